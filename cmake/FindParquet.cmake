@@ -0,0 +1,33 @@
+# Find the parquet library of Apache Arrow, which reads and writes Parquet files.
+# Output variables:
+#  PARQUET_INCLUDE_DIR : e.g., /usr/include/.
+#  PARQUET_LIBRARY     : Library path of parquet library
+#  ARROW_LIBRARY       : Library path of arrow library, which parquet depends on
+#  PARQUET_FOUND       : True if found.
+
+FIND_PATH(PARQUET_INCLUDE_DIR NAME parquet/api/reader.h HINTS
+    "$ENV{LIB_DIR}/include"
+    "$ENV{INCLUDE}"
+    /usr/local/opt/apache-arrow/include
+)
+
+FIND_LIBRARY(PARQUET_LIBRARY NAMES parquet PATHS
+    "$ENV{LIB_DIR}/lib"
+    "$ENV{LIB}/lib"
+    /usr/local/opt/apache-arrow/lib
+)
+
+FIND_LIBRARY(ARROW_LIBRARY NAMES arrow PATHS
+    "$ENV{LIB_DIR}/lib"
+    "$ENV{LIB}/lib"
+    /usr/local/opt/apache-arrow/lib
+)
+
+IF (PARQUET_INCLUDE_DIR AND PARQUET_LIBRARY AND ARROW_LIBRARY)
+    SET(PARQUET_FOUND TRUE)
+    MESSAGE(STATUS "Found parquet library: inc=${PARQUET_INCLUDE_DIR}, lib=${PARQUET_LIBRARY}, arrow=${ARROW_LIBRARY}")
+ELSE ()
+    SET(PARQUET_FOUND FALSE)
+    MESSAGE(STATUS "WARNING: parquet library not found, Parquet import and export will not be available.")
+    MESSAGE(STATUS "Try: 'sudo apt-get install libparquet-dev' (or brew install apache-arrow)")
+ENDIF ()
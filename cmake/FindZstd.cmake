@@ -0,0 +1,26 @@
+# Find the zstd library, which decompresses zstd-compressed input files.
+# Output variables:
+#  ZSTD_INCLUDE_DIR : e.g., /usr/include/.
+#  ZSTD_LIBRARY     : Library path of zstd library
+#  ZSTD_FOUND       : True if found.
+
+FIND_PATH(ZSTD_INCLUDE_DIR NAME zstd.h HINTS
+    "$ENV{LIB_DIR}/include"
+    "$ENV{INCLUDE}"
+    /usr/local/opt/zstd/include
+)
+
+FIND_LIBRARY(ZSTD_LIBRARY NAMES zstd PATHS
+    "$ENV{LIB_DIR}/lib"
+    "$ENV{LIB}/lib"
+    /usr/local/opt/zstd/lib
+)
+
+IF (ZSTD_INCLUDE_DIR AND ZSTD_LIBRARY)
+    SET(ZSTD_FOUND TRUE)
+    MESSAGE(STATUS "Found zstd library: inc=${ZSTD_INCLUDE_DIR}, lib=${ZSTD_LIBRARY}")
+ELSE ()
+    SET(ZSTD_FOUND FALSE)
+    MESSAGE(STATUS "WARNING: zstd library not found, zstd-compressed files cannot be imported.")
+    MESSAGE(STATUS "Try: 'sudo apt-get install libzstd-dev' (or brew install zstd)")
+ENDIF ()
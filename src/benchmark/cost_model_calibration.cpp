@@ -0,0 +1,314 @@
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "cost_model/cost_model_physical.hpp"
+#include "cxxopts.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+#include "utils/timer.hpp"
+
+using namespace opossum;                         // NOLINT
+using namespace opossum::expression_functional;  // NOLINT
+
+/**
+ * Fits the coefficients of the CostModelPhysical on the machine it runs on. The operators are executed on generated
+ * tables of increasing size, and each coefficient is fitted with a least-squares regression of the measured runtimes
+ * on the quantity that the coefficient is multiplied with, e.g., the number of scanned rows. The result is written as
+ * a JSON file that can be read with import_cost_model_coefficients().
+ *
+ * The default_row_cost is not measured, as it covers many different operators. It keeps its default value.
+ */
+
+namespace {
+
+// A measurement of an operator: the quantities that the fitted coefficients are multiplied with, and the runtime in
+// nanoseconds that is left to be explained by them
+struct Sample {
+  std::vector<float> features;
+  float runtime;
+};
+
+// Least-squares fit without intercept for one or two features
+std::vector<float> fit(const std::vector<Sample>& samples) {
+  const auto feature_count = samples.front().features.size();
+  if (feature_count == 1) {
+    auto xy = 0.0, xx = 0.0;
+    for (const auto& sample : samples) {
+      xy += sample.features[0] * sample.runtime;
+      xx += sample.features[0] * sample.features[0];
+    }
+    return {static_cast<float>(std::max(xy / xx, 0.0))};
+  }
+
+  // Solve the normal equations of the two features with Cramer's rule
+  auto x0x0 = 0.0, x0x1 = 0.0, x1x1 = 0.0, x0y = 0.0, x1y = 0.0;
+  for (const auto& sample : samples) {
+    const auto x0 = static_cast<double>(sample.features[0]);
+    const auto x1 = static_cast<double>(sample.features[1]);
+    x0x0 += x0 * x0;
+    x0x1 += x0 * x1;
+    x1x1 += x1 * x1;
+    x0y += x0 * sample.runtime;
+    x1y += x1 * sample.runtime;
+  }
+  const auto determinant = x0x0 * x1x1 - x0x1 * x0x1;
+  return {static_cast<float>(std::max((x0y * x1x1 - x1y * x0x1) / determinant, 0.0)),
+          static_cast<float>(std::max((x0x0 * x1y - x0x1 * x0y) / determinant, 0.0))};
+}
+
+class Calibration {
+ public:
+  Calibration(const std::vector<size_t>& row_counts, const size_t run_count)
+      : _row_counts(row_counts), _run_count(run_count) {}
+
+  CostModelCoefficients run() {
+    _calibrate_table_scans();
+    _calibrate_index_scan();
+    _calibrate_sort();
+    _calibrate_joins();
+    _calibrate_aggregate();
+    return _coefficients;
+  }
+
+ private:
+  // A table with a single int column with values between 0 and @param distinct_count
+  static std::shared_ptr<TableWrapper> _generate_table(const size_t row_count, const size_t distinct_count,
+                                                       const std::optional<EncodingType>& encoding_type = {}) {
+    const auto distribution = ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(distinct_count));
+    auto table = TableGenerator{}.generate_table({distribution}, row_count, CHUNK_SIZE, encoding_type);
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Executes a fresh operator @param run_count times and returns the fastest runtime and the output row count
+  std::pair<float, float> _measure(const std::function<std::shared_ptr<AbstractOperator>()>& make_operator) const {
+    auto min_runtime = std::numeric_limits<float>::max();
+    auto output_row_count = 0.0f;
+    for (auto run = size_t{0}; run < _run_count; ++run) {
+      const auto op = make_operator();
+      auto timer = Timer{};
+      op->execute();
+      min_runtime = std::min(min_runtime, static_cast<float>(timer.lap().count()));
+      output_row_count = static_cast<float>(op->get_output()->row_count());
+    }
+    return {min_runtime, output_row_count};
+  }
+
+  static std::shared_ptr<AbstractExpression> _column_a() { return pqp_column_(ColumnID{0}, DataType::Int, false, "a"); }
+
+  void _calibrate_table_scans() {
+    // Scans that select one percent of the rows, so that writing the output hardly matters
+    for (const auto encoding_type : {EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
+                                     EncodingType::FrameOfReference, EncodingType::LZ4, EncodingType::Delta}) {
+      auto samples = std::vector<Sample>{};
+      for (const auto row_count : _row_counts) {
+        const auto table = _generate_table(row_count, DISTINCT_COUNT,
+                                           encoding_type != EncodingType::Unencoded
+                                               ? std::optional<EncodingType>{encoding_type} : std::nullopt);
+        const auto [runtime, output_row_count] =
+            _measure([&]() { return std::make_shared<TableScan>(table, less_than_(_column_a(), 10)); });
+        samples.push_back({{static_cast<float>(row_count)}, runtime});
+      }
+      _coefficients.table_scan_row_costs[encoding_type] = fit(samples)[0];
+      std::cout << "Scan on " << encoding_type_to_string.left.at(encoding_type) << " segments: "
+                << _coefficients.table_scan_row_costs[encoding_type] << " ns per row" << std::endl;
+    }
+
+    // Scans that select all rows, with the scan of the input explained by the coefficient of unencoded segments
+    const auto scan_row_cost = _coefficients.table_scan_row_costs[EncodingType::Unencoded];
+    auto output_samples = std::vector<Sample>{};
+    auto reference_samples = std::vector<Sample>{};
+    auto expression_samples = std::vector<Sample>{};
+    for (const auto row_count : _row_counts) {
+      const auto table = _generate_table(row_count, DISTINCT_COUNT);
+      const auto [runtime, output_row_count] =
+          _measure([&]() { return std::make_shared<TableScan>(table, greater_than_equals_(_column_a(), 0)); });
+      output_samples.push_back({{output_row_count}, runtime - row_count * scan_row_cost});
+
+      const auto full_scan = std::make_shared<TableScan>(table, greater_than_equals_(_column_a(), 0));
+      full_scan->execute();
+      const auto [reference_runtime, reference_output_row_count] =
+          _measure([&]() { return std::make_shared<TableScan>(full_scan, less_than_(_column_a(), 10)); });
+      reference_samples.push_back({{static_cast<float>(row_count)}, reference_runtime - row_count * scan_row_cost});
+
+      // (a + 1) < 10 is evaluated by the ExpressionEvaluator and counts as six operations in the cost model
+      const auto [expression_runtime, expression_output_row_count] = _measure(
+          [&]() { return std::make_shared<TableScan>(table, less_than_(add_(_column_a(), 1), 10)); });
+      expression_samples.push_back({{row_count * 6.0f}, expression_runtime});
+    }
+    _coefficients.output_row_cost = fit(output_samples)[0];
+    _coefficients.reference_scan_row_cost = fit(reference_samples)[0];
+    _coefficients.expression_row_cost = fit(expression_samples)[0];
+    std::cout << "Output: " << _coefficients.output_row_cost << " ns per row" << std::endl;
+    std::cout << "Scan on reference segments: " << _coefficients.reference_scan_row_cost << " ns per row on top"
+              << std::endl;
+    std::cout << "Expression evaluation: " << _coefficients.expression_row_cost << " ns per row and operation"
+              << std::endl;
+  }
+
+  void _calibrate_index_scan() {
+    // Equality lookups of a single value and range lookups of a tenth of the values
+    auto samples = std::vector<Sample>{};
+    for (const auto row_count : _row_counts) {
+      const auto table = _generate_table(row_count, DISTINCT_COUNT, EncodingType::Dictionary);
+      const auto stored_table = std::const_pointer_cast<Table>(table->get_output());
+      stored_table->create_index<GroupKeyIndex>({ColumnID{0}});
+      const auto chunk_count = static_cast<float>(stored_table->chunk_count());
+
+      for (const auto& [predicate_condition, value] :
+           {std::pair{PredicateCondition::Equals, 10}, std::pair{PredicateCondition::LessThan, DISTINCT_COUNT / 10}}) {
+        const auto [runtime, output_row_count] = _measure([&, predicate_condition = predicate_condition,
+                                                           value = value]() {
+          return std::make_shared<IndexScan>(table, SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}},
+                                             predicate_condition, std::vector<AllTypeVariant>{value});
+        });
+        samples.push_back({{chunk_count, output_row_count}, runtime});
+      }
+    }
+    const auto coefficients = fit(samples);
+    _coefficients.index_scan_chunk_cost = coefficients[0];
+    _coefficients.index_scan_output_row_cost = coefficients[1];
+    std::cout << "IndexScan: " << _coefficients.index_scan_chunk_cost << " ns per chunk, "
+              << _coefficients.index_scan_output_row_cost << " ns per row" << std::endl;
+  }
+
+  void _calibrate_sort() {
+    auto samples = std::vector<Sample>{};
+    for (const auto row_count : _row_counts) {
+      const auto table = _generate_table(row_count, row_count);
+      const auto [runtime, output_row_count] = _measure([&]() { return std::make_shared<Sort>(table, ColumnID{0}); });
+      samples.push_back({{row_count * std::log2(static_cast<float>(row_count))},
+                         runtime - output_row_count * _coefficients.output_row_cost});
+    }
+    _coefficients.sort_row_cost = fit(samples)[0];
+    std::cout << "Sort: " << _coefficients.sort_row_cost << " ns per row and log2 of the row count" << std::endl;
+  }
+
+  void _calibrate_joins() {
+    const auto cost_model = CostModelPhysical{_coefficients};
+    const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+
+    // Inputs of the same size and a build input of a tenth of the size of the probe input, each with about one match
+    // per probe row
+    auto hash_join_samples = std::vector<Sample>{};
+    auto sort_merge_join_samples = std::vector<Sample>{};
+    for (const auto row_count : _row_counts) {
+      for (const auto build_row_count : {row_count, row_count / 10}) {
+        const auto build_table = _generate_table(build_row_count, build_row_count);
+        const auto probe_table = _generate_table(row_count, build_row_count);
+
+        const auto [runtime, output_row_count] = _measure([&]() {
+          return std::make_shared<JoinHash>(build_table, probe_table, JoinMode::Inner, column_ids,
+                                            PredicateCondition::Equals);
+        });
+        hash_join_samples.push_back({{static_cast<float>(build_row_count), static_cast<float>(row_count)},
+                                     runtime - output_row_count * _coefficients.output_row_cost});
+
+        const auto [sort_merge_runtime, sort_merge_output_row_count] = _measure([&]() {
+          return std::make_shared<JoinSortMerge>(build_table, probe_table, JoinMode::Inner, column_ids,
+                                                 PredicateCondition::Equals);
+        });
+        sort_merge_join_samples.push_back(
+            {{static_cast<float>(build_row_count + row_count)},
+             sort_merge_runtime - sort_merge_output_row_count * _coefficients.output_row_cost -
+                 cost_model.estimate_sort_cost(build_row_count) - cost_model.estimate_sort_cost(row_count)});
+      }
+    }
+    const auto hash_join_coefficients = fit(hash_join_samples);
+    _coefficients.hash_join_build_row_cost = hash_join_coefficients[0];
+    _coefficients.hash_join_probe_row_cost = hash_join_coefficients[1];
+    _coefficients.sort_merge_join_merge_row_cost = fit(sort_merge_join_samples)[0];
+    std::cout << "JoinHash: " << _coefficients.hash_join_build_row_cost << " ns per build row, "
+              << _coefficients.hash_join_probe_row_cost << " ns per probe row" << std::endl;
+    std::cout << "JoinSortMerge: " << _coefficients.sort_merge_join_merge_row_cost << " ns per merged row"
+              << std::endl;
+
+    // The JoinNestedLoop is only measured on small inputs, as its runtime grows quadratically
+    auto nested_loop_join_samples = std::vector<Sample>{};
+    for (const auto row_count : {size_t{100}, size_t{1'000}, size_t{3'000}}) {
+      const auto table = _generate_table(row_count, row_count);
+      const auto [runtime, output_row_count] = _measure([&]() {
+        return std::make_shared<JoinNestedLoop>(table, table, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+      });
+      nested_loop_join_samples.push_back({{static_cast<float>(row_count * row_count)},
+                                          runtime - output_row_count * _coefficients.output_row_cost});
+    }
+    _coefficients.nested_loop_join_row_pair_cost = fit(nested_loop_join_samples)[0];
+    std::cout << "JoinNestedLoop: " << _coefficients.nested_loop_join_row_pair_cost << " ns per pair of rows"
+              << std::endl;
+  }
+
+  void _calibrate_aggregate() {
+    auto samples = std::vector<Sample>{};
+    for (const auto row_count : _row_counts) {
+      const auto table = _generate_table(row_count, DISTINCT_COUNT);
+      const auto [runtime, output_row_count] = _measure([&]() {
+        return std::make_shared<Aggregate>(
+            table, std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}},
+            std::vector<ColumnID>{ColumnID{0}});
+      });
+      samples.push_back({{static_cast<float>(row_count)}, runtime - output_row_count * _coefficients.output_row_cost});
+    }
+    _coefficients.aggregate_row_cost = fit(samples)[0];
+    std::cout << "Aggregate: " << _coefficients.aggregate_row_cost << " ns per row" << std::endl;
+  }
+
+  static constexpr auto CHUNK_SIZE = size_t{100'000};
+  static constexpr auto DISTINCT_COUNT = 1'000;
+
+  const std::vector<size_t> _row_counts;
+  const size_t _run_count;
+  CostModelCoefficients _coefficients;
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"hyriseCostModelCalibration", "Fits the coefficients of the physical cost model"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit")
+    ("r,max_rows", "Number of rows of the largest generated table", cxxopts::value<size_t>()->default_value("1000000"))
+    ("runs", "Number of executions of each operator, of which the fastest is used", cxxopts::value<size_t>()->default_value("5")) // NOLINT
+    ("o,output", "File to write the coefficients to", cxxopts::value<std::string>()->default_value("cost_model_coefficients.json")); // NOLINT
+  // clang-format on
+
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+  if (cli_parse_result.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  // Tables with a hundredth, a tenth of, and the maximum number of rows
+  const auto max_row_count = cli_parse_result["max_rows"].as<size_t>();
+  const auto row_counts = std::vector<size_t>{max_row_count / 100, max_row_count / 10, max_row_count};
+
+  const auto coefficients = Calibration{row_counts, cli_parse_result["runs"].as<size_t>()}.run();
+
+  const auto output_path = cli_parse_result["output"].as<std::string>();
+  export_cost_model_coefficients(coefficients, output_path);
+  std::cout << "Wrote the coefficients to " << output_path << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <boost/algorithm/string.hpp>
+
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "benchmark_runner.hpp"
+#include "cli_config_parser.hpp"
+#include "cxxopts.hpp"
+#include "json.hpp"
+#include "ssb/ssb_query_generator.hpp"
+#include "ssb/ssb_table_generator.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark measures Hyrise's performance executing the 13 queries of the Star Schema Benchmark (SSB), a star
+ * schema variant of TPC-H with the fact table lineorder and the dimensions customer, supplier, part, and dwdate. See
+ * SSBTableGenerator for how the data is generated.
+ *
+ * main() is mostly concerned with parsing the CLI options while BenchmarkRunner.run() performs the actual benchmark
+ * logic.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("Star Schema Benchmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Database scale factor (1.0 ~ 1GB)", cxxopts::value<float>()->default_value("1"))
+    ("q,queries", "Specify queries to run (comma-separated query names, e.g. \"--queries 1.1,2.3,4.1\"), default is all", cxxopts::value<std::string>()); // NOLINT
+  // clang-format on
+
+  std::shared_ptr<BenchmarkConfig> config;
+  std::string comma_separated_queries;
+  float scale_factor;
+
+  if (CLIConfigParser::cli_has_json_config(argc, argv)) {
+    // JSON config file was passed in
+    const auto json_config = CLIConfigParser::parse_json_config_file(argv[1]);
+    scale_factor = json_config.value("scale", 0.1f);
+    comma_separated_queries = json_config.value("queries", std::string(""));
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_options_json_config(json_config));
+  } else {
+    // Parse regular command line args
+    const auto cli_parse_result = cli_options.parse(argc, argv);
+
+    if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+    if (cli_parse_result.count("queries")) {
+      comma_separated_queries = cli_parse_result["queries"].as<std::string>();
+    }
+
+    scale_factor = cli_parse_result["scale"].as<float>();
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_cli_options(cli_parse_result));
+  }
+
+  // Split the input into query names, ignoring leading, trailing, or duplicate commas
+  auto query_subset = std::optional<std::unordered_set<std::string>>{};
+  if (!comma_separated_queries.empty()) {
+    auto query_names = std::vector<std::string>{};
+    boost::trim_if(comma_separated_queries, boost::is_any_of(","));
+    boost::split(query_names, comma_separated_queries, boost::is_any_of(","), boost::token_compress_on);
+    query_subset.emplace(query_names.begin(), query_names.end());
+  }
+
+  std::cout << "- Benchmarking SSB with scale factor " << scale_factor << std::endl;
+
+  auto context = BenchmarkRunner::create_context(*config);
+  context.emplace("scale_factor", scale_factor);
+
+  BenchmarkRunner(*config, std::make_unique<SSBQueryGenerator>(query_subset),
+                  std::make_unique<SSBTableGenerator>(scale_factor, config), context)
+      .run();
+}
@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+/**
+ * Measures how fast segments can be read for each combination of encoding, vector compression, data type, and data
+ * distribution. Each segment is read in three ways:
+ *
+ *   SequentialIteration    All values are iterated with segment_iterate(), as most operators do
+ *   RandomAccess           Random positions are read with a SegmentAccessor, as, e.g., joins do for their output
+ *   TableScan              A TableScan selects roughly half of the values
+ *
+ * The benchmarks are registered for all combinations, e.g., BM_SegmentEncoding/Dictionary-SimdBp128/int/Skewed/
+ * RandomAccess. Use --benchmark_filter to select a subset.
+ */
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Rows per benchmarked segment
+constexpr auto ROW_COUNT = size_t{100'000};
+
+enum class DataDistribution { Sorted, Skewed, Unique };
+enum class AccessPattern { SequentialIteration, RandomAccess, TableScan };
+
+const auto data_distribution_names = std::vector<std::pair<DataDistribution, std::string>>{
+    {DataDistribution::Sorted, "Sorted"}, {DataDistribution::Skewed, "Skewed"}, {DataDistribution::Unique, "Unique"}};
+
+const auto access_pattern_names = std::vector<std::pair<AccessPattern, std::string>>{
+    {AccessPattern::SequentialIteration, "SequentialIteration"},
+    {AccessPattern::RandomAccess, "RandomAccess"},
+    {AccessPattern::TableScan, "TableScan"}};
+
+/**
+ * Generates the integers that are converted to the values of the segment:
+ *   Sorted    Ascending, each value is repeated ten times
+ *   Skewed    Log-uniformly distributed, so that small values are far more frequent than large ones
+ *   Unique    A random permutation of 0 .. ROW_COUNT - 1
+ */
+std::vector<int32_t> generate_integers(const DataDistribution distribution) {
+  auto integers = std::vector<int32_t>(ROW_COUNT);
+  auto random_engine = std::mt19937{42};
+
+  switch (distribution) {
+    case DataDistribution::Sorted:
+      for (auto row_id = size_t{0}; row_id < ROW_COUNT; ++row_id) integers[row_id] = static_cast<int32_t>(row_id / 10);
+      break;
+    case DataDistribution::Skewed: {
+      auto exponent_distribution = std::uniform_real_distribution<double>{0.0, 1.0};
+      for (auto& integer : integers) {
+        const auto exponent = exponent_distribution(random_engine);
+        integer = static_cast<int32_t>(std::pow(static_cast<double>(ROW_COUNT), exponent)) - 1;
+      }
+    } break;
+    case DataDistribution::Unique:
+      std::iota(integers.begin(), integers.end(), 0);
+      std::shuffle(integers.begin(), integers.end(), random_engine);
+      break;
+  }
+
+  return integers;
+}
+
+template <typename T>
+T convert_integer(const int32_t integer) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Zero-padded, so that the order of the strings is the order of the integers
+    const auto digits = std::to_string(integer);
+    return std::string(10 - digits.size(), '0') + digits;
+  } else {
+    return static_cast<T>(integer);
+  }
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> create_segment(const EncodingType encoding_type,
+                                            const std::optional<VectorCompressionType> vector_compression_type,
+                                            const DataDistribution distribution) {
+  const auto integers = generate_integers(distribution);
+
+  auto values = pmr_concurrent_vector<T>{};
+  values.reserve(ROW_COUNT);
+  for (const auto integer : integers) values.push_back(convert_integer<T>(integer));
+  auto value_segment = std::make_shared<ValueSegment<T>>(std::move(values));
+
+  if (encoding_type == EncodingType::Unencoded) return value_segment;
+  return encode_segment(encoding_type, data_type_from_type<T>(), value_segment, vector_compression_type);
+}
+
+template <typename T>
+void benchmark_segment(benchmark::State& state, const EncodingType encoding_type,
+                       const std::optional<VectorCompressionType> vector_compression_type,
+                       const DataDistribution distribution, const AccessPattern access_pattern) {
+  const auto segment = create_segment<T>(encoding_type, vector_compression_type, distribution);
+
+  switch (access_pattern) {
+    case AccessPattern::SequentialIteration: {
+      for (auto _ : state) {
+        segment_iterate<T>(*segment, [&](const auto& position) {
+          benchmark::DoNotOptimize(position.is_null());
+          benchmark::DoNotOptimize(position.value());
+        });
+      }
+    } break;
+
+    case AccessPattern::RandomAccess: {
+      auto random_engine = std::mt19937{42};
+      auto offset_distribution = std::uniform_int_distribution<ChunkOffset>{0, static_cast<ChunkOffset>(ROW_COUNT - 1)};
+      auto offsets = std::vector<ChunkOffset>(ROW_COUNT);
+      for (auto& offset : offsets) offset = offset_distribution(random_engine);
+
+      for (auto _ : state) {
+        const auto accessor = create_segment_accessor<T>(segment);
+        for (const auto offset : offsets) {
+          benchmark::DoNotOptimize(accessor->access(offset));
+        }
+      }
+    } break;
+
+    case AccessPattern::TableScan: {
+      auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", data_type_from_type<T>()}}, TableType::Data);
+      table->append_chunk(Segments{segment});
+      const auto table_wrapper = std::make_shared<TableWrapper>(table);
+      table_wrapper->execute();
+
+      // Selects about half of the values by comparing with the median
+      auto integers = generate_integers(distribution);
+      const auto median = integers.begin() + ROW_COUNT / 2;
+      std::nth_element(integers.begin(), median, integers.end());
+
+      const auto column = pqp_column_(ColumnID{0}, data_type_from_type<T>(), false, "a");
+      const auto predicate = less_than_(column, value_(convert_integer<T>(*median)));
+      for (auto _ : state) {
+        const auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+        table_scan->execute();
+      }
+    } break;
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * ROW_COUNT));
+}
+
+// The vector compressions that are benchmarked for an encoding. Encodings without vector compression use std::nullopt.
+std::vector<std::optional<VectorCompressionType>> vector_compression_types(const EncodingType encoding_type) {
+  if (encoding_type == EncodingType::Unencoded || !create_encoder(encoding_type)->uses_vector_compression()) {
+    return {std::nullopt};
+  }
+  return {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128};
+}
+
+void register_segment_encoding_benchmarks() {
+  // The mappings in constant_mappings.hpp might not be initialized yet when the benchmarks are registered
+  const auto encoding_names = std::vector<std::pair<EncodingType, std::string>>{
+      {EncodingType::Unencoded, "Unencoded"},
+      {EncodingType::Dictionary, "Dictionary"},
+      {EncodingType::RunLength, "RunLength"},
+      {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
+      {EncodingType::FrameOfReference, "FrameOfReference"},
+      {EncodingType::LZ4, "LZ4"},
+      {EncodingType::Delta, "Delta"}};
+  const auto data_type_names = std::vector<std::pair<DataType, std::string>>{{DataType::Int, "int"},
+                                                                              {DataType::Long, "long"},
+                                                                              {DataType::Float, "float"},
+                                                                              {DataType::Double, "double"},
+                                                                              {DataType::String, "string"}};
+
+  for (const auto& [encoding_type, encoding_name] : encoding_names) {
+    for (const auto& vector_compression_type : vector_compression_types(encoding_type)) {
+      auto full_encoding_name = encoding_name;
+      if (vector_compression_type) {
+        full_encoding_name += *vector_compression_type == VectorCompressionType::SimdBp128 ? "-SimdBp128"
+                                                                                           : "-FixedSizeByteAligned";
+      }
+
+      for (const auto& [data_type, data_type_name] : data_type_names) {
+        if (!encoding_supports_data_type(encoding_type, data_type)) continue;
+
+        for (const auto& [distribution, distribution_name] : data_distribution_names) {
+          for (const auto& [access_pattern, access_pattern_name] : access_pattern_names) {
+            const auto name = "BM_SegmentEncoding/" + full_encoding_name + "/" + data_type_name + "/" +
+                              distribution_name + "/" + access_pattern_name;
+
+            resolve_data_type(data_type, [&](const auto data_type_t) {
+              using ColumnDataType = typename decltype(data_type_t)::type;
+              benchmark::RegisterBenchmark(name.c_str(), benchmark_segment<ColumnDataType>, encoding_type,
+                                           vector_compression_type, distribution, access_pattern);
+            });
+          }
+        }
+      }
+    }
+  }
+}
+
+// Registers the benchmarks before main() runs, like the BENCHMARK macros do
+[[maybe_unused]] const auto segment_encoding_benchmarks_registered = (register_segment_encoding_benchmarks(), true);
+
+}  // namespace
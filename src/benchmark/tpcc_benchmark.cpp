@@ -0,0 +1,57 @@
+#include <iostream>
+#include <memory>
+
+#include "benchmark_runner.hpp"
+#include "cli_config_parser.hpp"
+#include "cxxopts.hpp"
+#include "json.hpp"
+#include "tpcc/tpcc_benchmark_runner.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark measures Hyrise's performance executing the TPC-C transactions with concurrent clients. Like the
+ * TPC-H benchmark, it does not run the TPC-C *benchmark* exactly as it is specified (e.g., there are no keying and
+ * think times). See TpccBenchmarkRunner for details.
+ *
+ * Of the basic benchmark options, the number of clients, the duration (--time), and the warmup duration are used. The
+ * clients always run concurrently, the scheduler only decides how the operators of their statements are executed.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("TPC-C Benchmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Number of warehouses", cxxopts::value<size_t>()->default_value("1")); // NOLINT
+  // clang-format on
+
+  std::shared_ptr<BenchmarkConfig> config;
+  size_t num_warehouses;
+
+  if (CLIConfigParser::cli_has_json_config(argc, argv)) {
+    // JSON config file was passed in
+    const auto json_config = CLIConfigParser::parse_json_config_file(argv[1]);
+    num_warehouses = json_config.value("scale", size_t{1});
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_options_json_config(json_config));
+  } else {
+    // Parse regular command line args
+    const auto cli_parse_result = cli_options.parse(argc, argv);
+
+    if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) return 0;
+
+    num_warehouses = cli_parse_result["scale"].as<size_t>();
+
+    config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_basic_cli_options(cli_parse_result));
+  }
+
+  Assert(!config->verify, "The TPC-C benchmark cannot be verified with SQLite");
+  std::cout << "- Benchmarking TPC-C with " << num_warehouses << " warehouse(s)" << std::endl;
+
+  auto context = BenchmarkRunner::create_context(*config);
+  context.emplace("scale_factor", num_warehouses);
+
+  TpccBenchmarkRunner(*config, num_warehouses, context).run();
+}
@@ -3,6 +3,7 @@
 #include "benchmark_config.hpp"
 #include "benchmark_table_encoder.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/timer.hpp"
@@ -54,6 +55,7 @@ void AbstractTableGenerator::generate_and_store() {
 
       std::cout << "- Writing '" << table_name << "' into binary file '" << binary_file_path << "' " << std::flush;
       Timer per_table_timer;
+      if (binary_file_path.has_parent_path()) std::filesystem::create_directories(binary_file_path.parent_path());
       ExportBinary::write_binary(*table_info.table, binary_file_path);
       std::cout << "(" << per_table_timer.lap_formatted() << ")" << std::endl;
     }
@@ -77,4 +79,45 @@ void AbstractTableGenerator::generate_and_store() {
             << std::endl;
 }
 
+std::shared_ptr<BenchmarkConfig> AbstractTableGenerator::_create_minimal_benchmark_config(uint32_t chunk_size) {
+  auto config = BenchmarkConfig::get_default_config();
+  config.chunk_size = chunk_size;
+  return std::make_shared<BenchmarkConfig>(config);
+}
+
+std::unordered_map<std::string, BenchmarkTableInfo> AbstractTableGenerator::_load_binary_tables_from_directory(
+    const std::filesystem::path& directory, const std::vector<std::string>& table_names) const {
+  auto table_info_by_name = std::unordered_map<std::string, BenchmarkTableInfo>{};
+  if (!_benchmark_config->cache_binary_tables) return table_info_by_name;
+
+  for (const auto& table_name : table_names) {
+    if (!std::filesystem::is_regular_file(directory / (table_name + ".bin"))) return table_info_by_name;
+  }
+
+  for (const auto& table_name : table_names) {
+    const auto binary_file_path = directory / (table_name + ".bin");
+    std::cout << "-  Loading table '" << table_name << "' from " << binary_file_path << std::flush;
+    Timer timer;
+
+    auto& table_info = table_info_by_name[table_name];
+    table_info.table = ImportBinary::read_binary(binary_file_path);
+    table_info.binary_file_path = binary_file_path;
+    table_info.loaded_from_binary = true;
+
+    std::cout << " (" << table_info.table->row_count() << " rows; " << timer.lap_formatted() << ")" << std::endl;
+  }
+
+  return table_info_by_name;
+}
+
+void AbstractTableGenerator::_set_binary_file_paths(
+    std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name,
+    const std::filesystem::path& directory) const {
+  if (!_benchmark_config->cache_binary_tables) return;
+
+  for (auto& [table_name, table_info] : table_info_by_name) {
+    table_info.binary_file_path = directory / (table_name + ".bin");
+  }
+}
+
 }  // namespace opossum
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <filesystem>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "encoding_config.hpp"
 #include "storage/chunk.hpp"
@@ -51,6 +54,17 @@ class AbstractTableGenerator {
    */
   static std::shared_ptr<BenchmarkConfig> _create_minimal_benchmark_config(uint32_t chunk_size);
 
+  /**
+   * Binary caching for generated tables: If BenchmarkConfig::cache_binary_tables is set and @param directory holds a
+   * binary file for each of the @param table_names, the tables are loaded from these files. Otherwise, an empty map is
+   * returned, and the generator has to generate the tables and call _set_binary_file_paths(), so that
+   * generate_and_store() writes them into @param directory.
+   */
+  std::unordered_map<std::string, BenchmarkTableInfo> _load_binary_tables_from_directory(
+      const std::filesystem::path& directory, const std::vector<std::string>& table_names) const;
+  void _set_binary_file_paths(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name,
+                              const std::filesystem::path& directory) const;
+
   const std::shared_ptr<BenchmarkConfig> _benchmark_config;
 };
 
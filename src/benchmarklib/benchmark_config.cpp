@@ -7,7 +7,9 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const Chunk
                                  const Duration& max_duration, const Duration& warmup_duration, const UseMvcc use_mvcc,
                                  const std::optional<std::string>& output_file_path, const bool enable_scheduler,
                                  const uint32_t cores, const uint32_t clients, const bool enable_visualization,
-                                 const bool verify, const bool cache_binary_tables)
+                                 const bool verify, const bool cache_binary_tables,
+                                 const bool enable_performance_counters,
+                                 const std::optional<HugePageSize> huge_page_size)
     : benchmark_mode(benchmark_mode),
       chunk_size(chunk_size),
       encoding_config(encoding_config),
@@ -21,7 +23,9 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode benchmark_mode, const Chunk
       clients(clients),
       enable_visualization(enable_visualization),
       verify(verify),
-      cache_binary_tables(cache_binary_tables) {}
+      cache_binary_tables(cache_binary_tables),
+      enable_performance_counters(enable_performance_counters),
+      huge_page_size(huge_page_size) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() { return BenchmarkConfig(); }
 
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
+#include <string>
 
 #include "encoding_config.hpp"
+#include "utils/huge_page_memory_resource.hpp"
 #include "utils/null_streambuf.hpp"
 
 namespace opossum {
@@ -24,7 +27,8 @@ class BenchmarkConfig {
                   const Duration& warmup_duration, const UseMvcc use_mvcc,
                   const std::optional<std::string>& output_file_path, const bool enable_scheduler, const uint32_t cores,
                   const uint32_t clients, const bool enable_visualization, const bool verify,
-                  const bool cache_binary_tables);
+                  const bool cache_binary_tables, const bool enable_performance_counters,
+                  const std::optional<HugePageSize> huge_page_size);
 
   static BenchmarkConfig get_default_config();
 
@@ -42,6 +46,9 @@ class BenchmarkConfig {
   bool enable_visualization = false;
   bool verify = false;
   bool cache_binary_tables = false;
+  bool enable_performance_counters = false;
+  // If set, large allocations of the default memory resource are placed on huge pages of this size
+  std::optional<HugePageSize> huge_page_size = std::nullopt;
 
   static const char* description;
 
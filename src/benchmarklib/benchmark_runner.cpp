@@ -1,7 +1,13 @@
 #include <json.hpp>
 
 #include <boost/range/adaptors.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <random>
+#include <utility>
+#include <vector>
 
 #include "cxxopts.hpp"
 
@@ -10,6 +16,7 @@
 #include "benchmark_state.hpp"
 #include "constant_mappings.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/scheduler_statistics.hpp"
 #include "sql/create_sql_parser_error_message.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/chunk.hpp"
@@ -17,13 +24,92 @@
 #include "storage/storage_manager.hpp"
 #include "tpch/tpch_table_generator.hpp"
 #include "utils/check_table_equal.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/huge_page_memory_resource.hpp"
+#include "utils/performance_counters.hpp"
 #include "utils/sqlite_wrapper.hpp"
 #include "utils/timer.hpp"
 #include "version.hpp"
 #include "visualization/lqp_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
 
+namespace {
+
+// The percentiles of the run times that are reported for each query
+constexpr auto LATENCY_PERCENTILES =
+    std::array<std::pair<const char*, double>, 4>{{{"p50", 0.5}, {"p90", 0.9}, {"p99", 0.99}, {"p99.9", 0.999}}};
+
+// The throughput over time is reported for windows of this length
+constexpr auto THROUGHPUT_WINDOW = std::chrono::seconds{1};
+
+// Returns the run time below which the given fraction of the runs finished (nearest-rank method)
+opossum::Duration duration_percentile(const std::vector<opossum::Duration>& sorted_durations, const double fraction) {
+  if (sorted_durations.empty()) return opossum::Duration{};
+
+  const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted_durations.size())));
+  return sorted_durations[std::max(rank, size_t{1}) - 1];
+}
+
+std::vector<opossum::Duration> sorted_durations(const tbb::concurrent_vector<opossum::Duration>& durations) {
+  auto sorted = std::vector<opossum::Duration>(durations.begin(), durations.end());
+  std::sort(sorted.begin(), sorted.end());
+  return sorted;
+}
+
+// Sums up the hardware events of the operators of a query run. Returns std::nullopt if no operator measured them.
+std::optional<opossum::PerformanceCounterValues> sum_performance_counters(
+    const std::vector<std::shared_ptr<const opossum::OperatorPerformanceData>>& operator_performance_data) {
+  auto sum = std::optional<opossum::PerformanceCounterValues>{};
+  for (const auto& performance_data : operator_performance_data) {
+    if (!performance_data->performance_counters) continue;
+    if (!sum) sum.emplace();
+    *sum += *performance_data->performance_counters;
+  }
+  return sum;
+}
+
+// Records the hardware events and the memory usage of the operators of a query run in the result of the query
+void record_operator_performance_data(
+    opossum::QueryBenchmarkResult& result,
+    const std::vector<std::shared_ptr<const opossum::OperatorPerformanceData>>& operator_performance_data) {
+  if (const auto performance_counters = sum_performance_counters(operator_performance_data)) {
+    result.iteration_performance_counters.push_back(*performance_counters);
+  }
+
+  // The outputs of the operators are retained until the query is done, while the memory that an operator uses
+  // temporarily (e.g., for hash tables) is released once it is done. Assuming that the operators do not run
+  // concurrently, the peak memory usage of the run is the sum of the retained bytes plus the largest temporary usage.
+  auto retained_bytes = size_t{0};
+  auto max_temporary_bytes = size_t{0};
+  for (const auto& performance_data : operator_performance_data) {
+    retained_bytes += performance_data->retained_memory_usage_bytes;
+    max_temporary_bytes = std::max(
+        max_temporary_bytes, performance_data->peak_memory_usage_bytes - performance_data->retained_memory_usage_bytes);
+  }
+  const auto peak_memory_usage_bytes = retained_bytes + max_temporary_bytes;
+
+  auto previous_peak_memory_usage_bytes = result.peak_memory_usage_bytes.load();
+  while (previous_peak_memory_usage_bytes < peak_memory_usage_bytes &&
+         !result.peak_memory_usage_bytes.compare_exchange_weak(previous_peak_memory_usage_bytes,
+                                                               peak_memory_usage_bytes)) {
+  }
+}
+
+// Averages the hardware events over the runs of a query
+opossum::PerformanceCounterValues average_performance_counters(
+    const tbb::concurrent_vector<opossum::PerformanceCounterValues>& iteration_performance_counters) {
+  auto sum = opossum::PerformanceCounterValues{};
+  for (const auto& performance_counters : iteration_performance_counters) sum += performance_counters;
+
+  const auto iteration_count = std::max(iteration_performance_counters.size(), size_t{1});
+  return opossum::PerformanceCounterValues{sum.cycles / iteration_count, sum.instructions / iteration_count,
+                                           sum.cache_misses / iteration_count, sum.tlb_misses / iteration_count,
+                                           sum.branch_misses / iteration_count};
+}
+
+}  // namespace
+
 namespace opossum {
 
 BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractQueryGenerator> query_generator,
@@ -50,10 +136,27 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<
 
     const auto scheduler = std::make_shared<NodeQueueScheduler>();
     CurrentScheduler::set(scheduler);
+
+    // The queue depths over time are part of the scheduler statistics in the report
+    scheduler->start_queue_depth_sampling(std::chrono::milliseconds{100});
+  }
+
+  if (config.enable_performance_counters) {
+    Assert(PerformanceCounters::read(),
+           "Hardware performance counters are not available, see /proc/sys/kernel/perf_event_paranoid");
+    PerformanceCounters::set_enabled(true);
+  }
+
+  // Enabled before the tables are generated, so that their segments are placed on huge pages as well
+  if (config.huge_page_size) {
+    HugePageMemoryResource::enable_for_default_resource(HugePageMemoryResource::HUGE_PAGE_BYTES,
+                                                        *config.huge_page_size);
   }
 }
 
 BenchmarkRunner::~BenchmarkRunner() {
+  PerformanceCounters::set_enabled(false);
+
   if (CurrentScheduler::is_set()) {
     CurrentScheduler::get()->finish();
   }
@@ -191,7 +294,8 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
         // to measure its duration as well as signal that the query was finished
         const auto query_run_begin = std::chrono::steady_clock::now();
         auto on_query_done = [query_run_begin, query_id, number_of_queries, &currently_running_clients,
-                              &finished_query_set_runs, &finished_queries_total, &state, this]() {
+                              &finished_query_set_runs, &finished_queries_total, &state,
+                              this](const auto& operator_performance_data) {
           if (finished_queries_total++ % number_of_queries == 0) {
             currently_running_clients--;
             finished_query_set_runs++;
@@ -202,6 +306,8 @@ void BenchmarkRunner::_benchmark_permuted_query_set() {
             auto& result = _query_results[query_id];
             result.duration += duration;
             result.iteration_durations.push_back(duration);
+            result.iteration_ends.push_back(std::chrono::high_resolution_clock::now() - state.benchmark_begin);
+            record_operator_performance_data(result, operator_performance_data);
             result.num_iterations++;
           }
         };
@@ -245,12 +351,15 @@ void BenchmarkRunner::_benchmark_individual_queries() {
         // The on_query_done callback will be appended to the last Task of the query,
         // to measure its duration as well as signal that the query was finished
         const auto query_run_begin = std::chrono::steady_clock::now();
-        auto on_query_done = [query_run_begin, &currently_running_clients, &result, &state]() {
+        auto on_query_done = [query_run_begin, &currently_running_clients, &result,
+                              &state](const auto& operator_performance_data) {
           currently_running_clients--;
           if (!state.is_done()) {  // To prevent queries to add their results after the time is up
             const auto query_run_end = std::chrono::steady_clock::now();
             result.num_iterations++;
             result.iteration_durations.push_back(query_run_end - query_run_begin);
+            result.iteration_ends.push_back(std::chrono::high_resolution_clock::now() - state.benchmark_begin);
+            record_operator_performance_data(result, operator_performance_data);
           }
         };
 
@@ -270,6 +379,23 @@ void BenchmarkRunner::_benchmark_individual_queries() {
     std::cout << "  -> Executed " << result.num_iterations << " times in " << duration_seconds << " seconds ("
               << items_per_second << " iter/s)" << std::endl;
 
+    const auto durations = sorted_durations(result.iteration_durations);
+    std::cout << "  -> Latency:";
+    for (const auto& [percentile_name, fraction] : LATENCY_PERCENTILES) {
+      const auto latency = std::chrono::duration<double, std::milli>(duration_percentile(durations, fraction));
+      std::cout << " " << percentile_name << " " << latency.count() << " ms";
+    }
+    std::cout << std::endl;
+
+    if (result.peak_memory_usage_bytes > 0) {
+      std::cout << "  -> Peak memory usage of the operators: " << format_bytes(result.peak_memory_usage_bytes)
+                << std::endl;
+    }
+    if (!result.iteration_performance_counters.empty()) {
+      std::cout << "  -> Per run: " << average_performance_counters(result.iteration_performance_counters).to_string()
+                << std::endl;
+    }
+
     // Wait for the rest of the tasks that didn't make it in time - they will not count toward the results
     // TODO(leander/anyone): To be replaced with something like CurrentScheduler::abort(),
     // that properly removes all remaining tasks from all queues, without having to wait for them
@@ -300,7 +426,7 @@ void BenchmarkRunner::_warmup_query(const QueryID query_id) {
 
       // The on_query_done callback will be appended to the last Task of the query,
       // to signal that the query was finished
-      auto on_query_done = [&currently_running_clients]() { currently_running_clients--; };
+      auto on_query_done = [&currently_running_clients](const auto&) { currently_running_clients--; };
 
       auto query_tasks = _schedule_or_execute_query(query_id, on_query_done);
       tasks.insert(tasks.end(), query_tasks.begin(), query_tasks.end());
@@ -318,7 +444,7 @@ void BenchmarkRunner::_warmup_query(const QueryID query_id) {
 }
 
 std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_or_execute_query(
-    const QueryID query_id, const std::function<void()>& done_callback) {
+    const QueryID query_id, const QueryDoneCallback& done_callback) {
   // Some queries (like TPC-H 15) require execution before we can call get_tasks() on the pipeline.
   // These queries can't be scheduled yet, therefore we fall back to "just" executing the query
   // when we don't use the scheduler anyway, so that they can be executed.
@@ -330,7 +456,7 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_or_execute
 }
 
 std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
-    const QueryID query_id, const std::function<void()>& done_callback) {
+    const QueryID query_id, const QueryDoneCallback& done_callback) {
   auto sql = _query_generator->build_query(query_id);
 
   auto query_tasks = std::vector<std::shared_ptr<AbstractTask>>();
@@ -340,7 +466,16 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
   auto pipeline = pipeline_builder.create_pipeline();
 
   auto tasks_per_statement = pipeline.get_tasks();
-  tasks_per_statement.back().back()->set_done_callback(done_callback);
+
+  // The performance data of the operators is read once the last task, which depends on all others, is done
+  auto operator_performance_data = std::vector<std::shared_ptr<const OperatorPerformanceData>>{};
+  for (const auto& tasks : tasks_per_statement) {
+    for (const auto& task : tasks) {
+      operator_performance_data.emplace_back(task->get_operator()->shared_performance_data());
+    }
+  }
+  tasks_per_statement.back().back()->set_done_callback(
+      [done_callback, operator_performance_data]() { done_callback(operator_performance_data); });
 
   for (auto tasks : tasks_per_statement) {
     CurrentScheduler::schedule_tasks(tasks);
@@ -353,7 +488,7 @@ std::vector<std::shared_ptr<AbstractTask>> BenchmarkRunner::_schedule_query(
   return query_tasks;
 }
 
-void BenchmarkRunner::_execute_query(const QueryID query_id, const std::function<void()>& done_callback) {
+void BenchmarkRunner::_execute_query(const QueryID query_id, const QueryDoneCallback& done_callback) {
   auto sql = _query_generator->build_query(query_id);
 
   auto pipeline_builder = SQLPipelineBuilder{sql}.with_mvcc(_config.use_mvcc);
@@ -399,7 +534,15 @@ void BenchmarkRunner::_execute_query(const QueryID query_id, const std::function
     }
   }
 
-  if (done_callback) done_callback();
+  if (done_callback) {
+    auto operator_performance_data = std::vector<std::shared_ptr<const OperatorPerformanceData>>{};
+    for (const auto& statement_metrics : pipeline.metrics().statement_metrics) {
+      for (const auto& description_and_performance_data : statement_metrics->operator_performance_data) {
+        operator_performance_data.emplace_back(description_and_performance_data.second);
+      }
+    }
+    done_callback(operator_performance_data);
+  }
 
   // If necessary, keep plans for visualization
   _store_plan(query_id, pipeline);
@@ -437,13 +580,47 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
                      return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
                    });
 
+    // Percentiles describe the tail of the run times, which the average hides
+    const auto durations = sorted_durations(query_result.iteration_durations);
+    nlohmann::json latency_percentiles;
+    for (const auto& [percentile_name, fraction] : LATENCY_PERCENTILES) {
+      latency_percentiles[percentile_name] =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(duration_percentile(durations, fraction)).count();
+    }
+
+    // Number of runs that finished in each window since the begin of the benchmark
+    auto window_iterations = std::vector<size_t>{};
+    for (const auto& iteration_end : query_result.iteration_ends) {
+      const auto window_id = static_cast<size_t>(iteration_end / THROUGHPUT_WINDOW);
+      if (window_id >= window_iterations.size()) window_iterations.resize(window_id + 1);
+      ++window_iterations[window_id];
+    }
+    const auto window_seconds = std::chrono::duration<double>(THROUGHPUT_WINDOW).count();
+    auto window_items_per_second = std::vector<double>{};
+    window_items_per_second.reserve(window_iterations.size());
+    for (const auto iterations : window_iterations) {
+      window_items_per_second.emplace_back(static_cast<double>(iterations) / window_seconds);
+    }
+
     nlohmann::json benchmark{{"name", name},
                              {"iterations", query_result.num_iterations.load()},
                              {"iteration_durations", iteration_durations},
                              {"avg_real_time_per_iteration", time_per_query},
+                             {"latency_percentiles", latency_percentiles},
                              {"items_per_second", items_per_second},
+                             {"throughput_window_in_s", window_seconds},
+                             {"items_per_second_per_window", window_items_per_second},
                              {"time_unit", "ns"}};
 
+    if (query_result.peak_memory_usage_bytes > 0) {
+      benchmark["peak_memory_usage_bytes"] = query_result.peak_memory_usage_bytes.load();
+    }
+
+    if (!query_result.iteration_performance_counters.empty()) {
+      benchmark["performance_counters_per_iteration"] =
+          average_performance_counters(query_result.iteration_performance_counters).to_json();
+    }
+
     if (_config.verify) {
       Assert(query_result.verification_passed, "Verification should have been performed");
       benchmark["verification_passed"] = *query_result.verification_passed;
@@ -464,6 +641,10 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
 
   nlohmann::json report{{"context", _context}, {"benchmarks", benchmarks}, {"summary", summary}};
 
+  if (CurrentScheduler::is_set()) {
+    report["scheduler"] = CurrentScheduler::get()->statistics().to_json();
+  }
+
   stream << std::setw(2) << report << std::endl;
 }
 
@@ -496,7 +677,9 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("performance_counters", "Measure cycles, instructions, cache, TLB, and branch misses of each operator (Linux only)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("huge_pages", "Place large segments, hash tables, and partitions on huge pages: off, transparent, 2MB, or 1GB (explicit huge pages have to be reserved, Linux only)", cxxopts::value<std::string>()->default_value("off")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -520,6 +703,21 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
   #endif
   // clang-format on
 
+  auto huge_pages = "off";
+  if (config.huge_page_size) {
+    switch (*config.huge_page_size) {
+      case HugePageSize::Transparent:
+        huge_pages = "transparent";
+        break;
+      case HugePageSize::Explicit2MB:
+        huge_pages = "2MB";
+        break;
+      case HugePageSize::Explicit1GB:
+        huge_pages = "1GB";
+        break;
+    }
+  }
+
   return nlohmann::json{
       {"date", timestamp_stream.str()},
       {"chunk_size", config.chunk_size},
@@ -537,6 +735,8 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
+      {"using_performance_counters", config.enable_performance_counters},
+      {"huge_pages", huge_pages},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
 
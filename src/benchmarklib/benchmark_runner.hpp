@@ -4,6 +4,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <optional>
 #include <unordered_map>
@@ -29,6 +30,10 @@ class SQLiteWrapper;
 
 class BenchmarkRunner {
  public:
+  // Called when a run of a query finished, with the performance data of its operators
+  using QueryDoneCallback =
+      std::function<void(const std::vector<std::shared_ptr<const OperatorPerformanceData>>& operator_performance_data)>;
+
   BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractQueryGenerator> query_generator,
                   std::unique_ptr<AbstractTableGenerator> table_generator, const nlohmann::json& context);
   ~BenchmarkRunner();
@@ -51,14 +56,14 @@ class BenchmarkRunner {
 
   // Calls _schedule_query if the scheduler is active, otherwise calls _execute_query and returns no tasks
   std::vector<std::shared_ptr<AbstractTask>> _schedule_or_execute_query(const QueryID query_id,
-                                                                        const std::function<void()>& done_callback);
+                                                                        const QueryDoneCallback& done_callback);
 
   // Schedule and return all tasks for named_query
   std::vector<std::shared_ptr<AbstractTask>> _schedule_query(const QueryID query_id,
-                                                             const std::function<void()>& done_callback);
+                                                             const QueryDoneCallback& done_callback);
 
   // Execute named_query
-  void _execute_query(const QueryID query_id, const std::function<void()>& done_callback);
+  void _execute_query(const QueryID query_id, const QueryDoneCallback& done_callback);
 
   // If visualization is enabled, stores an executed plan
   void _store_plan(const QueryID query_id, SQLPipeline& pipeline);
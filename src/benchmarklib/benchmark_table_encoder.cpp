@@ -58,6 +58,12 @@ bool is_chunk_encoding_spec_satisfied(const ChunkEncodingSpec& expected_chunk_en
   if (expected_chunk_encoding_spec.size() != actual_chunk_encoding_spec.size()) return false;
 
   for (auto column_id = ColumnID{0}; column_id < actual_chunk_encoding_spec.size(); ++column_id) {
+    // Any encoding satisfies Auto. Unencoded segments have not been encoded yet, as Auto never leaves them unencoded.
+    if (expected_chunk_encoding_spec[column_id].encoding_type == EncodingType::Auto) {
+      if (actual_chunk_encoding_spec[column_id].encoding_type == EncodingType::Unencoded) return false;
+      continue;
+    }
+
     if (expected_chunk_encoding_spec[column_id].encoding_type != actual_chunk_encoding_spec[column_id].encoding_type) {
       return false;
     }
@@ -79,11 +85,9 @@ bool is_chunk_encoding_spec_satisfied(const ChunkEncodingSpec& expected_chunk_en
 
 namespace opossum {
 
-bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
-                                   const EncodingConfig& encoding_config) {
-  /**
-   * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
-   */
+ChunkEncodingSpec BenchmarkTableEncoder::chunk_encoding_spec(const std::string& table_name,
+                                                             const TableColumnDefinitions& column_definitions,
+                                                             const EncodingConfig& encoding_config) {
   const auto& type_mapping = encoding_config.type_encoding_mapping;
   const auto& custom_mapping = encoding_config.custom_encoding_mapping;
 
@@ -92,12 +96,11 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
   ChunkEncodingSpec chunk_encoding_spec;
 
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (const auto& column_definition : column_definitions) {
     // Check if a column specific encoding was specified
     if (table_has_custom_encoding) {
-      const auto& column_name = table->column_name(column_id);
       const auto& encoding_by_column_name = column_mapping_it->second;
-      const auto& segment_encoding = encoding_by_column_name.find(column_name);
+      const auto& segment_encoding = encoding_by_column_name.find(column_definition.name);
       if (segment_encoding != encoding_by_column_name.end()) {
         // The column type has a custom encoding
         chunk_encoding_spec.push_back(segment_encoding->second);
@@ -106,8 +109,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
 
     // Check if a type specific encoding was specified
-    const auto& column_data_type = table->column_data_type(column_id);
-    const auto& encoding_by_data_type = type_mapping.find(column_data_type);
+    const auto& encoding_by_data_type = type_mapping.find(column_definition.data_type);
     if (encoding_by_data_type != type_mapping.end()) {
       // The column type has a specific encoding
       chunk_encoding_spec.push_back(encoding_by_data_type->second);
@@ -116,14 +118,33 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
     // No column-specific or type-specific encoding was specified.
     // Use default if it is compatible with the column type or leave column Unencoded if it is not.
-    if (encoding_supports_data_type(encoding_config.default_encoding_spec.encoding_type, column_data_type)) {
+    if (encoding_supports_data_type(encoding_config.default_encoding_spec.encoding_type, column_definition.data_type)) {
       chunk_encoding_spec.push_back(encoding_config.default_encoding_spec);
     } else {
+      chunk_encoding_spec.push_back(EncodingType::Unencoded);
+    }
+  }
+
+  return chunk_encoding_spec;
+}
+
+bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::shared_ptr<Table>& table,
+                                   const EncodingConfig& encoding_config) {
+  /**
+   * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
+   */
+  const auto chunk_encoding_spec = BenchmarkTableEncoder::chunk_encoding_spec(table_name, table->column_definitions(),
+                                                                              encoding_config);
+
+  const auto default_encoding_type = encoding_config.default_encoding_spec.encoding_type;
+  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+    const auto column_data_type = table->column_data_type(column_id);
+    if (chunk_encoding_spec[column_id].encoding_type == EncodingType::Unencoded &&
+        !encoding_supports_data_type(default_encoding_type, column_data_type)) {
       std::cout << " - Column '" << table_name << "." << table->column_name(column_id) << "' of type ";
       std::cout << data_type_to_string.left.at(column_data_type) << " cannot be encoded as ";
-      std::cout << encoding_type_to_string.left.at(encoding_config.default_encoding_spec.encoding_type) << " and is ";
+      std::cout << encoding_type_to_string.left.at(default_encoding_type) << " and is ";
       std::cout << "left Unencoded." << std::endl;
-      chunk_encoding_spec.push_back(EncodingType::Unencoded);
     }
   }
 
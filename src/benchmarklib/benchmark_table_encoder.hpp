@@ -3,6 +3,9 @@
 #include <memory>
 #include <string>
 
+#include "storage/chunk_encoder.hpp"
+#include "storage/table_column_definition.hpp"
+
 namespace opossum {
 
 class EncodingConfig;
@@ -10,6 +13,12 @@ class Table;
 
 class BenchmarkTableEncoder {
  public:
+  // Builds the ChunkEncodingSpec that @param encoding_config requests for the table. Table generators and imports
+  // use it to encode each chunk as soon as it is complete, so that encode() finds the chunks already encoded.
+  static ChunkEncodingSpec chunk_encoding_spec(const std::string& table_name,
+                                               const TableColumnDefinitions& column_definitions,
+                                               const EncodingConfig& encoding_config);
+
   // @param out   stream for logging info
   // @return      true, if any encoding operation was performed.
   //              false, if the @param table was already encoded as required by @param encoding_config
@@ -130,10 +130,31 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     std::cout << "- Not caching tables as binary files" << std::endl;
   }
 
-  return BenchmarkConfig{
-      benchmark_mode, chunk_size,         *encoding_config, max_runs, timeout_duration, warmup_duration,
-      use_mvcc,       output_file_path,   enable_scheduler, cores,    clients,          enable_visualization,
-      verify,         cache_binary_tables};
+  const auto enable_performance_counters =
+      json_config.value("performance_counters", default_config.enable_performance_counters);
+  if (enable_performance_counters) {
+    std::cout << "- Measuring hardware performance counters of each operator" << std::endl;
+  }
+
+  const auto huge_pages_str = json_config.value("huge_pages", "off");
+  auto huge_page_size = std::optional<HugePageSize>{};
+  if (huge_pages_str == "transparent") {
+    huge_page_size = HugePageSize::Transparent;
+  } else if (huge_pages_str == "2MB") {
+    huge_page_size = HugePageSize::Explicit2MB;
+  } else if (huge_pages_str == "1GB") {
+    huge_page_size = HugePageSize::Explicit1GB;
+  } else if (huge_pages_str != "off") {
+    throw std::runtime_error("Invalid huge page size: '" + huge_pages_str + "'");
+  }
+  if (huge_page_size) {
+    std::cout << "- Placing large allocations on huge pages (" << huge_pages_str << ")" << std::endl;
+  }
+
+  return BenchmarkConfig{benchmark_mode,   chunk_size,          *encoding_config,            max_runs,
+                         timeout_duration, warmup_duration,     use_mvcc,                    output_file_path,
+                         enable_scheduler, cores,               clients,                     enable_visualization,
+                         verify,           cache_binary_tables, enable_performance_counters, huge_page_size};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -158,6 +179,8 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("output", parse_result["output"].as<std::string>());
   json_config.emplace("verify", parse_result["verify"].as<bool>());
   json_config.emplace("cache_binary_tables", parse_result["cache_binary_tables"].as<bool>());
+  json_config.emplace("performance_counters", parse_result["performance_counters"].as<bool>());
+  json_config.emplace("huge_pages", parse_result["huge_pages"].as<std::string>());
 
   return json_config;
 }
@@ -96,6 +96,8 @@ look like this:
 All encoding/compression types can be viewed with the `help` command or seen
 in constant_mappings.cpp.
 The encoding is always required, the compression is optional.
+The encoding "Auto" picks the encoding and compression of each segment based
+on a sample of its values.
 
 {
   "default": {
@@ -82,7 +82,9 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
 
     std::cout << "-  Loading table '" << table_name << "' ";
 
-    // Pick a source file to load a table from, prefer the binary version
+    // Pick a source file to load a table from, prefer the binary version. Binary files are loaded without encoding
+    // the chunks on the fly, so that the encoding pass notices if the file has to be re-exported with the requested
+    // encoding.
     if (table_info.binary_file_path && !table_info.binary_file_out_of_date) {
       std::cout << "from " << *table_info.binary_file_path << std::flush;
       table_info.table = ImportBinary::read_binary(*table_info.binary_file_path);
@@ -93,7 +95,15 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
       if (extension == ".tbl") {
         table_info.table = load_table(*table_info.text_file_path, _benchmark_config->chunk_size);
       } else if (extension == ".csv") {
-        table_info.table = CsvParser{}.parse(*table_info.text_file_path, std::nullopt, _benchmark_config->chunk_size);
+        // The chunks are encoded by the parsing tasks, so that the ValueSegments of the whole table are never in memory
+        auto csv_parser = CsvParser{};
+        const auto column_definitions =
+            csv_parser.create_table_from_meta_file(table_info.text_file_path->string() + CsvMeta::META_FILE_EXTENSION)
+                ->column_definitions();
+        const auto encoding_spec = BenchmarkTableEncoder::chunk_encoding_spec(table_name, column_definitions,
+                                                                              _benchmark_config->encoding_config);
+        table_info.table = csv_parser.parse(*table_info.text_file_path, std::nullopt, _benchmark_config->chunk_size,
+                                            encoding_spec);
       } else {
         Fail("Unknown textual file format. This should have been caught earlier.");
       }
@@ -8,6 +8,9 @@ QueryBenchmarkResult::QueryBenchmarkResult(QueryBenchmarkResult&& other) noexcep
   num_iterations.store(other.num_iterations);
   duration = other.duration;
   iteration_durations = other.iteration_durations;
+  iteration_ends = other.iteration_ends;
+  iteration_performance_counters = other.iteration_performance_counters;
+  peak_memory_usage_bytes.store(other.peak_memory_usage_bytes);
 }
 
 }  // namespace opossum
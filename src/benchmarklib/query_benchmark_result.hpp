@@ -1,8 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <optional>
 
 #include "benchmark_config.hpp"
+#include "utils/performance_counters.hpp"
 
 namespace opossum {
 
@@ -17,6 +19,16 @@ struct QueryBenchmarkResult : public Noncopyable {
   Duration duration = Duration{};
   tbb::concurrent_vector<Duration> iteration_durations;
 
+  // Time from the begin of the benchmark until each run finished, for the throughput over time. In
+  // IndividualQueries mode, the benchmark of each query begins after its warmup.
+  tbb::concurrent_vector<Duration> iteration_ends;
+
+  // Hardware events of the operators of each run, if the benchmark was started with --performance_counters
+  tbb::concurrent_vector<PerformanceCounterValues> iteration_performance_counters;
+
+  // Estimated peak of the bytes that the operators of a run allocated (see OperatorPerformanceData), over all runs
+  std::atomic<size_t> peak_memory_usage_bytes = 0;
+
   std::optional<bool> verification_passed;
 };
 
@@ -0,0 +1,129 @@
+#include "ssb_queries.hpp"
+
+namespace {
+
+/**
+ * Flight 1 restricts the fact table by the order date and by ranges of the discount and quantity, i.e., it measures
+ * scans of the fact table and a single join.
+ */
+const char* const ssb_query_1_1 =
+    R"(SELECT SUM(lo_extendedprice * lo_discount) AS revenue
+       FROM lineorder, dwdate
+       WHERE lo_orderdate = d_datekey AND d_year = 1993 AND lo_discount BETWEEN 1 AND 3 AND lo_quantity < 25;)";
+
+const char* const ssb_query_1_2 =
+    R"(SELECT SUM(lo_extendedprice * lo_discount) AS revenue
+       FROM lineorder, dwdate
+       WHERE lo_orderdate = d_datekey AND d_yearmonthnum = 199401 AND lo_discount BETWEEN 4 AND 6
+         AND lo_quantity BETWEEN 26 AND 35;)";
+
+const char* const ssb_query_1_3 =
+    R"(SELECT SUM(lo_extendedprice * lo_discount) AS revenue
+       FROM lineorder, dwdate
+       WHERE lo_orderdate = d_datekey AND d_weeknuminyear = 6 AND d_year = 1994 AND lo_discount BETWEEN 5 AND 7
+         AND lo_quantity BETWEEN 26 AND 35;)";
+
+/**
+ * Flight 2 restricts two dimensions (part and supplier) and groups by the year and brand
+ */
+const char* const ssb_query_2_1 =
+    R"(SELECT SUM(lo_revenue) AS revenue, d_year, p_brand1
+       FROM lineorder, dwdate, part, supplier
+       WHERE lo_orderdate = d_datekey AND lo_partkey = p_partkey AND lo_suppkey = s_suppkey
+         AND p_category = 'MFGR#12' AND s_region = 'AMERICA'
+       GROUP BY d_year, p_brand1
+       ORDER BY d_year, p_brand1;)";
+
+const char* const ssb_query_2_2 =
+    R"(SELECT SUM(lo_revenue) AS revenue, d_year, p_brand1
+       FROM lineorder, dwdate, part, supplier
+       WHERE lo_orderdate = d_datekey AND lo_partkey = p_partkey AND lo_suppkey = s_suppkey
+         AND p_brand1 BETWEEN 'MFGR#2221' AND 'MFGR#2228' AND s_region = 'ASIA'
+       GROUP BY d_year, p_brand1
+       ORDER BY d_year, p_brand1;)";
+
+const char* const ssb_query_2_3 =
+    R"(SELECT SUM(lo_revenue) AS revenue, d_year, p_brand1
+       FROM lineorder, dwdate, part, supplier
+       WHERE lo_orderdate = d_datekey AND lo_partkey = p_partkey AND lo_suppkey = s_suppkey
+         AND p_brand1 = 'MFGR#2221' AND s_region = 'EUROPE'
+       GROUP BY d_year, p_brand1
+       ORDER BY d_year, p_brand1;)";
+
+/**
+ * Flight 3 restricts the customer, supplier, and date dimensions with decreasing selectivity
+ */
+const char* const ssb_query_3_1 =
+    R"(SELECT c_nation, s_nation, d_year, SUM(lo_revenue) AS revenue
+       FROM customer, lineorder, supplier, dwdate
+       WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_orderdate = d_datekey
+         AND c_region = 'ASIA' AND s_region = 'ASIA' AND d_year >= 1992 AND d_year <= 1997
+       GROUP BY c_nation, s_nation, d_year
+       ORDER BY d_year ASC, revenue DESC;)";
+
+const char* const ssb_query_3_2 =
+    R"(SELECT c_city, s_city, d_year, SUM(lo_revenue) AS revenue
+       FROM customer, lineorder, supplier, dwdate
+       WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_orderdate = d_datekey
+         AND c_nation = 'UNITED STATES' AND s_nation = 'UNITED STATES' AND d_year >= 1992 AND d_year <= 1997
+       GROUP BY c_city, s_city, d_year
+       ORDER BY d_year ASC, revenue DESC;)";
+
+const char* const ssb_query_3_3 =
+    R"(SELECT c_city, s_city, d_year, SUM(lo_revenue) AS revenue
+       FROM customer, lineorder, supplier, dwdate
+       WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_orderdate = d_datekey
+         AND (c_city = 'UNITED KI1' OR c_city = 'UNITED KI5') AND (s_city = 'UNITED KI1' OR s_city = 'UNITED KI5')
+         AND d_year >= 1992 AND d_year <= 1997
+       GROUP BY c_city, s_city, d_year
+       ORDER BY d_year ASC, revenue DESC;)";
+
+const char* const ssb_query_3_4 =
+    R"(SELECT c_city, s_city, d_year, SUM(lo_revenue) AS revenue
+       FROM customer, lineorder, supplier, dwdate
+       WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_orderdate = d_datekey
+         AND (c_city = 'UNITED KI1' OR c_city = 'UNITED KI5') AND (s_city = 'UNITED KI1' OR s_city = 'UNITED KI5')
+         AND d_yearmonth = 'Dec1997'
+       GROUP BY c_city, s_city, d_year
+       ORDER BY d_year ASC, revenue DESC;)";
+
+/**
+ * Flight 4 joins all dimensions and computes the profit
+ */
+const char* const ssb_query_4_1 =
+    R"(SELECT d_year, c_nation, SUM(lo_revenue - lo_supplycost) AS profit
+       FROM dwdate, customer, supplier, part, lineorder
+       WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_partkey = p_partkey AND lo_orderdate = d_datekey
+         AND c_region = 'AMERICA' AND s_region = 'AMERICA' AND (p_mfgr = 'MFGR#1' OR p_mfgr = 'MFGR#2')
+       GROUP BY d_year, c_nation
+       ORDER BY d_year, c_nation;)";
+
+const char* const ssb_query_4_2 =
+    R"(SELECT d_year, s_nation, p_category, SUM(lo_revenue - lo_supplycost) AS profit
+       FROM dwdate, customer, supplier, part, lineorder
+       WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_partkey = p_partkey AND lo_orderdate = d_datekey
+         AND c_region = 'AMERICA' AND s_region = 'AMERICA' AND (d_year = 1997 OR d_year = 1998)
+         AND (p_mfgr = 'MFGR#1' OR p_mfgr = 'MFGR#2')
+       GROUP BY d_year, s_nation, p_category
+       ORDER BY d_year, s_nation, p_category;)";
+
+const char* const ssb_query_4_3 =
+    R"(SELECT d_year, s_city, p_brand1, SUM(lo_revenue - lo_supplycost) AS profit
+       FROM dwdate, customer, supplier, part, lineorder
+       WHERE lo_custkey = c_custkey AND lo_suppkey = s_suppkey AND lo_partkey = p_partkey AND lo_orderdate = d_datekey
+         AND c_region = 'AMERICA' AND s_nation = 'UNITED STATES' AND (d_year = 1997 OR d_year = 1998)
+         AND p_category = 'MFGR#14'
+       GROUP BY d_year, s_city, p_brand1
+       ORDER BY d_year, s_city, p_brand1;)";
+
+}  // namespace
+
+namespace opossum {
+
+const std::vector<std::pair<std::string, const char*>> ssb_queries = {
+    {"1.1", ssb_query_1_1}, {"1.2", ssb_query_1_2}, {"1.3", ssb_query_1_3}, {"2.1", ssb_query_2_1},
+    {"2.2", ssb_query_2_2}, {"2.3", ssb_query_2_3}, {"3.1", ssb_query_3_1}, {"3.2", ssb_query_3_2},
+    {"3.3", ssb_query_3_3}, {"3.4", ssb_query_3_4}, {"4.1", ssb_query_4_1}, {"4.2", ssb_query_4_2},
+    {"4.3", ssb_query_4_3}};
+
+}  // namespace opossum
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * The 13 queries of the Star Schema Benchmark, as pairs of their name (e.g., "1.1") and SQL string, in the order of
+ * their flights. The queries use the substitution parameters of the SSB paper (O'Neil et al., "The Star Schema
+ * Benchmark and Augmented Fact Table Indexing", TPCTC 2009). The date dimension is called dwdate, as DATE is a keyword.
+ */
+extern const std::vector<std::pair<std::string, const char*>> ssb_queries;
+
+}  // namespace opossum
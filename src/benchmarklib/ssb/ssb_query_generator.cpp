@@ -0,0 +1,29 @@
+#include "ssb_query_generator.hpp"
+
+#include "ssb_queries.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SSBQueryGenerator::SSBQueryGenerator(const std::optional<std::unordered_set<std::string>>& query_subset) {
+  for (auto query_id = QueryID{0}; query_id < ssb_queries.size(); ++query_id) {
+    if (query_subset && !query_subset->count(ssb_queries[query_id].first)) continue;
+    _selected_queries.emplace_back(query_id);
+  }
+
+  Assert(!query_subset || _selected_queries.size() == query_subset->size(), "Unknown SSB query name");
+}
+
+std::string SSBQueryGenerator::build_query(const QueryID query_id) {
+  DebugAssert(query_id < ssb_queries.size(), "There are only 13 SSB queries");
+  return ssb_queries[query_id].second;
+}
+
+std::string SSBQueryGenerator::query_name(const QueryID query_id) const {
+  Assert(query_id < ssb_queries.size(), "query_id out of range");
+  return std::string("SSB ") + ssb_queries[query_id].first;
+}
+
+size_t SSBQueryGenerator::available_query_count() const { return ssb_queries.size(); }
+
+}  // namespace opossum
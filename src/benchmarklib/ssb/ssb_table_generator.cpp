@@ -0,0 +1,316 @@
+#include "ssb_table_generator.hpp"
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark_config.hpp"
+#include "benchmark_table_encoder.hpp"
+#include "table_builder.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// clang-format off
+const auto customer_column_types = boost::hana::tuple      <int32_t,     std::string, std::string, std::string, std::string, std::string, std::string, std::string>();  // NOLINT
+const auto customer_column_names = boost::hana::make_tuple("c_custkey", "c_name",    "c_address", "c_city",    "c_nation",  "c_region",  "c_phone",   "c_mktsegment");  // NOLINT
+
+const auto supplier_column_types = boost::hana::tuple      <int32_t,     std::string, std::string, std::string, std::string, std::string, std::string>();  // NOLINT
+const auto supplier_column_names = boost::hana::make_tuple("s_suppkey", "s_name",    "s_address", "s_city",    "s_nation",  "s_region",  "s_phone");  // NOLINT
+
+const auto part_column_types = boost::hana::tuple      <int32_t,     std::string, std::string, std::string,  std::string, std::string, std::string, int32_t,  std::string>();  // NOLINT
+const auto part_column_names = boost::hana::make_tuple("p_partkey", "p_name",    "p_mfgr",    "p_category", "p_brand1",  "p_color",   "p_type",    "p_size", "p_container");  // NOLINT
+
+const auto dwdate_column_types = boost::hana::tuple      <int32_t,     std::string, std::string,   std::string, int32_t,  int32_t,          std::string,   int32_t,          int32_t,           int32_t,          int32_t,            int32_t,           std::string,       int32_t,             int32_t,              int32_t,       int32_t>();  // NOLINT
+const auto dwdate_column_names = boost::hana::make_tuple("d_datekey", "d_date",    "d_dayofweek", "d_month",   "d_year", "d_yearmonthnum", "d_yearmonth", "d_daynuminweek", "d_daynuminmonth", "d_daynuminyear", "d_monthnuminyear", "d_weeknuminyear", "d_sellingseason", "d_lastdayinweekfl", "d_lastdayinmonthfl", "d_holidayfl", "d_weekdayfl");  // NOLINT
+
+const auto lineorder_column_types = boost::hana::tuple      <int32_t,      int32_t,         int32_t,      int32_t,      int32_t,      int32_t,        std::string,        int32_t,           int32_t,       int32_t,            int32_t,            int32_t,       int32_t,      int32_t,         int32_t,  int32_t,         std::string>();  // NOLINT
+const auto lineorder_column_names = boost::hana::make_tuple("lo_orderkey", "lo_linenumber", "lo_custkey", "lo_partkey", "lo_suppkey", "lo_orderdate", "lo_orderpriority", "lo_shippriority", "lo_quantity", "lo_extendedprice", "lo_ordtotalprice", "lo_discount", "lo_revenue", "lo_supplycost", "lo_tax", "lo_commitdate", "lo_shipmode");  // NOLINT
+// clang-format on
+
+// The nations of TPC-H with the index of their region
+const auto nations = std::vector<std::pair<std::string, size_t>>{
+    {"ALGERIA", 0},      {"ARGENTINA", 1},      {"BRAZIL", 1},        {"CANADA", 1},  {"EGYPT", 4},
+    {"ETHIOPIA", 0},     {"FRANCE", 3},         {"GERMANY", 3},       {"INDIA", 2},   {"INDONESIA", 2},
+    {"IRAN", 4},         {"IRAQ", 4},           {"JAPAN", 2},         {"JORDAN", 4},  {"KENYA", 0},
+    {"MOROCCO", 0},      {"MOZAMBIQUE", 0},     {"PERU", 1},          {"CHINA", 2},   {"ROMANIA", 3},
+    {"SAUDI ARABIA", 4}, {"VIETNAM", 2},        {"RUSSIA", 3},        {"UNITED KINGDOM", 3},
+    {"UNITED STATES", 1}};
+const auto regions = std::vector<std::string>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+const auto market_segments = std::vector<std::string>{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const auto order_priorities = std::vector<std::string>{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const auto ship_modes = std::vector<std::string>{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+
+const auto colors = std::vector<std::string>{
+    "almond",    "antique",   "aquamarine", "azure",     "beige",     "bisque",     "black",     "blanched",
+    "blue",      "blush",     "brown",      "burlywood", "burnished", "chartreuse", "chiffon",   "chocolate",
+    "coral",     "cornflower", "cornsilk",  "cream",     "cyan",      "dark",       "deep",      "dim",
+    "dodger",    "drab",      "firebrick",  "floral",    "forest",    "frosted",    "gainsboro", "ghost",
+    "goldenrod", "green",     "grey",       "honeydew",  "hot",       "indian",     "ivory",     "khaki",
+    "lace",      "lavender",  "lawn",       "lemon",     "light",     "lime",       "linen",     "magenta",
+    "maroon",    "medium",    "metallic",   "midnight",  "mint",      "misty",      "moccasin",  "navajo",
+    "navy",      "olive",     "orange",     "orchid",    "pale",      "papaya",     "peach",     "peru",
+    "pink",      "plum",      "powder",     "puff",      "purple",    "red",        "rose",      "rosy",
+    "royal",     "saddle",    "salmon",     "sandy",     "seashell",  "sienna",     "sky",       "slate",
+    "smoke",     "snow",      "spring",     "steel",     "tan",       "thistle",    "tomato",    "turquoise",
+    "violet",    "wheat",     "white",      "yellow"};
+
+const auto type_sizes = std::vector<std::string>{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const auto type_finishes = std::vector<std::string>{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const auto type_materials = std::vector<std::string>{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const auto container_sizes = std::vector<std::string>{"SM", "LG", "MED", "JUMBO", "WRAP"};
+const auto container_types = std::vector<std::string>{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+
+const auto first_date = boost::gregorian::date{1992, 1, 1};
+const auto last_date = boost::gregorian::date{1998, 12, 31};
+
+// Orders are placed until 151 days before the end of the date dimension, as in TPC-H
+const auto last_order_date = boost::gregorian::date{1998, 8, 2};
+
+// Deterministic random values, so that the tables are the same for each run
+class ValueGenerator {
+ public:
+  int32_t number(const int32_t min, const int32_t max) {
+    return std::uniform_int_distribution<int32_t>{min, max}(_random_engine);
+  }
+
+  const std::string& pick(const std::vector<std::string>& values) {
+    return values[static_cast<size_t>(number(0, static_cast<int32_t>(values.size()) - 1))];
+  }
+
+  // Random alphanumeric text, e.g., for addresses
+  std::string text(const int32_t min_length, const int32_t max_length) {
+    static constexpr auto CHARACTERS =
+        std::string_view{"0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ,"};
+    auto text = std::string(static_cast<size_t>(number(min_length, max_length)), ' ');
+    for (auto& character : text) character = CHARACTERS[static_cast<size_t>(number(0, CHARACTERS.size() - 1))];
+    return text;
+  }
+
+  // Phone numbers start with the country code of the nation, as in TPC-H
+  std::string phone(const size_t nation_id) {
+    return std::to_string(nation_id + 10) + "-" + std::to_string(number(100, 999)) + "-" +
+           std::to_string(number(100, 999)) + "-" + std::to_string(number(1000, 9999));
+  }
+
+ private:
+  std::mt19937 _random_engine{42};
+};
+
+// E.g., "Customer#000000042"
+std::string numbered_name(const std::string& prefix, const int32_t key) {
+  const auto digits = std::to_string(key);
+  return prefix + "#" + std::string(digits.size() < 9 ? 9 - digits.size() : 0, '0') + digits;
+}
+
+// The city is the nation name, padded or cut to nine characters, followed by a digit, e.g., "UNITED KI1"
+std::string city(const std::string& nation, const int32_t city_id) {
+  auto city = nation.substr(0, 9);
+  city.resize(9, ' ');
+  return city + std::to_string(city_id);
+}
+
+int32_t date_key(const boost::gregorian::date& date) {
+  return static_cast<int32_t>(date.year() * 10'000 + date.month().as_number() * 100 + date.day());
+}
+
+// The retail price of a part in cents, as in TPC-H
+int32_t retail_price(const int32_t part_key) { return 90'000 + ((part_key / 10) % 20'001) + 100 * (part_key % 1'000); }
+
+std::string selling_season(const int month) {
+  if (month == 12) return "Christmas";
+  if (month <= 2) return "Winter";
+  if (month <= 5) return "Spring";
+  if (month <= 8) return "Summer";
+  return "Fall";
+}
+
+std::string format_scale_factor(const float scale_factor) {
+  auto stream = std::ostringstream{};
+  stream << scale_factor;
+  return stream.str();
+}
+
+}  // namespace
+
+namespace opossum {
+
+SSBTableGenerator::SSBTableGenerator(float scale_factor, uint32_t chunk_size)
+    : AbstractTableGenerator(_create_minimal_benchmark_config(chunk_size)), _scale_factor(scale_factor) {}
+
+SSBTableGenerator::SSBTableGenerator(float scale_factor, const std::shared_ptr<BenchmarkConfig>& benchmark_config)
+    : AbstractTableGenerator(benchmark_config), _scale_factor(scale_factor) {}
+
+std::unordered_map<std::string, BenchmarkTableInfo> SSBTableGenerator::generate() {
+  const auto cache_directory = std::filesystem::path{"ssb_cached_tables"} /
+                               ("sf-" + format_scale_factor(_scale_factor) + "-chunk_size-" +
+                                std::to_string(_benchmark_config->chunk_size));
+  auto table_info_by_name = _load_binary_tables_from_directory(
+      cache_directory, {"customer", "supplier", "part", "dwdate", "lineorder"});
+  if (!table_info_by_name.empty()) return table_info_by_name;
+
+  const auto customer_count = static_cast<int32_t>(_scale_factor * 30'000);
+  const auto supplier_count = static_cast<int32_t>(_scale_factor * 2'000);
+  const auto part_count = static_cast<int32_t>(
+      200'000 * (_scale_factor < 1.0f ? _scale_factor : std::floor(1.0f + std::log2(_scale_factor))));
+  const auto order_count = static_cast<int32_t>(_scale_factor * 1'500'000);
+  Assert(customer_count > 0 && supplier_count > 0 && part_count > 0, "Scale factor is too small");
+
+  const auto chunk_size = _benchmark_config->chunk_size;
+  TableBuilder customer_builder{chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes,
+                                static_cast<size_t>(customer_count)};
+  TableBuilder supplier_builder{chunk_size, supplier_column_types, supplier_column_names, UseMvcc::Yes,
+                                static_cast<size_t>(supplier_count)};
+  TableBuilder part_builder{chunk_size, part_column_types, part_column_names, UseMvcc::Yes,
+                            static_cast<size_t>(part_count)};
+  TableBuilder dwdate_builder{chunk_size, dwdate_column_types, dwdate_column_names, UseMvcc::Yes,
+                              static_cast<size_t>((last_date - first_date).days() + 1)};
+  TableBuilder lineorder_builder{chunk_size, lineorder_column_types, lineorder_column_names, UseMvcc::Yes,
+                                 static_cast<size_t>(order_count) * 4};
+
+  // Encode the chunks while the tables are generated instead of encoding the complete tables afterwards
+  const auto set_chunk_encoding_spec = [&](auto& builder, const std::string& table_name) {
+    builder.set_chunk_encoding_spec(BenchmarkTableEncoder::chunk_encoding_spec(
+        table_name, builder.column_definitions(), _benchmark_config->encoding_config));
+  };
+  set_chunk_encoding_spec(customer_builder, "customer");
+  set_chunk_encoding_spec(supplier_builder, "supplier");
+  set_chunk_encoding_spec(part_builder, "part");
+  set_chunk_encoding_spec(dwdate_builder, "dwdate");
+  set_chunk_encoding_spec(lineorder_builder, "lineorder");
+
+  auto value_generator = ValueGenerator{};
+
+  /**
+   * CUSTOMER and SUPPLIER
+   */
+
+  for (auto customer_key = int32_t{1}; customer_key <= customer_count; ++customer_key) {
+    const auto nation_id = static_cast<size_t>(value_generator.number(0, static_cast<int32_t>(nations.size()) - 1));
+    const auto& [nation, region_id] = nations[nation_id];
+    customer_builder.append_row(int32_t{customer_key}, numbered_name("Customer", customer_key),
+                                value_generator.text(10, 25), city(nation, value_generator.number(0, 9)),
+                                std::string{nation}, std::string{regions[region_id]}, value_generator.phone(nation_id),
+                                std::string{value_generator.pick(market_segments)});
+  }
+
+  for (auto supplier_key = int32_t{1}; supplier_key <= supplier_count; ++supplier_key) {
+    const auto nation_id = static_cast<size_t>(value_generator.number(0, static_cast<int32_t>(nations.size()) - 1));
+    const auto& [nation, region_id] = nations[nation_id];
+    supplier_builder.append_row(int32_t{supplier_key}, numbered_name("Supplier", supplier_key),
+                                value_generator.text(10, 25), city(nation, value_generator.number(0, 9)),
+                                std::string{nation}, std::string{regions[region_id]}, value_generator.phone(nation_id));
+  }
+
+  /**
+   * PART
+   */
+
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    const auto category = "MFGR#" + std::to_string(value_generator.number(1, 5)) +
+                          std::to_string(value_generator.number(1, 5));
+    part_builder.append_row(int32_t{part_key}, value_generator.pick(colors) + " " + value_generator.pick(colors),
+                            category.substr(0, 6), std::string{category},
+                            category + std::to_string(value_generator.number(1, 40)),
+                            std::string{value_generator.pick(colors)},
+                            value_generator.pick(type_sizes) + " " + value_generator.pick(type_finishes) + " " +
+                                value_generator.pick(type_materials),
+                            value_generator.number(1, 50),
+                            value_generator.pick(container_sizes) + " " + value_generator.pick(container_types));
+  }
+
+  /**
+   * DWDATE
+   */
+
+  for (auto date = first_date; date <= last_date; date += boost::gregorian::days{1}) {
+    const auto month = static_cast<int32_t>(date.month().as_number());
+    const auto day_of_week = static_cast<int32_t>(date.day_of_week().as_number());
+    const auto is_holiday = (month == 1 && date.day() == 1) || (month == 7 && date.day() == 4) ||
+                            (month == 12 && date.day() == 25);
+
+    dwdate_builder.append_row(
+        date_key(date),
+        std::string{date.month().as_long_string()} + " " + std::to_string(date.day()) + ", " +
+            std::to_string(date.year()),
+        std::string{date.day_of_week().as_long_string()}, std::string{date.month().as_long_string()},
+        static_cast<int32_t>(date.year()), static_cast<int32_t>(date.year() * 100 + month),
+        std::string{date.month().as_short_string()} + std::to_string(date.year()), day_of_week + 1,
+        static_cast<int32_t>(date.day()), static_cast<int32_t>(date.day_of_year()), int32_t{month},
+        static_cast<int32_t>((date.day_of_year() - 1) / 7 + 1), selling_season(month),
+        static_cast<int32_t>(day_of_week == boost::date_time::Saturday),
+        static_cast<int32_t>(date == date.end_of_month()), static_cast<int32_t>(is_holiday),
+        static_cast<int32_t>(day_of_week != boost::date_time::Saturday && day_of_week != boost::date_time::Sunday));
+  }
+
+  /**
+   * LINEORDER
+   */
+
+  struct Line {
+    int32_t part_key;
+    int32_t supplier_key;
+    int32_t quantity;
+    int32_t extended_price;
+    int32_t discount;
+    int32_t revenue;
+    int32_t tax;
+    int32_t commit_date;
+    std::string ship_mode;
+  };
+
+  const auto order_date_count = static_cast<int32_t>((last_order_date - first_date).days());
+  auto lines = std::vector<Line>{};
+
+  for (auto order_key = int32_t{1}; order_key <= order_count; ++order_key) {
+    const auto customer_key = value_generator.number(1, customer_count);
+    const auto order_date = first_date + boost::gregorian::days{value_generator.number(0, order_date_count)};
+    const auto& order_priority = value_generator.pick(order_priorities);
+
+    lines.resize(static_cast<size_t>(value_generator.number(1, 7)));
+    auto total_price = int64_t{0};
+    for (auto& line : lines) {
+      line.part_key = value_generator.number(1, part_count);
+      line.supplier_key = value_generator.number(1, supplier_count);
+      line.quantity = value_generator.number(1, 50);
+      line.extended_price = line.quantity * retail_price(line.part_key);
+      line.discount = value_generator.number(0, 10);
+      line.revenue = line.extended_price * (100 - line.discount) / 100;
+      line.tax = value_generator.number(0, 8);
+      line.commit_date = date_key(order_date + boost::gregorian::days{value_generator.number(30, 90)});
+      line.ship_mode = value_generator.pick(ship_modes);
+      total_price += int64_t{line.revenue} * (100 + line.tax) / 100;
+    }
+
+    for (auto line_id = size_t{0}; line_id < lines.size(); ++line_id) {
+      const auto& line = lines[line_id];
+      lineorder_builder.append_row(int32_t{order_key}, static_cast<int32_t>(line_id + 1), int32_t{customer_key},
+                                   int32_t{line.part_key}, int32_t{line.supplier_key}, date_key(order_date),
+                                   std::string{order_priority}, int32_t{0}, int32_t{line.quantity},
+                                   int32_t{line.extended_price}, static_cast<int32_t>(total_price),
+                                   int32_t{line.discount}, int32_t{line.revenue},
+                                   retail_price(line.part_key) * 6 / 10, int32_t{line.tax}, int32_t{line.commit_date},
+                                   std::string{line.ship_mode});
+    }
+  }
+
+  table_info_by_name["customer"].table = customer_builder.finish_table();
+  table_info_by_name["supplier"].table = supplier_builder.finish_table();
+  table_info_by_name["part"].table = part_builder.finish_table();
+  table_info_by_name["dwdate"].table = dwdate_builder.finish_table();
+  table_info_by_name["lineorder"].table = lineorder_builder.finish_table();
+
+  _set_binary_file_paths(table_info_by_name, cache_directory);
+
+  return table_info_by_name;
+}
+
+}  // namespace opossum
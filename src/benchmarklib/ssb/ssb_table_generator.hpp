@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_table_generator.hpp"
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+/**
+ * Generates the tables of the Star Schema Benchmark (SSB, O'Neil et al., "The Star Schema Benchmark and Augmented Fact
+ * Table Indexing", TPCTC 2009): the fact table lineorder and the dimensions customer, supplier, part, and dwdate (the
+ * date dimension, renamed as DATE is a keyword). The values follow the distributions of the SSB specification, which
+ * derives them from TPC-H, but are not identical to those of the official ssb-dbgen.
+ *
+ * The row counts are those of the specification: customer SF * 30,000, supplier SF * 2,000, part
+ * 200,000 * floor(1 + log2(SF)), dwdate seven years, and lineorder SF * 1,500,000 orders with one to seven lines each.
+ * For scale factors below 1, part is scaled linearly instead.
+ *
+ * With binary caching enabled, the tables are cached in ssb_cached_tables/ and loaded from there by later runs.
+ */
+class SSBTableGenerator final : public AbstractTableGenerator {
+ public:
+  // Convenience constructor for creating an SSBTableGenerator out of a benchmarking context
+  explicit SSBTableGenerator(float scale_factor, uint32_t chunk_size = Chunk::DEFAULT_SIZE);
+
+  // Constructor for creating an SSBTableGenerator in a benchmark
+  SSBTableGenerator(float scale_factor, const std::shared_ptr<BenchmarkConfig>& benchmark_config);
+
+  std::unordered_map<std::string, BenchmarkTableInfo> generate() override;
+
+ private:
+  float _scale_factor;
+};
+
+}  // namespace opossum
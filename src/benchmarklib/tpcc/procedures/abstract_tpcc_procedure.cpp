@@ -0,0 +1,59 @@
+#include "abstract_tpcc_procedure.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+AbstractTpccProcedure::AbstractTpccProcedure(TpccRandomGenerator& random_generator, const size_t num_warehouses)
+    : _random_generator(random_generator), _num_warehouses(num_warehouses) {
+  Assert(num_warehouses > 0, "TPC-C needs at least one warehouse");
+}
+
+bool AbstractTpccProcedure::execute() {
+  _transaction_context = TransactionManager::get().new_transaction_context();
+
+  // A statement that aborts the transaction has already rolled it back (see OperatorTask)
+  if (!_on_execute()) return false;
+
+  if (_transaction_context->phase() == TransactionPhase::Active) {
+    _transaction_context->commit();
+  }
+  return true;
+}
+
+std::pair<bool, std::shared_ptr<const Table>> AbstractTpccProcedure::_execute_sql(const std::string& sql) {
+  auto pipeline = SQLPipelineBuilder{sql}.with_transaction_context(_transaction_context).create_pipeline();
+  const auto& result_tables = pipeline.get_result_tables();
+  if (pipeline.failed_pipeline_statement()) return {false, nullptr};
+
+  return {true, result_tables.back()};
+}
+
+size_t AbstractTpccProcedure::_remote_warehouse_id(const size_t w_id) {
+  if (_num_warehouses == 1) return w_id;
+
+  // Draw from all other warehouses by skipping the given one
+  const auto remote_w_id = _random_generator.random_number(0, _num_warehouses - 2);
+  return remote_w_id < w_id ? remote_w_id : remote_w_id + 1;
+}
+
+std::pair<bool, int32_t> AbstractTpccProcedure::_customer_id_by_last_name(const size_t w_id, const size_t d_id,
+                                                                          const std::string& last_name) {
+  const auto [success, customers] =
+      _execute_sql("SELECT C_ID FROM CUSTOMER WHERE C_W_ID = " + std::to_string(w_id) +
+                   " AND C_D_ID = " + std::to_string(d_id) + " AND C_LAST = '" + last_name + "' ORDER BY C_FIRST");
+  if (!success) return {false, 0};
+
+  // The TpccTableGenerator assigns each of the 1000 last names to at least one customer of each district
+  Assert(customers->row_count() > 0, "No customer with the last name " + last_name);
+  return {true, customers->get_value<int32_t>(ColumnID{0}, (customers->row_count() - 1) / 2)};
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "tpcc/tpcc_random_generator.hpp"
+
+namespace opossum {
+
+class Table;
+class TransactionContext;
+
+enum class TpccProcedureType { NewOrder, Payment, OrderStatus, Delivery, StockLevel };
+
+/**
+ * Base class of the five TPC-C transactions (TPC-C v5.11.0, Clause 2). The input of a procedure is drawn from the
+ * given random generator when it is constructed, so that a client can repeat a procedure with the same input.
+ *
+ * IDs are zero-based, as in the tables created by the TpccTableGenerator.
+ */
+class AbstractTpccProcedure {
+ public:
+  AbstractTpccProcedure(TpccRandomGenerator& random_generator, const size_t num_warehouses);
+  virtual ~AbstractTpccProcedure() = default;
+
+  // Executes the procedure in a transaction of its own. Returns false if the transaction was aborted because of a
+  // write conflict. A transaction that the procedure rolls back on purpose (see TpccNewOrder) counts as successful.
+  bool execute();
+
+  virtual TpccProcedureType type() const = 0;
+
+ protected:
+  // Executes the statements of the procedure. Returns false as soon as a statement aborted the transaction.
+  virtual bool _on_execute() = 0;
+
+  // Executes a single statement in the transaction of the procedure. Returns false and no table if the statement
+  // aborted the transaction.
+  std::pair<bool, std::shared_ptr<const Table>> _execute_sql(const std::string& sql);
+
+  // Draws a warehouse other than the given one, or the given one if there is only a single warehouse
+  size_t _remote_warehouse_id(const size_t w_id);
+
+  // Returns the customer in the middle of those with the given last name, ordered by their first names (Clause
+  // 2.5.2.2). Returns false if the statement aborted the transaction.
+  std::pair<bool, int32_t> _customer_id_by_last_name(const size_t w_id, const size_t d_id,
+                                                    const std::string& last_name);
+
+  TpccRandomGenerator& _random_generator;
+  const size_t _num_warehouses;
+  std::shared_ptr<TransactionContext> _transaction_context;
+};
+
+}  // namespace opossum
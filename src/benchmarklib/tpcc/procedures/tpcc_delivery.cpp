@@ -0,0 +1,77 @@
+#include "tpcc_delivery.hpp"
+
+#include <ctime>
+#include <string>
+
+#include "storage/table.hpp"
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccDelivery::TpccDelivery(TpccRandomGenerator& random_generator, const size_t num_warehouses)
+    : AbstractTpccProcedure(random_generator, num_warehouses),
+      _w_id(random_generator.random_number(0, num_warehouses - 1)),
+      _o_carrier_id(random_generator.random_number(MIN_CARRIER_ID, MAX_CARRIER_ID)) {}
+
+TpccProcedureType TpccDelivery::type() const { return TpccProcedureType::Delivery; }
+
+bool TpccDelivery::_on_execute() {
+  const auto w_id = std::to_string(_w_id);
+  const auto delivery_date = std::to_string(std::time(nullptr));
+
+  for (auto district_id = size_t{0}; district_id < NUM_DISTRICTS_PER_WAREHOUSE; ++district_id) {
+    const auto d_id = std::to_string(district_id);
+
+    const auto [new_order_success, new_order] =
+        _execute_sql("SELECT NO_O_ID FROM NEW_ORDER WHERE NO_W_ID = " + w_id + " AND NO_D_ID = " + d_id +
+                     " ORDER BY NO_O_ID LIMIT 1");
+    if (!new_order_success) return false;
+
+    // Clause 2.7.4.2: A district without undelivered orders is skipped
+    if (new_order->row_count() == 0) continue;
+    const auto o_id = std::to_string(new_order->get_value<int32_t>(ColumnID{0}, 0));
+
+    if (!_execute_sql("DELETE FROM NEW_ORDER WHERE NO_W_ID = " + w_id + " AND NO_D_ID = " + d_id +
+                      " AND NO_O_ID = " + o_id)
+             .first) {
+      return false;
+    }
+
+    const auto order_predicate = " WHERE O_W_ID = " + w_id + " AND O_D_ID = " + d_id + " AND O_ID = " + o_id;
+    const auto [order_success, order] = _execute_sql("SELECT O_C_ID FROM \"ORDER\"" + order_predicate);
+    if (!order_success) return false;
+    Assert(order->row_count() == 1, "Did not find order " + o_id);
+    const auto c_id = std::to_string(order->get_value<int32_t>(ColumnID{0}, 0));
+
+    if (!_execute_sql("UPDATE \"ORDER\" SET O_CARRIER_ID = " + std::to_string(_o_carrier_id) + order_predicate)
+             .first) {
+      return false;
+    }
+
+    const auto order_line_predicate =
+        " WHERE OL_W_ID = " + w_id + " AND OL_D_ID = " + d_id + " AND OL_O_ID = " + o_id;
+    if (!_execute_sql("UPDATE ORDER_LINE SET OL_DELIVERY_D = " + delivery_date + order_line_predicate).first) {
+      return false;
+    }
+
+    // The amounts are summed up here instead of by an aggregate, which would be NULL for an order without lines
+    const auto [order_line_success, order_lines] =
+        _execute_sql("SELECT OL_AMOUNT FROM ORDER_LINE" + order_line_predicate);
+    if (!order_line_success) return false;
+    auto amount = 0.0;
+    for (auto row_id = size_t{0}; row_id < order_lines->row_count(); ++row_id) {
+      amount += order_lines->get_value<float>(ColumnID{0}, row_id);
+    }
+
+    if (!_execute_sql("UPDATE CUSTOMER SET C_BALANCE = C_BALANCE + " + std::to_string(amount) +
+                      ", C_DELIVERY_CNT = C_DELIVERY_CNT + 1 WHERE C_W_ID = " + w_id + " AND C_D_ID = " + d_id +
+                      " AND C_ID = " + c_id)
+             .first) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace opossum
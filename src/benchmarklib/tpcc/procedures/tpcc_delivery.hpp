@@ -0,0 +1,24 @@
+#pragma once
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Delivers the oldest undelivered order of each of the ten districts of a warehouse (Clause 2.7). All districts are
+ * processed in a single transaction, which is executed directly instead of being queued for deferred execution.
+ */
+class TpccDelivery : public AbstractTpccProcedure {
+ public:
+  TpccDelivery(TpccRandomGenerator& random_generator, const size_t num_warehouses);
+
+  TpccProcedureType type() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  const size_t _w_id;
+  const size_t _o_carrier_id;
+};
+
+}  // namespace opossum
@@ -0,0 +1,116 @@
+#include "tpcc_new_order.hpp"
+
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "storage/table.hpp"
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccNewOrder::TpccNewOrder(TpccRandomGenerator& random_generator, const size_t num_warehouses)
+    : AbstractTpccProcedure(random_generator, num_warehouses),
+      _w_id(random_generator.random_number(0, num_warehouses - 1)),
+      _d_id(random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1)),
+      _c_id(random_generator.nurand(1023, 0, NUM_CUSTOMERS_PER_DISTRICT - 1)) {
+  const auto order_line_count = random_generator.random_number(MIN_ORDER_LINE_COUNT, MAX_ORDER_LINE_COUNT);
+  const auto is_erroneous = random_generator.random_number(1, 100) == 1;
+
+  _order_lines.resize(order_line_count);
+  for (auto line_id = size_t{0}; line_id < order_line_count; ++line_id) {
+    auto& order_line = _order_lines[line_id];
+    order_line.i_id = static_cast<int32_t>(random_generator.nurand(8191, 0, NUM_ITEMS - 1));
+
+    // Clause 2.4.1.5: One percent of the items are supplied by a remote warehouse
+    order_line.supply_w_id = _w_id;
+    if (random_generator.random_number(1, 100) == 1) {
+      order_line.supply_w_id = _remote_warehouse_id(_w_id);
+      _all_local &= order_line.supply_w_id == _w_id;
+    }
+
+    order_line.quantity = static_cast<int32_t>(random_generator.random_number(1, MAX_ORDER_LINE_QUANTITY));
+  }
+
+  // Clause 2.4.1.4: The last item of an erroneous order does not exist
+  if (is_erroneous) _order_lines.back().i_id = NUM_ITEMS;
+}
+
+TpccProcedureType TpccNewOrder::type() const { return TpccProcedureType::NewOrder; }
+
+bool TpccNewOrder::_on_execute() {
+  const auto w_id = std::to_string(_w_id);
+  const auto d_id = std::to_string(_d_id);
+
+  // Get the next order ID of the district and increment it
+  const auto [district_success, district] =
+      _execute_sql("SELECT D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = " + w_id + " AND D_ID = " + d_id);
+  if (!district_success) return false;
+  Assert(district->row_count() == 1, "Did not find district " + d_id + " of warehouse " + w_id);
+  const auto o_id = std::to_string(district->get_value<int32_t>(ColumnID{0}, 0));
+
+  if (!_execute_sql("UPDATE DISTRICT SET D_NEXT_O_ID = " + o_id + " + 1 WHERE D_W_ID = " + w_id + " AND D_ID = " +
+                    d_id)
+           .first) {
+    return false;
+  }
+
+  // Create the order and mark it as new, i.e., as not yet delivered. The carrier of an undelivered order is -1, as
+  // in the generated tables.
+  const auto entry_date = std::to_string(std::time(nullptr));
+  const auto order_values = o_id + ", " + d_id + ", " + w_id + ", " + std::to_string(_c_id) + ", " + entry_date +
+                            ", -1, " + std::to_string(_order_lines.size()) + ", " + (_all_local ? "1" : "0");
+  if (!_execute_sql("INSERT INTO \"ORDER\" VALUES (" + order_values + ")").first) return false;
+  if (!_execute_sql("INSERT INTO NEW_ORDER VALUES (" + o_id + ", " + d_id + ", " + w_id + ")").first) return false;
+
+  auto district_column_name = std::stringstream{};
+  district_column_name << "S_DIST_" << std::setw(2) << std::setfill('0') << _d_id + 1;
+
+  for (auto line_id = size_t{0}; line_id < _order_lines.size(); ++line_id) {
+    const auto& order_line = _order_lines[line_id];
+    const auto i_id = std::to_string(order_line.i_id);
+    const auto supply_w_id = std::to_string(order_line.supply_w_id);
+
+    const auto [item_success, item] = _execute_sql("SELECT I_PRICE FROM ITEM WHERE I_ID = " + i_id);
+    if (!item_success) return false;
+    if (item->row_count() == 0) {
+      // Clause 2.4.2.3: An unused item makes the procedure roll back the transaction
+      _transaction_context->rollback();
+      return true;
+    }
+    const auto price = item->get_value<float>(ColumnID{0}, 0);
+
+    const auto [stock_success, stock] = _execute_sql("SELECT S_QUANTITY, " + district_column_name.str() +
+                                                     " FROM STOCK WHERE S_I_ID = " + i_id +
+                                                     " AND S_W_ID = " + supply_w_id);
+    if (!stock_success) return false;
+    Assert(stock->row_count() == 1, "Did not find stock of item " + i_id + " in warehouse " + supply_w_id);
+    const auto stock_quantity = stock->get_value<int32_t>(ColumnID{0}, 0);
+    const auto dist_info = stock->get_value<std::string>(ColumnID{1}, 0);
+
+    // Clause 2.4.2.2: The stock is refilled by 91 items if fewer than ten would be left
+    const auto new_stock_quantity = stock_quantity >= order_line.quantity + 10
+                                        ? stock_quantity - order_line.quantity
+                                        : stock_quantity - order_line.quantity + 91;
+    const auto remote_increment = order_line.supply_w_id == _w_id ? "0" : "1";
+    if (!_execute_sql("UPDATE STOCK SET S_QUANTITY = " + std::to_string(new_stock_quantity) +
+                      ", S_YTD = S_YTD + " + std::to_string(order_line.quantity) +
+                      ", S_ORDER_CNT = S_ORDER_CNT + 1, S_REMOTE_CNT = S_REMOTE_CNT + " + remote_increment +
+                      " WHERE S_I_ID = " + i_id + " AND S_W_ID = " + supply_w_id)
+             .first) {
+      return false;
+    }
+
+    const auto amount = static_cast<float>(order_line.quantity) * price;
+    const auto order_line_values = o_id + ", " + d_id + ", " + w_id + ", " + std::to_string(line_id) + ", " + i_id +
+                                   ", " + supply_w_id + ", -1, " + std::to_string(order_line.quantity) + ", " +
+                                   std::to_string(amount) + ", '" + dist_info + "'";
+    if (!_execute_sql("INSERT INTO ORDER_LINE VALUES (" + order_line_values + ")").first) return false;
+  }
+
+  return true;
+}
+
+}  // namespace opossum
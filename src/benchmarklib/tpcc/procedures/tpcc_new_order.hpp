@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Enters a new order of five to fifteen items (Clause 2.4). One percent of the orders contain an unused item and are
+ * rolled back by the procedure itself.
+ */
+class TpccNewOrder : public AbstractTpccProcedure {
+ public:
+  TpccNewOrder(TpccRandomGenerator& random_generator, const size_t num_warehouses);
+
+  TpccProcedureType type() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  struct OrderLine {
+    int32_t i_id;
+    size_t supply_w_id;
+    int32_t quantity;
+  };
+
+  const size_t _w_id;
+  const size_t _d_id;
+  const size_t _c_id;
+  std::vector<OrderLine> _order_lines;
+  bool _all_local{true};
+};
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#include "tpcc_order_status.hpp"
+
+#include <string>
+
+#include "storage/table.hpp"
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccOrderStatus::TpccOrderStatus(TpccRandomGenerator& random_generator, const size_t num_warehouses)
+    : AbstractTpccProcedure(random_generator, num_warehouses),
+      _w_id(random_generator.random_number(0, num_warehouses - 1)),
+      _d_id(random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1)),
+      _select_customer_by_name(random_generator.random_number(1, 100) <= 60) {
+  if (_select_customer_by_name) {
+    _c_last = random_generator.last_name(random_generator.nurand(255, 0, 999));
+  } else {
+    _c_id = static_cast<int32_t>(random_generator.nurand(1023, 0, NUM_CUSTOMERS_PER_DISTRICT - 1));
+  }
+}
+
+TpccProcedureType TpccOrderStatus::type() const { return TpccProcedureType::OrderStatus; }
+
+bool TpccOrderStatus::_on_execute() {
+  const auto w_id = std::to_string(_w_id);
+  const auto d_id = std::to_string(_d_id);
+
+  if (_select_customer_by_name) {
+    const auto [customer_id_success, c_id] = _customer_id_by_last_name(_w_id, _d_id, _c_last);
+    if (!customer_id_success) return false;
+    _c_id = c_id;
+  }
+  const auto c_id = std::to_string(_c_id);
+
+  if (!_execute_sql("SELECT C_BALANCE, C_FIRST, C_MIDDLE, C_LAST FROM CUSTOMER WHERE C_W_ID = " + w_id +
+                    " AND C_D_ID = " + d_id + " AND C_ID = " + c_id)
+           .first) {
+    return false;
+  }
+
+  const auto [order_success, order] =
+      _execute_sql("SELECT O_ID, O_ENTRY_D, O_CARRIER_ID FROM \"ORDER\" WHERE O_W_ID = " + w_id + " AND O_D_ID = " +
+                   d_id + " AND O_C_ID = " + c_id + " ORDER BY O_ID DESC LIMIT 1");
+  if (!order_success) return false;
+
+  // Not every customer has placed an order yet
+  if (order->row_count() == 0) return true;
+
+  const auto o_id = std::to_string(order->get_value<int32_t>(ColumnID{0}, 0));
+  return _execute_sql("SELECT OL_I_ID, OL_SUPPLY_W_ID, OL_QUANTITY, OL_AMOUNT, OL_DELIVERY_D FROM ORDER_LINE "
+                      "WHERE OL_W_ID = " + w_id + " AND OL_D_ID = " + d_id + " AND OL_O_ID = " + o_id)
+      .first;
+}
+
+}  // namespace opossum
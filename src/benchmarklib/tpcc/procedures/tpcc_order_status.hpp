@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Queries the last order of a customer and its order lines (Clause 2.6). The customer is selected by last name in 60
+ * percent of the cases. The procedure is read-only.
+ */
+class TpccOrderStatus : public AbstractTpccProcedure {
+ public:
+  TpccOrderStatus(TpccRandomGenerator& random_generator, const size_t num_warehouses);
+
+  TpccProcedureType type() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  const size_t _w_id;
+  const size_t _d_id;
+  const bool _select_customer_by_name;
+  int32_t _c_id{0};
+  std::string _c_last;
+};
+
+}  // namespace opossum
@@ -0,0 +1,87 @@
+#include "tpcc_payment.hpp"
+
+#include <algorithm>
+#include <ctime>
+#include <string>
+
+#include "storage/table.hpp"
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccPayment::TpccPayment(TpccRandomGenerator& random_generator, const size_t num_warehouses)
+    : AbstractTpccProcedure(random_generator, num_warehouses),
+      _w_id(random_generator.random_number(0, num_warehouses - 1)),
+      _d_id(random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1)),
+      _c_w_id(_w_id),
+      _c_d_id(_d_id),
+      _select_customer_by_name(random_generator.random_number(1, 100) <= 60),
+      _h_amount(static_cast<float>(random_generator.random_number(100, 500'000)) / 100.f) {
+  // Clause 2.5.1.2: 15 percent of the customers pay through a warehouse other than their own
+  if (num_warehouses > 1 && random_generator.random_number(1, 100) <= 15) {
+    _c_w_id = _remote_warehouse_id(_w_id);
+    _c_d_id = random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1);
+  }
+
+  if (_select_customer_by_name) {
+    _c_last = random_generator.last_name(random_generator.nurand(255, 0, 999));
+  } else {
+    _c_id = static_cast<int32_t>(random_generator.nurand(1023, 0, NUM_CUSTOMERS_PER_DISTRICT - 1));
+  }
+}
+
+TpccProcedureType TpccPayment::type() const { return TpccProcedureType::Payment; }
+
+bool TpccPayment::_on_execute() {
+  const auto w_id = std::to_string(_w_id);
+  const auto d_id = std::to_string(_d_id);
+  const auto h_amount = std::to_string(_h_amount);
+
+  if (!_execute_sql("UPDATE WAREHOUSE SET W_YTD = W_YTD + " + h_amount + " WHERE W_ID = " + w_id).first) return false;
+  const auto [warehouse_success, warehouse] = _execute_sql("SELECT W_NAME FROM WAREHOUSE WHERE W_ID = " + w_id);
+  if (!warehouse_success) return false;
+  Assert(warehouse->row_count() == 1, "Did not find warehouse " + w_id);
+
+  if (!_execute_sql("UPDATE DISTRICT SET D_YTD = D_YTD + " + h_amount + " WHERE D_W_ID = " + w_id +
+                    " AND D_ID = " + d_id)
+           .first) {
+    return false;
+  }
+  const auto [district_success, district] =
+      _execute_sql("SELECT D_NAME FROM DISTRICT WHERE D_W_ID = " + w_id + " AND D_ID = " + d_id);
+  if (!district_success) return false;
+  Assert(district->row_count() == 1, "Did not find district " + d_id + " of warehouse " + w_id);
+
+  if (_select_customer_by_name) {
+    const auto [customer_id_success, c_id] = _customer_id_by_last_name(_c_w_id, _c_d_id, _c_last);
+    if (!customer_id_success) return false;
+    _c_id = c_id;
+  }
+
+  const auto customer_predicate = " WHERE C_W_ID = " + std::to_string(_c_w_id) + " AND C_D_ID = " +
+                                  std::to_string(_c_d_id) + " AND C_ID = " + std::to_string(_c_id);
+  const auto [customer_success, customer] = _execute_sql("SELECT C_CREDIT, C_DATA FROM CUSTOMER" + customer_predicate);
+  if (!customer_success) return false;
+  Assert(customer->row_count() == 1, "Did not find customer " + std::to_string(_c_id));
+
+  auto customer_update = "UPDATE CUSTOMER SET C_BALANCE = C_BALANCE - " + h_amount +
+                         ", C_YTD_PAYMENT = C_YTD_PAYMENT + " + h_amount + ", C_PAYMENT_CNT = C_PAYMENT_CNT + 1";
+
+  // Clause 2.5.2.2: The payment is prepended to the data of customers with bad credit
+  if (customer->get_value<std::string>(ColumnID{0}, 0) == "BC") {
+    auto c_data = std::to_string(_c_id) + " " + std::to_string(_c_d_id) + " " + std::to_string(_c_w_id) + " " +
+                  d_id + " " + w_id + " " + h_amount + " " + customer->get_value<std::string>(ColumnID{1}, 0);
+    c_data.resize(std::min(c_data.size(), size_t{500}));
+    customer_update += ", C_DATA = '" + c_data + "'";
+  }
+  if (!_execute_sql(customer_update + customer_predicate).first) return false;
+
+  const auto h_data =
+      warehouse->get_value<std::string>(ColumnID{0}, 0) + "    " + district->get_value<std::string>(ColumnID{0}, 0);
+  const auto history_values = std::to_string(_c_id) + ", " + std::to_string(_c_d_id) + ", " +
+                              std::to_string(_c_w_id) + ", " + std::to_string(std::time(nullptr)) + ", " + h_amount +
+                              ", '" + h_data + "'";
+  return _execute_sql("INSERT INTO HISTORY VALUES (" + history_values + ")").first;
+}
+
+}  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Records a payment of a customer, which is selected by last name in 60 percent of the cases (Clause 2.5). The
+ * customer belongs to a remote warehouse in 15 percent of the cases.
+ */
+class TpccPayment : public AbstractTpccProcedure {
+ public:
+  TpccPayment(TpccRandomGenerator& random_generator, const size_t num_warehouses);
+
+  TpccProcedureType type() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  const size_t _w_id;
+  const size_t _d_id;
+  size_t _c_w_id;
+  size_t _c_d_id;
+  bool _select_customer_by_name;
+  int32_t _c_id{0};
+  std::string _c_last;
+  const float _h_amount;
+};
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#include "tpcc_stock_level.hpp"
+
+#include <string>
+
+#include "storage/table.hpp"
+#include "tpcc/constants.hpp"
+
+namespace opossum {
+
+TpccStockLevel::TpccStockLevel(TpccRandomGenerator& random_generator, const size_t num_warehouses)
+    : AbstractTpccProcedure(random_generator, num_warehouses),
+      _w_id(random_generator.random_number(0, num_warehouses - 1)),
+      _d_id(random_generator.random_number(0, NUM_DISTRICTS_PER_WAREHOUSE - 1)),
+      _threshold(random_generator.random_number(10, 20)) {}
+
+TpccProcedureType TpccStockLevel::type() const { return TpccProcedureType::StockLevel; }
+
+bool TpccStockLevel::_on_execute() {
+  const auto w_id = std::to_string(_w_id);
+  const auto d_id = std::to_string(_d_id);
+
+  const auto [district_success, district] =
+      _execute_sql("SELECT D_NEXT_O_ID FROM DISTRICT WHERE D_W_ID = " + w_id + " AND D_ID = " + d_id);
+  if (!district_success) return false;
+  Assert(district->row_count() == 1, "Did not find district " + d_id + " of warehouse " + w_id);
+  const auto next_o_id = district->get_value<int32_t>(ColumnID{0}, 0);
+
+  // Clause 2.8.2.2: The last 20 orders of the district are examined
+  return _execute_sql("SELECT COUNT(DISTINCT S_I_ID) FROM ORDER_LINE, STOCK WHERE OL_W_ID = " + w_id +
+                      " AND OL_D_ID = " + d_id + " AND OL_O_ID < " + std::to_string(next_o_id) +
+                      " AND OL_O_ID >= " + std::to_string(next_o_id - 20) + " AND S_W_ID = " + w_id +
+                      " AND S_I_ID = OL_I_ID AND S_QUANTITY < " + std::to_string(_threshold))
+      .first;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "abstract_tpcc_procedure.hpp"
+
+namespace opossum {
+
+/**
+ * Counts the recently sold items of a district whose stock is below a threshold (Clause 2.8). The procedure is
+ * read-only.
+ */
+class TpccStockLevel : public AbstractTpccProcedure {
+ public:
+  TpccStockLevel(TpccRandomGenerator& random_generator, const size_t num_warehouses);
+
+  TpccProcedureType type() const override;
+
+ protected:
+  bool _on_execute() override;
+
+  const size_t _w_id;
+  const size_t _d_id;
+  const size_t _threshold;
+};
+
+}  // namespace opossum
@@ -0,0 +1,216 @@
+#include "tpcc_benchmark_runner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <thread>
+
+#include "procedures/tpcc_delivery.hpp"
+#include "procedures/tpcc_new_order.hpp"
+#include "procedures/tpcc_order_status.hpp"
+#include "procedures/tpcc_payment.hpp"
+#include "procedures/tpcc_stock_level.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/scheduler_statistics.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/storage_manager.hpp"
+#include "tpcc_table_generator.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+// Indexed by TpccProcedureType
+constexpr auto PROCEDURE_NAMES =
+    std::array<const char*, 5>{"NewOrder", "Payment", "OrderStatus", "Delivery", "StockLevel"};
+
+// The percentiles that are reported for the latencies of each procedure
+constexpr auto LATENCY_PERCENTILES = std::array<double, 4>{0.5, 0.9, 0.95, 0.99};
+
+std::chrono::nanoseconds duration_percentile(const std::vector<opossum::Duration>& sorted_durations,
+                                             const double fraction) {
+  if (sorted_durations.empty()) return std::chrono::nanoseconds{0};
+
+  const auto index = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted_durations.size()))) - 1;
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(sorted_durations[index]);
+}
+
+std::string percentile_name(const double fraction) {
+  return "p" + std::to_string(static_cast<int>(std::round(fraction * 100)));
+}
+
+}  // namespace
+
+namespace opossum {
+
+TpccBenchmarkRunner::TpccBenchmarkRunner(const BenchmarkConfig& config, const size_t num_warehouses,
+                                         const nlohmann::json& context)
+    : _config(config), _num_warehouses(num_warehouses), _context(context) {
+  Assert(num_warehouses > 0, "TPC-C needs at least one warehouse");
+  Assert(config.clients > 0, "TPC-C needs at least one client");
+
+  // Initialise the scheduler if the benchmark was requested to run multi-threaded. The clients are threads of their
+  // own, the scheduler executes the operators of their statements.
+  if (config.enable_scheduler) {
+    Topology::use_default_topology(config.cores);
+    std::cout << "- Multi-threaded Topology:" << std::endl;
+    Topology::get().print(std::cout, 2);
+
+    const auto scheduler = std::make_shared<NodeQueueScheduler>();
+    CurrentScheduler::set(scheduler);
+  }
+}
+
+TpccBenchmarkRunner::~TpccBenchmarkRunner() {
+  if (CurrentScheduler::is_set()) {
+    CurrentScheduler::get()->finish();
+  }
+}
+
+void TpccBenchmarkRunner::run() {
+  std::cout << "- Generating tables for " << _num_warehouses << " warehouse(s)" << std::endl;
+  auto timer = Timer{};
+  auto tables = TpccTableGenerator{_config.chunk_size, _num_warehouses, _config.encoding_config}.generate_all_tables();
+  for (auto& [table_name, table] : tables) {
+    StorageManager::get().add_table(table_name, table);
+  }
+  std::cout << "- Generated all tables (" << timer.lap_formatted() << ")" << std::endl;
+
+  // The procedures read single values from their results with Table::get_value()
+  _performance_warning_disabler.emplace();
+
+  std::cout << "- Starting Benchmark with " << _config.clients << " client(s)..." << std::endl;
+  const auto measurement_begin = std::chrono::high_resolution_clock::now() + _config.warmup_duration;
+  const auto end = measurement_begin + _config.max_duration;
+
+  auto clients = std::vector<std::thread>{};
+  clients.reserve(_config.clients);
+  for (auto client_id = uint32_t{0}; client_id < _config.clients; ++client_id) {
+    clients.emplace_back([&, client_id]() { _run_client(client_id, measurement_begin, end); });
+  }
+  for (auto& client : clients) {
+    client.join();
+  }
+  _measured_duration = std::chrono::high_resolution_clock::now() - measurement_begin;
+
+  for (auto& results : _results) {
+    std::sort(results.durations.begin(), results.durations.end());
+  }
+
+  _print_results();
+
+  if (_config.output_file_path) {
+    std::ofstream output_file(*_config.output_file_path);
+    _create_report(output_file);
+  }
+}
+
+void TpccBenchmarkRunner::_run_client(const uint32_t client_id, const TimePoint measurement_begin,
+                                      const TimePoint end) {
+  // Each client draws its procedures and their input from a random generator of its own
+  auto random_generator = TpccRandomGenerator{42 + client_id};
+  auto client_results = ResultsByProcedure{};
+
+  while (std::chrono::high_resolution_clock::now() < end) {
+    const auto procedure = _create_random_procedure(random_generator, _num_warehouses);
+
+    const auto begin = std::chrono::high_resolution_clock::now();
+    const auto success = procedure->execute();
+    const auto duration = std::chrono::high_resolution_clock::now() - begin;
+
+    if (begin < measurement_begin) continue;
+
+    auto& results = client_results[static_cast<size_t>(procedure->type())];
+    if (success) {
+      results.durations.emplace_back(duration);
+    } else {
+      ++results.aborted_count;
+    }
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_results_mutex};
+  for (auto type_id = size_t{0}; type_id < PROCEDURE_TYPE_COUNT; ++type_id) {
+    auto& results = _results[type_id];
+    results.durations.insert(results.durations.end(), client_results[type_id].durations.begin(),
+                             client_results[type_id].durations.end());
+    results.aborted_count += client_results[type_id].aborted_count;
+  }
+}
+
+std::unique_ptr<AbstractTpccProcedure> TpccBenchmarkRunner::_create_random_procedure(
+    TpccRandomGenerator& random_generator, const size_t num_warehouses) {
+  const auto draw = random_generator.random_number(1, 100);
+  if (draw <= 45) return std::make_unique<TpccNewOrder>(random_generator, num_warehouses);
+  if (draw <= 88) return std::make_unique<TpccPayment>(random_generator, num_warehouses);
+  if (draw <= 92) return std::make_unique<TpccOrderStatus>(random_generator, num_warehouses);
+  if (draw <= 96) return std::make_unique<TpccDelivery>(random_generator, num_warehouses);
+  return std::make_unique<TpccStockLevel>(random_generator, num_warehouses);
+}
+
+void TpccBenchmarkRunner::_print_results() const {
+  const auto measured_minutes = std::chrono::duration<double, std::ratio<60>>(_measured_duration).count();
+  const auto& new_order_results = _results[static_cast<size_t>(TpccProcedureType::NewOrder)];
+  std::cout << "- tpmC: " << static_cast<double>(new_order_results.durations.size()) / measured_minutes << std::endl;
+
+  for (auto type_id = size_t{0}; type_id < PROCEDURE_TYPE_COUNT; ++type_id) {
+    const auto& results = _results[type_id];
+    const auto successful_count = results.durations.size();
+    const auto total_count = successful_count + results.aborted_count;
+
+    std::cout << "- " << PROCEDURE_NAMES[type_id] << ": " << successful_count << " successful, "
+              << results.aborted_count << " aborted";
+    if (total_count > 0) {
+      std::cout << " (" << std::setprecision(3)
+                << 100.0 * static_cast<double>(results.aborted_count) / static_cast<double>(total_count) << "%)";
+    }
+    std::cout << std::endl << "  -> Latency:";
+    for (const auto fraction : LATENCY_PERCENTILES) {
+      const auto latency = std::chrono::duration<double, std::milli>(duration_percentile(results.durations, fraction));
+      std::cout << " " << percentile_name(fraction) << " " << latency.count() << " ms";
+    }
+    std::cout << std::endl;
+  }
+}
+
+void TpccBenchmarkRunner::_create_report(std::ostream& stream) const {
+  nlohmann::json benchmarks;
+
+  const auto measured_seconds = std::chrono::duration<double>(_measured_duration).count();
+  for (auto type_id = size_t{0}; type_id < PROCEDURE_TYPE_COUNT; ++type_id) {
+    const auto& results = _results[type_id];
+    const auto successful_count = results.durations.size();
+    const auto total_count = successful_count + results.aborted_count;
+
+    nlohmann::json latencies;
+    for (const auto fraction : LATENCY_PERCENTILES) {
+      latencies[percentile_name(fraction)] = duration_percentile(results.durations, fraction).count();
+    }
+
+    benchmarks.push_back(
+        {{"name", PROCEDURE_NAMES[type_id]},
+         {"successful", successful_count},
+         {"aborted", results.aborted_count},
+         {"abort_rate",
+          total_count > 0 ? static_cast<double>(results.aborted_count) / static_cast<double>(total_count) : 0.0},
+         {"items_per_second", static_cast<double>(successful_count) / measured_seconds},
+         {"latency_percentiles", latencies},
+         {"time_unit", "ns"}});
+  }
+
+  const auto& new_order_results = _results[static_cast<size_t>(TpccProcedureType::NewOrder)];
+  nlohmann::json summary{{"tpmC", static_cast<double>(new_order_results.durations.size()) / measured_seconds * 60},
+                         {"warehouses", _num_warehouses},
+                         {"total_run_duration_in_s", measured_seconds}};
+
+  nlohmann::json report{{"context", _context}, {"benchmarks", benchmarks}, {"summary", summary}};
+
+  if (CurrentScheduler::is_set()) {
+    report["scheduler"] = CurrentScheduler::get()->statistics().to_json();
+  }
+
+  stream << std::setw(2) << report << std::endl;
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <json.hpp>
+
+#include <array>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "benchmark_config.hpp"
+#include "procedures/abstract_tpcc_procedure.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+/**
+ * Runs the TPC-C transactions with concurrent clients. Each client is a thread of its own that executes one procedure
+ * after the other, choosing them with the minimum mix of Clause 5.2.3 (45% NewOrder, 43% Payment, 4% OrderStatus,
+ * 4% Delivery, 4% StockLevel) and without keying or think times. The clients run for the warmup duration of the
+ * BenchmarkConfig, whose results are discarded, and then for its max_duration.
+ *
+ * The runner reports the throughput of successful NewOrder transactions per minute (tpmC), as well as the latency
+ * percentiles and the abort rate of each procedure. A procedure is aborted if one of its statements has a write
+ * conflict with a concurrent transaction. It is not retried, but the client continues with the next procedure.
+ */
+class TpccBenchmarkRunner {
+ public:
+  TpccBenchmarkRunner(const BenchmarkConfig& config, const size_t num_warehouses, const nlohmann::json& context);
+  ~TpccBenchmarkRunner();
+
+  void run();
+
+ private:
+  static constexpr auto PROCEDURE_TYPE_COUNT = size_t{5};
+
+  struct ProcedureResults {
+    // Latencies of the procedures that were executed successfully
+    std::vector<Duration> durations;
+    size_t aborted_count{0};
+  };
+
+  using ResultsByProcedure = std::array<ProcedureResults, PROCEDURE_TYPE_COUNT>;
+
+  // Executes procedures until the end of the benchmark and adds the results measured after the warmup to _results
+  void _run_client(const uint32_t client_id, const TimePoint measurement_begin, const TimePoint end);
+
+  static std::unique_ptr<AbstractTpccProcedure> _create_random_procedure(TpccRandomGenerator& random_generator,
+                                                                         const size_t num_warehouses);
+
+  void _print_results() const;
+
+  // Create a report in roughly the same format as the BenchmarkRunner does
+  void _create_report(std::ostream& stream) const;
+
+  const BenchmarkConfig _config;
+  const size_t _num_warehouses;
+  nlohmann::json _context;
+
+  std::mutex _results_mutex;
+  ResultsByProcedure _results;
+
+  Duration _measured_duration{};
+
+  std::optional<PerformanceWarningDisabler> _performance_warning_disabler;
+};
+
+}  // namespace opossum
@@ -12,7 +12,10 @@
 #include <vector>
 
 #include "constants.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
 
@@ -59,11 +62,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_items_table() {
         return data;
       });
 
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
-
-  _encode_table("ITEM", table);
-  return table;
+  return _create_encoded_table("ITEM", column_definitions, segments_by_chunk);
 }
 
 std::shared_ptr<Table> TpccTableGenerator::generate_warehouse_table() {
@@ -96,11 +95,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_warehouse_table() {
     return CUSTOMER_YTD * NUM_CUSTOMERS_PER_DISTRICT * NUM_DISTRICTS_PER_WAREHOUSE;
   });
 
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
-
-  _encode_table("WAREHOUSE", table);
-  return table;
+  return _create_encoded_table("WAREHOUSE", column_definitions, segments_by_chunk);
 }
 
 std::shared_ptr<Table> TpccTableGenerator::generate_stock_table() {
@@ -146,11 +141,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_stock_table() {
         return data;
       });
 
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
-
-  _encode_table("STOCK", table);
-  return table;
+  return _create_encoded_table("STOCK", column_definitions, segments_by_chunk);
 }
 
 std::shared_ptr<Table> TpccTableGenerator::generate_district_table() {
@@ -186,13 +177,9 @@ std::shared_ptr<Table> TpccTableGenerator::generate_district_table() {
   add_column<float>(segments_by_chunk, column_definitions, "D_YTD", cardinalities,
                     [&](std::vector<size_t>) { return CUSTOMER_YTD * NUM_CUSTOMERS_PER_DISTRICT; });
   add_column<int>(segments_by_chunk, column_definitions, "D_NEXT_O_ID", cardinalities,
-                  [&](std::vector<size_t>) { return NUM_ORDERS + 1; });
-
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
+                  [&](std::vector<size_t>) { return NUM_ORDERS; });
 
-  _encode_table("DISTRICT", table);
-  return table;
+  return _create_encoded_table("DISTRICT", column_definitions, segments_by_chunk);
 }
 
 std::shared_ptr<Table> TpccTableGenerator::generate_customer_table() {
@@ -255,11 +242,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_customer_table() {
   add_column<std::string>(segments_by_chunk, column_definitions, "C_DATA", cardinalities,
                           [&](std::vector<size_t>) { return _random_gen.astring(300, 500); });
 
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
-
-  _encode_table("CUSTOMER", table);
-  return table;
+  return _create_encoded_table("CUSTOMER", column_definitions, segments_by_chunk);
 }
 
 std::shared_ptr<Table> TpccTableGenerator::generate_history_table() {
@@ -288,11 +271,7 @@ std::shared_ptr<Table> TpccTableGenerator::generate_history_table() {
   add_column<std::string>(segments_by_chunk, column_definitions, "H_DATA", cardinalities,
                           [&](std::vector<size_t>) { return _random_gen.astring(12, 24); });
 
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
-
-  _encode_table("HISTORY", table);
-  return table;
+  return _create_encoded_table("HISTORY", column_definitions, segments_by_chunk);
 }
 
 std::shared_ptr<Table> TpccTableGenerator::generate_order_table(
@@ -326,18 +305,14 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_table(
 
   add_column<int>(segments_by_chunk, column_definitions, "O_CARRIER_ID", cardinalities,
                   [&](std::vector<size_t> indices) {
-                    return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? _random_gen.random_number(1, 10) : -1;
+                    return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? _random_gen.random_number(1, 10) : -1;
                   });
   add_column<int>(segments_by_chunk, column_definitions, "O_OL_CNT", cardinalities,
                   [&](std::vector<size_t> indices) { return order_line_counts[indices[0]][indices[1]][indices[2]]; });
   add_column<int>(segments_by_chunk, column_definitions, "O_ALL_LOCAL", cardinalities,
                   [&](std::vector<size_t>) { return 1; });
 
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
-
-  _encode_table("ORDER", table);
-  return table;
+  return _create_encoded_table("ORDER", column_definitions, segments_by_chunk);
 }
 
 TpccTableGenerator::order_line_counts_type TpccTableGenerator::generate_order_line_counts() {
@@ -417,35 +392,31 @@ std::shared_ptr<Table> TpccTableGenerator::generate_order_line_table(
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_NUMBER", cardinalities, order_line_counts,
                               [&](std::vector<size_t> indices) { return indices[3]; });
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_I_ID", cardinalities, order_line_counts,
-                              [&](std::vector<size_t>) { return _random_gen.random_number(1, NUM_ITEMS); });
+                              [&](std::vector<size_t>) { return _random_gen.random_number(0, NUM_ITEMS - 1); });
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_SUPPLY_W_ID", cardinalities, order_line_counts,
                               [&](std::vector<size_t> indices) { return indices[0]; });
   // TODO(anybody) -1 should be null
   _add_order_line_column<int>(
       segments_by_chunk, column_definitions, "OL_DELIVERY_D", cardinalities, order_line_counts,
-      [&](std::vector<size_t> indices) { return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? _current_date : -1; });
+      [&](std::vector<size_t> indices) { return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? _current_date : -1; });
   _add_order_line_column<int>(segments_by_chunk, column_definitions, "OL_QUANTITY", cardinalities, order_line_counts,
                               [&](std::vector<size_t>) { return 5; });
 
   _add_order_line_column<float>(
       segments_by_chunk, column_definitions, "OL_AMOUNT", cardinalities, order_line_counts,
       [&](std::vector<size_t> indices) {
-        return indices[2] <= NUM_ORDERS - NUM_NEW_ORDERS ? 0.f : _random_gen.random_number(1, 999999) / 100.f;
+        return indices[2] < NUM_ORDERS - NUM_NEW_ORDERS ? 0.f : _random_gen.random_number(1, 999999) / 100.f;
       });
   _add_order_line_column<std::string>(segments_by_chunk, column_definitions, "OL_DIST_INFO", cardinalities,
                                       order_line_counts,
                                       [&](std::vector<size_t>) { return _random_gen.astring(24, 24); });
 
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
-
-  _encode_table("ORDER_LINE", table);
-  return table;
+  return _create_encoded_table("ORDER_LINE", column_definitions, segments_by_chunk);
 }
 
 std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
   auto cardinalities = std::make_shared<std::vector<size_t>>(
-      std::initializer_list<size_t>{_warehouse_size, NUM_DISTRICTS_PER_WAREHOUSE, NUM_ORDERS});
+      std::initializer_list<size_t>{_warehouse_size, NUM_DISTRICTS_PER_WAREHOUSE, NUM_NEW_ORDERS});
 
   /**
    * indices[0] = warehouse
@@ -456,17 +427,13 @@ std::shared_ptr<Table> TpccTableGenerator::generate_new_order_table() {
   TableColumnDefinitions column_definitions;
 
   add_column<int>(segments_by_chunk, column_definitions, "NO_O_ID", cardinalities,
-                  [&](std::vector<size_t> indices) { return indices[2] + NUM_ORDERS + 1 - NUM_NEW_ORDERS; });
+                  [&](std::vector<size_t> indices) { return indices[2] + NUM_ORDERS - NUM_NEW_ORDERS; });
   add_column<int>(segments_by_chunk, column_definitions, "NO_D_ID", cardinalities,
                   [&](std::vector<size_t> indices) { return indices[1]; });
   add_column<int>(segments_by_chunk, column_definitions, "NO_W_ID", cardinalities,
                   [&](std::vector<size_t> indices) { return indices[0]; });
 
-  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
-  for (const auto& segment : segments_by_chunk) table->append_chunk(segment);
-
-  _encode_table("NEW_ORDER", table);
-  return table;
+  return _create_encoded_table("NEW_ORDER", column_definitions, segments_by_chunk);
 }
 
 std::map<std::string, std::shared_ptr<Table>> TpccTableGenerator::generate_all_tables() {
@@ -528,8 +495,31 @@ std::shared_ptr<Table> TpccTableGenerator::generate_table(const std::string& tab
   return generators[table_name]();
 }
 
-void TpccTableGenerator::_encode_table(const std::string& table_name, const std::shared_ptr<Table>& table) {
-  BenchmarkTableEncoder::encode(table_name, table, _encoding_config);
+std::shared_ptr<Table> TpccTableGenerator::_create_encoded_table(const std::string& table_name,
+                                                                 const TableColumnDefinitions& column_definitions,
+                                                                 std::vector<Segments>& segments_by_chunk) {
+  const auto chunk_encoding_spec =
+      BenchmarkTableEncoder::chunk_encoding_spec(table_name, column_definitions, _encoding_config);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
+  const auto column_data_types = table->column_data_types();
+
+  // Each chunk is encoded by the task that creates it. The ValueSegments are released as soon as their chunk is
+  // encoded instead of after a separate encoding pass over the whole table.
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(segments_by_chunk.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(segments_by_chunk.size());
+  for (auto chunk_id = size_t{0}; chunk_id < segments_by_chunk.size(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto segments = std::move(segments_by_chunk[chunk_id]);
+      const auto row_count = segments.empty() ? ChunkOffset{0} : static_cast<ChunkOffset>(segments[0]->size());
+      chunks[chunk_id] = std::make_shared<Chunk>(segments, std::make_shared<MvccData>(row_count));
+      ChunkEncoder::encode_chunk(chunks[chunk_id], column_data_types, chunk_encoding_spec);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& chunk : chunks) table->append_chunk(chunk);
+  return table;
 }
 
 }  // namespace opossum
@@ -59,7 +59,10 @@ class TpccTableGenerator : public opossum::AbstractBenchmarkTableGenerator {
   const EncodingConfig _encoding_config;
 
  protected:
-  void _encode_table(const std::string& table_name, const std::shared_ptr<Table>& table);
+  // Creates the table from the generated segments and encodes each chunk as requested by the EncodingConfig
+  std::shared_ptr<Table> _create_encoded_table(const std::string& table_name,
+                                               const TableColumnDefinitions& column_definitions,
+                                               std::vector<Segments>& segments_by_chunk);
 
   template <typename T>
   std::vector<T> _generate_inner_order_line_column(std::vector<size_t> indices,
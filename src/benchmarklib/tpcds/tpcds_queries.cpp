@@ -0,0 +1,95 @@
+#include "tpcds_queries.hpp"
+
+namespace {
+
+const char* const tpcds_query_3 =
+    R"(SELECT dt.d_year, item.i_brand_id AS brand_id, item.i_brand AS brand, SUM(ss_ext_sales_price) AS sum_agg
+       FROM date_dim dt, store_sales, item
+       WHERE dt.d_date_sk = store_sales.ss_sold_date_sk AND store_sales.ss_item_sk = item.i_item_sk
+         AND item.i_manufact_id = 128 AND dt.d_moy = 11
+       GROUP BY dt.d_year, item.i_brand, item.i_brand_id
+       ORDER BY dt.d_year, sum_agg DESC, brand_id
+       LIMIT 100;)";
+
+const char* const tpcds_query_7 =
+    R"(SELECT i_item_id, AVG(ss_quantity) AS agg1, AVG(ss_list_price) AS agg2, AVG(ss_coupon_amt) AS agg3,
+              AVG(ss_sales_price) AS agg4
+       FROM store_sales, customer_demographics, date_dim, item, promotion
+       WHERE ss_sold_date_sk = d_date_sk AND ss_item_sk = i_item_sk AND ss_cdemo_sk = cd_demo_sk
+         AND ss_promo_sk = p_promo_sk AND cd_gender = 'M' AND cd_marital_status = 'S'
+         AND cd_education_status = 'College' AND (p_channel_email = 'N' OR p_channel_event = 'N') AND d_year = 2000
+       GROUP BY i_item_id
+       ORDER BY i_item_id
+       LIMIT 100;)";
+
+const char* const tpcds_query_19 =
+    R"(SELECT i_brand_id AS brand_id, i_brand AS brand, i_manufact_id, i_manufact,
+              SUM(ss_ext_sales_price) AS ext_price
+       FROM date_dim, store_sales, item, customer, customer_address, store
+       WHERE d_date_sk = ss_sold_date_sk AND ss_item_sk = i_item_sk AND i_manager_id = 8 AND d_moy = 11
+         AND d_year = 1998 AND ss_customer_sk = c_customer_sk AND c_current_addr_sk = ca_address_sk
+         AND SUBSTR(ca_zip, 1, 5) <> SUBSTR(s_zip, 1, 5) AND ss_store_sk = s_store_sk
+       GROUP BY i_brand, i_brand_id, i_manufact_id, i_manufact
+       ORDER BY ext_price DESC, i_brand, i_brand_id, i_manufact_id, i_manufact
+       LIMIT 100;)";
+
+const char* const tpcds_query_42 =
+    R"(SELECT dt.d_year, item.i_category_id, item.i_category, SUM(ss_ext_sales_price) AS sum_agg
+       FROM date_dim dt, store_sales, item
+       WHERE dt.d_date_sk = store_sales.ss_sold_date_sk AND store_sales.ss_item_sk = item.i_item_sk
+         AND item.i_manager_id = 1 AND dt.d_moy = 11 AND dt.d_year = 2000
+       GROUP BY dt.d_year, item.i_category_id, item.i_category
+       ORDER BY sum_agg DESC, dt.d_year, item.i_category_id, item.i_category
+       LIMIT 100;)";
+
+const char* const tpcds_query_43 =
+    R"(SELECT s_store_name, s_store_id,
+              SUM(CASE WHEN d_day_name = 'Sunday' THEN ss_sales_price ELSE NULL END) AS sun_sales,
+              SUM(CASE WHEN d_day_name = 'Monday' THEN ss_sales_price ELSE NULL END) AS mon_sales,
+              SUM(CASE WHEN d_day_name = 'Tuesday' THEN ss_sales_price ELSE NULL END) AS tue_sales,
+              SUM(CASE WHEN d_day_name = 'Wednesday' THEN ss_sales_price ELSE NULL END) AS wed_sales,
+              SUM(CASE WHEN d_day_name = 'Thursday' THEN ss_sales_price ELSE NULL END) AS thu_sales,
+              SUM(CASE WHEN d_day_name = 'Friday' THEN ss_sales_price ELSE NULL END) AS fri_sales,
+              SUM(CASE WHEN d_day_name = 'Saturday' THEN ss_sales_price ELSE NULL END) AS sat_sales
+       FROM date_dim, store_sales, store
+       WHERE d_date_sk = ss_sold_date_sk AND s_store_sk = ss_store_sk AND s_gmt_offset = -5 AND d_year = 2000
+       GROUP BY s_store_name, s_store_id
+       ORDER BY s_store_name, s_store_id, sun_sales, mon_sales, tue_sales, wed_sales, thu_sales, fri_sales, sat_sales
+       LIMIT 100;)";
+
+const char* const tpcds_query_52 =
+    R"(SELECT dt.d_year, item.i_brand_id AS brand_id, item.i_brand AS brand, SUM(ss_ext_sales_price) AS ext_price
+       FROM date_dim dt, store_sales, item
+       WHERE dt.d_date_sk = store_sales.ss_sold_date_sk AND store_sales.ss_item_sk = item.i_item_sk
+         AND item.i_manager_id = 1 AND dt.d_moy = 11 AND dt.d_year = 2000
+       GROUP BY dt.d_year, item.i_brand, item.i_brand_id
+       ORDER BY dt.d_year, ext_price DESC, brand_id
+       LIMIT 100;)";
+
+const char* const tpcds_query_55 =
+    R"(SELECT i_brand_id AS brand_id, i_brand AS brand, SUM(ss_ext_sales_price) AS ext_price
+       FROM date_dim, store_sales, item
+       WHERE d_date_sk = ss_sold_date_sk AND ss_item_sk = i_item_sk AND i_manager_id = 28 AND d_moy = 11
+         AND d_year = 1999
+       GROUP BY i_brand, i_brand_id
+       ORDER BY ext_price DESC, i_brand_id
+       LIMIT 100;)";
+
+const char* const tpcds_query_96 =
+    R"(SELECT COUNT(*) AS sales_count
+       FROM store_sales, household_demographics, time_dim, store
+       WHERE ss_sold_time_sk = time_dim.t_time_sk AND ss_hdemo_sk = household_demographics.hd_demo_sk
+         AND ss_store_sk = s_store_sk AND time_dim.t_hour = 20 AND time_dim.t_minute >= 30
+         AND household_demographics.hd_dep_count = 7 AND store.s_store_name = 'ese'
+       ORDER BY sales_count
+       LIMIT 100;)";
+
+}  // namespace
+
+namespace opossum {
+
+const std::vector<std::pair<std::string, const char*>> tpcds_queries = {
+    {"3", tpcds_query_3},   {"7", tpcds_query_7},   {"19", tpcds_query_19}, {"42", tpcds_query_42},
+    {"43", tpcds_query_43}, {"52", tpcds_query_52}, {"55", tpcds_query_55}, {"96", tpcds_query_96}};
+
+}  // namespace opossum
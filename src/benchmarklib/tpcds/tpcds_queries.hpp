@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * A subset of the TPC-DS queries that only uses the store channel, as pairs of their number (e.g., "3") and SQL
+ * string. The queries use the substitution parameters of the qualification run of the specification. Where a query
+ * orders by an aggregate, it orders by the aggregate's alias instead.
+ */
+extern const std::vector<std::pair<std::string, const char*>> tpcds_queries;
+
+}  // namespace opossum
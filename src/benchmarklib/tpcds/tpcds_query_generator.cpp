@@ -0,0 +1,29 @@
+#include "tpcds_query_generator.hpp"
+
+#include "tpcds_queries.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TpcdsQueryGenerator::TpcdsQueryGenerator(const std::optional<std::unordered_set<std::string>>& query_subset) {
+  for (auto query_id = QueryID{0}; query_id < tpcds_queries.size(); ++query_id) {
+    if (query_subset && !query_subset->count(tpcds_queries[query_id].first)) continue;
+    _selected_queries.emplace_back(query_id);
+  }
+
+  Assert(!query_subset || _selected_queries.size() == query_subset->size(), "Unknown TPC-DS query number");
+}
+
+std::string TpcdsQueryGenerator::build_query(const QueryID query_id) {
+  DebugAssert(query_id < tpcds_queries.size(), "query_id out of range");
+  return tpcds_queries[query_id].second;
+}
+
+std::string TpcdsQueryGenerator::query_name(const QueryID query_id) const {
+  Assert(query_id < tpcds_queries.size(), "query_id out of range");
+  return std::string("TPC-DS ") + tpcds_queries[query_id].first;
+}
+
+size_t TpcdsQueryGenerator::available_query_count() const { return tpcds_queries.size(); }
+
+}  // namespace opossum
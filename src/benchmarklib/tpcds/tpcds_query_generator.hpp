@@ -0,0 +1,22 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <unordered_set>
+
+#include "abstract_query_generator.hpp"
+
+namespace opossum {
+
+// Generates the TPC-DS queries of tpcds_queries.hpp. The queries do not have random parameters.
+class TpcdsQueryGenerator : public AbstractQueryGenerator {
+ public:
+  // @param query_subset    if set, only the queries with the specified numbers (e.g., "3" or "96") are generated
+  explicit TpcdsQueryGenerator(const std::optional<std::unordered_set<std::string>>& query_subset = {});
+
+  std::string build_query(const QueryID query_id) override;
+  std::string query_name(const QueryID query_id) const override;
+  size_t available_query_count() const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,423 @@
+#include "tpcds_table_generator.hpp"
+
+#include <boost/date_time/gregorian/gregorian.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark_config.hpp"
+#include "benchmark_table_encoder.hpp"
+#include "table_builder.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// clang-format off
+const auto date_dim_column_types = boost::hana::tuple      <int32_t,      std::string,  std::string, int32_t,  int32_t, int32_t, int32_t, std::string,  int32_t>();  // NOLINT
+const auto date_dim_column_names = boost::hana::make_tuple("d_date_sk", "d_date_id", "d_date",    "d_year", "d_moy", "d_dom", "d_qoy", "d_day_name", "d_week_seq");  // NOLINT
+
+const auto time_dim_column_types = boost::hana::tuple      <int32_t,      std::string,  int32_t,  int32_t,  int32_t,    int32_t,    std::string, std::string, std::string>();  // NOLINT
+const auto time_dim_column_names = boost::hana::make_tuple("t_time_sk", "t_time_id", "t_time", "t_hour", "t_minute", "t_second", "t_am_pm",   "t_shift",   "t_meal_time");  // NOLINT
+
+const auto item_column_types = boost::hana::tuple      <int32_t,      std::string, std::string,   float,             int32_t,      std::string, int32_t,      std::string, int32_t,         std::string,  int32_t,         std::string,  std::string, std::string, int32_t>();  // NOLINT
+const auto item_column_names = boost::hana::make_tuple("i_item_sk", "i_item_id", "i_item_desc", "i_current_price", "i_brand_id", "i_brand",   "i_class_id", "i_class",   "i_category_id", "i_category", "i_manufact_id", "i_manufact", "i_size",    "i_color",   "i_manager_id");  // NOLINT
+
+const auto customer_address_column_types = boost::hana::tuple      <int32_t,         std::string,     std::string,        std::string,      std::string, std::string,  std::string, std::string, std::string,  float>();  // NOLINT
+const auto customer_address_column_names = boost::hana::make_tuple("ca_address_sk", "ca_address_id", "ca_street_number", "ca_street_name", "ca_city",   "ca_county", "ca_state",  "ca_zip",    "ca_country", "ca_gmt_offset");  // NOLINT
+
+const auto customer_column_types = boost::hana::tuple      <int32_t,          std::string,      int32_t,              int32_t,              int32_t,             std::string,    std::string,   int32_t,         std::string>();  // NOLINT
+const auto customer_column_names = boost::hana::make_tuple("c_customer_sk", "c_customer_id", "c_current_cdemo_sk", "c_current_hdemo_sk", "c_current_addr_sk", "c_first_name", "c_last_name", "c_birth_year", "c_email_address");  // NOLINT
+
+const auto customer_demographics_column_types = boost::hana::tuple      <int32_t,      std::string,  std::string,         std::string,           int32_t,               std::string,        int32_t,        int32_t,                 int32_t>();  // NOLINT
+const auto customer_demographics_column_names = boost::hana::make_tuple("cd_demo_sk", "cd_gender", "cd_marital_status", "cd_education_status", "cd_purchase_estimate", "cd_credit_rating", "cd_dep_count", "cd_dep_employed_count", "cd_dep_college_count");  // NOLINT
+
+const auto household_demographics_column_types = boost::hana::tuple      <int32_t,      int32_t,             std::string,        int32_t,        int32_t>();  // NOLINT
+const auto household_demographics_column_names = boost::hana::make_tuple("hd_demo_sk", "hd_income_band_sk", "hd_buy_potential", "hd_dep_count", "hd_vehicle_count");  // NOLINT
+
+const auto store_column_types = boost::hana::tuple      <int32_t,       std::string,  std::string,    int32_t,               std::string, std::string, std::string, std::string, float>();  // NOLINT
+const auto store_column_names = boost::hana::make_tuple("s_store_sk", "s_store_id", "s_store_name", "s_number_employees", "s_city",    "s_county",  "s_state",   "s_zip",     "s_gmt_offset");  // NOLINT
+
+const auto promotion_column_types = boost::hana::tuple      <int32_t,       std::string,  std::string,    std::string,       std::string,       std::string,    float>();  // NOLINT
+const auto promotion_column_names = boost::hana::make_tuple("p_promo_sk", "p_promo_id", "p_promo_name", "p_channel_email", "p_channel_event", "p_channel_tv", "p_cost");  // NOLINT
+
+const auto store_sales_column_types = boost::hana::tuple      <int32_t,           int32_t,           int32_t,       int32_t,           int32_t,       int32_t,       int32_t,       int32_t,        int32_t,        int32_t,            int32_t,       float,               float,           float,            float,                 float,                float,                   float,               float,        float,           float,         float>();  // NOLINT
+const auto store_sales_column_names = boost::hana::make_tuple("ss_sold_date_sk", "ss_sold_time_sk", "ss_item_sk", "ss_customer_sk", "ss_cdemo_sk", "ss_hdemo_sk", "ss_addr_sk", "ss_store_sk", "ss_promo_sk", "ss_ticket_number", "ss_quantity", "ss_wholesale_cost", "ss_list_price", "ss_sales_price", "ss_ext_discount_amt", "ss_ext_sales_price", "ss_ext_wholesale_cost", "ss_ext_list_price", "ss_ext_tax", "ss_coupon_amt", "ss_net_paid", "ss_net_profit");  // NOLINT
+// clang-format on
+
+// dsdgen builds names from the digits of a number, e.g., 128 becomes "oughtableeing"
+const auto digit_syllables =
+    std::vector<std::string>{"bar", "ought", "able", "pri", "ese", "anti", "cally", "ation", "eing", "n st"};
+
+const auto categories = std::vector<std::string>{"Books", "Children", "Electronics", "Home",  "Jewelry",
+                                                 "Men",   "Music",    "Shoes",       "Sports", "Women"};
+const auto brand_names = std::vector<std::string>{"amalgamalg",     "importoamalg",    "edu packexporti",
+                                                  "exportiimporto", "scholaramalgamalg", "amalgimporto",
+                                                  "edu packscholar", "exportischolar", "corpbrand",
+                                                  "univbrand"};
+const auto classes = std::vector<std::string>{"accessories", "athletic", "audio",    "classical", "computers",
+                                              "dresses",     "fiction",  "fishing",  "furniture", "infants",
+                                              "kids",        "lighting", "mystery",  "pants",     "pop",
+                                              "shirts"};
+const auto sizes = std::vector<std::string>{"petite", "small", "medium", "large", "extra large", "economy", "N/A"};
+const auto colors = std::vector<std::string>{"almond", "azure",  "beige", "black",  "blue",   "brown", "burnished",
+                                             "chiffon", "coral", "cream", "cyan",   "forest", "ghost", "goldenrod",
+                                             "green",  "indian", "ivory", "khaki",  "lace",   "lime",  "maroon",
+                                             "navy",   "olive",  "orange", "pink",  "purple", "red",   "rose",
+                                             "salmon", "sienna", "slate", "snow",   "steel",  "tan",   "violet",
+                                             "white",  "yellow"};
+
+const auto cities = std::vector<std::string>{"Fairview", "Midway",    "Oak Grove", "Five Points", "Pleasant Hill",
+                                             "Centerville", "Riverside", "Greenwood", "Union",   "Salem"};
+const auto counties = std::vector<std::string>{"Williamson County", "Ziebach County", "Walker County",
+                                               "Richland County",   "Franklin County"};
+const auto states = std::vector<std::string>{"TN", "SD", "GA", "TX", "OH", "AL", "KY", "IL", "MO", "NC"};
+const auto street_names = std::vector<std::string>{"Main",   "Oak",     "Park",  "Elm",  "Maple", "Hill",
+                                                   "Lake",   "Sunset",  "Cedar", "Pine", "View",  "Church"};
+const auto street_types = std::vector<std::string>{"Street", "Avenue", "Road", "Lane", "Drive", "Court", "Way"};
+
+const auto first_names = std::vector<std::string>{"James", "Mary",  "John",  "Patricia", "Robert", "Linda",
+                                                  "Michael", "Barbara", "William", "Elizabeth", "David", "Jennifer"};
+const auto last_names = std::vector<std::string>{"Smith", "Johnson", "Williams", "Brown", "Jones", "Miller",
+                                                 "Davis", "Garcia",  "Rodriguez", "Wilson", "Martinez", "Anderson"};
+
+const auto genders = std::vector<std::string>{"M", "F"};
+const auto marital_statuses = std::vector<std::string>{"M", "S", "D", "W", "U"};
+const auto education_statuses = std::vector<std::string>{"Primary",         "Secondary", "College",  "2 yr Degree",
+                                                         "4 yr Degree",     "Advanced Degree", "Unknown"};
+const auto credit_ratings = std::vector<std::string>{"Good", "High Risk", "Low Risk", "Unknown"};
+const auto buy_potentials =
+    std::vector<std::string>{"0-500", ">10000", "Unknown", "501-1000", "1001-5000", "5001-10000"};
+
+// The date dimension covers 1900-01-02 to 2100-01-01, its surrogate keys are the julian day numbers
+const auto first_date = boost::gregorian::date{1900, 1, 2};
+const auto last_date = boost::gregorian::date{2100, 1, 1};
+
+// Sales happen in the five years from 1998 to 2002
+const auto first_sales_date = boost::gregorian::date{1998, 1, 2};
+const auto last_sales_date = boost::gregorian::date{2002, 12, 31};
+
+// Deterministic random values, so that the tables are the same for each run
+class ValueGenerator {
+ public:
+  int32_t number(const int32_t min, const int32_t max) {
+    return std::uniform_int_distribution<int32_t>{min, max}(_random_engine);
+  }
+
+  // A value between min and max that is skewed towards min, e.g., to make few items and customers account for most
+  // of the sales
+  int32_t skewed_number(const int32_t min, const int32_t max) {
+    const auto random_value = std::uniform_real_distribution<double>{0.0, 1.0}(_random_engine);
+    return min + static_cast<int32_t>(static_cast<double>(max - min) * random_value * random_value);
+  }
+
+  // An amount of money between min and max, rounded to cents
+  float money(const double min, const double max) {
+    return static_cast<float>(std::round(std::uniform_real_distribution<double>{min, max}(_random_engine) * 100.0) /
+                              100.0);
+  }
+
+  const std::string& pick(const std::vector<std::string>& values) {
+    return values[static_cast<size_t>(number(0, static_cast<int32_t>(values.size()) - 1))];
+  }
+
+  std::string zip() { return std::to_string(number(10'000, 99'999)); }
+
+ private:
+  std::mt19937 _random_engine{42};
+};
+
+std::string syllables(const int32_t number) {
+  auto name = std::string{};
+  for (const auto digit : std::to_string(number)) name += digit_syllables[static_cast<size_t>(digit - '0')];
+  return name;
+}
+
+// The business keys of dsdgen encode the surrogate key in 16 letters, e.g., 1 becomes "AAAAAAAABAAAAAAA"
+std::string business_key(const int32_t surrogate_key) {
+  auto key = std::string(16, 'A');
+  auto remaining_bits = static_cast<uint32_t>(surrogate_key);
+  for (auto position = size_t{8}; position < 16 && remaining_bits > 0; ++position, remaining_bits >>= 4u) {
+    key[position] = static_cast<char>('A' + (remaining_bits & 0xFu));
+  }
+  return key;
+}
+
+// Sub-linear growth of the smaller dimensions. Below scale factor 1, they shrink linearly, but not below minimum.
+int32_t scaled_row_count(const int32_t base_row_count, const float scale_factor, const int32_t minimum) {
+  const auto factor = scale_factor < 1.0f ? scale_factor : 1.0f + std::log2(scale_factor);
+  return std::max(minimum, static_cast<int32_t>(static_cast<float>(base_row_count) * factor));
+}
+
+std::string format_scale_factor(const float scale_factor) {
+  auto stream = std::ostringstream{};
+  stream << scale_factor;
+  return stream.str();
+}
+
+}  // namespace
+
+namespace opossum {
+
+TpcdsTableGenerator::TpcdsTableGenerator(float scale_factor, uint32_t chunk_size)
+    : AbstractTableGenerator(_create_minimal_benchmark_config(chunk_size)), _scale_factor(scale_factor) {}
+
+TpcdsTableGenerator::TpcdsTableGenerator(float scale_factor, const std::shared_ptr<BenchmarkConfig>& benchmark_config)
+    : AbstractTableGenerator(benchmark_config), _scale_factor(scale_factor) {}
+
+std::unordered_map<std::string, BenchmarkTableInfo> TpcdsTableGenerator::generate() {
+  const auto cache_directory = std::filesystem::path{"tpcds_cached_tables"} /
+                               ("sf-" + format_scale_factor(_scale_factor) + "-chunk_size-" +
+                                std::to_string(_benchmark_config->chunk_size));
+  auto table_info_by_name = _load_binary_tables_from_directory(
+      cache_directory, {"date_dim", "time_dim", "item", "customer_address", "customer", "customer_demographics",
+                        "household_demographics", "store", "promotion", "store_sales"});
+  if (!table_info_by_name.empty()) return table_info_by_name;
+
+  const auto item_count = scaled_row_count(18'000, _scale_factor, 100);
+  const auto store_count = scaled_row_count(12, _scale_factor, 12);
+  const auto promotion_count = scaled_row_count(300, _scale_factor, 30);
+  const auto customer_count = static_cast<int32_t>(_scale_factor * 100'000);
+  const auto customer_address_count = static_cast<int32_t>(_scale_factor * 50'000);
+  const auto ticket_count = static_cast<int32_t>(_scale_factor * 240'000);
+  Assert(customer_count > 0 && customer_address_count > 0 && ticket_count > 0, "Scale factor is too small");
+
+  // The full cross product of the demographic attributes is generated, except for small scale factors. Because the
+  // gender, marital status, and education status change fastest, the first rows still contain all their combinations.
+  const auto full_customer_demographics_count = static_cast<int32_t>(
+      genders.size() * marital_statuses.size() * education_statuses.size() * 20 * credit_ratings.size() * 7 * 7 * 7);
+  const auto customer_demographics_count = std::max(
+      static_cast<int32_t>(static_cast<float>(full_customer_demographics_count) * std::min(1.0f, _scale_factor)),
+      static_cast<int32_t>(genders.size() * marital_statuses.size() * education_statuses.size()));
+  const auto household_demographics_count = int32_t{20 * 6 * 10 * 6};
+
+  const auto chunk_size = _benchmark_config->chunk_size;
+  TableBuilder date_dim_builder{chunk_size, date_dim_column_types, date_dim_column_names, UseMvcc::Yes,
+                                static_cast<size_t>((last_date - first_date).days() + 1)};
+  TableBuilder time_dim_builder{chunk_size, time_dim_column_types, time_dim_column_names, UseMvcc::Yes,
+                                size_t{24 * 60 * 60}};
+  TableBuilder item_builder{chunk_size, item_column_types, item_column_names, UseMvcc::Yes,
+                            static_cast<size_t>(item_count)};
+  TableBuilder customer_address_builder{chunk_size, customer_address_column_types, customer_address_column_names,
+                                        UseMvcc::Yes, static_cast<size_t>(customer_address_count)};
+  TableBuilder customer_builder{chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes,
+                                static_cast<size_t>(customer_count)};
+  TableBuilder customer_demographics_builder{chunk_size, customer_demographics_column_types,
+                                             customer_demographics_column_names, UseMvcc::Yes,
+                                             static_cast<size_t>(customer_demographics_count)};
+  TableBuilder household_demographics_builder{chunk_size, household_demographics_column_types,
+                                              household_demographics_column_names, UseMvcc::Yes,
+                                              static_cast<size_t>(household_demographics_count)};
+  TableBuilder store_builder{chunk_size, store_column_types, store_column_names, UseMvcc::Yes,
+                             static_cast<size_t>(store_count)};
+  TableBuilder promotion_builder{chunk_size, promotion_column_types, promotion_column_names, UseMvcc::Yes,
+                                 static_cast<size_t>(promotion_count)};
+  TableBuilder store_sales_builder{chunk_size, store_sales_column_types, store_sales_column_names, UseMvcc::Yes,
+                                   static_cast<size_t>(ticket_count) * 12};
+
+  // Encode the chunks while the tables are generated instead of encoding the complete tables afterwards
+  const auto set_chunk_encoding_spec = [&](auto& builder, const std::string& table_name) {
+    builder.set_chunk_encoding_spec(BenchmarkTableEncoder::chunk_encoding_spec(
+        table_name, builder.column_definitions(), _benchmark_config->encoding_config));
+  };
+  set_chunk_encoding_spec(date_dim_builder, "date_dim");
+  set_chunk_encoding_spec(time_dim_builder, "time_dim");
+  set_chunk_encoding_spec(item_builder, "item");
+  set_chunk_encoding_spec(customer_address_builder, "customer_address");
+  set_chunk_encoding_spec(customer_builder, "customer");
+  set_chunk_encoding_spec(customer_demographics_builder, "customer_demographics");
+  set_chunk_encoding_spec(household_demographics_builder, "household_demographics");
+  set_chunk_encoding_spec(store_builder, "store");
+  set_chunk_encoding_spec(promotion_builder, "promotion");
+  set_chunk_encoding_spec(store_sales_builder, "store_sales");
+
+  auto value_generator = ValueGenerator{};
+
+  /**
+   * DATE_DIM and TIME_DIM
+   */
+
+  const auto first_date_sk = static_cast<int32_t>(first_date.julian_day());
+  for (auto date = first_date; date <= last_date; date += boost::gregorian::days{1}) {
+    const auto date_sk = static_cast<int32_t>(date.julian_day());
+    const auto month = static_cast<int32_t>(date.month().as_number());
+    date_dim_builder.append_row(int32_t{date_sk}, business_key(date_sk), boost::gregorian::to_iso_extended_string(date),
+                                static_cast<int32_t>(date.year()), int32_t{month}, static_cast<int32_t>(date.day()),
+                                (month - 1) / 3 + 1, std::string{date.day_of_week().as_long_string()},
+                                (date_sk - first_date_sk) / 7 + 1);
+  }
+
+  for (auto time_sk = int32_t{0}; time_sk < 24 * 60 * 60; ++time_sk) {
+    const auto hour = time_sk / 3600;
+    auto meal_time = std::string{};
+    if (hour >= 6 && hour < 9) meal_time = "breakfast";
+    if (hour >= 11 && hour < 14) meal_time = "lunch";
+    if (hour >= 17 && hour < 20) meal_time = "dinner";
+
+    time_dim_builder.append_row(int32_t{time_sk}, business_key(time_sk + 1), int32_t{time_sk}, int32_t{hour},
+                                time_sk / 60 % 60, time_sk % 60, std::string{hour < 12 ? "AM" : "PM"},
+                                std::string{hour < 8 ? "third" : hour < 16 ? "first" : "second"},
+                                std::move(meal_time));
+  }
+
+  /**
+   * ITEM
+   */
+
+  for (auto item_sk = int32_t{1}; item_sk <= item_count; ++item_sk) {
+    const auto category_id = value_generator.number(1, static_cast<int32_t>(categories.size()));
+    const auto class_id = value_generator.number(1, static_cast<int32_t>(classes.size()));
+    const auto brand_number = value_generator.number(1, 10);
+    const auto manufact_id = value_generator.number(1, 1000);
+    item_builder.append_row(
+        int32_t{item_sk}, business_key(item_sk),
+        value_generator.pick(colors) + " " + value_generator.pick(classes) + " for " + value_generator.pick(sizes) +
+            " customers",
+        value_generator.money(0.09, 99.99), category_id * 1'000'000 + class_id * 1'000 + brand_number,
+        brand_names[static_cast<size_t>(category_id - 1)] + " #" + std::to_string(brand_number), int32_t{class_id},
+        std::string{classes[static_cast<size_t>(class_id - 1)]}, int32_t{category_id},
+        std::string{categories[static_cast<size_t>(category_id - 1)]}, int32_t{manufact_id}, syllables(manufact_id),
+        std::string{value_generator.pick(sizes)}, std::string{value_generator.pick(colors)},
+        value_generator.number(1, 100));
+  }
+
+  /**
+   * CUSTOMER_ADDRESS and CUSTOMER
+   */
+
+  for (auto address_sk = int32_t{1}; address_sk <= customer_address_count; ++address_sk) {
+    customer_address_builder.append_row(
+        int32_t{address_sk}, business_key(address_sk), std::to_string(value_generator.number(1, 1000)),
+        value_generator.pick(street_names) + " " + value_generator.pick(street_types),
+        std::string{value_generator.pick(cities)}, std::string{value_generator.pick(counties)},
+        std::string{value_generator.pick(states)}, value_generator.zip(), std::string{"United States"},
+        static_cast<float>(value_generator.number(-8, -5)));
+  }
+
+  for (auto customer_sk = int32_t{1}; customer_sk <= customer_count; ++customer_sk) {
+    const auto& first_name = value_generator.pick(first_names);
+    const auto& last_name = value_generator.pick(last_names);
+    customer_builder.append_row(int32_t{customer_sk}, business_key(customer_sk),
+                                value_generator.number(1, customer_demographics_count),
+                                value_generator.number(1, household_demographics_count),
+                                value_generator.number(1, customer_address_count), std::string{first_name},
+                                std::string{last_name}, value_generator.number(1924, 1992),
+                                first_name + "." + last_name + "@" + syllables(customer_sk) + ".com");
+  }
+
+  /**
+   * CUSTOMER_DEMOGRAPHICS and HOUSEHOLD_DEMOGRAPHICS
+   */
+
+  for (auto demo_sk = int32_t{1}; demo_sk <= customer_demographics_count; ++demo_sk) {
+    // Decompose the key into the indices of the attribute values, the first attribute changing fastest
+    auto remainder = static_cast<size_t>(demo_sk - 1);
+    const auto next_index = [&](const size_t value_count) {
+      const auto index = remainder % value_count;
+      remainder /= value_count;
+      return index;
+    };
+    const auto gender_id = next_index(genders.size());
+    const auto marital_status_id = next_index(marital_statuses.size());
+    const auto education_status_id = next_index(education_statuses.size());
+    const auto purchase_estimate_id = next_index(20);
+    const auto credit_rating_id = next_index(credit_ratings.size());
+    const auto dep_count = next_index(7);
+    const auto dep_employed_count = next_index(7);
+    const auto dep_college_count = next_index(7);
+
+    customer_demographics_builder.append_row(
+        int32_t{demo_sk}, std::string{genders[gender_id]}, std::string{marital_statuses[marital_status_id]},
+        std::string{education_statuses[education_status_id]}, static_cast<int32_t>(500 * (purchase_estimate_id + 1)),
+        std::string{credit_ratings[credit_rating_id]}, static_cast<int32_t>(dep_count),
+        static_cast<int32_t>(dep_employed_count), static_cast<int32_t>(dep_college_count));
+  }
+
+  for (auto demo_sk = int32_t{1}; demo_sk <= household_demographics_count; ++demo_sk) {
+    const auto index = demo_sk - 1;
+    household_demographics_builder.append_row(int32_t{demo_sk}, index % 20 + 1,
+                                              std::string{buy_potentials[static_cast<size_t>(index / 20 % 6)]},
+                                              index / 120 % 10, index / 1200 % 6 - 1);
+  }
+
+  /**
+   * STORE and PROMOTION
+   */
+
+  for (auto store_sk = int32_t{1}; store_sk <= store_count; ++store_sk) {
+    store_builder.append_row(int32_t{store_sk}, business_key(store_sk), syllables(store_sk),
+                             value_generator.number(200, 300), std::string{value_generator.pick(cities)},
+                             std::string{value_generator.pick(counties)}, std::string{value_generator.pick(states)},
+                             value_generator.zip(), value_generator.number(0, 4) == 0 ? -6.0f : -5.0f);
+  }
+
+  for (auto promo_sk = int32_t{1}; promo_sk <= promotion_count; ++promo_sk) {
+    promotion_builder.append_row(int32_t{promo_sk}, business_key(promo_sk), syllables(promo_sk),
+                                 std::string{value_generator.number(0, 1) == 0 ? "N" : "Y"},
+                                 std::string{value_generator.number(0, 1) == 0 ? "N" : "Y"},
+                                 std::string{value_generator.number(0, 1) == 0 ? "N" : "Y"}, float{1000.0f});
+  }
+
+  /**
+   * STORE_SALES
+   */
+
+  const auto first_sales_date_sk = static_cast<int32_t>(first_sales_date.julian_day());
+  const auto last_sales_date_sk = static_cast<int32_t>(last_sales_date.julian_day());
+
+  for (auto ticket_number = int32_t{1}; ticket_number <= ticket_count; ++ticket_number) {
+    // The attributes of a ticket are shared by all its items
+    const auto sold_date_sk = value_generator.number(first_sales_date_sk, last_sales_date_sk);
+    const auto sold_time_sk = value_generator.number(8 * 3600, 22 * 3600 - 1);
+    const auto customer_sk = value_generator.skewed_number(1, customer_count);
+    const auto cdemo_sk = value_generator.number(1, customer_demographics_count);
+    const auto hdemo_sk = value_generator.number(1, household_demographics_count);
+    const auto addr_sk = value_generator.number(1, customer_address_count);
+    const auto store_sk = value_generator.number(1, store_count);
+
+    const auto line_count = value_generator.number(8, 16);
+    for (auto line_id = int32_t{0}; line_id < line_count; ++line_id) {
+      const auto quantity = value_generator.number(1, 100);
+      const auto wholesale_cost = value_generator.money(1.0, 100.0);
+      const auto list_price = std::round(wholesale_cost * (1.0f + value_generator.money(0.0, 2.0)) * 100.0f) / 100.0f;
+      const auto sales_price = std::round(list_price * (1.0f - value_generator.money(0.0, 1.0)) * 100.0f) / 100.0f;
+      const auto ext_sales_price = sales_price * static_cast<float>(quantity);
+      const auto ext_list_price = list_price * static_cast<float>(quantity);
+      const auto ext_wholesale_cost = wholesale_cost * static_cast<float>(quantity);
+      const auto coupon_amount = value_generator.number(0, 9) == 0 ? ext_sales_price * value_generator.money(0.0, 1.0)
+                                                                   : 0.0f;
+      const auto net_paid = ext_sales_price - coupon_amount;
+
+      store_sales_builder.append_row(
+          int32_t{sold_date_sk}, int32_t{sold_time_sk}, value_generator.skewed_number(1, item_count),
+          int32_t{customer_sk}, int32_t{cdemo_sk}, int32_t{hdemo_sk}, int32_t{addr_sk}, int32_t{store_sk},
+          value_generator.number(1, promotion_count), int32_t{ticket_number}, int32_t{quantity},
+          float{wholesale_cost}, float{list_price}, float{sales_price}, ext_list_price - ext_sales_price,
+          float{ext_sales_price}, float{ext_wholesale_cost}, float{ext_list_price},
+          ext_sales_price * value_generator.money(0.0, 0.09), float{coupon_amount}, float{net_paid},
+          net_paid - ext_wholesale_cost);
+    }
+  }
+
+  table_info_by_name["date_dim"].table = date_dim_builder.finish_table();
+  table_info_by_name["time_dim"].table = time_dim_builder.finish_table();
+  table_info_by_name["item"].table = item_builder.finish_table();
+  table_info_by_name["customer_address"].table = customer_address_builder.finish_table();
+  table_info_by_name["customer"].table = customer_builder.finish_table();
+  table_info_by_name["customer_demographics"].table = customer_demographics_builder.finish_table();
+  table_info_by_name["household_demographics"].table = household_demographics_builder.finish_table();
+  table_info_by_name["store"].table = store_builder.finish_table();
+  table_info_by_name["promotion"].table = promotion_builder.finish_table();
+  table_info_by_name["store_sales"].table = store_sales_builder.finish_table();
+
+  _set_binary_file_paths(table_info_by_name, cache_directory);
+
+  return table_info_by_name;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_table_generator.hpp"
+#include "storage/chunk.hpp"
+
+namespace opossum {
+
+/**
+ * Generates the tables of the store channel of TPC-DS that the queries in tpcds_queries.hpp use: the fact table
+ * store_sales and the dimensions date_dim, time_dim, item, customer, customer_address, customer_demographics,
+ * household_demographics, store, and promotion. Only the columns these queries (and typical ad-hoc queries on them)
+ * need are generated.
+ *
+ * As the official dsdgen is not available to us, the values are generated to resemble its output: the domains,
+ * business keys, and syllable-based names (e.g., s_store_name 'ese' for store 4 and i_manufact 'oughtableeing' for
+ * manufacturer 128) follow the specification, and the sales are skewed towards few items and customers. Results
+ * therefore differ from those of the official answer sets.
+ *
+ * store_sales has about SF * 2.9 million rows, customer SF * 100,000, and customer_address SF * 50,000. The smaller
+ * dimensions item, store, and promotion grow logarithmically with the scale factor, date_dim, time_dim, and
+ * household_demographics have a fixed size. customer_demographics is the cross product of its attributes (1,920,800
+ * rows) and only shrinks for scale factors below 1, so that small data sets can be generated quickly.
+ *
+ * With binary caching enabled, the tables are cached in tpcds_cached_tables/ and loaded from there by later runs.
+ */
+class TpcdsTableGenerator final : public AbstractTableGenerator {
+ public:
+  // Convenience constructor for creating a TpcdsTableGenerator out of a benchmarking context
+  explicit TpcdsTableGenerator(float scale_factor, uint32_t chunk_size = Chunk::DEFAULT_SIZE);
+
+  // Constructor for creating a TpcdsTableGenerator in a benchmark
+  TpcdsTableGenerator(float scale_factor, const std::shared_ptr<BenchmarkConfig>& benchmark_config);
+
+  std::unordered_map<std::string, BenchmarkTableInfo> generate() override;
+
+ private:
+  float _scale_factor;
+};
+
+}  // namespace opossum
@@ -6,18 +6,21 @@ extern "C" {
 #include <rnd.h>
 }
 
+#include <algorithm>
+#include <optional>
 #include <utility>
-
-#include "boost/hana/for_each.hpp"
-#include "boost/hana/integral_constant.hpp"
-#include "boost/hana/zip_with.hpp"
+#include <vector>
 
 #include "benchmark_config.hpp"
+#include "benchmark_table_encoder.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/storage_manager.hpp"
+#include "table_builder.hpp"
 
 extern char** asc_date;
-extern seed_t seed[];
+extern "C" void NthElement(DSS_HUGE N, DSS_HUGE* StartSeed);
 
 #pragma clang diagnostic ignored "-Wshorten-64-to-32"
 #pragma clang diagnostic ignored "-Wfloat-conversion"
@@ -53,96 +56,6 @@ const auto region_column_names = boost::hana::make_tuple("r_regionkey", "r_name"
 
 // clang-format on
 
-/**
- * Helper to build a table with a static (specified by template args `ColumnTypes`) column type layout. Keeps a vector
- * for each column and appends values to them in append_row(). Automatically creates chunks in accordance with the
- * specified chunk size.
- *
- * No real need to tie this to TPCH, but atm it is only used here so that's where it resides.
- */
-template <typename... DataTypes>
-class TableBuilder {
- public:
-  template <typename... Strings>
-  TableBuilder(size_t chunk_size, const boost::hana::tuple<DataTypes...>& column_types,
-               const boost::hana::tuple<Strings...>& column_names, opossum::UseMvcc use_mvcc, size_t estimated_rows = 0)
-      : _use_mvcc(use_mvcc), _estimated_rows_per_chunk(estimated_rows < chunk_size ? estimated_rows : chunk_size) {
-    /**
-     * Create a tuple ((column_name0, column_type0), (column_name1, column_type1), ...) so we can iterate over the
-     * columns.
-     * fold_left as below does this in order, I think boost::hana::zip_with() doesn't, which is why I'm doing two steps
-     * here.
-     */
-    const auto column_names_and_data_types = boost::hana::zip_with(
-        [&](auto column_type, auto column_name) {
-          return boost::hana::make_tuple(column_name, opossum::data_type_from_type<decltype(column_type)>());
-        },
-        column_types, column_names);
-
-    // Iterate over the column types/names and create the columns.
-    opossum::TableColumnDefinitions column_definitions;
-    boost::hana::fold_left(column_names_and_data_types, column_definitions,
-                           [](auto& definitions, auto column_name_and_type) -> decltype(auto) {
-                             definitions.emplace_back(column_name_and_type[boost::hana::llong_c<0>],
-                                                      column_name_and_type[boost::hana::llong_c<1>]);
-                             return definitions;
-                           });
-    _table = std::make_shared<opossum::Table>(column_definitions, opossum::TableType::Data, chunk_size, use_mvcc);
-
-    // Reserve some space in the vectors
-    boost::hana::for_each(_data_vectors, [&](auto&& vector) { vector.reserve(_estimated_rows_per_chunk); });
-  }
-
-  std::shared_ptr<opossum::Table> finish_table() {
-    if (_current_chunk_row_count() > 0) {
-      _emit_chunk();
-    }
-
-    return _table;
-  }
-
-  void append_row(DataTypes&&... column_values) {
-    // Create a tuple ([&data_vector0, value0], ...)
-    auto vectors_and_values = boost::hana::zip_with(
-        [](auto& vector, auto&& value) {
-          return boost::hana::make_tuple(std::reference_wrapper(vector), std::forward<decltype(value)>(value));
-        },
-        _data_vectors, boost::hana::make_tuple(std::forward<DataTypes>(column_values)...));
-
-    // Add the values to their respective data vector
-    boost::hana::for_each(vectors_and_values, [](auto&& vector_and_value) {
-      vector_and_value[boost::hana::llong_c<0>].get().emplace_back(
-          std::move(vector_and_value[boost::hana::llong_c<1>]));
-    });
-
-    if (_current_chunk_row_count() >= _table->max_chunk_size()) {
-      _emit_chunk();
-    }
-  }
-
- private:
-  std::shared_ptr<opossum::Table> _table;
-  opossum::UseMvcc _use_mvcc;
-  boost::hana::tuple<std::vector<DataTypes>...> _data_vectors;
-  size_t _estimated_rows_per_chunk;
-
-  size_t _current_chunk_row_count() const { return _data_vectors[boost::hana::llong_c<0>].size(); }
-
-  void _emit_chunk() {
-    opossum::Segments segments;
-
-    // Create a segment from each data vector and add it to the Chunk, then re-initialize the vector
-    boost::hana::for_each(_data_vectors, [&](auto&& vector) {
-      using T = typename std::decay_t<decltype(vector)>::value_type;
-      // reason for nolint: clang-tidy wants this to be a forward, but that doesn't work
-      segments.push_back(std::make_shared<opossum::ValueSegment<T>>(std::move(vector)));  // NOLINT
-      vector = std::decay_t<decltype(vector)>();
-      vector.reserve(_estimated_rows_per_chunk);
-    });
-    _table->append_chunk(segments);
-  }
-};
-
 std::unordered_map<opossum::TpchTable, std::underlying_type_t<opossum::TpchTable>> tpch_table_to_dbgen_id = {
     {opossum::TpchTable::Part, PART},     {opossum::TpchTable::PartSupp, PSUPP}, {opossum::TpchTable::Supplier, SUPP},
     {opossum::TpchTable::Customer, CUST}, {opossum::TpchTable::Orders, ORDER},   {opossum::TpchTable::LineItem, LINE},
@@ -167,12 +80,39 @@ DSSType call_dbgen_mk(size_t idx, MKRetType (*mk_fn)(DSS_HUGE, DSSType* val, Arg
   return value;
 }
 
+/**
+ * Advances dbgen's random number streams of @param table (and of its child table, e.g., LINEITEM for ORDERS) past the
+ * first @param row_count rows, as if these rows had been generated. This works because row_stop() advances each stream
+ * to the next multiple of its per-row boundary after each row, so that every row draws the same number of values.
+ */
+void skip_dbgen_rows(const TpchTable table, const size_t row_count) {
+  const auto dbgen_table_id = tpch_table_to_dbgen_id.at(table);
+  for (auto stream_id = 0; stream_id <= MAX_STREAM; ++stream_id) {
+    auto& stream = Seed[stream_id];
+    if (stream.table != dbgen_table_id && stream.table != tdefs[dbgen_table_id].child) continue;
+    NthElement(static_cast<DSS_HUGE>(row_count) * stream.boundary, &stream.value);
+  }
+}
+
 float convert_money(DSS_HUGE cents) {
   const auto dollars = cents / 100;
   cents %= 100;
   return dollars + (static_cast<float>(cents)) / 100.0f;
 }
 
+// Appends the chunks of the tables that were generated for consecutive row ranges to a single table
+std::shared_ptr<Table> concatenate_tables(const std::vector<std::shared_ptr<Table>>& tables) {
+  const auto& first_table = tables.front();
+  auto table = std::make_shared<Table>(first_table->column_definitions(), TableType::Data,
+                                       first_table->max_chunk_size(), UseMvcc::Yes);
+  for (const auto& partial_table : tables) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < partial_table->chunk_count(); ++chunk_id) {
+      table->append_chunk(partial_table->get_chunk(chunk_id));
+    }
+  }
+  return table;
+}
+
 /**
  * Call this after using dbgen to avoid memory leaks
  */
@@ -227,102 +167,192 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
   const auto nation_count = static_cast<size_t>(tdefs[NATION].base);
   const auto region_count = static_cast<size_t>(tdefs[REGION].base);
 
-  // The `* 4` part is defined in the TPC-H specification.
-  TableBuilder customer_builder{_benchmark_config->chunk_size, customer_column_types, customer_column_names,
-                                UseMvcc::Yes, customer_count};
-  TableBuilder order_builder{_benchmark_config->chunk_size, order_column_types, order_column_names, UseMvcc::Yes,
-                             order_count};
-  TableBuilder lineitem_builder{_benchmark_config->chunk_size, lineitem_column_types, lineitem_column_names,
-                                UseMvcc::Yes, order_count * 4};
-  TableBuilder part_builder{_benchmark_config->chunk_size, part_column_types, part_column_names, UseMvcc::Yes,
-                            part_count};
-  TableBuilder partsupp_builder{_benchmark_config->chunk_size, partsupp_column_types, partsupp_column_names,
-                                UseMvcc::Yes, part_count * 4};
-  TableBuilder supplier_builder{_benchmark_config->chunk_size, supplier_column_types, supplier_column_names,
-                                UseMvcc::Yes, supplier_count};
-  TableBuilder nation_builder{_benchmark_config->chunk_size, nation_column_types, nation_column_names, UseMvcc::Yes,
-                              nation_count};
-  TableBuilder region_builder{_benchmark_config->chunk_size, region_column_types, region_column_names, UseMvcc::Yes,
-                              region_count};
-
+  /**
+   * The tables are generated in parallel: Each task generates a range of rows into its own TableBuilders, which encode
+   * the chunks as soon as they are complete. As dbgen's random number streams are thread-local, a task only has to
+   * reset them and skip the rows before its range to generate the same rows as a sequential run. The ranges are
+   * multiples of the chunk size, so that only the last chunk of a range is incomplete - for LINEITEM, whose row count
+   * per order varies, and for the last range.
+   *
+   * Some state of dbgen is lazily initialized when the first row is generated (e.g., the text pool for the comments).
+   * To avoid races, a row of each table is generated before the tasks are started.
+   */
   dbgen_reset_seeds();
+  call_dbgen_mk<customer_t>(1, mk_cust, TpchTable::Customer);
+  call_dbgen_mk<order_t>(1, mk_order, TpchTable::Orders, 0l, _scale_factor);
+  call_dbgen_mk<part_t>(1, mk_part, TpchTable::Part, _scale_factor);
+  call_dbgen_mk<supplier_t>(1, mk_supp, TpchTable::Supplier);
+
+  const auto chunk_size = _benchmark_config->chunk_size;
+  const auto rows_per_task = size_t{4} * chunk_size;
+
+  // Creates a TableBuilder that encodes its chunks as configured for the table
+  const auto create_table_builder = [&](const auto& column_types, const auto& column_names, const TpchTable table,
+                                        const size_t estimated_rows) {
+    auto builder = TableBuilder{chunk_size, column_types, column_names, UseMvcc::Yes, estimated_rows};
+    builder.set_chunk_encoding_spec(BenchmarkTableEncoder::chunk_encoding_spec(
+        tpch_table_names.at(table), builder.column_definitions(), _benchmark_config->encoding_config));
+    return builder;
+  };
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  // Adds a task for each range of rows_per_task rows (at least one, so that empty tables are created as well).
+  // @param generate_range is called with the index of the range and its first and last (exclusive) row. Returns the
+  // number of ranges.
+  const auto add_tasks = [&](const size_t row_count, const auto& generate_range) {
+    const auto range_count = std::max(size_t{1}, (row_count + rows_per_task - 1) / rows_per_task);
+    for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+      const auto first_row = range_id * rows_per_task;
+      const auto last_row = std::min(first_row + rows_per_task, row_count);
+      tasks.emplace_back(std::make_shared<JobTask>([&generate_range, range_id, first_row, last_row]() {
+        dbgen_reset_seeds();
+        generate_range(range_id, first_row, last_row);
+      }));
+    }
+    return range_count;
+  };
 
   /**
    * CUSTOMER
    */
 
-  for (size_t row_idx = 0; row_idx < customer_count; row_idx++) {
-    auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
-    customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code, customer.phone,
-                                convert_money(customer.acctbal), customer.mktsegment, customer.comment);
-  }
+  auto customer_tables = std::vector<std::shared_ptr<Table>>{};
+  const auto generate_customers = [&](const size_t range_id, const size_t first_row, const size_t last_row) {
+    auto customer_builder =
+        create_table_builder(customer_column_types, customer_column_names, TpchTable::Customer, last_row - first_row);
+    skip_dbgen_rows(TpchTable::Customer, first_row);
+
+    for (auto row_idx = first_row; row_idx < last_row; ++row_idx) {
+      auto customer = call_dbgen_mk<customer_t>(row_idx + 1, mk_cust, TpchTable::Customer);
+      customer_builder.append_row(customer.custkey, customer.name, customer.address, customer.nation_code,
+                                  customer.phone, convert_money(customer.acctbal), customer.mktsegment,
+                                  customer.comment);
+    }
+
+    customer_tables[range_id] = customer_builder.finish_table();
+  };
+  customer_tables.resize(add_tasks(customer_count, generate_customers));
 
   /**
    * ORDER and LINEITEM
    */
 
-  for (size_t order_idx = 0; order_idx < order_count; ++order_idx) {
-    const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TpchTable::Orders, 0l, _scale_factor);
-
-    order_builder.append_row(order.okey, order.custkey, std::string(1, order.orderstatus),
-                             convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
-                             order.spriority, order.comment);
-
-    for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
-      const auto& lineitem = order.l[line_idx];
-
-      lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt, lineitem.quantity,
-                                  convert_money(lineitem.eprice), convert_money(lineitem.discount),
-                                  convert_money(lineitem.tax), std::string(1, lineitem.rflag[0]),
-                                  std::string(1, lineitem.lstatus[0]), lineitem.sdate, lineitem.cdate, lineitem.rdate,
-                                  lineitem.shipinstruct, lineitem.shipmode, lineitem.comment);
+  auto order_tables = std::vector<std::shared_ptr<Table>>{};
+  auto lineitem_tables = std::vector<std::shared_ptr<Table>>{};
+  const auto generate_orders = [&](const size_t range_id, const size_t first_row, const size_t last_row) {
+    // The `* 4` part is defined in the TPC-H specification.
+    auto order_builder =
+        create_table_builder(order_column_types, order_column_names, TpchTable::Orders, last_row - first_row);
+    auto lineitem_builder = create_table_builder(lineitem_column_types, lineitem_column_names, TpchTable::LineItem,
+                                                 (last_row - first_row) * 4);
+    skip_dbgen_rows(TpchTable::Orders, first_row);
+
+    for (auto order_idx = first_row; order_idx < last_row; ++order_idx) {
+      const auto order = call_dbgen_mk<order_t>(order_idx + 1, mk_order, TpchTable::Orders, 0l, _scale_factor);
+
+      order_builder.append_row(order.okey, order.custkey, std::string(1, order.orderstatus),
+                               convert_money(order.totalprice), order.odate, order.opriority, order.clerk,
+                               order.spriority, order.comment);
+
+      for (auto line_idx = 0; line_idx < order.lines; ++line_idx) {
+        const auto& lineitem = order.l[line_idx];
+
+        lineitem_builder.append_row(lineitem.okey, lineitem.partkey, lineitem.suppkey, lineitem.lcnt,
+                                    lineitem.quantity, convert_money(lineitem.eprice),
+                                    convert_money(lineitem.discount), convert_money(lineitem.tax),
+                                    std::string(1, lineitem.rflag[0]), std::string(1, lineitem.lstatus[0]),
+                                    lineitem.sdate, lineitem.cdate, lineitem.rdate, lineitem.shipinstruct,
+                                    lineitem.shipmode, lineitem.comment);
+      }
     }
-  }
+
+    order_tables[range_id] = order_builder.finish_table();
+    lineitem_tables[range_id] = lineitem_builder.finish_table();
+  };
+  order_tables.resize(add_tasks(order_count, generate_orders));
+  lineitem_tables.resize(order_tables.size());
 
   /**
    * PART and PARTSUPP
    */
 
-  for (size_t part_idx = 0; part_idx < part_count; ++part_idx) {
-    const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TpchTable::Part, _scale_factor);
-
-    part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
-                            convert_money(part.retailprice), part.comment);
-
-    for (const auto& partsupp : part.s) {
-      partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, convert_money(partsupp.scost),
-                                  partsupp.comment);
+  auto part_tables = std::vector<std::shared_ptr<Table>>{};
+  auto partsupp_tables = std::vector<std::shared_ptr<Table>>{};
+  const auto generate_parts = [&](const size_t range_id, const size_t first_row, const size_t last_row) {
+    auto part_builder =
+        create_table_builder(part_column_types, part_column_names, TpchTable::Part, last_row - first_row);
+    auto partsupp_builder = create_table_builder(partsupp_column_types, partsupp_column_names, TpchTable::PartSupp,
+                                                 (last_row - first_row) * 4);
+    skip_dbgen_rows(TpchTable::Part, first_row);
+
+    for (auto part_idx = first_row; part_idx < last_row; ++part_idx) {
+      const auto part = call_dbgen_mk<part_t>(part_idx + 1, mk_part, TpchTable::Part, _scale_factor);
+
+      part_builder.append_row(part.partkey, part.name, part.mfgr, part.brand, part.type, part.size, part.container,
+                              convert_money(part.retailprice), part.comment);
+
+      for (const auto& partsupp : part.s) {
+        partsupp_builder.append_row(partsupp.partkey, partsupp.suppkey, partsupp.qty, convert_money(partsupp.scost),
+                                    partsupp.comment);
+      }
     }
-  }
+
+    part_tables[range_id] = part_builder.finish_table();
+    partsupp_tables[range_id] = partsupp_builder.finish_table();
+  };
+  part_tables.resize(add_tasks(part_count, generate_parts));
+  partsupp_tables.resize(part_tables.size());
 
   /**
    * SUPPLIER
    */
 
-  for (size_t supplier_idx = 0; supplier_idx < supplier_count; ++supplier_idx) {
-    const auto supplier = call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TpchTable::Supplier);
+  auto supplier_tables = std::vector<std::shared_ptr<Table>>{};
+  const auto generate_suppliers = [&](const size_t range_id, const size_t first_row, const size_t last_row) {
+    auto supplier_builder =
+        create_table_builder(supplier_column_types, supplier_column_names, TpchTable::Supplier, last_row - first_row);
+    skip_dbgen_rows(TpchTable::Supplier, first_row);
 
-    supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code, supplier.phone,
-                                convert_money(supplier.acctbal), supplier.comment);
-  }
+    for (auto supplier_idx = first_row; supplier_idx < last_row; ++supplier_idx) {
+      const auto supplier = call_dbgen_mk<supplier_t>(supplier_idx + 1, mk_supp, TpchTable::Supplier);
 
-  /**
-   * NATION
-   */
+      supplier_builder.append_row(supplier.suppkey, supplier.name, supplier.address, supplier.nation_code,
+                                  supplier.phone, convert_money(supplier.acctbal), supplier.comment);
+    }
 
-  for (size_t nation_idx = 0; nation_idx < nation_count; ++nation_idx) {
-    const auto nation = call_dbgen_mk<code_t>(nation_idx + 1, mk_nation, TpchTable::Nation);
-    nation_builder.append_row(nation.code, nation.text, nation.join, nation.comment);
-  }
+    supplier_tables[range_id] = supplier_builder.finish_table();
+  };
+  supplier_tables.resize(add_tasks(supplier_count, generate_suppliers));
 
   /**
-   * REGION
+   * NATION and REGION, which are too small to be split
    */
 
-  for (size_t region_idx = 0; region_idx < region_count; ++region_idx) {
-    const auto region = call_dbgen_mk<code_t>(region_idx + 1, mk_region, TpchTable::Region);
-    region_builder.append_row(region.code, region.text, region.comment);
-  }
+  auto nation_table = std::shared_ptr<Table>{};
+  auto region_table = std::shared_ptr<Table>{};
+  tasks.emplace_back(std::make_shared<JobTask>([&]() {
+    dbgen_reset_seeds();
+
+    auto nation_builder =
+        create_table_builder(nation_column_types, nation_column_names, TpchTable::Nation, nation_count);
+    for (size_t nation_idx = 0; nation_idx < nation_count; ++nation_idx) {
+      const auto nation = call_dbgen_mk<code_t>(nation_idx + 1, mk_nation, TpchTable::Nation);
+      nation_builder.append_row(nation.code, nation.text, nation.join, nation.comment);
+    }
+    nation_table = nation_builder.finish_table();
+
+    auto region_builder =
+        create_table_builder(region_column_types, region_column_names, TpchTable::Region, region_count);
+    for (size_t region_idx = 0; region_idx < region_count; ++region_idx) {
+      const auto region = call_dbgen_mk<code_t>(region_idx + 1, mk_region, TpchTable::Region);
+      region_builder.append_row(region.code, region.text, region.comment);
+    }
+    region_table = region_builder.finish_table();
+  }));
+
+  // The vectors for the results of the tasks are sized, so the tasks can be started
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
 
   /**
    * Clean up dbgen every time we finish table generation to avoid memory leaks in dbgen
@@ -334,14 +364,14 @@ std::unordered_map<std::string, BenchmarkTableInfo> TpchTableGenerator::generate
    */
   std::unordered_map<std::string, BenchmarkTableInfo> table_info_by_name;
 
-  table_info_by_name["customer"].table = customer_builder.finish_table();
-  table_info_by_name["orders"].table = order_builder.finish_table();
-  table_info_by_name["lineitem"].table = lineitem_builder.finish_table();
-  table_info_by_name["part"].table = part_builder.finish_table();
-  table_info_by_name["partsupp"].table = partsupp_builder.finish_table();
-  table_info_by_name["supplier"].table = supplier_builder.finish_table();
-  table_info_by_name["nation"].table = nation_builder.finish_table();
-  table_info_by_name["region"].table = region_builder.finish_table();
+  table_info_by_name["customer"].table = concatenate_tables(customer_tables);
+  table_info_by_name["orders"].table = concatenate_tables(order_tables);
+  table_info_by_name["lineitem"].table = concatenate_tables(lineitem_tables);
+  table_info_by_name["part"].table = concatenate_tables(part_tables);
+  table_info_by_name["partsupp"].table = concatenate_tables(partsupp_tables);
+  table_info_by_name["supplier"].table = concatenate_tables(supplier_tables);
+  table_info_by_name["nation"].table = nation_table;
+  table_info_by_name["region"].table = region_table;
 
   return table_info_by_name;
 }
@@ -1,11 +1,19 @@
 #include <boost/asio/io_service.hpp>
+#include <boost/asio/signal_set.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <csignal>
 #include <cstdio>
 #include <cstdlib>
+#include <functional>
+#include <iomanip>
 #include <iostream>
+#include <thread>
 
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/scheduler_statistics.hpp"
 #include "scheduler/topology.hpp"
 #include "server/server.hpp"
 #include "storage/storage_manager.hpp"
@@ -23,15 +31,39 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(port_long);
     }
 
+    // The sessions are distributed over these threads, so that the network I/O of many clients uses multiple cores
+    auto session_thread_count = size_t{std::max(1u, std::thread::hardware_concurrency())};
+
+    if (argc >= 3) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto thread_count_long = std::strtol(argv[2], &endptr, 10);
+      Assert(errno == 0 && thread_count_long > 0 && *endptr == 0, "invalid session thread count");
+      session_thread_count = static_cast<size_t>(thread_count_long);
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
-    opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
+    const auto scheduler = std::make_shared<opossum::NodeQueueScheduler>();
+    opossum::CurrentScheduler::set(scheduler);
+    scheduler->start_queue_depth_sampling(std::chrono::seconds{1});
 
     boost::asio::io_service io_service;
 
+    // Dumps the scheduler statistics to stdout on SIGUSR1, e.g., to tell whether slow queries are CPU-bound or wait for
+    // Workers
+    boost::asio::signal_set statistics_signal{io_service, SIGUSR1};
+    std::function<void(const boost::system::error_code&, int)> dump_statistics;
+    dump_statistics = [&](const boost::system::error_code& error, int /* signal_number */) {
+      if (error) return;
+      std::cout << std::setw(2) << scheduler->statistics().to_json() << std::endl;
+      statistics_signal.async_wait(dump_statistics);
+    };
+    statistics_signal.async_wait(dump_statistics);
+
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
-    // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    // constructor and then runs forever. The sessions themselves run on the server's own session threads.
+    opossum::Server server{io_service, port, session_thread_count};
 
     io_service.run();
   } catch (std::exception& e) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -15,74 +17,170 @@ namespace opossum {
 
 inline constexpr size_t DefaultCacheCapacity = 1024;
 
-// Per-default, uses the GDFS cache as underlying storage.
+// A cache is split into shards of at least this capacity, so that small caches keep their exact eviction policy
+inline constexpr size_t MinCacheShardCapacity = 64;
+inline constexpr size_t MaxCacheShardCount = 16;
+
+/**
+ * Thread-safe cache that is, per default, backed by GDFS caches.
+ *
+ * The entries are distributed over shards by the hash of their key. Each shard has its own cache implementation and
+ * mutex, so that concurrent queries rarely wait for each other. Consequently, the eviction policy only considers the
+ * entries of one shard, i.e., it is applied approximately.
+ */
 template <typename Value, typename Key = std::string>
 class Cache : public Singleton<Cache<Value, Key>> {
  public:
   using Iterator = typename AbstractCacheImpl<Key, Value>::ErasedIterator;
 
-  explicit Cache(size_t capacity = DefaultCacheCapacity)
-      : _impl(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+  explicit Cache(size_t capacity = DefaultCacheCapacity) { replace_cache_impl<GDFSCache<Key, Value>>(capacity); }
 
   virtual ~Cache() {}
 
-  // Adds or refreshes the cache entry [query, value].
-  void set(const Key& query, const Value& value) {
-    if (_impl->capacity() == 0) return;
+  // Adds or refreshes the cache entry [query, value]. The cost and size are used by the eviction strategies that
+  // consider them (see AbstractCacheImpl::set()).
+  void set(const Key& query, const Value& value, double cost = 1.0, double size = 1.0) {
+    auto& shard = _shard(query);
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    _impl->set(query, value);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.impl->capacity() == 0) return;
+    shard.impl->set(query, value, cost, size);
   }
 
   // Tries to fetch the cache entry for the query into the result object.
   // Returns true if the entry was found, false otherwise.
   std::optional<Value> try_get(const Key& query) {
-    if (_impl->capacity() == 0) return {};
+    auto& shard = _shard(query);
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_impl->has(query)) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (!shard.impl->has(query)) {
       return {};
     }
-    return _impl->get(query);
+    return shard.impl->get(query);
   }
 
   // Checks whether an entry for the query exists.
-  bool has(const Key& query) const { return _impl->has(query); }
+  bool has(const Key& query) const {
+    auto& shard = _shard(query);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.impl->has(query);
+  }
 
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get_entry(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _impl->get(query);
+    auto& shard = _shard(query);
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.impl->get(query);
   }
 
   // Purges all entries from the cache.
-  void clear() { _impl->clear(); }
+  void clear() {
+    for (auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.impl->clear();
+    }
+  }
 
-  void resize(size_t capacity) { _impl->resize(capacity); }
+  // Distributes the capacity over the existing shards
+  void resize(size_t capacity) {
+    for (auto shard_id = size_t{0}; shard_id < _shards.size(); ++shard_id) {
+      std::lock_guard<std::mutex> lock(_shards[shard_id].mutex);
+      _shards[shard_id].impl->resize(_shard_capacity(capacity, shard_id));
+    }
+  }
 
-  size_t size() const { return _impl->size(); }
+  size_t size() const {
+    auto size = size_t{0};
+    for (auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      size += shard.impl->size();
+    }
+    return size;
+  }
+
+  size_t capacity() const {
+    auto capacity = size_t{0};
+    for (auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      capacity += shard.impl->capacity();
+    }
+    return capacity;
+  }
 
-  // Returns a reference to the underlying cache.
-  AbstractCacheImpl<Key, Value>& cache() { return *_impl; }
-  const AbstractCacheImpl<Key, Value>& cache() const { return *_impl; }
+  size_t shard_count() const { return _shards.size(); }
 
-  // Replaces the underlying cache by creating a new object
-  // of the given cache type.
+  // Replaces the underlying caches by creating new objects of the given cache type. Not thread-safe.
   template <class cache_t>
   void replace_cache_impl(size_t capacity) {
-    _impl = std::make_unique<cache_t>(capacity);
+    const auto shard_count = std::clamp(capacity / MinCacheShardCapacity, size_t{1}, MaxCacheShardCount);
+    _shards = std::vector<Shard>(shard_count);
+    for (auto shard_id = size_t{0}; shard_id < shard_count; ++shard_id) {
+      _shards[shard_id].impl = std::make_unique<cache_t>(_shard_capacity(capacity, shard_id));
+    }
   }
 
-  Iterator begin() { return _impl->begin(); }
+  // Iterates over the entries of all shards. Not thread-safe.
+  Iterator begin() { return Iterator{std::make_unique<ShardIterator>(_shards, 0)}; }
 
-  Iterator end() { return _impl->end(); }
+  Iterator end() { return Iterator{std::make_unique<ShardIterator>(_shards, _shards.size())}; }
 
  protected:
-  // Underlying cache eviction strategy.
-  std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
+  struct Shard {
+    // Underlying cache eviction strategy.
+    std::unique_ptr<AbstractCacheImpl<Key, Value>> impl;
+
+    mutable std::mutex mutex;
+  };
+
+  using KeyValuePair = typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+
+  // Chains the iterators of the shards
+  class ShardIterator : public AbstractCacheImpl<Key, Value>::AbstractIterator {
+   public:
+    ShardIterator(std::vector<Shard>& shards, const size_t shard_id) : _shards(shards), _shard_id(shard_id) {
+      _skip_exhausted_shards();
+    }
+
+    void increment() override {
+      ++*_iterator;
+      _skip_exhausted_shards();
+    }
+
+    bool equal(const typename AbstractCacheImpl<Key, Value>::AbstractIterator& other) const override {
+      const auto& other_iterator = static_cast<const ShardIterator&>(other);
+      if (_shard_id != other_iterator._shard_id) return false;
+      return _shard_id == _shards.size() || *_iterator == *other_iterator._iterator;
+    }
+
+    const KeyValuePair& dereference() const override { return **_iterator; }
+
+   private:
+    void _skip_exhausted_shards() {
+      while (_shard_id < _shards.size()) {
+        if (!_iterator) _iterator.emplace(_shards[_shard_id].impl->begin());
+        if (*_iterator != _shards[_shard_id].impl->end()) return;
+
+        _iterator.reset();
+        ++_shard_id;
+      }
+    }
+
+    std::vector<Shard>& _shards;
+    size_t _shard_id;
+    std::optional<Iterator> _iterator;
+  };
+
+  Shard& _shard(const Key& query) { return _shards[std::hash<Key>{}(query) % _shards.size()]; }
+  const Shard& _shard(const Key& query) const { return _shards[std::hash<Key>{}(query) % _shards.size()]; }
+
+  size_t _shard_capacity(const size_t capacity, const size_t shard_id) const {
+    return capacity / _shards.size() + (shard_id < capacity % _shards.size() ? 1 : 0);
+  }
 
-  std::mutex _mutex;
+  std::vector<Shard> _shards;
 };
 
 }  // namespace opossum
@@ -9,7 +9,8 @@
 
 namespace opossum {
 
-// Generic cache implementation using the GDFS policy.
+// Generic cache implementation using the GDFS (Greedy-Dual-Size-Frequency) policy. The priority of an entry grows with
+// its frequency and the cost of recomputing it and shrinks with its size.
 // Note: This implementation is not thread-safe.
 template <typename Key, typename Value>
 class GDFSCache : public AbstractCacheImpl<Key, Value> {
@@ -19,6 +20,7 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
     Key key;
     Value value;
     size_t frequency;
+    double cost;
     double size;
     double priority;
 
@@ -69,9 +71,10 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
 
       GDFSCacheEntry& entry = (*handle);
       entry.value = value;
+      entry.cost = cost;
       entry.size = size;
       entry.frequency++;
-      entry.priority = _inflation + entry.frequency / entry.size;
+      entry.priority = _priority(entry);
       _queue.update(handle);
 
       return;
@@ -87,8 +90,8 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
     }
 
     // Insert new item in cache.
-    GDFSCacheEntry entry{key, value, 1, size, 0.0};
-    entry.priority = _inflation + entry.frequency / entry.size;
+    GDFSCacheEntry entry{key, value, 1, cost, size, 0.0};
+    entry.priority = _priority(entry);
     Handle handle = _queue.push(entry);
     _map[key] = handle;
   }
@@ -98,7 +101,7 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
     Handle handle = it->second;
     GDFSCacheEntry& entry = (*handle);
     entry.frequency++;
-    entry.priority = _inflation + entry.frequency / entry.size;
+    entry.priority = _priority(entry);
     _queue.update(handle);
     return entry.value;
   }
@@ -123,6 +126,9 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
 
   double inflation() const { return _inflation; }
 
+  // Evicts the entry with the lowest priority, e.g., to bound the total size of the entries rather than their number
+  void evict() { _evict(); }
+
   double priority(const Key& key) const {
     auto it = _map.find(key);
     return (*it->second).priority;
@@ -142,6 +148,10 @@ class GDFSCache : public AbstractCacheImpl<Key, Value> {
   // Inflation value that will be updated whenever an item is evicted.
   double _inflation;
 
+  double _priority(const GDFSCacheEntry& entry) const {
+    return _inflation + static_cast<double>(entry.frequency) * entry.cost / entry.size;
+  }
+
   void _evict() {
     auto top = _queue.top();
 
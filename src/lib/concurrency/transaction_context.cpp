@@ -2,21 +2,31 @@
 
 #include <future>
 #include <memory>
+#include <optional>
 
 #include "commit_context.hpp"
+#include "logging/logger.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "transaction_manager.hpp"
 #include "utils/assert.hpp"
+#include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
-TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id)
+TransactionContext::TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id,
+                                       const bool is_read_only)
     : _transaction_id{transaction_id},
       _snapshot_commit_id{snapshot_commit_id},
+      _is_read_only{is_read_only},
       _phase{TransactionPhase::Active},
-      _num_active_operators{0} {}
+      _num_active_operators{0} {
+  TransactionManager::get()._register_transaction(_snapshot_commit_id);
+  DTRACE_PROBE3(HYRISE, TRANSACTION_BEGIN, _transaction_id, _snapshot_commit_id, _is_read_only);
+}
 
 TransactionContext::~TransactionContext() {
+  _deregister();
+
   DebugAssert(([this]() {
                 auto an_operator_failed = false;
                 for (const auto& op : _rw_operators) {
@@ -43,6 +53,7 @@ TransactionContext::~TransactionContext() {
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
 CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
+bool TransactionContext::is_read_only() const { return _is_read_only; }
 
 CommitID TransactionContext::commit_id() const {
   Assert((_commit_context != nullptr), "TransactionContext cid only available after commit context has been created.");
@@ -67,11 +78,19 @@ bool TransactionContext::rollback() {
   }
 
   _mark_as_rolled_back();
+  DTRACE_PROBE1(HYRISE, TRANSACTION_ROLLBACK, _transaction_id);
 
   return true;
 }
 
+void TransactionContext::register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) {
+  Assert(!_is_read_only, "Read-only transactions cannot write");
+  _rw_operators.push_back(op);
+}
+
 bool TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
+  if (_is_read_only) return _commit_read_only(callback);
+
   const auto success = _prepare_commit();
 
   if (!success) return false;
@@ -79,6 +98,7 @@ bool TransactionContext::commit_async(const std::function<void(TransactionID)>&
   for (const auto& op : _rw_operators) {
     op->commit_records(commit_id());
   }
+  DTRACE_PROBE2(HYRISE, TRANSACTION_COMMIT, _transaction_id, commit_id());
 
   _mark_as_pending_and_try_commit(callback);
 
@@ -97,6 +117,29 @@ bool TransactionContext::commit() {
   return true;
 }
 
+bool TransactionContext::_commit_read_only(const std::function<void(TransactionID)>& callback) {
+  const auto success = _transition(TransactionPhase::Active, TransactionPhase::Committing, TransactionPhase::Committed);
+  if (!success) return false;
+
+  _wait_for_active_operators_to_finish();
+  _phase = TransactionPhase::Committed;
+  _deregister();
+  // A read-only transaction commits without a CommitID of its own
+  DTRACE_PROBE2(HYRISE, TRANSACTION_COMMIT, _transaction_id, _snapshot_commit_id);
+
+  if (!callback) return true;
+
+  // The transaction might have seen changes that are visible, but not durable yet
+  if (Logger::get().is_enabled()) {
+    const auto transaction_id = _transaction_id;
+    Logger::get().on_durable(Logger::get().buffered_position(),
+                             [callback, transaction_id]() { callback(transaction_id); });
+  } else {
+    callback(_transaction_id);
+  }
+  return true;
+}
+
 bool TransactionContext::_abort() {
   const auto from_phase = TransactionPhase::Active;
   const auto to_phase = TransactionPhase::Aborted;
@@ -119,6 +162,7 @@ void TransactionContext::_mark_as_rolled_back() {
               "All read/write operators need to have been rolled back.");
 
   _phase = TransactionPhase::RolledBack;
+  _deregister();
 }
 
 bool TransactionContext::_prepare_commit() {
@@ -152,19 +196,39 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
               }()),
               "All read/write operators need to have been committed.");
 
+  // The changes are logged before the transaction can become visible, so that every change that another transaction
+  // sees is logged before that transaction's own changes
+  auto log_position = std::optional<Logger::LogPosition>{};
+  if (Logger::get().is_enabled()) log_position = Logger::get().log_commit(_transaction_id, commit_id());
+
   auto context_weak_ptr = std::weak_ptr<TransactionContext>{this->shared_from_this()};
-  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback](auto transaction_id) {
+  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback, log_position](auto transaction_id) {
     // If the transaction context still exists, set its phase to Committed.
     if (auto context_ptr = context_weak_ptr.lock()) {
       context_ptr->_phase = TransactionPhase::Committed;
+      context_ptr->_deregister();
     }
 
-    if (callback) callback(transaction_id);
+    // Checkpoints started from now on see the transaction
+    if (log_position) Logger::get().on_published(transaction_id);
+
+    if (!callback) return;
+
+    // The transaction is acknowledged once it is durable
+    if (log_position) {
+      Logger::get().on_durable(*log_position, [callback, transaction_id]() { callback(transaction_id); });
+    } else {
+      callback(transaction_id);
+    }
   });
 
   TransactionManager::get()._try_increment_last_commit_id(_commit_context);
 }
 
+void TransactionContext::_deregister() {
+  if (_is_registered.exchange(false)) TransactionManager::get()._deregister_transaction(_snapshot_commit_id);
+}
+
 void TransactionContext::on_operator_started() { ++_num_active_operators; }
 
 void TransactionContext::on_operator_finished() {
@@ -51,7 +51,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   friend class TransactionManager;
 
  public:
-  TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id);
+  TransactionContext(const TransactionID transaction_id, const CommitID snapshot_commit_id,
+                     const bool is_read_only = false);
   ~TransactionContext();
 
   /**
@@ -65,6 +66,12 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   CommitID snapshot_commit_id() const;
 
+  /**
+   * Read-only transactions cannot execute read/write operators. Committing them only ends the transaction, they do
+   * not get a commit id. See TransactionManager::new_read_only_transaction_context().
+   */
+  bool is_read_only() const;
+
   /**
    * The commit id that this transaction has once it is committed. This is the one that is written to the
    * begin/end commit ids of rows modified by this transaction.
@@ -92,7 +99,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * @param callback called when transaction is actually committed
+   * @param callback called when transaction is actually committed and, if the Logger is enabled, durable
    * @return false if called a second time
    */
   bool commit_async(const std::function<void(TransactionID)>& callback);
@@ -110,7 +117,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    * Add an operator to the list of read-write operators.
    * Update must not call this because it consists of a Delete and an Insert, which call this themselves.
    */
-  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
+  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op);
 
   /**
    * @defgroup Update the counter of active operators
@@ -161,10 +168,16 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   void _mark_as_pending_and_try_commit(std::function<void(TransactionID)> callback);
 
+  // Ends a read-only transaction without a commit context
+  bool _commit_read_only(const std::function<void(TransactionID)>& callback);
+
   /**@}*/
 
   void _wait_for_active_operators_to_finish() const;
 
+  // Removes the snapshot commit id from the TransactionManager's active transactions once the transaction has finished
+  void _deregister();
+
   /**
    * Throws an exception if the transition fails and
    * has not been already in phase to_phase or end_phase.
@@ -174,6 +187,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
  private:
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
+  const bool _is_read_only;
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _rw_operators;
 
   std::atomic<TransactionPhase> _phase;
@@ -181,6 +195,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   std::atomic_size_t _num_active_operators;
 
+  std::atomic_bool _is_registered{true};
+
   mutable std::condition_variable _active_operators_cv;
   mutable std::mutex _active_operators_mutex;
 };
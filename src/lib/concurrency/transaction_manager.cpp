@@ -1,10 +1,13 @@
 #include "transaction_manager.hpp"
 
 #include <memory>
+#include <mutex>
+#include <optional>
 
 #include "commit_context.hpp"
 #include "transaction_context.hpp"
 #include "utils/assert.hpp"
+#include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
@@ -13,19 +16,62 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+
+  manager._lock_wait_timeout = DEFAULT_LOCK_WAIT_TIMEOUT;
+  for (auto& count : manager._write_conflict_event_counts) {
+    count = 0;
+  }
+
+  std::lock_guard<std::mutex> lock(manager._active_snapshot_commit_ids_mutex);
+  manager._active_snapshot_commit_ids.clear();
 }
 
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {
+  for (auto& count : _write_conflict_event_counts) {
+    count = 0;
+  }
+}
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
+std::optional<CommitID> TransactionManager::lowest_active_snapshot_commit_id() const {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+  if (_active_snapshot_commit_ids.empty()) return std::nullopt;
+  return *_active_snapshot_commit_ids.begin();
+}
+
+std::chrono::microseconds TransactionManager::lock_wait_timeout() const { return _lock_wait_timeout; }
+
+void TransactionManager::set_lock_wait_timeout(const std::chrono::microseconds lock_wait_timeout) {
+  _lock_wait_timeout = lock_wait_timeout;
+}
+
+TransactionManager::WriteConflictStatistics TransactionManager::write_conflict_statistics() const {
+  const auto count = [&](const WriteConflictEvent event) {
+    return _write_conflict_event_counts[static_cast<size_t>(event)].load();
+  };
+  return {count(WriteConflictEvent::Conflict), count(WriteConflictEvent::Wait),
+          count(WriteConflictEvent::ResolvedWait), count(WriteConflictEvent::StatementRetry)};
+}
+
+void TransactionManager::record_write_conflict_event(const WriteConflictEvent event,
+                                                     const TransactionID transaction_id,
+                                                     const TransactionID holder_transaction_id) {
+  ++_write_conflict_event_counts[static_cast<size_t>(event)];
+  DTRACE_PROBE3(HYRISE, WRITE_CONFLICT, transaction_id, holder_transaction_id, static_cast<int>(event));
+}
+
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
   return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
 }
 
+std::shared_ptr<TransactionContext> TransactionManager::new_read_only_transaction_context() {
+  return std::make_shared<TransactionContext>(READ_ONLY_TRANSACTION_ID, _last_commit_id, true);
+}
+
 /**
  * Logic of the lock-free algorithm
  *
@@ -66,20 +112,48 @@ std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
   return next_context;
 }
 
+/**
+ * Group commit
+ *
+ * The thread whose context directly follows the last commit id collects the run of pending contexts that follow it
+ * and publishes the whole run with a single update of _last_commit_id, instead of one compare-and-swap (and, with a
+ * durable log, one flush) per transaction. Contexts that became pending while the run was published form the next
+ * run. The compare-and-swap fails for all threads but one if several threads try to publish the same context (e.g.,
+ * the context's own thread and the thread that published its predecessors), so that each context is published and
+ * its callback fired exactly once.
+ */
 void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
-  auto current_context = context;
-
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+  auto first_context = context;
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+  while (first_context->is_pending()) {
+    auto last_context = first_context;
+    while (last_context->has_next() && last_context->next()->is_pending()) {
+      last_context = last_context->next();
+    }
 
-    current_context->fire_callback();
+    auto expected_last_commit_id = first_context->commit_id() - 1;
+    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, last_context->commit_id())) return;
 
-    if (!current_context->has_next()) return;
+    for (auto current_context = first_context;; current_context = current_context->next()) {
+      current_context->fire_callback();
+      if (current_context == last_context) break;
+    }
 
-    current_context = current_context->next();
+    if (!last_context->has_next()) return;
+    first_context = last_context->next();
   }
 }
 
+void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+}
+
+void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock(_active_snapshot_commit_ids_mutex);
+  // The transaction might have been started before the last call to reset()
+  const auto it = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  if (it != _active_snapshot_commit_ids.end()) _active_snapshot_commit_ids.erase(it);
+}
+
 }  // namespace opossum
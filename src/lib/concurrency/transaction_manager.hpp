@@ -1,8 +1,14 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
 
 #include "types.hpp"
 #include "utils/singleton.hpp"
@@ -52,16 +58,74 @@ class TransactionManager : public Singleton<TransactionManager> {
 
   CommitID last_commit_id() const;
 
+  /**
+   * Returns the smallest snapshot commit id of all transactions that have neither committed nor rolled back yet, or
+   * nullopt if there are none. Rows that have been invalidated at or before this commit id (and before the
+   * last_commit_id) cannot be seen by any transaction anymore, which is used to physically remove them.
+   */
+  std::optional<CommitID> lowest_active_snapshot_commit_id() const;
+
   /**
    * Creates a new transaction context
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * Creates a context for a transaction that only reads, e.g., an auto-committed SELECT. It only captures the last
+   * commit id as its snapshot: It shares READ_ONLY_TRANSACTION_ID instead of getting an id of its own and takes no
+   * commit id when it commits. It is still registered as active, so that the rows it sees are not cleaned up.
+   */
+  std::shared_ptr<TransactionContext> new_read_only_transaction_context();
+
+  /**
+   * @defgroup Write conflicts
+   *
+   * A write conflict occurs when a Delete (also as part of an Update) tries to lock a row that another transaction
+   * has locked. If that transaction has not committed its change to the row yet, the Delete waits for up to the lock
+   * wait timeout for it to finish, as the row can still be locked if the transaction rolls back. Otherwise, the Delete
+   * fails and its transaction has to be rolled back. Auto-committed SQL statements can then be retried in a new
+   * transaction (see SQLPipelineBuilder::with_conflict_retries()).
+   * @{
+   */
+
+  struct WriteConflictStatistics {
+    // Rows that could not be locked, so that the Delete failed
+    uint64_t conflicts{0};
+
+    // Conflicts with transactions that had not committed yet, whose end was waited for
+    uint64_t waits{0};
+
+    // Waits after which the row could be locked, because the other transaction rolled back
+    uint64_t resolved_waits{0};
+
+    // Auto-committed statements that were executed again in a new transaction after a conflict
+    uint64_t statement_retries{0};
+  };
+
+  enum class WriteConflictEvent { Conflict, Wait, ResolvedWait, StatementRetry };
+
+  std::chrono::microseconds lock_wait_timeout() const;
+  void set_lock_wait_timeout(const std::chrono::microseconds lock_wait_timeout);
+
+  // Counts of the events since the TransactionManager was created or reset
+  WriteConflictStatistics write_conflict_statistics() const;
+
+  // Counts the event of @param transaction_id. @param holder_transaction_id is the transaction that held the row, if
+  // known.
+  void record_write_conflict_event(const WriteConflictEvent event, const TransactionID transaction_id,
+                                   const TransactionID holder_transaction_id = INVALID_TRANSACTION_ID);
+
+  static constexpr auto DEFAULT_LOCK_WAIT_TIMEOUT = std::chrono::microseconds{10'000};
+
+  /**@}*/
+
   // TransactionID = 0 means "not set" in the MVCC data. This is the case if the row has (a) just been reserved, but
   // not yet filled with content, (b) been inserted, committed and not marked for deletion, or (c) inserted but
   // deleted in the same transaction (which has not yet committed)
   static constexpr auto INVALID_TRANSACTION_ID = TransactionID{0};
   static constexpr auto INITIAL_TRANSACTION_ID = TransactionID{1};
+  // Never handed out to transactions that write, so that no row appears to be locked or inserted by a reader
+  static constexpr auto READ_ONLY_TRANSACTION_ID = std::numeric_limits<TransactionID>::max();
 
  private:
   TransactionManager();
@@ -70,8 +134,13 @@ class TransactionManager : public Singleton<TransactionManager> {
   friend class TransactionContext;
 
   std::shared_ptr<CommitContext> _new_commit_context();
+  // Publishes the pending commit contexts that follow the last commit id, starting at @param context, as one group
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
+  // Called by the TransactionContext when it is created and when it has finished, respectively
+  void _register_transaction(const CommitID snapshot_commit_id);
+  void _deregister_transaction(const CommitID snapshot_commit_id);
+
   std::atomic<TransactionID> _next_transaction_id;
 
   std::atomic<CommitID> _last_commit_id;
@@ -80,5 +149,12 @@ class TransactionManager : public Singleton<TransactionManager> {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  std::multiset<CommitID> _active_snapshot_commit_ids;
+  mutable std::mutex _active_snapshot_commit_ids_mutex;
+
+  std::atomic<std::chrono::microseconds> _lock_wait_timeout{DEFAULT_LOCK_WAIT_TIMEOUT};
+  // Indexed by WriteConflictEvent
+  std::array<std::atomic<uint64_t>, 4> _write_conflict_event_counts;
 };
 }  // namespace opossum
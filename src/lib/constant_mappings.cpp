@@ -11,6 +11,7 @@
 
 #include "expression/abstract_expression.hpp"
 #include "expression/aggregate_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/table.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
@@ -38,6 +39,8 @@ const boost::bimap<PredicateCondition, std::string> predicate_condition_to_strin
 const std::unordered_map<OrderByMode, std::string> order_by_mode_to_string = {
     {OrderByMode::Ascending, "Ascending"},
     {OrderByMode::Descending, "Descending"},
+    {OrderByMode::AscendingNullsLast, "AscendingNullsLast"},
+    {OrderByMode::DescendingNullsLast, "DescendingNullsLast"},
 };
 
 const std::unordered_map<hsql::OrderType, OrderByMode> order_type_to_order_by_mode = {
@@ -60,6 +63,21 @@ const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string
         {AggregateFunction::Avg, "AVG"},
         {AggregateFunction::Count, "COUNT"},
         {AggregateFunction::CountDistinct, "COUNT DISTINCT"},
+        {AggregateFunction::ApproxCountDistinct, "APPROX_COUNT_DISTINCT"},
+    });
+
+const boost::bimap<WindowFunction, std::string> window_function_to_string =
+    make_bimap<WindowFunction, std::string>({
+        {WindowFunction::RowNumber, "ROW_NUMBER"},
+        {WindowFunction::Rank, "RANK"},
+        {WindowFunction::DenseRank, "DENSE_RANK"},
+        {WindowFunction::Lag, "LAG"},
+        {WindowFunction::Lead, "LEAD"},
+        {WindowFunction::Min, "MIN"},
+        {WindowFunction::Max, "MAX"},
+        {WindowFunction::Sum, "SUM"},
+        {WindowFunction::Avg, "AVG"},
+        {WindowFunction::Count, "COUNT"},
     });
 
 const boost::bimap<FunctionType, std::string> function_type_to_string =
@@ -76,6 +94,9 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::RunLength, "RunLength"},
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
+    {EncodingType::LZ4, "LZ4"},
+    {EncodingType::Delta, "Delta"},
+    {EncodingType::Auto, "Auto"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
@@ -14,6 +14,7 @@ namespace opossum {
 enum class EncodingType : uint8_t;
 enum class VectorCompressionType : uint8_t;
 enum class AggregateFunction;
+enum class WindowFunction;
 enum class ExpressionType;
 enum class TableType;
 
@@ -24,6 +25,7 @@ extern const std::unordered_map<ExpressionType, std::string> expression_type_to_
 extern const std::unordered_map<JoinMode, std::string> join_mode_to_string;
 extern const std::unordered_map<UnionMode, std::string> union_mode_to_string;
 extern const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string;
+extern const boost::bimap<WindowFunction, std::string> window_function_to_string;
 extern const boost::bimap<FunctionType, std::string> function_type_to_string;
 extern const boost::bimap<DataType, std::string> data_type_to_string;
 extern const boost::bimap<EncodingType, std::string> encoding_type_to_string;
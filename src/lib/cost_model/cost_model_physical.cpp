@@ -0,0 +1,277 @@
+#include "cost_model_physical.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "json.hpp"
+
+#include "constant_mappings.hpp"
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The column that a TableScan compares to values, or nullptr if the predicate is evaluated by the ExpressionEvaluator
+std::shared_ptr<LQPColumnExpression> scanned_column(const AbstractExpression& predicate) {
+  if (!dynamic_cast<const AbstractPredicateExpression*>(&predicate)) return nullptr;
+
+  const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate.arguments[0]);
+  if (!column_expression) return nullptr;
+
+  for (auto argument_idx = size_t{1}; argument_idx < predicate.arguments.size(); ++argument_idx) {
+    const auto argument_type = predicate.arguments[argument_idx]->type;
+    if (argument_type != ExpressionType::Value && argument_type != ExpressionType::Placeholder &&
+        argument_type != ExpressionType::CorrelatedParameter) {
+      return nullptr;
+    }
+  }
+
+  return column_expression;
+}
+
+// Number of operations and accessed columns, as in CostModelLogical
+float expression_operation_count(const std::shared_ptr<AbstractExpression>& expression) {
+  auto operation_count = 0.0f;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    operation_count += sub_expression->type == ExpressionType::LQPColumn ? 2.0f : 1.0f;
+    return ExpressionVisitation::VisitArguments;
+  });
+  return operation_count;
+}
+
+// The coefficients other than the per-encoding scan costs, by their name in the JSON file
+std::vector<std::pair<std::string, Cost*>> named_row_costs(CostModelCoefficients& coefficients) {
+  return {{"reference_scan_row_cost", &coefficients.reference_scan_row_cost},
+          {"expression_row_cost", &coefficients.expression_row_cost},
+          {"index_scan_chunk_cost", &coefficients.index_scan_chunk_cost},
+          {"index_scan_output_row_cost", &coefficients.index_scan_output_row_cost},
+          {"hash_join_build_row_cost", &coefficients.hash_join_build_row_cost},
+          {"hash_join_probe_row_cost", &coefficients.hash_join_probe_row_cost},
+          {"sort_row_cost", &coefficients.sort_row_cost},
+          {"sort_merge_join_merge_row_cost", &coefficients.sort_merge_join_merge_row_cost},
+          {"nested_loop_join_row_pair_cost", &coefficients.nested_loop_join_row_pair_cost},
+          {"output_row_cost", &coefficients.output_row_cost},
+          {"aggregate_row_cost", &coefficients.aggregate_row_cost},
+          {"default_row_cost", &coefficients.default_row_cost}};
+}
+
+}  // namespace
+
+CostModelCoefficients import_cost_model_coefficients(const std::string& path) {
+  auto file = std::ifstream{path};
+  Assert(file.is_open(), "Could not open " + path);
+  auto json = nlohmann::json{};
+  file >> json;
+
+  auto coefficients = CostModelCoefficients{};
+  if (json.count("table_scan_row_costs")) {
+    const auto& row_costs = json["table_scan_row_costs"];
+    for (auto row_cost_it = row_costs.cbegin(); row_cost_it != row_costs.cend(); ++row_cost_it) {
+      const auto encoding_type = encoding_type_to_string.right.at(row_cost_it.key());
+      coefficients.table_scan_row_costs[encoding_type] = row_cost_it.value().get<Cost>();
+    }
+  }
+  for (const auto& [name, row_cost] : named_row_costs(coefficients)) {
+    if (json.count(name)) *row_cost = json[name].get<Cost>();
+  }
+  return coefficients;
+}
+
+void export_cost_model_coefficients(const CostModelCoefficients& coefficients, const std::string& path) {
+  auto json = nlohmann::json{};
+  for (const auto& [encoding_type, row_cost] : coefficients.table_scan_row_costs) {
+    json["table_scan_row_costs"][encoding_type_to_string.left.at(encoding_type)] = row_cost;
+  }
+  auto coefficients_copy = coefficients;
+  for (const auto& [name, row_cost] : named_row_costs(coefficients_copy)) {
+    json[name] = *row_cost;
+  }
+
+  auto file = std::ofstream{path};
+  Assert(file.is_open(), "Could not create " + path);
+  file << json.dump(2) << std::endl;
+}
+
+CostModelPhysical::CostModelPhysical(const CostModelCoefficients& coefficients) : _coefficients(coefficients) {}
+
+const CostModelCoefficients& CostModelPhysical::coefficients() const { return _coefficients; }
+
+Cost CostModelPhysical::estimate_table_scan_cost(const float input_row_count, const EncodingType encoding_type,
+                                                 const float output_row_count) const {
+  const auto row_cost_it = _coefficients.table_scan_row_costs.find(encoding_type);
+  const auto row_cost = row_cost_it != _coefficients.table_scan_row_costs.cend()
+                            ? row_cost_it->second
+                            : _coefficients.table_scan_row_costs.at(EncodingType::Unencoded);
+  return input_row_count * row_cost + output_row_count * _coefficients.output_row_cost;
+}
+
+Cost CostModelPhysical::estimate_index_scan_cost(const ChunkID chunk_count, const float output_row_count) const {
+  return static_cast<float>(chunk_count) * _coefficients.index_scan_chunk_cost +
+         output_row_count * _coefficients.index_scan_output_row_cost;
+}
+
+Cost CostModelPhysical::estimate_hash_join_cost(const float left_input_row_count,
+                                                const float right_input_row_count) const {
+  // JoinHash builds the hash table on the smaller input
+  const auto build_row_count = std::min(left_input_row_count, right_input_row_count);
+  const auto probe_row_count = std::max(left_input_row_count, right_input_row_count);
+  return build_row_count * _coefficients.hash_join_build_row_cost +
+         probe_row_count * _coefficients.hash_join_probe_row_cost;
+}
+
+Cost CostModelPhysical::estimate_sort_merge_join_cost(const float left_input_row_count,
+                                                      const float right_input_row_count) const {
+  return estimate_sort_cost(left_input_row_count) + estimate_sort_cost(right_input_row_count) +
+         (left_input_row_count + right_input_row_count) * _coefficients.sort_merge_join_merge_row_cost;
+}
+
+Cost CostModelPhysical::estimate_nested_loop_join_cost(const float left_input_row_count,
+                                                       const float right_input_row_count) const {
+  return left_input_row_count * right_input_row_count * _coefficients.nested_loop_join_row_pair_cost;
+}
+
+Cost CostModelPhysical::estimate_sort_cost(const float row_count) const {
+  if (row_count <= 1.0f) return 0.0f;
+  return row_count * std::log2(row_count) * _coefficients.sort_row_cost;
+}
+
+Cost CostModelPhysical::_estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto output_row_count = node->get_statistics()->row_count();
+  const auto left_input_row_count = node->left_input() ? node->left_input()->get_statistics()->row_count() : 0.0f;
+  const auto right_input_row_count = node->right_input() ? node->right_input()->get_statistics()->row_count() : 0.0f;
+
+  switch (node->type) {
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::Mock:
+      return 0.0f;
+
+    case LQPNodeType::Predicate:
+      return _estimate_predicate_node_cost(static_cast<const PredicateNode&>(*node), left_input_row_count,
+                                           output_row_count);
+
+    case LQPNodeType::Join:
+      return _estimate_join_node_cost(static_cast<const JoinNode&>(*node), left_input_row_count,
+                                      right_input_row_count) +
+             output_row_count * _coefficients.output_row_cost;
+
+    case LQPNodeType::Sort:
+    case LQPNodeType::Window:
+      // Windows sort their input by the PARTITION BY and ORDER BY expressions
+      return estimate_sort_cost(left_input_row_count) + output_row_count * _coefficients.output_row_cost;
+
+    case LQPNodeType::Aggregate:
+      return left_input_row_count * _coefficients.aggregate_row_cost +
+             output_row_count * _coefficients.output_row_cost;
+
+    case LQPNodeType::Union: {
+      const auto& union_node = static_cast<const UnionNode&>(*node);
+
+      switch (union_node.union_mode) {
+        case UnionMode::Positions:
+          return estimate_sort_cost(left_input_row_count) + estimate_sort_cost(right_input_row_count) +
+                 output_row_count * _coefficients.output_row_cost;
+        default:
+          Fail("GCC thinks this is reachable");
+      }
+    }
+
+    default:
+      return left_input_row_count * _coefficients.default_row_cost + output_row_count * _coefficients.output_row_cost;
+  }
+}
+
+Cost CostModelPhysical::_estimate_predicate_node_cost(const PredicateNode& predicate_node, const float input_row_count,
+                                                      const float output_row_count) const {
+  const auto& input_node = predicate_node.left_input();
+
+  // The LQPTranslator only creates IndexScans directly on StoredTableNodes
+  const auto input_stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(input_node);
+  if (predicate_node.scan_type == ScanType::IndexScan && input_stored_table_node) {
+    const auto table = StorageManager::get().get_table(input_stored_table_node->table_name);
+    const auto chunk_count = table->chunk_count() - input_stored_table_node->excluded_chunk_ids().size();
+    return estimate_index_scan_cost(ChunkID{static_cast<ChunkID::base_type>(chunk_count)}, output_row_count);
+  }
+
+  const auto column_expression = scanned_column(*predicate_node.predicate());
+  if (!column_expression) {
+    return input_row_count * _coefficients.expression_row_cost *
+               expression_operation_count(predicate_node.predicate()) +
+           output_row_count * _coefficients.output_row_cost;
+  }
+
+  // Intermediate results are accessed through their PosLists, on top of decoding the referenced segments
+  auto cost = input_stored_table_node ? 0.0f : input_row_count * _coefficients.reference_scan_row_cost;
+
+  const auto stored_table_node =
+      std::dynamic_pointer_cast<const StoredTableNode>(column_expression->column_reference.original_node());
+  if (!stored_table_node) {
+    return cost + estimate_table_scan_cost(input_row_count, EncodingType::Unencoded, output_row_count);
+  }
+
+  // The scanned rows are assumed to be spread over the chunks of the table according to their sizes
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+  const auto column_id = column_expression->column_reference.original_column_id();
+  const auto table_row_count = static_cast<float>(table->row_count());
+  if (table_row_count == 0.0f) return cost;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+    const auto encoding_type = encoded_segment ? encoded_segment->encoding_type() : EncodingType::Unencoded;
+    const auto share_of_rows = static_cast<float>(chunk->size()) / table_row_count;
+    cost += estimate_table_scan_cost(input_row_count * share_of_rows, encoding_type, 0.0f);
+  }
+
+  return cost + output_row_count * _coefficients.output_row_cost;
+}
+
+Cost CostModelPhysical::_estimate_join_node_cost(const JoinNode& join_node, const float left_input_row_count,
+                                                 const float right_input_row_count) const {
+  // A Product only writes its output
+  if (join_node.join_mode == JoinMode::Cross) return 0.0f;
+
+  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(join_node.join_predicate());
+  Assert(predicate, "Expected join predicate to be a predicate");
+  const auto predicate_condition = predicate->predicate_condition;
+
+  const auto hash_join_cost = estimate_hash_join_cost(left_input_row_count, right_input_row_count);
+
+  // The same choice of algorithms as in JoinAdaptive, except for JoinIndex, which depends on the indexes at runtime
+  if (join_node.join_mode == JoinMode::Semi || join_node.join_mode == JoinMode::Anti) return hash_join_cost;
+
+  auto cost = estimate_nested_loop_join_cost(left_input_row_count, right_input_row_count);
+
+  if (predicate_condition == PredicateCondition::Equals && join_node.join_mode != JoinMode::Outer) {
+    cost = std::min(cost, hash_join_cost);
+  }
+
+  if (predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::LessThan ||
+      predicate_condition == PredicateCondition::LessThanEquals ||
+      predicate_condition == PredicateCondition::GreaterThan ||
+      predicate_condition == PredicateCondition::GreaterThanEquals ||
+      (predicate_condition == PredicateCondition::NotEquals && join_node.join_mode == JoinMode::Inner)) {
+    cost = std::min(cost, estimate_sort_merge_join_cost(left_input_row_count, right_input_row_count));
+  }
+
+  return cost;
+}
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+
+#include "abstract_cost_estimator.hpp"
+#include "storage/encoding_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class JoinNode;
+class PredicateNode;
+
+/**
+ * Per-row costs, in nanoseconds, of the steps of the physical operators. The defaults are rough measurements on a
+ * current x86 server. Run hyriseCostModelCalibration on the target machine to obtain fitted coefficients.
+ */
+struct CostModelCoefficients {
+  // Cost of scanning one row of a stored table, by the encoding of the scanned segment
+  std::map<EncodingType, Cost> table_scan_row_costs{{EncodingType::Unencoded, 1.0f},
+                                                    {EncodingType::Dictionary, 0.8f},
+                                                    {EncodingType::RunLength, 0.5f},
+                                                    {EncodingType::FixedStringDictionary, 2.0f},
+                                                    {EncodingType::FrameOfReference, 1.2f},
+                                                    {EncodingType::LZ4, 8.0f},
+                                                    {EncodingType::Delta, 1.5f}};
+
+  // Cost of scanning one row of an intermediate result, which is accessed through a PosList
+  Cost reference_scan_row_cost = 3.0f;
+
+  // Cost of evaluating a more complex predicate with the ExpressionEvaluator, per row and operation
+  Cost expression_row_cost = 10.0f;
+
+  // Cost of looking up a value in the index of one chunk, and of producing one row from an IndexScan
+  Cost index_scan_chunk_cost = 500.0f;
+  Cost index_scan_output_row_cost = 5.0f;
+
+  Cost hash_join_build_row_cost = 20.0f;
+  Cost hash_join_probe_row_cost = 10.0f;
+
+  // JoinSortMerge sorts both inputs (per row and log2 of the row count) and then merges them (per row)
+  Cost sort_row_cost = 2.0f;
+  Cost sort_merge_join_merge_row_cost = 3.0f;
+
+  Cost nested_loop_join_row_pair_cost = 1.0f;
+
+  // Cost of writing one row of the output of an operator
+  Cost output_row_cost = 2.0f;
+
+  Cost aggregate_row_cost = 15.0f;
+
+  // Cost of processing one input row in all other operators
+  Cost default_row_cost = 1.0f;
+};
+
+// Reads and writes the coefficients as a JSON object, e.g., as written by hyriseCostModelCalibration. Coefficients
+// that are missing in the file keep their default value.
+CostModelCoefficients import_cost_model_coefficients(const std::string& path);
+void export_cost_model_coefficients(const CostModelCoefficients& coefficients, const std::string& path);
+
+/**
+ * Cost model for the estimated runtime of the physical operators that the LQPTranslator and the JoinAdaptive create
+ * for each node. Scans are costed by the encoding of the scanned column if they run on a stored table, and IndexScans
+ * by the number of chunks to look up. Joins are costed with the cheapest algorithm that supports them, i.e., JoinHash,
+ * JoinSortMerge or JoinNestedLoop, because JoinAdaptive picks the algorithm once the input sizes are known.
+ */
+class CostModelPhysical : public AbstractCostEstimator {
+ public:
+  explicit CostModelPhysical(const CostModelCoefficients& coefficients = {});
+
+  const CostModelCoefficients& coefficients() const;
+
+  Cost estimate_table_scan_cost(const float input_row_count, const EncodingType encoding_type,
+                                const float output_row_count) const;
+  Cost estimate_index_scan_cost(const ChunkID chunk_count, const float output_row_count) const;
+
+  // The costs of the join algorithms without the cost of writing the output
+  Cost estimate_hash_join_cost(const float left_input_row_count, const float right_input_row_count) const;
+  Cost estimate_sort_merge_join_cost(const float left_input_row_count, const float right_input_row_count) const;
+  Cost estimate_nested_loop_join_cost(const float left_input_row_count, const float right_input_row_count) const;
+
+  Cost estimate_sort_cost(const float row_count) const;
+
+ protected:
+  Cost _estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  Cost _estimate_predicate_node_cost(const PredicateNode& predicate_node, const float input_row_count,
+                                     const float output_row_count) const;
+  Cost _estimate_join_node_cost(const JoinNode& join_node, const float left_input_row_count,
+                                const float right_input_row_count) const;
+
+  const CostModelCoefficients _coefficients;
+};
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A Hyrise instance that stores a share of the data of a distributed database and executes query fragments on it (see
+ * DistributedCoordinator). The fragments are SQL statements: SQL is the plan format that every Hyrise instance already
+ * accepts, and unlike physical plans it does not refer to the tables of the coordinator.
+ */
+class AbstractNode {
+ public:
+  virtual ~AbstractNode() = default;
+
+  // Executes @param sql on the node and returns the result of the last statement. The result is a data table.
+  virtual std::shared_ptr<const Table> execute(const std::string& sql) = 0;
+
+  // Creates a table with the name and the columns of @param table on the node and inserts the rows of @param table
+  virtual void load_table(const std::string& table_name, const std::shared_ptr<const Table>& table) = 0;
+
+  // A human-readable identification of the node, used in error messages
+  virtual std::string description() const = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#include "distributed_coordinator.hpp"
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "abstract_node.hpp"
+#include "operators/exchange.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "table_partitioner.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+DistributedCoordinator::DistributedCoordinator(const std::vector<std::shared_ptr<AbstractNode>>& nodes)
+    : _nodes(nodes) {
+  Assert(!_nodes.empty(), "A distributed database needs at least one node.");
+}
+
+const std::vector<std::shared_ptr<AbstractNode>>& DistributedCoordinator::nodes() const { return _nodes; }
+
+void DistributedCoordinator::replicate_table(const std::string& table_name, const std::shared_ptr<const Table>& table) {
+  // As in the Exchange, the nodes are loaded from their own threads, as they mostly wait for the network
+  auto loads = std::vector<std::future<void>>{};
+  for (const auto& node : _nodes) {
+    loads.emplace_back(std::async(std::launch::async, [&, node]() { node->load_table(table_name, table); }));
+  }
+  for (auto& load : loads) load.get();
+}
+
+void DistributedCoordinator::partition_table(const std::string& table_name, const std::shared_ptr<const Table>& table,
+                                             const ColumnID column_id) {
+  const auto partitions = hash_partition_table(table, column_id, _nodes.size());
+
+  auto loads = std::vector<std::future<void>>{};
+  for (auto node_id = size_t{0}; node_id < _nodes.size(); ++node_id) {
+    loads.emplace_back(std::async(std::launch::async, [&, node_id]() {
+      _nodes[node_id]->load_table(table_name, partitions[node_id]);
+    }));
+  }
+  for (auto& load : loads) load.get();
+}
+
+std::shared_ptr<const Table> DistributedCoordinator::execute(const std::string& fragment_sql,
+                                                             const std::string& merge_sql,
+                                                             const std::string& partial_results_table_name) const {
+  const auto exchange = std::make_shared<Exchange>(_nodes, fragment_sql);
+  exchange->execute();
+  const auto partial_results = exchange->get_output();
+
+  if (merge_sql.empty()) return partial_results;
+
+  // Tables in the StorageManager need MVCC data. The segments of the partial results are not copied.
+  const auto merge_input = std::make_shared<Table>(partial_results->column_definitions(), TableType::Data,
+                                                   std::nullopt, UseMvcc::Yes);
+  for (auto chunk_id = ChunkID{0}; chunk_id < partial_results->chunk_count(); ++chunk_id) {
+    merge_input->append_chunk(partial_results->get_chunk(chunk_id)->segments());
+  }
+
+  // Concurrent queries, possibly of different coordinators, must not see each other's partial results. Hence, the
+  // table is registered under a name that is unique to this query, and the merge query is rewritten to refer to it.
+  Assert(std::regex_match(partial_results_table_name, std::regex{R"([A-Za-z_][A-Za-z0-9_]*)"}),
+         "Name of the partial results must be a plain identifier.");
+  static auto merge_count = std::atomic<size_t>{0};
+  const auto unique_table_name = partial_results_table_name + "__" + std::to_string(merge_count++);
+  const auto unique_merge_sql =
+      std::regex_replace(merge_sql, std::regex{"\\b" + partial_results_table_name + "\\b"}, unique_table_name);
+
+  auto& storage_manager = StorageManager::get();
+  storage_manager.add_table(unique_table_name, merge_input);
+
+  try {
+    const auto result = SQLPipelineBuilder{unique_merge_sql}.create_pipeline().get_result_table();
+    storage_manager.drop_table(unique_table_name);
+    return result;
+  } catch (...) {
+    storage_manager.drop_table(unique_table_name);
+    throw;
+  }
+}
+
+}  // namespace opossum
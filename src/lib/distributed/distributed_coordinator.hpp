@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractNode;
+class Table;
+
+/**
+ * Distributes tables across several Hyrise nodes and executes queries on them, for data that does not fit into a
+ * single machine. Tables are distributed in one of two ways:
+ *
+ *   - Small tables, such as the dimension tables of a star schema, are replicated to every node
+ *   - Large tables, such as fact tables, are hash-partitioned by a column (see hash_partition_table), so that every
+ *     node stores a share of their rows
+ *
+ * A query is split into a fragment that every node executes on its share of the data and a merge query that combines
+ * the partial results on the coordinator. For example, a partial aggregate
+ *
+ *   SELECT d_year, SUM(lo_revenue) AS revenue FROM lineorder, date WHERE lo_orderdate = d_datekey GROUP BY d_year
+ *
+ * is merged with
+ *
+ *   SELECT d_year, SUM(revenue) FROM partial_results GROUP BY d_year
+ *
+ * The fragments see only the local data of a node. Their joins are therefore only correct if at most one side is
+ * partitioned and the others are replicated, or if both sides are partitioned by the join key. Choosing the split is
+ * left to the caller; the coordinator does not rewrite queries.
+ */
+class DistributedCoordinator {
+ public:
+  explicit DistributedCoordinator(const std::vector<std::shared_ptr<AbstractNode>>& nodes);
+
+  const std::vector<std::shared_ptr<AbstractNode>>& nodes() const;
+
+  // Loads @param table on every node
+  void replicate_table(const std::string& table_name, const std::shared_ptr<const Table>& table);
+
+  // Loads one hash partition of @param table, partitioned by @param column_id, on each node
+  void partition_table(const std::string& table_name, const std::shared_ptr<const Table>& table,
+                       const ColumnID column_id);
+
+  /**
+   * Executes @param fragment_sql on all nodes (see Exchange). If @param merge_sql is empty, the union of the partial
+   * results is returned. Otherwise, @param merge_sql is executed on the coordinator, where it refers to the union as
+   * @param partial_results_table_name, and its result is returned. For the time of the merge, the union is added to
+   * the StorageManager under a name that is unique to the query, so that concurrent queries do not interfere.
+   */
+  std::shared_ptr<const Table> execute(const std::string& fragment_sql, const std::string& merge_sql = "",
+                                       const std::string& partial_results_table_name = "partial_results") const;
+
+ protected:
+  const std::vector<std::shared_ptr<AbstractNode>> _nodes;
+};
+
+}  // namespace opossum
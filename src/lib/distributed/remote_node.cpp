@@ -0,0 +1,233 @@
+#include "remote_node.hpp"
+
+#include <libpq-fe.h>
+
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Object IDs of the Postgres types that the server uses for Hyrise's data types (see QueryResponseBuilder)
+constexpr auto INT8_TYPE_ID = Oid{20};
+constexpr auto INT4_TYPE_ID = Oid{23};
+constexpr auto FLOAT4_TYPE_ID = Oid{700};
+constexpr auto FLOAT8_TYPE_ID = Oid{701};
+
+DataType type_id_to_data_type(const Oid type_id) {
+  switch (type_id) {
+    case INT4_TYPE_ID:
+      return DataType::Int;
+    case INT8_TYPE_ID:
+      return DataType::Long;
+    case FLOAT4_TYPE_ID:
+      return DataType::Float;
+    case FLOAT8_TYPE_ID:
+      return DataType::Double;
+    default:
+      return DataType::String;
+  }
+}
+
+std::string data_type_to_sql(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Int:
+      return "INT";
+    case DataType::Long:
+      return "LONG";
+    case DataType::Float:
+      return "FLOAT";
+    case DataType::Double:
+      return "DOUBLE";
+    case DataType::String:
+      return "TEXT";
+    default:
+      Fail("Data type cannot be sent to a remote node.");
+  }
+}
+
+// Frees a PGresult when going out of scope
+using ResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+}  // namespace
+
+namespace opossum {
+
+RemoteNode::RemoteNode(const std::string& connection_string)
+    : _connection_string(connection_string), _connection(PQconnectdb(connection_string.c_str())) {
+  if (PQstatus(_connection) != CONNECTION_OK) {
+    const auto message = std::string{PQerrorMessage(_connection)};
+    PQfinish(_connection);
+    Fail("Connecting to " + description() + " failed: " + message);
+  }
+}
+
+RemoteNode::~RemoteNode() { PQfinish(_connection); }
+
+std::shared_ptr<const Table> RemoteNode::execute(const std::string& sql) {
+  auto result = ResultPtr{nullptr, &PQclear};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    result.reset(PQexec(_connection, sql.c_str()));
+  }
+
+  const auto status = PQresultStatus(result.get());
+  Assert(status == PGRES_TUPLES_OK || status == PGRES_COMMAND_OK,
+         "Executing '" + sql + "' on " + description() + " failed: " + PQresultErrorMessage(result.get()));
+
+  const auto row_count = PQntuples(result.get());
+  const auto column_count = PQnfields(result.get());
+
+  auto column_definitions = TableColumnDefinitions{};
+  for (auto column_id = 0; column_id < column_count; ++column_id) {
+    // The server does not tell whether a column is nullable
+    column_definitions.emplace_back(PQfname(result.get(), column_id),
+                                    type_id_to_data_type(PQftype(result.get(), column_id)), true);
+  }
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  for (auto chunk_begin = 0; chunk_begin < row_count; chunk_begin += static_cast<int>(Chunk::DEFAULT_SIZE)) {
+    const auto chunk_end = std::min(chunk_begin + static_cast<int>(Chunk::DEFAULT_SIZE), row_count);
+
+    auto segments = Segments{};
+    for (auto column_id = 0; column_id < column_count; ++column_id) {
+      resolve_data_type(column_definitions[column_id].data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto values = pmr_concurrent_vector<ColumnDataType>(chunk_end - chunk_begin);
+        auto null_values = pmr_concurrent_vector<bool>(chunk_end - chunk_begin);
+        for (auto row = chunk_begin; row < chunk_end; ++row) {
+          if (PQgetisnull(result.get(), row, column_id)) {
+            null_values[row - chunk_begin] = true;
+          } else {
+            values[row - chunk_begin] = boost::lexical_cast<ColumnDataType>(PQgetvalue(result.get(), row, column_id));
+          }
+        }
+
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      });
+    }
+    table->append_chunk(segments);
+  }
+
+  return table;
+}
+
+void RemoteNode::load_table(const std::string& table_name, const std::shared_ptr<const Table>& table) {
+  auto create_table_sql = std::stringstream{};
+  create_table_sql << "CREATE TABLE " << table_name << " (";
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    if (column_id > 0) create_table_sql << ", ";
+    create_table_sql << table->column_name(column_id) << " " << data_type_to_sql(table->column_data_type(column_id))
+                     << (table->column_is_nullable(column_id) ? " NULL" : " NOT NULL");
+  }
+  create_table_sql << ");";
+  execute(create_table_sql.str());
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto copy_sql = "COPY " + table_name + " FROM STDIN;";
+  const auto copy_result = ResultPtr{PQexec(_connection, copy_sql.c_str()), &PQclear};
+  Assert(PQresultStatus(copy_result.get()) == PGRES_COPY_IN,
+         "Copying into " + table_name + " on " + description() + " failed: " + PQerrorMessage(_connection));
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto data = _chunk_to_copy_text(*table, chunk_id);
+    Assert(PQputCopyData(_connection, data.data(), static_cast<int>(data.size())) == 1,
+           "Sending rows to " + description() + " failed: " + PQerrorMessage(_connection));
+  }
+
+  Assert(PQputCopyEnd(_connection, nullptr) == 1,
+         "Sending rows to " + description() + " failed: " + PQerrorMessage(_connection));
+
+  // The server answers with the result of the COPY and then with a null result
+  auto status = PGRES_COMMAND_OK;
+  auto error_message = std::string{};
+  while (const auto result = ResultPtr{PQgetResult(_connection), &PQclear}) {
+    if (PQresultStatus(result.get()) != PGRES_COMMAND_OK) {
+      status = PQresultStatus(result.get());
+      error_message = PQresultErrorMessage(result.get());
+    }
+  }
+  Assert(status == PGRES_COMMAND_OK,
+         "Copying into " + table_name + " on " + description() + " failed: " + error_message);
+}
+
+std::string RemoteNode::description() const { return "remote node '" + _connection_string + "'"; }
+
+std::string RemoteNode::_chunk_to_copy_text(const Table& table, const ChunkID chunk_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto chunk_size = chunk->size();
+
+  // The chunk is converted column by column, so that each segment is iterated only once
+  auto fields = std::vector<std::vector<std::string>>(table.column_count(), std::vector<std::string>(chunk_size));
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    auto& column_fields = fields[column_id];
+
+    segment_iterate(*chunk->get_segment(column_id), [&](const auto& position) {
+      using ColumnDataType = typename std::decay_t<decltype(position)>::Type;
+
+      auto& field = column_fields[position.chunk_offset()];
+      if (position.is_null()) {
+        field = "\\N";
+      } else if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        field.reserve(position.value().size());
+        for (const auto character : position.value()) {
+          switch (character) {
+            case '\\':
+              field += "\\\\";
+              break;
+            case '\t':
+              field += "\\t";
+              break;
+            case '\n':
+              field += "\\n";
+              break;
+            case '\r':
+              field += "\\r";
+              break;
+            default:
+              field += character;
+          }
+        }
+      } else if constexpr (std::is_floating_point_v<ColumnDataType>) {
+        // Floating-point values are written with enough digits to be read back without loss
+        auto stream = std::stringstream{};
+        stream.precision(std::numeric_limits<ColumnDataType>::max_digits10);
+        stream << position.value();
+        field = stream.str();
+      } else {
+        field = std::to_string(position.value());
+      }
+    });
+  }
+
+  auto text = std::string{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      if (column_id > 0) text += '\t';
+      text += fields[column_id][chunk_offset];
+    }
+    text += '\n';
+  }
+
+  return text;
+}
+
+}  // namespace opossum
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "abstract_node.hpp"
+#include "types.hpp"
+
+struct pg_conn;
+
+namespace opossum {
+
+/**
+ * A node that is a Hyrise server (see hyriseServer) on another machine. It is accessed through the PostgreSQL wire
+ * protocol, which the server already speaks, using libpq:
+ *
+ *   - Query fragments are sent as simple queries. Their results are sent back in the text format and parsed by the
+ *     column types that the server reports.
+ *   - Tables are created with CREATE TABLE and their rows are sent with COPY ... FROM STDIN, chunk by chunk, so that
+ *     a table does not have to be serialized as a whole.
+ *
+ * libpq connections must not be used by several threads at the same time, so the calls are serialized. To send
+ * fragments to a node in parallel, use several RemoteNodes with the same connection string.
+ */
+class RemoteNode : public AbstractNode {
+ public:
+  // @param connection_string is passed to libpq, e.g., "host=10.0.0.2 port=5432"
+  explicit RemoteNode(const std::string& connection_string);
+  ~RemoteNode() override;
+
+  std::shared_ptr<const Table> execute(const std::string& sql) override;
+
+  void load_table(const std::string& table_name, const std::shared_ptr<const Table>& table) override;
+
+  std::string description() const override;
+
+ protected:
+  // The rows of the chunk in the text format of COPY: fields separated by tabs, \N for NULL
+  static std::string _chunk_to_copy_text(const Table& table, const ChunkID chunk_id);
+
+  const std::string _connection_string;
+  pg_conn* _connection;
+  std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include "table_partitioner.hpp"
+
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::vector<std::shared_ptr<Table>> hash_partition_table(const std::shared_ptr<const Table>& table,
+                                                         const ColumnID column_id, const size_t partition_count) {
+  Assert(partition_count > 0, "Need at least one partition.");
+  Assert(column_id < table->column_count(), "Cannot partition by a column the table does not have.");
+
+  auto partitions = std::vector<std::shared_ptr<Table>>(partition_count);
+  for (auto& partition : partitions) {
+    partition = std::make_shared<Table>(table->column_definitions(), TableType::Data, table->max_chunk_size());
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+
+    // The partition of each row of the chunk
+    auto partition_ids = std::vector<size_t>(chunk->size());
+    resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) return;
+        partition_ids[position.chunk_offset()] = std::hash<ColumnDataType>{}(position.value()) % partition_count;
+      });
+    });
+
+    // Each column of the chunk is copied into the segments of the partitions
+    auto segments_per_partition = std::vector<Segments>(partition_count);
+    for (auto copied_column_id = ColumnID{0}; copied_column_id < table->column_count(); ++copied_column_id) {
+      resolve_data_type(table->column_data_type(copied_column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        const auto nullable = table->column_is_nullable(copied_column_id);
+        auto values = std::vector<pmr_concurrent_vector<ColumnDataType>>(partition_count);
+        auto null_values = std::vector<pmr_concurrent_vector<bool>>(partition_count);
+
+        segment_iterate<ColumnDataType>(*chunk->get_segment(copied_column_id), [&](const auto& position) {
+          const auto partition_id = partition_ids[position.chunk_offset()];
+          values[partition_id].push_back(position.is_null() ? ColumnDataType{} : position.value());
+          if (nullable) null_values[partition_id].push_back(position.is_null());
+        });
+
+        for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+          if (nullable) {
+            segments_per_partition[partition_id].emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(
+                std::move(values[partition_id]), std::move(null_values[partition_id])));
+          } else {
+            segments_per_partition[partition_id].emplace_back(
+                std::make_shared<ValueSegment<ColumnDataType>>(std::move(values[partition_id])));
+          }
+        }
+      });
+    }
+
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      auto& segments = segments_per_partition[partition_id];
+      if (segments.empty() || segments.front()->size() == 0) continue;
+      partitions[partition_id]->append_chunk(segments);
+    }
+  }
+
+  return partitions;
+}
+
+}  // namespace opossum
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Splits @param table into @param partition_count data tables by the hash of the values in @param column_id. Rows
+ * with the same value end up in the same partition, so that tables that are partitioned by their join keys can be
+ * joined partition by partition. NULLs are put into the first partition.
+ *
+ * The partitions are materialized, as they are sent to other nodes (see DistributedCoordinator).
+ */
+std::vector<std::shared_ptr<Table>> hash_partition_table(const std::shared_ptr<const Table>& table,
+                                                         const ColumnID column_id, const size_t partition_count);
+
+}  // namespace opossum
@@ -29,7 +29,8 @@ enum class ExpressionType {
   PQPSelect,
   LQPSelect,
   UnaryMinus,
-  Value
+  Value,
+  WindowFunction
 };
 
 /**
@@ -1,8 +1,11 @@
 #include "expression_evaluator.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <type_traits>
+#include <utility>
 
+#include "boost/functional/hash.hpp"
 #include "boost/lexical_cast.hpp"
 #include "boost/variant/apply_visitor.hpp"
 
@@ -30,6 +33,9 @@
 #include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -127,6 +133,24 @@ std::shared_ptr<AbstractExpression> rewrite_in_list_expression(const InExpressio
   return rewritten_expression;
 }
 
+// AND and OR evaluate their cheaper operand first, so that the other one is only evaluated for the undecided rows.
+// Sub-SELECTs, LIKEs and functions such as SUBSTR are considered expensive.
+bool is_expensive_to_evaluate(const std::shared_ptr<AbstractExpression>& expression) {
+  auto is_expensive = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::PQPSelect || sub_expression->type == ExpressionType::Function) {
+      is_expensive = true;
+    } else if (sub_expression->type == ExpressionType::Predicate) {
+      const auto predicate_condition =
+          std::static_pointer_cast<AbstractPredicateExpression>(sub_expression)->predicate_condition;
+      is_expensive =
+          predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike;
+    }
+    return is_expensive ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return is_expensive;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -142,9 +166,54 @@ ExpressionEvaluator::ExpressionEvaluator(
   _segment_materializations.resize(_chunk->column_count());
 }
 
+ExpressionEvaluator::ExpressionEvaluator(
+    const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+    const std::shared_ptr<const PosList>& chunk_selection,
+    const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results)
+    : ExpressionEvaluator(table, chunk_id, uncorrelated_select_results) {
+  Assert(chunk_selection, "Expected a selection of rows");
+  DebugAssert(chunk_selection->empty() || (chunk_selection->references_single_chunk() &&
+                                           chunk_selection->common_chunk_id() == chunk_id),
+              "Selection has to reference the evaluated Chunk");
+
+  // A selection of all rows is no selection
+  if (chunk_selection->references_entire_chunk(_chunk->size())) return;
+
+  _chunk_selection = chunk_selection;
+  _output_row_count = _chunk_selection->size();
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expression_to_result(
     const AbstractExpression& expression) {
+  // Columns are cached in _segment_materializations, values and parameters are cheap to evaluate
+  if (expression.type == ExpressionType::PQPColumn || expression.type == ExpressionType::Value ||
+      expression.type == ExpressionType::CorrelatedParameter) {
+    return _evaluate_expression_to_result_uncached<Result>(expression);
+  }
+
+  // Subexpressions that occur more than once, e.g., `a * (1 - b)` in several columns of a Projection, are evaluated
+  // only once. The cache holds on to the expressions, so temporary expressions (e.g., from rewritten BETWEENs) stay
+  // valid as keys.
+  const auto shared_expression = std::const_pointer_cast<AbstractExpression>(expression.weak_from_this().lock());
+  if (!shared_expression) return _evaluate_expression_to_result_uncached<Result>(expression);
+
+  // Callers may request a Result type that differs from the data type of the expression
+  const auto cached_result_iter = _cached_results.find(shared_expression);
+  if (cached_result_iter != _cached_results.end()) {
+    if (const auto cached_result = std::dynamic_pointer_cast<ExpressionResult<Result>>(cached_result_iter->second)) {
+      return cached_result;
+    }
+  }
+
+  const auto result = _evaluate_expression_to_result_uncached<Result>(expression);
+  _cached_results.emplace(shared_expression, result);
+  return result;
+}
+
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_expression_to_result_uncached(
+    const AbstractExpression& expression) {
   switch (expression.type) {
     case ExpressionType::Arithmetic:
       return _evaluate_arithmetic_expression<Result>(static_cast<const ArithmeticExpression&>(expression));
@@ -188,6 +257,9 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::evaluate_expressi
     case ExpressionType::Aggregate:
       Fail("ExpressionEvaluator doesn't support Aggregates, use the Aggregate Operator to compute them");
 
+    case ExpressionType::WindowFunction:
+      Fail("ExpressionEvaluator doesn't support window functions, use the WindowFunctionEvaluator to compute them");
+
     case ExpressionType::List:
       Fail("Can't evaluate a ListExpression, lists should only appear as the right operand of an InExpression");
 
@@ -227,7 +299,8 @@ template <>
 std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>
 ExpressionEvaluator::_evaluate_binary_predicate_expression<ExpressionEvaluator::Bool>(
     const BinaryPredicateExpression& expression) {
-  auto result = std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>{};
+  auto result = _evaluate_binary_predicate_on_dictionary_segment(expression);
+  if (result) return result;
 
   // To reduce the number of template instantiations, we flip > and >= to < and <=
   auto predicate_condition = expression.predicate_condition;
@@ -253,6 +326,101 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
   Fail("Can only evaluate predicates to bool");
 }
 
+std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>
+ExpressionEvaluator::_evaluate_binary_predicate_on_dictionary_segment(const BinaryPredicateExpression& expression) {
+  if (!_chunk) return nullptr;
+
+  switch (expression.predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      break;
+    default:
+      return nullptr;
+  }
+
+  // Normalize to `column <condition> literal`
+  auto predicate_condition = expression.predicate_condition;
+  auto column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression.left_operand());
+  auto value_expression = std::dynamic_pointer_cast<ValueExpression>(expression.right_operand());
+  if (!column_expression) {
+    column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression.right_operand());
+    value_expression = std::dynamic_pointer_cast<ValueExpression>(expression.left_operand());
+    predicate_condition = flip_predicate_condition(predicate_condition);
+  }
+
+  // Strings are the only type where materializing the values is much more expensive than looking at the value ids
+  if (!column_expression || !value_expression || column_expression->data_type() != DataType::String ||
+      value_expression->data_type() != DataType::String) {
+    return nullptr;
+  }
+
+  const auto dictionary_segment =
+      std::dynamic_pointer_cast<const BaseDictionarySegment>(_chunk->get_segment(column_expression->column_id));
+  if (!dictionary_segment) return nullptr;
+
+  /**
+   * Non-NULL rows match iff their value id lies in [begin, end) - or does not, if `invert` is set. See
+   * ColumnVsValueTableScanImpl for the bounds.
+   */
+  const auto& value = value_expression->value;
+  const auto unique_values_count = ValueID{dictionary_segment->unique_values_count()};
+  const auto to_bound = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? unique_values_count : value_id;
+  };
+
+  auto begin = ValueID{0};
+  auto end = unique_values_count;
+  auto invert = false;
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals: {
+      const auto lower_bound = dictionary_segment->lower_bound(value);
+      if (lower_bound != INVALID_VALUE_ID && dictionary_segment->value_of_value_id(lower_bound) == value) {
+        begin = lower_bound;
+        end = ValueID{lower_bound + 1};
+      } else {
+        end = ValueID{0};
+      }
+      invert = predicate_condition == PredicateCondition::NotEquals;
+    } break;
+    case PredicateCondition::LessThan:
+      end = to_bound(dictionary_segment->lower_bound(value));
+      break;
+    case PredicateCondition::LessThanEquals:
+      end = to_bound(dictionary_segment->upper_bound(value));
+      break;
+    case PredicateCondition::GreaterThan:
+      begin = to_bound(dictionary_segment->upper_bound(value));
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      begin = to_bound(dictionary_segment->lower_bound(value));
+      break;
+    default:
+      Fail("Unexpected PredicateCondition");
+  }
+
+  auto result_values = std::vector<ExpressionEvaluator::Bool>(_output_row_count);
+  auto result_nulls = std::vector<bool>(column_expression->is_nullable() ? _output_row_count : 0);
+
+  auto iterable = create_iterable_from_attribute_vector(*dictionary_segment);
+  iterable.with_iterators(_chunk_selection, [&](auto it, const auto end_it) {
+    for (auto chunk_offset = ChunkOffset{0}; it != end_it; ++it, ++chunk_offset) {
+      const auto position = *it;
+      const auto value_id = position.value();
+      result_values[chunk_offset] = (value_id >= begin && value_id < end) != invert;
+      if (!result_nulls.empty()) result_nulls[chunk_offset] = position.is_null();
+    }
+  });
+
+  return std::make_shared<ExpressionResult<ExpressionEvaluator::Bool>>(std::move(result_values),
+                                                                       std::move(result_nulls));
+}
+
 template <>
 std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>
 ExpressionEvaluator::_evaluate_like_expression<ExpressionEvaluator::Bool>(const BinaryPredicateExpression& expression) {
@@ -895,6 +1063,11 @@ ExpressionEvaluator::populate_uncorrelated_select_results_cache(
     visit_expression(expression, [&](const auto& sub_expression) {
       const auto pqp_select_expression = std::dynamic_pointer_cast<PQPSelectExpression>(sub_expression);
       if (pqp_select_expression && !pqp_select_expression->is_correlated()) {
+        // The same select might be used by multiple expressions
+        if (uncorrelated_select_results->count(pqp_select_expression->pqp)) {
+          return ExpressionVisitation::DoNotVisitArguments;
+        }
+
         // Uncorrelated select expressions have the same result for every row, so executing them for row 0 is fine.
         auto result = evaluator._evaluate_select_expression_for_row(*pqp_select_expression, ChunkOffset{0});
         uncorrelated_select_results->emplace(pqp_select_expression->pqp, std::move(result));
@@ -912,16 +1085,21 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_select_expression_fo
   Assert(expression.parameters.empty() || _chunk,
          "Sub-SELECT references external Columns but Expression doesn't operate on a Table/Chunk");
 
-  std::unordered_map<ParameterID, AllTypeVariant> parameters;
-
-  for (auto parameter_idx = size_t{0}; parameter_idx < expression.parameters.size(); ++parameter_idx) {
-    const auto& parameter_id_column_id = expression.parameters[parameter_idx];
-    const auto parameter_id = parameter_id_column_id.first;
+  auto parameter_values = SelectParameterValues{};
+  parameter_values.reserve(expression.parameters.size());
+  for (const auto& parameter_id_column_id : expression.parameters) {
     const auto column_id = parameter_id_column_id.second;
+    parameter_values.emplace_back(_segment_materializations[column_id]->value_as_variant(chunk_offset));
+  }
 
-    const auto value = _segment_materializations[column_id]->value_as_variant(chunk_offset);
+  auto& results_by_parameter_values = _select_results_by_parameter_values[expression.pqp];
+  const auto result_iter = results_by_parameter_values.find(parameter_values);
+  if (result_iter != results_by_parameter_values.cend()) return result_iter->second;
 
-    parameters.emplace(parameter_id, value);
+  std::unordered_map<ParameterID, AllTypeVariant> parameters;
+
+  for (auto parameter_idx = size_t{0}; parameter_idx < expression.parameters.size(); ++parameter_idx) {
+    parameters.emplace(expression.parameters[parameter_idx].first, parameter_values[parameter_idx]);
   }
 
   // TODO(moritz) deep_copy() shouldn't be necessary for every row if we could re-execute PQPs...
@@ -931,28 +1109,69 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_select_expression_fo
   const auto tasks = OperatorTask::make_tasks_from_operator(row_pqp, CleanupTemporaries::Yes);
   CurrentScheduler::schedule_and_wait_for_tasks(tasks);
 
-  return row_pqp->get_output();
+  const auto result = row_pqp->get_output();
+  results_by_parameter_values.emplace(std::move(parameter_values), result);
+  return result;
+}
+
+size_t ExpressionEvaluator::SelectParameterValuesHash::operator()(
+    const SelectParameterValues& parameter_values) const {
+  auto hash = size_t{0};
+  for (const auto& value : parameter_values) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+bool ExpressionEvaluator::SelectParameterValuesEqual::operator()(const SelectParameterValues& lhs,
+                                                                 const SelectParameterValues& rhs) const {
+  if (lhs.size() != rhs.size()) return false;
+
+  for (auto value_idx = size_t{0}; value_idx < lhs.size(); ++value_idx) {
+    const auto lhs_is_null = variant_is_null(lhs[value_idx]);
+    if (lhs_is_null != variant_is_null(rhs[value_idx])) return false;
+    if (!lhs_is_null && !(lhs[value_idx] == rhs[value_idx])) return false;
+  }
+  return true;
 }
 
 std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_expression_to_segment(const AbstractExpression& expression) {
+  Assert(expression.data_type() != DataType::Null, "Can't create a Segment from a NULL");
+
   std::shared_ptr<BaseSegment> segment;
-  pmr_concurrent_vector<bool> nulls;
 
-  _resolve_to_expression_result_view(expression, [&](const auto& view) {
-    using ColumnDataType = typename std::decay_t<decltype(view)>::Type;
+  resolve_data_type(expression.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    // Unless other expressions already used it, the result of the root expression is not cached. If no one else holds
+    // the result, its values (e.g., the strings computed by CONCAT or CASE) are moved into the Segment, not copied.
+    const auto shared_expression = std::const_pointer_cast<AbstractExpression>(expression.weak_from_this().lock());
+    const auto result = shared_expression && _cached_results.count(shared_expression)
+                            ? evaluate_expression_to_result<ColumnDataType>(expression)
+                            : _evaluate_expression_to_result_uncached<ColumnDataType>(expression);
+
+    const auto has_null_per_row = !result->is_nullable() || result->nulls.size() == result->size();
+    if (result.use_count() == 1 && result->size() == _output_row_count && has_null_per_row) {
+      auto values = pmr_concurrent_vector<ColumnDataType>(std::make_move_iterator(result->values.begin()),
+                                                          std::make_move_iterator(result->values.end()));
+      if (result->is_nullable()) {
+        auto nulls = pmr_concurrent_vector<bool>(result->nulls.begin(), result->nulls.end());
+        segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(nulls));
+      } else {
+        segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+      }
+      return;
+    }
 
-    // clang-format off
-    if constexpr (std::is_same_v<ColumnDataType, NullValue>) {
-      Fail("Can't create a Segment from a NULL");
-    } else {
+    result->as_view([&](const auto& view) {
       pmr_concurrent_vector<ColumnDataType> values(_output_row_count);
 
       for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
-        values[chunk_offset] = std::move(view.value(chunk_offset));
+        values[chunk_offset] = view.value(chunk_offset);
       }
 
       if (view.is_nullable()) {
-        nulls.resize(_output_row_count);
+        pmr_concurrent_vector<bool> nulls(_output_row_count);
         for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
           nulls[chunk_offset] = view.is_null(chunk_offset);
         }
@@ -960,8 +1179,7 @@ std::shared_ptr<BaseSegment> ExpressionEvaluator::evaluate_expression_to_segment
       } else {
         segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
       }
-    }
-    // clang-format on
+    });
   });
 
   return segment;
@@ -1069,21 +1287,65 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
     } break;
 
     case ExpressionType::Logical: {
+      // The PosLists of the arguments already contain the ChunkOffsets of the selected rows, so they are returned
+      // without the translation below
       const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
 
-      const auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
-      const auto right_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
+      // AND and OR are commutative, so the cheaper operand is evaluated first
+      auto left_expression = logical_expression.arguments[0];
+      auto right_expression = logical_expression.arguments[1];
+      if (is_expensive_to_evaluate(left_expression) && !is_expensive_to_evaluate(right_expression)) {
+        std::swap(left_expression, right_expression);
+      }
+
+      auto left_pos_list = evaluate_expression_to_pos_list(*left_expression);
 
       switch (logical_expression.logical_operator) {
-        case LogicalOperator::And:
-          std::set_intersection(left_pos_list.begin(), left_pos_list.end(), right_pos_list.begin(),
-                                right_pos_list.end(), std::back_inserter(result_pos_list));
-          break;
-
-        case LogicalOperator::Or:
-          std::set_union(left_pos_list.begin(), left_pos_list.end(), right_pos_list.begin(), right_pos_list.end(),
-                         std::back_inserter(result_pos_list));
-          break;
+        case LogicalOperator::And: {
+          if (left_pos_list.empty()) return left_pos_list;
+
+          // The right side is only evaluated for the rows that match the left side, unless these are all rows
+          if (left_pos_list.size() < _output_row_count) {
+            auto left_matches = std::make_shared<PosList>(std::move(left_pos_list));
+            left_matches->guarantee_single_chunk();
+            return ExpressionEvaluator{_table, _chunk_id, left_matches, _uncorrelated_select_results}
+                .evaluate_expression_to_pos_list(*right_expression);
+          }
+
+          return evaluate_expression_to_pos_list(*right_expression);
+        }
+
+        case LogicalOperator::Or: {
+          if (left_pos_list.size() == _output_row_count) return left_pos_list;
+          if (left_pos_list.empty()) return evaluate_expression_to_pos_list(*right_expression);
+
+          // The right side is only evaluated for the rows that do not match the left side
+          auto unmatched_rows = std::make_shared<PosList>();
+          unmatched_rows->reserve(_output_row_count - left_pos_list.size());
+          auto left_iter = left_pos_list.cbegin();
+          const auto add_if_unmatched = [&](const RowID& row_id) {
+            while (left_iter != left_pos_list.cend() && left_iter->chunk_offset < row_id.chunk_offset) ++left_iter;
+            if (left_iter == left_pos_list.cend() || left_iter->chunk_offset != row_id.chunk_offset) {
+              unmatched_rows->emplace_back(row_id);
+            }
+          };
+
+          if (_chunk_selection) {
+            _chunk_selection->for_each_row_id(add_if_unmatched);
+          } else {
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _output_row_count; ++chunk_offset) {
+              add_if_unmatched(RowID{_chunk_id, chunk_offset});
+            }
+          }
+          unmatched_rows->guarantee_single_chunk();
+
+          const auto right_pos_list =
+              ExpressionEvaluator{_table, _chunk_id, unmatched_rows, _uncorrelated_select_results}
+                  .evaluate_expression_to_pos_list(*right_expression);
+          std::merge(left_pos_list.cbegin(), left_pos_list.cend(), right_pos_list.cbegin(), right_pos_list.cend(),
+                     std::back_inserter(result_pos_list));
+          return result_pos_list;
+        }
       }
     } break;
 
@@ -1128,14 +1390,52 @@ PosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpre
       Fail("Expression type cannot be evaluated to PosList");
   }
 
+  // With a selection, the rows above were identified by their index in the selection
+  if (_chunk_selection) {
+    for (auto& row_id : result_pos_list) {
+      row_id.chunk_offset = (*_chunk_selection)[row_id.chunk_offset].chunk_offset;
+    }
+  }
+
   return result_pos_list;
 }
 
 template <>
 std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>
 ExpressionEvaluator::_evaluate_logical_expression<ExpressionEvaluator::Bool>(const LogicalExpression& expression) {
-  const auto& left = *expression.left_operand();
-  const auto& right = *expression.right_operand();
+  // AND and OR are commutative, so the cheaper operand is evaluated first
+  auto left_expression = expression.left_operand();
+  auto right_expression = expression.right_operand();
+  if (is_expensive_to_evaluate(left_expression) && !is_expensive_to_evaluate(right_expression)) {
+    std::swap(left_expression, right_expression);
+  }
+  const auto& left = *left_expression;
+  const auto& right = *right_expression;
+
+  if (_chunk && _output_row_count > 1 && left.data_type() == DataTypeBool && right.data_type() == DataTypeBool) {
+    const auto is_and = expression.logical_operator == LogicalOperator::And;
+    const auto left_result = evaluate_expression_to_result<ExpressionEvaluator::Bool>(left);
+
+    if (left_result->size() == _output_row_count) {
+      // A left operand that is FALSE (for AND) or TRUE (for OR) decides the row, the right operand is only evaluated
+      // for the other rows
+      auto undecided_rows = std::vector<ChunkOffset>{};
+      for (auto row_idx = ChunkOffset{0}; row_idx < _output_row_count; ++row_idx) {
+        if (left_result->is_null(row_idx) || (left_result->value(row_idx) != 0) == is_and) {
+          undecided_rows.emplace_back(row_idx);
+        }
+      }
+
+      if (undecided_rows.empty()) return left_result;
+
+      if (undecided_rows.size() < _output_row_count) {
+        return is_and ? _evaluate_logical_expression_for_undecided_rows<TernaryAndEvaluator>(*left_result, right,
+                                                                                             undecided_rows)
+                      : _evaluate_logical_expression_for_undecided_rows<TernaryOrEvaluator>(*left_result, right,
+                                                                                            undecided_rows);
+      }
+    }
+  }
 
   // clang-format off
   switch (expression.logical_operator) {
@@ -1147,6 +1447,57 @@ ExpressionEvaluator::_evaluate_logical_expression<ExpressionEvaluator::Bool>(con
   Fail("GCC thinks this is reachable");
 }
 
+template <typename Functor>
+std::shared_ptr<ExpressionResult<ExpressionEvaluator::Bool>>
+ExpressionEvaluator::_evaluate_logical_expression_for_undecided_rows(
+    const ExpressionResult<Bool>& left_result, const AbstractExpression& right_expression,
+    const std::vector<ChunkOffset>& undecided_rows) {
+  // The selection of the sub-evaluator consists of ChunkOffsets of the Chunk, undecided_rows are indices into the
+  // rows evaluated here
+  auto selection = std::make_shared<PosList>();
+  selection->reserve(undecided_rows.size());
+  if (_chunk_selection) {
+    auto row_idx = ChunkOffset{0};
+    auto undecided_iter = undecided_rows.cbegin();
+    _chunk_selection->for_each_row_id([&](const RowID& row_id) {
+      if (undecided_iter != undecided_rows.cend() && *undecided_iter == row_idx) {
+        selection->emplace_back(row_id);
+        ++undecided_iter;
+      }
+      ++row_idx;
+    });
+  } else {
+    for (const auto row_idx : undecided_rows) {
+      selection->emplace_back(RowID{_chunk_id, row_idx});
+    }
+  }
+  selection->guarantee_single_chunk();
+
+  const auto right_result = ExpressionEvaluator{_table, _chunk_id, selection, _uncorrelated_select_results}
+                                .evaluate_expression_to_result<Bool>(right_expression);
+
+  // Decided rows are combined with a non-NULL FALSE, which yields the left operand for both AND and OR
+  auto values = std::vector<Bool>(_output_row_count);
+  auto nulls = std::vector<bool>(_output_row_count);
+  auto undecided_idx = size_t{0};
+  for (auto row_idx = ChunkOffset{0}; row_idx < _output_row_count; ++row_idx) {
+    auto right_value = Bool{0};
+    auto right_is_null = false;
+    if (undecided_idx < undecided_rows.size() && undecided_rows[undecided_idx] == row_idx) {
+      right_value = right_result->value(undecided_idx);
+      right_is_null = right_result->is_null(undecided_idx);
+      ++undecided_idx;
+    }
+
+    bool null;
+    Functor{}(values[row_idx], null, left_result.value(row_idx), left_result.is_null(row_idx), right_value,
+              right_is_null);
+    nulls[row_idx] = null;
+  }
+
+  return std::make_shared<ExpressionResult<Bool>>(std::move(values), std::move(nulls));
+}
+
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_logical_expression(
     const LogicalExpression& expression) {
@@ -1168,18 +1519,26 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
       values.resize(result_size);
       nulls = _evaluate_default_null_logic(left.nulls, right.nulls);
 
-      // Using three different branches instead of views, which would generate 9 cases.
+      // Using three different branches instead of views, which would generate 9 cases. NULLs are handled separately
+      // above, so the loops only apply the Functor to contiguous values. A literal operand is copied into a local,
+      // which the compiler does not have to reload after each write to `values`. This allows it to vectorize the loops.
+      auto* const result_values = values.data();
+      const auto* const left_values = left.values.data();
+      const auto* const right_values = right.values.data();
+
       if (left.is_literal() == right.is_literal()) {
         for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values[row_idx], right.values[row_idx]);
+          Functor{}(result_values[row_idx], left_values[row_idx], right_values[row_idx]);
         }
       } else if (right.is_literal()) {
+        const auto right_value = right.values.front();
         for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values[row_idx], right.values.front());
+          Functor{}(result_values[row_idx], left_values[row_idx], right_value);
         }
       } else {
+        const auto left_value = left.values.front();
         for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-          Functor{}(values[row_idx], left.values.front(), right.values[row_idx]);
+          Functor{}(result_values[row_idx], left_value, right_values[row_idx]);
         }
       }
     } else {
@@ -1202,9 +1561,27 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
     if constexpr (Functor::template supports<Result, LeftDataType, RightDataType>::value) {
       const auto result_row_count = _result_size(left.size(), right.size());
 
-      std::vector<bool> nulls(result_row_count);
       std::vector<Result> values(result_row_count);
 
+      if (!left.is_nullable() && !right.is_nullable()) {
+        // Without NULL operands, the Functor's NULL logic is mostly constant-folded away and the values are computed
+        // in a loop without writes to the (bit-packed) nulls. Only if the Functor still produced a NULL (e.g., on a
+        // division by zero) are the nulls computed in a second pass.
+        auto any_null = false;
+        for (auto row_idx = ChunkOffset{0}; row_idx < result_row_count; ++row_idx) {
+          auto null = false;
+          Functor{}(values[row_idx], null, left.value(row_idx), false, right.value(row_idx), false);
+          any_null |= null;
+        }
+
+        if (!any_null) {
+          result = std::make_shared<ExpressionResult<Result>>(std::move(values));
+          return;
+        }
+      }
+
+      std::vector<bool> nulls(result_row_count);
+
       for (auto row_idx = ChunkOffset{0}; row_idx < result_row_count; ++row_idx) {
         bool null;
         Functor{}(values[row_idx], null, left.value(row_idx), left.is_null(row_idx), right.value(row_idx),
@@ -1319,19 +1696,39 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
 
   if (_segment_materializations[column_id]) return;
 
-  const auto& segment = *_chunk->get_segment(column_id);
+  auto segment_ptr = _chunk->get_segment(column_id);
+  auto position_filter = _chunk_selection;
+
+  // ReferenceSegments cannot be accessed through a position filter. Instead, a ReferenceSegment with only the
+  // selected positions is materialized.
+  if (_chunk_selection) {
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment_ptr)) {
+      const auto& referenced_positions = *reference_segment->pos_list();
+      auto selected_positions = std::make_shared<PosList>();
+      selected_positions->reserve(_chunk_selection->size());
+      _chunk_selection->for_each_row_id([&](const auto& row_id) {
+        selected_positions->emplace_back(referenced_positions[row_id.chunk_offset]);
+      });
+
+      segment_ptr = std::make_shared<ReferenceSegment>(reference_segment->referenced_table(),
+                                                       reference_segment->referenced_column_id(), selected_positions);
+      position_filter = nullptr;
+    }
+  }
+
+  const auto& segment = *segment_ptr;
 
   resolve_data_type(segment.data_type(), [&](const auto column_data_type_t) {
     using ColumnDataType = typename decltype(column_data_type_t)::type;
 
-    std::vector<ColumnDataType> values(segment.size());
+    std::vector<ColumnDataType> values(_output_row_count);
 
     auto chunk_offset = ChunkOffset{0};
 
     if (_table->column_is_nullable(column_id)) {
-      std::vector<bool> nulls(segment.size());
+      std::vector<bool> nulls(_output_row_count);
 
-      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      segment_iterate_filtered<ColumnDataType>(segment, position_filter, [&](const auto& position) {
         if (position.is_null()) {
           nulls[chunk_offset] = true;
         } else {
@@ -1344,7 +1741,7 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
           std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
 
     } else {
-      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      segment_iterate_filtered<ColumnDataType>(segment, position_filter, [&](const auto& position) {
         values[chunk_offset] = position.value();
         ++chunk_offset;
       });
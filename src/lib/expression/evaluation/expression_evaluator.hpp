@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "boost/variant.hpp"
@@ -40,6 +41,9 @@ class PQPColumnExpression;
  *
  * Operates either
  *      - ...on a Chunk, thus returning a value for each row in it
+ *      - ...on a selection of the rows of a Chunk, thus returning a value for each selected row. This allows operators
+ *           to evaluate large Chunks in cache-sized batches and conjunctions to skip the rows that were already
+ *           eliminated by their left side.
  *      - ...without a Chunk, thus returning a single value (and failing if Columns are encountered in the Expression)
  */
 class ExpressionEvaluator final {
@@ -49,6 +53,10 @@ class ExpressionEvaluator final {
   using Bool = int32_t;
   static constexpr auto DataTypeBool = DataType::Int;
 
+  // Number of rows that operators evaluate at once when they split Chunks into batches, so that the intermediate
+  // results of an Expression stay in the cache
+  static constexpr auto BATCH_SIZE = ChunkOffset{4'096};
+
   // Performance Hack:
   //   For PQPSelectExpressions that are not correlated (i.e., that have no parameters), we pass previously
   //   calculated results into the per-chunk evaluator so that they are only evaluated once, not per-chunk.
@@ -65,6 +73,16 @@ class ExpressionEvaluator final {
   ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
                       const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results = {});
 
+  /*
+   * For Expressions that are only evaluated for some rows of a Chunk
+   * @param chunk_selection  The rows of the Chunk to evaluate, in ascending order. Results (and Segments) have one
+   *                         entry per selected row, evaluate_expression_to_pos_list() returns the selected rows that
+   *                         match.
+   */
+  ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
+                      const std::shared_ptr<const PosList>& chunk_selection,
+                      const std::shared_ptr<const UncorrelatedSelectResults>& uncorrelated_select_results = {});
+
   std::shared_ptr<BaseSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
   PosList evaluate_expression_to_pos_list(const AbstractExpression& expression);
 
@@ -76,6 +94,10 @@ class ExpressionEvaluator final {
       const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
  private:
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _evaluate_expression_to_result_uncached(
+      const AbstractExpression& expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -90,6 +112,11 @@ class ExpressionEvaluator final {
   std::shared_ptr<ExpressionResult<Result>> _evaluate_binary_predicate_expression(
       const BinaryPredicateExpression& expression);
 
+  // Compares a string column to a string literal on the value ids of a DictionarySegment, without materializing the
+  // strings. Returns nullptr if the expression or the segment do not have this shape.
+  std::shared_ptr<ExpressionResult<Bool>> _evaluate_binary_predicate_on_dictionary_segment(
+      const BinaryPredicateExpression& expression);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_like_expression(const BinaryPredicateExpression& expression);
 
@@ -105,6 +132,7 @@ class ExpressionEvaluator final {
   std::vector<std::shared_ptr<const Table>> _evaluate_select_expression_to_tables(
       const PQPSelectExpression& expression);
 
+  // Memoized in _select_results_by_parameter_values
   std::shared_ptr<const Table> _evaluate_select_expression_for_row(const PQPSelectExpression& expression,
                                                                    const ChunkOffset chunk_offset);
 
@@ -138,6 +166,13 @@ class ExpressionEvaluator final {
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_exists_expression(const ExistsExpression& exists_expression);
 
+  // Combines the result of the left operand of an AND/OR with the right operand, which is only evaluated for the
+  // undecided rows (given as indices into the evaluated rows)
+  template <typename Functor>
+  std::shared_ptr<ExpressionResult<Bool>> _evaluate_logical_expression_for_undecided_rows(
+      const ExpressionResult<Bool>& left_result, const AbstractExpression& right_expression,
+      const std::vector<ChunkOffset>& undecided_rows);
+
   // See docs for `_evaluate_default_null_logic()`
   template <typename Result, typename Functor>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_binary_with_default_null_logic(
@@ -190,12 +225,33 @@ class ExpressionEvaluator final {
   std::shared_ptr<const Table> _table;
   std::shared_ptr<const Chunk> _chunk;
   const ChunkID _chunk_id;
+  // nullptr if all rows of the Chunk are evaluated
+  std::shared_ptr<const PosList> _chunk_selection;
   size_t _output_row_count{1};
 
   // One entry for each segment in the _chunk, may be nullptr if the segment hasn't been materialized
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
+  // Results of the expressions evaluated so far, see evaluate_expression_to_result()
+  ExpressionUnorderedMap<std::shared_ptr<BaseExpressionResult>> _cached_results;
+
   const std::shared_ptr<const UncorrelatedSelectResults> _uncorrelated_select_results;
+
+  // The values bound to the parameters of a PQPSelectExpression. NULLs are considered equal to each other.
+  using SelectParameterValues = std::vector<AllTypeVariant>;
+  struct SelectParameterValuesHash {
+    size_t operator()(const SelectParameterValues& parameter_values) const;
+  };
+  struct SelectParameterValuesEqual {
+    bool operator()(const SelectParameterValues& lhs, const SelectParameterValues& rhs) const;
+  };
+
+  // Results of the PQPs of PQPSelectExpressions by the parameter values they were executed with. Correlated selects
+  // often see the same values in many rows (e.g., the same key), which then execute the PQP only once.
+  std::unordered_map<std::shared_ptr<AbstractOperator>,
+                     std::unordered_map<SelectParameterValues, std::shared_ptr<const Table>, SelectParameterValuesHash,
+                                        SelectParameterValuesEqual>>
+      _select_results_by_parameter_values;
 };
 
 }  // namespace opossum
@@ -1,9 +1,152 @@
 #include "like_matcher.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
 #include "boost/algorithm/string/replace.hpp"
 
 #include "utils/assert.hpp"
 
+// The 256-bit search is compiled for AVX2 and only available on x86-64
+#if defined(__x86_64__)
+#define LIKE_MATCHER_WIDE_REGISTERS 1
+#endif
+
+// Used for code that needs to be compiled for the instruction set of its caller (see find_256)
+#define LIKE_MATCHER_ALWAYS_INLINE __attribute__((always_inline))
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A register of register_size characters
+template <size_t register_size>
+struct CharRegister {
+  typedef char type __attribute__((vector_size(register_size)));
+};
+
+/**
+ * Finds the needle (which must not be empty) in the haystack, starting at position. For each block of register_size
+ * positions, the first and the last character of the needle are compared with the haystack at once. Only where both
+ * match, the characters in between are compared. See http://0x80.pl/articles/simd-strfind.html
+ */
+template <size_t register_size, size_t... lane>
+inline LIKE_MATCHER_ALWAYS_INLINE size_t find_with_registers(const std::string_view& haystack,
+                                                             const std::string_view& needle, size_t position,
+                                                             std::index_sequence<lane...>) {
+  using Register = typename CharRegister<register_size>::type;
+  static_assert(sizeof...(lane) == register_size, "Invalid register size");
+
+  const auto first_characters = Register{} + needle.front();
+  const auto last_characters = Register{} + needle.back();
+  const auto last_offset = needle.size() - 1;
+
+  for (; position + last_offset + register_size <= haystack.size(); position += register_size) {
+    Register first_block;
+    Register last_block;
+    std::memcpy(&first_block, haystack.data() + position, register_size);
+    std::memcpy(&last_block, haystack.data() + position + last_offset, register_size);
+
+    const auto candidates = (first_block == first_characters) & (last_block == last_characters);
+    auto mask = ((static_cast<uint64_t>(candidates[lane] & 1) << lane) | ...);
+
+    while (mask) {
+      const auto candidate = position + __builtin_ctzll(mask);
+      mask &= mask - 1u;
+
+      if (last_offset < 2 ||
+          std::memcmp(haystack.data() + candidate + 1, needle.data() + 1, last_offset - 1) == 0) {
+        return candidate;
+      }
+    }
+  }
+
+  // The positions after the last full block are checked by std::string_view
+  return haystack.find(needle, position);
+}
+
+size_t find_128(const std::string_view& haystack, const std::string_view& needle, const size_t position) {
+  return find_with_registers<16u>(haystack, needle, position, std::make_index_sequence<16u>{});
+}
+
+#if LIKE_MATCHER_WIDE_REGISTERS
+
+// Compiled for AVX2, only called if the CPU supports it
+__attribute__((target("avx2"))) size_t find_256(const std::string_view& haystack, const std::string_view& needle,
+                                                const size_t position) {
+  return find_with_registers<32u>(haystack, needle, position, std::make_index_sequence<32u>{});
+}
+
+#endif
+
+// Returns whether the section matches the string at the given position. The string has to be long enough.
+bool section_matches_at(const LikeMatcher::WildcardPattern::Section& section, const std::string_view& string,
+                        const size_t position) {
+  const auto& characters = section.characters;
+  for (auto index = size_t{0}; index < characters.size(); ++index) {
+    if (characters[index] != '_' && characters[index] != string[position + index]) return false;
+  }
+  return true;
+}
+
+// Returns the leftmost position at or after begin where the section matches and ends before end, or npos
+size_t find_section(const LikeMatcher::WildcardPattern::Section& section, const std::string_view& string,
+                    const size_t begin, const size_t end) {
+  const auto section_size = section.characters.size();
+  if (begin + section_size > end) return std::string_view::npos;
+
+  // A section of '_'s matches anywhere
+  if (section.anchor.empty()) return begin;
+
+  const auto searched_string = string.substr(0, end);
+  auto anchor_position = begin + section.anchor_offset;
+  while (true) {
+    anchor_position = LikeMatcher::find(searched_string, section.anchor, anchor_position);
+    if (anchor_position == std::string_view::npos) return std::string_view::npos;
+
+    const auto section_position = anchor_position - section.anchor_offset;
+    if (section_position + section_size > end) return std::string_view::npos;
+    if (section_matches_at(section, string, section_position)) return section_position;
+
+    ++anchor_position;
+  }
+}
+
+LikeMatcher::WildcardPattern make_wildcard_pattern(const std::string& pattern) {
+  auto wildcard_pattern = LikeMatcher::WildcardPattern{};
+  wildcard_pattern.starts_with_any_chars = !pattern.empty() && pattern.front() == '%';
+  wildcard_pattern.ends_with_any_chars = !pattern.empty() && pattern.back() == '%';
+
+  auto section_begin = size_t{0};
+  while (section_begin < pattern.size()) {
+    const auto section_end = std::min(pattern.find('%', section_begin), pattern.size());
+    if (section_end > section_begin) {
+      auto section = LikeMatcher::WildcardPattern::Section{};
+      section.characters = pattern.substr(section_begin, section_end - section_begin);
+
+      // Find the longest run of characters without '_'
+      auto run_begin = size_t{0};
+      section.anchor_offset = 0;
+      for (auto index = size_t{0}; index <= section.characters.size(); ++index) {
+        if (index < section.characters.size() && section.characters[index] != '_') continue;
+        if (index - run_begin > section.anchor.size()) {
+          section.anchor = section.characters.substr(run_begin, index - run_begin);
+          section.anchor_offset = run_begin;
+        }
+        run_begin = index + 1;
+      }
+
+      wildcard_pattern.sections.emplace_back(std::move(section));
+    }
+    section_begin = section_end + 1;
+  }
+
+  return wildcard_pattern;
+}
+
+}  // namespace
+
 namespace opossum {
 
 LikeMatcher::LikeMatcher(const std::string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
@@ -87,14 +230,67 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The pattern has to end with '%' (i.e., the next token would have to be a string) and must not be empty
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return make_wildcard_pattern(pattern);
     }
   }
 }
 
+size_t LikeMatcher::find(const std::string_view& haystack, const std::string_view& needle, const size_t offset) {
+  // Short haystacks do not fill a single register
+  if (needle.empty() || offset + needle.size() + 16u > haystack.size()) return haystack.find(needle, offset);
+
+#if LIKE_MATCHER_WIDE_REGISTERS
+  static const auto has_avx2 = []() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+  }();
+  if (has_avx2) return find_256(haystack, needle, offset);
+#endif
+
+  return find_128(haystack, needle, offset);
+}
+
+bool LikeMatcher::matches(const WildcardPattern& pattern, const std::string_view& string) {
+  const auto& sections = pattern.sections;
+  if (sections.empty()) return pattern.starts_with_any_chars || string.empty();
+
+  // The sections in [first_section, last_section) are searched for within [begin, end) of the string
+  auto first_section = sections.cbegin();
+  auto last_section = sections.cend();
+  auto begin = size_t{0};
+  auto end = string.size();
+
+  if (!pattern.starts_with_any_chars) {
+    const auto& section = sections.front();
+    if (section.characters.size() > end || !section_matches_at(section, string, 0)) return false;
+    begin = section.characters.size();
+    ++first_section;
+  }
+
+  if (!pattern.ends_with_any_chars) {
+    // Without any '%', the only section has to match the entire string
+    if (first_section == last_section) return begin == end;
+
+    const auto& section = sections.back();
+    if (section.characters.size() > end - begin) return false;
+    end -= section.characters.size();
+    if (!section_matches_at(section, string, end)) return false;
+    --last_section;
+  }
+
+  for (auto section_iter = first_section; section_iter != last_section; ++section_iter) {
+    const auto position = find_section(*section_iter, string, begin, end);
+    if (position == std::string_view::npos) return false;
+    begin = position + section_iter->characters.size();
+  }
+
+  return true;
+}
+
 std::string LikeMatcher::sql_like_to_regex(std::string sql_like) {
   // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
   // backslashes introduced by the other substitutions
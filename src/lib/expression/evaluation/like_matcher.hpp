@@ -1,7 +1,7 @@
 #pragma once
 
-#include <regex>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "boost/variant.hpp"
@@ -13,7 +13,7 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are matched by a WildcardPattern, which does not backtrack.
  */
 class LikeMatcher {
  public:
@@ -22,6 +22,13 @@ class LikeMatcher {
    */
   static std::string sql_like_to_regex(std::string sql_like);
 
+  /**
+   * Returns the position of the first occurrence of @param needle in @param haystack that starts at or after
+   * @param offset, or std::string_view::npos. Compares the first and the last character of the needle with 16 (or, with
+   * AVX2, 32) positions of the haystack at once and compares the rest of the needle only where both match.
+   */
+  static size_t find(const std::string_view& haystack, const std::string_view& needle, const size_t offset = 0);
+
   static size_t get_index_of_next_wildcard(const std::string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const std::string& pattern);
 
@@ -39,7 +46,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is a WildcardPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -57,18 +64,39 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<std::string> strings;
   };
+  // Any other pattern, e.g., 'h_llo%w%d'. The pattern is split at its '%'s into sections, which consist of characters
+  // and '_'s and thus match a fixed number of characters. The first section has to match at the beginning of the
+  // string, the last one at its end, and the sections in between are searched for from left to right. Taking the
+  // leftmost match of each section never rules out a match of the following ones, so no backtracking is needed.
+  struct WildcardPattern final {
+    struct Section final {
+      std::string characters;
+      // The longest run of characters without '_', which is searched for to find candidate positions of the section
+      std::string anchor;
+      size_t anchor_offset;
+    };
+
+    std::vector<Section> sections;
+    // Whether there is a '%' before the first or after the last section. Otherwise, that section has to match at the
+    // beginning or the end of the string.
+    bool starts_with_any_chars;
+    bool ends_with_any_chars;
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or a WildcardPattern for a general
+   * pattern.
    */
-  using AllPatternVariant =
-      boost::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+  using AllPatternVariant = boost::variant<WildcardPattern, StartsWithPattern, EndsWithPattern, ContainsPattern,
+                                           MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const std::string& pattern);
 
+  static bool matches(const WildcardPattern& pattern, const std::string_view& string);
+
   /**
-   * The functor will be called with a concrete matcher.
+   * The functor will be called with a concrete matcher. The matcher takes a std::string_view, so that strings that are
+   * not stored as std::string (e.g., in a FixedStringVector) do not need to be copied.
    * Usage example:
    *    LikeMatcher{"%hello%"}.resolve(false, [](const auto& matcher) {
    *        std::cout << matcher("He said hello!") << std::endl;
@@ -78,41 +106,43 @@ class LikeMatcher {
   void resolve(const bool invert_results, const Functor& functor) const {
     if (_pattern_variant.type() == typeid(StartsWithPattern)) {
       const auto& prefix = boost::get<StartsWithPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
+      functor([&](const std::string_view& string) -> bool {
         if (string.size() < prefix.size()) return invert_results;
         return (string.compare(0, prefix.size(), prefix) == 0) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(EndsWithPattern)) {
       const auto& suffix = boost::get<EndsWithPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
+      functor([&](const std::string_view& string) -> bool {
         if (string.size() < suffix.size()) return invert_results;
         return (string.compare(string.size() - suffix.size(), suffix.size(), suffix) == 0) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(ContainsPattern)) {
       const auto& contains_str = boost::get<ContainsPattern>(_pattern_variant).string;
-      functor([&](const std::string& string) -> bool {
-        return (string.find(contains_str) != std::string::npos) ^ invert_results;
+      functor([&](const std::string_view& string) -> bool {
+        return (find(string, contains_str) != std::string::npos) ^ invert_results;
       });
 
     } else if (_pattern_variant.type() == typeid(MultipleContainsPattern)) {
       const auto& contains_strs = boost::get<MultipleContainsPattern>(_pattern_variant).strings;
 
-      functor([&](const std::string& string) -> bool {
+      functor([&](const std::string_view& string) -> bool {
         auto current_position = size_t{0};
         for (const auto& contains_str : contains_strs) {
-          current_position = string.find(contains_str, current_position);
+          current_position = find(string, contains_str, current_position);
           if (current_position == std::string::npos) return invert_results;
           current_position += contains_str.size();
         }
         return !invert_results;
       });
 
-    } else if (_pattern_variant.type() == typeid(std::regex)) {
-      const auto& regex = boost::get<std::regex>(_pattern_variant);
+    } else if (_pattern_variant.type() == typeid(WildcardPattern)) {
+      const auto& wildcard_pattern = boost::get<WildcardPattern>(_pattern_variant);
 
-      functor([&](const std::string& string) -> bool { return std::regex_match(string, regex) ^ invert_results; });
+      functor([&](const std::string_view& string) -> bool {
+        return matches(wildcard_pattern, string) ^ invert_results;
+      });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
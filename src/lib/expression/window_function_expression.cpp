@@ -0,0 +1,191 @@
+#include "window_function_expression.hpp"
+
+#include <sstream>
+
+#include "boost/functional/hash.hpp"
+
+#include "aggregate_expression.hpp"
+#include "constant_mappings.hpp"
+#include "expression_utils.hpp"
+#include "operators/aggregate/aggregate_traits.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::vector<std::shared_ptr<AbstractExpression>> concatenate_arguments(
+    const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions) {
+  auto arguments = std::vector<std::shared_ptr<AbstractExpression>>{};
+  if (argument) arguments.emplace_back(argument);
+  arguments.insert(arguments.end(), partition_by_expressions.begin(), partition_by_expressions.end());
+  arguments.insert(arguments.end(), order_by_expressions.begin(), order_by_expressions.end());
+  return arguments;
+}
+
+}  // namespace
+
+namespace opossum {
+
+WindowFunctionExpression::WindowFunctionExpression(
+    const WindowFunction window_function, const std::shared_ptr<AbstractExpression>& argument,
+    const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+    const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+    const std::vector<OrderByMode>& order_by_modes, const size_t offset)
+    : AbstractExpression(ExpressionType::WindowFunction,
+                         concatenate_arguments(argument, partition_by_expressions, order_by_expressions)),
+      window_function(window_function),
+      partition_by_count(partition_by_expressions.size()),
+      order_by_modes(order_by_modes),
+      offset(offset) {
+  Assert(order_by_expressions.size() == order_by_modes.size(), "Expected as many Expressions as OrderByModes");
+
+  switch (window_function) {
+    case WindowFunction::RowNumber:
+    case WindowFunction::Rank:
+    case WindowFunction::DenseRank:
+      Assert(!argument, "Ranking window functions have no argument");
+      break;
+    case WindowFunction::Count:
+      break;
+    case WindowFunction::Lag:
+    case WindowFunction::Lead:
+    case WindowFunction::Min:
+    case WindowFunction::Max:
+    case WindowFunction::Sum:
+    case WindowFunction::Avg:
+      Assert(argument, "Window function requires an argument");
+      break;
+  }
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::argument() const {
+  return _has_argument() ? arguments[0] : nullptr;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::partition_by_expressions() const {
+  const auto begin = arguments.begin() + (_has_argument() ? 1 : 0);
+  return {begin, begin + partition_by_count};
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> WindowFunctionExpression::order_by_expressions() const {
+  return {arguments.end() - order_by_modes.size(), arguments.end()};
+}
+
+std::shared_ptr<AbstractExpression> WindowFunctionExpression::deep_copy() const {
+  return std::make_shared<WindowFunctionExpression>(
+      window_function, argument() ? argument()->deep_copy() : nullptr,
+      expressions_deep_copy(partition_by_expressions()), expressions_deep_copy(order_by_expressions()),
+      order_by_modes, offset);
+}
+
+std::string WindowFunctionExpression::as_column_name() const {
+  std::stringstream stream;
+
+  stream << window_function_to_string.left.at(window_function) << "(";
+  if (argument()) {
+    stream << argument()->as_column_name();
+  } else if (window_function == WindowFunction::Count) {
+    stream << "*";
+  }
+  if ((window_function == WindowFunction::Lag || window_function == WindowFunction::Lead) && offset != 1) {
+    stream << ", " << offset;
+  }
+  stream << ") OVER (";
+
+  const auto partition_by = partition_by_expressions();
+  if (!partition_by.empty()) {
+    stream << "PARTITION BY " << expression_column_names(partition_by);
+    if (!order_by_modes.empty()) stream << " ";
+  }
+
+  const auto order_by = order_by_expressions();
+  if (!order_by.empty()) {
+    stream << "ORDER BY ";
+    for (auto expression_idx = size_t{0}; expression_idx < order_by.size(); ++expression_idx) {
+      stream << order_by[expression_idx]->as_column_name() << " ";
+      stream << "(" << order_by_mode_to_string.at(order_by_modes[expression_idx]) << ")";
+      if (expression_idx + 1 < order_by.size()) stream << ", ";
+    }
+  }
+  stream << ")";
+
+  return stream.str();
+}
+
+DataType WindowFunctionExpression::data_type() const {
+  switch (window_function) {
+    case WindowFunction::RowNumber:
+    case WindowFunction::Rank:
+    case WindowFunction::DenseRank:
+    case WindowFunction::Count:
+      return DataType::Long;
+    case WindowFunction::Lag:
+    case WindowFunction::Lead:
+    case WindowFunction::Min:
+    case WindowFunction::Max:
+      return argument()->data_type();
+    case WindowFunction::Sum:
+    case WindowFunction::Avg:
+      break;
+  }
+
+  auto aggregate_data_type = DataType::Null;
+  resolve_data_type(argument()->data_type(), [&](const auto data_type_t) {
+    using ArgumentDataType = typename decltype(data_type_t)::type;
+    if (window_function == WindowFunction::Sum) {
+      aggregate_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Sum>::AGGREGATE_DATA_TYPE;
+    } else {
+      aggregate_data_type = AggregateTraits<ArgumentDataType, AggregateFunction::Avg>::AGGREGATE_DATA_TYPE;
+    }
+  });
+
+  return aggregate_data_type;
+}
+
+bool WindowFunctionExpression::is_nullable() const {
+  switch (window_function) {
+    case WindowFunction::RowNumber:
+    case WindowFunction::Rank:
+    case WindowFunction::DenseRank:
+    case WindowFunction::Count:
+      return false;
+    case WindowFunction::Lag:
+    case WindowFunction::Lead:
+      return true;
+    case WindowFunction::Min:
+    case WindowFunction::Max:
+    case WindowFunction::Sum:
+    case WindowFunction::Avg:
+      // The frame always contains the current row, so the result is only NULL if all values in it are NULL
+      return argument()->is_nullable();
+  }
+  Fail("GCC thinks this is reachable");
+}
+
+bool WindowFunctionExpression::_shallow_equals(const AbstractExpression& expression) const {
+  const auto& window_function_expression = static_cast<const WindowFunctionExpression&>(expression);
+  return window_function == window_function_expression.window_function &&
+         partition_by_count == window_function_expression.partition_by_count &&
+         order_by_modes == window_function_expression.order_by_modes &&
+         offset == window_function_expression.offset && _has_argument() == window_function_expression._has_argument();
+}
+
+size_t WindowFunctionExpression::_on_hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(window_function));
+  boost::hash_combine(hash, partition_by_count);
+  boost::hash_combine(hash, offset);
+  for (const auto order_by_mode : order_by_modes) {
+    boost::hash_combine(hash, static_cast<size_t>(order_by_mode));
+  }
+  return hash;
+}
+
+bool WindowFunctionExpression::_has_argument() const {
+  return arguments.size() > partition_by_count + order_by_modes.size();
+}
+
+}  // namespace opossum
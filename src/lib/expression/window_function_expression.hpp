@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class WindowFunction { RowNumber, Rank, DenseRank, Lag, Lead, Min, Max, Sum, Avg, Count };
+
+/**
+ * A window function, e.g., `RANK() OVER (PARTITION BY a ORDER BY b)` or `SUM(c) OVER (ORDER BY b)`.
+ *
+ * The arguments of the expression are the argument of the function (if it has one), followed by the PARTITION BY
+ * expressions and the ORDER BY expressions.
+ *
+ * The aggregate functions (MIN, MAX, SUM, AVG, COUNT) use the default frame of SQL: All rows of the partition up to
+ * the last row with the same ORDER BY values as the current row (RANGE BETWEEN UNBOUNDED PRECEDING AND CURRENT ROW),
+ * or the entire partition if there is no ORDER BY. LAG and LEAD return the argument `offset` rows before or after the
+ * current row within the partition, or NULL if there is no such row.
+ */
+class WindowFunctionExpression : public AbstractExpression {
+ public:
+  WindowFunctionExpression(const WindowFunction window_function, const std::shared_ptr<AbstractExpression>& argument,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& partition_by_expressions,
+                           const std::vector<std::shared_ptr<AbstractExpression>>& order_by_expressions,
+                           const std::vector<OrderByMode>& order_by_modes, const size_t offset = 1);
+
+  // nullptr for functions without an argument, e.g., RANK() or COUNT(*)
+  std::shared_ptr<AbstractExpression> argument() const;
+  std::vector<std::shared_ptr<AbstractExpression>> partition_by_expressions() const;
+  std::vector<std::shared_ptr<AbstractExpression>> order_by_expressions() const;
+
+  std::shared_ptr<AbstractExpression> deep_copy() const override;
+  std::string as_column_name() const override;
+  DataType data_type() const override;
+  bool is_nullable() const override;
+
+  const WindowFunction window_function;
+  const size_t partition_by_count;
+  const std::vector<OrderByMode> order_by_modes;
+
+  // The number of rows that LAG and LEAD look back or ahead
+  const size_t offset;
+
+ protected:
+  bool _shallow_equals(const AbstractExpression& expression) const override;
+  size_t _on_hash() const override;
+
+  bool _has_argument() const;
+};
+
+}  // namespace opossum
@@ -0,0 +1,398 @@
+#include "arrow_ipc_writer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Minimal FlatBuffers builder for the metadata of the Arrow IPC messages, which are FlatBuffers tables. Like the
+ * original builder, it writes the buffer back to front: Each object is written before the objects that reference it,
+ * so that the offsets point forward, as FlatBuffers requires. Positions of objects are counted from the end of the
+ * buffer until finish() is called.
+ */
+class FlatBufferBuilder {
+ public:
+  using Position = uint32_t;
+
+  struct Field {
+    uint16_t id;
+    std::vector<char> bytes;
+    size_t alignment;
+    // For fields that reference another object, which are written as an offset to that object
+    std::optional<Position> reference;
+  };
+
+  template <typename T>
+  static Field scalar(const uint16_t id, const T value) {
+    auto bytes = std::vector<char>(sizeof(T));
+    std::memcpy(bytes.data(), &value, sizeof(T));
+    return Field{id, std::move(bytes), sizeof(T), std::nullopt};
+  }
+
+  static Field reference(const uint16_t id, const Position position) {
+    return Field{id, std::vector<char>(sizeof(uint32_t)), sizeof(uint32_t), position};
+  }
+
+  Position add_string(const std::string& value) {
+    _pad(sizeof(uint32_t), value.size() + 1);
+    _prepend(value.c_str(), value.size() + 1);
+    _prepend_scalar(static_cast<uint32_t>(value.size()));
+    return _size();
+  }
+
+  // Vector of structs that consist of two int64 each, e.g., the FieldNodes and Buffers of a RecordBatch
+  Position add_struct_vector(const std::vector<std::array<int64_t, 2>>& structs) {
+    const auto struct_size = sizeof(std::array<int64_t, 2>);
+    _pad(alignof(int64_t), structs.size() * struct_size);
+    _prepend(reinterpret_cast<const char*>(structs.data()), structs.size() * struct_size);
+    _prepend_scalar(static_cast<uint32_t>(structs.size()));
+    return _size();
+  }
+
+  // Vector of references to tables, strings, or vectors
+  Position add_reference_vector(const std::vector<Position>& positions) {
+    _pad(sizeof(uint32_t), positions.size() * sizeof(uint32_t));
+    const auto elements_position = _size() + positions.size() * sizeof(uint32_t);
+    auto offsets = std::vector<uint32_t>(positions.size());
+    for (auto element_id = size_t{0}; element_id < positions.size(); ++element_id) {
+      offsets[element_id] =
+          static_cast<uint32_t>(elements_position - element_id * sizeof(uint32_t) - positions[element_id]);
+    }
+    _prepend(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(uint32_t));
+    _prepend_scalar(static_cast<uint32_t>(positions.size()));
+    return _size();
+  }
+
+  // Writes the table, which starts with the offset to its vtable, and the vtable right in front of it
+  Position add_table(const std::vector<Field>& fields) {
+    auto table_alignment = sizeof(int32_t);
+    auto table_size = sizeof(int32_t);
+    auto field_offsets = std::vector<size_t>(fields.size());
+    auto field_count = size_t{0};
+    for (auto field_index = size_t{0}; field_index < fields.size(); ++field_index) {
+      const auto& field = fields[field_index];
+      table_size = _round_up(table_size, field.alignment);
+      field_offsets[field_index] = table_size;
+      table_size += field.bytes.size();
+      table_alignment = std::max(table_alignment, field.alignment);
+      field_count = std::max(field_count, static_cast<size_t>(field.id) + 1);
+    }
+
+    _pad(table_alignment, table_size);
+    const auto table_position = static_cast<Position>(_size() + table_size);
+
+    auto vtable = std::vector<uint16_t>(2 + field_count);
+    vtable[0] = static_cast<uint16_t>(vtable.size() * sizeof(uint16_t));
+    vtable[1] = static_cast<uint16_t>(table_size);
+
+    auto table = std::vector<char>(table_size);
+    // The vtable directly precedes the table, as the table is 4-byte aligned and the vtable has an even size
+    const auto vtable_offset = static_cast<int32_t>(vtable[0]);
+    std::memcpy(table.data(), &vtable_offset, sizeof(int32_t));
+    for (auto field_index = size_t{0}; field_index < fields.size(); ++field_index) {
+      const auto& field = fields[field_index];
+      const auto field_offset = field_offsets[field_index];
+      vtable[2 + field.id] = static_cast<uint16_t>(field_offset);
+
+      if (field.reference) {
+        const auto offset = static_cast<uint32_t>(table_position - field_offset - *field.reference);
+        std::memcpy(table.data() + field_offset, &offset, sizeof(uint32_t));
+      } else {
+        std::memcpy(table.data() + field_offset, field.bytes.data(), field.bytes.size());
+      }
+    }
+
+    _prepend(table.data(), table.size());
+    _prepend(reinterpret_cast<const char*>(vtable.data()), vtable.size() * sizeof(uint16_t));
+    return table_position;
+  }
+
+  // Writes the offset to the root table and returns the buffer, whose size is a multiple of 8
+  std::vector<char> finish(const Position root) {
+    _pad(_max_alignment, sizeof(uint32_t));
+    _prepend_scalar(static_cast<uint32_t>(_size() + sizeof(uint32_t) - root));
+    return std::vector<char>(_buffer.cbegin(), _buffer.cend());
+  }
+
+ private:
+  static size_t _round_up(const size_t value, const size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+  }
+
+  size_t _size() const { return _buffer.size(); }
+
+  // Pads the buffer so that the object of @param object_size bytes that is written next starts aligned
+  void _pad(const size_t alignment, const size_t object_size) {
+    _max_alignment = std::max(_max_alignment, alignment);
+    const auto padding = _round_up(_size() + object_size, alignment) - (_size() + object_size);
+    _buffer.insert(_buffer.begin(), padding, '\0');
+  }
+
+  void _prepend(const char* bytes, const size_t size) { _buffer.insert(_buffer.begin(), bytes, bytes + size); }
+
+  template <typename T>
+  void _prepend_scalar(const T value) {
+    _prepend(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  // The metadata has a few hundred bytes per column, so prepending to a vector is cheap enough
+  std::vector<char> _buffer;
+  size_t _max_alignment = sizeof(uint64_t);
+};
+
+// Identifiers of the Arrow format (see Schema.fbs and Message.fbs of the Arrow project)
+constexpr auto METADATA_VERSION_V5 = int16_t{4};
+constexpr auto MESSAGE_HEADER_SCHEMA = uint8_t{1};
+constexpr auto MESSAGE_HEADER_RECORD_BATCH = uint8_t{3};
+constexpr auto TYPE_INT = uint8_t{2};
+constexpr auto TYPE_FLOATING_POINT = uint8_t{3};
+constexpr auto TYPE_UTF8 = uint8_t{5};
+constexpr auto PRECISION_SINGLE = int16_t{1};
+constexpr auto PRECISION_DOUBLE = int16_t{2};
+
+constexpr auto CONTINUATION_MARKER = uint32_t{0xFFFFFFFF};
+
+// Arrow requires the buffers to be aligned to 8 bytes
+constexpr auto BUFFER_ALIGNMENT = size_t{8};
+
+size_t padded_size(const size_t size) { return (size + BUFFER_ALIGNMENT - 1) / BUFFER_ALIGNMENT * BUFFER_ALIGNMENT; }
+
+void write_padding(std::ostream& stream, const size_t size) {
+  static constexpr char zeros[BUFFER_ALIGNMENT] = {};
+  stream.write(zeros, static_cast<std::streamsize>(padded_size(size) - size));
+}
+
+// Writes an encapsulated message, i.e., the continuation marker, the size of the metadata, and the metadata
+void write_message_metadata(std::ostream& stream, const std::vector<char>& metadata) {
+  const auto metadata_size = static_cast<int32_t>(padded_size(metadata.size()));
+  stream.write(reinterpret_cast<const char*>(&CONTINUATION_MARKER), sizeof(uint32_t));
+  stream.write(reinterpret_cast<const char*>(&metadata_size), sizeof(int32_t));
+  stream.write(metadata.data(), static_cast<std::streamsize>(metadata.size()));
+  write_padding(stream, metadata.size());
+}
+
+// A buffer of the body of a record batch. The write function writes exactly length bytes.
+struct BodyBuffer {
+  size_t length;
+  std::function<void(std::ostream&)> write;
+};
+
+struct ColumnBody {
+  int64_t null_count{0};
+  // Validity bitmap, offsets (for strings), and values
+  std::vector<BodyBuffer> buffers;
+};
+
+// Writes the values of a tbb::concurrent_vector, which stores them in several contiguous blocks, block by block
+template <typename T>
+void write_values(std::ostream& stream, const pmr_concurrent_vector<T>& values) {
+  auto block_begin = size_t{0};
+  for (auto index = size_t{1}; index <= values.size(); ++index) {
+    if (index < values.size() && &values[index] == &values[index - 1] + 1) continue;
+
+    stream.write(reinterpret_cast<const char*>(&values[block_begin]),
+                 static_cast<std::streamsize>((index - block_begin) * sizeof(T)));
+    block_begin = index;
+  }
+}
+
+BodyBuffer validity_buffer(const std::vector<bool>& nulls, const int64_t null_count) {
+  // Without nulls, the bitmap can be left out
+  if (null_count == 0) return BodyBuffer{0, [](std::ostream&) {}};
+
+  auto bitmap = std::vector<char>((nulls.size() + 7) / 8);
+  for (auto offset = size_t{0}; offset < nulls.size(); ++offset) {
+    if (!nulls[offset]) bitmap[offset / 8] |= static_cast<char>(1u << (offset % 8));
+  }
+  return BodyBuffer{bitmap.size(), [bitmap](std::ostream& stream) {
+                      stream.write(bitmap.data(), static_cast<std::streamsize>(bitmap.size()));
+                    }};
+}
+
+template <typename T>
+ColumnBody column_body(const BaseSegment& segment) {
+  auto body = ColumnBody{};
+
+  // The values of ValueSegments are written directly from the segment
+  if constexpr (!std::is_same_v<T, std::string>) {
+    if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment);
+        value_segment && !value_segment->is_nullable()) {
+      body.buffers.emplace_back(validity_buffer({}, 0));
+      body.buffers.emplace_back(BodyBuffer{value_segment->values().size() * sizeof(T), [value_segment](auto& stream) {
+                                             write_values(stream, value_segment->values());
+                                           }});
+      return body;
+    }
+  }
+
+  auto nulls = std::vector<bool>(segment.size());
+  auto values = std::vector<T>(segment.size());
+  auto offset = size_t{0};
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) {
+      nulls[offset] = true;
+      ++body.null_count;
+    } else {
+      values[offset] = position.value();
+    }
+    ++offset;
+  });
+
+  body.buffers.emplace_back(validity_buffer(nulls, body.null_count));
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Strings are stored as the concatenated characters and the offset of each string within them
+    auto offsets = std::vector<int32_t>(values.size() + 1);
+    auto characters = std::string{};
+    for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+      characters += values[value_index];
+      Assert(characters.size() <= static_cast<size_t>(std::numeric_limits<int32_t>::max()),
+             "Strings of a chunk exceed the 2 GB of an Arrow utf8 column");
+      offsets[value_index + 1] = static_cast<int32_t>(characters.size());
+    }
+
+    body.buffers.emplace_back(BodyBuffer{offsets.size() * sizeof(int32_t), [offsets](std::ostream& stream) {
+                                           stream.write(reinterpret_cast<const char*>(offsets.data()),
+                                                        static_cast<std::streamsize>(offsets.size() * sizeof(int32_t)));
+                                         }});
+    body.buffers.emplace_back(BodyBuffer{characters.size(), [characters](std::ostream& stream) {
+                                           stream.write(characters.data(),
+                                                        static_cast<std::streamsize>(characters.size()));
+                                         }});
+  } else {
+    body.buffers.emplace_back(BodyBuffer{values.size() * sizeof(T), [values](std::ostream& stream) {
+                                           stream.write(reinterpret_cast<const char*>(values.data()),
+                                                        static_cast<std::streamsize>(values.size() * sizeof(T)));
+                                         }});
+  }
+
+  return body;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ArrowIpcWriter::ArrowIpcWriter(const Table& table) : _table(table) {}
+
+void ArrowIpcWriter::write(const Table& table, std::ostream& stream) {
+  const auto writer = ArrowIpcWriter{table};
+  writer.write_schema(stream);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    writer.write_record_batch(chunk_id, stream);
+  }
+  write_end_of_stream(stream);
+}
+
+void ArrowIpcWriter::write_schema(std::ostream& stream) const {
+  auto builder = FlatBufferBuilder{};
+
+  auto fields = std::vector<FlatBufferBuilder::Position>{};
+  for (auto column_id = ColumnID{0}; column_id < _table.column_count(); ++column_id) {
+    auto type_type = uint8_t{};
+    auto type = FlatBufferBuilder::Position{};
+    switch (_table.column_data_type(column_id)) {
+      case DataType::Int:
+      case DataType::Long:
+        type_type = TYPE_INT;
+        type = builder.add_table(
+            {FlatBufferBuilder::scalar(0, int32_t{_table.column_data_type(column_id) == DataType::Int ? 32 : 64}),
+             FlatBufferBuilder::scalar(1, uint8_t{1})});
+        break;
+      case DataType::Float:
+      case DataType::Double:
+        type_type = TYPE_FLOATING_POINT;
+        type = builder.add_table({FlatBufferBuilder::scalar(
+            0, _table.column_data_type(column_id) == DataType::Float ? PRECISION_SINGLE : PRECISION_DOUBLE)});
+        break;
+      case DataType::String:
+        type_type = TYPE_UTF8;
+        type = builder.add_table({});
+        break;
+      default:
+        Fail("Column type cannot be written to Arrow");
+    }
+
+    // Arrow readers expect the children of each field, even if there are none
+    const auto children = builder.add_reference_vector({});
+    const auto name = builder.add_string(_table.column_name(column_id));
+    fields.emplace_back(builder.add_table({FlatBufferBuilder::reference(0, name),
+                                           FlatBufferBuilder::scalar(1, uint8_t{_table.column_is_nullable(column_id)}),
+                                           FlatBufferBuilder::scalar(2, type_type),
+                                           FlatBufferBuilder::reference(3, type),
+                                           FlatBufferBuilder::reference(5, children)}));
+  }
+
+  const auto schema = builder.add_table({FlatBufferBuilder::reference(1, builder.add_reference_vector(fields))});
+  const auto message = builder.add_table(
+      {FlatBufferBuilder::scalar(3, int64_t{0}), FlatBufferBuilder::scalar(0, METADATA_VERSION_V5),
+       FlatBufferBuilder::reference(2, schema), FlatBufferBuilder::scalar(1, MESSAGE_HEADER_SCHEMA)});
+
+  write_message_metadata(stream, builder.finish(message));
+}
+
+void ArrowIpcWriter::write_record_batch(const ChunkID chunk_id, std::ostream& stream) const {
+  const auto chunk = _table.get_chunk(chunk_id);
+  const auto row_count = static_cast<int64_t>(chunk->size());
+
+  auto nodes = std::vector<std::array<int64_t, 2>>{};
+  auto buffers = std::vector<BodyBuffer>{};
+  auto buffer_descriptions = std::vector<std::array<int64_t, 2>>{};
+  auto body_length = size_t{0};
+
+  for (auto column_id = ColumnID{0}; column_id < _table.column_count(); ++column_id) {
+    resolve_data_type(_table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto column = column_body<ColumnDataType>(*chunk->get_segment(column_id));
+      nodes.push_back({row_count, column.null_count});
+      for (auto& buffer : column.buffers) {
+        buffer_descriptions.push_back({static_cast<int64_t>(body_length), static_cast<int64_t>(buffer.length)});
+        body_length += padded_size(buffer.length);
+        buffers.emplace_back(std::move(buffer));
+      }
+    });
+  }
+
+  auto builder = FlatBufferBuilder{};
+  const auto buffers_position = builder.add_struct_vector(buffer_descriptions);
+  const auto nodes_position = builder.add_struct_vector(nodes);
+  const auto record_batch =
+      builder.add_table({FlatBufferBuilder::scalar(0, row_count), FlatBufferBuilder::reference(1, nodes_position),
+                         FlatBufferBuilder::reference(2, buffers_position)});
+  const auto message = builder.add_table(
+      {FlatBufferBuilder::scalar(3, static_cast<int64_t>(body_length)),
+       FlatBufferBuilder::scalar(0, METADATA_VERSION_V5), FlatBufferBuilder::reference(2, record_batch),
+       FlatBufferBuilder::scalar(1, MESSAGE_HEADER_RECORD_BATCH)});
+
+  write_message_metadata(stream, builder.finish(message));
+
+  for (const auto& buffer : buffers) {
+    buffer.write(stream);
+    write_padding(stream, buffer.length);
+  }
+}
+
+void ArrowIpcWriter::write_end_of_stream(std::ostream& stream) {
+  const auto end_of_stream = std::array<uint32_t, 2>{CONTINUATION_MARKER, 0};
+  stream.write(reinterpret_cast<const char*>(end_of_stream.data()), sizeof(end_of_stream));
+}
+
+}  // namespace opossum
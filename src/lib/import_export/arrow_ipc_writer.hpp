@@ -0,0 +1,35 @@
+#pragma once
+
+#include <ostream>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Writes tables in the Arrow IPC streaming format (https://arrow.apache.org/docs/format/Columnar.html), which pandas,
+ * Spark, and other columnar tools read without converting rows into columns. The stream consists of a schema message,
+ * one record batch per chunk, and the end-of-stream marker, so that it can be sent chunk by chunk.
+ *
+ * Int, Long, Float, Double, and String columns become int32, int64, float32, float64, and utf8 columns. The values of
+ * ValueSegments are written as they are stored, other segments are decoded first. Nulls are marked in validity
+ * bitmaps, which are left out for columns without nulls.
+ */
+class ArrowIpcWriter {
+ public:
+  explicit ArrowIpcWriter(const Table& table);
+
+  // Writes the complete stream of @param table
+  static void write(const Table& table, std::ostream& stream);
+
+  void write_schema(std::ostream& stream) const;
+  void write_record_batch(const ChunkID chunk_id, std::ostream& stream) const;
+  static void write_end_of_stream(std::ostream& stream);
+
+ private:
+  const Table& _table;
+};
+
+}  // namespace opossum
@@ -1,9 +1,22 @@
 #pragma once
 
+#include "types.hpp"
+
 namespace opossum {
 
-enum class BinarySegmentType : uint8_t { value_segment = 0, dictionary_segment = 1 };
+enum class BinarySegmentType : uint8_t {
+  value_segment = 0,
+  dictionary_segment = 1,
+  frame_of_reference_segment = 2,
+  run_length_segment = 3,
+  fixed_string_dictionary_segment = 4,
+  lz4_segment = 5,
+  delta_segment = 6
+};
 
 using BoolAsByteType = uint8_t;
 
+// Stored instead of the width of a fixed-size byte-aligned vector to mark a SIMD-BP128-compressed vector
+constexpr AttributeVectorWidth SIMD_BP128_VECTOR_WIDTH{16};
+
 }  // namespace opossum
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "constant_mappings.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -53,6 +54,19 @@ void from_json(const nlohmann::json& json, CsvMeta& meta) {
       column_meta.name = column.at("name");
       column_meta.type = column.at("type");
       assign_if_exists(column_meta.nullable, column, "nullable");
+      if (column.find("encoding") != column.end()) {
+        const auto encoding_type = encoding_type_to_string.right.find(column.at("encoding").get<std::string>());
+        Assert(encoding_type != encoding_type_to_string.right.end(), "CSV meta file: Unknown encoding.");
+        column_meta.encoding = SegmentEncodingSpec{encoding_type->second};
+
+        if (column.find("vector_compression") != column.end()) {
+          const auto vector_compression_type =
+              vector_compression_type_to_string.right.find(column.at("vector_compression").get<std::string>());
+          Assert(vector_compression_type != vector_compression_type_to_string.right.end(),
+                 "CSV meta file: Unknown vector compression.");
+          column_meta.encoding->vector_compression_type = vector_compression_type->second;
+        }
+      }
       meta.columns.push_back(column_meta);
     }
   }
@@ -72,15 +86,28 @@ void to_json(nlohmann::json& json, const CsvMeta& meta) {
 
   auto columns = nlohmann::json::parse("[]");
   for (const auto& column_meta : meta.columns) {
-    columns.emplace_back(
-        nlohmann::json{{"name", column_meta.name}, {"type", column_meta.type}, {"nullable", column_meta.nullable}});
+    auto column =
+        nlohmann::json{{"name", column_meta.name}, {"type", column_meta.type}, {"nullable", column_meta.nullable}};
+    if (column_meta.encoding) {
+      column["encoding"] = encoding_type_to_string.left.at(column_meta.encoding->encoding_type);
+      if (column_meta.encoding->vector_compression_type) {
+        column["vector_compression"] =
+            vector_compression_type_to_string.left.at(*column_meta.encoding->vector_compression_type);
+      }
+    }
+    columns.emplace_back(column);
   }
 
   json = nlohmann::json{{"config", config}, {"columns", columns}};
 }
 
 bool operator==(const ColumnMeta& left, const ColumnMeta& right) {
-  return std::tie(left.name, left.type, left.nullable) == std::tie(right.name, right.type, right.nullable);
+  const auto encodings_are_equal =
+      left.encoding.has_value() == right.encoding.has_value() &&
+      (!left.encoding || (left.encoding->encoding_type == right.encoding->encoding_type &&
+                          left.encoding->vector_compression_type == right.encoding->vector_compression_type));
+  return std::tie(left.name, left.type, left.nullable) == std::tie(right.name, right.type, right.nullable) &&
+         encodings_are_equal;
 }
 
 bool operator==(const ParseConfig& left, const ParseConfig& right) {
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "json.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -13,6 +15,9 @@ struct ColumnMeta {
   std::string type;
 
   bool nullable = false;
+
+  // If set, the chunks of the column are encoded with this encoding while they are imported
+  std::optional<SegmentEncodingSpec> encoding;
 };
 
 struct ParseConfig {
@@ -38,7 +43,7 @@ struct ParseConfig {
  * Meta information for a CSV table:
  *
  * config        characters and options that specify how the CSV should be parsed (delimiter, separator, etc.)
- * columns       column meta information (name, type, nullable) for each column
+ * columns       column meta information (name, type, nullable, optional encoding) for each column
  */
 struct CsvMeta {
   ParseConfig config;
@@ -0,0 +1,327 @@
+#include "csv_meta_inference.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "import_export/csv_converter.hpp"
+#include "import_export/file_block_reader.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_encoding_selection.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The sample consists of up to SAMPLE_BLOCK_COUNT blocks of up to SAMPLE_BLOCK_SIZE bytes each
+constexpr auto SAMPLE_BLOCK_COUNT = size_t{16};
+constexpr auto SAMPLE_BLOCK_SIZE = size_t{1} * 1024 * 1024;
+
+// The row that starts at the end of a block is completed from up to this many bytes after the block
+constexpr auto MAX_ROW_TAIL_SIZE = size_t{64} * 1024;
+
+// Floats represent decimal numbers with up to six significant digits and integers up to 2^24 without rounding
+constexpr auto FLOAT_SIGNIFICANT_DIGITS = size_t{6};
+constexpr auto FLOAT_MAX_EXACT_INTEGER = int64_t{1} << 24;
+
+// The fields of a sampled row as they appear in the file, i.e., quoted fields keep their quotes
+using SampledRow = std::vector<std::string>;
+
+/**
+ * Splits the rows that start in [first_row_begin, owned_end) of text into fields, like CsvParser does. A row that is
+ * not complete at the end of text is only kept if text is the end of the file.
+ */
+std::vector<SampledRow> split_rows(const std::string_view text, const size_t first_row_begin, const size_t owned_end,
+                                   const bool text_ends_file, const ParseConfig& config) {
+  auto rows = std::vector<SampledRow>{};
+  auto row = SampledRow{};
+  auto row_begin = first_row_begin;
+  auto field_begin = first_row_begin;
+  auto in_quotes = false;
+
+  for (auto position = first_row_begin; position < text.size() && row_begin < owned_end; ++position) {
+    const auto character = text[position];
+
+    // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
+    if (character == config.quote) {
+      const auto quote_is_escaped =
+          config.quote != config.escape && position != 0 && text[position - 1] == config.escape;
+      if (!quote_is_escaped) in_quotes = !in_quotes;
+      continue;
+    }
+    if (in_quotes) continue;
+
+    if (character == config.separator || character == config.delimiter) {
+      row.emplace_back(text.substr(field_begin, position - field_begin));
+      field_begin = position + 1;
+    }
+    if (character == config.delimiter) {
+      rows.emplace_back(std::move(row));
+      row = SampledRow{};
+      row_begin = field_begin;
+    }
+  }
+
+  // The last row of a file does not need to end with a delimiter
+  if (text_ends_file && !in_quotes && row_begin < std::min(text.size(), owned_end)) {
+    row.emplace_back(text.substr(field_begin));
+    rows.emplace_back(std::move(row));
+  }
+
+  return rows;
+}
+
+/**
+ * Samples blocks of the content, which is read by read_content(offset, length). Each block is read and split into rows
+ * by its own JobTask. Returns the rows of all blocks in the order of the content.
+ */
+std::vector<SampledRow> sample_rows(const std::function<std::string(size_t, size_t)>& read_content,
+                                    const size_t content_size, const bool content_ends_file,
+                                    const ParseConfig& config) {
+  // Small contents are split into SAMPLE_BLOCK_COUNT blocks and sampled completely
+  const auto block_distance = std::max(size_t{1}, (content_size + SAMPLE_BLOCK_COUNT - 1) / SAMPLE_BLOCK_COUNT);
+  const auto block_size = std::min(block_distance, SAMPLE_BLOCK_SIZE);
+
+  auto rows_by_block = std::vector<std::vector<SampledRow>>(SAMPLE_BLOCK_COUNT);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto block_id = size_t{0}; block_id < SAMPLE_BLOCK_COUNT; ++block_id) {
+    const auto block_begin = block_id * block_distance;
+    if (block_begin >= content_size) break;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, block_id, block_begin]() {
+      // The character before the block tells whether a row starts at the beginning of the block
+      const auto read_begin = block_begin == 0 ? size_t{0} : block_begin - 1;
+      const auto read_end = std::min(block_begin + block_size + MAX_ROW_TAIL_SIZE, content_size);
+      const auto text = read_content(read_begin, read_end - read_begin);
+
+      auto first_row_begin = size_t{0};
+      if (block_begin != 0) {
+        const auto delimiter_position = text.find(config.delimiter);
+        if (delimiter_position == std::string::npos) return;
+        first_row_begin = delimiter_position + 1;
+      }
+
+      const auto owned_end = block_begin + block_size - read_begin;
+      const auto text_ends_file = content_ends_file && read_end == content_size;
+      rows_by_block[block_id] = split_rows(text, first_row_begin, owned_end, text_ends_file, config);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto rows = std::vector<SampledRow>{};
+  for (auto& block_rows : rows_by_block) {
+    std::move(block_rows.begin(), block_rows.end(), std::back_inserter(rows));
+  }
+  return rows;
+}
+
+size_t significant_digit_count(const std::string& value) {
+  const auto mantissa = value.substr(0, value.find_first_of("eE"));
+
+  auto digits = std::string{};
+  for (const auto character : mantissa) {
+    if (std::isdigit(static_cast<unsigned char>(character)) && (!digits.empty() || character != '0')) {
+      digits.push_back(character);
+    }
+  }
+
+  // Trailing zeros only scale the value, which the exponent of the float takes care of
+  while (!digits.empty() && digits.back() == '0') digits.pop_back();
+  return digits.size();
+}
+
+/**
+ * Inspects the sampled values of a column and keeps track of the types that all of them fit into.
+ */
+struct ColumnInference {
+  void add(std::string value, const ParseConfig& config) {
+    if (value.empty() || (!config.reject_null_strings && boost::to_lower_copy(value) == ParseConfig::NULL_STRING)) {
+      is_nullable = true;
+      return;
+    }
+
+    has_values = true;
+    if (value.front() == config.quote) {
+      // Like CsvConverter, non-string columns only accept quoted values if reject_quoted_nonstrings is not set
+      if (config.reject_quoted_nonstrings) {
+        fits_double = false;
+        return;
+      }
+      BaseCsvConverter::unescape(value, config);
+      if (value.empty()) {
+        fits_double = false;
+        return;
+      }
+    }
+
+    // Words like "nan" or "inf" are accepted by std::stod, but are more likely strings
+    const auto first_character = value.front();
+    if (!std::isdigit(static_cast<unsigned char>(first_character)) && first_character != '-' &&
+        first_character != '+' && first_character != '.') {
+      fits_double = false;
+      return;
+    }
+
+    char* end = nullptr;
+    errno = 0;
+    const auto integer = std::strtoll(value.c_str(), &end, 10);
+    if (errno == 0 && end == value.c_str() + value.size()) {
+      fits_int &= integer >= std::numeric_limits<int32_t>::min() && integer <= std::numeric_limits<int32_t>::max();
+      fits_float &= integer >= -FLOAT_MAX_EXACT_INTEGER && integer <= FLOAT_MAX_EXACT_INTEGER;
+      return;
+    }
+
+    fits_int = false;
+    fits_long = false;
+
+    errno = 0;
+    const auto decimal = std::strtod(value.c_str(), &end);
+    if (errno != 0 || end != value.c_str() + value.size() || !std::isfinite(decimal)) {
+      fits_double = false;
+      return;
+    }
+
+    const auto magnitude = std::abs(decimal);
+    fits_float &= significant_digit_count(value) <= FLOAT_SIGNIFICANT_DIGITS &&
+                  (magnitude == 0.0 || (magnitude >= std::numeric_limits<float>::min() &&
+                                        magnitude <= std::numeric_limits<float>::max()));
+  }
+
+  DataType data_type() const {
+    if (!has_values || !fits_double) return DataType::String;
+    if (fits_int) return DataType::Int;
+    if (fits_long) return DataType::Long;
+    return fits_float ? DataType::Float : DataType::Double;
+  }
+
+  bool is_nullable{false};
+  bool has_values{false};
+  bool fits_int{true};
+  bool fits_long{true};
+  bool fits_float{true};
+  bool fits_double{true};
+};
+
+/**
+ * Converts the sampled values of a column into a ValueSegment and selects an encoding for it.
+ */
+template <typename T>
+SegmentEncodingSpec select_encoding(const std::vector<SampledRow>& rows, const ColumnID column_id,
+                                    const ColumnMeta& column_meta, const ParseConfig& config) {
+  auto values = std::vector<T>{};
+  auto null_values = std::vector<bool>{};
+  for (const auto& row : rows) {
+    auto value = row[column_id];
+    const auto is_null =
+        value.empty() || (!config.reject_null_strings && boost::to_lower_copy(value) == ParseConfig::NULL_STRING);
+    null_values.push_back(is_null);
+    if (is_null) {
+      values.emplace_back();
+      continue;
+    }
+
+    BaseCsvConverter::unescape(value, config);
+    if constexpr (std::is_same_v<T, std::string>) {
+      values.emplace_back(std::move(value));
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+      values.emplace_back(std::stoi(value));
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+      values.emplace_back(std::stoll(value));
+    } else if constexpr (std::is_same_v<T, float>) {
+      values.emplace_back(std::stof(value));
+    } else {
+      values.emplace_back(std::stod(value));
+    }
+  }
+
+  const auto segment = column_meta.nullable
+                           ? std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values))
+                           : std::make_shared<ValueSegment<T>>(std::move(values));
+  return select_segment_encoding_spec(data_type_from_type<T>(), segment);
+}
+
+}  // namespace
+
+namespace opossum {
+
+CsvMeta infer_csv_meta(const std::string& filename, const ParseConfig& config,
+                       const std::vector<std::string>& column_names) {
+  auto rows = std::vector<SampledRow>{};
+
+  auto file = FileBlockReader{filename};
+  if (file.compression() == FileCompression::None) {
+    // Each task reads its block through its own stream
+    const auto read_content = [&](const size_t offset, const size_t length) {
+      auto stream = std::ifstream{filename, std::ios::binary};
+      stream.seekg(static_cast<std::streamoff>(offset));
+      auto text = std::string(length, '\0');
+      stream.read(text.data(), static_cast<std::streamsize>(length));
+      text.resize(static_cast<size_t>(stream.gcount()));
+      return text;
+    };
+    rows = sample_rows(read_content, std::filesystem::file_size(filename), true, config);
+  } else {
+    auto content = std::string{};
+    const auto content_ends_file = !file.read_block(content, SAMPLE_BLOCK_COUNT * SAMPLE_BLOCK_SIZE);
+    const auto read_content = [&](const size_t offset, const size_t length) { return content.substr(offset, length); };
+    rows = sample_rows(read_content, content.size(), content_ends_file, config);
+  }
+
+  Assert(!rows.empty(), "Cannot infer the meta information of " + filename + " as it does not contain any rows");
+
+  // Rows of blocks that start within a quoted field are split at the wrong positions, so only the rows with the
+  // number of fields of the first row are used
+  const auto column_count = rows.front().size();
+  rows.erase(std::remove_if(rows.begin(), rows.end(), [&](const auto& row) { return row.size() != column_count; }),
+             rows.end());
+
+  Assert(column_names.empty() || column_names.size() == column_count,
+         "Expected " + std::to_string(column_count) + " column names for " + filename);
+
+  auto meta = CsvMeta{};
+  meta.config = config;
+  meta.columns.resize(column_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      auto inference = ColumnInference{};
+      for (const auto& row : rows) {
+        inference.add(row[column_id], config);
+      }
+
+      auto& column_meta = meta.columns[column_id];
+      column_meta.name = column_names.empty() ? "column_" + std::to_string(column_id) : column_names[column_id];
+      column_meta.type = data_type_to_string.left.at(inference.data_type());
+      column_meta.nullable = inference.is_nullable;
+
+      resolve_data_type(inference.data_type(), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        column_meta.encoding = select_encoding<ColumnDataType>(rows, column_id, column_meta, config);
+      });
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return meta;
+}
+
+}  // namespace opossum
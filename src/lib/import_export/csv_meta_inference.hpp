@@ -0,0 +1,30 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "import_export/csv_meta.hpp"
+
+namespace opossum {
+
+/*
+ * Infers the meta information of a csv file for which no meta file exists. A few blocks of the file are sampled and
+ * split into rows by parallel JobTasks, then each column is inspected by its own JobTask. Blocks of uncompressed files
+ * are spread over the entire file. Compressed files (see FileBlockReader) cannot be read from an arbitrary position,
+ * so their sample is taken from the beginning.
+ *
+ * For each column, the narrowest type that all sampled values fit into is chosen, in the order int, long, float,
+ * double, string. Decimal numbers are only stored as floats if they have at most six significant digits, which a
+ * float represents without rounding. A column is nullable if the sample contains an empty field. The encoding of a
+ * column is chosen based on the sampled values, as for EncodingType::Auto (see segment_encoding_selection.hpp).
+ *
+ * As only a sample is inspected, a value in the remaining file might not fit the inferred type or nullability. The
+ * import fails in this case, and the meta file can be corrected by hand.
+ *
+ * The csv files do not have a header row, so the columns are named column_0, column_1, ... unless column_names are
+ * given.
+ */
+CsvMeta infer_csv_meta(const std::string& filename, const ParseConfig& config = {},
+                       const std::vector<std::string>& column_names = {});
+
+}  // namespace opossum
@@ -1,19 +1,26 @@
 #include "csv_parser.hpp"
 
 #include <boost/algorithm/string/trim.hpp>
+#include <algorithm>
+#include <deque>
+#include <filesystem>
 #include <fstream>
 #include <functional>
+#include <iomanip>
 #include <list>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "constant_mappings.hpp"
 #include "import_export/csv_converter.hpp"
 #include "import_export/csv_meta.hpp"
+#include "import_export/csv_meta_inference.hpp"
+#include "import_export/file_block_reader.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
@@ -25,69 +32,163 @@
 
 namespace opossum {
 
+CsvParser::CsvParser(const size_t block_size) : _block_size(block_size) {}
+
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const std::optional<CsvMeta>& csv_meta,
-                                        const ChunkOffset chunk_size) {
-  // If no meta info is given as a parameter, look for a json file
+                                        const ChunkOffset chunk_size,
+                                        const std::optional<ChunkEncodingSpec>& encoding_spec) {
+  // If no meta info is given as a parameter, look for a json file. If there is none, infer the meta info from the csv
+  // file and write it, so that it does not have to be inferred again and can be corrected if needed.
   if (csv_meta == std::nullopt) {
-    _meta = process_csv_meta_file(filename + CsvMeta::META_FILE_EXTENSION);
+    const auto meta_filename = filename + CsvMeta::META_FILE_EXTENSION;
+    if (std::filesystem::exists(meta_filename)) {
+      _meta = process_csv_meta_file(meta_filename);
+    } else {
+      _meta = infer_csv_meta(filename);
+      nlohmann::json meta_json = _meta;
+      std::ofstream meta_file_stream(meta_filename);
+      meta_file_stream << std::setw(4) << meta_json << std::endl;
+    }
   } else {
     _meta = *csv_meta;
   }
 
+  // Without an explicit encoding spec, the encodings of the meta info are used
+  auto chunk_encoding_spec = encoding_spec;
+  const auto meta_has_encodings = std::any_of(_meta.columns.cbegin(), _meta.columns.cend(),
+                                              [](const auto& column_meta) { return column_meta.encoding.has_value(); });
+  if (!chunk_encoding_spec && meta_has_encodings) {
+    chunk_encoding_spec.emplace();
+    for (const auto& column_meta : _meta.columns) {
+      chunk_encoding_spec->emplace_back(column_meta.encoding.value_or(SegmentEncodingSpec{EncodingType::Unencoded}));
+    }
+  }
+
   _escaped_linebreak = std::string(1, _meta.config.delimiter_escape) + std::string(1, _meta.config.delimiter);
 
   auto table = _create_table_from_meta(chunk_size);
 
-  std::ifstream csvfile{filename};
+  // Compressed files are decompressed while they are read, so that decompressing the next block overlaps with parsing
+  // the previous ones
+  FileBlockReader file{filename};
 
   // return empty table if input file is empty
-  if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') return table;
-
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
-
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != _meta.config.delimiter) content.push_back(_meta.config.delimiter);
-
-  std::string_view content_view{content.c_str(), content.size()};
-
-  // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
-  std::vector<std::shared_ptr<AbstractTask>> tasks;
+  auto first_block = std::string{};
+  auto has_more_blocks = file.read_block(first_block, _block_size);
+  if (first_block.empty() || first_block.front() == '\r' || first_block.front() == '\n') return table;
+
+  const auto read_block = [&](std::string& content) {
+    if (!first_block.empty()) {
+      content += first_block;
+      first_block.clear();
+      return has_more_blocks;
+    }
+    return file.read_block(content, _block_size);
+  };
+
+  _parse_into_table(read_block, *table, chunk_encoding_spec);
+
+  return table;
+}
+
+std::shared_ptr<Table> CsvParser::parse_content(std::string content, const CsvMeta& csv_meta,
+                                                const ChunkOffset chunk_size) {
+  _meta = csv_meta;
+  _escaped_linebreak = std::string(1, _meta.config.delimiter_escape) + std::string(1, _meta.config.delimiter);
+
+  auto table = _create_table_from_meta(chunk_size);
+
+  // Same as for files, there are no rows if the content is empty or starts with an empty line
+  if (content.empty() || content.front() == '\r' || content.front() == '\n') return table;
+
+  // The content is already in memory, so it is passed as a single block
+  const auto read_block = [&](std::string& block) {
+    block = std::move(content);
+    return false;
+  };
+
+  _parse_into_table(read_block, *table, std::nullopt);
+
+  return table;
+}
+
+void CsvParser::_parse_into_table(const std::function<bool(std::string&)>& read_block, Table& table,
+                                  const std::optional<ChunkEncodingSpec>& encoding_spec) {
+  // The chunks that are being parsed, in the order of the content. A deque keeps the references to its elements valid
+  // when elements are added or removed at its ends.
+  struct PendingChunk {
+    std::shared_ptr<AbstractTask> task;
+    std::shared_ptr<Chunk> chunk;
+  };
+  std::deque<PendingChunk> pending_chunks;
+  const auto max_pending_chunks = std::max(size_t{2}, size_t{2} * std::thread::hardware_concurrency());
+
+  const auto append_first_pending_chunk = [&]() {
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{pending_chunks.front().task});
+    table.append_chunk(pending_chunks.front().chunk);
+    pending_chunks.pop_front();
+  };
+
+  // The content that has been read, of which everything before content_offset has been handed to the parsing tasks
+  auto content = std::string{};
+  auto content_offset = size_t{0};
+  auto content_is_complete = false;
+  const auto column_data_types = table.column_data_types();
+
   std::vector<size_t> field_ends;
-  while (_find_fields_in_chunk(content_view, *table, field_ends)) {
-    // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
+  while (true) {
+    const auto content_view = std::string_view{content}.substr(content_offset);
+    const auto fields_found = _find_fields_in_chunk(content_view, table, field_ends);
+
+    // Unless the content is complete, the chunk is only complete if it has the maximum number of rows. Otherwise, its
+    // last row might continue in the next block.
+    const auto chunk_is_full = table.max_chunk_size() != 0 && !field_ends.empty() &&
+                               field_ends.size() == size_t{table.max_chunk_size()} * table.column_count();
+    if (!fields_found || (!chunk_is_full && !content_is_complete)) {
+      if (content_is_complete) break;
+
+      // Drop the content that has been handed to the parsing tasks and read the next block
+      content.erase(0, content_offset);
+      content_offset = 0;
+      content_is_complete = !read_block(content);
+
+      // make sure content ends with a delimiter for better row processing later
+      if (content_is_complete && !content.empty() && content.back() != _meta.config.delimiter) {
+        content.push_back(_meta.config.delimiter);
+      }
+      continue;
+    }
 
-    // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
+    Assert(!field_ends.empty(), "CSV content ends within a quoted field.");
 
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
+    // Only pass the part of the string that is actually needed to the parsing task. It is copied, so that the content
+    // can be dropped while the chunk is parsed.
+    const auto chunk_content = std::make_shared<std::string>(content_view.substr(0, field_ends.back()));
+    content_offset += field_ends.back() + 1;
 
     // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([this, relevant_content, field_ends, &table, &segments]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments);
-    }));
-    tasks.back()->schedule();
+    pending_chunks.emplace_back();
+    auto& chunk = pending_chunks.back().chunk;
+    pending_chunks.back().task = std::make_shared<JobTask>(
+        [this, chunk_content, field_ends, &table, &chunk, &column_data_types, &encoding_spec]() {
+          auto segments = Segments{};
+          const auto row_count = _parse_into_chunk(*chunk_content, field_ends, table, segments);
+
+          chunk = std::make_shared<Chunk>(segments, std::make_shared<MvccData>(row_count));
+          if (encoding_spec) ChunkEncoder::encode_chunk(chunk, column_data_types, *encoding_spec);
+        });
+    pending_chunks.back().task->schedule();
+
+    // Append the completed chunks, waiting for the oldest one if too many chunks are being parsed
+    while (!pending_chunks.empty() &&
+           (pending_chunks.size() > max_pending_chunks || pending_chunks.front().task->is_done())) {
+      append_first_pending_chunk();
+    }
   }
 
-  CurrentScheduler::wait_for_tasks(tasks);
-
-  for (auto& segments : segments_by_chunks) {
-    table->append_chunk(segments);
+  while (!pending_chunks.empty()) {
+    append_first_pending_chunk();
   }
-
-  return table;
 }
 
 std::shared_ptr<Table> CsvParser::create_table_from_meta_file(const std::string& filename,
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -7,6 +8,7 @@
 #include <vector>
 
 #include "import_export/csv_meta.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -20,27 +22,58 @@ class Chunk;
  * The files are parsed according to RFC 4180 if not otherwise specified. [https://tools.ietf.org/html/rfc4180]
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
+ * If the meta file does not exist, the meta information is inferred from a sample of the file (see
+ * csv_meta_inference.hpp) and written to the meta file. Encodings in the meta information are applied unless an
+ * encoding spec is passed.
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * The file is read in blocks, so that files larger than the memory can be imported. The parser separates the data into
+ * chunks that are aligned with the csv rows, while the previous chunks are parsed and converted into opossum chunks by
+ * JobTasks. The chunks are appended to the table in the order of the file as soon as they are complete. As only a few
+ * chunks are parsed at the same time, the memory needed besides the table is bounded by a few chunks and blocks.
+ *
+ * Files compressed with gzip or zstd are decompressed block by block while they are read (see FileBlockReader).
  */
 class CsvParser {
  public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024 * 1024;
+
+  // @param block_size  The number of bytes that are read from the file at once
+  explicit CsvParser(const size_t block_size = DEFAULT_BLOCK_SIZE);
+
   // cannot move-assign because of const members
   CsvParser& operator=(CsvParser&&) = delete;
 
   /*
    * @param filename      Path to the input file.
    * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
+   * @param encoding_spec If set, each chunk is encoded by the task that parsed it, so that the ValueSegments of only a
+   *                      few chunks are in memory at the same time and no separate encoding pass is needed.
    * @returns             The table that was created from the csv file.
    */
   std::shared_ptr<Table> parse(const std::string& filename, const std::optional<CsvMeta>& csv_meta = std::nullopt,
-                               const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
+                               const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
+                               const std::optional<ChunkEncodingSpec>& encoding_spec = std::nullopt);
   std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                      const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
+  /*
+   * @param content       CSV data that is not stored in a file, e.g., because a client sent it.
+   * @param csv_meta      Meta information, including the columns of the resulting table.
+   * @returns             The table that was created from the csv content.
+   */
+  std::shared_ptr<Table> parse_content(std::string content, const CsvMeta& csv_meta,
+                                       const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
+
  protected:
+  /*
+   * Parses the chunks of the CSV content in parallel and appends them to the table. Expects _meta to be set.
+   *
+   * @param read_block    Appends the next block of the content to the given string. Returns false if the content has
+   *                      ended.
+   */
+  void _parse_into_table(const std::function<bool(std::string&)>& read_block, Table& table,
+                         const std::optional<ChunkEncodingSpec>& encoding_spec);
+
   /*
    * Use the meta information stored in _meta to create a new table with according column description.
    */
@@ -74,5 +107,7 @@ class CsvParser {
   CsvMeta _meta;
 
   std::string _escaped_linebreak;
+
+  const size_t _block_size;
 };
 }  // namespace opossum
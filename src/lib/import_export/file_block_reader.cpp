@@ -0,0 +1,181 @@
+#include "file_block_reader.hpp"
+
+#include <zlib.h>
+
+#if HYRISE_ZSTD_SUPPORT
+#include <zstd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// The compressed input is read in blocks of this size
+constexpr auto INPUT_BLOCK_SIZE = size_t{4} * 1024 * 1024;
+
+constexpr auto GZIP_MAGIC = std::array<unsigned char, 2>{0x1F, 0x8B};
+constexpr auto ZSTD_MAGIC = std::array<unsigned char, 4>{0x28, 0xB5, 0x2F, 0xFD};
+
+}  // namespace
+
+namespace opossum {
+
+class BaseFileDecompressor {
+ public:
+  virtual ~BaseFileDecompressor() = default;
+
+  // Decompresses from [input, input_end) into [output, output_end) and advances input and output
+  virtual void decompress(const char*& input, const char* const input_end, char*& output, char* const output_end) = 0;
+
+  // Whether the decompressed data ended with the last call, i.e., the input is not truncated if it ends here
+  virtual bool is_at_end() const = 0;
+};
+
+namespace {
+
+class GzipDecompressor : public BaseFileDecompressor {
+ public:
+  GzipDecompressor() {
+    // 16 + MAX_WBITS makes zlib expect a gzip header instead of a zlib header
+    Assert(inflateInit2(&_stream, 16 + MAX_WBITS) == Z_OK, "Could not initialize gzip decompression");
+  }
+
+  ~GzipDecompressor() override { inflateEnd(&_stream); }
+
+  void decompress(const char*& input, const char* const input_end, char*& output, char* const output_end) override {
+    // The input continues after the end of a gzip member, so the next member follows
+    if (_is_at_end) {
+      inflateReset(&_stream);
+      _is_at_end = false;
+    }
+
+    _stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input));
+    _stream.avail_in = static_cast<uInt>(std::min(static_cast<size_t>(input_end - input),
+                                                  static_cast<size_t>(std::numeric_limits<uInt>::max())));
+    _stream.next_out = reinterpret_cast<Bytef*>(output);
+    _stream.avail_out = static_cast<uInt>(std::min(static_cast<size_t>(output_end - output),
+                                                   static_cast<size_t>(std::numeric_limits<uInt>::max())));
+
+    const auto result = inflate(&_stream, Z_NO_FLUSH);
+    Assert(result == Z_OK || result == Z_STREAM_END || result == Z_BUF_ERROR,
+           std::string{"gzip decompression failed: "} + (_stream.msg ? _stream.msg : std::to_string(result)));
+
+    input = reinterpret_cast<const char*>(_stream.next_in);
+    output = reinterpret_cast<char*>(_stream.next_out);
+    _is_at_end = result == Z_STREAM_END;
+  }
+
+  bool is_at_end() const override { return _is_at_end; }
+
+ private:
+  z_stream _stream{};
+  bool _is_at_end{false};
+};
+
+#if HYRISE_ZSTD_SUPPORT
+class ZstdDecompressor : public BaseFileDecompressor {
+ public:
+  ZstdDecompressor() : _stream(ZSTD_createDStream()) {
+    Assert(_stream && !ZSTD_isError(ZSTD_initDStream(_stream)), "Could not initialize zstd decompression");
+  }
+
+  ~ZstdDecompressor() override { ZSTD_freeDStream(_stream); }
+
+  void decompress(const char*& input, const char* const input_end, char*& output, char* const output_end) override {
+    auto in_buffer = ZSTD_inBuffer{input, static_cast<size_t>(input_end - input), 0};
+    auto out_buffer = ZSTD_outBuffer{output, static_cast<size_t>(output_end - output), 0};
+
+    // Consecutive frames are decompressed one after the other by the same stream
+    const auto result = ZSTD_decompressStream(_stream, &out_buffer, &in_buffer);
+    Assert(!ZSTD_isError(result), std::string{"zstd decompression failed: "} + ZSTD_getErrorName(result));
+
+    input += in_buffer.pos;
+    output += out_buffer.pos;
+    _is_at_end = result == 0;
+  }
+
+  bool is_at_end() const override { return _is_at_end; }
+
+ private:
+  ZSTD_DStream* const _stream;
+  bool _is_at_end{false};
+};
+#endif
+
+}  // namespace
+
+FileBlockReader::FileBlockReader(const std::string& filename) : _filename(filename), _file(filename, std::ios::binary) {
+  Assert(_file.is_open(), "Could not open file " + filename);
+
+  auto magic = std::array<unsigned char, 4>{};
+  _file.read(reinterpret_cast<char*>(magic.data()), magic.size());
+  const auto magic_size = static_cast<size_t>(_file.gcount());
+  _file.clear();
+  _file.seekg(0);
+
+  if (magic_size >= GZIP_MAGIC.size() && std::equal(GZIP_MAGIC.begin(), GZIP_MAGIC.end(), magic.begin())) {
+    _compression = FileCompression::Gzip;
+    _decompressor = std::make_unique<GzipDecompressor>();
+  } else if (magic_size >= ZSTD_MAGIC.size() && std::equal(ZSTD_MAGIC.begin(), ZSTD_MAGIC.end(), magic.begin())) {
+    _compression = FileCompression::Zstd;
+#if HYRISE_ZSTD_SUPPORT
+    _decompressor = std::make_unique<ZstdDecompressor>();
+#else
+    Fail("Cannot read zstd-compressed file " + filename + ": Hyrise was built without zstd support");
+#endif
+  }
+}
+
+FileBlockReader::~FileBlockReader() = default;
+
+FileCompression FileBlockReader::compression() const { return _compression; }
+
+bool FileBlockReader::read_block(std::string& content, const size_t block_size) {
+  const auto previous_size = content.size();
+  content.resize(previous_size + block_size);
+
+  if (!_decompressor) {
+    _file.read(content.data() + previous_size, static_cast<std::streamsize>(block_size));
+    content.resize(previous_size + static_cast<size_t>(_file.gcount()));
+    return static_cast<bool>(_file);
+  }
+
+  auto* const output_begin = content.data() + previous_size;
+  auto* output = output_begin;
+  _decompress(output, output_begin + block_size);
+  const auto decompressed_size = static_cast<size_t>(output - output_begin);
+  content.resize(previous_size + decompressed_size);
+
+  // _decompress only stops before the block is full if the end of the file was reached
+  return decompressed_size == block_size;
+}
+
+void FileBlockReader::_decompress(char*& output, char* const output_end) {
+  while (output != output_end) {
+    if (_input_offset == _input.size()) {
+      if (_input_is_complete) {
+        Assert(_decompressor->is_at_end(), "Compressed file " + _filename + " is truncated");
+        return;
+      }
+
+      _input.resize(INPUT_BLOCK_SIZE);
+      _file.read(_input.data(), static_cast<std::streamsize>(_input.size()));
+      _input.resize(static_cast<size_t>(_file.gcount()));
+      _input_offset = 0;
+      _input_is_complete = !_file;
+      continue;
+    }
+
+    const auto* input = _input.data() + _input_offset;
+    _decompressor->decompress(input, _input.data() + _input.size(), output, output_end);
+    _input_offset = static_cast<size_t>(input - _input.data());
+  }
+}
+
+}  // namespace opossum
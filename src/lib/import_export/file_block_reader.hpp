@@ -0,0 +1,46 @@
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class FileCompression { None, Gzip, Zstd };
+
+class BaseFileDecompressor;
+
+/**
+ * Reads a file in blocks. Files compressed with gzip or zstd are recognized by their first bytes and decompressed
+ * while they are read, so that they do not have to be decompressed to disk first. Concatenated gzip members and
+ * zstd frames, as written by parallel compressors like pigz or zstd -T, are read one after the other.
+ */
+class FileBlockReader : public Noncopyable {
+ public:
+  explicit FileBlockReader(const std::string& filename);
+  ~FileBlockReader();
+
+  FileCompression compression() const;
+
+  // Appends up to block_size bytes of the decompressed content to the given string. Returns false if the end of the
+  // file was reached.
+  bool read_block(std::string& content, const size_t block_size);
+
+ private:
+  // Decompresses the buffered input into [output, output_end) and advances output. Reads more input if needed.
+  void _decompress(char*& output, char* const output_end);
+
+  const std::string _filename;
+  std::ifstream _file;
+  FileCompression _compression{FileCompression::None};
+  std::unique_ptr<BaseFileDecompressor> _decompressor;
+
+  // Compressed input that has been read from the file, of which everything before _input_offset has been decompressed
+  std::string _input;
+  size_t _input_offset{0};
+  bool _input_is_complete{false};
+};
+
+}  // namespace opossum
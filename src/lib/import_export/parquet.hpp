@@ -0,0 +1,69 @@
+#pragma once
+
+#if HYRISE_PARQUET_SUPPORT
+
+#include <parquet/api/reader.h>
+#include <parquet/api/writer.h>
+
+#include <string>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Mapping between the data types of Hyrise and the physical types of Parquet, which ImportParquet and ExportParquet
+ * share. Strings are stored as UTF-8 byte arrays.
+ */
+template <typename T>
+struct ParquetType;
+
+template <>
+struct ParquetType<int32_t> {
+  using type = parquet::Int32Type;
+};
+
+template <>
+struct ParquetType<int64_t> {
+  using type = parquet::Int64Type;
+};
+
+template <>
+struct ParquetType<float> {
+  using type = parquet::FloatType;
+};
+
+template <>
+struct ParquetType<double> {
+  using type = parquet::DoubleType;
+};
+
+template <>
+struct ParquetType<std::string> {
+  using type = parquet::ByteArrayType;
+};
+
+// Returns the Hyrise value of a value read from a Parquet file
+template <typename T, typename ParquetValue>
+T from_parquet_value(const ParquetValue& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::string{reinterpret_cast<const char*>(value.ptr), value.len};
+  } else {
+    return value;
+  }
+}
+
+// Returns the value that is written to a Parquet file. Byte arrays point to the string, which has to outlive them.
+template <typename T>
+typename ParquetType<T>::type::c_type to_parquet_value(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return parquet::ByteArray{static_cast<uint32_t>(value.size()), reinterpret_cast<const uint8_t*>(value.data())};
+  } else {
+    return value;
+  }
+}
+
+}  // namespace opossum
+
+#endif
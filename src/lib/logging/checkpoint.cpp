@@ -0,0 +1,269 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "log_format.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto CURRENT_FILE_NAME = std::string{"CURRENT"};
+const auto CHECKPOINT_NAME_PREFIX = std::string{"checkpoint_"};
+const auto META_FILE_NAME = std::string{"meta"};
+
+filesystem::path table_file_path(const filesystem::path& checkpoint_path, const size_t table_index) {
+  return checkpoint_path / ("table_" + std::to_string(table_index));
+}
+
+void sync_file_descriptor(const int file_descriptor, const std::string& path) {
+  const auto result = fsync(file_descriptor);
+  close(file_descriptor);
+  Assert(result == 0, "Could not sync " + path);
+}
+
+// Writes and syncs the file, so that it is durable before the checkpoint becomes the current one
+void write_file(const filesystem::path& path, const std::vector<char>& data) {
+  const auto file_descriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  Assert(file_descriptor >= 0, "Could not create " + path.string());
+
+  auto written_byte_count = size_t{0};
+  while (written_byte_count < data.size()) {
+    const auto result = ::write(file_descriptor, data.data() + written_byte_count, data.size() - written_byte_count);
+    if (result <= 0) close(file_descriptor);
+    Assert(result > 0, "Could not write to " + path.string());
+    written_byte_count += static_cast<size_t>(result);
+  }
+
+  sync_file_descriptor(file_descriptor, path.string());
+}
+
+// Renames within a directory are only durable once the directory is synced
+void sync_directory(const filesystem::path& path) {
+  const auto file_descriptor = open(path.c_str(), O_RDONLY | O_DIRECTORY);
+  Assert(file_descriptor >= 0, "Could not open " + path.string());
+  sync_file_descriptor(file_descriptor, path.string());
+}
+
+std::string current_checkpoint_name(const filesystem::path& directory) {
+  auto file = std::ifstream{directory / CURRENT_FILE_NAME};
+  auto name = std::string{};
+  std::getline(file, name);
+  return name;
+}
+
+std::vector<char> serialize_table(const std::string& table_name, Table& table, const CommitID snapshot_commit_id) {
+  auto buffer = std::vector<char>{};
+  write_log_value(buffer, table_name);
+  write_log_value(buffer, static_cast<uint32_t>(table.column_count()));
+  for (const auto& column_definition : table.column_definitions()) {
+    write_log_value(buffer, column_definition.name);
+    write_log_value(buffer, column_definition.data_type);
+    write_log_value(buffer, column_definition.nullable);
+  }
+  write_log_value(buffer, table.max_chunk_size());
+
+  // Chunks appended afterwards only hold rows of transactions that are not part of the snapshot
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  {
+    const auto append_lock = table.acquire_append_mutex();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      chunks.emplace_back(table.get_chunk(chunk_id));
+    }
+  }
+  write_log_value(buffer, static_cast<uint32_t>(chunks.size()));
+
+  for (const auto& chunk : chunks) {
+    const auto chunk_size = chunk->size();
+    write_log_value(buffer, chunk_size);
+    write_log_value(buffer, chunk->is_mutable());
+
+    // Rows are visible if they were inserted and not deleted by transactions that committed up to the snapshot
+    auto visible_rows = std::vector<bool>(chunk_size, true);
+    if (chunk->has_mvcc_data()) {
+      const auto mvcc_data = std::as_const(*chunk).get_scoped_mvcc_data_lock();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        visible_rows[chunk_offset] = mvcc_data->begin_cid(chunk_offset) <= snapshot_commit_id &&
+                                     mvcc_data->end_cid(chunk_offset) > snapshot_commit_id;
+      }
+    }
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto is_visible = visible_rows[chunk_offset];
+      write_log_value(buffer, is_visible);
+      if (!is_visible) continue;
+
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        write_log_value(buffer, (*chunk->get_segment(column_id))[chunk_offset]);
+      }
+    }
+  }
+
+  return buffer;
+}
+
+std::pair<std::string, std::shared_ptr<Table>> deserialize_table(LogReader& reader) {
+  auto table_name = std::string{};
+  auto column_count = uint32_t{0};
+  auto success = reader.read(table_name) && reader.read(column_count);
+
+  auto column_definitions = TableColumnDefinitions(column_count);
+  for (auto& column_definition : column_definitions) {
+    success = success && reader.read(column_definition.name) && reader.read(column_definition.data_type) &&
+              reader.read(column_definition.nullable);
+  }
+
+  auto max_chunk_size = uint32_t{0};
+  auto chunk_count = uint32_t{0};
+  success = success && reader.read(max_chunk_size) && reader.read(chunk_count);
+  Assert(success, "Checkpoint of table " + table_name + " is incomplete");
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, max_chunk_size, UseMvcc::Yes);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto chunk_size = ChunkOffset{0};
+    auto is_mutable = true;
+    Assert(reader.read(chunk_size) && reader.read(is_mutable), "Checkpoint of table " + table_name + " is incomplete");
+
+    auto segments = Segments{};
+    auto value_segments = std::vector<std::shared_ptr<BaseValueSegment>>{};
+    for (const auto& column_definition : column_definitions) {
+      resolve_data_type(column_definition.data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        value_segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable));
+      });
+      segments.emplace_back(value_segments.back());
+    }
+
+    // The values of invisible rows are not written. Any value of the column's type serves as a placeholder.
+    auto invisible_chunk_offsets = std::vector<ChunkOffset>{};
+    auto value = AllTypeVariant{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      auto is_visible = false;
+      Assert(reader.read(is_visible), "Checkpoint of table " + table_name + " is incomplete");
+      if (!is_visible) invisible_chunk_offsets.emplace_back(chunk_offset);
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        if (is_visible) {
+          Assert(reader.read(value), "Checkpoint of table " + table_name + " is incomplete");
+          value_segments[column_id]->append(value);
+        } else if (column_definitions[column_id].nullable) {
+          value_segments[column_id]->append(NULL_VALUE);
+        } else {
+          resolve_data_type(column_definitions[column_id].data_type, [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            value_segments[column_id]->append(ColumnDataType{});
+          });
+        }
+      }
+    }
+
+    table->append_chunk(segments);
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!invisible_chunk_offsets.empty()) {
+      auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      for (const auto chunk_offset : invisible_chunk_offsets) {
+        mvcc_data->end_cids[chunk_offset] = CommitID{0};
+      }
+      mvcc_data->register_invalidation();
+    }
+    if (!is_mutable) chunk->mark_immutable();
+  }
+
+  return {table_name, table};
+}
+
+}  // namespace
+
+namespace opossum {
+
+void Checkpoint::write(const std::string& directory, const CommitID snapshot_commit_id, const uint64_t log_offset) {
+  const auto directory_path = filesystem::path{directory};
+  filesystem::create_directories(directory_path);
+
+  // A directory left behind by a crash while writing a checkpoint is replaced
+  const auto previous_checkpoint_name = current_checkpoint_name(directory_path);
+  auto checkpoint_number = uint64_t{0};
+  if (!previous_checkpoint_name.empty()) {
+    checkpoint_number = std::stoull(previous_checkpoint_name.substr(CHECKPOINT_NAME_PREFIX.size())) + 1;
+  }
+  const auto checkpoint_name = CHECKPOINT_NAME_PREFIX + std::to_string(checkpoint_number);
+  const auto checkpoint_path = directory_path / checkpoint_name;
+  filesystem::remove_all(checkpoint_path);
+  filesystem::create_directory(checkpoint_path);
+
+  // The tables are written in parallel
+  const auto table_names = StorageManager::get().table_names();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto table_index = size_t{0}; table_index < table_names.size(); ++table_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, table_index]() {
+      const auto& table_name = table_names[table_index];
+      const auto table = StorageManager::get().get_table(table_name);
+      const auto serialized_table = serialize_table(table_name, *table, snapshot_commit_id);
+      write_file(table_file_path(checkpoint_path, table_index), serialized_table);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  auto meta = std::vector<char>{};
+  write_log_value(meta, log_offset);
+  write_log_value(meta, static_cast<uint32_t>(table_names.size()));
+  write_file(checkpoint_path / META_FILE_NAME, meta);
+  sync_directory(checkpoint_path);
+
+  // Replacing the CURRENT file makes the checkpoint the current one
+  const auto current_file_path = directory_path / CURRENT_FILE_NAME;
+  const auto temporary_current_file_path = directory_path / (CURRENT_FILE_NAME + ".tmp");
+  write_file(temporary_current_file_path, std::vector<char>(checkpoint_name.cbegin(), checkpoint_name.cend()));
+  filesystem::rename(temporary_current_file_path, current_file_path);
+  sync_directory(directory_path);
+
+  if (!previous_checkpoint_name.empty()) filesystem::remove_all(directory_path / previous_checkpoint_name);
+}
+
+uint64_t Checkpoint::load(const std::string& directory) {
+  const auto directory_path = filesystem::path{directory};
+  const auto checkpoint_name = current_checkpoint_name(directory_path);
+  Assert(!checkpoint_name.empty(), "No checkpoint in " + directory);
+  const auto checkpoint_path = directory_path / checkpoint_name;
+
+  auto meta_reader = LogReader::from_file(checkpoint_path / META_FILE_NAME);
+  auto log_offset = uint64_t{0};
+  auto table_count = uint32_t{0};
+  Assert(meta_reader.read(log_offset) && meta_reader.read(table_count), "Checkpoint " + checkpoint_name + " is broken");
+
+  // The tables are loaded in parallel and added to the StorageManager afterwards
+  auto tables = std::vector<std::pair<std::string, std::shared_ptr<Table>>>(table_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto table_index = size_t{0}; table_index < table_count; ++table_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, table_index]() {
+      auto reader = LogReader::from_file(table_file_path(checkpoint_path, table_index));
+      tables[table_index] = deserialize_table(reader);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& [table_name, table] : tables) {
+    StorageManager::get().add_table(table_name, table);
+  }
+
+  return log_offset;
+}
+
+}  // namespace opossum
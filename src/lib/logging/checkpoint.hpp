@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A checkpoint is a copy of all tables of the StorageManager as seen by a snapshot commit id, so that the recovery
+ * only has to replay the log from the checkpoint on (see Logger::checkpoint()). The rows are read like by a
+ * transaction with that snapshot, so writers are not blocked.
+ *
+ * Each table keeps its chunks, and every row keeps its position, as the log refers to rows by RowID. Rows that are
+ * not visible in the snapshot are written as invisible rows without their values. Their positions are filled by the
+ * log if they have been inserted by a transaction that committed after the snapshot.
+ *
+ * A checkpoint directory holds a subdirectory per checkpoint, each with a file per table and a file with the position
+ * in the log, and a file that names the current checkpoint. That file is replaced atomically once a new checkpoint is
+ * complete, so that a crash while writing a checkpoint leaves the previous one intact.
+ */
+class Checkpoint {
+ public:
+  // Writes the checkpoint and makes it the current one of @param directory, which is created if needed
+  static void write(const std::string& directory, const CommitID snapshot_commit_id, const uint64_t log_offset);
+
+  // Adds the tables of the current checkpoint of @param directory to the StorageManager and returns its log offset
+  static uint64_t load(const std::string& directory);
+};
+
+}  // namespace opossum
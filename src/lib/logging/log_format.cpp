@@ -0,0 +1,71 @@
+#include "log_format.hpp"
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void write_log_value(std::vector<char>& buffer, const std::string& value) {
+  write_log_value(buffer, static_cast<uint32_t>(value.size()));
+  buffer.insert(buffer.end(), value.cbegin(), value.cend());
+}
+
+void write_log_value(std::vector<char>& buffer, const AllTypeVariant& value) {
+  const auto data_type = data_type_from_all_type_variant(value);
+  write_log_value(buffer, data_type);
+  if (data_type == DataType::Null) return;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    write_log_value(buffer, boost::get<ColumnDataType>(value));
+  });
+}
+
+LogReader::LogReader(std::vector<char> data, const size_t position) : _data(std::move(data)), _position(position) {
+  Assert(_position <= _data.size(), "Position is behind the end of the data");
+}
+
+bool LogReader::read(std::string& value) {
+  auto size = uint32_t{0};
+  if (!read(size) || _data.size() - _position < size) return false;
+  value.assign(_data.data() + _position, size);
+  _position += size;
+  return true;
+}
+
+bool LogReader::read(AllTypeVariant& value) {
+  auto data_type = DataType::Null;
+  if (!read(data_type)) return false;
+
+  if (data_type == DataType::Null) {
+    value = NULL_VALUE;
+    return true;
+  }
+
+  auto success = false;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    auto typed_value = ColumnDataType{};
+    success = read(typed_value);
+    value = typed_value;
+  });
+  return success;
+}
+
+LogReader LogReader::from_file(const std::string& file_path, const size_t position) {
+  auto file = std::ifstream{file_path, std::ios::binary};
+  Assert(file.is_open(), "Could not open " + file_path);
+
+  // The data before the position is not read at all
+  file.seekg(static_cast<std::streamoff>(position));
+  Assert(file.good(), "Position is behind the end of " + file_path);
+  return LogReader{std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>())};
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Binary encoding of the log records and checkpoints. Integers are written in the byte order of the machine, strings
+ * are prefixed with their length, and values are prefixed with their DataType (DataType::Null for NULL).
+ */
+template <typename T>
+void write_log_value(std::vector<char>& buffer, const T& value) {
+  const auto* const bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void write_log_value(std::vector<char>& buffer, const std::string& value);
+void write_log_value(std::vector<char>& buffer, const AllTypeVariant& value);
+
+// Reads values written by write_log_value(). All reads return false once the end of the data is reached.
+class LogReader {
+ public:
+  explicit LogReader(std::vector<char> data, const size_t position = 0);
+
+  template <typename T>
+  bool read(T& value) {
+    if (_data.size() - _position < sizeof(T)) return false;
+    std::memcpy(&value, _data.data() + _position, sizeof(T));
+    _position += sizeof(T);
+    return true;
+  }
+
+  bool read(std::string& value);
+  bool read(AllTypeVariant& value);
+
+  // Reads the file at @param file_path from @param position on
+  static LogReader from_file(const std::string& file_path, const size_t position = 0);
+
+ private:
+  const std::vector<char> _data;
+  size_t _position;
+};
+
+}  // namespace opossum
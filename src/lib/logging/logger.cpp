@@ -0,0 +1,423 @@
+#include "logger.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "checkpoint.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "log_format.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto INSERT_RECORD = 'i';
+constexpr auto DELETE_RECORD = 'd';
+constexpr auto COMMIT_RECORD = 'c';
+
+// The records of the transactions that the thread currently commits, see Logger::log_commit()
+thread_local std::unordered_map<TransactionID, std::vector<char>> transaction_log_buffers;
+
+void write_record_header(std::vector<char>& buffer, const char record_type, const TransactionID transaction_id,
+                         const std::string& table_name, const RowID row_id) {
+  buffer.emplace_back(record_type);
+  write_log_value(buffer, transaction_id);
+  write_log_value(buffer, table_name);
+  write_log_value(buffer, row_id.chunk_id);
+  write_log_value(buffer, row_id.chunk_offset);
+}
+
+struct LoggedRow {
+  RowID row_id;
+  std::vector<AllTypeVariant> values;
+};
+
+// The changes of a transaction, grouped by table
+struct LoggedTransaction {
+  std::unordered_map<std::string, std::vector<LoggedRow>> inserted_rows;
+  std::unordered_map<std::string, std::vector<RowID>> deleted_rows;
+};
+
+// Values for the positions of rolled back inserts, which are invisible anyway
+std::vector<AllTypeVariant> placeholder_values(const Table& table) {
+  auto values = std::vector<AllTypeVariant>{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    if (table.column_is_nullable(column_id)) {
+      values.emplace_back(NULL_VALUE);
+      continue;
+    }
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      values.emplace_back(ColumnDataType{});
+    });
+  }
+  return values;
+}
+
+// Appends invisible rows until the position of @param row_id exists. Returns whether the position was appended.
+bool grow_to(Table& table, const RowID row_id, const std::vector<AllTypeVariant>& placeholder) {
+  while (table.chunk_count() <= row_id.chunk_id) {
+    table.append_mutable_chunk();
+  }
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  if (chunk->size() > row_id.chunk_offset) return false;
+  Assert(chunk->is_mutable(), "Logged row cannot be placed, the table differs from the one that was logged");
+
+  while (chunk->size() <= row_id.chunk_offset) {
+    const auto chunk_offset = chunk->size();
+    chunk->append(placeholder);
+
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    mvcc_data->begin_cids[chunk_offset] = CommitID{0};
+    mvcc_data->end_cids[chunk_offset] = CommitID{0};
+    mvcc_data->register_committed_insert(CommitID{0});
+    mvcc_data->register_invalidation();
+  }
+  return true;
+}
+
+// Writes the values of @param row into the ValueSegments of its position and makes it visible to all transactions
+void write_row(Chunk& chunk, const LoggedRow& row) {
+  const auto chunk_offset = row.row_id.chunk_offset;
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto& segment = chunk.get_segment(column_id);
+    resolve_data_type(segment->data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+      Assert(value_segment, "Logged rows can only be replayed into ValueSegments");
+
+      const auto& value = row.values[column_id];
+      if (value_segment->is_nullable()) value_segment->null_values()[chunk_offset] = variant_is_null(value);
+      if (!variant_is_null(value)) value_segment->set_value(chunk_offset, type_cast_variant<ColumnDataType>(value));
+    });
+  }
+
+  auto mvcc_data = chunk.get_scoped_mvcc_data_lock_for_writing();
+  mvcc_data->begin_cids[chunk_offset] = CommitID{0};
+  mvcc_data->end_cids[chunk_offset] = MvccData::MAX_COMMIT_ID;
+}
+
+/**
+ * Places the inserted rows at their logged positions and invalidates the deleted rows. Positions that already exist,
+ * e.g., as invisible rows of a checkpoint, are overwritten, so that replaying a change twice does no harm. The table
+ * is first grown one position after another, then the rows of each chunk are written by a job of their own.
+ */
+void replay_table(Table& table, std::vector<LoggedRow>& rows, const std::vector<RowID>& deleted_row_ids) {
+  std::sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) { return lhs.row_id < rhs.row_id; });
+  const auto placeholder = placeholder_values(table);
+
+  auto appended_row_ids = std::vector<RowID>{};
+  for (const auto& row : rows) {
+    if (grow_to(table, row.row_id, placeholder)) appended_row_ids.emplace_back(row.row_id);
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto chunk_begin = rows.cbegin(); chunk_begin != rows.cend();) {
+    const auto chunk_id = chunk_begin->row_id.chunk_id;
+    const auto chunk_end = std::find_if(chunk_begin, rows.cend(),
+                                        [&](const auto& row) { return row.row_id.chunk_id != chunk_id; });
+    jobs.emplace_back(std::make_shared<JobTask>([&table, chunk_id, chunk_begin, chunk_end]() {
+      const auto chunk = table.get_chunk(chunk_id);
+      for (auto row_iter = chunk_begin; row_iter != chunk_end; ++row_iter) {
+        write_row(*chunk, *row_iter);
+      }
+    }));
+    chunk_begin = chunk_end;
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  // Rows that existed before were indexed already
+  for (const auto& row_id : appended_row_ids) {
+    table.add_to_table_indexes(row_id.chunk_id, row_id.chunk_offset, row_id.chunk_offset + 1);
+  }
+
+  for (const auto& row_id : deleted_row_ids) {
+    Assert(row_id.chunk_id < table.chunk_count() && row_id.chunk_offset < table.get_chunk(row_id.chunk_id)->size(),
+           "Logged row does not exist, the table differs from the one that was logged");
+
+    auto mvcc_data = table.get_chunk(row_id.chunk_id)->get_scoped_mvcc_data_lock_for_writing();
+    mvcc_data->end_cids[row_id.chunk_offset] = CommitID{0};
+    mvcc_data->register_invalidation();
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+Logger::~Logger() { disable(); }
+
+void Logger::enable(const std::string& file_path) {
+  Assert(!_is_enabled, "Logger is already enabled");
+
+  _file_descriptor = open(file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Could not open log file " + file_path);
+
+  {
+    std::lock_guard<std::mutex> lock(_buffer_mutex);
+    _stop_requested = false;
+    _file_offset_at_enable = static_cast<uint64_t>(lseek(_file_descriptor, 0, SEEK_END));
+    _position_at_enable = _buffered_position;
+  }
+  _flush_thread = std::thread(&Logger::_flush_loop, this);
+  _is_enabled = true;
+}
+
+void Logger::disable() {
+  if (!_is_enabled) return;
+
+  // A running checkpoint still needs the log
+  _checkpoint_thread.reset();
+  if (!_is_enabled.exchange(false)) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_buffer_mutex);
+    _stop_requested = true;
+  }
+  _buffer_condition.notify_one();
+  _flush_thread.join();
+
+  // Transactions that committed while the flush thread stopped
+  flush();
+
+  close(_file_descriptor);
+  _file_descriptor = -1;
+}
+
+bool Logger::is_enabled() const { return _is_enabled; }
+
+void Logger::log_insert(const TransactionID transaction_id, const std::string& table_name, const RowID row_id,
+                        const std::vector<AllTypeVariant>& values) {
+  auto& buffer = transaction_log_buffers[transaction_id];
+  write_record_header(buffer, INSERT_RECORD, transaction_id, table_name, row_id);
+  for (const auto& value : values) {
+    write_log_value(buffer, value);
+  }
+}
+
+void Logger::log_delete(const TransactionID transaction_id, const std::string& table_name, const RowID row_id) {
+  write_record_header(transaction_log_buffers[transaction_id], DELETE_RECORD, transaction_id, table_name, row_id);
+}
+
+Logger::LogPosition Logger::log_commit(const TransactionID transaction_id, const CommitID commit_id) {
+  const auto transaction_log_buffer_iter = transaction_log_buffers.find(transaction_id);
+
+  std::unique_lock<std::mutex> lock(_buffer_mutex);
+
+  // Transactions without changes wait only for the changes they might have seen
+  if (transaction_log_buffer_iter == transaction_log_buffers.end()) return _buffered_position;
+
+  auto& transaction_log_buffer = transaction_log_buffer_iter->second;
+  transaction_log_buffer.emplace_back(COMMIT_RECORD);
+  write_log_value(transaction_log_buffer, transaction_id);
+  write_log_value(transaction_log_buffer, commit_id);
+
+  _unpublished_transactions.emplace(transaction_id, _buffered_position);
+  _buffer.insert(_buffer.end(), transaction_log_buffer.cbegin(), transaction_log_buffer.cend());
+  _buffered_position += transaction_log_buffer.size();
+  const auto position = _buffered_position;
+  lock.unlock();
+
+  transaction_log_buffers.erase(transaction_log_buffer_iter);
+  _buffer_condition.notify_one();
+
+  return position;
+}
+
+Logger::LogPosition Logger::buffered_position() {
+  std::lock_guard<std::mutex> lock(_buffer_mutex);
+  return _buffered_position;
+}
+
+void Logger::on_published(const TransactionID transaction_id) {
+  std::lock_guard<std::mutex> lock(_buffer_mutex);
+  _unpublished_transactions.erase(transaction_id);
+}
+
+void Logger::on_durable(const LogPosition position, const std::function<void()>& callback) {
+  {
+    std::lock_guard<std::mutex> lock(_callbacks_mutex);
+    if (position > _durable_position) {
+      _callbacks.emplace(position, callback);
+      return;
+    }
+  }
+
+  callback();
+}
+
+void Logger::flush() {
+  // The callbacks are called without holding a lock, as they might commit further transactions
+  auto durable_callbacks = std::vector<std::function<void()>>{};
+  {
+    std::lock_guard<std::mutex> file_lock(_file_mutex);
+
+    auto buffer = std::vector<char>{};
+    auto position = LogPosition{0};
+    {
+      std::lock_guard<std::mutex> lock(_buffer_mutex);
+      std::swap(buffer, _buffer);
+      position = _buffered_position;
+    }
+
+    if (!buffer.empty()) {
+      auto written_byte_count = size_t{0};
+      while (written_byte_count < buffer.size()) {
+        const auto result =
+            write(_file_descriptor, buffer.data() + written_byte_count, buffer.size() - written_byte_count);
+        Assert(result > 0, "Could not write to the log file");
+        written_byte_count += static_cast<size_t>(result);
+      }
+      Assert(fdatasync(_file_descriptor) == 0, "Could not sync the log file");
+    }
+
+    std::lock_guard<std::mutex> lock(_callbacks_mutex);
+    _durable_position = position;
+    const auto end = _callbacks.upper_bound(position);
+    for (auto callback_iter = _callbacks.begin(); callback_iter != end; ++callback_iter) {
+      durable_callbacks.emplace_back(std::move(callback_iter->second));
+    }
+    _callbacks.erase(_callbacks.begin(), end);
+  }
+
+  for (const auto& callback : durable_callbacks) {
+    callback();
+  }
+}
+
+void Logger::_flush_loop() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(_buffer_mutex);
+      _buffer_condition.wait(lock, [&]() { return _stop_requested || !_buffer.empty(); });
+      if (_stop_requested) return;
+    }
+
+    flush();
+  }
+}
+
+void Logger::checkpoint(const std::string& directory) {
+  Assert(_is_enabled, "Checkpoints require the log to be enabled");
+
+  // Transactions that are not visible in the snapshot taken afterwards are either logged from this offset on or not
+  // logged yet. The offset is determined first, so that no transaction is missed.
+  auto log_offset = uint64_t{0};
+  {
+    std::lock_guard<std::mutex> lock(_buffer_mutex);
+    auto position = _buffered_position;
+    for (const auto& [transaction_id, start_position] : _unpublished_transactions) {
+      position = std::min(position, start_position);
+    }
+    position = std::max(position, _position_at_enable);
+    log_offset = _file_offset_at_enable + (position - _position_at_enable);
+  }
+
+  // The transaction context keeps the MVCC data of the snapshot from being cleaned up while the tables are written
+  const auto transaction_context = TransactionManager::get().new_read_only_transaction_context();
+  Checkpoint::write(directory, transaction_context->snapshot_commit_id(), log_offset);
+  transaction_context->rollback();
+}
+
+void Logger::start_checkpointing(const std::string& directory, const std::chrono::milliseconds interval) {
+  Assert(_is_enabled, "Checkpoints require the log to be enabled");
+  _checkpoint_thread =
+      std::make_unique<PausableLoopThread>(interval, [this, directory](size_t) { checkpoint(directory); });
+}
+
+size_t Logger::recover(const std::string& file_path) { return _replay(file_path, 0); }
+
+size_t Logger::recover_from_checkpoint(const std::string& checkpoint_directory, const std::string& log_file_path) {
+  const auto log_offset = Checkpoint::load(checkpoint_directory);
+  return _replay(log_file_path, log_offset);
+}
+
+size_t Logger::_replay(const std::string& file_path, const uint64_t log_offset) {
+  auto reader = LogReader::from_file(file_path, log_offset);
+  auto pending_transactions = std::unordered_map<TransactionID, LoggedTransaction>{};
+  auto committed_transaction = LoggedTransaction{};
+  auto committed_transaction_count = size_t{0};
+
+  auto record_type = char{0};
+  while (reader.read(record_type)) {
+    auto transaction_id = TransactionID{0};
+    if (!reader.read(transaction_id)) break;
+
+    if (record_type == COMMIT_RECORD) {
+      auto commit_id = CommitID{0};
+      if (!reader.read(commit_id)) break;
+
+      // Only the final state is restored, so the changes of all committed transactions are replayed together
+      auto& transaction = pending_transactions[transaction_id];
+      for (auto& [table_name, rows] : transaction.inserted_rows) {
+        auto& table_rows = committed_transaction.inserted_rows[table_name];
+        std::move(rows.begin(), rows.end(), std::back_inserter(table_rows));
+      }
+      for (auto& [table_name, row_ids] : transaction.deleted_rows) {
+        auto& table_row_ids = committed_transaction.deleted_rows[table_name];
+        table_row_ids.insert(table_row_ids.end(), row_ids.cbegin(), row_ids.cend());
+      }
+      pending_transactions.erase(transaction_id);
+      ++committed_transaction_count;
+      continue;
+    }
+
+    Assert(record_type == INSERT_RECORD || record_type == DELETE_RECORD, "Unexpected record in log file");
+
+    auto table_name = std::string{};
+    auto row_id = RowID{};
+    if (!reader.read(table_name) || !reader.read(row_id.chunk_id) || !reader.read(row_id.chunk_offset)) break;
+
+    auto& transaction = pending_transactions[transaction_id];
+    if (record_type == DELETE_RECORD) {
+      transaction.deleted_rows[table_name].emplace_back(row_id);
+      continue;
+    }
+
+    const auto& table = StorageManager::get().get_table(table_name);
+    auto row = LoggedRow{row_id, std::vector<AllTypeVariant>(table->column_count())};
+    auto complete = true;
+    for (auto& value : row.values) {
+      complete = complete && reader.read(value);
+    }
+    if (!complete) break;
+    transaction.inserted_rows[table_name].emplace_back(std::move(row));
+  }
+
+  // The tables are replayed in parallel, each of them by chunk. The jobs only look up the changes of their table.
+  auto& inserted_rows = committed_transaction.inserted_rows;
+  auto& deleted_rows = committed_transaction.deleted_rows;
+  for (const auto& [table_name, row_ids] : deleted_rows) inserted_rows[table_name];
+  for (const auto& [table_name, rows] : inserted_rows) deleted_rows[table_name];
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto& table_rows : inserted_rows) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      replay_table(*StorageManager::get().get_table(table_rows.first), table_rows.second,
+                   deleted_rows.at(table_rows.first));
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  return committed_transaction_count;
+}
+
+}  // namespace opossum
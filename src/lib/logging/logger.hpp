@@ -0,0 +1,145 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Redo log of the changes of committed transactions, so that the tables can be restored after a crash.
+ *
+ * The log is a sequence of binary records, each starting with its type:
+ *  - Insert: 'i', TransactionID, table name, RowID, values of the row
+ *  - Delete: 'd', TransactionID, table name, RowID
+ *  - Commit: 'c', TransactionID, CommitID
+ * The values are encoded by write_log_value().
+ *
+ * Write path: When a transaction commits, Insert and Delete encode their records into a log buffer of the committing
+ * thread. Before the transaction can become visible, the TransactionContext calls log_commit(), which appends these
+ * records and the commit record to the log buffer in one go. Thus, the records of a transaction are adjacent in the
+ * log, only committed transactions are logged, and every change another transaction can see is logged before that
+ * transaction's own changes. A flush thread writes the log buffer to the file and fsyncs it while the Workers go on
+ * executing. Transactions that commit during an fsync are flushed together by the next one (group commit). The commit
+ * callbacks of transactions (see TransactionContext::commit_async()) are only called once their records are durable.
+ *
+ * Recovery: The log describes the changes relative to the tables as they were when logging was enabled, by RowID.
+ * recover() is to be called on the very same tables (e.g., reloaded from the same files) before new transactions run.
+ * It places the inserted rows of committed transactions at their logged positions, filling positions of rolled back
+ * inserts with invisible rows, and invalidates the deleted rows. Creating and dropping tables is not logged.
+ *
+ * Checkpoints: To not replay the whole log, checkpoint() writes all tables as seen by a new snapshot (see Checkpoint)
+ * together with the log offset from which on transactions might be missing in that snapshot. These are the
+ * transactions that were logged but not yet visible when the checkpoint was started. recover_from_checkpoint() loads
+ * the checkpoint and replays the log from that offset. As replaying writes rows to their logged positions, replaying
+ * a transaction that is part of the checkpoint already does no harm. The log is not truncated.
+ */
+class Logger : public Singleton<Logger> {
+ public:
+  // Number of bytes appended to the log since the process started
+  using LogPosition = uint64_t;
+
+  // Appends to @param file_path, which is created if it does not exist
+  void enable(const std::string& file_path);
+
+  // Flushes the log and closes the file
+  void disable();
+
+  bool is_enabled() const;
+
+  // Called by Insert and Delete when they commit their records
+  void log_insert(const TransactionID transaction_id, const std::string& table_name, const RowID row_id,
+                  const std::vector<AllTypeVariant>& values);
+  void log_delete(const TransactionID transaction_id, const std::string& table_name, const RowID row_id);
+
+  /**
+   * Appends the records of the transaction and its commit record to the log buffer. Returns the position up to which
+   * the log has to be durable for the transaction to be durable. Must be called on the thread that logged the records.
+   */
+  LogPosition log_commit(const TransactionID transaction_id, const CommitID commit_id);
+
+  // Called by the TransactionContext once a logged transaction is visible to new transactions
+  void on_published(const TransactionID transaction_id);
+
+  // Position up to which transactions have been logged. Changes visible to new transactions are durable from there on.
+  LogPosition buffered_position();
+
+  // Calls @param callback once the log is durable up to @param position, right away if it already is
+  void on_durable(const LogPosition position, const std::function<void()>& callback);
+
+  // Writes the log buffer to the file and fsyncs it. Usually done by the flush thread.
+  void flush();
+
+  /**
+   * Replays the committed transactions logged in @param file_path into the tables of the StorageManager. A truncated
+   * last record, e.g., of a crash during a write, is ignored. Returns the number of replayed transactions.
+   */
+  static size_t recover(const std::string& file_path);
+
+  // Writes a checkpoint of all tables to @param directory, see Checkpoint
+  void checkpoint(const std::string& directory);
+
+  // Writes a checkpoint every @param interval until the Logger is disabled
+  void start_checkpointing(const std::string& directory, const std::chrono::milliseconds interval);
+
+  /**
+   * Loads the current checkpoint of @param checkpoint_directory and replays the transactions of @param log_file_path
+   * that might be missing in it. Returns the number of replayed transactions.
+   */
+  static size_t recover_from_checkpoint(const std::string& checkpoint_directory, const std::string& log_file_path);
+
+  Logger(Logger&&) = delete;
+
+ protected:
+  Logger() = default;
+  ~Logger() override;
+
+  friend class Singleton;
+
+  void _flush_loop();
+
+  static size_t _replay(const std::string& file_path, const uint64_t log_offset);
+
+  std::atomic_bool _is_enabled{false};
+
+  // Guards the log buffer, the positions, _unpublished_transactions, and _stop_requested
+  std::mutex _buffer_mutex;
+  std::condition_variable _buffer_condition;
+  std::vector<char> _buffer;
+  LogPosition _buffered_position{0};
+  bool _stop_requested{false};
+
+  // Maps positions to offsets in the file, which might have held a log before it was enabled
+  LogPosition _position_at_enable{0};
+  uint64_t _file_offset_at_enable{0};
+
+  // Start positions of the logged transactions that are not visible yet
+  std::unordered_map<TransactionID, LogPosition> _unpublished_transactions;
+
+  // Serializes the writes to the file
+  std::mutex _file_mutex;
+  int _file_descriptor{-1};
+
+  // Guards the callbacks and _durable_position, so that no callback is added after the flush that would call it
+  std::mutex _callbacks_mutex;
+  LogPosition _durable_position{0};
+  std::multimap<LogPosition, std::function<void()>> _callbacks;
+
+  std::thread _flush_thread;
+  std::unique_ptr<PausableLoopThread> _checkpoint_thread;
+};
+
+}  // namespace opossum
@@ -23,6 +23,7 @@ enum class LQPNodeType {
   DropTable,
   DummyTable,
   Insert,
+  IntermediateResult,
   Join,
   Limit,
   Predicate,
@@ -35,6 +36,7 @@ enum class LQPNodeType {
   Update,
   Union,
   Validate,
+  Window,
   Mock
 };
 
@@ -9,6 +9,7 @@
 
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "resolve_type.hpp"
 #include "statistics/column_statistics.hpp"
 #include "statistics/table_statistics.hpp"
@@ -62,7 +63,27 @@ std::shared_ptr<TableStatistics> AggregateNode::derive_statistics_from(
   DebugAssert(left_input && !right_input, "AggregateNode need left_input and no right_input");
 
   const auto input_statistics = left_input->get_statistics();
-  const auto row_count = input_statistics->row_count();
+
+  // Each group yields one row, without GROUP BY there is a single group. The number of groups is bounded by the product
+  // of the distinct counts of the group by columns, assuming that they are independent.
+  auto row_count = aggregate_expressions_begin_idx == 0 ? 1.0f : input_statistics->row_count();
+  auto group_count = 1.0f;
+  for (auto expression_idx = size_t{0}; expression_idx < aggregate_expressions_begin_idx; ++expression_idx) {
+    const auto column_id = left_input->find_column_id(*node_expressions[expression_idx]);
+    if (!column_id) {
+      group_count = row_count;
+      break;
+    }
+    group_count *= input_statistics->column_statistics()[*column_id]->distinct_count();
+  }
+  row_count = std::min(row_count, group_count);
+
+  // If the group by expressions are unique (e.g., they contain a primary key), each row forms a group of its own
+  const auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>(
+      node_expressions.cbegin(), node_expressions.cbegin() + aggregate_expressions_begin_idx);
+  if (!group_by_expressions.empty() && lqp_expressions_are_unique(left_input, group_by_expressions)) {
+    row_count = input_statistics->row_count();
+  }
 
   std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
   column_statistics.reserve(node_expressions.size());
@@ -0,0 +1,72 @@
+#include "intermediate_result_node.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lqp_utils.hpp"
+#include "resolve_type.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IntermediateResultNode::IntermediateResultNode(const std::shared_ptr<AbstractLQPNode>& replaced_node,
+                                               const std::shared_ptr<const Table>& table)
+    : AbstractLQPNode(LQPNodeType::IntermediateResult), replaced_node(replaced_node), table(table) {
+  Assert(replaced_node && table, "IntermediateResultNode needs the node it replaces and a table");
+  Assert(table->column_count() == replaced_node->column_expressions().size(),
+         "Table does not match the column expressions of the replaced node");
+}
+
+std::string IntermediateResultNode::description() const {
+  return "[IntermediateResult] " + std::to_string(table->row_count()) + " rows";
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& IntermediateResultNode::column_expressions() const {
+  return replaced_node->column_expressions();
+}
+
+std::shared_ptr<TableStatistics> IntermediateResultNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(!left_input && !right_input, "IntermediateResultNode must not have inputs");
+
+  const auto row_count = static_cast<float>(table->row_count());
+  const auto estimated_statistics = replaced_node->get_statistics();
+
+  // Keep the estimated distributions of the values, but no column can have more distinct values than rows
+  auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{};
+  column_statistics.reserve(estimated_statistics->column_statistics().size());
+  for (const auto& estimated_column_statistics : estimated_statistics->column_statistics()) {
+    resolve_data_type(estimated_column_statistics->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto& typed_statistics = static_cast<const ColumnStatistics<ColumnDataType>&>(*estimated_column_statistics);
+      column_statistics.emplace_back(std::make_shared<ColumnStatistics<ColumnDataType>>(
+          typed_statistics.null_value_ratio(), std::min(typed_statistics.distinct_count(), row_count),
+          typed_statistics.min(), typed_statistics.max()));
+    });
+  }
+
+  return std::make_shared<TableStatistics>(table->type(), row_count, column_statistics);
+}
+
+std::shared_ptr<AbstractLQPNode> IntermediateResultNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  // The copy shares the replaced sub-plan, so expressions referencing it have to remain unchanged when they are
+  // adapted to the copied LQP
+  visit_lqp(replaced_node, [&](const auto& node) {
+    node_mapping.emplace(node, node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  return IntermediateResultNode::make(replaced_node, table);
+}
+
+bool IntermediateResultNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& intermediate_result_node = static_cast<const IntermediateResultNode&>(rhs);
+  return table == intermediate_result_node.table && replaced_node == intermediate_result_node.replaced_node;
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Node that represents the already computed result of a sub-plan of an LQP, i.e., of the `replaced_node` and its
+ * inputs. It is created during mid-query reoptimization (see ReoptimizingExecutor), when the LQP is executed up to a
+ * pipeline breaker and the sub-plan is replaced with its result.
+ *
+ * To the nodes above it, the node looks like the replaced node: It has the same column expressions, so that
+ * expressions referencing the replaced sub-plan remain valid. Its statistics are those estimated for the replaced node,
+ * but with the actual row count of the result.
+ */
+class IntermediateResultNode : public EnableMakeForLQPNode<IntermediateResultNode>, public AbstractLQPNode {
+ public:
+  IntermediateResultNode(const std::shared_ptr<AbstractLQPNode>& replaced_node,
+                         const std::shared_ptr<const Table>& table);
+
+  std::string description() const override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
+
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input = nullptr) const override;
+
+  // The (still connected) sub-plan that computed `table`. Its nodes are referenced by the column expressions.
+  const std::shared_ptr<AbstractLQPNode> replaced_node;
+
+  const std::shared_ptr<const Table> table;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+};
+
+}  // namespace opossum
@@ -5,16 +5,22 @@
 #include <boost/range/adaptors.hpp>
 #include <boost/range/combine.hpp>
 
+#include <optional>
 #include <queue>
 #include <unordered_set>
+#include <utility>
 
 #include "constant_mappings.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/arithmetic_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
 #include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
@@ -22,11 +28,17 @@
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+#include "operators/jit_operator/operators/jit_limit.hpp"
+#include "operators/jit_operator/operators/jit_read_deferred_columns.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
+#include "operators/jit_operator/specialization/jit_object_cache.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 
 using namespace std::string_literals;  // NOLINT
@@ -59,6 +71,9 @@ const std::unordered_map<ArithmeticOperator, JitExpressionType> arithmetic_opera
 const std::unordered_map<LogicalOperator, JitExpressionType> logical_operator_to_jit_expression = {
     {LogicalOperator::And, JitExpressionType::And}, {LogicalOperator::Or, JitExpressionType::Or}};
 
+// Loading machine code from the JitObjectCache skips code generation, but the pipeline is still specialized
+constexpr auto CACHED_COMPILATION_COST_FACTOR = 0.5f;
+
 bool requires_computation(const std::shared_ptr<AbstractLQPNode>& node) {
   // do not count trivial projections without computations
   if (const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(node)) {
@@ -74,6 +89,8 @@ bool requires_computation(const std::shared_ptr<AbstractLQPNode>& node) {
 
 namespace opossum {
 
+JitAwareLQPTranslator::JitAwareLQPTranslator(const float min_pipeline_work) : _min_pipeline_work(min_pipeline_work) {}
+
 std::shared_ptr<AbstractOperator> JitAwareLQPTranslator::translate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   // Jit operators materialize their output table and cannot be used in non-select queries
@@ -90,16 +107,38 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
 
   auto input_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
 
+  // At most one JoinNode is integrated into the operator chain as a JitHashJoinProbe. Its left input is part of the
+  // chain, its right input is the build side, which is translated separately.
+  auto join_node = std::shared_ptr<JoinNode>{};
+
   bool use_validate = false;
   bool validate_after_filter = false;
+  bool validate_above_join = false;
+  auto validate_node_count = size_t{0};
+
+  // Number of jittable nodes and expression nodes each tuple passes through, see the cost model in the header
+  auto per_tuple_work = size_t{0};
 
   // Traverse query tree until a non-jittable nodes is found in each branch
   _visit(node, [&](auto& current_node) {
+    if (join_node && current_node == join_node->right_input()) return false;
+
     const auto is_root_node = current_node == node;
-    if (_node_is_jittable(current_node, is_root_node)) {
+    const auto is_second_join = join_node && current_node->type == LQPNodeType::Join;
+    if (!is_second_join && _node_is_jittable(current_node, is_root_node)) {
+      if (current_node->type == LQPNodeType::Join) join_node = std::static_pointer_cast<JoinNode>(current_node);
+      validate_above_join |= !join_node && current_node->type == LQPNodeType::Validate;
       use_validate |= current_node->type == LQPNodeType::Validate;
+      if (current_node->type == LQPNodeType::Validate) ++validate_node_count;
       validate_after_filter |= use_validate && current_node->type == LQPNodeType::Predicate;
       if (requires_computation(current_node)) ++jittable_node_count;
+      ++per_tuple_work;
+      for (const auto& expression : current_node->node_expressions) {
+        visit_expression(expression, [&](const auto&) {
+          ++per_tuple_work;
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
       return true;
     } else {
       input_nodes.insert(current_node);
@@ -111,45 +150,117 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
   //   - If there is more than one input node, don't JIT
   //   - Always JIT AggregateNodes, as the JitAggregate is significantly faster than the Aggregate operator
   //   - Otherwise, JIT if there are two or more jittable nodes
+  //   - A join on its own (or with validation only) is left to the join operators, a JitHashJoinProbe only pays off
+  //     if it is fused with the operators that consume its output or produce its input
   if (input_nodes.size() != 1 || jittable_node_count < 1) return nullptr;
-  if (jittable_node_count == 1 && (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Validate)) {
+  if (jittable_node_count == 1 && (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Validate ||
+                                   node->type == LQPNodeType::Limit)) {
     return nullptr;
   }
+  if (join_node && jittable_node_count - validate_node_count < 2) return nullptr;
+
+  // A JitValidate only validates the rows of the probe side, which is not sufficient for a ValidateNode above the join
+  if (join_node && validate_above_join) return nullptr;
 
   // The input_node is not being integrated into the operator chain, but instead serves as the input to the JitOperators
   const auto input_node = *input_nodes.begin();
+  const auto build_node = join_node ? join_node->right_input() : nullptr;
+
+  if (_min_pipeline_work > 0.0f) {
+    auto pipeline_work = input_node->get_statistics()->row_count() * static_cast<float>(per_tuple_work);
+    // Building the hash table of a JitHashJoinProbe touches every row of the build side once
+    if (build_node) pipeline_work += build_node->get_statistics()->row_count();
+
+    auto min_pipeline_work = _min_pipeline_work;
+    if (!JitObjectCache::get().directory().empty()) min_pipeline_work *= CACHED_COMPILATION_COST_FACTOR;
+    if (pipeline_work < min_pipeline_work) return nullptr;
+  }
 
-  const auto jit_operator = std::make_shared<JitOperatorWrapper>(translate_node(input_node));
+  const auto jit_operator = std::make_shared<JitOperatorWrapper>(
+      translate_node(input_node), JitExecutionMode::Compile, std::vector<std::shared_ptr<AbstractJittable>>{},
+      build_node ? translate_node(build_node) : nullptr);
   const auto read_tuples = std::make_shared<JitReadTuples>(use_validate);
   jit_operator->add_jit_operator(read_tuples);
 
-  // "filter_node". The root node of the subplan computed by a JitFilter.
-  auto filter_node = node;
-  while (filter_node != input_node && filter_node->type != LQPNodeType::Predicate &&
-         filter_node->type != LQPNodeType::Union) {
-    filter_node = filter_node->left_input();
-  }
+  const auto join_probe = join_node ? std::make_shared<JitHashJoinProbe>() : nullptr;
+
+  // Position after the last operator that discards rows (i.e., a JitFilter or the JitHashJoinProbe) and the number of
+  // input columns used up to this operator. The input columns that are added later are only used by the operators after
+  // it and are deferred, so that they are only read for the rows that pass it.
+  auto deferred_read_position = std::optional<size_t>{};
+  auto eager_input_column_count = size_t{0};
+  const auto mark_deferred_read_position = [&]() {
+    deferred_read_position = jit_operator->jit_operators().size();
+    eager_input_column_count = read_tuples->input_columns().size();
+  };
+
+  // Adds a JitFilter for the predicates between root_node and bottom_node (exclusively)
+  const auto add_filter = [&](const std::shared_ptr<AbstractLQPNode>& root_node,
+                              const std::shared_ptr<AbstractLQPNode>& bottom_node) {
+    // "filter_node". The root node of the subplan computed by a JitFilter.
+    auto filter_node = root_node;
+    while (filter_node != bottom_node && filter_node->type != LQPNodeType::Predicate &&
+           filter_node->type != LQPNodeType::Union) {
+      filter_node = filter_node->left_input();
+    }
 
-  if (use_validate && !validate_after_filter) jit_operator->add_jit_operator(std::make_shared<JitValidate>());
+    // If we can reach the bottom node without encountering a UnionNode or PredicateNode,
+    // there is no need to filter any tuples
+    if (filter_node == bottom_node) return true;
 
-  // If we can reach the input node without encountering a UnionNode or PredicateNode,
-  // there is no need to filter any tuples
-  if (filter_node != input_node) {
     const auto boolean_expression = lqp_subplan_to_boolean_expression(filter_node);
-    if (!boolean_expression) return nullptr;
+    if (!boolean_expression) return false;
 
-    const auto jit_boolean_expression =
-        _try_translate_expression_to_jit_expression(*boolean_expression, *read_tuples, input_node);
-    if (!jit_boolean_expression) return nullptr;
+    const auto jit_boolean_expression = _try_translate_expression_to_jit_expression(
+        *boolean_expression, *read_tuples, input_node, join_probe, build_node);
+    if (!jit_boolean_expression) return false;
 
     // make sure that the expression gets computed ...
     jit_operator->add_jit_operator(std::make_shared<JitCompute>(jit_boolean_expression));
     // and then filter on the resulting boolean.
     jit_operator->add_jit_operator(std::make_shared<JitFilter>(jit_boolean_expression->result()));
-  }
+    mark_deferred_read_position();
+    return true;
+  };
+
+  if (use_validate && !validate_after_filter) jit_operator->add_jit_operator(std::make_shared<JitValidate>());
+
+  // Without a join, all predicates are below the root node. With a join, the predicates on the probe side are
+  // evaluated before and the remaining predicates after probing (lqp_subplan_to_boolean_expression stops at joins).
+  if (join_node && !add_filter(join_node->left_input(), input_node)) return nullptr;
+  if (!join_node && !add_filter(node, input_node)) return nullptr;
 
   if (use_validate && validate_after_filter) jit_operator->add_jit_operator(std::make_shared<JitValidate>());
 
+  if (join_node) {
+    const auto join_predicate = std::static_pointer_cast<BinaryPredicateExpression>(join_node->join_predicate());
+    auto probe_key = join_predicate->left_operand();
+    auto build_key = join_predicate->right_operand();
+    if (!join_node->left_input()->find_column_id(*probe_key)) std::swap(probe_key, build_key);
+
+    const auto build_column_id = build_node->find_column_id(*build_key);
+    if (!build_column_id) return nullptr;
+
+    const auto jit_probe_key = _try_translate_expression_to_jit_expression(*probe_key, *read_tuples, input_node);
+    if (!jit_probe_key) return nullptr;
+    if (jit_probe_key->expression_type() != JitExpressionType::Column) {
+      jit_operator->add_jit_operator(std::make_shared<JitCompute>(jit_probe_key));
+    }
+
+    join_probe->add_key_column(jit_probe_key->result(), *build_column_id);
+    jit_operator->add_jit_operator(join_probe);
+    mark_deferred_read_position();
+
+    if (!add_filter(node, join_node)) return nullptr;
+  }
+
+  if (node->type == LQPNodeType::Limit) {
+    // The limit applies to the rows that pass all filters, but before the output columns are computed
+    const auto& num_rows_expression = *std::static_pointer_cast<LimitNode>(node)->num_rows_expression();
+    const auto num_rows = type_cast_variant<int64_t>(static_cast<const ValueExpression&>(num_rows_expression).value);
+    jit_operator->add_jit_operator(std::make_shared<JitLimit>(static_cast<size_t>(num_rows)));
+  }
+
   if (node->type == LQPNodeType::Aggregate) {
     // Since aggregate nodes cause materialization, there is at most one JitAggregate operator in each operator chain
     // and it must be the last operator of the chain. The _node_is_jittable function takes care of this by rejecting
@@ -162,7 +273,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
          ++expression_idx) {
       const auto& groupby_expression = aggregate_node->node_expressions[expression_idx];
       const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*groupby_expression, *read_tuples, input_node);
+          _try_translate_expression_to_jit_expression(*groupby_expression, *read_tuples, input_node,
+                                                      join_probe, build_node);
       if (!jit_expression) return nullptr;
       // Create a JitCompute operator for each computed groupby column ...
       if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -178,8 +290,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
       const auto aggregate_expression = std::dynamic_pointer_cast<AggregateExpression>(expression);
       DebugAssert(aggregate_expression, "Expression is not a function.");
 
-      const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*aggregate_expression->arguments[0], *read_tuples, input_node);
+      const auto jit_expression = _try_translate_expression_to_jit_expression(
+          *aggregate_expression->arguments[0], *read_tuples, input_node, join_probe, build_node);
       if (!jit_expression) return nullptr;
       // Create a JitCompute operator for each aggregate expression on a computed value ...
       if (jit_expression->expression_type() != JitExpressionType::Column) {
@@ -195,8 +307,8 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
     // Add a compute operator for each computed output column (i.e., a column that is not from a stored table).
     auto write_table = std::make_shared<JitWriteTuples>();
     for (const auto& column_expression : node->column_expressions()) {
-      const auto jit_expression =
-          _try_translate_expression_to_jit_expression(*column_expression, *read_tuples, input_node);
+      const auto jit_expression = _try_translate_expression_to_jit_expression(*column_expression, *read_tuples,
+                                                                              input_node, join_probe, build_node);
       if (!jit_expression) return nullptr;
       // If the JitExpression is of type JitExpressionType::Column, there is no need to add a compute node, since it
       // would not compute anything anyway
@@ -209,12 +321,23 @@ std::shared_ptr<JitOperatorWrapper> JitAwareLQPTranslator::_try_translate_sub_pl
     jit_operator->add_jit_operator(write_table);
   }
 
-  return jit_operator;
+  const auto input_columns = read_tuples->input_columns();
+  if (!deferred_read_position || eager_input_column_count == input_columns.size()) return jit_operator;
+
+  for (auto index = eager_input_column_count; index < input_columns.size(); ++index) {
+    read_tuples->defer_input_column(input_columns[index].column_id);
+  }
+
+  auto jit_operators = jit_operator->jit_operators();
+  jit_operators.insert(jit_operators.begin() + *deferred_read_position, std::make_shared<JitReadDeferredColumns>());
+  return std::make_shared<JitOperatorWrapper>(jit_operator->input_left(), JitExecutionMode::Compile, jit_operators,
+                                              jit_operator->input_right());
 }
 
 std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expression_to_jit_expression(
     const AbstractExpression& expression, JitReadTuples& jit_source,
-    const std::shared_ptr<AbstractLQPNode>& input_node) const {
+    const std::shared_ptr<AbstractLQPNode>& input_node, const std::shared_ptr<JitHashJoinProbe>& join_probe,
+    const std::shared_ptr<AbstractLQPNode>& build_node) const {
   const auto input_node_column_id = input_node->find_column_id(expression);
   if (input_node_column_id) {
     const auto tuple_value =
@@ -222,6 +345,19 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
     return std::make_shared<JitExpression>(tuple_value);
   }
 
+  // Columns of the build side are copied to the runtime tuple by the JitHashJoinProbe
+  if (join_probe) {
+    if (const auto build_column_id = build_node->find_column_id(expression)) {
+      if (const auto tuple_value = join_probe->find_build_column(*build_column_id)) {
+        return std::make_shared<JitExpression>(*tuple_value);
+      }
+      const auto tuple_value = join_probe->add_build_column(
+          *build_column_id,
+          JitTupleValue(expression.data_type(), expression.is_nullable(), jit_source.add_temporary_value()));
+      return std::make_shared<JitExpression>(tuple_value);
+    }
+  }
+
   std::shared_ptr<const JitExpression> left, right;
   switch (expression.type) {
     case ExpressionType::Value: {
@@ -239,7 +375,8 @@ std::shared_ptr<const JitExpression> JitAwareLQPTranslator::_try_translate_expre
     case ExpressionType::Logical: {
       std::vector<std::shared_ptr<const JitExpression>> jit_expression_arguments;
       for (const auto& argument : expression.arguments) {
-        const auto jit_expression = _try_translate_expression_to_jit_expression(*argument, jit_source, input_node);
+        const auto jit_expression =
+            _try_translate_expression_to_jit_expression(*argument, jit_source, input_node, join_probe, build_node);
         if (!jit_expression) return nullptr;
         jit_expression_arguments.emplace_back(jit_expression);
       }
@@ -288,9 +425,10 @@ bool JitAwareLQPTranslator::_node_is_jittable(const std::shared_ptr<AbstractLQPN
         expressions.begin() + aggregate_node->aggregate_expressions_begin_idx, expressions.end(), [](auto& expression) {
           const auto aggregate_expression = std::dynamic_pointer_cast<AggregateExpression>(expression);
           Assert(aggregate_expression, "Expected AggregateExpression");
-          // Right now, the JIT doesn't support CountDistinct and Count(*) (which can be recognized by an empty
-          // argument list)
+          // Right now, the JIT doesn't support (approximate) CountDistinct and Count(*) (which can be recognized by an
+          // empty argument list)
           return aggregate_expression->aggregate_function == AggregateFunction::CountDistinct ||
+                 aggregate_expression->aggregate_function == AggregateFunction::ApproxCountDistinct ||
                  aggregate_expression->arguments.empty();
         });
     return allow_aggregate_node && !has_unsupported_aggregate;
@@ -300,6 +438,24 @@ bool JitAwareLQPTranslator::_node_is_jittable(const std::shared_ptr<AbstractLQPN
     return predicate_node->scan_type == ScanType::TableScan;
   }
 
+  if (const auto limit_node = std::dynamic_pointer_cast<LimitNode>(node)) {
+    // Like aggregates, a limit applies to the output of the whole operator chain and must thus be its last node. The
+    // number of rows has to be known when the chain is built.
+    const auto num_rows_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression());
+    if (!allow_aggregate_node || !num_rows_expression || variant_is_null(num_rows_expression->value)) return false;
+    const auto data_type = num_rows_expression->data_type();
+    if (data_type != DataType::Int && data_type != DataType::Long) return false;
+    return type_cast_variant<int64_t>(num_rows_expression->value) >= 0;
+  }
+
+  if (auto join_node = std::dynamic_pointer_cast<JoinNode>(node)) {
+    // The JitHashJoinProbe supports inner equi joins on keys of the same data type
+    if (join_node->join_mode != JoinMode::Inner) return false;
+    const auto join_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicate());
+    return join_predicate && join_predicate->predicate_condition == PredicateCondition::Equals &&
+           join_predicate->left_operand()->data_type() == join_predicate->right_operand()->data_type();
+  }
+
   return node->type == LQPNodeType::Projection || node->type == LQPNodeType::Union ||
          node->type == LQPNodeType::Validate;
 }
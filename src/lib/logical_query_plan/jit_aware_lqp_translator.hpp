@@ -5,6 +5,7 @@
 #if HYRISE_JIT_SUPPORT
 
 #include "operators/jit_operator/operators/jit_expression.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
 #include "operators/jit_operator_wrapper.hpp"
 
 namespace opossum {
@@ -32,13 +33,27 @@ namespace opossum {
  *    The output columns are determined by the top-most ProjectionNode. If there is no ProjectionNode, all columns from
  *    the input node are considered as outputs.
  *    In case we find any PredicateNode or UnionNode during our traversal, we need to create a JitFilter operator.
+ *    An inner equi JoinNode can be part of the chain as well. Its left input continues the chain (the probe side), its
+ *    right input is translated separately and becomes the build side of a JitHashJoinProbe. Columns of the build side
+ *    are registered with the JitHashJoinProbe, which copies them to the runtime tuple for each join partner.
+ *    A LimitNode with a constant number of rows at the top of the chain becomes a JitLimit, which stops the execution
+ *    once enough rows passed the filters.
  *    Whenever a non-primitive value (such as a predicate conditions, LQPExpression of LQPColumnReferences - which
  *    can in turn reference a LQPExpression in a ProjectionNode) is encountered, it is converted to an JitExpression
  *    by a helper method first. We then add a JitCompute operator to our chain and use its result value instead of the
  *    original non-primitive value.
+ *
+ * Jitting only pays off if the pipeline processes enough tuples to amortize the time needed to specialize and compile
+ * it. The work of a pipeline is estimated from the TableStatistics as the number of input rows times the number of
+ * jittable nodes and expression nodes each row passes through. Pipelines estimated to do less work than
+ * min_pipeline_work are left to the regular operators. If the JitObjectCache is enabled, machine code is likely to be
+ * loaded from the cache instead of being compiled, so the threshold is lowered accordingly.
  */
 class JitAwareLQPTranslator final : public LQPTranslator {
  public:
+  // With the default of zero, every eligible subplan is jitted
+  explicit JitAwareLQPTranslator(const float min_pipeline_work = 0.0f);
+
   std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const final;
 
  private:
@@ -47,7 +62,9 @@ class JitAwareLQPTranslator final : public LQPTranslator {
 
   std::shared_ptr<const JitExpression> _try_translate_expression_to_jit_expression(
       const AbstractExpression& expression, JitReadTuples& jit_source,
-      const std::shared_ptr<AbstractLQPNode>& input_node) const;
+      const std::shared_ptr<AbstractLQPNode>& input_node,
+      const std::shared_ptr<JitHashJoinProbe>& join_probe = nullptr,
+      const std::shared_ptr<AbstractLQPNode>& build_node = nullptr) const;
 
   // Returns whether an LQP node with its current configuration can be part of an operator pipeline.
   bool _node_is_jittable(const std::shared_ptr<AbstractLQPNode>& node, const bool allow_aggregate_node) const;
@@ -58,6 +75,8 @@ class JitAwareLQPTranslator final : public LQPTranslator {
               const std::function<bool(const std::shared_ptr<AbstractLQPNode>&)>& func) const;
 
   static JitExpressionType _expression_to_jit_expression_type(const AbstractExpression& expression);
+
+  const float _min_pipeline_work;
 };
 
 }  // namespace opossum
@@ -68,7 +87,7 @@ namespace opossum {
 
 class JitAwareLQPTranslator final : public LQPTranslator {
  public:
-  [[noreturn]] JitAwareLQPTranslator() {
+  [[noreturn]] explicit JitAwareLQPTranslator(const float min_pipeline_work = 0.0f) {
     Fail("Query translation with JIT operators requested, but jitting is not available");
   }
 };
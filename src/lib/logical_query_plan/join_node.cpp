@@ -1,5 +1,6 @@
 #include "join_node.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -13,6 +14,7 @@
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "types.hpp"
@@ -80,9 +82,33 @@ std::shared_ptr<TableStatistics> JoinNode::derive_statistics_from(
     // TODO(anybody) (Complex) predicate we can't build statistics for
     if (!operator_join_predicate) return cross_join_statistics;
 
-    return std::make_shared<TableStatistics>(left_input->get_statistics()->estimate_predicated_join(
+    const auto join_statistics = left_input->get_statistics()->estimate_predicated_join(
         *right_input->get_statistics(), join_mode, operator_join_predicate->column_ids,
-        operator_join_predicate->predicate_condition));
+        operator_join_predicate->predicate_condition);
+
+    // If the join column of one input is unique (e.g., a primary key), each row of the other input has at most one
+    // partner in an inner equi-join
+    if (join_mode == JoinMode::Inner && operator_join_predicate->predicate_condition == PredicateCondition::Equals) {
+      const auto& join_predicate_expression = static_cast<const BinaryPredicateExpression&>(*join_predicate());
+      auto max_row_count = std::numeric_limits<float>::infinity();
+      for (const auto& join_operand :
+           {join_predicate_expression.left_operand(), join_predicate_expression.right_operand()}) {
+        if (expression_evaluable_on_lqp(join_operand, *right_input) &&
+            lqp_expressions_are_unique(right_input, {join_operand})) {
+          max_row_count = std::min(max_row_count, left_input->get_statistics()->row_count());
+        } else if (expression_evaluable_on_lqp(join_operand, *left_input) &&
+                   lqp_expressions_are_unique(left_input, {join_operand})) {
+          max_row_count = std::min(max_row_count, right_input->get_statistics()->row_count());
+        }
+      }
+
+      if (join_statistics.row_count() > max_row_count) {
+        return std::make_shared<TableStatistics>(join_statistics.table_type(), max_row_count,
+                                                 join_statistics.column_statistics());
+      }
+    }
+
+    return std::make_shared<TableStatistics>(join_statistics);
   }
 }
 
@@ -1,8 +1,14 @@
 #include "lqp_translator.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "abstract_lqp_node.hpp"
@@ -22,22 +28,29 @@
 #include "expression/expression_utils.hpp"
 #include "expression/is_null_expression.hpp"
 #include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_select_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/pqp_select_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "expression/window_function_expression.hpp"
 #include "insert_node.hpp"
+#include "intermediate_result_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/delete.hpp"
+#include "operators/distinct.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
-#include "operators/join_sort_merge.hpp"
+#include "operators/join_iejoin.hpp"
+#include "operators/join_partition_wise.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
@@ -56,15 +69,20 @@
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "operators/window_function_evaluator.hpp"
 #include "predicate_node.hpp"
 #include "projection_node.hpp"
 #include "show_columns_node.hpp"
 #include "sort_node.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "stored_table_node.hpp"
+#include "type_cast.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 #include "validate_node.hpp"
+#include "window_node.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
@@ -93,11 +111,99 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
     return operator_iter->second;
   }
 
-  const auto pqp = _translate_by_node_type(node->type, node);
+  /**
+   * Beyond that, structurally equal subplans (e.g., of a view or a filtered table that the query uses several times)
+   * are translated only once and share their operator. Operators that were adapted to a single consumer are not
+   * shared, see _exclusive_lqp_nodes.
+   */
+  const auto is_shareable = _is_shareable(node);
+  if (is_shareable) {
+    const auto candidates_iter = _shareable_lqp_nodes_by_hash.find(_structural_hash(node));
+    if (candidates_iter != _shareable_lqp_nodes_by_hash.end()) {
+      for (const auto& candidate : candidates_iter->second) {
+        if (_exclusive_lqp_nodes.count(candidate) || !(*candidate == *node)) continue;
+
+        const auto shared_operator = _operator_by_lqp_node.at(candidate);
+        _shared_operators.emplace(shared_operator);
+        _operator_by_lqp_node.emplace(node, shared_operator);
+        return shared_operator;
+      }
+    }
+  }
+
+  const auto pqp =
+      _recycling_snapshot_commit_id ? _translate_or_recycle(node) : _translate_by_node_type(node->type, node);
+  // A node might be translated into an operator of one of its inputs, which keeps describing that input
+  if (!pqp->lqp_node) pqp->lqp_node = node;
   _operator_by_lqp_node.emplace(node, pqp);
+  if (is_shareable) _shareable_lqp_nodes_by_hash[_structural_hash(node)].emplace_back(node);
   return pqp;
 }
 
+void LQPTranslator::enable_recycling(const CommitID snapshot_commit_id) {
+  _recycling_snapshot_commit_id = snapshot_commit_id;
+}
+
+LQPTranslator::RecyclingReport LQPTranslator::disable_recycling() {
+  _recycling_snapshot_commit_id.reset();
+  return std::exchange(_recycling_report, RecyclingReport{});
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_or_recycle(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (!IntermediateResultRecycler::is_recyclable(node)) return _translate_by_node_type(node->type, node);
+
+  auto subplan = IntermediateResultRecycler::capture_subplan(node);
+  if (const auto recycled_table = IntermediateResultRecycler::get().try_get(subplan, *_recycling_snapshot_commit_id)) {
+    _recycling_report.uses_recycled_results = true;
+    return std::make_shared<TableWrapper>(recycled_table);
+  }
+
+  const auto pqp = _translate_by_node_type(node->type, node);
+  _recycling_report.candidates.emplace_back(RecyclingCandidate{std::move(subplan), pqp});
+  return pqp;
+}
+
+bool LQPTranslator::_is_shareable(const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (_exclusive_lqp_nodes.count(node)) return false;
+
+  // Only nodes that read data are shared, e.g., two equal Inserts have to insert twice
+  switch (node->type) {
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::Alias:
+    case LQPNodeType::Join:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::Union:
+    case LQPNodeType::Validate:
+    case LQPNodeType::Window:
+      return true;
+    default:
+      return false;
+  }
+}
+
+size_t LQPTranslator::_structural_hash(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto hash_iter = _structural_hash_by_lqp_node.find(node);
+  if (hash_iter != _structural_hash_by_lqp_node.end()) return hash_iter->second;
+
+  // The expressions are not hashed, as column expressions of equal subplans reference different, but equal nodes. Nodes
+  // with equal hashes are compared with operator==.
+  auto hash = boost::hash_value(static_cast<size_t>(node->type));
+  boost::hash_combine(hash, node->node_expressions.size());
+  if (node->type == LQPNodeType::StoredTable) {
+    boost::hash_combine(hash, std::static_pointer_cast<StoredTableNode>(node)->table_name);
+  }
+  if (node->left_input()) boost::hash_combine(hash, _structural_hash(node->left_input()));
+  if (node->right_input()) boost::hash_combine(hash, _structural_hash(node->right_input()));
+
+  _structural_hash_by_lqp_node.emplace(node, hash);
+  return hash;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     LQPNodeType type, const std::shared_ptr<AbstractLQPNode>& node) const {
   switch (type) {
@@ -113,9 +219,11 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
     case LQPNodeType::Insert:             return _translate_insert_node(node);
     case LQPNodeType::Delete:             return _translate_delete_node(node);
     case LQPNodeType::DummyTable:         return _translate_dummy_table_node(node);
+    case LQPNodeType::IntermediateResult: return _translate_intermediate_result_node(node);
     case LQPNodeType::Update:             return _translate_update_node(node);
     case LQPNodeType::Validate:           return _translate_validate_node(node);
     case LQPNodeType::Union:              return _translate_union_node(node);
+    case LQPNodeType::Window:             return _translate_window_node(node);
 
       // Maintenance operators
     case LQPNodeType::ShowTables:         return _translate_show_tables_node(node);
@@ -137,14 +245,36 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_stored_table_node(
   const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
   const auto get_table = std::make_shared<GetTable>(stored_table_node->table_name);
   get_table->set_excluded_chunk_ids(stored_table_node->excluded_chunk_ids());
+  get_table->set_table_sample(stored_table_node->table_sample());
+
+  const auto join_key_source_iter = _join_key_source_by_lqp_node.find(node);
+  if (join_key_source_iter != _join_key_source_by_lqp_node.end()) {
+    const auto& join_key_source = join_key_source_iter->second;
+    get_table->set_join_key_source(join_key_source.source_operator, join_key_source.source_column_id,
+                                   join_key_source.column_id);
+  }
+
   return get_table;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+
+  if (const auto join_hash = _translate_predicate_node_to_join_hash(predicate_node)) {
+    return join_hash;
+  }
+
+  if (const auto ie_join = _translate_predicate_node_to_ie_join(predicate_node)) {
+    return ie_join;
+  }
+
+  if (const auto fused_table_scan = _translate_predicate_nodes_to_fused_table_scan(predicate_node)) {
+    return fused_table_scan;
+  }
+
   const auto input_node = node->left_input();
   const auto input_operator = translate_node(input_node);
-  const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
 
   switch (predicate_node->scan_type) {
     case ScanType::TableScan:
@@ -156,6 +286,130 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
   Fail("GCC thinks this is reachable");
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_join_hash(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * The SQLTranslator places all but one of the predicates of a join on a composite key (e.g., ON a.x = b.x AND
+   * a.y = b.y) above the JoinNode. If these are equality predicates between the two inputs of an inner equi join, the
+   * JoinHash compares them as part of its join key instead of producing all matches of the first column pair, which
+   * are then scanned. The join and the predicates below this node must not be used by other nodes.
+   */
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{node};
+  while (predicate_nodes.back()->left_input()->type == LQPNodeType::Predicate) {
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(predicate_nodes.back()->left_input()));
+  }
+
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(predicate_nodes.back()->left_input());
+  if (!join_node || join_node->join_mode != JoinMode::Inner) return nullptr;
+
+  const auto join_predicate = OperatorJoinPredicate::from_expression(
+      *join_node->join_predicate(), *join_node->left_input(), *join_node->right_input());
+  if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return nullptr;
+
+  auto additional_column_ids = std::vector<ColumnIDPair>{};
+  for (const auto& predicate_node : predicate_nodes) {
+    if (predicate_node->left_input()->output_count() != 1 || predicate_node->scan_type != ScanType::TableScan) {
+      return nullptr;
+    }
+
+    const auto additional_predicate = OperatorJoinPredicate::from_expression(
+        *predicate_node->predicate(), *join_node->left_input(), *join_node->right_input());
+    if (!additional_predicate || additional_predicate->predicate_condition != PredicateCondition::Equals) {
+      return nullptr;
+    }
+    additional_column_ids.emplace_back(additional_predicate->column_ids);
+  }
+
+  // Restore the order of the predicates in the query
+  std::reverse(additional_column_ids.begin(), additional_column_ids.end());
+
+  return std::make_shared<JoinHash>(translate_node(join_node->left_input()), translate_node(join_node->right_input()),
+                                    JoinMode::Inner, join_predicate->column_ids, PredicateCondition::Equals,
+                                    std::nullopt, additional_column_ids);
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_ie_join(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * Band joins are translated into an inner join on one inequality and a PredicateNode with the other one above it
+   * (ON a.x >= b.begin AND a.x <= b.end), or into a cross join with a PredicateNode above it (WHERE a.x BETWEEN b.begin
+   * AND b.end). Both would produce all pairs of rows that satisfy the first predicate (or all pairs) and then scan
+   * them. A JoinIEJoin evaluates both inequalities instead. The join must not be used by other nodes.
+   */
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(node->left_input());
+  if (!join_node || join_node->output_count() != 1 || node->scan_type != ScanType::TableScan) return nullptr;
+
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  if (join_node->join_mode == JoinMode::Inner) {
+    predicates.emplace_back(join_node->join_predicate());
+    predicates.emplace_back(node->predicate());
+  } else if (join_node->join_mode == JoinMode::Cross) {
+    const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(node->predicate());
+    if (!between_expression) return nullptr;
+
+    predicates.emplace_back(std::make_shared<BinaryPredicateExpression>(
+        PredicateCondition::GreaterThanEquals, between_expression->value(), between_expression->lower_bound()));
+    predicates.emplace_back(std::make_shared<BinaryPredicateExpression>(
+        PredicateCondition::LessThanEquals, between_expression->value(), between_expression->upper_bound()));
+  } else {
+    return nullptr;
+  }
+
+  auto join_predicates = std::vector<OperatorJoinPredicate>{};
+  for (const auto& predicate : predicates) {
+    const auto join_predicate =
+        OperatorJoinPredicate::from_expression(*predicate, *join_node->left_input(), *join_node->right_input());
+    if (!join_predicate || !JoinIEJoin::supports(join_predicate->predicate_condition)) return nullptr;
+
+    // JoinIEJoin requires both columns of a predicate to have the same data type
+    const auto& [left_column_id, right_column_id] = join_predicate->column_ids;
+    if (join_node->left_input()->column_expressions()[left_column_id]->data_type() !=
+        join_node->right_input()->column_expressions()[right_column_id]->data_type()) {
+      return nullptr;
+    }
+
+    join_predicates.emplace_back(*join_predicate);
+  }
+
+  return std::make_shared<JoinIEJoin>(translate_node(join_node->left_input()),
+                                      translate_node(join_node->right_input()), JoinMode::Inner,
+                                      join_predicates[0].column_ids, join_predicates[0].predicate_condition,
+                                      join_predicates[1]);
+}
+
+std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_nodes_to_fused_table_scan(
+    const std::shared_ptr<PredicateNode>& node) const {
+  /**
+   * A chain of PredicateNodes (e.g., from `WHERE a > 5 AND b = 3`) would be translated into one TableScan per
+   * predicate, each of which writes a PosList that the next one has to read. If all of the predicates only look at a
+   * single column, a single TableScan evaluates their conjunction instead (see ConjunctionTableScanImpl). The nodes
+   * below this node must not be used by other nodes.
+   */
+  auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto fused_node = std::shared_ptr<PredicateNode>{};
+  auto next_node = std::shared_ptr<AbstractLQPNode>{node};
+
+  while (next_node->type == LQPNodeType::Predicate && (predicates.empty() || next_node->output_count() == 1)) {
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(next_node);
+    if (predicate_node->scan_type != ScanType::TableScan) break;
+
+    const auto predicate = _translate_expression(predicate_node->predicate(), predicate_node->left_input());
+    if (!TableScan::is_single_column_predicate(predicate)) break;
+
+    predicates.emplace_back(predicate);
+    fused_node = predicate_node;
+    next_node = predicate_node->left_input();
+  }
+
+  if (predicates.size() < 2) return nullptr;
+
+  // Evaluate the predicates in the same order as the chain of TableScans would have, i.e., bottom to top
+  std::reverse(predicates.begin(), predicates.end());
+
+  return std::make_shared<TableScan>(translate_node(fused_node->left_input()),
+                                     inflate_logical_expressions(predicates, LogicalOperator::And));
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_index_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   /**
@@ -196,19 +450,52 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
   const auto table_name = stored_table_node->table_name;
   const auto table = StorageManager::get().get_table(table_name);
+
+  // GetTable outputs a copy of the table if it prunes chunks. The copy has no table index, and its ChunkIDs are those
+  // of the remaining chunks. The chunks of a sample or those pruned by join keys are only known at runtime, so the
+  // indexes cannot be used for them.
+  if (stored_table_node->table_sample() || _join_key_source_by_lqp_node.count(stored_table_node)) {
+    return _translate_predicate_node_to_table_scan(node, input_operator);
+  }
+  const auto& excluded_chunk_ids = stored_table_node->excluded_chunk_ids();
+
+  // A table index covers all chunks, including those that are still being appended to, so no TableScan is needed
+  if (excluded_chunk_ids.empty() && table->get_table_index(column_id) &&
+      BaseTableIndex::supports(predicate->predicate_condition)) {
+    return std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
+                                       predicate->predicate_condition, right_values, right_values2);
+  }
+
+  // HashIndexes are preferred for the predicates they support, as they are cheaper to probe
+  auto index_type = SegmentIndexType::GroupKey;
+  if (BaseIndex::supports(SegmentIndexType::Hash, predicate->predicate_condition)) {
+    for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+      if (table->get_chunk(chunk_id)->get_index(SegmentIndexType::Hash, column_ids)) {
+        index_type = SegmentIndexType::Hash;
+        break;
+      }
+    }
+  }
+
+  // indexed_chunks holds the ChunkIDs of the GetTable output, which skips the excluded chunks
+  const auto excluded_chunks = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
   std::vector<ChunkID> indexed_chunks;
+  auto output_chunk_id = ChunkID{0u};
 
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (excluded_chunks.count(chunk_id)) continue;
+
     const auto chunk = table->get_chunk(chunk_id);
-    if (chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
-      indexed_chunks.emplace_back(chunk_id);
+    if (chunk->get_index(index_type, column_ids)) {
+      indexed_chunks.emplace_back(output_chunk_id);
     }
+    ++output_chunk_id;
   }
 
-  // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
-  // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+  // All chunks that have an index of index_type on column_ids are handled by an IndexScan. All other chunks are
+  // handled by TableScan(s).
+  auto index_scan = std::make_shared<IndexScan>(input_operator, index_type, column_ids, predicate->predicate_condition,
+                                                right_values, right_values2);
 
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
@@ -243,51 +530,110 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_node = node->left_input();
   const auto projection_node = std::dynamic_pointer_cast<ProjectionNode>(node);
+
+  if (const auto index_only_scan = _translate_projection_node_to_index_only_scan(projection_node)) {
+    return index_only_scan;
+  }
+
   const auto input_operator = translate_node(input_node);
 
   return std::make_shared<Projection>(input_operator,
                                       _translate_expressions(projection_node->node_expressions, input_node));
 }
 
-std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
-    const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
-  auto input_operator = translate_node(node->left_input());
-
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node_to_index_only_scan(
+    const std::shared_ptr<ProjectionNode>& node) const {
   /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
+   * If only the scanned column of an IndexScan on a stored table is projected, its values can be taken from the chunk
+   * indexes, i.e., the index covers the query. Indexes do not know which rows are visible, so there must not be a
+   * ValidateNode. Also, all chunks need an index that supports key access, so that no TableScan is needed.
    */
+  if (node->node_expressions.size() != 1) return nullptr;
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
-  if (pqp_expressions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node->left_input());
+  if (!predicate_node || predicate_node->scan_type != ScanType::IndexScan) return nullptr;
+
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(predicate_node->left_input());
+  if (!stored_table_node || !stored_table_node->excluded_chunk_ids().empty() || stored_table_node->table_sample() ||
+      _join_key_source_by_lqp_node.count(stored_table_node)) {
+    return nullptr;
+  }
+
+  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate());
+  if (!predicate || predicate->arguments.empty() || *predicate->arguments[0] != *node->node_expressions[0]) {
+    return nullptr;
   }
 
-  auto pqp_expression_iter = pqp_expressions.rbegin();
-  auto order_by_mode_iter = sort_node->order_by_modes.rbegin();
+  auto right_values = std::vector<AllTypeVariant>{};
+  auto right_values2 = std::vector<AllTypeVariant>{};
+  for (auto argument_idx = size_t{1}; argument_idx < predicate->arguments.size(); ++argument_idx) {
+    const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->arguments[argument_idx]);
+    if (!value_expression) return nullptr;
+    (argument_idx == 1 ? right_values : right_values2).emplace_back(value_expression->value);
+  }
+
+  const auto column_ids = std::vector<ColumnID>{stored_table_node->get_column_id(*predicate->arguments[0])};
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+  if (table->chunk_count() == 0) return nullptr;
 
-  for (; pqp_expression_iter != pqp_expressions.rend(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
+  // As for position-based IndexScans, HashIndexes are preferred for the predicates they support
+  const auto covers_all_chunks = [&](const SegmentIndexType index_type) {
+    if (!BaseIndex::supports(index_type, predicate->predicate_condition)) return false;
+    for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto index = table->get_chunk(chunk_id)->get_index(index_type, column_ids);
+      if (!index || !index->supports_key_access()) return false;
+    }
+    return true;
+  };
+
+  auto index_type = SegmentIndexType::Hash;
+  if (!covers_all_chunks(index_type)) {
+    index_type = SegmentIndexType::GroupKey;
+    if (!covers_all_chunks(index_type)) return nullptr;
+  }
+
+  const auto index_scan = std::make_shared<IndexScan>(translate_node(stored_table_node), index_type, column_ids,
+                                                      predicate->predicate_condition, right_values, right_values2);
+  index_scan->set_index_only(true);
+
+  // The Projection only forwards the segments and gives the column the name the query expects
+  const auto& column_expression = *node->node_expressions[0];
+  const auto pqp_column_expression = std::make_shared<PQPColumnExpression>(
+      ColumnID{0}, column_expression.data_type(), column_expression.is_nullable(), column_expression.as_column_name());
+
+  return std::make_shared<Projection>(index_scan,
+                                      std::vector<std::shared_ptr<AbstractExpression>>{pqp_column_expression});
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
+    const std::shared_ptr<AbstractLQPNode>& node, const std::optional<size_t>& row_limit) const {
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
+  auto input_operator = translate_node(node->left_input());
+
+  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
+
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  sort_definitions.reserve(pqp_expressions.size());
+  for (auto expression_idx = size_t{0}; expression_idx < pqp_expressions.size(); ++expression_idx) {
+    const auto& pqp_expression = pqp_expressions[expression_idx];
     const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
     Assert(pqp_column_expression,
            "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
 
-    current_pqp = std::make_shared<Sort>(current_pqp, pqp_column_expression->column_id, *order_by_mode_iter);
+    sort_definitions.emplace_back(pqp_column_expression->column_id, sort_node->order_by_modes[expression_idx]);
   }
 
-  return current_pqp;
+  return std::make_shared<Sort>(input_operator, sort_definitions, Chunk::DEFAULT_SIZE, row_limit);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+  _prepare_join_key_pruning(*join_node);
+
   const auto input_left_operator = translate_node(node->left_input());
   const auto input_right_operator = translate_node(node->right_input());
 
-  auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
-
   if (join_node->join_mode == JoinMode::Cross) {
     PerformanceWarning("CROSS join used");
     return std::make_shared<Product>(input_left_operator, input_right_operator);
@@ -304,15 +650,108 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   Assert(operator_join_predicate,
          "Couldn't translate join predicate: "s + join_node->join_predicate()->as_column_name());
 
-  const auto predicate_condition = operator_join_predicate->predicate_condition;
+  if (_is_partition_wise_join(*join_node, *operator_join_predicate)) {
+    return std::make_shared<JoinPartitionWise>(input_left_operator, input_right_operator, join_node->join_mode,
+                                               operator_join_predicate->column_ids,
+                                               operator_join_predicate->predicate_condition);
+  }
 
-  if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
-    return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
-                                      operator_join_predicate->column_ids, predicate_condition);
+  // The join algorithm is chosen once the sizes of the inputs are known, see JoinAdaptive
+  return std::make_shared<JoinAdaptive>(input_left_operator, input_right_operator, join_node->join_mode,
+                                        operator_join_predicate->column_ids,
+                                        operator_join_predicate->predicate_condition);
+}
+
+bool LQPTranslator::_is_partition_wise_join(const JoinNode& join_node,
+                                            const OperatorJoinPredicate& operator_join_predicate) const {
+  if (join_node.join_mode != JoinMode::Inner ||
+      operator_join_predicate.predicate_condition != PredicateCondition::Equals) {
+    return false;
   }
 
-  return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
-                                         operator_join_predicate->column_ids, predicate_condition);
+  // The partitioning of the stored table that a join column comes from, if the join column is its partition column
+  const auto partitioning_of = [](const AbstractLQPNode& input_node,
+                                  const ColumnID column_id) -> std::shared_ptr<const TablePartitioning> {
+    const auto column_expression =
+        std::dynamic_pointer_cast<LQPColumnExpression>(input_node.column_expressions()[column_id]);
+    if (!column_expression) return nullptr;
+
+    const auto& column_reference = column_expression->column_reference;
+    const auto stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(column_reference.original_node());
+    if (!stored_table_node) return nullptr;
+
+    const auto& partitioning = StorageManager::get().get_table(stored_table_node->table_name)->partitioning();
+    if (!partitioning || partitioning->column_id() != column_reference.original_column_id()) return nullptr;
+    return partitioning;
+  };
+
+  // Whether the inputs are still partitioned when they are joined is checked by JoinPartitionWise
+  const auto left_partitioning = partitioning_of(*join_node.left_input(), operator_join_predicate.column_ids.first);
+  const auto right_partitioning = partitioning_of(*join_node.right_input(), operator_join_predicate.column_ids.second);
+  return left_partitioning && right_partitioning && left_partitioning->is_co_partitioned_with(*right_partitioning);
+}
+
+void LQPTranslator::_prepare_join_key_pruning(const JoinNode& join_node) const {
+  /**
+   * Chunks of a stored table whose values are out of the range of the join keys of the other input (the "source") do
+   * not contribute to the result of an inner or semi equi-join. Once the source is executed, the GetTable of the stored
+   * table skips them, e.g., the chunks of a fact table outside of the dates selected from a dimension table. As this
+   * delays the GetTable until the source is executed, only the larger input is pruned by the smaller one.
+   */
+  if (join_node.join_mode != JoinMode::Inner && join_node.join_mode != JoinMode::Semi) return;
+
+  const auto operator_join_predicate = OperatorJoinPredicate::from_expression(
+      *join_node.join_predicate(), *join_node.left_input(), *join_node.right_input());
+  if (!operator_join_predicate || operator_join_predicate->predicate_condition != PredicateCondition::Equals) return;
+
+  // Semi joins only filter their left input
+  const auto left_row_count = join_node.left_input()->get_statistics()->row_count();
+  const auto right_row_count = join_node.right_input()->get_statistics()->row_count();
+  const auto prune_left = join_node.join_mode == JoinMode::Semi || left_row_count > right_row_count;
+  const auto pruned_row_count = prune_left ? left_row_count : right_row_count;
+  const auto source_row_count = prune_left ? right_row_count : left_row_count;
+  if (source_row_count >= pruned_row_count) return;
+
+  const auto& source_node = prune_left ? join_node.right_input() : join_node.left_input();
+  const auto source_column_id =
+      prune_left ? operator_join_predicate->column_ids.second : operator_join_predicate->column_ids.first;
+  const auto column_id =
+      prune_left ? operator_join_predicate->column_ids.first : operator_join_predicate->column_ids.second;
+
+  // Find the stored table below the predicates and validates of the pruned input, which keep its columns. All of them
+  // must only be used by this join. IndexScans refer to the chunks of the stored table by their ID.
+  auto stored_table_node = prune_left ? join_node.left_input() : join_node.right_input();
+  auto pruned_path = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  while (stored_table_node->output_count() == 1 &&
+         (stored_table_node->type == LQPNodeType::Validate ||
+          (stored_table_node->type == LQPNodeType::Predicate &&
+           std::static_pointer_cast<PredicateNode>(stored_table_node)->scan_type == ScanType::TableScan))) {
+    pruned_path.emplace_back(stored_table_node);
+    stored_table_node = stored_table_node->left_input();
+  }
+  if (stored_table_node->type != LQPNodeType::StoredTable || stored_table_node->output_count() != 1 ||
+      _operator_by_lqp_node.count(stored_table_node)) {
+    return;
+  }
+
+  // The GetTable must not be part of the source, as it would wait for itself
+  auto source_contains_stored_table_node = false;
+  visit_lqp(source_node, [&](const auto& node) {
+    if (node == stored_table_node) source_contains_stored_table_node = true;
+    return source_contains_stored_table_node ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+  });
+  if (source_contains_stored_table_node) return;
+
+  // The pruned operators must not be shared with other consumers of equal subplans
+  if (std::any_of(pruned_path.cbegin(), pruned_path.cend(),
+                  [&](const auto& node) { return _operator_by_lqp_node.count(node); })) {
+    return;
+  }
+  _exclusive_lqp_nodes.insert(pruned_path.cbegin(), pruned_path.cend());
+  _exclusive_lqp_nodes.emplace(stored_table_node);
+
+  _join_key_source_by_lqp_node.emplace(stored_table_node,
+                                       JoinKeySource{translate_node(source_node), source_column_id, column_id});
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
@@ -359,17 +798,101 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     group_by_column_ids.emplace_back(*column_id);
   }
 
-  return std::make_shared<Aggregate>(input_operator, aggregate_column_definitions, group_by_column_ids);
+  // Without aggregates, the groups only need to be deduplicated. If the input is sorted by the group-by columns, the
+  // Aggregate finds the groups without hashing, though.
+  const auto input_is_sorted = _is_input_sorted_by_group_by_expressions(aggregate_node);
+  if (aggregate_column_definitions.empty() && !input_is_sorted) {
+    return std::make_shared<Distinct>(input_operator, group_by_column_ids);
+  }
+
+  return std::make_shared<Aggregate>(input_operator, aggregate_column_definitions, group_by_column_ids,
+                                     input_is_sorted);
+}
+
+bool LQPTranslator::_is_input_sorted_by_group_by_expressions(
+    const std::shared_ptr<AggregateNode>& aggregate_node) const {
+  const auto group_by_expression_count = aggregate_node->aggregate_expressions_begin_idx;
+  if (group_by_expression_count == 0) return false;
+
+  // Validates and Projections keep the order of their input
+  auto input = aggregate_node->left_input();
+  while (input->type == LQPNodeType::Validate || input->type == LQPNodeType::Projection) {
+    input = input->left_input();
+  }
+  if (input->type != LQPNodeType::Sort || input->node_expressions.size() < group_by_expression_count) return false;
+
+  // The rows of each group are adjacent if the input is first sorted by all group-by expressions, in any order
+  const auto group_by_expressions_begin = aggregate_node->node_expressions.cbegin();
+  const auto group_by_expressions_end = group_by_expressions_begin + group_by_expression_count;
+  const auto sort_expressions_begin = input->node_expressions.cbegin();
+  const auto sort_expressions_end = sort_expressions_begin + group_by_expression_count;
+
+  const auto is_group_by_expression = [&](const auto& expression) {
+    return std::any_of(group_by_expressions_begin, group_by_expressions_end,
+                       [&](const auto& group_by_expression) { return *group_by_expression == *expression; });
+  };
+  const auto is_sort_expression = [&](const auto& expression) {
+    return std::any_of(sort_expressions_begin, sort_expressions_end,
+                       [&](const auto& sort_expression) { return *sort_expression == *expression; });
+  };
+
+  return std::all_of(group_by_expressions_begin, group_by_expressions_end, is_sort_expression) &&
+         std::all_of(sort_expressions_begin, sort_expressions_end, is_group_by_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+
+  auto row_limit = std::optional<size_t>{};
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression());
+  if (value_expression &&
+      (value_expression->data_type() == DataType::Int || value_expression->data_type() == DataType::Long)) {
+    const auto signed_row_limit = type_cast_variant<int64_t>(value_expression->value);
+    if (signed_row_limit >= 0) row_limit = static_cast<size_t>(signed_row_limit);
+  }
+
+  // ORDER BY ... LIMIT k with a constant k is executed by a Sort that only outputs the first k rows
+  if (node->left_input()->type == LQPNodeType::Sort && row_limit) {
+    return _translate_sort_node(node->left_input(), row_limit);
+  }
+
+  const auto input_operator = translate_node(node->left_input());
+  if (row_limit) _push_down_row_budget(node->left_input(), *row_limit);
+
   return std::make_shared<Limit>(
       input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
 }
 
+void LQPTranslator::_push_down_row_budget(const std::shared_ptr<AbstractLQPNode>& node,
+                                          const size_t row_budget) const {
+  /**
+   * The first row_budget rows of the input of a Limit only depend on the first chunks of the inputs of Projections,
+   * TableScans and GetTables. These operators are told to stop early. Projections do not change the number of rows, so
+   * the budget is also passed to their input. Operators used by more than one node need all of their rows.
+   */
+  auto current_node = node;
+  while (current_node->output_count() == 1) {
+    const auto op = translate_node(current_node);
+    if (_shared_operators.count(op)) return;
+    _exclusive_lqp_nodes.emplace(current_node);
+
+    if (const auto projection = std::dynamic_pointer_cast<Projection>(op)) {
+      projection->set_row_budget(row_budget);
+      current_node = current_node->left_input();
+      if (!current_node || projection->input_left() != translate_node(current_node)) return;
+    } else if (const auto table_scan = std::dynamic_pointer_cast<TableScan>(op)) {
+      table_scan->set_row_budget(row_budget);
+      return;
+    } else if (const auto get_table = std::dynamic_pointer_cast<GetTable>(op)) {
+      get_table->set_row_budget(row_budget);
+      return;
+    } else {
+      return;
+    }
+  }
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
@@ -414,6 +937,17 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_validate_node(
   return std::make_shared<Validate>(input_operator);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_window_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_node = node->left_input();
+  const auto input_operator = translate_node(input_node);
+  const auto window_node = std::static_pointer_cast<WindowNode>(node);
+
+  const auto window_function_expression = std::static_pointer_cast<WindowFunctionExpression>(
+      _translate_expression(window_node->window_function_expression(), input_node));
+  return std::make_shared<WindowFunctionEvaluator>(input_operator, window_function_expression);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_show_tables_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   DebugAssert(node->left_input() == nullptr, "ShowTables should not have an input operator.");
@@ -463,6 +997,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_dummy_table_node(
   return std::make_shared<TableWrapper>(Projection::dummy_table());
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_intermediate_result_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto intermediate_result_node = std::static_pointer_cast<IntermediateResultNode>(node);
+  return std::make_shared<TableWrapper>(intermediate_result_node->table);
+}
+
 std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
     const std::shared_ptr<AbstractExpression>& lqp_expression, const std::shared_ptr<AbstractLQPNode>& node) const {
   auto pqp_expression = lqp_expression->deep_copy();
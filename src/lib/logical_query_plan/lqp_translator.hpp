@@ -1,18 +1,25 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
 #include "operators/abstract_operator.hpp"
+#include "sql/intermediate_result_recycler.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class AggregateNode;
+class JoinNode;
 class PredicateNode;
+class ProjectionNode;
 class TableScan;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
@@ -27,28 +34,72 @@ class LQPTranslator {
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // A translated subplan whose result the IntermediateResultRecycler might keep once its operator is executed
+  struct RecyclingCandidate {
+    IntermediateResultRecycler::Subplan subplan;
+    std::shared_ptr<AbstractOperator> op;
+  };
+
+  struct RecyclingReport {
+    std::vector<RecyclingCandidate> candidates;
+
+    // If a recycled result was used, the operators are only valid for the snapshot and must not be cached
+    bool uses_recycled_results{false};
+  };
+
+  /**
+   * While recycling is enabled, recyclable subplans (see IntermediateResultRecycler::is_recyclable()) are translated
+   * into a TableWrapper of their result if the IntermediateResultRecycler holds it for the snapshot. The other ones are
+   * reported as candidates by disable_recycling().
+   */
+  void enable_recycling(const CommitID snapshot_commit_id);
+  RecyclingReport disable_recycling();
+
  private:
   std::shared_ptr<AbstractOperator> _translate_by_node_type(LQPNodeType type,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  std::shared_ptr<AbstractOperator> _translate_or_recycle(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  bool _is_shareable(const std::shared_ptr<AbstractLQPNode>& node) const;
+  size_t _structural_hash(const std::shared_ptr<AbstractLQPNode>& node) const;
+
   std::shared_ptr<AbstractOperator> _translate_stored_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_join_hash(
+      const std::shared_ptr<PredicateNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_ie_join(
+      const std::shared_ptr<PredicateNode>& node) const;
+  std::shared_ptr<TableScan> _translate_predicate_nodes_to_fused_table_scan(
+      const std::shared_ptr<PredicateNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
-  std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_projection_node_to_index_only_scan(
+      const std::shared_ptr<ProjectionNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node,
+                                                         const std::optional<size_t>& row_limit = std::nullopt) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  // Whether the join is an inner equi join on the partition columns of co-partitioned stored tables, see
+  // JoinPartitionWise
+  bool _is_partition_wise_join(const JoinNode& join_node, const OperatorJoinPredicate& operator_join_predicate) const;
+  void _prepare_join_key_pruning(const JoinNode& join_node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  bool _is_input_sorted_by_group_by_expressions(const std::shared_ptr<AggregateNode>& aggregate_node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  void _push_down_row_budget(const std::shared_ptr<AbstractLQPNode>& node, const size_t row_budget) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_delete_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_dummy_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_intermediate_result_node(
+      const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_update_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_union_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_validate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_window_node(const std::shared_ptr<AbstractLQPNode>& node) const;
 
   // Maintenance operators
   std::shared_ptr<AbstractOperator> _translate_show_tables_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -70,6 +121,27 @@ class LQPTranslator {
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
+
+  // Translated nodes by the hash of their structure, to share the operators of structurally equal subplans
+  mutable std::unordered_map<size_t, std::vector<std::shared_ptr<AbstractLQPNode>>> _shareable_lqp_nodes_by_hash;
+  mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, size_t> _structural_hash_by_lqp_node;
+
+  // Nodes whose operators were adapted to their single consumer (i.e., by a row budget or join key pruning) and must
+  // not be shared, and the operators that are shared already and thus must not be adapted
+  mutable std::unordered_set<std::shared_ptr<const AbstractLQPNode>> _exclusive_lqp_nodes;
+  mutable std::unordered_set<std::shared_ptr<const AbstractOperator>> _shared_operators;
+
+  // Set by _prepare_join_key_pruning() for the StoredTableNodes whose GetTable prunes chunks by join keys, see
+  // GetTable::set_join_key_source()
+  struct JoinKeySource {
+    std::shared_ptr<AbstractOperator> source_operator;
+    ColumnID source_column_id;
+    ColumnID column_id;
+  };
+  mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, JoinKeySource> _join_key_source_by_lqp_node;
+
+  std::optional<CommitID> _recycling_snapshot_commit_id;
+  mutable RecyclingReport _recycling_report;
 };
 
 }  // namespace opossum
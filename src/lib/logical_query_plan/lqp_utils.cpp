@@ -1,15 +1,26 @@
 #include "lqp_utils.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <set>
+#include <utility>
+#include <vector>
 
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/delete_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/intermediate_result_node.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
 #include "logical_query_plan/update_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -33,6 +44,12 @@ void lqp_create_node_mapping_impl(LQPNodeMapping& mapping, const std::shared_ptr
 
   lqp_create_node_mapping_impl(mapping, lhs->left_input(), rhs->left_input());
   lqp_create_node_mapping_impl(mapping, lhs->right_input(), rhs->right_input());
+
+  // The column expressions of IntermediateResultNodes reference the nodes of the sub-plan they replaced
+  if (lhs->type == LQPNodeType::IntermediateResult) {
+    lqp_create_node_mapping_impl(mapping, std::static_pointer_cast<IntermediateResultNode>(lhs)->replaced_node,
+                                 std::static_pointer_cast<IntermediateResultNode>(rhs)->replaced_node);
+  }
 }
 
 std::optional<LQPMismatch> lqp_find_structure_mismatch(const std::shared_ptr<const AbstractLQPNode>& lhs,
@@ -80,6 +97,30 @@ void lqp_find_subplan_roots_impl(std::vector<std::shared_ptr<AbstractLQPNode>>&
   });
 }
 
+void lqp_replace_expressions_in_outputs_impl(const std::shared_ptr<AbstractLQPNode>& node,
+                                             const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                                             const std::vector<std::shared_ptr<AbstractExpression>>& replacements,
+                                             std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes) {
+  for (const auto& output : node->outputs()) {
+    // Each node is visited once, as a replacement might contain the expression it replaces
+    if (!visited_nodes.emplace(output).second) continue;
+
+    for (auto& node_expression : output->node_expressions) {
+      visit_expression(node_expression, [&](auto& sub_expression) {
+        for (auto expression_idx = size_t{0}; expression_idx < expressions.size(); ++expression_idx) {
+          if (*sub_expression == *expressions[expression_idx]) {
+            sub_expression = replacements[expression_idx];
+            return ExpressionVisitation::DoNotVisitArguments;
+          }
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    lqp_replace_expressions_in_outputs_impl(output, expressions, replacements, visited_nodes);
+  }
+}
+
 }  // namespace
 
 namespace opossum {
@@ -178,6 +219,24 @@ bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp) {
   return lqp_is_validated(lqp->left_input()) && lqp_is_validated(lqp->right_input());
 }
 
+std::shared_ptr<AbstractLQPNode> lqp_copy_without_validate_nodes(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  // The root node allows for removing the topmost node, too
+  const auto root_node = LogicalPlanRootNode::make(lqp->deep_copy());
+
+  auto validate_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  visit_lqp(root_node, [&](const auto& node) {
+    if (node->type == LQPNodeType::Validate) validate_nodes.emplace_back(node);
+    return LQPVisitation::VisitInputs;
+  });
+  for (const auto& validate_node : validate_nodes) {
+    lqp_remove_node(validate_node);
+  }
+
+  const auto copy = root_node->left_input();
+  root_node->set_left_input(nullptr);
+  return copy;
+}
+
 std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQPNode>& lqp) {
   std::set<std::string> modified_tables;
 
@@ -201,6 +260,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::CreateView:
       case LQPNodeType::DropView:
       case LQPNodeType::DummyTable:
+      case LQPNodeType::IntermediateResult:
       case LQPNodeType::Join:
       case LQPNodeType::Limit:
       case LQPNodeType::Predicate:
@@ -211,6 +271,7 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::Sort:
       case LQPNodeType::StoredTable:
       case LQPNodeType::Union:
+      case LQPNodeType::Window:
       case LQPNodeType::Mock:
         return LQPVisitation::VisitInputs;
     }
@@ -220,6 +281,21 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
   return modified_tables;
 }
 
+std::set<std::string> lqp_find_accessed_tables(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  std::set<std::string> accessed_tables;
+
+  for (const auto& root_node : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(root_node, [&](const auto& node) {
+      if (node->type == LQPNodeType::StoredTable) {
+        accessed_tables.insert(std::static_pointer_cast<StoredTableNode>(node)->table_name);
+      }
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  return accessed_tables;
+}
+
 std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression(const std::shared_ptr<AbstractLQPNode>& lqp) {
   static const auto whitelist =
       std::set<LQPNodeType>{LQPNodeType::Projection, LQPNodeType::Sort, LQPNodeType::Validate};
@@ -263,4 +339,132 @@ std::vector<std::shared_ptr<AbstractLQPNode>> lqp_find_subplan_roots(const std::
   lqp_find_subplan_roots_impl(root_nodes, visited_nodes, lqp);
   return root_nodes;
 }
+
+bool lqp_expressions_are_unique(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  switch (lqp->type) {
+    case LQPNodeType::StoredTable: {
+      auto column_ids = std::vector<ColumnID>{};
+      for (const auto& expression : expressions) {
+        const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(expression);
+        if (column_expression && column_expression->column_reference.original_node() == lqp) {
+          column_ids.emplace_back(column_expression->column_reference.original_column_id());
+        }
+      }
+
+      const auto& table_name = std::static_pointer_cast<StoredTableNode>(lqp)->table_name;
+      const auto& unique_constraints = StorageManager::get().get_table(table_name)->get_unique_constraints();
+      return std::any_of(unique_constraints.cbegin(), unique_constraints.cend(), [&](const auto& unique_constraint) {
+        const auto& constraint_column_ids = unique_constraint.columns;
+        return std::all_of(constraint_column_ids.cbegin(), constraint_column_ids.cend(), [&](const auto column_id) {
+          return std::find(column_ids.cbegin(), column_ids.cend(), column_id) != column_ids.cend();
+        });
+      });
+    }
+
+    case LQPNodeType::Alias:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Validate:
+      return lqp_expressions_are_unique(lqp->left_input(), expressions);
+
+    case LQPNodeType::Aggregate: {
+      // Each group yields one row
+      const auto& aggregate_node = static_cast<const AggregateNode&>(*lqp);
+      const auto group_by_begin = aggregate_node.node_expressions.cbegin();
+      const auto group_by_end = group_by_begin + aggregate_node.aggregate_expressions_begin_idx;
+      return std::all_of(group_by_begin, group_by_end, [&](const auto& group_by_expression) {
+        return std::any_of(expressions.cbegin(), expressions.cend(),
+                           [&](const auto& expression) { return *expression == *group_by_expression; });
+      });
+    }
+
+    case LQPNodeType::Join: {
+      const auto& join_node = static_cast<const JoinNode&>(*lqp);
+      if (join_node.join_mode == JoinMode::Semi || join_node.join_mode == JoinMode::Anti) {
+        return lqp_expressions_are_unique(lqp->left_input(), expressions);
+      }
+      if (join_node.join_mode != JoinMode::Inner) return false;
+
+      const auto join_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node.join_predicate());
+      if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return false;
+
+      // If the join expression of one input is unique, each row of the other input matches at most one row, so its
+      // unique expressions stay unique
+      for (const auto& [input, other_input] : {std::make_pair(lqp->left_input(), lqp->right_input()),
+                                               std::make_pair(lqp->right_input(), lqp->left_input())}) {
+        const auto& other_join_expression = expression_evaluable_on_lqp(join_predicate->left_operand(), *other_input)
+                                                ? join_predicate->left_operand()
+                                                : join_predicate->right_operand();
+        if (!lqp_expressions_are_unique(other_input, {other_join_expression})) continue;
+
+        auto input_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+        std::copy_if(expressions.cbegin(), expressions.cend(), std::back_inserter(input_expressions),
+                     [&](const auto& expression) { return expression_evaluable_on_lqp(expression, *input); });
+        if (lqp_expressions_are_unique(input, input_expressions)) return true;
+      }
+      return false;
+    }
+
+    default:
+      return false;
+  }
+}
+
+void lqp_replace_expressions_in_outputs(const std::shared_ptr<AbstractLQPNode>& node,
+                                        const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                                        const std::vector<std::shared_ptr<AbstractExpression>>& replacements) {
+  auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+  lqp_replace_expressions_in_outputs_impl(node, expressions, replacements, visited_nodes);
+}
+
+std::vector<std::pair<std::shared_ptr<AbstractExpression>, OrderByMode>> lqp_find_output_order(
+    const std::shared_ptr<AbstractLQPNode>& lqp) {
+  switch (lqp->type) {
+    case LQPNodeType::Sort: {
+      const auto& sort_node = static_cast<const SortNode&>(*lqp);
+      auto order = std::vector<std::pair<std::shared_ptr<AbstractExpression>, OrderByMode>>{};
+      for (auto expression_idx = size_t{0}; expression_idx < sort_node.node_expressions.size(); ++expression_idx) {
+        order.emplace_back(sort_node.node_expressions[expression_idx], sort_node.order_by_modes[expression_idx]);
+      }
+
+      // The Sort is stable, so rows with equal values keep the order of the input
+      for (const auto& input_order_element : lqp_find_output_order(lqp->left_input())) {
+        const auto is_sorted_by = std::any_of(order.cbegin(), order.cend(), [&](const auto& order_element) {
+          return *order_element.first == *input_order_element.first;
+        });
+        if (!is_sorted_by) order.emplace_back(input_order_element);
+      }
+      return order;
+    }
+
+    case LQPNodeType::Predicate:
+      // An index scan outputs the matches in the order of the index
+      if (static_cast<const PredicateNode&>(*lqp).scan_type == ScanType::IndexScan) return {};
+      return lqp_find_output_order(lqp->left_input());
+
+    case LQPNodeType::Alias:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Validate:
+      return lqp_find_output_order(lqp->left_input());
+
+    case LQPNodeType::Projection: {
+      // The order is known up to the first expression that is not projected
+      auto order = lqp_find_output_order(lqp->left_input());
+      const auto& column_expressions = lqp->column_expressions();
+      const auto first_unprojected_iter = std::find_if(order.begin(), order.end(), [&](const auto& order_element) {
+        return std::none_of(column_expressions.cbegin(), column_expressions.cend(),
+                            [&](const auto& expression) { return *expression == *order_element.first; });
+      });
+      order.erase(first_unprojected_iter, order.end());
+      return order;
+    }
+
+    default:
+      return {};
+  }
+}
+
 }  // namespace opossum
@@ -5,6 +5,8 @@
 #include <queue>
 #include <set>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
@@ -50,17 +52,52 @@ void lqp_insert_node(const std::shared_ptr<AbstractLQPNode>& parent_node, const
  */
 bool lqp_is_validated(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return a deep copy of @param lqp without its ValidateNodes, e.g., to compare LQPs regardless of whether they were
+ *         translated for MVCC
+ */
+std::shared_ptr<AbstractLQPNode> lqp_copy_without_validate_nodes(const std::shared_ptr<AbstractLQPNode>& lqp);
+
 /**
  * @return all names of tables that have been accessed in modifying nodes (e.g., InsertNode, UpdateNode)
  */
 std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return all names of tables that are read by StoredTableNodes of @param lqp, including those in subselects
+ */
+std::set<std::string> lqp_find_accessed_tables(const std::shared_ptr<AbstractLQPNode>& lqp);
+
 /**
  * Create a boolean expression from an LQP by considering PredicateNodes and UnionNodes
  * @return      the expression, or nullptr if no expression could be created
  */
 std::shared_ptr<AbstractExpression> lqp_subplan_to_boolean_expression(const std::shared_ptr<AbstractLQPNode>& lqp);
 
+/**
+ * @return whether the values of @param expressions, taken together, are unique in the output of @param lqp. This is
+ *         derived from the unique constraints of stored tables and from the GROUP BY expressions of aggregates, and is
+ *         carried through filters and through joins that match each row with at most one row.
+ */
+bool lqp_expressions_are_unique(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
+/**
+ * Replaces each of @param expressions with the corresponding one of @param replacements in the node expressions of
+ * all nodes above @param node, e.g., after the aggregates that they refer to were rewritten
+ */
+void lqp_replace_expressions_in_outputs(const std::shared_ptr<AbstractLQPNode>& node,
+                                        const std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                                        const std::vector<std::shared_ptr<AbstractExpression>>& replacements);
+
+/**
+ * @return the expressions by which the output of @param lqp is sorted, with their OrderByModes, as far as it is known
+ *         from the plan. The order is established by a SortNode and kept by the filters, projections and limits above
+ *         it, whose operators process their input chunk by chunk. Empty if no order is known.
+ */
+std::vector<std::pair<std::shared_ptr<AbstractExpression>, OrderByMode>> lqp_find_output_order(
+    const std::shared_ptr<AbstractLQPNode>& lqp);
+
 enum class LQPVisitation { VisitInputs, DoNotVisitInputs };
 
 /**
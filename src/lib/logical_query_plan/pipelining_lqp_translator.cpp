@@ -0,0 +1,75 @@
+#include "pipelining_lqp_translator.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "operators/join_adaptive.hpp"
+#include "operators/join_hash.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace opossum {
+
+std::shared_ptr<AbstractOperator> PipeliningLQPTranslator::translate_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto pipeline_iter = _pipeline_by_lqp_node.find(node);
+  if (pipeline_iter != _pipeline_by_lqp_node.end()) return pipeline_iter->second;
+
+  // The inputs are translated by this translator as well, i.e., they might already be Pipelines
+  auto op = LQPTranslator::translate_node(node);
+
+  // The JoinAdaptive chooses its algorithm only once both inputs are materialized. Equi joins are executed as JoinHash
+  // instead, so that one of their inputs can be pipelined.
+  if (op->type() == OperatorType::JoinAdaptive) {
+    const auto& join_adaptive = static_cast<const JoinAdaptive&>(*op);
+    if (join_adaptive.predicate_condition() == PredicateCondition::Equals && join_adaptive.mode() != JoinMode::Outer) {
+      op = std::make_shared<JoinHash>(op->input_left(), op->input_right(), join_adaptive.mode(),
+                                      join_adaptive.column_ids(), PredicateCondition::Equals);
+    }
+  }
+
+  auto probe_input_is_left = true;
+  if (op->type() == OperatorType::JoinHash) {
+    const auto& join_hash = static_cast<const JoinHash&>(*op);
+    probe_input_is_left = join_hash.mode() != JoinMode::Right;
+    if (join_hash.mode() == JoinMode::Inner && node->left_input() && node->right_input()) {
+      probe_input_is_left =
+          node->left_input()->get_statistics()->row_count() >= node->right_input()->get_statistics()->row_count();
+    }
+  }
+
+  if (!Pipeline::is_stage(*op, probe_input_is_left)) return op;
+
+  const auto input = probe_input_is_left ? op->input_left() : op->input_right();
+  auto build_input = std::shared_ptr<const AbstractOperator>{};
+  if (op->type() == OperatorType::JoinHash) build_input = probe_input_is_left ? op->input_right() : op->input_left();
+  if (op->type() == OperatorType::Product) build_input = op->input_right();
+
+  auto pipeline = std::shared_ptr<Pipeline>{};
+
+  const auto input_lqp_node_iter = _lqp_node_by_pipeline.find(input);
+  if (input_lqp_node_iter != _lqp_node_by_pipeline.end() && input_lqp_node_iter->second->output_count() == 1) {
+    const auto input_pipeline = std::static_pointer_cast<const Pipeline>(input);
+    if (!build_input || !input_pipeline->input_right()) {
+      auto stages = input_pipeline->stages();
+      stages.emplace_back(op);
+
+      const auto pipeline_build_input = build_input ? build_input : input_pipeline->input_right();
+      const auto pipeline_probe_input_is_left =
+          build_input ? probe_input_is_left : input_pipeline->probe_input_is_left();
+
+      pipeline = std::make_shared<Pipeline>(input_pipeline->input_left(), stages, pipeline_build_input,
+                                            pipeline_probe_input_is_left);
+    }
+  }
+
+  if (!pipeline) {
+    pipeline = std::make_shared<Pipeline>(input, std::vector<std::shared_ptr<AbstractOperator>>{op}, build_input,
+                                          probe_input_is_left);
+  }
+
+  _lqp_node_by_pipeline.emplace(pipeline, node);
+  _pipeline_by_lqp_node.emplace(node, pipeline);
+  return pipeline;
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+
+#include "logical_query_plan/lqp_translator.hpp"
+#include "operators/pipeline.hpp"
+
+namespace opossum {
+
+/**
+ * Drop-in specialization of the LQPTranslator that executes chains of non-blocking operators (Validate, TableScan,
+ * Projection, the probe side of JoinHash and the left side of Product) morsel by morsel, see Pipeline.
+ *
+ * Each node is translated by the LQPTranslator. If the resulting operator can be a stage of a Pipeline, it is appended
+ * to the Pipeline of its input, or starts a new Pipeline. A Pipeline is only extended if the node it was created for
+ * has no other outputs, so that no intermediate result is computed twice, and if the Pipeline does not already
+ * contain a JoinHash or Product stage when the operator is one of them. Equi joins (except for full outer joins) become
+ * JoinHashes instead of JoinAdaptives. Inner joins probe their larger input (according to the statistics) and build
+ * the hash table of the smaller one.
+ */
+class PipeliningLQPTranslator final : public LQPTranslator {
+ public:
+  std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const final;
+
+ private:
+  // The Pipelines created so far and the nodes they were created for, to decide whether a Pipeline can be extended
+  mutable std::unordered_map<std::shared_ptr<const AbstractOperator>, std::shared_ptr<AbstractLQPNode>>
+      _lqp_node_by_pipeline;
+
+  // As the LQPTranslator caches the operators before they become stages, the Pipelines are cached separately
+  mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
+      _pipeline_by_lqp_node;
+};
+
+}  // namespace opossum
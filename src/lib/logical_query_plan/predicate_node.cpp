@@ -55,7 +55,10 @@ std::shared_ptr<TableStatistics> PredicateNode::derive_statistics_from(
 std::shared_ptr<AbstractExpression> PredicateNode::predicate() const { return node_expressions[0]; }
 
 std::shared_ptr<AbstractLQPNode> PredicateNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return std::make_shared<PredicateNode>(expression_copy_and_adapt_to_different_lqp(*predicate(), node_mapping));
+  const auto copy =
+      std::make_shared<PredicateNode>(expression_copy_and_adapt_to_different_lqp(*predicate(), node_mapping));
+  copy->scan_type = scan_type;
+  return copy;
 }
 
 bool PredicateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
@@ -63,7 +66,7 @@ bool PredicateNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNode
   const auto equal =
       expression_equal_to_expression_in_different_lqp(*predicate(), *predicate_node.predicate(), node_mapping);
 
-  return equal;
+  return equal && scan_type == predicate_node.scan_type;
 }
 
 }  // namespace opossum
@@ -1,6 +1,13 @@
 #include "stored_table_node.hpp"
 
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "expression/lqp_column_expression.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -19,7 +26,18 @@ void StoredTableNode::set_excluded_chunk_ids(const std::vector<ChunkID>& chunks)
 
 const std::vector<ChunkID>& StoredTableNode::excluded_chunk_ids() const { return _excluded_chunk_ids; }
 
-std::string StoredTableNode::description() const { return "[StoredTable] Name: '" + table_name + "'"; }
+void StoredTableNode::set_table_sample(const std::optional<TableSample>& table_sample) {
+  _table_sample = table_sample;
+}
+
+const std::optional<TableSample>& StoredTableNode::table_sample() const { return _table_sample; }
+
+std::string StoredTableNode::description() const {
+  std::stringstream stream;
+  stream << "[StoredTable] Name: '" << table_name << "'";
+  if (_table_sample) stream << " SAMPLE " << *_table_sample;
+  return stream.str();
+}
 
 const std::vector<std::shared_ptr<AbstractExpression>>& StoredTableNode::column_expressions() const {
   // Need to initialize the expressions lazily because they will have a weak_ptr to this node and we can't obtain that
@@ -40,18 +58,39 @@ const std::vector<std::shared_ptr<AbstractExpression>>& StoredTableNode::column_
 std::shared_ptr<TableStatistics> StoredTableNode::derive_statistics_from(
     const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
   DebugAssert(!left_input && !right_input, "StoredTableNode must be leaf");
-  return StorageManager::get().get_table(table_name)->table_statistics();
+  const auto table = StorageManager::get().get_table(table_name);
+  auto table_statistics = table->table_statistics();
+
+  // Inserts only maintain the row count of the statistics. Once too many rows were inserted, the statistics are
+  // regenerated lazily, i.e., by the next query that needs them. Concurrent queries might regenerate them as well.
+  if (table_statistics && table_statistics->is_stale()) {
+    auto regenerated_table_statistics = std::make_shared<TableStatistics>(generate_table_statistics(*table));
+    table_statistics->carry_over_invalid_row_count(*regenerated_table_statistics);
+    table->set_table_statistics(regenerated_table_statistics);
+    table_statistics = regenerated_table_statistics;
+  }
+
+  // Sampling keeps the distribution of the values, but only a fraction of the rows
+  if (table_statistics && _table_sample) {
+    const auto sampled_row_count = table_statistics->row_count() * static_cast<float>(_table_sample->fraction);
+    return std::make_shared<TableStatistics>(table_statistics->table_type(), sampled_row_count,
+                                             table_statistics->column_statistics());
+  }
+
+  return table_statistics;
 }
 
 std::shared_ptr<AbstractLQPNode> StoredTableNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
   const auto copy = make(table_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_table_sample(_table_sample);
   return copy;
 }
 
 bool StoredTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
   const auto& stored_table_node = static_cast<const StoredTableNode&>(rhs);
-  return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids;
+  return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids &&
+         _table_sample == stored_table_node._table_sample;
 }
 
 }  // namespace opossum
@@ -6,6 +6,7 @@
 #include "abstract_lqp_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "lqp_column_reference.hpp"
+#include "storage/table_sample.hpp"
 
 namespace opossum {
 
@@ -20,6 +21,10 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
   void set_excluded_chunk_ids(const std::vector<ChunkID>& chunks);
   const std::vector<ChunkID>& excluded_chunk_ids() const;
 
+  // If set, only a random sample of the table is read (see TableSample)
+  void set_table_sample(const std::optional<TableSample>& table_sample);
+  const std::optional<TableSample>& table_sample() const;
+
   std::string description() const override;
   const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
   std::shared_ptr<TableStatistics> derive_statistics_from(
@@ -35,6 +40,7 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
  private:
   mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _expressions;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::optional<TableSample> _table_sample;
 };
 
 }  // namespace opossum
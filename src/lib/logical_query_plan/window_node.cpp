@@ -0,0 +1,81 @@
+#include "window_node.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "expression/window_function_expression.hpp"
+#include "resolve_type.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WindowNode::WindowNode(const std::shared_ptr<AbstractExpression>& window_function_expression)
+    : AbstractLQPNode(LQPNodeType::Window, {window_function_expression}) {
+  Assert(window_function_expression->type == ExpressionType::WindowFunction,
+         "Expression used as window function expression must be of type WindowFunctionExpression.");
+}
+
+std::string WindowNode::description() const { return "[Window] " + node_expressions[0]->as_column_name(); }
+
+const std::vector<std::shared_ptr<AbstractExpression>>& WindowNode::column_expressions() const {
+  Assert(left_input(), "The input needs to be set to determine a WindowNode's output expressions");
+
+  // Updated every time they are requested, as in JoinNode::column_expressions()
+  const auto& input_expressions = left_input()->column_expressions();
+  _column_expressions.resize(input_expressions.size() + 1u);
+  std::copy(input_expressions.begin(), input_expressions.end(), _column_expressions.begin());
+  _column_expressions.back() = node_expressions[0];
+
+  return _column_expressions;
+}
+
+std::shared_ptr<TableStatistics> WindowNode::derive_statistics_from(
+    const std::shared_ptr<AbstractLQPNode>& left_input, const std::shared_ptr<AbstractLQPNode>& right_input) const {
+  DebugAssert(left_input && !right_input, "WindowNode needs left_input and no right_input");
+
+  // The window function keeps all input rows, so the row count and the statistics of the input columns are forwarded
+  const auto input_statistics = left_input->get_statistics();
+  auto column_statistics = input_statistics->column_statistics();
+
+  // MIN, MAX, LAG, and LEAD return values of their argument. For a column as argument, its statistics are used.
+  const auto& expression = *window_function_expression();
+  const auto returns_argument_values =
+      expression.window_function == WindowFunction::Min || expression.window_function == WindowFunction::Max ||
+      expression.window_function == WindowFunction::Lag || expression.window_function == WindowFunction::Lead;
+  const auto argument_column_id =
+      returns_argument_values ? left_input->find_column_id(*expression.argument()) : std::nullopt;
+
+  if (argument_column_id) {
+    column_statistics.emplace_back(input_statistics->column_statistics()[*argument_column_id]);
+  } else {
+    resolve_data_type(expression.data_type(), [&](const auto data_type_t) {
+      using ExpressionDataType = typename decltype(data_type_t)::type;
+      column_statistics.emplace_back(
+          std::make_shared<ColumnStatistics<ExpressionDataType>>(ColumnStatistics<ExpressionDataType>::dummy()));
+    });
+  }
+
+  return std::make_shared<TableStatistics>(TableType::References, input_statistics->row_count(), column_statistics);
+}
+
+std::shared_ptr<WindowFunctionExpression> WindowNode::window_function_expression() const {
+  return std::static_pointer_cast<WindowFunctionExpression>(node_expressions[0]);
+}
+
+std::shared_ptr<AbstractLQPNode> WindowNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
+  return WindowNode::make(expression_copy_and_adapt_to_different_lqp(*node_expressions[0], node_mapping));
+}
+
+bool WindowNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
+  const auto& window_node = static_cast<const WindowNode&>(rhs);
+  return expression_equal_to_expression_in_different_lqp(*node_expressions[0], *window_node.node_expressions[0],
+                                                         node_mapping);
+}
+
+}  // namespace opossum
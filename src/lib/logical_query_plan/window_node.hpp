@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_lqp_node.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class WindowFunctionExpression;
+
+/**
+ * This node type computes a window function (e.g., `RANK() OVER (PARTITION BY a ORDER BY b)`) for each row of its
+ * input. Unlike an AggregateNode, it keeps all input rows: The output columns are the input columns followed by the
+ * window function. Several window functions are computed by a chain of WindowNodes.
+ */
+class WindowNode : public EnableMakeForLQPNode<WindowNode>, public AbstractLQPNode {
+ public:
+  explicit WindowNode(const std::shared_ptr<AbstractExpression>& window_function_expression);
+
+  std::string description() const override;
+  const std::vector<std::shared_ptr<AbstractExpression>>& column_expressions() const override;
+
+  std::shared_ptr<TableStatistics> derive_statistics_from(
+      const std::shared_ptr<AbstractLQPNode>& left_input,
+      const std::shared_ptr<AbstractLQPNode>& right_input) const override;
+
+  std::shared_ptr<WindowFunctionExpression> window_function_expression() const;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
+  bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+
+ private:
+  mutable std::vector<std::shared_ptr<AbstractExpression>> _column_expressions;
+};
+
+}  // namespace opossum
@@ -44,6 +44,9 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
 
   std::shared_ptr<Table> _initialize_output_table() const;
 
+  // The output table of a join of the given tables, which might be parts (e.g., morsels, see Pipeline) of the inputs
+  std::shared_ptr<Table> _initialize_output_table(const Table& left_in_table, const Table& right_in_table) const;
+
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
   // found in join_hash.hpp.
@@ -7,11 +7,15 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/performance_counters.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
 #include "utils/timer.hpp"
+#include "utils/tracking_memory_resource.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
@@ -29,7 +33,22 @@ void AbstractOperator::execute() {
   DebugAssert(!_input_right || _input_right->get_output(), "Right input has not yet been executed");
   DebugAssert(!_output, "Operator has already been executed");
 
+  // Operators that are executed within a task rather than as a task of their own, e.g., the plans of correlated
+  // subqueries that the ExpressionEvaluator executes for each row, stop once the query is cancelled, too
+  if (const auto cancellation_token = AbstractTask::current_cancellation_token()) {
+    cancellation_token->throw_if_cancelled();
+  }
+
   Timer performance_timer;
+  const auto performance_counters_begin =
+      PerformanceCounters::enabled() ? PerformanceCounters::read() : std::nullopt;
+
+  // Keeps the memory resource alive while the operator allocates from it
+  const auto memory_resource = _memory_resource.lock();
+
+  // Counts the bytes that the operator allocates from memory_resource()
+  const auto operator_memory_resource = std::make_shared<TrackingMemoryResource>(memory_resource);
+  _execution_memory_resource = operator_memory_resource;
 
   auto transaction_context = this->transaction_context();
 
@@ -40,6 +59,7 @@ void AbstractOperator::execute() {
      * tasks of the Transaction run while the Rollback happens.
      */
     if (transaction_context->aborted()) {
+      _execution_memory_resource = nullptr;
       return;
     }
     transaction_context->on_operator_started();
@@ -52,7 +72,36 @@ void AbstractOperator::execute() {
   // release any temporary data if possible
   _on_cleanup();
 
+  // The output might contain data allocated from the memory resource and outlive the query. Operators without inputs
+  // (e.g., GetTable) and those that forward an input table do not create new output tables. A new output table can
+  // share data with the input tables (e.g., their PosLists), so it retains their memory resources, too.
+  if (_output && (_input_left || _input_right) && (!_input_left || _output != _input_left->get_output()) &&
+      (!_input_right || _output != _input_right->get_output())) {
+    const auto output = std::const_pointer_cast<Table>(_output);
+    output->retain_memory_resource(operator_memory_resource);
+    for (const auto& input : {_input_left, _input_right}) {
+      if (!input) continue;
+      for (const auto& input_memory_resource : input->get_output()->retained_memory_resources()) {
+        output->retain_memory_resource(input_memory_resource);
+      }
+    }
+  }
+  _execution_memory_resource = nullptr;
+  _performance_data->peak_memory_usage_bytes = operator_memory_resource->peak_allocated_bytes();
+  _performance_data->retained_memory_usage_bytes = operator_memory_resource->allocated_bytes();
+
   _performance_data->walltime = performance_timer.lap();
+  if (performance_counters_begin) {
+    if (const auto performance_counters_end = PerformanceCounters::read()) {
+      _performance_data->performance_counters = *performance_counters_end - *performance_counters_begin;
+    }
+  }
+  if (_input_left) _performance_data->input_row_count += _input_left->get_output()->row_count();
+  if (_input_right) _performance_data->input_row_count += _input_right->get_output()->row_count();
+  if (_output) {
+    _performance_data->output_row_count = _output->row_count();
+    _performance_data->output_chunk_count = _output->chunk_count();
+  }
 
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
                 _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
@@ -86,6 +135,11 @@ std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy() const {
   return _deep_copy_impl(copied_ops);
 }
 
+std::shared_ptr<AbstractOperator> AbstractOperator::deep_copy(
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return _deep_copy_impl(copied_ops);
+}
+
 std::shared_ptr<const Table> AbstractOperator::input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::input_table_right() const { return _input_right->get_output(); }
@@ -111,6 +165,26 @@ void AbstractOperator::set_transaction_context_recursively(
   if (_input_right != nullptr) mutable_input_right()->set_transaction_context_recursively(transaction_context);
 }
 
+boost::container::pmr::memory_resource* AbstractOperator::memory_resource() const {
+  if (_execution_memory_resource) return _execution_memory_resource.get();
+
+  const auto memory_resource = _memory_resource.lock();
+  return memory_resource ? memory_resource.get() : boost::container::pmr::get_default_resource();
+}
+
+void AbstractOperator::set_memory_resource(
+    const std::weak_ptr<boost::container::pmr::memory_resource>& memory_resource) {
+  _memory_resource = memory_resource;
+}
+
+void AbstractOperator::set_memory_resource_recursively(
+    const std::weak_ptr<boost::container::pmr::memory_resource>& memory_resource) {
+  set_memory_resource(memory_resource);
+
+  if (_input_left != nullptr) mutable_input_left()->set_memory_resource_recursively(memory_resource);
+  if (_input_right != nullptr) mutable_input_right()->set_memory_resource_recursively(memory_resource);
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_left() const {
   return std::const_pointer_cast<AbstractOperator>(_input_left);
 }
@@ -121,6 +195,10 @@ std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_right() const
 
 const OperatorPerformanceData& AbstractOperator::performance_data() const { return *_performance_data; }
 
+std::shared_ptr<const OperatorPerformanceData> AbstractOperator::shared_performance_data() const {
+  return _performance_data;
+}
+
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
 
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
@@ -132,7 +210,7 @@ void AbstractOperator::print(std::ostream& stream) const {
     if (op->input_right()) children.emplace_back(op->input_right());
     return children;
   };
-  const auto node_print_fn = [& performance_data = *_performance_data](const auto& op, auto& fn_stream) {
+  const auto node_print_fn = [](const auto& op, auto& fn_stream) {
     fn_stream << op->description();
 
     // If the operator was already executed, print some info about data and performance
@@ -143,7 +221,7 @@ void AbstractOperator::print(std::ostream& stream) const {
 
       fn_stream << format_bytes(output->estimate_memory_usage());
       fn_stream << "/";
-      fn_stream << performance_data.to_string(DescriptionMode::SingleLine) << ")";
+      fn_stream << op->performance_data().to_string(DescriptionMode::SingleLine) << ")";
     }
   };
 
@@ -172,6 +250,7 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
 
   const auto copied_op = _on_deep_copy(copied_input_left, copied_input_right);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  copied_op->lqp_node = lqp_node;
 
   copied_ops.emplace(this, copied_op);
 
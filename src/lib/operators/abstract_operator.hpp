@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/container/pmr/memory_resource.hpp>
+
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -11,8 +13,10 @@
 
 namespace opossum {
 
+class AbstractLQPNode;
 class OperatorTask;
 class Table;
+class TrackingMemoryResource;
 class TransactionContext;
 
 enum class OperatorType {
@@ -20,20 +24,28 @@ enum class OperatorType {
   Alias,
   Delete,
   Difference,
+  Distinct,
+  Exchange,
   ExportBinary,
   ExportCsv,
+  ExportParquet,
   GetTable,
   ImportBinary,
   ImportCsv,
+  ImportParquet,
   IndexScan,
   Insert,
   JitOperatorWrapper,
+  JoinAdaptive,
   JoinHash,
+  JoinIEJoin,
   JoinIndex,
   JoinMPSM,
   JoinNestedLoop,
+  JoinPartitionWise,
   JoinSortMerge,
   Limit,
+  Pipeline,
   Print,
   Product,
   Projection,
@@ -44,6 +56,7 @@ enum class OperatorType {
   UnionPositions,
   Update,
   Validate,
+  WindowFunctionEvaluator,
   CreateTable,
   CreatePreparedPlan,
   CreateView,
@@ -103,11 +116,31 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  /**
+   * The memory resource that the operator allocates (parts of) its intermediate results from, usually the
+   * ArenaMemoryResource of the query. Only a weak reference is kept, so that cached PQPs do not keep the arena alive.
+   * While the operator is executed, it holds the memory resource, and afterwards its output table does (see
+   * Table::retain_memory_resource()). Returns the default memory resource if none is set or if it has expired.
+   *
+   * While the operator is executed, the allocations pass through a TrackingMemoryResource of the operator, which counts
+   * its peak and retained memory usage (see OperatorPerformanceData).
+   */
+  boost::container::pmr::memory_resource* memory_resource() const;
+  void set_memory_resource(const std::weak_ptr<boost::container::pmr::memory_resource>& memory_resource);
+
+  // Calls set_memory_resource on itself and both input operators recursively
+  void set_memory_resource_recursively(const std::weak_ptr<boost::container::pmr::memory_resource>& memory_resource);
+
   // Returns a new instance of the same operator with the same configuration.
   // Recursively copies the input operators.
   // An operator needs to implement this method in order to be cacheable.
   std::shared_ptr<AbstractOperator> deep_copy() const;
 
+  // Same as above, but the operators in @param copied_ops are used as the copies of their keys instead of being copied.
+  // E.g., mapping an input to nullptr copies an operator without its input.
+  std::shared_ptr<AbstractOperator> deep_copy(
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const;
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
@@ -124,11 +157,18 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Return data about the operators performance (runtime, e.g.) AFTER it has been executed.
   const OperatorPerformanceData& performance_data() const;
 
+  // Same as above, but keeps the performance data valid after the operator is destroyed
+  std::shared_ptr<const OperatorPerformanceData> shared_performance_data() const;
+
   void print(std::ostream& stream = std::cout) const;
 
   // Set parameters (AllParameterVariants or CorrelatedParameterExpressions) to their respective values
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  // The LQP node that the operator was translated from, if any. Set by the LQPTranslator and kept by deep_copy(), so
+  // that, e.g., EXPLAIN can show the estimated row count of an operator next to the actual one.
+  std::shared_ptr<AbstractLQPNode> lqp_node;
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
@@ -169,7 +209,12 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
-  const std::unique_ptr<OperatorPerformanceData> _performance_data;
+  std::weak_ptr<boost::container::pmr::memory_resource> _memory_resource;
+
+  // Only set while the operator is executed, see memory_resource()
+  std::shared_ptr<TrackingMemoryResource> _execution_memory_resource;
+
+  const std::shared_ptr<OperatorPerformanceData> _performance_data;
 };
 
 }  // namespace opossum
@@ -1,52 +1,197 @@
 #include "aggregate.hpp"
 
 #include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <boost/math/distributions/normal.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "aggregate/aggregate_group_id_map.hpp"
 #include "aggregate/aggregate_traits.hpp"
 #include "constant_mappings.hpp"
+#include "morsel_planner.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "type_comparison.hpp"
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/tracking_memory_resource.hpp"
 
 namespace {
 using namespace opossum;  // NOLINT
 
-// Given an AggregateKey key, and a RowId row_id where this AggregateKey was encountered, this first checks if the
-// AggregateKey was seen before. If not, a new aggregate result is inserted into results and connected to the row id.
-// This is important so that we can reconstruct the original values later. In any case, a reference to the result is
-// returned so that result information, such as the aggregate's count or sum, can be modified by the caller.
-template <typename ResultIds, typename Results, typename AggregateKey>
-typename Results::reference get_or_add_result(ResultIds& result_ids, Results& results, const AggregateKey& key,
-                                              const RowID& row_id) {
-  // Get the result id for the current key or add it to the id map
-  auto it = result_ids.find(key);
-  if (it != result_ids.end()) return results[it->second];
+// The groups that were found while pre-aggregating a chunk, indexed by their id within the chunk
+template <typename AggregateKey>
+struct AggregateGroups {
+  std::vector<AggregateKey> keys;
+
+  // The first row of each group. This is important so that we can reconstruct the original values later.
+  std::vector<RowID> row_ids;
+
+  // The group ids sorted by the radix partition of their key, starting at partition_offsets[partition_id]
+  std::vector<AggregateResultId> partitioned_group_ids;
+  std::vector<size_t> partition_offsets;
+};
+
+// Merges a pre-aggregated result of a group into the group's result. The source result is left in a valid but
+// unspecified state.
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+void merge_aggregate_results(AggregateResult<ColumnDataType, AggregateType>& target,
+                             AggregateResult<ColumnDataType, AggregateType>& source) {
+  target.aggregate_count += source.aggregate_count;
+  target.sum_of_squares += source.sum_of_squares;
+
+  if constexpr (function == AggregateFunction::CountDistinct) {
+    target.distinct_values.merge(source.distinct_values);
+  }
+
+  if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+    target.sketch.merge(source.sketch);
+  }
+
+  if (!source.current_aggregate) return;
+
+  if (!target.current_aggregate) {
+    target.current_aggregate = std::move(source.current_aggregate);
+    return;
+  }
+
+  if constexpr (function == AggregateFunction::Min) {
+    if (value_smaller(*source.current_aggregate, *target.current_aggregate)) {
+      target.current_aggregate = std::move(source.current_aggregate);
+    }
+  } else if constexpr (function == AggregateFunction::Max) {
+    if (value_greater(*source.current_aggregate, *target.current_aggregate)) {
+      target.current_aggregate = std::move(source.current_aggregate);
+    }
+  } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+    *target.current_aggregate += *source.current_aggregate;
+  }
+}
+
+// The spilled groups of a partition are written as blocks, one per spilled chunk: the number of groups, the keys and
+// first rows of the groups, and then all results of the groups for each aggregate column in turn
+template <typename AggregateKey>
+void write_spilled_key(SpillFile& file, const AggregateKey& key) {
+  if constexpr (std::is_same_v<AggregateKey, pmr_vector<AggregateKeyEntry>>) {
+    file.write(key.data(), key.size() * sizeof(AggregateKeyEntry));
+  } else {
+    file.write(&key, sizeof(AggregateKey));
+  }
+}
+
+// The key needs to have the size of the spilled keys already
+template <typename AggregateKey>
+void read_spilled_key(SpillFile& file, AggregateKey& key) {
+  if constexpr (std::is_same_v<AggregateKey, pmr_vector<AggregateKeyEntry>>) {
+    Assert(file.read(key.data(), key.size() * sizeof(AggregateKeyEntry)), "Spill file is truncated");
+  } else {
+    Assert(file.read(&key, sizeof(AggregateKey)), "Spill file is truncated");
+  }
+}
+
+template <typename T>
+void write_spilled_value(SpillFile& file, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto length = static_cast<uint32_t>(value.size());
+    file.write(&length, sizeof(length));
+    file.write(value.data(), length);
+  } else {
+    file.write(&value, sizeof(T));
+  }
+}
+
+template <typename T>
+void read_spilled_value(SpillFile& file, T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto length = uint32_t{0};
+    Assert(file.read(&length, sizeof(length)), "Spill file is truncated");
+    value.resize(length);
+    Assert(file.read(value.data(), length), "Spill file is truncated");
+  } else {
+    Assert(file.read(&value, sizeof(T)), "Spill file is truncated");
+  }
+}
+
+// The row_id of the result is not written, the spilled groups store their first rows separately
+template <typename ColumnDataType, typename AggregateType>
+void write_spilled_result(SpillFile& file, const AggregateResult<ColumnDataType, AggregateType>& result) {
+  file.write(&result.aggregate_count, sizeof(size_t));
+  file.write(&result.sum_of_squares, sizeof(double));
+
+  const auto has_aggregate = result.current_aggregate.has_value();
+  file.write(&has_aggregate, sizeof(bool));
+  if (has_aggregate) write_spilled_value(file, *result.current_aggregate);
+
+  const auto distinct_value_count = result.distinct_values.size();
+  file.write(&distinct_value_count, sizeof(size_t));
+  for (const auto& distinct_value : result.distinct_values) {
+    write_spilled_value(file, distinct_value);
+  }
+
+  const auto& sparse_registers = result.sketch.sparse_registers();
+  const auto sparse_register_count = sparse_registers.size();
+  file.write(&sparse_register_count, sizeof(size_t));
+  file.write(sparse_registers.data(), sparse_register_count * sizeof(uint32_t));
+
+  const auto& dense_registers = result.sketch.dense_registers();
+  const auto dense_register_count = dense_registers.size();
+  file.write(&dense_register_count, sizeof(size_t));
+  file.write(dense_registers.data(), dense_register_count);
+}
+
+// Overwrites all of the result except for its row_id
+template <typename ColumnDataType, typename AggregateType>
+void read_spilled_result(SpillFile& file, AggregateResult<ColumnDataType, AggregateType>& result) {
+  Assert(file.read(&result.aggregate_count, sizeof(size_t)), "Spill file is truncated");
+  Assert(file.read(&result.sum_of_squares, sizeof(double)), "Spill file is truncated");
+
+  auto has_aggregate = false;
+  Assert(file.read(&has_aggregate, sizeof(bool)), "Spill file is truncated");
+  if (has_aggregate) {
+    auto aggregate = AggregateType{};
+    read_spilled_value(file, aggregate);
+    result.current_aggregate = std::move(aggregate);
+  } else {
+    result.current_aggregate.reset();
+  }
 
-  auto result_id = results.size();
+  auto distinct_value_count = size_t{0};
+  Assert(file.read(&distinct_value_count, sizeof(size_t)), "Spill file is truncated");
+  result.distinct_values.clear();
+  auto distinct_value = ColumnDataType{};
+  for (auto value_index = size_t{0}; value_index < distinct_value_count; ++value_index) {
+    read_spilled_value(file, distinct_value);
+    result.distinct_values.emplace_hint(result.distinct_values.end(), distinct_value);
+  }
 
-  result_ids.emplace_hint(it, key, result_id);
+  auto sparse_register_count = size_t{0};
+  Assert(file.read(&sparse_register_count, sizeof(size_t)), "Spill file is truncated");
+  auto sparse_registers = std::vector<uint32_t>(sparse_register_count);
+  Assert(file.read(sparse_registers.data(), sparse_register_count * sizeof(uint32_t)), "Spill file is truncated");
 
-  // If it was added to the id map, add the current row id to the result list so that we can revert the
-  // value(s) -> key mapping
-  results.emplace_back();
-  results[result_id].row_id = row_id;
+  auto dense_register_count = size_t{0};
+  Assert(file.read(&dense_register_count, sizeof(size_t)), "Spill file is truncated");
+  auto dense_registers = std::vector<uint8_t>(dense_register_count);
+  Assert(file.read(dense_registers.data(), dense_register_count), "Spill file is truncated");
 
-  return results[result_id];
+  result.sketch = HyperLogLog{std::move(sparse_registers), std::move(dense_registers)};
 }
 }  // namespace
 
@@ -54,20 +199,48 @@ namespace opossum {
 
 Aggregate::Aggregate(const std::shared_ptr<AbstractOperator>& in,
                      const std::vector<AggregateColumnDefinition>& aggregates,
-                     const std::vector<ColumnID>& groupby_column_ids)
+                     const std::vector<ColumnID>& groupby_column_ids, const bool input_is_sorted,
+                     const std::optional<SpillOptions>& spill_options,
+                     const std::optional<AggregateApproximation>& approximation)
     : AbstractReadOnlyOperator(OperatorType::Aggregate, in),
       _aggregates(aggregates),
-      _groupby_column_ids(groupby_column_ids) {
+      _groupby_column_ids(groupby_column_ids),
+      _input_is_sorted(input_is_sorted),
+      _spill_options(spill_options),
+      _approximation(approximation) {
   Assert(!(aggregates.empty() && groupby_column_ids.empty()),
          "Neither aggregate nor groupby columns have been specified");
+  Assert(!approximation || (approximation->sample_fraction > 0.0 && approximation->sample_fraction <= 1.0),
+         "The sample fraction has to be greater than 0 and at most 1.");
+  Assert(!approximation || (approximation->confidence > 0.0 && approximation->confidence < 1.0),
+         "The confidence has to be between 0 and 1.");
 }
 
 const std::vector<AggregateColumnDefinition>& Aggregate::aggregates() const { return _aggregates; }
 
 const std::vector<ColumnID>& Aggregate::groupby_column_ids() const { return _groupby_column_ids; }
 
+bool Aggregate::input_is_sorted() const { return _input_is_sorted; }
+
+const std::optional<SpillOptions>& Aggregate::spill_options() const { return _spill_options; }
+
+const std::optional<AggregateApproximation>& Aggregate::approximation() const { return _approximation; }
+
 const std::string Aggregate::name() const { return "Aggregate"; }
 
+std::optional<SpillOptions> Aggregate::_effective_spill_options() const {
+  if (_spill_options) return _spill_options;
+
+  const auto* const tracking_memory_resource = dynamic_cast<const TrackingMemoryResource*>(memory_resource());
+  if (!tracking_memory_resource) return std::nullopt;
+
+  const auto remaining_bytes = tracking_memory_resource->remaining_bytes();
+  if (!remaining_bytes) return std::nullopt;
+
+  // Leave the other half to the remaining operators of the query
+  return SpillOptions{*remaining_bytes / 2};
+}
+
 const std::string Aggregate::description(DescriptionMode description_mode) const {
   std::stringstream desc;
   desc << "[Aggregate] GroupBy ColumnIDs: ";
@@ -92,13 +265,20 @@ const std::string Aggregate::description(DescriptionMode description_mode) const
 
     if (expression_idx + 1 < _aggregates.size()) desc << ", ";
   }
+
+  if (_input_is_sorted) desc << " (sorted input)";
+  if (_approximation) {
+    desc << " (approximated from a " << _approximation->sample_fraction * 100 << "% sample, "
+         << _approximation->confidence * 100 << "% confidence)";
+  }
   return desc.str();
 }
 
 std::shared_ptr<AbstractOperator> Aggregate::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Aggregate>(copied_input_left, _aggregates, _groupby_column_ids);
+  return std::make_shared<Aggregate>(copied_input_left, _aggregates, _groupby_column_ids, _input_is_sorted,
+                                     _spill_options, _approximation);
 }
 
 void Aggregate::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -106,8 +286,7 @@ void Aggregate::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 void Aggregate::_on_cleanup() { _contexts_per_column.clear(); }
 
 /*
-Visitor context for the AggregateVisitor. The AggregateResultContext can be used without knowing the
-AggregateKey, the AggregateContext is the "full" version.
+Context that holds the AggregateResults of an aggregate column, either of a chunk, of a partition, or the final ones.
 */
 template <typename ColumnDataType, typename AggregateType>
 struct AggregateResultContext : SegmentVisitorContext {
@@ -119,16 +298,6 @@ struct AggregateResultContext : SegmentVisitorContext {
   AggregateResults<ColumnDataType, AggregateType> results;
 };
 
-template <typename ColumnDataType, typename AggregateType, typename AggregateKey>
-struct AggregateContext : public AggregateResultContext<ColumnDataType, AggregateType> {
-  AggregateContext() {
-    auto allocator = AggregateResultIdMapAllocator<AggregateKey>{&this->buffer};
-    result_ids = std::make_unique<AggregateResultIdMap<AggregateKey>>(allocator);
-  }
-
-  std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
-};
-
 /*
 The AggregateFunctionBuilder is used to create the lambda function that will be used by
 the AggregateVisitor. It is a separate class because methods cannot be partially specialized.
@@ -201,23 +370,116 @@ struct AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction
   }
 };
 
-template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                   const KeysPerChunk<AggregateKey>& keys_per_chunk) {
-  using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
+template <typename ColumnDataType, typename AggregateType>
+struct AggregateFunctionBuilder<ColumnDataType, AggregateType, AggregateFunction::ApproxCountDistinct> {
+  auto get_aggregate_function() {
+    return [](const ColumnDataType&, std::optional<AggregateType>& current_aggregate) { return std::nullopt; };
+  }
+};
+
+template <typename Functor>
+void Aggregate::_resolve_aggregate(const ColumnID column_index, const Functor& functor) const {
+  // The dummy context for DISTINCT uses small types
+  if (_aggregates.empty()) {
+    functor(hana::type_c<DistinctColumnType>, hana::type_c<DistinctAggregateType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+    return;
+  }
+
+  const auto& aggregate = _aggregates[column_index];
+
+  // SELECT COUNT(*) - we know the template arguments, so we don't need to resolve them
+  if (!aggregate.column) {
+    functor(hana::type_c<CountColumnType>, hana::type_c<CountAggregateType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+    return;
+  }
+
+  resolve_data_type(input_table_left()->column_data_type(*aggregate.column), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto resolve_function = [&](auto function) {
+      using AggregateType = typename AggregateTraits<ColumnDataType, decltype(function)::value>::AggregateType;
+      functor(type, hana::type_c<AggregateType>, function);
+    };
+
+    switch (aggregate.function) {
+      case AggregateFunction::Min:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+        break;
+      case AggregateFunction::Max:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+        break;
+      case AggregateFunction::Sum:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+        break;
+      case AggregateFunction::Avg:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+        break;
+      case AggregateFunction::Count:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+        break;
+      case AggregateFunction::CountDistinct:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+        break;
+      case AggregateFunction::ApproxCountDistinct:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::ApproxCountDistinct>{});
+        break;
+    }
+  });
+}
+
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
+                                   const std::vector<AggregateResultId>& group_ids,
+                                   AggregateResults<ColumnDataType, AggregateType>& results) const {
+  /**
+   * Special COUNT(*) implementation, also used for the dummy context of DISTINCT.
+   * Because COUNT(*) does not have a specific target column, we count the occurrences of each group.
+   * The results are saved in the regular aggregate_count variable so that we don't need a
+   * specific output logic for COUNT(*).
+   */
+  if (_aggregates.empty() || !_aggregates[column_index].column) {
+    for (const auto group_id : group_ids) {
+      ++results[group_id].aggregate_count;
+    }
+    return;
+  }
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
+  [[maybe_unused]] const auto sum_up_squares = _approximation.has_value();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
-      _contexts_per_column[column_index]);
+  const auto& base_segment = *input_table_left()->get_chunk(chunk_id)->get_segment(*_aggregates[column_index].column);
 
-  auto& result_ids = *context.result_ids;
-  auto& results = context.results;
-  const auto& hash_keys = keys_per_chunk[chunk_id];
+  if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+    // Each value of the dictionary is hashed only once, and the rows are added to the sketches by their value ids
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&base_segment)) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      auto hashes = std::vector<uint64_t>(dictionary.size());
+      for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+        hashes[value_id] = HyperLogLog::hash(dictionary[value_id]);
+      }
+
+      const auto null_value_id = static_cast<uint32_t>(dictionary_segment->null_value_id());
+      resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        auto chunk_offset = ChunkOffset{0};
+        for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+             ++value_id_it, ++chunk_offset) {
+          const auto value_id = static_cast<uint32_t>(*value_id_it);
+          if (value_id == null_value_id) continue;
+
+          auto& result = results[group_ids[chunk_offset]];
+          result.sketch.add_hash(hashes[value_id]);
+          ++result.aggregate_count;
+        }
+      });
+      return;
+    }
+  }
 
   ChunkOffset chunk_offset{0};
   segment_iterate<ColumnDataType>(base_segment, [&](const auto& position) {
-    auto& result = get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID(chunk_id, chunk_offset));
+    auto& result = results[group_ids[chunk_offset]];
 
     /**
     * If the value is NULL, the current aggregate value does not change.
@@ -229,11 +491,22 @@ void Aggregate::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, cons
       // increase value counter
       ++result.aggregate_count;
 
+      if constexpr (function == AggregateFunction::Sum && std::is_arithmetic_v<ColumnDataType>) {
+        if (sum_up_squares) {
+          const auto value = static_cast<double>(position.value());
+          result.sum_of_squares += value * value;
+        }
+      }
+
       if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
         // clang-tidy error: https://bugs.llvm.org/show_bug.cgi?id=35824
         // for the case of CountDistinct, insert this value into the set to keep track of distinct values
         result.distinct_values.insert(position.value());
       }
+
+      if constexpr (function == AggregateFunction::ApproxCountDistinct) {
+        result.sketch.add(position.value());
+      }
     }
 
     ++chunk_offset;
@@ -258,21 +531,6 @@ void Aggregate::_aggregate() {
     DebugAssert(groupby_column_id < input_table->column_count(), "GroupBy column index out of bounds");
   }
 
-  // check for invalid aggregates
-  for (const auto& aggregate : _aggregates) {
-    if (!aggregate.column) {
-      if (aggregate.function != AggregateFunction::Count) {
-        Fail("Aggregate: Asterisk is only valid with COUNT");
-      }
-    } else {
-      DebugAssert(*aggregate.column < input_table->column_count(), "Aggregate column index out of bounds");
-      if (input_table->column_data_type(*aggregate.column) == DataType::String &&
-          (aggregate.function == AggregateFunction::Sum || aggregate.function == AggregateFunction::Avg)) {
-        Fail("Aggregate: Cannot calculate SUM or AVG on string column");
-      }
-    }
-  }
-
   /*
   PARTITIONING PHASE
   First we partition the input chunks by the given group key(s).
@@ -383,173 +641,675 @@ void Aggregate::_aggregate() {
 
   /*
   AGGREGATION PHASE
+  The rows are aggregated in two steps. First, each chunk is pre-aggregated on its own and in parallel: the groups of
+  the chunk get consecutive ids from an AggregateGroupIdMap, which stays small and cache-resident for chunks with few
+  groups, and the AggregateResults of the chunk are indexed by these ids. Second, the pre-aggregated groups of all
+  chunks are radix partitioned by their AggregateKey and the partitions are merged in parallel, each with its own
+  AggregateGroupIdMap. The final results are the concatenation of the partitions' results. If there is only one
+  partition, the groups keep the order in which they first occur in the input.
+
+  Without aggregates (i.e., for DISTINCT), a dummy context is used, so that _contexts_per_column always has at least
+  one context with results. This is important later on when we write the group keys into the table.
+
+  If spill options are given, the pre-aggregated groups are counted against the memory budget. Once they exceed it,
+  the groups of every further chunk are radix partitioned right after the chunk's pre-aggregation and appended to one
+  SpillFile per partition, and afterwards the groups of the chunks that were kept in memory are spilled as well. The
+  partitions are then read back and merged, as many at a time as fit into the budget together. The AggregateKeys of
+  the input rows and the merged results are not counted against the budget.
   */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  const auto chunk_count = input_table->chunk_count();
+  const auto context_count = std::max(_aggregates.size(), size_t{1});
 
-  if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
+  auto groups_per_chunk = std::vector<AggregateGroups<AggregateKey>>(chunk_count);
+  auto contexts_per_chunk = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(chunk_count);
 
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
-    _contexts_per_column.push_back(context);
+  auto bytes_per_group = sizeof(AggregateKey) + sizeof(RowID);
+  if constexpr (std::is_same_v<AggregateKey, pmr_vector<AggregateKeyEntry>>) {
+    bytes_per_group += _groupby_column_ids.size() * sizeof(AggregateKeyEntry);
+  }
+  for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+    _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto /*function*/) {
+      using ColumnDataType = typename decltype(column_type)::type;
+      using AggregateType = typename decltype(aggregate_type)::type;
+      bytes_per_group += sizeof(AggregateResult<ColumnDataType, AggregateType>);
+    });
   }
 
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  for (ColumnID column_id{0}; column_id < _aggregates.size(); ++column_id) {
-    const auto& aggregate = _aggregates[column_id];
-    if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      _contexts_per_column[column_id] = context;
-      continue;
+  const auto spill_options = _effective_spill_options();
+
+  // There is at most one group per row, so that the spilled partitions of the groups fit into the budget one by one
+  auto spill_radix_bits = size_t{0};
+  while (spill_options && spill_radix_bits < MAX_SPILL_RADIX_BITS &&
+         ((input_table->row_count() * bytes_per_group) >> spill_radix_bits) > spill_options->memory_budget) {
+    ++spill_radix_bits;
+  }
+  const auto spill_partition_count = size_t{1} << spill_radix_bits;
+
+  auto pre_aggregated_bytes = std::atomic<size_t>{0};
+  auto is_spilled_by_chunk = std::vector<uint8_t>(chunk_count);
+  auto spill_mutex = std::mutex{};
+  auto spill_files = std::vector<std::unique_ptr<SpillFile>>{};
+  auto spilled_bytes_per_partition = std::vector<size_t>(spill_partition_count);
+
+  // Appends the pre-aggregated groups of the chunk to the spill files and releases them
+  const auto spill_chunk = [&](const ChunkID chunk_id) {
+    auto& groups = groups_per_chunk[chunk_id];
+    auto& contexts = contexts_per_chunk[chunk_id];
+
+    auto group_ids_by_partition = std::vector<std::vector<AggregateResultId>>(spill_partition_count);
+    for (auto group_id = AggregateResultId{0}; group_id < groups.keys.size(); ++group_id) {
+      const auto partition_id =
+          AggregateGroupIdMap<AggregateKey>::partition_hash(groups.keys[group_id]) & (spill_partition_count - 1);
+      group_ids_by_partition[partition_id].emplace_back(group_id);
+    }
+
+    {
+      const auto lock = std::lock_guard<std::mutex>{spill_mutex};
+      if (spill_files.empty()) {
+        for (auto partition_id = size_t{0}; partition_id < spill_partition_count; ++partition_id) {
+          spill_files.emplace_back(std::make_unique<SpillFile>(spill_options->directory));
+        }
+      }
+
+      for (auto partition_id = size_t{0}; partition_id < spill_partition_count; ++partition_id) {
+        const auto& group_ids = group_ids_by_partition[partition_id];
+        if (group_ids.empty()) continue;
+
+        auto& spill_file = *spill_files[partition_id];
+        const auto group_count = group_ids.size();
+        spill_file.write(&group_count, sizeof(size_t));
+        for (const auto group_id : group_ids) {
+          write_spilled_key(spill_file, groups.keys[group_id]);
+          spill_file.write(&groups.row_ids[group_id], sizeof(RowID));
+        }
+
+        for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+          _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto /*function*/) {
+            using ColumnDataType = typename decltype(column_type)::type;
+            using AggregateType = typename decltype(aggregate_type)::type;
+            using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+            const auto& results = std::static_pointer_cast<Context>(contexts[column_index])->results;
+            for (const auto group_id : group_ids) {
+              write_spilled_result(spill_file, results[group_id]);
+            }
+          });
+        }
+
+        spilled_bytes_per_partition[partition_id] += group_count * bytes_per_group;
+      }
+    }
+
+    groups = AggregateGroups<AggregateKey>{};
+    contexts.clear();
+    is_spilled_by_chunk[chunk_id] = true;
+  };
+
+  MorselPlanner::for_each_chunk(type(), *input_table, [&](const ChunkID chunk_id) {
+    const auto& keys = keys_per_chunk[chunk_id];
+    auto& groups = groups_per_chunk[chunk_id];
+
+    auto group_id_map = AggregateGroupIdMap<AggregateKey>{};
+    auto group_ids = std::vector<AggregateResultId>(keys.size());
+    for (ChunkOffset chunk_offset{0}; chunk_offset < keys.size(); ++chunk_offset) {
+      const auto [group_id, inserted] = group_id_map.find_or_insert(keys[chunk_offset]);
+      group_ids[chunk_offset] = group_id;
+
+      if (inserted) {
+        // Remember the first row of the group, so that we can reconstruct the group's values later
+        groups.keys.emplace_back(keys[chunk_offset]);
+        groups.row_ids.emplace_back(chunk_id, chunk_offset);
+      }
+    }
+
+    auto& contexts = contexts_per_chunk[chunk_id];
+    contexts.resize(context_count);
+    for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+      _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto function) {
+        using ColumnDataType = typename decltype(column_type)::type;
+        using AggregateType = typename decltype(aggregate_type)::type;
+
+        auto context = std::make_shared<AggregateResultContext<ColumnDataType, AggregateType>>();
+        context->results.resize(groups.keys.size());
+        _aggregate_segment<ColumnDataType, AggregateType, decltype(function)::value>(chunk_id, column_index,
+                                                                                    group_ids, context->results);
+        contexts[column_index] = context;
+      });
+    }
+
+    if (spill_options) {
+      const auto chunk_bytes = groups.keys.size() * bytes_per_group;
+      if (pre_aggregated_bytes.fetch_add(chunk_bytes) + chunk_bytes > spill_options->memory_budget) {
+        spill_chunk(chunk_id);
+      }
+    }
+  });
+
+  if (!spill_files.empty()) {
+    jobs.clear();
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (is_spilled_by_chunk[chunk_id]) continue;
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() { spill_chunk(chunk_id); }));
+      jobs.back()->schedule(input_table->get_chunk(chunk_id)->preferred_node_id());
     }
-    auto data_type = input_table->column_data_type(*aggregate.column);
-    _contexts_per_column[column_id] = _create_aggregate_context<AggregateKey>(data_type, aggregate.function);
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    for (auto& spill_file : spill_files) {
+      spill_file->rewind();
+    }
+
+    auto row_ids_per_partition = std::vector<std::vector<RowID>>(spill_partition_count);
+    auto contexts_per_partition =
+        std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(spill_partition_count);
+
+    // Merges the spilled blocks of the partition like the in-memory merge below merges the chunks' groups
+    const auto merge_spilled_partition = [&](const size_t partition_id) {
+      auto& row_ids = row_ids_per_partition[partition_id];
+      auto& contexts = contexts_per_partition[partition_id];
+      contexts.resize(context_count);
+      for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+        _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto /*function*/) {
+          using ColumnDataType = typename decltype(column_type)::type;
+          using AggregateType = typename decltype(aggregate_type)::type;
+          contexts[column_index] = std::make_shared<AggregateResultContext<ColumnDataType, AggregateType>>();
+        });
+      }
+
+      auto& spill_file = *spill_files[partition_id];
+      auto group_id_map = AggregateGroupIdMap<AggregateKey>{};
+      auto key = AggregateKey{};
+      if constexpr (std::is_same_v<AggregateKey, pmr_vector<AggregateKeyEntry>>) {
+        key = AggregateKey(_groupby_column_ids.size());
+      }
+
+      auto block_group_count = size_t{0};
+      auto merged_group_ids = std::vector<AggregateResultId>{};
+      while (spill_file.read(&block_group_count, sizeof(size_t))) {
+        merged_group_ids.resize(block_group_count);
+        for (auto block_group_id = size_t{0}; block_group_id < block_group_count; ++block_group_id) {
+          read_spilled_key(spill_file, key);
+          auto row_id = RowID{};
+          Assert(spill_file.read(&row_id, sizeof(RowID)), "Spill file is truncated");
+
+          const auto [group_id, inserted] = group_id_map.find_or_insert(key);
+          merged_group_ids[block_group_id] = group_id;
+          if (inserted) row_ids.emplace_back(row_id);
+        }
+
+        for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+          _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto function) {
+            using ColumnDataType = typename decltype(column_type)::type;
+            using AggregateType = typename decltype(aggregate_type)::type;
+            using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+            auto& results = std::static_pointer_cast<Context>(contexts[column_index])->results;
+            results.resize(row_ids.size());
+
+            auto spilled_result = AggregateResult<ColumnDataType, AggregateType>{};
+            for (const auto group_id : merged_group_ids) {
+              read_spilled_result(spill_file, spilled_result);
+              merge_aggregate_results<ColumnDataType, AggregateType, decltype(function)::value>(results[group_id],
+                                                                                              spilled_result);
+            }
+          });
+        }
+      }
+
+      spill_files[partition_id].reset();
+    };
+
+    // Merge consecutive partitions in parallel as long as their spilled groups fit into the budget together
+    for (auto partition_begin = size_t{0}; partition_begin < spill_partition_count;) {
+      auto partition_end = partition_begin + 1;
+      auto merged_bytes = spilled_bytes_per_partition[partition_begin];
+      while (partition_end < spill_partition_count &&
+             merged_bytes + spilled_bytes_per_partition[partition_end] <= spill_options->memory_budget) {
+        merged_bytes += spilled_bytes_per_partition[partition_end];
+        ++partition_end;
+      }
+
+      jobs.clear();
+      for (auto partition_id = partition_begin; partition_id < partition_end; ++partition_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() { merge_spilled_partition(partition_id); }));
+        jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(jobs);
+
+      partition_begin = partition_end;
+    }
+
+    _concatenate_partitions(row_ids_per_partition, contexts_per_partition);
+    return;
   }
 
-  // Process Chunks and perform aggregations
-  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    auto chunk_in = input_table->get_chunk(chunk_id);
-
-    const auto& hash_keys = keys_per_chunk[chunk_id];
-
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
-
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
-
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
-
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-        // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
+  // Choose the number of partitions so that their AggregateGroupIdMaps stay small
+  auto pre_aggregated_group_count = size_t{0};
+  for (const auto& groups : groups_per_chunk) {
+    pre_aggregated_group_count += groups.keys.size();
+  }
+
+  auto radix_bits = size_t{0};
+  while (radix_bits < MAX_RADIX_BITS && (pre_aggregated_group_count >> radix_bits) > MAX_GROUPS_PER_PARTITION) {
+    ++radix_bits;
+  }
+  const auto partition_count = size_t{1} << radix_bits;
+
+  // Sort the groups of each chunk by their partition
+  MorselPlanner::for_each_chunk(type(), *input_table, [&](const ChunkID chunk_id) {
+    auto& groups = groups_per_chunk[chunk_id];
+    groups.partition_offsets = std::vector<size_t>(partition_count + 1);
+    groups.partitioned_group_ids.resize(groups.keys.size());
+
+    if (partition_count == 1) {
+      groups.partition_offsets[1] = groups.keys.size();
+      std::iota(groups.partitioned_group_ids.begin(), groups.partitioned_group_ids.end(), AggregateResultId{0});
+      return;
+    }
+
+    const auto partition_mask = partition_count - 1;
+    auto partition_ids = std::vector<size_t>(groups.keys.size());
+    for (auto group_id = AggregateResultId{0}; group_id < groups.keys.size(); ++group_id) {
+      partition_ids[group_id] = AggregateGroupIdMap<AggregateKey>::partition_hash(groups.keys[group_id]) &
+                                partition_mask;
+      ++groups.partition_offsets[partition_ids[group_id] + 1];
+    }
+    std::partial_sum(groups.partition_offsets.begin(), groups.partition_offsets.end(),
+                     groups.partition_offsets.begin());
+
+    auto write_offsets = groups.partition_offsets;
+    for (auto group_id = AggregateResultId{0}; group_id < groups.keys.size(); ++group_id) {
+      groups.partitioned_group_ids[write_offsets[partition_ids[group_id]]++] = group_id;
+    }
+  });
+
+  // Merge the pre-aggregated groups of each partition
+  auto row_ids_per_partition = std::vector<std::vector<RowID>>(partition_count);
+  auto contexts_per_partition = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+
+  jobs.clear();
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& row_ids = row_ids_per_partition[partition_id];
+
+      // The ids of the partition's groups for the pre-aggregated groups of all chunks, in the order of the chunks
+      auto group_id_map = AggregateGroupIdMap<AggregateKey>{};
+      auto merged_group_ids = std::vector<AggregateResultId>{};
+      for (const auto& groups : groups_per_chunk) {
+        for (auto offset = groups.partition_offsets[partition_id]; offset < groups.partition_offsets[partition_id + 1];
+             ++offset) {
+          const auto chunk_group_id = groups.partitioned_group_ids[offset];
+          const auto [group_id, inserted] = group_id_map.find_or_insert(groups.keys[chunk_group_id]);
+          merged_group_ids.emplace_back(group_id);
+          if (inserted) row_ids.emplace_back(groups.row_ids[chunk_group_id]);
+        }
       }
-    } else {
-      ColumnID column_index{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-        if (!aggregate.column && aggregate.function == AggregateFunction::Count) {
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[column_index]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
 
-          // count occurrences for each group key
-          for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-            auto& result =
-                get_or_add_result(result_ids, results, hash_keys[chunk_offset], RowID{chunk_id, chunk_offset});
-            ++result.aggregate_count;
+      auto& contexts = contexts_per_partition[partition_id];
+      contexts.resize(context_count);
+      for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+        _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto function) {
+          using ColumnDataType = typename decltype(column_type)::type;
+          using AggregateType = typename decltype(aggregate_type)::type;
+          using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+          auto context = std::make_shared<Context>();
+          auto& results = context->results;
+          results.resize(row_ids.size());
+
+          auto merged_group_id_iter = merged_group_ids.cbegin();
+          for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+            const auto& groups = groups_per_chunk[chunk_id];
+            const auto chunk_context = std::static_pointer_cast<Context>(contexts_per_chunk[chunk_id][column_index]);
+            auto& chunk_results = chunk_context->results;
+            for (auto offset = groups.partition_offsets[partition_id];
+                 offset < groups.partition_offsets[partition_id + 1]; ++offset) {
+              merge_aggregate_results<ColumnDataType, AggregateType, decltype(function)::value>(
+                  results[*merged_group_id_iter++], chunk_results[groups.partitioned_group_ids[offset]]);
+            }
           }
+          contexts[column_index] = context;
+        });
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  _concatenate_partitions(row_ids_per_partition, contexts_per_partition);
+}
+
+void Aggregate::_concatenate_partitions(
+    const std::vector<std::vector<RowID>>& row_ids_per_partition,
+    std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>& contexts_per_partition) {
+  const auto partition_count = row_ids_per_partition.size();
+  const auto context_count = std::max(_aggregates.size(), size_t{1});
 
-          ++column_index;
-          continue;
+  auto group_count = size_t{0};
+  for (const auto& row_ids : row_ids_per_partition) {
+    group_count += row_ids.size();
+  }
+
+  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(context_count);
+  for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+    _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto /*function*/) {
+      using ColumnDataType = typename decltype(column_type)::type;
+      using AggregateType = typename decltype(aggregate_type)::type;
+      using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+      auto context = std::make_shared<Context>();
+      context->results.reserve(group_count);
+      for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+        auto& partition_results =
+            std::static_pointer_cast<Context>(contexts_per_partition[partition_id][column_index])->results;
+        const auto& row_ids = row_ids_per_partition[partition_id];
+        for (auto group_id = AggregateResultId{0}; group_id < row_ids.size(); ++group_id) {
+          auto& result = context->results.emplace_back(std::move(partition_results[group_id]));
+          result.row_id = row_ids[group_id];
         }
+      }
+      _contexts_per_column[column_index] = context;
+    });
+  }
+}
 
-        auto base_segment = chunk_in->get_segment(*aggregate.column);
-        auto data_type = input_table->column_data_type(*aggregate.column);
+/*
+If the rows of each group are adjacent, a row starts a new group if one of its group-by values differs from those of
+the previous row. The input is processed one chunk at a time and the only memory needed apart from the results are
+the group ids of the chunk's rows. NULLs are treated as equal to each other, just like in the hash-based aggregation.
+*/
+void Aggregate::_aggregate_sorted() {
+  const auto& input_table = input_table_left();
+  const auto context_count = std::max(_aggregates.size(), size_t{1});
+
+  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(context_count);
+  for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+    _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto /*function*/) {
+      using ColumnDataType = typename decltype(column_type)::type;
+      using AggregateType = typename decltype(aggregate_type)::type;
+      _contexts_per_column[column_index] = std::make_shared<AggregateResultContext<ColumnDataType, AggregateType>>();
+    });
+  }
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+  // The first row of each group
+  auto row_ids = std::vector<RowID>{};
+  auto previous_row_id = NULL_ROW_ID;
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    if (chunk_size == 0) continue;
+
+    auto starts_group = std::vector<uint8_t>(chunk_size, 0);
+
+    // The first row of the chunk is compared with the last row of the previous chunk
+    if (previous_row_id.is_null()) {
+      starts_group[0] = 1;
+    } else {
+      const auto previous_chunk = input_table->get_chunk(previous_row_id.chunk_id);
+      for (const auto column_id : _groupby_column_ids) {
+        const auto previous_value = (*previous_chunk->get_segment(column_id))[previous_row_id.chunk_offset];
+        const auto value = (*chunk->get_segment(column_id))[0];
+        const auto both_null = variant_is_null(previous_value) && variant_is_null(value);
+        if (!both_null && previous_value != value) starts_group[0] = 1;
+      }
+    }
+
+    for (const auto column_id : _groupby_column_ids) {
+      resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate.function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, column_index,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, column_index,
-                                                                                         *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, column_index, *base_segment, keys_per_chunk);
-              break;
+        auto previous_value = std::optional<ColumnDataType>{};
+        ChunkOffset chunk_offset{0};
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          const auto is_null = position.is_null();
+          const auto changed = chunk_offset == 0 || is_null != !previous_value ||
+                               (!is_null && *previous_value != position.value());
+          if (changed) {
+            if (chunk_offset > 0) starts_group[chunk_offset] = 1;
+            previous_value = is_null ? std::nullopt : std::optional<ColumnDataType>{position.value()};
           }
+          ++chunk_offset;
         });
+      });
+    }
 
-        ++column_index;
+    auto group_ids = std::vector<AggregateResultId>(chunk_size);
+    auto group_id = row_ids.empty() ? AggregateResultId{0} : AggregateResultId{row_ids.size() - 1};
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (starts_group[chunk_offset]) {
+        group_id = row_ids.size();
+        row_ids.emplace_back(chunk_id, chunk_offset);
       }
+      group_ids[chunk_offset] = group_id;
+    }
+
+    for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+      _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto function) {
+        using ColumnDataType = typename decltype(column_type)::type;
+        using AggregateType = typename decltype(aggregate_type)::type;
+        using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+        auto& results = std::static_pointer_cast<Context>(_contexts_per_column[column_index])->results;
+        results.resize(row_ids.size());
+        _aggregate_segment<ColumnDataType, AggregateType, decltype(function)::value>(chunk_id, column_index, group_ids,
+                                                                                    results);
+      });
     }
+
+    previous_row_id = RowID{chunk_id, static_cast<ChunkOffset>(chunk_size - 1)};
+  }
+
+  for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+    _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto /*function*/) {
+      using ColumnDataType = typename decltype(column_type)::type;
+      using AggregateType = typename decltype(aggregate_type)::type;
+      using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+      auto& results = std::static_pointer_cast<Context>(_contexts_per_column[column_index])->results;
+      for (auto group_id = AggregateResultId{0}; group_id < row_ids.size(); ++group_id) {
+        results[group_id].row_id = row_ids[group_id];
+      }
+    });
   }
 }
 
-std::shared_ptr<const Table> Aggregate::_on_execute() {
-  // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
-  // The reason we only have specializations up to 2 is because every specialization increases the compile time.
-  // Also, we need to make sure that there are tests for at least the first case, one array case, and the fallback.
-  switch (_groupby_column_ids.size()) {
-    case 0:
-    case 1:
-      // No need for a complex data structure if we only have one entry
-      _aggregate<AggregateKeyEntry>();
-      break;
-    case 2:
-      // We need to explicitly list all array sizes that we want to support
-      _aggregate<std::array<AggregateKeyEntry, 2>>();
-      break;
-    default:
-      PerformanceWarning("No std::array implementation initialized - falling back to vector");
-      _aggregate<pmr_vector<AggregateKeyEntry>>();
-      break;
+bool Aggregate::_can_aggregate_on_value_ids() const {
+  const auto& input_table = input_table_left();
+  if (_groupby_column_ids.size() != 1 || input_table->type() != TableType::Data || input_table->chunk_count() == 0) {
+    return false;
   }
 
+  const auto column_id = _groupby_column_ids.front();
+  auto all_segments_dictionary_encoded = true;
+  resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+      const auto segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
+      if (!std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment)) {
+        all_segments_dictionary_encoded = false;
+        return;
+      }
+    }
+  });
+  return all_segments_dictionary_encoded;
+}
+
+/*
+If the only group-by column is dictionary encoded, the value ids of a chunk's segment already are dense ids of the
+chunk's groups, with the NULL group at null_value_id(). Each chunk is pre-aggregated into an array that is indexed by
+the value ids. The dictionaries of all chunks are then merged into one sorted dictionary, which maps the value ids of
+each chunk to the ids of the merged groups. No value is hashed or compared per row. The groups are output in the order
+of the merged dictionary, followed by the NULL group.
+*/
+template <typename ColumnDataType>
+void Aggregate::_aggregate_on_value_ids() {
   const auto& input_table = input_table_left();
+  const auto column_id = _groupby_column_ids.front();
+  const auto chunk_count = input_table->chunk_count();
+  const auto context_count = std::max(_aggregates.size(), size_t{1});
+
+  auto segments = std::vector<std::shared_ptr<const DictionarySegment<ColumnDataType>>>(chunk_count);
+  auto merged_dictionary = std::vector<ColumnDataType>{};
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    segments[chunk_id] = std::static_pointer_cast<const DictionarySegment<ColumnDataType>>(
+        input_table->get_chunk(chunk_id)->get_segment(column_id));
+    const auto& dictionary = *segments[chunk_id]->dictionary();
+    merged_dictionary.insert(merged_dictionary.end(), dictionary.cbegin(), dictionary.cend());
+  }
+  std::sort(merged_dictionary.begin(), merged_dictionary.end());
+  merged_dictionary.erase(std::unique(merged_dictionary.begin(), merged_dictionary.end()), merged_dictionary.end());
+  const auto null_group_id = AggregateResultId{merged_dictionary.size()};
+
+  // For each chunk and value id, the id of the merged group and the first row with the value id
+  auto merged_group_ids_per_chunk = std::vector<std::vector<AggregateResultId>>(chunk_count);
+  auto row_ids_per_chunk = std::vector<std::vector<RowID>>(chunk_count);
+  auto contexts_per_chunk = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(chunk_count);
+
+  MorselPlanner::for_each_chunk(type(), *input_table, [&](const ChunkID chunk_id) {
+    const auto& segment = *segments[chunk_id];
+    const auto& dictionary = *segment.dictionary();
+    const auto value_id_count = size_t{segment.null_value_id()} + 1;
+
+    // Both dictionaries are sorted, so the search for the next value can start at the previous one
+    auto& merged_group_ids = merged_group_ids_per_chunk[chunk_id];
+    merged_group_ids.resize(value_id_count);
+    auto merged_dictionary_it = merged_dictionary.cbegin();
+    for (ValueID value_id{0}; value_id < dictionary.size(); ++value_id) {
+      merged_dictionary_it = std::lower_bound(merged_dictionary_it, merged_dictionary.cend(), dictionary[value_id]);
+      merged_group_ids[value_id] =
+          static_cast<AggregateResultId>(std::distance(merged_dictionary.cbegin(), merged_dictionary_it));
+    }
+    merged_group_ids[segment.null_value_id()] = null_group_id;
+
+    auto group_ids = std::vector<AggregateResultId>(segment.size());
+    auto& row_ids = row_ids_per_chunk[chunk_id];
+    row_ids.resize(value_id_count, NULL_ROW_ID);
+    resolve_compressed_vector_type(*segment.attribute_vector(), [&](const auto& attribute_vector) {
+      auto chunk_offset = ChunkOffset{0};
+      for (auto value_id_it = attribute_vector.cbegin(); value_id_it != attribute_vector.cend();
+           ++value_id_it, ++chunk_offset) {
+        const auto value_id = static_cast<AggregateResultId>(*value_id_it);
+        group_ids[chunk_offset] = value_id;
+        if (row_ids[value_id].is_null()) row_ids[value_id] = RowID{chunk_id, chunk_offset};
+      }
+    });
+
+    auto& contexts = contexts_per_chunk[chunk_id];
+    contexts.resize(context_count);
+    for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+      _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto function) {
+        using AggregateColumnType = typename decltype(column_type)::type;
+        using AggregateType = typename decltype(aggregate_type)::type;
+
+        auto context = std::make_shared<AggregateResultContext<AggregateColumnType, AggregateType>>();
+        context->results.resize(value_id_count);
+        _aggregate_segment<AggregateColumnType, AggregateType, decltype(function)::value>(
+            chunk_id, column_index, group_ids, context->results);
+        contexts[column_index] = context;
+      });
+    }
+  });
+
+  // The first row of each merged group, NULL_ROW_ID for values that do not occur (e.g., NULL)
+  auto row_ids = std::vector<RowID>(null_group_id + 1, NULL_ROW_ID);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& merged_group_ids = merged_group_ids_per_chunk[chunk_id];
+    const auto& chunk_row_ids = row_ids_per_chunk[chunk_id];
+    for (auto value_id = AggregateResultId{0}; value_id < chunk_row_ids.size(); ++value_id) {
+      auto& row_id = row_ids[merged_group_ids[value_id]];
+      if (row_id.is_null()) row_id = chunk_row_ids[value_id];
+    }
+  }
+
+  // Merge the pre-aggregated results of the chunks, one job per aggregate
+  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(context_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(context_count);
+  for (ColumnID column_index{0}; column_index < context_count; ++column_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_index]() {
+      _resolve_aggregate(column_index, [&](auto column_type, auto aggregate_type, auto function) {
+        using AggregateColumnType = typename decltype(column_type)::type;
+        using AggregateType = typename decltype(aggregate_type)::type;
+        using Context = AggregateResultContext<AggregateColumnType, AggregateType>;
+
+        auto merged_results = AggregateResults<AggregateColumnType, AggregateType>(row_ids.size());
+        for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+          const auto& merged_group_ids = merged_group_ids_per_chunk[chunk_id];
+          const auto& chunk_row_ids = row_ids_per_chunk[chunk_id];
+          auto& chunk_results = std::static_pointer_cast<Context>(contexts_per_chunk[chunk_id][column_index])->results;
+          for (auto value_id = AggregateResultId{0}; value_id < chunk_results.size(); ++value_id) {
+            if (chunk_row_ids[value_id].is_null()) continue;
+            merge_aggregate_results<AggregateColumnType, AggregateType, decltype(function)::value>(
+                merged_results[merged_group_ids[value_id]], chunk_results[value_id]);
+          }
+        }
+
+        // Only output the groups that occur
+        auto context = std::make_shared<Context>();
+        for (auto group_id = AggregateResultId{0}; group_id < row_ids.size(); ++group_id) {
+          if (row_ids[group_id].is_null()) continue;
+          auto& result = context->results.emplace_back(std::move(merged_results[group_id]));
+          result.row_id = row_ids[group_id];
+        }
+        _contexts_per_column[column_index] = context;
+      });
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+std::shared_ptr<const Table> Aggregate::_on_execute() {
+  const auto& input_table = input_table_left();
+
+  // check for invalid aggregates
+  for (const auto& aggregate : _aggregates) {
+    if (!aggregate.column) {
+      if (aggregate.function != AggregateFunction::Count) {
+        Fail("Aggregate: Asterisk is only valid with COUNT");
+      }
+    } else {
+      DebugAssert(*aggregate.column < input_table->column_count(), "Aggregate column index out of bounds");
+      if (input_table->column_data_type(*aggregate.column) == DataType::String &&
+          (aggregate.function == AggregateFunction::Sum || aggregate.function == AggregateFunction::Avg)) {
+        Fail("Aggregate: Cannot calculate SUM or AVG on string column");
+      }
+    }
+  }
+
+  if (_input_is_sorted) {
+    _aggregate_sorted();
+  } else {
+    // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
+    // The reason we only have specializations up to 2 is because every specialization increases the compile time.
+    // Also, we need to make sure that there are tests for at least the first case, one array case, and the fallback.
+    switch (_groupby_column_ids.size()) {
+      case 0:
+      case 1:
+        if (_can_aggregate_on_value_ids()) {
+          // Dictionary-encoded group-by columns are aggregated on their value ids, without any hashing
+          resolve_data_type(input_table->column_data_type(_groupby_column_ids.front()), [&](auto type) {
+            _aggregate_on_value_ids<typename decltype(type)::type>();
+          });
+          break;
+        }
+
+        // No need for a complex data structure if we only have one entry
+        _aggregate<AggregateKeyEntry>();
+        break;
+      case 2:
+        // We need to explicitly list all array sizes that we want to support
+        _aggregate<std::array<AggregateKeyEntry, 2>>();
+        break;
+      default:
+        PerformanceWarning("No std::array implementation initialized - falling back to vector");
+        _aggregate<pmr_vector<AggregateKeyEntry>>();
+        break;
+    }
+  }
 
   // add group by columns
   for (const auto& column_id : _groupby_column_ids) {
@@ -597,6 +1357,10 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
     ++column_index;
   }
 
+  _output_column_definitions.insert(_output_column_definitions.end(), _bound_column_definitions.begin(),
+                                    _bound_column_definitions.end());
+  _output_segments.insert(_output_segments.end(), _bound_segments.begin(), _bound_segments.end());
+
   // Write the output
   auto output = std::make_shared<Table>(_output_column_definitions, TableType::Data);
   output->append_chunk(_output_segments);
@@ -616,18 +1380,16 @@ write_aggregate_values(std::shared_ptr<ValueSegment<AggregateType>> segment,
                        const AggregateResults<ColumnDataType, AggregateType>& results) {
   DebugAssert(segment->is_nullable(), "Aggregate: Output segment needs to be nullable");
 
-  auto& values = segment->values();
+  segment->grow_to_at_least(results.size());
   auto& null_values = segment->null_values();
 
-  values.resize(results.size());
-  null_values.resize(results.size());
-
-  size_t i = 0;
+  auto i = ChunkOffset{0};
   for (const auto& result : results) {
     null_values[i] = !result.current_aggregate;
 
+    // MIN and MAX of strings are written through the segment, which keeps their prefixes for scans
     if (result.current_aggregate) {
-      values[i] = *result.current_aggregate;
+      segment->set_value(i, *result.current_aggregate);
     }
     ++i;
   }
@@ -667,6 +1429,23 @@ std::enable_if_t<func == AggregateFunction::CountDistinct, void> write_aggregate
   }
 }
 
+// APPROX_COUNT_DISTINCT writes the estimated number of distinct values
+template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
+std::enable_if_t<func == AggregateFunction::ApproxCountDistinct, void> write_aggregate_values(
+    std::shared_ptr<ValueSegment<AggregateType>> segment,
+    const AggregateResults<ColumnDataType, AggregateType>& results) {
+  DebugAssert(!segment->is_nullable(), "Aggregate: Output segment for COUNT shouldn't be nullable");
+
+  auto& values = segment->values();
+  values.resize(results.size());
+
+  size_t i = 0;
+  for (const auto& result : results) {
+    values[i] = static_cast<AggregateType>(result.sketch.estimate());
+    ++i;
+  }
+}
+
 // AVG writes the calculated average from current aggregate and the aggregate counter
 template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
 std::enable_if_t<func == AggregateFunction::Avg && std::is_arithmetic_v<AggregateType>, void> write_aggregate_values(
@@ -691,6 +1470,54 @@ std::enable_if_t<func == AggregateFunction::Avg && std::is_arithmetic_v<Aggregat
   }
 }
 
+/*
+Scales the SUMs and COUNTs of a sample up to estimates of the aggregates of all rows and writes their confidence bounds
+(see AggregateApproximation). The sample's SUM divided by the sample fraction p is an unbiased estimate of the SUM of
+all rows (Horvitz-Thompson estimator). If each row is sampled independently, its variance is (1 - p) / p times the sum
+of the squares of all rows, which is estimated by the sum of the squares of the sampled rows divided by p. A COUNT is
+the SUM of ones. The bounds are the estimate plus or minus z standard errors, with z the (1 + confidence) / 2 quantile
+of the standard normal distribution.
+*/
+template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
+void write_estimates(ValueSegment<AggregateType>& segment,
+                     const AggregateResults<ColumnDataType, AggregateType>& results,
+                     const AggregateApproximation& approximation, ValueSegment<double>& lower_bounds,
+                     ValueSegment<double>& upper_bounds) {
+  const auto fraction = approximation.sample_fraction;
+  const auto z = boost::math::quantile(boost::math::normal{}, (1.0 + approximation.confidence) / 2.0);
+
+  auto& values = segment.values();
+  for (auto row_idx = size_t{0}; row_idx < values.size(); ++row_idx) {
+    if (segment.is_nullable() && segment.null_values()[row_idx]) {
+      lower_bounds.values().push_back(0.0);
+      lower_bounds.null_values().push_back(true);
+      upper_bounds.values().push_back(0.0);
+      upper_bounds.null_values().push_back(true);
+      continue;
+    }
+
+    const auto estimate = static_cast<double>(values[row_idx]) / fraction;
+    if constexpr (std::is_integral_v<AggregateType>) {
+      values[row_idx] = static_cast<AggregateType>(std::llround(estimate));
+    } else {
+      values[row_idx] = static_cast<AggregateType>(estimate);
+    }
+
+    // Without groups and rows, there are no results, but a single COUNT of 0
+    auto sum_of_squares = 0.0;
+    if (!results.empty()) {
+      sum_of_squares = func == AggregateFunction::Count ? static_cast<double>(results[row_idx].aggregate_count)
+                                                        : results[row_idx].sum_of_squares;
+    }
+    const auto standard_error = std::sqrt((1.0 - fraction) * sum_of_squares) / fraction;
+
+    lower_bounds.values().push_back(estimate - z * standard_error);
+    lower_bounds.null_values().push_back(false);
+    upper_bounds.values().push_back(estimate + z * standard_error);
+    upper_bounds.null_values().push_back(false);
+  }
+}
+
 // AVG is not defined for non-arithmetic types. Avoiding compiler errors.
 template <typename ColumnDataType, typename AggregateType, AggregateFunction func>
 std::enable_if_t<func == AggregateFunction::Avg && !std::is_arithmetic_v<AggregateType>, void> write_aggregate_values(
@@ -736,6 +1563,9 @@ void Aggregate::_write_aggregate_output(boost::hana::basic_type<ColumnDataType>
     case AggregateFunction::CountDistinct:
       write_aggregate_output<ColumnDataType, AggregateFunction::CountDistinct>(column_index);
       break;
+    case AggregateFunction::ApproxCountDistinct:
+      write_aggregate_output<ColumnDataType, AggregateFunction::ApproxCountDistinct>(column_index);
+      break;
   }
 }
 
@@ -768,7 +1598,8 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
   }
   column_name_stream << ")";
 
-  constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct);
+  constexpr bool NEEDS_NULL = (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct &&
+                               function != AggregateFunction::ApproxCountDistinct);
   _output_column_definitions.emplace_back(column_name_stream.str(), aggregate_data_type, NEEDS_NULL);
 
   auto output_segment = std::make_shared<ValueSegment<decltype(aggregate_type)>>(NEEDS_NULL);
@@ -794,55 +1625,31 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
     write_aggregate_values<ColumnDataType, decltype(aggregate_type), function>(output_segment, results);
   } else if (_groupby_segments.empty()) {
     // If we did not GROUP BY anything and we have no results, we need to add NULL for most aggregates and 0 for count
-    output_segment->values().push_back(decltype(aggregate_type){});
-    if (function != AggregateFunction::Count && function != AggregateFunction::CountDistinct) {
-      output_segment->null_values().push_back(true);
+    const auto value = decltype(aggregate_type){};
+    if constexpr (NEEDS_NULL) {
+      const auto is_null = true;
+      output_segment->append_values(&value, &value + 1, &is_null);
+    } else {
+      output_segment->append_values(&value, &value + 1);
     }
   }
 
-  _output_segments.push_back(output_segment);
-}
-
-template <typename AggregateKey>
-std::shared_ptr<SegmentVisitorContext> Aggregate::_create_aggregate_context(const DataType data_type,
-                                                                            const AggregateFunction function) const {
-  std::shared_ptr<SegmentVisitorContext> context;
-  resolve_data_type(data_type, [&](auto type) {
-    using ColumnDataType = typename decltype(type)::type;
-    switch (function) {
-      case AggregateFunction::Min:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType,
-            AggregateKey>>();
-        break;
-      case AggregateFunction::Max:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType,
-            AggregateKey>>();
-        break;
-      case AggregateFunction::Sum:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType,
-            AggregateKey>>();
-        break;
-      case AggregateFunction::Avg:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType,
-            AggregateKey>>();
-        break;
-      case AggregateFunction::Count:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType,
-            AggregateKey>>();
-        break;
-      case AggregateFunction::CountDistinct:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType,
-            AggregateKey>>();
-        break;
+  if constexpr ((function == AggregateFunction::Sum || function == AggregateFunction::Count) &&
+                std::is_arithmetic_v<decltype(aggregate_type)>) {
+    if (_approximation) {
+      const auto lower_bounds = std::make_shared<ValueSegment<double>>(true);
+      const auto upper_bounds = std::make_shared<ValueSegment<double>>(true);
+      write_estimates<ColumnDataType, decltype(aggregate_type), function>(*output_segment, results, *_approximation,
+                                                                          *lower_bounds, *upper_bounds);
+
+      _bound_column_definitions.emplace_back(column_name_stream.str() + " LOWER BOUND", DataType::Double, true);
+      _bound_column_definitions.emplace_back(column_name_stream.str() + " UPPER BOUND", DataType::Double, true);
+      _bound_segments.emplace_back(lower_bounds);
+      _bound_segments.emplace_back(upper_bounds);
     }
-  });
-  return context;
+  }
+
+  _output_segments.push_back(output_segment);
 }
 
 }  // namespace opossum
@@ -21,6 +21,8 @@
 #include "storage/value_segment.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/hyper_log_log.hpp"
+#include "utils/spill_file.hpp"
 
 namespace opossum {
 
@@ -59,6 +61,13 @@ struct AggregateResult {
   size_t aggregate_count = 0;
   std::set<ColumnDataType> distinct_values;
   RowID row_id;
+
+  // Only summed up for SUM in approximate aggregations, where it is needed for the confidence bounds
+  double sum_of_squares = 0.0;
+
+  // Only used for APPROX_COUNT_DISTINCT. Unlike distinct_values, it needs at most HyperLogLog::REGISTER_COUNT bytes,
+  // no matter how many distinct values the group has.
+  HyperLogLog sketch;
 };
 
 // This vector holds the results for every group that was encountered and is indexed by AggregateResultId.
@@ -66,15 +75,6 @@ template <typename ColumnDataType, typename AggregateType>
 using AggregateResults = pmr_vector<AggregateResult<ColumnDataType, AggregateType>>;
 using AggregateResultId = size_t;
 
-// The AggregateResultIdMap maps AggregateKeys to their index in the list of aggregate results.
-template <typename AggregateKey>
-using AggregateResultIdMapAllocator = PolymorphicAllocator<std::pair<const AggregateKey, AggregateResultId>>;
-
-template <typename AggregateKey>
-using AggregateResultIdMap =
-    std::unordered_map<AggregateKey, AggregateResultId, std::hash<AggregateKey>, std::equal_to<AggregateKey>,
-                       AggregateResultIdMapAllocator<AggregateKey>>;
-
 /*
 The key type that is used for the aggregation map.
 */
@@ -94,16 +94,47 @@ using CountAggregateType = int64_t;
 using DistinctColumnType = int8_t;
 using DistinctAggregateType = int8_t;
 
+/**
+ * Lets an Aggregate of a random sample of the rows (see TableSample) estimate the aggregates of all rows. Each sampled
+ * row stands for 1 / sample_fraction rows, so the SUMs and COUNTs are scaled up by this factor. For each of them, the
+ * output gets two more columns, "<aggregate> LOWER BOUND" and "<aggregate> UPPER BOUND", after all other columns. The
+ * true aggregate lies between these bounds with the probability confidence (approximately, by the central limit
+ * theorem). The bounds assume that each row was sampled independently (TableSampleMethod::Bernoulli). For SYSTEM
+ * samples, they are too narrow if the rows of a chunk resemble each other more than the rows of different chunks.
+ * MIN, MAX, AVG, and COUNT(DISTINCT) are not scaled.
+ */
+struct AggregateApproximation final {
+  explicit AggregateApproximation(const double sample_fraction, const double confidence = 0.95)
+      : sample_fraction(sample_fraction), confidence(confidence) {}
+
+  double sample_fraction;
+  double confidence;
+};
+
 /**
  * Note: Aggregate does not support null values at the moment
+ *
+ * If the rows of each group are known to be adjacent in the input (e.g., because it is sorted by the group-by
+ * columns), input_is_sorted can be set. The groups are then found in a single pass over the input, which starts a new
+ * group whenever one of the group-by values changes, and no hash table is needed.
+ *
+ * If spill options are given, the hash aggregation writes the pre-aggregated groups to disk once they exceed the
+ * memory budget and merges them one group of radix partitions at a time (see Aggregate::_aggregate()). Without spill
+ * options, an Aggregate of a query with a memory limit spills once the groups exceed half of the query's remaining
+ * memory (see TrackingMemoryResource).
  */
 class Aggregate : public AbstractReadOnlyOperator {
  public:
   Aggregate(const std::shared_ptr<AbstractOperator>& in, const std::vector<AggregateColumnDefinition>& aggregates,
-            const std::vector<ColumnID>& groupby_column_ids);
+            const std::vector<ColumnID>& groupby_column_ids, const bool input_is_sorted = false,
+            const std::optional<SpillOptions>& spill_options = std::nullopt,
+            const std::optional<AggregateApproximation>& approximation = std::nullopt);
 
   const std::vector<AggregateColumnDefinition>& aggregates() const;
   const std::vector<ColumnID>& groupby_column_ids() const;
+  bool input_is_sorted() const;
+  const std::optional<SpillOptions>& spill_options() const;
+  const std::optional<AggregateApproximation>& approximation() const;
 
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
@@ -118,6 +149,24 @@ class Aggregate : public AbstractReadOnlyOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  // Concatenates the merged results of the radix partitions of _aggregate() into _contexts_per_column
+  void _concatenate_partitions(
+      const std::vector<std::vector<RowID>>& row_ids_per_partition,
+      std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>& contexts_per_partition);
+
+  // The spill options given to the constructor, or a budget derived from the memory limit of the query
+  std::optional<SpillOptions> _effective_spill_options() const;
+
+  // Aggregates input in which the rows of each group are adjacent, without any hashing
+  void _aggregate_sorted();
+
+  // Whether the only group-by column is dictionary encoded in all chunks of a data table
+  bool _can_aggregate_on_value_ids() const;
+
+  // Aggregates on the value ids of the dictionary-encoded group-by column instead of on AggregateKeys
+  template <typename ColumnDataType>
+  void _aggregate_on_value_ids();
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -132,20 +181,37 @@ class Aggregate : public AbstractReadOnlyOperator {
 
   void _write_groupby_output(PosList& pos_list);
 
-  template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-  void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+  // Calls functor(column type, aggregate type, function) with the types of the context of the given column as
+  // hana::types and the aggregate function as a std::integral_constant
+  template <typename Functor>
+  void _resolve_aggregate(const ColumnID column_index, const Functor& functor) const;
 
-  template <typename AggregateKey>
-  std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction function) const;
+  // Pre-aggregates the given column of a chunk into the results of the chunk's groups
+  template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+  void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const std::vector<AggregateResultId>& group_ids,
+                          AggregateResults<ColumnDataType, AggregateType>& results) const;
+
+  // The pre-aggregated groups are merged in up to 2^MAX_RADIX_BITS partitions, so that each partition has about
+  // MAX_GROUPS_PER_PARTITION groups
+  static constexpr auto MAX_RADIX_BITS = size_t{10};
+  static constexpr auto MAX_GROUPS_PER_PARTITION = size_t{16'384};
+
+  // Spilled groups are written to up to 2^MAX_SPILL_RADIX_BITS partitions
+  static constexpr auto MAX_SPILL_RADIX_BITS = size_t{8};
 
   const std::vector<AggregateColumnDefinition> _aggregates;
   const std::vector<ColumnID> _groupby_column_ids;
+  const bool _input_is_sorted;
+  const std::optional<SpillOptions> _spill_options;
+  const std::optional<AggregateApproximation> _approximation;
 
   TableColumnDefinitions _output_column_definitions;
   Segments _output_segments;
 
+  // The confidence bounds of approximate aggregations, which are output after all other columns
+  TableColumnDefinitions _bound_column_definitions;
+  Segments _bound_segments;
+
   pmr_vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
 };
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Maps the AggregateKeys of the groups of an Aggregate to consecutive group ids, in the order in which the groups were
+ * first seen. It replaces a node-based std::unordered_map with open addressing and linear probing on a flat array of
+ * slots, so that a lookup of an existing group usually touches a single cache line and new groups do not cost an
+ * allocation. The table doubles its slots when half of them are used.
+ *
+ * The Aggregate uses one map per input chunk for the pre-aggregation and one per radix partition for the merge of the
+ * pre-aggregated groups (see Aggregate::_aggregate()). partition_hash() is used to assign groups to partitions. Its
+ * bits are independent from those that select the slots, so that the groups of a partition are still spread over all
+ * slots of the partition's map.
+ */
+template <typename AggregateKey>
+class AggregateGroupIdMap {
+ public:
+  explicit AggregateGroupIdMap(const size_t expected_group_count = 0) {
+    auto slot_count = size_t{16};
+    while (slot_count < expected_group_count * 2) slot_count *= 2;
+    _resize(slot_count);
+  }
+
+  // Returns the group id of the key and whether the group was inserted
+  std::pair<size_t, bool> find_or_insert(const AggregateKey& key) {
+    auto slot_id = _first_slot(key);
+    for (; _slots[slot_id].group_id != EMPTY_SLOT; slot_id = (slot_id + 1) & _slot_mask) {
+      if (_slots[slot_id].key == key) return {_slots[slot_id].group_id, false};
+    }
+
+    const auto group_id = _group_count;
+    _slots[slot_id].key = key;
+    _slots[slot_id].group_id = group_id;
+    ++_group_count;
+
+    if (_group_count * 2 > _slots.size()) _resize(_slots.size() * 2);
+
+    return {group_id, true};
+  }
+
+  // The number of groups
+  size_t size() const { return _group_count; }
+
+  static size_t partition_hash(const AggregateKey& key) {
+    // Finalizer of MurmurHash3, std::hash is the identity for integers on common platforms
+    auto hash = static_cast<uint64_t>(std::hash<AggregateKey>{}(key));
+    hash ^= hash >> 33u;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33u;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33u;
+    return static_cast<size_t>(hash);
+  }
+
+ protected:
+  static constexpr auto EMPTY_SLOT = std::numeric_limits<size_t>::max();
+
+  struct Slot {
+    AggregateKey key{};
+    size_t group_id{EMPTY_SLOT};
+  };
+
+  size_t _first_slot(const AggregateKey& key) const {
+    // Fibonacci hashing uses the upper bits of the product, which select the slot
+    const auto hash = static_cast<uint64_t>(std::hash<AggregateKey>{}(key)) * uint64_t{0x9E3779B97F4A7C15};
+    return static_cast<size_t>(hash >> _slot_shift);
+  }
+
+  void _resize(const size_t slot_count) {
+    auto old_slots = std::move(_slots);
+
+    _slots = std::vector<Slot>(slot_count);
+    _slot_mask = slot_count - 1;
+    _slot_shift = 64u - static_cast<size_t>(__builtin_ctzll(slot_count));
+
+    for (auto& old_slot : old_slots) {
+      if (old_slot.group_id == EMPTY_SLOT) continue;
+
+      auto slot_id = _first_slot(old_slot.key);
+      while (_slots[slot_id].group_id != EMPTY_SLOT) slot_id = (slot_id + 1) & _slot_mask;
+      _slots[slot_id] = std::move(old_slot);
+    }
+  }
+
+  std::vector<Slot> _slots;
+  size_t _slot_mask{0};
+  size_t _slot_shift{0};
+  size_t _group_count{0};
+};
+
+}  // namespace opossum
@@ -1,15 +1,51 @@
 #include "delete.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "logging/logger.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Polls the row with an exponential backoff until @param transaction_id has unlocked it, has committed its change to
+// it, or @param deadline has passed
+void wait_for_row_lock(const Chunk& chunk, const ChunkOffset chunk_offset, const TransactionID transaction_id,
+                       const std::chrono::steady_clock::time_point deadline) {
+  constexpr auto MAX_BACKOFF = std::chrono::microseconds{1'000};
+
+  auto backoff = std::chrono::microseconds{10};
+  for (auto now = std::chrono::steady_clock::now(); now < deadline; now = std::chrono::steady_clock::now()) {
+    const auto remaining_time = std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+    std::this_thread::sleep_for(std::min(backoff, remaining_time));
+    backoff = std::min(backoff * 2, MAX_BACKOFF);
+
+    const auto mvcc_data = chunk.get_scoped_mvcc_data_lock();
+    if (mvcc_data->tid(chunk_offset) != transaction_id) return;
+    if (mvcc_data->end_cid(chunk_offset) != MvccData::MAX_COMMIT_ID) return;
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 Delete::Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& values_to_delete)
@@ -30,56 +66,146 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
 
   const auto values_to_delete = input_table_left();
 
+  // Group the rows to delete by the chunk they are in, so that each chunk is processed by one job that acquires the
+  // chunk's MVCC data only once
+  auto offsets_by_chunk = std::map<ChunkID, std::vector<ChunkOffset>>{};
   for (ChunkID chunk_id{0}; chunk_id < values_to_delete->chunk_count(); ++chunk_id) {
     const auto chunk = values_to_delete->get_chunk(chunk_id);
 
     // we have already verified that all segments reference the same table
     const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
-    const auto pos_list = first_segment->pos_list();
+    for (const auto& row_id : *first_segment->pos_list()) {
+      offsets_by_chunk[row_id.chunk_id].emplace_back(row_id.chunk_offset);
+    }
+  }
 
-    _pos_lists.emplace_back(pos_list);
+  _rows_by_chunk.reserve(offsets_by_chunk.size());
+  for (auto& [chunk_id, chunk_offsets] : offsets_by_chunk) {
+    std::sort(chunk_offsets.begin(), chunk_offsets.end());
+    chunk_offsets.erase(std::unique(chunk_offsets.begin(), chunk_offsets.end()), chunk_offsets.end());
+    _rows_by_chunk.emplace_back(ChunkRows{chunk_id, std::move(chunk_offsets)});
+  }
 
-    for (const auto& row_id : *pos_list) {
-      auto referenced_chunk = _table->get_chunk(row_id.chunk_id);
+  auto conflict = std::atomic_bool{false};
+  if (_rows_by_chunk.size() == 1) {
+    _lock_rows(_rows_by_chunk.front(), conflict);
+  } else {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(_rows_by_chunk.size());
+    for (auto& chunk_rows : _rows_by_chunk) {
+      jobs.emplace_back(
+          std::make_shared<JobTask>([this, &chunk_rows, &conflict]() { _lock_rows(chunk_rows, conflict); }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  }
 
-      auto expected = 0u;
-      // Actual row lock for delete happens here
-      const auto success =
-          referenced_chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset].compare_exchange_strong(
-              expected, _transaction_id);
+  if (conflict) {
+    // A row is already locked by someone else and the transaction needs to be rolled back
+    _mark_as_failed();
+    return nullptr;
+  }
 
-      if (success) continue;
+  _num_rows_deleted = input_table_left()->row_count();
 
-      // If the row has a set TID, it might be a row that our TX inserted
-      // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
-      // change this row from the initial tid
-      if (auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
-          mvcc_data->tids[row_id.chunk_offset] == _transaction_id) {
-        // Make sure that even we don't see it anymore
-        mvcc_data->tids[row_id.chunk_offset] = TransactionManager::INVALID_TRANSACTION_ID;
-        continue;
-      }
+  return nullptr;
+}
 
-      // the row is already locked by someone else and the transaction needs to be rolled back
-      _mark_as_failed();
-      return nullptr;
+bool Delete::_lock_rows(ChunkRows& chunk_rows, std::atomic_bool& conflict) const {
+  const auto referenced_chunk = _table->get_chunk(chunk_rows.chunk_id);
+  const auto lock_wait_timeout = TransactionManager::get().lock_wait_timeout();
+
+  auto& chunk_offsets = chunk_rows.chunk_offsets;
+  auto offset_idx = size_t{0};
+
+  // Set while waiting for the transaction that has locked the row at offset_idx
+  auto wait_deadline = std::optional<std::chrono::steady_clock::time_point>{};
+
+  while (true) {
+    auto holder_transaction_id = TransactionManager::INVALID_TRANSACTION_ID;
+    {
+      auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock_for_writing();
+
+      // Once a row is locked, it is invisible for this transaction. Validate cannot skip the chunk anymore.
+      mvcc_data->register_invalidation();
+
+      for (; offset_idx < chunk_offsets.size(); ++offset_idx) {
+        const auto chunk_offset = chunk_offsets[offset_idx];
+
+        auto expected = TransactionID{0};
+        // Actual row lock for delete happens here
+        if (!conflict.load(std::memory_order_relaxed) &&
+            mvcc_data->tids[chunk_offset].compare_exchange_strong(expected, _transaction_id)) {
+          if (wait_deadline) {
+            // The transaction that held the lock rolled back
+            TransactionManager::get().record_write_conflict_event(TransactionManager::WriteConflictEvent::ResolvedWait,
+                                                                  _transaction_id);
+            wait_deadline.reset();
+          }
+          continue;
+        }
+
+        // If the row has a set TID, it might be a row that our TX inserted
+        // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
+        // change this row from the initial tid
+        if (expected == _transaction_id) {
+          // Make sure that even we don't see it anymore
+          mvcc_data->tids[chunk_offset] = TransactionManager::INVALID_TRANSACTION_ID;
+          continue;
+        }
+
+        if (expected != TransactionManager::INVALID_TRANSACTION_ID) {
+          // The row is locked by another transaction. As long as that transaction has not committed its change to the
+          // row, it might still roll back, so we wait for it instead of failing right away.
+          if (mvcc_data->end_cids[chunk_offset] == MvccData::MAX_COMMIT_ID && lock_wait_timeout.count() > 0) {
+            const auto now = std::chrono::steady_clock::now();
+            if (!wait_deadline) {
+              TransactionManager::get().record_write_conflict_event(TransactionManager::WriteConflictEvent::Wait,
+                                                                    _transaction_id, expected);
+              wait_deadline = now + lock_wait_timeout;
+            }
+            if (now < *wait_deadline) {
+              holder_transaction_id = expected;
+              break;
+            }
+          }
+          TransactionManager::get().record_write_conflict_event(TransactionManager::WriteConflictEvent::Conflict,
+                                                                _transaction_id, expected);
+        }
+
+        // The row is already locked by someone else (or another job found such a row). Only the rows up to here have
+        // to be unlocked on rollback.
+        conflict = true;
+        chunk_offsets.resize(offset_idx);
+        return false;
+      }
     }
-  }
 
-  _num_rows_deleted = input_table_left()->row_count();
+    if (holder_transaction_id == TransactionManager::INVALID_TRANSACTION_ID) return true;
 
-  return nullptr;
+    // The MVCC data is not locked while waiting, so that the other transaction can commit or roll back
+    wait_for_row_lock(*referenced_chunk, chunk_offsets[offset_idx], holder_transaction_id, *wait_deadline);
+  }
 }
 
 void Delete::_on_commit_records(const CommitID cid) {
-  for (const auto& pos_list : _pos_lists) {
-    for (const auto& row_id : *pos_list) {
-      auto chunk = _table->get_chunk(row_id.chunk_id);
+  for (const auto& chunk_rows : _rows_by_chunk) {
+    auto mvcc_data = _table->get_chunk(chunk_rows.chunk_id)->get_scoped_mvcc_data_lock_for_writing();
 
-      chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = cid;
+    for (const auto chunk_offset : chunk_rows.chunk_offsets) {
+      mvcc_data->end_cids[chunk_offset] = cid;
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
   }
+  _table->register_commit(cid);
+
+  if (Logger::get().is_enabled()) {
+    for (const auto& chunk_rows : _rows_by_chunk) {
+      for (const auto chunk_offset : chunk_rows.chunk_offsets) {
+        Logger::get().log_delete(_transaction_id, _table_name, RowID{chunk_rows.chunk_id, chunk_offset});
+      }
+    }
+  }
 }
 
 void Delete::_finish_commit() {
@@ -90,20 +216,15 @@ void Delete::_finish_commit() {
 }
 
 void Delete::_on_rollback_records() {
-  for (const auto& pos_list : _pos_lists) {
-    for (const auto& row_id : *pos_list) {
-      auto chunk = _table->get_chunk(row_id.chunk_id);
+  // _rows_by_chunk only contains the rows that were processed in _on_execute
+  for (const auto& chunk_rows : _rows_by_chunk) {
+    auto mvcc_data = _table->get_chunk(chunk_rows.chunk_id)->get_scoped_mvcc_data_lock_for_writing();
 
+    for (const auto chunk_offset : chunk_rows.chunk_offsets) {
+      // Unlock all rows locked in _on_execute. This fails for rows that our own transaction inserted, which are
+      // invalidated by the rollback of the Insert.
       auto expected = _transaction_id;
-
-      // unlock all rows locked in _on_execute
-      const auto result =
-          chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset].compare_exchange_strong(expected, 0u);
-
-      // If the above operation fails, it means the row is locked by another transaction. This must have been
-      // the reason why the rollback was initiated. Since _on_execute stopped at this row, we can stop
-      // unlocking rows here as well.
-      if (!result) return;
+      mvcc_data->tids[chunk_offset].compare_exchange_strong(expected, 0u);
     }
   }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
@@ -39,11 +40,24 @@ class Delete : public AbstractReadWriteOperator {
    */
   bool _execution_input_valid(const std::shared_ptr<TransactionContext>& context) const;
 
+  // The rows of a single chunk of _table that this Delete has locked (or that were inserted by its own transaction),
+  // sorted by their offset
+  struct ChunkRows {
+    ChunkID chunk_id;
+    std::vector<ChunkOffset> chunk_offsets;
+  };
+
+  // Locks the rows of @param chunk_rows. Stops early if another job has set @param conflict. If a row is locked by
+  // another transaction, waits for up to TransactionManager::lock_wait_timeout() for that transaction to roll back,
+  // unless it has already committed its change. If the row stays locked, sets @param conflict. In both cases,
+  // chunk_rows is shrunk to the rows that were locked and false is returned.
+  bool _lock_rows(ChunkRows& chunk_rows, std::atomic_bool& conflict) const;
+
  private:
   const std::string _table_name;
   std::shared_ptr<Table> _table;
   TransactionID _transaction_id;
-  std::vector<std::shared_ptr<const PosList>> _pos_lists;
+  std::vector<ChunkRows> _rows_by_chunk;
   uint64_t _num_rows_deleted;
 };
 }  // namespace opossum
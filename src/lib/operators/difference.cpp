@@ -1,19 +1,103 @@
 #include "difference.hpp"
 
 #include <algorithm>
-#include <iterator>
+#include <functional>
 #include <memory>
-#include <sstream>
 #include <string>
 #include <unordered_map>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "boost/functional/hash.hpp"
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
-#include "type_cast.hpp"
+#include "storage/segment_iterate.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The values of one column of a chunk, materialized to hash the rows of the chunk and to compare them with other rows
+class BaseMaterializedColumn {
+ public:
+  virtual ~BaseMaterializedColumn() = default;
+
+  // Combines the hash of each value with the hash of its row
+  virtual void hash(std::vector<size_t>& row_hashes) const = 0;
+
+  // Whether the value at chunk_offset equals the value at other_chunk_offset of other, which has the same type
+  virtual bool equals(const ChunkOffset chunk_offset, const BaseMaterializedColumn& other,
+                      const ChunkOffset other_chunk_offset) const = 0;
+};
+
+template <typename T>
+class MaterializedColumn : public BaseMaterializedColumn {
+ public:
+  explicit MaterializedColumn(const BaseSegment& segment) {
+    _values.reserve(segment.size());
+    _null_values.reserve(segment.size());
+
+    segment_iterate<T>(segment, [&](const auto& position) {
+      _null_values.emplace_back(position.is_null());
+      _values.emplace_back(position.is_null() ? T{} : position.value());
+    });
+  }
+
+  void hash(std::vector<size_t>& row_hashes) const final {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _values.size(); ++chunk_offset) {
+      // All NULLs are hashed to the same value, so that they are considered equal
+      const auto value_hash = _null_values[chunk_offset] ? size_t{0} : std::hash<T>{}(_values[chunk_offset]);
+      boost::hash_combine(row_hashes[chunk_offset], value_hash);
+    }
+  }
+
+  bool equals(const ChunkOffset chunk_offset, const BaseMaterializedColumn& other,
+              const ChunkOffset other_chunk_offset) const final {
+    const auto& other_column = static_cast<const MaterializedColumn<T>&>(other);
+    if (_null_values[chunk_offset] || other_column._null_values[other_chunk_offset]) {
+      return _null_values[chunk_offset] && other_column._null_values[other_chunk_offset];
+    }
+    return _values[chunk_offset] == other_column._values[other_chunk_offset];
+  }
+
+ private:
+  std::vector<T> _values;
+  std::vector<bool> _null_values;
+};
+
+// The columns of a chunk together with the hash of each of its rows
+struct MaterializedChunk {
+  explicit MaterializedChunk(const Chunk& chunk) : row_hashes(chunk.size()) {
+    columns.reserve(chunk.column_count());
+    for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+      const auto segment = chunk.get_segment(column_id);
+      resolve_data_type(segment->data_type(), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        columns.emplace_back(std::make_unique<MaterializedColumn<ColumnDataType>>(*segment));
+      });
+      columns.back()->hash(row_hashes);
+    }
+  }
+
+  bool rows_equal(const ChunkOffset chunk_offset, const MaterializedChunk& other,
+                  const ChunkOffset other_chunk_offset) const {
+    for (auto column_id = ColumnID{0}; column_id < columns.size(); ++column_id) {
+      if (!columns[column_id]->equals(chunk_offset, *other.columns[column_id], other_chunk_offset)) return false;
+    }
+    return true;
+  }
+
+  std::vector<std::unique_ptr<BaseMaterializedColumn>> columns;
+  std::vector<size_t> row_hashes;
+};
+
+}  // namespace
+
 namespace opossum {
 Difference::Difference(const std::shared_ptr<const AbstractOperator>& left_in,
                        const std::shared_ptr<const AbstractOperator>& right_in)
@@ -35,90 +119,88 @@ std::shared_ptr<const Table> Difference::_on_execute() {
 
   auto output = std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
 
-  // 1. We create a set of all right input rows as concatenated strings.
-
-  auto right_input_row_set = std::unordered_set<std::string>(input_table_right()->row_count());
-
-  // Iterating over all chunks and for each chunk over all segments
-  for (ChunkID chunk_id{0}; chunk_id < input_table_right()->chunk_count(); chunk_id++) {
-    auto chunk = input_table_right()->get_chunk(chunk_id);
-    // creating a temporary row representation with strings to be filled segment-wise
-    auto string_row_vector = std::vector<std::stringstream>(chunk->size());
-    for (ColumnID column_id{0}; column_id < input_table_right()->column_count(); column_id++) {
-      const auto base_segment = chunk->get_segment(column_id);
-
-      // filling the row vector with all values from this segment
-      auto row_string_buffer = std::stringstream{};
-      for (ChunkOffset chunk_offset = 0; chunk_offset < base_segment->size(); chunk_offset++) {
-        // Previously we called a virtual method of the BaseSegment interface here.
-        // It was replaced with a call to the subscript operator as that is equally slow.
-        const auto value = (*base_segment)[chunk_offset];
-        _append_string_representation(string_row_vector[chunk_offset], value);
-      }
-    }
-
-    // Remove duplicate rows by adding all rows to a unordered set
-    std::transform(string_row_vector.cbegin(), string_row_vector.cend(),
-                   std::inserter(right_input_row_set, right_input_row_set.end()), [](auto& x) { return x.str(); });
-  }
+  // 1. We materialize and hash the rows of the right input, in parallel for each chunk.
 
-  // 2. Now we check for each chunk of the left input which rows can be added to the output
+  const auto right_chunk_count = input_table_right()->chunk_count();
+  auto right_chunks = std::vector<std::unique_ptr<MaterializedChunk>>(right_chunk_count);
 
-  // Iterating over all chunks and for each chunk over all segment
-  for (ChunkID chunk_id{0}; chunk_id < input_table_left()->chunk_count(); chunk_id++) {
-    const auto in_chunk = input_table_left()->get_chunk(chunk_id);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(right_chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < right_chunk_count; chunk_id++) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      right_chunks[chunk_id] = std::make_unique<MaterializedChunk>(*input_table_right()->get_chunk(chunk_id));
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // Map the hash of each right row to the rows with that hash
+  auto right_rows_by_hash = std::unordered_map<size_t, std::vector<RowID>>(input_table_right()->row_count());
+  for (ChunkID chunk_id{0}; chunk_id < right_chunk_count; chunk_id++) {
+    const auto& row_hashes = right_chunks[chunk_id]->row_hashes;
+    for (ChunkOffset chunk_offset = 0; chunk_offset < row_hashes.size(); chunk_offset++) {
+      right_rows_by_hash[row_hashes[chunk_offset]].emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
 
-    Segments output_segments;
+  // 2. Now we check for each chunk of the left input, again in parallel, which rows can be added to the output
 
-    // creating a map to share pos_lists (see table_scan.hpp)
-    std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>> out_pos_list_map;
+  const auto left_chunk_count = input_table_left()->chunk_count();
+  auto output_segments_by_chunk = std::vector<Segments>(left_chunk_count);
 
-    for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); column_id++) {
-      const auto base_segment = in_chunk->get_segment(column_id);
-      // temporary variables needed to create the reference segment
-      const auto referenced_segment = std::dynamic_pointer_cast<const ReferenceSegment>(
-          input_table_left()->get_chunk(chunk_id)->get_segment(column_id));
-      auto out_column_id = column_id;
-      auto out_referenced_table = input_table_left();
-      std::shared_ptr<const PosList> in_pos_list;
+  jobs.clear();
+  jobs.reserve(left_chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < left_chunk_count; chunk_id++) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto in_chunk = input_table_left()->get_chunk(chunk_id);
+      const auto left_chunk = MaterializedChunk{*in_chunk};
 
-      if (referenced_segment) {
-        // if the input segment was a reference segment then the output segment must reference the same values/objects
-        out_column_id = referenced_segment->referenced_column_id();
-        out_referenced_table = referenced_segment->referenced_table();
-        in_pos_list = referenced_segment->pos_list();
-      }
+      auto& output_segments = output_segments_by_chunk[chunk_id];
 
-      // automatically creates the entry if it does not exist
-      std::shared_ptr<PosList>& pos_list_out = out_pos_list_map[in_pos_list];
+      // creating a map to share pos_lists (see table_scan.hpp)
+      std::unordered_map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>> out_pos_list_map;
 
-      if (!pos_list_out) {
-        pos_list_out = std::make_shared<PosList>();
-      }
+      for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); column_id++) {
+        // temporary variables needed to create the reference segment
+        const auto referenced_segment =
+            std::dynamic_pointer_cast<const ReferenceSegment>(in_chunk->get_segment(column_id));
+        auto out_column_id = column_id;
+        auto out_referenced_table = input_table_left();
+        std::shared_ptr<const PosList> in_pos_list;
+
+        if (referenced_segment) {
+          // if the input segment was a reference segment then the output segment must reference the same
+          // values/objects
+          out_column_id = referenced_segment->referenced_column_id();
+          out_referenced_table = referenced_segment->referenced_table();
+          in_pos_list = referenced_segment->pos_list();
+        }
 
-      // creating a ReferenceSegment for the output
-      auto out_reference_segment =
-          std::make_shared<ReferenceSegment>(out_referenced_table, out_column_id, pos_list_out);
-      output_segments.push_back(out_reference_segment);
-    }
+        // automatically creates the entry if it does not exist
+        std::shared_ptr<PosList>& pos_list_out = out_pos_list_map[in_pos_list];
 
-    // for all offsets check if the row can be added to the output
-    for (ChunkOffset chunk_offset = 0; chunk_offset < in_chunk->size(); chunk_offset++) {
-      // creating string representation off the row at chunk_offset
-      auto row_string_buffer = std::stringstream{};
-      for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); column_id++) {
-        const auto base_segment = in_chunk->get_segment(column_id);
+        if (!pos_list_out) {
+          pos_list_out = std::make_shared<PosList>();
+        }
 
-        // Previously a virtual method of the BaseSegment interface was called here.
-        // It was replaced with a call to the subscript operator as that is equally slow.
-        const auto value = (*base_segment)[chunk_offset];
-        _append_string_representation(row_string_buffer, value);
+        // creating a ReferenceSegment for the output
+        auto out_reference_segment =
+            std::make_shared<ReferenceSegment>(out_referenced_table, out_column_id, pos_list_out);
+        output_segments.push_back(out_reference_segment);
       }
-      const auto row_string = row_string_buffer.str();
 
-      // we check if the recently created row_string is contained in the left_input_row_set
-      auto search = right_input_row_set.find(row_string);
-      if (search == right_input_row_set.end()) {
+      // for all offsets check if the row can be added to the output
+      for (ChunkOffset chunk_offset = 0; chunk_offset < in_chunk->size(); chunk_offset++) {
+        // only the right rows with the same hash have to be compared
+        const auto right_rows_it = right_rows_by_hash.find(left_chunk.row_hashes[chunk_offset]);
+        if (right_rows_it != right_rows_by_hash.end()) {
+          const auto& right_rows = right_rows_it->second;
+          const auto is_contained = std::any_of(right_rows.cbegin(), right_rows.cend(), [&](const auto& row_id) {
+            return left_chunk.rows_equal(chunk_offset, *right_chunks[row_id.chunk_id], row_id.chunk_offset);
+          });
+          if (is_contained) continue;
+        }
+
         for (auto pos_list_pair : out_pos_list_map) {
           if (pos_list_pair.first) {
             pos_list_pair.second->emplace_back((*pos_list_pair.first)[chunk_offset]);
@@ -127,8 +209,12 @@ std::shared_ptr<const Table> Difference::_on_execute() {
           }
         }
       }
-    }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
 
+  for (const auto& output_segments : output_segments_by_chunk) {
     // Only add chunk if it would contain any tuples
     if (!output_segments.empty() && output_segments[0]->size() > 0) {
       output->append_chunk(output_segments);
@@ -138,15 +224,4 @@ std::shared_ptr<const Table> Difference::_on_execute() {
   return output;
 }
 
-void Difference::_append_string_representation(std::ostream& row_string_buffer, const AllTypeVariant& value) {
-  const auto string_value = type_cast_variant<std::string>(value);
-  const auto length = static_cast<uint32_t>(string_value.length());
-
-  // write value as string
-  row_string_buffer << string_value;
-
-  // write byte representation of length
-  row_string_buffer.write(reinterpret_cast<const char*>(&length), sizeof(length));
-}
-
 }  // namespace opossum
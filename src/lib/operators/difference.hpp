@@ -1,7 +1,6 @@
 #pragma once
 
 #include <memory>
-#include <sstream>
 #include <string>
 #include <vector>
 
@@ -12,7 +11,9 @@
 namespace opossum {
 
 /**
- * Note: Difference does not support null values at the moment
+ * Computes the set difference of two tables with the same columns: The output references all rows of the left input
+ * that are not contained in the right input. Rows are hashed per column and rows with equal hashes are compared value
+ * by value. NULLs are treated as equal to each other, as in SQL's EXCEPT.
  */
 class Difference : public AbstractReadOnlyOperator {
  public:
@@ -27,8 +28,5 @@ class Difference : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
-
- private:
-  void _append_string_representation(std::ostream& row_string_buffer, const AllTypeVariant& value);
 };
 }  // namespace opossum
@@ -0,0 +1,350 @@
+#include "distinct.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Upper bound for the number of partitions, and thus for the number of output chunks
+constexpr auto MAX_PARTITION_COUNT = size_t{64};
+
+// Combined into the hash of a row for each NULL in it
+constexpr auto NULL_HASH = size_t{0x9E3779B97F4A7C15};
+
+// The materialized values of one column in all input chunks. Used when deduplicating on multiple columns, where rows
+// are hashed and compared column by column.
+class BaseDistinctColumn {
+ public:
+  virtual ~BaseDistinctColumn() = default;
+
+  // Materializes @param segment, which belongs to @param chunk_id, and combines the hashes of its values into
+  // @param row_hashes. Different chunks can be materialized concurrently.
+  virtual void materialize(const BaseSegment& segment, const ChunkID chunk_id, std::vector<size_t>& row_hashes) = 0;
+
+  virtual bool equals(const RowID& lhs, const RowID& rhs) const = 0;
+
+  // Creates a segment with the values of @param row_ids
+  virtual std::shared_ptr<BaseSegment> values_of(const std::vector<RowID>& row_ids) const = 0;
+};
+
+template <typename T>
+class DistinctColumn : public BaseDistinctColumn {
+ public:
+  DistinctColumn(const ChunkID chunk_count, const bool nullable)
+      : _values(chunk_count), _null_values(chunk_count), _nullable(nullable) {}
+
+  void materialize(const BaseSegment& segment, const ChunkID chunk_id, std::vector<size_t>& row_hashes) override {
+    auto& values = _values[chunk_id];
+    auto& null_values = _null_values[chunk_id];
+    values.resize(segment.size());
+    null_values.resize(segment.size());
+
+    auto chunk_offset = ChunkOffset{0};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        null_values[chunk_offset] = true;
+        boost::hash_combine(row_hashes[chunk_offset], NULL_HASH);
+      } else {
+        values[chunk_offset] = position.value();
+        boost::hash_combine(row_hashes[chunk_offset], std::hash<T>{}(position.value()));
+      }
+      ++chunk_offset;
+    });
+  }
+
+  bool equals(const RowID& lhs, const RowID& rhs) const override {
+    const auto lhs_is_null = _null_values[lhs.chunk_id][lhs.chunk_offset];
+    const auto rhs_is_null = _null_values[rhs.chunk_id][rhs.chunk_offset];
+    if (lhs_is_null || rhs_is_null) return lhs_is_null == rhs_is_null;
+
+    return _values[lhs.chunk_id][lhs.chunk_offset] == _values[rhs.chunk_id][rhs.chunk_offset];
+  }
+
+  std::shared_ptr<BaseSegment> values_of(const std::vector<RowID>& row_ids) const override {
+    auto values = std::vector<T>(row_ids.size());
+    for (auto row_idx = size_t{0}; row_idx < row_ids.size(); ++row_idx) {
+      values[row_idx] = _values[row_ids[row_idx].chunk_id][row_ids[row_idx].chunk_offset];
+    }
+
+    if (!_nullable) return std::make_shared<ValueSegment<T>>(std::move(values));
+
+    auto null_values = std::vector<bool>(row_ids.size());
+    for (auto row_idx = size_t{0}; row_idx < row_ids.size(); ++row_idx) {
+      null_values[row_idx] = _null_values[row_ids[row_idx].chunk_id][row_ids[row_idx].chunk_offset];
+    }
+    return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+  }
+
+ private:
+  std::vector<std::vector<T>> _values;
+  std::vector<std::vector<bool>> _null_values;
+  const bool _nullable;
+};
+
+}  // namespace
+
+namespace opossum {
+
+Distinct::Distinct(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids)
+    : AbstractReadOnlyOperator(OperatorType::Distinct, in), _column_ids(column_ids) {
+  Assert(!_column_ids.empty(), "Distinct needs at least one column");
+}
+
+const std::vector<ColumnID>& Distinct::column_ids() const { return _column_ids; }
+
+const std::string Distinct::name() const { return "Distinct"; }
+
+const std::string Distinct::description(DescriptionMode description_mode) const {
+  std::stringstream desc;
+  desc << "[Distinct] ColumnIDs: ";
+  for (auto column_idx = size_t{0}; column_idx < _column_ids.size(); ++column_idx) {
+    desc << _column_ids[column_idx];
+    if (column_idx + 1 < _column_ids.size()) desc << ", ";
+  }
+  return desc.str();
+}
+
+std::shared_ptr<AbstractOperator> Distinct::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Distinct>(copied_input_left, _column_ids);
+}
+
+void Distinct::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> Distinct::_on_execute() {
+  const auto& input_table = input_table_left();
+
+  auto column_definitions = TableColumnDefinitions{};
+  for (const auto column_id : _column_ids) {
+    column_definitions.emplace_back(input_table->column_name(column_id), input_table->column_data_type(column_id),
+                                    input_table->column_is_nullable(column_id));
+  }
+  const auto output_table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  if (input_table->chunk_count() == 0) return output_table;
+
+  // Each chunk scatters its values into all partitions, so there are no more partitions than chunks
+  const auto partition_count = std::min(static_cast<size_t>(input_table->chunk_count()), MAX_PARTITION_COUNT);
+
+  auto output_chunks = std::vector<Segments>{};
+  if (_column_ids.size() == 1) {
+    resolve_data_type(input_table->column_data_type(_column_ids.front()), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      output_chunks = _distinct_single_column<ColumnDataType>(partition_count);
+    });
+  } else {
+    output_chunks = _distinct_multiple_columns(partition_count);
+  }
+
+  for (const auto& segments : output_chunks) {
+    output_table->append_chunk(segments);
+  }
+
+  return output_table;
+}
+
+template <typename ColumnDataType>
+std::vector<Segments> Distinct::_distinct_single_column(const size_t partition_count) const {
+  const auto& input_table = input_table_left();
+  const auto column_id = _column_ids.front();
+  const auto chunk_count = input_table->chunk_count();
+  const auto nullable = input_table->column_is_nullable(column_id);
+  const auto hash_function = std::hash<ColumnDataType>{};
+
+  // (1) Deduplicate each chunk and scatter its distinct values into the partitions
+  auto values_per_chunk_and_partition = std::vector<std::vector<std::vector<ColumnDataType>>>(
+      chunk_count, std::vector<std::vector<ColumnDataType>>(partition_count));
+  auto contains_null = std::atomic_bool{false};
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto& segment = *input_table->get_chunk(chunk_id)->get_segment(column_id);
+      auto& values_per_partition = values_per_chunk_and_partition[chunk_id];
+      const auto add_value = [&](const ColumnDataType& value) {
+        values_per_partition[hash_function(value) % partition_count].emplace_back(value);
+      };
+
+      // The dictionary of a segment in a data table holds exactly the distinct non-NULL values of the segment
+      const auto* dictionary_segment = input_table->type() == TableType::Data
+                                           ? dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment)
+                                           : nullptr;
+      if (dictionary_segment) {
+        for (const auto& value : *dictionary_segment->dictionary()) {
+          add_value(value);
+        }
+
+        if (nullable && !contains_null) {
+          const auto null_value_id = static_cast<uint32_t>(dictionary_segment->null_value_id());
+          resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+            if (std::any_of(attribute_vector.cbegin(), attribute_vector.cend(),
+                            [&](const auto value_id) { return static_cast<uint32_t>(value_id) == null_value_id; })) {
+              contains_null = true;
+            }
+          });
+        }
+        return;
+      }
+
+      auto chunk_values = std::unordered_set<ColumnDataType>{};
+      auto chunk_contains_null = false;
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        if (position.is_null()) {
+          chunk_contains_null = true;
+        } else if (chunk_values.emplace(position.value()).second) {
+          add_value(position.value());
+        }
+      });
+      if (chunk_contains_null) contains_null = true;
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  // (2) Deduplicate each partition
+  auto values_per_partition = std::vector<std::vector<ColumnDataType>>(partition_count);
+
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto partition_values = std::unordered_set<ColumnDataType>{};
+      for (const auto& values_per_chunk_partition : values_per_chunk_and_partition) {
+        const auto& chunk_values = values_per_chunk_partition[partition_id];
+        partition_values.insert(chunk_values.cbegin(), chunk_values.cend());
+      }
+      values_per_partition[partition_id].assign(partition_values.cbegin(), partition_values.cend());
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // (3) Each non-empty partition becomes an output chunk. The NULL value, if any, is added to the first one.
+  auto output_chunks = std::vector<Segments>{};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    auto& values = values_per_partition[partition_id];
+    const auto add_null = contains_null && partition_id == 0;
+    if (values.empty() && !add_null) continue;
+
+    if (!nullable) {
+      output_chunks.emplace_back(Segments{std::make_shared<ValueSegment<ColumnDataType>>(std::move(values))});
+      continue;
+    }
+
+    auto null_values = std::vector<bool>(values.size(), false);
+    if (add_null) {
+      values.emplace_back();
+      null_values.emplace_back(true);
+    }
+    output_chunks.emplace_back(
+        Segments{std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values))});
+  }
+
+  return output_chunks;
+}
+
+std::vector<Segments> Distinct::_distinct_multiple_columns(const size_t partition_count) const {
+  const auto& input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto columns = std::vector<std::unique_ptr<BaseDistinctColumn>>{};
+  columns.reserve(_column_ids.size());
+  for (const auto column_id : _column_ids) {
+    columns.emplace_back(make_unique_by_data_type<BaseDistinctColumn, DistinctColumn>(
+        input_table->column_data_type(column_id), chunk_count, input_table->column_is_nullable(column_id)));
+  }
+
+  // Rows are identified by their RowID in the input table. Their hashes and values are looked up in the materialized
+  // columns.
+  auto row_hashes_per_chunk = std::vector<std::vector<size_t>>(chunk_count);
+  const auto hash_row = [&](const RowID& row_id) { return row_hashes_per_chunk[row_id.chunk_id][row_id.chunk_offset]; };
+  const auto rows_equal = [&](const RowID& lhs, const RowID& rhs) {
+    return std::all_of(columns.cbegin(), columns.cend(), [&](const auto& column) { return column->equals(lhs, rhs); });
+  };
+  using RowSet = std::unordered_set<RowID, decltype(hash_row), decltype(rows_equal)>;
+
+  // (1) Materialize and deduplicate each chunk and scatter its distinct rows into the partitions
+  auto rows_per_chunk_and_partition =
+      std::vector<std::vector<std::vector<RowID>>>(chunk_count, std::vector<std::vector<RowID>>(partition_count));
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      const auto chunk_size = chunk->size();
+
+      auto& row_hashes = row_hashes_per_chunk[chunk_id];
+      row_hashes.resize(chunk_size);
+      for (auto column_idx = size_t{0}; column_idx < columns.size(); ++column_idx) {
+        columns[column_idx]->materialize(*chunk->get_segment(_column_ids[column_idx]), chunk_id, row_hashes);
+      }
+
+      auto chunk_rows = RowSet(chunk_size, hash_row, rows_equal);
+      auto& rows_per_partition = rows_per_chunk_and_partition[chunk_id];
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto row_id = RowID{chunk_id, chunk_offset};
+        if (chunk_rows.emplace(row_id).second) {
+          rows_per_partition[row_hashes[chunk_offset] % partition_count].emplace_back(row_id);
+        }
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  // (2) Deduplicate each partition and write its distinct rows into an output chunk
+  auto output_chunks = std::vector<Segments>(partition_count);
+
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto partition_rows = RowSet(0, hash_row, rows_equal);
+      auto distinct_rows = std::vector<RowID>{};
+      for (const auto& rows_per_partition : rows_per_chunk_and_partition) {
+        for (const auto& row_id : rows_per_partition[partition_id]) {
+          if (partition_rows.emplace(row_id).second) distinct_rows.emplace_back(row_id);
+        }
+      }
+      if (distinct_rows.empty()) return;
+
+      auto& segments = output_chunks[partition_id];
+      for (const auto& column : columns) {
+        segments.emplace_back(column->values_of(distinct_rows));
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  output_chunks.erase(std::remove_if(output_chunks.begin(), output_chunks.end(),
+                                     [](const auto& segments) { return segments.empty(); }),
+                      output_chunks.end());
+  return output_chunks;
+}
+
+}  // namespace opossum
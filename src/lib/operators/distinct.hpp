@@ -0,0 +1,50 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Outputs each distinct combination of the values in the given columns once, i.e., it executes SELECT DISTINCT and
+ * GROUP BY without aggregates. Unlike Aggregate, it keeps no per-group state. Each chunk is deduplicated by a job of
+ * its own, which scatters the distinct values (or rows) of the chunk into radix partitions by their hash. Each
+ * partition is then deduplicated by a job of its own and becomes one chunk of the output.
+ *
+ * If there is a single column, its values are hashed directly. Of dictionary-encoded segments of data tables, the
+ * dictionary is taken as the chunk's distinct values, without looking at the rows.
+ *
+ * NULLs are considered equal to each other. The output consists of ValueSegments with the given columns in the given
+ * order. The order of the rows is undefined.
+ */
+class Distinct : public AbstractReadOnlyOperator {
+ public:
+  Distinct(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids);
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  // Returns the output chunks
+  template <typename ColumnDataType>
+  std::vector<Segments> _distinct_single_column(const size_t partition_count) const;
+  std::vector<Segments> _distinct_multiple_columns(const size_t partition_count) const;
+
+ private:
+  const std::vector<ColumnID> _column_ids;
+};
+
+}  // namespace opossum
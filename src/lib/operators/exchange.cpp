@@ -0,0 +1,102 @@
+#include "exchange.hpp"
+
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "distributed/abstract_node.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Exchange::Exchange(const std::vector<std::shared_ptr<AbstractNode>>& nodes, const std::string& fragment_sql)
+    : AbstractReadOnlyOperator(OperatorType::Exchange), _nodes(nodes), _fragment_sql(fragment_sql) {
+  Assert(!_nodes.empty(), "Exchange needs at least one node.");
+}
+
+const std::string Exchange::name() const { return "Exchange"; }
+
+const std::string Exchange::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return "[Exchange] " + std::to_string(_nodes.size()) + " nodes," + separator + _fragment_sql;
+}
+
+std::shared_ptr<const Table> Exchange::_on_execute() {
+  // The ids of the nodes whose partial results are ready, in the order in which they arrived. Declared before the
+  // futures, as the destructors of the futures wait for the threads that use them.
+  auto completed_node_ids = std::queue<size_t>{};
+  auto completed_mutex = std::mutex{};
+  auto completed_condition = std::condition_variable{};
+
+  const auto complete = [&](const size_t node_id) {
+    {
+      std::lock_guard<std::mutex> lock(completed_mutex);
+      completed_node_ids.push(node_id);
+    }
+    completed_condition.notify_one();
+  };
+
+  // The nodes spend their time waiting for the network, so they are queried from their own threads instead of
+  // occupying the workers of the scheduler
+  auto partial_results = std::vector<std::future<std::shared_ptr<const Table>>>{};
+  partial_results.reserve(_nodes.size());
+  for (auto node_id = size_t{0}; node_id < _nodes.size(); ++node_id) {
+    partial_results.emplace_back(std::async(std::launch::async, [&, node_id]() {
+      try {
+        const auto partial_result = _nodes[node_id]->execute(_fragment_sql);
+        complete(node_id);
+        return partial_result;
+      } catch (...) {
+        complete(node_id);
+        throw;
+      }
+    }));
+  }
+
+  // The partial results are appended as they arrive, so that slow nodes do not hold up the others
+  auto output = std::shared_ptr<Table>{};
+  for (auto completed_count = size_t{0}; completed_count < _nodes.size(); ++completed_count) {
+    auto node_id = size_t{0};
+    {
+      std::unique_lock<std::mutex> lock(completed_mutex);
+      completed_condition.wait(lock, [&]() { return !completed_node_ids.empty(); });
+      node_id = completed_node_ids.front();
+      completed_node_ids.pop();
+    }
+
+    const auto partial_result = partial_results[node_id].get();
+    Assert(partial_result->type() == TableType::Data,
+           "Partial result of " + _nodes[node_id]->description() + " is not a data table.");
+
+    if (!output) {
+      output = std::make_shared<Table>(partial_result->column_definitions(), TableType::Data);
+    } else {
+      Assert(partial_result->column_data_types() == output->column_data_types(),
+             "Partial result of " + _nodes[node_id]->description() + " has different columns than the others.");
+    }
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < partial_result->chunk_count(); ++chunk_id) {
+      const auto chunk = partial_result->get_chunk(chunk_id);
+      if (chunk->size() == 0) continue;
+      output->append_chunk(chunk->segments());
+    }
+  }
+
+  return output;
+}
+
+std::shared_ptr<AbstractOperator> Exchange::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Exchange>(_nodes, _fragment_sql);
+}
+
+void Exchange::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+class AbstractNode;
+
+/**
+ * Executes a query fragment on several nodes of a distributed database (see DistributedCoordinator) and returns the
+ * union of their partial results. The fragment is typically a scan, a partial aggregate, or a join with replicated or
+ * co-partitioned tables, of which the coordinator combines the results, e.g., with a final aggregate.
+ *
+ * The fragment is sent to all nodes at once. Their results are appended as they arrive, without copying their
+ * segments. All nodes have to return the same columns.
+ */
+class Exchange : public AbstractReadOnlyOperator {
+ public:
+  Exchange(const std::vector<std::shared_ptr<AbstractNode>>& nodes, const std::string& fragment_sql);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::vector<std::shared_ptr<AbstractNode>> _nodes;
+  const std::string _fragment_sql;
+};
+
+}  // namespace opossum
@@ -1,18 +1,29 @@
 #include "export_binary.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <deque>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "import_export/binary.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
-#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -21,11 +32,11 @@
 
 namespace {
 
-// Writes the content of the vector to the ofstream
+// Writes the content of the vector to the ostream
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the string are
+/* Writes the given strings to the ostream. First an array of string lengths is written. After that the string are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
@@ -33,7 +44,7 @@ void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values)
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
 template <typename Alloc>
-void export_string_values(std::ofstream& ofstream, const std::vector<std::string, Alloc>& values) {
+void export_string_values(std::ostream& ostream, const std::vector<std::string, Alloc>& values) {
   std::vector<size_t> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -43,7 +54,7 @@ void export_string_values(std::ofstream& ofstream, const std::vector<std::string
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(ostream, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) return;
@@ -56,59 +67,82 @@ void export_string_values(std::ofstream& ofstream, const std::vector<std::string
     start += str.size();
   }
 
-  export_values(ofstream, buffer);
+  export_values(ostream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values) {
+  ostream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_vector<std::string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& ostream, const opossum::pmr_vector<std::string>& values) {
+  export_string_values(ostream, values);
 }
 template <>
-void export_values(std::ofstream& ofstream, const std::vector<std::string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& ostream, const std::vector<std::string>& values) {
+  export_string_values(ostream, values);
 }
 
 // specialized implementation for bool values
 template <>
-void export_values(std::ofstream& ofstream, const std::vector<bool>& values) {
+void export_values(std::ostream& ostream, const std::vector<bool>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(ostream, writable_bools);
 }
 
 template <typename T>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<T>& values) {
+void export_values(std::ostream& ostream, const opossum::pmr_concurrent_vector<T>& values) {
   // TODO(all): could be faster if we directly write the values into the stream without prior conversion
   const auto value_block = std::vector<T>{values.begin(), values.end()};
-  ofstream.write(reinterpret_cast<const char*>(value_block.data()), value_block.size() * sizeof(T));
+  ostream.write(reinterpret_cast<const char*>(value_block.data()), value_block.size() * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<std::string>& values) {
+void export_values(std::ostream& ostream, const opossum::pmr_concurrent_vector<std::string>& values) {
   // TODO(all): could be faster if we directly write the values into the stream without prior conversion
   const auto value_block = std::vector<std::string>{values.begin(), values.end()};
-  export_string_values(ofstream, value_block);
+  export_string_values(ostream, value_block);
 }
 
 // specialized implementation for bool values
 template <>
-void export_values(std::ofstream& ofstream, const opossum::pmr_concurrent_vector<bool>& values) {
+void export_values(std::ostream& ostream, const opossum::pmr_concurrent_vector<bool>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(ostream, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// specialized implementation for bool values
+template <>
+void export_values(std::ostream& ostream, const opossum::pmr_vector<bool>& values) {
+  // Cast to fixed-size format used in binary file
+  const auto writable_bools = std::vector<opossum::BoolAsByteType>(values.begin(), values.end());
+  export_values(ostream, writable_bools);
+}
+
+// Writes a shallow copy of the given value to the ostream
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::ostream& ostream, const T& value) {
+  ostream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Returns the width of a fixed-size byte-aligned compressed vector as stored in the binary file
+opossum::AttributeVectorWidth compressed_vector_width(const opossum::CompressedVectorType type) {
+  switch (type) {
+    case opossum::CompressedVectorType::FixedSize4ByteAligned:
+      return 4u;
+    case opossum::CompressedVectorType::FixedSize2ByteAligned:
+      return 2u;
+    case opossum::CompressedVectorType::FixedSize1ByteAligned:
+      return 1u;
+    case opossum::CompressedVectorType::SimdBp128:
+      return opossum::SIMD_BP128_VECTOR_WIDTH;
+  }
+  opossum::Fail("Unknown compressed vector type");
 }
 }  // namespace
 
@@ -124,9 +158,50 @@ void ExportBinary::write_binary(const Table& table, const std::string& filename)
 
   _write_header(table, ofstream);
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+  // The chunk directory is written once the offsets of all chunks are known
+  const auto chunk_count = table.chunk_count();
+  const auto chunk_directory_position = ofstream.tellp();
+  auto chunk_offsets = std::vector<uint64_t>(chunk_count);
+  export_values(ofstream, chunk_offsets);
+
+  // The chunks are serialized into buffers by parallel JobTasks. The buffers are written in order, so that the file is
+  // written with large sequential writes. The number of buffered chunks is limited to bound the memory consumption.
+  struct PendingChunk {
+    std::shared_ptr<AbstractTask> task;
+    std::shared_ptr<std::stringstream> buffer;
+  };
+
+  std::deque<PendingChunk> pending_chunks;
+  const auto max_pending_chunks = std::max(size_t{2}, size_t{2} * std::thread::hardware_concurrency());
+  auto written_chunk_count = ChunkID{0};
+
+  const auto write_first_pending_chunk = [&]() {
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{pending_chunks.front().task});
+    chunk_offsets[written_chunk_count] = static_cast<uint64_t>(ofstream.tellp());
+    ofstream << pending_chunks.front().buffer->rdbuf();
+    pending_chunks.pop_front();
+    ++written_chunk_count;
+  };
+
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
+    auto buffer = std::make_shared<std::stringstream>();
+    buffer->exceptions(std::stringstream::failbit | std::stringstream::badbit);
+    auto task = std::make_shared<JobTask>([&table, buffer, chunk_id]() { _write_chunk(table, *buffer, chunk_id); });
+    pending_chunks.push_back({task, buffer});
+    task->schedule();
+
+    while (!pending_chunks.empty() &&
+           (pending_chunks.size() > max_pending_chunks || pending_chunks.front().task->is_done())) {
+      write_first_pending_chunk();
+    }
   }
+
+  while (!pending_chunks.empty()) {
+    write_first_pending_chunk();
+  }
+
+  ofstream.seekp(chunk_directory_position);
+  export_values(ofstream, chunk_offsets);
 }
 
 const std::string ExportBinary::name() const { return "ExportBinary"; }
@@ -144,10 +219,10 @@ std::shared_ptr<AbstractOperator> ExportBinary::_on_deep_copy(
 
 void ExportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-void ExportBinary::_write_header(const Table& table, std::ofstream& ofstream) {
-  export_value(ofstream, static_cast<ChunkOffset>(table.max_chunk_size()));
-  export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
-  export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
+void ExportBinary::_write_header(const Table& table, std::ostream& ostream) {
+  export_value(ostream, static_cast<ChunkOffset>(table.max_chunk_size()));
+  export_value(ostream, static_cast<ChunkID::base_type>(table.chunk_count()));
+  export_value(ostream, static_cast<ColumnID::base_type>(table.column_count()));
 
   std::vector<std::string> column_types(table.column_count());
   std::vector<std::string> column_names(table.column_count());
@@ -159,16 +234,16 @@ void ExportBinary::_write_header(const Table& table, std::ofstream& ofstream) {
     column_names[column_id] = table.column_name(column_id);
     columns_are_nullable[column_id] = table.column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(ostream, column_types);
+  export_values(ostream, columns_are_nullable);
+  export_string_values(ostream, column_names);
 }
 
-void ExportBinary::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
+void ExportBinary::_write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id) {
   const auto chunk = table.get_chunk(chunk_id);
-  const auto context = std::make_shared<ExportContext>(ofstream);
+  const auto context = std::make_shared<ExportContext>(ostream);
 
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  export_value(ostream, static_cast<ChunkOffset>(chunk->size()));
 
   // Iterating over all segments of this chunk and exporting them
   for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
@@ -187,13 +262,13 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseValueSegment
   auto context = std::static_pointer_cast<ExportContext>(base_context);
   const auto& segment = static_cast<const ValueSegment<T>&>(base_segment);
 
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->ostream, BinarySegmentType::value_segment);
 
   if (segment.is_nullable()) {
-    export_values(context->ofstream, segment.null_values());
+    export_values(context->ostream, segment.null_values());
   }
 
-  export_values(context->ofstream, segment.values());
+  export_values(context->ostream, segment.values());
 }
 
 template <typename T>
@@ -202,12 +277,12 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const ReferenceSegment
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
   // We materialize reference segments and save them as value segments
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->ostream, BinarySegmentType::value_segment);
 
   // Unfortunately, we have to iterate over all values of the reference segment
   // to materialize its contents. Then we can write them to the file
   for (ChunkOffset row = 0; row < ref_segment.size(); ++row) {
-    export_value(context->ofstream, type_cast_variant<T>(ref_segment[row]));
+    export_value(context->ostream, type_cast_variant<T>(ref_segment[row]));
   }
 }
 
@@ -218,7 +293,7 @@ void ExportBinary::ExportBinaryVisitor<std::string>::handle_segment(
   auto context = std::static_pointer_cast<ExportContext>(base_context);
 
   // We materialize reference segments and save them as value segments
-  export_value(context->ofstream, BinarySegmentType::value_segment);
+  export_value(context->ostream, BinarySegmentType::value_segment);
 
   // If there is no data, we can skip all of the coming steps.
   if (ref_segment.size() == 0) return;
@@ -234,8 +309,8 @@ void ExportBinary::ExportBinaryVisitor<std::string>::handle_segment(
     values << value;
   }
 
-  export_values(context->ofstream, string_lengths);
-  context->ofstream << values.rdbuf();
+  export_values(context->ostream, string_lengths);
+  context->ostream << values.rdbuf();
 }
 
 template <typename T>
@@ -245,71 +320,131 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseDictionarySe
 
   Assert(base_segment.compressed_vector_type(),
          "Expected DictionarySegment to use vector compression for attribute vector");
-  Assert(is_fixed_size_byte_aligned(*base_segment.compressed_vector_type()),
-         "Does only support fixed-size byte-aligned compressed attribute vectors.");
-
-  export_value(context->ofstream, BinarySegmentType::dictionary_segment);
-
-  const auto attribute_vector_width = [&]() {
-    Assert(base_segment.compressed_vector_type(),
-           "Expected DictionarySegment to use vector compression for attribute vector");
-    switch (*base_segment.compressed_vector_type()) {
-      case CompressedVectorType::FixedSize4ByteAligned:
-        return 4u;
-      case CompressedVectorType::FixedSize2ByteAligned:
-        return 2u;
-      case CompressedVectorType::FixedSize1ByteAligned:
-        return 1u;
-      default:
-        return 0u;
-    }
-  }();
-
-  // Write attribute vector width
-  export_value(context->ofstream, static_cast<const AttributeVectorWidth>(attribute_vector_width));
+  const auto attribute_vector_type = *base_segment.compressed_vector_type();
 
   if (base_segment.encoding_type() == EncodingType::FixedStringDictionary) {
     const auto& segment = static_cast<const FixedStringDictionarySegment<std::string>&>(base_segment);
+    const auto& dictionary = *segment.fixed_string_dictionary();
 
-    // Write the dictionary size and dictionary
-    export_value(context->ofstream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
-    export_values(context->ofstream, *segment.dictionary());
+    export_value(context->ostream, BinarySegmentType::fixed_string_dictionary_segment);
+    export_value(context->ostream, compressed_vector_width(attribute_vector_type));
+
+    // The padded strings are written as they are stored
+    export_value(context->ostream, dictionary.string_length());
+    export_value(context->ostream, dictionary.chars().size());
+    export_values(context->ostream, dictionary.chars());
+    export_value(context->ostream, segment.null_value_id());
   } else {
     const auto& segment = static_cast<const DictionarySegment<T>&>(base_segment);
 
+    export_value(context->ostream, BinarySegmentType::dictionary_segment);
+    export_value(context->ostream, compressed_vector_width(attribute_vector_type));
+
     // Write the dictionary size and dictionary
-    export_value(context->ofstream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
-    export_values(context->ofstream, *segment.dictionary());
+    export_value(context->ostream, static_cast<ValueID::base_type>(segment.dictionary()->size()));
+    export_values(context->ostream, *segment.dictionary());
   }
 
-  // Write attribute vector
-  Assert(base_segment.compressed_vector_type(),
-         "Expected DictionarySegment to use vector compression for attribute vector");
-  _export_attribute_vector(context->ofstream, *base_segment.compressed_vector_type(), *base_segment.attribute_vector());
+  _export_attribute_vector(context->ostream, attribute_vector_type, *base_segment.attribute_vector());
 }
 
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::handle_segment(const BaseEncodedSegment& base_segment,
                                                           std::shared_ptr<SegmentVisitorContext> base_context) {
-  Fail("Binary export not implemented yet for encoded segments.");
+  auto context = std::static_pointer_cast<ExportContext>(base_context);
+
+  switch (base_segment.encoding_type()) {
+    case EncodingType::RunLength: {
+      const auto& segment = static_cast<const RunLengthSegment<T>&>(base_segment);
+
+      export_value(context->ostream, BinarySegmentType::run_length_segment);
+      export_value(context->ostream, static_cast<uint32_t>(segment.values()->size()));
+      export_values(context->ostream, *segment.values());
+      export_values(context->ostream, *segment.null_values());
+      export_values(context->ostream, *segment.end_positions());
+      return;
+    }
+
+    case EncodingType::FrameOfReference:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                hana::type_c<T>)) {
+        const auto& segment = static_cast<const FrameOfReferenceSegment<T>&>(base_segment);
+        const auto offset_values_type = segment.offset_values().type();
+
+        export_value(context->ostream, BinarySegmentType::frame_of_reference_segment);
+        export_value(context->ostream, compressed_vector_width(offset_values_type));
+
+        export_value(context->ostream, static_cast<uint32_t>(segment.block_minima().size()));
+        export_values(context->ostream, segment.block_minima());
+        export_values(context->ostream, segment.null_values());
+
+        _export_attribute_vector(context->ostream, offset_values_type, segment.offset_values());
+        return;
+      }
+      break;
+
+    case EncodingType::LZ4: {
+      const auto& segment = static_cast<const LZ4Segment<T>&>(base_segment);
+
+      // The compressed blocks are written as they are, so that they do not have to be compressed again on import
+      export_value(context->ostream, BinarySegmentType::lz4_segment);
+      export_value(context->ostream, static_cast<uint32_t>(segment.block_count()));
+      export_values(context->ostream, segment.decompressed_block_sizes());
+      export_values(context->ostream, segment.block_offsets());
+      export_values(context->ostream, segment.compressed_data());
+      export_values(context->ostream, segment.null_values());
+      return;
+    }
+
+    case EncodingType::Delta:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::Delta>, hana::type_c<T>)) {
+        const auto& segment = static_cast<const DeltaSegment<T>&>(base_segment);
+        const auto deltas_type = segment.deltas().type();
+
+        export_value(context->ostream, BinarySegmentType::delta_segment);
+        export_value(context->ostream, compressed_vector_width(deltas_type));
+
+        export_value(context->ostream, static_cast<uint32_t>(segment.block_anchors().size()));
+        export_values(context->ostream, segment.block_anchors());
+        export_values(context->ostream, segment.null_values());
+
+        _export_attribute_vector(context->ostream, deltas_type, segment.deltas());
+
+        export_value(context->ostream, static_cast<uint32_t>(segment.wide_deltas().size()));
+        export_values(context->ostream, segment.wide_delta_offsets());
+        export_values(context->ostream, segment.wide_deltas());
+        return;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  Fail("Binary export not implemented for encoding " + encoding_type_to_string.left.at(base_segment.encoding_type()));
 }
 
 template <typename T>
-void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ofstream& ofstream,
+void ExportBinary::ExportBinaryVisitor<T>::_export_attribute_vector(std::ostream& ostream,
                                                                     const CompressedVectorType type,
                                                                     const BaseCompressedVector& attribute_vector) {
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
+      export_values(ostream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
       return;
-    default:
-      Fail("Any other type should have been caught before.");
+    case CompressedVectorType::SimdBp128: {
+      // The packed blocks are written as they are, the number of values is the row count of the chunk
+      const auto& data = dynamic_cast<const SimdBp128Vector&>(attribute_vector).data();
+      export_value(ostream, static_cast<uint64_t>(data.size()));
+      export_values(ostream, data);
+      return;
+    }
   }
 }
 
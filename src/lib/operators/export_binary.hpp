@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -23,6 +24,10 @@ class ExportBinary : public AbstractReadOnlyOperator {
  public:
   explicit ExportBinary(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename);
 
+  /**
+   * Writes the header, a directory with the offset of each chunk from the beginning of the file (uint64_t), and the
+   * chunks. The chunks are serialized in parallel JobTasks and written in order.
+   */
   static void write_binary(const Table& table, const std::string& filename);
 
   /**
@@ -47,7 +52,7 @@ class ExportBinary : public AbstractReadOnlyOperator {
   const std::string _filename;
 
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given ostream.
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
@@ -60,12 +65,12 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    * @param table The table that is to be exported
-   * @param ofstream The output stream for exporting
+   * @param ostream The output stream for exporting
    */
-  static void _write_header(const Table& table, std::ofstream& ofstream);
+  static void _write_header(const Table& table, std::ostream& ostream);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Writes the contents of the chunk into the given ostream.
    * First, it creates a chunk header with the following contents:
    *
    * Description           | Type                                  | Size in bytes
@@ -76,18 +81,18 @@ class ExportBinary : public AbstractReadOnlyOperator {
    * of the segment, such as ReferenceSegment, DictionarySegment, ValueSegment).
    *
    * @param table The table we are currently exporting
-   * @param ofstream The output stream to write to
+   * @param ostream The output stream to write to
    * @param chunkId The id of the chunk that is to be worked on now
    *
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id);
 
   template <typename T>
   class ExportBinaryVisitor;
 
   struct ExportContext : SegmentVisitorContext {
-    explicit ExportContext(std::ofstream& ofstream) : ofstream(ofstream) {}
-    std::ofstream& ofstream;
+    explicit ExportContext(std::ostream& ostream) : ostream(ostream) {}
+    std::ostream& ostream;
   };
 };
 
@@ -112,7 +117,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the ostream.
    *
    */
   void handle_segment(const BaseValueSegment& base_segment, std::shared_ptr<SegmentVisitorContext> base_context) final;
@@ -134,7 +139,7 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the ostream.
    */
   void handle_segment(const ReferenceSegment& ref_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
@@ -158,18 +163,89 @@ class ExportBinary::ExportBinaryVisitor : public AbstractSegmentVisitor {
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is written if the type of the column is NOT a string
    *
+   * Fixed String Dictionary Segments keep their padded strings:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Width of attribute v. | AttributeVectorWidth                  |   1
+   * String length         | size_t                                |   8
+   * Number of characters  | size_t                                |   8
+   * Characters            | char                                  |   Number of characters
+   * Null value id         | ValueID                               |   4
+   * Attribute v. values   | uintX                                 |   rows * width of attribute v.
+   *
+   * SIMD-BP128-compressed attribute vectors are marked by SIMD_BP128_VECTOR_WIDTH instead of a width. They are
+   * stored as the number of 128-bit blocks (uint64_t) followed by the blocks.
+   *
    * @param base_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the ostream.
    */
   void handle_segment(const BaseDictionarySegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
 
+  /**
+   * Encoded segments are written without decoding them, so that they do not have to be encoded again on import.
+   * Compressed vectors are written like attribute vectors of dictionary segments.
+   *
+   * Frame of Reference Segments are dumped with the following layout:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Width of offset v.    | AttributeVectorWidth                  |   1
+   * Number of blocks      | uint32_t                              |   4
+   * Block minima          | T (int, long)                         |   blocks * sizeof(T)
+   * Null Values           | vector<bool> (BoolAsByteType)         |   rows * 1
+   * Offset values         | uintX                                 |   rows * width of offset v.
+   *
+   * Run Length Segments:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Number of runs        | uint32_t                              |   4
+   * Values                | T (like in value segments)            |   runs * sizeof(T)
+   * Null Values           | vector<bool> (BoolAsByteType)         |   runs * 1
+   * End positions         | ChunkOffset                           |   runs * 4
+   *
+   * LZ4 Segments:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Number of blocks      | uint32_t                              |   4
+   * Decompressed sizes    | uint32_t                              |   blocks * 4
+   * Block offsets         | size_t                                |   (blocks + 1) * 8
+   * Compressed data       | char                                  |   last block offset
+   * Null Values           | vector<bool> (BoolAsByteType)         |   rows * 1
+   *
+   * Delta Segments:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Column Type           | ColumnType                            |   1
+   * Width of deltas       | AttributeVectorWidth                  |   1
+   * Number of blocks      | uint32_t                              |   4
+   * Block anchors         | T (int, long)                         |   blocks * sizeof(T)
+   * Null Values           | vector<bool> (BoolAsByteType)         |   rows * 1
+   * Deltas                | uintX                                 |   rows * width of deltas
+   * Number of wide deltas | uint32_t                              |   4
+   * Wide delta offsets    | ChunkOffset                           |   wide deltas * 4
+   * Wide deltas           | unsigned T                            |   wide deltas * sizeof(T)
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * @param base_segment The segment to export
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the ostream.
+   */
   void handle_segment(const BaseEncodedSegment& base_segment,
                       std::shared_ptr<SegmentVisitorContext> base_context) override;
 
  private:
-  // Chooses the right FixedSizeByteAlignedVector depending on the attribute_vector_width and exports it.
-  static void _export_attribute_vector(std::ofstream& ofstream, const CompressedVectorType type,
+  // Exports the compressed vector depending on its type, see the layout of dictionary segments.
+  static void _export_attribute_vector(std::ostream& ostream, const CompressedVectorType type,
                                        const BaseCompressedVector& attribute_vector);
 };
 }  // namespace opossum
@@ -0,0 +1,132 @@
+#if HYRISE_PARQUET_SUPPORT
+
+#include "export_parquet.hpp"
+
+#include <arrow/io/file.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "import_export/parquet.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+void write_column(const BaseSegment& segment, const bool is_nullable, parquet::ColumnWriter& column_writer) {
+  using ParquetDataType = typename ParquetType<T>::type;
+
+  // Parquet expects the values without the nulls, which are marked by a definition level of 0
+  auto values = std::vector<T>{};
+  values.reserve(segment.size());
+  auto definition_levels = std::vector<int16_t>{};
+  if (is_nullable) definition_levels.reserve(segment.size());
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) {
+      definition_levels.emplace_back(0);
+    } else {
+      if (is_nullable) definition_levels.emplace_back(1);
+      values.emplace_back(position.value());
+    }
+  });
+
+  auto parquet_values = std::vector<typename ParquetDataType::c_type>{};
+  parquet_values.reserve(values.size());
+  for (const auto& value : values) {
+    parquet_values.emplace_back(to_parquet_value(value));
+  }
+
+  auto& typed_column_writer = static_cast<parquet::TypedColumnWriter<ParquetDataType>&>(column_writer);
+  typed_column_writer.WriteBatch(static_cast<int64_t>(segment.size()),
+                                 is_nullable ? definition_levels.data() : nullptr, nullptr, parquet_values.data());
+}
+
+std::shared_ptr<parquet::schema::GroupNode> create_schema(const Table& table) {
+  auto fields = parquet::schema::NodeVector{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    auto physical_type = parquet::Type::BYTE_ARRAY;
+    auto converted_type = parquet::ConvertedType::NONE;
+    switch (table.column_data_type(column_id)) {
+      case DataType::Int:
+        physical_type = parquet::Type::INT32;
+        break;
+      case DataType::Long:
+        physical_type = parquet::Type::INT64;
+        break;
+      case DataType::Float:
+        physical_type = parquet::Type::FLOAT;
+        break;
+      case DataType::Double:
+        physical_type = parquet::Type::DOUBLE;
+        break;
+      case DataType::String:
+        converted_type = parquet::ConvertedType::UTF8;
+        break;
+      default:
+        Fail("Column type cannot be written to Parquet");
+    }
+
+    const auto repetition =
+        table.column_is_nullable(column_id) ? parquet::Repetition::OPTIONAL : parquet::Repetition::REQUIRED;
+    fields.emplace_back(parquet::schema::PrimitiveNode::Make(table.column_name(column_id), repetition, physical_type,
+                                                             converted_type));
+  }
+
+  return std::static_pointer_cast<parquet::schema::GroupNode>(
+      parquet::schema::GroupNode::Make("schema", parquet::Repetition::REQUIRED, fields));
+}
+
+}  // namespace
+
+namespace opossum {
+
+ExportParquet::ExportParquet(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename)
+    : AbstractReadOnlyOperator(OperatorType::ExportParquet, in), _filename(filename) {}
+
+const std::string ExportParquet::name() const { return "ExportParquet"; }
+
+std::shared_ptr<const Table> ExportParquet::_on_execute() {
+  write_parquet(*_input_left->get_output(), _filename);
+  return _input_left->get_output();
+}
+
+void ExportParquet::write_parquet(const Table& table, const std::string& filename) {
+  std::shared_ptr<arrow::io::FileOutputStream> file;
+  PARQUET_ASSIGN_OR_THROW(file, arrow::io::FileOutputStream::Open(filename));
+
+  auto file_writer = parquet::ParquetFileWriter::Open(file, create_schema(table));
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    auto* const row_group_writer = file_writer->AppendRowGroup();
+
+    for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        write_column<ColumnDataType>(*chunk->get_segment(column_id), table.column_is_nullable(column_id),
+                                     *row_group_writer->NextColumn());
+      });
+    }
+  }
+
+  file_writer->Close();
+  PARQUET_THROW_NOT_OK(file->Close());
+}
+
+std::shared_ptr<AbstractOperator> ExportParquet::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<ExportParquet>(copied_input_left, _filename);
+}
+
+void ExportParquet::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
+
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+
+#if HYRISE_PARQUET_SUPPORT
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Writes its input table to a Parquet file (https://parquet.apache.org/documentation/latest/), so that other tools,
+ * e.g., of a data lake, can read it without converting it from CSV first.
+ *
+ * Each chunk becomes one row group. Int, Long, Float, Double, and String columns are written as INT32, INT64, FLOAT,
+ * DOUBLE, and UTF-8 BYTE_ARRAY columns, nullable columns as optional columns. The Parquet writer dictionary-encodes
+ * the values and stores the min/max statistics of each row group, which ImportParquet uses to skip row groups.
+ */
+class ExportParquet : public AbstractReadOnlyOperator {
+ public:
+  explicit ExportParquet(const std::shared_ptr<const AbstractOperator>& in, const std::string& filename);
+
+  static void write_parquet(const Table& table, const std::string& filename);
+
+  const std::string name() const override;
+
+ protected:
+  // Returns the input table
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  // Path of the Parquet file
+  const std::string _filename;
+};
+
+}  // namespace opossum
+
+#endif
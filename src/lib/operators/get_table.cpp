@@ -2,11 +2,16 @@
 
 #include <algorithm>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
 
@@ -23,6 +28,15 @@ const std::string GetTable::description(DescriptionMode description_mode) const
   if (!_excluded_chunk_ids.empty()) {
     stream << separator << "(" << _excluded_chunk_ids.size() << " Chunks pruned)";
   }
+  if (_row_budget) {
+    stream << separator << "(first " << *_row_budget << " rows)";
+  }
+  if (_input_left) {
+    stream << separator << "(Chunks pruned by join keys)";
+  }
+  if (_table_sample) {
+    stream << separator << "(SAMPLE " << *_table_sample << ")";
+  }
   return stream.str();
 }
 
@@ -32,11 +46,29 @@ void GetTable::set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk
   _excluded_chunk_ids = excluded_chunk_ids;
 }
 
+void GetTable::set_join_key_source(const std::shared_ptr<const AbstractOperator>& join_key_source,
+                                   const ColumnID join_key_source_column_id, const ColumnID column_id) {
+  _input_left = join_key_source;
+  _join_key_source_column_id = join_key_source_column_id;
+  _join_key_column_id = column_id;
+}
+
+void GetTable::set_row_budget(const std::optional<size_t>& row_budget) { _row_budget = row_budget; }
+
+const std::optional<size_t>& GetTable::row_budget() const { return _row_budget; }
+
+void GetTable::set_table_sample(const std::optional<TableSample>& table_sample) { _table_sample = table_sample; }
+
+const std::optional<TableSample>& GetTable::table_sample() const { return _table_sample; }
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   auto copy = std::make_shared<GetTable>(_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_row_budget(_row_budget);
+  copy->set_table_sample(_table_sample);
+  if (copied_input_left) copy->set_join_key_source(copied_input_left, _join_key_source_column_id, _join_key_column_id);
   return copy;
 }
 
@@ -44,22 +76,122 @@ void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeV
 
 std::shared_ptr<const Table> GetTable::_on_execute() {
   auto original_table = StorageManager::get().get_table(_name);
-  if (_excluded_chunk_ids.empty()) {
+
+  auto excluded_chunks_set = std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
+  if (_input_left) _exclude_chunks_without_join_partners(*original_table, excluded_chunks_set);
+
+  // A sample of all rows is the table itself
+  const auto is_sampled = _table_sample && _table_sample->fraction < 1.0;
+  const auto sample_chunks = is_sampled && _table_sample->method == TableSampleMethod::System;
+  const auto sample_rows = is_sampled && _table_sample->method == TableSampleMethod::Bernoulli;
+  const auto row_budget = sample_rows ? std::nullopt : _row_budget;
+
+  if (excluded_chunks_set.empty() && (!row_budget || *row_budget >= original_table->row_count()) && !is_sampled) {
+    _performance_data->chunks_processed += original_table->chunk_count();
     return original_table;
   }
 
-  // we create a copy of the original table and don't include the excluded chunks
+  auto random_engine = std::mt19937{};
+  if (is_sampled) random_engine.seed(_table_sample->seed ? *_table_sample->seed : std::random_device{}());
+  auto chunk_is_sampled = std::bernoulli_distribution{sample_chunks ? _table_sample->fraction : 1.0};
+
+  // we create a copy of the original table and don't include the excluded chunks, nor the chunks after those that
+  // already hold enough rows for the row budget, nor the chunks that are not part of a SYSTEM sample
   const auto pruned_table = std::make_shared<Table>(original_table->column_definitions(), TableType::Data,
                                                     original_table->max_chunk_size(), original_table->has_mvcc());
-  const auto excluded_chunks_set =
-      std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
+  auto included_chunk_ids = std::vector<ChunkID>{};
+  auto row_count = size_t{0};
   for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
-    if (excluded_chunks_set.find(chunk_id) == excluded_chunks_set.end()) {
-      pruned_table->append_chunk(original_table->get_chunk(chunk_id));
-    }
+    if (row_budget && row_count >= *row_budget) break;
+    if (excluded_chunks_set.find(chunk_id) != excluded_chunks_set.end()) continue;
+    // Drawn for each chunk in turn, so that the same seed draws the same chunks
+    if (sample_chunks && !chunk_is_sampled(random_engine)) continue;
+
+    const auto chunk = original_table->get_chunk(chunk_id);
+    pruned_table->append_chunk(chunk);
+    included_chunk_ids.emplace_back(chunk_id);
+    row_count += chunk->size();
   }
 
+  _performance_data->chunks_processed += pruned_table->chunk_count();
+  _performance_data->chunks_skipped += original_table->chunk_count() - pruned_table->chunk_count();
+
+  if (sample_rows) return _sample_rows(original_table, included_chunk_ids, random_engine);
+
   return pruned_table;
 }
 
+void GetTable::_exclude_chunks_without_join_partners(const Table& table,
+                                                     std::unordered_set<ChunkID>& excluded_chunk_ids) const {
+  const auto join_key_source_table = input_table_left();
+  const auto data_type = table.column_data_type(_join_key_column_id);
+  if (join_key_source_table->column_data_type(_join_key_source_column_id) != data_type) return;
+
+  resolve_data_type(data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto min = std::optional<ColumnDataType>{};
+    auto max = std::optional<ColumnDataType>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < join_key_source_table->chunk_count(); ++chunk_id) {
+      const auto& segment = *join_key_source_table->get_chunk(chunk_id)->get_segment(_join_key_source_column_id);
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        if (position.is_null()) return;
+        if (!min || position.value() < *min) min = position.value();
+        if (!max || position.value() > *max) max = position.value();
+      });
+    }
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      // Without join keys (NULLs never match), the join has no result at all
+      if (!min) {
+        excluded_chunk_ids.emplace(chunk_id);
+        continue;
+      }
+
+      const auto statistics = table.get_chunk(chunk_id)->statistics();
+      if (statistics && statistics->can_prune(_join_key_column_id, PredicateCondition::Between, AllTypeVariant{*min},
+                                              AllTypeVariant{*max})) {
+        excluded_chunk_ids.emplace(chunk_id);
+      }
+    }
+  });
+}
+
+std::shared_ptr<const Table> GetTable::_sample_rows(const std::shared_ptr<const Table>& table,
+                                                  const std::vector<ChunkID>& chunk_ids,
+                                                  std::mt19937& random_engine) const {
+  const auto sampled_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  // Instead of drawing for each row whether it is part of the sample, the number of rows up to the next sampled row is
+  // drawn. Thus, only the sampled rows are touched, and the fewer rows are sampled, the faster the sampling is.
+  // The offsets are 64 bit wide, so that skipping past the end of the chunk does not overflow them.
+  auto skipped_row_count = std::geometric_distribution<uint64_t>{_table_sample->fraction};
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+
+    const auto pos_list = std::make_shared<PosList>();
+    pos_list->reserve(static_cast<size_t>(static_cast<double>(chunk_size) * _table_sample->fraction));
+    for (auto chunk_offset = skipped_row_count(random_engine); chunk_offset < chunk_size;
+         chunk_offset += skipped_row_count(random_engine) + 1) {
+      pos_list->emplace_back(chunk_id, static_cast<ChunkOffset>(chunk_offset));
+    }
+    if (pos_list->empty()) continue;
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+
+    // The sampled rows keep their order, and they are all of the partition of the chunk
+    const auto sampled_chunk = std::make_shared<Chunk>(segments);
+    if (const auto& ordered_by = chunk->ordered_by()) sampled_chunk->set_ordered_by(*ordered_by);
+    if (const auto partition_id = chunk->partition_id()) sampled_chunk->set_partition_id(*partition_id);
+    sampled_table->append_chunk(sampled_chunk);
+  }
+
+  return sampled_table;
+}
+
 }  // namespace opossum
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <random>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "storage/table_sample.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -21,6 +25,26 @@ class GetTable : public AbstractReadOnlyOperator {
 
   void set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk_ids);
 
+  /**
+   * Runtime chunk pruning for inner and semi joins: the values of the column @param column_id of this table are joined
+   * with the values of the column @param join_key_source_column_id of the output of @param join_key_source. Chunks
+   * whose statistics show that none of their values lie between the minimum and the maximum of these join keys are
+   * skipped. The join key source becomes the input of the GetTable, so that it is executed first. Set by the
+   * LQPTranslator if the join key source is the smaller input of the join.
+   */
+  void set_join_key_source(const std::shared_ptr<const AbstractOperator>& join_key_source,
+                           const ColumnID join_key_source_column_id, const ColumnID column_id);
+
+  // If set, only the first chunks that hold at least this many rows are output. Set by the LQPTranslator if the
+  // GetTable is consumed by a Limit with a constant row count.
+  void set_row_budget(const std::optional<size_t>& row_budget);
+  const std::optional<size_t>& row_budget() const;
+
+  // If set, only a random sample of the table is output (see TableSample). Chunks are sampled after the excluded
+  // chunks were removed. The row budget is ignored for Bernoulli samples, as the chunks hold fewer rows once sampled.
+  void set_table_sample(const std::optional<TableSample>& table_sample);
+  const std::optional<TableSample>& table_sample() const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -29,8 +53,20 @@ class GetTable : public AbstractReadOnlyOperator {
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  // Adds the chunks of @param table without join partners in the join key source to @param excluded_chunk_ids
+  void _exclude_chunks_without_join_partners(const Table& table,
+                                             std::unordered_set<ChunkID>& excluded_chunk_ids) const;
+
+  // A reference table of the rows of the chunks @param chunk_ids of @param table that are part of a Bernoulli sample
+  std::shared_ptr<const Table> _sample_rows(const std::shared_ptr<const Table>& table,
+                                            const std::vector<ChunkID>& chunk_ids, std::mt19937& random_engine) const;
+
   // name of the table to retrieve
   const std::string _name;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::optional<size_t> _row_budget;
+  std::optional<TableSample> _table_sample;
+  ColumnID _join_key_source_column_id{INVALID_COLUMN_ID};
+  ColumnID _join_key_column_id{INVALID_COLUMN_ID};
 };
 }  // namespace opossum
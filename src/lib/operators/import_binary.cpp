@@ -2,79 +2,116 @@
 
 #include <boost/hana/for_each.hpp>
 
+#include <algorithm>
 #include <cstdint>
-#include <fstream>
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "constant_mappings.hpp"
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/base_value_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-ImportBinary::ImportBinary(const std::string& filename, const std::optional<std::string>& tablename)
-    : AbstractReadOnlyOperator(OperatorType::ImportBinary), _filename(filename), _tablename(tablename) {}
+ImportBinary::ImportBinary(const std::string& filename, const std::optional<std::string>& tablename,
+                           const std::optional<ChunkEncodingSpec>& encoding_spec)
+    : AbstractReadOnlyOperator(OperatorType::ImportBinary),
+      _filename(filename),
+      _tablename(tablename),
+      _encoding_spec(encoding_spec) {}
 
 const std::string ImportBinary::name() const { return "ImportBinary"; }
 
-std::shared_ptr<Table> ImportBinary::read_binary(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-
-  Assert(file.is_open(), "ImportBinary: Could not open file " + filename);
-
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+std::shared_ptr<Table> ImportBinary::read_binary(const std::string& filename,
+                                                 const std::optional<ChunkEncodingSpec>& encoding_spec) {
+  MemoryMappedFile file{filename};
 
   std::shared_ptr<Table> table;
   ChunkID chunk_count;
   std::tie(table, chunk_count) = _read_header(file);
+  const auto chunk_offsets = _read_values<uint64_t>(file, chunk_count);
+  const auto column_data_types = table->column_data_types();
+
+  // The chunk directory tells where each chunk starts, so the chunks are imported in parallel. Each job reads through
+  // its own view of the mapping and encodes its chunk right away.
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto chunk_file = file.at(chunk_offsets[chunk_id]);
+      const auto segments = _import_chunk(chunk_file, *table);
+      const auto row_count = segments.empty() ? ChunkOffset{0} : static_cast<ChunkOffset>(segments[0]->size());
+      chunks[chunk_id] = std::make_shared<Chunk>(segments, std::make_shared<MvccData>(row_count));
+
+      // Chunks that were exported with an encoding keep it, as the ChunkEncoder only encodes ValueSegments
+      const auto is_unencoded = std::all_of(segments.cbegin(), segments.cend(), [](const auto& segment) {
+        return std::dynamic_pointer_cast<const BaseValueSegment>(segment) != nullptr;
+      });
+      if (encoding_spec && is_unencoded) {
+        ChunkEncoder::encode_chunk(chunks[chunk_id], column_data_types, *encoding_spec);
+      }
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& chunk : chunks) {
+    table->append_chunk(chunk);
   }
 
   return table;
 }
 
 template <typename T>
-pmr_vector<T> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> ImportBinary::_read_values(MemoryMappedFile& file, const size_t count) {
   pmr_vector<T> values(count);
-  file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+  const auto byte_count = values.size() * sizeof(T);
+  // The mapping is not aligned for T, so the values are copied in bulk instead of being accessed in place
+  const auto* const data = file.read(byte_count);
+  if (byte_count > 0) std::memcpy(values.data(), data, byte_count);
   return values;
 }
 
 // specialized implementation for string values
 template <>
-pmr_vector<std::string> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<std::string> ImportBinary::_read_values(MemoryMappedFile& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> ImportBinary::_read_values(std::ifstream& file, const size_t count) {
-  pmr_vector<BoolAsByteType> readable_bools(count);
-  file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
-  return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
+pmr_vector<bool> ImportBinary::_read_values(MemoryMappedFile& file, const size_t count) {
+  const auto* const readable_bools = reinterpret_cast<const BoolAsByteType*>(file.read(count * sizeof(BoolAsByteType)));
+  return pmr_vector<bool>(readable_bools, readable_bools + count);
 }
 
-pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<std::string> ImportBinary::_read_string_values(MemoryMappedFile& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
+
+  // The strings are constructed directly from the mapping without an intermediate buffer
+  const auto* const buffer = file.read(total_length);
 
   pmr_vector<std::string> values(count);
   size_t start = 0;
 
   for (size_t i = 0; i < count; ++i) {
-    values[i] = std::string(buffer.data() + start, buffer.data() + start + string_lengths[i]);
+    values[i] = std::string(buffer + start, buffer + start + string_lengths[i]);
     start += string_lengths[i];
   }
 
@@ -82,9 +119,9 @@ pmr_vector<std::string> ImportBinary::_read_string_values(std::ifstream& file, c
 }
 
 template <typename T>
-T ImportBinary::_read_value(std::ifstream& file) {
+T ImportBinary::_read_value(MemoryMappedFile& file) {
   T result;
-  file.read(reinterpret_cast<char*>(&result), sizeof(T));
+  std::memcpy(&result, file.read(sizeof(T)), sizeof(T));
   return result;
 }
 
@@ -93,7 +130,7 @@ std::shared_ptr<const Table> ImportBinary::_on_execute() {
     return StorageManager::get().get_table(*_tablename);
   }
 
-  const auto table = read_binary(_filename);
+  const auto table = read_binary(_filename, _encoding_spec);
 
   if (_tablename) {
     StorageManager::get().add_table(*_tablename, table);
@@ -105,12 +142,12 @@ std::shared_ptr<const Table> ImportBinary::_on_execute() {
 std::shared_ptr<AbstractOperator> ImportBinary::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<ImportBinary>(_filename, _tablename);
+  return std::make_shared<ImportBinary>(_filename, _tablename, _encoding_spec);
 }
 
 void ImportBinary::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstream& file) {
+std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(MemoryMappedFile& file) {
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -129,18 +166,18 @@ std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstr
   return std::make_pair(table, chunk_count);
 }
 
-void ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+Segments ImportBinary::_import_chunk(MemoryMappedFile& file, const Table& table) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
   Segments output_segments;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
     output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+        _import_segment(file, row_count, table.column_data_type(column_id), table.column_is_nullable(column_id)));
   }
-  table->append_chunk(output_segments);
+  return output_segments;
 }
 
-std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> ImportBinary::_import_segment(MemoryMappedFile& file, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -152,7 +189,7 @@ std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file,
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> ImportBinary::_import_segment(MemoryMappedFile& file, ChunkOffset row_count,
                                                            bool is_nullable) {
   const auto column_type = _read_value<BinarySegmentType>(file);
 
@@ -161,28 +198,56 @@ std::shared_ptr<BaseSegment> ImportBinary::_import_segment(std::ifstream& file,
       return _import_value_segment<ColumnDataType>(file, row_count, is_nullable);
     case BinarySegmentType::dictionary_segment:
       return _import_dictionary_segment<ColumnDataType>(file, row_count);
+    case BinarySegmentType::frame_of_reference_segment:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_frame_of_reference_segment<ColumnDataType>(file, row_count);
+      } else {
+        Fail("Cannot import FrameOfReferenceSegment: data type is not supported by the encoding");
+      }
+    case BinarySegmentType::run_length_segment:
+      return _import_run_length_segment<ColumnDataType>(file);
+    case BinarySegmentType::fixed_string_dictionary_segment:
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        return _import_fixed_string_dictionary_segment(file, row_count);
+      } else {
+        Fail("Cannot import FixedStringDictionarySegment: data type is not supported by the encoding");
+      }
+    case BinarySegmentType::lz4_segment:
+      return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case BinarySegmentType::delta_segment:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::Delta>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_delta_segment<ColumnDataType>(file, row_count);
+      } else {
+        Fail("Cannot import DeltaSegment: data type is not supported by the encoding");
+      }
     default:
       // This case happens if the read column type is not a valid BinarySegmentType.
       Fail("Cannot import column: invalid column type");
   }
 }
 
-std::shared_ptr<BaseCompressedVector> ImportBinary::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+std::unique_ptr<const BaseCompressedVector> ImportBinary::_import_attribute_vector(
+    MemoryMappedFile& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
     case 2:
-      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
     case 4:
-      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return std::make_unique<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+    case SIMD_BP128_VECTOR_WIDTH: {
+      const auto block_count = _read_value<uint64_t>(file);
+      return std::make_unique<SimdBp128Vector>(_read_values<uint128_t>(file, block_count), row_count);
+    }
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(MemoryMappedFile& file, ChunkOffset row_count,
                                                                      bool is_nullable) {
   // TODO(unknown): Ideally _read_values would directly write into a tbb::concurrent_vector so that no conversion is
   // needed
@@ -198,16 +263,84 @@ std::shared_ptr<ValueSegment<T>> ImportBinary::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> ImportBinary::_import_dictionary_segment(MemoryMappedFile& file,
                                                                                ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
   const auto null_value_id = dictionary_size;
   auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
 
-  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+  auto attribute_vector =
+      std::shared_ptr<const BaseCompressedVector>{_import_attribute_vector(file, row_count, attribute_vector_width)};
 
   return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector, null_value_id);
 }
 
+template <typename T>
+std::shared_ptr<FrameOfReferenceSegment<T>> ImportBinary::_import_frame_of_reference_segment(MemoryMappedFile& file,
+                                                                                           ChunkOffset row_count) {
+  const auto offset_values_width = _read_value<AttributeVectorWidth>(file);
+  const auto block_count = _read_value<uint32_t>(file);
+  auto block_minima = _read_values<T>(file, block_count);
+  auto null_values = _read_values<bool>(file, row_count);
+
+  auto offset_values = _import_attribute_vector(file, row_count, offset_values_width);
+
+  return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::move(null_values),
+                                                      std::move(offset_values));
+}
+
+template <typename T>
+std::shared_ptr<RunLengthSegment<T>> ImportBinary::_import_run_length_segment(MemoryMappedFile& file) {
+  const auto run_count = _read_value<uint32_t>(file);
+  auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, run_count));
+  auto null_values = std::make_shared<pmr_vector<bool>>(_read_values<bool>(file, run_count));
+  auto end_positions = std::make_shared<pmr_vector<ChunkOffset>>(_read_values<ChunkOffset>(file, run_count));
+
+  return std::make_shared<RunLengthSegment<T>>(values, null_values, end_positions);
+}
+
+std::shared_ptr<FixedStringDictionarySegment<std::string>> ImportBinary::_import_fixed_string_dictionary_segment(
+    MemoryMappedFile& file, ChunkOffset row_count) {
+  const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
+  const auto string_length = _read_value<size_t>(file);
+  const auto char_count = _read_value<size_t>(file);
+  auto dictionary = std::make_shared<FixedStringVector>(_read_values<char>(file, char_count), string_length);
+  const auto null_value_id = _read_value<ValueID>(file);
+
+  auto attribute_vector =
+      std::shared_ptr<const BaseCompressedVector>{_import_attribute_vector(file, row_count, attribute_vector_width)};
+
+  return std::make_shared<FixedStringDictionarySegment<std::string>>(dictionary, attribute_vector, null_value_id);
+}
+
+template <typename T>
+std::shared_ptr<LZ4Segment<T>> ImportBinary::_import_lz4_segment(MemoryMappedFile& file, ChunkOffset row_count) {
+  const auto block_count = _read_value<uint32_t>(file);
+  auto decompressed_block_sizes = _read_values<uint32_t>(file, block_count);
+  auto block_offsets = _read_values<size_t>(file, block_count + size_t{1});
+  auto compressed_data = _read_values<char>(file, block_offsets.back());
+  auto null_values = _read_values<bool>(file, row_count);
+
+  return std::make_shared<LZ4Segment<T>>(std::move(compressed_data), std::move(block_offsets),
+                                         std::move(decompressed_block_sizes), std::move(null_values));
+}
+
+template <typename T>
+std::shared_ptr<DeltaSegment<T>> ImportBinary::_import_delta_segment(MemoryMappedFile& file, ChunkOffset row_count) {
+  const auto deltas_width = _read_value<AttributeVectorWidth>(file);
+  const auto block_count = _read_value<uint32_t>(file);
+  auto block_anchors = _read_values<T>(file, block_count);
+  auto null_values = _read_values<bool>(file, row_count);
+
+  auto deltas = _import_attribute_vector(file, row_count, deltas_width);
+
+  const auto wide_delta_count = _read_value<uint32_t>(file);
+  auto wide_delta_offsets = _read_values<ChunkOffset>(file, wide_delta_count);
+  auto wide_deltas = _read_values<typename DeltaSegment<T>::UnsignedT>(file, wide_delta_count);
+
+  return std::make_shared<DeltaSegment<T>>(std::move(block_anchors), std::move(null_values), std::move(deltas),
+                                           std::move(wide_delta_offsets), std::move(wide_deltas));
+}
+
 }  // namespace opossum
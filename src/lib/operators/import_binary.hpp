@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -10,8 +9,16 @@
 #include "abstract_read_only_operator.hpp"
 #include "import_export/binary.hpp"
 #include "storage/base_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/delta_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/value_segment.hpp"
+#include "utils/memory_mapped_file.hpp"
 
 namespace opossum {
 
@@ -19,23 +26,33 @@ namespace opossum {
  * This operator reads a Opossum binary file and creates a table from that input.
  * If parameter tablename provided, the imported table is stored in the StorageManager. If a table with this name
  * already exists, it is returned and no import is performed.
+ * The file is memory-mapped (see MemoryMappedFile) and fixed-width data is copied from the mapping in bulk. The
+ * chunks are imported in parallel JobTasks. If an encoding spec is given, each job encodes its chunk right after
+ * importing it, unless the chunk was already stored with an encoding.
  *
  * Note: ImportBinary does not support null values at the moment
  */
 class ImportBinary : public AbstractReadOnlyOperator {
  public:
-  explicit ImportBinary(const std::string& filename, const std::optional<std::string>& tablename = std::nullopt);
+  explicit ImportBinary(const std::string& filename, const std::optional<std::string>& tablename = std::nullopt,
+                        const std::optional<ChunkEncodingSpec>& encoding_spec = std::nullopt);
 
-  static std::shared_ptr<Table> read_binary(const std::string& filename);
+  static std::shared_ptr<Table> read_binary(const std::string& filename,
+                                            const std::optional<ChunkEncodingSpec>& encoding_spec = std::nullopt);
 
   /*
    * Reads the given binary file. The file must be in the following form:
    *
-   * --------------
-   * |   Header   |
-   * |------------|
-   * |   Chunks¹  |
-   * --------------
+   * -------------------
+   * |     Header      |
+   * |-----------------|
+   * | Chunk directory |
+   * |-----------------|
+   * |     Chunks¹     |
+   * -------------------
+   *
+   * The chunk directory holds the offset of each chunk from the beginning of the file as uint64_t, which allows the
+   * chunks to be imported in parallel.
    *
    * ¹ Zero or more chunks
    */
@@ -67,10 +84,10 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * Column names          | std::string array                     |   Sum of lengths of all names
    *
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(MemoryMappedFile& file);
 
   /*
-   * Creates a chunk from chunk information from the given file and adds it to the given table.
+   * Reads the segments of a chunk of the given table from the given file.
    * The chunk information has the following form:
    *
    * ----------------
@@ -81,15 +98,15 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static Segments _import_chunk(MemoryMappedFile& file, const Table& table);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
+  static std::shared_ptr<BaseSegment> _import_segment(MemoryMappedFile& file, ChunkOffset row_count, DataType data_type,
                                                       bool is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(MemoryMappedFile& file, ChunkOffset row_count, bool is_nullable);
 
   /*
    * Imports a serialized ValueSegment from the given file.
@@ -117,7 +134,7 @@ class ImportBinary : public AbstractReadOnlyOperator {
    *
    */
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(MemoryMappedFile& file, ChunkOffset row_count,
                                                                 bool is_nullable);
 
   /*
@@ -137,28 +154,65 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * °: This field is needed if the type of the column is NOT a string
    */
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(MemoryMappedFile& file,
+                                                                          ChunkOffset row_count);
+
+  /*
+   * Imports a serialized FrameOfReferenceSegment from the given file.
+   * The file must contain data in the following format:
+   *
+   * Description           | Type                                  | Size in bytes
+   * -----------------------------------------------------------------------------------------
+   * Width of offset v.    | AttributeVectorWidth                  |   1
+   * Number of blocks      | uint32_t                              |   4
+   * Block minima          | T (int, long)                         |   blocks * sizeof(T)
+   * Null Values           | bool (stored as BoolAsByteType)       |   row_count * 1
+   * Offset values         | uintX                                 |   row_count * width of offset v.
+   */
+  template <typename T>
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(MemoryMappedFile& file,
+                                                                                        ChunkOffset row_count);
+
+  /*
+   * Imports a serialized RunLengthSegment, FixedStringDictionarySegment, LZ4Segment, or DeltaSegment from the given
+   * file. The layouts are described in ExportBinary. The encoded data is taken as it is, i.e., nothing is encoded
+   * again.
+   */
+  template <typename T>
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(MemoryMappedFile& file);
+
+  static std::shared_ptr<FixedStringDictionarySegment<std::string>> _import_fixed_string_dictionary_segment(
+      MemoryMappedFile& file, ChunkOffset row_count);
+
+  template <typename T>
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(MemoryMappedFile& file, ChunkOffset row_count);
+
+  template <typename T>
+  static std::shared_ptr<DeltaSegment<T>> _import_delta_segment(MemoryMappedFile& file, ChunkOffset row_count);
 
-  // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
-                                                                        AttributeVectorWidth attribute_vector_width);
+  // Imports the compressed vector that corresponds to the given attribute_vector_width, which is either the width of
+  // a FixedSizeByteAlignedVector or SIMD_BP128_VECTOR_WIDTH.
+  static std::unique_ptr<const BaseCompressedVector> _import_attribute_vector(
+      MemoryMappedFile& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(MemoryMappedFile& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<std::string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<std::string> _read_string_values(MemoryMappedFile& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(MemoryMappedFile& file);
 
  private:
   // Name of the import file
   const std::string _filename;
   // Name for adding the table to the StorageManager
   const std::optional<std::string> _tablename;
+  // Encoding of the imported chunks that were stored unencoded
+  const std::optional<ChunkEncodingSpec> _encoding_spec;
 };
 
 }  // namespace opossum
@@ -7,6 +7,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "import_export/csv_meta.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -28,10 +29,12 @@ class ImportCsv : public AbstractReadOnlyOperator {
    * @param filename      Path to the input file.
    * @param tablename     Optional. Name of the table to store/look up in the StorageManager.
    * @param meta          Optional. A specific meta config, to override the given .json file.
+   * @param encoding_spec Optional. The encoding of the chunks, which are encoded right after they were parsed.
    */
   explicit ImportCsv(const std::string& filename, const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
                      const std::optional<std::string>& tablename = std::nullopt,
-                     const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                     const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                     const std::optional<ChunkEncodingSpec>& encoding_spec = std::nullopt);
 
   const std::string name() const override;
 
@@ -54,5 +57,7 @@ class ImportCsv : public AbstractReadOnlyOperator {
   const std::optional<std::string> _tablename;
   // CSV meta information
   const std::optional<CsvMeta> _csv_meta;
+  // Encoding of the imported chunks
+  const std::optional<ChunkEncodingSpec> _encoding_spec;
 };
 }  // namespace opossum
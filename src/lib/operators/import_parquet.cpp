@@ -0,0 +1,355 @@
+#if HYRISE_PARQUET_SUPPORT
+
+#include "import_parquet.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "import_export/parquet.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+std::optional<DataType> parquet_data_type(const parquet::ColumnDescriptor& column) {
+  switch (column.physical_type()) {
+    case parquet::Type::INT32:
+      return DataType::Int;
+    case parquet::Type::INT64:
+      return DataType::Long;
+    case parquet::Type::FLOAT:
+      return DataType::Float;
+    case parquet::Type::DOUBLE:
+      return DataType::Double;
+    case parquet::Type::BYTE_ARRAY:
+      return DataType::String;
+    default:
+      return std::nullopt;
+  }
+}
+
+// Reads a column chunk whose pages are all dictionary-encoded into a DictionarySegment. Returns nullptr if a page is
+// not dictionary-encoded, e.g., because the writer fell back to plain encoding for a large dictionary.
+template <typename T>
+std::shared_ptr<BaseSegment> read_dictionary_column(parquet::RowGroupReader& row_group_reader, const int column_index,
+                                                    const int64_t row_count, const bool is_nullable) {
+  using ParquetDataType = typename ParquetType<T>::type;
+
+  const auto column_reader = row_group_reader.Column(column_index);
+  auto& typed_column_reader = static_cast<parquet::TypedColumnReader<ParquetDataType>&>(*column_reader);
+
+  auto definition_levels = std::vector<int16_t>(static_cast<size_t>(row_count));
+  auto indices = std::vector<int32_t>(static_cast<size_t>(row_count));
+  auto parquet_dictionary = std::vector<T>{};
+
+  auto level_count = int64_t{0};
+  auto index_count = int64_t{0};
+  try {
+    while (level_count < row_count && typed_column_reader.HasNext()) {
+      // The dictionary is only returned by the first call. It belongs to the reader and is copied right away.
+      const typename ParquetDataType::c_type* dictionary = nullptr;
+      auto dictionary_length = int32_t{0};
+      auto indices_read = int64_t{0};
+      level_count += typed_column_reader.ReadBatchWithDictionary(
+          row_count - level_count, definition_levels.data() + level_count, nullptr, indices.data() + index_count,
+          &indices_read, &dictionary, &dictionary_length);
+      index_count += indices_read;
+
+      if (dictionary) {
+        parquet_dictionary.reserve(static_cast<size_t>(dictionary_length));
+        for (auto dictionary_index = int32_t{0}; dictionary_index < dictionary_length; ++dictionary_index) {
+          parquet_dictionary.emplace_back(from_parquet_value<T>(dictionary[dictionary_index]));
+        }
+      }
+    }
+  } catch (const parquet::ParquetException&) {
+    return nullptr;
+  }
+
+  // Hyrise requires sorted dictionaries without duplicates, while Parquet stores the values in the order in which they
+  // appeared. Instead of decoding the values, only the dictionary is sorted and the value ids are remapped.
+  auto sorted_positions = std::vector<size_t>(parquet_dictionary.size());
+  std::iota(sorted_positions.begin(), sorted_positions.end(), size_t{0});
+  std::sort(sorted_positions.begin(), sorted_positions.end(),
+            [&](const auto left, const auto right) { return parquet_dictionary[left] < parquet_dictionary[right]; });
+
+  auto dictionary = std::make_shared<pmr_vector<T>>();
+  dictionary->reserve(parquet_dictionary.size());
+  auto value_ids = std::vector<uint32_t>(parquet_dictionary.size());
+  for (const auto position : sorted_positions) {
+    if (dictionary->empty() || dictionary->back() != parquet_dictionary[position]) {
+      dictionary->emplace_back(parquet_dictionary[position]);
+    }
+    value_ids[position] = static_cast<uint32_t>(dictionary->size() - 1);
+  }
+
+  const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+  auto attribute_vector = pmr_vector<uint32_t>{};
+  attribute_vector.reserve(static_cast<size_t>(row_count));
+  auto index_id = size_t{0};
+  for (auto row = int64_t{0}; row < row_count; ++row) {
+    if (is_nullable && definition_levels[static_cast<size_t>(row)] == 0) {
+      attribute_vector.emplace_back(null_value_id);
+    } else {
+      attribute_vector.emplace_back(value_ids[static_cast<size_t>(indices[index_id++])]);
+    }
+  }
+
+  auto compressed_attribute_vector =
+      compress_vector(attribute_vector, VectorCompressionType::FixedSizeByteAligned, PolymorphicAllocator<size_t>{},
+                      {static_cast<uint32_t>(dictionary->size() + 1u)});
+  return std::make_shared<DictionarySegment<T>>(
+      dictionary, std::shared_ptr<const BaseCompressedVector>(std::move(compressed_attribute_vector)),
+      ValueID{null_value_id});
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> read_plain_column(parquet::RowGroupReader& row_group_reader, const int column_index,
+                                               const int64_t row_count, const bool is_nullable) {
+  using ParquetDataType = typename ParquetType<T>::type;
+
+  const auto column_reader = row_group_reader.Column(column_index);
+  auto& typed_column_reader = static_cast<parquet::TypedColumnReader<ParquetDataType>&>(*column_reader);
+
+  auto definition_levels = std::vector<int16_t>(static_cast<size_t>(row_count));
+  auto parquet_values = std::vector<typename ParquetDataType::c_type>(static_cast<size_t>(row_count));
+  auto non_null_values = std::vector<T>{};
+  non_null_values.reserve(static_cast<size_t>(row_count));
+
+  auto level_count = int64_t{0};
+  while (level_count < row_count && typed_column_reader.HasNext()) {
+    auto values_read = int64_t{0};
+    level_count += typed_column_reader.ReadBatch(row_count - level_count, definition_levels.data() + level_count,
+                                                 nullptr, parquet_values.data(), &values_read);
+
+    // Byte arrays point into the current page, so they are converted before the next page is read
+    for (auto value_index = int64_t{0}; value_index < values_read; ++value_index) {
+      non_null_values.emplace_back(from_parquet_value<T>(parquet_values[static_cast<size_t>(value_index)]));
+    }
+  }
+
+  if (!is_nullable) return std::make_shared<ValueSegment<T>>(std::move(non_null_values));
+
+  auto values = std::vector<T>(static_cast<size_t>(row_count));
+  auto null_values = std::vector<bool>(static_cast<size_t>(row_count));
+  auto value_index = size_t{0};
+  for (auto row = size_t{0}; row < values.size(); ++row) {
+    if (definition_levels[row] == 0) {
+      null_values[row] = true;
+    } else {
+      values[row] = std::move(non_null_values[value_index++]);
+    }
+  }
+  return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+}
+
+}  // namespace
+
+namespace opossum {
+
+ImportParquet::ImportParquet(const std::string& filename, const std::optional<std::string>& tablename,
+                             const std::vector<std::string>& column_names,
+                             const std::vector<ParquetRowGroupPredicate>& predicates)
+    : AbstractReadOnlyOperator(OperatorType::ImportParquet),
+      _filename(filename),
+      _tablename(tablename),
+      _column_names(column_names),
+      _predicates(predicates) {}
+
+const std::string ImportParquet::name() const { return "ImportParquet"; }
+
+std::shared_ptr<const Table> ImportParquet::_on_execute() {
+  if (_tablename && StorageManager::get().has_table(*_tablename)) {
+    return StorageManager::get().get_table(*_tablename);
+  }
+
+  const auto table = read_parquet(_filename, _column_names, _predicates);
+
+  if (_tablename) {
+    StorageManager::get().add_table(*_tablename, table);
+  }
+
+  return table;
+}
+
+std::shared_ptr<Table> ImportParquet::read_parquet(const std::string& filename,
+                                                   const std::vector<std::string>& column_names,
+                                                   const std::vector<ParquetRowGroupPredicate>& predicates) {
+  const auto file_reader = parquet::ParquetFileReader::OpenFile(filename, true);
+  const auto metadata = file_reader->metadata();
+  const auto& schema = *metadata->schema();
+
+  // Only the requested columns are read
+  auto column_indices = std::vector<int>{};
+  if (column_names.empty()) {
+    column_indices.resize(static_cast<size_t>(schema.num_columns()));
+    std::iota(column_indices.begin(), column_indices.end(), 0);
+  } else {
+    for (const auto& column_name : column_names) {
+      const auto column_index = schema.ColumnIndex(column_name);
+      Assert(column_index >= 0, "Column " + column_name + " does not exist in " + filename);
+      column_indices.emplace_back(column_index);
+    }
+  }
+
+  auto column_definitions = TableColumnDefinitions{};
+  for (const auto column_index : column_indices) {
+    const auto& column = *schema.Column(column_index);
+    Assert(column.max_repetition_level() == 0, "Repeated Parquet columns are not supported");
+    const auto data_type = parquet_data_type(column);
+    Assert(data_type, "Type of Parquet column " + column.name() + " is not supported");
+    column_definitions.emplace_back(column.name(), *data_type, column.max_definition_level() > 0);
+  }
+
+  // Each row group becomes a chunk, so the chunks need to hold the largest row group
+  auto chunk_size = int64_t{1};
+  auto row_group_indices = std::vector<int>{};
+  for (auto row_group_index = 0; row_group_index < metadata->num_row_groups(); ++row_group_index) {
+    chunk_size = std::max(chunk_size, metadata->RowGroup(row_group_index)->num_rows());
+    if (!_can_skip_row_group(*metadata, row_group_index, predicates)) row_group_indices.emplace_back(row_group_index);
+  }
+  Assert(chunk_size <= std::numeric_limits<ChunkOffset>::max(), "Row groups of " + filename + " are too large");
+
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data,
+                                             static_cast<ChunkOffset>(chunk_size), UseMvcc::Yes);
+
+  auto segments_by_row_group = std::vector<Segments>(row_group_indices.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(row_group_indices.size());
+  for (auto job_id = size_t{0}; job_id < row_group_indices.size(); ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      // The readers are not thread-safe, so each job opens its own. The metadata is only parsed once.
+      const auto row_group_file_reader =
+          parquet::ParquetFileReader::OpenFile(filename, true, parquet::default_reader_properties(), metadata);
+      const auto row_group_reader = row_group_file_reader->RowGroup(row_group_indices[job_id]);
+      segments_by_row_group[job_id] = _read_row_group(*row_group_reader, *table, column_indices);
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+
+  for (const auto& segments : segments_by_row_group) {
+    table->append_chunk(segments);
+  }
+
+  return table;
+}
+
+bool ImportParquet::_can_skip_row_group(const parquet::FileMetaData& metadata, const int row_group_index,
+                                        const std::vector<ParquetRowGroupPredicate>& predicates) {
+  const auto row_group = metadata.RowGroup(row_group_index);
+  const auto& schema = *metadata.schema();
+
+  for (const auto& predicate : predicates) {
+    const auto column_index = schema.ColumnIndex(predicate.column_name);
+    if (column_index < 0) continue;
+
+    const auto column_chunk = row_group->ColumnChunk(column_index);
+    const auto statistics = column_chunk->statistics();
+    if (!column_chunk->is_stats_set() || !statistics) continue;
+
+    if (predicate.predicate_condition == PredicateCondition::IsNull ||
+        predicate.predicate_condition == PredicateCondition::IsNotNull) {
+      if (!statistics->HasNullCount()) continue;
+      const auto null_count = statistics->null_count();
+      if (predicate.predicate_condition == PredicateCondition::IsNull && null_count == 0) return true;
+      if (predicate.predicate_condition == PredicateCondition::IsNotNull && null_count == row_group->num_rows()) {
+        return true;
+      }
+      continue;
+    }
+
+    // Values of other types would have to be converted, which might change the result of the comparison
+    const auto data_type = parquet_data_type(*schema.Column(column_index));
+    if (!statistics->HasMinMax() || variant_is_null(predicate.value) || !data_type ||
+        *data_type != data_type_from_all_type_variant(predicate.value)) {
+      continue;
+    }
+
+    auto can_skip = false;
+    resolve_data_type(*data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      using ParquetDataType = typename ParquetType<ColumnDataType>::type;
+
+      const auto& typed_statistics = static_cast<const parquet::TypedStatistics<ParquetDataType>&>(*statistics);
+      const auto min = from_parquet_value<ColumnDataType>(typed_statistics.min());
+      const auto max = from_parquet_value<ColumnDataType>(typed_statistics.max());
+      const auto value = boost::get<ColumnDataType>(predicate.value);
+
+      switch (predicate.predicate_condition) {
+        case PredicateCondition::Equals:
+          can_skip = value < min || value > max;
+          break;
+        case PredicateCondition::LessThan:
+          can_skip = min >= value;
+          break;
+        case PredicateCondition::LessThanEquals:
+          can_skip = min > value;
+          break;
+        case PredicateCondition::GreaterThan:
+          can_skip = max <= value;
+          break;
+        case PredicateCondition::GreaterThanEquals:
+          can_skip = max < value;
+          break;
+        default:
+          break;
+      }
+    });
+    if (can_skip) return true;
+  }
+
+  return false;
+}
+
+Segments ImportParquet::_read_row_group(parquet::RowGroupReader& row_group_reader, const Table& table,
+                                        const std::vector<int>& column_indices) {
+  const auto row_count = row_group_reader.metadata()->num_rows();
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    const auto column_index = column_indices[column_id];
+    const auto is_nullable = table.column_is_nullable(column_id);
+    const auto has_dictionary_page = row_group_reader.metadata()->ColumnChunk(column_index)->has_dictionary_page();
+
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto segment = std::shared_ptr<BaseSegment>{};
+      if (has_dictionary_page) {
+        segment = read_dictionary_column<ColumnDataType>(row_group_reader, column_index, row_count, is_nullable);
+      }
+      if (!segment) {
+        segment = read_plain_column<ColumnDataType>(row_group_reader, column_index, row_count, is_nullable);
+      }
+      segments.emplace_back(segment);
+    });
+  }
+
+  return segments;
+}
+
+std::shared_ptr<AbstractOperator> ImportParquet::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<ImportParquet>(_filename, _tablename, _column_names, _predicates);
+}
+
+void ImportParquet::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
+
+#endif
@@ -0,0 +1,89 @@
+#pragma once
+
+#if HYRISE_PARQUET_SUPPORT
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace parquet {
+class FileMetaData;
+class RowGroupReader;
+}  // namespace parquet
+
+namespace opossum {
+
+/**
+ * A predicate of the form <column> <condition> <value>. Row groups whose statistics show that none of their rows
+ * satisfies the predicate are not read. The rows of the other row groups are not filtered, i.e., the predicate still
+ * has to be evaluated by a TableScan.
+ */
+struct ParquetRowGroupPredicate {
+  std::string column_name;
+  PredicateCondition predicate_condition;
+  AllTypeVariant value;
+};
+
+/**
+ * Creates a table from a Parquet file (https://parquet.apache.org/documentation/latest/). INT32, INT64, FLOAT,
+ * DOUBLE, and BYTE_ARRAY columns become Int, Long, Float, Double, and String columns, optional columns become
+ * nullable ones. Each row group becomes one chunk. The row groups are read in parallel by JobTasks.
+ *
+ * Column chunks whose pages are all dictionary-encoded become DictionarySegments without decoding the values: Only
+ * the dictionary is sorted, which Hyrise requires, and the value ids are remapped accordingly. Other column chunks
+ * become ValueSegments.
+ *
+ * If parameter tablename is provided, the imported table is stored in the StorageManager. If a table with this name
+ * already exists, it is returned and no import is performed.
+ */
+class ImportParquet : public AbstractReadOnlyOperator {
+ public:
+  /**
+   * @param column_names  The columns to read, in the order of the resulting table. All columns are read if empty.
+   * @param predicates    Predicates that are used to skip row groups based on their statistics.
+   */
+  explicit ImportParquet(const std::string& filename, const std::optional<std::string>& tablename = std::nullopt,
+                         const std::vector<std::string>& column_names = {},
+                         const std::vector<ParquetRowGroupPredicate>& predicates = {});
+
+  static std::shared_ptr<Table> read_parquet(const std::string& filename,
+                                             const std::vector<std::string>& column_names = {},
+                                             const std::vector<ParquetRowGroupPredicate>& predicates = {});
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  // Whether the statistics of the row group show that none of its rows satisfies all predicates
+  static bool _can_skip_row_group(const parquet::FileMetaData& metadata, const int row_group_index,
+                                  const std::vector<ParquetRowGroupPredicate>& predicates);
+
+  static Segments _read_row_group(parquet::RowGroupReader& row_group_reader, const Table& table,
+                                  const std::vector<int>& column_indices);
+
+ private:
+  // Path to the input file
+  const std::string _filename;
+
+  // Name for adding the table to the StorageManager
+  const std::optional<std::string> _tablename;
+
+  const std::vector<std::string> _column_names;
+  const std::vector<ParquetRowGroupPredicate> _predicates;
+};
+
+}  // namespace opossum
+
+#endif
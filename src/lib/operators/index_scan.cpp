@@ -1,13 +1,21 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
 
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/value_segment.hpp"
 
 #include "utils/assert.hpp"
 
@@ -27,12 +35,31 @@ const std::string IndexScan::name() const { return "IndexScan"; }
 
 void IndexScan::set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _included_chunk_ids = chunk_ids; }
 
+void IndexScan::set_index_only(const bool index_only) { _index_only = index_only; }
+
+bool IndexScan::index_only() const { return _index_only; }
+
 std::shared_ptr<const Table> IndexScan::_on_execute() {
   _in_table = input_table_left();
 
   _validate_input();
 
-  _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
+  if (_index_only) {
+    Assert(_left_column_ids.size() == 1, "Index-only scans are only supported on a single column.");
+    const auto column_definitions =
+        TableColumnDefinitions{_in_table->column_definitions()[_left_column_ids.front()]};
+    _out_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  } else {
+    _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
+  }
+
+  // The TableIndex only knows the positions of the values
+  if (!_index_only && _left_column_ids.size() == 1 && BaseTableIndex::supports(_predicate_condition)) {
+    if (const auto table_index = _in_table->get_table_index(_left_column_ids.front())) {
+      _scan_table_index(*table_index);
+      return _out_table;
+    }
+  }
 
   std::mutex output_mutex;
 
@@ -57,14 +84,26 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 std::shared_ptr<AbstractOperator> IndexScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  const auto copy = std::make_shared<IndexScan>(copied_input_left, _index_type, _left_column_ids,
+                                                _predicate_condition, _right_values, _right_values2);
+  copy->set_included_chunk_ids(_included_chunk_ids);
+  copy->set_index_only(_index_only);
+  return copy;
 }
 
 void IndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex) {
   auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
+    if (_index_only) {
+      const auto segment_out = _scan_chunk_keys(chunk_id);
+      if (segment_out->size() == 0) return;
+
+      std::lock_guard<std::mutex> lock(output_mutex);
+      _out_table->append_chunk(Segments{segment_out});
+      return;
+    }
+
     const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
 
     const auto chunk = _in_table->get_chunk(chunk_id);
@@ -87,6 +126,41 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
   return job_task;
 }
 
+void IndexScan::_scan_table_index(const BaseTableIndex& table_index) {
+  const auto matches_out = std::make_shared<PosList>();
+
+  const auto search_value2 = _predicate_condition == PredicateCondition::Between
+                                 ? std::optional<AllTypeVariant>{_right_values2.front()}
+                                 : std::nullopt;
+  table_index.append_matches(_predicate_condition, _right_values.front(), search_value2, *matches_out);
+
+  if (!_included_chunk_ids.empty()) {
+    auto chunk_is_included = std::vector<bool>(_in_table->chunk_count(), false);
+    for (const auto chunk_id : _included_chunk_ids) {
+      chunk_is_included[chunk_id] = true;
+    }
+    matches_out->erase(std::remove_if(matches_out->begin(), matches_out->end(),
+                                      [&](const auto& row_id) {
+                                        // Chunks may have been added by concurrent inserts since the lookup
+                                        return row_id.chunk_id >= chunk_is_included.size() ||
+                                               !chunk_is_included[row_id.chunk_id];
+                                      }),
+                       matches_out->end());
+  }
+
+  if (matches_out->empty()) return;
+
+  // The index returns the matches in value order, the output is in the order of the input table
+  std::sort(matches_out->begin(), matches_out->end());
+  if (matches_out->front().chunk_id == matches_out->back().chunk_id) matches_out->guarantee_single_chunk();
+
+  Segments segments;
+  for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+    segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+  }
+  _out_table->append_chunk(segments);
+}
+
 void IndexScan::_validate_input() {
   Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
@@ -104,67 +178,89 @@ void IndexScan::_validate_input() {
 PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   const auto to_row_id = [chunk_id](ChunkOffset chunk_offset) { return RowID{chunk_id, chunk_offset}; };
 
-  auto range_begin = BaseIndex::Iterator{};
-  auto range_end = BaseIndex::Iterator{};
+  const auto ranges = _matching_ranges(chunk_id).second;
 
-  const auto chunk = _in_table->get_chunk_with_access_counting(chunk_id);
   auto matches_out = PosList{};
+  auto match_count = size_t{0};
+  for (const auto& [range_begin, range_end] : ranges) {
+    match_count += std::distance(range_begin, range_end);
+  }
+  matches_out.reserve(match_count);
+
+  for (const auto& [range_begin, range_end] : ranges) {
+    std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
+  }
+
+  return matches_out;
+}
+
+std::shared_ptr<BaseSegment> IndexScan::_scan_chunk_keys(const ChunkID chunk_id) {
+  const auto [index, ranges] = _matching_ranges(chunk_id);
+  Assert(index->supports_key_access(), "Index-only scans require an index that supports key access.");
+
+  auto segment_out = std::shared_ptr<BaseSegment>{};
+  resolve_data_type(_in_table->column_data_type(_left_column_ids.front()), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Indexes do not contain NULLs, so the output is not nullable either
+    auto values = std::vector<ColumnDataType>{};
+    for (const auto& [range_begin, range_end] : ranges) {
+      index->for_each_key(range_begin, range_end, [&](const AllTypeVariant& value, const ChunkOffset row_count) {
+        values.insert(values.end(), row_count, type_cast_variant<ColumnDataType>(value));
+      });
+    }
+    segment_out = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+  });
+
+  return segment_out;
+}
+
+std::pair<std::shared_ptr<const BaseIndex>, std::vector<IndexScan::IndexRange>> IndexScan::_matching_ranges(
+    const ChunkID chunk_id) {
+  const auto chunk = _in_table->get_chunk_with_access_counting(chunk_id);
 
   const auto index = chunk->get_index(_index_type, _left_column_ids);
   Assert(index != nullptr, "Index of specified type not found for segment (vector).");
+  Assert(BaseIndex::supports(index->type(), _predicate_condition), "Predicate condition not supported by index.");
+
+  auto ranges = std::vector<IndexRange>{};
 
   switch (_predicate_condition) {
     case PredicateCondition::Equals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values);
+      ranges.emplace_back(index->lower_bound(_right_values), index->upper_bound(_right_values));
       break;
     }
     case PredicateCondition::NotEquals: {
-      // first, get all values less than the search value
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
-
-      matches_out.reserve(std::distance(range_begin, range_end));
-      std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
-
-      // set range for second half to all values greater than the search value
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
+      // all values less than the search value and all values greater than the search value
+      ranges.emplace_back(index->cbegin(), index->lower_bound(_right_values));
+      ranges.emplace_back(index->upper_bound(_right_values), index->cend());
       break;
     }
     case PredicateCondition::LessThan: {
-      range_begin = index->cbegin();
-      range_end = index->lower_bound(_right_values);
+      ranges.emplace_back(index->cbegin(), index->lower_bound(_right_values));
       break;
     }
     case PredicateCondition::LessThanEquals: {
-      range_begin = index->cbegin();
-      range_end = index->upper_bound(_right_values);
+      ranges.emplace_back(index->cbegin(), index->upper_bound(_right_values));
       break;
     }
     case PredicateCondition::GreaterThan: {
-      range_begin = index->upper_bound(_right_values);
-      range_end = index->cend();
+      ranges.emplace_back(index->upper_bound(_right_values), index->cend());
       break;
     }
     case PredicateCondition::GreaterThanEquals: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->cend();
+      ranges.emplace_back(index->lower_bound(_right_values), index->cend());
       break;
     }
     case PredicateCondition::Between: {
-      range_begin = index->lower_bound(_right_values);
-      range_end = index->upper_bound(_right_values2);
+      ranges.emplace_back(index->lower_bound(_right_values), index->upper_bound(_right_values2));
       break;
     }
     default:
       Fail("Unsupported comparison type encountered");
   }
 
-  matches_out.reserve(matches_out.size() + std::distance(range_begin, range_end));
-  std::transform(range_begin, range_end, std::back_inserter(matches_out), to_row_id);
-
-  return matches_out;
+  return {index, ranges};
 }
 
 }  // namespace opossum
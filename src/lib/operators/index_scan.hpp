@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 
@@ -13,10 +15,20 @@ namespace opossum {
 
 class Table;
 class AbstractTask;
+class BaseIndex;
+class BaseSegment;
+class BaseTableIndex;
 
 /**
  * Operator that performs a predicate search using indices
  *
+ * If the input table has a TableIndex on the (single) scanned column, all chunks are searched with one lookup in
+ * that index and the matches are returned as a single chunk. Otherwise, the chunk indexes of _index_type are used.
+ *
+ * In index-only mode, the output is a data table that only contains the (single) scanned column. Its values are taken
+ * from the chunk indexes, which have to support key access (see BaseIndex::for_each_key()), so that the indexed
+ * segments are never accessed. The rows of a chunk are returned in value order.
+ *
  * Note: Scans only the set of chunks passed to the constructor
  */
 class IndexScan : public AbstractReadOnlyOperator {
@@ -36,6 +48,12 @@ class IndexScan : public AbstractReadOnlyOperator {
    */
   void set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids);
 
+  /**
+   * @brief If set, the scan returns the values of the scanned column instead of references to the matching rows.
+   */
+  void set_index_only(const bool index_only);
+  bool index_only() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -47,6 +65,12 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  std::shared_ptr<BaseSegment> _scan_chunk_keys(const ChunkID chunk_id);
+  void _scan_table_index(const BaseTableIndex& table_index);
+
+  // Returns the index of the chunk and the (up to two) ranges of it that match the predicate
+  using IndexRange = std::pair<std::vector<ChunkOffset>::const_iterator, std::vector<ChunkOffset>::const_iterator>;
+  std::pair<std::shared_ptr<const BaseIndex>, std::vector<IndexRange>> _matching_ranges(const ChunkID chunk_id);
 
  private:
   const SegmentIndexType _index_type;
@@ -56,6 +80,7 @@ class IndexScan : public AbstractReadOnlyOperator {
   const std::vector<AllTypeVariant> _right_values2;
 
   std::vector<ChunkID> _included_chunk_ids;
+  bool _index_only{false};
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
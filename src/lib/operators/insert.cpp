@@ -1,13 +1,20 @@
 #include "insert.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/logger.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
 #include "type_cast.hpp"
@@ -35,13 +42,7 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
   void resize_vector(std::shared_ptr<BaseSegment> segment, size_t new_size) override {
     auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(segment);
     DebugAssert(value_segment, "Cannot insert into non-ValueColumns");
-    auto& values = value_segment->values();
-
-    values.resize(new_size);
-
-    if (value_segment->is_nullable()) {
-      value_segment->null_values().resize(new_size);
-    }
+    value_segment->grow_to_at_least(new_size);
   }
 
   // this copies
@@ -49,12 +50,14 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
                  std::shared_ptr<BaseSegment> target, ChunkOffset target_start_index, ChunkOffset length) override {
     auto casted_target = std::dynamic_pointer_cast<ValueSegment<T>>(target);
     DebugAssert(casted_target, "Cannot insert into non-ValueColumns");
-    auto& values = casted_target->values();
 
     auto target_is_nullable = casted_target->is_nullable();
 
     if (auto casted_source = std::dynamic_pointer_cast<const ValueSegment<T>>(source)) {
-      std::copy_n(casted_source->values().begin() + source_start_index, length, values.begin() + target_start_index);
+      const auto& source_values = casted_source->values();
+      for (auto i = ChunkOffset{0}; i < length; ++i) {
+        casted_target->set_value(target_start_index + i, source_values[source_start_index + i]);
+      }
 
       if (casted_source->is_nullable()) {
         const auto nulls_begin_iter = casted_source->null_values().begin() + source_start_index;
@@ -78,19 +81,33 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
 
       // Ignore source value and only set null to true
       casted_target->null_values()[target_start_index] = true;
+    } else if (source->data_type() == data_type_from_type<T>()) {
+      // Encoded and reference segments of the same type are read through their iterables, which resolve the
+      // referenced segments without creating an AllTypeVariant for each value
+      segment_with_iterators<T>(*source, [&](auto source_it, const auto source_end) {
+        std::advance(source_it, source_start_index);
+        DebugAssert(static_cast<ChunkOffset>(std::distance(source_it, source_end)) >= length,
+                    "Source segment is too short.");
+        for (auto i = 0u; i < length; ++i, ++source_it) {
+          if (source_it->is_null()) {
+            Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target");
+            casted_target->set_value(target_start_index + i, T{});
+            casted_target->null_values()[target_start_index + i] = true;
+          } else {
+            casted_target->set_value(target_start_index + i, source_it->value());
+          }
+        }
+      });
     } else {
-      // } else if(auto casted_source = std::dynamic_pointer_cast<ReferenceSegment>(source)){
-      // since we have no guarantee that a ReferenceSegment references only a single other segment,
-      // this would require us to find out the referenced segment's type for each single row.
-      // instead, we just use the slow path below.
+      // Values of other types need to be converted, which we do via AllTypeVariants
       for (auto i = 0u; i < length; i++) {
         auto ref_value = (*source)[source_start_index + i];
         if (variant_is_null(ref_value)) {
           Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target");
-          values[target_start_index + i] = T{};
+          casted_target->set_value(target_start_index + i, T{});
           casted_target->null_values()[target_start_index + i] = true;
         } else {
-          values[target_start_index + i] = type_cast_variant<T>(ref_value);
+          casted_target->set_value(target_start_index + i, type_cast_variant<T>(ref_value));
         }
       }
     }
@@ -106,6 +123,7 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   context->register_read_write_operator(std::static_pointer_cast<AbstractReadWriteOperator>(shared_from_this()));
 
   _target_table = StorageManager::get().get_table(_target_table_name);
+  _transaction_id = context->transaction_id();
 
   // These TypedSegmentProcessors kind of retrieve the template parameter of the segments.
   auto typed_segment_processors = std::vector<std::unique_ptr<AbstractTypedSegmentProcessor>>();
@@ -116,114 +134,220 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
   auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
 
-  // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
-  // modifying the table's size simultaneously.
-  auto start_index = 0u;
-  auto start_chunk_id = ChunkID{0};
-  auto end_chunk_id = 0u;
-  {
-    auto scoped_lock = _target_table->acquire_append_mutex();
-
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
+  // The rows of a partitioned table have to go to chunks of their partition, so the input is split by partition first
+  // and each part is inserted through the insertion chunk of its partition. Otherwise, all rows are inserted through
+  // the insertion chunk of the calling thread.
+  struct Source {
+    std::shared_ptr<const Table> table;
+    Table::InsertionChunk& insertion_chunk;
+  };
+  auto sources = std::vector<Source>{};
+  if (const auto& partitioning = _target_table->partitioning()) {
+    const auto input_partitions = _partition_input(*partitioning);
+    for (auto partition_id = PartitionID{0}; partition_id < input_partitions.size(); ++partition_id) {
+      if (input_partitions[partition_id]->empty()) continue;
+      sources.emplace_back(Source{input_partitions[partition_id], _target_table->insertion_chunk(partition_id)});
     }
+  } else {
+    sources.emplace_back(Source{input_table_left(), _target_table->insertion_chunk()});
+  }
 
-    start_chunk_id = _target_table->chunk_count() - 1;
-    end_chunk_id = start_chunk_id + 1;
-    auto last_chunk = _target_table->get_chunk(start_chunk_id);
-    start_index = last_chunk->size();
+  // The rows of each target chunk are filled by a job of their own, see below
+  struct TargetRange {
+    ChunkID target_chunk_id;
+    ChunkOffset target_begin;
+    ChunkOffset length;
+    // Position of the first row to insert in the source table and in the output PosList _inserted_rows
+    const Table* source_table;
+    ChunkID source_chunk_id;
+    ChunkOffset source_begin;
+    size_t input_offset;
+  };
+  auto target_ranges = std::vector<TargetRange>{};
+
+  auto input_offset = size_t{0};
+  for (const auto& source : sources) {
+    const auto first_range_of_source = target_ranges.size();
+
+    // First, allocate space for all the rows to insert, including their MVCC data. Do so while locking the insertion
+    // chunk to prevent multiple threads modifying its size simultaneously. Inserts running on other Workers might use
+    // other insertion chunks and reserve their rows at the same time (see Table::insertion_chunk()).
+    {
+      auto& insertion_chunk = source.insertion_chunk;
+      std::lock_guard<std::mutex> insertion_lock(insertion_chunk.mutex);
+
+      auto remaining_rows = static_cast<uint32_t>(source.table->row_count());
+      while (remaining_rows > 0) {
+        // Full chunks are sealed and replaced with a new one
+        const auto current_chunk_id = _target_table->open_insertion_chunk(insertion_chunk);
+        auto current_chunk = _target_table->get_chunk(current_chunk_id);
+        auto rows_to_insert_this_loop =
+            std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
+
+        // Resize MVCC vectors.
+        current_chunk->get_scoped_mvcc_data_lock()->grow_by(rows_to_insert_this_loop, MvccData::MAX_COMMIT_ID);
+
+        // Resize current chunk to full size.
+        auto old_size = current_chunk->size();
+        for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
+          typed_segment_processors[column_id]->resize_vector(current_chunk->get_segment(column_id),
+                                                             old_size + rows_to_insert_this_loop);
+        }
 
-    // If last chunk is compressed, add a new uncompressed chunk
-    if (!last_chunk->is_mutable()) {
-      _target_table->append_mutable_chunk();
-      end_chunk_id++;
+        target_ranges.emplace_back(TargetRange{current_chunk_id, old_size, rows_to_insert_this_loop,
+                                               source.table.get(), ChunkID{0}, 0u, 0u});
+        remaining_rows -= rows_to_insert_this_loop;
+      }
     }
-
-    auto remaining_rows = total_rows_to_insert;
-    while (remaining_rows > 0) {
-      auto current_chunk = _target_table->get_chunk(static_cast<ChunkID>(_target_table->chunk_count() - 1));
-      auto rows_to_insert_this_loop = std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
-
-      // Resize MVCC vectors.
-      current_chunk->get_scoped_mvcc_data_lock()->grow_by(rows_to_insert_this_loop, MvccData::MAX_COMMIT_ID);
-
-      // Resize current chunk to full size.
-      auto old_size = current_chunk->size();
-      for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
-        typed_segment_processors[column_id]->resize_vector(current_chunk->get_segment(column_id),
-                                                           old_size + rows_to_insert_this_loop);
+    // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
+
+    // Then, assign the rows of the source to the reserved ranges
+    auto source_chunk_id = ChunkID{0};
+    auto source_chunk_start_index = ChunkOffset{0};
+
+    for (auto range_idx = first_range_of_source; range_idx < target_ranges.size(); ++range_idx) {
+      auto& range = target_ranges[range_idx];
+      range.source_chunk_id = source_chunk_id;
+      range.source_begin = source_chunk_start_index;
+      range.input_offset = input_offset;
+
+      // Advance the source position by the rows that this target chunk receives
+      auto rows_to_skip = range.length;
+      while (rows_to_skip > 0) {
+        const auto source_chunk_size = source.table->get_chunk(source_chunk_id)->size();
+        const auto skipped = std::min(source_chunk_size - source_chunk_start_index, rows_to_skip);
+        rows_to_skip -= skipped;
+        source_chunk_start_index += skipped;
+        if (source_chunk_start_index == source_chunk_size) {
+          source_chunk_id++;
+          source_chunk_start_index = 0u;
+        }
       }
 
-      remaining_rows -= rows_to_insert_this_loop;
-
-      // Create new chunk if necessary.
-      if (remaining_rows > 0) {
-        _target_table->append_mutable_chunk();
-        end_chunk_id++;
-      }
+      input_offset += range.length;
     }
   }
-  // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
-  // Then, actually insert the data.
-  auto input_offset = 0u;
-  auto source_chunk_id = ChunkID{0};
-  auto source_chunk_start_index = 0u;
+  // Finally, actually insert the data. The rows are not visible to other transactions yet, so the jobs need no further
+  // synchronization with them. The target chunks are not necessarily adjacent, as Inserts using other insertion
+  // chunks might have appended chunks in between.
+  _inserted_rows.resize(total_rows_to_insert);
 
-  for (auto target_chunk_id = start_chunk_id; target_chunk_id < end_chunk_id; target_chunk_id++) {
-    auto target_chunk = _target_table->get_chunk(target_chunk_id);
+  const auto transaction_id = _transaction_id;
+  const auto insert_range = [&](const TargetRange& range) {
+    const auto target_chunk = _target_table->get_chunk(range.target_chunk_id);
 
-    const auto current_num_rows_to_insert =
-        std::min(target_chunk->size() - start_index, total_rows_to_insert - input_offset);
+    auto target_start_index = range.target_begin;
+    auto still_to_insert = range.length;
+    auto range_source_chunk_id = range.source_chunk_id;
+    auto range_source_begin = range.source_begin;
 
-    auto target_start_index = start_index;
-    auto still_to_insert = current_num_rows_to_insert;
-
-    // while target chunk is not full
-    while (target_start_index != target_chunk->size()) {
-      const auto source_chunk = input_table_left()->get_chunk(source_chunk_id);
-      auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
+    while (still_to_insert > 0) {
+      const auto source_chunk = range.source_table->get_chunk(range_source_chunk_id);
+      const auto num_to_insert = std::min(source_chunk->size() - range_source_begin, still_to_insert);
       for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
         const auto& source_segment = source_chunk->get_segment(column_id);
-        typed_segment_processors[column_id]->copy_data(source_segment, source_chunk_start_index,
+        typed_segment_processors[column_id]->copy_data(source_segment, range_source_begin,
                                                        target_chunk->get_segment(column_id), target_start_index,
                                                        num_to_insert);
       }
       still_to_insert -= num_to_insert;
       target_start_index += num_to_insert;
-      source_chunk_start_index += num_to_insert;
+      range_source_chunk_id++;
+      range_source_begin = 0u;
+    }
 
-      bool source_chunk_depleted = source_chunk_start_index == source_chunk->size();
-      if (source_chunk_depleted) {
-        source_chunk_id++;
-        source_chunk_start_index = 0u;
+    // We do not need to check whether other operators have locked the rows, we have just created them and they are not
+    // visible for other operators. The transaction IDs are set here and not during the resize, because
+    // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
+    // deleted.
+    const auto range_end = range.target_begin + range.length;
+    {
+      auto mvcc_data = target_chunk->get_scoped_mvcc_data_lock();
+      for (auto chunk_offset = range.target_begin; chunk_offset < range_end; ++chunk_offset) {
+        mvcc_data->tids[chunk_offset] = transaction_id;
       }
     }
 
-    for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
-      // we do not need to check whether other operators have locked the rows, we have just created them
-      // and they are not visible for other operators.
-      // the transaction IDs are set here and not during the resize, because
-      // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
-      // deleted.
-      target_chunk->get_scoped_mvcc_data_lock()->tids[i] = context->transaction_id();
-      _inserted_rows.emplace_back(RowID{target_chunk_id, i});
+    for (auto chunk_offset = range.target_begin; chunk_offset < range_end; ++chunk_offset) {
+      _inserted_rows[range.input_offset + chunk_offset - range.target_begin] =
+          RowID{range.target_chunk_id, chunk_offset};
     }
+  };
+
+  if (target_ranges.size() == 1) {
+    insert_range(target_ranges.front());
+  } else {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(target_ranges.size());
+    for (const auto& range : target_ranges) {
+      jobs.emplace_back(std::make_shared<JobTask>([&insert_range, &range]() { insert_range(range); }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  }
 
-    input_offset += current_num_rows_to_insert;
-    start_index = 0u;
+  // The table indexes are not thread-safe and are therefore updated after all data was written
+  for (const auto& range : target_ranges) {
+    _target_table->add_to_table_indexes(range.target_chunk_id, range.target_begin, range.target_begin + range.length);
   }
 
   return nullptr;
 }
 
+std::vector<std::shared_ptr<const Table>> Insert::_partition_input(const TablePartitioning& partitioning) const {
+  const auto input_table = input_table_left();
+  const auto nullable = input_table->columns_are_nullable();
+
+  auto input_partitions = std::vector<std::shared_ptr<Table>>(partitioning.partition_count());
+  for (auto& input_partition : input_partitions) {
+    input_partition = std::make_shared<Table>(input_table->column_definitions(), TableType::Data);
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto segments_per_partition =
+        partitioning.partition_segments(input_table->get_chunk(chunk_id)->segments(), nullable);
+    for (auto partition_id = PartitionID{0}; partition_id < segments_per_partition.size(); ++partition_id) {
+      const auto& segments = segments_per_partition[partition_id];
+      if (segments.front()->size() == 0) continue;
+      input_partitions[partition_id]->append_chunk(segments);
+    }
+  }
+
+  return {input_partitions.cbegin(), input_partitions.cend()};
+}
+
 void Insert::_on_commit_records(const CommitID cid) {
-  for (auto row_id : _inserted_rows) {
-    auto chunk = _target_table->get_chunk(row_id.chunk_id);
+  // The inserted rows of a chunk are adjacent in _inserted_rows, so the MVCC data of each chunk is locked only once
+  auto row_iter = _inserted_rows.cbegin();
+  while (row_iter != _inserted_rows.cend()) {
+    const auto chunk_id = row_iter->chunk_id;
+    auto mvcc_data = _target_table->get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
+
+    for (; row_iter != _inserted_rows.cend() && row_iter->chunk_id == chunk_id; ++row_iter) {
+      mvcc_data->begin_cids[row_iter->chunk_offset] = cid;
+      mvcc_data->tids[row_iter->chunk_offset] = 0u;
+      mvcc_data->register_committed_insert(cid);
+    }
+  }
+  _target_table->register_commit(cid);
+
+  if (Logger::get().is_enabled()) {
+    auto values = std::vector<AllTypeVariant>(_target_table->column_count());
+    for (const auto& row_id : _inserted_rows) {
+      const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+      for (auto column_id = ColumnID{0}; column_id < values.size(); ++column_id) {
+        values[column_id] = (*chunk->get_segment(column_id))[row_id.chunk_offset];
+      }
+      Logger::get().log_insert(_transaction_id, _target_table_name, row_id, values);
+    }
+  }
+}
 
-    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
-    mvcc_data->begin_cids[row_id.chunk_offset] = cid;
-    mvcc_data->tids[row_id.chunk_offset] = 0u;
+void Insert::_finish_commit() {
+  const auto table_statistics = _target_table->table_statistics();
+  if (table_statistics) {
+    table_statistics->increase_row_count(_inserted_rows.size());
   }
 }
 
@@ -232,11 +356,14 @@ void Insert::_on_rollback_records() {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
     // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
     // does not think that this row is still incomplete. We need to make sure that the end is written before the begin.
-    chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = 0u;
+    // Once the begin cid is written, the chunk's MVCC data might be compressed, unless we hold the lock.
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock_for_writing();
+    mvcc_data->end_cids[row_id.chunk_offset] = 0u;
     std::atomic_thread_fence(std::memory_order_release);
-    chunk->get_scoped_mvcc_data_lock()->begin_cids[row_id.chunk_offset] = 0u;
+    mvcc_data->begin_cids[row_id.chunk_offset] = 0u;
 
-    chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset] = 0u;
+    mvcc_data->tids[row_id.chunk_offset] = 0u;
+    mvcc_data->register_invalidation();
   }
 }
 
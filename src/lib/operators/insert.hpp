@@ -10,6 +10,7 @@
 
 namespace opossum {
 
+class TablePartitioning;
 class TransactionContext;
 
 /**
@@ -19,6 +20,8 @@ class TransactionContext;
  *
  * Assumption: The input has been validated before.
  * Note: Insert does not support null values at the moment
+ *
+ * The rows inserted into a partitioned table are written to chunks of their partitions (see TablePartitioning).
  */
 class Insert : public AbstractReadWriteOperator {
  public:
@@ -34,11 +37,16 @@ class Insert : public AbstractReadWriteOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
+  void _finish_commit() override;
   void _on_rollback_records() override;
 
  private:
+  // Splits the input rows by the partition of the target table they belong to, one data table per partition
+  std::vector<std::shared_ptr<const Table>> _partition_input(const TablePartitioning& partitioning) const;
+
   const std::string _target_table_name;
   std::shared_ptr<Table> _target_table;
+  TransactionID _transaction_id{0};
 
   PosList _inserted_rows;
 };
@@ -1,5 +1,7 @@
 #include "jit_operations.hpp"
 
+#include <regex>
+
 namespace opossum {
 
 // Returns the enum value (e.g., DataType::Int, DataType::String) of a data type defined in the DATA_TYPE_INFO sequence
@@ -21,6 +23,16 @@ namespace opossum {
   case JIT_GET_ENUM_VALUE(0, types): \
     return to.set<JIT_GET_DATA_TYPE(0, types)>(from.get<JIT_GET_DATA_TYPE(0, types)>(context), to_index, context);
 
+#define JIT_JOIN_EQUALS_CASE(r, types)                      \
+  case JIT_GET_ENUM_VALUE(0, types):                        \
+    return lhs.get<JIT_GET_DATA_TYPE(0, types)>(context) == \
+           context.join_hashmap.columns[rhs_column_index].get<JIT_GET_DATA_TYPE(0, types)>(rhs_index);
+
+#define JIT_ASSIGN_FROM_JOIN_CASE(r, types)     \
+  case JIT_GET_ENUM_VALUE(0, types):            \
+    return to.set<JIT_GET_DATA_TYPE(0, types)>( \
+        context.join_hashmap.columns[from_column_index].get<JIT_GET_DATA_TYPE(0, types)>(from_index), context);
+
 #define JIT_GROW_BY_ONE_CASE(r, types) \
   case JIT_GET_ENUM_VALUE(0, types):   \
     return context.hashmap.columns[value.column_index()].grow_by_one<JIT_GET_DATA_TYPE(0, types)>(initial_value);
@@ -151,6 +163,36 @@ void jit_assign(const JitTupleValue& from, const JitHashmapValue& to, const size
   }
 }
 
+bool jit_join_equals(const JitTupleValue& lhs, const size_t rhs_column_index, const size_t rhs_index,
+                     JitRuntimeContext& context) {
+  // Rows with NULL keys are neither probed nor inserted into the join_hashmap
+  DebugAssert(!lhs.is_null(context), "NULL values never match in jit_join_equals.");
+
+  switch (lhs.data_type()) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_JOIN_EQUALS_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      Fail("unreachable");
+  }
+}
+
+void jit_assign_from_join(const size_t from_column_index, const size_t from_index, const JitTupleValue& to,
+                          JitRuntimeContext& context) {
+  if (to.is_nullable()) {
+    const bool is_null = context.join_hashmap.columns[from_column_index].is_null(from_index);
+    to.set_is_null(is_null, context);
+    // The value is NULL - our work is done here.
+    if (is_null) {
+      return;
+    }
+  }
+
+  switch (to.data_type()) {
+    BOOST_PP_SEQ_FOR_EACH_PRODUCT(JIT_ASSIGN_FROM_JOIN_CASE, (JIT_DATA_TYPE_INFO))
+    default:
+      break;
+  }
+}
+
 size_t jit_grow_by_one(const JitHashmapValue& value, const JitVariantVector::InitialValue initial_value,
                        JitRuntimeContext& context) {
   switch (value.data_type()) {
@@ -166,6 +208,8 @@ size_t jit_grow_by_one(const JitHashmapValue& value, const JitVariantVector::Ini
 #undef JIT_HASH_CASE
 #undef JIT_AGGREGATE_EQUALS_CASE
 #undef JIT_ASSIGN_CASE
+#undef JIT_JOIN_EQUALS_CASE
+#undef JIT_ASSIGN_FROM_JOIN_CASE
 #undef JIT_GROW_BY_ONE_CASE
 
 }  // namespace opossum
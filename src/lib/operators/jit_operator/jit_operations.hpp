@@ -255,6 +255,15 @@ __attribute__((noinline)) bool jit_aggregate_equals(const JitTupleValue& lhs, co
 __attribute__((noinline)) void jit_assign(const JitTupleValue& from, const JitHashmapValue& to, const size_t to_index,
                                           JitRuntimeContext& context);
 
+// Compares a non-NULL JitTupleValue to a value in a column of the JitRuntimeContext's join_hashmap
+__attribute__((noinline)) bool jit_join_equals(const JitTupleValue& lhs, const size_t rhs_column_index,
+                                               const size_t rhs_index, JitRuntimeContext& context);
+
+// Copies a value from a column of the JitRuntimeContext's join_hashmap to a JitTupleValue. Both values MUST be of the
+// same data type.
+__attribute__((noinline)) void jit_assign_from_join(const size_t from_column_index, const size_t from_index,
+                                                    const JitTupleValue& to, JitRuntimeContext& context);
+
 // Adds an element to a column represented by some JitHashmapValue
 __attribute__((noinline)) size_t jit_grow_by_one(const JitHashmapValue& value,
                                                  const JitVariantVector::InitialValue initial_value,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/preprocessor/seq/for_each.hpp>
+#include <limits>
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
@@ -134,8 +135,14 @@ struct JitRuntimeContext {
   ChunkOffset chunk_offset;
   JitVariantVector tuple;
   std::vector<std::shared_ptr<BaseJitSegmentReader>> inputs;
+  // Readers of the deferred input columns, which are only read by JitReadDeferredColumns (see jit_read_tuples.hpp)
+  std::vector<std::shared_ptr<BaseJitSegmentReader>> deferred_inputs;
   std::vector<std::shared_ptr<BaseJitSegmentWriter>> outputs;
   JitRuntimeHashmap hashmap;
+  // The build side of a JitHashJoinProbe, see jit_hash_join_probe.hpp
+  JitRuntimeHashmap join_hashmap;
+  // Number of tuples a JitLimit still passes on. No further chunks are processed once it reaches zero.
+  size_t limit_row_count{std::numeric_limits<size_t>::max()};
   Segments out_chunk;
 
   // Query transaction data required by JitValidate
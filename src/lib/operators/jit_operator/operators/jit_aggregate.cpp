@@ -218,6 +218,7 @@ void JitAggregate::add_aggregate_column(const std::string& column_name, const Ji
                              JitHashmapValue(DataType::Long, false, _num_hashmap_columns++)});
       break;
     case AggregateFunction::CountDistinct:
+    case AggregateFunction::ApproxCountDistinct:
       Fail("Aggregate function count distinct not supported");
   }
 }
@@ -312,7 +313,8 @@ void JitAggregate::_consume(JitRuntimeContext& context) const {
           jit_grow_by_one(_aggregate_columns[i].hashmap_count_for_avg.value(), JitVariantVector::InitialValue::Zero,
                           context);
           break;
-        case AggregateFunction::CountDistinct: {
+        case AggregateFunction::CountDistinct:
+        case AggregateFunction::ApproxCountDistinct: {
           Fail("Aggregate function count distinct not supported");
         }
       }
@@ -349,7 +351,8 @@ void JitAggregate::_consume(JitRuntimeContext& context) const {
         jit_aggregate_compute(jit_increment, _aggregate_columns[i].tuple_value,
                               _aggregate_columns[i].hashmap_count_for_avg.value(), row_index, context);
         break;
-      case AggregateFunction::CountDistinct: {
+      case AggregateFunction::CountDistinct:
+      case AggregateFunction::ApproxCountDistinct: {
         Fail("Aggregate function count distinct not supported");
       }
     }
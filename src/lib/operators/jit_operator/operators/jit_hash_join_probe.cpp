@@ -0,0 +1,144 @@
+#include "jit_hash_join_probe.hpp"
+
+#include <algorithm>
+
+#include "operators/jit_operator/jit_operations.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace opossum {
+
+std::string JitHashJoinProbe::description() const {
+  std::stringstream desc;
+  desc << "[HashJoinProbe] Keys: ";
+  for (const auto& key_column : _key_columns) {
+    desc << "x" << key_column.probe_value.tuple_index() << " = BuildColumn#" << key_column.build_column_id << ", ";
+  }
+  desc << " Build columns: ";
+  for (const auto& build_column : _build_columns) {
+    desc << "x" << build_column.tuple_value.tuple_index() << " = BuildColumn#" << build_column.column_id << ", ";
+  }
+  return desc.str();
+}
+
+void JitHashJoinProbe::before_query(const Table& build_table, JitRuntimeContext& context) const {
+  const auto num_key_columns = _key_columns.size();
+  const auto row_count = build_table.row_count();
+
+  // The columns of the hashmap are the key columns, followed by the build columns
+  auto& hashmap = context.join_hashmap;
+  hashmap.indices.clear();
+  hashmap.columns.clear();
+  hashmap.columns.resize(num_key_columns + _build_columns.size());
+
+  const auto materialize_column = [&](const ColumnID column_id, JitVariantVector& column) {
+    resolve_data_type(build_table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto& values = column.get_vector<ColumnDataType>();
+      auto& null_values = column.get_is_null_vector();
+      values.reserve(row_count);
+      null_values.reserve(row_count);
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < build_table.chunk_count(); ++chunk_id) {
+        const auto& segment = *build_table.get_chunk(chunk_id)->get_segment(column_id);
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          values.emplace_back(position.is_null() ? ColumnDataType{} : position.value());
+          null_values.emplace_back(position.is_null());
+        });
+      }
+    });
+  };
+
+  for (auto i = size_t{0}; i < num_key_columns; ++i) {
+    const auto& key_column = _key_columns[i];
+    DebugAssert(build_table.column_data_type(key_column.build_column_id) == key_column.probe_value.data_type(),
+                "Data types of join keys don't match.");
+    materialize_column(key_column.build_column_id, hashmap.columns[i]);
+  }
+  for (auto i = size_t{0}; i < _build_columns.size(); ++i) {
+    materialize_column(_build_columns[i].column_id, hashmap.columns[num_key_columns + i]);
+  }
+
+  // Hash the keys of each build row the same way jit_hash is combined in _consume
+  auto hash_values = std::vector<uint64_t>(row_count, 0);
+  auto has_null_key = std::vector<bool>(row_count, false);
+  for (auto i = size_t{0}; i < num_key_columns; ++i) {
+    resolve_data_type(_key_columns[i].probe_value.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      const auto& values = hashmap.columns[i].get_vector<ColumnDataType>();
+      const auto& null_values = hashmap.columns[i].get_is_null_vector();
+      for (auto row = size_t{0}; row < row_count; ++row) {
+        if (null_values[row]) {
+          has_null_key[row] = true;
+        } else {
+          hash_values[row] = (hash_values[row] << 5u) ^ std::hash<ColumnDataType>()(values[row]);
+        }
+      }
+    });
+  }
+
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    if (!has_null_key[row]) hashmap.indices[hash_values[row]].push_back(row);
+  }
+}
+
+void JitHashJoinProbe::add_key_column(const JitTupleValue& probe_value, const ColumnID build_column_id) {
+  _key_columns.push_back({probe_value, build_column_id});
+}
+
+JitTupleValue JitHashJoinProbe::add_build_column(const ColumnID column_id, const JitTupleValue& tuple_value) {
+  if (const auto existing_tuple_value = find_build_column(column_id)) return *existing_tuple_value;
+
+  _build_columns.push_back({column_id, tuple_value});
+  return tuple_value;
+}
+
+std::optional<JitTupleValue> JitHashJoinProbe::find_build_column(const ColumnID column_id) const {
+  const auto it = std::find_if(_build_columns.begin(), _build_columns.end(),
+                               [&column_id](const auto& build_column) { return build_column.column_id == column_id; });
+  if (it == _build_columns.end()) return std::nullopt;
+  return it->tuple_value;
+}
+
+const std::vector<JitHashJoinKeyColumn> JitHashJoinProbe::key_columns() const { return _key_columns; }
+
+const std::vector<JitHashJoinBuildColumn> JitHashJoinProbe::build_columns() const { return _build_columns; }
+
+void JitHashJoinProbe::_consume(JitRuntimeContext& context) const {
+  // We use index-based for loops in this function, since the LLVM optimizer is not able to properly unroll range-based
+  // loops, and we need the unrolling for proper specialization.
+
+  const auto num_key_columns = _key_columns.size();
+  const auto num_build_columns = _build_columns.size();
+
+  // Step 1: Compute the hash value of the probe values. NULL values never find a join partner.
+  uint64_t hash_value = 0;
+  for (uint32_t i = 0; i < num_key_columns; ++i) {
+    if (_key_columns[i].probe_value.is_null(context)) return;
+    hash_value = (hash_value << 5u) ^ jit_hash(_key_columns[i].probe_value, context);
+  }
+
+  // Step 2: Look up the build rows with this hash in the hashmap.
+  const auto hash_bucket = context.join_hashmap.indices.find(hash_value);
+  if (hash_bucket == context.join_hashmap.indices.end()) return;
+
+  // Step 3: Emit the tuple once for each build row that matches on all keys. Unless there is a hash collision, all
+  // rows in the bucket match.
+  for (const auto& index : hash_bucket->second) {
+    bool all_values_equal = true;
+    for (uint32_t i = 0; i < num_key_columns; ++i) {
+      if (!jit_join_equals(_key_columns[i].probe_value, i, index, context)) {
+        all_values_equal = false;
+        break;
+      }
+    }
+    if (!all_values_equal) continue;
+
+    for (uint32_t i = 0; i < num_build_columns; ++i) {
+      jit_assign_from_join(num_key_columns + i, index, _build_columns[i].tuple_value, context);
+    }
+    _emit(context);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "abstract_jittable.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// A pair of join keys: The probe_value is compared to the values of the build_column_id in the build table.
+struct JitHashJoinKeyColumn {
+  JitTupleValue probe_value;
+  ColumnID build_column_id;
+};
+
+// A column of the build table that later operators of the chain read. The value of the matching build row is copied
+// to the tuple_value before the tuple is emitted.
+struct JitHashJoinBuildColumn {
+  ColumnID column_id;
+  JitTupleValue tuple_value;
+};
+
+/* The JitHashJoinProbe operator performs the probe phase of an inner equi hash join within an operator chain. This
+ * allows pipelines to continue through a join (e.g., scan -> probe -> aggregate) instead of materializing the probe
+ * side into an intermediate table.
+ *
+ * The build side is the right input table of the JitOperatorWrapper. Before the query is executed, the operator
+ * materializes the key columns and the build columns of that table and builds a hashmap from the hash of the keys to
+ * the build rows (see before_query). Build rows with a NULL key never find a join partner and are not inserted.
+ * The hashmap is stored in the JitRuntimeContext, so the operator itself remains immutable during query execution.
+ *
+ * Each consumed tuple is processed in the following way:
+ * - A hash across all probe values is computed in the same way as for the build rows.
+ * - All build rows with this hash are compared to the probe values.
+ * - For each matching build row, the build columns are copied to the runtime tuple and the tuple is emitted.
+ */
+class JitHashJoinProbe : public AbstractJittable {
+ public:
+  std::string description() const final;
+
+  // Is called by the JitOperatorWrapper before any tuple is consumed and builds the hashmap from the build table.
+  void before_query(const Table& build_table, JitRuntimeContext& context) const;
+
+  // Adds a pair of join keys. The probe value and the build column MUST be of the same data type.
+  void add_key_column(const JitTupleValue& probe_value, const ColumnID build_column_id);
+
+  // Adds a build column that is copied to the tuple_value for each join partner. Returns the previously added tuple
+  // value if the column has already been added.
+  JitTupleValue add_build_column(const ColumnID column_id, const JitTupleValue& tuple_value);
+
+  std::optional<JitTupleValue> find_build_column(const ColumnID column_id) const;
+
+  const std::vector<JitHashJoinKeyColumn> key_columns() const;
+  const std::vector<JitHashJoinBuildColumn> build_columns() const;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+
+  std::vector<JitHashJoinKeyColumn> _key_columns;
+  std::vector<JitHashJoinBuildColumn> _build_columns;
+};
+
+}  // namespace opossum
@@ -0,0 +1,23 @@
+#include "jit_limit.hpp"
+
+namespace opossum {
+
+JitLimit::JitLimit(const size_t row_count) : _row_count{row_count} {}
+
+std::string JitLimit::description() const { return "[Limit] to " + std::to_string(_row_count) + " rows"; }
+
+size_t JitLimit::row_count() const { return _row_count; }
+
+void JitLimit::before_query(JitRuntimeContext& context) const { context.limit_row_count = _row_count; }
+
+void JitLimit::_consume(JitRuntimeContext& context) const {
+  if (context.limit_row_count == 0) return;
+
+  --context.limit_row_count;
+  _emit(context);
+
+  // Shortening the chunk ends the read loop without an additional check per row
+  if (context.limit_row_count == 0) context.chunk_size = context.chunk_offset + 1;
+}
+
+}  // namespace opossum
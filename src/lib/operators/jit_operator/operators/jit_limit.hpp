@@ -0,0 +1,27 @@
+#pragma once
+
+#include "abstract_jittable.hpp"
+
+namespace opossum {
+
+/* The JitLimit operator passes on the first row_count tuples that reach it. Once the limit is reached, it ends the
+ * loop of the JitReadTuples operator over the current chunk, and the JitOperatorWrapper does not process the remaining
+ * chunks. The remaining number of tuples is kept in the runtime context and initialized by before_query().
+ */
+class JitLimit : public AbstractJittable {
+ public:
+  explicit JitLimit(const size_t row_count);
+
+  std::string description() const final;
+
+  size_t row_count() const;
+
+  void before_query(JitRuntimeContext& context) const;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+
+  const size_t _row_count;
+};
+
+}  // namespace opossum
@@ -0,0 +1,16 @@
+#include "jit_read_deferred_columns.hpp"
+
+#include "jit_read_tuples.hpp"
+
+namespace opossum {
+
+std::string JitReadDeferredColumns::description() const { return "[ReadDeferredColumns]"; }
+
+void JitReadDeferredColumns::_consume(JitRuntimeContext& context) const {
+  for (const auto& input : context.deferred_inputs) {
+    input->read_value(context);
+  }
+  _emit(context);
+}
+
+}  // namespace opossum
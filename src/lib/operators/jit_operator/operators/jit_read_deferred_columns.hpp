@@ -0,0 +1,19 @@
+#pragma once
+
+#include "abstract_jittable.hpp"
+
+namespace opossum {
+
+/* The JitReadDeferredColumns operator reads the values of the deferred input columns of the JitReadTuples operator
+ * (see jit_read_tuples.hpp) for the current row. It is placed after the last filtering operator of a chain, so that
+ * the columns that are only needed by the subsequent operators are read (e.g., decoded) for the qualifying rows only.
+ */
+class JitReadDeferredColumns : public AbstractJittable {
+ public:
+  std::string description() const final;
+
+ private:
+  void _consume(JitRuntimeContext& context) const final;
+};
+
+}  // namespace opossum
@@ -12,7 +12,8 @@ std::string JitReadTuples::description() const {
   std::stringstream desc;
   desc << "[ReadTuple] ";
   for (const auto& input_column : _input_columns) {
-    desc << "x" << input_column.tuple_value.tuple_index() << " = Column#" << input_column.column_id << ", ";
+    desc << "x" << input_column.tuple_value.tuple_index() << " = Column#" << input_column.column_id
+         << (input_column.is_deferred ? " (deferred)" : "") << ", ";
   }
   for (const auto& input_literal : _input_literals) {
     desc << "x" << input_literal.tuple_value.tuple_index() << " = " << input_literal.value << ", ";
@@ -44,21 +45,22 @@ void JitReadTuples::before_query(const Table& in_table, JitRuntimeContext& conte
 
 void JitReadTuples::before_chunk(const Table& in_table, const Chunk& in_chunk, JitRuntimeContext& context) const {
   context.inputs.clear();
+  context.deferred_inputs.clear();
   context.chunk_offset = 0;
   context.chunk_size = in_chunk.size();
 
   if (_has_validate) {
     if (in_chunk.has_mvcc_data()) {
-      // materialize atomic transaction ids as specialization cannot handle atomics
-      context.row_tids.resize(in_chunk.mvcc_data()->tids.size());
-      auto itr = context.row_tids.begin();
-      for (const auto& tid : in_chunk.mvcc_data()->tids) {
-        *itr++ = tid.load();
-      }
       // Lock MVCC data before accessing it.
       context.mvcc_data_lock =
           std::make_unique<SharedScopedLockingPtr<const MvccData>>(in_chunk.get_scoped_mvcc_data_lock());
       context.mvcc_data = in_chunk.mvcc_data();
+
+      // materialize atomic transaction ids as specialization cannot handle atomics
+      context.row_tids.resize(context.mvcc_data->size());
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < context.row_tids.size(); ++chunk_offset) {
+        context.row_tids[chunk_offset] = context.mvcc_data->tid(chunk_offset);
+      }
     } else {
       DebugAssert(in_chunk.references_exactly_one_table(),
                   "Input to Validate contains a Chunk referencing more than one table.");
@@ -74,7 +76,19 @@ void JitReadTuples::before_chunk(const Table& in_table, const Chunk& in_chunk, J
     const auto segment = in_chunk.get_segment(column_id);
     const auto is_nullable = in_table.column_is_nullable(column_id);
 
-    if (is_nullable) {
+    if (input_column.is_deferred) {
+      resolve_data_type(in_table.column_data_type(column_id), [&](auto type) {
+        using Type = typename decltype(type)::type;
+        auto accessor = create_segment_accessor<Type>(segment);
+        if (is_nullable) {
+          context.deferred_inputs.push_back(
+              std::make_shared<JitSegmentAccessorReader<Type, true>>(std::move(accessor), input_column.tuple_value));
+        } else {
+          context.deferred_inputs.push_back(
+              std::make_shared<JitSegmentAccessorReader<Type, false>>(std::move(accessor), input_column.tuple_value));
+        }
+      });
+    } else if (is_nullable) {
       segment_with_iterators(*segment, [&](auto it, const auto end) {
         using IteratorType = decltype(it);
         using Type = typename IteratorType::ValueType;
@@ -118,6 +132,13 @@ JitTupleValue JitReadTuples::add_input_column(const DataType data_type, const bo
   return tuple_value;
 }
 
+void JitReadTuples::defer_input_column(const ColumnID column_id) {
+  const auto it = std::find_if(_input_columns.begin(), _input_columns.end(),
+                               [&column_id](const auto& input_column) { return input_column.column_id == column_id; });
+  DebugAssert(it != _input_columns.end(), "Cannot defer an unknown input column");
+  it->is_deferred = true;
+}
+
 JitTupleValue JitReadTuples::add_literal_value(const AllTypeVariant& value) {
   // Somebody needs a literal value. We assign it a position in the runtime tuple and store the literal value,
   // so we can initialize the corresponding tuple value to the correct literal value later.
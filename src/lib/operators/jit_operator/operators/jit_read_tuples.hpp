@@ -3,6 +3,7 @@
 #include "../jit_types.hpp"
 #include "abstract_jittable.hpp"
 #include "storage/chunk.hpp"
+#include "storage/segment_accessor.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -20,6 +21,8 @@ class BaseJitSegmentReader {
 struct JitInputColumn {
   ColumnID column_id;
   JitTupleValue tuple_value;
+  // Deferred input columns are not read for every row, but only by a JitReadDeferredColumns operator
+  bool is_deferred{false};
 };
 
 struct JitInputLiteral {
@@ -32,7 +35,9 @@ struct JitInputLiteral {
  * 1) storing literal values to the runtime tuple before the query is executed
  * 2) reading data from the the input table to the runtime tuple
  * 3) advancing the segment iterators
- * 4) keeping track of the number of values in the runtime tuple. Whenever
+ * 4) creating random-access readers for the deferred input columns, which are only read for the rows that reach a
+ *    JitReadDeferredColumns operator
+ * 5) keeping track of the number of values in the runtime tuple. Whenever
  *    another operator needs to store a temporary value in the runtime tuple,
  *    it can request a slot in the tuple from JitReadTuples.
  */
@@ -84,6 +89,36 @@ class JitReadTuples : public AbstractJittable {
     JitTupleValue _tuple_value;
   };
 
+  /* JitSegmentAccessorReaders read the values of deferred input columns. Instead of iterating over the segment, they
+   * access the value at the current chunk offset, so that rows that were discarded before are never read (e.g., not
+   * decoded from a dictionary).
+   */
+  template <typename DataType, bool Nullable>
+  class JitSegmentAccessorReader : public BaseJitSegmentReader {
+   public:
+    JitSegmentAccessorReader(std::unique_ptr<BaseSegmentAccessor<DataType>> accessor, const JitTupleValue& tuple_value)
+        : _accessor{std::move(accessor)}, _tuple_value{tuple_value} {}
+
+    // Reads the value at the current chunk offset into the _tuple_value.
+    void read_value(JitRuntimeContext& context) {
+      const auto value = _accessor->access(context.chunk_offset);
+      // clang-format off
+      if constexpr (Nullable) {
+        context.tuple.set_is_null(_tuple_value.tuple_index(), !value);
+        if (value) {
+          context.tuple.set<DataType>(_tuple_value.tuple_index(), *value);
+        }
+      } else {
+        context.tuple.set<DataType>(_tuple_value.tuple_index(), *value);
+      }
+      // clang-format on
+    }
+
+   private:
+    std::unique_ptr<BaseSegmentAccessor<DataType>> _accessor;
+    JitTupleValue _tuple_value;
+  };
+
  public:
   explicit JitReadTuples(const bool has_validate = false);
 
@@ -94,6 +129,8 @@ class JitReadTuples : public AbstractJittable {
 
   JitTupleValue add_input_column(const DataType data_type, const bool is_nullable, const ColumnID column_id);
   JitTupleValue add_literal_value(const AllTypeVariant& value);
+  // Marks the input column as deferred, see JitReadDeferredColumns
+  void defer_input_column(const ColumnID column_id);
   size_t add_temporary_value();
 
   std::vector<JitInputColumn> input_columns() const;
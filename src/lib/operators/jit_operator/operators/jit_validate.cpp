@@ -9,8 +9,8 @@ namespace {
 
 bool is_row_visible(const CommitID our_tid, const TransactionID row_tid, const CommitID snapshot_commit_id,
                     const ChunkOffset chunk_offset, const MvccData& mvcc_data) {
-  const auto begin_cid = mvcc_data.begin_cids[chunk_offset];
-  const auto end_cid = mvcc_data.end_cids[chunk_offset];
+  const auto begin_cid = mvcc_data.begin_cid(chunk_offset);
+  const auto end_cid = mvcc_data.end_cid(chunk_offset);
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
@@ -27,7 +27,8 @@ void JitValidate::_consume(JitRuntimeContext& context) const {
     const auto row_id = (*context.pos_list)[context.chunk_offset];
     const auto& referenced_chunk = context.referenced_table->get_chunk(row_id.chunk_id);
     const auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
-    const auto row_tid = _load_atomic_value(mvcc_data->tids[row_id.chunk_offset]);
+    const auto row_tid = mvcc_data->is_compressed() ? mvcc_data->tid(row_id.chunk_offset)
+                                                    : _load_atomic_value(mvcc_data->tids[row_id.chunk_offset]);
     if (is_row_visible(context.transaction_id, row_tid, context.snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
       _emit(context);
     }
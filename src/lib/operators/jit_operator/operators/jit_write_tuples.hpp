@@ -46,10 +46,13 @@ class JitWriteTuples : public AbstractJittableSink {
 
     // Reads the value from the _tuple_value and appends it to the output ValueSegment.
     void write_value(JitRuntimeContext& context) const {
-      _segment->values().push_back(context.tuple.get<DataType>(_tuple_value.tuple_index()));
+      const auto value = context.tuple.get<DataType>(_tuple_value.tuple_index());
       // clang-format off
       if constexpr (Nullable) {
-        _segment->null_values().push_back(context.tuple.is_null(_tuple_value.tuple_index()));
+        const auto is_null = context.tuple.is_null(_tuple_value.tuple_index());
+        _segment->append_values(&value, &value + 1, &is_null);
+      } else {
+        _segment->append_values(&value, &value + 1);
       }
       // clang-format on
     }
@@ -5,13 +5,15 @@
 #include <llvm/IRReader/IRReader.h>
 #include <llvm/Passes/PassBuilder.h>
 
+#include "jit_object_cache.hpp"
+
 namespace opossum {
 
 JitCompiler::JitCompiler()
     : _target_machine{llvm::EngineBuilder().selectTarget()},
       _data_layout{_target_machine->createDataLayout()},
       _object_layer{[]() { return std::make_shared<llvm::SectionMemoryManager>(); }},
-      _compile_layer{_object_layer, llvm::orc::SimpleCompiler(*_target_machine)},
+      _compile_layer{_object_layer, llvm::orc::SimpleCompiler(*_target_machine, &JitObjectCache::get())},
       _cxx_runtime_overrides{[this](const std::string& symbol) { return _mangle(symbol); }} {
   // Make exported symbols of the current process available to the JIT
   llvm::sys::DynamicLibrary::LoadLibraryPermanently(nullptr);
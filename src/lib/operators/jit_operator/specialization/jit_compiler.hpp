@@ -21,7 +21,8 @@ namespace opossum {
  * outside the JitCompiler.
  * The interface of the JitCompiler is rather simple: Modules (LLVM's compilation unit) can be added and removed from
  * the compiler; the compiler takes ownership of all modules.
- * When a module is added to the compiler, it is immediately compiled to machine code.
+ * When a module is added to the compiler, it is immediately compiled to machine code. The machine code is taken from
+ * the JitObjectCache instead if it has been compiled before, possibly by an earlier process.
  * This machine code can be accessed for a symbol defined by a module by passing the MANGLED! name of the symbol to the
  * find_symbol function.
  * By providing the correct template parameters, the function returns a properly-typed function pointer that can be
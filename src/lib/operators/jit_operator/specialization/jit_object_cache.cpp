@@ -0,0 +1,98 @@
+#include "jit_object_cache.hpp"
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+JitObjectCache::JitObjectCache() {
+  auto host_features = llvm::StringMap<bool>{};
+  llvm::sys::getHostCPUFeatures(host_features);
+
+  // StringMap does not have a deterministic iteration order
+  auto enabled_features = std::vector<std::string>{};
+  for (const auto& feature : host_features) {
+    if (feature.second) enabled_features.emplace_back(feature.first());
+  }
+  std::sort(enabled_features.begin(), enabled_features.end());
+
+  _target_key = llvm::sys::getProcessTriple() + ";" + llvm::sys::getHostCPUName().str();
+  for (const auto& feature : enabled_features) {
+    _target_key += ";" + feature;
+  }
+}
+
+void JitObjectCache::set_directory(const std::string& directory) {
+  if (!directory.empty()) filesystem::create_directories(directory);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _directory = directory;
+}
+
+std::string JitObjectCache::directory() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _directory;
+}
+
+void JitObjectCache::notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef object) {
+  const auto path = _object_path(*module);
+  if (path.empty()) return;
+
+  std::stringstream temporary_path;
+  temporary_path << path << ".tmp" << std::this_thread::get_id();
+
+  {
+    std::ofstream file(temporary_path.str(), std::ios::binary);
+    file.write(object.getBufferStart(), object.getBufferSize());
+    if (!file) return;
+  }
+
+  // The cache is only an optimization, so failing to store an object is not an error
+  auto error_code = std::error_code{};
+  filesystem::rename(temporary_path.str(), path, error_code);
+  if (error_code) filesystem::remove(temporary_path.str(), error_code);
+}
+
+std::unique_ptr<llvm::MemoryBuffer> JitObjectCache::getObject(const llvm::Module* module) {
+  const auto path = _object_path(*module);
+  if (path.empty()) return nullptr;
+
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return nullptr;
+
+  std::stringstream contents;
+  contents << file.rdbuf();
+  if (contents.str().empty()) return nullptr;
+
+  return llvm::MemoryBuffer::getMemBufferCopy(contents.str(), path);
+}
+
+std::string JitObjectCache::_object_path(const llvm::Module& module) const {
+  const auto directory = this->directory();
+  if (directory.empty()) return "";
+
+  std::string module_ir;
+  llvm::raw_string_ostream module_ir_stream(module_ir);
+  module.print(module_ir_stream, nullptr);
+  module_ir_stream.flush();
+
+  llvm::SHA1 hasher;
+  hasher.update(_target_key);
+  hasher.update(module_ir);
+
+  return (filesystem::path{directory} / (llvm::toHex(hasher.final()) + ".o")).string();
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/IR/Module.h>
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/* The JitObjectCache stores the machine code of compiled LLVM modules in a directory, so that a module is compiled to
+ * machine code only once per deployment instead of once per process.
+ * Objects are identified by a hash of the module's IR and the host's target triple, CPU and CPU features. A module
+ * that differs in any specialized value therefore never loads a wrong object, and objects compiled on a different
+ * machine are ignored.
+ * The cache is disabled until a directory is set. Objects are written to a temporary file first and then renamed, so
+ * that multiple processes can share the directory.
+ */
+class JitObjectCache : public llvm::ObjectCache, public Singleton<JitObjectCache> {
+ public:
+  // Enables the cache with the given directory, which is created if it does not exist. An empty path disables it.
+  void set_directory(const std::string& directory);
+  std::string directory() const;
+
+  // Called by LLVM after a module has been compiled to machine code
+  void notifyObjectCompiled(const llvm::Module* module, llvm::MemoryBufferRef object) override;
+
+  // Called by LLVM before a module is compiled. Returns nullptr if the object is not cached.
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+ private:
+  JitObjectCache();
+
+  friend class Singleton;
+
+  std::string _object_path(const llvm::Module& module) const;
+
+  // Identifies the host the objects are compiled for
+  std::string _target_key;
+
+  mutable std::mutex _mutex;
+  std::string _directory;
+};
+
+}  // namespace opossum
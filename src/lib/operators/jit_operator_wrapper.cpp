@@ -1,16 +1,23 @@
 #include "jit_operator_wrapper.hpp"
 
+#include <chrono>
+
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+#include "operators/jit_operator/operators/jit_limit.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
+#include "scheduler/job_task.hpp"
 
 namespace opossum {
 
 JitOperatorWrapper::JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
                                        const JitExecutionMode execution_mode,
-                                       const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators)
-    : AbstractReadOnlyOperator{OperatorType::JitOperatorWrapper, left},
+                                       const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators,
+                                       const std::shared_ptr<const AbstractOperator>& right)
+    : AbstractReadOnlyOperator{OperatorType::JitOperatorWrapper, left, right},
       _execution_mode{execution_mode},
-      _jit_operators{jit_operators} {}
+      _jit_operators{jit_operators},
+      _compiled_pipeline{std::make_shared<CompiledPipeline>()} {}
 
 const std::string JitOperatorWrapper::name() const { return "JitOperatorWrapper"; }
 
@@ -24,7 +31,11 @@ const std::string JitOperatorWrapper::description(DescriptionMode description_mo
   return desc.str();
 }
 
-void JitOperatorWrapper::add_jit_operator(const std::shared_ptr<AbstractJittable>& op) { _jit_operators.push_back(op); }
+void JitOperatorWrapper::add_jit_operator(const std::shared_ptr<AbstractJittable>& op) {
+  _jit_operators.push_back(op);
+  // Code compiled for the previous pipeline does not fit anymore
+  _compiled_pipeline = std::make_shared<CompiledPipeline>();
+}
 
 const std::vector<std::shared_ptr<AbstractJittable>>& JitOperatorWrapper::jit_operators() const {
   return _jit_operators;
@@ -58,6 +69,11 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
   for (auto& jit_operator : _jit_operators) {
     if (auto jit_validate = std::dynamic_pointer_cast<JitValidate>(jit_operator)) {
       jit_validate->set_input_table_type(in_table.type());
+    } else if (auto jit_hash_join_probe = std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operator)) {
+      Assert(input_right(), "JitHashJoinProbe requires the build side as right input.");
+      jit_hash_join_probe->before_query(*input_right()->get_output(), context);
+    } else if (auto jit_limit = std::dynamic_pointer_cast<JitLimit>(jit_operator)) {
+      jit_limit->before_query(context);
     }
   }
 
@@ -66,23 +82,19 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
     (*it)->set_next_operator(*(it + 1));
   }
 
-  std::function<void(const JitReadTuples*, JitRuntimeContext&)> execute_func;
-  // We want to perform two specialization passes if the operator chain contains a JitAggregate operator, since the
-  // JitAggregate operator contains multiple loops that need unrolling.
-  auto two_specialization_passes = static_cast<bool>(std::dynamic_pointer_cast<JitAggregate>(_sink()));
-  switch (_execution_mode) {
-    case JitExecutionMode::Compile:
-      // this corresponds to "opossum::JitReadTuples::execute(opossum::JitRuntimeContext&) const"
-      execute_func = _module.specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
-          "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
-          std::make_shared<JitConstantRuntimePointer>(_source().get()), two_specialization_passes);
-      break;
-    case JitExecutionMode::Interpret:
-      execute_func = &JitReadTuples::execute;
-      break;
-  }
+  // Chunks are interpreted until the compiled function is ready
+  ExecuteFunction execute_func = &JitReadTuples::execute;
+  auto compiled_execute_func = std::shared_future<ExecuteFunction>{};
+  if (_execution_mode == JitExecutionMode::Compile) compiled_execute_func = _compile_in_background();
+
+  // A JitLimit stops the execution once it has passed on enough tuples
+  for (opossum::ChunkID chunk_id{0}; chunk_id < in_table.chunk_count() && context.limit_row_count > 0; ++chunk_id) {
+    if (compiled_execute_func.valid() &&
+        compiled_execute_func.wait_for(std::chrono::seconds{0}) == std::future_status::ready) {
+      execute_func = compiled_execute_func.get();
+      compiled_execute_func = {};
+    }
 
-  for (opossum::ChunkID chunk_id{0}; chunk_id < in_table.chunk_count(); ++chunk_id) {
     const auto& in_chunk = *in_table.get_chunk(chunk_id);
     _source()->before_chunk(in_table, in_chunk, context);
     execute_func(_source().get(), context);
@@ -94,10 +106,42 @@ std::shared_ptr<const Table> JitOperatorWrapper::_on_execute() {
   return out_table;
 }
 
+std::shared_future<JitOperatorWrapper::ExecuteFunction> JitOperatorWrapper::_compile_in_background() {
+  std::lock_guard<std::mutex> lock(_compiled_pipeline->mutex);
+  if (_compiled_pipeline->execute_function.valid()) return _compiled_pipeline->execute_function;
+
+  auto promise = std::make_shared<std::promise<ExecuteFunction>>();
+  _compiled_pipeline->execute_function = promise->get_future().share();
+
+  // We want to perform two specialization passes if the operator chain contains a JitAggregate operator, since the
+  // JitAggregate operator contains multiple loops that need unrolling.
+  const auto two_specialization_passes = static_cast<bool>(std::dynamic_pointer_cast<JitAggregate>(_sink()));
+
+  // The task keeps the operators and the compiled code alive, even if the query finishes first
+  const auto task = std::make_shared<JobTask>(
+      [promise, compiled_pipeline = _compiled_pipeline, source = _source(), two_specialization_passes]() {
+        try {
+          // this corresponds to "opossum::JitReadTuples::execute(opossum::JitRuntimeContext&) const"
+          promise->set_value(
+              compiled_pipeline->module.specialize_and_compile_function<void(const JitReadTuples*, JitRuntimeContext&)>(
+                  "_ZNK7opossum13JitReadTuples7executeERNS_17JitRuntimeContextE",
+                  std::make_shared<JitConstantRuntimePointer>(source.get()), two_specialization_passes));
+        } catch (...) {
+          promise->set_exception(std::current_exception());
+        }
+      });
+  task->schedule();
+
+  return _compiled_pipeline->execute_function;
+}
+
 std::shared_ptr<AbstractOperator> JitOperatorWrapper::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JitOperatorWrapper>(copied_input_left, _execution_mode, _jit_operators);
+  const auto copy =
+      std::make_shared<JitOperatorWrapper>(copied_input_left, _execution_mode, _jit_operators, copied_input_right);
+  copy->_compiled_pipeline = _compiled_pipeline;
+  return copy;
 }
 
 void JitOperatorWrapper::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <future>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 #include "jit_operator/operators/abstract_jittable_sink.hpp"
@@ -17,12 +22,19 @@ enum class JitExecutionMode { Interpret, Compile };
  * The JitOperatorWrapper is responsible for chaining the operators it contains, compiling code for the operators at
  * runtime, creating and managing the runtime context and calling hooks (before/after processing a chunk or the entire
  * query) on the its operators.
+ * The optional right input is the build side of a JitHashJoinProbe in the pipeline.
+ * In JitExecutionMode::Compile, the code is specialized and compiled by a background task. Chunks are interpreted
+ * until the compiled function is ready. Deep copies of the wrapper (e.g., of cached plans) share the jit operators
+ * the code is specialized for, so they also share the compiled function.
  */
 class JitOperatorWrapper : public AbstractReadOnlyOperator {
+  friend class JitOperatorWrapperTest;
+
  public:
   explicit JitOperatorWrapper(const std::shared_ptr<const AbstractOperator>& left,
                               const JitExecutionMode execution_mode = JitExecutionMode::Compile,
-                              const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators = {});
+                              const std::vector<std::shared_ptr<AbstractJittable>>& jit_operators = {},
+                              const std::shared_ptr<const AbstractOperator>& right = nullptr);
 
   const std::string name() const final;
   const std::string description(DescriptionMode description_mode) const final;
@@ -45,9 +57,21 @@ class JitOperatorWrapper : public AbstractReadOnlyOperator {
   const std::shared_ptr<JitReadTuples> _source() const;
   const std::shared_ptr<AbstractJittableSink> _sink() const;
 
+  using ExecuteFunction = std::function<void(const JitReadTuples*, JitRuntimeContext&)>;
+
+  struct CompiledPipeline {
+    std::mutex mutex;
+    JitCodeSpecializer module;
+    // Invalid until the compilation is started
+    std::shared_future<ExecuteFunction> execute_function;
+  };
+
+  // Starts the compilation of the pipeline in a background task, unless that already happened
+  std::shared_future<ExecuteFunction> _compile_in_background();
+
   const JitExecutionMode _execution_mode;
-  JitCodeSpecializer _module;
   std::vector<std::shared_ptr<AbstractJittable>> _jit_operators;
+  std::shared_ptr<CompiledPipeline> _compiled_pipeline;
 };
 
 }  // namespace opossum
@@ -0,0 +1,142 @@
+#include "join_adaptive.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "join_hash.hpp"
+#include "join_index.hpp"
+#include "join_nested_loop.hpp"
+#include "join_sort_merge.hpp"
+#include "resolve_type.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+JoinAdaptive::JoinAdaptive(const std::shared_ptr<const AbstractOperator>& left,
+                           const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                           const ColumnIDPair& column_ids, const PredicateCondition predicate_condition)
+    : AbstractJoinOperator(OperatorType::JoinAdaptive, left, right, mode, column_ids, predicate_condition) {
+  DebugAssert(mode != JoinMode::Cross, "Cross Join is not supported by adaptive join.");
+  DebugAssert((mode != JoinMode::Semi && mode != JoinMode::Anti) || predicate_condition == PredicateCondition::Equals,
+              "Semi and anti joins are only supported for equality predicates.");
+}
+
+const std::string JoinAdaptive::name() const { return "JoinAdaptive"; }
+
+const std::optional<OperatorType>& JoinAdaptive::chosen_join_type() const { return _chosen_join_type; }
+
+std::shared_ptr<AbstractOperator> JoinAdaptive::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<JoinAdaptive>(copied_input_left, copied_input_right, _mode, _column_ids,
+                                        _predicate_condition);
+}
+
+void JoinAdaptive::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> JoinAdaptive::_on_execute() {
+  _join = _choose_join();
+  _chosen_join_type = _join->type();
+
+  // The inputs of the chosen join are the already executed inputs of this operator
+  _join->execute();
+  return _join->get_output();
+}
+
+void JoinAdaptive::_on_cleanup() { _join.reset(); }
+
+std::shared_ptr<AbstractJoinOperator> JoinAdaptive::_choose_join() const {
+  const auto left_row_count = input_table_left()->row_count();
+  const auto right_row_count = input_table_right()->row_count();
+
+  if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
+    return std::make_shared<JoinHash>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+  }
+
+  if (left_row_count * right_row_count <= MAX_NESTED_LOOP_ROW_PAIRS) {
+    return std::make_shared<JoinNestedLoop>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+  }
+
+  if (left_row_count * MIN_INDEX_JOIN_SIZE_RATIO <= right_row_count && _right_input_has_index()) {
+    return std::make_shared<JoinIndex>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+  }
+
+  // JoinSortMerge requires both join columns to have the same type, JoinHash and JoinNestedLoop do not
+  const auto same_column_types =
+      input_table_left()->column_data_type(_column_ids.first) ==
+      input_table_right()->column_data_type(_column_ids.second);
+
+  if (_predicate_condition == PredicateCondition::Equals && _mode != JoinMode::Outer) {
+    if (same_column_types && _is_ordered_by(*input_table_left(), _column_ids.first) &&
+        _is_ordered_by(*input_table_right(), _column_ids.second)) {
+      return std::make_shared<JoinSortMerge>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+    }
+
+    // The same choice of the build input as in JoinHash::_on_execute()
+    const auto left_is_build_input =
+        _mode == JoinMode::Right || (_mode != JoinMode::Left && left_row_count <= right_row_count);
+    const auto& build_table = left_is_build_input ? *input_table_left() : *input_table_right();
+    const auto build_column_id = left_is_build_input ? _column_ids.first : _column_ids.second;
+
+    auto radix_bits = size_t{0};
+    resolve_data_type(build_table.column_data_type(build_column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      radix_bits = JoinHash::calculate_radix_bits(build_table.row_count(), sizeof(ColumnDataType));
+    });
+
+    return std::make_shared<JoinHash>(_input_left, _input_right, _mode, _column_ids, _predicate_condition,
+                                      radix_bits);
+  }
+
+  if (same_column_types && (_predicate_condition == PredicateCondition::Equals ||
+                            _predicate_condition == PredicateCondition::LessThan ||
+                            _predicate_condition == PredicateCondition::LessThanEquals ||
+                            _predicate_condition == PredicateCondition::GreaterThan ||
+                            _predicate_condition == PredicateCondition::GreaterThanEquals ||
+                            (_predicate_condition == PredicateCondition::NotEquals && _mode == JoinMode::Inner))) {
+    return std::make_shared<JoinSortMerge>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+  }
+
+  return std::make_shared<JoinNestedLoop>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+}
+
+bool JoinAdaptive::_right_input_has_index() const {
+  const auto& right_table = *input_table_right();
+
+  // The same lookup of the indexes as in JoinIndex::_perform_join()
+  const auto use_table_index = right_table.type() == TableType::Data &&
+                               BaseTableIndex::supports(flip_predicate_condition(_predicate_condition));
+  if (use_table_index && right_table.get_table_index(_column_ids.second)) {
+    return true;
+  }
+
+  if (right_table.chunk_count() == 0) return false;
+
+  for (ChunkID chunk_id{0}; chunk_id < right_table.chunk_count(); ++chunk_id) {
+    const auto indices = right_table.get_chunk(chunk_id)->get_indices(std::vector<ColumnID>{_column_ids.second});
+    const auto index_it = std::find_if(indices.cbegin(), indices.cend(), [&](const auto& index) {
+      return BaseIndex::supports(index->type(), _predicate_condition);
+    });
+    if (index_it == indices.cend()) return false;
+  }
+  return true;
+}
+
+bool JoinAdaptive::_is_ordered_by(const Table& table, const ColumnID column_id) {
+  if (table.chunk_count() == 0) return false;
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto& ordered_by = table.get_chunk(chunk_id)->ordered_by();
+    if (!ordered_by || ordered_by->first != column_id) return false;
+  }
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Chooses the join algorithm only once the input tables are available, so that the choice depends on their actual
+ * sizes instead of on the estimates of the optimizer, and then executes it:
+ *  - JoinHash for semi and anti joins, which no other join supports
+ *  - JoinNestedLoop if the inputs are so small that materializing, hashing or sorting them does not pay off
+ *  - JoinIndex if the right input has an index on its join column for the predicate (a table index or an index in
+ *    each chunk) and the left input is much smaller, so that probing the index is cheaper than building a hash table
+ *  - JoinSortMerge for equi joins whose inputs are both ordered by their join columns already, because its sort is
+ *    cheap then
+ *  - JoinHash for the remaining equi joins except for full outer joins, with the radix bits for the actual size of
+ *    the build input
+ *  - JoinSortMerge for all other joins that it supports, and JoinNestedLoop otherwise
+ */
+class JoinAdaptive : public AbstractJoinOperator {
+ public:
+  JoinAdaptive(const std::shared_ptr<const AbstractOperator>& left,
+               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+               const ColumnIDPair& column_ids, const PredicateCondition predicate_condition);
+
+  const std::string name() const override;
+
+  // The type of the join that was executed, std::nullopt before the execution
+  const std::optional<OperatorType>& chosen_join_type() const;
+
+  // Inputs with at most this many pairs of rows are joined with a JoinNestedLoop
+  static constexpr auto MAX_NESTED_LOOP_ROW_PAIRS = size_t{10'000};
+
+  // The right input has to be at least this many times larger than the left input for a JoinIndex
+  static constexpr auto MIN_INDEX_JOIN_SIZE_RATIO = size_t{8};
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_cleanup() override;
+
+  std::shared_ptr<AbstractJoinOperator> _choose_join() const;
+
+  // Whether JoinIndex finds an index on the right join column for the predicate
+  bool _right_input_has_index() const;
+
+  // Whether all chunks of the table are ordered by the column
+  static bool _is_ordered_by(const Table& table, const ColumnID column_id);
+
+  std::shared_ptr<AbstractJoinOperator> _join;
+  std::optional<OperatorType> _chosen_join_type;
+};
+
+}  // namespace opossum
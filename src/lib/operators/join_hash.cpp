@@ -3,15 +3,16 @@
 #include <cmath>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
-#include "bytell_hash_map.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
@@ -20,23 +21,142 @@
 #include "utils/assert.hpp"
 #include "utils/timer.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The hash table of the build relation and the probing of morsels against it, see JoinHash::create_morsel_processor()
+template <typename BuildColumnType, typename ProbeColumnType>
+class JoinHashMorselProber {
+ public:
+  using HashedType = typename JoinHashTraits<BuildColumnType, ProbeColumnType>::HashType;
+
+  JoinHashMorselProber(const std::shared_ptr<const Table>& build_table, const ColumnID build_column_id,
+                       const ColumnID probe_column_id, const JoinMode mode, const bool probe_input_is_left,
+                       const TableColumnDefinitions& output_column_definitions)
+      : _build_table(build_table),
+        _probe_column_id(probe_column_id),
+        _mode(mode),
+        _probe_input_is_left(probe_input_is_left),
+        _output_column_definitions(output_column_definitions) {
+    // NULLs are always discarded for the build side
+    auto histograms = std::vector<std::vector<size_t>>{};
+    const auto materialized_build =
+        materialize_input<BuildColumnType, HashedType, false>(build_table, build_column_id, histograms, 0);
+
+    // Semi and anti joins only need to know whether a build value exists, not all of its RowIDs
+    const auto hash_table_mode = _is_semi_or_anti() ? PosHashTableMode::SinglePosition : PosHashTableMode::AllPositions;
+    _hash_tables = build<BuildColumnType, HashedType>(materialized_build, hash_table_mode);
+
+    if (build_table->type() == TableType::References) {
+      _build_pos_lists_by_segment = setup_pos_lists_by_segment(build_table);
+    }
+  }
+
+  std::shared_ptr<Table> probe_morsel(const std::shared_ptr<const Table>& in_table,
+                                      const std::vector<ChunkID>& chunk_ids) const {
+    const auto output_table = std::make_shared<Table>(_output_column_definitions, TableType::References);
+
+    for (const auto chunk_id : chunk_ids) {
+      // The steps materialize whole tables, so each probe chunk is wrapped into a table of its own. The RowIDs of
+      // probed data chunks are mapped back to the chunk of the input table, which the output has to reference.
+      const auto chunk_table = std::make_shared<Table>(in_table->column_definitions(), in_table->type());
+      chunk_table->append_chunk(in_table->get_chunk(chunk_id)->segments());
+
+      auto histograms = std::vector<std::vector<size_t>>{};
+      auto build_pos_lists = std::vector<PosList>(1);
+      auto probe_pos_lists = std::vector<PosList>(1);
+
+      if (_is_semi_or_anti()) {
+        const auto materialized_probe =
+            materialize_input<ProbeColumnType, HashedType, false>(chunk_table, _probe_column_id, histograms, 0);
+        probe_semi_anti<ProbeColumnType, HashedType>(materialized_probe, _hash_tables, probe_pos_lists, _mode);
+      } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
+        // The probe relation is the outer relation and keeps its NULL values
+        const auto materialized_probe =
+            materialize_input<ProbeColumnType, HashedType, true>(chunk_table, _probe_column_id, histograms, 0);
+        probe<ProbeColumnType, HashedType, true>(materialized_probe, _hash_tables, build_pos_lists, probe_pos_lists,
+                                                 _mode);
+      } else {
+        const auto materialized_probe =
+            materialize_input<ProbeColumnType, HashedType, false>(chunk_table, _probe_column_id, histograms, 0);
+        probe<ProbeColumnType, HashedType, false>(materialized_probe, _hash_tables, build_pos_lists, probe_pos_lists,
+                                                  _mode);
+      }
+
+      auto probe_pos_list = std::make_shared<PosList>(std::move(probe_pos_lists[0]));
+      if (probe_pos_list->empty()) continue;
+
+      auto probe_table = std::shared_ptr<const Table>{chunk_table};
+      auto probe_pos_lists_by_segment = PosListsBySegment{};
+      if (in_table->type() == TableType::References) {
+        probe_pos_lists_by_segment = setup_pos_lists_by_segment(chunk_table);
+      } else {
+        probe_table = in_table;
+        for (auto& row_id : *probe_pos_list) row_id.chunk_id = chunk_id;
+      }
+
+      auto output_segments = Segments{};
+      if (_is_semi_or_anti()) {
+        write_output_segments(output_segments, probe_table, probe_pos_lists_by_segment, probe_pos_list);
+      } else {
+        auto build_pos_list = std::make_shared<PosList>(std::move(build_pos_lists[0]));
+        if (_probe_input_is_left) {
+          write_output_segments(output_segments, probe_table, probe_pos_lists_by_segment, probe_pos_list);
+          write_output_segments(output_segments, _build_table, _build_pos_lists_by_segment, build_pos_list);
+        } else {
+          write_output_segments(output_segments, _build_table, _build_pos_lists_by_segment, build_pos_list);
+          write_output_segments(output_segments, probe_table, probe_pos_lists_by_segment, probe_pos_list);
+        }
+      }
+
+      output_table->append_chunk(output_segments);
+    }
+
+    return output_table;
+  }
+
+ private:
+  bool _is_semi_or_anti() const { return _mode == JoinMode::Semi || _mode == JoinMode::Anti; }
+
+  const std::shared_ptr<const Table> _build_table;
+  const ColumnID _probe_column_id;
+  const JoinMode _mode;
+  const bool _probe_input_is_left;
+  const TableColumnDefinitions _output_column_definitions;
+
+  std::vector<std::optional<PosHashTable<HashedType>>> _hash_tables;
+  PosListsBySegment _build_pos_lists_by_segment;
+};
+
+}  // namespace
+
 namespace opossum {
 
 JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-                   const std::optional<size_t>& radix_bits)
+                   const std::optional<size_t>& radix_bits,
+                   const std::vector<ColumnIDPair>& additional_column_ids,
+                   const std::optional<SpillOptions>& spill_options)
     : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
-      _radix_bits(radix_bits) {
+      _radix_bits(radix_bits),
+      _additional_column_ids(additional_column_ids),
+      _spill_options(spill_options) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
 }
 
 const std::string JoinHash::name() const { return "JoinHash"; }
 
+const std::vector<ColumnIDPair>& JoinHash::additional_column_ids() const { return _additional_column_ids; }
+
+const std::optional<SpillOptions>& JoinHash::spill_options() const { return _spill_options; }
+
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition);
+  return std::make_shared<JoinHash>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                    _radix_bits, _additional_column_ids, _spill_options);
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -52,8 +172,10 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   // (2) for a semi and anti join the inputs are always swapped
   bool inputs_swapped = (_mode == JoinMode::Left || _mode == JoinMode::Anti || _mode == JoinMode::Semi);
 
-  // (3) else the smaller relation will become build relation, the larger probe relation
-  if (!inputs_swapped && _input_left->get_output()->row_count() > _input_right->get_output()->row_count()) {
+  // (3) else the smaller relation will become build relation, the larger probe relation. The outer relation of a right
+  // outer join has to stay the probe relation, though.
+  if (!inputs_swapped && _mode != JoinMode::Right &&
+      _input_left->get_output()->row_count() > _input_right->get_output()->row_count()) {
     inputs_swapped = true;
   }
 
@@ -75,6 +197,37 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
   auto build_input = build_operator->get_output();
   auto probe_input = probe_operator->get_output();
 
+  if (!_additional_column_ids.empty()) {
+    // Composite keys are joined as strings (see materialize_composite_keys())
+    auto build_column_ids = std::vector<ColumnID>{build_column_id};
+    auto probe_column_ids = std::vector<ColumnID>{probe_column_id};
+    for (const auto& [left_column_id, right_column_id] : _additional_column_ids) {
+      build_column_ids.emplace_back(inputs_swapped ? right_column_id : left_column_id);
+      probe_column_ids.emplace_back(inputs_swapped ? left_column_id : right_column_id);
+    }
+
+    auto hashed_data_types = std::vector<DataType>{};
+    for (auto key_part_id = size_t{0}; key_part_id < build_column_ids.size(); ++key_part_id) {
+      resolve_data_type(build_input->column_data_type(build_column_ids[key_part_id]), [&](auto build_type) {
+        using BuildColumnDataType = typename decltype(build_type)::type;
+        resolve_data_type(probe_input->column_data_type(probe_column_ids[key_part_id]), [&](auto probe_type) {
+          using ProbeColumnDataType = typename decltype(probe_type)::type;
+          using HashedType = typename JoinHashTraits<BuildColumnDataType, ProbeColumnDataType>::HashType;
+          hashed_data_types.emplace_back(data_type_from_type<HashedType>());
+        });
+      });
+    }
+
+    const auto build_keys = materialize_composite_keys(build_input, build_column_ids, hashed_data_types);
+    const auto probe_keys = materialize_composite_keys(probe_input, probe_column_ids, hashed_data_types);
+
+    _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
+        DataType::String, DataType::String, *this, build_operator, probe_operator, _mode,
+        ColumnIDPair{ColumnID{0}, ColumnID{0}}, _predicate_condition, inputs_swapped, _radix_bits, build_keys,
+        probe_keys);
+    return _impl->_on_execute();
+  }
+
   _impl = make_unique_by_data_types<AbstractReadOnlyOperatorImpl, JoinHashImpl>(
       build_input->column_data_type(build_column_id), probe_input->column_data_type(probe_column_id), *this,
       build_operator, probe_operator, _mode, adjusted_column_ids, _predicate_condition, inputs_swapped, _radix_bits);
@@ -83,20 +236,101 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
 
 void JoinHash::_on_cleanup() { _impl.reset(); }
 
+bool JoinHash::supports_morsel_probing(const bool probe_input_is_left) const {
+  if (!_additional_column_ids.empty()) return false;
+
+  // The relation on the right is always the probe relation in JoinHashImpl, so the outer relation of outer joins and
+  // the left relation of semi and anti joins have to be probed
+  switch (_mode) {
+    case JoinMode::Inner:
+      return true;
+    case JoinMode::Left:
+    case JoinMode::Semi:
+    case JoinMode::Anti:
+      return probe_input_is_left;
+    case JoinMode::Right:
+      return !probe_input_is_left;
+    default:
+      return false;
+  }
+}
+
+MorselProcessor JoinHash::create_morsel_processor(const std::shared_ptr<const Table>& build_table,
+                                                  const Table& probe_layout, const bool probe_input_is_left) const {
+  Assert(supports_morsel_probing(probe_input_is_left), "JoinHash cannot probe morsels of this input");
+
+  const auto build_column_id = probe_input_is_left ? _column_ids.second : _column_ids.first;
+  const auto probe_column_id = probe_input_is_left ? _column_ids.first : _column_ids.second;
+
+  const auto output_layout = probe_input_is_left ? _initialize_output_table(probe_layout, *build_table)
+                                                 : _initialize_output_table(*build_table, probe_layout);
+
+  auto processor = MorselProcessor{};
+  resolve_data_type(build_table->column_data_type(build_column_id), [&](const auto build_data_type_t) {
+    using BuildColumnDataType = typename decltype(build_data_type_t)::type;
+    resolve_data_type(probe_layout.column_data_type(probe_column_id), [&](const auto probe_data_type_t) {
+      using ProbeColumnDataType = typename decltype(probe_data_type_t)::type;
+      const auto prober = std::make_shared<JoinHashMorselProber<BuildColumnDataType, ProbeColumnDataType>>(
+          build_table, build_column_id, probe_column_id, _mode, probe_input_is_left,
+          output_layout->column_definitions());
+      processor = [prober](const std::shared_ptr<const Table>& in_table, const std::vector<ChunkID>& chunk_ids) {
+        return prober->probe_morsel(in_table, chunk_ids);
+      };
+    });
+  });
+
+  return processor;
+}
+
+size_t JoinHash::calculate_radix_bits(const size_t build_relation_size, const size_t build_value_size) {
+  /*
+    Setting number of bits for radix clustering:
+    The number of bits is used to create probe partitions with a size that can
+    be expected to fit into the L2 cache.
+    This should incorporate hardware knowledge, once available in Hyrise.
+    As of now, we assume a L2 cache size of 256 KB.
+    We estimate the size the following way:
+      - we assume each key appears once (that is an overestimation space-wise, but we
+      aim rather for a hash map that is slightly smaller than L2 than slightly larger)
+      - each entry in the hash map is a data structure holding the actual value
+      and the RowID
+  */
+  const auto l2_cache_size = 256'000;  // bytes
+
+  // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
+  // that each value is distinct, so that all RowIDs are stored inline in the slots of the PosHashTable.
+  const auto complete_hash_map_size =
+      // number of items in map
+      (build_relation_size *
+       // key + RowID + row count and overflow offset
+       (build_value_size + sizeof(RowID) + 2 * sizeof(uint32_t)))
+      // fill factor, the PosHashTable has at least twice as many slots as rows
+      / 0.5;
+
+  const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
+  const auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+
+  return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
+}
+
 template <typename LeftType, typename RightType>
 class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
  public:
   JoinHashImpl(const JoinHash& join_hash, const std::shared_ptr<const AbstractOperator>& left,
                const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                const ColumnIDPair& column_ids, const PredicateCondition predicate_condition, const bool inputs_swapped,
-               const std::optional<size_t>& radix_bits = std::nullopt)
+               const std::optional<size_t>& radix_bits = std::nullopt,
+               const std::shared_ptr<const Table>& left_keys = nullptr,
+               const std::shared_ptr<const Table>& right_keys = nullptr)
       : _join_hash(join_hash),
         _left(left),
         _right(right),
         _mode(mode),
         _column_ids(column_ids),
         _predicate_condition(predicate_condition),
-        _inputs_swapped(inputs_swapped) {
+        _inputs_swapped(inputs_swapped),
+        _left_keys(left_keys),
+        _right_keys(right_keys) {
     if (radix_bits.has_value()) {
       _radix_bits = radix_bits.value();
     } else {
@@ -112,6 +346,9 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   const PredicateCondition _predicate_condition;
   const bool _inputs_swapped;
 
+  // The tables whose column_ids are joined, if they are not the input tables (i.e., the composite keys of the inputs)
+  const std::shared_ptr<const Table> _left_keys, _right_keys;
+
   std::shared_ptr<Table> _output_table;
 
   size_t _radix_bits;
@@ -119,19 +356,26 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   // Determine correct type for hashing
   using HashedType = typename JoinHashTraits<LeftType, RightType>::HashType;
 
+  // Checking the statistics of each probe chunk costs one lookup per build value, so runtime pruning is only used for
+  // small build relations
+  static constexpr auto max_runtime_pruning_build_values = size_t{1'000};
+
+  // The bytes that a build row takes in its partition and in the hash table (which has at least twice as many slots
+  // as rows) and that a probe row takes in its partition, not counting the characters of strings
+  static constexpr auto build_bytes_per_row =
+      sizeof(PartitionedElement<LeftType>) + 2 * (sizeof(HashedType) + sizeof(RowID) + 2 * sizeof(uint32_t));
+  static constexpr auto probe_bytes_per_row = sizeof(PartitionedElement<RightType>);
+
+  // Each partition of a grace hash join has two open files
+  static constexpr auto max_spill_radix_bits = size_t{8};
+
+  // Semi and anti joins only need to know whether a build value exists, not all of its RowIDs
+  PosHashTableMode _hash_table_mode() const {
+    return _mode == JoinMode::Semi || _mode == JoinMode::Anti ? PosHashTableMode::SinglePosition
+                                                               : PosHashTableMode::AllPositions;
+  }
+
   size_t _calculate_radix_bits() const {
-    /*
-      Setting number of bits for radix clustering:
-      The number of bits is used to create probe partitions with a size that can
-      be expected to fit into the L2 cache.
-      This should incorporate hardware knowledge, once available in Hyrise.
-      As of now, we assume a L2 cache size of 256 KB.
-      We estimate the size the following way:
-        - we assume each key appears once (that is an overestimation space-wise, but we
-        aim rather for a hash map that is slightly smaller than L2 than slightly larger)
-        - each entry in the hash map is a data structure holding the actual value
-        and the RowID
-    */
     const auto build_relation_size = _left->get_output()->row_count();
     const auto probe_relation_size = _right->get_output()->row_count();
 
@@ -146,30 +390,155 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       PerformanceWarning(warning);
     }
 
-    const auto l2_cache_size = 256'000;  // bytes
+    return JoinHash::calculate_radix_bits(build_relation_size, sizeof(LeftType));
+  }
 
-    // To get a pessimistic estimation (ensure that the hash table fits within the cache), we assume
-    // that each value maps to a PosList with a single RowID. For the used small_vector's, we assume a
-    // size of 2*RowID per PosList. For sizing, see comments:
-    // https://probablydance.com/2018/05/28/a-new-fast-hash-table-in-response-to-googles-new-fast-hash-table/
-    const auto complete_hash_map_size =
-        // number of items in map
-        (build_relation_size *
-         // key + value (and one byte overhead, see link above)
-         (sizeof(LeftType) + 2 * sizeof(RowID) + 1))
-        // fill factor
-        / 0.8;
+  // Grace hash join, see JoinHash and spill_partitions()
+  void _join_spilled(const std::shared_ptr<const Table>& left_key_table,
+                     const std::shared_ptr<const Table>& right_key_table, const bool keep_nulls,
+                     std::vector<PosList>& left_pos_lists, std::vector<PosList>& right_pos_lists) const {
+    const auto& spill_options = *_join_hash._spill_options;
+    const auto size_of_partitions =
+        left_key_table->row_count() * build_bytes_per_row + right_key_table->row_count() * probe_bytes_per_row;
+
+    // Aim for partitions of half the budget, so that skewed partitions still fit
+    const auto needed_partition_count =
+        std::max(std::ceil(2.0 * static_cast<double>(size_of_partitions) / spill_options.memory_budget), 1.0);
+    const auto needed_radix_bits = static_cast<size_t>(std::ceil(std::log2(needed_partition_count)));
+    const auto radix_bits = std::min(std::max(_radix_bits, needed_radix_bits), max_spill_radix_bits);
+    const auto partition_count = size_t{1} << radix_bits;
+
+    // NULLs are always discarded for the build side
+    auto left_spill_files = std::vector<std::unique_ptr<SpillFile>>{};
+    const auto left_partition_sizes = spill_partitions<LeftType, HashedType, false>(
+        left_key_table, _column_ids.first, radix_bits, spill_options.directory, left_spill_files);
+
+    auto right_spill_files = std::vector<std::unique_ptr<SpillFile>>{};
+    const auto right_partition_sizes =
+        keep_nulls ? spill_partitions<RightType, HashedType, true>(right_key_table, _column_ids.second, radix_bits,
+                                                                   spill_options.directory, right_spill_files)
+                   : spill_partitions<RightType, HashedType, false>(right_key_table, _column_ids.second, radix_bits,
+                                                                    spill_options.directory, right_spill_files);
+
+    // The hash tables and the output PosLists are allocated from the memory resource of the query, see
+    // AbstractOperator::memory_resource()
+    const auto pos_list_allocator = PosList::allocator_type{_join_hash.memory_resource()};
+    left_pos_lists = create_pos_lists(partition_count, pos_list_allocator);
+    right_pos_lists = create_pos_lists(partition_count, pos_list_allocator);
+
+    for (auto partition_begin = size_t{0}; partition_begin < partition_count;) {
+      auto partition_end = partition_begin;
+      auto group_size = size_t{0};
+      while (partition_end < partition_count) {
+        const auto partition_size = left_partition_sizes[partition_end] * build_bytes_per_row +
+                                    right_partition_sizes[partition_end] * probe_bytes_per_row;
+        if (partition_end > partition_begin && group_size + partition_size > spill_options.memory_budget) break;
+        group_size += partition_size;
+        ++partition_end;
+      }
+
+      const auto radix_left =
+          load_partitions<LeftType, false>(left_spill_files, left_partition_sizes, partition_begin, partition_end);
+      const auto hashtables = build<LeftType, HashedType>(radix_left, _hash_table_mode(),
+                                                          PolymorphicAllocator<size_t>{_join_hash.memory_resource()});
 
-    const auto adaption_factor = 2.0f;  // don't occupy the whole L2 cache
-    const auto cluster_count = std::max(1.0, (adaption_factor * complete_hash_map_size) / l2_cache_size);
+      const auto group_partition_count = partition_end - partition_begin;
+      auto group_left_pos_lists = create_pos_lists(group_partition_count, pos_list_allocator);
+      auto group_right_pos_lists = create_pos_lists(group_partition_count, pos_list_allocator);
 
-    return static_cast<size_t>(std::ceil(std::log2(cluster_count)));
+      if (keep_nulls) {
+        const auto radix_right = load_partitions<RightType, true>(right_spill_files, right_partition_sizes,
+                                                                  partition_begin, partition_end);
+        probe<RightType, HashedType, true>(radix_right, hashtables, group_left_pos_lists, group_right_pos_lists,
+                                           _mode);
+      } else {
+        const auto radix_right = load_partitions<RightType, false>(right_spill_files, right_partition_sizes,
+                                                                   partition_begin, partition_end);
+        if (_mode == JoinMode::Semi || _mode == JoinMode::Anti) {
+          probe_semi_anti<RightType, HashedType>(radix_right, hashtables, group_right_pos_lists, _mode);
+        } else {
+          probe<RightType, HashedType, false>(radix_right, hashtables, group_left_pos_lists, group_right_pos_lists,
+                                              _mode);
+        }
+      }
+
+      for (auto group_partition_id = size_t{0}; group_partition_id < group_partition_count; ++group_partition_id) {
+        left_pos_lists[partition_begin + group_partition_id] = std::move(group_left_pos_lists[group_partition_id]);
+        right_pos_lists[partition_begin + group_partition_id] = std::move(group_right_pos_lists[group_partition_id]);
+      }
+
+      partition_begin = partition_end;
+    }
+  }
+
+  // Appends one output chunk per partition
+  void _write_output_chunks(const std::shared_ptr<const Table>& left_in_table,
+                            const std::shared_ptr<const Table>& right_in_table, std::vector<PosList>& left_pos_lists,
+                            std::vector<PosList>& right_pos_lists) {
+    auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
+
+    /**
+     * Two Caches to avoid redundant reference materialization for Reference input tables. As there might be
+     *  quite a lot Partitions (>500 seen), input Chunks (>500 seen), and columns (>50 seen), this speeds up
+     *  write_output_chunks a lot.
+     *
+     * They do two things:
+     *      - Make it possible to re-use output pos lists if two segments in the input table have exactly the same
+     *          PosLists Chunk by Chunk
+     *      - Avoid creating the std::vector<const PosList*> for each Partition over and over again.
+     *
+     * They hold one entry per column in the table, not per BaseSegment in a single chunk
+     */
+    PosListsBySegment left_pos_lists_by_segment;
+    PosListsBySegment right_pos_lists_by_segment;
+
+    // left_pos_lists_by_segment will only be needed if left is a reference table and being output
+    if (left_in_table->type() == TableType::References && !only_output_right_input) {
+      left_pos_lists_by_segment = setup_pos_lists_by_segment(left_in_table);
+    }
+
+    // right_pos_lists_by_segment will only be needed if right is a reference table
+    if (right_in_table->type() == TableType::References) {
+      right_pos_lists_by_segment = setup_pos_lists_by_segment(right_in_table);
+    }
+
+    for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
+      // moving the values into a shared pos list saves us some work in write_output_segments. We know that
+      // left_pos_lists and right_pos_lists will not be used again.
+      auto left = std::make_shared<PosList>(std::move(left_pos_lists[partition_id]));
+      auto right = std::make_shared<PosList>(std::move(right_pos_lists[partition_id]));
+
+      if (left->empty() && right->empty()) {
+        continue;
+      }
+
+      Segments output_segments;
+
+      // we need to swap back the inputs, so that the order of the output columns is not harmed
+      if (_inputs_swapped) {
+        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+
+        // Semi/Anti joins are always swapped but do not need the outer relation
+        if (!only_output_right_input) {
+          write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
+        }
+      } else {
+        write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
+        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
+      }
+
+      _output_table->append_chunk(output_segments);
+    }
   }
 
   std::shared_ptr<const Table> _on_execute() override {
     auto right_in_table = _right->get_output();
     auto left_in_table = _left->get_output();
 
+    // The join values are materialized from the key tables, the output references the input tables
+    const auto left_key_table = _left_keys ? _left_keys : left_in_table;
+    const auto right_key_table = _right_keys ? _right_keys : right_in_table;
+
     _output_table = _join_hash._initialize_output_table();
 
     /*
@@ -179,12 +548,25 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
      */
     const auto keep_nulls = (_mode == JoinMode::Left || _mode == JoinMode::Right);
 
+    // The materialized and the radix partitioned relations as well as the hash tables are in memory at the same time
+    const auto& spill_options = _join_hash._spill_options;
+    if (spill_options && 2 * (left_key_table->row_count() * build_bytes_per_row +
+                              right_key_table->row_count() * probe_bytes_per_row) >
+                             spill_options->memory_budget) {
+      std::vector<PosList> left_pos_lists;
+      std::vector<PosList> right_pos_lists;
+      _join_spilled(left_key_table, right_key_table, keep_nulls, left_pos_lists, right_pos_lists);
+      _write_output_chunks(left_in_table, right_in_table, left_pos_lists, right_pos_lists);
+      return _output_table;
+    }
+
     // Pre-partitioning:
     // Save chunk offsets into the input relation.
-    const auto left_chunk_offsets = determine_chunk_offsets(left_in_table);
-    const auto right_chunk_offsets = determine_chunk_offsets(right_in_table);
+    const auto left_chunk_offsets = determine_chunk_offsets(left_key_table);
+    const auto right_chunk_offsets = determine_chunk_offsets(right_key_table);
 
-    Timer performance_timer;
+    // The phases of both relations run concurrently, so their walltimes are summed up per phase
+    auto& performance_data = *_join_hash._performance_data;
 
     // Containers used to store histograms for (potentially subsequent) radix
     // partitioning phase (in cases _radix_bits > 0). Created during materialization phase.
@@ -200,7 +582,14 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     // Containers for potential (skipped when left side small) radix partitioning phase
     RadixContainer<LeftType> radix_left;
     RadixContainer<RightType> radix_right;
-    std::vector<std::optional<HashTable<HashedType>>> hashtables;
+    std::vector<std::optional<PosHashTable<HashedType>>> hashtables;
+
+    // Semi and anti joins on integers from a small range use a bitmap of the build values instead of hash tables, see
+    // DenseValueBitmap. The probe relation is then neither filtered nor partitioned, so that it is only materialized
+    // when the bitmap is known.
+    const auto try_dense_bitmap =
+        (_mode == JoinMode::Semi || _mode == JoinMode::Anti) && std::is_integral_v<HashedType>;
+    std::optional<DenseValueBitmap<HashedType>> dense_bitmap;
 
     // Depiction of the hash join parallelization (radix partitioning can be skipped when radix_bits = 0)
     // ===============================================================================================
@@ -223,13 +612,42 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     //                           \                 /
     //                          Probing (actual Join)
 
+    /*
+     * Runtime filtering: Rows of the probe relation whose values do not occur in the build relation cannot have a join
+     * partner. If the build relation is smaller than the probe relation, such rows are discarded while the probe
+     * relation is materialized, using the value range and a Bloom filter of the build values (see RuntimeFilter), so
+     * that they are neither partitioned nor probed. Additionally, if the build relation is small, the chunks of the
+     * probe relation whose statistics rule out all build values are not materialized at all (runtime pruning, see
+     * determine_pruned_chunks()). Both require the build values before the probe relation is materialized, so both
+     * paths are executed one after another. Outer and anti joins need the unmatched rows and are never filtered.
+     */
+    const auto filter_probe_relation = _mode == JoinMode::Inner || _mode == JoinMode::Semi;
+    const auto use_runtime_filter = filter_probe_relation && left_in_table->row_count() < right_in_table->row_count();
+    const auto use_runtime_pruning = std::is_same_v<LeftType, RightType> && filter_probe_relation &&
+                                     left_in_table->row_count() <= max_runtime_pruning_build_values;
+    std::optional<RuntimeFilter<HashedType>> runtime_filter;
+    std::vector<bool> pruned_right_chunks;
+
     std::vector<std::shared_ptr<AbstractTask>> jobs;
 
     // Pre-Probing path of left relation
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      Timer timer;
+
       // materialize left table (NULLs are always discarded for the build side)
-      materialized_left = materialize_input<LeftType, HashedType, false>(left_in_table, _column_ids.first,
+      materialized_left = materialize_input<LeftType, HashedType, false>(left_key_table, _column_ids.first,
                                                                          histograms_left, _radix_bits);
+      performance_data.bytes_materialized +=
+          materialized_left.elements->size() * sizeof(PartitionedElement<LeftType>);
+      performance_data.add_phase_walltime("Materialize", timer.lap());
+
+      if (try_dense_bitmap) {
+        dense_bitmap = build_dense_value_bitmap<LeftType, HashedType>(materialized_left);
+        if (dense_bitmap) {
+          performance_data.add_phase_walltime("Build", timer.lap());
+          return;
+        }
+      }
 
       if (_radix_bits > 0) {
         // radix partition the left table
@@ -239,48 +657,97 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         // short cut: skip radix partitioning and use materialized data directly
         radix_left = std::move(materialized_left);
       }
+      performance_data.add_phase_walltime("Partition", timer.lap());
 
       // build hash tables
-      hashtables = build<LeftType, HashedType>(radix_left);
+      hashtables = build<LeftType, HashedType>(radix_left, _hash_table_mode(),
+                                               PolymorphicAllocator<size_t>{_join_hash.memory_resource()});
+      performance_data.add_phase_walltime("Build", timer.lap());
     }));
     jobs.back()->schedule();
 
+    if (use_runtime_filter || use_runtime_pruning || try_dense_bitmap) {
+      CurrentScheduler::wait_for_tasks(jobs);
+      jobs.clear();
+    }
+
+    if (use_runtime_filter && !dense_bitmap) {
+      runtime_filter.emplace(hashtables);
+    }
+
+    if (use_runtime_pruning) {
+      auto build_values = std::vector<HashedType>{};
+      if constexpr (std::is_integral_v<HashedType>) {
+        if (dense_bitmap) dense_bitmap->for_each([&](const auto& value) { build_values.emplace_back(value); });
+      }
+      for (const auto& hashtable : hashtables) {
+        if (!hashtable) continue;
+        hashtable->for_each([&](const auto& value, const auto& /*row_ids*/) { build_values.emplace_back(value); });
+      }
+      pruned_right_chunks = determine_pruned_chunks(right_key_table, _column_ids.second, build_values);
+    }
+
+    const auto right_radix_bits = dense_bitmap ? size_t{0} : _radix_bits;
+
     jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      Timer timer;
+
       // Materialize right table. The third template parameter signals if the relation on the right (probe
       // relation) materializes NULL values when executing OUTER joins (default is to discard NULL values).
       if (keep_nulls) {
-        materialized_right = materialize_input<RightType, HashedType, true>(right_in_table, _column_ids.second,
-                                                                            histograms_right, _radix_bits);
+        materialized_right = materialize_input<RightType, HashedType, true>(right_key_table, _column_ids.second,
+                                                                            histograms_right, right_radix_bits);
       } else {
-        materialized_right = materialize_input<RightType, HashedType, false>(right_in_table, _column_ids.second,
-                                                                             histograms_right, _radix_bits);
+        materialized_right = materialize_input<RightType, HashedType, false>(
+            right_key_table, _column_ids.second, histograms_right, right_radix_bits, pruned_right_chunks,
+            runtime_filter ? &*runtime_filter : nullptr);
       }
+      performance_data.bytes_materialized +=
+          materialized_right.elements->size() * sizeof(PartitionedElement<RightType>);
+      performance_data.add_phase_walltime("Materialize", timer.lap());
 
-      if (_radix_bits > 0) {
+      if (right_radix_bits > 0) {
         // radix partition the right table. 'keep_nulls' makes sure that the
         // relation on the right keeps NULL values when executing an OUTER join.
         if (keep_nulls) {
           radix_right = partition_radix_parallel<RightType, HashedType, true>(materialized_right, right_chunk_offsets,
-                                                                              histograms_right, _radix_bits);
+                                                                              histograms_right, right_radix_bits);
         } else {
           radix_right = partition_radix_parallel<RightType, HashedType, false>(materialized_right, right_chunk_offsets,
-                                                                               histograms_right, _radix_bits);
+                                                                               histograms_right, right_radix_bits);
         }
       } else {
         // short cut: skip radix partitioning and use materialized data directly
         radix_right = std::move(materialized_right);
       }
+      performance_data.add_phase_walltime("Partition", timer.lap());
     }));
     jobs.back()->schedule();
 
     CurrentScheduler::wait_for_tasks(jobs);
 
+    Timer probe_timer;
+
     // Probe phase
     std::vector<PosList> left_pos_lists;
     std::vector<PosList> right_pos_lists;
+    const auto pos_list_allocator = PosList::allocator_type{_join_hash.memory_resource()};
+
+    if constexpr (std::is_integral_v<HashedType>) {
+      if (dense_bitmap) {
+        probe_semi_anti_dense<RightType, HashedType>(radix_right, *dense_bitmap, right_chunk_offsets, right_pos_lists,
+                                                     _mode, pos_list_allocator);
+        left_pos_lists = create_pos_lists(right_pos_lists.size(), pos_list_allocator);
+        performance_data.add_phase_walltime("Probe", probe_timer.lap());
+        _write_output_chunks(left_in_table, right_in_table, left_pos_lists, right_pos_lists);
+        performance_data.add_phase_walltime("Write output", probe_timer.lap());
+        return _output_table;
+      }
+    }
+
     const size_t partition_count = radix_right.partition_offsets.size();
-    left_pos_lists.resize(partition_count);
-    right_pos_lists.resize(partition_count);
+    left_pos_lists = create_pos_lists(partition_count, pos_list_allocator);
+    right_pos_lists = create_pos_lists(partition_count, pos_list_allocator);
     for (size_t i = 0; i < partition_count; i++) {
       // simple heuristic: half of the rows of the right relation will match
       const size_t result_rows_per_partition = _right->get_output()->row_count() / partition_count / 2;
@@ -302,61 +769,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
         probe<RightType, HashedType, false>(radix_right, hashtables, left_pos_lists, right_pos_lists, _mode);
       }
     }
+    performance_data.add_phase_walltime("Probe", probe_timer.lap());
 
-    auto only_output_right_input = _inputs_swapped && (_mode == JoinMode::Semi || _mode == JoinMode::Anti);
-
-    /**
-     * Two Caches to avoid redundant reference materialization for Reference input tables. As there might be
-     *  quite a lot Partitions (>500 seen), input Chunks (>500 seen), and columns (>50 seen), this speeds up
-     *  write_output_chunks a lot.
-     *
-     * They do two things:
-     *      - Make it possible to re-use output pos lists if two segments in the input table have exactly the same
-     *          PosLists Chunk by Chunk
-     *      - Avoid creating the std::vector<const PosList*> for each Partition over and over again.
-     *
-     * They hold one entry per column in the table, not per BaseSegment in a single chunk
-     */
-    PosListsBySegment left_pos_lists_by_segment;
-    PosListsBySegment right_pos_lists_by_segment;
-
-    // left_pos_lists_by_segment will only be needed if left is a reference table and being output
-    if (left_in_table->type() == TableType::References && !only_output_right_input) {
-      left_pos_lists_by_segment = setup_pos_lists_by_segment(left_in_table);
-    }
-
-    // right_pos_lists_by_segment will only be needed if right is a reference table
-    if (right_in_table->type() == TableType::References) {
-      right_pos_lists_by_segment = setup_pos_lists_by_segment(right_in_table);
-    }
-
-    for (size_t partition_id = 0; partition_id < left_pos_lists.size(); ++partition_id) {
-      // moving the values into a shared pos list saves us some work in write_output_segments. We know that
-      // left_pos_lists and right_pos_lists will not be used again.
-      auto left = std::make_shared<PosList>(std::move(left_pos_lists[partition_id]));
-      auto right = std::make_shared<PosList>(std::move(right_pos_lists[partition_id]));
-
-      if (left->empty() && right->empty()) {
-        continue;
-      }
-
-      Segments output_segments;
-
-      // we need to swap back the inputs, so that the order of the output columns is not harmed
-      if (_inputs_swapped) {
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
-
-        // Semi/Anti joins are always swapped but do not need the outer relation
-        if (!only_output_right_input) {
-          write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
-        }
-      } else {
-        write_output_segments(output_segments, left_in_table, left_pos_lists_by_segment, left);
-        write_output_segments(output_segments, right_in_table, right_pos_lists_by_segment, right);
-      }
-
-      _output_table->append_chunk(output_segments);
-    }
+    _write_output_chunks(left_in_table, right_in_table, left_pos_lists, right_pos_lists);
+    performance_data.add_phase_walltime("Write output", probe_timer.lap());
 
     return _output_table;
   }
@@ -1,15 +1,32 @@
 #pragma once
 
+#include <optional>
+#include <vector>
+
 #include "abstract_join_operator.hpp"
+#include "pipeline.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/spill_file.hpp"
 
 namespace opossum {
 
 /**
  * This operator joins two tables using one column of each table.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
- * If you want to filter by multiple criteria, you can chain this operator.
+ * Further column pairs that have to be equal can be passed as additional_column_ids. The join then hashes and
+ * compares the values of all column pairs as a composite key.
+ *
+ * If spill_options are given and the partitions and hash tables of both inputs would take more than the memory
+ * budget, the join becomes a grace hash join: Both inputs are radix partitioned into temporary files, and groups of
+ * partitions that fit into the budget are then joined one after another (see spill_partitions()). A partition that
+ * alone exceeds the budget is still joined in memory. Runtime filtering and pruning are not used in this case.
+ *
+ * Semi and anti joins only test whether a probe value occurs in the build relation. Their hash tables keep a single
+ * RowID per value, and integer build values from a small range are stored in a bitmap instead (see DenseValueBitmap).
+ *
+ * As a stage of a Pipeline, the join builds the hash table of one input and probes morsels of the other input against
+ * it, see create_morsel_processor().
  *
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
@@ -20,10 +37,30 @@ class JoinHash : public AbstractJoinOperator {
  public:
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
-           const std::optional<size_t>& radix_bits = std::nullopt);
+           const std::optional<size_t>& radix_bits = std::nullopt,
+           const std::vector<ColumnIDPair>& additional_column_ids = {},
+           const std::optional<SpillOptions>& spill_options = std::nullopt);
 
   const std::string name() const override;
 
+  const std::vector<ColumnIDPair>& additional_column_ids() const;
+  const std::optional<SpillOptions>& spill_options() const;
+
+  // The number of radix bits that makes the hash table of each partition of the build relation fit into the L2 cache
+  static size_t calculate_radix_bits(const size_t build_relation_size, const size_t build_value_size);
+
+  // Whether morsels of the given input can be probed, i.e., the join is an inner join or the input is the outer input
+  // of an outer join or the left input of a semi or anti join. Composite keys are not supported.
+  bool supports_morsel_probing(const bool probe_input_is_left) const;
+
+  /**
+   * Builds a single hash table of @param build_table and returns a processor that probes morsels of the other input
+   * against it, see Pipeline. @param probe_layout is a table with the columns of the morsels. The build table is not
+   * radix partitioned, runtime filters are not used and the spill options are ignored.
+   */
+  MorselProcessor create_morsel_processor(const std::shared_ptr<const Table>& build_table, const Table& probe_layout,
+                                          const bool probe_input_is_left) const;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -34,6 +71,8 @@ class JoinHash : public AbstractJoinOperator {
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   const std::optional<size_t> _radix_bits;
+  const std::vector<ColumnIDPair> _additional_column_ids;
+  const std::optional<SpillOptions> _spill_options;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
@@ -1,18 +1,33 @@
 #pragma once
 
-#include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
 
-#include "bytell_hash_map.hpp"
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "operators/morsel_planner.hpp"
+#include "pos_hash_table.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/bloom_filter.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 #include "type_cast.hpp"
 #include "type_comparison.hpp"
 #include "uninitialized_vector.hpp"
+#include "utils/huge_page_memory_resource.hpp"
+#include "utils/spill_file.hpp"
 
 /*
   This file includes the functions that cover the main steps of our hash join implementation
@@ -42,15 +57,17 @@ template <typename T>
 using Partition = std::conditional_t<std::is_trivially_destructible_v<T>, uninitialized_vector<PartitionedElement<T>>,
                                      std::vector<PartitionedElement<T>>>;
 
-// The small_vector holds the first n values in local storage and only resorts to heap storage after that. 1 is chosen
-// as n because in many cases, we join on primary key attributes where by definition we have only one match on the
-// smaller side.
-using SmallPosList = boost::container::small_vector<RowID, 1>;
+/*
+The radix partitions are distributed round-robin over the NUMA nodes. The hash table of a partition is allocated on its
+node and the jobs that build and probe it are scheduled there, so that the random accesses to the hash table are local.
+Without radix partitioning, the single hash table stays on the node of the current worker.
+*/
+inline NodeID partition_node_id(const size_t partition_id, const size_t partition_count) {
+  const auto node_count = Topology::get().nodes().size();
+  if (partition_count < 2 || node_count < 2) return CURRENT_NODE_ID;
 
-// In case we consider runtime to be more relevant, the flat hash map performs better (measured to be mostly on par
-// with bytell hash map and in some cases up to 5% faster) but is significantly larger than the bytell hash map.
-template <typename T>
-using HashTable = ska::bytell_hash_map<T, SmallPosList>;
+  return NodeID{static_cast<NodeID::base_type>(partition_id % node_count)};
+}
 
 /*
 This struct contains radix-partitioned data in a contiguous buffer, as well as a list of offsets for each partition.
@@ -86,9 +103,164 @@ inline std::vector<size_t> determine_chunk_offsets(std::shared_ptr<const Table>
   return chunk_offsets;
 }
 
+/*
+Composite join keys: For joins on several column pairs, the values of each row are encoded into a single string key,
+so that the hash tables compare full keys. Each value is cast to the type that its column pair is hashed with (see
+JoinHashTraits), so that equal values of both inputs are encoded equally. Numbers are stored with their binary
+representation, strings are prefixed with their length, so that the values of neighbouring columns cannot run into
+each other. A row with a NULL in any of the columns gets a NULL key and thus never has a join partner.
+
+The returned table has the chunk layout of the input table, so that the RowIDs of the key table address the same
+rows as those of the input table.
+*/
+inline std::shared_ptr<Table> materialize_composite_keys(const std::shared_ptr<const Table>& in_table,
+                                                         const std::vector<ColumnID>& column_ids,
+                                                         const std::vector<DataType>& hashed_data_types) {
+  DebugAssert(column_ids.size() == hashed_data_types.size(), "Need one hashed data type per column.");
+
+  auto key_segments = std::vector<std::shared_ptr<BaseSegment>>(in_table->chunk_count());
+
+  MorselPlanner::for_each_chunk(OperatorType::JoinHash, *in_table, [&](const ChunkID chunk_id) {
+    const auto chunk = in_table->get_chunk(chunk_id);
+    auto keys = std::vector<std::string>(chunk->size());
+    auto null_values = std::vector<bool>(chunk->size());
+
+    for (auto key_part_id = size_t{0}; key_part_id < column_ids.size(); ++key_part_id) {
+      const auto& segment = *chunk->get_segment(column_ids[key_part_id]);
+
+      resolve_data_type(segment.data_type(), [&](auto column_type) {
+        using ColumnDataType = typename decltype(column_type)::type;
+
+        resolve_data_type(hashed_data_types[key_part_id], [&](auto hashed_type) {
+          using HashedType = typename decltype(hashed_type)::type;
+
+          auto offset = ChunkOffset{0};
+          segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+            const auto row_offset = offset++;
+            if (position.is_null()) {
+              null_values[row_offset] = true;
+              return;
+            }
+
+            auto& key = keys[row_offset];
+            if constexpr (std::is_same_v<HashedType, std::string>) {
+              const auto value = type_cast<std::string>(position.value());
+              const auto length = static_cast<uint32_t>(value.size());
+              key.append(reinterpret_cast<const char*>(&length), sizeof(length));
+              key.append(value);
+            } else {
+              auto value = type_cast<HashedType>(position.value());
+              // -0.0 and 0.0 are equal, but differ in their binary representation
+              if (value == HashedType{0}) value = HashedType{0};
+              key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+            }
+          });
+        });
+      });
+    }
+
+    key_segments[chunk_id] = std::make_shared<ValueSegment<std::string>>(std::move(keys), std::move(null_values));
+  });
+
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("key", DataType::String, true);
+  auto key_table = std::make_shared<Table>(column_definitions, TableType::Data, in_table->max_chunk_size());
+  for (auto& key_segment : key_segments) {
+    key_table->append_chunk({key_segment});
+  }
+
+  return key_table;
+}
+
+/*
+Runtime pruning of the probe relation: Returns for each chunk whether the statistics of its join column (e.g., Bloom
+filters, see SegmentStatistics) rule out every value of the build relation. For ReferenceSegments, the statistics of
+the referenced chunk are used if the segment references a single chunk. Chunks without statistics are not pruned.
+*/
+template <typename HashedType>
+std::vector<bool> determine_pruned_chunks(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                          const std::vector<HashedType>& build_values) {
+  auto pruned_chunks = std::vector<bool>(in_table->chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    const auto chunk = in_table->get_chunk(chunk_id);
+
+    auto statistics = chunk->statistics();
+    auto statistics_column_id = column_id;
+
+    if (const auto reference_segment =
+            std::dynamic_pointer_cast<const ReferenceSegment>(chunk->get_segment(column_id))) {
+      const auto& pos_list = *reference_segment->pos_list();
+      if (pos_list.empty() || !pos_list.references_single_chunk() || pos_list[0].is_null()) continue;
+
+      statistics = reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id())->statistics();
+      statistics_column_id = reference_segment->referenced_column_id();
+    }
+
+    if (!statistics) continue;
+
+    pruned_chunks[chunk_id] = std::all_of(build_values.cbegin(), build_values.cend(), [&](const auto& value) {
+      return statistics->can_prune(statistics_column_id, PredicateCondition::Equals, AllTypeVariant{value});
+    });
+  }
+
+  return pruned_chunks;
+}
+
+/*
+Runtime filter of the probe relation: Holds the value range and a Bloom filter of the values of the build relation.
+Probe rows whose values fail it cannot have a join partner, so that inner and semi joins can discard them during
+the materialization of the probe relation, before they are partitioned and probed. False positives of the Bloom
+filter are removed by the probe phase.
+*/
+template <typename HashedType>
+class RuntimeFilter {
+ public:
+  explicit RuntimeFilter(const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables) {
+    auto value_count = size_t{0};
+    for (const auto& hash_table : hash_tables) {
+      if (hash_table) value_count += hash_table->size();
+    }
+
+    // The optimal number of hash functions is ln(2) * bits per value (see BloomFilter::build_filter())
+    const auto hash_function_count = static_cast<size_t>(std::round(std::log(2.0) * BITS_PER_VALUE));
+    _bloom_filter.emplace(value_count * BITS_PER_VALUE, hash_function_count);
+
+    for (const auto& hash_table : hash_tables) {
+      if (!hash_table) continue;
+      hash_table->for_each([&](const auto& value, const auto& /*row_ids*/) {
+        if (!_min_value || value < *_min_value) _min_value = value;
+        if (!_max_value || value > *_max_value) _max_value = value;
+        _bloom_filter->insert(value);
+      });
+    }
+  }
+
+  bool may_contain(const HashedType& value) const {
+    // An empty build relation has no range, so that every value fails
+    if (!_min_value || value < *_min_value || value > *_max_value) return false;
+    return _bloom_filter->may_contain(value);
+  }
+
+ protected:
+  static constexpr auto BITS_PER_VALUE = DEFAULT_BLOOM_FILTER_BITS_PER_VALUE;
+
+  std::optional<HashedType> _min_value;
+  std::optional<HashedType> _max_value;
+  std::optional<BloomFilter<HashedType>> _bloom_filter;
+};
+
+/*
+Chunks for which pruned_chunks is set are skipped, their slots in the output remain empty (i.e., NULL_ROW_IDs). The
+same holds for rows whose values fail the runtime filter, which is only used when NULL values are discarded.
+*/
 template <typename T, typename HashedType, bool consider_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                    const std::vector<bool>& pruned_chunks = {},
+                                    const RuntimeFilter<HashedType>* runtime_filter = nullptr) {
+  DebugAssert(!runtime_filter || !consider_null_values, "Runtime filters would discard the NULL values.");
+
   const std::hash<HashedType> hash_function;
   // list of all elements that will be partitioned
   auto elements = std::make_shared<Partition<T>>(in_table->row_count());
@@ -121,26 +293,25 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
   // create histograms per chunk
   histograms.resize(chunk_offsets.size());
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(in_table->chunk_count());
+  MorselPlanner::for_each_chunk(OperatorType::JoinHash, *in_table, [&](const ChunkID chunk_id) {
+    // Get information from work queue
+    auto output_offset = chunk_offsets[chunk_id];
+    auto output_iterator = elements->begin() + output_offset;
+    auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-      // Get information from work queue
-      auto output_offset = chunk_offsets[chunk_id];
-      auto output_iterator = elements->begin() + output_offset;
-      auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
+    [[maybe_unused]] auto null_value_bitvector_iterator = null_value_bitvector->begin();
+    if constexpr (consider_null_values) {
+      null_value_bitvector_iterator += output_offset;
+    }
 
-      [[maybe_unused]] auto null_value_bitvector_iterator = null_value_bitvector->begin();
-      if constexpr (consider_null_values) {
-        null_value_bitvector_iterator += output_offset;
-      }
+    // prepare histogram
+    auto histogram = std::vector<size_t>(num_partitions);
 
-      // prepare histogram
-      auto histogram = std::vector<size_t>(num_partitions);
+    auto reference_chunk_offset = ChunkOffset{0};
 
-      auto reference_chunk_offset = ChunkOffset{0};
+    const auto is_pruned = !pruned_chunks.empty() && pruned_chunks[chunk_id];
 
+    if (!is_pruned) {
       segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
         using IterableType = typename decltype(it)::IterableType;
 
@@ -148,7 +319,11 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
           const auto& value = *it;
           ++it;
 
-          if (!value.is_null() || consider_null_values) {
+          // Rows that cannot have a join partner are discarded like NULL values
+          const auto is_filtered = runtime_filter && !value.is_null() &&
+                                   !runtime_filter->may_contain(type_cast<HashedType>(value.value()));
+
+          if ((!value.is_null() || consider_null_values) && !is_filtered) {
             const Hash hashed_value = hash_function(type_cast<HashedType>(value.value()));
 
             /*
@@ -179,35 +354,33 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
           }
         }
       });
+    }
 
-      if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
-        // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
-        auto output_offset_end = chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : elements->size();
-        while (output_iterator != elements->begin() + output_offset_end) {
-          *(output_iterator++) = PartitionedElement<T>{};
-        }
+    if constexpr (std::is_same_v<Partition<T>, uninitialized_vector<PartitionedElement<T>>>) {  // NOLINT
+      // Because the vector is uninitialized, we need to manually fill up all slots that we did not use
+      auto output_offset_end = chunk_id < chunk_offsets.size() - 1 ? chunk_offsets[chunk_id + 1] : elements->size();
+      while (output_iterator != elements->begin() + output_offset_end) {
+        *(output_iterator++) = PartitionedElement<T>{};
       }
+    }
 
-      histograms[chunk_id] = std::move(histogram);
-    }));
-    jobs.back()->schedule();
-  }
-  CurrentScheduler::wait_for_tasks(jobs);
+    histograms[chunk_id] = std::move(histogram);
+  });
 
   return RadixContainer<T>{elements, std::vector<size_t>{elements->size()}, null_value_bitvector};
 }
 
 /*
-Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left
+Build all the hash tables for the partitions of Left. We parallelize this process for all partitions of Left.
+Hash tables that are not placed on a specific NUMA node are allocated with `allocator`.
 */
 template <typename LeftType, typename HashedType>
-std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<LeftType>& radix_container) {
-  /*
-  NUMA notes:
-  The hashtables for each partition P should also reside on the same node as the two vectors leftP and rightP.
-  */
-  std::vector<std::optional<HashTable<HashedType>>> hashtables;
+std::vector<std::optional<PosHashTable<HashedType>>> build(
+    const RadixContainer<LeftType>& radix_container, const PosHashTableMode mode = PosHashTableMode::AllPositions,
+    const PolymorphicAllocator<size_t>& allocator = {}) {
+  std::vector<std::optional<PosHashTable<HashedType>>> hashtables;
   hashtables.resize(radix_container.partition_offsets.size());
+  const auto partition_count = radix_container.partition_offsets.size();
 
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size());
@@ -228,8 +401,11 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
                                                  partition_size]() {
       auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
 
-      // slightly oversize the hash table to avoid unnecessary rebuilds
-      auto hashtable = HashTable<HashedType>(static_cast<size_t>(partition_size * 1.2));
+      const auto node_id = partition_node_id(current_partition_id, partition_count);
+      const auto partition_allocator =
+          node_id == CURRENT_NODE_ID ? allocator
+                                     : PolymorphicAllocator<size_t>{Topology::get().get_memory_resource(node_id)};
+      auto hashtable = PosHashTable<HashedType>(partition_size, mode, partition_allocator);
 
       for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end; ++partition_offset) {
         auto& element = partition_left[partition_offset];
@@ -239,18 +415,13 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
           continue;
         }
 
-        auto casted_value = type_cast<HashedType>(std::move(element.value));
-        auto it = hashtable.find(casted_value);
-        if (it != hashtable.end()) {
-          it->second.emplace_back(element.row_id);
-        } else {
-          hashtable.emplace(casted_value, SmallPosList{element.row_id});
-        }
+        hashtable.insert(type_cast<HashedType>(std::move(element.value)), element.row_id);
       }
+      hashtable.finalize();
 
       hashtables[current_partition_id] = std::move(hashtable);
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(partition_node_id(current_partition_id, partition_count));
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
@@ -258,6 +429,85 @@ std::vector<std::optional<HashTable<HashedType>>> build(const RadixContainer<Lef
   return hashtables;
 }
 
+/*
+Semi and anti joins only need to know whether a value occurs in the build relation. If the build values are integers
+from a small range, a bitmap over that range answers this with a single bit test, so that neither the build relation
+is partitioned and hashed nor the probe relation is partitioned. Only defined for integral HashedTypes.
+*/
+template <typename HashedType>
+class DenseValueBitmap {
+ public:
+  // The bitmap is only used if it takes fewer bits per build row than this (a PosHashTable takes far more)
+  static constexpr auto MAX_BITS_PER_ROW = size_t{64};
+
+  DenseValueBitmap(const HashedType min_value, const HashedType max_value)
+      : _min_value(min_value), _bits(_offset(max_value) + 1) {}
+
+  void insert(const HashedType value) { _bits[_offset(value)] = true; }
+
+  bool contains(const HashedType value) const {
+    if (value < _min_value) return false;
+    const auto offset = _offset(value);
+    return offset < _bits.size() && _bits[offset];
+  }
+
+  // Calls functor(value) for each value in the bitmap
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    using UnsignedType = std::make_unsigned_t<HashedType>;
+    for (auto offset = size_t{0}; offset < _bits.size(); ++offset) {
+      if (_bits[offset]) functor(static_cast<HashedType>(static_cast<UnsignedType>(_min_value) + offset));
+    }
+  }
+
+ protected:
+  // Computed on the unsigned type, so that the distances within the whole value range do not overflow
+  size_t _offset(const HashedType value) const {
+    using UnsignedType = std::make_unsigned_t<HashedType>;
+    return static_cast<size_t>(static_cast<UnsignedType>(value) - static_cast<UnsignedType>(_min_value));
+  }
+
+  HashedType _min_value;
+  std::vector<bool> _bits;
+};
+
+// Returns a DenseValueBitmap of the build relation if its values are integers from a range that is small enough
+template <typename LeftType, typename HashedType>
+std::optional<DenseValueBitmap<HashedType>> build_dense_value_bitmap(const RadixContainer<LeftType>& radix_container) {
+  if constexpr (!std::is_integral_v<HashedType>) {
+    return std::nullopt;
+  } else {
+    const auto& elements = *radix_container.elements;
+
+    auto row_count = size_t{0};
+    auto min_value = std::numeric_limits<HashedType>::max();
+    auto max_value = std::numeric_limits<HashedType>::min();
+    for (const auto& element : elements) {
+      // Skip initialized PartitionedElements that might remain after materialization phase, like build()
+      if (element.row_id == NULL_ROW_ID) continue;
+
+      const auto value = type_cast<HashedType>(element.value);
+      min_value = std::min(min_value, value);
+      max_value = std::max(max_value, value);
+      ++row_count;
+    }
+
+    // Empty build relations are cheap to handle with (empty) hash tables
+    if (row_count == 0) return std::nullopt;
+
+    using UnsignedType = std::make_unsigned_t<HashedType>;
+    const auto range = static_cast<UnsignedType>(max_value) - static_cast<UnsignedType>(min_value);
+    if (range >= row_count * DenseValueBitmap<HashedType>::MAX_BITS_PER_ROW) return std::nullopt;
+
+    auto bitmap = DenseValueBitmap<HashedType>{min_value, max_value};
+    for (const auto& element : elements) {
+      if (element.row_id == NULL_ROW_ID) continue;
+      bitmap.insert(type_cast<HashedType>(element.value));
+    }
+    return bitmap;
+  }
+}
+
 template <typename T, typename HashedType, bool consider_null_values>
 RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_container,
                                            const std::vector<size_t>& chunk_offsets,
@@ -281,9 +531,11 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   size_t pass = 0;
   size_t mask = static_cast<uint32_t>(pow(2, radix_bits * (pass + 1)) - 1);
 
-  // allocate new (shared) output
+  // allocate new (shared) output. The partitions are written to at random, so they profit from huge pages if those
+  // were enabled. An uninitialized_vector does not touch its pages on resize, so they are backed after the advice.
   auto output = std::make_shared<Partition<T>>();
   output->resize(container_elements.size());
+  HugePageMemoryResource::advise_transparent_huge_pages(output->data(), output->size() * sizeof(PartitionedElement<T>));
 
   [[maybe_unused]] auto output_nulls = std::make_shared<std::vector<bool>>();
   if constexpr (consider_null_values) {
@@ -353,6 +605,155 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   return radix_output;
 }
 
+/*
+Grace hash join: If the partitions and hash tables of both relations do not fit into the memory budget (see JoinHash),
+each relation is radix partitioned straight into one SpillFile per partition, chunk by chunk, without materializing
+the whole relation first. Consecutive partitions whose elements fit into the budget are then loaded together by
+load_partitions() and joined by build() and probe() like in memory.
+
+An element is stored as its RowID, its NULL flag, and its value. Strings are preceded by their length.
+*/
+template <typename T>
+void write_partitioned_element(SpillFile& file, const PartitionedElement<T>& element, const bool is_null) {
+  file.write(&element.row_id, sizeof(RowID));
+  file.write(&is_null, sizeof(bool));
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto length = static_cast<uint32_t>(element.value.size());
+    file.write(&length, sizeof(length));
+    file.write(element.value.data(), length);
+  } else {
+    file.write(&element.value, sizeof(T));
+  }
+}
+
+// Returns false at the end of the file
+template <typename T>
+bool read_partitioned_element(SpillFile& file, PartitionedElement<T>& element, bool& is_null) {
+  if (!file.read(&element.row_id, sizeof(RowID))) return false;
+  Assert(file.read(&is_null, sizeof(bool)), "Spill file is truncated");
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto length = uint32_t{0};
+    Assert(file.read(&length, sizeof(length)), "Spill file is truncated");
+    element.value.resize(length);
+    Assert(file.read(element.value.data(), length), "Spill file is truncated");
+  } else {
+    Assert(file.read(&element.value, sizeof(T)), "Spill file is truncated");
+  }
+  return true;
+}
+
+// Writes the elements of the column into one new SpillFile per partition and returns the number of elements per
+// partition. The RowIDs are assigned like in materialize_input().
+template <typename T, typename HashedType, bool consider_null_values>
+std::vector<size_t> spill_partitions(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                     const size_t radix_bits, const std::string& directory,
+                                     std::vector<std::unique_ptr<SpillFile>>& spill_files) {
+  const std::hash<HashedType> hash_function;
+  const auto partition_count = size_t{1} << radix_bits;
+  const auto mask = partition_count - 1;
+
+  spill_files.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    spill_files.emplace_back(std::make_unique<SpillFile>(directory));
+  }
+  auto partition_sizes = std::vector<size_t>(partition_count);
+
+  // Each job partitions its chunk in memory and then appends the partitions to the files
+  auto spill_mutex = std::mutex{};
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(in_table->chunk_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto elements_by_partition = std::vector<std::vector<PartitionedElement<T>>>(partition_count);
+      auto nulls_by_partition = std::vector<std::vector<bool>>(partition_count);
+
+      const auto segment = in_table->get_chunk(chunk_id)->get_segment(column_id);
+      auto reference_chunk_offset = ChunkOffset{0};
+
+      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+        using IterableType = typename decltype(it)::IterableType;
+
+        for (; it != end; ++it) {
+          const auto& value = *it;
+
+          if (!value.is_null() || consider_null_values) {
+            const auto partition_id = hash_function(type_cast<HashedType>(value.value())) & mask;
+
+            // See materialize_input() for the RowIDs of ReferenceSegments
+            auto row_id = RowID{chunk_id, value.chunk_offset()};
+            if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
+              row_id = RowID{chunk_id, reference_chunk_offset};
+            }
+            elements_by_partition[partition_id].emplace_back(row_id, value.value());
+            nulls_by_partition[partition_id].emplace_back(value.is_null());
+          }
+
+          if constexpr (std::is_same_v<IterableType, ReferenceSegmentIterable<T>>) {
+            ++reference_chunk_offset;
+          }
+        }
+      });
+
+      const auto lock = std::lock_guard<std::mutex>{spill_mutex};
+      for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+        const auto& elements = elements_by_partition[partition_id];
+        for (auto element_id = size_t{0}; element_id < elements.size(); ++element_id) {
+          write_partitioned_element(*spill_files[partition_id], elements[element_id],
+                                    nulls_by_partition[partition_id][element_id]);
+        }
+        partition_sizes[partition_id] += elements.size();
+      }
+    }));
+    jobs.back()->schedule(in_table->get_chunk(chunk_id)->preferred_node_id());
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (auto& spill_file : spill_files) {
+    spill_file->rewind();
+  }
+
+  return partition_sizes;
+}
+
+// Reads the partitions [partition_begin, partition_end) written by spill_partitions() into a RadixContainer with one
+// partition each. The files are closed afterwards.
+template <typename T, bool consider_null_values>
+RadixContainer<T> load_partitions(std::vector<std::unique_ptr<SpillFile>>& spill_files,
+                                  const std::vector<size_t>& partition_sizes, const size_t partition_begin,
+                                  const size_t partition_end) {
+  auto radix_container = RadixContainer<T>{};
+  auto element_count = size_t{0};
+  for (auto partition_id = partition_begin; partition_id < partition_end; ++partition_id) {
+    element_count += partition_sizes[partition_id];
+    radix_container.partition_offsets.emplace_back(element_count);
+  }
+
+  radix_container.elements = std::make_shared<Partition<T>>(element_count);
+  radix_container.null_value_bitvector = std::make_shared<std::vector<bool>>();
+  if constexpr (consider_null_values) {
+    radix_container.null_value_bitvector->resize(element_count);
+  }
+
+  auto element_id = size_t{0};
+  for (auto partition_id = partition_begin; partition_id < partition_end; ++partition_id) {
+    auto element = PartitionedElement<T>{};
+    auto is_null = false;
+    while (read_partitioned_element(*spill_files[partition_id], element, is_null)) {
+      (*radix_container.elements)[element_id] = element;
+      if constexpr (consider_null_values) {
+        (*radix_container.null_value_bitvector)[element_id] = is_null;
+      }
+      ++element_id;
+    }
+    spill_files[partition_id].reset();
+  }
+  Assert(element_id == element_count, "Spill file is truncated");
+
+  return radix_container;
+}
+
 /*
   In the probe phase we take all partitions from the right partition, iterate over them and compare each join candidate
   with the values in the hash table. Since Left and Right are hashed using the same hash function, we can reduce the
@@ -360,18 +761,12 @@ RadixContainer<T> partition_radix_parallel(const RadixContainer<T>& radix_contai
   */
 template <typename RightType, typename HashedType, bool consider_null_values>
 void probe(const RadixContainer<RightType>& radix_container,
-           const std::vector<std::optional<HashTable<HashedType>>>& hashtables, std::vector<PosList>& pos_lists_left,
+           const std::vector<std::optional<PosHashTable<HashedType>>>& hashtables, std::vector<PosList>& pos_lists_left,
            std::vector<PosList>& pos_lists_right, const JoinMode mode) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size());
 
-  /*
-    NUMA notes:
-    At this point both input relations are partitioned using radix partitioning.
-    Probing will be done per partition for both sides.
-    Therefore, inputs for one partition should be located on the same NUMA node,
-    and the job that probes that partition should also be on that NUMA node.
-  */
+  // Each partition is probed on the node of its hash table, see partition_node_id()
   for (size_t current_partition_id = 0; current_partition_id < radix_container.partition_offsets.size();
        ++current_partition_id) {
     const auto partition_begin =
@@ -386,8 +781,9 @@ void probe(const RadixContainer<RightType>& radix_container,
     jobs.emplace_back(std::make_shared<JobTask>([&, partition_begin, partition_end, current_partition_id]() {
       // Get information from work queue
       auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
-      PosList pos_list_left_local;
-      PosList pos_list_right_local;
+      // The local PosLists are moved into the output PosLists, so they have to use the same allocators
+      PosList pos_list_left_local(pos_lists_left[current_partition_id].get_allocator());
+      PosList pos_list_right_local(pos_lists_right[current_partition_id].get_allocator());
 
       if constexpr (consider_null_values) {
         DebugAssert(
@@ -414,11 +810,10 @@ void probe(const RadixContainer<RightType>& radix_container,
             continue;
           }
 
-          const auto& rows_iter = hashtable.find(type_cast<HashedType>(row.value));
+          const auto matching_rows = hashtable.find(type_cast<HashedType>(row.value));
 
-          if (rows_iter != hashtable.end()) {
+          if (!matching_rows.empty()) {
             // Key exists, thus we have at least one hit
-            const auto& matching_rows = rows_iter->second;
 
             // Since we cannot store NULL values directly in off-the-shelf containers,
             // we need to the check the NULL bit vector here because a NULL value (represented
@@ -486,7 +881,7 @@ void probe(const RadixContainer<RightType>& radix_container,
         pos_lists_right[current_partition_id] = std::move(pos_list_right_local);
       }
     }));
-    jobs.back()->schedule();
+    jobs.back()->schedule(partition_node_id(current_partition_id, radix_container.partition_offsets.size()));
   }
 
   CurrentScheduler::wait_for_tasks(jobs);
@@ -494,7 +889,7 @@ void probe(const RadixContainer<RightType>& radix_container,
 
 template <typename RightType, typename HashedType>
 void probe_semi_anti(const RadixContainer<RightType>& radix_container,
-                     const std::vector<std::optional<HashTable<HashedType>>>& hashtables,
+                     const std::vector<std::optional<PosHashTable<HashedType>>>& hashtables,
                      std::vector<PosList>& pos_lists, const JoinMode mode) {
   std::vector<std::shared_ptr<AbstractTask>> jobs;
   jobs.reserve(radix_container.partition_offsets.size());
@@ -514,7 +909,7 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
       // Get information from work queue
       auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
 
-      PosList pos_list_local;
+      PosList pos_list_local(pos_lists[current_partition_id].get_allocator());
 
       if (hashtables[current_partition_id].has_value()) {
         // Valid hashtable found, so there is at least one match in this partition
@@ -527,9 +922,9 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
           }
 
           const auto& hashtable = hashtables[current_partition_id].value();
-          const auto it = hashtable.find(type_cast<HashedType>(row.value));
+          const auto has_match = hashtable.contains(type_cast<HashedType>(row.value));
 
-          if ((mode == JoinMode::Semi && it != hashtable.end()) || (mode == JoinMode::Anti && it == hashtable.end())) {
+          if ((mode == JoinMode::Semi && has_match) || (mode == JoinMode::Anti && !has_match)) {
             // Semi: found at least one match for this row -> match
             // Anti: no matching rows found -> match
             pos_list_local.emplace_back(row.row_id);
@@ -548,6 +943,58 @@ void probe_semi_anti(const RadixContainer<RightType>& radix_container,
         pos_lists[current_partition_id] = std::move(pos_list_local);
       }
     }));
+    jobs.back()->schedule(partition_node_id(current_partition_id, radix_container.partition_offsets.size()));
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+// Creates @param count empty PosLists with the given allocator (resizing a vector would use the default allocator)
+inline std::vector<PosList> create_pos_lists(const size_t count, const PosList::allocator_type& allocator) {
+  auto pos_lists = std::vector<PosList>{};
+  pos_lists.reserve(count);
+  for (auto pos_list_idx = size_t{0}; pos_list_idx < count; ++pos_list_idx) {
+    pos_lists.emplace_back(allocator);
+  }
+  return pos_lists;
+}
+
+/*
+Semi/anti probe against a DenseValueBitmap. The probe relation is not radix partitioned, so that each input chunk
+(see determine_chunk_offsets()) is probed by its own job and yields its own PosList.
+*/
+template <typename RightType, typename HashedType>
+void probe_semi_anti_dense(const RadixContainer<RightType>& radix_container,
+                           const DenseValueBitmap<HashedType>& bitmap, const std::vector<size_t>& chunk_offsets,
+                           std::vector<PosList>& pos_lists, const JoinMode mode,
+                           const PosList::allocator_type& allocator = {}) {
+  DebugAssert(radix_container.partition_offsets.size() == 1, "Expected a probe relation without radix partitions");
+
+  pos_lists = create_pos_lists(chunk_offsets.size(), allocator);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_offsets.size());
+
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_offsets.size(); ++chunk_index) {
+    const auto chunk_begin = chunk_offsets[chunk_index];
+    const auto chunk_end =
+        chunk_index + 1 < chunk_offsets.size() ? chunk_offsets[chunk_index + 1] : radix_container.elements->size();
+    if (chunk_begin == chunk_end) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index, chunk_begin, chunk_end]() {
+      const auto& partition = static_cast<const Partition<RightType>&>(*radix_container.elements);
+      auto& pos_list = pos_lists[chunk_index];
+
+      for (auto element_id = chunk_begin; element_id < chunk_end; ++element_id) {
+        const auto& row = partition[element_id];
+        if (row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) continue;
+
+        const auto has_match = bitmap.contains(type_cast<HashedType>(row.value));
+        if ((mode == JoinMode::Semi && has_match) || (mode == JoinMode::Anti && !has_match)) {
+          pos_list.emplace_back(row.row_id);
+        }
+      }
+    }));
     jobs.back()->schedule();
   }
 
@@ -606,7 +1053,7 @@ inline void write_output_segments(Segments& output_segments, const std::shared_p
         auto iter = output_pos_list_cache.find(input_table_pos_lists);
         if (iter == output_pos_list_cache.end()) {
           // Get the row ids that are referenced
-          auto new_pos_list = std::make_shared<PosList>(pos_list->size());
+          auto new_pos_list = std::make_shared<PosList>(pos_list->size(), pos_list->get_allocator());
           auto new_pos_list_iter = new_pos_list->begin();
           for (const auto& row : *pos_list) {
             if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Semi and anti joins only need to know whether a value occurs in the build relation. With SinglePosition, only the
+// first RowID of each value is kept and further inserts of the value are dropped, so that no overflow area is built.
+enum class PosHashTableMode { AllPositions, SinglePosition };
+
+/**
+ * The hash table that the build phase of the JoinHash creates for each radix partition. It maps the values of the
+ * build relation to the RowIDs of the rows that have them.
+ *
+ * Node-based hash maps with a small vector of RowIDs per value cost an allocation and a pointer chase for each build
+ * row. Instead, this table uses open addressing with linear probing on a flat array of slots. A slot stores the value
+ * and, for values that occur only once (e.g., primary keys), its RowID, so that a probe of such a value touches a
+ * single cache line. The RowIDs of values with duplicates are stored contiguously in a separate overflow area, and
+ * the slot only holds their offset.
+ *
+ * Until finalize() is called, a slot holds the first RowID of its value and the further RowIDs are appended to a list
+ * of pending duplicates. finalize() then scatters them into the overflow area, keeping the insertion order. The table
+ * is sized for the number of rows passed to the constructor, so that at most half of the slots are used.
+ *
+ * The slots and the overflow area are allocated with the given allocator, e.g., from the NUMA node that probes the
+ * table. In PosHashTableMode::SinglePosition, find() returns only the first RowID of a value.
+ */
+template <typename T>
+class PosHashTable {
+ public:
+  // The RowIDs of the build rows that have a probed value
+  class Matches {
+   public:
+    Matches() = default;
+    Matches(const RowID* begin, const RowID* end) : _begin(begin), _end(end) {}
+
+    const RowID* begin() const { return _begin; }
+    const RowID* end() const { return _end; }
+    size_t size() const { return static_cast<size_t>(_end - _begin); }
+    bool empty() const { return _begin == _end; }
+
+   private:
+    const RowID* _begin{nullptr};
+    const RowID* _end{nullptr};
+  };
+
+  explicit PosHashTable(const size_t max_row_count, const PosHashTableMode mode = PosHashTableMode::AllPositions,
+                        const PolymorphicAllocator<size_t>& allocator = {})
+      : _mode(mode), _slots(allocator), _overflow(allocator) {
+    Assert(max_row_count < std::numeric_limits<uint32_t>::max(), "Too many rows for a PosHashTable.");
+
+    auto slot_count = size_t{8};
+    while (slot_count < max_row_count * 2) slot_count *= 2;
+
+    _slots.resize(slot_count);
+    _slot_mask = slot_count - 1;
+    _slot_shift = 64u - static_cast<size_t>(__builtin_ctzll(slot_count));
+  }
+
+  void insert(const T& value, const RowID& row_id) {
+    DebugAssert(!_finalized, "Cannot insert into a finalized PosHashTable.");
+    DebugAssert(_row_count * 2 < _slots.size(), "PosHashTable was created for fewer rows.");
+
+    ++_row_count;
+
+    auto slot_id = _first_slot(value);
+    for (; _slots[slot_id].row_count != 0; slot_id = (slot_id + 1) & _slot_mask) {
+      auto& slot = _slots[slot_id];
+      if (slot.value == value) {
+        if (_mode == PosHashTableMode::SinglePosition) return;
+        ++slot.row_count;
+        _pending_duplicates.emplace_back(static_cast<uint32_t>(slot_id), row_id);
+        return;
+      }
+    }
+
+    auto& slot = _slots[slot_id];
+    slot.value = value;
+    slot.row_id = row_id;
+    slot.row_count = 1;
+    ++_value_count;
+  }
+
+  // Moves the RowIDs of values with duplicates into the overflow area. Needs to be called before the table is probed.
+  void finalize() {
+    DebugAssert(!_finalized, "PosHashTable was already finalized.");
+    _finalized = true;
+
+    if (_pending_duplicates.empty()) return;
+
+    // The already stored RowID goes first. Until the pending duplicates are scattered, overflow_offset points to the
+    // next free position of the slot's RowIDs.
+    auto overflow_size = uint32_t{0};
+    for (auto& slot : _slots) {
+      if (slot.row_count < 2) continue;
+      slot.overflow_offset = overflow_size + 1;
+      overflow_size += slot.row_count;
+    }
+
+    _overflow.resize(overflow_size);
+    for (auto& slot : _slots) {
+      if (slot.row_count >= 2) _overflow[slot.overflow_offset - 1] = slot.row_id;
+    }
+    for (const auto& [slot_id, row_id] : _pending_duplicates) {
+      _overflow[_slots[slot_id].overflow_offset++] = row_id;
+    }
+    for (auto& slot : _slots) {
+      if (slot.row_count >= 2) slot.overflow_offset -= slot.row_count;
+    }
+
+    _pending_duplicates.clear();
+    _pending_duplicates.shrink_to_fit();
+  }
+
+  Matches find(const T& value) const {
+    DebugAssert(_finalized, "PosHashTable has to be finalized before it is probed.");
+
+    for (auto slot_id = _first_slot(value);; slot_id = (slot_id + 1) & _slot_mask) {
+      const auto& slot = _slots[slot_id];
+      if (slot.row_count == 0) return Matches{};
+      if (slot.value == value) return _matches(slot);
+    }
+  }
+
+  bool contains(const T& value) const { return !find(value).empty(); }
+
+  // Calls functor(value, matches) for each distinct value
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    DebugAssert(_finalized, "PosHashTable has to be finalized before it is iterated.");
+
+    for (const auto& slot : _slots) {
+      if (slot.row_count != 0) functor(slot.value, _matches(slot));
+    }
+  }
+
+  // The number of distinct values
+  size_t size() const { return _value_count; }
+
+  bool empty() const { return _value_count == 0; }
+
+  // The number of inserted rows
+  size_t row_count() const { return _row_count; }
+
+ protected:
+  struct Slot {
+    T value{};
+    // The only RowID of the value, unused if the value has duplicates
+    RowID row_id{NULL_ROW_ID};
+    // 0 for empty slots
+    uint32_t row_count{0};
+    uint32_t overflow_offset{0};
+  };
+
+  size_t _first_slot(const T& value) const {
+    // The radix partitioning uses the lower bits of the hash, so they are the same for all values of a partition.
+    // Fibonacci hashing spreads them over the upper bits, which select the slot.
+    const auto hash = static_cast<uint64_t>(std::hash<T>{}(value)) * uint64_t{0x9E3779B97F4A7C15};
+    return static_cast<size_t>(hash >> _slot_shift);
+  }
+
+  Matches _matches(const Slot& slot) const {
+    // Slots with duplicates point to the overflow area
+    if (slot.row_count == 1) return Matches{&slot.row_id, &slot.row_id + 1};
+
+    const auto* begin = _overflow.data() + slot.overflow_offset;
+    return Matches{begin, begin + slot.row_count};
+  }
+
+  PosHashTableMode _mode;
+
+  pmr_vector<Slot> _slots;
+  size_t _slot_mask{0};
+  size_t _slot_shift{0};
+
+  pmr_vector<RowID> _overflow;
+  std::vector<std::pair<uint32_t, RowID>> _pending_duplicates;
+
+  size_t _value_count{0};
+  size_t _row_count{0};
+  bool _finalized{false};
+};
+
+}  // namespace opossum
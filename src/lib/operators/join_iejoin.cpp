@@ -0,0 +1,356 @@
+#include "join_iejoin.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "join_hash/join_hash_steps.hpp"
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The number of bits per word of the bit arrays
+constexpr auto WORD_SIZE = size_t{64};
+
+// The rows of a join input, with the values of the join columns replaced by their ranks (see rank_join_columns())
+struct JoinInput {
+  std::vector<RowID> row_ids;
+
+  // One vector of ranks per predicate
+  std::vector<std::vector<uint32_t>> ranks;
+
+  // True for the rows that have a NULL in any of the join columns
+  std::vector<bool> null_values;
+};
+
+JoinInput create_join_input(const Table& table) {
+  auto join_input = JoinInput{};
+  join_input.row_ids.reserve(table.row_count());
+  join_input.null_values.resize(table.row_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk_size = table.get_chunk(chunk_id)->size();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      join_input.row_ids.emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  return join_input;
+}
+
+// Materializes a column in the order of JoinInput::row_ids. NULLs are marked in null_values.
+template <typename T>
+std::vector<T> materialize_column(const Table& table, const ColumnID column_id, std::vector<bool>& null_values) {
+  auto values = std::vector<T>{};
+  values.reserve(table.row_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    segment_iterate<T>(*table.get_chunk(chunk_id)->get_segment(column_id), [&](const auto& position) {
+      if (position.is_null()) {
+        null_values[values.size()] = true;
+        values.emplace_back();
+      } else {
+        values.emplace_back(position.value());
+      }
+    });
+  }
+
+  return values;
+}
+
+/**
+ * Replaces the values of the two columns of a predicate by their ranks among the distinct values of both columns. For
+ * > and >=, the ranks are descending, so that every predicate can be evaluated as `left_rank < right_rank` or
+ * `left_rank <= right_rank`. The placeholders of NULLs get ranks as well, but are never looked at.
+ */
+void rank_join_columns(const Table& left_table, JoinInput& left_input, const Table& right_table,
+                       JoinInput& right_input, const OperatorJoinPredicate& predicate) {
+  const auto data_type = left_table.column_data_type(predicate.column_ids.first);
+  Assert(data_type == right_table.column_data_type(predicate.column_ids.second),
+         "JoinIEJoin requires both columns of a predicate to have the same data type");
+
+  const auto descending = predicate.predicate_condition == PredicateCondition::GreaterThan ||
+                          predicate.predicate_condition == PredicateCondition::GreaterThanEquals;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto left_values =
+        materialize_column<ColumnDataType>(left_table, predicate.column_ids.first, left_input.null_values);
+    const auto right_values =
+        materialize_column<ColumnDataType>(right_table, predicate.column_ids.second, right_input.null_values);
+
+    auto distinct_values = std::vector<ColumnDataType>{};
+    distinct_values.reserve(left_values.size() + right_values.size());
+    distinct_values.insert(distinct_values.end(), left_values.begin(), left_values.end());
+    distinct_values.insert(distinct_values.end(), right_values.begin(), right_values.end());
+    std::sort(distinct_values.begin(), distinct_values.end());
+    distinct_values.erase(std::unique(distinct_values.begin(), distinct_values.end()), distinct_values.end());
+
+    const auto rank_values = [&](const auto& values) {
+      auto ranks = std::vector<uint32_t>(values.size());
+      for (auto row_index = size_t{0}; row_index < values.size(); ++row_index) {
+        const auto rank = static_cast<uint32_t>(
+            std::lower_bound(distinct_values.begin(), distinct_values.end(), values[row_index]) -
+            distinct_values.begin());
+        ranks[row_index] = descending ? static_cast<uint32_t>(distinct_values.size() - 1u) - rank : rank;
+      }
+      return ranks;
+    };
+
+    left_input.ranks.emplace_back(rank_values(left_values));
+    right_input.ranks.emplace_back(rank_values(right_values));
+  });
+}
+
+// Returns the indices of the rows that have no NULL in the join columns, sorted by their ranks
+std::vector<size_t> sort_rows(const JoinInput& join_input, const std::vector<uint32_t>& ranks) {
+  auto rows = std::vector<size_t>{};
+  rows.reserve(join_input.row_ids.size());
+  for (auto row_index = size_t{0}; row_index < join_input.row_ids.size(); ++row_index) {
+    if (!join_input.null_values[row_index]) rows.emplace_back(row_index);
+  }
+
+  std::stable_sort(rows.begin(), rows.end(), [&](const auto lhs, const auto rhs) { return ranks[lhs] < ranks[rhs]; });
+  return rows;
+}
+
+// Returns the number of sorted left rows that satisfy the predicate for a right rank
+size_t matching_prefix_length(const std::vector<uint32_t>& sorted_left_ranks, const uint32_t right_rank,
+                              const bool strict) {
+  const auto end = strict ? std::lower_bound(sorted_left_ranks.begin(), sorted_left_ranks.end(), right_rank)
+                          : std::upper_bound(sorted_left_ranks.begin(), sorted_left_ranks.end(), right_rank);
+  return static_cast<size_t>(end - sorted_left_ranks.begin());
+}
+
+// Calls emit(left_row_index, right_row_index) for all pairs with `left_rank < right_rank` (or <= if not strict)
+template <typename Emit>
+void join_one_predicate(const JoinInput& left_input, const JoinInput& right_input, const bool strict,
+                        const Emit& emit) {
+  const auto& left_ranks = left_input.ranks[0];
+  const auto& right_ranks = right_input.ranks[0];
+
+  const auto left_rows = sort_rows(left_input, left_ranks);
+  auto sorted_left_ranks = std::vector<uint32_t>(left_rows.size());
+  for (auto position = size_t{0}; position < left_rows.size(); ++position) {
+    sorted_left_ranks[position] = left_ranks[left_rows[position]];
+  }
+
+  for (auto right_row_index = size_t{0}; right_row_index < right_input.row_ids.size(); ++right_row_index) {
+    if (right_input.null_values[right_row_index]) continue;
+
+    const auto match_count = matching_prefix_length(sorted_left_ranks, right_ranks[right_row_index], strict);
+    for (auto position = size_t{0}; position < match_count; ++position) {
+      emit(left_rows[position], right_row_index);
+    }
+  }
+}
+
+// Calls emit(left_row_index, right_row_index) for all pairs that satisfy both predicates (see class comment)
+template <typename Emit>
+void join_two_predicates(const JoinInput& left_input, const JoinInput& right_input, const bool first_strict,
+                         const bool second_strict, const Emit& emit) {
+  const auto& left_first_ranks = left_input.ranks[0];
+  const auto& left_second_ranks = left_input.ranks[1];
+  const auto& right_first_ranks = right_input.ranks[0];
+  const auto& right_second_ranks = right_input.ranks[1];
+
+  // The permutation arrays
+  const auto left_rows_by_first = sort_rows(left_input, left_first_ranks);
+  const auto left_rows_by_second = sort_rows(left_input, left_second_ranks);
+  const auto right_rows_by_first = sort_rows(right_input, right_first_ranks);
+
+  // The position of each left row in the bit array, which is ordered by the second predicate
+  auto bit_positions = std::vector<uint32_t>(left_input.row_ids.size());
+  auto sorted_left_second_ranks = std::vector<uint32_t>(left_rows_by_second.size());
+  for (auto position = size_t{0}; position < left_rows_by_second.size(); ++position) {
+    bit_positions[left_rows_by_second[position]] = static_cast<uint32_t>(position);
+    sorted_left_second_ranks[position] = left_second_ranks[left_rows_by_second[position]];
+  }
+
+  const auto word_count = (left_rows_by_second.size() + WORD_SIZE - 1u) / WORD_SIZE;
+  auto bits = std::vector<uint64_t>(word_count);
+  auto non_empty_words = std::vector<uint64_t>((word_count + WORD_SIZE - 1u) / WORD_SIZE);
+
+  auto next_left_row = left_rows_by_first.begin();
+
+  for (const auto right_row_index : right_rows_by_first) {
+    // Mark the left rows that satisfy the first predicate. As the right rows are visited in the order of the first
+    // predicate, these include all rows marked for the previous right rows.
+    const auto right_first_rank = right_first_ranks[right_row_index];
+    while (next_left_row != left_rows_by_first.end() &&
+           (first_strict ? left_first_ranks[*next_left_row] < right_first_rank
+                         : left_first_ranks[*next_left_row] <= right_first_rank)) {
+      const auto bit_position = bit_positions[*next_left_row];
+      const auto word_index = bit_position / WORD_SIZE;
+      bits[word_index] |= uint64_t{1} << (bit_position % WORD_SIZE);
+      non_empty_words[word_index / WORD_SIZE] |= uint64_t{1} << (word_index % WORD_SIZE);
+      ++next_left_row;
+    }
+
+    // Visit the marked rows in the prefix of the bit array that satisfies the second predicate
+    const auto prefix_length =
+        matching_prefix_length(sorted_left_second_ranks, right_second_ranks[right_row_index], second_strict);
+    const auto prefix_word_count = (prefix_length + WORD_SIZE - 1u) / WORD_SIZE;
+
+    for (auto group_index = size_t{0}; group_index * WORD_SIZE < prefix_word_count; ++group_index) {
+      auto group_mask = non_empty_words[group_index];
+      while (group_mask) {
+        const auto word_index = group_index * WORD_SIZE + __builtin_ctzll(group_mask);
+        group_mask &= group_mask - 1u;
+        if (word_index >= prefix_word_count) break;
+
+        auto word = bits[word_index];
+        if (word_index == prefix_length / WORD_SIZE) {
+          // The last word of the prefix is only partially part of it
+          word &= (uint64_t{1} << (prefix_length % WORD_SIZE)) - 1u;
+        }
+
+        while (word) {
+          const auto position = word_index * WORD_SIZE + __builtin_ctzll(word);
+          word &= word - 1u;
+          emit(left_rows_by_second[position], right_row_index);
+        }
+      }
+    }
+  }
+}
+
+bool is_strict(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::LessThan || predicate_condition == PredicateCondition::GreaterThan;
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinIEJoin::JoinIEJoin(const std::shared_ptr<const AbstractOperator>& left,
+                       const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                       const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+                       const std::optional<OperatorJoinPredicate>& secondary_predicate)
+    : AbstractJoinOperator(OperatorType::JoinIEJoin, left, right, mode, column_ids, predicate_condition),
+      _secondary_predicate(secondary_predicate) {
+  DebugAssert(mode == JoinMode::Inner || mode == JoinMode::Left || mode == JoinMode::Right || mode == JoinMode::Outer,
+              "JoinMode not supported by JoinIEJoin");
+  DebugAssert(supports(predicate_condition), "PredicateCondition not supported by JoinIEJoin");
+  DebugAssert(!secondary_predicate || supports(secondary_predicate->predicate_condition),
+              "PredicateCondition of the secondary predicate not supported by JoinIEJoin");
+}
+
+const std::string JoinIEJoin::name() const { return "JoinIEJoin"; }
+
+const std::string JoinIEJoin::description(DescriptionMode description_mode) const {
+  auto join_description = AbstractJoinOperator::description(description_mode);
+  if (!_secondary_predicate) return join_description;
+
+  const auto& [left_column_id, right_column_id] = _secondary_predicate->column_ids;
+  auto column_name_left = std::string("Column #") + std::to_string(left_column_id);
+  auto column_name_right = std::string("Column #") + std::to_string(right_column_id);
+
+  if (input_table_left()) column_name_left = input_table_left()->column_name(left_column_id);
+  if (input_table_right()) column_name_right = input_table_right()->column_name(right_column_id);
+
+  // Add the secondary predicate before the closing parenthesis
+  join_description.insert(join_description.size() - 1u, " AND " + column_name_left + " " +
+                                                  predicate_condition_to_string.left.at(
+                                                      _secondary_predicate->predicate_condition) +
+                                                  " " + column_name_right);
+  return join_description;
+}
+
+const std::optional<OperatorJoinPredicate>& JoinIEJoin::secondary_predicate() const { return _secondary_predicate; }
+
+bool JoinIEJoin::supports(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals ||
+         predicate_condition == PredicateCondition::GreaterThan ||
+         predicate_condition == PredicateCondition::GreaterThanEquals;
+}
+
+std::shared_ptr<AbstractOperator> JoinIEJoin::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<JoinIEJoin>(copied_input_left, copied_input_right, _mode, _column_ids, _predicate_condition,
+                                      _secondary_predicate);
+}
+
+void JoinIEJoin::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> JoinIEJoin::_on_execute() {
+  const auto left_table = input_table_left();
+  const auto right_table = input_table_right();
+
+  auto left_input = create_join_input(*left_table);
+  auto right_input = create_join_input(*right_table);
+
+  rank_join_columns(*left_table, left_input, *right_table, right_input,
+                    OperatorJoinPredicate{_column_ids, _predicate_condition});
+  if (_secondary_predicate) {
+    rank_join_columns(*left_table, left_input, *right_table, right_input, *_secondary_predicate);
+  }
+
+  auto left_pos_list = std::make_shared<PosList>();
+  auto right_pos_list = std::make_shared<PosList>();
+
+  // For outer joins, remember the rows that found a match
+  const auto track_left_matches = _mode == JoinMode::Left || _mode == JoinMode::Outer;
+  const auto track_right_matches = _mode == JoinMode::Right || _mode == JoinMode::Outer;
+  auto left_matches = std::vector<bool>(track_left_matches ? left_input.row_ids.size() : 0u);
+  auto right_matches = std::vector<bool>(track_right_matches ? right_input.row_ids.size() : 0u);
+
+  const auto emit = [&](const size_t left_row_index, const size_t right_row_index) {
+    left_pos_list->emplace_back(left_input.row_ids[left_row_index]);
+    right_pos_list->emplace_back(right_input.row_ids[right_row_index]);
+    if (track_left_matches) left_matches[left_row_index] = true;
+    if (track_right_matches) right_matches[right_row_index] = true;
+  };
+
+  if (_secondary_predicate) {
+    join_two_predicates(left_input, right_input, is_strict(_predicate_condition),
+                        is_strict(_secondary_predicate->predicate_condition), emit);
+  } else {
+    join_one_predicate(left_input, right_input, is_strict(_predicate_condition), emit);
+  }
+
+  // Add the unmatched rows of the outer inputs, including those with NULLs in the join columns
+  for (auto row_index = size_t{0}; row_index < left_matches.size(); ++row_index) {
+    if (left_matches[row_index]) continue;
+    left_pos_list->emplace_back(left_input.row_ids[row_index]);
+    right_pos_list->emplace_back(NULL_ROW_ID);
+  }
+
+  for (auto row_index = size_t{0}; row_index < right_matches.size(); ++row_index) {
+    if (right_matches[row_index]) continue;
+    left_pos_list->emplace_back(NULL_ROW_ID);
+    right_pos_list->emplace_back(right_input.row_ids[row_index]);
+  }
+
+  auto output_table = _initialize_output_table();
+  if (left_pos_list->empty()) return output_table;
+
+  auto left_pos_lists_by_segment = PosListsBySegment{};
+  auto right_pos_lists_by_segment = PosListsBySegment{};
+  if (left_table->type() == TableType::References) {
+    left_pos_lists_by_segment = setup_pos_lists_by_segment(left_table);
+  }
+  if (right_table->type() == TableType::References) {
+    right_pos_lists_by_segment = setup_pos_lists_by_segment(right_table);
+  }
+
+  Segments output_segments;
+  write_output_segments(output_segments, left_table, left_pos_lists_by_segment, left_pos_list);
+  write_output_segments(output_segments, right_table, right_pos_lists_by_segment, right_pos_list);
+  output_table->append_chunk(output_segments);
+
+  return output_table;
+}
+
+}  // namespace opossum
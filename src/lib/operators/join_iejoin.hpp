@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_join_operator.hpp"
+#include "operator_join_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * This operator joins two tables on one or two inequality predicates (<, <=, >, >=), e.g., events with the intervals
+ * that they fall into (ON e.ts >= i.begin AND e.ts <= i.end). It follows the IEJoin algorithm by Khayyat et al.
+ * ("Lightning Fast and Space Efficient Inequality Joins", VLDB 2015):
+ *
+ * The values of both join columns of a predicate are replaced by their ranks among the values of both inputs, so that
+ * the algorithm itself only compares integers. The rows of both inputs are then sorted by the first predicate
+ * (the permutation arrays). The right rows are visited in this order, and the left rows that satisfy the first
+ * predicate for the current right row are marked in a bit array, which is ordered by the second predicate. The
+ * matches of a right row are the marked rows in the prefix of the bit array that satisfies the second predicate. A
+ * second bit array marks which 64-bit words of the first one contain any marked rows, so that empty ranges are
+ * skipped. With only one predicate, the matches of each right row are a prefix of the sorted left rows.
+ *
+ * The runtime is O((n + m) * log(n + m)) plus the size of the output, instead of O(n * m) for a JoinNestedLoop or for
+ * a JoinSortMerge followed by a TableScan of the second predicate.
+ *
+ * Rows with NULL in any of the join columns never match. Inner, left, right and full outer joins are supported. Both
+ * columns of a predicate need to have the same data type.
+ */
+class JoinIEJoin : public AbstractJoinOperator {
+ public:
+  JoinIEJoin(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
+             const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+             const std::optional<OperatorJoinPredicate>& secondary_predicate = std::nullopt);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::optional<OperatorJoinPredicate>& secondary_predicate() const;
+
+  // Returns true for the conditions that this join can evaluate
+  static bool supports(const PredicateCondition predicate_condition);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::optional<OperatorJoinPredicate> _secondary_predicate;
+};
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -11,7 +12,9 @@
 #include "all_type_variant.hpp"
 #include "join_nested_loop.hpp"
 #include "resolve_type.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
@@ -75,46 +78,72 @@ void JoinIndex::_perform_join() {
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
-    const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+  // The index is probed with the left value, so the predicate condition is flipped
+  const auto use_table_index = input_table_right()->type() == TableType::Data &&
+                               BaseTableIndex::supports(flip_predicate_condition(_predicate_condition));
+  const auto right_table_index = use_table_index ? input_table_right()->get_table_index(_column_ids.second) : nullptr;
+
+  if (right_table_index) {
+    // A single lookup per left value covers all right chunks
+    if (track_right_matches) {
+      for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count();
+           ++chunk_id_right) {
+        _right_matches[chunk_id_right].resize(input_table_right()->get_chunk(chunk_id_right)->size());
+      }
+    }
 
-    std::shared_ptr<BaseIndex> index = nullptr;
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+      const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
 
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+      segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+        _join_segment_using_table_index(it, end, chunk_id_left, *right_table_index);
+      });
     }
+    performance_data.chunks_scanned_with_index += input_table_right()->chunk_count();
+  } else {
+    // Scan all chunks for right input
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+      const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
+      const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
+      if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
 
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+      std::shared_ptr<BaseIndex> index = nullptr;
 
-        segment_with_iterators(*segment_left, [&](auto it, const auto end) {
-          _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
-        });
-      }
-      performance_data.chunks_scanned_with_index++;
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _predicate_condition};
-        JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right, params);
+      // We assume the first index that supports the predicate to be efficient for our join
+      // as we do not want to spend time on evaluating the best index inside of this join loop
+      const auto index_it = std::find_if(indices.cbegin(), indices.cend(), [&](const auto& candidate) {
+        return BaseIndex::supports(candidate->type(), _predicate_condition);
+      });
+      if (index_it != indices.cend()) index = *index_it;
+
+      // Scan all chunks from left input
+      if (index != nullptr) {
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+
+          segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+            _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
+          });
+        }
+        performance_data.chunks_scanned_with_index++;
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+          JoinNestedLoop::JoinParams params{*_pos_list_left,
+                                            *_pos_list_right,
+                                            _left_matches[chunk_id_left],
+                                            _right_matches[chunk_id_right],
+                                            track_left_matches,
+                                            track_right_matches,
+                                            _mode,
+                                            _predicate_condition};
+          JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right,
+                                                     params);
+        }
+        performance_data.chunks_scanned_without_index++;
       }
-      performance_data.chunks_scanned_without_index++;
     }
   }
 
@@ -165,6 +194,29 @@ void JoinIndex::_perform_join() {
 template <typename LeftIterator>
 void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
                                                const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index) {
+  // The ART looks up all values of the left segment at once, interleaving the traversals of its nodes
+  if (_predicate_condition == PredicateCondition::Equals) {
+    if (const auto art_index = std::dynamic_pointer_cast<AdaptiveRadixTreeIndex>(index)) {
+      auto left_values = std::vector<AllTypeVariant>{};
+      auto left_chunk_offsets = std::vector<ChunkOffset>{};
+      for (; left_it != left_end; ++left_it) {
+        const auto left_value = *left_it;
+        if (left_value.is_null()) continue;
+
+        left_values.emplace_back(left_value.value());
+        left_chunk_offsets.emplace_back(left_value.chunk_offset());
+      }
+
+      const auto range_begins = art_index->lower_bounds(left_values);
+      const auto range_ends = art_index->upper_bounds(left_values);
+      for (auto value_idx = size_t{0}; value_idx < left_values.size(); ++value_idx) {
+        _append_matches(range_begins[value_idx], range_ends[value_idx], left_chunk_offsets[value_idx], chunk_id_left,
+                        chunk_id_right);
+      }
+      return;
+    }
+  }
+
   for (; left_it != left_end; ++left_it) {
     const auto left_value = *left_it;
     if (left_value.is_null()) continue;
@@ -218,6 +270,39 @@ void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterato
   }
 }
 
+// join loop that looks up each value of the left segment in the TableIndex of the right table
+template <typename LeftIterator>
+void JoinIndex::_join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end,
+                                                const ChunkID chunk_id_left, const BaseTableIndex& table_index) {
+  const auto predicate_condition = flip_predicate_condition(_predicate_condition);
+  const auto track_left_matches = (_mode == JoinMode::Left || _mode == JoinMode::Outer);
+  const auto track_right_matches = (_mode == JoinMode::Outer || _mode == JoinMode::Right);
+
+  auto right_matches = PosList{};
+
+  for (; left_it != left_end; ++left_it) {
+    const auto left_value = *left_it;
+    if (left_value.is_null()) continue;
+
+    right_matches.clear();
+    table_index.append_matches(predicate_condition, AllTypeVariant{left_value.value()}, std::nullopt, right_matches);
+
+    for (const auto& row_id_right : right_matches) {
+      // Skip rows that were added to the right table after the join started
+      if (row_id_right.chunk_id >= _right_matches.size()) continue;
+      if (track_right_matches) {
+        if (row_id_right.chunk_offset >= _right_matches[row_id_right.chunk_id].size()) continue;
+        _right_matches[row_id_right.chunk_id][row_id_right.chunk_offset] = true;
+      }
+
+      _pos_list_left->emplace_back(RowID{chunk_id_left, left_value.chunk_offset()});
+      _pos_list_right->emplace_back(row_id_right);
+
+      if (track_left_matches) _left_matches[chunk_id_left][left_value.chunk_offset()] = true;
+    }
+  }
+}
+
 // join loop that joins two segments of two columns via their iterators
 template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
 void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
@@ -338,7 +423,7 @@ void JoinIndex::_on_cleanup() {
 
 std::string JoinIndex::PerformanceData::to_string(DescriptionMode description_mode) const {
   std::string string = OperatorPerformanceData::to_string(description_mode);
-  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\n");
   string += std::to_string(chunks_scanned_with_index) + " of " +
             std::to_string(chunks_scanned_with_index + chunks_scanned_without_index) + " chunks used an index";
   return string;
@@ -8,6 +8,7 @@
 
 #include "abstract_join_operator.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/pos_list.hpp"
 #include "types.hpp"
 
@@ -17,7 +18,9 @@ namespace opossum {
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
-   * Note: An index needs to be present on the right table in order to execute an index join.
+   * Note: An index needs to be present on the right table in order to execute an index join. If the right table has
+   *       a TableIndex on the join column, each left value is looked up once for all chunks. Otherwise, the chunk
+   *       indexes are probed for each right chunk.
    * Note: Cross joins are not supported. Use the product operator instead.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -49,6 +52,10 @@ class JoinIndex : public AbstractJoinOperator {
   void _join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
                                       const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index);
 
+  template <typename LeftIterator>
+  void _join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
+                                       const BaseTableIndex& table_index);
+
   template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
   void _join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
                                       RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
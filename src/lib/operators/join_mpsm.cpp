@@ -102,6 +102,9 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   std::unique_ptr<PosList> _null_rows_left;
   std::unique_ptr<PosList> _null_rows_right;
 
+  // Values that make up a large share of the rows, sorted ascending. Their matches are emitted by separate jobs.
+  std::vector<T> _heavy_hitters;
+
   const ColumnID _left_column_id;
   const ColumnID _right_column_id;
 
@@ -111,7 +114,7 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   // the cluster count must be a power of two, i.e. 1, 2, 4, 8, 16, ...
   ClusterID _cluster_count;
 
-  // Contains the output row ids for each cluster
+  // Contains the output row ids for each cluster, followed by those of the jobs that join heavy hitters
   std::vector<std::vector<std::shared_ptr<PosList>>> _output_pos_lists_left;
   std::vector<std::vector<std::shared_ptr<PosList>>> _output_pos_lists_right;
 
@@ -208,8 +211,12 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
     auto cluster_number = left_run.start.cluster;
     auto partition_number = left_run.start.partition;
     switch (comparison_result) {
-      case ComparisonResult::Equal:
-        _emit_all_combinations(partition_number, cluster_number, left_run, right_run);
+      case ComparisonResult::Equal: {
+        // The matches of heavy hitters are emitted by the jobs created in _perform_join()
+        const auto& left_cluster = *(*_sorted_left_table)[partition_number].materialized_segments[cluster_number];
+        if (!_is_heavy_hitter(left_cluster[left_run.start.index].value)) {
+          _emit_all_combinations(partition_number, cluster_number, left_run, right_run);
+        }
 
         // Since we step multiple times over the left chunk
         // we need to memorize the joined rows for the left and outer case
@@ -220,6 +227,7 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
         }
 
         break;
+      }
       case ComparisonResult::Less:
         // This usually does something for the left join case
         // but we could hit an equal when stepping again over the left side
@@ -291,6 +299,71 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
     return result - start_position;
   }
 
+  bool _is_heavy_hitter(const T& value) const {
+    return !_heavy_hitters.empty() && std::binary_search(_heavy_hitters.begin(), _heavy_hitters.end(), value);
+  }
+
+  /**
+  * Creates the jobs that emit the matches of the heavy hitters in a cluster. For each partition of the
+  * right side, the larger of the two runs of a heavy hitter is split into slices, and each job joins one slice with
+  * the whole smaller run, so that the smaller run is broadcast to all jobs. Each job writes to an output pos list of
+  * its own in the last partition of the output pos lists.
+  **/
+  void _create_heavy_hitter_jobs(ClusterID cluster_number, std::vector<std::shared_ptr<AbstractTask>>& jobs) {
+    const auto left_node_id = static_cast<NodeID>(cluster_number);
+    const auto left_cluster_id = ClusterID{0};
+    const auto right_cluster_id = cluster_number;
+    const auto output_partition = static_cast<NodeID>(_output_pos_lists_left.size() - 1);
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
+
+    const auto& left_cluster = *(*_sorted_left_table)[left_node_id].materialized_segments[left_cluster_id];
+
+    for (const auto& heavy_hitter : _heavy_hitters) {
+      const auto value = MaterializedValue<T>{NULL_ROW_ID, heavy_hitter};
+      const auto [left_begin, left_end] = std::equal_range(left_cluster.begin(), left_cluster.end(), value, compare);
+      if (left_begin == left_end) continue;
+
+      const auto left_run =
+          TableRange(left_node_id, left_cluster_id, static_cast<size_t>(left_begin - left_cluster.begin()),
+                     static_cast<size_t>(left_end - left_cluster.begin()));
+      const auto left_run_size = static_cast<size_t>(left_end - left_begin);
+
+      for (auto right_node_id = NodeID{0}; right_node_id < static_cast<NodeID>(_cluster_count); ++right_node_id) {
+        const auto& right_cluster = *(*_sorted_right_table)[right_node_id].materialized_segments[right_cluster_id];
+        const auto [right_begin, right_end] =
+            std::equal_range(right_cluster.begin(), right_cluster.end(), value, compare);
+
+        // Without matches, the merge handles the run (e.g., for outer joins)
+        if (right_begin == right_end) continue;
+
+        const auto right_run =
+            TableRange(right_node_id, right_cluster_id, static_cast<size_t>(right_begin - right_cluster.begin()),
+                       static_cast<size_t>(right_end - right_cluster.begin()));
+        const auto right_run_size = static_cast<size_t>(right_end - right_begin);
+        const auto slice_left = left_run_size >= right_run_size;
+        const auto& larger_run = slice_left ? left_run : right_run;
+        const auto slice_size =
+            std::max(size_t{1}, HEAVY_HITTER_JOB_ROW_COUNT / std::min(left_run_size, right_run_size));
+
+        for (auto slice_start = larger_run.start.index; slice_start < larger_run.end.index; slice_start += slice_size) {
+          const auto slice_end = std::min(slice_start + slice_size, larger_run.end.index);
+          const auto slice =
+              TableRange(larger_run.start.partition, larger_run.start.cluster, slice_start, slice_end);
+          const auto output_cluster = static_cast<ClusterID>(_output_pos_lists_left[output_partition].size());
+          _output_pos_lists_left[output_partition].emplace_back(std::make_shared<PosList>());
+          _output_pos_lists_right[output_partition].emplace_back(std::make_shared<PosList>());
+
+          const auto job_left_run = slice_left ? slice : left_run;
+          const auto job_right_run = slice_left ? right_run : slice;
+          jobs.push_back(
+              std::make_shared<JobTask>([this, output_partition, output_cluster, job_left_run, job_right_run] {
+                _emit_all_combinations(output_partition, output_cluster, job_left_run, job_right_run);
+              }));
+        }
+      }
+    }
+  }
+
   /**
   * Compares two values and creates a comparison result.
   **/
@@ -386,6 +459,20 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
   void _perform_join() {
     auto jobs = std::vector<std::shared_ptr<AbstractTask>>();
 
+    // The output pos lists of the heavy hitter jobs form an additional partition. They are all created before any job
+    // is scheduled.
+    if (!_heavy_hitters.empty()) {
+      _output_pos_lists_left.emplace_back();
+      _output_pos_lists_right.emplace_back();
+      for (auto cluster_number = ClusterID{0}; cluster_number < _cluster_count; ++cluster_number) {
+        _create_heavy_hitter_jobs(cluster_number, jobs);
+      }
+
+      for (const auto& job : jobs) {
+        job->schedule();
+      }
+    }
+
     // Parallel join for each cluster
     for (auto cluster_number = ClusterID{0}; cluster_number < _cluster_count; ++cluster_number) {
       jobs.push_back(std::make_shared<JobTask>([this, cluster_number] { this->_join_cluster(cluster_number); }));
@@ -497,6 +584,7 @@ class JoinMPSM::JoinMPSMImpl : public AbstractJoinOperatorImpl {
     _sorted_right_table = std::move(sort_output.clusters_right);
     _null_rows_left = std::move(sort_output.null_rows_left);
     _null_rows_right = std::move(sort_output.null_rows_right);
+    _heavy_hitters = std::move(sort_output.heavy_hitters);
 
     // this generates the actual join results and fills the _output_pos_lists
     _perform_join();
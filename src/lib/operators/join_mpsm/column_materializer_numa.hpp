@@ -53,12 +53,18 @@ using MaterializedNUMAPartitionList = std::vector<MaterializedNUMAPartition<T>>;
 
 /**
  * Materializes a table for a specific column and sorts it if required. Row-Ids are kept in order to enable
- * the construction of pos lists for the algorithms that are using this class.
+ * the construction of pos lists for the algorithms that are using this class. Chunks that are ordered descending by
+ * the column (see Chunk::ordered_by()) are reversed, so that all ordered chunks are materialized in ascending order.
+ * If sampling is enabled, every sample_stride()-th value of each materialized chunk is collected.
  **/
 template <typename T>
 class ColumnMaterializerNUMA {
  public:
-  explicit ColumnMaterializerNUMA(bool materialize_null) : _materialize_null{materialize_null} {}
+  // The average number of values sampled from each chunk if sampling is enabled
+  static constexpr auto SAMPLES_PER_CHUNK = size_t{128};
+
+  explicit ColumnMaterializerNUMA(bool materialize_null, bool sample = false)
+      : _materialize_null{materialize_null}, _sample{sample} {}
 
  public:
   /**
@@ -81,6 +87,10 @@ class ColumnMaterializerNUMA {
     }
     auto null_rows = std::make_unique<PosList>();
 
+    _samples_per_chunk.assign(_sample ? input->chunk_count() : 0, std::vector<T>{});
+    const auto sample_count = std::max(size_t{1}, input->chunk_count() * SAMPLES_PER_CHUNK);
+    _sample_stride = std::max(size_t{1}, input->row_count() / sample_count);
+
     auto jobs = std::vector<std::shared_ptr<AbstractTask>>();
     for (auto chunk_id = ChunkID{0}; chunk_id < input->chunk_count(); ++chunk_id) {
       // This allocator is used to ensure that materialized chunks are colocated with the original chunks
@@ -110,6 +120,20 @@ class ColumnMaterializerNUMA {
     return std::make_pair(std::move(output), std::move(null_rows));
   }
 
+  /**
+   * Returns the values sampled from the chunks materialized by the last call of materialize(). NULLs are not sampled.
+   **/
+  std::vector<T> samples() const {
+    auto samples = std::vector<T>{};
+    for (const auto& chunk_samples : _samples_per_chunk) {
+      samples.insert(samples.end(), chunk_samples.begin(), chunk_samples.end());
+    }
+    return samples;
+  }
+
+  // Each sampled value represents this number of materialized values
+  size_t sample_stride() const { return _sample_stride; }
+
  private:
   /**
    * Creates a job to materialize and sort a chunk.
@@ -120,19 +144,44 @@ class ColumnMaterializerNUMA {
     // This allocator ensures that materialized values are colocated with the actual values.
     auto alloc = MaterializedValueAllocator<T>{input->get_chunk(chunk_id)->get_allocator()};
 
-    const auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
+    const auto chunk = input->get_chunk(chunk_id);
+    const auto segment = chunk->get_segment(column_id);
+    const auto& ordered_by = chunk->ordered_by();
+    const auto is_descending = ordered_by && ordered_by->first == column_id &&
+                               (ordered_by->second == OrderByMode::Descending ||
+                                ordered_by->second == OrderByMode::DescendingNullsLast);
 
     return std::make_shared<JobTask>(
-        [this, &output, &null_rows_output, segment, chunk_id, alloc, numa_node_id] {
+        [this, &output, &null_rows_output, segment, chunk_id, alloc, numa_node_id, is_descending] {
+          auto& partition = (*output)[numa_node_id];
           if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
-            _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, (*output)[numa_node_id]);
+            _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, partition);
           } else {
-            _materialize_generic_segment(*segment, chunk_id, null_rows_output, (*output)[numa_node_id]);
+            _materialize_generic_segment(*segment, chunk_id, null_rows_output, partition);
+          }
+
+          // The NULLs are not materialized, so a descending segment is sorted once it is reversed
+          if (is_descending) {
+            auto& materialized_segment = *partition.materialized_segments[chunk_id];
+            std::reverse(materialized_segment.begin(), materialized_segment.end());
+          }
+
+          if (_sample) {
+            _samples_per_chunk[chunk_id] = _sample_values(*partition.materialized_segments[chunk_id]);
           }
         },
         SchedulePriority::Default, false);
   }
 
+  std::vector<T> _sample_values(const MaterializedSegment<T>& segment) const {
+    auto samples = std::vector<T>{};
+    samples.reserve(segment.size() / _sample_stride + 1);
+    for (auto index = size_t{0}; index < segment.size(); index += _sample_stride) {
+      samples.emplace_back(segment[index].value);
+    }
+    return samples;
+  }
+
   /**
    * Materialization works for all types of segments
    */
@@ -185,6 +234,11 @@ class ColumnMaterializerNUMA {
 
  private:
   bool _materialize_null;
+  bool _sample;
+  size_t _sample_stride{1};
+
+  // Written by the materialization job of each chunk
+  std::vector<std::vector<T>> _samples_per_chunk;
 };
 
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #include "join_nested_loop.hpp"
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -9,6 +11,9 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterate.hpp"
@@ -52,6 +57,49 @@ void join_two_typed_segments(const BinaryFunctor& func, LeftIterator left_it, Le
     }
   }
 }
+
+template <typename T>
+void materialize_chunk(const BaseSegment& segment, JoinNestedLoop::MaterializedChunk<T>& materialized_chunk) {
+  materialized_chunk.values.reserve(segment.size());
+  materialized_chunk.chunk_offsets.reserve(segment.size());
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) return;
+    materialized_chunk.values.emplace_back(position.value());
+    materialized_chunk.chunk_offsets.emplace_back(position.chunk_offset());
+  });
+}
+
+// Number of right values that are compared with a left value at once. The results of a block stay in the L1 cache,
+// and the compiler vectorizes the comparisons of numeric values, as they are written without branches.
+constexpr auto RIGHT_BLOCK_SIZE = size_t{1024};
+
+// Joins the materialized values of two chunks, left values in the outer loop, to keep the order of JoinNestedLoop
+template <typename Comparator, typename LeftType, typename RightType>
+void join_materialized_chunks(const Comparator& comparator, const JoinNestedLoop::MaterializedChunk<LeftType>& left,
+                              const ChunkID chunk_id_left, const JoinNestedLoop::MaterializedChunk<RightType>& right,
+                              const ChunkID chunk_id_right, PosList& pos_list_left, PosList& pos_list_right) {
+  auto block_matches = std::array<uint8_t, RIGHT_BLOCK_SIZE>{};
+  const auto right_size = right.values.size();
+
+  for (auto left_index = size_t{0}; left_index < left.values.size(); ++left_index) {
+    const auto& left_value = left.values[left_index];
+
+    for (auto block_begin = size_t{0}; block_begin < right_size; block_begin += RIGHT_BLOCK_SIZE) {
+      const auto block_size = std::min(RIGHT_BLOCK_SIZE, right_size - block_begin);
+      const auto* right_values = right.values.data() + block_begin;
+
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        block_matches[index] = comparator(left_value, right_values[index]);
+      }
+
+      for (auto index = size_t{0}; index < block_size; ++index) {
+        if (!block_matches[index]) continue;
+        pos_list_left.emplace_back(RowID{chunk_id_left, left.chunk_offsets[left_index]});
+        pos_list_right.emplace_back(RowID{chunk_id_right, right.chunk_offsets[block_begin + index]});
+      }
+    }
+  }
+}
 }  // namespace
 
 namespace opossum {
@@ -59,8 +107,9 @@ namespace opossum {
 /*
  * This is a Nested Loop Join implementation completely based on iterables.
  * It supports all current join and predicate conditions, as well as NULL values.
+ * The values of both inputs are materialized per chunk, and the pairs of chunks are joined in parallel jobs.
  * Because this is a Nested Loop Join, the performance is going to be far inferior to JoinHash and JoinSortMerge,
- * so only use this for testing or benchmarking purposes.
+ * so only use this for testing or benchmarking purposes, or for predicates that the other joins do not support.
  */
 
 JoinNestedLoop::JoinNestedLoop(const std::shared_ptr<const AbstractOperator>& left,
@@ -155,27 +204,82 @@ void JoinNestedLoop::_perform_join() {
 
   _is_outer_join = (_mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::Outer);
 
-  // Scan all chunks from left input
-  _right_matches.resize(right_table->chunk_count());
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < left_table->chunk_count(); ++chunk_id_left) {
-    auto segment_left = left_table->get_chunk(chunk_id_left)->get_segment(left_column_id);
+  const auto left_chunk_count = left_table->chunk_count();
+  const auto right_chunk_count = right_table->chunk_count();
 
-    // for Outer joins, remember matches on the left side
-    std::vector<bool> left_matches;
+  // Each block joins a left chunk with a range of right chunks, so that jobs are not too small for large numbers of
+  // small chunks. Blocks are in the order of the left chunks.
+  auto right_chunk_sizes = std::vector<size_t>(right_chunk_count);
+  for (auto chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+    right_chunk_sizes[chunk_id_right] = right_table->get_chunk(chunk_id_right)->size();
+  }
 
-    if (_is_outer_join) {
-      left_matches.resize(segment_left->size());
+  auto blocks = std::vector<Block>{};
+  for (auto chunk_id_left = ChunkID{0}; chunk_id_left < left_chunk_count; ++chunk_id_left) {
+    const auto left_chunk_size = left_table->get_chunk(chunk_id_left)->size();
+    auto row_pairs = size_t{0};
+    auto right_begin = ChunkID{0};
+    for (auto chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+      row_pairs += left_chunk_size * right_chunk_sizes[chunk_id_right];
+      if (row_pairs >= MIN_ROW_PAIRS_PER_JOB || chunk_id_right + 1 == right_chunk_count) {
+        blocks.emplace_back(Block{chunk_id_left, right_begin, ChunkID{chunk_id_right + 1}, {}, {}});
+        right_begin = ChunkID{chunk_id_right + 1};
+        row_pairs = 0;
+      }
+    }
+  }
+
+  resolve_data_type(left_table->column_data_type(left_column_id), [&](auto left_type) {
+    resolve_data_type(right_table->column_data_type(right_column_id), [&](auto right_type) {
+      using LeftType = typename decltype(left_type)::type;
+      using RightType = typename decltype(right_type)::type;
+
+      if constexpr (std::is_same_v<LeftType, std::string> == std::is_same_v<RightType, std::string>) {
+        _join_blocks<LeftType, RightType>(*left_table, left_column_id, *right_table, right_column_id, blocks);
+      } else {
+        Fail("Cannot join String with non-String column");
+      }
+    });
+  });
+
+  // Merge the matches of the blocks in their order, so that the output does not depend on the scheduling
+  auto match_count = size_t{0};
+  for (const auto& block : blocks) {
+    match_count += block.pos_list_left.size();
+  }
+  _pos_list_left->reserve(match_count);
+  _pos_list_right->reserve(match_count);
+
+  // for Full Outer, remember the matches on the right side
+  auto right_matches = std::vector<std::vector<bool>>{};
+  if (_mode == JoinMode::Outer) {
+    right_matches.resize(right_chunk_count);
+    for (auto chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+      right_matches[chunk_id_right].resize(right_chunk_sizes[chunk_id_right]);
     }
+  }
+
+  auto block_it = blocks.cbegin();
+  for (auto chunk_id_left = ChunkID{0}; chunk_id_left < left_chunk_count; ++chunk_id_left) {
+    // for Outer joins, remember matches on the left side
+    auto left_matches = std::vector<bool>{};
+    if (_is_outer_join) left_matches.resize(left_table->get_chunk(chunk_id_left)->size());
 
-    // Scan all chunks for right input
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
-      const auto segment_right = right_table->get_chunk(chunk_id_right)->get_segment(right_column_id);
-      _right_matches[chunk_id_right].resize(segment_right->size());
+    for (; block_it != blocks.cend() && block_it->chunk_id_left == chunk_id_left; ++block_it) {
+      _pos_list_left->insert(_pos_list_left->end(), block_it->pos_list_left.cbegin(), block_it->pos_list_left.cend());
+      _pos_list_right->insert(_pos_list_right->end(), block_it->pos_list_right.cbegin(),
+                              block_it->pos_list_right.cend());
 
-      const auto track_right_matches = (_mode == JoinMode::Outer);
-      JoinParams params{*_pos_list_left, *_pos_list_right,    left_matches, _right_matches[chunk_id_right],
-                        _is_outer_join,  track_right_matches, _mode,        _predicate_condition};
-      _join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right, params);
+      if (_is_outer_join) {
+        for (const auto& row_id : block_it->pos_list_left) {
+          left_matches[row_id.chunk_offset] = true;
+        }
+      }
+      if (_mode == JoinMode::Outer) {
+        for (const auto& row_id : block_it->pos_list_right) {
+          right_matches[row_id.chunk_id][row_id.chunk_offset] = true;
+        }
+      }
     }
 
     if (_is_outer_join) {
@@ -192,16 +296,13 @@ void JoinNestedLoop::_perform_join() {
   // For Full Outer we need to add all unmatched rows for the right side.
   // Unmatched rows on the left side are already added in the main loop above
   if (_mode == JoinMode::Outer) {
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
-      const auto segment_right = right_table->get_chunk(chunk_id_right)->get_segment(right_column_id);
-
-      segment_iterate(*segment_right, [&](const auto& position) {
-        const auto row_id = RowID{chunk_id_right, position.chunk_offset()};
-        if (!_right_matches[chunk_id_right][row_id.chunk_offset]) {
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_chunk_count; ++chunk_id_right) {
+      for (ChunkOffset chunk_offset{0}; chunk_offset < right_matches[chunk_id_right].size(); ++chunk_offset) {
+        if (!right_matches[chunk_id_right][chunk_offset]) {
           _pos_list_left->emplace_back(NULL_ROW_ID);
-          _pos_list_right->emplace_back(row_id);
+          _pos_list_right->emplace_back(RowID{chunk_id_right, chunk_offset});
         }
-      });
+      }
     }
   }
 
@@ -219,6 +320,51 @@ void JoinNestedLoop::_perform_join() {
   _output_table->append_chunk(segments);
 }
 
+template <typename LeftType, typename RightType>
+void JoinNestedLoop::_join_blocks(const Table& left_table, const ColumnID left_column_id, const Table& right_table,
+                                  const ColumnID right_column_id, std::vector<Block>& blocks) const {
+  // Materialize the non-NULL values of all chunks once, as every chunk is joined with all chunks of the other side
+  auto left_chunks = std::vector<MaterializedChunk<LeftType>>(left_table.chunk_count());
+  auto right_chunks = std::vector<MaterializedChunk<RightType>>(right_table.chunk_count());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(left_chunks.size() + right_chunks.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < left_chunks.size(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      materialize_chunk(*left_table.get_chunk(chunk_id)->get_segment(left_column_id), left_chunks[chunk_id]);
+    }));
+    jobs.back()->schedule();
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < right_chunks.size(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      materialize_chunk(*right_table.get_chunk(chunk_id)->get_segment(right_column_id), right_chunks[chunk_id]);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  jobs.clear();
+
+  // Each block writes its matches into its own PosLists, which are merged afterwards
+  jobs.reserve(blocks.size());
+  for (auto& block : blocks) {
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      with_comparator(_predicate_condition, [&](auto comparator) {
+        for (auto chunk_id_right = block.chunk_id_right_begin; chunk_id_right < block.chunk_id_right_end;
+             ++chunk_id_right) {
+          join_materialized_chunks(comparator, left_chunks[block.chunk_id_left], block.chunk_id_left,
+                                   right_chunks[chunk_id_right], chunk_id_right, block.pos_list_left,
+                                   block.pos_list_right);
+
+          // Joining all pairs of chunks takes long, let queued tasks of higher priority run in between
+          CurrentScheduler::yield();
+        }
+      });
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
 void JoinNestedLoop::_write_output_chunks(Segments& segments, const std::shared_ptr<const Table>& input_table,
                                           const std::shared_ptr<PosList>& pos_list) {
   // Add segments from table to output chunk
@@ -265,7 +411,6 @@ void JoinNestedLoop::_on_cleanup() {
   _output_table.reset();
   _pos_list_left.reset();
   _pos_list_right.reset();
-  _right_matches.clear();
 }
 
 }  // namespace opossum
@@ -33,6 +33,16 @@ class JoinNestedLoop : public AbstractJoinOperator {
     const PredicateCondition predicate_condition;
   };
 
+  // The non-NULL values of a segment and their offsets in the chunk
+  template <typename T>
+  struct MaterializedChunk {
+    std::vector<T> values;
+    std::vector<ChunkOffset> chunk_offsets;
+  };
+
+  // A left chunk and a range of right chunks are joined by a job if the chunks have at least this many pairs of rows
+  static constexpr auto MIN_ROW_PAIRS_PER_JOB = size_t{1'000'000};
+
  protected:
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -44,6 +54,21 @@ class JoinNestedLoop : public AbstractJoinOperator {
 
   void _perform_join();
 
+  // The matches of a left chunk with the right chunks in [chunk_id_right_begin, chunk_id_right_end)
+  struct Block {
+    ChunkID chunk_id_left;
+    ChunkID chunk_id_right_begin;
+    ChunkID chunk_id_right_end;
+    PosList pos_list_left;
+    PosList pos_list_right;
+  };
+
+  // Joins the blocks in parallel jobs
+  template <typename LeftType, typename RightType>
+  void __attribute__((noinline))
+  _join_blocks(const Table& left_table, const ColumnID left_column_id, const Table& right_table,
+               const ColumnID right_column_id, std::vector<Block>& blocks) const;
+
   // Having all these static methods and passing around the state of the JoinNestedLoop is somewhat ugly, but it allows
   // us to reuse the code in JoinIndex as a fallback. __attribute__((noinline)) is simply magic - otherwise the
   // compiler would try to put the entire join for all types into a single, monolithic function. For -O3 on clang, this
@@ -67,9 +92,6 @@ class JoinNestedLoop : public AbstractJoinOperator {
   std::shared_ptr<PosList> _pos_list_left;
   std::shared_ptr<PosList> _pos_list_right;
 
-  // for Full Outer, remember the matches on the right side
-  std::vector<std::vector<bool>> _right_matches;
-
   // The JoinIndex uses this join as a fallback if no index exists
   friend class JoinIndex;
 };
@@ -0,0 +1,131 @@
+#include "join_partition_wise.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "join_adaptive.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "table_wrapper.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+JoinPartitionWise::JoinPartitionWise(const std::shared_ptr<const AbstractOperator>& left,
+                                     const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                                     const ColumnIDPair& column_ids, const PredicateCondition predicate_condition)
+    : AbstractJoinOperator(OperatorType::JoinPartitionWise, left, right, mode, column_ids, predicate_condition) {
+  // Rows without a join partner in the other input's partition would have to be emitted for outer and anti joins
+  Assert(mode == JoinMode::Inner, "Partition-wise joins are only supported for inner joins.");
+  Assert(predicate_condition == PredicateCondition::Equals,
+         "Partition-wise joins are only supported for equality predicates.");
+}
+
+const std::string JoinPartitionWise::name() const { return "JoinPartitionWise"; }
+
+const std::optional<size_t>& JoinPartitionWise::joined_partition_count() const { return _joined_partition_count; }
+
+std::shared_ptr<AbstractOperator> JoinPartitionWise::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<JoinPartitionWise>(copied_input_left, copied_input_right, _mode, _column_ids,
+                                             _predicate_condition);
+}
+
+std::shared_ptr<const Table> JoinPartitionWise::_on_execute() {
+  const auto left_chunk_ids_by_partition = _chunk_ids_by_partition(*input_table_left());
+  const auto right_chunk_ids_by_partition = _chunk_ids_by_partition(*input_table_right());
+
+  if (!left_chunk_ids_by_partition || !right_chunk_ids_by_partition) {
+    const auto join =
+        std::make_shared<JoinAdaptive>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+    join->execute();
+    return join->get_output();
+  }
+
+  // Partitions that only one of the inputs has rows of do not contribute to the output of an inner join
+  const auto partition_count = std::min(left_chunk_ids_by_partition->size(), right_chunk_ids_by_partition->size());
+  auto partition_outputs = std::vector<std::shared_ptr<const Table>>(partition_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    const auto& left_chunk_ids = (*left_chunk_ids_by_partition)[partition_id];
+    const auto& right_chunk_ids = (*right_chunk_ids_by_partition)[partition_id];
+    if (left_chunk_ids.empty() || right_chunk_ids.empty()) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      const auto left = std::make_shared<TableWrapper>(_partition_table(input_table_left(), left_chunk_ids));
+      const auto right = std::make_shared<TableWrapper>(_partition_table(input_table_right(), right_chunk_ids));
+      left->execute();
+      right->execute();
+
+      const auto join = std::make_shared<JoinAdaptive>(left, right, _mode, _column_ids, _predicate_condition);
+      join->execute();
+      partition_outputs[partition_id] = join->get_output();
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+  _joined_partition_count = jobs.size();
+
+  const auto output = _initialize_output_table();
+  for (const auto& partition_output : partition_outputs) {
+    if (!partition_output) continue;
+    for (auto chunk_id = ChunkID{0}; chunk_id < partition_output->chunk_count(); ++chunk_id) {
+      output->append_chunk(partition_output->get_chunk(chunk_id)->segments());
+    }
+  }
+
+  return output;
+}
+
+std::optional<std::vector<std::vector<ChunkID>>> JoinPartitionWise::_chunk_ids_by_partition(const Table& table) {
+  auto chunk_ids_by_partition = std::vector<std::vector<ChunkID>>{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (chunk->size() == 0) continue;
+
+    const auto partition_id = chunk->partition_id();
+    if (!partition_id) return std::nullopt;
+
+    const auto partition_idx = static_cast<size_t>(*partition_id);
+    if (partition_idx >= chunk_ids_by_partition.size()) chunk_ids_by_partition.resize(partition_idx + 1);
+    chunk_ids_by_partition[partition_idx].emplace_back(chunk_id);
+  }
+
+  return chunk_ids_by_partition;
+}
+
+std::shared_ptr<const Table> JoinPartitionWise::_partition_table(const std::shared_ptr<const Table>& table,
+                                                                 const std::vector<ChunkID>& chunk_ids) {
+  const auto partition_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table->get_chunk(chunk_id);
+
+    if (table->type() == TableType::References) {
+      partition_table->append_chunk(chunk->segments());
+      continue;
+    }
+
+    const auto pos_list = std::make_shared<PosList>();
+    pos_list->set_chunk_range(chunk_id, ChunkOffset{0}, chunk->size());
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+    }
+    partition_table->append_chunk(segments);
+  }
+
+  return partition_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Joins inputs whose rows come from co-partitioned tables (see TablePartitioning::is_co_partitioned_with()) on their
+ * partition columns. Equal values are in partitions with the same id, so only the chunks of the same partition need
+ * to be joined with each other. Each partition is joined by a JoinAdaptive of its own, and these run as jobs in
+ * parallel. Their inputs are a fraction of the full inputs, so that, e.g., the hash tables of JoinHash are smaller.
+ *
+ * The LQPTranslator uses this join for inner equi joins on the partition columns of co-partitioned stored tables.
+ * Whether the inputs are still partitioned is only known once they were executed, as only GetTable, Validate, and
+ * TableScan keep the partition of their chunks (see Chunk::partition_id()). If a chunk of either input has no
+ * partition, the inputs are joined as a whole by a single JoinAdaptive.
+ */
+class JoinPartitionWise : public AbstractJoinOperator {
+ public:
+  JoinPartitionWise(const std::shared_ptr<const AbstractOperator>& left,
+                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition);
+
+  const std::string name() const override;
+
+  // The number of partitions that were joined separately, std::nullopt before the execution or if the inputs were
+  // joined as a whole
+  const std::optional<size_t>& joined_partition_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+
+  // The ids of the chunks of each partition, std::nullopt if a chunk has no partition
+  static std::optional<std::vector<std::vector<ChunkID>>> _chunk_ids_by_partition(const Table& table);
+
+  // A reference table of the chunks of @param table. The chunks of data tables are referenced, so that the output of
+  // the join refers to the rows of the input table (and not to a copy of it) like the output of other joins.
+  static std::shared_ptr<const Table> _partition_table(const std::shared_ptr<const Table>& table,
+                                                       const std::vector<ChunkID>& chunk_ids);
+
+  std::optional<size_t> _joined_partition_count;
+};
+
+}  // namespace opossum
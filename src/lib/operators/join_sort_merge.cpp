@@ -103,6 +103,9 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   std::unique_ptr<PosList> _null_rows_left;
   std::unique_ptr<PosList> _null_rows_right;
 
+  // Values that make up a large share of the rows, sorted ascending. Their matches are emitted by separate jobs.
+  std::vector<T> _heavy_hitters;
+
   const ColumnID _left_column_id;
   const ColumnID _right_column_id;
 
@@ -112,7 +115,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   // the cluster count must be a power of two, i.e. 1, 2, 4, 8, 16, ...
   size_t _cluster_count;
 
-  // Contains the output row ids for each cluster
+  // Contains the output row ids for each cluster, followed by those of the jobs that join heavy hitters
   std::vector<std::shared_ptr<PosList>> _output_pos_lists_left;
   std::vector<std::shared_ptr<PosList>> _output_pos_lists_right;
 
@@ -164,6 +167,13 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
   * TODO(anyone): How should we determine the number of clusters?
   **/
   size_t _determine_number_of_clusters() {
+    // If both inputs are ordered by their join columns, their chunks are merged into a single cluster instead of being
+    // clustered and sorted
+    if (RadixClusterSort<T>::is_ordered_by(*_sort_merge_join.input_table_left(), _left_column_id) &&
+        RadixClusterSort<T>::is_ordered_by(*_sort_merge_join.input_table_right(), _right_column_id)) {
+      return 1;
+    }
+
     // Get the next lower power of two of the bigger chunk number
     // Note: this is only provisional. There should be a reasonable calculation here based on hardware stats.
     size_t chunk_count_left = _sort_merge_join.input_table_left()->chunk_count();
@@ -194,7 +204,10 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     switch (_op) {
       case PredicateCondition::Equals:
         if (compare_result == CompareResult::Equal) {
-          _emit_all_combinations(cluster_number, left_run, right_run);
+          // The matches of heavy hitters are emitted by the jobs created in _perform_join()
+          if (!_is_heavy_hitter((*(*_sorted_left_table)[cluster_number])[left_run.start.index].value)) {
+            _emit_all_combinations(cluster_number, left_run, right_run);
+          }
         } else if (compare_result == CompareResult::Less) {
           if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
             _emit_right_null_combinations(cluster_number, left_run);
@@ -296,6 +309,55 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     return result - start_position;
   }
 
+  bool _is_heavy_hitter(const T& value) const {
+    return !_heavy_hitters.empty() && std::binary_search(_heavy_hitters.begin(), _heavy_hitters.end(), value);
+  }
+
+  /**
+  * Creates the jobs that emit the matches of the heavy hitters in a cluster. The larger of the two runs of a heavy
+  * hitter is split into slices, and each job joins one slice with the whole smaller run, so that the smaller run is
+  * broadcast to all jobs. Each job writes to an output pos list of its own.
+  **/
+  void _create_heavy_hitter_jobs(size_t cluster_number, std::vector<std::shared_ptr<AbstractTask>>& jobs) {
+    const auto& left_cluster = *(*_sorted_left_table)[cluster_number];
+    const auto& right_cluster = *(*_sorted_right_table)[cluster_number];
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
+
+    for (const auto& heavy_hitter : _heavy_hitters) {
+      const auto value = MaterializedValue<T>{NULL_ROW_ID, heavy_hitter};
+      const auto [left_begin, left_end] = std::equal_range(left_cluster.begin(), left_cluster.end(), value, compare);
+      const auto [right_begin, right_end] =
+          std::equal_range(right_cluster.begin(), right_cluster.end(), value, compare);
+
+      // Without matches, the merge handles the run (e.g., for outer joins)
+      if (left_begin == left_end || right_begin == right_end) continue;
+
+      const auto left_run = TableRange(cluster_number, static_cast<size_t>(left_begin - left_cluster.begin()),
+                                       static_cast<size_t>(left_end - left_cluster.begin()));
+      const auto right_run = TableRange(cluster_number, static_cast<size_t>(right_begin - right_cluster.begin()),
+                                        static_cast<size_t>(right_end - right_cluster.begin()));
+      const auto left_run_size = static_cast<size_t>(left_end - left_begin);
+      const auto right_run_size = static_cast<size_t>(right_end - right_begin);
+      const auto slice_left = left_run_size >= right_run_size;
+      const auto& larger_run = slice_left ? left_run : right_run;
+      const auto slice_size = std::max(size_t{1}, HEAVY_HITTER_JOB_ROW_COUNT / std::min(left_run_size, right_run_size));
+
+      for (auto slice_start = larger_run.start.index; slice_start < larger_run.end.index; slice_start += slice_size) {
+        const auto slice_end = std::min(slice_start + slice_size, larger_run.end.index);
+        const auto slice = TableRange(cluster_number, slice_start, slice_end);
+        const auto output_index = _output_pos_lists_left.size();
+        _output_pos_lists_left.emplace_back(std::make_shared<PosList>());
+        _output_pos_lists_right.emplace_back(std::make_shared<PosList>());
+
+        const auto job_left_run = slice_left ? slice : left_run;
+        const auto job_right_run = slice_left ? right_run : slice;
+        jobs.push_back(std::make_shared<JobTask>([this, output_index, job_left_run, job_right_run] {
+          _emit_all_combinations(output_index, job_left_run, job_right_run);
+        }));
+      }
+    }
+  }
+
   /**
   * Compares two values and creates a comparison result.
   **/
@@ -542,7 +604,17 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
         }
       }
       jobs.push_back(std::make_shared<JobTask>([this, cluster_number] { this->_join_cluster(cluster_number); }));
-      jobs.back()->schedule();
+    }
+
+    // The output pos lists of the heavy hitter jobs are added here, so the jobs are scheduled only afterwards
+    if (!_heavy_hitters.empty()) {
+      for (size_t cluster_number = 0; cluster_number < _cluster_count; ++cluster_number) {
+        _create_heavy_hitter_jobs(cluster_number, jobs);
+      }
+    }
+
+    for (const auto& job : jobs) {
+      job->schedule();
     }
 
     CurrentScheduler::wait_for_tasks(jobs);
@@ -655,6 +727,7 @@ class JoinSortMerge::JoinSortMergeImpl : public AbstractJoinOperatorImpl {
     _sorted_right_table = std::move(sort_output.clusters_right);
     _null_rows_left = std::move(sort_output.null_rows_left);
     _null_rows_right = std::move(sort_output.null_rows_right);
+    _heavy_hitters = std::move(sort_output.heavy_hitters);
     _end_of_left_table = _end_of_table(_sorted_left_table);
     _end_of_right_table = _end_of_table(_sorted_right_table);
 
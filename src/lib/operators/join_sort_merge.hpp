@@ -20,6 +20,10 @@ namespace opossum {
    * Note: SortMergeJoin does not support null values in the input at the moment.
    * Note: Cross joins are not supported. Use the product operator instead.
    * Note: Outer joins are only implemented for the equi-join case, i.e. the "=" operator.
+   *
+   * In the equi-join case, the matches of heavy hitters (values that make up a large share of the rows, see
+   * RadixClusterSort) are not emitted by the job of their cluster. Instead, the rows of the larger side are split into
+   * slices that are joined with all rows of the smaller side in parallel.
    */
 class JoinSortMerge : public AbstractJoinOperator {
  public:
@@ -29,6 +33,9 @@ class JoinSortMerge : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  // The number of output rows that each job emits for the matches of a heavy hitter
+  static constexpr auto HEAVY_HITTER_JOB_ROW_COUNT = size_t{10'000};
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
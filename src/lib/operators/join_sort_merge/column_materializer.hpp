@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,12 +33,18 @@ using MaterializedSegmentList = std::vector<std::shared_ptr<MaterializedSegment<
 
 /**
  * Materializes a table for a specific segment and sorts it if required. Row-Ids are kept in order to enable
- * the construction of pos lists for the algorithms that are using this class.
+ * the construction of pos lists for the algorithms that are using this class. Chunks that are ordered by the column
+ * (see Chunk::ordered_by()) are not sorted again, descending ones are only reversed. If sampling is enabled, every
+ * sample_stride()-th value of each materialized chunk is collected, e.g., to find values that occur in many rows.
  **/
 template <typename T>
 class ColumnMaterializer {
  public:
-  explicit ColumnMaterializer(bool sort, bool materialize_null) : _sort{sort}, _materialize_null{materialize_null} {}
+  // The average number of values sampled from each chunk if sampling is enabled
+  static constexpr auto SAMPLES_PER_CHUNK = size_t{128};
+
+  explicit ColumnMaterializer(bool sort, bool materialize_null, bool sample = false)
+      : _sort{sort}, _materialize_null{materialize_null}, _sample{sample} {}
 
  public:
   /**
@@ -49,6 +56,9 @@ class ColumnMaterializer {
       std::shared_ptr<const Table> input, ColumnID column_id) {
     auto output = std::make_unique<MaterializedSegmentList<T>>(input->chunk_count());
     auto null_rows = std::make_unique<PosList>();
+    _samples_per_chunk.assign(_sample ? input->chunk_count() : 0, std::vector<T>{});
+    const auto sample_count = std::max(size_t{1}, input->chunk_count() * SAMPLES_PER_CHUNK);
+    _sample_stride = std::max(size_t{1}, input->row_count() / sample_count);
 
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     for (ChunkID chunk_id{0}; chunk_id < input->chunk_count(); ++chunk_id) {
@@ -61,6 +71,20 @@ class ColumnMaterializer {
     return std::make_pair(std::move(output), std::move(null_rows));
   }
 
+  /**
+   * Returns the values sampled from the chunks materialized by the last call of materialize(). NULLs are not sampled.
+   **/
+  std::vector<T> samples() const {
+    auto samples = std::vector<T>{};
+    for (const auto& chunk_samples : _samples_per_chunk) {
+      samples.insert(samples.end(), chunk_samples.begin(), chunk_samples.end());
+    }
+    return samples;
+  }
+
+  // Each sampled value represents this number of materialized values
+  size_t sample_stride() const { return _sample_stride; }
+
  private:
   /**
    * Creates a job to materialize and sort a chunk.
@@ -70,21 +94,42 @@ class ColumnMaterializer {
                                                                   ChunkID chunk_id, std::shared_ptr<const Table> input,
                                                                   ColumnID column_id) {
     return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id] {
-      auto segment = input->get_chunk(chunk_id)->get_segment(column_id);
+      const auto chunk = input->get_chunk(chunk_id);
+      auto segment = chunk->get_segment(column_id);
+
+      auto order_by_mode = std::optional<OrderByMode>{};
+      if (const auto& ordered_by = chunk->ordered_by(); ordered_by && ordered_by->first == column_id) {
+        order_by_mode = ordered_by->second;
+      }
 
       if (const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<T>>(segment)) {
-        (*output)[chunk_id] = _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output);
+        (*output)[chunk_id] =
+            _materialize_dictionary_segment(*dictionary_segment, chunk_id, null_rows_output, order_by_mode);
       } else {
-        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output);
+        (*output)[chunk_id] = _materialize_generic_segment(*segment, chunk_id, null_rows_output, order_by_mode);
+      }
+
+      if (_sample) {
+        _samples_per_chunk[chunk_id] = _sample_values(*(*output)[chunk_id]);
       }
     });
   }
 
+  std::vector<T> _sample_values(const MaterializedSegment<T>& segment) const {
+    auto samples = std::vector<T>{};
+    samples.reserve(segment.size() / _sample_stride + 1);
+    for (auto index = size_t{0}; index < segment.size(); index += _sample_stride) {
+      samples.emplace_back(segment[index].value);
+    }
+    return samples;
+  }
+
   /**
    * Materialization works of all types of segments
    */
-  std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(const BaseSegment& segment, ChunkID chunk_id,
-                                                                       std::unique_ptr<PosList>& null_rows_output) {
+  std::shared_ptr<MaterializedSegment<T>> _materialize_generic_segment(
+      const BaseSegment& segment, ChunkID chunk_id, std::unique_ptr<PosList>& null_rows_output,
+      const std::optional<OrderByMode>& order_by_mode) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
@@ -100,8 +145,12 @@ class ColumnMaterializer {
     });
 
     if (_sort) {
-      std::sort(output.begin(), output.end(),
-                [](const auto& left, const auto& right) { return left.value < right.value; });
+      if (order_by_mode) {
+        _reverse_if_descending(output, *order_by_mode);
+      } else {
+        std::sort(output.begin(), output.end(),
+                  [](const auto& left, const auto& right) { return left.value < right.value; });
+      }
     }
 
     return std::make_shared<MaterializedSegment<T>>(std::move(output));
@@ -110,16 +159,16 @@ class ColumnMaterializer {
   /**
    * Specialization for dictionary segments
    */
-  std::shared_ptr<MaterializedSegment<T>> _materialize_dictionary_segment(const DictionarySegment<T>& segment,
-                                                                          ChunkID chunk_id,
-                                                                          std::unique_ptr<PosList>& null_rows_output) {
+  std::shared_ptr<MaterializedSegment<T>> _materialize_dictionary_segment(
+      const DictionarySegment<T>& segment, ChunkID chunk_id, std::unique_ptr<PosList>& null_rows_output,
+      const std::optional<OrderByMode>& order_by_mode) {
     auto output = MaterializedSegment<T>{};
     output.reserve(segment.size());
 
     auto base_attribute_vector = segment.attribute_vector();
     auto dict = segment.dictionary();
 
-    if (_sort) {
+    if (_sort && !order_by_mode) {
       // Works like Bucket Sort
       // Collect for every value id, the set of rows that this value appeared in
       // value_count is used as an inverted index
@@ -167,14 +216,28 @@ class ColumnMaterializer {
           output.emplace_back(row_id, position.value());
         }
       });
+
+      if (_sort) _reverse_if_descending(output, *order_by_mode);
     }
 
     return std::make_shared<MaterializedSegment<T>>(std::move(output));
   }
 
+  // The NULLs are not part of the materialized segment, so a descending segment is sorted once it is reversed
+  static void _reverse_if_descending(MaterializedSegment<T>& segment, const OrderByMode order_by_mode) {
+    if (order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast) {
+      std::reverse(segment.begin(), segment.end());
+    }
+  }
+
  private:
   bool _sort;
   bool _materialize_null;
+  bool _sample;
+  size_t _sample_stride{1};
+
+  // Written by the materialization job of each chunk
+  std::vector<std::vector<T>> _samples_per_chunk;
 };
 
 }  // namespace opossum
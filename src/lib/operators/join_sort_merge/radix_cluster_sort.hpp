@@ -3,6 +3,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -20,6 +21,9 @@ struct RadixClusterOutput {
   std::unique_ptr<MaterializedSegmentList<T>> clusters_right;
   std::unique_ptr<PosList> null_rows_left;
   std::unique_ptr<PosList> null_rows_right;
+
+  // Values that make up a large share of the rows of the inputs, sorted ascending (only determined for equi joins)
+  std::vector<T> heavy_hitters;
 };
 
 /*
@@ -34,6 +38,13 @@ struct RadixClusterOutput {
 * -> Input chunks are materialized and sorted. Every value is stored together with its row id.
 * -> Then, either radix clustering or range clustering is performed.
 * -> At last, the resulting clusters are sorted.
+* If there is only one cluster and the materialized chunks are sorted runs (always in the non-equi case, and in the
+* equi case if all chunks of the input are ordered by the join column), the runs are merged instead of sorting the
+* cluster. For inputs whose chunks do not overlap, e.g., tables that are clustered by the join column, this is a
+* single linear pass.
+* In the equi case, the values are sampled during materialization to detect heavy hitters, i.e., values that make up a
+* large share of the rows. All rows of a heavy hitter end up in the same cluster, so that the join of this cluster
+* takes much longer than that of the others. The join uses the heavy hitters to split their matches across workers.
 *
 * Radix clustering example:
 * cluster_count = 4
@@ -66,6 +77,11 @@ class RadixClusterSort {
 
   virtual ~RadixClusterSort() = default;
 
+  // A value is a heavy hitter if it makes up at least this share of the rows of both inputs...
+  static constexpr auto HEAVY_HITTER_MIN_SHARE = 0.01;
+  // ...and at least this number of rows, both as estimated from the samples
+  static constexpr auto HEAVY_HITTER_MIN_ROW_COUNT = size_t{1'000};
+
  protected:
   /**
   * The ChunkInformation structure is used to gather statistics regarding a chunk's values in order to
@@ -162,6 +178,42 @@ class RadixClusterSort {
     return output_table;
   }
 
+  /**
+  * Concatenates materialized segments that are sorted in themselves to a single sorted materialized segment. Adjacent
+  * runs are merged pairwise, and runs that do not overlap with their predecessor are left as they are.
+  **/
+  static std::unique_ptr<MaterializedSegmentList<T>> _merge_chunks(
+      std::unique_ptr<MaterializedSegmentList<T>>& input_chunks) {
+    auto run_offsets = std::vector<size_t>{0};
+    for (const auto& chunk : *input_chunks) {
+      run_offsets.emplace_back(run_offsets.back() + chunk->size());
+    }
+
+    auto output_table = _concatenate_chunks(input_chunks);
+    auto& output_chunk = *(*output_table)[0];
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
+
+    // Every pass halves the number of runs
+    while (run_offsets.size() > 2) {
+      const auto run_count = run_offsets.size() - 1;
+      auto merged_run_offsets = std::vector<size_t>{0};
+      for (auto run_id = size_t{0}; run_id < run_count; run_id += 2) {
+        if (run_id + 1 < run_count) {
+          const auto begin = output_chunk.begin() + run_offsets[run_id];
+          const auto middle = output_chunk.begin() + run_offsets[run_id + 1];
+          const auto end = output_chunk.begin() + run_offsets[run_id + 2];
+          if (begin != middle && middle != end && compare(*middle, *(middle - 1))) {
+            std::inplace_merge(begin, middle, end, compare);
+          }
+        }
+        merged_run_offsets.emplace_back(run_offsets[std::min(run_id + 2, run_count)]);
+      }
+      run_offsets = std::move(merged_run_offsets);
+    }
+
+    return output_table;
+  }
+
   /**
   * Performs the clustering on a materialized table using a clustering function that determines for each
   * value the appropriate cluster id. This is how the clustering works:
@@ -324,6 +376,33 @@ class RadixClusterSort {
     return {std::move(output_left), std::move(output_right)};
   }
 
+  /**
+  * Determines the heavy hitters from the values sampled from both inputs during their materialization.
+  **/
+  std::vector<T> _determine_heavy_hitters(const ColumnMaterializer<T>& left_column_materializer,
+                                          const ColumnMaterializer<T>& right_column_materializer) {
+    // Estimate the number of rows of each sampled value
+    auto estimated_row_counts = std::unordered_map<T, size_t>{};
+    for (const auto& column_materializer : {&left_column_materializer, &right_column_materializer}) {
+      const auto sample_stride = column_materializer->sample_stride();
+      for (const auto& value : column_materializer->samples()) {
+        estimated_row_counts[value] += sample_stride;
+      }
+    }
+
+    const auto row_count = _input_table_left->row_count() + _input_table_right->row_count();
+    const auto min_share_row_count = static_cast<size_t>(HEAVY_HITTER_MIN_SHARE * static_cast<double>(row_count));
+    const auto min_row_count = std::max(HEAVY_HITTER_MIN_ROW_COUNT, min_share_row_count);
+
+    auto heavy_hitters = std::vector<T>{};
+    for (const auto& [value, estimated_row_count] : estimated_row_counts) {
+      if (estimated_row_count >= min_row_count) heavy_hitters.emplace_back(value);
+    }
+
+    std::sort(heavy_hitters.begin(), heavy_hitters.end());
+    return heavy_hitters;
+  }
+
   /**
   * Sorts all clusters of a materialized table.
   **/
@@ -334,15 +413,29 @@ class RadixClusterSort {
   }
 
  public:
+  // Whether all chunks of the table are ordered by the column
+  static bool is_ordered_by(const Table& table, const ColumnID column_id) {
+    if (table.chunk_count() == 0) return false;
+
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto& ordered_by = table.get_chunk(chunk_id)->ordered_by();
+      if (!ordered_by || ordered_by->first != column_id) return false;
+    }
+    return true;
+  }
+
   /**
   * Executes the clustering and sorting.
   **/
   RadixClusterOutput<T> execute() {
     RadixClusterOutput<T> output;
 
-    // Sort the chunks of the input tables in the non-equi cases
-    ColumnMaterializer<T> left_column_materializer(!_equi_case, _materialize_null_left);
-    ColumnMaterializer<T> right_column_materializer(!_equi_case, _materialize_null_right);
+    // Sort the chunks of the input tables in the non-equi cases, and if they are ordered already and can be merged
+    const auto merge_left = _cluster_count == 1 && (!_equi_case || is_ordered_by(*_input_table_left, _left_column_id));
+    const auto merge_right =
+        _cluster_count == 1 && (!_equi_case || is_ordered_by(*_input_table_right, _right_column_id));
+    ColumnMaterializer<T> left_column_materializer(!_equi_case || merge_left, _materialize_null_left, _equi_case);
+    ColumnMaterializer<T> right_column_materializer(!_equi_case || merge_right, _materialize_null_right, _equi_case);
     auto materialization_left = left_column_materializer.materialize(_input_table_left, _left_column_id);
     auto materialization_right = right_column_materializer.materialize(_input_table_right, _right_column_id);
     auto materialized_left_segments = std::move(materialization_left.first);
@@ -350,9 +443,15 @@ class RadixClusterSort {
     output.null_rows_left = std::move(materialization_left.second);
     output.null_rows_right = std::move(materialization_right.second);
 
+    if (_equi_case) {
+      output.heavy_hitters = _determine_heavy_hitters(left_column_materializer, right_column_materializer);
+    }
+
     if (_cluster_count == 1) {
-      output.clusters_left = _concatenate_chunks(materialized_left_segments);
-      output.clusters_right = _concatenate_chunks(materialized_right_segments);
+      output.clusters_left = merge_left ? _merge_chunks(materialized_left_segments)
+                                        : _concatenate_chunks(materialized_left_segments);
+      output.clusters_right = merge_right ? _merge_chunks(materialized_right_segments)
+                                          : _concatenate_chunks(materialized_right_segments);
     } else if (_equi_case) {
       output.clusters_left = _radix_cluster(materialized_left_segments);
       output.clusters_right = _radix_cluster(materialized_right_segments);
@@ -364,8 +463,8 @@ class RadixClusterSort {
 
     // Sort each cluster (right now std::sort -> but maybe can be replaced with
     // an more efficient algorithm, if subparts are already sorted [InsertionSort?!])
-    _sort_clusters(output.clusters_left);
-    _sort_clusters(output.clusters_right);
+    if (!merge_left) _sort_clusters(output.clusters_left);
+    if (!merge_right) _sort_clusters(output.clusters_right);
 
     return output;
   }
@@ -8,10 +8,12 @@
 
 namespace opossum {
 
-CreateTable::CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions)
+CreateTable::CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+                         const std::shared_ptr<const TablePartitioning>& partitioning)
     : AbstractReadOnlyOperator(OperatorType::CreateTable),
       table_name(table_name),
-      column_definitions(column_definitions) {}
+      column_definitions(column_definitions),
+      partitioning(partitioning) {}
 
 const std::string CreateTable::name() const { return "Create Table"; }
 
@@ -37,12 +39,17 @@ const std::string CreateTable::description(DescriptionMode description_mode) con
   }
   stream << ")";
 
+  if (partitioning) {
+    stream << separator << "PARTITION BY " << partitioning->description();
+  }
+
   return stream.str();
 }
 
 std::shared_ptr<const Table> CreateTable::_on_execute() {
   // TODO(anybody) chunk size and mvcc not yet specifiable
   const auto table = std::make_shared<Table>(column_definitions, TableType::Data, Chunk::DEFAULT_SIZE, UseMvcc::Yes);
+  if (partitioning) table->set_partitioning(partitioning);
 
   StorageManager::get().add_table(table_name, table);
 
@@ -52,7 +59,7 @@ std::shared_ptr<const Table> CreateTable::_on_execute() {
 std::shared_ptr<AbstractOperator> CreateTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<CreateTable>(table_name, column_definitions);
+  return std::make_shared<CreateTable>(table_name, column_definitions, partitioning);
 }
 
 void CreateTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
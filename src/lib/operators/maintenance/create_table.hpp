@@ -5,16 +5,21 @@
 
 namespace opossum {
 
+class TablePartitioning;
+
 // maintenance operator for the "CREATE TABLE" sql statement
+// If a partitioning is given, the rows of the table are stored by partition (see TablePartitioning)
 class CreateTable : public AbstractReadOnlyOperator {
  public:
-  CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions);
+  CreateTable(const std::string& table_name, const TableColumnDefinitions& column_definitions,
+              const std::shared_ptr<const TablePartitioning>& partitioning = nullptr);
 
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
   const std::string table_name;
   const TableColumnDefinitions column_definitions;
+  const std::shared_ptr<const TablePartitioning> partitioning;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
@@ -0,0 +1,89 @@
+#include "morsel_planner.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+constexpr auto OPERATOR_TYPE_COUNT = static_cast<size_t>(opossum::OperatorType::Mock) + 1;
+
+// Weight of a new observation in the moving average of the cost per row
+constexpr auto COST_SMOOTHING_FACTOR = 0.125;
+
+// Observed cost per row in nanoseconds, by operator type. Concurrent updates may overwrite each other, which only
+// loses observations.
+std::array<std::atomic<double>, OPERATOR_TYPE_COUNT> cost_per_row_by_operator_type{};
+
+}  // namespace
+
+namespace opossum {
+
+std::vector<Morsel> MorselPlanner::plan(const OperatorType operator_type, const Table& table,
+                                        const std::vector<ChunkID>& chunk_ids) {
+  auto total_row_count = size_t{0};
+  for (const auto chunk_id : chunk_ids) {
+    total_row_count += table.get_chunk(chunk_id)->size();
+  }
+
+  // Without an observed cost, max_morsel_row_count is zero and each chunk becomes a morsel of its own
+  auto max_morsel_row_count = size_t{0};
+  const auto row_cost = cost_per_row(operator_type);
+  if (row_cost > 0.0) {
+    const auto target_nanoseconds = std::chrono::nanoseconds{TARGET_MORSEL_DURATION}.count();
+    const auto worker_count = CurrentScheduler::is_set() ? CurrentScheduler::get()->workers().size() : size_t{1};
+    const auto row_count_per_worker = (total_row_count + worker_count - 1) / worker_count;
+    max_morsel_row_count =
+        std::min(static_cast<size_t>(static_cast<double>(target_nanoseconds) / row_cost), row_count_per_worker);
+  }
+
+  auto morsels = std::vector<Morsel>{};
+  for (const auto chunk_id : chunk_ids) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto row_count = size_t{chunk->size()};
+    const auto node_id = chunk->preferred_node_id();
+
+    if (morsels.empty() || morsels.back().node_id != node_id ||
+        morsels.back().row_count + row_count > max_morsel_row_count) {
+      morsels.emplace_back();
+      morsels.back().node_id = node_id;
+    }
+
+    morsels.back().chunk_ids.emplace_back(chunk_id);
+    morsels.back().row_count += row_count;
+  }
+
+  return morsels;
+}
+
+void MorselPlanner::record_execution(const OperatorType operator_type, const size_t row_count,
+                                     const std::chrono::nanoseconds duration) {
+  if (row_count == 0) return;
+
+  auto& cost = cost_per_row_by_operator_type[static_cast<size_t>(operator_type)];
+  const auto observed_cost = static_cast<double>(duration.count()) / static_cast<double>(row_count);
+  const auto previous_cost = cost.load();
+  cost = previous_cost == 0.0 ? observed_cost
+                              : previous_cost * (1.0 - COST_SMOOTHING_FACTOR) + observed_cost * COST_SMOOTHING_FACTOR;
+}
+
+double MorselPlanner::cost_per_row(const OperatorType operator_type) {
+  return cost_per_row_by_operator_type[static_cast<size_t>(operator_type)];
+}
+
+void MorselPlanner::reset_cost_per_row(const OperatorType operator_type) {
+  cost_per_row_by_operator_type[static_cast<size_t>(operator_type)] = 0.0;
+}
+
+std::vector<ChunkID> MorselPlanner::all_chunk_ids(const Table& table) {
+  auto chunk_ids = std::vector<ChunkID>(table.chunk_count());
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+  return chunk_ids;
+}
+
+}  // namespace opossum
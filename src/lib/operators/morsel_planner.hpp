@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A run of consecutive chunks of a table that one job of a chunk-parallel operator processes
+ */
+struct Morsel {
+  std::vector<ChunkID> chunk_ids;
+  size_t row_count{0};
+  // The NUMA node of the chunks, see Chunk::preferred_node_id()
+  NodeID node_id{CURRENT_NODE_ID};
+};
+
+/**
+ * Creating, scheduling and waiting for a task costs a few microseconds, which outweighs the work on small chunks, or
+ * on the chunks of narrow tables with cheap operators. Thus, chunk-parallel operators group their chunks into
+ * morsels that take about TARGET_MORSEL_DURATION each:
+ *   - The duration of a morsel is estimated from the rows of its chunks and the cost per row that previous morsels of
+ *     the same operator type took. As long as no morsel of the operator type was executed, each chunk is a morsel.
+ *   - There are at least as many morsels as Workers (as far as there are chunks), so that all Workers are used.
+ *   - The chunks of a morsel are on the same NUMA node.
+ */
+class MorselPlanner {
+ public:
+  static constexpr auto TARGET_MORSEL_DURATION = std::chrono::microseconds{500};
+
+  // Groups the chunks in the given order into morsels
+  static std::vector<Morsel> plan(const OperatorType operator_type, const Table& table,
+                                  const std::vector<ChunkID>& chunk_ids);
+
+  // Records that a morsel of `row_count` rows took `duration` to execute
+  static void record_execution(const OperatorType operator_type, const size_t row_count,
+                               const std::chrono::nanoseconds duration);
+
+  // Observed cost of a row in nanoseconds, zero if no morsel of the operator type was executed yet
+  static double cost_per_row(const OperatorType operator_type);
+  static void reset_cost_per_row(const OperatorType operator_type);
+
+  /**
+   * Calls `functor(chunk_id)` for each of the chunks, with one job per morsel, and waits for the jobs. Chunks are
+   * processed concurrently, so the functor has to write its results into per-chunk slots.
+   */
+  template <typename Functor>
+  static void for_each_chunk(const OperatorType operator_type, const Table& table,
+                             const std::vector<ChunkID>& chunk_ids, const Functor& functor) {
+    const auto morsels = plan(operator_type, table, chunk_ids);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(morsels.size());
+    for (const auto& morsel : morsels) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        const auto started = std::chrono::steady_clock::now();
+        for (const auto chunk_id : morsel.chunk_ids) {
+          functor(chunk_id);
+        }
+        const auto duration =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started);
+        record_execution(operator_type, morsel.row_count, duration);
+      }));
+      jobs.back()->schedule(morsel.node_id);
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  }
+
+  // Calls `functor(chunk_id)` for all chunks of the table, see above
+  template <typename Functor>
+  static void for_each_chunk(const OperatorType operator_type, const Table& table, const Functor& functor) {
+    for_each_chunk(operator_type, table, all_chunk_ids(table), functor);
+  }
+
+  static std::vector<ChunkID> all_chunk_ids(const Table& table);
+};
+
+}  // namespace opossum
@@ -1,13 +1,96 @@
 #include "operator_performance_data.hpp"
 
+#include <algorithm>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
+void OperatorPerformanceData::add_phase_walltime(const std::string& phase,
+                                                 const std::chrono::nanoseconds phase_walltime) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto phase_iter =
+      std::find_if(_phase_walltimes.begin(), _phase_walltimes.end(),
+                   [&](const auto& phase_and_walltime) { return phase_and_walltime.first == phase; });
+  if (phase_iter != _phase_walltimes.end()) {
+    phase_iter->second += phase_walltime;
+  } else {
+    _phase_walltimes.emplace_back(phase, phase_walltime);
+  }
+
+  DTRACE_PROBE3(HYRISE, OPERATOR_PHASE_FINISHED, phase.c_str(), phase_walltime.count(),
+                reinterpret_cast<uintptr_t>(this));
+}
+
+std::vector<std::pair<std::string, std::chrono::nanoseconds>> OperatorPerformanceData::phase_walltimes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _phase_walltimes;
+}
+
+void OperatorPerformanceData::add_task_walltime(const std::chrono::nanoseconds task_walltime) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _task_walltimes.min = _task_walltimes.count == 0 ? task_walltime : std::min(_task_walltimes.min, task_walltime);
+  _task_walltimes.max = std::max(_task_walltimes.max, task_walltime);
+  _task_walltimes.total += task_walltime;
+  ++_task_walltimes.count;
+}
+
+OperatorPerformanceData::TaskWalltimes OperatorPerformanceData::task_walltimes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _task_walltimes;
+}
+
 std::string OperatorPerformanceData::to_string(DescriptionMode description_mode) const {
-  return format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+  const auto separator = description_mode == DescriptionMode::SingleLine ? " / " : "\n";
+
+  std::stringstream stream;
+  stream << format_duration(std::chrono::duration_cast<std::chrono::nanoseconds>(walltime));
+
+  const auto chunk_count = chunks_processed + chunks_skipped;
+  if (chunk_count > 0) {
+    stream << separator << chunks_processed << " of " << chunk_count << " chunk(s) processed";
+  }
+
+  if (bytes_materialized > 0) {
+    stream << separator << format_bytes(bytes_materialized) << " materialized";
+  }
+
+  if (peak_memory_usage_bytes > 0) {
+    stream << separator << format_bytes(peak_memory_usage_bytes) << " peak memory, "
+           << format_bytes(retained_memory_usage_bytes) << " retained";
+  }
+
+  if (performance_counters) {
+    stream << separator << performance_counters->to_string();
+    if (input_row_count > 0) {
+      const auto input_rows = static_cast<double>(input_row_count);
+      stream.precision(2);
+      stream << std::fixed << separator << static_cast<double>(performance_counters->cache_misses) / input_rows
+             << " cache misses, " << static_cast<double>(performance_counters->tlb_misses) / input_rows
+             << " TLB misses per input row";
+    }
+  }
+
+  for (const auto& [phase, phase_walltime] : phase_walltimes()) {
+    stream << separator << phase << ": " << format_duration(phase_walltime);
+  }
+
+  const auto tasks = task_walltimes();
+  if (tasks.count > 0) {
+    stream << separator << tasks.count << " task(s): " << format_duration(tasks.min) << " min, "
+           << format_duration(tasks.total / tasks.count) << " avg, " << format_duration(tasks.max) << " max";
+  }
+
+  return stream.str();
 }
 
 }  // namespace opossum
@@ -1,20 +1,70 @@
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "types.hpp"
+#include "utils/performance_counters.hpp"
 
 namespace opossum {
 
 // For an example on how this can be extended on a per-operator basis, see JoinIndex
 
 struct OperatorPerformanceData : public Noncopyable {
+  // Distribution of the walltimes of the jobs that an operator split its work into
+  struct TaskWalltimes {
+    size_t count{0};
+    std::chrono::nanoseconds total{0};
+    std::chrono::nanoseconds min{0};
+    std::chrono::nanoseconds max{0};
+  };
+
   virtual ~OperatorPerformanceData() = default;
 
   std::chrono::nanoseconds walltime{0};
 
+  // Set by AbstractOperator::execute(). The input row count is the sum of the row counts of both inputs.
+  uint64_t input_row_count{0};
+  uint64_t output_row_count{0};
+  uint64_t output_chunk_count{0};
+
+  // Counted by the operators that process their input chunk by chunk. Skipped chunks are not looked at, e.g., because
+  // they were pruned or their rows are not visible.
+  std::atomic<uint64_t> chunks_processed{0};
+  std::atomic<uint64_t> chunks_skipped{0};
+
+  // Bytes of data that the operator materialized, e.g., the join keys of JoinHash or the computed columns of Projection
+  std::atomic<uint64_t> bytes_materialized{0};
+
+  // Set by AbstractOperator::execute(). Bytes allocated from AbstractOperator::memory_resource() (e.g., for hash
+  // tables and PosLists): the peak during the execution and those still allocated afterwards, usually by the output.
+  size_t peak_memory_usage_bytes{0};
+  size_t retained_memory_usage_bytes{0};
+
+  // Hardware events of the thread that executed the operator, if PerformanceCounters are enabled and available. Jobs
+  // that the operator scheduled on other workers are not included.
+  std::optional<PerformanceCounterValues> performance_counters;
+
+  // Adds @param phase_walltime to the named phase (e.g., "Build" in JoinHash). Phases are kept in the order in which
+  // they were first recorded. Thread-safe.
+  void add_phase_walltime(const std::string& phase, const std::chrono::nanoseconds phase_walltime);
+  std::vector<std::pair<std::string, std::chrono::nanoseconds>> phase_walltimes() const;
+
+  // Records the walltime of a job. Thread-safe.
+  void add_task_walltime(const std::chrono::nanoseconds task_walltime);
+  TaskWalltimes task_walltimes() const;
+
   virtual std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
+
+ private:
+  mutable std::mutex _mutex;
+  std::vector<std::pair<std::string, std::chrono::nanoseconds>> _phase_walltimes;
+  TaskWalltimes _task_walltimes;
 };
 
 }  // namespace opossum
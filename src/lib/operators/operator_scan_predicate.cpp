@@ -3,6 +3,7 @@
 #include "constant_mappings.hpp"
 #include "expression/abstract_predicate_expression.hpp"
 #include "expression/expression_functional.hpp"
+#include "expression/placeholder_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "utils/assert.hpp"
@@ -23,6 +24,8 @@ std::optional<AllParameterVariant> resolve_all_parameter_variant(const AbstractE
     value = *column_id;
   } else if (const auto parameter_expression = dynamic_cast<const CorrelatedParameterExpression*>(&expression)) {
     value = parameter_expression->parameter_id;
+  } else if (const auto placeholder_expression = dynamic_cast<const PlaceholderExpression*>(&expression)) {
+    value = placeholder_expression->parameter_id;
   } else {
     return std::nullopt;
   }
@@ -0,0 +1,172 @@
+#include "pipeline.hpp"
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "join_hash.hpp"
+#include "morsel_planner.hpp"
+#include "product.hpp"
+#include "projection.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
+#include "table_scan.hpp"
+#include "utils/assert.hpp"
+#include "validate.hpp"
+
+namespace opossum {
+
+Pipeline::Pipeline(const std::shared_ptr<const AbstractOperator>& in,
+                   const std::vector<std::shared_ptr<AbstractOperator>>& stages,
+                   const std::shared_ptr<const AbstractOperator>& build_input, const bool probe_input_is_left)
+    : AbstractReadOnlyOperator(OperatorType::Pipeline, in, build_input), _probe_input_is_left(probe_input_is_left) {
+  Assert(!stages.empty(), "Pipeline needs at least one stage");
+
+  auto join_stage_count = size_t{0};
+  for (const auto& stage : stages) {
+    Assert(is_stage(*stage, probe_input_is_left), "Operator " + stage->name() + " cannot be a stage of a Pipeline");
+    if (stage->type() == OperatorType::JoinHash || stage->type() == OperatorType::Product) ++join_stage_count;
+
+    // The stages only process the morsels of the Pipeline, so their inputs are not kept
+    auto copied_ops = std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>{};
+    if (stage->input_left()) copied_ops.emplace(stage->input_left().get(), nullptr);
+    if (stage->input_right()) copied_ops.emplace(stage->input_right().get(), nullptr);
+    _stages.emplace_back(stage->deep_copy(copied_ops));
+  }
+
+  Assert(join_stage_count == (build_input ? 1u : 0u),
+         "Expected one JoinHash or Product stage if and only if there is a build input");
+}
+
+const std::string Pipeline::name() const { return "Pipeline"; }
+
+const std::string Pipeline::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name();
+  for (const auto& stage : _stages) {
+    stream << separator << "[" << stage->description(DescriptionMode::SingleLine) << "]";
+  }
+
+  return stream.str();
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& Pipeline::stages() const { return _stages; }
+
+bool Pipeline::probe_input_is_left() const { return _probe_input_is_left; }
+
+bool Pipeline::is_stage(const AbstractOperator& op, const bool probe_input_is_left) {
+  switch (op.type()) {
+    case OperatorType::Validate:
+    case OperatorType::Projection:
+      return true;
+    case OperatorType::TableScan:
+      // The excluded chunks are those of the input table, not of the morsels
+      return static_cast<const TableScan&>(op).excluded_chunk_ids().empty();
+    case OperatorType::JoinHash:
+      return static_cast<const JoinHash&>(op).supports_morsel_probing(probe_input_is_left);
+    case OperatorType::Product:
+      // The morsels are chunks of the left input
+      return probe_input_is_left;
+    default:
+      return false;
+  }
+}
+
+std::shared_ptr<const Table> Pipeline::_on_execute() {
+  const auto in_table = input_table_left();
+
+  // Each processor is created for the columns of its input, i.e., the (empty) output of the previous processor
+  auto processors = std::vector<MorselProcessor>{};
+  processors.reserve(_stages.size());
+  auto stage_input_layout = in_table;
+  for (const auto& stage : _stages) {
+    processors.emplace_back(_create_morsel_processor(*stage, *stage_input_layout));
+    stage_input_layout = processors.back()(stage_input_layout, {});
+  }
+
+  const auto output_table =
+      std::make_shared<Table>(stage_input_layout->column_definitions(), stage_input_layout->type(), std::nullopt,
+                              stage_input_layout->has_mvcc());
+
+  // The input chunks are pushed through the stages in morsels of consecutive chunks, see MorselPlanner. The output
+  // chunks are collected per morsel and appended in chunk order, so that the output does not depend on the order in
+  // which the jobs finish.
+  const auto morsels = MorselPlanner::plan(type(), *in_table, MorselPlanner::all_chunk_ids(*in_table));
+  auto output_chunks_by_morsel = std::vector<std::vector<std::shared_ptr<Chunk>>>(morsels.size());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(morsels.size());
+  for (auto morsel_idx = size_t{0}; morsel_idx < morsels.size(); ++morsel_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, morsel_idx]() {
+      const auto started = std::chrono::steady_clock::now();
+      const auto& morsel_in = morsels[morsel_idx];
+      auto morsel = processors.front()(in_table, morsel_in.chunk_ids);
+
+      for (auto stage_idx = size_t{1}; stage_idx < processors.size() && morsel->chunk_count() > 0; ++stage_idx) {
+        morsel = processors[stage_idx](morsel, MorselPlanner::all_chunk_ids(*morsel));
+      }
+
+      output_chunks_by_morsel[morsel_idx] = morsel->chunks();
+      MorselPlanner::record_execution(
+          type(), morsel_in.row_count,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started));
+    }));
+    jobs.back()->schedule(morsels[morsel_idx].node_id);
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& output_chunks : output_chunks_by_morsel) {
+    for (const auto& output_chunk : output_chunks) {
+      output_table->append_chunk(output_chunk);
+    }
+  }
+
+  return output_table;
+}
+
+MorselProcessor Pipeline::_create_morsel_processor(const AbstractOperator& stage,
+                                                   const Table& stage_input_layout) const {
+  switch (stage.type()) {
+    case OperatorType::Validate:
+      return static_cast<const Validate&>(stage).create_morsel_processor();
+    case OperatorType::TableScan:
+      return static_cast<const TableScan&>(stage).create_morsel_processor();
+    case OperatorType::Projection:
+      return static_cast<const Projection&>(stage).create_morsel_processor();
+    case OperatorType::JoinHash:
+      return static_cast<const JoinHash&>(stage).create_morsel_processor(input_table_right(), stage_input_layout,
+                                                                         _probe_input_is_left);
+    case OperatorType::Product:
+      return static_cast<const Product&>(stage).create_morsel_processor(input_table_right());
+    default:
+      break;
+  }
+  Fail("Operator " + stage.name() + " cannot be a stage of a Pipeline");
+}
+
+std::shared_ptr<AbstractOperator> Pipeline::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Pipeline>(copied_input_left, _stages, copied_input_right, _probe_input_is_left);
+}
+
+void Pipeline::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  for (const auto& stage : _stages) {
+    stage->set_transaction_context(transaction_context);
+  }
+}
+
+void Pipeline::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  for (const auto& stage : _stages) {
+    stage->set_parameters(parameters);
+  }
+}
+
+}  // namespace opossum
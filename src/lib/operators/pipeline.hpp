@@ -0,0 +1,68 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Processes the given chunks (i.e., a morsel) of a table and returns a table holding only the output chunks of these
+ * chunks. Chunks without output rows are skipped. Called with no chunks, it returns an empty table that has the
+ * columns of the output. Created by the operators that can be stages of a Pipeline, see Pipeline::is_stage().
+ */
+using MorselProcessor = std::function<std::shared_ptr<Table>(const std::shared_ptr<const Table>& in_table,
+                                                             const std::vector<ChunkID>& chunk_ids)>;
+
+/**
+ * Executes a chain of non-blocking operators (the stages) morsel by morsel: Each morsel of the input (a run of
+ * consecutive chunks, see MorselPlanner) is pushed through all stages by a single job, so that the intermediate results
+ * of the stages are never materialized as whole tables and stay in the caches of the worker. The output chunks are
+ * appended in the order of the input chunks.
+ *
+ * Supported stages are Validate, TableScan, Projection, the probe side of a JoinHash (see
+ * JoinHash::supports_morsel_probing()), whose hash table is built from `build_input` before the morsels are
+ * processed, and a Product with its left input, whose morsels are combined with all chunks of `build_input`. A
+ * Pipeline has at most one JoinHash or Product stage. The stages are stored without their inputs, as the Pipeline
+ * provides their input morsels. Row budgets of the stages are ignored.
+ *
+ * Pipelines are created by the PipeliningLQPTranslator.
+ */
+class Pipeline : public AbstractReadOnlyOperator {
+ public:
+  // @param stages from the bottom to the top, the first stage consumes `in`
+  // @param probe_input_is_left whether the morsels are the left or the right input of the JoinHash stage (if any). Must
+  //                            be true for a Product stage.
+  Pipeline(const std::shared_ptr<const AbstractOperator>& in,
+           const std::vector<std::shared_ptr<AbstractOperator>>& stages,
+           const std::shared_ptr<const AbstractOperator>& build_input = nullptr, const bool probe_input_is_left = true);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<std::shared_ptr<AbstractOperator>>& stages() const;
+  bool probe_input_is_left() const;
+
+  // Whether the operator can be a stage of a Pipeline, given which of its inputs is pipelined
+  static bool is_stage(const AbstractOperator& op, const bool probe_input_is_left = true);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  MorselProcessor _create_morsel_processor(const AbstractOperator& stage, const Table& stage_input_layout) const;
+
+ private:
+  std::vector<std::shared_ptr<AbstractOperator>> _stages;
+  const bool _probe_input_is_left;
+};
+
+}  // namespace opossum
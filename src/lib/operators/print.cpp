@@ -109,9 +109,9 @@ std::shared_ptr<const Table> Print::_on_execute() {
       if (_flags & PrintMvcc && chunk->has_mvcc_data()) {
         auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
-        auto begin = mvcc_data->begin_cids[chunk_offset];
-        auto end = mvcc_data->end_cids[chunk_offset];
-        auto tid = mvcc_data->tids[chunk_offset];
+        auto begin = mvcc_data->begin_cid(chunk_offset);
+        auto end = mvcc_data->end_cid(chunk_offset);
+        auto tid = mvcc_data->tid(chunk_offset);
 
         auto begin_string = begin == MvccData::MAX_COMMIT_ID ? "" : std::to_string(begin);
         auto end_string = end == MvccData::MAX_COMMIT_ID ? "" : std::to_string(end);
@@ -175,7 +175,8 @@ std::string Print::_segment_type(const std::shared_ptr<BaseSegment>& segment) co
     segment_type += "ReferS";
   } else if (const auto& encoded_segment = std::dynamic_pointer_cast<BaseEncodedSegment>(segment)) {
     switch (encoded_segment->encoding_type()) {
-      case EncodingType::Unencoded: {
+      case EncodingType::Unencoded:
+      case EncodingType::Auto: {
         Fail("An actual segment should never have this type");
       }
       case EncodingType::Dictionary: {
@@ -194,6 +195,14 @@ std::string Print::_segment_type(const std::shared_ptr<BaseSegment>& segment) co
         segment_type += "FoR";
         break;
       }
+      case EncodingType::LZ4: {
+        segment_type += "LZ4";
+        break;
+      }
+      case EncodingType::Delta: {
+        segment_type += "Dlt";
+        break;
+      }
     }
     if (encoded_segment->compressed_vector_type()) {
       switch (*encoded_segment->compressed_vector_type()) {
@@ -6,7 +6,9 @@
 #include <utility>
 #include <vector>
 
+#include "morsel_planner.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 Product::Product(const std::shared_ptr<const AbstractOperator>& left,
@@ -15,34 +17,70 @@ Product::Product(const std::shared_ptr<const AbstractOperator>& left,
 
 const std::string Product::name() const { return "Product"; }
 
+MorselProcessor Product::create_morsel_processor(const std::shared_ptr<const Table>& right_table) const {
+  return [right_table](const std::shared_ptr<const Table>& in_table, const std::vector<ChunkID>& chunk_ids) {
+    const auto output_table =
+        std::make_shared<Table>(_output_column_definitions(*in_table, *right_table), TableType::References);
+
+    for (const auto chunk_id_left : chunk_ids) {
+      for (auto chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
+        const auto output_chunk = _product_of_two_chunks(in_table, chunk_id_left, right_table, chunk_id_right);
+        if (output_chunk) output_table->append_chunk(output_chunk);
+      }
+    }
+
+    return output_table;
+  };
+}
+
 std::shared_ptr<const Table> Product::_on_execute() {
+  const auto left_table = input_table_left();
+  const auto right_table = input_table_right();
+
+  auto output =
+      std::make_shared<Table>(_output_column_definitions(*left_table, *right_table), TableType::References);
+
+  // The output chunks of each left chunk are computed in parallel and appended in the order of the chunks
+  auto output_chunks_by_left_chunk = std::vector<std::vector<std::shared_ptr<Chunk>>>(left_table->chunk_count());
+  MorselPlanner::for_each_chunk(type(), *left_table, [&](const ChunkID chunk_id_left) {
+    for (auto chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
+      const auto output_chunk = _product_of_two_chunks(left_table, chunk_id_left, right_table, chunk_id_right);
+      if (output_chunk) output_chunks_by_left_chunk[chunk_id_left].emplace_back(output_chunk);
+    }
+  });
+
+  for (const auto& output_chunks : output_chunks_by_left_chunk) {
+    for (const auto& output_chunk : output_chunks) {
+      output->append_chunk(output_chunk);
+    }
+  }
+
+  return output;
+}
+
+TableColumnDefinitions Product::_output_column_definitions(const Table& left_table, const Table& right_table) {
   TableColumnDefinitions column_definitions;
 
   // add columns from left table to output
-  for (ColumnID column_id{0}; column_id < input_table_left()->column_count(); ++column_id) {
-    column_definitions.emplace_back(input_table_left()->column_definitions()[column_id]);
+  for (ColumnID column_id{0}; column_id < left_table.column_count(); ++column_id) {
+    column_definitions.emplace_back(left_table.column_definitions()[column_id]);
   }
 
   // add columns from right table to output
-  for (ColumnID column_id{0}; column_id < input_table_right()->column_count(); ++column_id) {
-    column_definitions.emplace_back(input_table_right()->column_definitions()[column_id]);
-  }
-
-  auto output = std::make_shared<Table>(column_definitions, TableType::References);
-
-  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
-      _add_product_of_two_chunks(output, chunk_id_left, chunk_id_right);
-    }
+  for (ColumnID column_id{0}; column_id < right_table.column_count(); ++column_id) {
+    column_definitions.emplace_back(right_table.column_definitions()[column_id]);
   }
 
-  return output;
+  return column_definitions;
 }
 
-void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, ChunkID chunk_id_left,
-                                         ChunkID chunk_id_right) {
-  const auto chunk_left = input_table_left()->get_chunk(chunk_id_left);
-  const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
+std::shared_ptr<Chunk> Product::_product_of_two_chunks(const std::shared_ptr<const Table>& left_table,
+                                                       const ChunkID chunk_id_left,
+                                                       const std::shared_ptr<const Table>& right_table,
+                                                       const ChunkID chunk_id_right) {
+  const auto chunk_left = left_table->get_chunk(chunk_id_left);
+  const auto chunk_right = right_table->get_chunk(chunk_id_right);
+  if (chunk_left->size() == 0 || chunk_right->size() == 0) return nullptr;
 
   // we use an approach here in which we do not have nested loops for left and right but create both sides separately
   // When the result looks like this:
@@ -64,8 +102,6 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
   for (const auto& chunk_in : {chunk_left, chunk_right}) {
     // reusing the same code for left and right side - using a reference_wrapper is ugly, but better than code
     // duplication
-    auto table = is_left_side ? input_table_left() : input_table_right();
-
     for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
       std::shared_ptr<const Table> referenced_table;
       ColumnID referenced_segment;
@@ -77,7 +113,7 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
         referenced_segment = reference_segment_in->referenced_column_id();
         pos_list_in = reference_segment_in->pos_list();
       } else {
-        referenced_table = is_left_side ? input_table_left() : input_table_right();
+        referenced_table = is_left_side ? left_table : right_table;
         referenced_segment = column_id;
       }
 
@@ -105,7 +141,7 @@ void Product::_add_product_of_two_chunks(const std::shared_ptr<Table>& output, C
     is_left_side = false;
   }
 
-  output->append_chunk(output_segments);
+  return std::make_shared<Chunk>(output_segments);
 }
 std::shared_ptr<AbstractOperator> Product::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
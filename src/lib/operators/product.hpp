@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "pipeline.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -14,6 +15,11 @@ namespace opossum {
  * Operator to calculate the cartesian product (unconditional join)
  * This is for demonstration purposes and for supporting the full relational algebra.
  *
+ * Each pair of a left and a right chunk becomes an output chunk. The left chunks are processed in parallel, in morsels
+ * (see MorselPlanner). As a stage of a Pipeline, the product of a morsel of the left input with the right input is
+ * only computed when the morsel is pushed through the Pipeline, so that the following stages (e.g., a TableScan)
+ * discard most of the rows before the next morsel is processed and the whole product is never materialized.
+ *
  * Note: Product does not support null values at the moment
  */
 class Product : public AbstractReadOnlyOperator {
@@ -22,8 +28,18 @@ class Product : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  // For Pipelines: The morsels are chunks of the left input, each is combined with all chunks of @param right_table
+  MorselProcessor create_morsel_processor(const std::shared_ptr<const Table>& right_table) const;
+
  protected:
-  void _add_product_of_two_chunks(const std::shared_ptr<Table>& output, ChunkID chunk_id_left, ChunkID chunk_id_right);
+  static TableColumnDefinitions _output_column_definitions(const Table& left_table, const Table& right_table);
+
+  // Returns nullptr if one of the chunks is empty
+  static std::shared_ptr<Chunk> _product_of_two_chunks(const std::shared_ptr<const Table>& left_table,
+                                                       const ChunkID chunk_id_left,
+                                                       const std::shared_ptr<const Table>& right_table,
+                                                       const ChunkID chunk_id_right);
+
   std::shared_ptr<const Table> _on_execute() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
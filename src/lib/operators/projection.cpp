@@ -2,8 +2,10 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -12,7 +14,11 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "morsel_planner.hpp"
+#include "resolve_type.hpp"
+#include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
+#include "utils/timer.hpp"
 
 namespace opossum {
 
@@ -22,10 +28,24 @@ Projection::Projection(const std::shared_ptr<const AbstractOperator>& in,
 
 const std::string Projection::name() const { return "Projection"; }
 
+const std::string Projection::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  std::stringstream stream;
+  stream << name();
+  if (_row_budget) stream << separator << "(first " << *_row_budget << " rows)";
+  return stream.str();
+}
+
+void Projection::set_row_budget(const std::optional<size_t>& row_budget) { _row_budget = row_budget; }
+
+const std::optional<size_t>& Projection::row_budget() const { return _row_budget; }
+
 std::shared_ptr<AbstractOperator> Projection::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Projection>(copied_input_left, expressions_deep_copy(expressions));
+  auto copy = std::make_shared<Projection>(copied_input_left, expressions_deep_copy(expressions));
+  copy->set_row_budget(_row_budget);
+  return copy;
 }
 
 void Projection::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
@@ -37,6 +57,81 @@ void Projection::_on_set_transaction_context(const std::weak_ptr<TransactionCont
 }
 
 std::shared_ptr<const Table> Projection::_on_execute() {
+  const auto output_table = _create_output_table(*input_table_left());
+  const auto forward_columns = input_table_left()->type() == output_table->type();
+
+  const auto uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache(expressions);
+
+  /**
+   * Perform the projection, in parallel for each chunk. The chunks are appended to the output table afterwards to keep
+   * their order.
+   */
+  auto chunk_count = input_table_left()->chunk_count();
+
+  // With a row budget, the chunks after those that already hold enough rows are not projected
+  if (_row_budget) {
+    auto row_count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      if (row_count >= *_row_budget) {
+        chunk_count = chunk_id;
+        break;
+      }
+      row_count += input_table_left()->get_chunk(chunk_id)->size();
+    }
+  }
+
+  auto output_segments_by_chunk = std::vector<Segments>(chunk_count);
+
+  auto chunk_ids = std::vector<ChunkID>(chunk_count);
+  std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0});
+
+  MorselPlanner::for_each_chunk(type(), *input_table_left(), chunk_ids, [&](const ChunkID chunk_id) {
+    Timer timer;
+    auto& output_segments = output_segments_by_chunk[chunk_id];
+    output_segments = _project_chunk(input_table_left(), chunk_id, forward_columns, uncorrelated_select_results);
+
+    // Forwarded segments are not materialized by the projection
+    for (auto column_id = ColumnID{0}; column_id < output_segments.size(); ++column_id) {
+      const auto& expression = *expressions[column_id];
+      if (expression.type == ExpressionType::PQPColumn && forward_columns) continue;
+      _performance_data->bytes_materialized += output_segments[column_id]->estimate_memory_usage();
+    }
+
+    _performance_data->add_task_walltime(timer.lap());
+  });
+  _performance_data->chunks_processed += chunk_count;
+  _performance_data->chunks_skipped += input_table_left()->chunk_count() - chunk_count;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    output_table->append_chunk(output_segments_by_chunk[chunk_id]);
+    output_table->get_chunk(chunk_id)->set_mvcc_data(input_table_left()->get_chunk(chunk_id)->mvcc_data());
+    _forward_ordered_by(*input_table_left()->get_chunk(chunk_id), *output_table->get_chunk(chunk_id));
+  }
+
+  return output_table;
+}
+
+MorselProcessor Projection::create_morsel_processor() const {
+  const auto uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache(expressions);
+
+  // The processor is only used while this operator is executed as a stage of a Pipeline
+  return [this, uncorrelated_select_results](const std::shared_ptr<const Table>& in_table,
+                                             const std::vector<ChunkID>& chunk_ids) {
+    const auto output_table = _create_output_table(*in_table);
+    const auto forward_columns = in_table->type() == output_table->type();
+
+    for (const auto chunk_id : chunk_ids) {
+      output_table->append_chunk(_project_chunk(in_table, chunk_id, forward_columns, uncorrelated_select_results));
+      const auto output_chunk = output_table->get_chunk(ChunkID{output_table->chunk_count() - 1});
+      output_chunk->set_mvcc_data(in_table->get_chunk(chunk_id)->mvcc_data());
+      _forward_ordered_by(*in_table->get_chunk(chunk_id), *output_chunk);
+    }
+
+    return output_table;
+  };
+}
+
+std::shared_ptr<Table> Projection::_create_output_table(const Table& in_table) const {
   /**
    * Determine the TableColumnDefinitions
    */
@@ -53,39 +148,89 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     return expression->type == ExpressionType::PQPColumn;
   });
 
-  const auto output_table_type = only_projects_columns ? input_table_left()->type() : TableType::Data;
-  const auto forward_columns = input_table_left()->type() == output_table_type;
+  const auto output_table_type = only_projects_columns ? in_table.type() : TableType::Data;
 
-  const auto output_table =
-      std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, input_table_left()->has_mvcc());
+  return std::make_shared<Table>(column_definitions, output_table_type, std::nullopt, in_table.has_mvcc());
+}
 
-  const auto uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache(expressions);
+void Projection::_forward_ordered_by(const Chunk& input_chunk, Chunk& output_chunk) const {
+  const auto& ordered_by = input_chunk.ordered_by();
+  if (!ordered_by) return;
 
-  /**
-   * Perform the projection
-   */
-  for (auto chunk_id = ChunkID{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    Segments output_segments;
-    output_segments.reserve(expressions.size());
-
-    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
-
-    ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_select_results);
-    for (const auto& expression : expressions) {
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
-        const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
-        output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
-      } else {
-        output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
-      }
+  for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expressions[column_id]);
+    if (pqp_column_expression && pqp_column_expression->column_id == ordered_by->first) {
+      output_chunk.set_ordered_by({column_id, ordered_by->second});
+      return;
     }
+  }
+}
+
+Segments Projection::_project_chunk(
+    const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id, const bool forward_columns,
+    const std::shared_ptr<ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results) const {
+  auto output_segments = Segments{};
+  output_segments.reserve(expressions.size());
 
-    output_table->append_chunk(output_segments);
-    output_table->get_chunk(chunk_id)->set_mvcc_data(input_chunk->mvcc_data());
+  const auto input_chunk = in_table->get_chunk(chunk_id);
+  const auto chunk_size = input_chunk->size();
+
+  // Large chunks are evaluated in batches, so that the intermediate results of the expressions stay in the cache. The
+  // segments of the batches are appended to one ValueSegment per expression.
+  const auto evaluate_in_batches = chunk_size > ExpressionEvaluator::BATCH_SIZE;
+
+  ExpressionEvaluator evaluator(in_table, chunk_id, uncorrelated_select_results);
+  for (const auto& expression : expressions) {
+    // Forward input column if possible
+    if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+      const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(expression);
+      output_segments.emplace_back(input_chunk->get_segment(pqp_column_expression->column_id));
+    } else if (evaluate_in_batches) {
+      output_segments.emplace_back(nullptr);
+    } else {
+      output_segments.emplace_back(evaluator.evaluate_expression_to_segment(*expression));
+    }
   }
 
-  return output_table;
+  if (!evaluate_in_batches) return output_segments;
+
+  auto batched_segments = std::vector<std::shared_ptr<BaseValueSegment>>(expressions.size());
+  for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+    if (output_segments[column_id]) continue;
+
+    resolve_data_type(expressions[column_id]->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      batched_segments[column_id] =
+          std::make_shared<ValueSegment<ColumnDataType>>(expressions[column_id]->is_nullable());
+    });
+    batched_segments[column_id]->reserve(chunk_size);
+    output_segments[column_id] = batched_segments[column_id];
+  }
+
+  constexpr auto batch_size = ExpressionEvaluator::BATCH_SIZE;
+  for (auto batch_begin = ChunkOffset{0}; batch_begin < chunk_size; batch_begin += batch_size) {
+    const auto batch_end = std::min(static_cast<ChunkOffset>(batch_begin + batch_size), chunk_size);
+    auto batch = std::make_shared<PosList>();
+    batch->set_chunk_range(chunk_id, batch_begin, batch_end);
+
+    // Expressions that share columns materialize them once per batch
+    ExpressionEvaluator batch_evaluator(in_table, chunk_id, batch, uncorrelated_select_results);
+    for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+      if (!batched_segments[column_id]) continue;
+
+      const auto batch_segment = batch_evaluator.evaluate_expression_to_segment(*expressions[column_id]);
+
+      // No one else holds the batch's segment, so its values (e.g., strings) are moved instead of copied
+      resolve_data_type(expressions[column_id]->data_type(), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+        auto& source = static_cast<ValueSegment<ColumnDataType>&>(*batch_segment);
+        auto& target = static_cast<ValueSegment<ColumnDataType>&>(*batched_segments[column_id]);
+        target.append_values(std::move(source));
+      });
+    }
+  }
+
+  return output_segments;
 }
 
 // returns the singleton dummy table used for literal projections
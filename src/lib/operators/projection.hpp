@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -12,6 +13,8 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "pipeline.hpp"
 
 namespace opossum {
 
@@ -24,6 +27,14 @@ class Projection : public AbstractReadOnlyOperator {
              const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
   const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  /**
+   * If set, only the first chunks of the input that hold at least this many rows are projected. Set by the
+   * LQPTranslator if the Projection is consumed by a Limit with a constant row count.
+   */
+  void set_row_budget(const std::optional<size_t>& row_budget);
+  const std::optional<size_t>& row_budget() const;
 
   /**
    * The dummy table is used for literal projections that have no input table.
@@ -43,6 +54,9 @@ class Projection : public AbstractReadOnlyOperator {
 
   static std::shared_ptr<Table> dummy_table();
 
+  // Projects morsels, see Pipeline. Uncorrelated subqueries are evaluated once, when the processor is created.
+  MorselProcessor create_morsel_processor() const;
+
   const std::vector<std::shared_ptr<AbstractExpression>> expressions;
 
  protected:
@@ -53,6 +67,19 @@ class Projection : public AbstractReadOnlyOperator {
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+
+  // The empty output table for an input table
+  std::shared_ptr<Table> _create_output_table(const Table& in_table) const;
+
+  Segments _project_chunk(
+      const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id, const bool forward_columns,
+      const std::shared_ptr<ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results) const;
+
+  // If the input chunk is ordered by a column that is projected as is, the output chunk is ordered by it as well
+  void _forward_ordered_by(const Chunk& input_chunk, Chunk& output_chunk) const;
+
+ private:
+  std::optional<size_t> _row_budget;
 };
 
 }  // namespace opossum
@@ -1,248 +1,740 @@
 #include "sort.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <queue>
+#include <sstream>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "constant_mappings.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/shared_dictionaries.hpp"
 #include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+using namespace opossum;  // NOLINT
+
+// Strings are encoded by this many bytes, followed by their length (see encode_value())
+constexpr auto STRING_PREFIX_LENGTH = size_t{8};
+
+// The first byte of each column's part of a key orders NULLs before or after all values
+constexpr auto NULL_FIRST_BYTE = uint8_t{0};
+constexpr auto VALUE_BYTE = uint8_t{1};
+constexpr auto NULL_LAST_BYTE = uint8_t{2};
+
+// The number of bytes that encode a value of the given type
+template <typename T>
+constexpr size_t encoded_value_width() {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return STRING_PREFIX_LENGTH + 1;
+  } else {
+    return sizeof(T);
+  }
+}
+
+// Writes the bytes of an unsigned integer, the most significant byte first, so that memcmp() orders them like the
+// integers
+template <typename UnsignedInteger>
+void encode_big_endian(UnsignedInteger value, uint8_t* key) {
+  for (auto byte_id = sizeof(UnsignedInteger); byte_id > 0; --byte_id) {
+    key[byte_id - 1] = static_cast<uint8_t>(value & 0xFFu);
+    value >>= 8u;
+  }
+}
+
+// Encodes a value so that memcmp() orders the encoded values like the values
+template <typename T>
+void encode_value(const T& value, uint8_t* key) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Shorter strings are padded with zeros. Their length then orders them after the strings that they start with.
+    // Only strings that are longer than the prefix can have the same encoding and still differ.
+    const auto prefix_length = std::min(value.size(), STRING_PREFIX_LENGTH);
+    std::memcpy(key, value.data(), prefix_length);
+    std::memset(key + prefix_length, 0, STRING_PREFIX_LENGTH - prefix_length);
+    key[STRING_PREFIX_LENGTH] = static_cast<uint8_t>(std::min(value.size(), STRING_PREFIX_LENGTH + 1));
+  } else if constexpr (std::is_floating_point_v<T>) {
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = Bits{1} << (sizeof(T) * 8 - 1);
+
+    auto bits = Bits{};
+    std::memcpy(&bits, &value, sizeof(T));
+    // Larger negative values have larger bits, so they are inverted. Positive values come after all negative ones.
+    bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    encode_big_endian(bits, key);
+  } else if constexpr (std::is_signed_v<T>) {
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr auto SIGN_BIT = Unsigned{1} << (sizeof(T) * 8 - 1);
+
+    // Flipping the sign bit orders negative values before positive ones
+    encode_big_endian(static_cast<Unsigned>(static_cast<Unsigned>(value) ^ SIGN_BIT), key);
+  } else {
+    encode_big_endian(value, key);
+  }
+}
+
+// The part of the normalized keys that encodes the values of one sort column
+struct NormalizedKeyColumn {
+  ColumnID column_id{INVALID_COLUMN_ID};
+  bool descending{false};
+  bool nulls_first{true};
+
+  // The position of the column's NULL byte in the key and the number of bytes including it
+  size_t offset{0};
+  size_t width{0};
+
+  // Whether the key encodes the prefixes of strings (and not value IDs)
+  bool encodes_strings{false};
+
+  // Only set if the value IDs are encoded
+  std::vector<std::shared_ptr<const BaseDictionarySegment>> shared_dictionary_segments;
+
+  // For string columns, the strings that are longer than their encoded prefix, by row
+  std::vector<std::string> long_strings;
+  bool has_long_strings{false};
+
+  // The last byte of the encoding of long strings
+  uint8_t long_string_length_byte{0};
+};
+
+// Encodes the values of a segment into the keys of its rows, which start at first_key
+template <typename T>
+void encode_segment(const BaseSegment& segment, NormalizedKeyColumn& key_column, uint8_t* first_key,
+                    const size_t key_width, const size_t first_row) {
+  const auto encode_position = [&](const auto& position, const auto& value) {
+    auto* key = first_key + position.chunk_offset() * key_width + key_column.offset;
+
+    // The value bytes of NULLs stay zero
+    if (position.is_null()) {
+      key[0] = key_column.nulls_first ? NULL_FIRST_BYTE : NULL_LAST_BYTE;
+      return;
+    }
+
+    key[0] = VALUE_BYTE;
+    encode_value(value, key + 1);
+
+    if (key_column.descending) {
+      for (auto byte_id = size_t{1}; byte_id < key_column.width; ++byte_id) {
+        key[byte_id] = static_cast<uint8_t>(~key[byte_id]);
+      }
+    }
+  };
+
+  if (!key_column.shared_dictionary_segments.empty()) {
+    const auto& dictionary_segment = static_cast<const BaseDictionarySegment&>(segment);
+    create_iterable_from_attribute_vector(dictionary_segment).for_each([&](const auto& position) {
+      encode_position(position, static_cast<ValueID::base_type>(position.value()));
+    });
+    return;
+  }
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    encode_position(position, position.value());
+
+    if constexpr (std::is_same_v<T, std::string>) {
+      if (!position.is_null() && position.value().size() > STRING_PREFIX_LENGTH) {
+        key_column.long_strings[first_row + position.chunk_offset()] = position.value();
+      }
+    }
+  });
+}
+
+// Compares two normalized keys. Only long strings whose encodings are equal are compared in full. They are returned by
+// left_long_string and right_long_string, which take the index of the column in long_string_columns.
+template <typename LeftLongString, typename RightLongString>
+bool normalized_key_less(const uint8_t* left_key, const uint8_t* right_key, const size_t key_width,
+                         const std::vector<const NormalizedKeyColumn*>& long_string_columns,
+                         const LeftLongString& left_long_string, const RightLongString& right_long_string) {
+  auto compared_width = size_t{0};
+  for (auto long_string_column_id = size_t{0}; long_string_column_id < long_string_columns.size();
+       ++long_string_column_id) {
+    const auto* key_column = long_string_columns[long_string_column_id];
+    const auto column_end = key_column->offset + key_column->width;
+    const auto result = std::memcmp(left_key + compared_width, right_key + compared_width, column_end - compared_width);
+    if (result != 0) return result < 0;
+    compared_width = column_end;
+
+    // Both keys encode the same prefix of two strings that are longer than it
+    if (left_key[column_end - 1] == key_column->long_string_length_byte) {
+      const auto& left_string = left_long_string(long_string_column_id);
+      const auto& right_string = right_long_string(long_string_column_id);
+      if (left_string != right_string) {
+        return key_column->descending ? left_string > right_string : left_string < right_string;
+      }
+    }
+  }
+
+  return std::memcmp(left_key + compared_width, right_key + compared_width, key_width - compared_width) < 0;
+}
+
+// Orders rows by their normalized keys
+class NormalizedKeyComparator {
+ public:
+  NormalizedKeyComparator(const std::vector<uint8_t>& keys, const size_t key_width,
+                          const std::vector<NormalizedKeyColumn>& key_columns)
+      : _keys(keys.data()), _key_width(key_width) {
+    for (const auto& key_column : key_columns) {
+      if (key_column.has_long_strings) _long_string_columns.emplace_back(&key_column);
+    }
+  }
+
+  bool operator()(const uint32_t left_row, const uint32_t right_row) const {
+    return normalized_key_less(
+        _keys + size_t{left_row} * _key_width, _keys + size_t{right_row} * _key_width, _key_width,
+        _long_string_columns, [&](const auto column_id) -> const std::string& {
+          return _long_string_columns[column_id]->long_strings[left_row];
+        },
+        [&](const auto column_id) -> const std::string& {
+          return _long_string_columns[column_id]->long_strings[right_row];
+        });
+  }
+
+ private:
+  const uint8_t* _keys;
+  const size_t _key_width;
+  std::vector<const NormalizedKeyColumn*> _long_string_columns;
+};
+
+// Encodes the keys of the rows of the chunks [chunk_begin, chunk_end), one job per chunk. The rows are numbered
+// starting with the first row of chunk_begin.
+void encode_chunks(const Table& input_table, std::vector<NormalizedKeyColumn>& key_columns, const size_t key_width,
+                   const ChunkID chunk_begin, const ChunkID chunk_end, std::vector<uint8_t>& keys,
+                   std::vector<RowID>& row_ids) {
+  auto first_row_by_chunk = std::vector<size_t>{0};
+  for (auto chunk_id = chunk_begin; chunk_id < chunk_end; ++chunk_id) {
+    first_row_by_chunk.emplace_back(first_row_by_chunk.back() + input_table.get_chunk(chunk_id)->size());
+  }
+  const auto row_count = first_row_by_chunk.back();
+
+  // The value bytes of NULLs are expected to be zero
+  keys.assign(row_count * key_width, uint8_t{0});
+  row_ids.resize(row_count);
+  for (auto& key_column : key_columns) {
+    if (key_column.encodes_strings) key_column.long_strings.assign(row_count, std::string{});
+  }
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_end - chunk_begin);
+  for (auto chunk_id = chunk_begin; chunk_id < chunk_end; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = input_table.get_chunk(chunk_id);
+      const auto first_row = first_row_by_chunk[chunk_id - chunk_begin];
+
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        row_ids[first_row + chunk_offset] = RowID{chunk_id, chunk_offset};
+      }
+
+      for (auto& key_column : key_columns) {
+        const auto segment = key_column.shared_dictionary_segments.empty()
+                                 ? chunk->get_segment(key_column.column_id)
+                                 : std::static_pointer_cast<const BaseSegment>(
+                                       key_column.shared_dictionary_segments[chunk_id]);
+        resolve_data_type(input_table.column_data_type(key_column.column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          encode_segment<ColumnDataType>(*segment, key_column, keys.data() + first_row * key_width, key_width,
+                                         first_row);
+        });
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (auto& key_column : key_columns) {
+    key_column.has_long_strings = std::any_of(key_column.long_strings.cbegin(), key_column.long_strings.cend(),
+                                              [](const auto& string) { return !string.empty(); });
+  }
+}
+
+// Keeps only the rows that can be among the first row_limit rows of the sorted rows, in their input order. Each job
+// keeps the first rows of a range in a max-heap, where rows with equal keys are ordered by their input position.
+void keep_first_rows(std::vector<uint32_t>& rows, const NormalizedKeyComparator& comparator, const size_t row_limit,
+                     const size_t min_rows_per_job) {
+  const auto heap_comparator = [&](const uint32_t left_row, const uint32_t right_row) {
+    if (comparator(left_row, right_row)) return true;
+    return !comparator(right_row, left_row) && left_row < right_row;
+  };
+
+  const auto range_count = std::max(rows.size() / min_rows_per_job, size_t{1});
+  auto candidates_by_range = std::vector<std::vector<uint32_t>>(range_count);
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(range_count);
+  for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_id]() {
+      auto heap = std::priority_queue<uint32_t, std::vector<uint32_t>, decltype(heap_comparator)>{heap_comparator};
+      const auto range_end = rows.size() * (range_id + 1) / range_count;
+      for (auto row_index = rows.size() * range_id / range_count; row_index < range_end; ++row_index) {
+        const auto row = rows[row_index];
+        if (heap.size() < row_limit) {
+          heap.push(row);
+        } else if (row_limit > 0 && heap_comparator(row, heap.top())) {
+          heap.pop();
+          heap.push(row);
+        }
+      }
+
+      auto& candidates = candidates_by_range[range_id];
+      candidates.reserve(heap.size());
+      for (; !heap.empty(); heap.pop()) candidates.emplace_back(heap.top());
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // The candidates are kept in their input order, so that sorting them is stable
+  rows.clear();
+  for (const auto& candidates : candidates_by_range) {
+    rows.insert(rows.end(), candidates.cbegin(), candidates.cend());
+  }
+  std::sort(rows.begin(), rows.end());
+}
+
+// Sorts runs of rows in parallel and merges them pairwise until a single run is left. Both std::stable_sort and
+// std::merge keep the order of rows with equal keys, so the sort is stable.
+void sort_rows(std::vector<uint32_t>& rows, const NormalizedKeyComparator& comparator, const size_t min_rows_per_job) {
+  const auto run_count = std::max(rows.size() / min_rows_per_job, size_t{1});
+  auto run_offsets = std::vector<size_t>(run_count + 1);
+  for (auto run_id = size_t{0}; run_id <= run_count; ++run_id) {
+    run_offsets[run_id] = rows.size() * run_id / run_count;
+  }
+
+  // The comparator is passed as a reference, because the algorithms copy it frequently
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(run_count);
+  for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, run_id]() {
+      std::stable_sort(rows.begin() + run_offsets[run_id], rows.begin() + run_offsets[run_id + 1],
+                       std::cref(comparator));
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  auto merged_rows = std::vector<uint32_t>(run_count > 1 ? rows.size() : 0);
+  while (run_offsets.size() > 2) {
+    auto merged_run_offsets = std::vector<size_t>{0};
+
+    jobs.clear();
+    for (auto run_id = size_t{0}; run_id + 1 < run_offsets.size(); run_id += 2) {
+      // An odd last run is copied, all others are merged with their right neighbor
+      const auto begin = run_offsets[run_id];
+      const auto middle = run_offsets[run_id + 1];
+      const auto end = run_id + 2 < run_offsets.size() ? run_offsets[run_id + 2] : middle;
+      merged_run_offsets.emplace_back(end);
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, begin, middle, end]() {
+        std::merge(rows.cbegin() + begin, rows.cbegin() + middle, rows.cbegin() + middle, rows.cbegin() + end,
+                   merged_rows.begin() + begin, std::cref(comparator));
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    std::swap(rows, merged_rows);
+    run_offsets = std::move(merged_run_offsets);
+  }
+}
+
+// A row of a spilled run. Long strings are stored behind the key, in the order of the string columns.
+struct SpilledRow {
+  std::vector<uint8_t> key;
+  RowID row_id;
+  std::vector<std::string> long_strings;
+};
+
+bool is_long_string(const uint8_t* key, const NormalizedKeyColumn& key_column) {
+  return key[key_column.offset + key_column.width - 1] == key_column.long_string_length_byte;
+}
+
+void write_spilled_row(SpillFile& file, const uint8_t* key, const size_t key_width, const RowID& row_id,
+                       const std::vector<const NormalizedKeyColumn*>& string_columns, const size_t row) {
+  file.write(key, key_width);
+  file.write(&row_id, sizeof(RowID));
+  for (const auto* key_column : string_columns) {
+    if (!is_long_string(key, *key_column)) continue;
+    const auto& string = key_column->long_strings[row];
+    const auto length = static_cast<uint32_t>(string.size());
+    file.write(&length, sizeof(length));
+    file.write(string.data(), length);
+  }
+}
+
+// Returns false if the run has no more rows
+bool read_spilled_row(SpillFile& file, SpilledRow& spilled_row,
+                      const std::vector<const NormalizedKeyColumn*>& string_columns) {
+  if (!file.read(spilled_row.key.data(), spilled_row.key.size())) return false;
+  Assert(file.read(&spilled_row.row_id, sizeof(RowID)), "Spill file is truncated");
+  for (auto string_column_id = size_t{0}; string_column_id < string_columns.size(); ++string_column_id) {
+    if (!is_long_string(spilled_row.key.data(), *string_columns[string_column_id])) continue;
+    auto length = uint32_t{0};
+    Assert(file.read(&length, sizeof(length)), "Spill file is truncated");
+    auto& string = spilled_row.long_strings[string_column_id];
+    string.resize(length);
+    Assert(file.read(string.data(), length), "Spill file is truncated");
+  }
+  return true;
+}
+
+}  // namespace
 
 namespace opossum {
 
 Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
            const size_t output_chunk_size)
+    : Sort(in, std::vector<SortColumnDefinition>{SortColumnDefinition{column_id, order_by_mode}}, output_chunk_size) {}
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size, const std::optional<size_t>& row_limit,
+           const std::optional<SpillOptions>& spill_options)
     : AbstractReadOnlyOperator(OperatorType::Sort, in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+      _sort_definitions(sort_definitions),
+      _output_chunk_size(output_chunk_size),
+      _row_limit(row_limit),
+      _spill_options(spill_options) {
+  Assert(!_sort_definitions.empty(), "Expected at least one column to sort by");
+}
+
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
 
-ColumnID Sort::column_id() const { return _column_id; }
+const std::optional<size_t>& Sort::row_limit() const { return _row_limit; }
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+const std::optional<SpillOptions>& Sort::spill_options() const { return _spill_options; }
+
+ColumnID Sort::column_id() const { return _sort_definitions.front().column; }
+
+OrderByMode Sort::order_by_mode() const { return _sort_definitions.front().order_by_mode; }
 
 const std::string Sort::name() const { return "Sort"; }
 
+const std::string Sort::description(DescriptionMode description_mode) const {
+  auto stream = std::stringstream{};
+  stream << "[Sort] ";
+  for (auto definition_id = size_t{0}; definition_id < _sort_definitions.size(); ++definition_id) {
+    const auto& definition = _sort_definitions[definition_id];
+    stream << "Column #" << definition.column << " " << order_by_mode_to_string.at(definition.order_by_mode);
+    if (definition_id + 1 < _sort_definitions.size()) stream << ", ";
+  }
+  if (_row_limit) stream << " (first " << *_row_limit << " rows)";
+  return stream.str();
+}
+
 std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Sort>(copied_input_left, _column_id, _order_by_mode, _output_chunk_size);
+  return std::make_shared<Sort>(copied_input_left, _sort_definitions, _output_chunk_size, _row_limit, _spill_options);
 }
 
 void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
 std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
-      input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
-      _output_chunk_size);
-  return _impl->_on_execute();
-}
+  const auto& input_table = input_table_left();
+  const auto chunk_count = input_table->chunk_count();
+  const auto row_count = input_table->row_count();
+  Assert(row_count < std::numeric_limits<uint32_t>::max(), "Too many rows to sort");
+
+  /**
+   * 1. Lay out the normalized keys. Value IDs of a shared dictionary are ordered like the values, but are much
+   *    cheaper to encode and compare (e.g., for strings).
+   */
+  auto key_columns = std::vector<NormalizedKeyColumn>(_sort_definitions.size());
+  auto key_width = size_t{0};
+  for (auto definition_id = size_t{0}; definition_id < _sort_definitions.size(); ++definition_id) {
+    const auto& definition = _sort_definitions[definition_id];
+    auto& key_column = key_columns[definition_id];
+
+    key_column.column_id = definition.column;
+    key_column.descending = definition.order_by_mode == OrderByMode::Descending ||
+                            definition.order_by_mode == OrderByMode::DescendingNullsLast;
+    key_column.nulls_first =
+        definition.order_by_mode == OrderByMode::Ascending || definition.order_by_mode == OrderByMode::Descending;
+    key_column.shared_dictionary_segments = segments_with_shared_dictionary(*input_table, definition.column);
+
+    auto value_width = sizeof(ValueID::base_type);
+    if (key_column.shared_dictionary_segments.empty()) {
+      resolve_data_type(input_table->column_data_type(definition.column), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        value_width = encoded_value_width<ColumnDataType>();
 
-void Sort::_on_cleanup() { _impl.reset(); }
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          key_column.encodes_strings = true;
+          const auto length_byte = static_cast<uint8_t>(STRING_PREFIX_LENGTH + 1);
+          key_column.long_string_length_byte =
+              key_column.descending ? static_cast<uint8_t>(~length_byte) : length_byte;
+        }
+      });
+    }
 
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
-template <typename SortColumnType>
-class Sort::SortImplMaterializeOutput {
- public:
-  // creates a new table with reference segments
-  SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
-                            const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+    key_column.offset = key_width;
+    key_column.width = 1 + value_width;
+    key_width += key_column.width;
+  }
 
-  std::shared_ptr<const Table> execute() {
-    // First we create a new table as the output
-    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
+  auto string_columns = std::vector<const NormalizedKeyColumn*>{};
+  for (const auto& key_column : key_columns) {
+    if (key_column.encodes_strings) string_columns.emplace_back(&key_column);
+  }
 
-    // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+  // The keys, row numbers, and RowIDs that an in-memory sort holds per row (not counting the characters of long
+  // strings)
+  const auto bytes_per_row =
+      key_width + 2 * sizeof(uint32_t) + 2 * sizeof(RowID) + string_columns.size() * sizeof(std::string);
 
-    // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input segment with a reference
-    // to the output segment. This enables for the SortImplMaterializeOutput class to ignore the column types during the
-    // copying of the values.
-    const auto row_count_out = _row_id_value_vector->size();
+  auto output = std::make_shared<Table>(input_table->column_definitions(), TableType::Data, _output_chunk_size);
 
-    // Ceiling of integer division
-    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+  auto keys = std::vector<uint8_t>{};
+  auto row_ids = std::vector<RowID>{};
 
-    const auto chunk_count_out = div_ceil(row_count_out, _output_chunk_size);
+  if (!_spill_options || row_count * bytes_per_row <= _spill_options->memory_budget) {
+    /**
+     * 2. Encode the keys, one job per chunk
+     */
+    encode_chunks(*input_table, key_columns, key_width, ChunkID{0}, chunk_count, keys, row_ids);
 
-    // Vector of segments for each chunk
-    std::vector<Segments> output_segments_by_chunk(chunk_count_out);
+    /**
+     * 3. Sort the rows in parallel. With a row limit, only the rows that can be among the first rows are sorted.
+     */
+    const auto comparator = NormalizedKeyComparator{keys, key_width, key_columns};
 
-    // Materialize segment-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-      const auto column_data_type = output->column_data_type(column_id);
+    auto rows = std::vector<uint32_t>(row_count);
+    std::iota(rows.begin(), rows.end(), uint32_t{0});
 
-      resolve_data_type(column_data_type, [&](auto type) {
-        using ColumnDataType = typename decltype(type)::type;
+    if (_row_limit && *_row_limit < row_count) keep_first_rows(rows, comparator, *_row_limit, MIN_ROWS_PER_SORT_JOB);
+    sort_rows(rows, comparator, MIN_ROWS_PER_SORT_JOB);
+    if (_row_limit && *_row_limit < rows.size()) rows.resize(*_row_limit);
 
-        auto chunk_it = output_segments_by_chunk.begin();
-        auto chunk_offset_out = 0u;
+    auto sorted_row_ids = std::vector<RowID>(rows.size());
+    for (auto row_id = size_t{0}; row_id < rows.size(); ++row_id) {
+      sorted_row_ids[row_id] = row_ids[rows[row_id]];
+    }
 
-        auto value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
-        auto value_segment_null_vector = pmr_concurrent_vector<bool>();
+    /**
+     * 4. Materialization of the result: We take the sorted RowIDs, create chunks, fill them until they are full and
+     *    create the next one.
+     */
+    _materialize_output(sorted_row_ids, *output);
+    return output;
+  }
 
-        value_segment_value_vector.reserve(row_count_out);
-        value_segment_null_vector.reserve(row_count_out);
+  /**
+   * External sort: Consecutive chunks whose state fits into the memory budget are sorted like above and written to a
+   * spill file as a sorted run. A run holds at least one chunk, even if it alone exceeds the budget. The runs are
+   * then merged, and the merged rows are materialized one output chunk at a time.
+   */
+  const auto rows_per_run = std::max(_spill_options->memory_budget / bytes_per_row, size_t{1});
+
+  auto spill_files = std::vector<std::unique_ptr<SpillFile>>{};
+  for (auto run_begin = ChunkID{0}; run_begin < chunk_count;) {
+    auto run_end = run_begin;
+    auto run_row_count = size_t{0};
+    while (run_end < chunk_count &&
+           (run_end == run_begin || run_row_count + input_table->get_chunk(run_end)->size() <= rows_per_run)) {
+      run_row_count += input_table->get_chunk(run_end)->size();
+      ++run_end;
+    }
 
-        auto segment_ptr_and_accessor_by_chunk_id =
-            std::unordered_map<ChunkID, std::pair<std::shared_ptr<const BaseSegment>,
-                                                  std::shared_ptr<BaseSegmentAccessor<ColumnDataType>>>>();
-        segment_ptr_and_accessor_by_chunk_id.reserve(row_count_out);
+    encode_chunks(*input_table, key_columns, key_width, run_begin, run_end, keys, row_ids);
+    run_begin = run_end;
+    if (run_row_count == 0) continue;
 
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto [chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;  // NOLINT
+    const auto comparator = NormalizedKeyComparator{keys, key_width, key_columns};
 
-          auto& segment_ptr_and_typed_ptr_pair = segment_ptr_and_accessor_by_chunk_id[chunk_id];
-          auto& base_segment = segment_ptr_and_typed_ptr_pair.first;
-          auto& accessor = segment_ptr_and_typed_ptr_pair.second;
+    auto rows = std::vector<uint32_t>(run_row_count);
+    std::iota(rows.begin(), rows.end(), uint32_t{0});
 
-          if (!base_segment) {
-            base_segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
-            accessor = create_segment_accessor<ColumnDataType>(base_segment);
-          }
+    // No run needs to contribute more rows than the limit
+    if (_row_limit && *_row_limit < run_row_count) {
+      keep_first_rows(rows, comparator, *_row_limit, MIN_ROWS_PER_SORT_JOB);
+    }
+    sort_rows(rows, comparator, MIN_ROWS_PER_SORT_JOB);
+    if (_row_limit && *_row_limit < rows.size()) rows.resize(*_row_limit);
 
-          // If the input segment is not a ReferenceSegment, we can take a fast(er) path
-          if (accessor) {
-            const auto typed_value = accessor->access(chunk_offset);
-            const auto is_null = !typed_value.has_value();
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-            value_segment_null_vector.push_back(is_null);
-          } else {
-            const auto value = (*base_segment)[chunk_offset];
-            const auto is_null = variant_is_null(value);
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : type_cast_variant<ColumnDataType>(value));
-            value_segment_null_vector.push_back(is_null);
-          }
+    spill_files.emplace_back(std::make_unique<SpillFile>(_spill_options->directory));
+    for (const auto row : rows) {
+      write_spilled_row(*spill_files.back(), keys.data() + size_t{row} * key_width, key_width, row_ids[row],
+                        string_columns, row);
+    }
+    spill_files.back()->rewind();
+  }
 
-          ++chunk_offset_out;
-
-          // Check if value segment is full
-          if (chunk_offset_out >= _output_chunk_size) {
-            chunk_offset_out = 0u;
-            auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                                std::move(value_segment_null_vector));
-            chunk_it->push_back(value_segment);
-            value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>();
-            value_segment_null_vector = pmr_concurrent_vector<bool>();
-            ++chunk_it;
-          }
-        }
+  keys = std::vector<uint8_t>{};
+  row_ids = std::vector<RowID>{};
+  for (auto& key_column : key_columns) {
+    key_column.long_strings = std::vector<std::string>{};
+  }
 
-        // Last segment has not been added
-        if (chunk_offset_out > 0u) {
-          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                              std::move(value_segment_null_vector));
-          chunk_it->push_back(value_segment);
-        }
-      });
-    }
+  // The runs are merged with a min-heap of the current row of each run. Rows with equal keys are taken from the runs
+  // in their input order, which keeps the sort stable.
+  const auto run_count = spill_files.size();
+  auto current_rows = std::vector<SpilledRow>(run_count);
+
+  const auto spilled_row_less = [&](const SpilledRow& left, const SpilledRow& right) {
+    return normalized_key_less(
+        left.key.data(), right.key.data(), key_width, string_columns,
+        [&](const auto column_id) -> const std::string& { return left.long_strings[column_id]; },
+        [&](const auto column_id) -> const std::string& { return right.long_strings[column_id]; });
+  };
+  const auto heap_comparator = [&](const size_t left_run_id, const size_t right_run_id) {
+    const auto& left_row = current_rows[left_run_id];
+    const auto& right_row = current_rows[right_run_id];
+    if (spilled_row_less(right_row, left_row)) return true;
+    return !spilled_row_less(left_row, right_row) && left_run_id > right_run_id;
+  };
+  auto heap = std::priority_queue<size_t, std::vector<size_t>, decltype(heap_comparator)>{heap_comparator};
+
+  for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+    current_rows[run_id].key.resize(key_width);
+    current_rows[run_id].long_strings.resize(string_columns.size());
+    if (read_spilled_row(*spill_files[run_id], current_rows[run_id], string_columns)) heap.push(run_id);
+  }
+
+  const auto output_row_count = _row_limit ? std::min(*_row_limit, row_count) : row_count;
+  auto sorted_row_ids = std::vector<RowID>{};
+  sorted_row_ids.reserve(std::min(_output_chunk_size, output_row_count));
 
-    for (auto& segments : output_segments_by_chunk) {
-      output->append_chunk(segments);
+  for (auto output_row = size_t{0}; output_row < output_row_count && !heap.empty(); ++output_row) {
+    const auto run_id = heap.top();
+    heap.pop();
+
+    sorted_row_ids.emplace_back(current_rows[run_id].row_id);
+    if (sorted_row_ids.size() == _output_chunk_size) {
+      _materialize_output(sorted_row_ids, *output);
+      sorted_row_ids.clear();
     }
 
-    return output;
+    if (read_spilled_row(*spill_files[run_id], current_rows[run_id], string_columns)) heap.push(run_id);
   }
+  _materialize_output(sorted_row_ids, *output);
 
- protected:
-  const std::shared_ptr<const Table> _table_in;
-  const size_t _output_chunk_size;
-  const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
-};
+  return output;
+}
 
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
-class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
-      : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
-  }
-
- protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      _sort_with_operator<std::less<>>();
-    } else {
-      _sort_with_operator<std::greater<>>();
+void Sort::_materialize_output(const std::vector<RowID>& sorted_row_ids, Table& output) const {
+  const auto& input_table = input_table_left();
+
+  // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+
+  // After we created the output table and initialized the column structure, we can start adding values. Because the
+  // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
+  // copied column by column, in parallel, for each output chunk.
+  const auto row_count_out = sorted_row_ids.size();
+
+  // Ceiling of integer division
+  const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+
+  const auto chunk_count_out = div_ceil(row_count_out, _output_chunk_size);
+  const auto chunk_count_in = input_table->chunk_count();
+
+  // The rows of each output chunk are grouped by their input chunk (with a counting sort), so that the type of each
+  // input segment is resolved once per output chunk and its values are read without a virtual call per row (see
+  // segment_with_accessor()). The grouping is shared by all columns.
+  struct RowsByInputChunk {
+    // Positions within the output chunk, ordered by input chunk
+    std::vector<ChunkOffset> rows;
+    // The rows of input chunk i are rows[offsets[i]] to rows[offsets[i + 1] - 1]
+    std::vector<size_t> offsets;
+  };
+
+  auto rows_by_input_chunk = std::vector<RowsByInputChunk>(chunk_count_out);
+  for (auto chunk_id_out = size_t{0}; chunk_id_out < chunk_count_out; ++chunk_id_out) {
+    const auto begin = chunk_id_out * _output_chunk_size;
+    const auto row_count = std::min(_output_chunk_size, row_count_out - begin);
+    auto& [rows, offsets] = rows_by_input_chunk[chunk_id_out];
+
+    offsets.resize(chunk_count_in + 1);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      ++offsets[sorted_row_ids[begin + row].chunk_id + 1];
     }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
 
-    // 2b. Insert null rows if necessary
-    if (!_null_value_rows->empty()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
-      }
+    auto write_offsets = std::vector<size_t>(offsets.begin(), offsets.end() - 1);
+    rows.resize(row_count);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      rows[write_offsets[sorted_row_ids[begin + row].chunk_id]++] = static_cast<ChunkOffset>(row);
     }
-
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    return materialization->execute();
   }
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+  // Vector of segments for each chunk
+  std::vector<Segments> output_segments_by_chunk(chunk_count_out, Segments(output.column_count()));
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(output.column_count());
 
-    auto& null_value_rows = *_null_value_rows;
+  // Materialize segment-wise
+  for (ColumnID column_id{0u}; column_id < output.column_count(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      const auto column_data_type = output.column_data_type(column_id);
+
+      resolve_data_type(column_data_type, [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
 
-    for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
-      auto chunk = _table_in->get_chunk(chunk_id);
+        for (auto chunk_id_out = size_t{0}; chunk_id_out < chunk_count_out; ++chunk_id_out) {
+          const auto begin = chunk_id_out * _output_chunk_size;
+          // Structured bindings cannot be captured by the lambda below
+          const auto& rows = rows_by_input_chunk[chunk_id_out].rows;
+          const auto& offsets = rows_by_input_chunk[chunk_id_out].offsets;
+
+          auto value_segment_value_vector = pmr_concurrent_vector<ColumnDataType>(rows.size());
+          auto value_segment_null_vector = pmr_concurrent_vector<bool>(rows.size());
+
+          for (auto chunk_id_in = ChunkID{0}; chunk_id_in < chunk_count_in; ++chunk_id_in) {
+            const auto rows_begin = offsets[chunk_id_in];
+            const auto rows_end = offsets[chunk_id_in + 1];
+            if (rows_begin == rows_end) continue;
+
+            const auto segment = input_table->get_chunk(chunk_id_in)->get_segment(column_id);
+            segment_with_accessor<ColumnDataType>(*segment, [&](const auto& accessor) {
+              // The input rows are read in random order, so their values are prefetched a few rows ahead
+              constexpr auto PREFETCH_DISTANCE = size_t{16};
+
+              for (auto row_index = rows_begin; row_index < rows_end; ++row_index) {
+                if (row_index + PREFETCH_DISTANCE < rows_end) {
+                  accessor.prefetch(sorted_row_ids[begin + rows[row_index + PREFETCH_DISTANCE]].chunk_offset);
+                }
+
+                const auto row = rows[row_index];
+                const auto typed_value = accessor.access(sorted_row_ids[begin + row].chunk_offset);
+                if (typed_value) {
+                  value_segment_value_vector[row] = *typed_value;
+                } else {
+                  value_segment_null_vector[row] = true;
+                }
+              }
+            });
+          }
 
-      auto base_segment = chunk->get_segment(_column_id);
+          output_segments_by_chunk[chunk_id_out][column_id] = std::make_shared<ValueSegment<ColumnDataType>>(
+              std::move(value_segment_value_vector), std::move(value_segment_null_vector));
 
-      segment_iterate<SortColumnType>(*base_segment, [&](const auto& position) {
-        if (position.is_null()) {
-          null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-        } else {
-          row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
+          // Materializing a large sorted table takes long, let queued tasks of higher priority run in between
+          CurrentScheduler::yield();
         }
       });
-    }
+    }));
+    jobs.back()->schedule();
   }
+  CurrentScheduler::wait_for_tasks(jobs);
 
-  template <typename Comparator>
-  void _sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+  // Each output chunk is sorted by the first sort column, which allows later scans to use binary search
+  const auto ordered_by = std::make_pair(column_id(), order_by_mode());
+  for (auto& segments : output_segments_by_chunk) {
+    output.append_chunk(segments);
+    output.get_chunk(ChunkID{output.chunk_count() - 1})->set_ordered_by(ordered_by);
   }
-
-  const std::shared_ptr<const Table> _table_in;
-
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
-  // chunk size of the materialized output
-  const size_t _output_chunk_size;
-
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
-};
+}
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -11,13 +12,40 @@
 #include "resolve_type.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "types.hpp"
+#include "utils/spill_file.hpp"
 
 namespace opossum {
 
+// Describes one of the columns that a Sort sorts by
+struct SortColumnDefinition final {
+  SortColumnDefinition(const ColumnID column, const OrderByMode order_by_mode = OrderByMode::Ascending)
+      : column(column), order_by_mode(order_by_mode) {}
+
+  ColumnID column;
+  OrderByMode order_by_mode;
+};
+
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
- * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * Operator to sort a table by one or more columns. This implements a stable sort, i.e., rows that share the same
+ * values will maintain their relative order.
+ *
+ * The values of the sort columns of each row are encoded into a normalized key, a byte string whose lexicographical
+ * order (i.e., memcmp()) is the order of the rows. This way, rows are compared without resolving data types, NULLs, or
+ * sort directions. Strings are encoded by a prefix, only strings that share a long prefix are compared in full. If all
+ * segments of a sort column share a dictionary (see shared_dictionaries.hpp), the value IDs are encoded instead of the
+ * values.
+ *
+ * The keys are sorted in parallel: runs of rows are sorted in separate jobs and then merged pairwise, again in
+ * parallel.
+ *
+ * If a row_limit is given, only the first row_limit rows of the sorted table are output (i.e., ORDER BY ... LIMIT k).
+ * Each job then only keeps the first rows of its run in a bounded heap, and only these candidates are sorted.
+ *
+ * If spill_options are given and the keys and RowIDs of all rows would take more than the memory budget, the Sort
+ * becomes an external merge sort: Groups of consecutive chunks that fit into the budget are sorted one after another
+ * and written to temporary files as sorted runs. The runs are then merged with a heap and the output is materialized
+ * one chunk at a time, so that only the current row of each run is kept in memory. The output table itself is not
+ * part of the budget.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -25,31 +53,39 @@ class Sort : public AbstractReadOnlyOperator {
   Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
        const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
 
+  // Sorts by the first definition, rows with equal values in it by the second one, and so on
+  Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::DEFAULT_SIZE, const std::optional<size_t>& row_limit = std::nullopt,
+       const std::optional<SpillOptions>& spill_options = std::nullopt);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  const std::optional<size_t>& row_limit() const;
+  const std::optional<SpillOptions>& spill_options() const;
+
+  // The first column that is sorted by and its OrderByMode
   ColumnID column_id() const;
   OrderByMode order_by_mode() const;
 
   const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
-  void _on_cleanup() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
-  template <typename SortColumnType>
-  class SortImpl;
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
-  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+  // Appends chunks with the rows in the given order to the output table
+  void _materialize_output(const std::vector<RowID>& sorted_row_ids, Table& output) const;
+
+  // Runs of at least this many rows are sorted by separate jobs
+  static constexpr auto MIN_ROWS_PER_SORT_JOB = size_t{65'536};
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
+  const std::optional<size_t> _row_limit;
+  const std::optional<SpillOptions> _spill_options;
 };
 
 }  // namespace opossum
@@ -1,8 +1,8 @@
 #include "table_scan.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
-#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -11,32 +11,38 @@
 #include <vector>
 
 #include "all_parameter_variant.hpp"
+#include "concurrency/transaction_context.hpp"
 #include "constant_mappings.hpp"
 #include "expression/between_expression.hpp"
 #include "expression/binary_predicate_expression.hpp"
 #include "expression/correlated_parameter_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
 #include "expression/is_null_expression.hpp"
+#include "expression/list_expression.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "operators/morsel_planner.hpp"
 #include "operators/operator_scan_predicate.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "resolve_type.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/proxy_chunk.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
+#include "table_scan/column_in_table_scan_impl.hpp"
 #include "table_scan/column_is_null_table_scan_impl.hpp"
 #include "table_scan/column_like_table_scan_impl.hpp"
 #include "table_scan/column_vs_column_table_scan_impl.hpp"
 #include "table_scan/column_vs_value_table_scan_impl.hpp"
+#include "table_scan/conjunction_table_scan_impl.hpp"
 #include "table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/timer.hpp"
 
 namespace opossum {
 
@@ -46,6 +52,12 @@ TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
 
 void TableScan::set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _excluded_chunk_ids = chunk_ids; }
 
+const std::vector<ChunkID>& TableScan::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
+void TableScan::set_row_budget(const std::optional<size_t>& row_budget) { _row_budget = row_budget; }
+
+const std::optional<size_t>& TableScan::row_budget() const { return _row_budget; }
+
 const std::shared_ptr<AbstractExpression>& TableScan::predicate() const { return _predicate; }
 
 const std::string TableScan::name() const { return "TableScan"; }
@@ -58,6 +70,7 @@ const std::string TableScan::description(DescriptionMode description_mode) const
   stream << name() << separator;
   stream << "Impl: " << _impl_description;
   stream << separator << _predicate->as_column_name();
+  if (_row_budget) stream << separator << "(first " << *_row_budget << " rows)";
 
   return stream.str();
 }
@@ -73,7 +86,10 @@ void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<TableScan>(copied_input_left, _predicate->deep_copy());
+  auto copy = std::make_shared<TableScan>(copied_input_left, _predicate->deep_copy());
+  copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  copy->set_row_budget(_row_budget);
+  return copy;
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
@@ -83,93 +99,155 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   _impl = create_impl();
   _impl_description = _impl->description();
+  _impl->set_pos_list_allocator(PosList::allocator_type{memory_resource()});
 
-  std::mutex output_mutex;
+  auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
-  const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
-
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
+  // Within a transaction, compacted chunks whose rows were moved before our snapshot was taken cannot match
+  const auto transaction_context = this->transaction_context();
+  if (in_table->type() == TableType::Data && transaction_context) {
+    const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+    for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+      const auto cleanup_commit_id = in_table->get_chunk(chunk_id)->cleanup_commit_id();
+      if (cleanup_commit_id && snapshot_commit_id >= *cleanup_commit_id) excluded_chunk_set.emplace(chunk_id);
+    }
+  }
 
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(in_table->chunk_count() - excluded_chunk_set.size());
   for (ChunkID chunk_id{0u}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
-
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
-      if (matches_out->empty()) return;
-
-      // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
-      // towards the original chunk.
-      Segments out_segments;
-
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference segments of the output. If it is a reference segment,
-       * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between segments as much as possible. Position lists can be shared between two segments iff
-       * (a) they point to the same table and
-       * (b) the reference segments of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (in_table->type() == TableType::References) {
-        const auto chunk_in = in_table->get_chunk(chunk_id);
-
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
-
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto segment_in = chunk_in->get_segment(column_id);
-
-          auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
-          DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
-
-          const auto pos_list_in = ref_segment_in->pos_list();
-
-          const auto table_out = ref_segment_in->referenced_table();
-          const auto column_id_out = ref_segment_in->referenced_column_id();
-
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
-
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>(matches_out->size());
-            if (pos_list_in->references_single_chunk()) {
-              filtered_pos_list->guarantee_single_chunk();
-            }
-
-            size_t offset = 0;
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              (*filtered_pos_list)[offset] = row_id;
-              ++offset;
-            }
-          }
+    if (!excluded_chunk_set.count(chunk_id)) chunk_ids.emplace_back(chunk_id);
+  }
 
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
-          out_segments.push_back(ref_segment_out);
-        }
-      } else {
-        matches_out->guarantee_single_chunk();
-        for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
-        }
-      }
+  // The output chunks are collected per scanned chunk and appended in chunk order, so that the output does not depend
+  // on the order in which the jobs finish.
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>(in_table->chunk_count());
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      output_table->append_chunk(out_segments, chunk_guard->get_allocator(), chunk_guard->access_counter());
+  /**
+   * Without a row budget, all chunks are scanned at once. With a row budget, the chunks are scanned in batches of
+   * doubling size, in chunk order. Once the chunks scanned so far have produced enough rows, no further batch is
+   * scheduled. Chunks of the last batch can exceed the budget; the Limit consuming this scan cuts them off.
+   */
+  auto batch_begin = size_t{0};
+  auto batch_size = _row_budget ? size_t{1} : chunk_ids.size();
+  auto row_count = size_t{0};
+
+  while (batch_begin < chunk_ids.size() && (!_row_budget || row_count < *_row_budget)) {
+    const auto batch_end = std::min(batch_begin + batch_size, chunk_ids.size());
+
+    // The chunks of a batch are scanned in morsels of consecutive chunks, see MorselPlanner
+    const auto batch_chunk_ids = std::vector<ChunkID>(chunk_ids.begin() + batch_begin, chunk_ids.begin() + batch_end);
+    MorselPlanner::for_each_chunk(type(), *in_table, batch_chunk_ids, [&](const ChunkID chunk_id) {
+      Timer timer;
+      output_chunks[chunk_id] = _scan_chunk(in_table, chunk_id, *_impl);
+      _performance_data->add_task_walltime(timer.lap());
     });
 
-    jobs.push_back(job_task);
-    job_task->schedule();
+    for (auto chunk_idx = batch_begin; chunk_idx < batch_end; ++chunk_idx) {
+      const auto& output_chunk = output_chunks[chunk_ids[chunk_idx]];
+      if (output_chunk) row_count += output_chunk->size();
+    }
+
+    batch_begin = batch_end;
+    batch_size *= 2;
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
+  // Excluded chunks as well as those left over once the row budget was reached are skipped
+  _performance_data->chunks_processed += batch_begin;
+  _performance_data->chunks_skipped += in_table->chunk_count() - batch_begin;
+
+  for (const auto& output_chunk : output_chunks) {
+    if (output_chunk) output_table->append_chunk(output_chunk);
+  }
 
   return output_table;
 }
 
+std::shared_ptr<Chunk> TableScan::_scan_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                              const AbstractTableScanImpl& impl) {
+  const auto chunk_guard = in_table->get_chunk_with_access_counting(chunk_id);
+  // The actual scan happens in the sub classes of BaseTableScanImpl
+  const auto matches_out = impl.scan_chunk(chunk_id);
+  if (matches_out->empty()) return nullptr;
+
+  // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
+  // towards the original chunk.
+  Segments out_segments;
+
+  /**
+   * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+   * directly use the matches to construct the reference segments of the output. If it is a reference segment,
+   * we need to resolve the row IDs so that they reference the physical data segments (value, dictionary) instead,
+   * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+   * between segments as much as possible. Position lists can be shared between two segments iff
+   * (a) they point to the same table and
+   * (b) the reference segments of the input table point to the same positions in the same order
+   *     (i.e. they share their position list).
+   */
+  if (in_table->type() == TableType::References) {
+    const auto chunk_in = in_table->get_chunk(chunk_id);
+
+    auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto segment_in = chunk_in->get_segment(column_id);
+
+      auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
+      DebugAssert(ref_segment_in != nullptr, "All segments should be of type ReferenceSegment.");
+
+      const auto pos_list_in = ref_segment_in->pos_list();
+
+      const auto table_out = ref_segment_in->referenced_table();
+      const auto column_id_out = ref_segment_in->referenced_column_id();
+
+      auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+
+      if (!filtered_pos_list) {
+        filtered_pos_list = std::make_shared<PosList>(matches_out->size(), matches_out->get_allocator());
+
+        size_t offset = 0;
+        matches_out->for_each_row_id([&](const RowID& match) {
+          const auto row_id = (*pos_list_in)[match.chunk_offset];
+          (*filtered_pos_list)[offset] = row_id;
+          ++offset;
+        });
+
+        if (pos_list_in->references_single_chunk()) {
+          filtered_pos_list->guarantee_single_chunk();
+
+          // If the scan kept all or most rows of the referenced chunk, we do not need to store their RowIDs
+          const auto& first_row_id = (*filtered_pos_list)[0];
+          if (!first_row_id.is_null()) {
+            filtered_pos_list->compact(table_out->get_chunk(first_row_id.chunk_id)->size());
+          }
+        }
+      }
+
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list);
+      out_segments.push_back(ref_segment_out);
+    }
+  } else {
+    matches_out->guarantee_single_chunk();
+    // If all or most rows of the chunk match, the RowIDs are replaced by a range or bitmap (see pos_list.hpp)
+    matches_out->compact(in_table->get_chunk(chunk_id)->size());
+    for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
+      out_segments.push_back(ref_segment_out);
+    }
+  }
+
+  const auto output_chunk =
+      std::make_shared<Chunk>(out_segments, nullptr, chunk_guard->get_allocator(), chunk_guard->access_counter());
+
+  // The matches keep the order of the rows, so the output chunk is ordered like the input chunk. It also holds rows of
+  // the same partition only.
+  const auto in_chunk = in_table->get_chunk(chunk_id);
+  if (const auto& ordered_by = in_chunk->ordered_by()) output_chunk->set_ordered_by(*ordered_by);
+  if (const auto partition_id = in_chunk->partition_id()) output_chunk->set_partition_id(*partition_id);
+
+  return output_chunk;
+}
+
 std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
     const std::shared_ptr<AbstractExpression>& predicate) {
   // If the predicate has an uncorrelated subquery as an argument, we resolve that subquery first. That way, we can
@@ -205,6 +283,39 @@ std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
 }
 
 std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
+  return _create_impl(input_table_left(), _resolve_uncorrelated_subqueries(_predicate), nullptr);
+}
+
+MorselProcessor TableScan::create_morsel_processor() const {
+  const auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+  const auto uncorrelated_select_results =
+      ExpressionEvaluator::populate_uncorrelated_select_results_cache({resolved_predicate});
+  const auto transaction_context = this->transaction_context();
+
+  return [=](const std::shared_ptr<const Table>& in_table, const std::vector<ChunkID>& chunk_ids) {
+    const auto output_table = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+    if (chunk_ids.empty()) return output_table;
+
+    // The impls are bound to their input table, which is different for each morsel
+    const auto impl = _create_impl(in_table, resolved_predicate, uncorrelated_select_results);
+
+    for (const auto chunk_id : chunk_ids) {
+      // See _on_execute()
+      if (in_table->type() == TableType::Data && transaction_context) {
+        const auto cleanup_commit_id = in_table->get_chunk(chunk_id)->cleanup_commit_id();
+        if (cleanup_commit_id && transaction_context->snapshot_commit_id() >= *cleanup_commit_id) continue;
+      }
+
+      if (const auto output_chunk = _scan_chunk(in_table, chunk_id, *impl)) output_table->append_chunk(output_chunk);
+    }
+
+    return output_table;
+  };
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_impl(
+    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& resolved_predicate,
+    const std::shared_ptr<ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results) {
   /**
    * Select the scanning implementation (`_impl`) to use based on the kind of the expression. For this we have to
    * closely examine the predicate expression.
@@ -212,8 +323,35 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
    * an expression.
    */
 
-  auto resolved_predicate = _resolve_uncorrelated_subqueries(_predicate);
+  // Predicate pattern: <single column predicate> AND <single column predicate> AND ...
+  const auto logical_expression = std::dynamic_pointer_cast<LogicalExpression>(resolved_predicate);
+  if (logical_expression && logical_expression->logical_operator == LogicalOperator::And) {
+    auto impls = std::vector<std::unique_ptr<AbstractSingleColumnTableScanImpl>>{};
+    for (const auto& predicate : flatten_logical_expressions(resolved_predicate, LogicalOperator::And)) {
+      auto impl = _create_dedicated_impl(in_table, predicate);
+      if (!dynamic_cast<AbstractSingleColumnTableScanImpl*>(impl.get())) {
+        impls.clear();
+        break;
+      }
+      impls.emplace_back(static_cast<AbstractSingleColumnTableScanImpl*>(impl.release()));
+    }
+
+    if (!impls.empty()) return std::make_unique<ConjunctionTableScanImpl>(std::move(impls));
+  }
 
+  if (auto impl = _create_dedicated_impl(in_table, resolved_predicate)) return impl;
+
+  // Fallback: Evaluate the predicate with the ExpressionEvaluator
+  return std::make_unique<ExpressionEvaluatorTableScanImpl>(in_table, resolved_predicate, uncorrelated_select_results);
+}
+
+bool TableScan::is_single_column_predicate(const std::shared_ptr<AbstractExpression>& predicate) {
+  // The impls do not access the table when they are created
+  return dynamic_cast<AbstractSingleColumnTableScanImpl*>(_create_dedicated_impl(nullptr, predicate).get());
+}
+
+std::unique_ptr<AbstractTableScanImpl> TableScan::_create_dedicated_impl(
+    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& resolved_predicate) {
   if (const auto binary_predicate_expression =
           std::dynamic_pointer_cast<BinaryPredicateExpression>(resolved_predicate)) {
     const auto predicate_condition = binary_predicate_expression->predicate_condition;
@@ -250,24 +388,24 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> LIKE <non-null value>
     if (left_column_expression && left_column_expression->data_type() == DataType::String && is_like_predicate &&
         right_value) {
-      return std::make_unique<ColumnLikeTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<ColumnLikeTableScanImpl>(in_table, left_column_expression->column_id,
                                                        predicate_condition,
                                                        type_cast_variant<std::string>(*right_value));
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <non-null value>
     if (left_column_expression && right_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, left_column_expression->column_id,
                                                           predicate_condition, *right_value);
     }
     if (right_column_expression && left_value) {
-      return std::make_unique<ColumnVsValueTableScanImpl>(input_table_left(), right_column_expression->column_id,
+      return std::make_unique<ColumnVsValueTableScanImpl>(in_table, right_column_expression->column_id,
                                                           flip_predicate_condition(predicate_condition), *left_value);
     }
 
     // Predicate pattern: <column> <binary predicate_condition> <column>
     if (left_column_expression && right_column_expression) {
-      return std::make_unique<ColumnVsColumnTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<ColumnVsColumnTableScanImpl>(in_table, left_column_expression->column_id,
                                                            predicate_condition, right_column_expression->column_id);
     }
   }
@@ -276,11 +414,45 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> IS NULL
     if (const auto left_column_expression =
             std::dynamic_pointer_cast<PQPColumnExpression>(is_null_expression->operand())) {
-      return std::make_unique<ColumnIsNullTableScanImpl>(input_table_left(), left_column_expression->column_id,
+      return std::make_unique<ColumnIsNullTableScanImpl>(in_table, left_column_expression->column_id,
                                                          is_null_expression->predicate_condition);
     }
   }
 
+  if (const auto in_expression = std::dynamic_pointer_cast<InExpression>(resolved_predicate)) {
+    const auto column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(in_expression->value());
+    const auto list_expression = std::dynamic_pointer_cast<ListExpression>(in_expression->set());
+
+    // Predicate pattern: <column> [NOT] IN (<value-of-type-x>, <value-of-type-x>, ...), where x is the data type of
+    // the column. Int and Float values are widened for Long and Double columns. NULL values are allowed.
+    if (column_expression && list_expression && !list_expression->elements().empty()) {
+      const auto column_data_type = column_expression->data_type();
+
+      auto values = std::vector<AllTypeVariant>{};
+      values.reserve(list_expression->elements().size());
+      for (const auto& element : list_expression->elements()) {
+        const auto value = expression_get_value_or_parameter(*element);
+        if (!value) break;
+
+        const auto value_data_type = data_type_from_all_type_variant(*value);
+        if (value_data_type == column_data_type || value_data_type == DataType::Null) {
+          values.emplace_back(*value);
+        } else if (column_data_type == DataType::Long && value_data_type == DataType::Int) {
+          values.emplace_back(type_cast_variant<int64_t>(*value));
+        } else if (column_data_type == DataType::Double && value_data_type == DataType::Float) {
+          values.emplace_back(type_cast_variant<double>(*value));
+        } else {
+          break;
+        }
+      }
+
+      if (values.size() == list_expression->elements().size()) {
+        return std::make_unique<ColumnInTableScanImpl>(in_table, column_expression->column_id,
+                                                       in_expression->predicate_condition, values);
+      }
+    }
+  }
+
   if (const auto between_expression = std::dynamic_pointer_cast<BetweenExpression>(resolved_predicate)) {
     const auto left_column = std::dynamic_pointer_cast<PQPColumnExpression>(between_expression->value());
 
@@ -290,13 +462,13 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
     // Predicate pattern: <column> BETWEEN <value-of-type-x> AND <value-of-type-x>
     if (left_column && lower_bound_value && upper_bound_value &&
         lower_bound_value->type() == upper_bound_value->type()) {
-      return std::make_unique<ColumnBetweenTableScanImpl>(input_table_left(), left_column->column_id,
+      return std::make_unique<ColumnBetweenTableScanImpl>(in_table, left_column->column_id,
                                                           *lower_bound_value, *upper_bound_value);
     }
   }
 
-  // Predicate pattern: Everything else. Fall back to ExpressionEvaluator
-  return std::make_unique<ExpressionEvaluatorTableScanImpl>(input_table_left(), resolved_predicate);
+  // Predicate pattern: Everything else. Evaluated by the ExpressionEvaluator, see create_impl()
+  return nullptr;
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
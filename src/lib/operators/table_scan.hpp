@@ -8,6 +8,8 @@
 #include "abstract_read_only_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "pipeline.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -37,6 +39,17 @@ class TableScan : public AbstractReadOnlyOperator {
    * excluded chunks and all others a list of included chunks.
    */
   void set_excluded_chunk_ids(const std::vector<ChunkID>& chunk_ids);
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
+
+  /**
+   * @brief If set, the scan may stop once it has produced at least this many rows.
+   *
+   * Set by the LQPTranslator if the scan is consumed by a Limit with a constant row count. The chunks are then scanned
+   * in chunk order, so that the first rows of the output are the same as without a budget. The output can still
+   * contain more rows than the budget.
+   */
+  void set_row_budget(const std::optional<size_t>& row_budget);
+  const std::optional<size_t>& row_budget() const;
 
   const std::shared_ptr<AbstractExpression>& predicate() const;
 
@@ -48,6 +61,18 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::unique_ptr<AbstractTableScanImpl> create_impl() const;
 
+  /**
+   * Scans morsels, see Pipeline. Uncorrelated subqueries are evaluated once, when the processor is created. Neither
+   * the excluded chunks nor the row budget are considered.
+   */
+  MorselProcessor create_morsel_processor() const;
+
+  /**
+   * Returns whether the predicate is scanned by an impl that only looks at a single column (e.g., `a > 5` or
+   * `b LIKE 'x%'`). Conjunctions of such predicates are evaluated in one pass by the ConjunctionTableScanImpl.
+   */
+  static bool is_single_column_predicate(const std::shared_ptr<AbstractExpression>& predicate);
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -65,6 +90,18 @@ class TableScan : public AbstractReadOnlyOperator {
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<AbstractExpression>& predicate);
 
+  static std::unique_ptr<AbstractTableScanImpl> _create_impl(
+      const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& resolved_predicate,
+      const std::shared_ptr<ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results);
+
+  // Creates the dedicated impl for a predicate, or returns nullptr if it has to be evaluated by the ExpressionEvaluator
+  static std::unique_ptr<AbstractTableScanImpl> _create_dedicated_impl(
+      const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& resolved_predicate);
+
+  // Returns the output chunk for the matches of a chunk, or nullptr if there are none
+  static std::shared_ptr<Chunk> _scan_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                            const AbstractTableScanImpl& impl);
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
 
@@ -74,6 +111,8 @@ class TableScan : public AbstractReadOnlyOperator {
   std::string _impl_description{"Unset"};
 
   std::vector<ChunkID> _excluded_chunk_ids;
+
+  std::optional<size_t> _row_budget;
 };
 
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
@@ -21,19 +22,87 @@ AbstractSingleColumnTableScanImpl::AbstractSingleColumnTableScanImpl(const std::
 
 std::shared_ptr<PosList> AbstractSingleColumnTableScanImpl::scan_chunk(const ChunkID chunk_id) const {
   const auto& chunk = _in_table->get_chunk(chunk_id);
-  const auto& segment = chunk->get_segment(_column_id);
 
-  auto matches = std::make_shared<PosList>();
+  // The scanned segments, including those referenced by ReferenceSegments, are read without copying their shared_ptrs.
+  // The guard keeps them from being released if they are replaced during the scan.
+  const auto epoch_guard = EpochGuard{};
+  const auto& segment = chunk->get_pinned_segment(_column_id);
 
-  if (const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment)) {
+  auto matches = std::make_shared<PosList>(_pos_list_allocator);
+
+  if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
     _scan_reference_segment(*reference_segment, chunk_id, *matches);
+  } else if (const auto& ordered_by = chunk->ordered_by(); ordered_by && ordered_by->first == _column_id) {
+    segment.access_statistics().on_predicate(_predicate_condition);
+    _scan_sorted_segment(segment, chunk_id, *matches, ordered_by->second);
+  } else {
+    segment.access_statistics().on_predicate(_predicate_condition);
+    _scan_non_reference_segment(segment, chunk_id, *matches, nullptr);
+  }
+
+  return matches;
+}
+
+std::shared_ptr<PosList> AbstractSingleColumnTableScanImpl::scan_chunk_candidates(const ChunkID chunk_id,
+                                                                                  const PosList& candidates) const {
+  const auto& segment = _in_table->get_chunk(chunk_id)->get_segment(_column_id);
+
+  auto matches = std::make_shared<PosList>(_pos_list_allocator);
+
+  // The candidates are passed to the scan as a position filter. For reference segments, the filter has to reference
+  // the referenced table instead.
+  const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
+  const auto referenced_pos_list = reference_segment ? reference_segment->pos_list() : nullptr;
+
+  auto candidate_offsets = std::vector<ChunkOffset>{};
+  candidate_offsets.reserve(candidates.size());
+  auto position_filter = std::make_shared<PosList>();
+  position_filter->reserve(candidates.size());
+
+  candidates.for_each_row_id([&](const RowID& candidate) {
+    candidate_offsets.emplace_back(candidate.chunk_offset);
+    position_filter->emplace_back(referenced_pos_list ? (*referenced_pos_list)[candidate.chunk_offset] : candidate);
+  });
+
+  if (reference_segment) {
+    if (referenced_pos_list->references_single_chunk()) position_filter->guarantee_single_chunk();
+    const auto filtered_segment = ReferenceSegment{reference_segment->referenced_table(),
+                                                   reference_segment->referenced_column_id(), position_filter};
+    _scan_reference_segment(filtered_segment, chunk_id, *matches);
   } else {
-    _scan_non_reference_segment(*segment, chunk_id, *matches, nullptr);
+    position_filter->guarantee_single_chunk();
+    segment->access_statistics().on_predicate(_predicate_condition);
+    _scan_non_reference_segment(*segment, chunk_id, *matches, position_filter);
+  }
+
+  // The scans have filled `matches` with positions within the candidates, which are translated back to offsets
+  for (auto match_idx = size_t{0}; match_idx < matches->size(); ++match_idx) {
+    (*matches)[match_idx].chunk_offset = candidate_offsets[(*matches)[match_idx].chunk_offset];
   }
 
   return matches;
 }
 
+void AbstractSingleColumnTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                             PosList& matches,
+                                                             const OrderByMode /*order_by_mode*/) const {
+  _scan_non_reference_segment(segment, chunk_id, matches, nullptr);
+}
+
+void AbstractSingleColumnTableScanImpl::_add_range_to_matches(const ChunkID chunk_id, const ChunkOffset begin,
+                                                              const ChunkOffset end, PosList& matches) {
+  // A single range does not need to be stored as RowIDs
+  if (matches.empty()) {
+    matches.set_chunk_range(chunk_id, begin, end);
+    return;
+  }
+
+  matches.reserve(matches.size() + (end - begin));
+  for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset) {
+    matches.emplace_back(RowID{chunk_id, chunk_offset});
+  }
+}
+
 void AbstractSingleColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id,
                                                                 PosList& matches) const {
   const auto& pos_list = segment.pos_list();
@@ -42,9 +111,10 @@ void AbstractSingleColumnTableScanImpl::_scan_reference_segment(const ReferenceS
     // Fast path :)
 
     const auto chunk = segment.referenced_table()->get_chunk(pos_list->common_chunk_id());
-    auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
+    const auto& referenced_segment = chunk->get_pinned_segment(segment.referenced_column_id());
 
-    _scan_non_reference_segment(*referenced_segment, chunk_id, matches, pos_list);
+    referenced_segment.access_statistics().on_predicate(_predicate_condition);
+    _scan_non_reference_segment(referenced_segment, chunk_id, matches, pos_list);
 
     return;
   }
@@ -60,11 +130,12 @@ void AbstractSingleColumnTableScanImpl::_scan_reference_segment(const ReferenceS
     if (!position_filter || position_filter->empty()) continue;
 
     const auto chunk = segment.referenced_table()->get_chunk(referenced_chunk_id);
-    auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
+    const auto& referenced_segment = chunk->get_pinned_segment(segment.referenced_column_id());
 
     const auto num_previous_matches = matches.size();
 
-    _scan_non_reference_segment(*referenced_segment, chunk_id, matches, position_filter);
+    referenced_segment.access_statistics().on_predicate(_predicate_condition);
+    _scan_non_reference_segment(referenced_segment, chunk_id, matches, position_filter);
 
     // The scan has filled `matches` assuming that `position_filter` was the entire ReferenceSegment, so we need to fix
     // that:
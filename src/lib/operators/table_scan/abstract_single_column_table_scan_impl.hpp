@@ -29,6 +29,10 @@ class AbstractSingleColumnTableScanImpl : public AbstractTableScanImpl {
 
   std::shared_ptr<PosList> scan_chunk(const ChunkID chunk_id) const override;
 
+  // Only scans the given rows of the chunk, e.g., the matches of a previous predicate (see ConjunctionTableScanImpl).
+  // The candidates reference the chunk of the input table, as do the returned matches.
+  std::shared_ptr<PosList> scan_chunk_candidates(const ChunkID chunk_id, const PosList& candidates) const;
+
  protected:
   void _scan_reference_segment(const ReferenceSegment& segment, const ChunkID chunk_id, PosList& matches) const;
 
@@ -39,6 +43,15 @@ class AbstractSingleColumnTableScanImpl : public AbstractTableScanImpl {
   virtual void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                            const std::shared_ptr<const PosList>& position_filter) const = 0;
 
+  // Called instead of _scan_non_reference_segment if the chunk is sorted by the scanned column (see
+  // Chunk::ordered_by()). Impls that can make use of the order (e.g., via binary search) override this.
+  virtual void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                                    const OrderByMode order_by_mode) const;
+
+  // Adds the rows [begin, end) of a chunk to the matches
+  static void _add_range_to_matches(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end,
+                                    PosList& matches);
+
   const std::shared_ptr<const Table> _in_table;
   const ColumnID _column_id;
   const PredicateCondition _predicate_condition;
@@ -18,7 +18,12 @@ class AbstractTableScanImpl {
 
   virtual std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const = 0;
 
+  // The allocator of the PosLists returned by scan_chunk(), e.g., for the arena of a query (see ArenaMemoryResource)
+  virtual void set_pos_list_allocator(const PosList::allocator_type& allocator) { _pos_list_allocator = allocator; }
+
  protected:
+  PosList::allocator_type _pos_list_allocator;
+
   /**
    * @defgroup The hot loop of the table scan
    * @{
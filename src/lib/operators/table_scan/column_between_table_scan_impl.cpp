@@ -4,6 +4,7 @@
 #include <string>
 #include <type_traits>
 
+#include "sorted_segment_search.hpp"
 #include "storage/chunk.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
@@ -46,6 +47,28 @@ void ColumnBetweenTableScanImpl::_scan_non_reference_segment(
   }
 }
 
+void ColumnBetweenTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                      PosList& matches, const OrderByMode order_by_mode) const {
+  if (variant_is_null(_left_value) || variant_is_null(_right_value)) return;
+
+  resolve_data_and_segment_type(segment, [&](auto type, const auto& typed_segment) {
+    using ColumnDataType = typename decltype(type)::type;
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("Expected a non-reference segment");
+    } else {
+      const auto typed_left_value = type_cast_variant<ColumnDataType>(_left_value);
+      const auto typed_right_value = type_cast_variant<ColumnDataType>(_right_value);
+
+      const auto search = SortedSegmentSearch<SegmentType, ColumnDataType>{typed_segment, order_by_mode};
+      search.scan_between(typed_left_value, typed_right_value, [&](const auto begin, const auto end) {
+        _add_range_to_matches(chunk_id, begin, end, matches);
+      });
+    }
+  });
+}
+
 void ColumnBetweenTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
                                                        PosList& matches,
                                                        const std::shared_ptr<const PosList>& position_filter) const {
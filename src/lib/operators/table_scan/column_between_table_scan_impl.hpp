@@ -32,6 +32,10 @@ class ColumnBetweenTableScanImpl : public AbstractSingleColumnTableScanImpl {
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
 
+  // Uses binary search to find the matching range of the sorted segment
+  void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                            const OrderByMode order_by_mode) const override;
+
   void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                              const std::shared_ptr<const PosList>& position_filter) const;
 
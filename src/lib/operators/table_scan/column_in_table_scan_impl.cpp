@@ -0,0 +1,133 @@
+#include "column_in_table_scan_impl.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+#include "utils/assert.hpp"
+
+#include "resolve_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+struct ColumnInTableScanImpl::ValueSet : public BaseValueSet {
+  std::unordered_set<T> values;
+};
+
+ColumnInTableScanImpl::ColumnInTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                             const PredicateCondition& predicate_condition,
+                                             const std::vector<AllTypeVariant>& values)
+    : AbstractSingleColumnTableScanImpl{in_table, column_id, predicate_condition} {
+  DebugAssert(predicate_condition == PredicateCondition::In || predicate_condition == PredicateCondition::NotIn,
+              "Invalid PredicateCondition");
+
+  _values.reserve(values.size());
+  for (const auto& value : values) {
+    if (variant_is_null(value)) {
+      _matches_none |= predicate_condition == PredicateCondition::NotIn;
+    } else {
+      _values.emplace_back(value);
+    }
+  }
+
+  // `col IN (NULL)` is never true either
+  if (_values.empty()) _matches_none = true;
+  if (_matches_none) return;
+
+  resolve_data_type(data_type_from_all_type_variant(_values.front()), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto value_set = std::make_shared<ValueSet<ColumnDataType>>();
+    value_set->values.reserve(_values.size());
+    for (const auto& value : _values) {
+      Assert(value.type() == typeid(ColumnDataType), "Expected all values of an IN list to have the same data type");
+      value_set->values.emplace(boost::get<ColumnDataType>(value));
+    }
+    _value_set = value_set;
+  });
+}
+
+std::string ColumnInTableScanImpl::description() const { return "ColumnIn"; }
+
+void ColumnInTableScanImpl::_scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                        PosList& matches,
+                                                        const std::shared_ptr<const PosList>& position_filter) const {
+  if (_matches_none) return;
+
+  // Select optimized or generic scanning implementation based on segment type
+  if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
+    _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else {
+    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+  }
+}
+
+void ColumnInTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                  PosList& matches,
+                                                  const std::shared_ptr<const PosList>& position_filter) const {
+  segment_with_iterators_filtered(segment, position_filter, [&](auto it, const auto end) {
+    using ColumnDataType = typename decltype(it)::ValueType;
+
+    DebugAssert(_values.front().type() == typeid(ColumnDataType), "Values do not match the data type of the column");
+    const auto& value_set = static_cast<const ValueSet<ColumnDataType>&>(*_value_set).values;
+
+    if (_predicate_condition == PredicateCondition::In) {
+      const auto comparator = [&value_set](const auto& position) { return value_set.count(position.value()) != 0; };
+      _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+    } else {
+      const auto comparator = [&value_set](const auto& position) { return value_set.count(position.value()) == 0; };
+      _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+    }
+  });
+}
+
+void ColumnInTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
+                                                     PosList& matches,
+                                                     const std::shared_ptr<const PosList>& position_filter) const {
+  /**
+   * Each value of the list is looked up in the dictionary. The value ids that match are marked in a bitmap, which
+   * has one more entry for the null value id that is never set. Thus, NULLs do not have to be checked separately.
+   */
+  const auto unique_values_count = segment.unique_values_count();
+  auto value_id_matches =
+      std::vector<bool>(unique_values_count + 1u, _predicate_condition == PredicateCondition::NotIn);
+  value_id_matches[unique_values_count] = false;
+
+  for (const auto& value : _values) {
+    const auto value_id = segment.lower_bound(value);
+    if (value_id == INVALID_VALUE_ID || segment.upper_bound(value) == value_id) continue;
+
+    value_id_matches[value_id] = _predicate_condition == PredicateCondition::In;
+  }
+
+  const auto match_count = std::count(value_id_matches.begin(), value_id_matches.end(), true);
+  if (match_count == 0) return;
+
+  auto iterable = create_iterable_from_attribute_vector(segment);
+
+  if (static_cast<size_t>(match_count) == unique_values_count) {
+    iterable.with_iterators(position_filter, [&](auto it, auto end) {
+      static const auto always_true = [](const auto&) { return true; };
+      // Matches all, so include all rows except those with NULLs in the result.
+      _scan_with_iterators<true>(always_true, it, end, chunk_id, matches);
+    });
+
+    return;
+  }
+
+  const auto comparator = [&value_id_matches](const auto& position) { return value_id_matches[position.value()]; };
+  iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_single_column_table_scan_impl.hpp"
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Compares a column to a list of scalar values (... WHERE col [NOT] IN (value_1, value_2, ...))
+ *
+ * The values are put into a hash set once, so that each row is only looked up once instead of being compared to
+ * every list element. On DictionarySegments, the values are looked up in the dictionary and the scan only checks the
+ * value ids of the rows against a bitmap.
+ *
+ * `col IN (1, NULL)` matches the rows with value 1, while `col NOT IN (1, NULL)` matches no rows at all, since
+ * `col <> NULL` is never true.
+ *
+ * Limitations:
+ * - All values are expected to have the data type of the column (see TableScan::create_impl)
+ */
+class ColumnInTableScanImpl : public AbstractSingleColumnTableScanImpl {
+ public:
+  ColumnInTableScanImpl(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                        const PredicateCondition& predicate_condition, const std::vector<AllTypeVariant>& values);
+
+  std::string description() const override;
+
+ protected:
+  void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                                   const std::shared_ptr<const PosList>& position_filter) const override;
+
+  void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                             const std::shared_ptr<const PosList>& position_filter) const;
+
+  // Optimized scan on DictionarySegments
+  void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
+                                const std::shared_ptr<const PosList>& position_filter) const;
+
+  struct BaseValueSet {
+    virtual ~BaseValueSet() = default;
+  };
+
+  // Holds the values as an std::unordered_set<T>, where T is the data type of the column
+  template <typename T>
+  struct ValueSet;
+
+  // The values without NULLs
+  std::vector<AllTypeVariant> _values;
+  std::shared_ptr<const BaseValueSet> _value_set;
+
+  // True for `col NOT IN (..., NULL, ...)`, which is never true
+  bool _matches_none{false};
+};
+
+}  // namespace opossum
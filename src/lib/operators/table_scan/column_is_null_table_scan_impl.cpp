@@ -28,7 +28,7 @@ std::shared_ptr<PosList> ColumnIsNullTableScanImpl::scan_chunk(const ChunkID chu
   const auto& chunk = _in_table->get_chunk(chunk_id);
   const auto& segment = chunk->get_segment(_column_id);
 
-  auto matches = std::make_shared<PosList>();
+  auto matches = std::make_shared<PosList>(_pos_list_allocator);
 
   if (const auto value_segment = std::dynamic_pointer_cast<BaseValueSegment>(segment)) {
     _scan_value_segment(*value_segment, chunk_id, *matches, nullptr);
@@ -78,7 +78,7 @@ bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) co
       return false;
 
     case PredicateCondition::IsNotNull:
-      return !segment.is_nullable();
+      return !segment.is_nullable() || !segment.may_contain_null_values();
 
     default:
       Fail("Unsupported comparison type encountered");
@@ -88,7 +88,7 @@ bool ColumnIsNullTableScanImpl::_matches_all(const BaseValueSegment& segment) co
 bool ColumnIsNullTableScanImpl::_matches_none(const BaseValueSegment& segment) const {
   switch (_predicate_condition) {
     case PredicateCondition::IsNull:
-      return !segment.is_nullable();
+      return !segment.is_nullable() || !segment.may_contain_null_values();
 
     case PredicateCondition::IsNotNull:
       return false;
@@ -102,6 +102,12 @@ void ColumnIsNullTableScanImpl::_add_all(const ChunkID chunk_id, PosList& matche
                                          const std::shared_ptr<const PosList>& position_filter,
                                          const size_t segment_size) const {
   const auto num_rows = position_filter ? position_filter->size() : segment_size;
+  // All rows match, so they do not need to be stored as RowIDs
+  if (matches.empty()) {
+    matches.set_chunk_range(chunk_id, ChunkOffset{0}, static_cast<ChunkOffset>(num_rows));
+    return;
+  }
+
   for (auto chunk_offset = 0u; chunk_offset < num_rows; ++chunk_offset) {
     matches.emplace_back(RowID{chunk_id, chunk_offset});
   }
@@ -7,10 +7,12 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fixed_string_dictionary_segment/fixed_string_vector.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
@@ -25,7 +27,19 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const std::string& pattern)
     : AbstractSingleColumnTableScanImpl{in_table, column_id, predicate_condition},
       _matcher{pattern},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {}
+      _invert_results(predicate_condition == PredicateCondition::NotLike) {
+  const auto tokens = LikeMatcher::pattern_string_to_tokens(pattern);
+  if (tokens.empty()) {
+    _search_string = std::string{};
+  } else if (tokens[0].type() == typeid(std::string)) {
+    if (tokens.size() == 1) {
+      _search_string = boost::get<std::string>(tokens[0]);
+    } else if (tokens.size() == 2 && tokens[1] == LikeMatcher::PatternToken{LikeMatcher::Wildcard::AnyChars}) {
+      _search_string = boost::get<std::string>(tokens[0]);
+      _search_string_is_prefix = true;
+    }
+  }
+}
 
 std::string ColumnLikeTableScanImpl::description() const { return "ColumnLike"; }
 
@@ -68,7 +82,7 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
     result = _find_matches_in_dictionary(*typed_segment.dictionary());
   } else {
     const auto& typed_segment = static_cast<const FixedStringDictionarySegment<std::string>&>(segment);
-    result = _find_matches_in_dictionary(*typed_segment.dictionary());
+    result = _find_matches_in_dictionary(*typed_segment.fixed_string_dictionary());
   }
 
   const auto& match_count = result.first;
@@ -100,19 +114,47 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   });
 }
 
+template <typename Dictionary>
 std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(
-    const pmr_vector<std::string>& dictionary) const {
+    const Dictionary& dictionary) const {
   auto result = std::pair<size_t, std::vector<bool>>{};
 
   auto& count = result.first;
   auto& dictionary_matches = result.second;
 
   count = 0u;
+
+  if (_search_string) {
+    const auto search_string = std::string_view{*_search_string};
+    const auto less = [](const auto& lhs, const auto& rhs) { return std::string_view{lhs} < std::string_view{rhs}; };
+
+    const auto range_begin = std::lower_bound(dictionary.cbegin(), dictionary.cend(), search_string, less);
+    auto range_end = range_begin;
+    if (_search_string_is_prefix) {
+      range_end = std::partition_point(range_begin, dictionary.cend(), [&](const auto& value) {
+        return std::string_view{value}.substr(0, search_string.size()) == search_string;
+      });
+    } else {
+      range_end = std::upper_bound(range_begin, dictionary.cend(), search_string, less);
+    }
+
+    const auto begin_value_id = static_cast<size_t>(std::distance(dictionary.cbegin(), range_begin));
+    const auto end_value_id = static_cast<size_t>(std::distance(dictionary.cbegin(), range_end));
+
+    const auto dictionary_size = static_cast<size_t>(std::distance(dictionary.cbegin(), dictionary.cend()));
+
+    dictionary_matches.resize(dictionary_size, _invert_results);
+    std::fill(dictionary_matches.begin() + begin_value_id, dictionary_matches.begin() + end_value_id, !_invert_results);
+    count = _invert_results ? dictionary_size - (end_value_id - begin_value_id) : end_value_id - begin_value_id;
+
+    return result;
+  }
+
   dictionary_matches.reserve(dictionary.size());
 
   _matcher.resolve(_invert_results, [&](const auto& matcher) {
     for (const auto& value : dictionary) {
-      const auto matches = matcher(value);
+      const auto matches = matcher(std::string_view{value});
       count += static_cast<size_t>(matches);
       dictionary_matches.push_back(matches);
     }
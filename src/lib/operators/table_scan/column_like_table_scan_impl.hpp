@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <utility>
@@ -26,8 +27,13 @@ class Table;
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
  *
- * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
- *                    e.g., StartsWithPattern. 
+ * - Dictionaries are sorted, so the entries matching a pattern without wildcards ('abc') or a prefix pattern ('abc%')
+ *   form a contiguous range, which is found using binary search
+ * - Other patterns are matched against std::string_views of the dictionary entries. For FixedStringDictionarySegments,
+ *   these point directly into the fixed-width buffer, so that no strings are materialized.
+ *
+ * Performance Notes: Uses a general WildcardPattern as a fallback and resorts to faster Pattern matchers for special
+ *                    cases, e.g., StartsWithPattern.
  */
 class ColumnLikeTableScanImpl : public AbstractSingleColumnTableScanImpl {
  public:
@@ -46,15 +52,21 @@ class ColumnLikeTableScanImpl : public AbstractSingleColumnTableScanImpl {
                                 const std::shared_ptr<const PosList>& position_filter) const;
 
   /**
-   * Used for dictionary segments
+   * Used for dictionary segments, the dictionary is either a pmr_vector<std::string> or a FixedStringVector
    * @returns number of matches and the result of each dictionary entry
    */
-  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<std::string>& dictionary) const;
+  template <typename Dictionary>
+  std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const Dictionary& dictionary) const;
 
   const LikeMatcher _matcher;
 
   // For NOT LIKE support
   const bool _invert_results;
+
+  // Set if the pattern does not contain wildcards or only a trailing '%', in which case the matching dictionary
+  // entries are found using binary search
+  std::optional<std::string> _search_string;
+  bool _search_string_is_prefix{false};
 };
 
 }  // namespace opossum
@@ -75,7 +75,7 @@ std::shared_ptr<PosList> ColumnVsColumnTableScanImpl::_typed_scan_chunk(ChunkID
                                                                         const RightIterable& right_iterable) const {
   const auto chunk = _in_table->get_chunk(chunk_id);
 
-  auto matches_out = std::make_shared<PosList>();
+  auto matches_out = std::make_shared<PosList>(_pos_list_allocator);
 
   using LeftType = typename LeftIterable::ValueType;
   using RightType = typename RightIterable::ValueType;
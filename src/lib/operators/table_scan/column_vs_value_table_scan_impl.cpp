@@ -1,14 +1,21 @@
 #include "column_vs_value_table_scan_impl.hpp"
 
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "sorted_segment_search.hpp"
+#include "value_segment_simd_scan.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/string_prefix.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -38,9 +45,34 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
   // Select optimized or generic scanning implementation based on segment type
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
-  } else {
-    _scan_generic_segment(segment, chunk_id, matches, position_filter);
+    return;
   }
+
+  if (!position_filter && _scan_run_length_segment(segment, chunk_id, matches)) return;
+
+  if (!position_filter && _scan_value_segment_with_simd(segment, chunk_id, matches)) return;
+
+  if (!position_filter && _scan_string_value_segment(segment, chunk_id, matches)) return;
+
+  _scan_generic_segment(segment, chunk_id, matches, position_filter);
+}
+
+void ColumnVsValueTableScanImpl::_scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                      PosList& matches, const OrderByMode order_by_mode) const {
+  if (variant_is_null(_value)) return;
+
+  resolve_data_and_segment_type(segment, [&](auto type, const auto& typed_segment) {
+    using ColumnDataType = typename decltype(type)::type;
+    using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+    if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      Fail("Expected a non-reference segment");
+    } else {
+      const auto search = SortedSegmentSearch<SegmentType, ColumnDataType>{typed_segment, order_by_mode};
+      search.scan(_predicate_condition, type_cast_variant<ColumnDataType>(_value),
+                  [&](const auto begin, const auto end) { _add_range_to_matches(chunk_id, begin, end, matches); });
+    }
+  });
 }
 
 void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id,
@@ -59,6 +91,105 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(const BaseSegment& segmen
   });
 }
 
+bool ColumnVsValueTableScanImpl::_scan_value_segment_with_simd(const BaseSegment& segment, const ChunkID chunk_id,
+                                                               PosList& matches) const {
+  auto scanned = false;
+
+  resolve_data_type(segment.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if constexpr (ValueSegmentSimdScan::supports_data_type<ColumnDataType>()) {
+      if (const auto* value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
+        ValueSegmentSimdScan::scan(*value_segment, _predicate_condition, type_cast_variant<ColumnDataType>(_value),
+                                   chunk_id, matches);
+        scanned = true;
+      }
+    }
+  });
+
+  return scanned;
+}
+
+bool ColumnVsValueTableScanImpl::_scan_string_value_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                            PosList& matches) const {
+  const auto* value_segment = dynamic_cast<const ValueSegment<std::string>*>(&segment);
+  if (!value_segment) return false;
+
+  const auto& values = value_segment->values();
+  const auto& prefixes = value_segment->string_prefixes();
+
+  // The prefixes are appended before the values, so they cover at least all values read here
+  const auto size = values.size();
+  DebugAssert(prefixes.size() >= size, "String prefixes are missing");
+
+  const auto typed_value = type_cast_variant<std::string>(_value);
+  const auto value_prefix = StringPrefix::of(typed_value);
+  const auto check_nulls = value_segment->is_nullable() && value_segment->may_contain_null_values();
+  const auto* null_values = check_nulls ? &value_segment->null_values() : nullptr;
+
+  value_segment->access_statistics().on_sequential_scan(size);
+
+  with_comparator(_predicate_condition, [&](auto predicate_comparator) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < size; ++chunk_offset) {
+      if (check_nulls && (*null_values)[chunk_offset]) continue;
+
+      // Only strings that share the prefix of the value are compared in full
+      auto comparison = compare_string_prefixes(prefixes[chunk_offset], value_prefix);
+      if (!comparison) comparison = values[chunk_offset].compare(typed_value);
+
+      if (predicate_comparator(*comparison, 0)) matches.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  });
+
+  return true;
+}
+
+bool ColumnVsValueTableScanImpl::_scan_run_length_segment(const BaseSegment& segment, const ChunkID chunk_id,
+                                                          PosList& matches) const {
+  auto scanned = false;
+
+  resolve_data_type(segment.data_type(), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto* run_length_segment = dynamic_cast<const RunLengthSegment<ColumnDataType>*>(&segment);
+    if (!run_length_segment) return;
+
+    const auto& values = *run_length_segment->values();
+    const auto& null_values = *run_length_segment->null_values();
+    const auto& end_positions = *run_length_segment->end_positions();
+    const auto typed_value = type_cast_variant<ColumnDataType>(_value);
+
+    run_length_segment->access_statistics().on_sequential_scan(run_length_segment->size());
+
+    with_comparator(_predicate_condition, [&](auto predicate_comparator) {
+      // [range_begin, range_end) spans the adjacent matching runs that have not been added to the matches yet
+      auto range_begin = ChunkOffset{0};
+      auto range_end = ChunkOffset{0};
+      auto run_begin = ChunkOffset{0};
+
+      for (auto run_idx = size_t{0}; run_idx < values.size(); ++run_idx) {
+        const auto run_end = static_cast<ChunkOffset>(end_positions[run_idx] + 1);
+
+        if (!null_values[run_idx] && predicate_comparator(values[run_idx], typed_value)) {
+          if (run_begin != range_end) {
+            if (range_begin != range_end) _add_range_to_matches(chunk_id, range_begin, range_end, matches);
+            range_begin = run_begin;
+          }
+          range_end = run_end;
+        }
+
+        run_begin = run_end;
+      }
+
+      if (range_begin != range_end) _add_range_to_matches(chunk_id, range_begin, range_end, matches);
+    });
+
+    scanned = true;
+  });
+
+  return scanned;
+}
+
 void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id,
                                                           PosList& matches,
                                                           const std::shared_ptr<const PosList>& position_filter) const {
@@ -108,6 +239,11 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     return;
   }
 
+  if (!position_filter && segment.compressed_vector_type() == CompressedVectorType::SimdBp128) {
+    _scan_simd_bp128_attribute_vector(segment, search_value_id, chunk_id, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan(_predicate_condition, [&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -127,6 +263,55 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_simd_bp128_attribute_vector(const BaseDictionarySegment& segment,
+                                                                   const ValueID search_value_id,
+                                                                   const ChunkID chunk_id, PosList& matches) const {
+  /**
+   * Instead of decompressing the attribute vector and comparing each value ID afterwards, the comparison is
+   * expressed as a range of value IDs and evaluated on the bit-packed blocks directly. NULLs are represented by
+   * null_value_id (== unique_values_count()), which lies outside of all include ranges.
+   *
+   * Operator          |  Matching value IDs
+   * column == _value  |  [search_vid, search_vid + 1)
+   * column != _value  |  [0, null_value_id) without [search_vid, search_vid + 1)
+   * column <  _value  |  [0, search_vid)
+   * column <= _value  |  [0, search_vid)   (search_vid is the upper bound here)
+   * column >  _value  |  [search_vid, null_value_id)   (search_vid is the upper bound here)
+   * column >= _value  |  [search_vid, null_value_id)
+   */
+  const auto null_value_id = static_cast<uint32_t>(segment.null_value_id());
+  const auto search_vid = static_cast<uint32_t>(search_value_id);
+
+  auto ranges = SimdBp128Packing::MatchRanges{};
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      ranges = {search_vid, search_vid + 1u};
+      break;
+
+    case PredicateCondition::NotEquals:
+      ranges = {0u, null_value_id, search_vid, search_vid + 1u};
+      break;
+
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      ranges = {0u, search_vid};
+      break;
+
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      ranges = {search_vid, null_value_id};
+      break;
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+
+  const auto& attribute_vector = static_cast<const SimdBp128Vector&>(*segment.attribute_vector());
+  attribute_vector.for_each_match(ranges, [&](const size_t chunk_offset) {
+    matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(chunk_offset)});
+  });
+}
+
 ValueID ColumnVsValueTableScanImpl::_get_search_value_id(const BaseDictionarySegment& segment) const {
   switch (_predicate_condition) {
     case PredicateCondition::Equals:
@@ -16,7 +16,10 @@ namespace opossum {
 /**
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
- * - Value segments are scanned sequentially
+ * - Value segments of numeric types are scanned with SIMD comparisons (see ValueSegmentSimdScan), value segments of
+ *   strings are scanned by the prefixes of their strings (see StringPrefix), all other segments are scanned
+ *   sequentially
+ * - Run-length segments are scanned run by run, each matching run is added to the matches as a range
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
@@ -32,8 +35,24 @@ class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
   void _scan_non_reference_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                                    const std::shared_ptr<const PosList>& position_filter) const override;
 
+  // Uses binary search to find the matching range of the sorted segment
+  void _scan_sorted_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
+                            const OrderByMode order_by_mode) const override;
+
   void _scan_generic_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches,
                              const std::shared_ptr<const PosList>& position_filter) const;
+
+  // Uses the SIMD kernels of ValueSegmentSimdScan for unencoded numeric segments. Returns false for other segments.
+  bool _scan_value_segment_with_simd(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  // Compares the prefixes of the strings of an unencoded string segment with the prefix of the value and compares the
+  // strings themselves only if the prefixes are equal. Returns false for other segments.
+  bool _scan_string_value_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
+  // Evaluates the predicate once per run of a RunLengthSegment and adds the matching runs as ranges. Returns false for
+  // other segments.
+  bool _scan_run_length_segment(const BaseSegment& segment, const ChunkID chunk_id, PosList& matches) const;
+
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, PosList& matches,
                                 const std::shared_ptr<const PosList>& position_filter) const;
 
@@ -44,6 +63,10 @@ class ColumnVsValueTableScanImpl : public AbstractSingleColumnTableScanImpl {
 
   ValueID _get_search_value_id(const BaseDictionarySegment& segment) const;
 
+  // Evaluates the predicate on the bit-packed attribute vector without decompressing it
+  void _scan_simd_bp128_attribute_vector(const BaseDictionarySegment& segment, const ValueID search_value_id,
+                                         const ChunkID chunk_id, PosList& matches) const;
+
   bool _value_matches_all(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
 
   bool _value_matches_none(const BaseDictionarySegment& segment, const ValueID search_value_id) const;
@@ -0,0 +1,51 @@
+#include "conjunction_table_scan_impl.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ConjunctionTableScanImpl::ConjunctionTableScanImpl(
+    std::vector<std::unique_ptr<AbstractSingleColumnTableScanImpl>>&& impls)
+    : _impls(std::move(impls)) {
+  Assert(!_impls.empty(), "Expected at least one predicate");
+}
+
+std::string ConjunctionTableScanImpl::description() const {
+  std::stringstream stream;
+  stream << "Conjunction(";
+  for (auto impl_idx = size_t{0}; impl_idx < _impls.size(); ++impl_idx) {
+    stream << (impl_idx > 0 ? ", " : "") << _impls[impl_idx]->description();
+  }
+  stream << ")";
+  return stream.str();
+}
+
+std::shared_ptr<PosList> ConjunctionTableScanImpl::scan_chunk(const ChunkID chunk_id) const {
+  auto matches = _impls.front()->scan_chunk(chunk_id);
+
+  for (auto impl_idx = size_t{1}; impl_idx < _impls.size() && !matches->empty(); ++impl_idx) {
+    matches = _impls[impl_idx]->scan_chunk_candidates(chunk_id, *matches);
+  }
+
+  return matches;
+}
+
+void ConjunctionTableScanImpl::set_pos_list_allocator(const PosList::allocator_type& allocator) {
+  // The matches are produced by the impls of the predicates
+  AbstractTableScanImpl::set_pos_list_allocator(allocator);
+  for (const auto& impl : _impls) {
+    impl->set_pos_list_allocator(allocator);
+  }
+}
+
+const std::vector<std::unique_ptr<AbstractSingleColumnTableScanImpl>>& ConjunctionTableScanImpl::impls() const {
+  return _impls;
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_single_column_table_scan_impl.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Evaluates a conjunction of single column predicates (e.g., `a > 5 AND b = 3 AND c LIKE 'x%'`) in one pass
+ *
+ * The first predicate scans the entire chunk. Every following predicate only looks at the rows that matched all
+ * predicates before it, so that no intermediate ReferenceSegments are created. Once no candidate rows are left in a
+ * chunk, the remaining predicates are skipped. The predicates are evaluated in the given order. The
+ * PredicateReorderingRule has already put the most selective predicates first.
+ */
+class ConjunctionTableScanImpl : public AbstractTableScanImpl {
+ public:
+  explicit ConjunctionTableScanImpl(std::vector<std::unique_ptr<AbstractSingleColumnTableScanImpl>>&& impls);
+
+  std::string description() const override;
+
+  std::shared_ptr<PosList> scan_chunk(const ChunkID chunk_id) const override;
+
+  void set_pos_list_allocator(const PosList::allocator_type& allocator) override;
+
+  const std::vector<std::unique_ptr<AbstractSingleColumnTableScanImpl>>& impls() const;
+
+ private:
+  const std::vector<std::unique_ptr<AbstractSingleColumnTableScanImpl>> _impls;
+};
+
+}  // namespace opossum
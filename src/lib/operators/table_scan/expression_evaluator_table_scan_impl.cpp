@@ -1,22 +1,49 @@
 #include "expression_evaluator_table_scan_impl.hpp"
 
+#include <algorithm>
+#include <memory>
+
 #include "expression/evaluation/expression_evaluator.hpp"
 #include "expression/expression_utils.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 
 ExpressionEvaluatorTableScanImpl::ExpressionEvaluatorTableScanImpl(
-    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression)
-    : _in_table(in_table), _expression(expression) {
-  _uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache({expression});
+    const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression,
+    const std::shared_ptr<ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results)
+    : _in_table(in_table), _expression(expression), _uncorrelated_select_results(uncorrelated_select_results) {
+  if (!_uncorrelated_select_results) {
+    _uncorrelated_select_results = ExpressionEvaluator::populate_uncorrelated_select_results_cache({expression});
+  }
 }
 
 std::string ExpressionEvaluatorTableScanImpl::description() const { return "ExpressionEvaluator"; }
 
 std::shared_ptr<PosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) const {
-  return std::make_shared<PosList>(
-      ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_select_results}.evaluate_expression_to_pos_list(
-          *_expression));
+  const auto chunk_size = _in_table->get_chunk(chunk_id)->size();
+  if (chunk_size <= ExpressionEvaluator::BATCH_SIZE) {
+    return std::make_shared<PosList>(
+        ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_select_results}.evaluate_expression_to_pos_list(
+            *_expression));
+  }
+
+  // Large chunks are evaluated in batches, so that the intermediate results of the expression stay in the cache
+  constexpr auto batch_size = ExpressionEvaluator::BATCH_SIZE;
+  auto matches = std::make_shared<PosList>();
+
+  for (auto batch_begin = ChunkOffset{0}; batch_begin < chunk_size; batch_begin += batch_size) {
+    const auto batch_end = std::min(static_cast<ChunkOffset>(batch_begin + batch_size), chunk_size);
+    auto batch = std::make_shared<PosList>();
+    batch->set_chunk_range(chunk_id, batch_begin, batch_end);
+
+    const auto batch_matches =
+        ExpressionEvaluator{_in_table, chunk_id, batch, _uncorrelated_select_results}.evaluate_expression_to_pos_list(
+            *_expression);
+    matches->insert(matches->end(), batch_matches.begin(), batch_matches.end());
+  }
+
+  return matches;
 }
 
 }  // namespace opossum
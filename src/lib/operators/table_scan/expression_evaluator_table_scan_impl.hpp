@@ -15,8 +15,10 @@ class Table;
  */
 class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
  public:
-  ExpressionEvaluatorTableScanImpl(const std::shared_ptr<const Table>& in_table,
-                                   const std::shared_ptr<AbstractExpression>& expression);
+  // The results of the uncorrelated subqueries of the expression are computed if they are not passed
+  ExpressionEvaluatorTableScanImpl(
+      const std::shared_ptr<const Table>& in_table, const std::shared_ptr<AbstractExpression>& expression,
+      const std::shared_ptr<ExpressionEvaluator::UncorrelatedSelectResults>& uncorrelated_select_results = nullptr);
 
   std::string description() const override;
   std::shared_ptr<PosList> scan_chunk(ChunkID chunk_id) const override;
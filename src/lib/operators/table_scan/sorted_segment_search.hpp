@@ -0,0 +1,141 @@
+#pragma once
+
+#include <utility>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Finds the rows of a sorted segment that satisfy a predicate using binary search
+ *
+ * The segment must be sorted as described by the OrderByMode (see Chunk::ordered_by()). The result consists of at
+ * most two contiguous ranges of chunk offsets (two only for NotEquals), which are passed to the result consumer as
+ * (begin, end) pairs in ascending order. NULLs never match.
+ *
+ * Values are accessed via get_typed_value(), so each probe is cheap for most encodings.
+ */
+template <typename SegmentType, typename T>
+class SortedSegmentSearch {
+ public:
+  SortedSegmentSearch(const SegmentType& segment, const OrderByMode order_by_mode)
+      : _segment{segment},
+        _is_ascending{order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast} {
+    const auto size = static_cast<ChunkOffset>(segment.size());
+    const auto nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+
+    if (nulls_first) {
+      _begin = _partition_point(0u, size, [&](const auto offset) { return !_segment.get_typed_value(offset); });
+      _end = size;
+    } else {
+      _begin = 0u;
+      _end = _partition_point(0u, size,
+                              [&](const auto offset) { return _segment.get_typed_value(offset).has_value(); });
+    }
+  }
+
+  template <typename ResultConsumer>
+  void scan(const PredicateCondition predicate_condition, const T& value, const ResultConsumer& result_consumer) const {
+    if (_begin == _end) return;
+
+    if (_is_ascending) {
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+          return _emit(_first_not_less(value), _first_greater(value), result_consumer);
+        case PredicateCondition::NotEquals:
+          _emit(_begin, _first_not_less(value), result_consumer);
+          return _emit(_first_greater(value), _end, result_consumer);
+        case PredicateCondition::LessThan:
+          return _emit(_begin, _first_not_less(value), result_consumer);
+        case PredicateCondition::LessThanEquals:
+          return _emit(_begin, _first_greater(value), result_consumer);
+        case PredicateCondition::GreaterThan:
+          return _emit(_first_greater(value), _end, result_consumer);
+        case PredicateCondition::GreaterThanEquals:
+          return _emit(_first_not_less(value), _end, result_consumer);
+        default:
+          Fail("Unsupported predicate condition encountered");
+      }
+    } else {
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+          return _emit(_first_not_greater(value), _first_less(value), result_consumer);
+        case PredicateCondition::NotEquals:
+          _emit(_begin, _first_not_greater(value), result_consumer);
+          return _emit(_first_less(value), _end, result_consumer);
+        case PredicateCondition::LessThan:
+          return _emit(_first_less(value), _end, result_consumer);
+        case PredicateCondition::LessThanEquals:
+          return _emit(_first_not_greater(value), _end, result_consumer);
+        case PredicateCondition::GreaterThan:
+          return _emit(_begin, _first_not_greater(value), result_consumer);
+        case PredicateCondition::GreaterThanEquals:
+          return _emit(_begin, _first_less(value), result_consumer);
+        default:
+          Fail("Unsupported predicate condition encountered");
+      }
+    }
+  }
+
+  // Finds the rows with left_value <= value <= right_value
+  template <typename ResultConsumer>
+  void scan_between(const T& left_value, const T& right_value, const ResultConsumer& result_consumer) const {
+    if (_begin == _end) return;
+
+    if (_is_ascending) {
+      _emit(_first_not_less(left_value), _first_greater(right_value), result_consumer);
+    } else {
+      _emit(_first_not_greater(right_value), _first_less(left_value), result_consumer);
+    }
+  }
+
+ private:
+  // Returns the first offset in [begin, end) for which the predicate is false. The predicate must be true for a
+  // (possibly empty) prefix of the range and false for the rest.
+  template <typename Predicate>
+  static ChunkOffset _partition_point(ChunkOffset begin, ChunkOffset end, const Predicate& predicate) {
+    while (begin < end) {
+      const auto middle = static_cast<ChunkOffset>(begin + (end - begin) / 2u);
+      if (predicate(middle)) {
+        begin = middle + 1u;
+      } else {
+        end = middle;
+      }
+    }
+    return begin;
+  }
+
+  const T _value(const ChunkOffset offset) const { return *_segment.get_typed_value(offset); }
+
+  ChunkOffset _first_not_less(const T& search_value) const {
+    return _partition_point(_begin, _end, [&](const auto offset) { return _value(offset) < search_value; });
+  }
+
+  ChunkOffset _first_greater(const T& search_value) const {
+    return _partition_point(_begin, _end, [&](const auto offset) { return !(search_value < _value(offset)); });
+  }
+
+  // The descending counterparts to the two methods above
+  ChunkOffset _first_not_greater(const T& search_value) const {
+    return _partition_point(_begin, _end, [&](const auto offset) { return search_value < _value(offset); });
+  }
+
+  ChunkOffset _first_less(const T& search_value) const {
+    return _partition_point(_begin, _end, [&](const auto offset) { return !(_value(offset) < search_value); });
+  }
+
+  template <typename ResultConsumer>
+  static void _emit(const ChunkOffset begin, const ChunkOffset end, const ResultConsumer& result_consumer) {
+    if (begin < end) result_consumer(begin, end);
+  }
+
+  const SegmentType& _segment;
+  const bool _is_ascending;
+
+  // The range of non-NULL values
+  ChunkOffset _begin;
+  ChunkOffset _end;
+};
+
+}  // namespace opossum
@@ -0,0 +1,252 @@
+#include "value_segment_simd_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+// The 256-bit and 512-bit kernels are compiled for AVX2 and AVX-512 and are only available on x86-64
+#if defined(__x86_64__)
+#define VALUE_SEGMENT_SIMD_SCAN_WIDE_REGISTERS 1
+#endif
+
+// Used for code that needs to be compiled for the instruction set of its caller (see match_masks_512)
+#define VALUE_SEGMENT_SIMD_SCAN_ALWAYS_INLINE __attribute__((always_inline))
+
+namespace opossum {
+
+namespace {
+
+// Number of rows per match mask
+constexpr auto BLOCK_SIZE = size_t{64};
+
+// A register of register_size bytes holding values of type T
+template <typename T, size_t register_size>
+struct SimdRegister {
+  typedef T type __attribute__((vector_size(register_size)));
+};
+
+/**
+ * Compares two values or two registers. For registers, GCC and clang evaluate the comparison per lane and yield -1
+ * (all bits set) for true and 0 for false in each lane. The result is passed by reference, as returning registers by
+ * value depends on the instruction set of the caller.
+ */
+template <PredicateCondition condition, typename Value, typename Result>
+inline VALUE_SEGMENT_SIMD_SCAN_ALWAYS_INLINE void compare(const Value& lhs, const Value& rhs, Result& result) {
+  if constexpr (condition == PredicateCondition::Equals) result = lhs == rhs;
+  if constexpr (condition == PredicateCondition::NotEquals) result = lhs != rhs;
+  if constexpr (condition == PredicateCondition::LessThan) result = lhs < rhs;
+  if constexpr (condition == PredicateCondition::LessThanEquals) result = lhs <= rhs;
+  if constexpr (condition == PredicateCondition::GreaterThan) result = lhs > rhs;
+  if constexpr (condition == PredicateCondition::GreaterThanEquals) result = lhs >= rhs;
+}
+
+// Compares BLOCK_SIZE consecutive values with the search value and returns one bit per value
+template <PredicateCondition condition, size_t register_size, typename T, size_t... lane>
+inline VALUE_SEGMENT_SIMD_SCAN_ALWAYS_INLINE uint64_t match_mask(const T* values, const T search_value,
+                                                                  std::index_sequence<lane...>) {
+  using Register = typename SimdRegister<T, register_size>::type;
+  constexpr auto LANES = sizeof...(lane);
+  static_assert(LANES * sizeof(T) == register_size && BLOCK_SIZE % LANES == 0u, "Invalid register size");
+
+  const auto search_register = Register{} + search_value;
+
+  auto mask = uint64_t{0};
+  for (auto register_index = size_t{0}; register_index < BLOCK_SIZE / LANES; ++register_index) {
+    Register value_register;
+    std::memcpy(&value_register, values + register_index * LANES, sizeof(Register));
+
+    auto result = decltype(value_register == search_register){};
+    compare<condition>(value_register, search_register, result);
+    const auto lane_bits = ((static_cast<uint64_t>(result[lane] & 1) << lane) | ...);
+    mask |= lane_bits << (register_index * LANES);
+  }
+
+  return mask;
+}
+
+template <PredicateCondition condition, size_t register_size, typename T>
+inline VALUE_SEGMENT_SIMD_SCAN_ALWAYS_INLINE void match_masks(const pmr_concurrent_vector<T>& values,
+                                                              const T search_value, std::vector<uint64_t>& masks) {
+  alignas(64) auto buffer = std::array<T, BLOCK_SIZE>{};
+
+  for (auto block_index = size_t{0}; block_index < masks.size(); ++block_index) {
+    const auto begin = block_index * BLOCK_SIZE;
+
+    // The concurrent_vector stores its values in segments of increasing size. Blocks are usually within a single
+    // segment. Only the first blocks can span several segments and are copied into a buffer.
+    const auto* block_values = &values[begin];
+    if (&values[begin + BLOCK_SIZE - 1u] != block_values + BLOCK_SIZE - 1u) {
+      std::copy(values.begin() + begin, values.begin() + begin + BLOCK_SIZE, buffer.begin());
+      block_values = buffer.data();
+    }
+
+    masks[block_index] = match_mask<condition, register_size>(block_values, search_value,
+                                                               std::make_index_sequence<register_size / sizeof(T)>{});
+  }
+}
+
+template <PredicateCondition condition, typename T>
+void match_masks_128(const pmr_concurrent_vector<T>& values, const T search_value, std::vector<uint64_t>& masks) {
+  match_masks<condition, 16u>(values, search_value, masks);
+}
+
+#if VALUE_SEGMENT_SIMD_SCAN_WIDE_REGISTERS
+
+// Compiled for the respective instruction set, only called if the CPU supports it
+template <PredicateCondition condition, typename T>
+__attribute__((target("avx2"))) void match_masks_256(const pmr_concurrent_vector<T>& values, const T search_value,
+                                                     std::vector<uint64_t>& masks) {
+  match_masks<condition, 32u>(values, search_value, masks);
+}
+
+template <PredicateCondition condition, typename T>
+__attribute__((target("avx512f"))) void match_masks_512(const pmr_concurrent_vector<T>& values, const T search_value,
+                                                        std::vector<uint64_t>& masks) {
+  match_masks<condition, 64u>(values, search_value, masks);
+}
+
+#endif
+
+// Appends the chunk offsets of the set bits of the masks. NULLs are only looked up for matches.
+template <bool check_nulls>
+void compress_masks(const std::vector<uint64_t>& masks, const pmr_concurrent_vector<bool>* null_values,
+                    const ChunkID chunk_id, PosList& matches) {
+  for (auto block_index = size_t{0}; block_index < masks.size(); ++block_index) {
+    auto mask = masks[block_index];
+    while (mask) {
+      const auto chunk_offset = static_cast<ChunkOffset>(block_index * BLOCK_SIZE + __builtin_ctzll(mask));
+      mask &= mask - 1u;
+
+      if constexpr (check_nulls) {
+        if ((*null_values)[chunk_offset]) continue;
+      }
+      matches.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+}
+
+template <typename Functor>
+void resolve_predicate_condition(const PredicateCondition predicate_condition, const Functor& functor) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::Equals>{});
+      return;
+
+    case PredicateCondition::NotEquals:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::NotEquals>{});
+      return;
+
+    case PredicateCondition::LessThan:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::LessThan>{});
+      return;
+
+    case PredicateCondition::LessThanEquals:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::LessThanEquals>{});
+      return;
+
+    case PredicateCondition::GreaterThan:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::GreaterThan>{});
+      return;
+
+    case PredicateCondition::GreaterThanEquals:
+      functor(std::integral_constant<PredicateCondition, PredicateCondition::GreaterThanEquals>{});
+      return;
+
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+}
+
+}  // namespace
+
+uint32_t ValueSegmentSimdScan::max_register_width() {
+#if VALUE_SEGMENT_SIMD_SCAN_WIDE_REGISTERS
+  static const auto register_width = []() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return 512u;
+    if (__builtin_cpu_supports("avx2")) return 256u;
+    return 128u;
+  }();
+  return register_width;
+#else
+  return 128u;
+#endif
+}
+
+template <typename T>
+void ValueSegmentSimdScan::scan(const ValueSegment<T>& segment, const PredicateCondition predicate_condition,
+                                const T search_value, const ChunkID chunk_id, PosList& matches) {
+  scan(segment, predicate_condition, search_value, chunk_id, matches, max_register_width());
+}
+
+template <typename T>
+void ValueSegmentSimdScan::scan(const ValueSegment<T>& segment, const PredicateCondition predicate_condition,
+                                const T search_value, const ChunkID chunk_id, PosList& matches,
+                                const uint32_t register_width) {
+  static_assert(supports_data_type<T>(), "No SIMD kernel for this data type");
+  DebugAssert(register_width <= max_register_width(), "Register width is not supported by this CPU.");
+
+  segment.access_statistics().on_sequential_scan(segment.size());
+
+  const auto& values = segment.values();
+  const auto size = values.size();
+  const auto check_nulls = segment.is_nullable() && segment.may_contain_null_values();
+  const auto* null_values = check_nulls ? &segment.null_values() : nullptr;
+
+  auto masks = std::vector<uint64_t>(size / BLOCK_SIZE);
+
+  resolve_predicate_condition(predicate_condition, [&](auto condition_c) {
+    constexpr auto condition = decltype(condition_c)::value;
+
+#if VALUE_SEGMENT_SIMD_SCAN_WIDE_REGISTERS
+    if (register_width >= 512u) {
+      match_masks_512<condition>(values, search_value, masks);
+    } else if (register_width >= 256u) {
+      match_masks_256<condition>(values, search_value, masks);
+    } else {
+      match_masks_128<condition>(values, search_value, masks);
+    }
+#else
+    match_masks_128<condition>(values, search_value, masks);
+#endif
+
+    if (check_nulls) {
+      compress_masks<true>(masks, null_values, chunk_id, matches);
+    } else {
+      compress_masks<false>(masks, null_values, chunk_id, matches);
+    }
+
+    // The rows after the last full block are compared one by one
+    for (auto chunk_offset = static_cast<ChunkOffset>(masks.size() * BLOCK_SIZE); chunk_offset < size; ++chunk_offset) {
+      if (check_nulls && (*null_values)[chunk_offset]) continue;
+
+      auto result = false;
+      compare<condition>(values[chunk_offset], search_value, result);
+      if (result) matches.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  });
+}
+
+template void ValueSegmentSimdScan::scan<int32_t>(const ValueSegment<int32_t>&, const PredicateCondition,
+                                                  const int32_t, const ChunkID, PosList&);
+template void ValueSegmentSimdScan::scan<int64_t>(const ValueSegment<int64_t>&, const PredicateCondition,
+                                                  const int64_t, const ChunkID, PosList&);
+template void ValueSegmentSimdScan::scan<float>(const ValueSegment<float>&, const PredicateCondition, const float,
+                                                const ChunkID, PosList&);
+template void ValueSegmentSimdScan::scan<double>(const ValueSegment<double>&, const PredicateCondition, const double,
+                                                 const ChunkID, PosList&);
+
+template void ValueSegmentSimdScan::scan<int32_t>(const ValueSegment<int32_t>&, const PredicateCondition,
+                                                  const int32_t, const ChunkID, PosList&, const uint32_t);
+template void ValueSegmentSimdScan::scan<int64_t>(const ValueSegment<int64_t>&, const PredicateCondition,
+                                                  const int64_t, const ChunkID, PosList&, const uint32_t);
+template void ValueSegmentSimdScan::scan<float>(const ValueSegment<float>&, const PredicateCondition, const float,
+                                                const ChunkID, PosList&, const uint32_t);
+template void ValueSegmentSimdScan::scan<double>(const ValueSegment<double>&, const PredicateCondition, const double,
+                                                 const ChunkID, PosList&, const uint32_t);
+
+}  // namespace opossum
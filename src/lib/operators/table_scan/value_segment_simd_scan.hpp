@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "storage/pos_list.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Scans an unencoded numeric segment with SIMD comparisons
+ *
+ * The values are compared against the search value in blocks of 64. Each block results in a 64-bit match mask, one
+ * bit per row. The masks are then compressed into the chunk offsets of the matches. Depending on the CPU, 128-bit,
+ * 256-bit (AVX2) or 512-bit (AVX-512) registers are used. The instruction set is chosen at runtime, so that a binary
+ * built on one machine still runs on older CPUs.
+ *
+ * If the segment may contain NULLs, matches that are NULL are dropped while compressing the masks. Segments without
+ * NULLs skip this check. Only the conditions Equals, NotEquals, LessThan, LessThanEquals, GreaterThan and
+ * GreaterThanEquals are supported.
+ */
+class ValueSegmentSimdScan {
+ public:
+  // Returns true for the data types that have a SIMD kernel
+  template <typename T>
+  static constexpr bool supports_data_type() {
+    return std::is_same_v<T, int32_t> || std::is_same_v<T, int64_t> || std::is_same_v<T, float> ||
+           std::is_same_v<T, double>;
+  }
+
+  // The widest register (in bits) that the CPU supports and that kernels exist for
+  static uint32_t max_register_width();
+
+  template <typename T>
+  static void scan(const ValueSegment<T>& segment, const PredicateCondition predicate_condition, const T search_value,
+                   const ChunkID chunk_id, PosList& matches);
+
+  // Uses registers of the given width. Public for testing purposes.
+  template <typename T>
+  static void scan(const ValueSegment<T>& segment, const PredicateCondition predicate_condition, const T search_value,
+                   const ChunkID chunk_id, PosList& matches, const uint32_t register_width);
+};
+
+}  // namespace opossum
@@ -19,7 +19,7 @@ const std::string UnionAll::name() const { return "UnionAll"; }
 std::shared_ptr<const Table> UnionAll::_on_execute() {
   DebugAssert(input_table_left()->column_definitions() == input_table_right()->column_definitions(),
               "Input tables must have same number of columns");
-  DebugAssert(input_table_left()->type() == input_table_left()->type(), "Input tables must have the same type");
+  DebugAssert(input_table_left()->type() == input_table_right()->type(), "Input tables must have the same type");
 
   auto output = std::make_shared<Table>(input_table_left()->column_definitions(), input_table_left()->type());
 
@@ -27,12 +27,22 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
   for (const auto& input : {input_table_left(), input_table_right()}) {
     // iterating over all chunks of table input
     for (ChunkID in_chunk_id{0}; in_chunk_id < input->chunk_count(); in_chunk_id++) {
+      const auto& chunk = input->chunks()[in_chunk_id];
+
+      // Chunks without MVCC data (e.g., all chunks of intermediate results) are forwarded as they are, which also
+      // keeps their statistics and sort orders. The chunks of stored tables are wrapped in new chunks without MVCC
+      // data, as the output table does not use MVCC.
+      if (!chunk->has_mvcc_data()) {
+        output->append_chunk(chunk);
+        continue;
+      }
+
       // creating empty chunk to add segments with positions
       Segments output_segments;
 
       // iterating over all segments of the current chunk
       for (ColumnID column_id{0}; column_id < input->column_count(); ++column_id) {
-        output_segments.push_back(input->get_chunk(in_chunk_id)->get_segment(column_id));
+        output_segments.push_back(chunk->get_segment(column_id));
       }
 
       // adding newly filled chunk to the output table
@@ -42,6 +52,7 @@ std::shared_ptr<const Table> UnionAll::_on_execute() {
 
   return output;
 }
+
 std::shared_ptr<AbstractOperator> UnionAll::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
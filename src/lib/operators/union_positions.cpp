@@ -47,6 +47,14 @@
  *      _column_cluster_offsets = {0, 2, 3}
  *
  *
+ * ### About the bitmap union
+ * If there is only one ColumnCluster, which is the case for the typical disjunction of predicates on a single table,
+ * the rows of the ReferenceMatrices are single RowIDs. Instead of sorting them, a bitmap is set for each chunk of the
+ * referenced table that is referenced by any RowID of the inputs. Reading the bitmaps chunk by chunk yields the union
+ * in the same order as merging the sorted ReferenceMatrices but in time linear in the number of input rows (plus the
+ * size of the referenced chunks).
+ *
+ *
  * ### TODO(anybody) for potential performance improvements
  * Instead of using a ReferenceMatrix, consider using a linked list of RowIDs for each row. Since most of the sorting
  *      will depend on the leftmost column, this way most of the time no remote memory would need to be accessed
@@ -75,6 +83,10 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  if (_column_cluster_offsets.size() == 1) {
+    return _union_with_bitmaps();
+  }
+
   /**
    * For each input, create a ReferenceMatrix
    */
@@ -194,6 +206,76 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
   return out_table;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_with_bitmaps() const {
+  const auto& referenced_table = *_referenced_tables[0];
+
+  // Bitmaps are only allocated for the referenced chunks, so that selective inputs do not touch the whole table
+  auto bitmaps = std::vector<std::vector<bool>>(referenced_table.chunk_count());
+  auto contains_null_row = false;
+
+  const auto add = [&](const auto& table) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto segment = table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+      const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+
+      for (const auto& row_id : pos_list) {
+        if (row_id.is_null()) {
+          contains_null_row = true;
+          continue;
+        }
+
+        auto& bitmap = bitmaps[row_id.chunk_id];
+        if (bitmap.empty()) {
+          bitmap.resize(referenced_table.get_chunk(row_id.chunk_id)->size());
+        }
+        DebugAssert(row_id.chunk_offset < bitmap.size(), "RowID out of range of the referenced chunk");
+        bitmap[row_id.chunk_offset] = true;
+      }
+    }
+  };
+  add(input_table_left());
+  add(input_table_right());
+
+  auto out_table = std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
+
+  // The same chunk size as in the merge of the ReferenceMatrices in _on_execute()
+  const auto out_chunk_size = std::max(input_table_left()->max_chunk_size(), input_table_right()->max_chunk_size());
+
+  auto pos_list = std::make_shared<PosList>();
+
+  const auto emit_chunk = [&]() {
+    Segments output_segments;
+    for (auto column_id = ColumnID{0}; column_id < input_table_left()->column_count(); ++column_id) {
+      output_segments.push_back(std::make_shared<ReferenceSegment>(_referenced_tables[0],
+                                                                   _referenced_column_ids[column_id], pos_list));
+    }
+    out_table->append_chunk(output_segments);
+
+    pos_list = std::make_shared<PosList>();
+  };
+
+  const auto emit_row = [&](const RowID& row_id) {
+    pos_list->emplace_back(row_id);
+    if (pos_list->size() == out_chunk_size) {
+      emit_chunk();
+    }
+  };
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < bitmaps.size(); ++chunk_id) {
+    const auto& bitmap = bitmaps[chunk_id];
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < bitmap.size(); ++chunk_offset) {
+      if (bitmap[chunk_offset]) emit_row(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  // NULL_ROW_ID is the largest RowID and thus the last row of the merged ReferenceMatrices as well
+  if (contains_null_row) emit_row(NULL_ROW_ID);
+
+  if (!pos_list->empty()) emit_chunk();
+
+  return out_table;
+}
+
 std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   DebugAssert(input_table_left()->column_definitions() == input_table_right()->column_definitions(),
               "Input tables don't have the same layout");
@@ -107,6 +107,12 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * Computes the union if all columns of the inputs share one ColumnCluster, i.e., the inputs reference a single
+   * table. See the "About the bitmap union" doc in the cpp
+   */
+  std::shared_ptr<const Table> _union_with_bitmaps() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                       const ReferenceMatrix& right_matrix, size_t right_row_idx) const;
@@ -6,8 +6,10 @@
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "morsel_planner.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
+#include "utils/timer.hpp"
 
 namespace opossum {
 
@@ -15,9 +17,9 @@ namespace {
 
 bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
                     const MvccData& mvcc_data) {
-  const auto row_tid = mvcc_data.tids[chunk_offset].load();
-  const auto begin_cid = mvcc_data.begin_cids[chunk_offset];
-  const auto end_cid = mvcc_data.end_cids[chunk_offset];
+  const auto row_tid = mvcc_data.tid(chunk_offset);
+  const auto begin_cid = mvcc_data.begin_cid(chunk_offset);
+  const auto end_cid = mvcc_data.end_cid(chunk_offset);
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
@@ -60,89 +62,193 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
 
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+  const auto pos_list_allocator = PosList::allocator_type{memory_resource()};
+
+  // The output segments are collected per input chunk and appended in chunk order, so that the output does not depend
+  // on the order in which the jobs finish. Chunks without visible rows are left empty.
+  auto output_segments_by_chunk = std::vector<Segments>(in_table->chunk_count());
+
+  const auto validate_chunk = [&](const ChunkID chunk_id) {
+    Timer timer;
+    output_segments_by_chunk[chunk_id] =
+        _validate_chunk(in_table, chunk_id, our_tid, snapshot_commit_id, pos_list_allocator);
+    _performance_data->add_task_walltime(timer.lap());
+  };
+
+  MorselPlanner::for_each_chunk(type(), *in_table, validate_chunk);
+  _performance_data->chunks_processed += in_table->chunk_count();
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
+    if (output_segments_by_chunk[chunk_id].empty()) continue;
+    output->append_chunk(output_segments_by_chunk[chunk_id]);
+    _forward_chunk_properties(*in_table->get_chunk(chunk_id), *output->get_chunk(ChunkID{output->chunk_count() - 1}));
+  }
 
-  for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-    const auto chunk_in = in_table->get_chunk(chunk_id);
+  return output;
+}
 
-    Segments output_segments;
-    auto pos_list_out = std::make_shared<PosList>();
-    auto referenced_table = std::shared_ptr<const Table>();
-    const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
+void Validate::_forward_chunk_properties(const Chunk& input_chunk, Chunk& output_chunk) {
+  // The visible rows keep their order and their partition
+  if (const auto& ordered_by = input_chunk.ordered_by()) output_chunk.set_ordered_by(*ordered_by);
+  if (const auto partition_id = input_chunk.partition_id()) output_chunk.set_partition_id(*partition_id);
+}
 
-    // If the segments in this chunk reference a segment, build a poslist for a reference segment.
-    if (ref_segment_in) {
-      DebugAssert(chunk_in->references_exactly_one_table(),
-                  "Input to Validate contains a Chunk referencing more than one table.");
+Segments Validate::_validate_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                   const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                   const PosList::allocator_type& pos_list_allocator) {
+  const auto chunk_in = in_table->get_chunk(chunk_id);
+  auto output_segments = Segments{};
 
-      // Check all rows in the old poslist and put them in pos_list_out if they are visible.
-      referenced_table = ref_segment_in->referenced_table();
-      DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
+  // All rows of a compacted chunk have been moved to other chunks before our snapshot was taken.
+  const auto cleanup_commit_id = chunk_in->cleanup_commit_id();
+  if (cleanup_commit_id && snapshot_commit_id >= *cleanup_commit_id) return output_segments;
 
-      const auto& pos_list_in = *ref_segment_in->pos_list();
-      if (pos_list_in.references_single_chunk() && !pos_list_in.empty()) {
-        // Fast path - we are looking at a single referenced chunk and thus need to get the MVCC data vector only once.
+  auto pos_list_out = std::make_shared<PosList>(pos_list_allocator);
+  auto referenced_table = std::shared_ptr<const Table>();
+  const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
 
-        pos_list_out->guarantee_single_chunk();
+  // If the segments in this chunk reference a segment, build a poslist for a reference segment.
+  if (ref_segment_in) {
+    DebugAssert(chunk_in->references_exactly_one_table(),
+                "Input to Validate contains a Chunk referencing more than one table.");
 
-        const auto referenced_chunk = referenced_table->get_chunk(pos_list_in.common_chunk_id());
-        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+    // Check all rows in the old poslist and put them in pos_list_out if they are visible.
+    referenced_table = ref_segment_in->referenced_table();
+    DebugAssert(referenced_table->has_mvcc(), "Trying to use Validate on a table that has no MVCC data");
+
+    const auto& pos_list_in = *ref_segment_in->pos_list();
+    if (pos_list_in.references_single_chunk() && !pos_list_in.empty()) {
+      // Fast path - we are looking at a single referenced chunk and thus need to get the MVCC data vector only once.
+
+      const auto referenced_chunk = referenced_table->get_chunk(pos_list_in.common_chunk_id());
+      auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+
+      // If all rows of the referenced chunk are visible, the input chunk is forwarded as it is
+      if (mvcc_data->is_fully_visible(snapshot_commit_id)) {
+        for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+          output_segments.push_back(chunk_in->get_segment(column_id));
+        }
+        return output_segments;
+      }
+
+      pos_list_out->guarantee_single_chunk();
 
-        for (auto row_id : pos_list_in) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-            pos_list_out->emplace_back(row_id);
-          }
+      pos_list_in.for_each_row_id([&](const RowID& row_id) {
+        if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+          pos_list_out->emplace_back(row_id);
         }
+      });
 
-      } else {
-        // Slow path - we are looking at multiple referenced chunks and need to get the MVCC data vector for every row.
+      pos_list_out->compact(referenced_chunk->size());
 
-        for (auto row_id : pos_list_in) {
-          const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+    } else {
+      // Slow path - we are looking at multiple referenced chunks and need to get the MVCC data vector for every row.
 
-          auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+      for (auto row_id : pos_list_in) {
+        const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-            pos_list_out->emplace_back(row_id);
-          }
+        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+
+        if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+          pos_list_out->emplace_back(row_id);
         }
       }
+    }
+
+    if (pos_list_out->empty()) return output_segments;
+
+    // Construct the actual ReferenceSegment objects and add them to the chunk.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      const auto reference_segment =
+          std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
+      const auto referenced_column_id = reference_segment->referenced_column_id();
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
+      output_segments.push_back(ref_segment_out);
+    }
+
+    // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
+  } else {
+    referenced_table = in_table;
+    DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
+
+    // The size is determined before looking at the MVCC data. Rows that are appended in the meantime are not part
+    // of the output, even if they are committed.
+    auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
+    const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
+
+    if (mvcc_data->is_fully_visible(snapshot_commit_id)) {
+      // Shortcut for chunks that were not modified since they were loaded or committed before our snapshot
+      pos_list_out->set_chunk_range(chunk_id, 0u, chunk_size);
+    } else if (mvcc_data->is_compressed()) {
+      // Frozen chunk: Only the invalidated rows need to be checked
+      pos_list_out->guarantee_single_chunk();
 
-      // Construct the actual ReferenceSegment objects and add them to the chunk.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        const auto reference_segment =
-            std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
-        const auto referenced_column_id = reference_segment->referenced_column_id();
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+      const auto begin_cid = mvcc_data->compressed_begin_cid();
+      auto chunk_offset = ChunkOffset{0};
+      const auto emit_valid_rows_until = [&](const ChunkOffset end_offset) {
+        if (snapshot_commit_id >= begin_cid) {
+          for (; chunk_offset < end_offset; ++chunk_offset) pos_list_out->emplace_back(RowID{chunk_id, chunk_offset});
+        }
+        chunk_offset = end_offset;
+      };
+
+      for (const auto& invalidated_row : mvcc_data->invalidated_rows()) {
+        if (invalidated_row.chunk_offset >= chunk_size) break;
+        emit_valid_rows_until(invalidated_row.chunk_offset);
+        if (Validate::is_row_visible(our_tid, snapshot_commit_id, invalidated_row.tid, begin_cid,
+                                     invalidated_row.end_cid)) {
+          pos_list_out->emplace_back(RowID{chunk_id, chunk_offset});
+        }
+        ++chunk_offset;
       }
+      emit_valid_rows_until(chunk_size);
 
-      // Otherwise we have a Value- or DictionarySegment and simply iterate over all rows to build a poslist.
+      pos_list_out->compact(chunk_size);
     } else {
-      referenced_table = in_table;
-      DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
-      const auto mvcc_data = chunk_in->get_scoped_mvcc_data_lock();
       pos_list_out->guarantee_single_chunk();
 
       // Generate pos_list_out.
-      auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
       for (auto i = 0u; i < chunk_size; i++) {
         if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
           pos_list_out->emplace_back(RowID{chunk_id, i});
         }
       }
 
-      // Create actual ReferenceSegment objects.
-      for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
-      }
+      // Usually, most rows are visible. In that case, a range or bitmap takes less memory than the RowIDs.
+      pos_list_out->compact(chunk_size);
     }
 
-    if (!pos_list_out->empty() > 0) {
-      output->append_chunk(output_segments);
+    if (pos_list_out->empty()) return output_segments;
+
+    // Create actual ReferenceSegment objects.
+    for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
+      auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
+      output_segments.push_back(ref_segment_out);
     }
   }
-  return output;
+
+  return output_segments;
+}
+
+MorselProcessor Validate::create_morsel_processor() const {
+  const auto transaction_context = this->transaction_context();
+  Assert(transaction_context, "Validate can't be called without a transaction context.");
+
+  const auto our_tid = transaction_context->transaction_id();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  return [our_tid, snapshot_commit_id](const std::shared_ptr<const Table>& in_table,
+                                       const std::vector<ChunkID>& chunk_ids) {
+    auto output = std::make_shared<Table>(in_table->column_definitions(), TableType::References);
+    for (const auto chunk_id : chunk_ids) {
+      const auto output_segments =
+          _validate_chunk(in_table, chunk_id, our_tid, snapshot_commit_id, PosList::allocator_type{});
+      if (output_segments.empty()) continue;
+      output->append_chunk(output_segments);
+      _forward_chunk_properties(*in_table->get_chunk(chunk_id), *output->get_chunk(ChunkID{output->chunk_count() - 1}));
+    }
+    return output;
+  };
 }
 
 }  // namespace opossum
@@ -5,6 +5,8 @@
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
+#include "pipeline.hpp"
+#include "storage/pos_list.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -26,6 +28,9 @@ class Validate : public AbstractReadOnlyOperator {
   static bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
                              const CommitID begin_cid, const CommitID end_cid);
 
+  // Validates morsels within the transaction context of this operator, see Pipeline
+  MorselProcessor create_morsel_processor() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
@@ -33,6 +38,15 @@ class Validate : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  // Returns the output segments for the visible rows of a chunk, or no segments if no row is visible
+  static Segments _validate_chunk(const std::shared_ptr<const Table>& in_table, const ChunkID chunk_id,
+                                  const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                  const PosList::allocator_type& pos_list_allocator);
+
+  // Sets the order and the partition of the input chunk (see Chunk::ordered_by() and Chunk::partition_id()) on the
+  // output chunk of its visible rows
+  static void _forward_chunk_properties(const Chunk& input_chunk, Chunk& output_chunk);
 };
 
 }  // namespace opossum
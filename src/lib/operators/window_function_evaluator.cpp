@@ -0,0 +1,489 @@
+#include "window_function_evaluator.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "expression/pqp_column_expression.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "operators/aggregate/aggregate_traits.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Partitions are distributed to about one bucket per ROWS_PER_BUCKET rows, but at most MAX_BUCKET_COUNT buckets
+constexpr auto ROWS_PER_BUCKET = size_t{10'000};
+constexpr auto MAX_BUCKET_COUNT = size_t{256};
+
+// The values of a column, indexed by the position of the row in the input table (in chunk order)
+struct BaseMaterializedColumn {
+  virtual ~BaseMaterializedColumn() = default;
+
+  // Stable sort of the rows by the values of this column. NULLs are placed as in the Sort operator.
+  virtual void sort(std::vector<size_t>& rows, const OrderByMode order_by_mode) const = 0;
+
+  // NULLs are considered equal to each other, as they belong to the same partition and peer group
+  virtual bool equals(const size_t lhs_row, const size_t rhs_row) const = 0;
+
+  virtual size_t hash(const size_t row) const = 0;
+};
+
+template <typename T>
+struct MaterializedColumn : public BaseMaterializedColumn {
+  void sort(std::vector<size_t>& rows, const OrderByMode order_by_mode) const override {
+    const auto nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+    const auto descending =
+        order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+
+    // Move the NULLs to the front or the back, then sort the remaining values
+    auto values_begin = rows.begin();
+    auto values_end = rows.end();
+    if (nulls_first) {
+      values_begin = std::stable_partition(rows.begin(), rows.end(), [&](const auto row) { return null_values[row]; });
+    } else {
+      values_end = std::stable_partition(rows.begin(), rows.end(), [&](const auto row) { return !null_values[row]; });
+    }
+
+    if (descending) {
+      std::stable_sort(values_begin, values_end,
+                       [&](const auto lhs, const auto rhs) { return values[lhs] > values[rhs]; });
+    } else {
+      std::stable_sort(values_begin, values_end,
+                       [&](const auto lhs, const auto rhs) { return values[lhs] < values[rhs]; });
+    }
+  }
+
+  bool equals(const size_t lhs_row, const size_t rhs_row) const override {
+    if (null_values[lhs_row] || null_values[rhs_row]) return null_values[lhs_row] && null_values[rhs_row];
+    return values[lhs_row] == values[rhs_row];
+  }
+
+  size_t hash(const size_t row) const override { return null_values[row] ? 0 : std::hash<T>{}(values[row]); }
+
+  std::vector<T> values;
+  std::vector<bool> null_values;
+};
+
+template <typename T>
+std::unique_ptr<MaterializedColumn<T>> materialize_typed_column(const Table& table, const ColumnID column_id) {
+  auto column = std::make_unique<MaterializedColumn<T>>();
+  column->values.reserve(table.row_count());
+  column->null_values.reserve(table.row_count());
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    segment_iterate<T>(*table.get_chunk(chunk_id)->get_segment(column_id), [&](const auto& position) {
+      if (position.is_null()) {
+        column->values.emplace_back();
+        column->null_values.emplace_back(true);
+      } else {
+        column->values.emplace_back(position.value());
+        column->null_values.emplace_back(false);
+      }
+    });
+  }
+
+  return column;
+}
+
+std::unique_ptr<BaseMaterializedColumn> materialize_column(const Table& table, const ColumnID column_id) {
+  auto column = std::unique_ptr<BaseMaterializedColumn>{};
+  resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    column = materialize_typed_column<ColumnDataType>(table, column_id);
+  });
+  return column;
+}
+
+ColumnID column_id_of(const AbstractExpression& expression) {
+  return static_cast<const PQPColumnExpression&>(expression).column_id;
+}
+
+// The results of the window function, one vector per input chunk. Jobs write the results of distinct rows
+// concurrently, which is safe as concurrent vectors store their elements (including bools) separately.
+template <typename T>
+class WindowResults {
+ public:
+  WindowResults(const Table& table, const std::vector<RowID>& row_ids, const bool nullable)
+      : _row_ids(row_ids), _nullable(nullable) {
+    _values.reserve(table.chunk_count());
+    if (_nullable) _null_values.reserve(table.chunk_count());
+
+    for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk_size = table.get_chunk(chunk_id)->size();
+      _values.emplace_back(chunk_size);
+      if (_nullable) _null_values.emplace_back(chunk_size, false);
+    }
+  }
+
+  void set(const size_t row, const T& value) {
+    const auto& row_id = _row_ids[row];
+    _values[row_id.chunk_id][row_id.chunk_offset] = value;
+  }
+
+  void set_null(const size_t row) {
+    DebugAssert(_nullable, "Tried to write NULL into a non-nullable window function result");
+    const auto& row_id = _row_ids[row];
+    _null_values[row_id.chunk_id][row_id.chunk_offset] = true;
+  }
+
+  std::vector<std::shared_ptr<BaseSegment>> segments() {
+    auto segments = std::vector<std::shared_ptr<BaseSegment>>{};
+    segments.reserve(_values.size());
+    for (auto chunk_index = size_t{0}; chunk_index < _values.size(); ++chunk_index) {
+      if (_nullable) {
+        segments.emplace_back(std::make_shared<ValueSegment<T>>(std::move(_values[chunk_index]),
+                                                                std::move(_null_values[chunk_index])));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<T>>(std::move(_values[chunk_index])));
+      }
+    }
+    return segments;
+  }
+
+ private:
+  const std::vector<RowID>& _row_ids;
+  const bool _nullable;
+  std::vector<pmr_concurrent_vector<T>> _values;
+  std::vector<pmr_concurrent_vector<bool>> _null_values;
+};
+
+template <WindowFunction function, typename T>
+using WindowAggregateType = std::conditional_t<
+    function == WindowFunction::Count, int64_t,
+    std::conditional_t<function == WindowFunction::Sum,
+                       typename AggregateTraits<T, AggregateFunction::Sum>::AggregateType,
+                       std::conditional_t<function == WindowFunction::Avg, double, T>>>;
+
+// A partition is the range [begin, end) of the sorted rows of a bucket
+template <typename IsPeer>
+void compute_ranking(const WindowFunction function, const std::vector<size_t>& rows, const size_t begin,
+                     const size_t end, const IsPeer& is_peer, WindowResults<int64_t>& results) {
+  auto rank = int64_t{0};
+  auto dense_rank = int64_t{0};
+
+  for (auto position = begin; position < end; ++position) {
+    const auto row_number = static_cast<int64_t>(position - begin + 1);
+    if (position == begin || !is_peer(rows[position - 1], rows[position])) {
+      rank = row_number;
+      ++dense_rank;
+    }
+
+    switch (function) {
+      case WindowFunction::RowNumber:
+        results.set(rows[position], row_number);
+        break;
+      case WindowFunction::Rank:
+        results.set(rows[position], rank);
+        break;
+      case WindowFunction::DenseRank:
+        results.set(rows[position], dense_rank);
+        break;
+      default:
+        Fail("Not a ranking window function");
+    }
+  }
+}
+
+template <typename T>
+void compute_offset(const WindowFunction function, const size_t offset, const std::vector<size_t>& rows,
+                    const size_t begin, const size_t end, const MaterializedColumn<T>& argument,
+                    WindowResults<T>& results) {
+  for (auto position = begin; position < end; ++position) {
+    const auto has_source = function == WindowFunction::Lag ? position - begin >= offset : end - position > offset;
+    if (!has_source) {
+      results.set_null(rows[position]);
+      continue;
+    }
+
+    const auto source_row = rows[function == WindowFunction::Lag ? position - offset : position + offset];
+    if (argument.null_values[source_row]) {
+      results.set_null(rows[position]);
+    } else {
+      results.set(rows[position], argument.values[source_row]);
+    }
+  }
+}
+
+// Computes the aggregate for one peer group (i.e., rows with the same ORDER BY values) after another, so that each
+// partition is scanned only once. `argument` is nullptr for COUNT(*).
+template <WindowFunction function, typename T, typename IsPeer>
+void compute_aggregate(const std::vector<size_t>& rows, const size_t begin, const size_t end, const IsPeer& is_peer,
+                       const MaterializedColumn<T>* argument,
+                       WindowResults<WindowAggregateType<function, T>>& results) {
+  using SumType = std::conditional_t<function == WindowFunction::Sum, WindowAggregateType<function, T>, double>;
+
+  auto count = int64_t{0};
+  auto sum = SumType{};
+  auto extreme = T{};
+
+  auto group_begin = begin;
+  while (group_begin < end) {
+    auto group_end = group_begin + 1;
+    while (group_end < end && is_peer(rows[group_end - 1], rows[group_end])) ++group_end;
+
+    for (auto position = group_begin; position < group_end; ++position) {
+      const auto row = rows[position];
+      if (argument && argument->null_values[row]) continue;
+
+      if constexpr (function == WindowFunction::Min || function == WindowFunction::Max) {
+        const auto& value = argument->values[row];
+        if (count == 0 || (function == WindowFunction::Min ? value < extreme : value > extreme)) extreme = value;
+      } else if constexpr (function == WindowFunction::Sum || function == WindowFunction::Avg) {
+        if constexpr (std::is_arithmetic_v<T>) {
+          sum += static_cast<SumType>(argument->values[row]);
+        } else {
+          Fail("SUM and AVG are not defined for non-numeric arguments");
+        }
+      }
+      ++count;
+    }
+
+    for (auto position = group_begin; position < group_end; ++position) {
+      const auto row = rows[position];
+      if constexpr (function == WindowFunction::Count) {
+        results.set(row, count);
+      } else if (count == 0) {
+        results.set_null(row);
+      } else if constexpr (function == WindowFunction::Min || function == WindowFunction::Max) {
+        results.set(row, extreme);
+      } else if constexpr (function == WindowFunction::Sum) {
+        results.set(row, sum);
+      } else {
+        results.set(row, sum / static_cast<double>(count));
+      }
+    }
+
+    group_begin = group_end;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+WindowFunctionEvaluator::WindowFunctionEvaluator(
+    const std::shared_ptr<const AbstractOperator>& in,
+    const std::shared_ptr<WindowFunctionExpression>& window_function_expression)
+    : AbstractReadOnlyOperator(OperatorType::WindowFunctionEvaluator, in),
+      window_function_expression(window_function_expression) {
+  for (const auto& argument : window_function_expression->arguments) {
+    Assert(argument->type == ExpressionType::PQPColumn, "Arguments of window functions have to be columns");
+  }
+}
+
+const std::string WindowFunctionEvaluator::name() const { return "WindowFunctionEvaluator"; }
+
+const std::string WindowFunctionEvaluator::description(DescriptionMode description_mode) const {
+  return name() + " " + window_function_expression->as_column_name();
+}
+
+std::shared_ptr<const Table> WindowFunctionEvaluator::_on_execute() {
+  const auto input_table = input_table_left();
+  const auto& expression = *window_function_expression;
+  const auto row_count = input_table->row_count();
+
+  auto row_ids = std::vector<RowID>{};
+  row_ids.reserve(row_count);
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto chunk_size = input_table->get_chunk(chunk_id)->size();
+    for (ChunkOffset chunk_offset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      row_ids.emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  auto partition_columns = std::vector<std::unique_ptr<BaseMaterializedColumn>>{};
+  for (const auto& partition_by_expression : expression.partition_by_expressions()) {
+    partition_columns.emplace_back(materialize_column(*input_table, column_id_of(*partition_by_expression)));
+  }
+
+  auto order_columns = std::vector<std::unique_ptr<BaseMaterializedColumn>>{};
+  for (const auto& order_by_expression : expression.order_by_expressions()) {
+    order_columns.emplace_back(materialize_column(*input_table, column_id_of(*order_by_expression)));
+  }
+
+  // Distribute the rows to buckets, so that all rows of a partition end up in the same bucket
+  auto buckets = std::vector<std::vector<size_t>>{};
+  if (partition_columns.empty()) {
+    buckets.resize(1);
+    buckets[0].resize(row_count);
+    std::iota(buckets[0].begin(), buckets[0].end(), size_t{0});
+  } else {
+    auto bucket_count = size_t{1};
+    while (bucket_count < MAX_BUCKET_COUNT && bucket_count * ROWS_PER_BUCKET < row_count) bucket_count *= 2;
+    buckets.resize(bucket_count);
+
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      auto hash = size_t{0};
+      for (const auto& partition_column : partition_columns) {
+        boost::hash_combine(hash, partition_column->hash(row));
+      }
+      buckets[hash & (bucket_count - 1)].emplace_back(row);
+    }
+  }
+
+  const auto is_same_partition = [&](const size_t lhs_row, const size_t rhs_row) {
+    return std::all_of(partition_columns.begin(), partition_columns.end(),
+                       [&](const auto& column) { return column->equals(lhs_row, rhs_row); });
+  };
+
+  const auto is_peer = [&](const size_t lhs_row, const size_t rhs_row) {
+    return std::all_of(order_columns.begin(), order_columns.end(),
+                       [&](const auto& column) { return column->equals(lhs_row, rhs_row); });
+  };
+
+  // Sorts each bucket in its own job and calls compute_partition(rows, begin, end) for each of its partitions
+  const auto for_each_partition = [&](const auto& compute_partition) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto& rows : buckets) {
+      if (rows.empty()) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        // Stable sorts from the least to the most significant column. The PARTITION BY columns only need to be
+        // grouped, which an ascending sort achieves.
+        for (auto column_index = order_columns.size(); column_index-- > 0;) {
+          order_columns[column_index]->sort(rows, expression.order_by_modes[column_index]);
+        }
+        for (auto column_index = partition_columns.size(); column_index-- > 0;) {
+          partition_columns[column_index]->sort(rows, OrderByMode::Ascending);
+        }
+
+        auto begin = size_t{0};
+        while (begin < rows.size()) {
+          auto end = begin + 1;
+          while (end < rows.size() && is_same_partition(rows[end - 1], rows[end])) ++end;
+          compute_partition(rows, begin, end);
+          begin = end;
+        }
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+  };
+
+  auto window_segments = std::vector<std::shared_ptr<BaseSegment>>{};
+  const auto nullable = expression.is_nullable();
+  const auto argument = expression.argument();
+
+  if (!argument) {
+    // Ranking functions and COUNT(*)
+    auto results = WindowResults<int64_t>{*input_table, row_ids, nullable};
+    for_each_partition([&](const auto& rows, const size_t begin, const size_t end) {
+      if (expression.window_function == WindowFunction::Count) {
+        compute_aggregate<WindowFunction::Count, int32_t>(rows, begin, end, is_peer, nullptr, results);
+      } else {
+        compute_ranking(expression.window_function, rows, begin, end, is_peer, results);
+      }
+    });
+    window_segments = results.segments();
+  } else {
+    resolve_data_type(argument->data_type(), [&](const auto data_type_t) {
+      using ArgumentDataType = typename decltype(data_type_t)::type;
+      const auto argument_column = materialize_typed_column<ArgumentDataType>(*input_table, column_id_of(*argument));
+
+      const auto evaluate_aggregate = [&](const auto function_t) {
+        constexpr auto FUNCTION = decltype(function_t)::value;
+        auto results = WindowResults<WindowAggregateType<FUNCTION, ArgumentDataType>>{*input_table, row_ids, nullable};
+        for_each_partition([&](const auto& rows, const size_t begin, const size_t end) {
+          compute_aggregate<FUNCTION>(rows, begin, end, is_peer, argument_column.get(), results);
+        });
+        window_segments = results.segments();
+      };
+
+      switch (expression.window_function) {
+        case WindowFunction::Lag:
+        case WindowFunction::Lead: {
+          auto results = WindowResults<ArgumentDataType>{*input_table, row_ids, nullable};
+          for_each_partition([&](const auto& rows, const size_t begin, const size_t end) {
+            compute_offset(expression.window_function, expression.offset, rows, begin, end, *argument_column,
+                           results);
+          });
+          window_segments = results.segments();
+        } break;
+        case WindowFunction::Min:
+          evaluate_aggregate(std::integral_constant<WindowFunction, WindowFunction::Min>{});
+          break;
+        case WindowFunction::Max:
+          evaluate_aggregate(std::integral_constant<WindowFunction, WindowFunction::Max>{});
+          break;
+        case WindowFunction::Sum:
+        case WindowFunction::Avg:
+          Assert((std::is_arithmetic_v<ArgumentDataType>), "SUM and AVG are not defined for non-numeric arguments");
+          if (expression.window_function == WindowFunction::Sum) {
+            evaluate_aggregate(std::integral_constant<WindowFunction, WindowFunction::Sum>{});
+          } else {
+            evaluate_aggregate(std::integral_constant<WindowFunction, WindowFunction::Avg>{});
+          }
+          break;
+        case WindowFunction::Count:
+          evaluate_aggregate(std::integral_constant<WindowFunction, WindowFunction::Count>{});
+          break;
+        default:
+          Fail("Window function requires no argument");
+      }
+    });
+  }
+
+  // The results are stored in a table of their own, which the output references in the order of the input rows
+  const auto window_column_definition =
+      TableColumnDefinition{expression.as_column_name(), expression.data_type(), nullable};
+  const auto window_table =
+      std::make_shared<Table>(TableColumnDefinitions{window_column_definition}, TableType::Data);
+  for (const auto& window_segment : window_segments) {
+    window_table->append_chunk({window_segment});
+  }
+
+  auto output_column_definitions = input_table->column_definitions();
+  output_column_definitions.emplace_back(window_column_definition);
+  const auto output_table = std::make_shared<Table>(output_column_definitions, TableType::References);
+
+  for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    const auto input_chunk = input_table->get_chunk(chunk_id);
+
+    const auto pos_list = std::make_shared<PosList>(input_chunk->size());
+    for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk->size(); ++chunk_offset) {
+      (*pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+    }
+
+    auto output_segments = Segments{};
+    for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+      if (input_table->type() == TableType::References) {
+        output_segments.emplace_back(input_chunk->get_segment(column_id));
+      } else {
+        output_segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+      }
+    }
+    output_segments.emplace_back(std::make_shared<ReferenceSegment>(window_table, ColumnID{0}, pos_list));
+
+    output_table->append_chunk(output_segments);
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> WindowFunctionEvaluator::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<WindowFunctionEvaluator>(
+      copied_input_left,
+      std::static_pointer_cast<WindowFunctionExpression>(window_function_expression->deep_copy()));
+}
+
+void WindowFunctionEvaluator::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/window_function_expression.hpp"
+
+namespace opossum {
+
+/**
+ * Operator to compute a window function (see WindowFunctionExpression) for each row of its input. The arguments of
+ * the window function have to be PQPColumnExpressions. The output has the input columns (as ReferenceSegments), in
+ * the order of the input rows, followed by a column with the results of the window function.
+ *
+ * Rows are distributed to buckets by the hash of their PARTITION BY values, so that each partition lies in a single
+ * bucket. The buckets are processed in parallel: The rows of each bucket are sorted by the PARTITION BY values and
+ * then by the ORDER BY values, so that partitions become consecutive ranges of rows. Each partition is then scanned
+ * once, i.e., the frames of the aggregate functions are computed incrementally, one group of rows with the same
+ * ORDER BY values after another. Without PARTITION BY, there is only one bucket.
+ */
+class WindowFunctionEvaluator : public AbstractReadOnlyOperator {
+ public:
+  WindowFunctionEvaluator(const std::shared_ptr<const AbstractOperator>& in,
+                          const std::shared_ptr<WindowFunctionExpression>& window_function_expression);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  const std::shared_ptr<WindowFunctionExpression> window_function_expression;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+};
+
+}  // namespace opossum
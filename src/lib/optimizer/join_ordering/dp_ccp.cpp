@@ -11,18 +11,38 @@
 
 namespace opossum {
 
-DpCcp::DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
-    : AbstractJoinOrderingAlgorithm(cost_estimator) {}
+DpCcp::DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+             const std::optional<size_t>& max_csg_cmp_pair_count)
+    : AbstractJoinOrderingAlgorithm(cost_estimator), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {}
 
 std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph) {
   Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
 
+  /**
+   * 1. Enumerate the CsgCmpPairs, i.e., the candidate joins, first. If there are too many of them, DpCcp gives up
+   *    before doing any work. For this, transform the JoinGraph's vertex-to-vertex edges into index pairs
+   */
+  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
+  for (const auto& edge : join_graph.edges) {
+    // EnumerateCcp only deals with binary join predicates
+    if (edge.vertex_set.count() != 2) continue;
+
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
+
+    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
+  }
+
+  auto enumerate_ccp = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges, _max_csg_cmp_pair_count};
+  const auto csg_cmp_pairs = enumerate_ccp();
+  if (enumerate_ccp.budget_exceeded()) return nullptr;
+
   // No std::unordered_map, since hashing of JoinGraphVertexSet is not (efficiently) possible because
   // boost::dynamic_bitset hides the data necessary for doing so efficiently.
   auto best_plan = std::map<JoinGraphVertexSet, std::shared_ptr<AbstractLQPNode>>{};
 
   /**
-   * 1. Initialize best_plan[] with the vertices
+   * 2. Initialize best_plan[] with the vertices
    */
   for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
     auto single_vertex_set = JoinGraphVertexSet{join_graph.vertices.size()};
@@ -32,8 +52,8 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 2. Place Uncorrelated Predicates (think "6 > 4": not referencing any vertex)
-   * 2.1 Collect uncorrelated predicates
+   * 3. Place Uncorrelated Predicates (think "6 > 4": not referencing any vertex)
+   * 3.1 Collect uncorrelated predicates
    */
   std::vector<std::shared_ptr<AbstractExpression>> uncorrelated_predicates;
   for (const auto& edge : join_graph.edges) {
@@ -42,7 +62,7 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 2.2 Find the largest vertex and place the uncorrelated predicates for optimal execution.
+   * 3.2 Find the largest vertex and place the uncorrelated predicates for optimal execution.
    *     Reasoning: Uncorrelated predicates are either False or True for *all* rows. If an uncorrelated
    *                predicate is False and we place it on top of the largest vertex we avoid processing the vertex'
    *                many rows in later joins.
@@ -71,7 +91,7 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 3. Add local predicates on top of the vertices
+   * 4. Add local predicates on top of the vertices
    */
   for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
     const auto vertex_predicates = join_graph.find_local_predicates(vertex_idx);
@@ -83,24 +103,9 @@ std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph)
   }
 
   /**
-   * 4. Prepare EnumerateCcp: Transform the JoinGraph's vertex-to-vertex edges into index pairs
-   */
-  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
-  for (const auto& edge : join_graph.edges) {
-    // EnumerateCcp only deals with binary join predicates
-    if (edge.vertex_set.count() != 2) continue;
-
-    const auto first_vertex_idx = edge.vertex_set.find_first();
-    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
-
-    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
-  }
-
-  /**
-   * 5. Actual DpCcp algorithm: Enumerate the CsgCmpPairs; build candidate plans; update best_plan if the candidate plan
-   *                            is cheaper than the cheapest currently known plan for a particular subset of vertices.
+   * 5. Actual DpCcp algorithm: Build candidate plans for the CsgCmpPairs; update best_plan if the candidate plan is
+   *                            cheaper than the cheapest currently known plan for a particular subset of vertices.
    */
-  const auto csg_cmp_pairs = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges}();  // NOLINT
   for (const auto& csg_cmp_pair : csg_cmp_pairs) {
     const auto best_plan_left_iter = best_plan.find(csg_cmp_pair.first);
     const auto best_plan_right_iter = best_plan.find(csg_cmp_pair.second);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "abstract_join_ordering_algorithm.hpp"
 
 namespace opossum {
@@ -17,7 +19,12 @@ namespace opossum {
  */
 class DpCcp final : public AbstractJoinOrderingAlgorithm {
  public:
-  explicit DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+  /**
+   * @param max_csg_cmp_pair_count  Optimization budget, i.e., the maximum number of candidate joins to cost, see
+   *                                EnumerateCcp. Unlimited if std::nullopt.
+   */
+  explicit DpCcp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                 const std::optional<size_t>& max_csg_cmp_pair_count = std::nullopt);
 
   /**
    * @param join_graph      A JoinGraph for a part of an LQP with further subplans as vertices. DpCcp is only applied
@@ -25,8 +32,12 @@ class DpCcp final : public AbstractJoinOrderingAlgorithm {
    * @return                An LQP consisting of
    *                         * the operations from the JoinGraph in an optimal order
    *                         * the subplans from the vertices below them
+   *                        or nullptr if the JoinGraph has more candidate joins than the budget allows.
    */
   std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph);
+
+ private:
+  const std::optional<size_t> _max_csg_cmp_pair_count;
 };
 
 }  // namespace opossum
@@ -17,8 +17,9 @@
 
 namespace opossum {
 
-EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges)
-    : _num_vertices(num_vertices), _edges(std::move(edges)) {
+EnumerateCcp::EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+                           const std::optional<size_t>& max_csg_cmp_pair_count)
+    : _num_vertices(num_vertices), _edges(std::move(edges)), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {
   // DPccp should not be used for queries with a table count on the scale of 64 because of complexity reasons
   Assert(num_vertices < sizeof(unsigned long) * 8, "Too many vertices, EnumerateCcp relies on to_ulong()");  // NOLINT
 
@@ -47,7 +48,7 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
    * each vertex (_enumerate_csg_recursive()).
    * For each subgraph, a search for complement subgraphs is started (_enumerate_cmp()).
    */
-  for (size_t reverse_vertex_idx = 0; reverse_vertex_idx < _num_vertices; ++reverse_vertex_idx) {
+  for (size_t reverse_vertex_idx = 0; reverse_vertex_idx < _num_vertices && !_budget_exceeded; ++reverse_vertex_idx) {
     const auto forward_vertex_idx = _num_vertices - reverse_vertex_idx - 1;
 
     auto start_vertex_set = JoinGraphVertexSet(_num_vertices);
@@ -57,10 +58,14 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
     std::vector<JoinGraphVertexSet> csgs;
     _enumerate_csg_recursive(csgs, start_vertex_set, _exclusion_set(forward_vertex_idx));
     for (const auto& csg : csgs) {
+      if (_budget_exceeded) break;
       _enumerate_cmp(csg);
     }
   }
 
+  if (_max_csg_cmp_pair_count && _csg_cmp_pairs.size() > *_max_csg_cmp_pair_count) _budget_exceeded = true;
+  if (_budget_exceeded) return _csg_cmp_pairs;
+
 #if HYRISE_DEBUG
   // Assert that the algorithm didn't create duplicates and that all created ccps contain only previously enumerated
   // subsets, i.e., that the enumeration order is correct
@@ -87,6 +92,8 @@ std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> EnumerateCcp::ope
   return _csg_cmp_pairs;
 }
 
+bool EnumerateCcp::budget_exceeded() const { return _budget_exceeded; }
+
 void EnumerateCcp::_enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
                                             const JoinGraphVertexSet& exclusion_set) {
   /**
@@ -102,7 +109,11 @@ void EnumerateCcp::_enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csg
     csgs.emplace_back(subset | vertex_set);
   }
 
+  // Each connected subgraph is part of at least one CsgCmpPair, unless it spans the entire graph
+  if (_max_csg_cmp_pair_count && csgs.size() > *_max_csg_cmp_pair_count) _budget_exceeded = true;
+
   for (const auto& subset : neighborhood_subsets) {
+    if (_budget_exceeded) return;
     _enumerate_csg_recursive(csgs, subset | vertex_set, extended_exclusion_set);
   }
 }
@@ -125,6 +136,9 @@ void EnumerateCcp::_enumerate_cmp(const JoinGraphVertexSet& primary_vertex_set)
   } while ((current_vertex_idx = neighborhood.find_next(current_vertex_idx)) != JoinGraphVertexSet::npos);
 
   for (auto iter = reverse_vertex_indices.rbegin(); iter != reverse_vertex_indices.rend(); ++iter) {
+    if (_max_csg_cmp_pair_count && _csg_cmp_pairs.size() > *_max_csg_cmp_pair_count) _budget_exceeded = true;
+    if (_budget_exceeded) return;
+
     auto cmp_vertex_set = JoinGraphVertexSet(_num_vertices);
     cmp_vertex_set.set(*iter);
 
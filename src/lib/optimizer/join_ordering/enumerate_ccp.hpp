@@ -54,11 +54,20 @@ using CsgCmpPair = std::pair<JoinGraphVertexSet, JoinGraphVertexSet>;
  */
 class EnumerateCcp final {
  public:
-  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges);
-
-  // Corresponds to EnumerateCsg in the paper
+  /**
+   * @param max_csg_cmp_pair_count   Budget for the enumeration: the number of CsgCmpPairs grows exponentially with the
+   *                                 number of vertices for densely connected graphs. If more than this number of
+   *                                 CsgCmpPairs (or connected subgraphs) are found, the enumeration stops early and
+   *                                 budget_exceeded() returns true.
+   */
+  EnumerateCcp(const size_t num_vertices, std::vector<std::pair<size_t, size_t>> edges,
+               const std::optional<size_t>& max_csg_cmp_pair_count = std::nullopt);
+
+  // Corresponds to EnumerateCsg in the paper. The result is incomplete if budget_exceeded() is true afterwards.
   std::vector<CsgCmpPair> operator()();
 
+  bool budget_exceeded() const;
+
  private:
   // Corresponds to EnumerateCsgRec in the paper
   void _enumerate_csg_recursive(std::vector<JoinGraphVertexSet>& csgs, const JoinGraphVertexSet& vertex_set,
@@ -80,6 +89,9 @@ class EnumerateCcp final {
 
   const size_t _num_vertices;
   const std::vector<std::pair<size_t, size_t>> _edges;
+  const std::optional<size_t> _max_csg_cmp_pair_count;
+
+  bool _budget_exceeded{false};
 
   std::vector<std::pair<JoinGraphVertexSet, JoinGraphVertexSet>> _csg_cmp_pairs;
 
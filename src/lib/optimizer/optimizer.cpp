@@ -3,7 +3,7 @@
 #include <memory>
 #include <unordered_set>
 
-#include "cost_model/cost_model_logical.hpp"
+#include "cost_model/cost_model_physical.hpp"
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_select_expression.hpp"
 #include "logical_query_plan/logical_plan_root_node.hpp"
@@ -11,13 +11,20 @@
 #include "optimizer/strategy/predicate_placement_rule.hpp"
 #include "strategy/chunk_pruning_rule.hpp"
 #include "strategy/column_pruning_rule.hpp"
+#include "strategy/common_subexpression_elimination_rule.hpp"
 #include "strategy/constant_calculation_rule.hpp"
+#include "strategy/eager_aggregation_rule.hpp"
 #include "strategy/exists_reformulation_rule.hpp"
+#include "strategy/group_by_reduction_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
 #include "strategy/join_detection_rule.hpp"
+#include "strategy/join_elimination_rule.hpp"
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/logical_reduction_rule.hpp"
+#include "strategy/materialized_view_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
+#include "strategy/sort_elimination_rule.hpp"
+#include "strategy/subselect_decorrelation_rule.hpp"
 #include "utils/performance_warning.hpp"
 
 /**
@@ -85,18 +92,29 @@ namespace opossum {
 std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   auto optimizer = std::make_shared<Optimizer>();
 
+  // Matches the plans of materialized views, so it runs before any rule rewrites the plan
+  optimizer->add_rule(std::make_shared<MaterializedViewRule>());
+
   // Run pruning just once since the rule would otherwise insert the pruning ProjectionNodes multiple times.
   optimizer->add_rule(std::make_shared<ConstantCalculationRule>());
 
   optimizer->add_rule(std::make_shared<LogicalReductionRule>());
 
+  // Decorrelate before the ColumnPruningRule, which would prune the columns that the decorrelated subselects group by
+  optimizer->add_rule(std::make_shared<SubselectDecorrelationRule>());
+
   optimizer->add_rule(std::make_shared<ColumnPruningRule>());
 
   optimizer->add_rule(std::make_shared<ExistsReformulationRule>());
 
+  // Uses the key constraints of the tables. Runs after the ExistsReformulationRule to consider the semi joins it adds.
+  optimizer->add_rule(std::make_shared<JoinEliminationRule>());
+
+  optimizer->add_rule(std::make_shared<GroupByReductionRule>());
+
   optimizer->add_rule(std::make_shared<ChunkPruningRule>());
 
-  optimizer->add_rule(std::make_shared<JoinOrderingRule>(std::make_shared<CostModelLogical>()));
+  optimizer->add_rule(std::make_shared<JoinOrderingRule>(std::make_shared<CostModelPhysical>()));
 
   // Position the predicates after the JoinOrderingRule ran. The JOR manipulates predicate placement as well, but
   // for now we want the PredicateReorderingRule to have the final say on predicate positions
@@ -105,20 +123,55 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
   // Bring predicates into the desired order once the PredicateReorderingRule has positioned them as desired
   optimizer->add_rule(std::make_shared<PredicateReorderingRule>());
 
+  // Runs on the final join order, as the benefit of a partial aggregate depends on the join it is pushed below
+  optimizer->add_rule(std::make_shared<EagerAggregationRule>(std::make_shared<CostModelPhysical>()));
+
   optimizer->add_rule(std::make_shared<IndexScanRule>());
 
+  // Index scans do not keep the order of their input, so the order of the plan is only known after the IndexScanRule
+  optimizer->add_rule(std::make_shared<SortEliminationRule>());
+
+  // Factor out shared subexpressions last, the ProjectionNodes it inserts would otherwise be pruned or moved around
+  optimizer->add_rule(std::make_shared<CommonSubexpressionEliminationRule>());
+
+  return optimizer;
+}
+
+std::shared_ptr<Optimizer> Optimizer::create_reoptimization_optimizer() {
+  auto optimizer = std::make_shared<Optimizer>();
+
+  // The other rules of the default optimizer do not depend on cardinalities and already ran on the LQP. Some of them,
+  // e.g., the ColumnPruningRule, must not run twice.
+  optimizer->add_rule(std::make_shared<JoinOrderingRule>(std::make_shared<CostModelPhysical>()));
+
+  optimizer->add_rule(std::make_shared<PredicatePlacementRule>());
+
+  optimizer->add_rule(std::make_shared<PredicateReorderingRule>());
+
   return optimizer;
 }
 
 void Optimizer::add_rule(const std::shared_ptr<AbstractRule>& rule) { _rules.emplace_back(rule); }
 
-std::shared_ptr<AbstractLQPNode> Optimizer::optimize(const std::shared_ptr<AbstractLQPNode>& input) const {
+std::shared_ptr<AbstractLQPNode> Optimizer::optimize(const std::shared_ptr<AbstractLQPNode>& input,
+                                                     std::vector<OptimizerRuleMetrics>* rule_metrics) const {
   // Add explicit root node, so the rules can freely change the tree below it without having to maintain a root node
   // to return to the Optimizer
   const auto root_node = LogicalPlanRootNode::make(input);
 
   for (const auto& rule : _rules) {
+    const auto lqp_before_rule = rule_metrics ? root_node->left_input()->deep_copy() : nullptr;
+
+    const auto started = std::chrono::high_resolution_clock::now();
+
     _apply_rule(*rule, root_node);
+
+    if (rule_metrics) {
+      const auto done = std::chrono::high_resolution_clock::now();
+      const auto changed_plan = !(*lqp_before_rule == *root_node->left_input());
+      rule_metrics->emplace_back(OptimizerRuleMetrics{
+          rule->name(), std::chrono::duration_cast<std::chrono::nanoseconds>(done - started), changed_plan});
+    }
   }
 
   // Remove LogicalPlanRootNode
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace opossum {
@@ -8,20 +11,35 @@ namespace opossum {
 class AbstractRule;
 class AbstractLQPNode;
 
+// Time spent in a rule (including the subselects it optimized) and whether it changed the LQP or one of its subselects
+struct OptimizerRuleMetrics {
+  std::string rule_name;
+  std::chrono::nanoseconds duration{};
+  bool changed_plan{false};
+};
+
 /**
  * Applies optimization rules to an LQP.
  * On each invocation of optimize(), these Batches are applied in the same order as they were added
  * to the Optimizer.
  *
  * Optimizer::create_default_optimizer() creates the Optimizer with the default rule set.
+ * Optimizer::create_reoptimization_optimizer() creates an Optimizer with only the rules that depend on cardinality
+ * estimates. It is used to re-optimize already optimized LQPs once better cardinalities are known (see
+ * ReoptimizingExecutor).
  */
 class Optimizer final {
  public:
   static std::shared_ptr<Optimizer> create_default_optimizer();
+  static std::shared_ptr<Optimizer> create_reoptimization_optimizer();
 
   void add_rule(const std::shared_ptr<AbstractRule>& rule);
 
-  std::shared_ptr<AbstractLQPNode> optimize(const std::shared_ptr<AbstractLQPNode>& input) const;
+  // If @param rule_metrics is given, the metrics of each rule are appended to it, in the order in which the rules were
+  // applied. Whether a rule changed the LQP is found by comparing the LQP to a copy taken before the rule, which is
+  // not included in the duration of the rule.
+  std::shared_ptr<AbstractLQPNode> optimize(const std::shared_ptr<AbstractLQPNode>& input,
+                                            std::vector<OptimizerRuleMetrics>* rule_metrics = nullptr) const;
 
  private:
   std::vector<std::shared_ptr<AbstractRule>> _rules;
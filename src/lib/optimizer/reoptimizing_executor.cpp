@@ -0,0 +1,115 @@
+#include "reoptimizing_executor.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/intermediate_result_node.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "operators/abstract_operator.hpp"
+#include "optimizer.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the first checkpoint (see ReoptimizingExecutor) of the LQP in post-order, i.e., one that has no checkpoint
+// below it
+std::shared_ptr<AbstractLQPNode> find_checkpoint(const std::shared_ptr<AbstractLQPNode>& node, const bool below_join) {
+  if (!node) return nullptr;
+
+  const auto is_join = node->type == LQPNodeType::Join;
+  for (const auto& input : {node->left_input(), node->right_input()}) {
+    const auto checkpoint = find_checkpoint(input, below_join || is_join);
+    if (checkpoint) return checkpoint;
+  }
+
+  if (!below_join || (!is_join && node->type != LQPNodeType::Aggregate)) return nullptr;
+
+  auto checkpoint = node;
+  if (is_join) {
+    while (checkpoint->output_count() == 1 && checkpoint->outputs()[0]->type == LQPNodeType::Predicate) {
+      checkpoint = checkpoint->outputs()[0];
+    }
+  }
+
+  return checkpoint;
+}
+
+}  // namespace
+
+namespace opossum {
+
+ReoptimizingExecutor::ReoptimizingExecutor(const float threshold, const std::shared_ptr<Optimizer>& optimizer)
+    : _threshold(threshold), _optimizer(optimizer ? optimizer : Optimizer::create_reoptimization_optimizer()) {
+  Assert(threshold >= 1.0f, "The threshold is a factor and cannot be smaller than 1");
+}
+
+std::shared_ptr<const Table> ReoptimizingExecutor::execute(
+    const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<TransactionContext>& transaction_context) {
+  _checkpoints.clear();
+
+  // Sub-plans get replaced, so work on a copy of the LQP. The root node allows for replacing the topmost node, too.
+  const auto root_node = LogicalPlanRootNode::make(lqp->deep_copy());
+
+  while (const auto checkpoint_node = find_checkpoint(root_node->left_input(), false)) {
+    const auto estimated_row_count = checkpoint_node->get_statistics()->row_count();
+
+    const auto table = _execute_lqp(checkpoint_node, transaction_context);
+    const auto actual_row_count = static_cast<float>(table->row_count());
+
+    // Unlike lqp_replace_node(), keep the sub-plan intact, as the IntermediateResultNode still references it
+    const auto intermediate_result_node = IntermediateResultNode::make(checkpoint_node, table);
+    const auto outputs = checkpoint_node->outputs();
+    const auto input_sides = checkpoint_node->get_input_sides();
+    for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+      outputs[output_idx]->set_input(input_sides[output_idx], intermediate_result_node);
+    }
+
+    // Row counts smaller than one are treated as one, so that an estimate of 0.1 rows is not reported as a factor of
+    // ten off of a single actual row
+    const auto misestimation = std::max(actual_row_count, estimated_row_count) /
+                               std::max(std::min(actual_row_count, estimated_row_count), 1.0f);
+    const auto reoptimize = misestimation > _threshold;
+    if (reoptimize) {
+      const auto remaining_lqp = root_node->left_input();
+      root_node->set_left_input(nullptr);
+      root_node->set_left_input(_optimizer->optimize(remaining_lqp));
+    }
+
+    _checkpoints.emplace_back(
+        Checkpoint{checkpoint_node->description(), estimated_row_count, table->row_count(), reoptimize});
+  }
+
+  return _execute_lqp(root_node->left_input(), transaction_context);
+}
+
+const std::vector<ReoptimizingExecutor::Checkpoint>& ReoptimizingExecutor::checkpoints() const {
+  return _checkpoints;
+}
+
+size_t ReoptimizingExecutor::reoptimization_count() const {
+  return std::count_if(_checkpoints.begin(), _checkpoints.end(),
+                       [](const auto& checkpoint) { return checkpoint.reoptimized; });
+}
+
+std::shared_ptr<const Table> ReoptimizingExecutor::_execute_lqp(
+    const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<TransactionContext>& transaction_context) const {
+  // A new LQPTranslator for every sub-plan, as it caches the operators of all LQP nodes it translated
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  if (transaction_context) pqp->set_transaction_context_recursively(transaction_context);
+
+  const auto tasks = OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes);
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  return tasks.back()->get_operator()->get_output();
+}
+
+}  // namespace opossum
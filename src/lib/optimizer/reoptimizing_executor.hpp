@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Optimizer;
+class Table;
+class TransactionContext;
+
+/**
+ * Executes an (already optimized) LQP with mid-query reoptimization: Cardinality estimates become less reliable the
+ * more joins they are based on, so that a join order chosen from estimates may be far off for larger queries. Instead
+ * of executing the entire LQP at once, the ReoptimizingExecutor
+ *  - executes the sub-plan below a checkpoint,
+ *  - replaces the sub-plan with an IntermediateResultNode holding its result, and
+ *  - if the actual row count differs from the estimated row count by more than `threshold` (as a factor, in either
+ *    direction), re-optimizes the remainder of the LQP, now with the actual row count of the sub-plan.
+ * This is repeated until no checkpoint is left. Then, the remainder of the LQP is executed.
+ *
+ * Checkpoints are pipeline breakers whose result is below another join, i.e., joins and aggregates below a join. The
+ * remainder of the LQP can only be re-ordered at joins, so there is no point in checkpoints above the topmost join.
+ * Predicates directly on top of a join are part of its checkpoint, because the LQPTranslator translates them
+ * together with the join (e.g., into a JoinHash with multiple predicates).
+ *
+ * The LQP passed to execute() is not modified, so it can come from a plan cache.
+ */
+class ReoptimizingExecutor final {
+ public:
+  constexpr static auto DEFAULT_THRESHOLD = 10.0f;
+
+  struct Checkpoint {
+    std::string description;
+    float estimated_row_count;
+    size_t actual_row_count;
+    bool reoptimized;
+  };
+
+  // If no optimizer is given, Optimizer::create_reoptimization_optimizer() is used
+  explicit ReoptimizingExecutor(const float threshold = DEFAULT_THRESHOLD,
+                                const std::shared_ptr<Optimizer>& optimizer = nullptr);
+
+  std::shared_ptr<const Table> execute(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                       const std::shared_ptr<TransactionContext>& transaction_context = nullptr);
+
+  // The checkpoints passed during the last call to execute(), in the order in which they were executed
+  const std::vector<Checkpoint>& checkpoints() const;
+  size_t reoptimization_count() const;
+
+ private:
+  std::shared_ptr<const Table> _execute_lqp(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                            const std::shared_ptr<TransactionContext>& transaction_context) const;
+
+  const float _threshold;
+  const std::shared_ptr<Optimizer> _optimizer;
+  std::vector<Checkpoint> _checkpoints;
+};
+
+}  // namespace opossum
@@ -64,6 +64,11 @@ void ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) co
   for (auto& predicate : predicate_nodes) {
     auto new_exclusions = _compute_exclude_list(statistics, predicate);
     excluded_chunk_ids.insert(new_exclusions.begin(), new_exclusions.end());
+
+    if (table->partitioning()) {
+      const auto partition_exclusions = _compute_partition_exclude_list(*table, predicate);
+      excluded_chunk_ids.insert(partition_exclusions.begin(), partition_exclusions.end());
+    }
   }
 
   // wanted side effect of usings sets: excluded_chunk_ids vector is sorted
@@ -106,4 +111,36 @@ std::set<ChunkID> ChunkPruningRule::_compute_exclude_list(
   return result;
 }
 
+std::set<ChunkID> ChunkPruningRule::_compute_partition_exclude_list(
+    const Table& table, const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto& partitioning = *table.partitioning();
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+  if (!operator_predicates) return {};
+
+  // All operator predicates have to hold for a row, so a partition is excluded if it cannot match any one of them
+  auto matching_partitions = std::vector<bool>(partitioning.partition_count(), true);
+  for (const auto& operator_predicate : *operator_predicates) {
+    if (operator_predicate.column_id != partitioning.column_id() || !is_variant(operator_predicate.value)) continue;
+    if (operator_predicate.value2 && !is_variant(*operator_predicate.value2)) continue;
+
+    const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+    std::optional<AllTypeVariant> value2;
+    if (static_cast<bool>(operator_predicate.value2)) value2 = boost::get<AllTypeVariant>(*operator_predicate.value2);
+
+    const auto predicate_matching_partitions =
+        partitioning.matching_partitions(operator_predicate.predicate_condition, value, value2);
+    for (auto partition_id = size_t{0}; partition_id < matching_partitions.size(); ++partition_id) {
+      if (!predicate_matching_partitions[partition_id]) matching_partitions[partition_id] = false;
+    }
+  }
+
+  std::set<ChunkID> result;
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto partition_id = table.get_chunk(chunk_id)->partition_id();
+    if (partition_id && !matching_partitions[*partition_id]) result.insert(chunk_id);
+  }
+  return result;
+}
+
 }  // namespace opossum
@@ -14,11 +14,15 @@ namespace opossum {
 class AbstractLQPNode;
 class ChunkStatistics;
 class PredicateNode;
+class Table;
 
 /**
  * This rule determines which chunks can be excluded from table scans based on
  * the predicates present in the LQP and stores that information in the stored
  * table nodes.
+ *
+ * Chunks are excluded if their statistics rule out matches, or if the table is partitioned and the predicates rule out
+ * the chunk's partition (see TablePartitioning).
  */
 class ChunkPruningRule : public AbstractRule {
  public:
@@ -28,6 +32,9 @@ class ChunkPruningRule : public AbstractRule {
  protected:
   std::set<ChunkID> _compute_exclude_list(const std::vector<std::shared_ptr<ChunkStatistics>>& statistics,
                                           const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  std::set<ChunkID> _compute_partition_exclude_list(const Table& table,
+                                                    const std::shared_ptr<PredicateNode>& predicate_node) const;
 };
 
 }  // namespace opossum
@@ -0,0 +1,104 @@
+#include "common_subexpression_elimination_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Expressions that are computed row by row and thus worth sharing. Columns and values are not, subselects are left
+// where they are.
+bool is_shareable(const AbstractExpression& expression) {
+  switch (expression.type) {
+    case ExpressionType::Arithmetic:
+    case ExpressionType::Case:
+    case ExpressionType::Cast:
+    case ExpressionType::Extract:
+    case ExpressionType::Function:
+    case ExpressionType::Logical:
+    case ExpressionType::Predicate:
+    case ExpressionType::UnaryMinus:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string CommonSubexpressionEliminationRule::name() const { return "Common Subexpression Elimination Rule"; }
+
+void CommonSubexpressionEliminationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  // The inputs are processed first, so that the ProjectionNodes inserted by this rule are not processed again
+  _apply_to_inputs(node);
+
+  if (node->type == LQPNodeType::Projection) {
+    _factor_out_shared_subexpressions(node);
+  }
+}
+
+void CommonSubexpressionEliminationRule::_factor_out_shared_subexpressions(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_node = node->left_input();
+
+  // Count how often each subexpression occurs. Subexpressions that the input already computes are not counted.
+  auto occurrence_counts = ExpressionUnorderedMap<size_t>{};
+  for (const auto& expression : node->node_expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (input_node->find_column_id(*sub_expression)) return ExpressionVisitation::DoNotVisitArguments;
+      if (is_shareable(*sub_expression)) ++occurrence_counts[sub_expression];
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  // Shared subexpressions within a shared subexpression are computed with it and not factored out on their own
+  auto shared_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto shared_expression_set = ExpressionUnorderedSet{};
+  for (const auto& expression : node->node_expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      const auto occurrence_count_iter = occurrence_counts.find(sub_expression);
+      if (occurrence_count_iter == occurrence_counts.end() || occurrence_count_iter->second < 2) {
+        return ExpressionVisitation::VisitArguments;
+      }
+
+      if (shared_expression_set.emplace(sub_expression).second) shared_expressions.emplace_back(sub_expression);
+      return ExpressionVisitation::DoNotVisitArguments;
+    });
+  }
+
+  if (shared_expressions.empty()) return;
+
+  // Collect the columns of the input that are used outside of the shared subexpressions
+  auto required_input_expressions = ExpressionUnorderedSet{};
+  for (const auto& expression : node->node_expressions) {
+    visit_expression(expression, [&](const auto& sub_expression) {
+      if (shared_expression_set.count(sub_expression)) return ExpressionVisitation::DoNotVisitArguments;
+      if (input_node->find_column_id(*sub_expression)) {
+        required_input_expressions.emplace(sub_expression);
+        return ExpressionVisitation::DoNotVisitArguments;
+      }
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  auto lower_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& input_expression : input_node->column_expressions()) {
+    if (required_input_expressions.count(input_expression)) lower_expressions.emplace_back(input_expression);
+  }
+  lower_expressions.insert(lower_expressions.end(), shared_expressions.begin(), shared_expressions.end());
+
+  lqp_insert_node(node, LQPInputSide::Left, ProjectionNode::make(lower_expressions));
+}
+
+}  // namespace opossum
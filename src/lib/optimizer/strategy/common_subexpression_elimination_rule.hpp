@@ -0,0 +1,33 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Factors subexpressions that occur more than once in the expressions of a ProjectionNode into a ProjectionNode
+ * below it, so that they are computed only once per row. The upper ProjectionNode then refers to them as columns of
+ * its input, as it does for any other expression its input already computes.
+ *
+ * EXAMPLE: TPC-H query 1.
+ *   `l_extendedprice * (1 - l_discount)` is an argument of `SUM(l_extendedprice * (1 - l_discount))` and part of the
+ *   argument of `SUM(l_extendedprice * (1 - l_discount) * (1 + l_tax))`.
+ *
+ * The lower ProjectionNode only forwards those columns of its input that the upper one still needs, so that the
+ * Projection does not copy the other columns of a reference input.
+ */
+class CommonSubexpressionEliminationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  void _factor_out_shared_subexpressions(const std::shared_ptr<AbstractLQPNode>& node) const;
+};
+
+}  // namespace opossum
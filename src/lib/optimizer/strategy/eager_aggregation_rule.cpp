@@ -0,0 +1,169 @@
+#include "eager_aggregation_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "cost_model/abstract_cost_estimator.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the aggregate that combines the partial aggregates computed by @param aggregate_expression, or nullptr if the
+// aggregate cannot be split
+std::shared_ptr<AbstractExpression> combining_aggregate(const AggregateExpression& aggregate_expression,
+                                                        const std::shared_ptr<AbstractExpression>& partial_aggregate) {
+  switch (aggregate_expression.aggregate_function) {
+    case AggregateFunction::Sum:
+    case AggregateFunction::Count:
+      return sum_(partial_aggregate);
+    case AggregateFunction::Min:
+      return min_(partial_aggregate);
+    case AggregateFunction::Max:
+      return max_(partial_aggregate);
+    case AggregateFunction::Avg:
+    case AggregateFunction::CountDistinct:
+    case AggregateFunction::ApproxCountDistinct:
+      return nullptr;
+  }
+  return nullptr;
+}
+
+void add_unique_expression(std::vector<std::shared_ptr<AbstractExpression>>& expressions,
+                           const std::shared_ptr<AbstractExpression>& expression) {
+  const auto iter = std::find_if(expressions.cbegin(), expressions.cend(),
+                                 [&](const auto& other_expression) { return *other_expression == *expression; });
+  if (iter == expressions.cend()) expressions.emplace_back(expression);
+}
+
+}  // namespace
+
+namespace opossum {
+
+EagerAggregationRule::EagerAggregationRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
+    : _cost_estimator(cost_estimator) {}
+
+std::string EagerAggregationRule::name() const { return "Eager Aggregation Rule"; }
+
+void EagerAggregationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
+  const auto replacement_node = aggregate_node ? _push_down_partial_aggregate(aggregate_node) : nullptr;
+
+  _apply_to_inputs(replacement_node ? replacement_node : node);
+}
+
+std::shared_ptr<AbstractLQPNode> EagerAggregationRule::_push_down_partial_aggregate(
+    const std::shared_ptr<AggregateNode>& aggregate_node) const {
+  // Skip ProjectionNodes that only prune columns, the rewritten plan does not need them
+  auto join_candidate = aggregate_node->left_input();
+  while (join_candidate->type == LQPNodeType::Projection && join_candidate->output_count() == 1 &&
+         std::all_of(join_candidate->node_expressions.cbegin(), join_candidate->node_expressions.cend(),
+                     [](const auto& expression) { return expression->type == ExpressionType::LQPColumn; })) {
+    join_candidate = join_candidate->left_input();
+  }
+
+  const auto join_node = std::dynamic_pointer_cast<JoinNode>(join_candidate);
+  if (!join_node || join_node->join_mode != JoinMode::Inner || join_node->output_count() != 1) return nullptr;
+
+  const auto join_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicate());
+  if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return nullptr;
+
+  const auto& left_input = join_node->left_input();
+  const auto& right_input = join_node->right_input();
+
+  const auto group_by_expressions =
+      std::vector<std::shared_ptr<AbstractExpression>>(aggregate_node->node_expressions.cbegin(),
+                                                       aggregate_node->node_expressions.cbegin() +
+                                                           aggregate_node->aggregate_expressions_begin_idx);
+  const auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>(
+      aggregate_node->node_expressions.cbegin() + aggregate_node->aggregate_expressions_begin_idx,
+      aggregate_node->node_expressions.cend());
+  if (aggregate_expressions.empty()) return nullptr;
+
+  // The arguments of all aggregates have to come from the same side, which is then aggregated partially. For COUNT(*)
+  // only, the larger side is aggregated.
+  auto aggregate_left = std::optional<bool>{};
+  for (const auto& expression : aggregate_expressions) {
+    const auto argument = std::static_pointer_cast<AggregateExpression>(expression)->argument();
+    if (!argument) continue;
+
+    const auto argument_side_is_left = expression_evaluable_on_lqp(argument, *left_input);
+    if (!argument_side_is_left && !expression_evaluable_on_lqp(argument, *right_input)) return nullptr;
+    if (aggregate_left && *aggregate_left != argument_side_is_left) return nullptr;
+    aggregate_left = argument_side_is_left;
+  }
+  if (!aggregate_left) {
+    aggregate_left = left_input->get_statistics()->row_count() >= right_input->get_statistics()->row_count();
+  }
+
+  const auto& aggregated_input = *aggregate_left ? left_input : right_input;
+  const auto& other_input = *aggregate_left ? right_input : left_input;
+
+  // Group the partial aggregate by the join column and the group by columns of its side
+  auto partial_group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  const auto& join_column = expression_evaluable_on_lqp(join_predicate->left_operand(), *aggregated_input)
+                                ? join_predicate->left_operand()
+                                : join_predicate->right_operand();
+  if (!expression_evaluable_on_lqp(join_column, *aggregated_input)) return nullptr;
+  add_unique_expression(partial_group_by_expressions, join_column);
+
+  for (const auto& expression : group_by_expressions) {
+    if (expression_evaluable_on_lqp(expression, *aggregated_input)) {
+      add_unique_expression(partial_group_by_expressions, expression);
+    } else if (!expression_evaluable_on_lqp(expression, *other_input)) {
+      return nullptr;
+    }
+  }
+
+  auto combining_aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& expression : aggregate_expressions) {
+    const auto combining_aggregate_expression =
+        combining_aggregate(static_cast<const AggregateExpression&>(*expression), expression);
+    if (!combining_aggregate_expression) return nullptr;
+    combining_aggregate_expressions.emplace_back(combining_aggregate_expression);
+  }
+
+  // Build the rewritten plan next to the original one to compare their costs
+  const auto partial_aggregate_node =
+      AggregateNode::make(partial_group_by_expressions, aggregate_expressions, aggregated_input);
+  const auto rewritten_join_node =
+      *aggregate_left ? JoinNode::make(JoinMode::Inner, join_predicate, partial_aggregate_node, other_input)
+                      : JoinNode::make(JoinMode::Inner, join_predicate, other_input, partial_aggregate_node);
+  const auto combining_aggregate_node =
+      AggregateNode::make(group_by_expressions, combining_aggregate_expressions, rewritten_join_node);
+
+  if (_cost_estimator->estimate_plan_cost(combining_aggregate_node) >=
+      _cost_estimator->estimate_plan_cost(aggregate_node)) {
+    rewritten_join_node->set_left_input(nullptr);
+    rewritten_join_node->set_right_input(nullptr);
+    partial_aggregate_node->set_left_input(nullptr);
+    return nullptr;
+  }
+
+  const auto outputs = aggregate_node->outputs();
+  const auto input_sides = aggregate_node->get_input_sides();
+  for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+    outputs[output_idx]->set_input(input_sides[output_idx], combining_aggregate_node);
+  }
+  lqp_replace_expressions_in_outputs(combining_aggregate_node, aggregate_expressions, combining_aggregate_expressions);
+
+  join_node->set_left_input(nullptr);
+  join_node->set_right_input(nullptr);
+  aggregate_node->set_left_input(nullptr);
+
+  return combining_aggregate_node;
+}
+
+}  // namespace opossum
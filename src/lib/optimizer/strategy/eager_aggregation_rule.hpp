@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractCostEstimator;
+class AggregateNode;
+
+/**
+ * Pushes a partial aggregation below the inner equi-join that is the input of an AggregateNode (eager aggregation), if
+ * the cost estimator considers this cheaper. E.g., for
+ *
+ *   SELECT d.category, SUM(f.amount) FROM f JOIN d ON f.d_id = d.id GROUP BY d.category
+ *
+ * the rows of f are first aggregated per f.d_id, so that the join only processes one row per group:
+ *
+ *   [Aggregate] GROUP BY d.category: SUM(SUM(f.amount))
+ *       [Join] f.d_id = d.id
+ *           [Aggregate] GROUP BY f.d_id: SUM(f.amount)
+ *               f
+ *           d
+ *
+ * The partial aggregate groups by the join column of its side and the group by columns from that side. All aggregate
+ * arguments have to come from that side. Only SUM, MIN, MAX and COUNT can be split into partial aggregates. The
+ * expressions of the nodes above the AggregateNode are adapted to the combined aggregates (e.g., COUNT(x) becomes
+ * SUM(COUNT(x))). Between the AggregateNode and the JoinNode, there may be ProjectionNodes that only prune columns.
+ */
+class EagerAggregationRule : public AbstractRule {
+ public:
+  explicit EagerAggregationRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  std::string name() const override;
+
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+ private:
+  // Returns the AggregateNode that replaced @param aggregate_node, or nullptr if it was not replaced
+  std::shared_ptr<AbstractLQPNode> _push_down_partial_aggregate(
+      const std::shared_ptr<AggregateNode>& aggregate_node) const;
+
+  std::shared_ptr<AbstractCostEstimator> _cost_estimator;
+};
+
+}  // namespace opossum
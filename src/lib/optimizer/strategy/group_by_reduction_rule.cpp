@@ -0,0 +1,65 @@
+#include "group_by_reduction_rule.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+std::string GroupByReductionRule::name() const { return "Group By Reduction Rule"; }
+
+void GroupByReductionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
+  if (!aggregate_node || aggregate_node->aggregate_expressions_begin_idx == 0) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  const auto& node_expressions = aggregate_node->node_expressions;
+  const auto group_by_expressions = std::vector<std::shared_ptr<AbstractExpression>>(
+      node_expressions.cbegin(), node_expressions.cbegin() + aggregate_node->aggregate_expressions_begin_idx);
+  if (!lqp_expressions_are_unique(aggregate_node->left_input(), group_by_expressions)) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // The value of each aggregate for a group of a single row
+  auto aggregate_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto single_row_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (auto expression_idx = aggregate_node->aggregate_expressions_begin_idx; expression_idx < node_expressions.size();
+       ++expression_idx) {
+    const auto& aggregate_expression = static_cast<const AggregateExpression&>(*node_expressions[expression_idx]);
+    const auto argument = aggregate_expression.argument();
+
+    if (aggregate_expression.aggregate_function == AggregateFunction::Min ||
+        aggregate_expression.aggregate_function == AggregateFunction::Max) {
+      single_row_expressions.emplace_back(argument);
+    } else if (aggregate_expression.aggregate_function == AggregateFunction::Count && !argument) {
+      single_row_expressions.emplace_back(value_(int64_t{1}));
+    } else {
+      _apply_to_inputs(node);
+      return;
+    }
+    aggregate_expressions.emplace_back(node_expressions[expression_idx]);
+  }
+
+  auto projection_expressions = group_by_expressions;
+  projection_expressions.insert(projection_expressions.end(), single_row_expressions.cbegin(),
+                                single_row_expressions.cend());
+
+  const auto projection_node = ProjectionNode::make(projection_expressions);
+  lqp_replace_node(aggregate_node, projection_node);
+  lqp_replace_expressions_in_outputs(projection_node, aggregate_expressions, single_row_expressions);
+
+  _apply_to_inputs(projection_node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Replaces an AggregateNode with a ProjectionNode if its GROUP BY expressions are unique in its input (see
+ * lqp_expressions_are_unique()), e.g., because they contain the primary key of the grouped table. Each group then
+ * consists of a single row, so MIN(x) and MAX(x) become x and COUNT(*) becomes 1. Other aggregates keep the
+ * AggregateNode in place.
+ */
+class GroupByReductionRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
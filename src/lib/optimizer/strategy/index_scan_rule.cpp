@@ -8,11 +8,14 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
+#include "expression/abstract_predicate_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -45,6 +48,13 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
           predicate_node->scan_type = ScanType::IndexScan;
         }
       }
+
+      // Table indexes also cover the mutable chunks at the end of the table, which have no chunk indexes
+      for (const auto& table_index : table->table_indexes()) {
+        if (_is_table_index_scan_applicable(*table_index, predicate_node)) {
+          predicate_node->scan_type = ScanType::IndexScan;
+        }
+      }
     }
   }
 
@@ -55,8 +65,25 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_info)) return false;
 
-  if (index_info.type != SegmentIndexType::GroupKey) return false;
+  if (index_info.type != SegmentIndexType::GroupKey && index_info.type != SegmentIndexType::Hash) return false;
+
+  // HashIndexes only answer equality lookups
+  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate());
+  if (!predicate || !BaseIndex::supports(index_info.type, predicate->predicate_condition)) return false;
 
+  return _is_index_scan_applicable(index_info.column_ids[0], predicate_node);
+}
+
+bool IndexScanRule::_is_table_index_scan_applicable(const BaseTableIndex& table_index,
+                                                    const std::shared_ptr<PredicateNode>& predicate_node) const {
+  const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(predicate_node->predicate());
+  if (!predicate || !BaseTableIndex::supports(predicate->predicate_condition)) return false;
+
+  return _is_index_scan_applicable(table_index.column_id(), predicate_node);
+}
+
+bool IndexScanRule::_is_index_scan_applicable(const ColumnID indexed_column_id,
+                                              const std::shared_ptr<PredicateNode>& predicate_node) const {
   const auto operator_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
   if (!operator_predicates) return false;
@@ -67,7 +94,7 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
   // Currently, we do not support two-column predicates
   if (is_column_id(operator_predicate.value)) return false;
 
-  if (index_info.column_ids[0] != operator_predicate.column_id) return false;
+  if (indexed_column_id != operator_predicate.column_id) return false;
 
   const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
@@ -11,6 +11,7 @@
 namespace opossum {
 
 class AbstractLQPNode;
+class BaseTableIndex;
 class PredicateNode;
 
 /**
@@ -22,7 +23,9 @@ class PredicateNode;
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Currently, only GroupKeyIndexes, HashIndexes (for (in)equality predicates) and TableIndexes are supported. As
+ * TableIndexes are maintained by the Insert operator, they make IndexScans possible on tables that are still being
+ * appended to.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -33,6 +36,12 @@ class IndexScanRule : public AbstractRule {
  protected:
   bool _is_index_scan_applicable(const IndexInfo& index_info,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_table_index_scan_applicable(const BaseTableIndex& table_index,
+                                       const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  // Checks whether the predicate compares the indexed column to a value and is selective enough
+  bool _is_index_scan_applicable(const ColumnID indexed_column_id,
+                                 const std::shared_ptr<PredicateNode>& predicate_node) const;
   inline bool _is_single_segment_index(const IndexInfo& index_info) const;
 };
 
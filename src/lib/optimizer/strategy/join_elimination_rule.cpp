@@ -0,0 +1,182 @@
+#include "join_elimination_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the StoredTableNode below @param lqp if all of its rows reach @param lqp, i.e., if there are only
+// ValidateNodes and ProjectionNodes that prune columns in between. Rows invisible to the transaction are not
+// considered filtered, the foreign key constraint is assumed to hold for the visible rows.
+std::shared_ptr<StoredTableNode> unfiltered_stored_table_node(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto node = lqp;
+  while (node->type == LQPNodeType::Validate ||
+         (node->type == LQPNodeType::Projection &&
+          std::all_of(node->node_expressions.cbegin(), node->node_expressions.cend(),
+                      [](const auto& expression) { return expression->type == ExpressionType::LQPColumn; }))) {
+    node = node->left_input();
+  }
+
+  const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node);
+  if (!stored_table_node || !stored_table_node->excluded_chunk_ids().empty()) return nullptr;
+  return stored_table_node;
+}
+
+bool is_any_column_used_above(const std::shared_ptr<AbstractLQPNode>& node,
+                              const std::vector<std::shared_ptr<AbstractExpression>>& columns,
+                              std::unordered_set<std::shared_ptr<AbstractLQPNode>>& visited_nodes) {
+  const auto is_column = [&](const auto& expression) {
+    return std::any_of(columns.cbegin(), columns.cend(), [&](const auto& column) { return *column == *expression; });
+  };
+
+  // The root of the plan outputs all of its columns
+  if (node->output_count() == 0) {
+    const auto& column_expressions = node->column_expressions();
+    return std::any_of(column_expressions.cbegin(), column_expressions.cend(), is_column);
+  }
+
+  for (const auto& output : node->outputs()) {
+    if (!visited_nodes.emplace(output).second) continue;
+
+    // Modifying nodes work on all columns or on the rows of their input
+    if (output->type == LQPNodeType::Delete || output->type == LQPNodeType::Insert ||
+        output->type == LQPNodeType::Update) {
+      return true;
+    }
+
+    for (const auto& node_expression : output->node_expressions) {
+      auto is_used = false;
+      visit_expression(node_expression, [&](const auto& sub_expression) {
+        is_used |= is_column(sub_expression);
+        return is_used ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+      });
+      if (is_used) return true;
+    }
+
+    if (is_any_column_used_above(output, columns, visited_nodes)) return true;
+  }
+
+  return false;
+}
+
+bool references(const Table& table, const ColumnID column_id, const std::string& referenced_table_name,
+                const ColumnID referenced_column_id) {
+  const auto& foreign_key_constraints = table.get_foreign_key_constraints();
+  return std::any_of(foreign_key_constraints.cbegin(), foreign_key_constraints.cend(), [&](const auto& constraint) {
+    return constraint.columns == std::vector<ColumnID>{column_id} &&
+           constraint.referenced_table_name == referenced_table_name &&
+           constraint.referenced_columns == std::vector<ColumnID>{referenced_column_id};
+  });
+}
+
+void try_eliminate_join(const std::shared_ptr<JoinNode>& join_node) {
+  if (join_node->join_mode != JoinMode::Inner && join_node->join_mode != JoinMode::Semi) return;
+
+  const auto join_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(join_node->join_predicate());
+  if (!join_predicate || join_predicate->predicate_condition != PredicateCondition::Equals) return;
+
+  // A semi join can only be removed on its right side, which it does not output
+  const auto eliminated_sides = join_node->join_mode == JoinMode::Inner
+                                    ? std::vector<LQPInputSide>{LQPInputSide::Right, LQPInputSide::Left}
+                                    : std::vector<LQPInputSide>{LQPInputSide::Right};
+
+  for (const auto eliminated_side : eliminated_sides) {
+    const auto eliminated_input = join_node->input(eliminated_side);
+    const auto kept_input =
+        join_node->input(eliminated_side == LQPInputSide::Right ? LQPInputSide::Left : LQPInputSide::Right);
+
+    auto referencing_column = join_predicate->left_operand();
+    auto referenced_column = join_predicate->right_operand();
+    if (!expression_evaluable_on_lqp(referencing_column, *kept_input)) std::swap(referencing_column, referenced_column);
+
+    const auto referencing_column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(referencing_column);
+    const auto referenced_column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(referenced_column);
+    if (!referencing_column_expression || !referenced_column_expression ||
+        !expression_evaluable_on_lqp(referencing_column, *kept_input) ||
+        !expression_evaluable_on_lqp(referenced_column, *eliminated_input)) {
+      continue;
+    }
+
+    // Each referencing row has to find its partner on the eliminated side...
+    const auto referenced_stored_table_node = unfiltered_stored_table_node(eliminated_input);
+    if (!referenced_stored_table_node ||
+        referenced_column_expression->column_reference.original_node() != referenced_stored_table_node) {
+      continue;
+    }
+
+    const auto referencing_stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(
+        referencing_column_expression->column_reference.original_node());
+    if (!referencing_stored_table_node) continue;
+
+    const auto referencing_table = StorageManager::get().get_table(referencing_stored_table_node->table_name);
+    const auto referencing_column_id = referencing_column_expression->column_reference.original_column_id();
+    if (!references(*referencing_table, referencing_column_id, referenced_stored_table_node->table_name,
+                    referenced_column_expression->column_reference.original_column_id())) {
+      continue;
+    }
+
+    // ...and, for an inner join, nothing but that partner, whose columns have to be unused
+    if (join_node->join_mode == JoinMode::Inner) {
+      if (!lqp_expressions_are_unique(eliminated_input, {referenced_column})) continue;
+
+      auto visited_nodes = std::unordered_set<std::shared_ptr<AbstractLQPNode>>{};
+      if (is_any_column_used_above(join_node, eliminated_input->column_expressions(), visited_nodes)) continue;
+    }
+
+    // Rows with a NULL value in the foreign key column have no partner
+    auto replacement_node = kept_input;
+    if (referencing_table->column_is_nullable(referencing_column_id)) {
+      replacement_node = PredicateNode::make(is_not_null_(referencing_column), kept_input);
+    }
+
+    const auto outputs = join_node->outputs();
+    const auto input_sides = join_node->get_input_sides();
+
+    join_node->set_left_input(nullptr);
+    join_node->set_right_input(nullptr);
+
+    for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+      outputs[output_idx]->set_input(input_sides[output_idx], replacement_node);
+    }
+    return;
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string JoinEliminationRule::name() const { return "Join Elimination Rule"; }
+
+void JoinEliminationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  // Collect the joins first, as eliminating them changes the plan
+  auto join_nodes = std::vector<std::shared_ptr<JoinNode>>{};
+  visit_lqp(node, [&](const auto& sub_node) {
+    if (const auto join_node = std::dynamic_pointer_cast<JoinNode>(sub_node)) join_nodes.emplace_back(join_node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& join_node : join_nodes) {
+    try_eliminate_join(join_node);
+  }
+}
+
+}  // namespace opossum
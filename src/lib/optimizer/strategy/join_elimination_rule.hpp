@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Removes joins from a foreign key to a unique key, e.g., `f JOIN d ON f.d_id = d.id`, if none of the columns of the
+ * referenced side are used above the join. As each row of the referencing side has exactly one partner, such a join
+ * neither filters nor duplicates rows. The same holds for semi joins on the referenced side, which do not need the key
+ * to be unique. If the foreign key column is nullable, the join is replaced with an IS NOT NULL predicate.
+ *
+ * The referenced side has to be the stored table itself (possibly validated and with pruned columns), since a filter
+ * would remove partners. The rule relies on the declared constraints (see TableConstraintDefinition), which are not
+ * checked by the storage layer.
+ */
+class JoinEliminationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
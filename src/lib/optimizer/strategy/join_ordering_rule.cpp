@@ -7,10 +7,18 @@
 #include "optimizer/join_ordering/join_graph.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// EnumerateCcp represents vertex sets as unsigned longs
+constexpr auto MAX_DP_VERTEX_COUNT = sizeof(unsigned long) * 8;  // NOLINT
+
+}  // namespace
+
 namespace opossum {
 
-JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
-    : _cost_estimator(cost_estimator) {}
+JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                                   const size_t max_dp_candidate_join_count)
+    : _cost_estimator(cost_estimator), _max_dp_candidate_join_count(max_dp_candidate_join_count) {}
 
 std::string JoinOrderingRule::name() const { return "JoinOrderingRule"; }
 
@@ -50,12 +58,13 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
     return lqp;
   }
 
-  // Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
+  // Use DpCcp if the number of candidate joins it has to cost is within the budget and GOO for everything more complex.
+  // The number of candidate joins depends on the shape of the JoinGraph more than on the number of tables.
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
-  if (join_graph->vertices.size() < 9) {
-    result_lqp = DpCcp{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
-  } else {
+  if (join_graph->vertices.size() < MAX_DP_VERTEX_COUNT) {
+    result_lqp = DpCcp{_cost_estimator, _max_dp_candidate_join_count}(*join_graph);  // NOLINT - doesn't like `{}()`
+  }
+  if (!result_lqp) {
     result_lqp = GreedyOperatorOrdering{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
   }
 
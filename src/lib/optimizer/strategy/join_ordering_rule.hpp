@@ -10,14 +10,17 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
- *
- * TODO(anybody) Use a different join ordering algorithm, such as GreedyOperatorOrdering, if there are too many join
- *               operations for DPccp to handle efficiently.
+ * Currently only the order of inner joins is modified. The optimal order is determined with DpCcp within an
+ * optimization budget, i.e., as long as the JoinGraph has at most max_dp_candidate_join_count candidate joins. This
+ * holds for chains of up to ~40 tables, but only for cliques of up to 9 tables. Larger JoinGraphs are ordered with
+ * GreedyOperatorOrdering, whose runtime is polynomial in the number of tables.
  */
 class JoinOrderingRule : public AbstractRule {
  public:
-  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+  static constexpr size_t DEFAULT_MAX_DP_CANDIDATE_JOIN_COUNT = 10'000;
+
+  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                            const size_t max_dp_candidate_join_count = DEFAULT_MAX_DP_CANDIDATE_JOIN_COUNT);
 
   std::string name() const override;
 
@@ -29,6 +32,7 @@ class JoinOrderingRule : public AbstractRule {
   void _recurse_to_inputs(const std::shared_ptr<AbstractLQPNode>& lqp) const;
 
   std::shared_ptr<AbstractCostEstimator> _cost_estimator;
+  const size_t _max_dp_candidate_join_count;
 };
 
 }  // namespace opossum
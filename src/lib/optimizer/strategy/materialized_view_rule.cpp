@@ -0,0 +1,41 @@
+#include "materialized_view_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+std::string MaterializedViewRule::name() const { return "Materialized View Rule"; }
+
+void MaterializedViewRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  for (const auto& [view_name, view] : StorageManager::get().materialized_views()) {
+    if (node->type != view->lqp->type) continue;
+    if (!(*lqp_copy_without_validate_nodes(node) == *view->lqp)) continue;
+
+    view->refresh();
+
+    const auto stored_table_node = StoredTableNode::make(view_name);
+    auto replacement_node = std::shared_ptr<AbstractLQPNode>{stored_table_node};
+    if (lqp_is_validated(node)) replacement_node = ValidateNode::make(stored_table_node);
+
+    // The columns of the view are those of the replaced sub-plan, in the same order
+    const auto expressions = node->column_expressions();
+    const auto outputs = node->outputs();
+    const auto input_sides = node->get_input_sides();
+    for (auto output_idx = size_t{0}; output_idx < outputs.size(); ++output_idx) {
+      outputs[output_idx]->set_input(input_sides[output_idx], replacement_node);
+    }
+    lqp_replace_expressions_in_outputs(replacement_node, expressions, stored_table_node->column_expressions());
+    return;
+  }
+
+  _apply_to_inputs(node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Answers sub-plans that equal the LQP of a materialized view from the table of the view (see MaterializedView). The
+ * sub-plan is replaced with a StoredTableNode of the view (and a ValidateNode if the sub-plan was validated), and the
+ * expressions of the nodes above are rewritten to its columns. For example, a dashboard query that aggregates a table
+ * becomes a lookup of the aggregated rows.
+ *
+ * Plans are compared without their ValidateNodes. The view is refreshed before it is used, so the plan sees all
+ * changes committed before the optimization. Note that a cached plan reads the view as of its last refresh.
+ */
+class MaterializedViewRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
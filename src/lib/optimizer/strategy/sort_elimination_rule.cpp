@@ -0,0 +1,55 @@
+#include "sort_elimination_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/sort_node.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_order_satisfied(const SortNode& sort_node) {
+  const auto input_order = lqp_find_output_order(sort_node.left_input());
+  if (input_order.size() < sort_node.node_expressions.size()) return false;
+
+  for (auto expression_idx = size_t{0}; expression_idx < sort_node.node_expressions.size(); ++expression_idx) {
+    if (*sort_node.node_expressions[expression_idx] != *input_order[expression_idx].first ||
+        sort_node.order_by_modes[expression_idx] != input_order[expression_idx].second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool is_order_discarded(const SortNode& sort_node) {
+  const auto outputs = sort_node.outputs();
+  return !outputs.empty() && std::all_of(outputs.cbegin(), outputs.cend(), [](const auto& output) {
+    return output->type == LQPNodeType::Aggregate || output->type == LQPNodeType::Join;
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string SortEliminationRule::name() const { return "Sort Elimination Rule"; }
+
+void SortEliminationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  // The SortNodes are collected from the top, so that removing a SortNode that discards the order of the SortNodes
+  // below happens first
+  auto sort_nodes = std::vector<std::shared_ptr<SortNode>>{};
+  visit_lqp(node, [&](const auto& sub_node) {
+    if (const auto sort_node = std::dynamic_pointer_cast<SortNode>(sub_node)) sort_nodes.emplace_back(sort_node);
+    return LQPVisitation::VisitInputs;
+  });
+
+  for (const auto& sort_node : sort_nodes) {
+    if (is_order_satisfied(*sort_node) || is_order_discarded(*sort_node)) lqp_remove_node(sort_node);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Removes SortNodes that do not change the order that the plan guarantees:
+ *  - SortNodes whose input is already sorted by an order that starts with theirs (see lqp_find_output_order()),
+ *    e.g., an ORDER BY on top of a subquery that is sorted the same way
+ *  - SortNodes whose outputs are all AggregateNodes or JoinNodes, which do not keep the order of their inputs, e.g.,
+ *    an ORDER BY without LIMIT in a view that is joined
+ *
+ * Runs after the IndexScanRule, as index scans do not keep the order of their input.
+ */
+class SortEliminationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
@@ -0,0 +1,204 @@
+#include "subselect_decorrelation_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "expression/lqp_select_expression.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_comparison(const PredicateCondition predicate_condition) {
+  return predicate_condition == PredicateCondition::Equals || predicate_condition == PredicateCondition::NotEquals ||
+         predicate_condition == PredicateCondition::LessThan ||
+         predicate_condition == PredicateCondition::LessThanEquals ||
+         predicate_condition == PredicateCondition::GreaterThan ||
+         predicate_condition == PredicateCondition::GreaterThanEquals;
+}
+
+// For outer rows without a group, the subselect yields an empty aggregate. This is NULL for all aggregates but the
+// COUNTs, so that the comparison fails just like the inner join does not find a group.
+bool yields_null_for_empty_input(const std::shared_ptr<AbstractExpression>& expression) {
+  const auto aggregate_expression = std::dynamic_pointer_cast<AggregateExpression>(expression);
+  return aggregate_expression && aggregate_expression->is_nullable();
+}
+
+// Whether the expression is NULL if the aggregates below it are NULL, e.g., `0.2 * AVG(t2.b)`. Other expressions, e.g.,
+// CASE, COALESCE, or IS NULL, turn the NULL of the empty aggregate into a value, for which the comparison might hold.
+bool propagates_null(const std::shared_ptr<AbstractExpression>& expression) {
+  switch (expression->type) {
+    case ExpressionType::Aggregate:
+      return true;
+    case ExpressionType::Arithmetic:
+    case ExpressionType::Cast:
+    case ExpressionType::UnaryMinus:
+      return std::any_of(expression->arguments.cbegin(), expression->arguments.cend(), propagates_null);
+    default:
+      return false;
+  }
+}
+
+size_t count_parameter_usages(const std::shared_ptr<AbstractLQPNode>& lqp, const ParameterID parameter_id) {
+  auto usage_count = size_t{0};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        const auto parameter_expression = std::dynamic_pointer_cast<CorrelatedParameterExpression>(sub_expression);
+        if (parameter_expression && parameter_expression->parameter_id == parameter_id) ++usage_count;
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  return usage_count;
+}
+
+/**
+ * Finds the PredicateNode `inner_column = parameter` below an AggregateNode. It can be pulled up to the AggregateNode
+ * if all nodes in between filter, order, or combine rows without dropping columns and only have one output.
+ */
+std::pair<std::shared_ptr<PredicateNode>, std::shared_ptr<AbstractExpression>> find_correlated_predicate(
+    const std::shared_ptr<AbstractLQPNode>& lqp, const ParameterID parameter_id) {
+  auto correlated_predicate_node = std::shared_ptr<PredicateNode>{};
+  auto inner_column = std::shared_ptr<AbstractExpression>{};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->output_count() > 1) return LQPVisitation::DoNotVisitInputs;
+
+    if (node->type == LQPNodeType::Join) {
+      const auto join_mode = std::static_pointer_cast<JoinNode>(node)->join_mode;
+      return join_mode == JoinMode::Inner || join_mode == JoinMode::Cross ? LQPVisitation::VisitInputs
+                                                                          : LQPVisitation::DoNotVisitInputs;
+    }
+
+    if (node->type == LQPNodeType::Validate || node->type == LQPNodeType::Sort) return LQPVisitation::VisitInputs;
+    if (node->type != LQPNodeType::Predicate) return LQPVisitation::DoNotVisitInputs;
+
+    const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate());
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) return LQPVisitation::VisitInputs;
+
+    for (auto argument_idx = size_t{0}; argument_idx < 2; ++argument_idx) {
+      const auto parameter_expression =
+          std::dynamic_pointer_cast<CorrelatedParameterExpression>(predicate->arguments[argument_idx]);
+      const auto& other_argument = predicate->arguments[1 - argument_idx];
+
+      if (parameter_expression && parameter_expression->parameter_id == parameter_id &&
+          other_argument->type == ExpressionType::LQPColumn) {
+        correlated_predicate_node = predicate_node;
+        inner_column = other_argument;
+        return LQPVisitation::DoNotVisitInputs;
+      }
+    }
+
+    return LQPVisitation::VisitInputs;
+  });
+
+  return {correlated_predicate_node, inner_column};
+}
+
+// Returns the node that replaces the PredicateNode, or nullptr if its predicate cannot be decorrelated
+std::shared_ptr<AbstractLQPNode> decorrelate(const std::shared_ptr<PredicateNode>& predicate_node) {
+  const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate());
+  if (!predicate || !is_comparison(predicate->predicate_condition)) return nullptr;
+
+  const auto subselect_idx = predicate->arguments[0]->type == ExpressionType::LQPSelect ? size_t{0} : size_t{1};
+  const auto subselect = std::dynamic_pointer_cast<LQPSelectExpression>(predicate->arguments[subselect_idx]);
+  if (!subselect || subselect->parameter_count() != 1) return nullptr;
+
+  const auto& input = predicate_node->left_input();
+  const auto outer_column = subselect->parameter_expression(0);
+  const auto& other_operand = predicate->arguments[1 - subselect_idx];
+  if (outer_column->type != ExpressionType::LQPColumn || !expression_evaluable_on_lqp(outer_column, *input) ||
+      !expression_evaluable_on_lqp(other_operand, *input)) {
+    return nullptr;
+  }
+
+  // The subselect LQP might be shared with other expressions, so it is only modified once it is known to be
+  // decorrelatable, and only as a copy
+  const auto parameter_id = subselect->parameter_ids[0];
+  const auto subselect_lqp = subselect->lqp->deep_copy();
+  if (subselect_lqp->column_expressions().size() != 1) return nullptr;
+  const auto subselect_result = subselect_lqp->column_expressions()[0];
+
+  // Above the aggregate, only Projections are allowed, e.g., for `0.2 * AVG(t2.b)`
+  if (!propagates_null(subselect_result)) return nullptr;
+  auto projection_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto node = subselect_lqp;
+  while (node->type == LQPNodeType::Projection && node->output_count() <= 1) {
+    projection_nodes.emplace_back(node);
+    node = node->left_input();
+  }
+
+  const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
+  if (!aggregate_node || aggregate_node->aggregate_expressions_begin_idx != 0 || aggregate_node->output_count() > 1 ||
+      !std::all_of(aggregate_node->node_expressions.cbegin(), aggregate_node->node_expressions.cend(),
+                   yields_null_for_empty_input)) {
+    return nullptr;
+  }
+
+  if (count_parameter_usages(subselect_lqp, parameter_id) != 1) return nullptr;
+
+  const auto [correlated_predicate_node, inner_column] =
+      find_correlated_predicate(aggregate_node->left_input(), parameter_id);
+  if (!correlated_predicate_node) return nullptr;
+
+  // Pull the correlated predicate up into a join and group the aggregate by the column it compared to the parameter
+  lqp_remove_node(correlated_predicate_node);
+
+  const auto grouped_aggregate_node =
+      AggregateNode::make(expression_vector(inner_column), aggregate_node->node_expressions);
+  lqp_replace_node(aggregate_node, grouped_aggregate_node);
+
+  for (const auto& projection_node : projection_nodes) {
+    projection_node->node_expressions.emplace_back(inner_column);
+  }
+  const auto decorrelated_lqp = projection_nodes.empty() ? grouped_aggregate_node : subselect_lqp;
+
+  auto decorrelated_predicate_arguments = predicate->arguments;
+  decorrelated_predicate_arguments[subselect_idx] = subselect_result;
+  const auto decorrelated_predicate = std::make_shared<BinaryPredicateExpression>(
+      predicate->predicate_condition, decorrelated_predicate_arguments[0], decorrelated_predicate_arguments[1]);
+
+  // Remove the columns of the subselect from the output again
+  const auto projection_node = ProjectionNode::make(input->column_expressions());
+  lqp_replace_node(predicate_node, projection_node);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(outer_column, inner_column), input, decorrelated_lqp);
+  projection_node->set_left_input(PredicateNode::make(decorrelated_predicate, join_node));
+
+  return projection_node;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string SubselectDecorrelationRule::name() const { return "Subselect Decorrelation Rule"; }
+
+void SubselectDecorrelationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+  const auto decorrelated_node = predicate_node ? decorrelate(predicate_node) : nullptr;
+
+  _apply_to_inputs(decorrelated_node ? decorrelated_node : node);
+}
+
+}  // namespace opossum
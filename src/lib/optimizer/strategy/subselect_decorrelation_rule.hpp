@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+// Rewrites comparisons with correlated scalar aggregate subselects into joins with grouped aggregates, e.g.,
+//   `SELECT * FROM t1 WHERE t1.b < (SELECT 0.2 * AVG(t2.b) FROM t2 WHERE t2.a = t1.a)`
+// into the equivalent of
+//   `SELECT t1.* FROM t1 JOIN (SELECT t2.a, 0.2 * AVG(t2.b) AS x FROM t2 GROUP BY t2.a) s ON t1.a = s.a
+//    WHERE t1.b < s.x`
+// so that the subselect is evaluated once for all outer rows instead of once per outer row.
+// Does not cover - COUNT aggregates (because they yield 0 rather than NULL for outer rows without a group)
+//                - subselects that use multiple external parameters, or use one twice, or in other predicates than
+//                    `inner_column = parameter` (because our joins can only handle single predicates)
+//                - subselects with nodes other than Projections above the aggregate or other than Predicates,
+//                    Validates, Sorts, and inner and cross Joins between the aggregate and the correlated predicate
+//                    (because these would need to be changed to keep the grouping column)
+//                - IN and EXISTS (the latter is handled by the ExistsReformulationRule)
+
+class SubselectDecorrelationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
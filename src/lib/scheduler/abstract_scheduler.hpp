@@ -9,7 +9,9 @@ namespace opossum {
 
 class AbstractTask;
 class CurrentScheduler;
+struct SchedulerStatistics;
 class TaskQueue;
+class Worker;
 
 class AbstractScheduler {
   friend class CurrentScheduler;
@@ -36,8 +38,13 @@ class AbstractScheduler {
 
   virtual const std::vector<std::shared_ptr<TaskQueue>>& queues() const = 0;
 
+  virtual const std::vector<std::shared_ptr<Worker>>& workers() const = 0;
+
   virtual void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                         SchedulePriority priority = SchedulePriority::Default) = 0;
+
+  // Telemetry of the Workers and queues, e.g., to be dumped by benchmarks
+  virtual SchedulerStatistics statistics() const = 0;
 };
 
 }  // namespace opossum
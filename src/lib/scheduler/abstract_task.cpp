@@ -1,18 +1,80 @@
 #include "abstract_task.hpp"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "cancellation_token.hpp"
 #include "current_scheduler.hpp"
+#include "job_task.hpp"
+#include "scheduling_group.hpp"
 #include "task_queue.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// The SchedulingGroup of the task that is executed on this thread, if any
+thread_local std::shared_ptr<opossum::SchedulingGroup> current_scheduling_group;
+
+// Execution time of the tasks that were executed while the current task executes on this thread, e.g., while it waits
+// for the tasks it spawned. It is not charged to the group of the current task.
+thread_local std::chrono::nanoseconds nested_execution_time{0};
+
+// The task that is executed on this thread, if any
+thread_local opossum::AbstractTask* current_task = nullptr;
+
+// Makes a task the current task of the thread while it executes
+class ScopedCurrentTask {
+ public:
+  explicit ScopedCurrentTask(opossum::AbstractTask* task) : _outer_task(current_task) { current_task = task; }
+
+  ~ScopedCurrentTask() { current_task = _outer_task; }
+
+ private:
+  opossum::AbstractTask* const _outer_task;
+};
+
+// Makes the group of a task the current group of the thread while the task executes, and charges the group with the
+// execution time of the task
+class ScopedSchedulingGroup {
+ public:
+  explicit ScopedSchedulingGroup(const std::shared_ptr<opossum::SchedulingGroup>& scheduling_group)
+      : _scheduling_group(scheduling_group) {
+    if (!_scheduling_group) return;
+
+    _outer_scheduling_group = current_scheduling_group;
+    _outer_nested_execution_time = nested_execution_time;
+    current_scheduling_group = _scheduling_group;
+    nested_execution_time = std::chrono::nanoseconds{0};
+    _started = std::chrono::steady_clock::now();
+  }
+
+  ~ScopedSchedulingGroup() {
+    if (!_scheduling_group) return;
+
+    const auto execution_time =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _started);
+    _scheduling_group->add_execution_time(execution_time - nested_execution_time);
+
+    current_scheduling_group = _outer_scheduling_group;
+    nested_execution_time = _outer_nested_execution_time + execution_time;
+  }
+
+ private:
+  const std::shared_ptr<opossum::SchedulingGroup>& _scheduling_group;
+  std::shared_ptr<opossum::SchedulingGroup> _outer_scheduling_group;
+  std::chrono::nanoseconds _outer_nested_execution_time{0};
+  std::chrono::steady_clock::time_point _started;
+};
+
+}  // namespace
+
 namespace opossum {
 
 AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
@@ -25,8 +87,12 @@ bool AbstractTask::is_ready() const { return _pending_predecessors == 0; }
 
 bool AbstractTask::is_done() const { return _done; }
 
+std::exception_ptr AbstractTask::exception() const { return _exception; }
+
 bool AbstractTask::is_stealable() const { return _stealable; }
 
+SchedulePriority AbstractTask::priority() const { return _priority; }
+
 bool AbstractTask::is_scheduled() const { return _is_scheduled; }
 
 std::string AbstractTask::description() const {
@@ -49,7 +115,14 @@ const std::vector<std::shared_ptr<AbstractTask>>& AbstractTask::successors() con
 
 void AbstractTask::set_node_id(NodeID node_id) { _node_id = node_id; }
 
-bool AbstractTask::try_mark_as_enqueued() { return !_is_enqueued.exchange(true); }
+bool AbstractTask::try_mark_as_enqueued() {
+  if (_is_enqueued.exchange(true)) return false;
+
+  _enqueue_time = std::chrono::steady_clock::now();
+  return true;
+}
+
+std::chrono::steady_clock::time_point AbstractTask::enqueue_time() const { return _enqueue_time; }
 
 void AbstractTask::set_done_callback(const std::function<void()>& done_callback) {
   DebugAssert((!_is_scheduled), "Possible race: Don't set callback after the Task was scheduled");
@@ -57,7 +130,34 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
   _done_callback = done_callback;
 }
 
+void AbstractTask::set_scheduling_group(const std::shared_ptr<SchedulingGroup>& scheduling_group) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set scheduling group after the Task was scheduled");
+
+  _scheduling_group = scheduling_group;
+}
+
+const std::shared_ptr<SchedulingGroup>& AbstractTask::scheduling_group() const { return _scheduling_group; }
+
+const std::shared_ptr<SchedulingGroup>& AbstractTask::current_scheduling_group() { return ::current_scheduling_group; }
+
+void AbstractTask::set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set cancellation token after the Task was scheduled");
+
+  _cancellation_token = cancellation_token;
+}
+
+const std::shared_ptr<const CancellationToken>& AbstractTask::cancellation_token() const {
+  return _cancellation_token;
+}
+
+std::shared_ptr<const CancellationToken> AbstractTask::current_cancellation_token() {
+  return ::current_task ? ::current_task->_cancellation_token : nullptr;
+}
+
 void AbstractTask::schedule(NodeID preferred_node_id) {
+  if (!_scheduling_group) _scheduling_group = ::current_scheduling_group;
+  if (!_cancellation_token && ::current_task) _cancellation_token = ::current_task->_cancellation_token;
+
   _mark_as_scheduled();
 
   if (CurrentScheduler::is_set()) {
@@ -80,14 +180,102 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  {
+    const ScopedSchedulingGroup scoped_scheduling_group(_scheduling_group);
+    const ScopedCurrentTask scoped_current_task(this);
+    _run_and_catch_exception([&]() {
+      // The remaining tasks of a cancelled query only leave the queues
+      if (_cancellation_token) _cancellation_token->throw_if_cancelled();
+      _on_execute();
+    });
+
+    // A suspended task is finished by its continuation
+    if (_schedule_continuation()) return;
+  }
 
-  for (auto& successor : _successors) {
-    successor->_on_predecessor_done();
+  _finish();
+}
+
+AbstractTask* AbstractTask::_current_task() { return ::current_task; }
+
+void AbstractTask::_suspend_until(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                  const std::function<void()>& continuation) {
+  DebugAssert(!_continuation, "Task can only wait for one set of tasks at a time");
+
+  // The continuation keeps the task alive until it is done
+  _continuation = std::make_shared<JobTask>(
+      [this_task = shared_from_this(), continuation]() { this_task->_resume(continuation); }, _priority, _stealable);
+  _continuation->set_scheduling_group(_scheduling_group);
+  _continuation->set_cancellation_token(_cancellation_token);
+
+  for (const auto& task : tasks) {
+    task->set_as_predecessor_of(_continuation);
+  }
+  _awaited_tasks = tasks;
+}
+
+bool AbstractTask::_schedule_continuation() {
+  if (!_continuation) return false;
+
+  // Without a Scheduler, the tasks and thereby the continuation are executed right away, which might suspend the task
+  // again. Thus, the continuation is cleared first and the tasks are scheduled from a copy. The tasks stay referenced
+  // until _resume() has checked them for exceptions.
+  const auto continuation = std::move(_continuation);
+  _continuation = nullptr;
+  const auto awaited_tasks = _awaited_tasks;
+
+  // The continuation is not ready yet, so it is only marked as scheduled and executed once the tasks are done
+  continuation->schedule();
+  for (const auto& task : awaited_tasks) {
+    task->schedule();
+  }
+
+  return true;
+}
+
+void AbstractTask::_resume(const std::function<void()>& continuation) {
+  // If one of the awaited tasks failed, the continuation is skipped and the task fails with the same exception
+  const auto awaited_tasks = std::move(_awaited_tasks);
+  _awaited_tasks.clear();
+  for (const auto& task : awaited_tasks) {
+    if (task->_exception && !_exception) _exception = task->_exception;
   }
 
+  {
+    const ScopedCurrentTask scoped_current_task(this);
+    if (!_exception) {
+      _run_and_catch_exception([&]() {
+        if (_cancellation_token) _cancellation_token->throw_if_cancelled();
+        continuation();
+      });
+    }
+
+    if (_schedule_continuation()) return;
+  }
+
+  _finish();
+}
+
+void AbstractTask::_run_and_catch_exception(const std::function<void()>& function) {
+  try {
+    function();
+  } catch (...) {
+    _exception = std::current_exception();
+
+    // A failed task does not continue
+    _continuation = nullptr;
+    _awaited_tasks.clear();
+  }
+}
+
+void AbstractTask::_finish() {
+  // Called before the successors run, e.g., so that it sees the output of an OperatorTask before they clear it
   if (_done_callback) _done_callback();
 
+  for (auto& successor : _successors) {
+    successor->_on_predecessor_done();
+  }
+
   {
     std::lock_guard<std::mutex> lock(_done_mutex);
     _done = true;
@@ -109,6 +297,10 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
+      // The Worker executes the first successor that becomes ready right after this task, as the task's output is
+      // still in the caches. Further successors are left to the other Workers.
+      if (worker->continue_with(shared_from_this())) return;
+
       worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
     } else {
       if (_is_scheduled) execute();
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -12,6 +14,8 @@
 
 namespace opossum {
 
+class CancellationToken;
+class SchedulingGroup;
 class Worker;
 
 /**
@@ -42,11 +46,20 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_done() const;
 
+  /**
+   * The exception that the task (or one of its continuations) threw, nullptr if there was none. Exceptions do not leave
+   * the Worker that executes a task. Instead, CurrentScheduler::wait_for_tasks() rethrows them, and an OperatorTask
+   * fails with the exception of a failed input. Only valid once the task is done.
+   */
+  std::exception_ptr exception() const;
+
   /**
    * @return Workers are allowed to steal the task from another node
    */
   bool is_stealable() const;
 
+  SchedulePriority priority() const;
+
   /**
    * Description for debugging purposes
    */
@@ -80,11 +93,32 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   void set_node_id(NodeID node_id);
 
   /**
-   * Callback to be executed right after the Task finished.
+   * Callback to be executed right after the Task finished, before its successors are notified.
    * Notice the execution of the callback might happen on ANY thread
    */
   void set_done_callback(const std::function<void()>& done_callback);
 
+  /**
+   * The SchedulingGroup whose share of the Workers the task uses, and that is charged with the task's execution time.
+   * Tasks without a group that are scheduled while another task executes inherit the group of that task.
+   */
+  void set_scheduling_group(const std::shared_ptr<SchedulingGroup>& scheduling_group);
+  const std::shared_ptr<SchedulingGroup>& scheduling_group() const;
+
+  // The SchedulingGroup of the task that is executed on the calling thread, nullptr if there is none
+  static const std::shared_ptr<SchedulingGroup>& current_scheduling_group();
+
+  /**
+   * The token that cancels the query the task belongs to, see CancellationToken. A task whose token is cancelled fails
+   * with a QueryCancelledException instead of executing. Tasks without a token that are scheduled while another task
+   * executes inherit the token of that task.
+   */
+  void set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+  const std::shared_ptr<const CancellationToken>& cancellation_token() const;
+
+  // The CancellationToken of the task that is executed on the calling thread, nullptr if there is none
+  static std::shared_ptr<const CancellationToken> current_cancellation_token();
+
   /**
    * Schedules the task if a Scheduler is available, otherwise just executes it on the current Thread
    */
@@ -102,6 +136,11 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool try_mark_as_enqueued();
 
+  /**
+   * When the task was enqueued, i.e., became ready to be executed by a Worker. Used for the scheduler statistics.
+   */
+  std::chrono::steady_clock::time_point enqueue_time() const;
+
   /**
    * Executes the task in the current Thread, blocks until all operations are finished
    */
@@ -127,12 +166,36 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   void _join();
 
+  // The task that is executed on the calling thread, nullptr if there is none
+  static AbstractTask* _current_task();
+
+  /**
+   * Lets the task continue with `continuation` once `tasks` are done, see CurrentScheduler::continue_after(). The
+   * tasks are scheduled once the current part of the task has returned, see _schedule_continuation().
+   */
+  void _suspend_until(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                      const std::function<void()>& continuation);
+
+  // Schedules the continuation and the tasks it waits for, if the task was suspended. Returns whether it was.
+  bool _schedule_continuation();
+
+  // Executes a continuation of the task, called by the task that _suspend_until() creates for it
+  void _resume(const std::function<void()>& continuation);
+
+  // Stores the exception thrown by @param function, if any
+  void _run_and_catch_exception(const std::function<void()>& function);
+
+  // Notifies the successors and waiting threads that the task is done
+  void _finish();
+
   std::atomic<TaskID> _id{INVALID_TASK_ID};
   std::atomic<NodeID> _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
   bool _stealable;
   std::atomic_bool _done{false};
   std::function<void()> _done_callback;
+  std::shared_ptr<SchedulingGroup> _scheduling_group;
+  std::shared_ptr<const CancellationToken> _cancellation_token;
 
   // For dependencies
   std::atomic_uint _pending_predecessors{0};
@@ -144,6 +207,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   // to a TaskQueue
   std::atomic_bool _is_enqueued{false};
   std::atomic_bool _is_scheduled{false};
+  // Written before the task is added to a TaskQueue or deque, read by the Worker that takes it from there
+  std::chrono::steady_clock::time_point _enqueue_time;
 
   // For making Tasks join()-able
   std::condition_variable _done_condition_variable;
@@ -154,6 +219,13 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   // To make sure a task is never executed twice
   std::atomic_bool _started{false};
+
+  // Set while a suspended task has not yet scheduled its continuation. The awaited tasks are kept until the
+  // continuation is executed.
+  std::shared_ptr<AbstractTask> _continuation;
+  std::vector<std::shared_ptr<AbstractTask>> _awaited_tasks;
+
+  std::exception_ptr _exception;
 };
 
 }  // namespace opossum
@@ -0,0 +1,27 @@
+#include "cancellation_token.hpp"
+
+#include <memory>
+
+namespace opossum {
+
+CancellationToken::CancellationToken(const std::optional<std::chrono::steady_clock::time_point>& deadline,
+                                     const std::shared_ptr<const CancellationToken>& parent)
+    : _deadline(deadline), _parent(parent) {}
+
+void CancellationToken::cancel() { _cancelled = true; }
+
+bool CancellationToken::is_cancelled() const {
+  if (_cancelled) return true;
+  if (_deadline && std::chrono::steady_clock::now() >= *_deadline) return true;
+  return _parent && _parent->is_cancelled();
+}
+
+void CancellationToken::throw_if_cancelled() const {
+  if (_cancelled) throw QueryCancelledException("canceling statement due to user request");
+  if (_deadline && std::chrono::steady_clock::now() >= *_deadline) {
+    throw QueryCancelledException("canceling statement due to statement timeout");
+  }
+  if (_parent) _parent->throw_if_cancelled();
+}
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Thrown by the tasks and operators of a query whose CancellationToken was cancelled. Like any other exception, it
+ * fails the statement and rolls back its changes.
+ */
+class QueryCancelledException : public std::runtime_error {
+ public:
+  explicit QueryCancelledException(const std::string& message) : std::runtime_error(message) {}
+};
+
+/**
+ * Stops a running query, e.g., on a Postgres CancelRequest or once its statement timeout has passed. The token is
+ * assigned to the tasks of the query via AbstractTask::set_cancellation_token(), and the tasks that they spawn, such as
+ * the JobTasks that operators use to process chunks in parallel, inherit it. A task of a cancelled query fails right
+ * away instead of executing, so that the remaining tasks of the query leave the queues quickly and do not allocate
+ * further intermediate results.
+ *
+ * A token is also cancelled once its deadline has passed or its parent was cancelled. E.g., the token of a statement
+ * with a timeout has the token of the session that executes it as its parent.
+ */
+class CancellationToken : private Noncopyable {
+ public:
+  explicit CancellationToken(const std::optional<std::chrono::steady_clock::time_point>& deadline = std::nullopt,
+                             const std::shared_ptr<const CancellationToken>& parent = nullptr);
+
+  void cancel();
+
+  bool is_cancelled() const;
+
+  // Throws a QueryCancelledException if the token is cancelled
+  void throw_if_cancelled() const;
+
+ private:
+  std::atomic_bool _cancelled{false};
+  const std::optional<std::chrono::steady_clock::time_point> _deadline;
+  const std::shared_ptr<const CancellationToken> _parent;
+};
+
+}  // namespace opossum
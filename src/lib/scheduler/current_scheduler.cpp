@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "abstract_task.hpp"
 
 namespace opossum {
 
@@ -17,4 +18,21 @@ void CurrentScheduler::set(const std::shared_ptr<AbstractScheduler>& instance) {
 
 bool CurrentScheduler::is_set() { return !!_instance; }
 
+void CurrentScheduler::yield() {
+  const auto worker = Worker::get_this_thread_worker();
+  if (worker) worker->_yield();
+}
+
+void CurrentScheduler::continue_after(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                                      const std::function<void()>& continuation) {
+  const auto current_task = AbstractTask::_current_task();
+  if (!current_task) {
+    schedule_and_wait_for_tasks(tasks);
+    continuation();
+    return;
+  }
+
+  current_task->_suspend_until(tasks, continuation);
+}
+
 }  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <exception>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -10,6 +12,7 @@
 namespace opossum {
 
 class AbstractScheduler;
+class AbstractTask;
 
 /**
  * Holds the singleton instance (or the lack of one) of the currently active Scheduler
@@ -28,10 +31,32 @@ class CurrentScheduler {
   /**
    * If there is an active Scheduler, block execution until all @param tasks have finished
    * If there is no active Scheduler, returns immediately since all @param tasks have executed when they were scheduled
+   * Afterwards, rethrows the exception of the first of the @param tasks that failed, see AbstractTask::exception()
    */
   template <typename TaskType>
   static void wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
+  /**
+   * Yield point for long-running tasks, e.g., between the chunks of a heavy operator. If the task is executed by a
+   * Worker and a task that the Worker would serve first (e.g., of High priority) is queued, that task is executed
+   * before this call returns. Otherwise, the call is cheap. Must not be called while holding locks that other tasks
+   * might need.
+   */
+  static void yield();
+
+  /**
+   * Suspension point for tasks that wait for other tasks (e.g., for subtasks or I/O jobs): Instead of blocking the
+   * Worker in wait_for_tasks(), the calling task returns and the Worker serves other tasks. Once the unscheduled
+   * @param tasks are done, @param continuation is executed as part of the calling task, on any Worker. The calling
+   * task is done once its last continuation has finished, so its successors and waiters are not woken before.
+   *
+   * The tasks are scheduled after the calling part of the task has returned, so continue_after() must be its last
+   * action. The continuation may call continue_after() again. Called outside of tasks (e.g., from the main thread),
+   * the tasks are scheduled and waited for, and the continuation is executed right away.
+   */
+  static void continue_after(const std::vector<std::shared_ptr<AbstractTask>>& tasks,
+                             const std::function<void()>& continuation);
+
   template <typename TaskType>
   static void schedule_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
 
@@ -64,6 +89,10 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
   } else {
     for (auto& task : tasks) task->_join();
   }
+
+  for (const auto& task : tasks) {
+    if (task->exception()) std::rethrow_exception(task->exception());
+  }
 }
 
 template <typename TaskType>
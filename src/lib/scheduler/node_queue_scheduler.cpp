@@ -1,8 +1,10 @@
 #include "node_queue_scheduler.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <memory>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -17,7 +19,11 @@
 
 namespace opossum {
 
-NodeQueueScheduler::NodeQueueScheduler() { _worker_id_allocator = std::make_shared<UidAllocator>(); }
+NodeQueueScheduler::NodeQueueScheduler(const std::chrono::microseconds spin_duration,
+                                       const WorkerPlacement worker_placement)
+    : _spin_duration(spin_duration), _worker_placement(worker_placement) {
+  _worker_id_allocator = std::make_shared<UidAllocator>();
+}
 
 NodeQueueScheduler::~NodeQueueScheduler() {
   if (HYRISE_DEBUG && _active) {
@@ -31,6 +37,9 @@ void NodeQueueScheduler::begin() {
   _workers.reserve(Topology::get().num_cpus());
   _queues.reserve(Topology::get().nodes().size());
 
+  // Physical cores that already have a Worker, for WorkerPlacement::OnePerCore
+  auto occupied_core_ids = std::unordered_set<CpuID>{};
+
   for (auto node_id = NodeID{0}; node_id < Topology::get().nodes().size(); node_id++) {
     auto queue = std::make_shared<TaskQueue>(node_id);
 
@@ -39,7 +48,12 @@ void NodeQueueScheduler::begin() {
     auto& topology_node = Topology::get().nodes()[node_id];
 
     for (auto& topology_cpu : topology_node.cpus) {
-      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+      if (_worker_placement == WorkerPlacement::OnePerCore && !occupied_core_ids.emplace(topology_cpu.core_id).second) {
+        continue;
+      }
+
+      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id,
+                                                     topology_cpu.cache_domain_id, _spin_duration));
     }
   }
 
@@ -71,10 +85,22 @@ void NodeQueueScheduler::finish() {
     for ([[maybe_unused]] auto& queue : _queues) {
       DebugAssert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for ([[maybe_unused]] auto& worker : _workers) {
+      DebugAssert(!worker->has_local_tasks(),
+                  "NodeQueueScheduler bug: Worker had local tasks even though all tasks finished");
+    }
   }
 
   _active = false;
 
+  // The sampling thread reads the queues, which are destroyed below
+  _queue_depth_sampling_thread.reset();
+
+  // Parked Workers have to notice that the scheduler is no longer active
+  for (auto& queue : _queues) {
+    queue->notify_all_waiting_workers();
+  }
+
   for (auto& worker : _workers) {
     worker->join();
   }
@@ -88,6 +114,8 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -101,9 +129,15 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
+  // Tasks can prefer the node of the data they work on (see Chunk::preferred_node_id()). If the scheduler was set up
+  // with fewer nodes than the memory (e.g., with a fake topology), the task is treated as having no preference.
+  if (preferred_node_id != CURRENT_NODE_ID && static_cast<size_t>(preferred_node_id) >= _queues.size()) {
+    preferred_node_id = CURRENT_NODE_ID;
+  }
+
   // Lookup node id for current worker.
+  const auto worker = Worker::get_this_thread_worker();
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -115,7 +149,116 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
               "preferred_node_id is not within range of available nodes");
 
+  // Tasks that a Worker spawns for its own node go to its local deque, see the class comment
+  if (worker && worker->queue()->node_id() == preferred_node_id && priority == SchedulePriority::Default) {
+    worker->push_local_task(task);
+    return;
+  }
+
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
+
+  // If all Workers of the node are busy, wake a parked Worker of another node, which can steal the task
+  if (queue->has_waiting_workers()) return;
+  for (const auto& other_queue : _queues) {
+    if (other_queue->has_waiting_workers()) {
+      other_queue->notify_waiting_worker();
+      break;
+    }
+  }
 }
+
+SchedulerStatistics NodeQueueScheduler::statistics() const {
+  auto statistics = SchedulerStatistics{};
+  for (const auto& worker : _workers) {
+    statistics.workers.emplace_back(worker->statistics());
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_queue_depth_samples_mutex);
+    statistics.queue_depth_samples.assign(_queue_depth_samples.cbegin(), _queue_depth_samples.cend());
+  }
+
+  return statistics;
+}
+
+void NodeQueueScheduler::set_active_worker_count(const NodeID node_id, const size_t count) {
+  Assert(_active, "Workers can only be activated while the NodeQueueScheduler is active");
+  Assert(static_cast<size_t>(node_id) < _queues.size(), "Node does not exist");
+  Assert(count > 0, "Each node needs an active Worker for its non-stealable tasks");
+
+  std::lock_guard<std::mutex> lock(_active_workers_mutex);
+
+  auto node_workers = std::vector<std::shared_ptr<Worker>>{};
+  for (const auto& worker : _workers) {
+    if (worker->queue()->node_id() == node_id) node_workers.emplace_back(worker);
+  }
+  Assert(count <= node_workers.size(), "Node has fewer Workers than requested");
+
+  for (auto worker_index = size_t{0}; worker_index < node_workers.size(); ++worker_index) {
+    node_workers[worker_index]->set_active(worker_index < count);
+  }
+}
+
+void NodeQueueScheduler::set_active_worker_count(const size_t count) {
+  Assert(count <= _workers.size(), "Scheduler has fewer Workers than requested");
+
+  auto num_workers_by_node = std::vector<size_t>(_queues.size());
+  for (const auto& worker : _workers) {
+    ++num_workers_by_node[worker->queue()->node_id()];
+  }
+
+  // Hand out the Workers round-robin, skipping nodes that have no Workers left
+  auto counts = std::vector<size_t>(_queues.size());
+  auto remaining_count = count;
+  while (remaining_count > 0) {
+    for (auto node_id = size_t{0}; node_id < _queues.size() && remaining_count > 0; ++node_id) {
+      if (counts[node_id] == num_workers_by_node[node_id]) continue;
+      ++counts[node_id];
+      --remaining_count;
+    }
+  }
+
+  for (auto node_id = NodeID{0}; node_id < _queues.size(); ++node_id) {
+    if (num_workers_by_node[node_id] == 0) continue;
+    set_active_worker_count(node_id, std::max(counts[node_id], size_t{1}));
+  }
+}
+
+size_t NodeQueueScheduler::active_worker_count() const {
+  return std::count_if(_workers.cbegin(), _workers.cend(), [](const auto& worker) { return worker->is_active(); });
+}
+
+void NodeQueueScheduler::start_queue_depth_sampling(const std::chrono::milliseconds interval,
+                                                    const size_t max_sample_count) {
+  DebugAssert(_active, "Queue depths can only be sampled while the NodeQueueScheduler is active");
+  Assert(max_sample_count > 0, "Expected to keep at least one sample");
+
+  _queue_depth_sampling_thread.reset();
+  _max_queue_depth_sample_count = max_sample_count;
+  _queue_depth_sampling_thread =
+      std::make_unique<PausableLoopThread>(interval, [this](size_t) { _sample_queue_depths(); });
+}
+
+std::vector<size_t> NodeQueueScheduler::queue_depths() const {
+  auto queue_depths = std::vector<size_t>(_queues.size());
+  for (auto node_id = size_t{0}; node_id < _queues.size(); ++node_id) {
+    queue_depths[node_id] = _queues[node_id]->size();
+  }
+  for (const auto& worker : _workers) {
+    queue_depths[worker->queue()->node_id()] += worker->num_local_tasks();
+  }
+  return queue_depths;
+}
+
+void NodeQueueScheduler::_sample_queue_depths() {
+  auto sample = QueueDepthSample{std::chrono::steady_clock::now(), queue_depths()};
+
+  std::lock_guard<std::mutex> lock(_queue_depth_samples_mutex);
+  _queue_depth_samples.emplace_back(std::move(sample));
+  while (_queue_depth_samples.size() > _max_queue_depth_sample_count) {
+    _queue_depth_samples.pop_front();
+  }
+}
+
 }  // namespace opossum
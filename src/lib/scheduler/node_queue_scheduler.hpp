@@ -1,11 +1,16 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "scheduler_statistics.hpp"
+#include "utils/pausable_loop_thread.hpp"
 
 namespace opossum {
 
@@ -29,6 +34,11 @@ namespace opossum {
  * To determine if a task is ready, it checks its parent tasks if they are done. A task will be set done after it
  * was processed successfully.
  *
+ * When a task finishes on a Worker, the Worker executes the first successor that became ready right afterwards (see
+ * Worker::continue_with()), so that the successor finds its input in the caches of the CPU. Further successors are
+ * pushed to the TaskQueue with high priority. Chains of such continuations are executed iteratively and are cut after
+ * a fixed length, so that a deep plan neither grows the stack nor monopolizes the Worker.
+ *
  *
  * JOBTASKS
  *
@@ -49,14 +59,66 @@ namespace opossum {
  * In general, each node owns a TaskQueue. Furthermore, one Worker is assigned to one CPU. Therefore, the Worker
  * running on CPUs of one node are just pulling from the single TaskQueue of this node.
  *
+ * Tasks scheduled from outside of the Workers (e.g., the OperatorTasks of a query) and high-priority tasks (tasks that
+ * became ready when their predecessors finished) are put into the TaskQueue of the node. Tasks that a Worker schedules
+ * for its own node (e.g., the JobTasks an operator spawns for its chunks) are put into a lock-free WorkStealingDeque
+ * owned by the Worker instead, so that fine-grained tasks do not contend for the node's TaskQueue.
+ *
+ * By default, a Worker is started on every CPU of the topology, i.e., on every hardware thread. For memory-bound
+ * workloads, WorkerPlacement::OnePerCore starts only one Worker per physical core, so that SMT siblings do not
+ * compete for the same caches and memory bandwidth.
+ *
  * A topology can also be created with Topology::use_fake_numa_topology() to simulate a NUMA system
  * with multiple nodes (queues) and worker and should mainly be used for testing NUMA-concepts
  * on non-NUMA development machines.
  *
+ * The number of active Workers can be changed at runtime with set_active_worker_count(), e.g., when the CPU quota of
+ * the process changes on a shared machine. Workers are created for all CPUs when the scheduler begins and deactivated
+ * ones sleep until they are activated again, so that no task is dropped and the Workers can be reached by the
+ * scheduler's other parts without synchronization. Each node keeps at least one active Worker, as its
+ * non-stealable tasks cannot be executed elsewhere.
+ *
+ *
+ * FAIR SHARING AND ADMISSION
+ *
+ * The tasks of a query can be assigned to a SchedulingGroup (e.g., one per session or one for all analytical
+ * queries). The TaskQueues hand out the tasks of the group that has used the least of its weighted share of the
+ * Workers first, so that short queries do not wait behind the many tasks of a long-running one. A group can also cap
+ * how many of its queries are executed at once. See SchedulingGroup.
+ *
+ *
+ * YIELDING
+ *
+ * Tasks are not preempted. Instead, long-running operators (e.g., Sort and JoinNestedLoop) call
+ * CurrentScheduler::yield() between pieces of their work. If the Worker's TaskQueue holds a task of High priority, or a
+ * task of a group that is served before the group of the running task, the Worker executes that task before it
+ * continues with the yielding one. Thus, a few long tasks do not delay short ones until they finish.
+ *
+ *
+ * SUSPENDING
+ *
+ * A task that waits for other tasks in wait_for_tasks() occupies its Worker, which executes other tasks on top of the
+ * waiting one's stack until the awaited tasks are done. Alternatively, a task can end with
+ * CurrentScheduler::continue_after(), which schedules the awaited tasks and a continuation that depends on them. The
+ * Worker is free as soon as the task returns, and the continuation is executed by any Worker once it is ready. The
+ * task is done only after its last continuation, so that its successors still see its full result.
+ *
+ *
+ * PARKING
+ *
+ * Workers that do not find a task spin for a configurable duration and then park on their node's TaskQueue. Pushing
+ * a task wakes a parked Worker of the task's node, or of another node if all Workers of that node are busy, as these
+ * can steal the task.
+ *
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
+ * A Worker first executes its own deque's tasks, most recent first, and then pulls from its node's TaskQueue. An idle
+ * Worker steals the oldest task from the deque of another Worker of the same node before it turns to other nodes.
+ * Within the node, it first tries the Workers that share its last-level cache (see TopologyCpu::cache_domain_id),
+ * e.g., those of the same CCX on AMD EPYC, as the tasks of their deques likely work on data that is in that cache.
+ *
+ * Across nodes, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
  * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
  * pull a ready task. This occurs in two cases:
  *  1) all tasks in the queue are not ready
@@ -70,20 +132,33 @@ namespace opossum {
  * Afterwards, the current worker is checking its local queue gain.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
+ *
+ *
+ * STATISTICS
+ *
+ * The Workers count their busy and idle time, finished tasks, and steals, and record how long tasks waited for a
+ * Worker and how long they executed. Together with the optionally sampled queue depths, statistics() tells whether
+ * slow queries are CPU-bound or wait in the queues.
  */
 
 class Worker;
 class TaskQueue;
 class UidAllocator;
 
+enum class WorkerPlacement { AllCpus, OnePerCore };
+
 /**
  * Schedules Tasks
  */
 class NodeQueueScheduler : public AbstractScheduler {
  public:
-  NodeQueueScheduler();
+  // Idle Workers keep looking for tasks for spin_duration before they park
+  explicit NodeQueueScheduler(const std::chrono::microseconds spin_duration = DEFAULT_SPIN_DURATION,
+                              const WorkerPlacement worker_placement = WorkerPlacement::AllCpus);
   ~NodeQueueScheduler() override;
 
+  static constexpr auto DEFAULT_SPIN_DURATION = std::chrono::microseconds{100};
+
   /**
    * Create a queue on every node and a processing unit for every core.
    * Start a single worker for each processing unit.
@@ -96,6 +171,8 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const override;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
@@ -104,12 +181,49 @@ class NodeQueueScheduler : public AbstractScheduler {
   void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                 SchedulePriority priority = SchedulePriority::Default) override;
 
+  SchedulerStatistics statistics() const override;
+
+  /**
+   * Activates the first @param count Workers of the node and deactivates the others, which finish their current and
+   * their local tasks first. @param count must be at least one and at most the number of the node's Workers.
+   */
+  void set_active_worker_count(const NodeID node_id, const size_t count);
+
+  /**
+   * Distributes @param count active Workers over the nodes, one node after another, so that the counts of the nodes
+   * differ by at most one where their Workers allow. Every node keeps at least one active Worker, even if @param count
+   * is lower than the number of nodes.
+   */
+  void set_active_worker_count(const size_t count);
+
+  size_t active_worker_count() const;
+
+  /**
+   * Records the number of waiting tasks of each node every `interval`, keeping the latest `max_sample_count` samples
+   * for statistics(). Sampling ends when the scheduler finishes.
+   */
+  void start_queue_depth_sampling(const std::chrono::milliseconds interval, const size_t max_sample_count = 1'000);
+
+  // Number of tasks currently waiting on each node, i.e., in the node's TaskQueue or in the local deques of its Workers
+  std::vector<size_t> queue_depths() const;
+
  private:
+  void _sample_queue_depths();
+
+  const std::chrono::microseconds _spin_duration;
+  const WorkerPlacement _worker_placement;
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
   std::vector<std::shared_ptr<Worker>> _workers;
   std::atomic_bool _active{false};
+  // Serializes the changes of the active Workers
+  std::mutex _active_workers_mutex;
+
+  std::unique_ptr<PausableLoopThread> _queue_depth_sampling_thread;
+  size_t _max_queue_depth_sample_count{0};
+  std::deque<QueueDepthSample> _queue_depth_samples;
+  mutable std::mutex _queue_depth_samples_mutex;
 };
 
 }  // namespace opossum
@@ -1,5 +1,6 @@
 #include "operator_task.hpp"
 
+#include <exception>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -59,6 +60,12 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
 void OperatorTask::_on_execute() {
+  // If an input failed (e.g., because the query exceeded its memory limit), the operator fails with the same exception
+  for (const auto& weak_predecessor : predecessors()) {
+    const auto predecessor = weak_predecessor.lock();
+    if (predecessor && predecessor->exception()) std::rethrow_exception(predecessor->exception());
+  }
+
   auto context = _op->transaction_context();
   if (context) {
     switch (context->phase()) {
@@ -0,0 +1,89 @@
+#include "scheduler_statistics.hpp"
+
+#include <vector>
+
+namespace {
+
+nlohmann::json histogram_to_json(const opossum::DurationHistogram& histogram) {
+  // Empty buckets are left out
+  auto buckets = nlohmann::json::array();
+  for (auto bucket_id = size_t{0}; bucket_id < opossum::DurationHistogram::BUCKET_COUNT; ++bucket_id) {
+    const auto bucket_count = histogram.count_in_bucket(bucket_id);
+    if (bucket_count == 0) continue;
+    buckets.push_back({{"upper_bound_in_us", opossum::DurationHistogram::bucket_upper_bound(bucket_id).count()},
+                       {"count", bucket_count}});
+  }
+
+  return nlohmann::json{{"count", histogram.count()},
+                        {"p50_in_us", histogram.percentile(0.5).count()},
+                        {"p90_in_us", histogram.percentile(0.9).count()},
+                        {"p99_in_us", histogram.percentile(0.99).count()},
+                        {"buckets", buckets}};
+}
+
+}  // namespace
+
+namespace opossum {
+
+double WorkerStatistics::utilization() const {
+  const auto total_time = busy_time + idle_time;
+  if (total_time.count() == 0) return 0.0;
+  return static_cast<double>(busy_time.count()) / static_cast<double>(total_time.count());
+}
+
+nlohmann::json WorkerStatistics::to_json() const {
+  return nlohmann::json{
+      {"worker_id", worker_id},
+      {"node_id", static_cast<NodeID::base_type>(node_id)},
+      {"busy_time_in_ns", busy_time.count()},
+      {"idle_time_in_ns", idle_time.count()},
+      {"utilization", utilization()},
+      {"finished_tasks_by_priority",
+       {{"high", finished_tasks_by_priority[static_cast<size_t>(SchedulePriority::High)]},
+        {"default", finished_tasks_by_priority[static_cast<size_t>(SchedulePriority::Default)]}}},
+      {"yielded_to_tasks", yielded_to_tasks},
+      {"continued_tasks", continued_tasks},
+      {"steal_attempts", steal_attempts},
+      {"successful_steals", successful_steals},
+      {"wait_times", histogram_to_json(wait_times)},
+      {"execution_times", histogram_to_json(execution_times)}};
+}
+
+DurationHistogram SchedulerStatistics::wait_times() const {
+  auto histogram = DurationHistogram{};
+  for (const auto& worker : workers) {
+    histogram.merge(worker.wait_times);
+  }
+  return histogram;
+}
+
+DurationHistogram SchedulerStatistics::execution_times() const {
+  auto histogram = DurationHistogram{};
+  for (const auto& worker : workers) {
+    histogram.merge(worker.execution_times);
+  }
+  return histogram;
+}
+
+nlohmann::json SchedulerStatistics::to_json() const {
+  auto workers_json = nlohmann::json::array();
+  for (const auto& worker : workers) {
+    workers_json.push_back(worker.to_json());
+  }
+
+  // The times of the samples are given relative to the first one
+  auto queue_depth_samples_json = nlohmann::json::array();
+  for (const auto& sample : queue_depth_samples) {
+    const auto time_offset = sample.time - queue_depth_samples.front().time;
+    queue_depth_samples_json.push_back(
+        {{"time_in_ms", std::chrono::duration_cast<std::chrono::milliseconds>(time_offset).count()},
+         {"queue_depths", sample.queue_depths}});
+  }
+
+  return nlohmann::json{{"workers", workers_json},
+                        {"wait_times", histogram_to_json(wait_times())},
+                        {"execution_times", histogram_to_json(execution_times())},
+                        {"queue_depth_samples", queue_depth_samples_json}};
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <vector>
+
+#include "json.hpp"
+
+#include "types.hpp"
+#include "utils/duration_histogram.hpp"
+
+namespace opossum {
+
+/**
+ * Activity of a Worker since it was started, see Worker::statistics()
+ */
+struct WorkerStatistics {
+  static constexpr size_t PRIORITY_COUNT = 2;
+
+  WorkerID worker_id{0};
+  NodeID node_id{0};
+
+  // The Worker is idle while it looks for tasks without finding one (spinning) and while it is parked
+  std::chrono::nanoseconds busy_time{0};
+  std::chrono::nanoseconds idle_time{0};
+
+  // Indexed by the SchedulePriority of the tasks
+  std::array<uint64_t, PRIORITY_COUNT> finished_tasks_by_priority{};
+  // Tasks executed at yield points of other tasks, see CurrentScheduler::yield()
+  uint64_t yielded_to_tasks{0};
+  // Successors executed right after their last predecessor, see Worker::continue_with()
+  uint64_t continued_tasks{0};
+
+  // Attempts to steal a task from another Worker or node, made whenever the Worker's own queues are empty
+  uint64_t steal_attempts{0};
+  uint64_t successful_steals{0};
+
+  // Time from enqueueing a task until a Worker starts it (i.e., the time the task waited for a Worker), and from its
+  // start until it is done
+  DurationHistogram wait_times;
+  DurationHistogram execution_times;
+
+  // Share of the time the Worker was busy
+  double utilization() const;
+
+  nlohmann::json to_json() const;
+};
+
+struct QueueDepthSample {
+  std::chrono::steady_clock::time_point time;
+  // Number of tasks waiting on each node, i.e., in the node's TaskQueue or in the local deques of its Workers
+  std::vector<size_t> queue_depths;
+};
+
+/**
+ * Telemetry of a scheduler, see AbstractScheduler::statistics(). Tells whether the queries are CPU-bound (busy
+ * Workers, short wait times) or wait for Workers (long wait times, deep queues).
+ */
+struct SchedulerStatistics {
+  std::vector<WorkerStatistics> workers;
+  // Oldest first, see NodeQueueScheduler::start_queue_depth_sampling()
+  std::vector<QueueDepthSample> queue_depth_samples;
+
+  // Histograms of all Workers combined
+  DurationHistogram wait_times() const;
+  DurationHistogram execution_times() const;
+
+  nlohmann::json to_json() const;
+};
+
+}  // namespace opossum
@@ -0,0 +1,62 @@
+#include "scheduling_group.hpp"
+
+#include <memory>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SchedulingGroup::SchedulingGroup(const float weight, const std::optional<size_t>& max_admitted_queries)
+    : _weight(weight), _max_admitted_queries(max_admitted_queries) {
+  Assert(_weight > 0.0f, "Weight of a SchedulingGroup must be positive");
+  Assert(!_max_admitted_queries || *_max_admitted_queries > 0, "A SchedulingGroup must admit at least one query");
+}
+
+float SchedulingGroup::weight() const { return _weight; }
+
+const std::optional<size_t>& SchedulingGroup::max_admitted_queries() const { return _max_admitted_queries; }
+
+uint64_t SchedulingGroup::virtual_time() const { return _virtual_time; }
+
+void SchedulingGroup::add_execution_time(const std::chrono::nanoseconds execution_time) {
+  _virtual_time += static_cast<uint64_t>(static_cast<float>(execution_time.count()) / _weight);
+}
+
+void SchedulingGroup::advance_virtual_time_to(const uint64_t virtual_time) {
+  auto current_virtual_time = _virtual_time.load();
+  while (current_virtual_time < virtual_time &&
+         !_virtual_time.compare_exchange_weak(current_virtual_time, virtual_time)) {
+  }
+}
+
+size_t SchedulingGroup::admitted_query_count() const {
+  std::lock_guard<std::mutex> lock(_admission_mutex);
+  return _admitted_query_count;
+}
+
+void SchedulingGroup::_admit() {
+  std::unique_lock<std::mutex> lock(_admission_mutex);
+  if (_max_admitted_queries) {
+    _admission_condition.wait(lock, [&]() { return _admitted_query_count < *_max_admitted_queries; });
+  }
+  ++_admitted_query_count;
+}
+
+void SchedulingGroup::_release() {
+  {
+    std::lock_guard<std::mutex> lock(_admission_mutex);
+    DebugAssert(_admitted_query_count > 0, "Released more queries than were admitted");
+    --_admitted_query_count;
+  }
+  _admission_condition.notify_one();
+}
+
+SchedulingGroup::ScopedAdmission::ScopedAdmission(const std::shared_ptr<SchedulingGroup>& group) : _group(group) {
+  if (_group) _group->_admit();
+}
+
+SchedulingGroup::ScopedAdmission::~ScopedAdmission() {
+  if (_group) _group->_release();
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The tasks of the queries of one session or class of queries (e.g., all analytical queries). A query is assigned to a
+ * group via SQLPipelineBuilder::with_scheduling_group(), the tasks that its operators spawn inherit the group.
+ *
+ * Fair sharing: Each group accumulates the execution time of its tasks, divided by its weight ("virtual time"). The
+ * TaskQueue hands out the tasks of the group with the lowest virtual time first, so that the groups that have tasks
+ * share the Workers in proportion to their weights. Thus, a short query in its own group does not wait until all
+ * tasks of a long-running query were executed.
+ *
+ * Admission control: If max_admitted_queries is set, at most that many queries of the group are executed at once,
+ * further queries block in their ScopedAdmission until one of them finished. This keeps heavy queries from flooding
+ * the queues with tasks.
+ */
+class SchedulingGroup : private Noncopyable {
+ public:
+  explicit SchedulingGroup(const float weight = 1.0f, const std::optional<size_t>& max_admitted_queries = std::nullopt);
+
+  float weight() const;
+  const std::optional<size_t>& max_admitted_queries() const;
+
+  /**
+   * Execution time of the tasks of the group in nanoseconds, divided by the weight
+   */
+  uint64_t virtual_time() const;
+
+  void add_execution_time(const std::chrono::nanoseconds execution_time);
+
+  /**
+   * Raises the virtual time to at least `virtual_time`. Used when a group that was idle gets tasks again, so that it
+   * cannot claim the Workers for itself until it caught up with the time the idle period did not cost it.
+   */
+  void advance_virtual_time_to(const uint64_t virtual_time);
+
+  size_t admitted_query_count() const;
+
+  /**
+   * Admits a query of the group for as long as it exists. Blocks until the query can be admitted. Does nothing if the
+   * group is nullptr.
+   */
+  class ScopedAdmission : private Noncopyable {
+   public:
+    explicit ScopedAdmission(const std::shared_ptr<SchedulingGroup>& group);
+    ~ScopedAdmission();
+
+   private:
+    const std::shared_ptr<SchedulingGroup> _group;
+  };
+
+ private:
+  void _admit();
+  void _release();
+
+  const float _weight;
+  const std::optional<size_t> _max_admitted_queries;
+
+  std::atomic<uint64_t> _virtual_time{0};
+
+  size_t _admitted_query_count{0};
+  mutable std::mutex _admission_mutex;
+  std::condition_variable _admission_condition;
+};
+
+}  // namespace opossum
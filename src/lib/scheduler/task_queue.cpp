@@ -1,10 +1,13 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "abstract_task.hpp"
+#include "scheduling_group.hpp"
 #include "utils/assert.hpp"
+#include "utils/tracing/probes.hpp"
 
 namespace opossum {
 
@@ -12,6 +15,8 @@ TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
 bool TaskQueue::empty() const { return _num_tasks == 0; }
 
+size_t TaskQueue::size() const { return _num_tasks; }
+
 NodeID TaskQueue::node_id() const { return _node_id; }
 
 void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priority) {
@@ -21,9 +26,22 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+
+  if (const auto& scheduling_group = task->scheduling_group()) {
+    std::lock_guard<std::mutex> lock(_grouped_tasks_mutex);
+    const auto [group_iter, group_was_idle] = _grouped_tasks.try_emplace(scheduling_group);
+    if (group_was_idle) scheduling_group->advance_virtual_time_to(_virtual_time_floor);
+
+    group_iter->second[priority].push_back(task);
+    _num_grouped_tasks++;
+  } else {
+    _queues[priority].push(task);
+  }
 
   _num_tasks++;
+  DTRACE_PROBE3(HYRISE, TASK_ENQUEUED, task->id(), static_cast<NodeID::base_type>(_node_id), priority);
+
+  notify_waiting_worker();
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
@@ -34,6 +52,9 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
       return task;
     }
   }
+
+  if (_num_grouped_tasks > 0) return _pull_grouped_task(false);
+
   return nullptr;
 }
 
@@ -49,7 +70,113 @@ std::shared_ptr<AbstractTask> TaskQueue::steal() {
       }
     }
   }
+
+  if (_num_grouped_tasks > 0) return _pull_grouped_task(true);
+
+  return nullptr;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::pull_preempting_task(
+    const std::shared_ptr<SchedulingGroup>& scheduling_group) {
+  std::shared_ptr<AbstractTask> task;
+  if (_queues[static_cast<uint32_t>(SchedulePriority::High)].try_pop(task)) {
+    _num_tasks--;
+    return task;
+  }
+
+  if (!scheduling_group) return nullptr;
+
+  // Tasks without a group are pulled before grouped tasks, see pull()
+  if (_queues[static_cast<uint32_t>(SchedulePriority::Default)].try_pop(task)) {
+    _num_tasks--;
+    return task;
+  }
+
+  if (_num_grouped_tasks > 0) return _pull_grouped_task(false, scheduling_group->virtual_time());
+
   return nullptr;
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::_pull_grouped_task(const bool stealable_only,
+                                                            const uint64_t max_virtual_time) {
+  const auto can_pull = [&](const auto& queue) {
+    return !queue.empty() && (!stealable_only || queue.front()->is_stealable());
+  };
+
+  std::lock_guard<std::mutex> lock(_grouped_tasks_mutex);
+
+  auto selected_group_iter = _grouped_tasks.end();
+  auto selected_virtual_time = max_virtual_time;
+  for (auto group_iter = _grouped_tasks.begin(); group_iter != _grouped_tasks.end(); ++group_iter) {
+    const auto virtual_time = group_iter->first->virtual_time();
+    if (virtual_time >= selected_virtual_time) continue;
+    if (std::none_of(group_iter->second.begin(), group_iter->second.end(), can_pull)) continue;
+
+    selected_group_iter = group_iter;
+    selected_virtual_time = virtual_time;
+  }
+
+  if (selected_group_iter == _grouped_tasks.end()) return nullptr;
+
+  auto& queues = selected_group_iter->second;
+  const auto queue_iter = std::find_if(queues.begin(), queues.end(), can_pull);
+  auto task = std::move(queue_iter->front());
+  queue_iter->pop_front();
+
+  if (std::all_of(queues.begin(), queues.end(), [](const auto& queue) { return queue.empty(); })) {
+    _grouped_tasks.erase(selected_group_iter);
+  }
+
+  _virtual_time_floor = selected_virtual_time;
+  _num_grouped_tasks--;
+  _num_tasks--;
+  return task;
+}
+
+void TaskQueue::wait_for_task(const std::chrono::milliseconds timeout) {
+  std::unique_lock<std::mutex> lock(_wait_mutex);
+  ++_num_waiting_workers;
+
+  // Checking empty() covers tasks that were pushed before this Worker was counted as waiting
+  const auto notification_count = _notification_count;
+  _wait_condition.wait_for(lock, timeout, [&]() { return _notification_count != notification_count || !empty(); });
+
+  --_num_waiting_workers;
+}
+
+void TaskQueue::notify_waiting_worker() {
+  if (!has_waiting_workers()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_wait_mutex);
+    ++_notification_count;
+  }
+  _wait_condition.notify_one();
+}
+
+void TaskQueue::notify_all_waiting_workers() {
+  {
+    std::lock_guard<std::mutex> lock(_wait_mutex);
+    ++_notification_count;
+  }
+  _wait_condition.notify_all();
+}
+
+bool TaskQueue::has_waiting_workers() const { return _num_waiting_workers > 0; }
+
+bool TaskQueue::has_grouped_tasks() const { return _num_grouped_tasks > 0; }
+
+std::optional<uint64_t> TaskQueue::lowest_queued_virtual_time() {
+  if (_num_grouped_tasks == 0) return std::nullopt;
+
+  std::lock_guard<std::mutex> lock(_grouped_tasks_mutex);
+
+  auto lowest_virtual_time = std::optional<uint64_t>{};
+  for (const auto& [scheduling_group, queues] : _grouped_tasks) {
+    const auto virtual_time = scheduling_group->virtual_time();
+    if (!lowest_virtual_time || virtual_time < *lowest_virtual_time) lowest_virtual_time = virtual_time;
+  }
+  return lowest_virtual_time;
+}
+
 }  // namespace opossum
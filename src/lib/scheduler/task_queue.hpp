@@ -4,16 +4,30 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractTask;
+class SchedulingGroup;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Idle Workers of the node park on the queue instead of polling it, and are woken when a task is pushed.
+ *
+ * Tasks that belong to a SchedulingGroup are queued per group. Tasks without a group are pulled first, afterwards the
+ * tasks of the group with the lowest virtual time, so that the groups share the Workers fairly (see SchedulingGroup).
+ * As long as no group is used, the queue does not lock.
  */
 class TaskQueue {
  public:
@@ -22,6 +36,7 @@ class TaskQueue {
   explicit TaskQueue(NodeID node_id);
 
   bool empty() const;
+  size_t size() const;
 
   NodeID node_id() const;
 
@@ -37,10 +52,56 @@ class TaskQueue {
    */
   std::shared_ptr<AbstractTask> steal();
 
+  /**
+   * Returns a task that the queue serves before the tasks of `scheduling_group` and removes it from the queue, or
+   * nullptr if there is none. These are tasks of High priority and, if `scheduling_group` is set, tasks without a group
+   * and tasks of groups with a lower virtual time. Used by yielding Workers, see CurrentScheduler::yield().
+   */
+  std::shared_ptr<AbstractTask> pull_preempting_task(const std::shared_ptr<SchedulingGroup>& scheduling_group);
+
+  /**
+   * Blocks the calling Worker until it is notified, a task is pushed, or the timeout expires. The timeout bounds the
+   * delay of wakeups that are missed, e.g., for tasks that can only be stolen from other nodes.
+   */
+  void wait_for_task(const std::chrono::milliseconds timeout);
+
+  /**
+   * Wakes one (or all) of the Workers waiting for a task. The call is cheap if no Worker is waiting.
+   */
+  void notify_waiting_worker();
+  void notify_all_waiting_workers();
+
+  bool has_waiting_workers() const;
+
+  bool has_grouped_tasks() const;
+
+  /**
+   * The lowest virtual time of the groups that have tasks in the queue, if any
+   */
+  std::optional<uint64_t> lowest_queued_virtual_time();
+
  private:
+  // Pulls a task of the group with the lowest virtual time, considering only groups below `max_virtual_time`
+  std::shared_ptr<AbstractTask> _pull_grouped_task(
+      const bool stealable_only, const uint64_t max_virtual_time = std::numeric_limits<uint64_t>::max());
+
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
   std::atomic_uint _num_tasks{0};
+
+  using GroupedTaskQueues = std::array<std::deque<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS>;
+  // Groups are erased once they have no tasks left
+  std::unordered_map<std::shared_ptr<SchedulingGroup>, GroupedTaskQueues> _grouped_tasks;
+  std::atomic_uint _num_grouped_tasks{0};
+  std::mutex _grouped_tasks_mutex;
+  // Virtual time of the group that was pulled last. Groups that get tasks again after being idle start from here.
+  uint64_t _virtual_time_floor{0};
+
+  std::atomic_uint _num_waiting_workers{0};
+  std::mutex _wait_mutex;
+  std::condition_variable _wait_condition;
+  // Incremented for each notification, so that waiting Workers can tell notifications from spurious wakeups
+  uint64_t _notification_count{0};
 };
 
 }  // namespace opossum
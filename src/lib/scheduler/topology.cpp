@@ -5,15 +5,81 @@
 #endif
 
 #include <algorithm>
+#include <fstream>
 #include <iomanip>
 #include <memory>
+#include <optional>
 #include <sstream>
+#include <string>
 #include <thread>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "utils/numa_memory_resource.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const auto SYSFS_CPU_PATH = std::string{"/sys/devices/system/cpu/"};
+
+// Returns the first line of a sysfs file, std::nullopt if it does not exist (e.g., outside of Linux)
+std::optional<std::string> read_sysfs_file(const std::string& path) {
+  auto file = std::ifstream{path};
+  auto line = std::string{};
+  if (!file || !std::getline(file, line)) return std::nullopt;
+  return line;
+}
+
+// The lowest CPU of a list in a sysfs file, std::nullopt if the file does not exist
+std::optional<CpuID> first_cpu_in_sysfs_file(const std::string& path) {
+  const auto cpu_list = read_sysfs_file(path);
+  if (!cpu_list) return std::nullopt;
+
+  const auto cpus = Topology::parse_cpu_list(*cpu_list);
+  if (cpus.empty()) return std::nullopt;
+  return *std::min_element(cpus.cbegin(), cpus.cend());
+}
+
+std::unordered_set<CpuID> isolated_cpus() {
+  const auto cpu_list = read_sysfs_file(SYSFS_CPU_PATH + "isolated");
+  if (!cpu_list) return {};
+
+  const auto cpus = Topology::parse_cpu_list(*cpu_list);
+  return {cpus.cbegin(), cpus.cend()};
+}
+
+// Sets the physical cores and the cache domains of the CPUs of a node. The cache domain of a CPU is given by its cache
+// of the highest level, which is the L3 on most systems.
+void detect_cache_topology(std::vector<TopologyCpu>& cpus) {
+  for (auto& cpu : cpus) {
+    const auto cpu_path = SYSFS_CPU_PATH + "cpu" + std::to_string(cpu.cpu_id) + "/";
+
+    cpu.core_id = first_cpu_in_sysfs_file(cpu_path + "topology/thread_siblings_list").value_or(cpu.cpu_id);
+
+    auto cache_domain_id = std::optional<CpuID>{};
+    auto max_cache_level = 0;
+    for (auto cache_index = 0;; ++cache_index) {
+      const auto cache_path = cpu_path + "cache/index" + std::to_string(cache_index) + "/";
+      const auto level = read_sysfs_file(cache_path + "level");
+      if (!level) break;
+
+      const auto cache_level = std::stoi(*level);
+      if (cache_level <= max_cache_level) continue;
+
+      const auto first_cpu = first_cpu_in_sysfs_file(cache_path + "shared_cpu_list");
+      if (!first_cpu) continue;
+
+      max_cache_level = cache_level;
+      cache_domain_id = first_cpu;
+    }
+    cpu.cache_domain_id = cache_domain_id.value_or(cpus.front().cpu_id);
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 #if HYRISE_NUMA_SUPPORT
@@ -26,10 +92,10 @@ Topology::Topology() { _init_default_topology(); }
 
 void TopologyNode::print(std::ostream& stream, size_t indent) const {
   for (size_t i = 0; i < indent; ++i) stream << " ";
-  stream << "Number of Node CPUs: " << cpus.size() << ", CPUIDs: [";
+  stream << "Number of Node CPUs: " << cpus.size() << ", CPUIDs (core, cache domain): [";
   for (size_t cpu_idx = 0; cpu_idx < cpus.size(); ++cpu_idx) {
     for (size_t i = 0; i < indent; ++i) stream << " ";
-    stream << cpus[cpu_idx].cpu_id;
+    stream << cpus[cpu_idx].cpu_id << " (" << cpus[cpu_idx].core_id << ", " << cpus[cpu_idx].cache_domain_id << ")";
     if (cpu_idx + 1 < cpus.size()) {
       stream << ", ";
     }
@@ -71,6 +137,7 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
   auto num_configured_cpus = static_cast<CpuID>(numa_num_configured_cpus());
   auto cpu_bitmask = numa_allocate_cpumask();
   auto core_count = uint32_t{0};
+  const auto isolated = isolated_cpus();
 
   for (auto node_id = 0; node_id <= max_node; node_id++) {
     if (max_num_cores == 0 || core_count < max_num_cores) {
@@ -79,7 +146,7 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
       numa_node_to_cpus(node_id, cpu_bitmask);
 
       for (CpuID cpu_id{0}; cpu_id < num_configured_cpus; ++cpu_id) {
-        if (numa_bitmask_isbitset(cpu_bitmask, cpu_id)) {
+        if (numa_bitmask_isbitset(cpu_bitmask, cpu_id) && !isolated.count(cpu_id)) {
           if (max_num_cores == 0 || core_count < max_num_cores) {
             cpus.emplace_back(TopologyCpu(cpu_id));
             _num_cpus++;
@@ -88,6 +155,8 @@ void Topology::_init_numa_topology(uint32_t max_num_cores) {
         }
       }
 
+      if (!cpus.empty()) detect_cache_topology(cpus);
+
       TopologyNode node(std::move(cpus));
       _nodes.emplace_back(std::move(node));
     }
@@ -103,16 +172,19 @@ void Topology::_init_non_numa_topology(uint32_t max_num_cores) {
   _clear();
   _fake_numa_topology = false;
 
-  _num_cpus = std::thread::hardware_concurrency();
-  if (max_num_cores != 0) {
-    _num_cpus = std::min(_num_cpus, max_num_cores);
-  }
+  const auto num_hardware_cpus = std::thread::hardware_concurrency();
+  const auto isolated = isolated_cpus();
 
   auto cpus = std::vector<TopologyCpu>();
 
-  for (auto cpu_id = CpuID{0}; cpu_id < _num_cpus; cpu_id++) {
+  for (auto cpu_id = CpuID{0}; cpu_id < num_hardware_cpus; cpu_id++) {
+    if (max_num_cores != 0 && cpus.size() == max_num_cores) break;
+    if (isolated.count(cpu_id)) continue;
     cpus.emplace_back(TopologyCpu(cpu_id));
   }
+  _num_cpus = static_cast<uint32_t>(cpus.size());
+
+  if (!cpus.empty()) detect_cache_topology(cpus);
 
   auto node = TopologyNode(std::move(cpus));
   _nodes.emplace_back(std::move(node));
@@ -144,6 +216,8 @@ void Topology::_init_fake_numa_topology(uint32_t max_num_workers, uint32_t worke
       cpu_id++;
     }
 
+    if (!cpus.empty()) detect_cache_topology(cpus);
+
     auto node = TopologyNode(std::move(cpus));
 
     _nodes.emplace_back(std::move(node));
@@ -157,6 +231,29 @@ const std::vector<TopologyNode>& Topology::nodes() { return _nodes; }
 
 size_t Topology::num_cpus() const { return _num_cpus; }
 
+std::vector<CpuID> Topology::parse_cpu_list(const std::string& cpu_list) {
+  auto cpus = std::vector<CpuID>{};
+
+  auto stream = std::stringstream{cpu_list};
+  auto range = std::string{};
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) continue;
+
+    // Either a single CPU or a range of CPUs, e.g., "8-11"
+    const auto dash_position = range.find('-');
+    const auto first = static_cast<CpuID::base_type>(std::stoul(range.substr(0, dash_position)));
+    auto last = first;
+    if (dash_position != std::string::npos) {
+      last = static_cast<CpuID::base_type>(std::stoul(range.substr(dash_position + 1)));
+    }
+    for (auto cpu_id = first; cpu_id <= last; ++cpu_id) {
+      cpus.emplace_back(cpu_id);
+    }
+  }
+
+  return cpus;
+}
+
 boost::container::pmr::memory_resource* Topology::get_memory_resource(int node_id) {
   DebugAssert(node_id >= 0 && node_id < static_cast<int>(_nodes.size()), "node_id is out of bounds");
   return &_memory_resources[static_cast<size_t>(node_id)];
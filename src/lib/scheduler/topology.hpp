@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <ostream>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -19,10 +20,20 @@ class memory_resource;
 
 namespace opossum {
 
+/**
+ * A hardware thread. Its physical core and last-level cache are identified by the lowest id of the CPUs that share
+ * them, as read from sysfs. Without sysfs, each CPU is its own core and the CPUs of a node share a cache.
+ */
 struct TopologyCpu final {
-  explicit TopologyCpu(CpuID cpu_id) : cpu_id(cpu_id) {}
+  explicit TopologyCpu(CpuID cpu_id) : cpu_id(cpu_id), core_id(cpu_id), cache_domain_id(cpu_id) {}
 
   CpuID cpu_id = INVALID_CPU_ID;
+
+  // The SMT siblings of a physical core have the same core_id
+  CpuID core_id = INVALID_CPU_ID;
+
+  // CPUs that share the last-level cache (e.g., the L3 of a CCX on AMD EPYC) have the same cache_domain_id
+  CpuID cache_domain_id = INVALID_CPU_ID;
 };
 
 struct TopologyNode final {
@@ -39,6 +50,9 @@ struct TopologyNode final {
  * if needed, e.g. for testing purposes.
  *
  * The static 'use_*_topology()' methods replace the current topology information by the new one, and should be used carefully.
+ *
+ * CPUs that are isolated from the kernel's scheduler (isolcpus) are reserved for other processes and are left out of
+ * the NUMA and non-NUMA topologies.
  */
 class Topology final : public Singleton<Topology> {
  public:
@@ -83,6 +97,9 @@ class Topology final : public Singleton<Topology> {
 
   size_t num_cpus() const;
 
+  // Parses a list of CPUs in the format of sysfs, e.g., "0-3,8"
+  static std::vector<CpuID> parse_cpu_list(const std::string& cpu_list);
+
   boost::container::pmr::memory_resource* get_memory_resource(int node_id);
 
   void print(std::ostream& stream = std::cout, size_t indent = 0) const;
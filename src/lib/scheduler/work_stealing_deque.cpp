@@ -0,0 +1,124 @@
+#include "work_stealing_deque.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Takes ownership of a task obtained from the deque
+std::shared_ptr<AbstractTask> take_task(std::shared_ptr<AbstractTask>* task) {
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+}  // namespace
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const int64_t capacity)
+    : _capacity(capacity), _slots(std::make_unique<std::atomic<std::shared_ptr<AbstractTask>*>[]>(capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+}
+
+int64_t WorkStealingDeque::Buffer::capacity() const { return _capacity; }
+
+std::shared_ptr<AbstractTask>* WorkStealingDeque::Buffer::load(const int64_t index) const {
+  return _slots[index & (_capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::store(const int64_t index, std::shared_ptr<AbstractTask>* task) {
+  _slots[index & (_capacity - 1)].store(task, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(const size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(static_cast<int64_t>(initial_capacity)));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  const auto* buffer = _buffer.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < _bottom.load(std::memory_order_relaxed); ++index) {
+    delete buffer->load(index);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > buffer->capacity() - 1) {
+    // The buffer is full, continue with one of twice the size
+    auto grown_buffer = std::make_unique<Buffer>(buffer->capacity() * 2);
+    for (auto index = top; index < bottom; ++index) {
+      grown_buffer->store(index, buffer->load(index));
+    }
+    buffer = grown_buffer.get();
+    _buffers.emplace_back(std::move(grown_buffer));
+    _buffer.store(buffer, std::memory_order_release);
+  }
+
+  buffer->store(bottom, new std::shared_ptr<AbstractTask>(task));
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  // Reserve the bottom task before looking at the top, so that thieves cannot take it unnoticed
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* task = buffer->load(bottom);
+  if (top == bottom) {
+    // This is the last task, which a thief might be about to steal. Whoever advances the top first gets it.
+    const auto won_race =
+        _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!won_race) return nullptr;
+  }
+
+  return take_task(task);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  auto* task = _buffer.load(std::memory_order_acquire)->load(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // The owner or another thief took the task
+    return nullptr;
+  }
+
+  return take_task(task);
+}
+
+bool WorkStealingDeque::empty() const {
+  return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+}
+
+size_t WorkStealingDeque::size() const {
+  const auto size = _bottom.load(std::memory_order_relaxed) - _top.load(std::memory_order_relaxed);
+  return static_cast<size_t>(std::max(size, int64_t{0}));
+}
+
+}  // namespace opossum
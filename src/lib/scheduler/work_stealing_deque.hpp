@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free deque of the tasks spawned by a single Worker, following Chase and Lev, "Dynamic Circular Work-Stealing
+ * Deque" (SPAA 2005), with the memory orderings of Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+ * Models" (PPoPP 2013).
+ *
+ * Only the owning Worker pushes and pops, at the bottom. It thus executes the most recently spawned task first, whose
+ * data is the most likely to still be in its cache. Other Workers steal from the top, i.e., the oldest tasks. The owner
+ * only competes with thieves (in a single CAS) for the last task in the deque.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 64);
+  ~WorkStealingDeque();
+
+  // Only to be called by the owner
+  void push(const std::shared_ptr<AbstractTask>& task);
+  std::shared_ptr<AbstractTask> pop();
+
+  // Can be called by any thread. Returns nullptr if the deque is empty or another thread took the task first.
+  std::shared_ptr<AbstractTask> steal();
+
+  bool empty() const;
+  // Approximate if called by threads other than the owner
+  size_t size() const;
+
+ private:
+  // Circular buffer with a capacity that is a power of two. Its slots hold heap-allocated shared_ptrs, so that they can
+  // be read and written atomically. Exactly one of pop() and steal() obtains each task and frees its shared_ptr.
+  class Buffer {
+   public:
+    explicit Buffer(const int64_t capacity);
+
+    int64_t capacity() const;
+
+    std::shared_ptr<AbstractTask>* load(const int64_t index) const;
+    void store(const int64_t index, std::shared_ptr<AbstractTask>* task);
+
+   private:
+    const int64_t _capacity;
+    std::unique_ptr<std::atomic<std::shared_ptr<AbstractTask>*>[]> _slots;
+  };
+
+  // Top and bottom are written by different threads, so they are kept in separate cache lines
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // When the deque grows, thieves might still read from the previous buffer, so all buffers live as long as the deque
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
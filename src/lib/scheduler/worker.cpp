@@ -4,16 +4,22 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
+#include "scheduler_statistics.hpp"
+#include "scheduling_group.hpp"
 #include "task_queue.hpp"
+#include "utils/tracing/probes.hpp"
 
 namespace {
 
@@ -22,14 +28,21 @@ namespace {
  * Uses a weak_ptr, because otherwise the ref-count of it would not reach zero within the main() scope of the program.
  */
 thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
+
+// Parked Workers are woken by new tasks of their node. The timeout bounds how long they miss tasks that are only
+// available to them by stealing from other nodes.
+constexpr auto PARK_TIMEOUT = std::chrono::milliseconds{10};
 }  // namespace
 
 namespace opossum {
 
+static_assert(WorkerStatistics::PRIORITY_COUNT == TaskQueue::NUM_PRIORITY_LEVELS, "Expected one count per priority");
+
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id, CpuID cache_domain_id,
+               const std::chrono::microseconds spin_duration)
+    : _queue(queue), _id(id), _cpu_id(cpu_id), _cache_domain_id(cache_domain_id), _spin_duration(spin_duration) {}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -37,6 +50,8 @@ std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
+CpuID Worker::cache_domain_id() const { return _cache_domain_id; }
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker");
 
@@ -45,44 +60,174 @@ void Worker::operator()() {
   _set_affinity();
 
   while (CurrentScheduler::get()->active()) {
+    // A deactivated Worker still executes its local tasks, as these are stolen only by idle Workers of the same node
+    if (!_is_active && !has_local_tasks()) {
+      _wait_until_activated();
+      continue;
+    }
+
     _work();
   }
 }
 
 void Worker::_work() {
-  auto task = _queue->pull();
+  // Tasks spawned by this Worker come first, most recent first, as their data is likely to still be in the cache
+  auto task = _local_tasks.pop();
+
+  // The local tasks bypass the fair sharing of the TaskQueue. Thus, a group that has had more than its share of the
+  // Workers leaves its local task for later if the queue holds tasks of a group that has had less.
+  if (task && _should_make_way_for_queued_group(*task)) {
+    if (auto queued_task = _queue->pull()) {
+      DTRACE_PROBE3(HYRISE, TASK_DEQUEUED, queued_task->id(), static_cast<NodeID::base_type>(_queue->node_id()), _id);
+      _local_tasks.push(task);
+      task = std::move(queued_task);
+    }
+  }
 
   if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    auto work_stealing_successful = false;
-    for (auto& queue : CurrentScheduler::get()->queues()) {
-      if (queue == _queue) {
-        continue;
-      }
+    task = _queue->pull();
+    if (task) {
+      DTRACE_PROBE3(HYRISE, TASK_DEQUEUED, task->id(), static_cast<NodeID::base_type>(_queue->node_id()), _id);
+    }
+  }
+  if (!task) {
+    ++_num_steal_attempts;
+    task = _steal_task();
+    if (task) ++_num_successful_steals;
+  }
 
-      task = queue->steal();
-      if (task) {
-        task->set_node_id(_queue->node_id());
-        work_stealing_successful = true;
-        break;
-      }
+  // Spin and then park if there is no ready task in our queues and work stealing was not successful.
+  if (!task) {
+    const auto now = std::chrono::steady_clock::now();
+    if (!_idle_since) {
+      _idle_since = now;
+      DTRACE_PROBE1(HYRISE, WORKER_IDLE, _id);
+    }
+
+    if (now - *_idle_since < _spin_duration) {
+      std::this_thread::yield();
+    } else {
+      _queue->wait_for_task(PARK_TIMEOUT);
     }
+    const auto idle_time = std::chrono::steady_clock::now() - now;
+    _idle_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(idle_time).count();
+    return;
+  }
+  if (_idle_since) {
+    DTRACE_PROBE2(HYRISE, WORKER_ACTIVE, _id,
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - *_idle_since)
+                      .count());
+    _idle_since.reset();
+  }
+
+  _execute(task);
+}
+
+void Worker::_yield() {
+  if (_is_yielding) return;
+
+  const auto task = _queue->pull_preempting_task(AbstractTask::current_scheduling_group());
+  if (!task) return;
+  DTRACE_PROBE3(HYRISE, TASK_DEQUEUED, task->id(), static_cast<NodeID::base_type>(_queue->node_id()), _id);
+
+  _is_yielding = true;
+  ++_num_yielded_to_tasks;
+  _execute(task);
+  _is_yielding = false;
+}
+
+void Worker::_execute(const std::shared_ptr<AbstractTask>& task) {
+  auto current_task = task;
+  auto chain_length = size_t{0};
+
+  while (current_task) {
+    const auto start_time = std::chrono::steady_clock::now();
+    _wait_times.add(start_time - current_task->enqueue_time());
+
+    current_task->execute();
+
+    _execution_times.add(std::chrono::steady_clock::now() - start_time);
+    ++_num_finished_tasks_by_priority[static_cast<size_t>(current_task->priority())];
+
+    // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
+    // Scheduler to determine whether all tasks finished
+    _num_finished_tasks++;
+
+    // Continue with the successor that the task made ready, unless the chain has become too long or the successor's
+    // group has to make way for others. Tasks executed within the task (e.g., while it waited for its jobs) consumed
+    // their own continuations in their nested call of _execute().
+    current_task = std::move(_continuation);
+    _continuation = nullptr;
+    if (!current_task) break;
+
+    ++chain_length;
+    if (chain_length == MAX_CONTINUATION_CHAIN_LENGTH || _should_make_way_for_queued_group(*current_task)) {
+      _queue->push(current_task, static_cast<uint32_t>(SchedulePriority::High));
+      break;
+    }
+
+    // Someone else was first to enqueue the task (i.e., it was scheduled only after it became ready)? No problem!
+    if (!current_task->try_mark_as_enqueued()) break;
+    current_task->set_node_id(_queue->node_id());
+    ++_num_continued_tasks;
+  }
+}
+
+bool Worker::_should_make_way_for_queued_group(const AbstractTask& task) const {
+  if (!task.scheduling_group() || !_queue->has_grouped_tasks()) return false;
+
+  const auto lowest_queued_virtual_time = _queue->lowest_queued_virtual_time();
+  return lowest_queued_virtual_time && *lowest_queued_virtual_time < task.scheduling_group()->virtual_time();
+}
+
+void Worker::_wait_until_activated() {
+  const auto start_time = std::chrono::steady_clock::now();
+  {
+    std::unique_lock<std::mutex> lock(_activation_mutex);
+    _activation_condition.wait_for(lock, PARK_TIMEOUT, [&]() { return _is_active.load(); });
+  }
+
+  // The time a Worker is deactivated counts as idle time
+  const auto idle_time = std::chrono::steady_clock::now() - start_time;
+  _idle_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(idle_time).count();
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_task() const {
+  // Steal the oldest task of another Worker of the same node. These are not moved between nodes, as they are the
+  // tasks that Workers spawned for themselves and a non-stealable task cannot be put back into another Worker's deque.
+  // Workers that share our last-level cache are tried first, as stealing from other cache domains thrashes the caches.
+  for (const auto same_cache_domain : {true, false}) {
+    for (const auto& worker : CurrentScheduler::get()->workers()) {
+      if (worker.get() == this || worker->_queue != _queue) continue;
+      if ((worker->_cache_domain_id == _cache_domain_id) != same_cache_domain) continue;
 
-    // Sleep if there is no ready task in our queue and work stealing was not successful.
-    if (!work_stealing_successful) {
-      std::this_thread::sleep_for(std::chrono::milliseconds(10));
-      return;
+      if (auto task = worker->_local_tasks.steal()) {
+        DTRACE_PROBE3(HYRISE, TASK_STOLEN, task->id(), static_cast<NodeID::base_type>(_queue->node_id()), _id);
+        return task;
+      }
     }
   }
 
-  task->execute();
+  // Simple work stealing without explicitly transferring data between nodes.
+  for (auto& queue : CurrentScheduler::get()->queues()) {
+    if (queue == _queue) {
+      continue;
+    }
+
+    if (auto task = queue->steal()) {
+      DTRACE_PROBE3(HYRISE, TASK_STOLEN, task->id(), static_cast<NodeID::base_type>(queue->node_id()), _id);
+      task->set_node_id(_queue->node_id());
+      return task;
+    }
+  }
 
-  // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
-  // Scheduler to determine whether all tasks finished
-  _num_finished_tasks++;
+  return nullptr;
 }
 
-void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
+void Worker::start() {
+  _start_time = std::chrono::steady_clock::now();
+  _thread = std::thread(&Worker::operator(), this);
+}
 
 void Worker::join() {
   Assert(!CurrentScheduler::get()->active(), "Worker can't be join()-ed while the scheduler is still active");
@@ -91,6 +236,66 @@ void Worker::join() {
 
 uint64_t Worker::num_finished_tasks() const { return _num_finished_tasks; }
 
+WorkerStatistics Worker::statistics() const {
+  auto statistics = WorkerStatistics{};
+  statistics.worker_id = _id;
+  statistics.node_id = _queue->node_id();
+
+  // The idle time of a Worker that is currently idle is only added once it finishes spinning or parking
+  statistics.idle_time = std::chrono::nanoseconds{_idle_nanoseconds.load()};
+  const auto run_time =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start_time);
+  statistics.busy_time = std::max(run_time - statistics.idle_time, std::chrono::nanoseconds{0});
+
+  for (auto priority = size_t{0}; priority < WorkerStatistics::PRIORITY_COUNT; ++priority) {
+    statistics.finished_tasks_by_priority[priority] = _num_finished_tasks_by_priority[priority].load();
+  }
+  statistics.yielded_to_tasks = _num_yielded_to_tasks;
+  statistics.continued_tasks = _num_continued_tasks;
+  statistics.steal_attempts = _num_steal_attempts;
+  statistics.successful_steals = _num_successful_steals;
+  statistics.wait_times = _wait_times;
+  statistics.execution_times = _execution_times;
+
+  return statistics;
+}
+
+void Worker::push_local_task(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(get_this_thread_worker().get() == this, "Only the Worker itself can push to its local tasks");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _local_tasks.push(task);
+
+  // Parked Workers of the node can steal the task
+  _queue->notify_waiting_worker();
+}
+
+bool Worker::continue_with(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(get_this_thread_worker().get() == this, "Only the Worker itself can continue with a task");
+
+  // A deactivated Worker leaves the successor to the active ones
+  if (_continuation || !_is_active) return false;
+  _continuation = task;
+  return true;
+}
+
+void Worker::set_active(const bool active) {
+  {
+    std::lock_guard<std::mutex> lock(_activation_mutex);
+    _is_active = active;
+  }
+  _activation_condition.notify_one();
+}
+
+bool Worker::is_active() const { return _is_active; }
+
+bool Worker::has_local_tasks() const { return !_local_tasks.empty(); }
+
+size_t Worker::num_local_tasks() const { return _local_tasks.size(); }
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
@@ -1,20 +1,45 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <thread>
 #include <vector>
 
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/duration_histogram.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
+struct WorkerStatistics;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * Tasks that a Worker schedules for its own node are kept in its local WorkStealingDeque instead of the node's
+ * TaskQueue. The Worker executes them most recent first, idle Workers of the same node steal the oldest ones. Local
+ * tasks of a SchedulingGroup yield to queued tasks of groups with a lower virtual time.
+ *
+ * A Worker that finds no task keeps looking for spin_duration, so that it picks up tasks of a busy system without
+ * delay. Afterwards, it parks on its node's TaskQueue until it is woken by a new task, so that idle Workers do not
+ * occupy their CPUs.
+ *
+ * Long-running tasks call CurrentScheduler::yield() at points where they can be interrupted. If the Worker's queue
+ * holds a task that it serves before the running one (see TaskQueue::pull_preempting_task()), the Worker executes
+ * that task right away and then returns to the yielding task. Tasks executed at a yield point do not yield
+ * themselves, so that at most one task is suspended per Worker.
+ *
+ * A deactivated Worker (see NodeQueueScheduler::set_active_worker_count()) finishes its current task and its local
+ * tasks, and then sleeps until it is activated again, without pulling from the TaskQueue.
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class CurrentScheduler;
@@ -22,7 +47,9 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
  public:
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  // @param cache_domain_id of the CPU, see TopologyCpu
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id, CpuID cache_domain_id,
+         const std::chrono::microseconds spin_duration = std::chrono::microseconds{0});
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -30,18 +57,42 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   WorkerID id() const;
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
+  CpuID cache_domain_id() const;
 
   void start();
   void join();
 
   uint64_t num_finished_tasks() const;
 
+  // Activity of the Worker since it was started
+  WorkerStatistics statistics() const;
+
+  // Must only be called from the Worker's own thread
+  void push_local_task(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Lets the Worker execute @param task, a successor that became ready when the current task finished, right after
+   * the current task, while the task's input is still in the caches of the CPU. Returns false if the Worker already
+   * continues with another successor, which is then left to the TaskQueue. Must only be called from the Worker's own
+   * thread.
+   */
+  bool continue_with(const std::shared_ptr<AbstractTask>& task);
+
+  // Can be called from any thread
+  void set_active(const bool active);
+  bool is_active() const;
+
+  bool has_local_tasks() const;
+  size_t num_local_tasks() const;
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
  protected:
   void operator()();
   void _work();
+  void _yield();
+  void _execute(const std::shared_ptr<AbstractTask>& task);
 
   template <typename TaskType>
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
@@ -67,11 +118,49 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  // Returns a task stolen from another Worker of the same node or from the queue of another node, or nullptr
+  std::shared_ptr<AbstractTask> _steal_task() const;
+
+  // Whether a task that bypasses the TaskQueue (i.e., a local task or a continuation) has to make way for a queued
+  // task of a SchedulingGroup that has had less of its share of the Workers
+  bool _should_make_way_for_queued_group(const AbstractTask& task) const;
+
+  // Sleeps until the Worker is activated again or a timeout passes, so that it notices the shutdown of the scheduler
+  void _wait_until_activated();
+
+  // Continuations are executed one after another instead of recursively. A chain of continuations is cut after this
+  // many tasks, so that a deep plan does not occupy the Worker while tasks of other queries wait in the TaskQueue.
+  static constexpr auto MAX_CONTINUATION_CHAIN_LENGTH = size_t{64};
+
   std::shared_ptr<TaskQueue> _queue;
+  WorkStealingDeque _local_tasks;
   WorkerID _id;
   CpuID _cpu_id;
+  CpuID _cache_domain_id;
+  const std::chrono::microseconds _spin_duration;
+  // Time at which the Worker last found no task, unset while it finds tasks
+  std::optional<std::chrono::steady_clock::time_point> _idle_since;
+  // Set while the Worker executes a task at a yield point
+  bool _is_yielding{false};
+  // The successor to execute after the current task, see continue_with()
+  std::shared_ptr<AbstractTask> _continuation;
+  std::atomic_bool _is_active{true};
+  std::mutex _activation_mutex;
+  std::condition_variable _activation_condition;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
+
+  // For the statistics
+  std::chrono::steady_clock::time_point _start_time;
+  std::atomic<uint64_t> _idle_nanoseconds{0};
+  // Indexed by SchedulePriority
+  std::array<std::atomic<uint64_t>, 2> _num_finished_tasks_by_priority{};
+  std::atomic<uint64_t> _num_yielded_to_tasks{0};
+  std::atomic<uint64_t> _num_continued_tasks{0};
+  std::atomic<uint64_t> _num_steal_attempts{0};
+  std::atomic<uint64_t> _num_successful_steals{0};
+  DurationHistogram _wait_times;
+  DurationHistogram _execution_times;
 };
 
 }  // namespace opossum
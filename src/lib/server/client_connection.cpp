@@ -1,5 +1,7 @@
 #include "client_connection.hpp"
 
+#include <algorithm>
+
 #include <boost/asio.hpp>
 
 #include "postgres_wire_handler.hpp"
@@ -10,125 +12,154 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-const auto ignore_sent_bytes = [](uint64_t sent_bytes) {};
+const auto ignore_packet = [](const InputPacket& packet) {};
+
+template <typename PacketHandler>
+auto ClientConnection::_receive_packet_async(const size_t size, PacketHandler packet_handler) {
+  // We need a copy of this client connection to outlive the async operation
+  auto self = shared_from_this();
+  return _receive_bytes_async(size) >> then >>
+         [self, size, packet_handler]() { return packet_handler(self->_take_received_bytes(size)); };
+}
 
 ClientConnection::ClientConnection(boost::asio::ip::tcp::socket socket) : _socket(std::move(socket)) {
-  _response_buffer.reserve(_max_response_size);
+  _response_buffer.data.reserve(_max_response_size);
 }
 
-boost::future<uint32_t> ClientConnection::receive_startup_packet_header() {
+boost::future<StartupPacketHeader> ClientConnection::receive_startup_packet_header() {
   constexpr uint32_t STARTUP_HEADER_LENGTH = 8u;
 
-  return _receive_bytes_async(STARTUP_HEADER_LENGTH) >> then >> PostgresWireHandler::handle_startup_package;
+  return _receive_packet_async(STARTUP_HEADER_LENGTH, PostgresWireHandler::handle_startup_package);
 }
 
-boost::future<void> ClientConnection::receive_startup_packet_body(uint32_t size) {
-  return _receive_bytes_async(size) >> then >> [](InputPacket p) {
-    // Read these values and ignore them
-    PostgresWireHandler::handle_startup_package_content(p);
-  };
+boost::future<StartupParameters> ClientConnection::receive_startup_packet_body(uint32_t size) {
+  return _receive_packet_async(size, PostgresWireHandler::handle_startup_package_content);
+}
+
+boost::future<BackendKeyData> ClientConnection::receive_cancel_request_body(uint32_t size) {
+  return _receive_packet_async(size, PostgresWireHandler::handle_cancel_request_packet);
 }
 
 boost::future<RequestHeader> ClientConnection::receive_packet_header() {
   constexpr uint32_t HEADER_LENGTH = 5u;
 
-  return _receive_bytes_async(HEADER_LENGTH) >> then >> PostgresWireHandler::handle_header;
+  return _receive_packet_async(HEADER_LENGTH, PostgresWireHandler::handle_header);
 }
 
 boost::future<std::string> ClientConnection::receive_simple_query_packet_body(uint32_t size) {
-  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_query_packet;
+  return _receive_packet_async(size, PostgresWireHandler::handle_query_packet);
 }
 
 boost::future<ParsePacket> ClientConnection::receive_parse_packet_body(uint32_t size) {
-  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_parse_packet;
+  return _receive_packet_async(size, PostgresWireHandler::handle_parse_packet);
 }
 
 boost::future<BindPacket> ClientConnection::receive_bind_packet_body(uint32_t size) {
-  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_bind_packet;
+  return _receive_packet_async(size, PostgresWireHandler::handle_bind_packet);
 }
 
 boost::future<std::string> ClientConnection::receive_describe_packet_body(uint32_t size) {
-  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_describe_packet;
+  return _receive_packet_async(size, PostgresWireHandler::handle_describe_packet);
 }
 
 boost::future<void> ClientConnection::receive_sync_packet_body(uint32_t size) {
   // Packet has no content, we'll make the receive call anyways, just in case size > 0
-  return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
+  return _receive_packet_async(size, ignore_packet);
 }
 
 boost::future<void> ClientConnection::receive_flush_packet_body(uint32_t size) {
   // Packet has no content, we'll make the receive call anyways, just in case size > 0
-  return _receive_bytes_async(size) >> then >> [](InputPacket packet) {};
+  return _receive_packet_async(size, ignore_packet);
+}
+
+boost::future<ExecutePacket> ClientConnection::receive_execute_packet_body(uint32_t size) {
+  return _receive_packet_async(size, PostgresWireHandler::handle_execute_packet);
+}
+
+boost::future<std::string> ClientConnection::receive_copy_data_packet_body(uint32_t size) {
+  return _receive_packet_async(size, PostgresWireHandler::handle_copy_data_packet);
+}
+
+boost::future<void> ClientConnection::receive_copy_done_packet_body(uint32_t size) {
+  // Packet has no content, we'll make the receive call anyways, just in case size > 0
+  return _receive_packet_async(size, ignore_packet);
 }
 
-boost::future<std::string> ClientConnection::receive_execute_packet_body(uint32_t size) {
-  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_execute_packet;
+boost::future<std::string> ClientConnection::receive_copy_fail_packet_body(uint32_t size) {
+  return _receive_packet_async(size, PostgresWireHandler::handle_copy_fail_packet);
 }
 
 boost::future<void> ClientConnection::send_ssl_denied() {
-  // Don't use new_output_packet here, because this packet has special size requirements (only contains N, no size)
-  auto output_packet = std::make_shared<OutputPacket>();
-  PostgresWireHandler::write_value(*output_packet, NetworkMessageType::SslNo);
+  // Don't use _begin_message here, because this packet has special size requirements (only contains N, no size)
+  PostgresWireHandler::write_value(_response_buffer, NetworkMessageType::SslNo);
 
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  return _flush_async();
 }
 
 boost::future<void> ClientConnection::send_auth() {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::AuthenticationRequest);
-  PostgresWireHandler::write_value(*output_packet, htonl(0u));
+  const auto message_offset = _begin_message(NetworkMessageType::AuthenticationRequest);
+  PostgresWireHandler::write_value(_response_buffer, htonl(0u));
+
+  return _end_message(message_offset);
+}
+
+boost::future<void> ClientConnection::send_backend_key_data(const BackendKeyData& backend_key_data) {
+  const auto message_offset = _begin_message(NetworkMessageType::BackendKeyData);
+  PostgresWireHandler::write_value(_response_buffer, htonl(backend_key_data.process_id));
+  PostgresWireHandler::write_value(_response_buffer, htonl(backend_key_data.secret_key));
 
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  return _end_message(message_offset);
 }
 
 boost::future<void> ClientConnection::send_parameter_status(const std::string& key, const std::string& value) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::ParameterStatus);
-  PostgresWireHandler::write_string(*output_packet, key);
-  PostgresWireHandler::write_string(*output_packet, value);
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  const auto message_offset = _begin_message(NetworkMessageType::ParameterStatus);
+  PostgresWireHandler::write_string(_response_buffer, key);
+  PostgresWireHandler::write_string(_response_buffer, value);
+  return _end_message(message_offset);
 }
 
 boost::future<void> ClientConnection::send_ready_for_query() {
   // ReadyForQuery packet 'Z' with transaction status Idle 'I'
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::ReadyForQuery);
-  PostgresWireHandler::write_value(*output_packet, TransactionStatusIndicator::Idle);
+  const auto message_offset = _begin_message(NetworkMessageType::ReadyForQuery);
+  PostgresWireHandler::write_value(_response_buffer, TransactionStatusIndicator::Idle);
 
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  return _end_message(message_offset, true);
 }
 
 boost::future<void> ClientConnection::send_error(const std::string& message) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::ErrorResponse);
+  const auto message_offset = _begin_message(NetworkMessageType::ErrorResponse);
 
   // Send the error message with type info 'M' that indicates that the following body is a plain message to be displayed
-  PostgresWireHandler::write_value(*output_packet, NetworkMessageType::HumanReadableError);
-  PostgresWireHandler::write_string(*output_packet, message);
+  PostgresWireHandler::write_value(_response_buffer, NetworkMessageType::HumanReadableError);
+  PostgresWireHandler::write_string(_response_buffer, message);
 
   // Terminate the error response
-  PostgresWireHandler::write_value(*output_packet, '\0');
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  PostgresWireHandler::write_value(_response_buffer, '\0');
+  return _end_message(message_offset, true);
 }
 
 boost::future<void> ClientConnection::send_notice(const std::string& notice) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::Notice);
+  const auto message_offset = _begin_message(NetworkMessageType::Notice);
 
   // Send notice message with type info 'M' that indicates that the following body is a plain message to be displayed
-  PostgresWireHandler::write_value(*output_packet, NetworkMessageType::HumanReadableError);
-  PostgresWireHandler::write_string(*output_packet, notice);
+  PostgresWireHandler::write_value(_response_buffer, NetworkMessageType::HumanReadableError);
+  PostgresWireHandler::write_string(_response_buffer, notice);
 
   // Terminate the notice response
-  PostgresWireHandler::write_value(*output_packet, '\0');
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  PostgresWireHandler::write_value(_response_buffer, '\0');
+  return _end_message(message_offset, true);
 }
 
 boost::future<void> ClientConnection::send_status_message(const NetworkMessageType& type) {
-  auto output_packet = PostgresWireHandler::new_output_packet(type);
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  const auto message_offset = _begin_message(type);
+  return _end_message(message_offset);
 }
 
 boost::future<void> ClientConnection::send_row_description(const std::vector<ColumnDescription>& row_description) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::RowDescription);
+  const auto message_offset = _begin_message(NetworkMessageType::RowDescription);
 
   // Int16 Specifies the number of fields in a row (can be zero).
-  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_description.size())));
+  PostgresWireHandler::write_value(_response_buffer, htons(static_cast<uint16_t>(row_description.size())));
 
   /* FROM: https://www.postgresql.org/docs/current/static/protocol-message-formats.html
    *
@@ -159,23 +190,24 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
    */
 
   for (const auto& column_description : row_description) {
-    PostgresWireHandler::write_string(*output_packet, column_description.column_name);
-    PostgresWireHandler::write_value(*output_packet, htonl(0u));  // no object id
-    PostgresWireHandler::write_value(*output_packet, htons(0u));  // no attribute number
+    PostgresWireHandler::write_string(_response_buffer, column_description.column_name);
+    PostgresWireHandler::write_value(_response_buffer, htonl(0u));  // no object id
+    PostgresWireHandler::write_value(_response_buffer, htons(0u));  // no attribute number
 
-    PostgresWireHandler::write_value(*output_packet,
+    PostgresWireHandler::write_value(_response_buffer,
                                      htonl(static_cast<uint32_t>(column_description.object_id)));  // object id of type
-    PostgresWireHandler::write_value(*output_packet,
+    PostgresWireHandler::write_value(_response_buffer,
                                      htons(static_cast<uint16_t>(column_description.type_width)));  // regular int
-    PostgresWireHandler::write_value(*output_packet, htonl(-1));                                    // no modifier
-    PostgresWireHandler::write_value(*output_packet, htons(0u));                                    // text format
+    PostgresWireHandler::write_value(_response_buffer, htonl(-1));                                    // no modifier
+    PostgresWireHandler::write_value(_response_buffer,
+                                     htons(static_cast<uint16_t>(column_description.format_code)));  // text or binary
   }
 
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  return _end_message(message_offset);
 }
 
 boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
+  const auto message_offset = _begin_message(NetworkMessageType::DataRow);
 
   /*
   DataRow (B)
@@ -199,77 +231,116 @@ boost::future<void> ClientConnection::send_data_row(const std::vector<std::strin
   */
 
   // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_strings.size())));
+  PostgresWireHandler::write_value(_response_buffer, htons(static_cast<uint16_t>(row_strings.size())));
 
   for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value_string.length())));
+    // Size of the string representation of the value in text format, of the encoded value in binary format
+    PostgresWireHandler::write_value(_response_buffer, htonl(static_cast<uint32_t>(value_string.length())));
 
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
+    // In both formats, the values are sent as non-terminated byte sequences
+    PostgresWireHandler::write_string(_response_buffer, value_string, false);
   }
 
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  return _end_message(message_offset);
 }
 
 boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::CommandComplete);
-  PostgresWireHandler::write_string(*output_packet, message);
+  const auto message_offset = _begin_message(NetworkMessageType::CommandComplete);
+  PostgresWireHandler::write_string(_response_buffer, message);
 
-  return _send_bytes_async(output_packet, true) >> then >> ignore_sent_bytes;
+  return _end_message(message_offset);
 }
 
-boost::future<InputPacket> ClientConnection::_receive_bytes_async(size_t size) {
-  auto result = std::make_shared<InputPacket>();
-  result->data.resize(size);
+boost::future<void> ClientConnection::send_copy_in_response(const FormatCode format_code, const size_t column_count) {
+  // The client waits for this message before it sends the data
+  return _send_copy_response(NetworkMessageType::CopyInResponse, format_code, column_count, true);
+}
+
+boost::future<void> ClientConnection::send_copy_out_response(const FormatCode format_code, const size_t column_count) {
+  return _send_copy_response(NetworkMessageType::CopyOutResponse, format_code, column_count, false);
+}
+
+boost::future<void> ClientConnection::send_copy_data(const std::string& data) {
+  const auto message_offset = _begin_message(NetworkMessageType::CopyData);
+  PostgresWireHandler::write_string(_response_buffer, data, false);
+
+  return _end_message(message_offset);
+}
+
+boost::future<void> ClientConnection::_send_copy_response(const NetworkMessageType type, const FormatCode format_code,
+                                                          const size_t column_count, const bool flush) {
+  const auto message_offset = _begin_message(type);
+
+  // The overall format, followed by the format of each column, which is the same for all columns
+  PostgresWireHandler::write_value(_response_buffer, static_cast<int8_t>(format_code));
+  PostgresWireHandler::write_value(_response_buffer, htons(static_cast<uint16_t>(column_count)));
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    PostgresWireHandler::write_value(_response_buffer, htons(static_cast<uint16_t>(format_code)));
+  }
+
+  return _end_message(message_offset, flush);
+}
+
+boost::future<void> ClientConnection::flush() {
+  if (_response_buffer.data.empty()) return boost::make_ready_future();
+
+  return _flush_async();
+}
+
+boost::future<void> ClientConnection::_receive_bytes_async(size_t size) {
+  const auto buffered_size = _receive_buffer.size() - _receive_buffer_offset;
+  if (buffered_size >= size) return boost::make_ready_future();
+
+  // Keep the bytes that were not consumed yet and read at least the missing ones, plus whatever else has arrived
+  _receive_buffer.erase(_receive_buffer.begin(), _receive_buffer.begin() + _receive_buffer_offset);
+  _receive_buffer_offset = 0;
+  const auto missing_size = size - buffered_size;
+  _receive_buffer.resize(buffered_size + std::max(missing_size, static_cast<size_t>(_max_receive_size)));
 
   // We need a copy of this client connection to outlive the async operation
   auto self = shared_from_this();
-  return _socket.async_read_some(boost::asio::buffer(result->data, size), boost::asio::use_boost_future) >> then >>
-         [self, result, size](uint64_t received_size) {
-           // If this assertion should fail, we will end up in either the error handler for the current command or
-           // the entire session. The connection may be closed but the server will keep running either way.
-           Assert(received_size == size, "Client sent less data than expected.");
-
-           result->offset = result->data.begin();
-           return std::move(*result);
+  return boost::asio::async_read(
+             _socket,
+             boost::asio::buffer(_receive_buffer.data() + buffered_size, _receive_buffer.size() - buffered_size),
+             boost::asio::transfer_at_least(missing_size), boost::asio::use_boost_future) >>
+         then >> [self, buffered_size, size](uint64_t received_size) {
+           // async_read only completes early if the connection was closed, in which case it reports an error. If this
+           // assertion should still fail, we will end up in either the error handler for the current command or the
+           // entire session. The connection may be closed but the server will keep running either way.
+           Assert(buffered_size + received_size >= size, "Client sent less data than expected.");
+
+           self->_receive_buffer.resize(buffered_size + received_size);
          };
 }
 
-boost::future<uint64_t> ClientConnection::_send_bytes_async(const std::shared_ptr<OutputPacket>& packet, bool flush) {
-  const auto packet_size = packet->data.size();
+InputPacket ClientConnection::_take_received_bytes(size_t size) {
+  DebugAssert(_receive_buffer.size() - _receive_buffer_offset >= size, "Bytes have not been received yet.");
 
-  // If the packet is SslNo (size == 1), it has a special format and does not require a size
-  if (packet_size > 1) {
-    PostgresWireHandler::write_output_packet_size(*packet);
-  }
+  const auto begin = _receive_buffer.data() + _receive_buffer_offset;
+  _receive_buffer_offset += size;
+  return InputPacket{begin, begin + size};
+}
 
-  // If this fails, the connection may be closed but the server will keep running.
-  Assert(packet_size <= _max_response_size,
-         "The output packet is too big and cannot be sent. This should never happen!");
+size_t ClientConnection::_begin_message(NetworkMessageType type) {
+  return PostgresWireHandler::begin_output_message(_response_buffer, type);
+}
 
-  if (_response_buffer.size() + packet_size > _max_response_size) {
-    // We have to flush before we can actually process the data
-    return _flush_async() >> then >> [=](uint64_t) { return _send_bytes_async(packet, flush); };
-  }
+boost::future<void> ClientConnection::_end_message(size_t message_offset, bool flush) {
+  PostgresWireHandler::write_output_packet_size(_response_buffer, message_offset);
 
-  _response_buffer.insert(_response_buffer.end(), packet->data.begin(), packet->data.end());
+  // A single message may exceed the maximum size, it is then sent on its own
+  if (flush || _response_buffer.data.size() >= _max_response_size) return _flush_async();
 
-  if (flush) {
-    return _flush_async() >> then >> [=](uint64_t) { return static_cast<uint64_t>(packet_size); };
-  } else {
-    // Return an already resolved future (we have just written data to the buffer)
-    return boost::make_ready_future<uint64_t>(packet_size);
-  }
+  return boost::make_ready_future();
 }
 
-boost::future<uint64_t> ClientConnection::_flush_async() {
-  return _socket.async_send(boost::asio::buffer(_response_buffer), boost::asio::use_boost_future) >> then >>
+boost::future<void> ClientConnection::_flush_async() {
+  return _socket.async_send(boost::asio::buffer(_response_buffer.data), boost::asio::use_boost_future) >> then >>
          [=](uint64_t sent_bytes) {
            // If this fails, the connection may be closed but the server will keep running.
-           Assert(sent_bytes == _response_buffer.size(), "Could not send all data");
-           _response_buffer.clear();
-           return static_cast<uint64_t>(sent_bytes);
+           Assert(sent_bytes == _response_buffer.data.size(), "Could not send all data");
+           _response_buffer.data.clear();
          };
 }
+
 }  // namespace opossum
@@ -5,20 +5,23 @@
 
 #include <memory>
 
+#include "server/postgres_wire_handler.hpp"
+#include "server/types.hpp"
+
 namespace opossum {
 
 using ByteBuffer = std::vector<char>;
 struct InputPacket;
-struct OutputPacket;
 struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
-enum class NetworkMessageType : unsigned char;
+struct ExecutePacket;
 
 struct ColumnDescription {
   std::string column_name;
   uint64_t object_id;
   int64_t type_width;
+  FormatCode format_code = FormatCode::Text;
 };
 
 // This class provides a wrapper over the TCP socket and (de)serializes
@@ -28,8 +31,9 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
  public:
   explicit ClientConnection(boost::asio::ip::tcp::socket socket);
 
-  boost::future<uint32_t> receive_startup_packet_header();
-  boost::future<void> receive_startup_packet_body(uint32_t size);
+  boost::future<StartupPacketHeader> receive_startup_packet_header();
+  boost::future<StartupParameters> receive_startup_packet_body(uint32_t size);
+  boost::future<BackendKeyData> receive_cancel_request_body(uint32_t size);
 
   boost::future<RequestHeader> receive_packet_header();
   boost::future<std::string> receive_simple_query_packet_body(uint32_t size);
@@ -38,10 +42,14 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<std::string> receive_describe_packet_body(uint32_t size);
   boost::future<void> receive_sync_packet_body(uint32_t size);
   boost::future<void> receive_flush_packet_body(uint32_t size);
-  boost::future<std::string> receive_execute_packet_body(uint32_t size);
+  boost::future<ExecutePacket> receive_execute_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_data_packet_body(uint32_t size);
+  boost::future<void> receive_copy_done_packet_body(uint32_t size);
+  boost::future<std::string> receive_copy_fail_packet_body(uint32_t size);
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
+  boost::future<void> send_backend_key_data(const BackendKeyData& backend_key_data);
   boost::future<void> send_parameter_status(const std::string& key, const std::string& value);
   boost::future<void> send_ready_for_query();
   boost::future<void> send_error(const std::string& message);
@@ -50,18 +58,48 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
   boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
   boost::future<void> send_command_complete(const std::string& message);
+  boost::future<void> send_copy_in_response(FormatCode format_code, size_t column_count);
+  boost::future<void> send_copy_out_response(FormatCode format_code, size_t column_count);
+  boost::future<void> send_copy_data(const std::string& data);
+
+  // Sends the buffered responses. Responses are also sent once the buffer is full and with every ReadyForQuery, error,
+  // and notice, so that the responses to a pipeline of extended query messages are sent together at its Sync.
+  boost::future<void> flush();
 
  protected:
-  boost::future<InputPacket> _receive_bytes_async(size_t size);
+  // Receives @param size bytes and passes them to @param packet_handler, which has to read everything it needs from
+  // them, as they are only valid until the next receive call
+  template <typename PacketHandler>
+  auto _receive_packet_async(size_t size, PacketHandler packet_handler);
+
+  // Reads from the socket until at least @param size bytes are in the receive buffer
+  boost::future<void> _receive_bytes_async(size_t size);
 
-  boost::future<uint64_t> _send_bytes_async(const std::shared_ptr<OutputPacket>& packet, bool flush = false);
-  boost::future<uint64_t> _flush_async();
+  // Returns the next @param size bytes of the receive buffer without copying them
+  InputPacket _take_received_bytes(size_t size);
+
+  // Messages are written directly into the response buffer, starting with _begin_message(). _end_message() fills in
+  // the size of the message and sends the buffer if it is full or @param flush is set.
+  size_t _begin_message(NetworkMessageType type);
+  boost::future<void> _end_message(size_t message_offset, bool flush = false);
+  boost::future<void> _flush_async();
+
+  // CopyInResponse and CopyOutResponse only differ in their type
+  boost::future<void> _send_copy_response(NetworkMessageType type, FormatCode format_code, size_t column_count,
+                                          bool flush);
 
   boost::asio::ip::tcp::socket _socket;
 
-  // Max 2048 bytes per IP packet sent
+  // The buffered responses are sent once they exceed this size. The buffer keeps its capacity after it was sent, so
+  // that writing responses does not allocate memory in the steady state.
   uint32_t _max_response_size = 2048;
-  ByteBuffer _response_buffer;
+  OutputPacket _response_buffer;
+
+  // Clients send the messages of a pipeline back to back, so everything that has arrived is read at once and the
+  // following messages are taken from this buffer, starting at the offset
+  uint32_t _max_receive_size = 4096;
+  ByteBuffer _receive_buffer;
+  size_t _receive_buffer_offset = 0;
 };
 
 }  // namespace opossum
@@ -1,15 +1,78 @@
 #include "postgres_wire_handler.hpp"
 
+#include <cstring>
 #include <iostream>
 #include <iterator>
 
+#include "resolve_type.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Object IDs of the Postgres types, see https://github.com/postgres/postgres/blob/master/src/include/catalog/pg_type.h
+constexpr uint32_t UNSPECIFIED_TYPE_ID = 0;
+constexpr uint32_t INT2_TYPE_ID = 21;
+constexpr uint32_t INT4_TYPE_ID = 23;
+constexpr uint32_t INT8_TYPE_ID = 20;
+constexpr uint32_t FLOAT4_TYPE_ID = 700;
+constexpr uint32_t FLOAT8_TYPE_ID = 701;
+constexpr uint32_t TEXT_TYPE_ID = 25;
+constexpr uint32_t VARCHAR_TYPE_ID = 1043;
+
+std::vector<FormatCode> read_format_codes(const InputPacket& packet) {
+  const auto num_format_codes = ntohs(PostgresWireHandler::read_value<uint16_t>(packet));
+  const auto network_format_codes = PostgresWireHandler::read_values<uint16_t>(packet, num_format_codes);
+
+  auto format_codes = std::vector<FormatCode>{};
+  format_codes.reserve(num_format_codes);
+  for (const auto network_format_code : network_format_codes) {
+    const auto format_code = ntohs(network_format_code);
+    Assert(format_code <= static_cast<uint16_t>(FormatCode::Binary), "Unknown format code.");
+    format_codes.emplace_back(static_cast<FormatCode>(format_code));
+  }
+  return format_codes;
+}
+
+// Reads the bytes as an unsigned integer in network byte order, independent of the host's byte order
+template <typename T>
+T from_network_bytes(const std::string& bytes) {
+  Assert(bytes.size() == sizeof(T), "Binary value has an unexpected size.");
+
+  auto value = T{0};
+  for (const auto byte : bytes) {
+    value = static_cast<T>(value << 8 | static_cast<unsigned char>(byte));
+  }
+  return value;
+}
+
+template <typename T>
+std::string to_network_bytes(T value) {
+  auto bytes = std::string(sizeof(T), '\0');
+  for (auto byte_index = sizeof(T); byte_index > 0; --byte_index) {
+    bytes[byte_index - 1] = static_cast<char>(value & 0xFF);
+    value >>= 8;
+  }
+  return bytes;
+}
+
+// Floating point numbers are sent as their IEEE 754 representation
+template <typename Target, typename Source>
+Target copy_bits(const Source source) {
+  static_assert(sizeof(Target) == sizeof(Source), "Can only copy the bits between types of equal size");
+  auto target = Target{};
+  std::memcpy(&target, &source, sizeof(Target));
+  return target;
+}
+
+}  // namespace
+
 namespace opossum {
 
-uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet) {
+StartupPacketHeader PostgresWireHandler::handle_startup_package(const InputPacket& packet) {
   auto network_length = read_value<uint32_t>(packet);
   // We ALWAYS need to convert from network endianess to host endianess with these fancy macros
   // ntohl = network to host long and htonl = host to network long (where long = uint32)
@@ -21,20 +84,34 @@ uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet)
   auto version = ntohl(network_version);
 
   // Reset data buffer
-  packet.offset = packet.data.cbegin();
-
-  // Special SSL version number that we catch to deny SSL support
-  if (version == 80877103) {
-    return 0;
-  } else {
-    // Subtract read bytes from total length
-    return length - (2 * sizeof(uint32_t));
+  packet.offset = packet.begin;
+
+  // Special version numbers that denote an SSL request, which we deny, and a CancelRequest
+  if (version == 80877103) return {StartupPacketType::SslRequest, 0};
+
+  // Subtract read bytes from total length
+  const auto payload_length = static_cast<uint32_t>(length - (2 * sizeof(uint32_t)));
+  if (version == 80877102) return {StartupPacketType::CancelRequest, payload_length};
+  return {StartupPacketType::Startup, payload_length};
+}
+
+StartupParameters PostgresWireHandler::handle_startup_package_content(const InputPacket& packet) {
+  // Pairs of parameter name and value, terminated by an empty name
+  auto parameters = StartupParameters{};
+  while (packet.offset < packet.end) {
+    auto name = read_string(packet);
+    if (name.empty()) break;
+    parameters[name] = read_string(packet);
   }
+
+  packet.offset = packet.end;
+  return parameters;
 }
 
-void PostgresWireHandler::handle_startup_package_content(const InputPacket& packet) {
-  // Ignore the content, because we don't care about the variables that were passed in.
-  read_values<char>(packet, packet.data.size());
+BackendKeyData PostgresWireHandler::handle_cancel_request_packet(const InputPacket& packet) {
+  const auto process_id = ntohl(read_value<uint32_t>(packet));
+  const auto secret_key = ntohl(read_value<uint32_t>(packet));
+  return BackendKeyData{process_id, secret_key};
 }
 
 RequestHeader PostgresWireHandler::handle_header(const InputPacket& packet) {
@@ -43,7 +120,7 @@ RequestHeader PostgresWireHandler::handle_header(const InputPacket& packet) {
   auto network_length = read_value<uint32_t>(packet);
   auto length = ntohl(network_length);
 
-  packet.offset = packet.data.begin();
+  packet.offset = packet.begin;
 
   // Return length minus the already read bytes (the message type doesn't count into the length)
   return {/* message_type = */ tag, /* payload_length = */ static_cast<uint32_t>(length - sizeof(network_length))};
@@ -56,11 +133,14 @@ ParsePacket PostgresWireHandler::handle_parse_packet(const InputPacket& packet)
 
   auto query = read_string(packet);
 
-  auto network_parameter_data_types = read_value<uint16_t>(packet);
+  auto num_parameter_types = ntohs(read_value<uint16_t>(packet));
 
-  /*auto parameter_data_types = */ read_values<uint32_t>(packet, network_parameter_data_types);
+  auto parameter_types = read_values<uint32_t>(packet, num_parameter_types);
+  for (auto& parameter_type : parameter_types) {
+    parameter_type = ntohl(parameter_type);
+  }
 
-  return ParsePacket{std::move(statement_name), std::move(query)};
+  return ParsePacket{std::move(statement_name), std::move(query), std::move(parameter_types)};
 }
 
 BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
@@ -68,32 +148,41 @@ BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
 
   auto statement_name = read_string(packet);
 
-  auto num_format_codes = ntohs(read_value<int16_t>(packet));
-
-  auto format_codes = read_values<int16_t>(packet, num_format_codes);
+  auto parameter_format_codes = read_format_codes(packet);
 
   auto num_parameter_values = ntohs(read_value<int16_t>(packet));
 
   std::vector<AllTypeVariant> parameter_values;
   for (auto i = 0; i < num_parameter_values; ++i) {
-    auto parameter_value_length = ntohl(read_value<int32_t>(packet));
-    auto x = read_values<char>(packet, parameter_value_length);
-    const std::string x_str(x.begin(), x.end());
-    parameter_values.emplace_back(x_str);
+    // A length of -1 denotes NULL, in which case no value bytes follow
+    auto parameter_value_length = static_cast<int32_t>(ntohl(read_value<uint32_t>(packet)));
+    if (parameter_value_length == -1) {
+      parameter_values.emplace_back(NullValue{});
+      continue;
+    }
+
+    parameter_values.emplace_back(read_bytes(packet, static_cast<size_t>(parameter_value_length)));
   }
 
-  auto num_result_column_format_codes = ntohs(read_value<int16_t>(packet));
-  auto result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
+  auto result_format_codes = read_format_codes(packet);
 
-  return BindPacket{statement_name, portal, std::move(parameter_values)};
+  return BindPacket{statement_name, portal, std::move(parameter_values), std::move(parameter_format_codes),
+                    std::move(result_format_codes)};
 }
 
-std::string PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
-  const auto portal = read_string(packet);
-  /*const auto max_rows = */ read_value<int32_t>(packet);
-  return portal;
+ExecutePacket PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
+  auto portal = read_string(packet);
+  const auto max_rows = ntohl(read_value<uint32_t>(packet));
+  return ExecutePacket{std::move(portal), max_rows};
+}
+
+std::string PostgresWireHandler::handle_copy_data_packet(const InputPacket& packet) {
+  // The data is not split at row boundaries, so it is returned as is
+  return read_bytes(packet, static_cast<size_t>(packet.end - packet.offset));
 }
 
+std::string PostgresWireHandler::handle_copy_fail_packet(const InputPacket& packet) { return read_string(packet); }
+
 std::string PostgresWireHandler::handle_describe_packet(const InputPacket& packet) {
   read_value<char>(packet);
   const auto portal = read_string(packet);
@@ -101,13 +190,8 @@ std::string PostgresWireHandler::handle_describe_packet(const InputPacket& packe
 }
 
 void PostgresWireHandler::write_string(OutputPacket& packet, const std::string& value, bool terminate) {
-  auto num_bytes = value.length();
   auto& data = packet.data;
 
-  // Add one byte more for terminated string
-  auto total_size = data.size() + num_bytes + (terminate ? 1 : 0);
-  data.reserve(total_size);
-
   data.insert(data.end(), value.cbegin(), value.cend());
 
   if (terminate) {
@@ -116,39 +200,114 @@ void PostgresWireHandler::write_string(OutputPacket& packet, const std::string&
   }
 }
 
-std::shared_ptr<OutputPacket> PostgresWireHandler::new_output_packet(NetworkMessageType type) {
-  auto output_packet = std::make_shared<OutputPacket>();
-  write_value(*output_packet, type);
-  write_value(*output_packet, htonl(0u));
-  return output_packet;
+size_t PostgresWireHandler::begin_output_message(OutputPacket& packet, NetworkMessageType type) {
+  const auto message_offset = packet.data.size();
+  write_value(packet, type);
+  write_value(packet, htonl(0u));
+  return message_offset;
 }
 
-void PostgresWireHandler::write_output_packet_size(OutputPacket& packet) {
+void PostgresWireHandler::write_output_packet_size(OutputPacket& packet, const size_t message_offset) {
   auto& data = packet.data;
   Assert(
-      data.size() >= 5,
+      data.size() >= message_offset + 5,
       "Cannot update the packet size of a packet which is less than NetworkIMessageType + dummy size (i.e. 5 bytes)");
 
   // - 1 because the message type byte does not contribute to the total size
-  auto total_bytes = htonl(static_cast<uint32_t>(data.size() - 1));
+  auto total_bytes = htonl(static_cast<uint32_t>(data.size() - message_offset - 1));
   auto size_chars = reinterpret_cast<char*>(&total_bytes);
 
-  // The size starts at byte position 1
-  const auto size_offset = 1u;
+  // The size starts at byte position 1 of the message
+  const auto size_offset = message_offset + 1u;
   for (auto byte_offset = 0u; byte_offset < sizeof(total_bytes); ++byte_offset) {
     data[size_offset + byte_offset] = size_chars[byte_offset];
   }
 }
 
+FormatCode PostgresWireHandler::format_code(const std::vector<FormatCode>& format_codes, const size_t index) {
+  if (format_codes.empty()) return FormatCode::Text;
+  if (format_codes.size() == 1) return format_codes.front();
+
+  Assert(index < format_codes.size(), "Number of format codes does not match the number of values.");
+  return format_codes[index];
+}
+
+AllTypeVariant PostgresWireHandler::decode_binary_value(const std::string& bytes, const uint32_t type_id) {
+  switch (type_id) {
+    case INT2_TYPE_ID:
+      return static_cast<int32_t>(static_cast<int16_t>(from_network_bytes<uint16_t>(bytes)));
+    case INT4_TYPE_ID:
+      return static_cast<int32_t>(from_network_bytes<uint32_t>(bytes));
+    case INT8_TYPE_ID:
+      return static_cast<int64_t>(from_network_bytes<uint64_t>(bytes));
+    case FLOAT4_TYPE_ID:
+      return copy_bits<float>(from_network_bytes<uint32_t>(bytes));
+    case FLOAT8_TYPE_ID:
+      return copy_bits<double>(from_network_bytes<uint64_t>(bytes));
+    case TEXT_TYPE_ID:
+    case VARCHAR_TYPE_ID:
+      return bytes;
+    case UNSPECIFIED_TYPE_ID:
+      if (bytes.size() == sizeof(int32_t)) return static_cast<int32_t>(from_network_bytes<uint32_t>(bytes));
+      if (bytes.size() == sizeof(int64_t)) return static_cast<int64_t>(from_network_bytes<uint64_t>(bytes));
+      Fail("Cannot decode binary parameter of unspecified type.");
+    default:
+      Fail("Unsupported type of binary parameter.");
+  }
+}
+
+std::string PostgresWireHandler::encode_binary_value(const AllTypeVariant& value) {
+  switch (data_type_from_all_type_variant(value)) {
+    case DataType::Int:
+      return to_network_bytes(static_cast<uint32_t>(boost::get<int32_t>(value)));
+    case DataType::Long:
+      return to_network_bytes(static_cast<uint64_t>(boost::get<int64_t>(value)));
+    case DataType::Float:
+      return to_network_bytes(copy_bits<uint32_t>(boost::get<float>(value)));
+    case DataType::Double:
+      return to_network_bytes(copy_bits<uint64_t>(boost::get<double>(value)));
+    case DataType::String:
+      return boost::get<std::string>(value);
+    default:
+      Fail("Value cannot be sent in binary format.");
+  }
+}
+
+uint32_t PostgresWireHandler::type_id(const DataType data_type) {
+  switch (data_type) {
+    case DataType::Int:
+      return INT4_TYPE_ID;
+    case DataType::Long:
+      return INT8_TYPE_ID;
+    case DataType::Float:
+      return FLOAT4_TYPE_ID;
+    case DataType::Double:
+      return FLOAT8_TYPE_ID;
+    case DataType::String:
+      return TEXT_TYPE_ID;
+    default:
+      Fail("Data type has no corresponding Postgres type.");
+  }
+}
+
 std::string PostgresWireHandler::read_string(const InputPacket& packet) {
-  if (packet.offset == packet.data.cend()) return "";
+  if (packet.offset == packet.end) return "";
 
   // We have to convert the byte buffer into a std::string, making sure
   // we don't run past the end of the buffer and stop at the first null byte
-  auto string_end = std::find(packet.offset, packet.data.cend(), '\0');
+  auto string_end = std::find(packet.offset, packet.end, '\0');
   std::string result(packet.offset, string_end);
 
-  packet.offset += result.length() + 1;
+  packet.offset = std::min(string_end + 1, packet.end);
+
+  return result;
+}
+
+std::string PostgresWireHandler::read_bytes(const InputPacket& packet, const size_t num_bytes) {
+  Assert(num_bytes <= static_cast<size_t>(packet.end - packet.offset), "Reading too many bytes from buffer.");
+
+  std::string result(packet.offset, packet.offset + num_bytes);
+  packet.offset += num_bytes;
 
   return result;
 }
@@ -3,10 +3,12 @@
 #include <arpa/inet.h>
 #include <algorithm>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "SQLParserResult.h"
 #include "all_parameter_variant.hpp"
+#include "server/types.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "types.hpp"
 
@@ -15,20 +17,40 @@ namespace opossum {
 // For convenience
 using ByteBuffer = std::vector<char>;
 
-// This is the struct that we store our incoming network bytes in and that we then read from
+// A view on incoming network bytes that we then read from. The packet does not own the bytes, they stay in the
+// receive buffer of the ClientConnection (or in the buffer the packet was created from) and have to outlive it.
 struct InputPacket {
-  // The vector needs to have a fixed size for boost::asio to work with it
-  ByteBuffer data;
+  InputPacket() = default;
+  InputPacket(const char* bytes_begin, const char* bytes_end) : begin(bytes_begin), end(bytes_end), offset(begin) {}
+  explicit InputPacket(const ByteBuffer& buffer) : InputPacket(buffer.data(), buffer.data() + buffer.size()) {}
+
+  size_t size() const { return static_cast<size_t>(end - begin); }
+
+  const char* begin = nullptr;
+  const char* end = nullptr;
 
-  // Stores the current position in the data buffer
-  mutable ByteBuffer::const_iterator offset = data.begin();
+  // Stores the current position in the bytes
+  mutable const char* offset = nullptr;
 };
 
-// This is the struct in which we write our network bytes and then send
+// This is the struct in which we write our network bytes and then send. The ClientConnection writes all messages into
+// one such packet, which is reused after it has been sent.
 struct OutputPacket {
   ByteBuffer data;
 };
 
+// A new connection starts with a startup message, unless it requests SSL first or only cancels the query of another
+// session
+enum class StartupPacketType { Startup, SslRequest, CancelRequest };
+
+struct StartupPacketHeader {
+  StartupPacketType type;
+  uint32_t payload_length;
+};
+
+// The parameters that the client passes in the startup message, e.g., user, database, and options
+using StartupParameters = std::unordered_map<std::string, std::string>;
+
 struct RequestHeader {
   NetworkMessageType message_type;
   uint32_t payload_length;
@@ -37,21 +59,39 @@ struct RequestHeader {
 struct ParsePacket {
   std::string statement_name;
   std::string query;
+
+  // Object IDs of the parameter types, 0 if the client left a type unspecified
+  std::vector<uint32_t> parameter_types;
 };
 
 struct BindPacket {
   std::string statement_name;
   std::string destination_portal;
+
+  // Parameters in binary format are kept as the raw bytes (see decode_binary_value()), NULLs as NullValue
   std::vector<AllTypeVariant> params;
+
+  std::vector<FormatCode> parameter_format_codes;
+  std::vector<FormatCode> result_format_codes;
+};
+
+struct ExecutePacket {
+  std::string portal;
+
+  // Maximum number of rows to return, 0 for no limit
+  uint32_t max_rows;
 };
 
 class PostgresWireHandler {
  public:
-  static std::shared_ptr<OutputPacket> new_output_packet(NetworkMessageType type);
-  static void write_output_packet_size(OutputPacket& packet);
+  // Appends the type and a placeholder for the size of a new message to @param packet. Returns the offset of the
+  // message, at which write_output_packet_size() fills in the size once the message is complete.
+  static size_t begin_output_message(OutputPacket& packet, NetworkMessageType type);
+  static void write_output_packet_size(OutputPacket& packet, size_t message_offset = 0);
 
-  static uint32_t handle_startup_package(const InputPacket& packet);
-  static void handle_startup_package_content(const InputPacket& packet);
+  static StartupPacketHeader handle_startup_package(const InputPacket& packet);
+  static StartupParameters handle_startup_package_content(const InputPacket& packet);
+  static BackendKeyData handle_cancel_request_packet(const InputPacket& packet);
 
   static RequestHeader handle_header(const InputPacket& packet);
 
@@ -59,7 +99,9 @@ class PostgresWireHandler {
   static ParsePacket handle_parse_packet(const InputPacket& packet);
   static BindPacket handle_bind_packet(const InputPacket& packet);
   static std::string handle_describe_packet(const InputPacket& packet);
-  static std::string handle_execute_packet(const InputPacket& packet);
+  static ExecutePacket handle_execute_packet(const InputPacket& packet);
+  static std::string handle_copy_data_packet(const InputPacket& packet);
+  static std::string handle_copy_fail_packet(const InputPacket& packet);
 
   template <typename T>
   static T read_value(const InputPacket& packet);
@@ -69,10 +111,27 @@ class PostgresWireHandler {
 
   static std::string read_string(const InputPacket& packet);
 
+  // Reads @param num_bytes bytes into a string, e.g., a parameter value
+  static std::string read_bytes(const InputPacket& packet, size_t num_bytes);
+
   template <typename T>
   static void write_value(OutputPacket& packet, T value);
 
   static void write_string(OutputPacket& packet, const std::string& value, bool terminate = true);
+
+  // Returns the format of the value at @param index given the format codes of a Bind message. Without format codes,
+  // all values are text, and a single format code applies to all values.
+  static FormatCode format_code(const std::vector<FormatCode>& format_codes, size_t index);
+
+  // Decodes a parameter that was sent in binary format. @param type_id is the object ID of its type as given in the
+  // Parse message. If the type was left unspecified (0), values of 4 and 8 bytes are read as integers.
+  static AllTypeVariant decode_binary_value(const std::string& bytes, uint32_t type_id);
+
+  // Encodes a value in the binary format of its type, i.e., numbers in network byte order and strings as they are
+  static std::string encode_binary_value(const AllTypeVariant& value);
+
+  // Returns the object ID of the Postgres type that corresponds to the data type
+  static uint32_t type_id(DataType data_type);
 };
 
 template <typename T>
@@ -80,7 +139,7 @@ T PostgresWireHandler::read_value(const InputPacket& packet) {
   T result;
   auto num_bytes = sizeof(T);
 
-  Assert(packet.offset + num_bytes <= packet.data.cend(), "Reading too many bytes from buffer.");
+  Assert(num_bytes <= static_cast<size_t>(packet.end - packet.offset), "Reading too many bytes from buffer.");
 
   std::copy(packet.offset, packet.offset + num_bytes, reinterpret_cast<char*>(&result));
   packet.offset += num_bytes;
@@ -93,7 +152,7 @@ std::vector<T> PostgresWireHandler::read_values(const InputPacket& packet, const
   std::vector<T> result(num_values);
   auto num_bytes = result.size() * sizeof(T);
 
-  Assert(packet.offset + num_bytes <= packet.data.cend(), "Reading too many bytes from buffer.");
+  Assert(num_bytes <= static_cast<size_t>(packet.end - packet.offset), "Reading too many bytes from buffer.");
 
   std::copy(packet.offset, packet.offset + num_bytes, reinterpret_cast<char*>(result.data()));
   packet.offset += num_bytes;
@@ -106,12 +165,8 @@ void PostgresWireHandler::write_value(OutputPacket& packet, T value) {
   auto num_bytes = sizeof(T);
   auto value_chars = reinterpret_cast<char*>(&value);
 
-  auto& data = packet.data;
-  data.reserve(data.size() + num_bytes);
-
-  for (auto byte_offset = 0u; byte_offset < num_bytes; ++byte_offset) {
-    data.push_back(value_chars[byte_offset]);
-  }
+  // No reserve() here, the buffer grows geometrically while a message is written value by value
+  packet.data.insert(packet.data.end(), value_chars, value_chars + num_bytes);
 }
 
 }  // namespace opossum
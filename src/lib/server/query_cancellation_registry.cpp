@@ -0,0 +1,45 @@
+#include "query_cancellation_registry.hpp"
+
+#include "scheduler/cancellation_token.hpp"
+
+namespace opossum {
+
+QueryCancellationRegistry::QueryCancellationRegistry() : _random_engine(std::random_device{}()) {}
+
+BackendKeyData QueryCancellationRegistry::register_session() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // The secret key keeps clients from cancelling the queries of other sessions, whose process ids are easy to guess
+  const auto backend_key_data = BackendKeyData{_next_process_id++, static_cast<uint32_t>(_random_engine())};
+  _sessions[backend_key_data.process_id] = Session{backend_key_data.secret_key, nullptr};
+  return backend_key_data;
+}
+
+void QueryCancellationRegistry::unregister_session(const BackendKeyData& backend_key_data) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _sessions.erase(backend_key_data.process_id);
+}
+
+void QueryCancellationRegistry::set_current_query(const BackendKeyData& backend_key_data,
+                                                  const std::shared_ptr<CancellationToken>& cancellation_token) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto session_it = _sessions.find(backend_key_data.process_id);
+  if (session_it == _sessions.end()) return;
+  session_it->second.current_query = cancellation_token;
+}
+
+bool QueryCancellationRegistry::cancel(const BackendKeyData& backend_key_data) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto session_it = _sessions.find(backend_key_data.process_id);
+  if (session_it == _sessions.end()) return false;
+
+  const auto& session = session_it->second;
+  if (session.secret_key != backend_key_data.secret_key || !session.current_query) return false;
+
+  session.current_query->cancel();
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+#include "server/types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class CancellationToken;
+
+/**
+ * Keeps the CancellationToken of the query that each session currently executes. A Postgres CancelRequest arrives on
+ * a new connection and only carries the BackendKeyData of the session whose query is to be cancelled, so that the
+ * sessions have to be found via this registry.
+ */
+class QueryCancellationRegistry : public Singleton<QueryCancellationRegistry> {
+ public:
+  // Returns the key of a new session, which the session has to unregister once it ends
+  BackendKeyData register_session();
+  void unregister_session(const BackendKeyData& backend_key_data);
+
+  // Sets the token of the query that the session executes, nullptr once it is done
+  void set_current_query(const BackendKeyData& backend_key_data,
+                         const std::shared_ptr<CancellationToken>& cancellation_token);
+
+  // Cancels the current query of the session if the secret key matches. Returns whether a query was cancelled.
+  bool cancel(const BackendKeyData& backend_key_data);
+
+ protected:
+  friend class Singleton;
+
+  QueryCancellationRegistry();
+
+  struct Session {
+    uint32_t secret_key;
+    std::shared_ptr<CancellationToken> current_query;
+  };
+
+  std::mutex _mutex;
+  uint32_t _next_process_id = 1;
+  std::mt19937 _random_engine;
+  std::unordered_map<uint32_t, Session> _sessions;
+};
+
+}  // namespace opossum
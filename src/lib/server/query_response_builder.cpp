@@ -1,5 +1,7 @@
 #include "query_response_builder.hpp"
 
+#include <algorithm>
+
 #include "server/postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
 
@@ -11,7 +13,8 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const std::shared_ptr<const Table>& table) {
+std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(
+    const std::shared_ptr<const Table>& table, const std::vector<FormatCode>& format_codes) {
   std::vector<ColumnDescription> result;
 
   const auto& column_names = table->column_names();
@@ -46,7 +49,8 @@ std::vector<ColumnDescription> QueryResponseBuilder::build_row_description(const
         Fail("Bad DataType");
     }
 
-    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id});
+    result.emplace_back(ColumnDescription{column_names[column_id], object_id, type_id,
+                                          PostgresWireHandler::format_code(format_codes, column_id)});
   }
 
   return result;
@@ -76,38 +80,76 @@ std::string QueryResponseBuilder::build_execution_info_message(const std::shared
   return sql_pipeline->metrics().to_string();
 }
 
-boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table) {
+boost::future<uint64_t> QueryResponseBuilder::send_query_response(const send_row_t& send_row, const Table& table,
+                                                                 const std::vector<FormatCode>& format_codes,
+                                                                 const uint64_t first_row, const uint64_t max_rows) {
   // Essentially we're iterating over every row in every chunk in the table, generating and sending
   // its string representation. However, because of the asynchronous send_row call, we have to
   // use this two-level recursion instead of two nested for-loops
 
-  return _send_query_response_chunks(send_row, table, ChunkID{0}) >> then >> [&]() { return table.row_count(); };
+  auto column_format_codes = std::make_shared<std::vector<FormatCode>>(table.column_count());
+  for (auto column_id = 0u; column_id < table.column_count(); ++column_id) {
+    (*column_format_codes)[column_id] = PostgresWireHandler::format_code(format_codes, column_id);
+  }
+
+  const auto row_count = table.row_count();
+  const auto begin_row = std::min(first_row, row_count);
+  const auto end_row = max_rows == 0 ? row_count : std::min(begin_row + max_rows, row_count);
+
+  // Find the chunk that contains the first row to send
+  auto chunk_id = ChunkID{0};
+  auto chunk_offset = begin_row;
+  while (chunk_id < table.chunk_count() && chunk_offset >= table.get_chunk(chunk_id)->size()) {
+    chunk_offset -= table.get_chunk(chunk_id)->size();
+    ++chunk_id;
+  }
+
+  const auto sent_row_count = end_row - begin_row;
+  return _send_query_response_chunks(send_row, table, column_format_codes, chunk_id,
+                                     static_cast<ChunkOffset>(chunk_offset), sent_row_count) >>
+         then >> [sent_row_count]() { return sent_row_count; };
 }
 
 boost::future<void> QueryResponseBuilder::_send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                                      ChunkID current_chunk_id) {
-  if (current_chunk_id == table.chunk_count()) return boost::make_ready_future();
+                                                                      const ColumnFormatCodes& column_format_codes,
+                                                                      ChunkID current_chunk_id,
+                                                                      ChunkOffset first_chunk_offset,
+                                                                      uint64_t remaining_row_count) {
+  if (current_chunk_id == table.chunk_count() || remaining_row_count == 0) return boost::make_ready_future();
 
   const auto& chunk = table.get_chunk(current_chunk_id);
+  const auto chunk_row_count = std::min(static_cast<uint64_t>(chunk->size() - first_chunk_offset), remaining_row_count);
+  const auto end_chunk_offset = static_cast<ChunkOffset>(first_chunk_offset + chunk_row_count);
 
-  return _send_query_response_rows(send_row, *chunk, ChunkOffset{0}) >> then >>
-         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table),
-                   ChunkID{current_chunk_id + 1});
+  return _send_query_response_rows(send_row, *chunk, column_format_codes, first_chunk_offset, end_chunk_offset) >>
+         then >>
+         std::bind(QueryResponseBuilder::_send_query_response_chunks, send_row, std::ref(table), column_format_codes,
+                   ChunkID{current_chunk_id + 1}, ChunkOffset{0}, remaining_row_count - chunk_row_count);
 }
 
 boost::future<void> QueryResponseBuilder::_send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                                    ChunkOffset current_chunk_offset) {
-  if (current_chunk_offset == chunk.size()) return boost::make_ready_future();
+                                                                    const ColumnFormatCodes& column_format_codes,
+                                                                    ChunkOffset current_chunk_offset,
+                                                                    ChunkOffset end_chunk_offset) {
+  if (current_chunk_offset == end_chunk_offset) return boost::make_ready_future();
 
   std::vector<std::string> row_strings(chunk.column_count());
 
   for (ColumnID column_id{0}; column_id < ColumnID{chunk.column_count()}; ++column_id) {
     const auto& segment = chunk.get_segment(column_id);
-    row_strings[column_id] = type_cast_variant<std::string>((*segment)[current_chunk_offset]);
+    const auto value = (*segment)[current_chunk_offset];
+
+    // The binary format spares the clients and us the conversion of numbers from and to strings
+    if ((*column_format_codes)[column_id] == FormatCode::Binary) {
+      row_strings[column_id] = PostgresWireHandler::encode_binary_value(value);
+    } else {
+      row_strings[column_id] = type_cast_variant<std::string>(value);
+    }
   }
 
   return send_row(row_strings) >> then >> std::bind(QueryResponseBuilder::_send_query_response_rows, send_row,
-                                                    std::ref(chunk), ChunkOffset{current_chunk_offset + 1});
+                                                    std::ref(chunk), column_format_codes,
+                                                    ChunkOffset{current_chunk_offset + 1}, end_chunk_offset);
 }
 
 }  // namespace opossum
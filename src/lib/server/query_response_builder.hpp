@@ -12,19 +12,31 @@ class SQLPipeline;
 
 class QueryResponseBuilder {
  public:
-  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table);
+  // The format codes are those of the Bind message, see PostgresWireHandler::format_code()
+  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table,
+                                                              const std::vector<FormatCode>& format_codes = {});
   static std::string build_command_complete_message(const AbstractOperator& root_op, uint64_t row_count);
   static std::string build_execution_info_message(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
   using send_row_t = std::function<boost::future<void>(const std::vector<std::string>&)>;
 
-  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table);
+  // Sends up to @param max_rows rows (0 for all) of the table, starting at row @param first_row, and returns the number
+  // of rows sent. The table has to outlive the returned future.
+  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table,
+                                                     const std::vector<FormatCode>& format_codes = {},
+                                                     uint64_t first_row = 0, uint64_t max_rows = 0);
 
  protected:
+  // One format code per column
+  using ColumnFormatCodes = std::shared_ptr<const std::vector<FormatCode>>;
+
   static boost::future<void> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                         ChunkID current_chunk_id);
+                                                         const ColumnFormatCodes& column_format_codes,
+                                                         ChunkID current_chunk_id, ChunkOffset first_chunk_offset,
+                                                         uint64_t remaining_row_count);
   static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                       ChunkOffset current_chunk_offset);
+                                                       const ColumnFormatCodes& column_format_codes,
+                                                       ChunkOffset current_chunk_offset, ChunkOffset end_chunk_offset);
 };
 
 }  // namespace opossum
@@ -1,8 +1,5 @@
 #include "server.hpp"
 
-#include <boost/asio/placeholders.hpp>
-#include <boost/bind.hpp>
-
 #include "client_connection.hpp"
 #include "server_session.hpp"
 #include "task_runner.hpp"
@@ -12,24 +9,59 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-Server::Server(boost::asio::io_service& io_service, uint16_t port)
+Server::Server(boost::asio::io_service& io_service, uint16_t port, size_t session_thread_count)
     : _io_service(io_service),
-      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-      _socket(io_service) {
+      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)) {
+  _session_io_services.reserve(session_thread_count);
+  _session_io_service_works.reserve(session_thread_count);
+  _session_threads.reserve(session_thread_count);
+  for (auto thread_id = size_t{0}; thread_id < session_thread_count; ++thread_id) {
+    auto& session_io_service = *_session_io_services.emplace_back(std::make_unique<boost::asio::io_service>());
+    // Keeps the io_service running while it has no session
+    _session_io_service_works.emplace_back(session_io_service);
+    _session_threads.emplace_back([&session_io_service]() { session_io_service.run(); });
+  }
+
   _accept_next_connection();
 }
 
+Server::~Server() {
+  for (auto& session_io_service : _session_io_services) {
+    session_io_service->stop();
+  }
+  for (auto& session_thread : _session_threads) {
+    session_thread.join();
+  }
+}
+
+boost::asio::io_service& Server::_next_session_io_service() {
+  if (_session_io_services.empty()) return _io_service;
+
+  auto& session_io_service = *_session_io_services[_next_session_io_service_id];
+  _next_session_io_service_id = (_next_session_io_service_id + 1) % _session_io_services.size();
+  return session_io_service;
+}
+
 void Server::_accept_next_connection() {
-  _acceptor.async_accept(_socket, boost::bind(&Server::_start_session, this, boost::asio::placeholders::error));
+  // The socket belongs to the io_service of the session, so that all of its I/O is handled on the session's thread
+  auto& session_io_service = _next_session_io_service();
+  auto socket = std::make_shared<boost::asio::ip::tcp::socket>(session_io_service);
+  _acceptor.async_accept(*socket, [this, socket, &session_io_service](const boost::system::error_code& error) {
+    _start_session(socket, session_io_service, error);
+  });
 }
 
-void Server::_start_session(boost::system::error_code error) {
+void Server::_start_session(const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
+                            boost::asio::io_service& session_io_service, boost::system::error_code error) {
   if (!error) {
-    auto connection = std::make_shared<ClientConnection>(std::move(_socket));
-    auto task_runner = std::make_shared<TaskRunner>(_io_service);
+    auto connection = std::make_shared<ClientConnection>(std::move(*socket));
+    auto task_runner = std::make_shared<TaskRunner>(session_io_service);
     auto session = std::make_shared<ServerSession>(connection, task_runner);
-    // Start the session and release it once it has terminated
-    session->start() >> then >> [=]() mutable { session.reset(); };
+    // Start the session on its own thread and release it once it has terminated
+    session_io_service.post([session]() {
+      auto started_session = session;
+      started_session->start() >> then >> [=]() mutable { started_session.reset(); };
+    });
   }
 
   _accept_next_connection();
@@ -3,23 +3,39 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <memory>
+#include <thread>
+#include <vector>
+
 #include "server_session.hpp"
 
 namespace opossum {
 
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  // Accepts connections on @param io_service. With @param session_thread_count > 0, the sessions are distributed
+  // round-robin over that many threads, each running its own io_service, so that reading queries and sending results
+  // of many clients is not bound to the single thread running @param io_service. Otherwise, the sessions run on
+  // @param io_service as well.
+  Server(boost::asio::io_service& io_service, uint16_t port, size_t session_thread_count = 0);
+  ~Server();
 
   uint16_t get_port_number();
 
  protected:
+  boost::asio::io_service& _next_session_io_service();
   void _accept_next_connection();
-  void _start_session(boost::system::error_code error);
+  void _start_session(const std::shared_ptr<boost::asio::ip::tcp::socket>& socket,
+                      boost::asio::io_service& session_io_service, boost::system::error_code error);
 
   boost::asio::io_service& _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
-  boost::asio::ip::tcp::socket _socket;
+
+  // A session only ever runs on the thread of its io_service, so its handlers need no synchronization
+  std::vector<std::unique_ptr<boost::asio::io_service>> _session_io_services;
+  std::vector<boost::asio::io_service::work> _session_io_service_works;
+  std::vector<std::thread> _session_threads;
+  size_t _next_session_io_service_id = 0;
 };
 
 }  // namespace opossum
@@ -0,0 +1,147 @@
+#include "server_metrics.hpp"
+
+#include <string>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "sql/sql_pipeline.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+const std::array<std::string, ServerMetrics::PHASE_COUNT> PHASE_NAMES = {"parse", "translate", "optimize", "execute",
+                                                                         "serialize"};
+
+}  // namespace
+
+namespace opossum {
+
+void ServerMetrics::session_started() { ++_active_session_count; }
+
+void ServerMetrics::session_ended() { --_active_session_count; }
+
+void ServerMetrics::record_pipeline(SQLPipeline& sql_pipeline, const std::chrono::nanoseconds serialize_time) {
+  const auto& physical_plans = sql_pipeline.get_physical_plans();
+  const auto& metrics = sql_pipeline.metrics();
+  if (physical_plans.empty()) return;
+
+  const auto parse_time = metrics.parse_time_nanos / static_cast<int64_t>(physical_plans.size());
+
+  for (auto statement_id = size_t{0}; statement_id < physical_plans.size(); ++statement_id) {
+    const auto type = statement_type(*physical_plans[statement_id]);
+    const auto& statement_metrics = *metrics.statement_metrics[statement_id];
+
+    record(type, StatementPhase::Parse, parse_time);
+    record(type, StatementPhase::Translate,
+           statement_metrics.sql_translate_time_nanos + statement_metrics.lqp_translate_time_nanos);
+    record(type, StatementPhase::Optimize, statement_metrics.optimize_time_nanos);
+    record(type, StatementPhase::Execute, statement_metrics.execution_time_nanos);
+
+    ++_planned_statement_count;
+    if (statement_metrics.query_plan_cache_hit || statement_metrics.parameterized_plan_cache_hit) {
+      ++_plan_cache_hit_count;
+    }
+    if (statement_metrics.result_cache_hit) ++_result_cache_hit_count;
+  }
+
+  record(statement_type(*physical_plans.back()), StatementPhase::Serialize, serialize_time);
+}
+
+void ServerMetrics::record(const std::string& statement_type, const StatementPhase phase,
+                           const std::chrono::nanoseconds duration) {
+  std::lock_guard<std::mutex> lock(_latencies_mutex);
+  _latencies[statement_type][static_cast<size_t>(phase)].add(duration);
+}
+
+std::string ServerMetrics::statement_type(const AbstractOperator& root_operator) {
+  switch (root_operator.type()) {
+    case OperatorType::Insert:
+      return "INSERT";
+    case OperatorType::Update:
+      return "UPDATE";
+    case OperatorType::Delete:
+      return "DELETE";
+    default:
+      return "SELECT";
+  }
+}
+
+std::shared_ptr<Table> ServerMetrics::to_table() const {
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"metric", DataType::String}, {"labels", DataType::String}, {"value", DataType::Double}},
+      TableType::Data);
+  const auto add_row = [&](const std::string& metric, const std::string& labels, const double value) {
+    table->append({AllTypeVariant{metric}, AllTypeVariant{labels}, AllTypeVariant{value}});
+  };
+
+  add_row("hyrise_active_sessions", "", static_cast<double>(_active_session_count.load()));
+
+  {
+    std::lock_guard<std::mutex> lock(_latencies_mutex);
+    for (const auto& [type, histograms] : _latencies) {
+      for (auto phase_id = size_t{0}; phase_id < PHASE_COUNT; ++phase_id) {
+        const auto& histogram = histograms[phase_id];
+        const auto count = histogram.count();
+        if (count == 0) continue;
+
+        const auto labels = "type=\"" + type + "\",phase=\"" + PHASE_NAMES[phase_id] + "\"";
+
+        // Buckets beyond the longest recorded latency add no information and are left out, except for +Inf
+        auto cumulative_count = uint64_t{0};
+        for (auto bucket_id = size_t{0}; bucket_id + 1 < DurationHistogram::BUCKET_COUNT && cumulative_count < count;
+             ++bucket_id) {
+          cumulative_count += histogram.count_in_bucket(bucket_id);
+          const auto upper_bound = DurationHistogram::bucket_upper_bound(bucket_id).count();
+          add_row("hyrise_statement_latency_microseconds_bucket",
+                  labels + ",le=\"" + std::to_string(upper_bound) + "\"", static_cast<double>(cumulative_count));
+        }
+        add_row("hyrise_statement_latency_microseconds_bucket", labels + ",le=\"+Inf\"", static_cast<double>(count));
+        add_row("hyrise_statement_latency_microseconds_count", labels, static_cast<double>(count));
+      }
+    }
+  }
+
+  const auto planned_statement_count = _planned_statement_count.load();
+  add_row("hyrise_statements_total", "", static_cast<double>(planned_statement_count));
+  add_row("hyrise_plan_cache_hits_total", "", static_cast<double>(_plan_cache_hit_count.load()));
+  add_row("hyrise_result_cache_hits_total", "", static_cast<double>(_result_cache_hit_count.load()));
+  if (planned_statement_count > 0) {
+    add_row("hyrise_plan_cache_hit_rate", "",
+            static_cast<double>(_plan_cache_hit_count.load()) / static_cast<double>(planned_statement_count));
+  }
+
+  if (const auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(CurrentScheduler::get())) {
+    const auto queue_depths = scheduler->queue_depths();
+    for (auto node_id = size_t{0}; node_id < queue_depths.size(); ++node_id) {
+      add_row("hyrise_scheduler_queue_depth", "node=\"" + std::to_string(node_id) + "\"",
+              static_cast<double>(queue_depths[node_id]));
+    }
+  }
+
+  // Persisted tables that were not accessed yet are not loaded for this
+  auto& storage_manager = StorageManager::get();
+  for (const auto& table_name : storage_manager.table_names()) {
+    if (!storage_manager.is_table_loaded(table_name)) continue;
+    add_row("hyrise_table_memory_bytes", "table=\"" + table_name + "\"",
+            static_cast<double>(storage_manager.get_table(table_name)->estimate_memory_usage()));
+  }
+
+  return table;
+}
+
+void ServerMetrics::reset() {
+  {
+    std::lock_guard<std::mutex> lock(_latencies_mutex);
+    _latencies.clear();
+  }
+  _planned_statement_count = 0;
+  _plan_cache_hit_count = 0;
+  _result_cache_hit_count = 0;
+}
+
+}  // namespace opossum
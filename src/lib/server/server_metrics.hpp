@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "utils/duration_histogram.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class SQLPipeline;
+class Table;
+
+// The phases of a statement whose latencies are recorded. Translate covers the SQL and the LQP translation, Serialize
+// the time it takes to send the result to the client.
+enum class StatementPhase { Parse, Translate, Optimize, Execute, Serialize };
+
+/**
+ * Load of the server, returned by `SHOW STATS` (see CreatePipelineTask). Tells where the latency of the statements
+ * goes, how many sessions are active, how often the plan caches hit, how many tasks wait for the scheduler, and how
+ * much memory the tables use. The rows follow the Prometheus conventions, e.g., the latency histograms are cumulative
+ * `_bucket` rows with an `le` label, so that they can be exported to a monitoring system as they are.
+ */
+class ServerMetrics : public Singleton<ServerMetrics> {
+ public:
+  static constexpr size_t PHASE_COUNT = 5;
+
+  void session_started();
+  void session_ended();
+
+  // Records the phases of all statements of the executed @param sql_pipeline. The parse time, which the pipeline only
+  // measures for all statements at once, is split evenly. @param serialize_time applies to the last statement, whose
+  // result is sent to the client.
+  void record_pipeline(SQLPipeline& sql_pipeline, const std::chrono::nanoseconds serialize_time);
+
+  void record(const std::string& statement_type, const StatementPhase phase, const std::chrono::nanoseconds duration);
+
+  // SELECT, INSERT, UPDATE, or DELETE, as in the CommandComplete message of the statement
+  static std::string statement_type(const AbstractOperator& root_operator);
+
+  // One row per value, with the columns metric, labels, and value. Samples the scheduler and the tables when called.
+  std::shared_ptr<Table> to_table() const;
+
+  void reset();
+
+ protected:
+  friend class Singleton;
+
+  ServerMetrics() = default;
+
+  mutable std::mutex _latencies_mutex;
+  std::map<std::string, std::array<DurationHistogram, PHASE_COUNT>> _latencies;
+
+  std::atomic<int64_t> _active_session_count{0};
+
+  std::atomic<uint64_t> _planned_statement_count{0};
+  std::atomic<uint64_t> _plan_cache_hit_count{0};
+  std::atomic<uint64_t> _result_cache_hit_count{0};
+};
+
+}  // namespace opossum
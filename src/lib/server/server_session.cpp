@@ -7,15 +7,19 @@
 
 #include <chrono>
 #include <iostream>
+#include <regex>
 #include <thread>
 
 #include "SQLParserResult.h"
 
 #include "concurrency/transaction_manager.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/storage_manager.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/copy_server_data_task.hpp"
+#include "tasks/server/copy_server_result_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
@@ -23,7 +27,9 @@
 #include "tasks/server/parse_server_prepared_statement_task.hpp"
 
 #include "client_connection.hpp"
+#include "query_cancellation_registry.hpp"
 #include "query_response_builder.hpp"
+#include "server_metrics.hpp"
 #include "then_operator.hpp"
 #include "types.hpp"
 #include "use_boost_future.hpp"
@@ -34,11 +40,24 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
+template <typename TConnection, typename TTaskRunner>
+ServerSessionImpl<TConnection, TTaskRunner>::~ServerSessionImpl() {
+  if (!_backend_key_data) return;
+
+  QueryCancellationRegistry::get().unregister_session(*_backend_key_data);
+  ServerMetrics::get().session_ended();
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
   // We need a copy of this session to outlive the async operation
   auto self = this->shared_from_this();
-  return (_perform_session_startup() >> then >> [this, self]() { return _handle_client_requests(); })
+  return (_perform_session_startup() >> then >>
+          [this, self]() {
+            // The connection of a CancelRequest is closed right away
+            if (!_backend_key_data) return boost::make_ready_future();
+            return _handle_client_requests();
+          })
       // Use .then instead of >> then >> to be able to handle exceptions
       .then(boost::launch::sync, [self](boost::future<void> f) {
         try {
@@ -51,21 +70,74 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_perform_session_startup() {
-  return _connection->receive_startup_packet_header() >> then >> [=](uint32_t startup_packet_length) {
-    if (startup_packet_length == 0) {
-      // This is a request for SSL, deny it and wait for the next startup packet
+  return _connection->receive_startup_packet_header() >> then >> [=](StartupPacketHeader header) {
+    if (header.type == StartupPacketType::SslRequest) {
+      // Deny SSL and wait for the next startup packet
       return _connection->send_ssl_denied() >> then >> [=]() { return _perform_session_startup(); };
     }
 
-    return _connection->receive_startup_packet_body(startup_packet_length) >> then >>
-           [=]() { return _connection->send_auth(); } >> then >>
+    if (header.type == StartupPacketType::CancelRequest) {
+      // Postgres does not reply to a CancelRequest, e.g., if the key is wrong or the query has already finished
+      return _connection->receive_cancel_request_body(header.payload_length) >> then >>
+             [](BackendKeyData backend_key_data) { QueryCancellationRegistry::get().cancel(backend_key_data); };
+    }
+
+    _backend_key_data = QueryCancellationRegistry::get().register_session();
+    ServerMetrics::get().session_started();
+
+    return _connection->receive_startup_packet_body(header.payload_length) >> then >>
+           [=](StartupParameters parameters) {
+             _apply_startup_parameters(parameters);
+             return _connection->send_auth();
+           } >>
+           then >>
            // We need to provide some random server version > 9 here, because some clients require it.
            [=]() { return _connection->send_parameter_status("server_version", "9.5"); } >> then >>
            [=]() { return _connection->send_parameter_status("client_encoding", "UTF8"); } >> then >>
+           [=]() { return _connection->send_backend_key_data(*_backend_key_data); } >> then >>
            [=]() { return _connection->send_ready_for_query(); };
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+void ServerSessionImpl<TConnection, TTaskRunner>::_apply_startup_parameters(const StartupParameters& parameters) {
+  // The statement timeout is passed directly or, e.g., by psql via PGOPTIONS, as "-c statement_timeout=5s" in the
+  // options. Like in Postgres, the value is in milliseconds unless it has a unit, and 0 disables the timeout.
+  static const auto statement_timeout_regex = std::regex{R"(statement_timeout\s*=\s*(\d+)\s*(ms|s|min)?)"};
+
+  auto statement_timeout = std::string{};
+  const auto statement_timeout_it = parameters.find("statement_timeout");
+  const auto options_it = parameters.find("options");
+  if (statement_timeout_it != parameters.end()) {
+    statement_timeout = "statement_timeout=" + statement_timeout_it->second;
+  } else if (options_it != parameters.end()) {
+    statement_timeout = options_it->second;
+  }
+
+  auto match = std::smatch{};
+  if (!std::regex_search(statement_timeout, match, statement_timeout_regex)) return;
+
+  auto timeout = std::chrono::milliseconds{std::stoll(match[1].str())};
+  if (match[2] == "s") {
+    timeout *= 1000;
+  } else if (match[2] == "min") {
+    timeout *= 60 * 1000;
+  }
+
+  if (timeout.count() > 0) _statement_timeout = timeout;
+}
+
+template <typename TConnection, typename TTaskRunner>
+std::shared_ptr<CancellationToken> ServerSessionImpl<TConnection, TTaskRunner>::_begin_query() {
+  auto deadline = std::optional<std::chrono::steady_clock::time_point>{};
+  if (_statement_timeout) deadline = std::chrono::steady_clock::now() + *_statement_timeout;
+
+  // A CancelRequest that arrives after the query is done cancels this token, which is no longer used
+  const auto cancellation_token = std::make_shared<CancellationToken>(deadline);
+  if (_backend_key_data) QueryCancellationRegistry::get().set_current_query(*_backend_key_data, cancellation_token);
+  return cancellation_token;
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_requests() {
   auto process_command = [=](RequestHeader request) {
@@ -76,25 +148,34 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
                [=]() { return _connection->send_ready_for_query(); };
       }
 
+      // After an error, the messages of the extended query protocol are read but ignored until the next Sync
       case NetworkMessageType::ParseCommand: {
         return _connection->receive_parse_packet_body(request.payload_length) >> then >>
-               [=](ParsePacket parse_packet) { return _handle_parse_command(parse_packet); };
+               [=](ParsePacket parse_packet) {
+                 if (_skip_until_sync) return boost::make_ready_future();
+                 return _handle_parse_command(parse_packet);
+               };
       }
 
       case NetworkMessageType::BindCommand: {
-        return _connection->receive_bind_packet_body(request.payload_length) >> then >>
-               [=](BindPacket bind_packet) { return _handle_bind_command(bind_packet); };
+        return _connection->receive_bind_packet_body(request.payload_length) >> then >> [=](BindPacket bind_packet) {
+          if (_skip_until_sync) return boost::make_ready_future();
+          return _handle_bind_command(bind_packet);
+        };
       }
 
       case NetworkMessageType::DescribeCommand: {
-        return _connection->receive_describe_packet_body(request.payload_length) >> then >>
-               [=](std::string portal) { return _handle_describe_command(portal); };
+        return _connection->receive_describe_packet_body(request.payload_length) >> then >> [=](std::string portal) {
+          if (_skip_until_sync) return boost::make_ready_future();
+          return _handle_describe_command(portal);
+        };
       }
 
       case NetworkMessageType::SyncCommand: {
-        return _connection->receive_sync_packet_body(request.payload_length) >> then >>
-               [=]() { return _handle_sync_command(); } >> then >>
-               [=]() { return _connection->send_ready_for_query(); };
+        return _connection->receive_sync_packet_body(request.payload_length) >> then >> [=]() {
+          _skip_until_sync = false;
+          return _handle_sync_command();
+        } >> then >> [=]() { return _connection->send_ready_for_query(); };
       }
 
       case NetworkMessageType::FlushCommand: {
@@ -104,7 +185,10 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
 
       case NetworkMessageType::ExecuteCommand: {
         return _connection->receive_execute_packet_body(request.payload_length) >> then >>
-               [=](std::string portal) { return _handle_execute_command(portal); };
+               [=](ExecutePacket execute_packet) {
+                 if (_skip_until_sync) return boost::make_ready_future();
+                 return _handle_execute_command(execute_packet);
+               };
       }
 
       default:
@@ -123,7 +207,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
     // because >> then >> does not handle exceptions
     return process_command(request)
                .then(boost::launch::sync,
-                     [this, self](boost::future<void> result) {
+                     [this, self, request](boost::future<void> result) {
                        try {
                          result.get();
                          return boost::make_ready_future();
@@ -134,6 +218,13 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
                            _transaction.reset();
                          }
 
+                         // Clients pipeline extended query messages up to a Sync, which is answered with the
+                         // ReadyForQuery. The messages in between depend on the failed one and are skipped.
+                         if (_is_extended_query_message(request.message_type)) {
+                           _skip_until_sync = true;
+                           return _connection->send_error(e.what());
+                         }
+
                          return _connection->send_error(e.what()) >> then >>
                                 [this, self]() { return _connection->send_ready_for_query(); };
                        }
@@ -162,21 +253,41 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
   };
 
   auto send_command_complete = [=](uint64_t row_count) {
+    // Like PostgreSQL, EXPLAIN is completed with its own tag, even if the explained statement is, e.g., an INSERT
+    if (sql_pipeline->explain_mode() != ExplainMode::None) return _connection->send_command_complete("EXPLAIN");
+
     auto root_op = sql_pipeline->get_physical_plans().front();
     auto complete_message = QueryResponseBuilder::build_command_complete_message(*root_op, row_count);
     return _connection->send_command_complete(complete_message);
   };
 
+  const auto serialize_start = std::chrono::steady_clock::now();
   return send_row_data() >> then >> send_command_complete >> then >> [=]() {
+    ServerMetrics::get().record_pipeline(*sql_pipeline, std::chrono::steady_clock::now() - serialize_start);
+
     auto execution_info = QueryResponseBuilder::build_execution_info_message(sql_pipeline);
     return _connection->send_notice(execution_info);
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_server_metrics(
+    const std::shared_ptr<const Table>& server_metrics) {
+  const auto row_description = QueryResponseBuilder::build_row_description(server_metrics);
+  return _connection->send_row_description(row_description) >> then >>
+         [=]() {
+           return QueryResponseBuilder::send_query_response(
+               [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *server_metrics);
+         } >>
+         then >> [=](uint64_t row_count) {
+           return _connection->send_command_complete("SELECT " + std::to_string(row_count));
+         };
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true, _begin_query()));
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
@@ -197,6 +308,12 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
   return create_sql_pipeline() >> then >> [=](std::unique_ptr<CreatePipelineResult> result) {
     if (result->load_table.has_value()) {
       return load_table_file(result->load_table->first, result->load_table->second);
+    } else if (result->copy_from_stdin.has_value()) {
+      return _handle_copy_from_stdin(*result->copy_from_stdin);
+    } else if (result->copy_to_stdout.has_value()) {
+      return _handle_copy_to_stdout(*result->copy_to_stdout);
+    } else if (result->server_metrics) {
+      return _send_server_metrics(result->server_metrics);
     } else {
       return execute_sql_pipeline(result->sql_pipeline) >> then >>
              [=](std::shared_ptr<SQLPipeline> sql_pipeline) { return _send_simple_query_response(sql_pipeline); };
@@ -221,6 +338,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_c
          [=](std::unique_ptr<PreparedPlan> prepared_plan) {
            // We know that SQLPipeline is set because the load table command is not allowed in this context
            StorageManager::get().add_prepared_plan(parse_info.statement_name, std::move(prepared_plan));
+           _prepared_statements[parse_info.statement_name] =
+               PreparedStatement{parse_info.query, parse_info.parameter_types};
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::ParseComplete); };
 }
@@ -234,7 +353,25 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
 
   const auto prepared_plan = StorageManager::get().get_prepared_plan(packet.statement_name);
 
-  if (packet.statement_name.empty()) StorageManager::get().drop_prepared_plan(packet.statement_name);
+  // Decode the parameters sent in binary format according to the types given when the statement was parsed
+  auto params = packet.params;
+  const auto prepared_statement = _prepared_statements[packet.statement_name];
+  const auto& parameter_types = prepared_statement.parameter_types;
+  for (auto parameter_id = size_t{0}; parameter_id < params.size(); ++parameter_id) {
+    if (variant_is_null(params[parameter_id]) ||
+        PostgresWireHandler::format_code(packet.parameter_format_codes, parameter_id) != FormatCode::Binary) {
+      continue;
+    }
+
+    const auto type_id = parameter_id < parameter_types.size() ? parameter_types[parameter_id] : uint32_t{0};
+    const auto& bytes = boost::get<std::string>(params[parameter_id]);
+    params[parameter_id] = PostgresWireHandler::decode_binary_value(bytes, type_id);
+  }
+
+  if (packet.statement_name.empty()) {
+    StorageManager::get().drop_prepared_plan(packet.statement_name);
+    _prepared_statements.erase(packet.statement_name);
+  }
 
   auto portal_name = packet.destination_portal;
 
@@ -248,9 +385,11 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
     _portals.erase(portal_it);
   }
 
-  auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_plan, packet.params);
+  auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_statement.query, prepared_plan, params);
   return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::shared_ptr<AbstractOperator> physical_plan) { _portals.emplace(portal_name, physical_plan); } >>
+         [=](std::shared_ptr<AbstractOperator> physical_plan) {
+           _portals.emplace(portal_name, Portal{physical_plan, packet.result_format_codes});
+         } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
 }
 
@@ -273,41 +412,157 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_sync_co
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_flush_command() {
-  // Ignore this because this message is received in a batch with other commands that handle the response.
-  return boost::make_ready_future();
+  // The responses to extended query messages are buffered until the Sync, unless the client asks for them earlier
+  return _connection->flush();
 }
 
 template <typename TConnection, typename TTaskRunner>
-boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute_command(
-    const std::string& portal_name) {
-  auto portal_it = _portals.find(portal_name);
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_copy_from_stdin(
+    const CopyFromStdin& copy_from_stdin) {
+  // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+  if (!StorageManager::get().has_table(copy_from_stdin.table_name)) Fail("The specified table does not exist.");
+
+  const auto column_count = StorageManager::get().get_table(copy_from_stdin.table_name)->column_count();
+  const auto format_code = copy_from_stdin.format == CopyFormat::Binary ? FormatCode::Binary : FormatCode::Text;
+  const auto data = std::make_shared<std::string>();
+
+  return _connection->send_copy_in_response(format_code, column_count) >> then >>
+         [=]() { return _receive_copy_data(data); } >> then >>
+         [=]() {
+           auto task = std::make_shared<CopyServerDataTask>(copy_from_stdin.table_name, copy_from_stdin.format, data);
+           return _task_runner->dispatch_server_task(task);
+         } >>
+         then >> [=](uint64_t row_count) {
+           return _connection->send_command_complete("COPY " + std::to_string(row_count));
+         };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_receive_copy_data(
+    const std::shared_ptr<std::string>& data) {
+  // The client sends the data in CopyData messages until it is done or the COPY failed on its side
+  return _connection->receive_packet_header() >> then >> [=](RequestHeader request) {
+    switch (request.message_type) {
+      case NetworkMessageType::CopyData:
+        return _connection->receive_copy_data_packet_body(request.payload_length) >> then >>
+               [=](std::string bytes) {
+                 data->append(bytes);
+                 return _receive_copy_data(data);
+               };
+
+      case NetworkMessageType::CopyDone:
+        return _connection->receive_copy_done_packet_body(request.payload_length);
+
+      case NetworkMessageType::CopyFail:
+        return _connection->receive_copy_fail_packet_body(request.payload_length) >> then >>
+               [](std::string message) -> void { Fail("COPY failed: " + message); };
+
+      default:
+        Fail("Unexpected message during COPY.");
+    }
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_copy_to_stdout(
+    const CopyToStdout& copy_to_stdout) {
+  auto task = std::make_shared<CopyServerResultTask>(copy_to_stdout, _begin_query());
+  return _task_runner->dispatch_server_task(task) >> then >> [=](std::unique_ptr<CopyServerResult> unique_result) {
+    // The Arrow stream is binary, i.e., its format and the format of all columns is binary
+    const auto result = std::shared_ptr<CopyServerResult>{std::move(unique_result)};
+    return _connection->send_copy_out_response(FormatCode::Binary, result->column_count) >> then >>
+           [=]() { return _send_copy_data(result, 0); } >> then >>
+           [=]() { return _connection->send_status_message(NetworkMessageType::CopyDone); } >> then >>
+           [=]() { return _connection->send_command_complete("COPY " + std::to_string(result->row_count)); };
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_copy_data(
+    const std::shared_ptr<CopyServerResult>& result, const size_t message_id) {
+  if (message_id == result->messages.size()) return boost::make_ready_future();
+
+  return _connection->send_copy_data(result->messages[message_id]) >> then >>
+         [=]() { return _send_copy_data(result, message_id + 1); };
+}
+
+template <typename TConnection, typename TTaskRunner>
+bool ServerSessionImpl<TConnection, TTaskRunner>::_is_extended_query_message(const NetworkMessageType message_type) {
+  return message_type == NetworkMessageType::ParseCommand || message_type == NetworkMessageType::BindCommand ||
+         message_type == NetworkMessageType::DescribeCommand || message_type == NetworkMessageType::ExecuteCommand ||
+         message_type == NetworkMessageType::FlushCommand;
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute_command(const ExecutePacket& packet) {
+  auto portal_it = _portals.find(packet.portal);
   Assert(portal_it != _portals.end(), "The specified portal does not exist.");
 
-  const auto physical_plan = portal_it->second;
+  const auto portal_name = packet.portal;
+  const auto max_rows = packet.max_rows;
+  const auto portal = portal_it->second;
 
-  if (portal_name.empty()) _portals.erase(portal_it);
+  // A portal that was suspended by a previous Execute message is not executed again
+  if (portal.result_table) return _send_portal_rows(portal_name, portal, max_rows);
 
   if (!_transaction) _transaction = TransactionManager::get().new_transaction_context();
 
-  physical_plan->set_transaction_context_recursively(_transaction);
+  portal.physical_plan->set_transaction_context_recursively(_transaction);
+
+  const auto execute_start = std::chrono::steady_clock::now();
+  return _task_runner->dispatch_server_task(
+             std::make_shared<ExecuteServerPreparedStatementTask>(portal.physical_plan, _begin_query())) >>
+         then >> [=](std::shared_ptr<const Table> result_table) {
+           ServerMetrics::get().record(ServerMetrics::statement_type(*portal.physical_plan), StatementPhase::Execute,
+                                       std::chrono::steady_clock::now() - execute_start);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan)) >>
-         then >>
-         [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
            if (!result_table) {
+             if (portal_name.empty()) _portals.erase(portal_name);
+
+             const auto complete_message =
+                 QueryResponseBuilder::build_command_complete_message(*portal.physical_plan, 0);
              return _connection->send_status_message(NetworkMessageType::NoDataResponse) >> then >>
-                    []() { return uint64_t(0); };
+                    [=]() { return _connection->send_command_complete(complete_message); };
            }
 
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
-           return _connection->send_row_description(row_description) >> then >> [=]() {
-             return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-           };
-         } >>
+           auto executed_portal = portal;
+           executed_portal.result_table = result_table;
+
+           const auto row_description =
+               QueryResponseBuilder::build_row_description(result_table, portal.result_format_codes);
+           return _connection->send_row_description(row_description) >> then >>
+                  [=]() { return _send_portal_rows(portal_name, executed_portal, max_rows); };
+         };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_portal_rows(const std::string& portal_name,
+                                                                                    const Portal& portal,
+                                                                                    const uint32_t max_rows) {
+  const auto result_table = portal.result_table;
+
+  return QueryResponseBuilder::send_query_response(
+             [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table,
+             portal.result_format_codes, portal.sent_row_count, max_rows) >>
          then >> [=](uint64_t row_count) {
-           auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, row_count);
+           auto sent_portal = portal;
+           sent_portal.sent_row_count += row_count;
+
+           // The client fetches the remaining rows with another Execute message for the same portal
+           if (sent_portal.sent_row_count < result_table->row_count()) {
+             _portals[portal_name] = sent_portal;
+             return _connection->send_status_message(NetworkMessageType::PortalSuspended);
+           }
+
+           if (portal_name.empty()) {
+             _portals.erase(portal_name);
+           } else {
+             _portals[portal_name] = sent_portal;
+           }
+
+           const auto complete_message =
+               QueryResponseBuilder::build_command_complete_message(*portal.physical_plan, sent_portal.sent_row_count);
            return _connection->send_command_complete(complete_message);
          };
 }
@@ -4,44 +4,94 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "task_runner.hpp"
+#include "tasks/server/copy_server_data_task.hpp"
+#include "tasks/server/copy_server_result_task.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class CancellationToken;
+
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
   explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
       : _connection(connection), _task_runner(task_runner) {}
 
+  ~ServerSessionImpl();
+
   boost::future<void> start();
 
  protected:
+  // A bound statement, ready to be executed. If an Execute message limited the number of rows, the portal keeps the
+  // result table, so that following Execute messages continue where the previous one stopped.
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<FormatCode> result_format_codes;
+
+    std::shared_ptr<const Table> result_table;
+    uint64_t sent_row_count = 0;
+  };
+
+  // What the session keeps from the Parse message of a prepared statement, whose plan is in the StorageManager. The
+  // query identifies the cached physical plans of the statement, the parameter types are needed to decode binary
+  // parameters.
+  struct PreparedStatement {
+    std::string query;
+    std::vector<uint32_t> parameter_types;
+  };
+
   boost::future<void> _perform_session_startup();
+  void _apply_startup_parameters(const StartupParameters& parameters);
+
+  // Creates the CancellationToken of the next query, which a CancelRequest for this session or the statement timeout
+  // cancels
+  std::shared_ptr<CancellationToken> _begin_query();
 
   boost::future<void> _handle_client_requests();
   boost::future<void> _handle_simple_query_command(const std::string& sql);
   boost::future<void> _handle_parse_command(const ParsePacket& parse_info);
   boost::future<void> _handle_bind_command(const BindPacket& packet);
   boost::future<void> _handle_describe_command(const std::string& portal_name);
-  boost::future<void> _handle_execute_command(const std::string& portal_name);
+  boost::future<void> _handle_execute_command(const ExecutePacket& packet);
   boost::future<void> _handle_sync_command();
   boost::future<void> _handle_flush_command();
+  boost::future<void> _handle_copy_from_stdin(const CopyFromStdin& copy_from_stdin);
+  boost::future<void> _receive_copy_data(const std::shared_ptr<std::string>& data);
+  boost::future<void> _handle_copy_to_stdout(const CopyToStdout& copy_to_stdout);
+  boost::future<void> _send_copy_data(const std::shared_ptr<CopyServerResult>& result, size_t message_id);
+
+  static bool _is_extended_query_message(const NetworkMessageType message_type);
 
   boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
+  boost::future<void> _send_server_metrics(const std::shared_ptr<const Table>& server_metrics);
+  boost::future<void> _send_portal_rows(const std::string& portal_name, const Portal& portal, uint32_t max_rows);
 
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
 
   std::shared_ptr<TransactionContext> _transaction;
 
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  std::unordered_map<std::string, Portal> _portals;
+
+  std::unordered_map<std::string, PreparedStatement> _prepared_statements;
+
+  // Set when an extended query message failed, reset by the next Sync
+  bool _skip_until_sync = false;
+
+  // Set once the session is registered for CancelRequests. A connection that only sends a CancelRequest has none.
+  std::optional<BackendKeyData> _backend_key_data;
+
+  // The statement_timeout parameter of the client, if any
+  std::optional<std::chrono::milliseconds> _statement_timeout;
 };
 
 // The corresponding template instantiation takes place in the .cpp
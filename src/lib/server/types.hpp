@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace opossum {
 
 enum class NetworkMessageType : unsigned char {
@@ -20,6 +22,10 @@ enum class NetworkMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  PortalSuspended = 's',
+  CopyInResponse = 'G',
+  CopyOutResponse = 'H',
+  BackendKeyData = 'K',
 
   // Errors
   HumanReadableError = 'M',
@@ -36,12 +42,26 @@ enum class NetworkMessageType : unsigned char {
   SimpleQueryCommand = 'Q',
   CloseCommand = 'C',
 
+  // COPY ... FROM STDIN and COPY ... TO STDOUT
+  CopyData = 'd',
+  CopyDone = 'c',
+  CopyFail = 'f',
+
   // SSL willingness
   SslYes = 'S',
   SslNo = 'N',
   Notice = 'N',
 };
 
+// Identifies a session towards the client, which sends it in a CancelRequest to cancel the query of that session
+struct BackendKeyData {
+  uint32_t process_id;
+  uint32_t secret_key;
+};
+
+// Format of a parameter or result column value, as requested by the client in the Bind message
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
 enum class TransactionStatusIndicator : unsigned char {
   Idle = 'I',
   InTransactionBlock = 'T',
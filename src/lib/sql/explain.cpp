@@ -0,0 +1,105 @@
+#include "explain.hpp"
+
+#include <cmath>
+#include <regex>
+#include <unordered_set>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Whether the statistics of @param node can be derived, i.e., it and all nodes below it describe data. Other nodes,
+// e.g., DummyTableNodes or the nodes of DML statements, do not implement derive_statistics_from().
+bool has_statistics(const AbstractLQPNode& node) {
+  switch (node.type) {
+    case LQPNodeType::StoredTable:
+    case LQPNodeType::IntermediateResult:
+      return true;
+    case LQPNodeType::Aggregate:
+    case LQPNodeType::Alias:
+    case LQPNodeType::Join:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Union:
+    case LQPNodeType::Validate:
+    case LQPNodeType::Window:
+      break;
+    default:
+      return false;
+  }
+
+  if (!node.left_input() || !has_statistics(*node.left_input())) return false;
+  return !node.right_input() || has_statistics(*node.right_input());
+}
+
+AllTypeVariant estimated_row_count(const AbstractOperator& op) {
+  if (!op.lqp_node || !has_statistics(*op.lqp_node)) return NULL_VALUE;
+  return static_cast<int64_t>(std::lround(op.lqp_node->get_statistics()->row_count()));
+}
+
+void add_operator_rows(Table& table, const std::shared_ptr<const AbstractOperator>& op, const size_t depth,
+                       const ExplainMode explain_mode,
+                       std::unordered_set<std::shared_ptr<const AbstractOperator>>& described_operators) {
+  const auto indented_description = std::string(depth * 2, ' ') + op->description();
+
+  if (!described_operators.emplace(op).second) {
+    table.append({AllTypeVariant{indented_description + " (shared)"}, NULL_VALUE, NULL_VALUE, NULL_VALUE,
+                  NULL_VALUE, NULL_VALUE});
+    return;
+  }
+
+  if (explain_mode == ExplainMode::Analyze) {
+    const auto& performance_data = op->performance_data();
+    table.append({AllTypeVariant{indented_description}, estimated_row_count(*op),
+                  AllTypeVariant{static_cast<int64_t>(performance_data.output_row_count)},
+                  AllTypeVariant{static_cast<int64_t>(performance_data.walltime.count())},
+                  AllTypeVariant{static_cast<int64_t>(performance_data.chunks_processed.load())},
+                  AllTypeVariant{static_cast<int64_t>(performance_data.chunks_skipped.load())}});
+  } else {
+    table.append({AllTypeVariant{indented_description}, estimated_row_count(*op), NULL_VALUE, NULL_VALUE, NULL_VALUE,
+                  NULL_VALUE});
+  }
+
+  if (op->input_left()) add_operator_rows(table, op->input_left(), depth + 1, explain_mode, described_operators);
+  if (op->input_right()) add_operator_rows(table, op->input_right(), depth + 1, explain_mode, described_operators);
+}
+
+}  // namespace
+
+std::pair<ExplainMode, std::string> strip_explain_prefix(const std::string& sql) {
+  static const auto explain_regex = std::regex{R"(^\s*EXPLAIN(\s+ANALYZE)?\s+)", std::regex::icase};
+
+  auto match = std::smatch{};
+  if (!std::regex_search(sql, match, explain_regex)) return {ExplainMode::None, sql};
+
+  const auto explain_mode = match[1].matched ? ExplainMode::Analyze : ExplainMode::Plan;
+  return {explain_mode, match.suffix().str()};
+}
+
+std::shared_ptr<Table> create_explain_table(const std::shared_ptr<const AbstractOperator>& physical_plan,
+                                            const ExplainMode explain_mode) {
+  DebugAssert(explain_mode != ExplainMode::None, "Expected EXPLAIN or EXPLAIN ANALYZE");
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"operator", DataType::String},
+                                                              {"estimated_rows", DataType::Long, true},
+                                                              {"actual_rows", DataType::Long, true},
+                                                              {"walltime_ns", DataType::Long, true},
+                                                              {"chunks_processed", DataType::Long, true},
+                                                              {"chunks_skipped", DataType::Long, true}},
+                                       TableType::Data);
+
+  auto described_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  add_operator_rows(*table, physical_plan, 0, explain_mode, described_operators);
+
+  return table;
+}
+
+}  // namespace opossum
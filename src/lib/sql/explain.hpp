@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * The SQL parser does not know EXPLAIN, so `EXPLAIN [ANALYZE] <statement>` is detected before parsing. Returns the
+ * ExplainMode and @param sql without the prefix, or ExplainMode::None and the unchanged @param sql.
+ */
+std::pair<ExplainMode, std::string> strip_explain_prefix(const std::string& sql);
+
+/**
+ * Describes @param physical_plan with one row per operator, starting at the root. The operator column shows the tree
+ * by indenting each operator below its output. The estimated row count is that of the LQP node that the operator was
+ * translated from. For ExplainMode::Analyze, the plan has to be executed already, and the actual row count, walltime,
+ * and the processed and skipped chunks are taken from its OperatorPerformanceData. Otherwise, these columns are NULL.
+ *
+ * An operator that is the input of several operators is described once. Its other occurrences are marked as shared.
+ */
+std::shared_ptr<Table> create_explain_table(const std::shared_ptr<const AbstractOperator>& physical_plan,
+                                            const ExplainMode explain_mode);
+
+}  // namespace opossum
@@ -0,0 +1,151 @@
+#include "intermediate_result_recycler.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+#include "boost/functional/hash.hpp"
+
+#include "expression/abstract_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+IntermediateResultRecycler::IntermediateResultRecycler() : _cache(std::numeric_limits<size_t>::max()) {}
+
+bool IntermediateResultRecycler::is_recyclable(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  if (lqp->type != LQPNodeType::Join && lqp->type != LQPNodeType::Aggregate) return false;
+
+  auto recyclable = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    switch (node->type) {
+      case LQPNodeType::Aggregate:
+      case LQPNodeType::Alias:
+      case LQPNodeType::Join:
+      case LQPNodeType::Limit:
+      case LQPNodeType::Predicate:
+      case LQPNodeType::Projection:
+      case LQPNodeType::Sort:
+      case LQPNodeType::StoredTable:
+      case LQPNodeType::Union:
+      case LQPNodeType::Validate:
+      case LQPNodeType::Window:
+        break;
+      default:
+        recyclable = false;
+    }
+
+    // Without a Validate, the rows of other transactions that are not committed yet would be part of the result
+    if (node->type != LQPNodeType::Validate) {
+      for (const auto& input : {node->left_input(), node->right_input()}) {
+        if (input && input->type == LQPNodeType::StoredTable) recyclable = false;
+      }
+    }
+
+    for (const auto& node_expression : node->node_expressions) {
+      visit_expression(node_expression, [&](const auto& expression) {
+        switch (expression->type) {
+          case ExpressionType::CorrelatedParameter:
+          case ExpressionType::Placeholder:
+          case ExpressionType::LQPSelect:
+          case ExpressionType::PQPSelect:
+            recyclable = false;
+            break;
+          default:
+            break;
+        }
+        return recyclable ? ExpressionVisitation::VisitArguments : ExpressionVisitation::DoNotVisitArguments;
+      });
+    }
+
+    return recyclable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  return recyclable;
+}
+
+IntermediateResultRecycler::Subplan IntermediateResultRecycler::capture_subplan(
+    const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto subplan = Subplan{lqp, 0, SQLResultCacheEntry::current_table_versions(lqp_find_accessed_tables(lqp))};
+
+  // The descriptions include the expressions of the nodes. Subplans with equal keys are compared with operator==.
+  visit_lqp(lqp, [&](const auto& node) {
+    boost::hash_combine(subplan.key, node->description());
+    return LQPVisitation::VisitInputs;
+  });
+  for (const auto& table_version : subplan.table_versions) {
+    boost::hash_combine(subplan.key, table_version.table_name);
+    boost::hash_combine(subplan.key, table_version.last_commit_id);
+    boost::hash_combine(subplan.key, table_version.direct_append_count);
+  }
+
+  return subplan;
+}
+
+std::shared_ptr<const Table> IntermediateResultRecycler::try_get(const Subplan& subplan,
+                                                                 const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_cache.has(subplan.key)) return nullptr;
+
+  const auto entry = _cache.get(subplan.key);
+  if (*entry->lqp != *subplan.lqp || !entry->result.is_valid_for(snapshot_commit_id)) return nullptr;
+  return entry->result.result_table;
+}
+
+void IntermediateResultRecycler::offer(const Subplan& subplan, const std::shared_ptr<const Table>& result_table,
+                                       const double cost, const CommitID snapshot_commit_id) {
+  const auto memory_usage = std::max(result_table->estimate_memory_usage(), size_t{1});
+  const auto entry = std::make_shared<const Entry>(
+      Entry{subplan.lqp->deep_copy(), SQLResultCacheEntry{subplan.table_versions, result_table}, memory_usage});
+  if (!entry->result.is_valid_for(snapshot_commit_id)) return;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (memory_usage > _memory_budget) return;
+
+  // The entry replaces the result of a different subplan with the same key
+  if (_cache.has(subplan.key)) _memory_usage -= _cache.get(subplan.key)->memory_usage;
+
+  _cache.set(subplan.key, entry, cost, static_cast<double>(memory_usage));
+  _memory_usage += memory_usage;
+  _evict_until_within_budget(_memory_budget);
+}
+
+void IntermediateResultRecycler::set_memory_budget(const size_t memory_budget) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _evict_until_within_budget(memory_budget);
+  _memory_budget = memory_budget;
+}
+
+size_t IntermediateResultRecycler::memory_budget() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_budget;
+}
+
+size_t IntermediateResultRecycler::memory_usage() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _memory_usage;
+}
+
+size_t IntermediateResultRecycler::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cache.size();
+}
+
+void IntermediateResultRecycler::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _cache.clear();
+  _memory_usage = 0;
+}
+
+void IntermediateResultRecycler::_evict_until_within_budget(const size_t memory_budget) {
+  while (_memory_usage > memory_budget) {
+    _memory_usage -= _cache.queue().top().value->memory_usage;
+    _cache.evict();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/gdfs_cache.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Keeps the results of expensive subplans (joins and aggregates) across queries, so that queries that share a subplan
+ * but, e.g., compute different aggregates on top of it, only compute it once. In contrast to the SQLResultCache, which
+ * keeps the results of whole statements, a result is recycled for any equal subplan of a later query. The LQPTranslator
+ * translates such subplans into a TableWrapper of the recycled result.
+ *
+ * A subplan is identified by a hash of its structure and expressions combined with the versions of the tables it reads
+ * (see SQLResultCacheEntry::TableVersion). Its result is recycled for an equal subplan if the tables are unchanged and
+ * the snapshot of the query sees their last commit. Changing a table thus makes the results computed from it
+ * unreachable, and they are evicted eventually.
+ *
+ * The results are kept in a GDFSCache whose total size is bounded by the memory budget. The cost of an entry is the
+ * time it took to compute the result, its size is the memory usage of the result table. Recycling is disabled while the
+ * budget is zero, which is the default.
+ */
+class IntermediateResultRecycler : public Singleton<IntermediateResultRecycler> {
+ public:
+  // A subplan whose result might be recycled, with the versions of the tables it read when it was translated
+  struct Subplan {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    size_t key;
+    std::vector<SQLResultCacheEntry::TableVersion> table_versions;
+  };
+
+  /**
+   * Whether the result of the subplan may be recycled. This is the case for joins and aggregates of stored tables that
+   * are only read through Validates, as other queries would see different rows of them otherwise. Subplans with
+   * subqueries or placeholders are not recycled.
+   */
+  static bool is_recyclable(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Captures the current versions of the tables that the subplan reads. Has to be called after the snapshot of the
+  // query was taken (see SQLResultCacheEntry::is_valid_for()).
+  static Subplan capture_subplan(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Returns the result of an equal subplan that read the same versions of the tables, or nullptr
+  std::shared_ptr<const Table> try_get(const Subplan& subplan, const CommitID snapshot_commit_id);
+
+  // Keeps the result of the subplan, which took @param cost nanoseconds to compute, if it fits into the memory budget
+  void offer(const Subplan& subplan, const std::shared_ptr<const Table>& result_table, const double cost,
+             const CommitID snapshot_commit_id);
+
+  // Evicts entries until the rest fits into the new budget
+  void set_memory_budget(const size_t memory_budget);
+  size_t memory_budget() const;
+
+  size_t memory_usage() const;
+  size_t size() const;
+
+  void clear();
+
+ protected:
+  friend class Singleton;
+
+  struct Entry {
+    std::shared_ptr<const AbstractLQPNode> lqp;
+    SQLResultCacheEntry result;
+    size_t memory_usage;
+  };
+
+  IntermediateResultRecycler();
+
+  void _evict_until_within_budget(const size_t memory_budget);
+
+  mutable std::mutex _mutex;
+
+  // The capacity of the cache is not limited, entries are evicted by their memory usage instead
+  GDFSCache<size_t, std::shared_ptr<const Entry>> _cache;
+  size_t _memory_budget{0};
+  size_t _memory_usage{0};
+};
+
+}  // namespace opossum
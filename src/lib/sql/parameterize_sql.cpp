@@ -0,0 +1,229 @@
+#include "parameterize_sql.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <cctype>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "expression/value_expression.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Keywords whose literal operand is part of the syntax rather than a value
+const std::unordered_set<std::string> KEYWORDS_BEFORE_KEPT_LITERALS = {"LIMIT", "OFFSET", "DATE", "TIMESTAMP",
+                                                                       "INTERVAL"};
+
+// Keywords after which a minus sign belongs to a negative number literal
+const std::unordered_set<std::string> KEYWORDS_BEFORE_OPERANDS = {"AND", "OR", "NOT", "BETWEEN", "IN", "WHERE"};
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+// Whether a minus sign after the given word or symbol is the sign of a number rather than a binary minus
+bool is_operand_position(const std::string& previous_word, const char previous_symbol) {
+  if (!previous_word.empty()) return KEYWORDS_BEFORE_OPERANDS.count(previous_word) > 0;
+  return previous_symbol == '=' || previous_symbol == '<' || previous_symbol == '>' || previous_symbol == '(' ||
+         previous_symbol == ',';
+}
+
+// Returns a ValueExpression of the type that the SQLTranslator gives a number literal, or nullptr if it is malformed
+std::shared_ptr<AbstractExpression> number_value(const std::string& number) {
+  auto parsed_length = size_t{0};
+  try {
+    if (number.find_first_of(".eE") != std::string::npos) {
+      const auto value = std::stod(number, &parsed_length);
+      if (parsed_length != number.size()) return nullptr;
+      return std::make_shared<ValueExpression>(value);
+    }
+
+    const auto value = std::stoll(number, &parsed_length);
+    if (parsed_length != number.size()) return nullptr;
+    if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+      return std::make_shared<ValueExpression>(static_cast<int32_t>(value));
+    }
+    return std::make_shared<ValueExpression>(static_cast<int64_t>(value));
+  } catch (const std::logic_error&) {
+    return nullptr;
+  }
+}
+
+bool is_placeholder_compared_to_column(const hsql::Expr* placeholder, const hsql::Expr* other_operand) {
+  return placeholder && placeholder->type == hsql::kExprParameter && other_operand &&
+         other_operand->type == hsql::kExprColumnRef;
+}
+
+size_t count_placeholders_compared_to_columns(const hsql::SelectStatement& select);
+
+size_t count_placeholders_compared_to_columns(const hsql::Expr* expr) {
+  if (!expr) return 0;
+
+  auto count = size_t{0};
+
+  if (expr->type == hsql::kExprOperator) {
+    switch (expr->opType) {
+      case hsql::kOpEquals:
+      case hsql::kOpNotEquals:
+      case hsql::kOpLess:
+      case hsql::kOpLessEq:
+      case hsql::kOpGreater:
+      case hsql::kOpGreaterEq:
+        count += is_placeholder_compared_to_column(expr->expr, expr->expr2) ? 1 : 0;
+        count += is_placeholder_compared_to_column(expr->expr2, expr->expr) ? 1 : 0;
+        break;
+
+      case hsql::kOpBetween:
+      case hsql::kOpIn:
+        if (expr->exprList) {
+          for (const auto* list_element : *expr->exprList) {
+            count += is_placeholder_compared_to_column(list_element, expr->expr) ? 1 : 0;
+          }
+        }
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  // Placeholders in other positions, e.g., in arithmetics, are not counted, only the predicates they are part of
+  if (expr->type != hsql::kExprOperator || expr->opType == hsql::kOpAnd || expr->opType == hsql::kOpOr ||
+      expr->opType == hsql::kOpNot) {
+    count += count_placeholders_compared_to_columns(expr->expr);
+    count += count_placeholders_compared_to_columns(expr->expr2);
+  }
+  if (expr->select) count += count_placeholders_compared_to_columns(*expr->select);
+
+  return count;
+}
+
+size_t count_placeholders_compared_to_columns(const hsql::SelectStatement& select) {
+  return count_placeholders_compared_to_columns(select.whereClause);
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::optional<ParameterizedSQL> parameterize_sql(const std::string& sql) {
+  auto parameterized_sql = ParameterizedSQL{};
+  auto& normalized_sql = parameterized_sql.sql;
+  normalized_sql.reserve(sql.size());
+
+  // The previous keyword or identifier (upper case) and the previous other character, whichever came last
+  auto previous_word = std::string{};
+  auto previous_symbol = '\0';
+
+  const auto add_literal = [&](const std::shared_ptr<AbstractExpression>& value, const std::string& literal) {
+    if (KEYWORDS_BEFORE_KEPT_LITERALS.count(previous_word)) {
+      normalized_sql += literal;
+    } else {
+      normalized_sql += '?';
+      parameterized_sql.values.emplace_back(value);
+    }
+    previous_word.clear();
+    previous_symbol = '?';
+  };
+
+  for (auto position = size_t{0}; position < sql.size();) {
+    const auto character = sql[position];
+
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      normalized_sql += character;
+      ++position;
+
+    } else if (character == '-' && position + 1 < sql.size() && sql[position + 1] == '-') {
+      // Comments are dropped, the line break stays
+      position = sql.find('\n', position);
+      if (position == std::string::npos) position = sql.size();
+
+    } else if (character == '?') {
+      // Placeholders of the query itself would be numbered together with the ones for the literals
+      return std::nullopt;
+
+    } else if (character == '\'') {
+      // String literal, a quote within it is escaped by doubling it
+      auto value = std::string{};
+      auto end = position + 1;
+      while (true) {
+        if (end >= sql.size()) return std::nullopt;
+        if (sql[end] == '\'') {
+          if (end + 1 < sql.size() && sql[end + 1] == '\'') {
+            value += '\'';
+            end += 2;
+            continue;
+          }
+          break;
+        }
+        value += sql[end];
+        ++end;
+      }
+      add_literal(std::make_shared<ValueExpression>(value), sql.substr(position, end + 1 - position));
+      position = end + 1;
+
+    } else if (character == '"' || character == '`') {
+      // Quoted identifier
+      const auto end = sql.find(character, position + 1);
+      if (end == std::string::npos) return std::nullopt;
+      normalized_sql += sql.substr(position, end + 1 - position);
+      previous_word = "IDENTIFIER";
+      position = end + 1;
+
+    } else if (is_digit(character) || (character == '-' && position + 1 < sql.size() && is_digit(sql[position + 1]) &&
+                                       is_operand_position(previous_word, previous_symbol))) {
+      // Number literal, including the sign of an exponent
+      auto end = position + 1;
+      while (end < sql.size()) {
+        const auto is_exponent_sign =
+            (sql[end] == '+' || sql[end] == '-') && (sql[end - 1] == 'e' || sql[end - 1] == 'E');
+        if (!is_identifier_character(sql[end]) && sql[end] != '.' && !is_exponent_sign) break;
+        ++end;
+      }
+      const auto literal = sql.substr(position, end - position);
+      const auto value = number_value(literal);
+      if (!value) return std::nullopt;
+      add_literal(value, literal);
+      position = end;
+
+    } else if (is_identifier_character(character)) {
+      auto end = position + 1;
+      while (end < sql.size() && is_identifier_character(sql[end])) ++end;
+      const auto word = sql.substr(position, end - position);
+      normalized_sql += word;
+      previous_word = boost::to_upper_copy(word);
+      position = end;
+
+    } else {
+      normalized_sql += character;
+      previous_word.clear();
+      previous_symbol = character;
+      ++position;
+    }
+  }
+
+  if (parameterized_sql.values.empty()) return std::nullopt;
+
+  return parameterized_sql;
+}
+
+bool placeholders_are_scan_values(const hsql::SQLParserResult& parsed_sql, const size_t placeholder_count) {
+  if (!parsed_sql.isValid() || parsed_sql.size() != 1 || !parsed_sql.getStatement(0)->isType(hsql::kStmtSelect)) {
+    return false;
+  }
+
+  // Each placeholder is counted at most once, so all of them are in the expected positions if the counts match
+  const auto& select = static_cast<const hsql::SelectStatement&>(*parsed_sql.getStatement(0));
+  return count_placeholders_compared_to_columns(select) == placeholder_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "SQLParser.h"
+
+namespace opossum {
+
+class AbstractExpression;
+
+/**
+ * A SQL string with its literals replaced by placeholders, e.g., `SELECT * FROM t WHERE a = ? AND b < ?` and the
+ * values 5 and 'x' for `SELECT * FROM t WHERE a = 5 AND b < 'x'`. Queries that only differ in their literals share the
+ * same parameterized SQL, under which the SQLParameterizedPlanCache caches their optimized plan.
+ */
+struct ParameterizedSQL {
+  std::string sql;
+
+  // One ValueExpression per placeholder, in the order of the placeholders, typed as the SQLTranslator types literals
+  std::vector<std::shared_ptr<AbstractExpression>> values;
+};
+
+/**
+ * Replaces the integer, float and string literals of @param sql with placeholders. Literals that follow LIMIT, OFFSET,
+ * DATE, TIMESTAMP or INTERVAL are kept, as they cannot be placeholders. Returns std::nullopt if the SQL string
+ * contains no literals or placeholders of its own.
+ *
+ * This is a purely lexical transformation. Use placeholders_are_scan_values() on the parsed result to check whether
+ * the plan of the parameterized SQL can be used for the original query.
+ */
+std::optional<ParameterizedSQL> parameterize_sql(const std::string& sql);
+
+/**
+ * Checks whether @param parsed_sql is a single SELECT statement in whose WHERE clauses (including those of nested
+ * SELECTs in the WHERE clauses) each of its @param placeholder_count placeholders is compared to a column, i.e., is
+ * the operand of a comparison, BETWEEN, or IN list whose other operand is a column. Such placeholders do not
+ * influence the structure of the plan, and the plan stays valid for all of their values.
+ */
+bool placeholders_are_scan_values(const hsql::SQLParserResult& parsed_sql, const size_t placeholder_count);
+
+}  // namespace opossum
@@ -7,7 +7,9 @@
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "sql/explain.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/tracing/probes.hpp"
 
@@ -15,24 +17,35 @@ namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries)
+                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                         const UseQueryArena use_query_arena,
+                         const std::shared_ptr<SchedulingGroup>& scheduling_group,
+                         const std::optional<size_t>& memory_limit, const size_t max_conflict_retries,
+                         const UseParameterizedPlanCache use_parameterized_plan_cache,
+                         const UseResultCache use_result_cache,
+                         const std::optional<std::chrono::milliseconds>& statement_timeout,
+                         const std::shared_ptr<const CancellationToken>& cancellation_token)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
   DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
               "Transaction context without MVCC enabled makes no sense");
 
+  const auto [explain_mode, statement_sql] = strip_explain_prefix(sql);
+  _explain_mode = explain_mode;
+
   hsql::SQLParserResult parse_result;
 
   const auto start = std::chrono::high_resolution_clock::now();
-  hsql::SQLParser::parse(sql, &parse_result);
+  hsql::SQLParser::parse(statement_sql, &parse_result);
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics.parse_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - start);
   DTRACE_PROBE2(HYRISE, SQL_PARSING, sql.c_str(), _metrics.parse_time_nanos.count());
 
-  AssertInput(parse_result.isValid(), create_sql_parser_error_message(sql, parse_result));
+  AssertInput(parse_result.isValid(), create_sql_parser_error_message(statement_sql, parse_result));
   DebugAssert(parse_result.size() > 0, "Cannot create empty SQLPipeline.");
+  AssertInput(_explain_mode == ExplainMode::None || parse_result.size() == 1, "EXPLAIN expects a single statement");
 
   _sql_pipeline_statements.reserve(parse_result.size());
 
@@ -70,12 +83,13 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
 
     // Get the statement string from the original query string, so we can pass it to the SQLPipelineStatement
     const auto statement_string_length = statement->stringLength;
-    const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
+    const auto statement_string = boost::trim_copy(statement_sql.substr(sql_string_offset, statement_string_length));
     sql_string_offset += statement_string_length;
 
-    auto pipeline_statement =
-        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, cleanup_temporaries);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, std::move(parsed_statement), use_mvcc, transaction_context, lqp_translator, optimizer,
+        cleanup_temporaries, use_query_arena, scheduling_group, memory_limit, max_conflict_retries,
+        use_parameterized_plan_cache, use_result_cache, statement_timeout, cancellation_token, _explain_mode);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -198,7 +212,10 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
 
   for (auto& pipeline_statement : _sql_pipeline_statements) {
     pipeline_statement->get_result_table();
-    if (_transaction_context && _transaction_context->aborted()) {
+
+    // The transaction of an auto-committed statement stays rolled back if it ran out of conflict retries
+    const auto& transaction_context = pipeline_statement->transaction_context();
+    if (transaction_context && transaction_context->aborted()) {
       _failed_pipeline_statement = pipeline_statement;
       _result_tables.clear();
       return _result_tables;
@@ -222,6 +239,8 @@ size_t SQLPipeline::statement_count() const { return _sql_pipeline_statements.si
 
 bool SQLPipeline::requires_execution() const { return _requires_execution; }
 
+ExplainMode SQLPipeline::explain_mode() const { return _explain_mode; }
+
 const SQLPipelineMetrics& SQLPipeline::metrics() {
   if (_metrics.statement_metrics.empty()) {
     _metrics.statement_metrics.reserve(statement_count());
@@ -233,12 +252,34 @@ const SQLPipelineMetrics& SQLPipeline::metrics() {
   return _metrics;
 }
 
+std::vector<OptimizerRuleMetrics> SQLPipelineMetrics::optimizer_rule_metrics() const {
+  auto summed_rule_metrics = std::vector<OptimizerRuleMetrics>{};
+
+  for (const auto& statement_metric : statement_metrics) {
+    for (const auto& rule_metrics : statement_metric->optimizer_rule_metrics) {
+      const auto summed_iter =
+          std::find_if(summed_rule_metrics.begin(), summed_rule_metrics.end(),
+                       [&](const auto& summed_metrics) { return summed_metrics.rule_name == rule_metrics.rule_name; });
+      if (summed_iter == summed_rule_metrics.end()) {
+        summed_rule_metrics.emplace_back(rule_metrics);
+        continue;
+      }
+
+      summed_iter->duration += rule_metrics.duration;
+      summed_iter->changed_plan |= rule_metrics.changed_plan;
+    }
+  }
+
+  return summed_rule_metrics;
+}
+
 std::string SQLPipelineMetrics::to_string() const {
   auto total_sql_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_optimize_nanos = std::chrono::nanoseconds::zero();
   auto total_lqp_translate_nanos = std::chrono::nanoseconds::zero();
   auto total_execute_nanos = std::chrono::nanoseconds::zero();
   std::vector<bool> query_plan_cache_hits;
+  auto peak_memory_usage_bytes = size_t{0};
 
   for (const auto& statement_metric : statement_metrics) {
     total_sql_translate_nanos += statement_metric->sql_translate_time_nanos;
@@ -247,6 +288,7 @@ std::string SQLPipelineMetrics::to_string() const {
     total_execute_nanos += statement_metric->execution_time_nanos;
 
     query_plan_cache_hits.push_back(statement_metric->query_plan_cache_hit);
+    peak_memory_usage_bytes = std::max(peak_memory_usage_bytes, statement_metric->peak_memory_usage_bytes);
   }
 
   const auto num_cache_hits = std::count(query_plan_cache_hits.begin(), query_plan_cache_hits.end(), true);
@@ -258,7 +300,18 @@ std::string SQLPipelineMetrics::to_string() const {
   info_string << "OPTIMIZE: " << format_duration(total_optimize_nanos) << ", ";
   info_string << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
   info_string << "EXECUTE: " << format_duration(total_execute_nanos) << " (wall time) | ";
-  info_string << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size() << " statement(s)";
+  info_string << "QUERY PLAN CACHE HITS: " << num_cache_hits << "/" << query_plan_cache_hits.size()
+              << " statement(s) | ";
+  info_string << "PEAK MEMORY: " << format_bytes(peak_memory_usage_bytes);
+
+  const auto rule_metrics = optimizer_rule_metrics();
+  const auto slowest_rule_iter = std::max_element(
+      rule_metrics.cbegin(), rule_metrics.cend(),
+      [](const auto& lhs, const auto& rhs) { return lhs.duration < rhs.duration; });
+  if (slowest_rule_iter != rule_metrics.cend()) {
+    info_string << " | SLOWEST OPTIMIZER RULE: " << slowest_rule_iter->rule_name << " ("
+                << format_duration(slowest_rule_iter->duration) << ")";
+  }
   info_string << "]\n";
 
   return info_string.str();
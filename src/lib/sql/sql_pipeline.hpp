@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
@@ -20,6 +22,10 @@ struct SQLPipelineMetrics {
   // This is different from the other measured times as we only get this for all statements at once
   std::chrono::nanoseconds parse_time_nanos{0};
 
+  // The metrics of the optimizer rules, summed up over the statements for each rule and in the order in which the rules
+  // were first applied. A rule changed the plan if it changed the plan of any statement.
+  std::vector<OptimizerRuleMetrics> optimizer_rule_metrics() const;
+
   std::string to_string() const;
 };
 
@@ -35,7 +41,13 @@ class SQLPipeline : public Noncopyable {
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const UseQueryArena use_query_arena = UseQueryArena::No,
+              const std::shared_ptr<SchedulingGroup>& scheduling_group = nullptr,
+              const std::optional<size_t>& memory_limit = std::nullopt, const size_t max_conflict_retries = 0,
+              const UseParameterizedPlanCache use_parameterized_plan_cache = UseParameterizedPlanCache::No,
+              const UseResultCache use_result_cache = UseResultCache::No,
+              const std::optional<std::chrono::milliseconds>& statement_timeout = std::nullopt,
+              const std::shared_ptr<const CancellationToken>& cancellation_token = nullptr);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -74,6 +86,10 @@ class SQLPipeline : public Noncopyable {
   // another uses it)
   bool requires_execution() const;
 
+  // Whether the SQL string was prefixed with EXPLAIN or EXPLAIN ANALYZE. It then holds a single statement, whose result
+  // table describes its plan, see SQLPipelineStatement::get_result_table().
+  ExplainMode explain_mode() const;
+
   const SQLPipelineMetrics& metrics();
 
  private:
@@ -99,6 +115,8 @@ class SQLPipeline : public Noncopyable {
   // --> requires execution of first statement before the second one can be translated
   bool _requires_execution{false};
 
+  ExplainMode _explain_mode{ExplainMode::None};
+
   SQLPipelineMetrics _metrics{};
 
   std::shared_ptr<SQLPipelineStatement> _failed_pipeline_statement;
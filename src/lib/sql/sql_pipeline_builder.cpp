@@ -1,4 +1,6 @@
 #include "sql_pipeline_builder.hpp"
+
+#include "sql/explain.hpp"
 #include "utils/tracing/probes.hpp"
 
 namespace opossum {
@@ -35,11 +37,56 @@ SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::enable_query_arena() {
+  _use_query_arena = UseQueryArena::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_scheduling_group(
+    const std::shared_ptr<SchedulingGroup>& scheduling_group) {
+  _scheduling_group = scheduling_group;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_memory_limit(const size_t bytes) {
+  _memory_limit = bytes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_conflict_retries(const size_t max_retries) {
+  _max_conflict_retries = max_retries;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::enable_parameterized_plan_cache() {
+  _use_parameterized_plan_cache = UseParameterizedPlanCache::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::enable_result_cache() {
+  _use_result_cache = UseResultCache::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_statement_timeout(const std::chrono::milliseconds timeout) {
+  _statement_timeout = timeout;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_cancellation_token(
+    const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  _cancellation_token = cancellation_token;
+  return *this;
+}
+
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries,
+                              _use_query_arena, _scheduling_group, _memory_limit, _max_conflict_retries,
+                              _use_parameterized_plan_cache, _use_result_cache, _statement_timeout,
+                              _cancellation_token);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_strings().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -49,9 +96,24 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
     std::shared_ptr<hsql::SQLParserResult> parsed_sql) const {
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
+  auto [explain_mode, statement_sql] = strip_explain_prefix(_sql);
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc, _transaction_context, lqp_translator,
-          optimizer, _cleanup_temporaries};
+  return {std::move(statement_sql),
+          std::move(parsed_sql),
+          _use_mvcc,
+          _transaction_context,
+          lqp_translator,
+          optimizer,
+          _cleanup_temporaries,
+          _use_query_arena,
+          _scheduling_group,
+          _memory_limit,
+          _max_conflict_retries,
+          _use_parameterized_plan_cache,
+          _use_result_cache,
+          _statement_timeout,
+          _cancellation_token,
+          explain_mode};
 }
 
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -10,6 +12,7 @@
 
 namespace opossum {
 
+class CancellationToken;
 class Optimizer;
 
 /**
@@ -52,6 +55,56 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& dont_cleanup_temporaries();
 
+  /*
+   * Allocate intermediate results of each statement from an arena that is released at once, see ArenaMemoryResource.
+   * The result table keeps the arena alive.
+   */
+  SQLPipelineBuilder& enable_query_arena();
+
+  /*
+   * Execute the tasks of each statement as part of the given SchedulingGroup, see there
+   */
+  SQLPipelineBuilder& with_scheduling_group(const std::shared_ptr<SchedulingGroup>& scheduling_group);
+
+  /*
+   * Fail each statement whose intermediate results exceed @param bytes, or let it spill where supported, see
+   * TrackingMemoryResource
+   */
+  SQLPipelineBuilder& with_memory_limit(const size_t bytes);
+
+  /*
+   * Execute each auto-committed statement again, up to @param max_retries times, if its transaction was rolled back
+   * because of a write conflict. Statements in a transaction passed via with_transaction_context() are not retried,
+   * as the transaction has to be rolled back as a whole.
+   */
+  SQLPipelineBuilder& with_conflict_retries(const size_t max_retries);
+
+  /*
+   * Reuse the optimized plan of a SELECT for all SELECTs that only differ in the values they compare columns to, see
+   * parameterize_sql(). This saves the optimization of frequent queries whose literals change, e.g., from ORMs, but the
+   * plan cannot use optimizations that depend on the values, such as pruning chunks.
+   */
+  SQLPipelineBuilder& enable_parameterized_plan_cache();
+
+  /*
+   * Answer each auto-committed SELECT from the SQLResultCache if it was executed before and the tables it reads have
+   * not changed since, and cache its result otherwise. This serves queries that are repeated more often than the data
+   * changes, e.g., from dashboards, without executing them.
+   */
+  SQLPipelineBuilder& enable_result_cache();
+
+  /*
+   * Cancel each statement that is still executing @param timeout after its execution started, see CancellationToken.
+   * The statement then fails with a QueryCancelledException.
+   */
+  SQLPipelineBuilder& with_statement_timeout(const std::chrono::milliseconds timeout);
+
+  /*
+   * Cancel the statements once @param cancellation_token is cancelled, e.g., by a Postgres CancelRequest. Without it,
+   * the statements use the token of the task that executes them, if any.
+   */
+  SQLPipelineBuilder& with_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+
   SQLPipeline create_pipeline() const;
 
   /**
@@ -68,6 +121,14 @@ class SQLPipelineBuilder final {
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   CleanupTemporaries _cleanup_temporaries{true};
+  UseQueryArena _use_query_arena{UseQueryArena::No};
+  std::shared_ptr<SchedulingGroup> _scheduling_group;
+  std::optional<size_t> _memory_limit;
+  size_t _max_conflict_retries{0};
+  UseParameterizedPlanCache _use_parameterized_plan_cache{UseParameterizedPlanCache::No};
+  UseResultCache _use_result_cache{UseResultCache::No};
+  std::optional<std::chrono::milliseconds> _statement_timeout;
+  std::shared_ptr<const CancellationToken> _cancellation_token;
 };
 
 }  // namespace opossum
@@ -2,8 +2,12 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
 #include <iomanip>
+#include <memory>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "SQLParser.h"
 #include "concurrency/transaction_manager.hpp"
@@ -11,12 +15,21 @@
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/scheduling_group.hpp"
+#include "sql/explain.hpp"
+#include "sql/intermediate_result_recycler.hpp"
+#include "sql/parameterize_sql.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "storage/prepared_plan.hpp"
+#include "utils/arena_memory_resource.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
+#include "utils/tracking_memory_resource.hpp"
 
 namespace opossum {
 
@@ -25,16 +38,34 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const UseQueryArena use_query_arena,
+                                           const std::shared_ptr<SchedulingGroup>& scheduling_group,
+                                           const std::optional<size_t>& memory_limit,
+                                           const size_t max_conflict_retries,
+                                           const UseParameterizedPlanCache use_parameterized_plan_cache,
+                                           const UseResultCache use_result_cache,
+                                           const std::optional<std::chrono::milliseconds>& statement_timeout,
+                                           const std::shared_ptr<const CancellationToken>& cancellation_token,
+                                           const ExplainMode explain_mode)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
       _transaction_context(transaction_context),
       _lqp_translator(lqp_translator),
       _optimizer(optimizer),
+      _query_arena(use_query_arena == UseQueryArena::Yes ? std::make_shared<ArenaMemoryResource>() : nullptr),
+      _query_memory_resource(std::make_shared<TrackingMemoryResource>(_query_arena, memory_limit)),
+      _scheduling_group(scheduling_group),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _max_conflict_retries(max_conflict_retries),
+      _use_parameterized_plan_cache(use_parameterized_plan_cache),
+      _use_result_cache(use_result_cache),
+      _statement_timeout(statement_timeout),
+      _cancellation_token(cancellation_token),
+      _explain_mode(explain_mode) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -105,11 +136,19 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
     }
   }
 
+  if (_use_parameterized_plan_cache == UseParameterizedPlanCache::Yes &&
+      get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect)) {
+    if (const auto instantiated_plan = _instantiate_parameterized_plan()) {
+      _optimized_logical_plan = instantiated_plan;
+      return _optimized_logical_plan;
+    }
+  }
+
   const auto& unoptimized_lqp = get_unoptimized_logical_plan();
 
   const auto started = std::chrono::high_resolution_clock::now();
 
-  _optimized_logical_plan = _optimizer->optimize(unoptimized_lqp);
+  _optimized_logical_plan = _optimizer->optimize(unoptimized_lqp, &_metrics->optimizer_rule_metrics);
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->optimize_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
@@ -130,16 +169,28 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
     return _physical_plan;
   }
 
+  const auto is_select = get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect);
+
   // If we need a transaction context but haven't passed one in, this is the latest point where we can create it
   if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
-    _transaction_context = TransactionManager::get().new_transaction_context();
+    // An auto-committed SELECT only needs a snapshot, not a transaction that takes part in the commit order
+    _transaction_context = is_select ? TransactionManager::get().new_read_only_transaction_context()
+                                     : TransactionManager::get().new_transaction_context();
   }
 
+  // Like the SQLResultCache, the IntermediateResultRecycler is only used by auto-committed SELECTs, whose results do
+  // not include changes of their own. Their plans are translated anew, so that they use the current recycled results.
+  const auto uses_recycler = _use_mvcc == UseMvcc::Yes && _auto_commit && is_select &&
+                             _explain_mode == ExplainMode::None &&
+                             IntermediateResultRecycler::get().memory_budget() > 0;
+  auto uses_recycled_results = false;
+
   // Stores when the actual compilation started/ended
   auto started = std::chrono::high_resolution_clock::now();
   auto done = started;  // dummy value needed for initialization
 
-  if (const auto cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_sql_string)) {
+  const auto cached_physical_plan = uses_recycler ? std::nullopt : SQLPhysicalPlanCache::get().try_get(_sql_string);
+  if (cached_physical_plan) {
     if ((*cached_physical_plan)->transaction_context_is_set()) {
       Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
     } else {
@@ -155,15 +206,24 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
     // Reset time to exclude previous pipeline steps
     started = std::chrono::high_resolution_clock::now();
-    _physical_plan = _lqp_translator->translate_node(lqp);
+    if (uses_recycler) {
+      _lqp_translator->enable_recycling(_transaction_context->snapshot_commit_id());
+      _physical_plan = _lqp_translator->translate_node(lqp);
+      auto recycling_report = _lqp_translator->disable_recycling();
+      _recycling_candidates = std::move(recycling_report.candidates);
+      uses_recycled_results = recycling_report.uses_recycled_results;
+    } else {
+      _physical_plan = _lqp_translator->translate_node(lqp);
+    }
   }
 
   done = std::chrono::high_resolution_clock::now();
 
   if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
+  _physical_plan->set_memory_resource_recursively(_query_memory_resource);
 
   // Cache newly created plan for the according sql statement (only if not already cached)
-  if (!_metrics->query_plan_cache_hit) {
+  if (!_metrics->query_plan_cache_hit && !_uses_parameterized_plan && !uses_recycled_results) {
     SQLPhysicalPlanCache::get().set(_sql_string, _physical_plan);
   }
 
@@ -172,12 +232,89 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   return _physical_plan;
 }
 
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_instantiate_parameterized_plan() {
+  const auto parameterized_sql = parameterize_sql(_sql_string);
+  if (!parameterized_sql) return nullptr;
+
+  const auto started = std::chrono::high_resolution_clock::now();
+
+  auto prepared_plan = std::shared_ptr<PreparedPlan>{};
+  auto cache_hit = false;
+  if (const auto cached_plan = SQLParameterizedPlanCache::get().try_get(parameterized_sql->sql)) {
+    prepared_plan = *cached_plan;
+    if (!prepared_plan) return nullptr;
+
+    // MVCC-enabled and MVCC-disabled LQPs will evict each other
+    cache_hit = lqp_is_validated(prepared_plan->lqp) == (_use_mvcc == UseMvcc::Yes);
+  }
+
+  if (!cache_hit) {
+    hsql::SQLParserResult parsed_sql;
+    hsql::SQLParser::parse(parameterized_sql->sql, &parsed_sql);
+
+    // Literals in other positions, e.g., in projections, can determine the plan or the type of its results
+    if (!placeholders_are_scan_values(parsed_sql, parameterized_sql->values.size())) {
+      SQLParameterizedPlanCache::get().set(parameterized_sql->sql, nullptr);
+      return nullptr;
+    }
+
+    SQLTranslator sql_translator{_use_mvcc};
+    const auto lqp_roots = sql_translator.translate_parser_result(parsed_sql);
+    DebugAssert(lqp_roots.size() == 1, "Expected exactly one LQP root for a single statement");
+
+    const auto optimized_lqp = _optimizer->optimize(lqp_roots.front(), &_metrics->optimizer_rule_metrics);
+    prepared_plan = std::make_shared<PreparedPlan>(optimized_lqp, sql_translator.parameter_ids_of_value_placeholders());
+    prepared_plan->is_optimized = true;
+    SQLParameterizedPlanCache::get().set(parameterized_sql->sql, prepared_plan);
+  }
+
+  const auto lqp = prepared_plan->instantiate(parameterized_sql->values);
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics->optimize_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  _metrics->parameterized_plan_cache_hit = cache_hit;
+  _uses_parameterized_plan = true;
+
+  return lqp;
+}
+
 const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_tasks() {
   if (!_tasks.empty()) {
     return _tasks;
   }
 
   _tasks = OperatorTask::make_tasks_from_operator(get_physical_plan(), _cleanup_temporaries);
+
+  // The result of a candidate is offered when its task is done, before its consumers might clear it
+  for (const auto& task : _tasks) {
+    const auto candidate_iter =
+        std::find_if(_recycling_candidates.cbegin(), _recycling_candidates.cend(),
+                     [&](const auto& candidate) { return candidate.op == task->get_operator(); });
+    if (candidate_iter == _recycling_candidates.cend()) continue;
+
+    const auto snapshot_commit_id = _transaction_context->snapshot_commit_id();
+    task->set_done_callback([candidate = *candidate_iter, snapshot_commit_id]() {
+      const auto result_table = candidate.op->get_output();
+      if (!result_table) return;
+
+      // The cost of the result is the time it took to execute the operators of the subplan
+      auto cost = std::chrono::nanoseconds{0};
+      auto visited_operators = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+      auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{candidate.op};
+      while (!operators.empty()) {
+        const auto op = operators.back();
+        operators.pop_back();
+        if (!op || !visited_operators.emplace(op).second) continue;
+        cost += op->performance_data().walltime;
+        operators.emplace_back(op->input_left());
+        operators.emplace_back(op->input_right());
+      }
+
+      IntermediateResultRecycler::get().offer(candidate.subplan, result_table, static_cast<double>(cost.count()),
+                                              snapshot_commit_id);
+    });
+  }
+
   return _tasks;
 }
 
@@ -186,25 +323,123 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
+  // EXPLAIN only describes the plan. The transaction that was created for the plan has nothing to commit.
+  if (_explain_mode == ExplainMode::Plan) {
+    const auto& physical_plan = get_physical_plan();
+    if (_auto_commit) _transaction_context->commit();
+    _result_table = create_explain_table(physical_plan, _explain_mode);
+    return _result_table;
+  }
+
+  // Only auto-committed statements are answered from the SQLResultCache, as the changes of a transaction of its own
+  // would not be part of the cached result. EXPLAIN ANALYZE has to execute the statement.
+  const auto uses_result_cache = _use_result_cache == UseResultCache::Yes && _auto_commit &&
+                                 _explain_mode == ExplainMode::None &&
+                                 get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect);
+  auto table_versions = std::vector<SQLResultCacheEntry::TableVersion>{};
+  if (uses_result_cache) {
+    // The snapshot is taken before the versions of the tables are read. A commit that is not part of the snapshot has
+    // then either not changed the versions yet, or the versions are not valid for the snapshot.
+    if (!_transaction_context) _transaction_context = TransactionManager::get().new_read_only_transaction_context();
+
+    if (const auto cached_entry = SQLResultCache::get().try_get(_sql_string)) {
+      if ((*cached_entry)->is_valid_for(_transaction_context->snapshot_commit_id())) {
+        _result_table = (*cached_entry)->result_table;
+        _metrics->result_cache_hit = true;
+        _transaction_context->commit();
+        return _result_table;
+      }
+    }
+
+    const auto accessed_tables = lqp_find_accessed_tables(get_optimized_logical_plan());
+    table_versions = SQLResultCacheEntry::current_table_versions(accessed_tables);
+  }
+
   const auto& tasks = get_tasks();
 
   const auto started = std::chrono::high_resolution_clock::now();
 
-  DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
-                reinterpret_cast<uintptr_t>(this));
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  // The timeout covers all retries. Without a token of its own, the statement is cancelled with the task that
+  // executes it, as its tasks inherit the token of that task when they are scheduled.
+  auto cancellation_token = _cancellation_token;
+  if (_statement_timeout) {
+    const auto parent = cancellation_token ? cancellation_token : AbstractTask::current_cancellation_token();
+    cancellation_token =
+        std::make_shared<CancellationToken>(std::chrono::steady_clock::now() + *_statement_timeout, parent);
+  }
 
-  if (_auto_commit) {
+  for (auto retry_count = size_t{0};; ++retry_count) {
+    if (_scheduling_group) {
+      for (const auto& task : tasks) task->set_scheduling_group(_scheduling_group);
+    }
+    if (cancellation_token) {
+      for (const auto& task : tasks) task->set_cancellation_token(cancellation_token);
+    }
+
+    DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
+                  reinterpret_cast<uintptr_t>(this));
+    {
+      // Blocks while the group has as many queries in execution as it admits
+      const SchedulingGroup::ScopedAdmission admission(_scheduling_group);
+      try {
+        CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+      } catch (...) {
+        // E.g., the statement exceeded its memory limit. The changes of the statement are rolled back.
+        _metrics->peak_memory_usage_bytes = _query_memory_resource->peak_allocated_bytes();
+        if (_auto_commit) _transaction_context->rollback();
+        throw;
+      }
+    }
+
+    // A write conflict rolls back the transaction (see OperatorTask). An auto-committed statement can be executed
+    // again in a new transaction, whose snapshot includes the change it conflicted with.
+    if (!_auto_commit || !_transaction_context->aborted() || retry_count == _max_conflict_retries) break;
+
+    TransactionManager::get().record_write_conflict_event(TransactionManager::WriteConflictEvent::StatementRetry,
+                                                          _transaction_context->transaction_id());
+    _transaction_context = TransactionManager::get().new_transaction_context();
+    _physical_plan = _physical_plan->deep_copy();
+    _physical_plan->set_transaction_context_recursively(_transaction_context);
+    _physical_plan->set_memory_resource_recursively(_query_memory_resource);
+    _tasks = OperatorTask::make_tasks_from_operator(_physical_plan, _cleanup_temporaries);
+  }
+
+  // If the conflict persists, the statement fails like one in a transaction (see SQLPipeline::get_result_tables())
+  if (_auto_commit && !_transaction_context->aborted()) {
     _transaction_context->commit();
   }
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->execution_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  _metrics->peak_memory_usage_bytes = _query_memory_resource->peak_allocated_bytes();
+
+  _metrics->operator_performance_data.clear();
+  _metrics->operator_performance_data.reserve(tasks.size());
+  for (const auto& task : tasks) {
+    const auto& op = task->get_operator();
+    _metrics->operator_performance_data.emplace_back(op->description(), op->shared_performance_data());
+  }
 
   // Get output from the last task
   _result_table = tasks.back()->get_operator()->get_output();
   if (_result_table == nullptr) _query_has_output = false;
 
+  if (uses_result_cache && _result_table && !_transaction_context->aborted()) {
+    const auto entry =
+        std::make_shared<SQLResultCacheEntry>(SQLResultCacheEntry{std::move(table_versions), _result_table});
+    if (entry->is_valid_for(_transaction_context->snapshot_commit_id())) {
+      // Large results are evicted first
+      const auto size = std::max(_result_table->estimate_memory_usage(), size_t{1});
+      SQLResultCache::get().set(_sql_string, entry, static_cast<double>(_metrics->execution_time_nanos.count()),
+                                static_cast<double>(size));
+    }
+  }
+
+  if (_explain_mode == ExplainMode::Analyze) {
+    _result_table = create_explain_table(_physical_plan, _explain_mode);
+    _query_has_output = true;
+  }
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translate_time_nanos.count(),
                 _metrics->optimize_time_nanos.count(), _metrics->lqp_translate_time_nanos.count(),
                 _metrics->execution_time_nanos.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -217,4 +452,7 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 const std::shared_ptr<SQLPipelineStatementMetrics>& SQLPipelineStatement::metrics() const { return _metrics; }
+
+ExplainMode SQLPipelineStatement::explain_mode() const { return _explain_mode; }
+
 }  // namespace opossum
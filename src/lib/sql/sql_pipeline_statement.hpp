@@ -1,24 +1,48 @@
 #pragma once
 
+#include <chrono>
+#include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "SQLParserResult.h"
 #include "cache/cache.hpp"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
+#include "operators/operator_performance_data.hpp"
 #include "optimizer/optimizer.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
+class ArenaMemoryResource;
+class CancellationToken;
+class SchedulingGroup;
+class TrackingMemoryResource;
+
 // Holds relevant information about the execution of an SQLPipelineStatement.
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translate_time_nanos{};
   std::chrono::nanoseconds optimize_time_nanos{};
+  std::vector<OptimizerRuleMetrics> optimizer_rule_metrics;
   std::chrono::nanoseconds lqp_translate_time_nanos{};
   std::chrono::nanoseconds execution_time_nanos{};
 
   bool query_plan_cache_hit = false;
+
+  // Whether the optimized LQP was instantiated from a plan cached for the same SQL with other literals
+  bool parameterized_plan_cache_hit = false;
+
+  // Whether the result table was taken from the SQLResultCache instead of executing the statement
+  bool result_cache_hit = false;
+
+  // Peak number of bytes allocated for the intermediate results of the statement, see TrackingMemoryResource
+  size_t peak_memory_usage_bytes{0};
+
+  // Description and performance data of each executed operator, in execution order. As cached PQPs are executed
+  // again, the performance data of a cached operator reflects its most recent execution.
+  std::vector<std::pair<std::string, std::shared_ptr<const OperatorPerformanceData>>> operator_performance_data;
 };
 
 /**
@@ -40,7 +64,16 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries);
+                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                       const UseQueryArena use_query_arena = UseQueryArena::No,
+                       const std::shared_ptr<SchedulingGroup>& scheduling_group = nullptr,
+                       const std::optional<size_t>& memory_limit = std::nullopt,
+                       const size_t max_conflict_retries = 0,
+                       const UseParameterizedPlanCache use_parameterized_plan_cache = UseParameterizedPlanCache::No,
+                       const UseResultCache use_result_cache = UseResultCache::No,
+                       const std::optional<std::chrono::milliseconds>& statement_timeout = std::nullopt,
+                       const std::shared_ptr<const CancellationToken>& cancellation_token = nullptr,
+                       const ExplainMode explain_mode = ExplainMode::None);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -62,7 +95,10 @@ class SQLPipelineStatement : public Noncopyable {
   // Returns all tasks that need to be executed for this query.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
-  // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Executes all tasks, waits for them to finish, and returns the resulting table. An auto-committed statement whose
+  // transaction was rolled back because of a write conflict is executed again, up to max_conflict_retries times.
+  // For EXPLAIN, the statement is not executed and the table describes its physical plan. For EXPLAIN ANALYZE, the
+  // statement is executed and the table describes the executed plan instead of holding its result.
   const std::shared_ptr<const Table>& get_result_table();
 
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
@@ -71,7 +107,14 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
+  // Whether the statement was prefixed with EXPLAIN or EXPLAIN ANALYZE, see strip_explain_prefix()
+  ExplainMode explain_mode() const;
+
  private:
+  // Instantiates the plan of the parameterized SQL string from the SQLParameterizedPlanCache, optimizing and caching it
+  // first if needed. Returns nullptr if the SQL string cannot be parameterized.
+  std::shared_ptr<AbstractLQPNode> _instantiate_parameterized_plan();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -84,12 +127,24 @@ class SQLPipelineStatement : public Noncopyable {
   const std::shared_ptr<LQPTranslator> _lqp_translator;
   const std::shared_ptr<Optimizer> _optimizer;
 
+  // The memory resource for the intermediate results of the physical plan, if enabled (see ArenaMemoryResource).
+  // Declared before the plan, so that it is destroyed after it.
+  const std::shared_ptr<ArenaMemoryResource> _query_arena;
+
+  // Counts the intermediate results (allocated from the arena, if any) and enforces the memory limit, if any
+  const std::shared_ptr<TrackingMemoryResource> _query_memory_resource;
+
+  // The group whose share of the Workers executes the tasks, if any, see SchedulingGroup
+  const std::shared_ptr<SchedulingGroup> _scheduling_group;
+
   // Execution results
   std::shared_ptr<hsql::SQLParserResult> _parsed_sql_statement;
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
   std::shared_ptr<AbstractLQPNode> _optimized_logical_plan;
   std::shared_ptr<AbstractOperator> _physical_plan;
   std::vector<std::shared_ptr<OperatorTask>> _tasks;
+  // Subplans whose results are offered to the IntermediateResultRecycler once they are computed
+  std::vector<LQPTranslator::RecyclingCandidate> _recycling_candidates;
   std::shared_ptr<const Table> _result_table;
   // Assume there is an output table. Only change if nullptr is returned from execution.
   bool _query_has_output = true;
@@ -98,6 +153,22 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  const size_t _max_conflict_retries;
+
+  const UseParameterizedPlanCache _use_parameterized_plan_cache;
+
+  const UseResultCache _use_result_cache;
+
+  // If set, the execution of the statement is cancelled once the timeout has passed, see CancellationToken
+  const std::optional<std::chrono::milliseconds> _statement_timeout;
+  const std::shared_ptr<const CancellationToken> _cancellation_token;
+
+  const ExplainMode _explain_mode;
+
+  // Whether the optimized LQP was instantiated from the SQLParameterizedPlanCache. Its plans are then not cached under
+  // the SQL string itself, so that the caches do not fill up with one plan per literal.
+  bool _uses_parameterized_plan = false;
 };
 
 }  // namespace opossum
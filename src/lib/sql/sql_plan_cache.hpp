@@ -9,8 +9,17 @@ namespace opossum {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class PreparedPlan;
 
 using SQLPhysicalPlanCache = Cache<std::shared_ptr<AbstractOperator>, std::string>;
 using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, std::string>;
 
+// Optimized plans by parameterized SQL (see parameterize_sql()). nullptr marks SQL that cannot be parameterized.
+using SQLParameterizedPlanCache = Cache<std::shared_ptr<PreparedPlan>, std::string>;
+
+// Physical plans of server-side prepared statements, in which CorrelatedParameterExpressions take the place of the
+// placeholders. The key is the SQL string followed by the data types of the parameters, which the plan is specific to.
+// The plans are only copied and never executed themselves, hence they are const.
+using SQLPreparedStatementPlanCache = Cache<std::shared_ptr<const AbstractOperator>, std::string>;
+
 }  // namespace opossum
@@ -0,0 +1,46 @@
+#include "sql_result_cache.hpp"
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::vector<SQLResultCacheEntry::TableVersion> SQLResultCacheEntry::current_table_versions(
+    const std::set<std::string>& table_names) {
+  auto table_versions = std::vector<TableVersion>{};
+  table_versions.reserve(table_names.size());
+
+  for (const auto& table_name : table_names) {
+    const auto table = StorageManager::get().get_table(table_name);
+    table_versions.emplace_back(
+        TableVersion{table_name, table, table->last_commit_id(), table->direct_append_count()});
+  }
+
+  return table_versions;
+}
+
+bool SQLResultCacheEntry::is_valid_for(const CommitID snapshot_commit_id) const {
+  for (const auto& table_version : table_versions) {
+    // A dropped table might have been replaced by a new one of the same name
+    if (!StorageManager::get().has_table(table_version.table_name)) return false;
+    const auto table = StorageManager::get().get_table(table_version.table_name);
+    if (table != table_version.table.lock()) return false;
+
+    if (table->last_commit_id() != table_version.last_commit_id ||
+        table->direct_append_count() != table_version.direct_append_count) {
+      return false;
+    }
+
+    // The last commit might not be visible yet, e.g., for a snapshot that was taken while it was in progress
+    if (table_version.last_commit_id > snapshot_commit_id) return false;
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cache/cache.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * The result of an auto-committed SELECT statement together with the versions of the stored tables that it was
+ * computed from. The result is valid for as long as none of these tables is replaced or changed.
+ */
+struct SQLResultCacheEntry {
+  struct TableVersion {
+    std::string table_name;
+    std::weak_ptr<const Table> table;
+    CommitID last_commit_id;
+    uint64_t direct_append_count;
+  };
+
+  // Captures the current versions of the stored tables with the given names, which have to exist
+  static std::vector<TableVersion> current_table_versions(const std::set<std::string>& table_names);
+
+  // Whether the result is the one a statement with the given snapshot would compute, i.e., whether the tables are
+  // unchanged and the snapshot sees the last commit to each of them
+  bool is_valid_for(const CommitID snapshot_commit_id) const;
+
+  std::vector<TableVersion> table_versions;
+  std::shared_ptr<const Table> result_table;
+};
+
+// Results of SELECT statements by SQL string, see SQLPipelineBuilder::enable_result_cache(). The size of an entry is
+// the memory usage of its result table.
+using SQLResultCache = Cache<std::shared_ptr<SQLResultCacheEntry>, std::string>;
+
+}  // namespace opossum
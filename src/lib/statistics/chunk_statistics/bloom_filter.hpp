@@ -0,0 +1,116 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "abstract_filter.hpp"
+#include "all_type_variant.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+//! default number of bits per distinct value, yields a false positive rate of about 1%
+static constexpr uint32_t DEFAULT_BLOOM_FILTER_BITS_PER_VALUE = 10;
+
+/**
+ * Filter that stores the distinct values of a segment in a Bloom filter. Other than MinMaxFilter and RangeFilter, it
+ * can prune equality predicates on values that lie within the segment's value range but are not contained in it
+ * (e.g., point lookups or join keys). False positives are possible, i.e., a value that is not contained might not be
+ * pruned, but contained values are never pruned.
+ *
+ * The bit positions are derived from a single std::hash using double hashing (Kirsch and Mitzenmacher).
+ */
+template <typename T>
+class BloomFilter : public AbstractFilter {
+ public:
+  BloomFilter(const size_t bit_count, const size_t hash_function_count)
+      : _bits((std::max(bit_count, size_t{1}) + 63u) / 64u), _hash_function_count(hash_function_count) {
+    DebugAssert(hash_function_count > 0, "Bloom filter needs at least one hash function.");
+  }
+
+  ~BloomFilter() override = default;
+
+  static std::unique_ptr<BloomFilter<T>> build_filter(const pmr_vector<T>& dictionary,
+                                                      uint32_t bits_per_value = DEFAULT_BLOOM_FILTER_BITS_PER_VALUE);
+
+  void insert(const T& value) {
+    const auto [first_hash, second_hash] = _hashes(value);
+    for (auto hash_function_id = size_t{0}; hash_function_id < _hash_function_count; ++hash_function_id) {
+      const auto bit = _bit_position(first_hash, second_hash, hash_function_id);
+      _bits[bit / 64u] |= uint64_t{1} << (bit % 64u);
+    }
+  }
+
+  bool may_contain(const T& value) const {
+    const auto [first_hash, second_hash] = _hashes(value);
+    for (auto hash_function_id = size_t{0}; hash_function_id < _hash_function_count; ++hash_function_id) {
+      const auto bit = _bit_position(first_hash, second_hash, hash_function_id);
+      if ((_bits[bit / 64u] & (uint64_t{1} << (bit % 64u))) == 0u) return false;
+    }
+    return true;
+  }
+
+  bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
+                 const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override {
+    // Early exit for NULL variants.
+    if (variant_is_null(variant_value)) {
+      return false;
+    }
+
+    // Only equality predicates can be answered, all other predicates need an order
+    if (predicate_type != PredicateCondition::Equals) {
+      return false;
+    }
+
+    return !may_contain(type_cast_variant<T>(variant_value));
+  }
+
+  size_t memory_usage() const { return sizeof(*this) + _bits.size() * sizeof(uint64_t); }
+
+ protected:
+  std::pair<uint64_t, uint64_t> _hashes(const T& value) const {
+    // std::hash is the identity for integers on common platforms, so the hash is mixed (finalizer of MurmurHash3)
+    auto hash = static_cast<uint64_t>(std::hash<T>{}(value));
+    hash ^= hash >> 33u;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33u;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33u;
+
+    // The second hash must be odd so that it does not repeat positions if the bit count is a power of two
+    return {hash, (hash >> 32u) | (hash << 32u) | 1u};
+  }
+
+  size_t _bit_position(const uint64_t first_hash, const uint64_t second_hash, const size_t hash_function_id) const {
+    return static_cast<size_t>((first_hash + hash_function_id * second_hash) % (_bits.size() * 64u));
+  }
+
+  std::vector<uint64_t> _bits;
+  const size_t _hash_function_count;
+};
+
+template <typename T>
+std::unique_ptr<BloomFilter<T>> BloomFilter<T>::build_filter(const pmr_vector<T>& dictionary,
+                                                             const uint32_t bits_per_value) {
+  DebugAssert(!dictionary.empty(), "The dictionary should not be empty.");
+  DebugAssert(bits_per_value > 0, "Number of bits per value needs to be larger zero.");
+
+  // The optimal number of hash functions is ln(2) * bits per value
+  const auto hash_function_count =
+      std::clamp(static_cast<size_t>(std::round(std::log(2.0) * bits_per_value)), size_t{1}, size_t{16});
+
+  auto filter = std::make_unique<BloomFilter<T>>(dictionary.size() * bits_per_value, hash_function_count);
+  for (const auto& value : dictionary) {
+    filter->insert(value);
+  }
+  return filter;
+}
+
+}  // namespace opossum
@@ -597,6 +597,53 @@ float AbstractHistogram<std::string>::estimate_cardinality(const PredicateCondit
   }
 }
 
+template <typename T>
+float AbstractHistogram<T>::estimate_join_cardinality(const AbstractHistogram<T>& right_histogram) const {
+  if constexpr (std::is_same_v<T, std::string>) {
+    Fail("Join estimation is not supported for string histograms.");
+  } else {
+    // Returns the share of the values in the bin that are in [minimum, maximum]
+    const auto share_of_bin = [](const AbstractHistogram<T>& histogram, const BinID bin_id, const T minimum,
+                                 const T maximum) {
+      // Avoids computing the next value of the largest value of the data type
+      const auto share_up_to_maximum =
+          maximum == histogram._bin_maximum(bin_id)
+              ? 1.0
+              : histogram._share_of_bin_less_than_value(bin_id, histogram._get_next_value(maximum));
+      return std::clamp(share_up_to_maximum - histogram._share_of_bin_less_than_value(bin_id, minimum), 0.0, 1.0);
+    };
+
+    auto cardinality = 0.0;
+    auto left_bin_id = BinID{0};
+    auto right_bin_id = BinID{0};
+    while (left_bin_id < bin_count() && right_bin_id < right_histogram.bin_count()) {
+      const auto left_maximum = _bin_maximum(left_bin_id);
+      const auto right_maximum = right_histogram._bin_maximum(right_bin_id);
+      const auto overlap_minimum = std::max(_bin_minimum(left_bin_id), right_histogram._bin_minimum(right_bin_id));
+      const auto overlap_maximum = std::min(left_maximum, right_maximum);
+
+      if (overlap_minimum <= overlap_maximum) {
+        const auto left_share = share_of_bin(*this, left_bin_id, overlap_minimum, overlap_maximum);
+        const auto right_share = share_of_bin(right_histogram, right_bin_id, overlap_minimum, overlap_maximum);
+        const auto left_distinct_count = left_share * _bin_distinct_count(left_bin_id);
+        const auto right_distinct_count = right_share * right_histogram._bin_distinct_count(right_bin_id);
+        const auto distinct_count = std::max(left_distinct_count, right_distinct_count);
+
+        if (distinct_count > 0.0) {
+          cardinality += left_share * _bin_height(left_bin_id) * right_share *
+                         right_histogram._bin_height(right_bin_id) / distinct_count;
+        }
+      }
+
+      // Continue with the bin that ends first, the other one might overlap with further bins
+      if (left_maximum <= right_maximum) ++left_bin_id;
+      if (right_maximum <= left_maximum) ++right_bin_id;
+    }
+
+    return static_cast<float>(cardinality);
+  }
+}
+
 template <typename T>
 float AbstractHistogram<T>::estimate_selectivity(const PredicateCondition predicate_type,
                                                  const AllTypeVariant& variant_value,
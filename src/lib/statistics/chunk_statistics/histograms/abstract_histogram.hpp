@@ -97,6 +97,15 @@ class AbstractHistogram : public AbstractFilter {
   bool can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                  const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const override;
 
+  /**
+   * Returns the estimated cardinality of an equi-join between the values represented in this histogram and the ones
+   * in `right_histogram`. The bins of both histograms are aligned: For each pair of overlapping bins, the values are
+   * assumed to be distributed uniformly within the bins, and the distinct values of the bin with fewer of them in the
+   * overlap are assumed to find join partners in the other bin.
+   * Not supported for strings, as their numerical representation depends on the prefix settings of each histogram.
+   */
+  float estimate_join_cardinality(const AbstractHistogram<T>& right_histogram) const;
+
   /**
    * Returns the lower bound (minimum value) of the histogram.
    * This is equal to the smallest value in the segment.
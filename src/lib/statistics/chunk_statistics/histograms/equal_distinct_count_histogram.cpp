@@ -118,6 +118,15 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
     return nullptr;
   }
 
+  return from_value_distribution(value_counts, max_bin_count, supported_characters, string_prefix_length);
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_value_distribution(
+    const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count,
+    const std::optional<std::string>& supported_characters, const std::optional<uint32_t>& string_prefix_length) {
+  Assert(!value_counts.empty(), "Cannot have histogram without any values.");
+
   auto bins = EqualDistinctCountHistogram<T>::_build_bins(value_counts, max_bin_count);
 
   if constexpr (std::is_same_v<T, std::string>) {
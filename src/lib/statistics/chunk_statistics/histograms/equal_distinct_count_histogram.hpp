@@ -62,6 +62,16 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
       const std::optional<std::string>& supported_characters = std::nullopt,
       const std::optional<uint32_t>& string_prefix_length = std::nullopt);
 
+  /**
+   * Create a histogram based on the distinct values and their number of occurrences, e.g., in all chunks of a table.
+   * @param value_counts The distinct values and their counts, sorted by value. Must not be empty.
+   * For the other parameters, see from_segment().
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_value_distribution(
+      const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count,
+      const std::optional<std::string>& supported_characters = std::nullopt,
+      const std::optional<uint32_t>& string_prefix_length = std::nullopt);
+
   HistogramType histogram_type() const override;
   std::string histogram_name() const override;
   HistogramCountType total_distinct_count() const override;
@@ -1,6 +1,7 @@
 #include "segment_statistics.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <type_traits>
 #include <unordered_set>
@@ -8,6 +9,7 @@
 #include "resolve_type.hpp"
 
 #include "abstract_filter.hpp"
+#include "bloom_filter.hpp"
 #include "min_max_filter.hpp"
 #include "range_filter.hpp"
 #include "storage/base_encoded_segment.hpp"
@@ -20,6 +22,12 @@
 
 namespace opossum {
 
+namespace {
+
+std::atomic<uint32_t> bloom_filter_bits_per_value_setting{0};
+
+}  // namespace
+
 template <typename T>
 static std::shared_ptr<SegmentStatistics> build_statistics_from_dictionary(const pmr_vector<T>& dictionary) {
   auto statistics = std::make_shared<SegmentStatistics>();
@@ -36,6 +44,10 @@ static std::shared_ptr<SegmentStatistics> build_statistics_from_dictionary(const
       statistics->add_filter(std::move(min_max_filter));
     }
     // clang-format on
+
+    if (const auto bits_per_value = SegmentStatistics::bloom_filter_bits_per_value(); bits_per_value > 0) {
+      statistics->add_filter(BloomFilter<T>::build_filter(dictionary, bits_per_value));
+    }
   }
   return statistics;
 }
@@ -73,6 +85,12 @@ std::shared_ptr<SegmentStatistics> SegmentStatistics::build_statistics(
 }
 void SegmentStatistics::add_filter(std::shared_ptr<AbstractFilter> filter) { _filters.emplace_back(filter); }
 
+void SegmentStatistics::set_bloom_filter_bits_per_value(const uint32_t bits_per_value) {
+  bloom_filter_bits_per_value_setting = bits_per_value;
+}
+
+uint32_t SegmentStatistics::bloom_filter_bits_per_value() { return bloom_filter_bits_per_value_setting; }
+
 bool SegmentStatistics::can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                                   const std::optional<AllTypeVariant>& variant_value2) const {
   for (const auto& filter : _filters) {
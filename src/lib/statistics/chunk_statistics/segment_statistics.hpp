@@ -23,6 +23,14 @@ class SegmentStatistics final {
 
   void add_filter(std::shared_ptr<AbstractFilter> filter);
 
+  /**
+   * Bloom filters (see bloom_filter.hpp) prune equality predicates within the value range of a segment, but need
+   * memory for each distinct value. They are only built by build_statistics() if bits_per_value is larger than zero,
+   * which is not the default.
+   */
+  static void set_bloom_filter_bits_per_value(const uint32_t bits_per_value);
+  static uint32_t bloom_filter_bits_per_value();
+
   /**
    * calls can_prune on each filter in this object
   */
@@ -1,8 +1,10 @@
 #include "column_statistics.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics/histograms/abstract_histogram.hpp"
 #include "table_statistics.hpp"
 #include "type_cast.hpp"
 
@@ -18,15 +20,46 @@ ColumnDataType ColumnStatistics<ColumnDataType>::max() const {
   return _max;
 }
 
+template <typename ColumnDataType>
+std::shared_ptr<const AbstractHistogram<ColumnDataType>> ColumnStatistics<ColumnDataType>::histogram() const {
+  return _histogram;
+}
+
+template <typename ColumnDataType>
+void ColumnStatistics<ColumnDataType>::set_histogram(
+    const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& histogram) {
+  _histogram = histogram;
+}
+
 template <typename ColumnDataType>
 std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::clone() const {
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  auto column_statistics =
+      std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  column_statistics->_histogram = _histogram;
+  return column_statistics;
 }
 
 template <typename ColumnDataType>
 FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_value(
     const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
     const std::optional<AllTypeVariant>& value2) const {
+  auto estimate = _estimate_predicate_with_value_from_range(predicate_condition, variant_value, value2);
+
+  // The histogram knows how the values are distributed, but the resulting column statistics are still derived from the
+  // range. An empty histogram cannot estimate anything.
+  if (_histogram && _histogram->total_count() > 0) {
+    const auto selectivity =
+        _histogram->estimate_cardinality(predicate_condition, variant_value, value2) / _histogram->total_count();
+    estimate.selectivity = non_null_value_ratio() * selectivity;
+  }
+
+  return estimate;
+}
+
+template <typename ColumnDataType>
+FilterByValueEstimate ColumnStatistics<ColumnDataType>::_estimate_predicate_with_value_from_range(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& value2) const {
   const auto value = type_cast_variant<ColumnDataType>(variant_value);
 
   switch (predicate_condition) {
@@ -251,6 +284,15 @@ FilterByColumnComparisonEstimate ColumnStatistics<ColumnDataType>::estimate_pred
     equal_values_ratio = right_overlapping_ratio / distinct_count();
   }
 
+  // If both columns have a histogram, their bins are aligned instead of assuming uniformly distributed values, so that
+  // skewed distributions (e.g., of foreign keys) are accounted for
+  const auto& right_histogram = right_column_statistics._histogram;
+  if (_histogram && right_histogram && _histogram->total_count() > 0 && right_histogram->total_count() > 0) {
+    const auto cross_product_count =
+        static_cast<float>(_histogram->total_count()) * static_cast<float>(right_histogram->total_count());
+    equal_values_ratio = std::min(_histogram->estimate_join_cardinality(*right_histogram) / cross_product_count, 1.0f);
+  }
+
   const auto combined_non_null_ratio = non_null_value_ratio() * right_column_statistics.non_null_value_ratio();
 
   // used for <, <=, > and >= predicate_conditions
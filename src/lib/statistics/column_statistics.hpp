@@ -11,8 +11,16 @@
 
 namespace opossum {
 
+template <typename T>
+class AbstractHistogram;
+
 /**
  * @tparam ColumnDataType   the DataType of the values in the Column that these statistics represent
+ *
+ * If a histogram of the column is set, it is used instead of min/max/distinct count and the assumption of uniformly
+ * distributed values to estimate the selectivity of predicates on values and of equi-joins with other columns that
+ * have a histogram. The column statistics that result from an estimation do not have a histogram, unless the
+ * predicate selects all values.
  */
 template <typename ColumnDataType>
 class ColumnStatistics : public BaseColumnStatistics {
@@ -40,6 +48,10 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnDataType min() const;
   ColumnDataType max() const;
+
+  // The histogram of the values of the column, if any. Its counts do not include NULLs.
+  std::shared_ptr<const AbstractHistogram<ColumnDataType>> histogram() const;
+  void set_histogram(const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& histogram);
   /** @} */
 
   /**
@@ -89,8 +101,14 @@ class ColumnStatistics : public BaseColumnStatistics {
   /** @} */
 
  private:
+  // Estimates a Column-Value Predicate from min, max, and distinct count, assuming uniformly distributed values
+  FilterByValueEstimate _estimate_predicate_with_value_from_range(const PredicateCondition predicate_condition,
+                                                                  const AllTypeVariant& variant_value,
+                                                                  const std::optional<AllTypeVariant>& value2) const;
+
   ColumnDataType _min;
   ColumnDataType _max;
+  std::shared_ptr<const AbstractHistogram<ColumnDataType>> _histogram;
 };
 
 }  // namespace opossum
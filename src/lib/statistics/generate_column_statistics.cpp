@@ -1,66 +1,74 @@
 #include "generate_column_statistics.hpp"
 
-#include <boost/container/pmr/monotonic_buffer_resource.hpp>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
 
-#include "storage/segment_iterate.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
+std::vector<ChunkID> sample_chunk_ids(const Table& table, const float sample_rate) {
+  Assert(sample_rate > 0.0f && sample_rate <= 1.0f, "Sample rate must be in (0, 1]");
+
+  auto chunk_ids = std::vector<ChunkID>{};
+  chunk_ids.reserve(static_cast<size_t>(std::ceil(static_cast<double>(table.chunk_count()) * sample_rate)));
+
+  // A chunk is sampled if the number of chunks to sample up to and including it is one more than up to the previous one
+  for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto sampled_chunk_count_before = std::ceil(static_cast<double>(chunk_id) * sample_rate);
+    const auto sampled_chunk_count = std::ceil(static_cast<double>(chunk_id + 1) * sample_rate);
+    if (sampled_chunk_count > sampled_chunk_count_before) chunk_ids.emplace_back(chunk_id);
+  }
+
+  return chunk_ids;
+}
+
+void for_each_index_in_parallel(const size_t count, const std::function<void(size_t)>& functor) {
+  if (count == 1) {
+    functor(0);
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(count);
+
+  for (auto index = size_t{0}; index < count; ++index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&functor, index]() { functor(index); }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
 /**
  * Specialisation for strings since they don't have numerical_limits and that's what the unspecialised implementation
  * uses.
  */
 template <>
 std::shared_ptr<BaseColumnStatistics> generate_column_statistics<std::string>(const Table& table,
-                                                                              const ColumnID column_id) {
-  // It would be nice to store string_views in the set, but the iterables hold copies of the values, not references.
-  // SegmentPosition would have to be changed to `T& _value` and this brings a whole bunch of problems in iterators
-  // that create stack copies of the accessed values (e.g., for ReferenceSegments)
-
-  auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(table.row_count() * 10);
-  auto distinct_set =
-      std::unordered_set<std::string, std::hash<std::string>, std::equal_to<>, PolymorphicAllocator<std::string>>(
-          PolymorphicAllocator<std::string>{&temp_buffer});
-  distinct_set.reserve(table.row_count());
-
-  auto null_value_count = size_t{0};
-
-  auto min = std::string_view{};
-  auto max = std::string_view{};
-
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
-    const auto base_segment = table.get_chunk(chunk_id)->get_segment(column_id);
-
-    segment_iterate<std::string>(*base_segment, [&](const auto& position) {
-      if (position.is_null()) {
-        ++null_value_count;
-      } else {
-        // One would expect distinct_set.emplace() to be the same as the code below. However, "The element may be
-        // constructed even if there already is an element with the key in the container, in which case the newly
-        // constructed element will be destroyed immediately."
-        // This is the case here, where simply using emplace takes ~50% longer.
-        auto it = distinct_set.find(position.value());
-        if (it == distinct_set.end()) {
-          it = distinct_set.emplace_hint(it, std::move(position.value()));
-        }
-
-        if (distinct_set.size() == 1) {
-          min = *it;
-          max = *it;
-        } else {
-          if (*it < min) min = *it;
-          if (*it > max) max = *it;
-        }
-      }
-    });
-  }
+                                                                              const ColumnID column_id,
+                                                                              const float sample_rate) {
+  const auto counts = count_column_values<std::string>(table, column_id, sample_chunk_ids(table, sample_rate));
 
   const auto null_value_ratio =
-      table.row_count() > 0 ? static_cast<float>(null_value_count) / static_cast<float>(table.row_count()) : 0.0f;
-  const auto distinct_count = static_cast<float>(distinct_set.size());
+      counts.row_count > 0 ? static_cast<float>(counts.null_value_count) / static_cast<float>(counts.row_count) : 0.0f;
+  const auto distinct_count = estimate_distinct_count(table, counts);
+
+  const std::string* min = nullptr;
+  const std::string* max = nullptr;
+
+  for (const auto& [value, count] : counts.value_counts) {
+    if (!min || value < *min) min = &value;
+    if (!max || value > *max) max = &value;
+  }
 
-  return std::make_shared<ColumnStatistics<std::string>>(null_value_ratio, distinct_count, std::string{min},
-                                                         std::string{max});
+  return std::make_shared<ColumnStatistics<std::string>>(null_value_ratio, distinct_count,
+                                                         min ? *min : std::string{}, max ? *max : std::string{});
 }
 
 }  // namespace opossum
@@ -1,64 +1,170 @@
 #pragma once
 
-#include <boost/container/pmr/monotonic_buffer_resource.hpp>
-#include <boost/container/scoped_allocator.hpp>
-#include <unordered_set>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "base_column_statistics.hpp"
 #include "column_statistics.hpp"
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics/histograms/equal_distinct_count_histogram.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
+// The number of bins of the histograms that are generated for the columns, see ColumnStatistics
+constexpr auto COLUMN_HISTOGRAM_BIN_COUNT = BinID{100};
+
 /**
- * Generate the statistics of a single column. Used by generate_table_statistics()
+ * The number of occurrences of each value of a column in some of the chunks of a table. The counts of different chunks
+ * are mergeable, so the chunks are counted in parallel.
  */
 template <typename ColumnDataType>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& table, const ColumnID column_id) {
-  // distinct_set is thrown away at the end of this method, so we don't want proper heap allocations for the strings
-  // stored within. The initial size of the buffer is a completely random guess, but better than zero.
+struct ColumnValueCounts {
+  std::unordered_map<ColumnDataType, size_t> value_counts;
+  size_t null_value_count{0};
 
-  auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(table.row_count() * sizeof(ColumnDataType));
-  auto distinct_set =
-      std::unordered_set<ColumnDataType, std::hash<ColumnDataType>, std::equal_to<ColumnDataType>,
-                         PolymorphicAllocator<ColumnDataType>>(PolymorphicAllocator<ColumnDataType>{&temp_buffer});
-  distinct_set.reserve(table.row_count());
+  // The number of rows in the counted chunks
+  size_t row_count{0};
+};
 
-  auto null_value_count = size_t{0};
+/**
+ * Returns the ids of the chunks whose values are used for the statistics. For a @param sample_rate below one, these
+ * are ceil(chunk_count * sample_rate) chunks spread evenly over the table, including the first one. Whole chunks are
+ * sampled instead of single rows so that the segments are still read sequentially.
+ */
+std::vector<ChunkID> sample_chunk_ids(const Table& table, const float sample_rate);
 
-  auto min = std::numeric_limits<ColumnDataType>::max();
-  auto max = std::numeric_limits<ColumnDataType>::lowest();
+// Calls @param functor with each index in [0, count), as a job of the current scheduler per index
+void for_each_index_in_parallel(const size_t count, const std::function<void(size_t)>& functor);
+
+/**
+ * Counts the values of the column in each of the chunks as a job of its own and merges the counts.
+ */
+template <typename ColumnDataType>
+ColumnValueCounts<ColumnDataType> count_column_values(const Table& table, const ColumnID column_id,
+                                                      const std::vector<ChunkID>& chunk_ids) {
+  auto chunk_value_counts = std::vector<ColumnValueCounts<ColumnDataType>>(chunk_ids.size());
+
+  for_each_index_in_parallel(chunk_ids.size(), [&](const size_t chunk_index) {
+    auto& counts = chunk_value_counts[chunk_index];
+    const auto chunk = table.get_chunk(chunk_ids[chunk_index]);
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
-    const auto base_segment = table.get_chunk(chunk_id)->get_segment(column_id);
+    counts.row_count = chunk->size();
+    counts.value_counts.reserve(chunk->size());
 
-    segment_iterate<ColumnDataType>(*base_segment, [&](const auto& position) {
+    segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
       if (position.is_null()) {
-        ++null_value_count;
+        ++counts.null_value_count;
       } else {
-        distinct_set.insert(position.value());
-        min = std::min(min, position.value());
-        max = std::max(max, position.value());
+        ++counts.value_counts[position.value()];
       }
     });
+  });
+
+  auto merged_counts = ColumnValueCounts<ColumnDataType>{};
+  for (auto& counts : chunk_value_counts) {
+    if (merged_counts.value_counts.empty()) {
+      merged_counts.value_counts = std::move(counts.value_counts);
+    } else {
+      for (const auto& [value, count] : counts.value_counts) {
+        merged_counts.value_counts[value] += count;
+      }
+    }
+    merged_counts.null_value_count += counts.null_value_count;
+    merged_counts.row_count += counts.row_count;
+
+    // Release the memory of the merged counts right away
+    counts.value_counts = {};
+  }
+
+  return merged_counts;
+}
+
+/**
+ * Estimates the distinct count of the whole column from the value counts of a sample of its chunks, using the GEE
+ * estimator (Charikar et al., "Towards Estimation Error Guarantees for Distinct Values", PODS 2000). Values that occur
+ * more than once in the sample are assumed to be frequent and thus sampled, while each value that occurs only once
+ * stands for sqrt(1 / sample_rate) values of the column. Without sampling, this is the exact distinct count.
+ */
+template <typename ColumnDataType>
+float estimate_distinct_count(const Table& table, const ColumnValueCounts<ColumnDataType>& counts) {
+  if (counts.row_count == table.row_count()) return static_cast<float>(counts.value_counts.size());
+
+  const auto scale = static_cast<float>(table.row_count()) / static_cast<float>(counts.row_count);
+  const auto value_count = static_cast<float>(counts.row_count - counts.null_value_count) * scale;
+
+  auto distinct_count_sampled_once = size_t{0};
+  for (const auto& [value, count] : counts.value_counts) {
+    if (count == 1) ++distinct_count_sampled_once;
   }
+  const auto distinct_count_sampled_repeatedly = counts.value_counts.size() - distinct_count_sampled_once;
+
+  const auto distinct_count = std::sqrt(scale) * static_cast<float>(distinct_count_sampled_once) +
+                              static_cast<float>(distinct_count_sampled_repeatedly);
+  return std::min(distinct_count, value_count);
+}
+
+/**
+ * Generate the statistics of a single column. Used by generate_table_statistics(), see there for @param sample_rate.
+ */
+template <typename ColumnDataType>
+std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& table, const ColumnID column_id,
+                                                                 const float sample_rate = 1.0f) {
+  const auto counts = count_column_values<ColumnDataType>(table, column_id, sample_chunk_ids(table, sample_rate));
 
   const auto null_value_ratio =
-      table.row_count() > 0 ? static_cast<float>(null_value_count) / static_cast<float>(table.row_count()) : 0.0f;
-  const auto distinct_count = static_cast<float>(distinct_set.size());
+      counts.row_count > 0 ? static_cast<float>(counts.null_value_count) / static_cast<float>(counts.row_count) : 0.0f;
+  const auto distinct_count = estimate_distinct_count(table, counts);
 
-  if (distinct_count == 0.0f) {
+  auto min = std::numeric_limits<ColumnDataType>::max();
+  auto max = std::numeric_limits<ColumnDataType>::lowest();
+
+  for (const auto& [value, count] : counts.value_counts) {
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+
+  if (counts.value_counts.empty()) {
     min = std::numeric_limits<ColumnDataType>::min();
     max = std::numeric_limits<ColumnDataType>::max();
   }
 
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
+  auto column_statistics =
+      std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
+
+  // The histogram cannot count more rows than HistogramCountType holds. The bins of a histogram built from a sample
+  // would underestimate their distinct counts, so sampled columns get no histogram.
+  const auto is_sampled = counts.row_count != table.row_count();
+  const auto fits_histogram = table.row_count() <= std::numeric_limits<HistogramCountType>::max();
+  if (!counts.value_counts.empty() && !is_sampled && fits_histogram) {
+    auto value_distribution = std::vector<std::pair<ColumnDataType, HistogramCountType>>{};
+    value_distribution.reserve(counts.value_counts.size());
+    for (const auto& [value, count] : counts.value_counts) {
+      value_distribution.emplace_back(value, static_cast<HistogramCountType>(count));
+    }
+    std::sort(value_distribution.begin(), value_distribution.end());
+    column_statistics->set_histogram(
+        EqualDistinctCountHistogram<ColumnDataType>::from_value_distribution(value_distribution,
+                                                                             COLUMN_HISTOGRAM_BIN_COUNT));
+  }
+
+  return column_statistics;
 }
 
+/**
+ * Strings get no histogram, as string histograms only support a fixed set of characters.
+ */
 template <>
 std::shared_ptr<BaseColumnStatistics> generate_column_statistics<std::string>(const Table& table,
-                                                                              const ColumnID column_id);
+                                                                              const ColumnID column_id,
+                                                                              const float sample_rate);
 
 }  // namespace opossum
@@ -11,7 +11,7 @@
 
 namespace opossum {
 
-TableStatistics generate_table_statistics(const Table& table) {
+TableStatistics generate_table_statistics(const Table& table, const float sample_rate) {
   std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
   column_statistics.reserve(table.column_count());
 
@@ -20,7 +20,7 @@ TableStatistics generate_table_statistics(const Table& table) {
 
     resolve_data_type(column_data_type, [&](auto type) {
       using ColumnDataType = typename decltype(type)::type;
-      column_statistics.emplace_back(generate_column_statistics<ColumnDataType>(table, column_id));
+      column_statistics.emplace_back(generate_column_statistics<ColumnDataType>(table, column_id, sample_rate));
     });
   }
 
@@ -10,8 +10,12 @@ namespace opossum {
 class Table;
 
 /**
- * Generate statistics about a Table by analysing its entire data. This may be slow, use with caution.
+ * Generate statistics about a Table by analysing its entire data. This may be slow, use with caution. The chunks of a
+ * column are analysed in parallel.
+ *
+ * For huge tables, a @param sample_rate in (0, 1) analyses only that share of the chunks. The distinct counts are then
+ * extrapolated, while min and max only cover the sampled values and the columns get no histograms.
  */
-TableStatistics generate_table_statistics(const Table& table);
+TableStatistics generate_table_statistics(const Table& table, const float sample_rate = 1.0f);
 
 }  // namespace opossum
@@ -294,6 +294,20 @@ TableStatistics TableStatistics::estimate_predicated_join(const TableStatistics&
 
 void TableStatistics::increase_invalid_row_count(uint64_t count) { _approx_invalid_row_count += count; }
 
+void TableStatistics::increase_row_count(uint64_t count) {
+  _row_count += static_cast<float>(count);
+  _approx_inserted_row_count += count;
+}
+
+bool TableStatistics::is_stale() const {
+  const auto generated_row_count = _row_count - static_cast<float>(_approx_inserted_row_count);
+  return static_cast<float>(_approx_inserted_row_count) > generated_row_count * MAX_INSERTED_ROW_RATIO;
+}
+
+void TableStatistics::carry_over_invalid_row_count(TableStatistics& regenerated_table_statistics) const {
+  regenerated_table_statistics._approx_invalid_row_count = _approx_invalid_row_count;
+}
+
 TableStatistics TableStatistics::estimate_disjunction(const TableStatistics& right_table_statistics) const {
   // TODO(anybody) this is just a dummy implementation
   return {TableType::References, row_count() + right_table_statistics.row_count() * DEFAULT_DISJUNCTION_SELECTIVITY,
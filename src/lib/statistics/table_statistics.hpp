@@ -22,6 +22,8 @@ class TableStatistics final {
   static constexpr auto DEFAULT_OPEN_ENDED_SELECTIVITY = 1.f / 3.f;
   // Made up magic number
   static constexpr auto DEFAULT_DISJUNCTION_SELECTIVITY = 0.2f;
+  // Share of rows that may be inserted after the statistics were generated before they are considered stale
+  static constexpr auto MAX_INSERTED_ROW_RATIO = 0.1f;
 
   TableStatistics(const TableType table_type, const float row_count,
                   const std::vector<std::shared_ptr<const BaseColumnStatistics>>& column_statistics);
@@ -56,6 +58,16 @@ class TableStatistics final {
   // Increases the (approximate) count of invalid rows in the table (caused by deletes).
   void increase_invalid_row_count(uint64_t count);
 
+  // Increases the row count of the table by rows inserted after the statistics were generated (caused by inserts).
+  void increase_row_count(uint64_t count);
+
+  // Whether more than MAX_INSERTED_ROW_RATIO of the rows were inserted after the statistics were generated. The column
+  // statistics (min, max, distinct count, histogram) do not reflect these rows, so they should be regenerated.
+  bool is_stale() const;
+
+  // Moves the count of invalid rows over to statistics that were regenerated for the same table
+  void carry_over_invalid_row_count(TableStatistics& regenerated_table_statistics) const;
+
   std::string description() const;
 
  private:
@@ -67,6 +79,10 @@ class TableStatistics final {
   // This is currently not an atomic due to performance considerations.
   // It is simply used as an estimate for the optimizer, and therefore does not need to be exact.
   uint64_t _approx_invalid_row_count{0};
+
+  // Stores the number of rows inserted after the statistics were generated. Like _approx_invalid_row_count, this is
+  // an estimate and not atomic.
+  uint64_t _approx_inserted_row_count{0};
 };
 
 }  // namespace opossum
@@ -7,4 +7,6 @@ BaseSegment::BaseSegment(const DataType data_type) : _data_type(data_type) {}
 
 DataType BaseSegment::data_type() const { return _data_type; }
 
+SegmentAccessStatistics& BaseSegment::access_statistics() const { return _access_statistics; }
+
 }  // namespace opossum
@@ -5,6 +5,7 @@
 
 #include "all_type_variant.hpp"
 #include "chunk_encoder.hpp"
+#include "segment_access_statistics.hpp"
 #include "types.hpp"
 #include "utils/format_bytes.hpp"
 
@@ -37,7 +38,12 @@ class BaseSegment : private Noncopyable {
   // such as strings who memory usage is implementation defined
   virtual size_t estimate_memory_usage() const = 0;
 
+  // How the segment is read, see SegmentAccessStatistics. Reading a segment updates them, which is why they are
+  // mutable even through a const segment.
+  SegmentAccessStatistics& access_statistics() const;
+
  private:
   const DataType _data_type;
+  mutable SegmentAccessStatistics _access_statistics;
 };
 }  // namespace opossum
@@ -23,6 +23,10 @@ class BaseSegmentAccessor {
   virtual ~BaseSegmentAccessor() {}
 
   virtual const std::optional<T> access(ChunkOffset offset) const = 0;
+
+  // Hints that the value at @param offset will be accessed soon. Accessors of segments whose layout allows locating the
+  // value without reading the segment issue a software prefetch, the others ignore the hint.
+  virtual void prefetch(ChunkOffset offset) const {}
 };
 
 }  // namespace opossum
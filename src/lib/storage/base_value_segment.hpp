@@ -19,6 +19,9 @@ class BaseValueSegment : public BaseSegment {
   // appends the value at the end of the segment
   virtual void append(const AllTypeVariant& val) = 0;
 
+  // appends `length` values of `source`, starting at `offset`. Both segments must have the same data type.
+  virtual void append_values(const BaseValueSegment& source, const ChunkOffset offset, const ChunkOffset length) = 0;
+
   /**
    * @brief Returns null array
    *
@@ -27,6 +30,14 @@ class BaseValueSegment : public BaseSegment {
   virtual const pmr_concurrent_vector<bool>& null_values() const = 0;
   virtual pmr_concurrent_vector<bool>& null_values() = 0;
 
+  /**
+   * @brief Returns false if the segment is guaranteed to hold no NULLs
+   *
+   * Cheaper than inspecting null_values(). It may return true for a segment without NULLs (e.g., after the mutable
+   * null_values() have been requested), but never false for a segment with NULLs.
+   */
+  virtual bool may_contain_null_values() const = 0;
+
   virtual void reserve(const size_t capacity) = 0;
 };
 }  // namespace opossum
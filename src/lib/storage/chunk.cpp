@@ -3,6 +3,7 @@
 #include <limits>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -14,13 +15,23 @@
 #include "resolve_type.hpp"
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "utils/assert.hpp"
+#include "utils/numa_memory_resource.hpp"
 
 namespace opossum {
 
 Chunk::Chunk(const Segments& segments, const std::shared_ptr<MvccData>& mvcc_data,
              const std::optional<PolymorphicAllocator<Chunk>>& alloc,
              const std::shared_ptr<ChunkAccessCounter>& access_counter)
-    : _segments(segments), _mvcc_data(mvcc_data), _access_counter(access_counter) {
+    : _segments(segments),
+      _mvcc_data(mvcc_data),
+      _access_counter(access_counter),
+      _published_segments(segments.size()),
+      _indices(std::make_shared<const Indices>()) {
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    _published_segments[column_id].store(_segments[column_id].get(), std::memory_order_relaxed);
+  }
+  _published_indices.store(_indices.get(), std::memory_order_release);
+
 #if HYRISE_DEBUG
   const auto chunk_size = segments.empty() ? 0u : segments[0]->size();
   Assert(!_mvcc_data || _mvcc_data->size() == chunk_size, "Invalid MvccData size");
@@ -37,7 +48,9 @@ bool Chunk::is_mutable() const { return _is_mutable; }
 void Chunk::mark_immutable() { _is_mutable = false; }
 
 void Chunk::replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment) {
-  std::atomic_store(&_segments.at(column_id), segment);
+  auto previous_segment = std::atomic_exchange(&_segments.at(column_id), segment);
+  _published_segments[column_id].store(segment.get(), std::memory_order_release);
+  EpochManager::get().retire(std::move(previous_segment));
 }
 
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
@@ -60,6 +73,28 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
+void Chunk::append_columns(const Segments& source_segments, const ChunkOffset offset, const ChunkOffset length) {
+  DebugAssert(is_mutable(), "Can't append to immutable Chunk");
+  DebugAssert(_segments.size() == source_segments.size(),
+              "append_columns: number of segments (" + std::to_string(_segments.size()) +
+                  ") does not match number of source segments (" + std::to_string(source_segments.size()) + ")");
+
+  if (length == 0) return;
+
+  // As in append(), the MVCC data has to exist first
+  if (has_mvcc_data()) get_scoped_mvcc_data_lock()->grow_by(length, MvccData::MAX_COMMIT_ID);
+
+  for (auto column_id = ColumnID{0}; column_id < _segments.size(); ++column_id) {
+    const auto base_value_segment = std::dynamic_pointer_cast<BaseValueSegment>(_segments[column_id]);
+    DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
+
+    const auto source_segment = std::dynamic_pointer_cast<const BaseValueSegment>(source_segments[column_id]);
+    Assert(source_segment, "Can only append values from ValueSegments");
+
+    base_value_segment->append_values(*source_segment, offset, length);
+  }
+}
+
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
   return std::atomic_load(&_segments.at(column_id));
 }
@@ -70,13 +105,18 @@ uint16_t Chunk::column_count() const { return static_cast<uint16_t>(_segments.si
 
 uint32_t Chunk::size() const {
   if (_segments.empty()) return 0;
-  auto first_segment = get_segment(ColumnID{0});
-  return static_cast<uint32_t>(first_segment->size());
+  const auto epoch_guard = EpochGuard{};
+  return static_cast<uint32_t>(get_pinned_segment(ColumnID{0}).size());
 }
 
 bool Chunk::has_mvcc_data() const { return _mvcc_data != nullptr; }
 bool Chunk::has_access_counter() const { return _access_counter != nullptr; }
 
+bool Chunk::has_indices() const {
+  const auto epoch_guard = EpochGuard{};
+  return !_published_indices.load(std::memory_order_acquire)->empty();
+}
+
 SharedScopedLockingPtr<MvccData> Chunk::get_scoped_mvcc_data_lock() {
   DebugAssert((has_mvcc_data()), "Chunk does not have mvcc data");
 
@@ -89,14 +129,39 @@ SharedScopedLockingPtr<const MvccData> Chunk::get_scoped_mvcc_data_lock() const
   return {*_mvcc_data, _mvcc_data->_mutex};
 }
 
+SharedScopedLockingPtr<MvccData> Chunk::get_scoped_mvcc_data_lock_for_writing() {
+  DebugAssert((has_mvcc_data()), "Chunk does not have mvcc data");
+
+  // The data might be compressed again between decompressing it and locking it
+  while (true) {
+    {
+      auto mvcc_data = get_scoped_mvcc_data_lock();
+      if (!mvcc_data->is_compressed()) return mvcc_data;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(_mvcc_data->_mutex);
+    _mvcc_data->_decompress();
+  }
+}
+
+bool Chunk::try_compress_mvcc_data(const CommitID visibility_horizon) {
+  if (!has_mvcc_data() || is_mutable()) return false;
+
+  std::unique_lock<std::shared_mutex> lock(_mvcc_data->_mutex);
+  return _mvcc_data->_compress(visibility_horizon);
+}
+
 std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
 
 void Chunk::set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data) { _mvcc_data = mvcc_data; }
 
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  const auto epoch_guard = EpochGuard{};
+  const auto& indices = *_published_indices.load(std::memory_order_acquire);
+
   auto result = std::vector<std::shared_ptr<BaseIndex>>();
-  std::copy_if(_indices.cbegin(), _indices.cend(), std::back_inserter(result),
+  std::copy_if(indices.cbegin(), indices.cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
 }
@@ -108,11 +173,14 @@ std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(const std::vector<Col
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
                                             const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
-  auto index_it = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
+  const auto epoch_guard = EpochGuard{};
+  const auto& indices = *_published_indices.load(std::memory_order_acquire);
+
+  auto index_it = std::find_if(indices.cbegin(), indices.cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
 
-  return (index_it == _indices.cend()) ? nullptr : *index_it;
+  return (index_it == indices.cend()) ? nullptr : *index_it;
 }
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
@@ -122,9 +190,27 @@ std::shared_ptr<BaseIndex> Chunk::get_index(const SegmentIndexType index_type,
 }
 
 void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
-  auto it = std::find(_indices.cbegin(), _indices.cend(), index);
-  DebugAssert(it != _indices.cend(), "Trying to remove a non-existing index");
-  _indices.erase(it);
+  std::lock_guard<std::mutex> lock(_index_mutex);
+
+  auto indices = std::make_shared<Indices>(*_indices);
+  auto it = std::find(indices->cbegin(), indices->cend(), index);
+  DebugAssert(it != indices->cend(), "Trying to remove a non-existing index");
+  indices->erase(it);
+  _publish_indices(std::move(indices));
+}
+
+void Chunk::_add_index(const std::shared_ptr<BaseIndex>& index) {
+  std::lock_guard<std::mutex> lock(_index_mutex);
+
+  auto indices = std::make_shared<Indices>(*_indices);
+  indices->emplace_back(index);
+  _publish_indices(std::move(indices));
+}
+
+void Chunk::_publish_indices(std::shared_ptr<const Indices> indices) {
+  _published_indices.store(indices.get(), std::memory_order_release);
+  std::swap(_indices, indices);
+  EpochManager::get().retire(std::move(indices));
 }
 
 bool Chunk::references_exactly_one_table() const {
@@ -149,20 +235,38 @@ bool Chunk::references_exactly_one_table() const {
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   // Migrating chunks with indices is not implemented yet.
-  if (!_indices.empty()) {
+  if (has_indices()) {
     Fail("Cannot migrate Chunk with Indices.");
   }
 
   _alloc = PolymorphicAllocator<size_t>(memory_source);
-  Segments new_segments(_alloc);
-  for (const auto& segment : _segments) {
-    new_segments.push_back(segment->copy_using_allocator(_alloc));
+
+  // The segments are exchanged one by one, so that operators running concurrently on an immutable chunk continue to
+  // work on the previous segments (see replace_segment)
+  for (auto column_id = ColumnID{0}; column_id < column_count(); ++column_id) {
+    replace_segment(column_id, get_segment(column_id)->copy_using_allocator(_alloc));
   }
-  _segments = std::move(new_segments);
 }
 
 const PolymorphicAllocator<Chunk>& Chunk::get_allocator() const { return _alloc; }
 
+NodeID Chunk::preferred_node_id() const {
+  if (const auto memory_resource = dynamic_cast<NUMAMemoryResource*>(_alloc.resource())) {
+    const auto node_id = memory_resource->get_node_id();
+    return node_id == NUMAMemoryResource::UNDEFINED_NODE_ID ? CURRENT_NODE_ID : NodeID{static_cast<uint32_t>(node_id)};
+  }
+
+  // ReferenceSegments are not allocated on a node, their data lives where the referenced chunk lives
+  if (column_count() == 0) return CURRENT_NODE_ID;
+  const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(get_segment(ColumnID{0}));
+  if (!reference_segment) return CURRENT_NODE_ID;
+
+  const auto& pos_list = *reference_segment->pos_list();
+  if (!pos_list.references_single_chunk() || pos_list.empty()) return CURRENT_NODE_ID;
+
+  return reference_segment->referenced_table()->get_chunk(pos_list.common_chunk_id())->preferred_node_id();
+}
+
 size_t Chunk::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -173,12 +277,7 @@ size_t Chunk::estimate_memory_usage() const {
   // TODO(anybody) Index memory usage missing
   // TODO(anybody) ChunkAccessCounter memory usage missing
 
-  if (_mvcc_data) {
-    bytes += sizeof(_mvcc_data->tids) + sizeof(_mvcc_data->begin_cids) + sizeof(_mvcc_data->end_cids);
-    bytes += _mvcc_data->tids.size() * sizeof(decltype(_mvcc_data->tids)::value_type);
-    bytes += _mvcc_data->begin_cids.size() * sizeof(decltype(_mvcc_data->begin_cids)::value_type);
-    bytes += _mvcc_data->end_cids.size() * sizeof(decltype(_mvcc_data->end_cids)::value_type);
-  }
+  if (_mvcc_data) bytes += _mvcc_data->estimate_memory_usage();
 
   return bytes;
 }
@@ -199,13 +298,43 @@ std::vector<std::shared_ptr<const BaseSegment>> Chunk::_get_segments_for_ids(
   return segments;
 }
 
-std::shared_ptr<ChunkStatistics> Chunk::statistics() const { return _statistics; }
+std::shared_ptr<ChunkStatistics> Chunk::statistics() const { return std::atomic_load(&_statistics); }
+
+const ChunkStatistics* Chunk::get_pinned_statistics() const {
+  DebugAssert(EpochManager::is_pinned(), "Pinned statistics can only be read while holding an EpochGuard");
+  return _published_statistics.load(std::memory_order_acquire);
+}
 
 void Chunk::set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics) {
   Assert(!is_mutable(), "Cannot set statistics on mutable chunks.");
   DebugAssert(chunk_statistics->statistics().size() == column_count(),
               "ChunkStatistics must have same number of segments as Chunk");
-  _statistics = chunk_statistics;
+  auto previous_statistics = std::atomic_exchange(&_statistics, chunk_statistics);
+  _published_statistics.store(chunk_statistics.get(), std::memory_order_release);
+  EpochManager::get().retire(std::move(previous_statistics));
+}
+
+const std::optional<std::pair<ColumnID, OrderByMode>>& Chunk::ordered_by() const { return _ordered_by; }
+
+void Chunk::set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by) {
+  Assert(ordered_by.first < column_count(), "Chunk cannot be ordered by a column it does not have.");
+  _ordered_by = ordered_by;
+}
+
+std::optional<PartitionID> Chunk::partition_id() const { return _partition_id; }
+
+void Chunk::set_partition_id(const PartitionID partition_id) { _partition_id = partition_id; }
+
+std::optional<CommitID> Chunk::cleanup_commit_id() const {
+  const auto cleanup_commit_id = _cleanup_commit_id.load();
+  if (cleanup_commit_id == MvccData::MAX_COMMIT_ID) return std::nullopt;
+  return cleanup_commit_id;
+}
+
+void Chunk::set_cleanup_commit_id(const CommitID cleanup_commit_id) {
+  Assert(cleanup_commit_id != MvccData::MAX_COMMIT_ID, "Invalid cleanup commit id");
+  Assert(!this->cleanup_commit_id(), "Cleanup commit id can only be set once");
+  _cleanup_commit_id = cleanup_commit_id;
 }
 
 }  // namespace opossum
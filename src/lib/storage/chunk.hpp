@@ -9,8 +9,10 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "index/segment_index_type.hpp"
@@ -20,7 +22,9 @@
 #include "mvcc_data.hpp"
 #include "table_column_definition.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 #include "utils/copyable_atomic.hpp"
+#include "utils/epoch_manager.hpp"
 #include "utils/scoped_locking_ptr.hpp"
 
 namespace opossum {
@@ -30,12 +34,19 @@ class BaseSegment;
 class ChunkStatistics;
 
 using Segments = pmr_vector<std::shared_ptr<BaseSegment>>;
+using Indices = std::vector<std::shared_ptr<BaseIndex>>;
 
 /**
  * A Chunk is a horizontal partition of a table.
  * It stores the table's data segment by segment.
  * Optionally, mostly applying to StoredTables, it may also hold MvccData.
  *
+ * The segments, indexes, and statistics of immutable chunks can be replaced while operators read them, e.g., when
+ * segments are re-encoded. Next to the shared_ptrs that own them, the chunk publishes raw pointers to the current
+ * versions. Operators that hold an EpochGuard can read these through the get_pinned_* methods without the reference
+ * counting that copying the shared_ptrs needs. Replaced versions are handed to the EpochManager, which releases them
+ * once no guard that might have read them is left.
+ *
  * Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/chunk-concept
  */
 class Chunk : private Noncopyable {
@@ -57,7 +68,8 @@ class Chunk : private Noncopyable {
 
   void mark_immutable();
 
-  // Atomically replaces the current segment at column_id with the passed segment
+  // Atomically replaces the current segment at column_id with the passed segment. The previous segment is retired, so
+  // that operators reading it via get_pinned_segment() can finish.
   void replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment);
 
   // returns the number of columns, which is equal to the number of segments (cannot exceed ColumnID (uint16_t))
@@ -70,6 +82,11 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  // adds `length` rows to the chunk, taken column by column from the given ValueSegments starting at `offset`.
+  // The source segments must have the same data types as the chunk's segments. This avoids creating an
+  // AllTypeVariant for each value, but is not thread-safe either.
+  void append_columns(const Segments& source_segments, const ChunkOffset offset, const ChunkOffset length);
+
   /**
    * Atomically accesses and returns the segment at a given position
    *
@@ -82,6 +99,17 @@ class Chunk : private Noncopyable {
    */
   std::shared_ptr<BaseSegment> get_segment(ColumnID column_id) const;
 
+  /**
+   * Returns the segment at a given position without copying the shared_ptr. The calling thread must hold an
+   * EpochGuard, and the reference must not be used after the guard was released. Use get_segment() if the segment has
+   * to outlive the guard.
+   */
+  const BaseSegment& get_pinned_segment(const ColumnID column_id) const {
+    DebugAssert(column_id < _published_segments.size(), "ColumnID out of range");
+    DebugAssert(EpochManager::is_pinned(), "Pinned segments can only be read while holding an EpochGuard");
+    return *_published_segments[column_id].load(std::memory_order_acquire);
+  }
+
   const Segments& segments() const;
 
   bool has_mvcc_data() const;
@@ -99,6 +127,18 @@ class Chunk : private Noncopyable {
   SharedScopedLockingPtr<MvccData> get_scoped_mvcc_data_lock();
   SharedScopedLockingPtr<const MvccData> get_scoped_mvcc_data_lock() const;
 
+  /**
+   * Like get_scoped_mvcc_data_lock(), but decompresses the MVCC data first (see MvccData::is_compressed()), so that
+   * the per-row vectors can be written. Used by operators that modify rows of immutable chunks, e.g., Delete.
+   */
+  SharedScopedLockingPtr<MvccData> get_scoped_mvcc_data_lock_for_writing();
+
+  /**
+   * Compresses the MVCC data of an immutable chunk if no transaction can see its rows differently, i.e., all of them
+   * were inserted and invalidated at or before @param visibility_horizon. Returns whether the data is compressed.
+   */
+  bool try_compress_mvcc_data(const CommitID visibility_horizon);
+
   std::shared_ptr<MvccData> mvcc_data() const;
   void set_mvcc_data(const std::shared_ptr<MvccData>& mvcc_data);
 
@@ -123,7 +163,7 @@ class Chunk : private Noncopyable {
                 "All segments must be part of the chunk.");
 
     auto index = std::make_shared<Index>(segments_to_index);
-    _indices.emplace_back(index);
+    _add_index(index);
     return index;
   }
 
@@ -135,6 +175,8 @@ class Chunk : private Noncopyable {
 
   void remove_index(const std::shared_ptr<BaseIndex>& index);
 
+  bool has_indices() const;
+
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
   std::shared_ptr<ChunkAccessCounter> access_counter() const { return _access_counter; }
@@ -143,10 +185,47 @@ class Chunk : private Noncopyable {
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
 
+  /**
+   * The NUMA node whose memory holds the chunk's data (see NUMAPlacementManager), so that tasks working on the chunk
+   * can be scheduled on that node. For a chunk of ReferenceSegments that reference a single chunk, this is the node of
+   * the referenced chunk. CURRENT_NODE_ID if the node is not known, e.g., without NUMA support.
+   */
+  NodeID preferred_node_id() const;
+
   std::shared_ptr<ChunkStatistics> statistics() const;
 
+  // Like get_pinned_segment(), returns the statistics without copying the shared_ptr. nullptr if there are none.
+  const ChunkStatistics* get_pinned_statistics() const;
+
+  // Atomically replaces the statistics. The previous statistics are retired like replaced segments.
   void set_statistics(const std::shared_ptr<ChunkStatistics>& chunk_statistics);
 
+  /**
+   * If set, the rows of this chunk are sorted by the given column. NULLs come first, unless the OrderByMode is
+   * AscendingNullsLast or DescendingNullsLast. Set by the Sort operator and by the ChunkEncoder. Scans use it to find
+   * matching rows via binary search. The order is not checked, so it must only be set for chunks that are not going
+   * to be modified anymore.
+   */
+  const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by() const;
+  void set_ordered_by(const std::pair<ColumnID, OrderByMode>& ordered_by);
+
+  /**
+   * If set, all rows of this chunk belong to the given partition of the table's TablePartitioning. Set by the Table
+   * before the chunk is added to it, and forwarded to their output chunks by the operators that keep the rows of an
+   * input chunk together (GetTable, Validate, TableScan).
+   */
+  std::optional<PartitionID> partition_id() const;
+  void set_partition_id(const PartitionID partition_id);
+
+  /**
+   * If set, all valid rows of this chunk have been moved to another chunk by a transaction that committed with the
+   * returned commit id (see ChunkCompactionTask). Transactions with a snapshot commit id at or after it do not see
+   * any rows of this chunk and skip it. Once no older snapshot is active anymore, the ChunkCompactionManager
+   * releases the chunk's data.
+   */
+  std::optional<CommitID> cleanup_commit_id() const;
+  void set_cleanup_commit_id(const CommitID cleanup_commit_id);
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this chunk and its segments
    */
@@ -155,14 +234,30 @@ class Chunk : private Noncopyable {
  private:
   std::vector<std::shared_ptr<const BaseSegment>> _get_segments_for_ids(const std::vector<ColumnID>& column_ids) const;
 
+  void _add_index(const std::shared_ptr<BaseIndex>& index);
+
+  // Replaces the indexes with the passed copy and retires the previous ones. Requires _index_mutex to be held.
+  void _publish_indices(std::shared_ptr<const Indices> indices);
+
  private:
   PolymorphicAllocator<Chunk> _alloc;
   Segments _segments;
   std::shared_ptr<MvccData> _mvcc_data;
   std::shared_ptr<ChunkAccessCounter> _access_counter;
-  pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+  std::vector<std::atomic<BaseSegment*>> _published_segments;
+
+  // The indexes are copied on write, so that they can be read without locking (see get_indices()). Writers are
+  // serialized by _index_mutex.
+  std::shared_ptr<const Indices> _indices;
+  std::atomic<const Indices*> _published_indices{nullptr};
+  std::mutex _index_mutex;
+
   std::shared_ptr<ChunkStatistics> _statistics;
+  std::atomic<const ChunkStatistics*> _published_statistics{nullptr};
+  std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
+  std::optional<PartitionID> _partition_id;
   bool _is_mutable = true;
+  std::atomic<CommitID> _cleanup_commit_id{MvccData::MAX_COMMIT_ID};
 };
 
 }  // namespace opossum
@@ -0,0 +1,115 @@
+#include "chunk_compaction_manager.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "tasks/chunk_compaction_task.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Creates an empty chunk that takes the place of a compacted chunk once its rows cannot be seen anymore
+std::shared_ptr<Chunk> create_released_chunk(const Table& table, const CommitID cleanup_commit_id) {
+  auto segments = Segments{};
+  for (const auto& column_definition : table.column_definitions()) {
+    resolve_data_type(column_definition.data_type, [&](const auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable));
+    });
+  }
+
+  auto chunk = std::make_shared<Chunk>(segments, std::make_shared<MvccData>(0));
+  chunk->mark_immutable();
+  chunk->set_cleanup_commit_id(cleanup_commit_id);
+  return chunk;
+}
+
+}  // namespace
+
+const ChunkCompactionManager::Options& ChunkCompactionManager::options() const { return _options; }
+
+void ChunkCompactionManager::set_options(const Options& options) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _options = options;
+  if (_compaction_thread) _compaction_thread->set_loop_sleep_time(_options.compaction_interval);
+}
+
+void ChunkCompactionManager::resume() {
+  PausableLoopThread::resume_or_create(_compaction_thread, _options.compaction_interval,
+                                       [this](size_t) { compact_chunks(); });
+}
+
+void ChunkCompactionManager::pause() {
+  if (_compaction_thread) _compaction_thread->pause();
+}
+
+size_t ChunkCompactionManager::compact_chunks() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto compacted_chunk_count = size_t{0};
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    if (table->has_mvcc() != UseMvcc::Yes) continue;
+
+    // Rows invalidated at or before this commit id cannot be seen by any transaction, neither active nor future ones
+    const auto lowest_active_snapshot_commit_id = TransactionManager::get().lowest_active_snapshot_commit_id();
+    const auto last_commit_id = TransactionManager::get().last_commit_id();
+    const auto visibility_horizon =
+        lowest_active_snapshot_commit_id ? std::min(*lowest_active_snapshot_commit_id, last_commit_id) : last_commit_id;
+
+    auto chunk_ids = std::vector<ChunkID>{};
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+
+      const auto cleanup_commit_id = chunk->cleanup_commit_id();
+      if (cleanup_commit_id) {
+        if (chunk->size() > 0 && *cleanup_commit_id <= visibility_horizon) {
+          table->replace_chunk(chunk_id, create_released_chunk(*table, *cleanup_commit_id));
+        }
+        continue;
+      }
+
+      if (chunk->size() == 0 || !ChunkCompactionTask::chunk_is_compactable(chunk)) continue;
+
+      auto invalidated_row_count = size_t{0};
+      {
+        const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+        if (mvcc_data->is_compressed()) {
+          invalidated_row_count = mvcc_data->invalidated_rows().size();
+        } else {
+          for (const auto end_cid : mvcc_data->end_cids) {
+            if (end_cid <= visibility_horizon) ++invalidated_row_count;
+          }
+        }
+      }
+
+      if (static_cast<float>(invalidated_row_count) / static_cast<float>(chunk->size()) <
+          _options.min_invalidated_share) {
+        if (_options.compress_mvcc_data) chunk->try_compress_mvcc_data(visibility_horizon);
+        continue;
+      }
+
+      chunk_ids.emplace_back(chunk_id);
+    }
+
+    for (const auto chunk_id : chunk_ids) {
+      auto task = ChunkCompactionTask{table_name, chunk_id};
+      task.execute();
+      if (task.was_compacted()) ++compacted_chunk_count;
+    }
+  }
+
+  return compacted_chunk_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * The ChunkCompactionManager is a singleton that periodically removes invalidated rows from the chunks of all tables
+ * in the StorageManager. Deleted and updated rows would otherwise occupy memory forever.
+ *
+ * Each iteration has two steps:
+ *  1. Chunks that have been compacted before and cannot be seen by any active transaction anymore (i.e., the lowest
+ *     active snapshot commit id is at or after their cleanup commit id) are replaced with empty chunks. Operators that
+ *     still hold the old chunk are not affected, its memory is released once the last of them finishes.
+ *  2. Immutable chunks in which at least `min_invalidated_share` of the rows have been invalidated before the lowest
+ *     active snapshot are compacted by a ChunkCompactionTask, which moves their valid rows to the end of the table.
+ *  3. The other immutable chunks get a compressed representation of their MVCC data once no transaction can see their
+ *     rows differently (see MvccData::is_compressed()), which saves most of the per-row MVCC memory.
+ *
+ * Transactional queries skip compacted chunks in Validate and TableScan. Queries that are not run within a
+ * transaction do not check the cleanup commit id, so they might still see the moved rows twice and must not hold on to
+ * references into compacted chunks.
+ *
+ * The ChunkCompactionManager is initialized in a paused state and needs to be `resumed` to start its operation.
+ */
+class ChunkCompactionManager : public Singleton<ChunkCompactionManager> {
+ public:
+  struct Options {
+    // The time interval at which the tables are checked for chunks to compact or release
+    std::chrono::milliseconds compaction_interval = std::chrono::seconds(10);
+
+    // The share of invalidated rows above which a chunk is compacted
+    float min_invalidated_share = 0.2f;
+
+    // Whether the MVCC data of immutable chunks that are not compacted is compressed
+    bool compress_mvcc_data = true;
+  };
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+
+  /**
+   * Releases the chunks that have been compacted previously, compacts chunks with many invalidated rows, and
+   * compresses the MVCC data of the other frozen chunks once. This is what the background thread does in each
+   * iteration.
+   *
+   * @return the number of compacted chunks
+   */
+  size_t compact_chunks();
+
+  ChunkCompactionManager(ChunkCompactionManager&&) = delete;
+
+ protected:
+  ChunkCompactionManager() = default;
+
+  friend class Singleton;
+
+  Options _options;
+
+  // Guards the options and makes sure that only one compaction pass runs at a time
+  std::mutex _mutex;
+
+  std::unique_ptr<PausableLoopThread> _compaction_thread;
+};
+
+}  // namespace opossum
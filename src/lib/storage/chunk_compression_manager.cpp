@@ -0,0 +1,70 @@
+#include "chunk_compression_manager.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/shared_dictionaries.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+const ChunkCompressionManager::Options& ChunkCompressionManager::options() const { return _options; }
+
+void ChunkCompressionManager::set_options(const Options& options) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _options = options;
+  if (_compression_thread) _compression_thread->set_loop_sleep_time(_options.compression_interval);
+}
+
+void ChunkCompressionManager::resume() {
+  PausableLoopThread::resume_or_create(_compression_thread, _options.compression_interval,
+                                       [this](size_t) { compress_completed_chunks(); });
+}
+
+void ChunkCompressionManager::pause() {
+  if (_compression_thread) _compression_thread->pause();
+}
+
+size_t ChunkCompressionManager::compress_completed_chunks() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  auto compressed_chunk_count = size_t{0};
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    auto chunk_ids = std::vector<ChunkID>{};
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+
+      // Only chunks filled via Insert have MVCC data that tells us whether all insertions are finished
+      if (!chunk->is_mutable() || !chunk->has_mvcc_data()) continue;
+      if (!ChunkCompressionTask::chunk_is_completed(chunk, table->max_chunk_size())) continue;
+
+      chunk_ids.emplace_back(chunk_id);
+    }
+
+    if (chunk_ids.empty()) continue;
+
+    const auto table_encoding_spec_it = _options.table_encoding_specs.find(table_name);
+    const auto& segment_encoding_spec = table_encoding_spec_it != _options.table_encoding_specs.end()
+                                            ? table_encoding_spec_it->second
+                                            : _options.default_encoding_spec;
+
+    ChunkCompressionTask{table_name, chunk_ids, segment_encoding_spec}.execute();
+    compressed_chunk_count += chunk_ids.size();
+
+    if (_options.share_dictionaries) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        share_dictionaries(table, column_id);
+      }
+    }
+  }
+
+  return compressed_chunk_count;
+}
+
+}  // namespace opossum
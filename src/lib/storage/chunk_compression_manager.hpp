@@ -0,0 +1,71 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "storage/chunk_encoder.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * The ChunkCompressionManager is a singleton that periodically encodes the completed chunks of all tables in the
+ * StorageManager. Tables that are filled via Insert would otherwise keep their data in ValueSegments forever.
+ *
+ * A chunk is compressed once it is full, still mutable (i.e., it has not been encoded yet), and all transactions that
+ * inserted into it have finished (see ChunkCompressionTask). The segments are exchanged atomically, so concurrently
+ * running operators continue to work on the previous segments.
+ *
+ * The ChunkCompressionManager is initialized in a paused state and needs to be `resumed` to start its operation.
+ */
+class ChunkCompressionManager : public Singleton<ChunkCompressionManager> {
+ public:
+  struct Options {
+    // The time interval at which the tables are checked for completed chunks
+    std::chrono::milliseconds compression_interval = std::chrono::seconds(1);
+
+    // The encoding used for tables without a table-specific encoding. By default, the encoding of each segment is
+    // chosen automatically.
+    SegmentEncodingSpec default_encoding_spec = SegmentEncodingSpec{EncodingType::Auto};
+
+    // Encodings for specific tables, by table name
+    std::unordered_map<std::string, SegmentEncodingSpec> table_encoding_specs;
+
+    // Merge the dictionaries of each column after compressing chunks of a table, so that value IDs are comparable
+    // across chunks (see shared_dictionaries.hpp)
+    bool share_dictionaries = false;
+  };
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+
+  /**
+   * Compresses all completed chunks once. This is what the background thread does in each iteration.
+   *
+   * @return the number of compressed chunks
+   */
+  size_t compress_completed_chunks();
+
+  ChunkCompressionManager(ChunkCompressionManager&&) = delete;
+
+ protected:
+  ChunkCompressionManager() = default;
+
+  friend class Singleton;
+
+  Options _options;
+
+  // Guards the options and makes sure that only one compression pass runs at a time
+  std::mutex _mutex;
+
+  std::unique_ptr<PausableLoopThread> _compression_thread;
+};
+
+}  // namespace opossum
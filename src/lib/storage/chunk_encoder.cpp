@@ -1,18 +1,78 @@
 #include "chunk_encoder.hpp"
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "base_value_segment.hpp"
 #include "chunk.hpp"
+#include "resolve_type.hpp"
 #include "table.hpp"
 #include "types.hpp"
+#include "value_segment.hpp"
 
 #include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "statistics/chunk_statistics/segment_statistics.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/segment_encoding_selection.hpp"
 #include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
 #include "utils/assert.hpp"
+#include "utils/timer.hpp"
+#include "utils/tracing/probes.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Returns the order of a value segment, if it is sorted. Segments that contain only a single distinct value are not
+ * reported as sorted, since a binary search would not narrow down the result.
+ */
+std::optional<OrderByMode> detect_order(const DataType data_type, const BaseValueSegment& base_value_segment) {
+  auto order_by_mode = std::optional<OrderByMode>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& value_segment = static_cast<const ValueSegment<ColumnDataType>&>(base_value_segment);
+    const auto& values = value_segment.values();
+    const auto size = value_segment.size();
+    const auto is_null = [&](const size_t offset) {
+      return value_segment.may_contain_null_values() && value_segment.null_values()[offset];
+    };
+
+    // NULLs are either at the beginning or at the end of a sorted segment
+    auto begin = size_t{0u};
+    while (begin < size && is_null(begin)) ++begin;
+    auto end = size;
+    while (end > begin && is_null(end - 1)) --end;
+
+    if (end - begin < 2u || (begin > 0u && end < size)) return;
+
+    auto ascending = true;
+    auto descending = true;
+    for (auto offset = begin + 1; offset < end && (ascending || descending); ++offset) {
+      if (is_null(offset)) return;
+      ascending &= !(values[offset] < values[offset - 1]);
+      descending &= !(values[offset - 1] < values[offset]);
+    }
+
+    // Both are only true if all values are equal
+    if (ascending == descending) return;
+
+    const auto nulls_last = end < size;
+    if (ascending) {
+      order_by_mode = nulls_last ? OrderByMode::AscendingNullsLast : OrderByMode::Ascending;
+    } else {
+      order_by_mode = nulls_last ? OrderByMode::DescendingNullsLast : OrderByMode::Descending;
+    }
+  });
+
+  return order_by_mode;
+}
+
+}  // namespace
 
 namespace opossum {
 
@@ -23,16 +83,27 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   Assert((chunk_encoding_spec.size() == chunk->column_count()),
          "Number of column encoding specs must match the chunk’s column count.");
 
+  Timer timer;
+
   std::vector<std::shared_ptr<SegmentStatistics>> column_statistics;
   for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
-    const auto spec = chunk_encoding_spec[column_id];
-
     const auto data_type = column_data_types[column_id];
     const auto base_segment = chunk->get_segment(column_id);
     const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(base_segment);
 
     Assert(value_segment != nullptr, "All segments of the chunk need to be of type ValueSegment<T>");
 
+    // Bulk-loaded data is often sorted (e.g., by a key or a timestamp). Remember the first sorted column.
+    if (!chunk->ordered_by()) {
+      if (const auto order_by_mode = detect_order(data_type, *value_segment)) {
+        chunk->set_ordered_by({column_id, *order_by_mode});
+      }
+    }
+
+    const auto spec = chunk_encoding_spec[column_id].encoding_type == EncodingType::Auto
+                          ? select_segment_encoding_spec(data_type, value_segment)
+                          : chunk_encoding_spec[column_id];
+
     if (spec.encoding_type == EncodingType::Unencoded) {
       // No need to encode, but we still want to have statistics for the now immutable value segment
       column_statistics.push_back(SegmentStatistics::build_statistics(data_type, value_segment));
@@ -49,6 +120,9 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   if (chunk->has_mvcc_data()) {
     chunk->get_scoped_mvcc_data_lock()->shrink();
   }
+
+  DTRACE_PROBE3(HYRISE, CHUNK_ENCODED, reinterpret_cast<uintptr_t>(chunk.get()), chunk->column_count(),
+                timer.lap().count());
 }
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
@@ -120,4 +194,46 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
   }
 }
 
+void ChunkEncoder::reencode_segment(const std::shared_ptr<Chunk>& chunk, const ColumnID column_id,
+                                    const DataType data_type, const SegmentEncodingSpec& segment_encoding_spec) {
+  Assert(!chunk->is_mutable(), "Only segments of immutable chunks can be re-encoded.");
+  Assert(segment_encoding_spec.encoding_type != EncodingType::Auto, "Re-encoding needs a specific encoding.");
+
+  Timer timer;
+
+  const auto segment = chunk->get_segment(column_id);
+  auto value_segment = std::shared_ptr<BaseValueSegment>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto values = pmr_concurrent_vector<ColumnDataType>(segment->size());
+    auto null_values = pmr_concurrent_vector<bool>(segment->size());
+    auto has_null = false;
+    segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+      if (position.is_null()) {
+        null_values[position.chunk_offset()] = true;
+        has_null = true;
+      } else {
+        values[position.chunk_offset()] = position.value();
+      }
+    });
+
+    if (has_null) {
+      value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+    } else {
+      value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+    }
+  });
+
+  if (segment_encoding_spec.encoding_type == EncodingType::Unencoded) {
+    chunk->replace_segment(column_id, value_segment);
+  } else {
+    chunk->replace_segment(column_id, encode_segment(segment_encoding_spec.encoding_type, data_type, value_segment,
+                                                     segment_encoding_spec.vector_compression_type));
+  }
+
+  DTRACE_PROBE3(HYRISE, CHUNK_ENCODED, reinterpret_cast<uintptr_t>(chunk.get()), 1, timer.lap().count());
+}
+
 }  // namespace opossum
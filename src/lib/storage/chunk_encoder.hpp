@@ -48,6 +48,11 @@ class ChunkEncoder {
    * Note: In some cases, it might be beneficial to
    *       leave certain segments of a chunk unencoded.
    *       Use EncodingType::Unencoded in this case.
+   *
+   * Use EncodingType::Auto to let the encoder choose the encoding and
+   * vector compression of a segment based on a sample of its values
+   * (see segment_encoding_selection.hpp). The given vector compression
+   * is ignored in this case.
    */
   static void encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
                            const ChunkEncodingSpec& chunk_encoding_spec);
@@ -92,6 +97,17 @@ class ChunkEncoder {
    */
   static void encode_all_chunks(const std::shared_ptr<Table>& table,
                                 const SegmentEncodingSpec& segment_encoding_spec = {});
+
+  /**
+   * @brief Changes the encoding of a single segment of an immutable chunk
+   *
+   * Unlike encode_chunk(), the segment may already be encoded. It is decoded into a ValueSegment first, which is then
+   * encoded using the passed spec (EncodingType::Auto is not supported). The segment is exchanged atomically, so that
+   * concurrently running operators continue to work on the previous segment. The statistics and the order of the
+   * chunk stay valid, as the values do not change.
+   */
+  static void reencode_segment(const std::shared_ptr<Chunk>& chunk, const ColumnID column_id, const DataType data_type,
+                               const SegmentEncodingSpec& segment_encoding_spec);
 };
 
 }  // namespace opossum
@@ -0,0 +1,139 @@
+#include "chunk_merge_manager.hpp"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_compaction_manager.hpp"
+#include "storage/chunk_compression_manager.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/b_tree/b_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "storage/shared_dictionaries.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The index of a chunk for one of the IndexInfos of its table, by position in Table::get_indexes()
+using ChunkIndexKey = std::pair<std::shared_ptr<const Chunk>, size_t>;
+
+// Only main chunks that are still in use get indexes
+bool is_main_chunk(const Chunk& chunk) { return !chunk.is_mutable() && chunk.size() > 0 && !chunk.cleanup_commit_id(); }
+
+// Creates an index of @param index_type, unless the segments are not encoded as the index requires
+std::shared_ptr<BaseIndex> create_index(Chunk& chunk, const SegmentIndexType index_type,
+                                        const std::vector<ColumnID>& column_ids) {
+  auto segments = std::vector<std::shared_ptr<const BaseSegment>>{};
+  auto dictionary_segments = std::vector<std::shared_ptr<const BaseDictionarySegment>>{};
+  for (const auto column_id : column_ids) {
+    segments.emplace_back(chunk.get_segment(column_id));
+    dictionary_segments.emplace_back(std::dynamic_pointer_cast<const BaseDictionarySegment>(segments.back()));
+  }
+  const auto is_dictionary_encoded = std::all_of(dictionary_segments.cbegin(), dictionary_segments.cend(),
+                                                 [](const auto& segment) { return segment != nullptr; });
+
+  switch (index_type) {
+    case SegmentIndexType::GroupKey:
+      if (!is_dictionary_encoded) return nullptr;
+      return chunk.create_index<GroupKeyIndex>(segments);
+    case SegmentIndexType::CompositeGroupKey:
+      if (!is_dictionary_encoded) return nullptr;
+      for (const auto& dictionary_segment : dictionary_segments) {
+        const auto compressed_vector_type = dictionary_segment->compressed_vector_type();
+        if (!compressed_vector_type || !is_fixed_size_byte_aligned(*compressed_vector_type)) return nullptr;
+      }
+      return chunk.create_index<CompositeGroupKeyIndex>(segments);
+    case SegmentIndexType::AdaptiveRadixTree:
+      if (!is_dictionary_encoded) return nullptr;
+      return chunk.create_index<AdaptiveRadixTreeIndex>(segments);
+    case SegmentIndexType::BTree:
+      return chunk.create_index<BTreeIndex>(segments);
+    case SegmentIndexType::Hash:
+      return chunk.create_index<HashIndex>(segments);
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace
+
+const ChunkMergeManager::Options& ChunkMergeManager::options() const { return _options; }
+
+void ChunkMergeManager::set_options(const Options& options) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _options = options;
+  if (_merge_thread) _merge_thread->set_loop_sleep_time(_options.merge_interval);
+}
+
+void ChunkMergeManager::resume() {
+  PausableLoopThread::resume_or_create(_merge_thread, _options.merge_interval, [this](size_t) { merge(); });
+}
+
+void ChunkMergeManager::pause() {
+  if (_merge_thread) _merge_thread->pause();
+}
+
+size_t ChunkMergeManager::merge() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // The indexes are looked up by the current segments. Once a segment has been exchanged, its index is not found
+  // anymore, so the indexes are remembered here to release them after the merge.
+  auto previous_indexes = std::map<ChunkIndexKey, std::shared_ptr<BaseIndex>>{};
+  if (_options.rebuild_indexes) {
+    for (const auto& [table_name, table] : StorageManager::get().tables()) {
+      const auto index_infos = table->get_indexes();
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        for (auto index_info_id = size_t{0}; index_info_id < index_infos.size(); ++index_info_id) {
+          const auto& index_info = index_infos[index_info_id];
+          const auto index = chunk->get_index(index_info.type, index_info.column_ids);
+          if (index) previous_indexes.emplace(ChunkIndexKey{chunk, index_info_id}, index);
+        }
+      }
+    }
+  }
+
+  const auto compacted_chunk_count = ChunkCompactionManager::get().compact_chunks();
+  const auto encoded_chunk_count = ChunkCompressionManager::get().compress_completed_chunks();
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    if (_options.share_dictionaries && compacted_chunk_count + encoded_chunk_count > 0) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        share_dictionaries(table, column_id);
+      }
+    }
+
+    if (!_options.rebuild_indexes) continue;
+
+    const auto index_infos = table->get_indexes();
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!is_main_chunk(*chunk)) continue;
+
+      for (auto index_info_id = size_t{0}; index_info_id < index_infos.size(); ++index_info_id) {
+        const auto& index_info = index_infos[index_info_id];
+        if (chunk->get_index(index_info.type, index_info.column_ids)) continue;
+
+        create_index(*chunk, index_info.type, index_info.column_ids);
+
+        // The index of the exchanged segments would only keep their memory alive
+        const auto previous_index_it = previous_indexes.find(ChunkIndexKey{chunk, index_info_id});
+        if (previous_index_it != previous_indexes.end()) chunk->remove_index(previous_index_it->second);
+      }
+    }
+  }
+
+  return compacted_chunk_count + encoded_chunk_count;
+}
+
+}  // namespace opossum
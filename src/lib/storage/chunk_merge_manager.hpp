@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * The ChunkMergeManager is a singleton that periodically merges the write-optimized delta of all tables in the
+ * StorageManager into their read-optimized main part.
+ *
+ * The delta of a table consists of the mutable chunks at its end, into whose ValueSegments Insert and Update append,
+ * and of the rows that Delete and Update invalidate in the encoded main chunks. The log and the table indexes refer
+ * to rows by RowID, so rows are never moved in place. Instead, each merge pass
+ *  1. compacts the main chunks with many invalidated rows, moving their valid rows into the delta, and releases the
+ *     chunks that were compacted before (see ChunkCompactionManager, whose options apply),
+ *  2. encodes the completed delta chunks, including the ones filled by step 1 (see ChunkCompressionManager, whose
+ *     options apply),
+ *  3. merges the dictionaries of each column, so that the new main chunks share them (see shared_dictionaries.hpp),
+ *  4. rebuilds the chunk indexes registered at the table (see Table::get_indexes()) on the segments of the new main
+ *     chunks, replacing the indexes of segments that were exchanged in steps 2 and 3.
+ *
+ * All steps exchange segments and chunks atomically, so queries keep running on the previous ones while a merge
+ * runs. Indexes are only created on segments that support them, e.g., a GroupKeyIndex is skipped for chunks that were
+ * not dictionary-encoded.
+ *
+ * The ChunkMergeManager is initialized in a paused state and needs to be `resumed` to start its operation.
+ */
+class ChunkMergeManager : public Singleton<ChunkMergeManager> {
+ public:
+  struct Options {
+    // The time interval at which the deltas are merged
+    std::chrono::milliseconds merge_interval = std::chrono::seconds(10);
+
+    // Whether the dictionaries of each column are merged after chunks have been encoded or compacted
+    bool share_dictionaries = true;
+
+    // Whether the indexes registered at a table are rebuilt on the new main chunks
+    bool rebuild_indexes = true;
+  };
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+
+  /**
+   * Merges the deltas of all tables into their main chunks once. This is what the background thread does in each
+   * iteration.
+   *
+   * @return the number of compacted and encoded chunks
+   */
+  size_t merge();
+
+  ChunkMergeManager(ChunkMergeManager&&) = delete;
+
+ protected:
+  ChunkMergeManager() = default;
+
+  friend class Singleton;
+
+  Options _options;
+
+  // Guards the options and makes sure that only one merge pass runs at a time
+  std::mutex _mutex;
+
+  std::unique_ptr<PausableLoopThread> _merge_thread;
+};
+
+}  // namespace opossum
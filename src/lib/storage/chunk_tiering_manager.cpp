@@ -0,0 +1,102 @@
+#include "chunk_tiering_manager.hpp"
+
+#include <boost/container/pmr/global_resource.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+const ChunkTieringManager::Options& ChunkTieringManager::options() const { return _options; }
+
+void ChunkTieringManager::set_options(const Options& options) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  Assert(!_storage || (options.storage_directory == _options.storage_directory &&
+                       options.storage_capacity == _options.storage_capacity),
+         "Cannot change the storage of tiered chunks once it is in use.");
+  _options = options;
+  if (_tiering_thread) _tiering_thread->set_loop_sleep_time(_options.tiering_interval);
+}
+
+void ChunkTieringManager::resume() {
+  PausableLoopThread::resume_or_create(_tiering_thread, _options.tiering_interval, [this](size_t) { tier_chunks(); });
+}
+
+void ChunkTieringManager::pause() {
+  if (_tiering_thread) _tiering_thread->pause();
+}
+
+size_t ChunkTieringManager::tier_chunks() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  struct Candidate {
+    std::shared_ptr<Chunk> chunk;
+    uint64_t temperature;
+    size_t memory_usage;
+    bool is_tiered;
+  };
+
+  auto candidates = std::vector<Candidate>{};
+  auto dram_usage = size_t{0};
+
+  for (const auto& [table_name, table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto chunk_is_tiered = is_tiered(*chunk);
+
+      const auto access_counter = chunk->access_counter();
+      if (access_counter) access_counter->process();
+
+      if (!access_counter || chunk->is_mutable() || chunk->has_indices()) {
+        if (!chunk_is_tiered) dram_usage += chunk->estimate_memory_usage();
+        continue;
+      }
+
+      candidates.emplace_back(Candidate{chunk, access_counter->history_sample(_options.lookback_samples),
+                                        chunk->estimate_memory_usage(), chunk_is_tiered});
+    }
+  }
+
+  // Hottest chunks first. Among equally hot chunks, those already in DRAM are preferred to avoid migrations.
+  std::stable_sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    if (lhs.temperature != rhs.temperature) return lhs.temperature > rhs.temperature;
+    return !lhs.is_tiered && rhs.is_tiered;
+  });
+
+  auto migrated_chunk_count = size_t{0};
+
+  for (const auto& candidate : candidates) {
+    const auto fits_into_dram =
+        dram_usage <= _options.dram_budget && candidate.memory_usage <= _options.dram_budget - dram_usage;
+
+    // Tiered chunks are only brought back once they are accessed again
+    if (fits_into_dram && (!candidate.is_tiered || candidate.temperature > 0)) {
+      dram_usage += candidate.memory_usage;
+      if (candidate.is_tiered) {
+        candidate.chunk->migrate(boost::container::pmr::get_default_resource());
+        ++migrated_chunk_count;
+      }
+    } else if (!candidate.is_tiered) {
+      if (!_storage) {
+        _storage = std::make_unique<FileBackedMemoryResource>(_options.storage_directory, _options.storage_capacity);
+      }
+      candidate.chunk->migrate(_storage.get());
+      ++migrated_chunk_count;
+    }
+  }
+
+  return migrated_chunk_count;
+}
+
+bool ChunkTieringManager::is_tiered(const Chunk& chunk) const {
+  return _storage && chunk.get_allocator().resource() == _storage.get();
+}
+
+}  // namespace opossum
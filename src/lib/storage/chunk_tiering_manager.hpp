@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "types.hpp"
+#include "utils/file_backed_memory_resource.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * The ChunkTieringManager is a singleton that keeps the frequently accessed chunks of all tables in DRAM and moves the
+ * others to a file-backed memory resource on secondary storage (e.g., an SSD), so that more data can be kept online
+ * than fits into DRAM.
+ *
+ * The access frequency is taken from the ChunkAccessCounter of each chunk, which is also used for NUMA placement.
+ * In each iteration, the manager takes a snapshot of all counters, ranks the chunks by the time they were accessed
+ * during the last `lookback_samples` iterations, and fills the DRAM budget with the hottest chunks. The remaining
+ * chunks are migrated to the file-backed resource via Chunk::migrate. A tiered chunk is brought back to DRAM once it
+ * is accessed again and fits into the budget.
+ *
+ * Only immutable chunks with an access counter and without indices are tiered, as Chunk::migrate is not safe for
+ * chunks that are still being modified. All other chunks (and the tiered chunks that have not been accessed) stay
+ * where they are, but count towards the DRAM budget.
+ *
+ * The ChunkTieringManager is initialized in a paused state and needs to be `resumed` to start its operation.
+ */
+class ChunkTieringManager : public Singleton<ChunkTieringManager> {
+ public:
+  struct Options {
+    // The time interval at which the access counters are sampled and chunks are migrated
+    std::chrono::milliseconds tiering_interval = std::chrono::seconds(10);
+
+    // The number of recent samples that determine how hot a chunk is
+    size_t lookback_samples = 30;
+
+    // The number of bytes that the chunks of all tables may occupy in DRAM
+    size_t dram_budget = std::numeric_limits<size_t>::max();
+
+    // The directory in which the file for the tiered chunks is created, and the maximum size of that file. Both
+    // cannot be changed once a chunk has been tiered.
+    std::string storage_directory = "/tmp";
+    size_t storage_capacity = size_t{64} << 30u;
+  };
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  void resume();
+  void pause();
+
+  /**
+   * Samples the access counters and migrates chunks between DRAM and secondary storage once. This is what the
+   * background thread does in each iteration.
+   *
+   * @return the number of migrated chunks
+   */
+  size_t tier_chunks();
+
+  // Returns whether the chunk is currently stored on secondary storage
+  bool is_tiered(const Chunk& chunk) const;
+
+  ChunkTieringManager(ChunkTieringManager&&) = delete;
+
+ protected:
+  ChunkTieringManager() = default;
+
+  friend class Singleton;
+
+  Options _options;
+
+  // Guards the options and makes sure that only one tiering pass runs at a time
+  std::mutex _mutex;
+
+  // Created when the first chunk is tiered and kept until the process ends, as tiered chunks reference it
+  std::unique_ptr<FileBackedMemoryResource> _storage;
+
+  std::unique_ptr<PausableLoopThread> _tiering_thread;
+};
+
+}  // namespace opossum
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "storage/delta_segment/delta_segment_iterable.hpp"
 #include "storage/dictionary_segment/dictionary_segment_iterable.hpp"
 #include "storage/frame_of_reference/frame_of_reference_iterable.hpp"
+#include "storage/lz4/lz4_iterable.hpp"
 #include "storage/run_length_segment/run_length_segment_iterable.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/value_segment/value_segment_iterable.hpp"
@@ -72,6 +74,24 @@ auto create_iterable_from_segment(const FrameOfReferenceSegment<T>& segment) {
   }
 }
 
+template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+auto create_iterable_from_segment(const LZ4Segment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return LZ4Iterable<T>{segment};
+  }
+}
+
+template <typename T, bool EraseSegmentType = HYRISE_DEBUG>
+auto create_iterable_from_segment(const DeltaSegment<T>& segment) {
+  if constexpr (EraseSegmentType) {
+    return create_any_segment_iterable<T>(segment);
+  } else {
+    return DeltaSegmentIterable<T>{segment};
+  }
+}
+
 /**
  * This function must be forward-declared because ReferenceSegmentIterable
  * includes this file leading to a circular dependency
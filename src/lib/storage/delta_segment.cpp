@@ -0,0 +1,116 @@
+#include "delta_segment.hpp"
+
+#include "resolve_type.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+DeltaSegment<T, U>::DeltaSegment(pmr_vector<T> block_anchors, pmr_vector<bool> null_values,
+                                 std::unique_ptr<const BaseCompressedVector> deltas,
+                                 pmr_vector<ChunkOffset> wide_delta_offsets, pmr_vector<UnsignedT> wide_deltas)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _block_anchors{std::move(block_anchors)},
+      _null_values{std::move(null_values)},
+      _deltas{std::move(deltas)},
+      _wide_delta_offsets{std::move(wide_delta_offsets)},
+      _wide_deltas{std::move(wide_deltas)},
+      _decompressor{_deltas->create_base_decompressor()} {
+  DebugAssert(_wide_delta_offsets.size() == _wide_deltas.size(), "Each wide delta needs a chunk offset.");
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& DeltaSegment<T, U>::block_anchors() const {
+  return _block_anchors;
+}
+
+template <typename T, typename U>
+const pmr_vector<bool>& DeltaSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& DeltaSegment<T, U>::deltas() const {
+  return *_deltas;
+}
+
+template <typename T, typename U>
+const pmr_vector<ChunkOffset>& DeltaSegment<T, U>::wide_delta_offsets() const {
+  return _wide_delta_offsets;
+}
+
+template <typename T, typename U>
+const pmr_vector<typename DeltaSegment<T, U>::UnsignedT>& DeltaSegment<T, U>::wide_deltas() const {
+  return _wide_deltas;
+}
+
+template <typename T, typename U>
+const AllTypeVariant DeltaSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+const std::optional<T> DeltaSegment<T, U>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  // Start at the anchor of the block and sum up the deltas. The anchor's own delta is not used.
+  const auto block_begin = (chunk_offset / block_size) * block_size;
+  auto value = _block_anchors[chunk_offset / block_size];
+  for (auto offset = block_begin + 1u; offset <= chunk_offset; ++offset) {
+    value = apply_delta(value, _decompressor->get(offset), offset);
+  }
+  return value;
+}
+
+template <typename T, typename U>
+size_t DeltaSegment<T, U>::size() const {
+  return _deltas->size();
+}
+
+template <typename T, typename U>
+std::shared_ptr<BaseSegment> DeltaSegment<T, U>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_block_anchors = pmr_vector<T>{_block_anchors, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+  auto new_deltas = _deltas->copy_using_allocator(alloc);
+  auto new_wide_delta_offsets = pmr_vector<ChunkOffset>{_wide_delta_offsets, alloc};
+  auto new_wide_deltas = pmr_vector<UnsignedT>{_wide_deltas, alloc};
+
+  return std::allocate_shared<DeltaSegment>(alloc, std::move(new_block_anchors), std::move(new_null_values),
+                                            std::move(new_deltas), std::move(new_wide_delta_offsets),
+                                            std::move(new_wide_deltas));
+}
+
+template <typename T, typename U>
+size_t DeltaSegment<T, U>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + sizeof(T) * _block_anchors.size() + _deltas->data_size() +
+         _null_values.size() / bits_per_byte + sizeof(ChunkOffset) * _wide_delta_offsets.size() +
+         sizeof(UnsignedT) * _wide_deltas.size();
+}
+
+template <typename T, typename U>
+EncodingType DeltaSegment<T, U>::encoding_type() const {
+  return EncodingType::Delta;
+}
+
+template <typename T, typename U>
+std::optional<CompressedVectorType> DeltaSegment<T, U>::compressed_vector_type() const {
+  return _deltas->type();
+}
+
+template class DeltaSegment<int32_t>;
+template class DeltaSegment<int64_t>;
+
+}  // namespace opossum
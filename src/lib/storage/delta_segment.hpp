@@ -0,0 +1,136 @@
+#pragma once
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "base_encoded_segment.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing delta encoding
+ *
+ * Delta encoding stores the difference of each value to its predecessor.
+ * For sorted or nearly sorted columns (e.g., keys or timestamps), these
+ * deltas are small and can be represented by very few bits, while frame-of-
+ * reference encoding would still need as many bits as the value range of
+ * a block requires.
+ *
+ * The deltas are zigzag encoded (small negative deltas become small unsigned
+ * integers) and then compressed using vector compression (null suppression).
+ *
+ * The segment is divided into fixed-size blocks. For each block, its first
+ * value (the block anchor) is stored uncompressed and serves as a skip
+ * pointer: Accessing a value only requires summing up the deltas from the
+ * start of its block. Null values have a delta of zero, i.e., they repeat
+ * the preceding value internally.
+ *
+ * Vector compression only supports 32 bit integers. Wider deltas, e.g.,
+ * between 0 and INT64_MAX, are stored as WIDE_DELTA in the compressed
+ * deltas. Their actual values are kept in a separate list, which is ordered
+ * by chunk offset and searched when a WIDE_DELTA is decoded.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(
+                          enum_c<EncodingType, EncodingType::Delta>, hana::type_c<T>)>>
+class DeltaSegment : public BaseEncodedSegment {
+ public:
+  /**
+   * Random access needs to sum up to block_size - 1 deltas, so the block size
+   * is much smaller than in frame-of-reference encoding. It matches the block
+   * size of SIMD-BP128, so that each block can be decoded as a whole.
+   */
+  static constexpr auto block_size = 128u;
+
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  // Marks a delta that is stored in wide_deltas()
+  static constexpr auto WIDE_DELTA = std::numeric_limits<uint32_t>::max();
+
+  explicit DeltaSegment(pmr_vector<T> block_anchors, pmr_vector<bool> null_values,
+                        std::unique_ptr<const BaseCompressedVector> deltas,
+                        pmr_vector<ChunkOffset> wide_delta_offsets = {}, pmr_vector<UnsignedT> wide_deltas = {});
+
+  const pmr_vector<T>& block_anchors() const;
+  const pmr_vector<bool>& null_values() const;
+  const BaseCompressedVector& deltas() const;
+
+  // The chunk offsets of the deltas that are stored as WIDE_DELTA, in ascending order, and their zigzag encoded values
+  const pmr_vector<ChunkOffset>& wide_delta_offsets() const;
+  const pmr_vector<UnsignedT>& wide_deltas() const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup Zigzag encoding of deltas
+   * @{
+   */
+
+  // Returns the zigzag encoded difference value - previous_value. Arithmetic is done modulo 2^n to avoid overflows.
+  static UnsignedT encode_delta(const T previous_value, const T value) {
+    const auto delta = static_cast<T>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(previous_value));
+    return static_cast<UnsignedT>(static_cast<UnsignedT>(delta) << 1u) ^
+           static_cast<UnsignedT>(delta >> (sizeof(T) * 8u - 1u));
+  }
+
+  static T apply_delta(const T previous_value, const UnsignedT encoded_delta) {
+    const auto delta = static_cast<UnsignedT>((encoded_delta >> 1u) ^ (UnsignedT{0u} - (encoded_delta & 1u)));
+    return static_cast<T>(static_cast<UnsignedT>(previous_value) + delta);
+  }
+
+  // Applies the delta at chunk_offset as read from deltas(), which might be a WIDE_DELTA
+  T apply_delta(const T previous_value, const uint32_t compressed_delta, const ChunkOffset chunk_offset) const {
+    if (compressed_delta != WIDE_DELTA) return apply_delta(previous_value, static_cast<UnsignedT>(compressed_delta));
+
+    const auto offset_it = std::lower_bound(_wide_delta_offsets.cbegin(), _wide_delta_offsets.cend(), chunk_offset);
+    DebugAssert(offset_it != _wide_delta_offsets.cend() && *offset_it == chunk_offset, "Wide delta not found.");
+    return apply_delta(previous_value, _wide_deltas[std::distance(_wide_delta_offsets.cbegin(), offset_it)]);
+  }
+
+  /**@}*/
+
+ private:
+  const pmr_vector<T> _block_anchors;
+  const pmr_vector<bool> _null_values;
+  const std::unique_ptr<const BaseCompressedVector> _deltas;
+  const pmr_vector<ChunkOffset> _wide_delta_offsets;
+  const pmr_vector<UnsignedT> _wide_deltas;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/delta_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class DeltaEncoder : public SegmentEncoder<DeltaEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::Delta>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto alloc = value_segment->values().get_allocator();
+
+    static constexpr auto block_size = DeltaSegment<T>::block_size;
+
+    const auto size = value_segment->size();
+
+    // Ceiling of integer division
+    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+
+    // holds the first value of each block
+    auto block_anchors = pmr_vector<T>{alloc};
+    block_anchors.reserve(div_ceil(size, block_size));
+
+    // holds the uncompressed, zigzag encoded deltas
+    auto deltas = pmr_vector<uint32_t>{alloc};
+    deltas.reserve(size);
+
+    // holds the deltas that do not fit into uint32_t (required for vector compression) and their chunk offsets
+    auto wide_delta_offsets = pmr_vector<ChunkOffset>{alloc};
+    auto wide_deltas = pmr_vector<typename DeltaSegment<T>::UnsignedT>{alloc};
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    // used as optional input for the compression of the deltas
+    auto max_delta = uint32_t{0u};
+
+    auto previous_value = T{0};
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.for_each([&](const auto& segment_value) {
+      const auto is_null = segment_value.is_null();
+      null_values.push_back(is_null);
+
+      if (deltas.size() % block_size == 0u) {
+        // The first row of a block is represented by its anchor. Null values take over the preceding value so that
+        // they do not produce large deltas.
+        const auto anchor = is_null ? previous_value : segment_value.value();
+        block_anchors.push_back(anchor);
+        deltas.push_back(0u);
+        previous_value = anchor;
+        return;
+      }
+
+      const auto value = is_null ? previous_value : segment_value.value();
+      const auto delta = DeltaSegment<T>::encode_delta(previous_value, value);
+
+      if (delta >= DeltaSegment<T>::WIDE_DELTA) {
+        wide_delta_offsets.push_back(static_cast<ChunkOffset>(deltas.size()));
+        wide_deltas.push_back(delta);
+        deltas.push_back(DeltaSegment<T>::WIDE_DELTA);
+        max_delta = DeltaSegment<T>::WIDE_DELTA;
+      } else {
+        deltas.push_back(static_cast<uint32_t>(delta));
+        max_delta = std::max(max_delta, static_cast<uint32_t>(delta));
+      }
+      previous_value = value;
+    });
+
+    auto compressed_deltas = compress_vector(deltas, vector_compression_type(), alloc, {max_delta});
+
+    return std::allocate_shared<DeltaSegment<T>>(alloc, std::move(block_anchors), std::move(null_values),
+                                                 std::move(compressed_deltas), std::move(wide_delta_offsets),
+                                                 std::move(wide_deltas));
+  }
+};
+
+}  // namespace opossum
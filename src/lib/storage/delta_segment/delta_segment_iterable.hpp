@@ -0,0 +1,182 @@
+#pragma once
+
+#include <limits>
+#include <type_traits>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/delta_segment.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class DeltaSegmentIterable : public PointAccessibleSegmentIterable<DeltaSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit DeltaSegmentIterable(const DeltaSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_statistics().on_sequential_scan(_segment.size());
+
+    resolve_compressed_vector_type(_segment.deltas(), [&](const auto& deltas) {
+      using DeltaIteratorT = decltype(deltas.cbegin());
+
+      auto begin = Iterator<DeltaIteratorT>{&_segment, _segment.block_anchors().cbegin(), deltas.cbegin(),
+                                            _segment.null_values().cbegin(),
+                                            static_cast<ChunkOffset>(_segment.size())};
+
+      auto end = Iterator<DeltaIteratorT>{deltas.cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    _segment.access_statistics().on_point_access(position_filter->size());
+
+    resolve_compressed_vector_type(_segment.deltas(), [&](const auto& vector) {
+      auto decompressor = vector.create_decompressor();
+      using DeltaDecompressorT = std::decay_t<decltype(*decompressor)>;
+
+      auto begin = PointAccessIterator<DeltaDecompressorT>{&_segment, decompressor.get(), position_filter->cbegin(),
+                                                           position_filter->cbegin()};
+
+      auto end = PointAccessIterator<DeltaDecompressorT>{position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const DeltaSegment<T>& _segment;
+
+ private:
+  template <typename DeltaIteratorT>
+  class Iterator : public BaseSegmentIterator<Iterator<DeltaIteratorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DeltaSegmentIterable<T>;
+    using BlockAnchorIterator = typename pmr_vector<T>::const_iterator;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    // Begin Iterator
+    explicit Iterator(const DeltaSegment<T>* segment, BlockAnchorIterator block_anchor_it, DeltaIteratorT delta_it,
+                      NullValueIterator null_value_it, const ChunkOffset size)
+        : _segment{segment},
+          _block_anchor_it{block_anchor_it},
+          _delta_it{delta_it},
+          _null_value_it{null_value_it},
+          _size{size},
+          _index_within_block{0u},
+          _chunk_offset{0u},
+          _current_value{size > 0u ? *block_anchor_it : T{}} {}
+
+    // End iterator
+    explicit Iterator(DeltaIteratorT delta_it) : Iterator{nullptr, {}, delta_it, {}, ChunkOffset{0u}} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_delta_it;
+      ++_null_value_it;
+      ++_index_within_block;
+      ++_chunk_offset;
+
+      // Do not read past the last value
+      if (_chunk_offset >= _size) return;
+
+      if (_index_within_block >= DeltaSegment<T>::block_size) {
+        _index_within_block = 0u;
+        ++_block_anchor_it;
+        _current_value = *_block_anchor_it;
+      } else {
+        _current_value = _segment->apply_delta(_current_value, *_delta_it, _chunk_offset);
+      }
+    }
+
+    bool equal(const Iterator& other) const { return _delta_it == other._delta_it; }
+
+    SegmentPosition<T> dereference() const {
+      return SegmentPosition<T>{_current_value, *_null_value_it, _chunk_offset};
+    }
+
+   private:
+    const DeltaSegment<T>* _segment;
+    BlockAnchorIterator _block_anchor_it;
+    DeltaIteratorT _delta_it;
+    NullValueIterator _null_value_it;
+    ChunkOffset _size;
+    size_t _index_within_block;
+    ChunkOffset _chunk_offset;
+    T _current_value;
+  };
+
+  /**
+   * Point access sums up the deltas from the start of the block. If the position list is sorted, subsequent accesses
+   * to the same block continue from the previously accessed position.
+   */
+  template <typename DeltaDecompressorT>
+  class PointAccessIterator
+      : public BasePointAccessSegmentIterator<PointAccessIterator<DeltaDecompressorT>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = DeltaSegmentIterable<T>;
+
+    // Begin Iterator
+    PointAccessIterator(const DeltaSegment<T>* segment, DeltaDecompressorT* delta_decompressor,
+                        const PosList::const_iterator position_filter_begin, PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator<DeltaDecompressorT>,
+                                         SegmentPosition<T>>{std::move(position_filter_begin),
+                                                             std::move(position_filter_it)},
+          _segment{segment},
+          _delta_decompressor{delta_decompressor} {}
+
+    // End Iterator
+    explicit PointAccessIterator(const PosList::const_iterator position_filter_begin,
+                                 PosList::const_iterator position_filter_it)
+        : PointAccessIterator{nullptr, nullptr, std::move(position_filter_begin),
+                              std::move(position_filter_it)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+
+      static constexpr auto block_size = DeltaSegment<T>::block_size;
+
+      const auto chunk_offset = chunk_offsets.offset_in_referenced_chunk;
+      const auto is_null = _segment->null_values()[chunk_offset];
+
+      const auto block_begin = (chunk_offset / block_size) * block_size;
+      if (_last_chunk_offset == INVALID_CHUNK_OFFSET || _last_chunk_offset < block_begin ||
+          _last_chunk_offset > chunk_offset) {
+        _last_chunk_offset = block_begin;
+        _last_value = _segment->block_anchors()[chunk_offset / block_size];
+      }
+
+      for (; _last_chunk_offset < chunk_offset; ++_last_chunk_offset) {
+        const auto next_offset = static_cast<ChunkOffset>(_last_chunk_offset + 1u);
+        _last_value = _segment->apply_delta(_last_value, _delta_decompressor->get(next_offset), next_offset);
+      }
+
+      return SegmentPosition<T>{_last_value, is_null, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const DeltaSegment<T>* _segment;
+    DeltaDecompressorT* _delta_decompressor;
+    mutable ChunkOffset _last_chunk_offset{INVALID_CHUNK_OFFSET};
+    mutable T _last_value{};
+  };
+};
+
+}  // namespace opossum
@@ -2,6 +2,7 @@
 
 #include <utility>
 
+#include "storage/segment_access_statistics.hpp"
 #include "storage/segment_iterables.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
@@ -11,11 +12,15 @@ class AttributeVectorIterable : public PointAccessibleSegmentIterable<AttributeV
  public:
   using ValueType = ValueID;
 
-  explicit AttributeVectorIterable(const BaseCompressedVector& attribute_vector, const ValueID null_value_id)
-      : _attribute_vector{attribute_vector}, _null_value_id{null_value_id} {}
+  // Reads of the attribute vector are counted in @param access_statistics, if given, as those of its segment
+  explicit AttributeVectorIterable(const BaseCompressedVector& attribute_vector, const ValueID null_value_id,
+                                   SegmentAccessStatistics* access_statistics = nullptr)
+      : _attribute_vector{attribute_vector}, _null_value_id{null_value_id}, _access_statistics{access_statistics} {}
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
+    if (_access_statistics) _access_statistics->on_sequential_scan(_attribute_vector.size());
+
     resolve_compressed_vector_type(_attribute_vector, [&](const auto& vector) {
       using ZsIteratorType = decltype(vector.cbegin());
 
@@ -28,6 +33,8 @@ class AttributeVectorIterable : public PointAccessibleSegmentIterable<AttributeV
 
   template <typename Functor>
   void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    if (_access_statistics) _access_statistics->on_point_access(position_filter->size());
+
     resolve_compressed_vector_type(_attribute_vector, [&](const auto& vector) {
       auto decompressor = vector.create_decompressor();
       using ZsDecompressorType = std::decay_t<decltype(*decompressor)>;
@@ -45,6 +52,7 @@ class AttributeVectorIterable : public PointAccessibleSegmentIterable<AttributeV
  private:
   const BaseCompressedVector& _attribute_vector;
   const ValueID _null_value_id;
+  SegmentAccessStatistics* const _access_statistics;
 
  private:
   template <typename ZsIteratorType>
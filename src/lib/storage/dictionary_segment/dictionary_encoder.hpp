@@ -61,7 +61,7 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
     const auto alloc = values.get_allocator();
 
     // Remove null values from value vector
-    if (value_segment->is_nullable()) {
+    if (value_segment->may_contain_null_values()) {
       const auto& null_values = value_segment->null_values();
 
       // Swap values to back if value is null
@@ -86,7 +86,7 @@ class DictionaryEncoder : public SegmentEncoder<DictionaryEncoder<Encoding>> {
 
     const auto null_value_id = static_cast<uint32_t>(dictionary.size());
 
-    if (value_segment->is_nullable()) {
+    if (value_segment->may_contain_null_values()) {
       const auto& null_values = value_segment->null_values();
 
       /**
@@ -17,11 +17,24 @@ namespace opossum {
 
 namespace hana = boost::hana;
 
-enum class EncodingType : uint8_t { Unencoded, Dictionary, RunLength, FixedStringDictionary, FrameOfReference };
+/**
+ * Unencoded and Auto are not actual encodings. Auto lets the ChunkEncoder pick an encoding for each segment,
+ * see segment_encoding_selection.hpp.
+ */
+enum class EncodingType : uint8_t {
+  Unencoded,
+  Dictionary,
+  RunLength,
+  FixedStringDictionary,
+  FrameOfReference,
+  LZ4,
+  Delta,
+  Auto
+};
 
 inline static std::vector<EncodingType> encoding_type_enum_values{
     EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength, EncodingType::FixedStringDictionary,
-    EncodingType::FrameOfReference};
+    EncodingType::FrameOfReference, EncodingType::LZ4, EncodingType::Delta, EncodingType::Auto};
 
 /**
  * @brief Maps each encoding type to its supported data types
@@ -36,7 +49,10 @@ constexpr auto supported_data_types_for_encoding_type = hana::make_map(
     hana::make_pair(enum_c<EncodingType, EncodingType::Dictionary>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::RunLength>, data_types),
     hana::make_pair(enum_c<EncodingType, EncodingType::FixedStringDictionary>, hana::tuple_t<std::string>),
-    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>));
+    hana::make_pair(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::LZ4>, data_types),
+    hana::make_pair(enum_c<EncodingType, EncodingType::Delta>, hana::tuple_t<int32_t, int64_t>),
+    hana::make_pair(enum_c<EncodingType, EncodingType::Auto>, data_types));
 
 /**
  * @return an integral constant implicitly convertible to bool
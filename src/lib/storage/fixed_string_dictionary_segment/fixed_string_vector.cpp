@@ -11,6 +11,12 @@
 
 namespace opossum {
 
+FixedStringVector::FixedStringVector(pmr_vector<char>&& chars, const size_t string_length)
+    : _string_length(string_length), _chars(std::move(chars)) {
+  DebugAssert(_string_length == 0 ? _chars.size() == 1 : _chars.size() % _string_length == 0,
+              "Characters do not form strings of the given length");
+}
+
 void FixedStringVector::push_back(const std::string& string) {
   DebugAssert(string.size() <= _string_length, "Inserted string is too long to insert in FixedStringVector");
   const auto pos = _chars.size();
@@ -69,6 +75,10 @@ const std::string FixedStringVector::get_string_at(const size_t pos) const {
 
 char* FixedStringVector::data() { return _chars.data(); }
 
+const pmr_vector<char>& FixedStringVector::chars() const { return _chars; }
+
+size_t FixedStringVector::string_length() const { return _string_length; }
+
 size_t FixedStringVector::size() const {
   // If the string length is zero, `_chars` has always the size 0. Thus, we don't know
   // how many empty strings were added to the FixedStringVector. So the FixedStringVector size is
@@ -34,6 +34,9 @@ class FixedStringVector {
     }
   }
 
+  // Create a FixedStringVector from characters that already hold the zero-padded strings back to back
+  FixedStringVector(pmr_vector<char>&& chars, const size_t string_length);
+
   // Add a string to the end of the vector
   void push_back(const std::string& string);
 
@@ -59,6 +62,12 @@ class FixedStringVector {
   // Return a pointer to the underlying memory
   char* data();
 
+  // Return the underlying characters, i.e., the zero-padded strings back to back
+  const pmr_vector<char>& chars() const;
+
+  // Return the length every string is padded to
+  size_t string_length() const;
+
   // Return the number of entries in the vector.
   size_t size() const;
 
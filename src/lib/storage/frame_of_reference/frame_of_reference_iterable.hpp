@@ -18,6 +18,8 @@ class FrameOfReferenceIterable : public PointAccessibleSegmentIterable<FrameOfRe
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
+    _segment.access_statistics().on_sequential_scan(_segment.size());
+
     resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
       using OffsetValueIteratorT = decltype(offset_values.cbegin());
 
@@ -32,6 +34,8 @@ class FrameOfReferenceIterable : public PointAccessibleSegmentIterable<FrameOfRe
 
   template <typename Functor>
   void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    _segment.access_statistics().on_point_access(position_filter->size());
+
     resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& vector) {
       auto decompressor = vector.create_decompressor();
       using OffsetValueDecompressorT = std::decay_t<decltype(*decompressor)>;
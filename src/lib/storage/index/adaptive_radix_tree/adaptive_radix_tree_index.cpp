@@ -1,9 +1,11 @@
 #include "adaptive_radix_tree_index.hpp"
 
 #include <algorithm>
+#include <array>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -27,20 +29,29 @@ AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr
   Assert(static_cast<bool>(_indexed_segment), "AdaptiveRadixTree only works with dictionary segments for now");
   Assert((segments_to_index.size() == 1), "AdaptiveRadixTree only works with a single segment");
 
-  // For each value ID in the attribute vector, create a pair consisting of a BinaryComparable of
-  // this value ID and its ChunkOffset (needed for bulk-inserting).
-  std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
-  pairs_to_insert.reserve(_indexed_segment->attribute_vector()->size());
+  // The value IDs are dense, so the (value ID, ChunkOffset) pairs can be sorted with a counting sort. NULLs have the
+  // largest value ID and are sorted last.
+  const auto& attribute_vector = *_indexed_segment->attribute_vector();
+  auto value_id_counts = std::vector<ChunkOffset>(_indexed_segment->unique_values_count() + 2u, ChunkOffset{0u});
 
-  resolve_compressed_vector_type(*_indexed_segment->attribute_vector(), [&](const auto& attribute_vector) {
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+    for (auto value_id_it = vector.cbegin(); value_id_it != vector.cend(); ++value_id_it) {
+      ++value_id_counts[*value_id_it + 1u];
+    }
+  });
+
+  std::partial_sum(value_id_counts.begin(), value_id_counts.end(), value_id_counts.begin());
+
+  auto sorted_values = std::vector<std::pair<ValueID, ChunkOffset>>(attribute_vector.size());
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
     auto chunk_offset = ChunkOffset{0u};
-    auto value_id_it = attribute_vector.cbegin();
-    for (; value_id_it != attribute_vector.cend(); ++value_id_it, ++chunk_offset) {
-      pairs_to_insert.emplace_back(BinaryComparable(ValueID{*value_id_it}), chunk_offset);
+    for (auto value_id_it = vector.cbegin(); value_id_it != vector.cend(); ++value_id_it, ++chunk_offset) {
+      const auto value_id = ValueID{*value_id_it};
+      sorted_values[value_id_counts[value_id]++] = {value_id, chunk_offset};
     }
   });
 
-  _root = _bulk_insert(pairs_to_insert);
+  _root = _bulk_insert_sorted(sorted_values);
 }
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
@@ -62,57 +73,123 @@ BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTy
   }
 }
 
+std::vector<BaseIndex::Iterator> AdaptiveRadixTreeIndex::lower_bounds(const std::vector<AllTypeVariant>& values) const {
+  auto value_ids = std::vector<ValueID>(values.size());
+  std::transform(values.cbegin(), values.cend(), value_ids.begin(),
+                 [&](const auto& value) { return _indexed_segment->lower_bound(value); });
+  return _lower_bounds(value_ids);
+}
+
+std::vector<BaseIndex::Iterator> AdaptiveRadixTreeIndex::upper_bounds(const std::vector<AllTypeVariant>& values) const {
+  // As in _upper_bound(), the upper bound of a value is the lower bound of the next larger value ID
+  auto value_ids = std::vector<ValueID>(values.size());
+  std::transform(values.cbegin(), values.cend(), value_ids.begin(),
+                 [&](const auto& value) { return _indexed_segment->upper_bound(value); });
+  return _lower_bounds(value_ids);
+}
+
+std::vector<BaseIndex::Iterator> AdaptiveRadixTreeIndex::_lower_bounds(const std::vector<ValueID>& value_ids) const {
+  // The number of traversals that are interleaved. It should be large enough to keep several memory accesses in
+  // flight, but small enough for the nodes to stay in the cache until they are used.
+  constexpr auto BATCH_SIZE = size_t{16u};
+  constexpr auto KEY_BYTES = sizeof(ValueID::base_type);
+
+  auto results = std::vector<Iterator>(value_ids.size(), _chunk_offsets.cend());
+  auto nodes = std::array<const ARTNode*, BATCH_SIZE>{};
+
+  for (auto batch_begin = size_t{0u}; batch_begin < value_ids.size(); batch_begin += BATCH_SIZE) {
+    const auto batch_size = std::min(BATCH_SIZE, value_ids.size() - batch_begin);
+    nodes.fill(_root.get());
+
+    // Advance all traversals by one level at a time. The dictionary segment maps each value to a value ID that is
+    // contained in the segment, so the keys are usually found. Otherwise, the traversal stops with a nullptr.
+    for (auto depth = size_t{0u}; depth < KEY_BYTES; ++depth) {
+      const auto shift = 8u * (KEY_BYTES - 1u - depth);
+      for (auto batch_offset = size_t{0u}; batch_offset < batch_size; ++batch_offset) {
+        auto& node = nodes[batch_offset];
+        if (!node) continue;
+        node = node->child(static_cast<uint8_t>(value_ids[batch_begin + batch_offset] >> shift));
+        if (node) __builtin_prefetch(node);
+      }
+    }
+
+    for (auto batch_offset = size_t{0u}; batch_offset < batch_size; ++batch_offset) {
+      const auto value_id = value_ids[batch_begin + batch_offset];
+      if (value_id == INVALID_VALUE_ID) continue;
+
+      // After all bytes of the key have been consumed, the node is the leaf of the value ID. Keys that are not
+      // contained fall back to the regular search, which also finds the next larger key.
+      const auto* const node = nodes[batch_offset];
+      results[batch_begin + batch_offset] = node ? node->begin() : _root->lower_bound(BinaryComparable(value_id), 0);
+    }
+  }
+
+  return results;
+}
+
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offsets.cbegin(); }
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_offsets.cend(); }
 
 std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
     const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values) {
-  DebugAssert(!(values.empty()), "Index on empty segment is not defined");
-  _chunk_offsets.reserve(values.size());
-  auto begin = _chunk_offsets.cbegin();
-  return _bulk_insert(values, static_cast<size_t>(0u), begin);
+  auto sorted_values = std::vector<std::pair<ValueID, ChunkOffset>>{};
+  sorted_values.reserve(values.size());
+  for (const auto& [binary_comparable, chunk_offset] : values) {
+    auto value_id = ValueID::base_type{0u};
+    for (auto byte_id = size_t{0u}; byte_id < binary_comparable.size(); ++byte_id) {
+      value_id = (value_id << 8u) | binary_comparable[byte_id];
+    }
+    sorted_values.emplace_back(ValueID{value_id}, chunk_offset);
+  }
+
+  // Equal keys keep the order of their ChunkOffsets
+  std::stable_sort(sorted_values.begin(), sorted_values.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+  return _bulk_insert_sorted(sorted_values);
 }
 
-std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
-    const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values, size_t depth, BaseIndex::Iterator& it) {
-  // This is the anchor of the recursion: if all values have the same key, create a leaf.
-  if (std::all_of(values.begin(), values.end(), [&values](const std::pair<BinaryComparable, ChunkOffset>& pair) {
-        return values.front().first == pair.first;
-      })) {
-    // copy the Iterator in the _chunk_offsets - vector --> this is the lower_bound of the leaf
-    auto lower = it;
-    // insert the ChunkOffsets into the vector and push the Iterator further
-    auto old_capacity = _chunk_offsets.capacity();
-    for (const auto& pair : values) {
-      _chunk_offsets.emplace_back(pair.second);
-    }
-    std::advance(it, values.size());
-    auto new_capacity = _chunk_offsets.capacity();
-    // we are not allowed to change the size of the vector as it would invalidate all our Iterators
-    Assert(old_capacity == new_capacity, "_chunk_offsets capacity changes, all Iterators are invalidated");
+std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert_sorted(
+    const std::vector<std::pair<ValueID, ChunkOffset>>& sorted_values) {
+  DebugAssert(!(sorted_values.empty()), "Index on empty segment is not defined");
 
-    // "it" points to the position after the last inserted ChunkOffset --> this is the upper_bound of the leave
-    auto upper = it;
+  // The leaves reference ranges of _chunk_offsets, so it is filled completely before the tree is built
+  _chunk_offsets.resize(sorted_values.size());
+  std::transform(sorted_values.cbegin(), sorted_values.cend(), _chunk_offsets.begin(),
+                 [](const auto& pair) { return pair.second; });
+
+  return _build_node(sorted_values, 0u, sorted_values.size(), 0u);
+}
+
+std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_build_node(
+    const std::vector<std::pair<ValueID, ChunkOffset>>& sorted_values, const size_t begin, const size_t end,
+    const size_t depth) {
+  // This is the anchor of the recursion: if all values have the same key, create a leaf. As the values are sorted,
+  // this is the case if the first and the last key are equal.
+  if (sorted_values[begin].first == sorted_values[end - 1].first) {
+    auto lower = _chunk_offsets.cbegin() + begin;
+    auto upper = _chunk_offsets.cbegin() + end;
     return std::make_shared<Leaf>(lower, upper);
   }
 
-  // radix-partition on the depths-byte into 256 partitions
-  std::array<std::vector<std::pair<BinaryComparable, ChunkOffset>>, std::numeric_limits<uint8_t>::max() + 1> partitions;
-  for (const auto& pair : values) {
-    partitions[pair.first[depth]].emplace_back(pair);
-  }
+  // The keys share the first `depth` bytes, so the values with the same byte at `depth` are adjacent. Each of these
+  // ranges becomes a child, the tree is built bottom-up without copying the values into partitions.
+  const auto partial_key = [&](const ValueID value_id) {
+    return static_cast<uint8_t>(value_id >> (8u * (sizeof(ValueID::base_type) - 1u - depth)));
+  };
 
-  // call recursively for each non-empty partition and gather the children
   std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children;
 
-  for (uint16_t partition_id = 0; partition_id < partitions.size(); ++partition_id) {
-    if (!partitions[partition_id].empty()) {
-      auto child =
-          std::make_pair(static_cast<uint8_t>(partition_id), _bulk_insert(partitions[partition_id], depth + 1, it));
-      children.emplace_back(std::move(child));
-    }
+  for (auto child_begin = begin; child_begin < end;) {
+    const auto key = partial_key(sorted_values[child_begin].first);
+    const auto child_end = static_cast<size_t>(
+        std::partition_point(sorted_values.cbegin() + child_begin, sorted_values.cbegin() + end,
+                             [&](const auto& pair) { return partial_key(pair.first) == key; }) -
+        sorted_values.cbegin());
+    children.emplace_back(key, _build_node(sorted_values, child_begin, child_end, depth + 1));
+    child_begin = child_end;
   }
+
   // finally create the appropriate ARTNode according to the size of the children
   if (children.size() <= 4) {
     return std::make_shared<ARTNode4>(children);
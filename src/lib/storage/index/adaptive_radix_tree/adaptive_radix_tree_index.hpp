@@ -51,6 +51,16 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   virtual ~AdaptiveRadixTreeIndex() = default;
 
+  /**
+   * Batched versions of lower_bound() and upper_bound() that look up many single-column values at once, e.g., all
+   * probe values of an index join. The traversals of several keys are interleaved and the next node of each traversal
+   * is prefetched, so that the cache misses of independent lookups overlap instead of stalling one after another.
+   *
+   * @return one Iterator per value, equal to what lower_bound({value}) and upper_bound({value}) return
+   */
+  std::vector<Iterator> lower_bounds(const std::vector<AllTypeVariant>& values) const;
+  std::vector<Iterator> upper_bounds(const std::vector<AllTypeVariant>& values) const;
+
   /**
    *All keys in the ART have to be binary comparable in the sense that if the most significant differing bit between
    *BinaryComparable a and BinaryComparable b is greater for a <=> a > b.
@@ -80,10 +90,17 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   Iterator _cend() const final;
 
+  // Returns the lower bound of each value ID, INVALID_VALUE_ID results in cend()
+  std::vector<Iterator> _lower_bounds(const std::vector<ValueID>& value_ids) const;
+
+  // Sorts the values by key and builds the tree from them
   std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values);
 
-  std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values,
-                                        size_t depth, Iterator& it);
+  // Builds the tree bottom-up from values that are sorted by value ID, ChunkOffsets of equal keys in ascending order
+  std::shared_ptr<ARTNode> _bulk_insert_sorted(const std::vector<std::pair<ValueID, ChunkOffset>>& sorted_values);
+
+  std::shared_ptr<ARTNode> _build_node(const std::vector<std::pair<ValueID, ChunkOffset>>& sorted_values,
+                                       const size_t begin, const size_t end, const size_t depth);
 
   std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const;
 
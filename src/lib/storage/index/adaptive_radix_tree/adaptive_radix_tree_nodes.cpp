@@ -1,6 +1,7 @@
 #include "adaptive_radix_tree_nodes.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <utility>
@@ -15,6 +16,33 @@ namespace opossum {
 
 constexpr uint8_t INVALID_INDEX = 255u;
 
+namespace {
+
+/**
+ * 16 partial keys are compared at once using GCC vector extensions, which are compiled to SSE2 instructions on x86
+ * (see also simd_bp128_packing.cpp). Each lane of a comparison result is 0xFF if the comparison holds and 0x00
+ * otherwise.
+ */
+using PartialKeys = uint8_t __attribute__((vector_size(16)));
+using LaneMask = int8_t __attribute__((vector_size(16)));
+
+PartialKeys load_partial_keys(const uint8_t* partial_keys) {
+  auto vector = PartialKeys{};
+  std::memcpy(&vector, partial_keys, sizeof(vector));
+  return vector;
+}
+
+// Returns the position of the first lane that is set or 16 if no lane is set (assumes little endian)
+size_t first_set_lane(const LaneMask mask) {
+  uint64_t words[2];
+  std::memcpy(words, &mask, sizeof(words));
+  if (words[0] != 0u) return static_cast<size_t>(__builtin_ctzll(words[0])) / 8u;
+  if (words[1] != 0u) return 8u + static_cast<size_t>(__builtin_ctzll(words[1])) / 8u;
+  return 16u;
+}
+
+}  // namespace
+
 /**
  *
  * ARTNode4 has two arrays of length 4:
@@ -81,6 +109,13 @@ BaseIndex::Iterator ARTNode4::upper_bound(const AdaptiveRadixTreeIndex::BinaryCo
       key, depth, [&key, this](size_t i, size_t new_depth) { return _children[i]->upper_bound(key, new_depth); });
 }
 
+const ARTNode* ARTNode4::child(const uint8_t partial_key) const {
+  for (uint8_t partial_key_id = 0; partial_key_id < 4; ++partial_key_id) {
+    if (_partial_keys[partial_key_id] == partial_key) return _children[partial_key_id].get();
+  }
+  return nullptr;
+}
+
 BaseIndex::Iterator ARTNode4::begin() const { return _children[0]->begin(); }
 
 BaseIndex::Iterator ARTNode4::end() const {
@@ -141,19 +176,20 @@ BaseIndex::Iterator ARTNode16::_delegate_to_child(
     const std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type, size_t)>&
         function) const {
   auto partial_key = key[depth];
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
 
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, ++depth);  // case0
-  }
+  // The position of the first partial key that is not smaller than the searched one, as std::lower_bound would find
+  const auto partial_key_pos = first_set_lane(load_partial_keys(_partial_keys.data()) >= partial_key);
+
   if (partial_key_pos >= 16) {
     return end();  // case 1a
   }
-  if (_children[partial_key_pos] != nullptr) {
-    return _children[partial_key_pos]->begin();  // case2
+  if (_children[partial_key_pos] == nullptr) {
+    return end();  // case1b
+  }
+  if (_partial_keys[partial_key_pos] == partial_key) {
+    return function(partial_key_pos, ++depth);  // case0
   }
-  return end();  // case1b
+  return _children[partial_key_pos]->begin();  // case2
 }
 
 BaseIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
@@ -170,6 +206,13 @@ BaseIndex::Iterator ARTNode16::upper_bound(const AdaptiveRadixTreeIndex::BinaryC
                    size_t new_depth) { return _children[partial_key_pos]->upper_bound(key, new_depth); });
 }
 
+const ARTNode* ARTNode16::child(const uint8_t partial_key) const {
+  // A partial key of 255u might also be the default value of an unused position, which has no child
+  const auto partial_key_pos = first_set_lane(load_partial_keys(_partial_keys.data()) == partial_key);
+  if (partial_key_pos >= 16) return nullptr;
+  return _children[partial_key_pos].get();
+}
+
 BaseIndex::Iterator ARTNode16::begin() const { return _children[0]->begin(); }
 
 /**
@@ -247,12 +290,21 @@ BaseIndex::Iterator ARTNode48::_delegate_to_child(const AdaptiveRadixTreeIndex::
     // case0
     return function(partial_key, ++depth);
   }
-  for (uint16_t i = partial_key + 1; i < 256u; ++i) {
+  // Check the positions up to the next multiple of 16 one by one, then 16 positions at once
+  auto i = static_cast<uint16_t>(partial_key + 1u);
+  for (; i < 256u && i % 16u != 0u; ++i) {
     if (_index_to_child[i] != INVALID_INDEX) {
       // case2
       return _children[_index_to_child[i]]->begin();
     }
   }
+  for (; i < 256u; i += 16u) {
+    const auto child_pos = first_set_lane(load_partial_keys(_index_to_child.data() + i) != INVALID_INDEX);
+    if (child_pos < 16u) {
+      // case2
+      return _children[_index_to_child[i + child_pos]]->begin();
+    }
+  }
   // case1
   return end();
 }
@@ -269,6 +321,11 @@ BaseIndex::Iterator ARTNode48::upper_bound(const AdaptiveRadixTreeIndex::BinaryC
   });
 }
 
+const ARTNode* ARTNode48::child(const uint8_t partial_key) const {
+  if (_index_to_child[partial_key] == INVALID_INDEX) return nullptr;
+  return _children[_index_to_child[partial_key]].get();
+}
+
 BaseIndex::Iterator ARTNode48::begin() const {
   for (auto index : _index_to_child) {
     if (index != INVALID_INDEX) {
@@ -351,6 +408,8 @@ BaseIndex::Iterator ARTNode256::lower_bound(const AdaptiveRadixTreeIndex::Binary
   });
 }
 
+const ARTNode* ARTNode256::child(const uint8_t partial_key) const { return _children[partial_key].get(); }
+
 BaseIndex::Iterator ARTNode256::begin() const {
   for (const auto& child : _children) {
     if (child != nullptr) {
@@ -379,4 +438,6 @@ BaseIndex::Iterator Leaf::begin() const { return _begin; }
 
 BaseIndex::Iterator Leaf::end() const { return _end; }
 
+const ARTNode* Leaf::child(uint8_t) const { return this; }
+
 }  // namespace opossum
@@ -34,6 +34,13 @@ class ARTNode : private Noncopyable {
   virtual Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const = 0;
   virtual Iterator begin() const = 0;
   virtual Iterator end() const = 0;
+
+  /**
+   * Returns the child for exactly this partial key or nullptr if there is none. Leaves return themselves, so that a
+   * traversal can take the same number of steps for every key. This is used for the batched lookups of
+   * AdaptiveRadixTreeIndex, which interleave the traversals of several keys.
+   */
+  virtual const ARTNode* child(uint8_t partial_key) const = 0;
 };
 
 /**
@@ -56,6 +63,7 @@ class ARTNode4 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
 
  private:
   /**
@@ -79,6 +87,8 @@ class ARTNode4 final : public ARTNode {
  *
  * The default value of the _partial_keys array is 255u
  *
+ * The partial keys are searched with SIMD instructions, comparing all 16 keys at once.
+ *
  */
 
 class ARTNode16 final : public ARTNode {
@@ -89,6 +99,7 @@ class ARTNode16 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
 
  private:
   Iterator _delegate_to_child(
@@ -120,6 +131,7 @@ class ARTNode48 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
 
  private:
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
@@ -142,6 +154,7 @@ class ARTNode256 final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t partial_key) const override;
 
  private:
   Iterator _delegate_to_child(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
@@ -186,6 +199,7 @@ class Leaf final : public ARTNode {
   Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
   Iterator begin() const override;
   Iterator end() const override;
+  const ARTNode* child(uint8_t) const override;
 
  private:
   Iterator _begin;
@@ -1,5 +1,10 @@
 #include "b_tree_index_impl.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include "storage/index/base_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
@@ -62,29 +67,29 @@ size_t BTreeIndexImpl<DataType>::memory_consumption() const {
 template <typename DataType>
 void BTreeIndexImpl<DataType>::_bulk_insert(const std::shared_ptr<const BaseSegment>& segment) {
   std::vector<std::pair<ChunkOffset, DataType>> values;
+  values.reserve(segment->size());
 
   // Materialize
   segment_iterate<DataType>(*segment, [&](const auto& position) {
     if (position.is_null()) return;
-    values.push_back(std::make_pair(position.chunk_offset(), position.value()));
+    values.emplace_back(position.chunk_offset(), position.value());
   });
 
+  if (values.empty()) return;
+
   // Sort
-  std::sort(values.begin(), values.end(), [](const auto& a, const auto& b) { return a.second < b.second; });
+  std::stable_sort(values.begin(), values.end(), [](const auto& a, const auto& b) { return a.second < b.second; });
   _chunk_offsets.resize(values.size());
   for (size_t i = 0; i < values.size(); i++) {
     _chunk_offsets[i] = values[i].first;
   }
 
-  // Build index
-  DataType current_value = values[0].second;
-  _btree[current_value] = 0;
-  _add_to_heap_memory_usage(current_value);
+  // Build index. The distinct values arrive in ascending order, so each one is appended at the end of the tree. With
+  // end() as the hint, the insert does not search the tree and only splits the rightmost nodes.
   for (size_t i = 0; i < values.size(); i++) {
-    if (values[i].second != current_value) {
-      current_value = values[i].second;
-      _btree[current_value] = i;
-      _add_to_heap_memory_usage(current_value);
+    if (i == 0 || values[i].second != values[i - 1].second) {
+      _btree.insert(_btree.end(), std::make_pair(values[i].second, i));
+      _add_to_heap_memory_usage(values[i].second);
     }
   }
 }
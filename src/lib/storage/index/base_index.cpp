@@ -7,6 +7,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 
 namespace opossum {
 
@@ -21,11 +22,32 @@ size_t BaseIndex::estimate_memory_consumption(SegmentIndexType type, ChunkOffset
       return AdaptiveRadixTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     case SegmentIndexType::BTree:
       return BTreeIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
+    case SegmentIndexType::Hash:
+      return HashIndex::estimate_memory_consumption(row_count, distinct_count, value_bytes);
     default:
       Fail("estimate_memory_consumption() is not implemented for the given index type");
   }
 }
 
+bool BaseIndex::supports(const SegmentIndexType type, const PredicateCondition predicate_condition) {
+  if (type == SegmentIndexType::Invalid) return false;
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+      return true;
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::Between:
+      // The HashIndex does not order its values
+      return type != SegmentIndexType::Hash;
+    default:
+      return false;
+  }
+}
+
 BaseIndex::BaseIndex(const SegmentIndexType type) : _type{type} {}
 
 bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
@@ -57,8 +79,23 @@ BaseIndex::Iterator BaseIndex::cbegin() const { return _cbegin(); }
 
 BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
 
+void BaseIndex::for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const {
+  DebugAssert(supports_key_access(), "Index does not support key access.");
+  DebugAssert(begin <= end, "Expected a valid range.");
+
+  _for_each_key(begin, end, key_functor);
+}
+
+bool BaseIndex::supports_key_access() const { return _supports_key_access(); }
+
 SegmentIndexType BaseIndex::type() const { return _type; }
 
 size_t BaseIndex::memory_consumption() const { return _memory_consumption(); }
 
+bool BaseIndex::_supports_key_access() const { return false; }
+
+void BaseIndex::_for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const {
+  Fail("Index does not support key access.");
+}
+
 }  // namespace opossum
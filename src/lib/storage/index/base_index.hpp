@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -15,7 +16,8 @@ class BaseSegment;
 /**
  * BaseIndex is the abstract super class for all index types, e.g. GroupKeyIndex, CompositeGroupKeyIndex,
  * ARTIndex etc.
- * It is assumed that all index types support range queries and that they are composite indices.
+ * It is assumed that all index types except for the HashIndex support range queries and that they are composite
+ * indices.
  * I.e. the index is sorted based on the column order. To check whether a key is less than another
  * key, the comparison is performed for the first column. If and only if they are equal, a check is
  * executed for the part of the next column. If needed, this step is repeated for all column
@@ -38,6 +40,9 @@ class BaseIndex : private Noncopyable {
   // For now we use an iterator over a vector of chunkoffsets as the GroupKeyIndex works like this
   using Iterator = std::vector<ChunkOffset>::const_iterator;
 
+  // Called with an indexed value and the number of rows that have it, see for_each_key()
+  using KeyFunctor = std::function<void(const AllTypeVariant& value, ChunkOffset row_count)>;
+
   /**
    * Predicts the memory consumption in bytes of creating an index with the specific index implementation <type>
    * on a Chunk with the following statistics:
@@ -51,6 +56,13 @@ class BaseIndex : private Noncopyable {
   static size_t estimate_memory_consumption(SegmentIndexType type, ChunkOffset row_count, ChunkOffset distinct_count,
                                             uint32_t value_bytes);
 
+  /**
+   * Returns whether an index of the given type can answer lookups with the predicate condition. The HashIndex only
+   * groups equal values, so it supports Equals and NotEquals, but no range lookups. For those, lower_bound() and
+   * upper_bound() only delimit the rows that equal the searched value.
+   */
+  static bool supports(SegmentIndexType type, PredicateCondition predicate_condition);
+
   /**
    * Creates an index on all given segments. Since all indices are composite indices the order of
    * the provided segments matters. Creating two indices with the same segments, but in different orders
@@ -119,6 +131,16 @@ class BaseIndex : private Noncopyable {
    */
   Iterator cend() const;
 
+  /**
+   * Index-only access: Calls key_functor with every value of the rows in [begin, end) and the number of rows that have
+   * it, without accessing the rows of the indexed segment. The range has to be delimited by the iterators returned by
+   * this index, e.g., by lower_bound() and upper_bound(). Only single-segment indexes that know their values support
+   * this, see supports_key_access().
+   */
+  void for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const;
+
+  bool supports_key_access() const;
+
   SegmentIndexType type() const;
 
   /**
@@ -138,6 +160,10 @@ class BaseIndex : private Noncopyable {
   virtual std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const = 0;
   virtual size_t _memory_consumption() const = 0;
 
+  // Not supported by default
+  virtual bool _supports_key_access() const;
+  virtual void _for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const;
+
  private:
   const SegmentIndexType _type;
 };
@@ -90,23 +90,23 @@ CompositeGroupKeyIndex::CompositeGroupKeyIndex(const std::vector<std::shared_ptr
   std::sort(_position_list.begin(), _position_list.end(),
             [&keys](auto left, auto right) { return keys[left] < keys[right]; });
 
-  _keys = VariableLengthKeyStore(static_cast<ChunkOffset>(segment_size), bytes_per_key);
+  auto sorted_keys = VariableLengthKeyStore(static_cast<ChunkOffset>(segment_size), bytes_per_key);
   for (ChunkOffset chunk_offset = 0; chunk_offset < segment_size; ++chunk_offset) {
-    _keys[chunk_offset] = keys[_position_list[chunk_offset]];
+    sorted_keys[chunk_offset] = keys[_position_list[chunk_offset]];
   }
 
   // create offsets to unique keys
   _key_offsets.reserve(segment_size);
   _key_offsets.emplace_back(0);
   for (ChunkOffset chunk_offset = 1; chunk_offset < segment_size; ++chunk_offset) {
-    if (_keys[chunk_offset] != _keys[chunk_offset - 1]) _key_offsets.emplace_back(chunk_offset);
+    if (sorted_keys[chunk_offset] != sorted_keys[chunk_offset - 1]) _key_offsets.emplace_back(chunk_offset);
   }
   _key_offsets.shrink_to_fit();
 
-  // remove duplicated keys
-  auto unique_keys_end = std::unique(_keys.begin(), _keys.end());
-  _keys.erase(unique_keys_end, _keys.end());
-  _keys.shrink_to_fit();
+  // remove duplicated keys and compress the remaining ones
+  auto unique_keys_end = std::unique(sorted_keys.begin(), sorted_keys.end());
+  sorted_keys.erase(unique_keys_end, sorted_keys.end());
+  _keys = PrefixCompressedKeyStore(sorted_keys);
 }
 
 BaseIndex::Iterator CompositeGroupKeyIndex::_cbegin() const { return _position_list.cbegin(); }
@@ -156,19 +156,15 @@ VariableLengthKey CompositeGroupKeyIndex::_create_composite_key(const std::vecto
 }
 
 BaseIndex::Iterator CompositeGroupKeyIndex::_get_position_iterator_for_key(const VariableLengthKey& key) const {
-  // get an iterator pointing to the search-key in the keystore
+  // get the position of the search-key in the keystore
   // (use always lower_bound() since the search method is already handled within creation of composite key)
-  auto key_it = std::lower_bound(_keys.cbegin(), _keys.cend(), key);
-  if (key_it == _keys.cend()) return _position_list.cend();
+  const auto key_position = _keys.lower_bound(key);
+  if (key_position == _keys.size()) return _position_list.cend();
 
-  // get the start position in the position-vector, ie the offset, by getting the offset_iterator for the key
-  // (which is at the same position as the iterator for the key in the keystore)
-  auto offset_it = _key_offsets.cbegin();
-  std::advance(offset_it, std::distance(_keys.cbegin(), key_it));
-
-  // get an iterator pointing to that start position
+  // get an iterator pointing to the start position in the position-vector, ie the offset of the key
+  // (which is at the same position as the key in the keystore)
   auto position_it = _position_list.cbegin();
-  std::advance(position_it, *offset_it);
+  std::advance(position_it, _key_offsets[key_position]);
 
   return position_it;
 }
@@ -183,7 +179,7 @@ std::vector<std::shared_ptr<const BaseSegment>> CompositeGroupKeyIndex::_get_ind
 }
 
 size_t CompositeGroupKeyIndex::_memory_consumption() const {
-  size_t byte_count = _keys.size() * _keys.key_size();
+  size_t byte_count = _keys.memory_consumption();
   byte_count += _key_offsets.size() * sizeof(ChunkOffset);
   byte_count += _position_list.size() * sizeof(ChunkOffset);
   return byte_count;
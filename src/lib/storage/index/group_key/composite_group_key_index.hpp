@@ -6,8 +6,8 @@
 #include <vector>
 
 #include "storage/index/base_index.hpp"
+#include "prefix_compressed_key_store.hpp"
 #include "types.hpp"
-#include "variable_length_key_store.hpp"
 
 namespace opossum {
 
@@ -19,7 +19,8 @@ class BaseDictionarySegment;
  * The CompositeGroupKey-Index works on an arbitrary number of dictionary compressed segments.
  * It uses three structures:
  *      - a position list containing record positions (ie ChunkOffsets)
- *      - a sorted store containing all unique concatenated keys of the input segments
+ *      - a sorted store containing all unique concatenated keys of the input segments, prefix-compressed in blocks
+ *        (see PrefixCompressedKeyStore)
  *      - an offset list storing where the positions for a certain concatenated key start at
  *        in the position list
  *
@@ -109,7 +110,7 @@ class CompositeGroupKeyIndex : public BaseIndex {
   std::vector<std::shared_ptr<const BaseDictionarySegment>> _indexed_segments;
 
   // contains concatenated value-ids
-  VariableLengthKeyStore _keys;
+  PrefixCompressedKeyStore _keys;
 
   // the start positions within _position_list for every key
   std::vector<ChunkOffset> _key_offsets;
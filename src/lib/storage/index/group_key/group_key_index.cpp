@@ -1,5 +1,7 @@
 #include "group_key_index.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <vector>
 
@@ -96,6 +98,26 @@ std::vector<std::shared_ptr<const BaseSegment>> GroupKeyIndex::_get_indexed_segm
   return {_indexed_segments};
 }
 
+bool GroupKeyIndex::_supports_key_access() const { return true; }
+
+void GroupKeyIndex::_for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const {
+  const auto begin_offset = static_cast<size_t>(std::distance(_index_postings.cbegin(), begin));
+  const auto end_offset = static_cast<size_t>(std::distance(_index_postings.cbegin(), end));
+
+  // Find the value id whose postings contain begin_offset
+  const auto offset_it = std::upper_bound(_index_offsets.cbegin(), _index_offsets.cend(), begin_offset);
+  auto value_id = static_cast<size_t>(std::distance(_index_offsets.cbegin(), offset_it) - 1);
+
+  for (; value_id < _indexed_segments->unique_values_count() && _index_offsets[value_id] < end_offset; ++value_id) {
+    const auto row_count =
+        std::min(_index_offsets[value_id + 1], end_offset) - std::max(_index_offsets[value_id], begin_offset);
+    if (row_count == 0) continue;
+
+    key_functor(_indexed_segments->value_of_value_id(ValueID{static_cast<ValueID::base_type>(value_id)}),
+                static_cast<ChunkOffset>(row_count));
+  }
+}
+
 size_t GroupKeyIndex::_memory_consumption() const {
   size_t bytes = sizeof(_indexed_segments);
   bytes += sizeof(std::size_t) * _index_offsets.size();
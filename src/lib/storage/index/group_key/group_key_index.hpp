@@ -79,6 +79,10 @@ class GroupKeyIndex : public BaseIndex {
 
   size_t _memory_consumption() const final;
 
+  // The values are taken from the dictionary of the indexed segment
+  bool _supports_key_access() const final;
+  void _for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const final;
+
  private:
   const std::shared_ptr<const BaseDictionarySegment> _indexed_segments;
   std::vector<std::size_t> _index_offsets;   // maps value-ids to offsets in _index_postings
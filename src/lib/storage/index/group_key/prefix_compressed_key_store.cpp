@@ -0,0 +1,167 @@
+#include "prefix_compressed_key_store.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#include "utils/assert.hpp"
+#include "variable_length_key_proxy.hpp"
+
+namespace opossum {
+
+PrefixCompressedKeyStore::PrefixCompressedKeyStore(const VariableLengthKeyStore& sorted_keys)
+    : _key_size(sorted_keys.key_size()), _size(sorted_keys.size()) {
+  DebugAssert(std::adjacent_find(sorted_keys.cbegin(), sorted_keys.cend(),
+                                 [](const auto& left, const auto& right) { return !(left < right); }) ==
+                  sorted_keys.cend(),
+              "Keys have to be sorted and unique.");
+
+  const auto block_count = (_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  _block_anchors = VariableLengthKeyStore(block_count, _key_size);
+  _suffix_widths.reserve(block_count);
+  _suffix_offsets.reserve(block_count);
+
+  for (auto block_id = ChunkOffset{0}; block_id < block_count; ++block_id) {
+    const auto block_begin = block_id * BLOCK_SIZE;
+    const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+
+    const auto first_key = sorted_keys[block_begin];
+    const auto last_key = sorted_keys[block_end - 1];
+    _block_anchors[block_id] = first_key;
+
+    // All keys in between share the most significant bytes that the first and the last key share
+    auto suffix_width = _key_size;
+    while (suffix_width > 0 && first_key._impl._data[_byte_index(suffix_width - 1)] ==
+                                   last_key._impl._data[_byte_index(suffix_width - 1)]) {
+      --suffix_width;
+    }
+
+    _suffix_widths.emplace_back(suffix_width);
+    _suffix_offsets.emplace_back(static_cast<uint32_t>(_suffixes.size()));
+
+    for (auto key_id = block_begin + 1; key_id < block_end; ++key_id) {
+      const auto key = sorted_keys[key_id];
+      for (auto significance = uint8_t{0}; significance < suffix_width; ++significance) {
+        _suffixes.emplace_back(key._impl._data[_byte_index(significance)]);
+      }
+    }
+  }
+
+  _suffixes.resize(_suffixes.size() + sizeof(uint64_t));
+  _suffixes.shrink_to_fit();
+}
+
+ChunkOffset PrefixCompressedKeyStore::lower_bound(const VariableLengthKey& key) const {
+  DebugAssert(key.bytes_per_key() == _key_size, "Key has the wrong size.");
+
+  // Find the last block whose first key is not larger than the searched key
+  const auto block_it = std::upper_bound(_block_anchors.cbegin(), _block_anchors.cend(), key);
+  if (block_it == _block_anchors.cbegin()) return 0;
+
+  const auto block_id = static_cast<ChunkOffset>(std::distance(_block_anchors.cbegin(), block_it) - 1);
+  const auto block_begin = block_id * BLOCK_SIZE;
+  const auto block_end = std::min(block_begin + BLOCK_SIZE, _size);
+
+  const auto anchor = _block_anchors[block_id];
+  if (anchor == key) return block_begin;
+
+  // The searched key is larger than the first key of the block. If it also has a larger prefix, it is larger than
+  // all keys of the block.
+  const auto suffix_width = _suffix_widths[block_id];
+  for (auto significance = static_cast<int16_t>(_key_size - 1); significance >= suffix_width; --significance) {
+    const auto byte_index = _byte_index(static_cast<uint8_t>(significance));
+    if (key._impl._data[byte_index] != anchor._impl._data[byte_index]) return block_end;
+  }
+
+  const auto suffix_offset = _suffix_offsets[block_id];
+  const auto suffix_count = block_end - block_begin - 1;
+
+  if (suffix_width <= sizeof(uint64_t)) {
+    auto searched_suffix = uint64_t{0};
+    for (auto significance = uint8_t{0}; significance < suffix_width; ++significance) {
+      searched_suffix |= uint64_t{key._impl._data[_byte_index(significance)]} << (significance * 8u);
+    }
+
+    // Unused entries are never smaller than the searched suffix
+    auto suffixes = std::array<uint64_t, BLOCK_SIZE - 1>{};
+    suffixes.fill(std::numeric_limits<uint64_t>::max());
+    for (auto suffix_id = ChunkOffset{0}; suffix_id < suffix_count; ++suffix_id) {
+      suffixes[suffix_id] = _load_suffix(suffix_offset + size_t{suffix_id} * suffix_width, suffix_width);
+    }
+
+    auto smaller_count = ChunkOffset{0};
+    for (auto suffix_id = ChunkOffset{0}; suffix_id < BLOCK_SIZE - 1; ++suffix_id) {
+      smaller_count += suffixes[suffix_id] < searched_suffix;
+    }
+    return block_begin + 1 + smaller_count;
+  }
+
+  // Longer suffixes are compared byte by byte, starting with the most significant one
+  for (auto suffix_id = ChunkOffset{0}; suffix_id < suffix_count; ++suffix_id) {
+    const auto* suffix = _suffixes.data() + suffix_offset + size_t{suffix_id} * suffix_width;
+    auto significance = static_cast<int16_t>(suffix_width - 1);
+    while (significance >= 0 && suffix[significance] == key._impl._data[_byte_index(significance)]) {
+      --significance;
+    }
+    if (significance < 0 || suffix[significance] > key._impl._data[_byte_index(significance)]) {
+      return block_begin + 1 + suffix_id;
+    }
+  }
+  return block_end;
+}
+
+VariableLengthKey PrefixCompressedKeyStore::operator[](ChunkOffset position) const {
+  DebugAssert(position < _size, "Position out of range.");
+
+  const auto block_id = position / BLOCK_SIZE;
+  VariableLengthKey key = _block_anchors[block_id];
+
+  const auto suffix_id = position % BLOCK_SIZE;
+  if (suffix_id == 0) return key;
+
+  const auto suffix_width = _suffix_widths[block_id];
+  const auto* suffix = _suffixes.data() + _suffix_offsets[block_id] + size_t{suffix_id - 1} * suffix_width;
+  for (auto significance = uint8_t{0}; significance < suffix_width; ++significance) {
+    key._impl._data[_byte_index(significance)] = suffix[significance];
+  }
+  return key;
+}
+
+CompositeKeyLength PrefixCompressedKeyStore::key_size() const { return _key_size; }
+
+ChunkOffset PrefixCompressedKeyStore::size() const { return _size; }
+
+size_t PrefixCompressedKeyStore::memory_consumption() const {
+  return _block_anchors.size() * _block_anchors.key_size() + _suffix_widths.size() * sizeof(uint8_t) +
+         _suffix_offsets.size() * sizeof(uint32_t) + _suffixes.size();
+}
+
+uint8_t PrefixCompressedKeyStore::_byte_index(uint8_t significance) const {
+  // The most significant byte is on the right on little-endian machines (see VariableLengthKeyBase)
+  if constexpr (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) {
+    return significance;
+  } else {
+    return static_cast<uint8_t>(_key_size - 1 - significance);
+  }
+}
+
+uint64_t PrefixCompressedKeyStore::_load_suffix(size_t suffix_offset, uint8_t suffix_width) const {
+  const auto mask = suffix_width == sizeof(uint64_t) ? std::numeric_limits<uint64_t>::max()
+                                                     : (uint64_t{1} << (suffix_width * 8u)) - 1u;
+  if constexpr (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) {
+    auto suffix = uint64_t{0};
+    std::memcpy(&suffix, _suffixes.data() + suffix_offset, sizeof(uint64_t));
+    return suffix & mask;
+  } else {
+    auto suffix = uint64_t{0};
+    for (auto significance = uint8_t{0}; significance < suffix_width; ++significance) {
+      suffix |= uint64_t{_suffixes[suffix_offset + significance]} << (significance * 8u);
+    }
+    return suffix;
+  }
+}
+
+}  // namespace opossum
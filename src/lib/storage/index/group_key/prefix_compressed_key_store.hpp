@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "types.hpp"
+#include "variable_length_key.hpp"
+#include "variable_length_key_store.hpp"
+
+namespace opossum {
+
+/**
+ * This class stores sorted, unique VariableLengthKeys in compressed form and supports lower-bound searches on them.
+ * It is used by the CompositeGroupKeyIndex, where neighbouring keys usually share their most significant bytes (i.e.,
+ * the value ids of the first indexed segments).
+ *
+ * The keys are grouped into blocks of BLOCK_SIZE keys. The first key of each block is stored in full in a
+ * VariableLengthKeyStore, so that the block of a key can be found with a binary search. As the keys are sorted, all
+ * keys of a block share the most significant bytes that the first and last key of the block share. Of the other keys,
+ * only the remaining least significant bytes are stored, with the same width for all keys of the block:
+ *
+ *    block anchors     suffix width     suffixes (least significant byte first)
+ *    00 01 02 00           1            03 | 07 | 0a | ...
+ *    00 01 05 01           2            02 10 | 04 11 | ...
+ *
+ * Within a block, the suffixes of keys of up to eight bytes are decoded into integers and compared with the searched
+ * suffix in a loop with a fixed trip count and without branches, which the compiler can vectorize.
+ */
+class PrefixCompressedKeyStore {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{16};
+
+  PrefixCompressedKeyStore() = default;
+
+  // Compresses the keys, which have to be sorted and unique
+  explicit PrefixCompressedKeyStore(const VariableLengthKeyStore& sorted_keys);
+
+  // Returns the position of the first key that is not smaller than the given key, or size() if there is none
+  ChunkOffset lower_bound(const VariableLengthKey& key) const;
+
+  // Decompresses the key at the given position
+  VariableLengthKey operator[](ChunkOffset position) const;
+
+  CompositeKeyLength key_size() const;
+
+  ChunkOffset size() const;
+
+  size_t memory_consumption() const;
+
+ private:
+  // Returns the index of the byte with the given significance in a key's data
+  uint8_t _byte_index(uint8_t significance) const;
+
+  // Decodes the suffix of up to eight bytes that starts at the given position of _suffixes
+  uint64_t _load_suffix(size_t suffix_offset, uint8_t suffix_width) const;
+
+  CompositeKeyLength _key_size{0};
+  ChunkOffset _size{0};
+
+  // The first key of each block
+  VariableLengthKeyStore _block_anchors;
+
+  // The number of least significant bytes that are stored for the keys of each block, and where they start
+  std::vector<uint8_t> _suffix_widths;
+  std::vector<uint32_t> _suffix_offsets;
+
+  // The suffixes of all keys but the first of each block. Padded, so that eight bytes can be loaded at every offset.
+  std::vector<uint8_t> _suffixes;
+};
+
+}  // namespace opossum
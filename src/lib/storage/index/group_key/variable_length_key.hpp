@@ -10,6 +10,7 @@ namespace opossum {
 
 class VariableLengthKeyProxy;
 class VariableLengthKeyConstProxy;
+class PrefixCompressedKeyStore;
 
 /**
  * The VariableLengthKey class can be used to create keys with a length up to 255 byte.
@@ -22,6 +23,7 @@ class VariableLengthKeyConstProxy;
 class VariableLengthKey {
   friend class VariableLengthKeyProxy;
   friend class VariableLengthKeyConstProxy;
+  friend class PrefixCompressedKeyStore;
 
  public:
   VariableLengthKey() = default;
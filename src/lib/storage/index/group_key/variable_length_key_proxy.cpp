@@ -59,6 +59,11 @@ VariableLengthKeyProxy& VariableLengthKeyProxy::operator=(const VariableLengthKe
   return *this;
 }
 
+VariableLengthKeyProxy& VariableLengthKeyProxy::operator=(const VariableLengthKeyConstProxy& other) {
+  operator=(other._impl);
+  return *this;
+}
+
 VariableLengthKeyProxy& VariableLengthKeyProxy::operator<<=(CompositeKeyLength shift) {
   _impl <<= shift;
   return *this;
@@ -14,6 +14,7 @@ class VariableLengthKeyConstProxy {
   friend class VariableLengthKey;
   friend class VariableLengthKeyStore;
   friend class VariableLengthKeyProxy;
+  friend class PrefixCompressedKeyStore;
 
  public:
   VariableLengthKeyConstProxy() = default;
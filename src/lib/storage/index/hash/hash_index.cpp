@@ -0,0 +1,49 @@
+#include "hash_index.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/index/segment_index_type.hpp"
+
+namespace opossum {
+
+size_t HashIndex::estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count,
+                                              uint32_t value_bytes) {
+  // At most half of the buckets are used and the bucket count is a power of two
+  auto bucket_count = size_t{16u};
+  while (bucket_count < size_t{2u} * distinct_count) bucket_count *= 2u;
+
+  return sizeof(ChunkOffset) * row_count + (value_bytes + sizeof(ChunkOffset)) * distinct_count +
+         sizeof(uint32_t) * bucket_count;
+}
+
+HashIndex::HashIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index)
+    : BaseIndex{get_index_type_of<HashIndex>()}, _indexed_segment(segments_to_index[0]) {
+  Assert((segments_to_index.size() == 1), "HashIndex only works with a single segment.");
+  _impl = make_shared_by_data_type<BaseHashIndexImpl, HashIndexImpl>(_indexed_segment->data_type(), _indexed_segment);
+}
+
+size_t HashIndex::_memory_consumption() const { return _impl->memory_consumption(); }
+
+HashIndex::Iterator HashIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  return _impl->lower_bound(values);
+}
+
+HashIndex::Iterator HashIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  return _impl->upper_bound(values);
+}
+
+HashIndex::Iterator HashIndex::_cbegin() const { return _impl->cbegin(); }
+
+HashIndex::Iterator HashIndex::_cend() const { return _impl->cend(); }
+
+std::vector<std::shared_ptr<const BaseSegment>> HashIndex::_get_indexed_segments() const { return {_indexed_segment}; }
+
+bool HashIndex::_supports_key_access() const { return true; }
+
+void HashIndex::_for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const {
+  _impl->for_each_key(begin, end, key_functor);
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "hash_index_impl.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/index/base_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest;
+
+/**
+ * The HashIndex answers equality lookups on a single segment in constant time. Unlike the other indexes, it does not
+ * order the values, so that it neither pays for sorting when it is created nor for a tree traversal when it is
+ * probed. Range lookups (e.g., for PredicateCondition::LessThan) are not supported, see BaseIndex::supports().
+ *
+ * It works on segments of all encodings and does not index NULLs.
+ */
+class HashIndex : public BaseIndex {
+  friend HashIndexTest;
+
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  /**
+   * Predicts the memory consumption in bytes of creating this index.
+   * See BaseIndex::estimate_memory_consumption()
+   */
+  static size_t estimate_memory_consumption(ChunkOffset row_count, ChunkOffset distinct_count, uint32_t value_bytes);
+
+  HashIndex() = delete;
+  explicit HashIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator _cbegin() const override;
+  Iterator _cend() const override;
+  std::vector<std::shared_ptr<const BaseSegment>> _get_indexed_segments() const override;
+  size_t _memory_consumption() const override;
+
+  bool _supports_key_access() const override;
+  void _for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const override;
+
+  std::shared_ptr<const BaseSegment> _indexed_segment;
+  std::shared_ptr<BaseHashIndexImpl> _impl;
+};
+
+}  // namespace opossum
@@ -0,0 +1,170 @@
+#include "hash_index_impl.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "storage/segment_iterate.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename DataType>
+HashIndexImpl<DataType>::HashIndexImpl(const std::shared_ptr<const BaseSegment>& segment_to_index) {
+  _resize_buckets(16u);
+
+  // Each row is assigned to the group of its value, NULLs are not indexed
+  auto group_ids = std::vector<GroupID>(segment_to_index->size(), EMPTY_BUCKET);
+  auto group_sizes = std::vector<ChunkOffset>{};
+
+  segment_iterate<DataType>(*segment_to_index, [&](const auto& position) {
+    if (position.is_null()) return;
+
+    const auto group_id = _find_or_add_group(position.value());
+    if (group_id == group_sizes.size()) group_sizes.emplace_back(0u);
+    ++group_sizes[group_id];
+    group_ids[position.chunk_offset()] = group_id;
+  });
+
+  _group_begins.resize(group_sizes.size() + 1u);
+  _group_begins[0] = 0u;
+  std::partial_sum(group_sizes.cbegin(), group_sizes.cend(), _group_begins.begin() + 1);
+
+  // Scatter the ChunkOffsets into their groups. As the rows are visited in order, each group is sorted.
+  _chunk_offsets.resize(_group_begins.back());
+  auto group_ends = std::vector<ChunkOffset>(_group_begins.cbegin(), _group_begins.cend() - 1);
+  for (auto chunk_offset = ChunkOffset{0u}; chunk_offset < group_ids.size(); ++chunk_offset) {
+    const auto group_id = group_ids[chunk_offset];
+    if (group_id == EMPTY_BUCKET) continue;
+    _chunk_offsets[group_ends[group_id]++] = chunk_offset;
+  }
+
+  _distinct_values.shrink_to_fit();
+}
+
+template <typename DataType>
+BaseHashIndexImpl::Iterator HashIndexImpl<DataType>::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (variant_is_null(values[0])) return cend();
+  return lower_bound(type_cast_variant<DataType>(values[0]));
+}
+
+template <typename DataType>
+BaseHashIndexImpl::Iterator HashIndexImpl<DataType>::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (variant_is_null(values[0])) return cend();
+  return upper_bound(type_cast_variant<DataType>(values[0]));
+}
+
+template <typename DataType>
+BaseHashIndexImpl::Iterator HashIndexImpl<DataType>::cbegin() const {
+  return _chunk_offsets.cbegin();
+}
+
+template <typename DataType>
+BaseHashIndexImpl::Iterator HashIndexImpl<DataType>::cend() const {
+  return _chunk_offsets.cend();
+}
+
+template <typename DataType>
+BaseHashIndexImpl::Iterator HashIndexImpl<DataType>::lower_bound(const DataType& value) const {
+  const auto group_id = _find_group(value);
+  if (group_id == EMPTY_BUCKET) return cend();
+  return _chunk_offsets.cbegin() + _group_begins[group_id];
+}
+
+template <typename DataType>
+BaseHashIndexImpl::Iterator HashIndexImpl<DataType>::upper_bound(const DataType& value) const {
+  const auto group_id = _find_group(value);
+  if (group_id == EMPTY_BUCKET) return cend();
+  return _chunk_offsets.cbegin() + _group_begins[group_id + 1];
+}
+
+template <typename DataType>
+void HashIndexImpl<DataType>::for_each_key(const Iterator& begin, const Iterator& end,
+                                           const KeyFunctor& key_functor) const {
+  const auto begin_offset = static_cast<ChunkOffset>(std::distance(_chunk_offsets.cbegin(), begin));
+  const auto end_offset = static_cast<ChunkOffset>(std::distance(_chunk_offsets.cbegin(), end));
+
+  // Find the group whose ChunkOffsets contain begin_offset
+  const auto group_begin_it = std::upper_bound(_group_begins.cbegin(), _group_begins.cend(), begin_offset);
+  auto group_id = static_cast<GroupID>(std::distance(_group_begins.cbegin(), group_begin_it) - 1);
+
+  for (; group_id < _distinct_values.size() && _group_begins[group_id] < end_offset; ++group_id) {
+    const auto row_count =
+        std::min(_group_begins[group_id + 1], end_offset) - std::max(_group_begins[group_id], begin_offset);
+    if (row_count > 0) key_functor(_distinct_values[group_id], row_count);
+  }
+}
+
+template <typename DataType>
+size_t HashIndexImpl<DataType>::memory_consumption() const {
+  auto bytes = sizeof(*this) + sizeof(ChunkOffset) * (_chunk_offsets.capacity() + _group_begins.capacity()) +
+               sizeof(DataType) * _distinct_values.capacity() + sizeof(GroupID) * _buckets.capacity();
+
+  if constexpr (std::is_same_v<DataType, std::string>) {
+    // Strings that do not fit into the small string buffer are stored on the heap
+    const auto small_string_capacity = std::string{}.capacity();
+    for (const auto& value : _distinct_values) {
+      if (value.capacity() > small_string_capacity) bytes += value.capacity() + 1u;
+    }
+  }
+
+  return bytes;
+}
+
+template <typename DataType>
+typename HashIndexImpl<DataType>::GroupID HashIndexImpl<DataType>::_find_group(const DataType& value) const {
+  const auto bucket_mask = _buckets.size() - 1u;
+  for (auto bucket = _first_bucket(value);; bucket = (bucket + 1u) & bucket_mask) {
+    const auto group_id = _buckets[bucket];
+    if (group_id == EMPTY_BUCKET || _distinct_values[group_id] == value) return group_id;
+  }
+}
+
+template <typename DataType>
+typename HashIndexImpl<DataType>::GroupID HashIndexImpl<DataType>::_find_or_add_group(const DataType& value) {
+  const auto bucket_mask = _buckets.size() - 1u;
+  auto bucket = _first_bucket(value);
+  for (; _buckets[bucket] != EMPTY_BUCKET; bucket = (bucket + 1u) & bucket_mask) {
+    if (_distinct_values[_buckets[bucket]] == value) return _buckets[bucket];
+  }
+
+  const auto group_id = static_cast<GroupID>(_distinct_values.size());
+  _distinct_values.emplace_back(value);
+  _buckets[bucket] = group_id;
+
+  if (_distinct_values.size() * 2u > _buckets.size()) _resize_buckets(_buckets.size() * 2u);
+
+  return group_id;
+}
+
+template <typename DataType>
+size_t HashIndexImpl<DataType>::_first_bucket(const DataType& value) const {
+  // Fibonacci hashing, see Knuth, The Art of Computer Programming, Vol. 3, Section 6.4
+  const auto hash = static_cast<uint64_t>(std::hash<DataType>{}(value)) * uint64_t{0x9E3779B97F4A7C15};
+  return static_cast<size_t>(hash >> _bucket_shift);
+}
+
+template <typename DataType>
+void HashIndexImpl<DataType>::_resize_buckets(const size_t bucket_count) {
+  DebugAssert(bucket_count > 1u && (bucket_count & (bucket_count - 1u)) == 0u,
+              "Bucket count must be a power of two.");
+
+  _buckets.assign(bucket_count, EMPTY_BUCKET);
+  _bucket_shift = 64u - static_cast<size_t>(__builtin_ctzll(bucket_count));
+
+  const auto bucket_mask = bucket_count - 1u;
+  for (auto group_id = GroupID{0u}; group_id < _distinct_values.size(); ++group_id) {
+    auto bucket = _first_bucket(_distinct_values[group_id]);
+    while (_buckets[bucket] != EMPTY_BUCKET) bucket = (bucket + 1u) & bucket_mask;
+    _buckets[bucket] = group_id;
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(HashIndexImpl);
+
+}  // namespace opossum
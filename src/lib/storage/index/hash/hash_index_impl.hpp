@@ -0,0 +1,87 @@
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/base_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest;
+
+class BaseHashIndexImpl : public Noncopyable {
+  friend HashIndexTest;
+
+ public:
+  virtual ~BaseHashIndexImpl() = default;
+
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+  virtual size_t memory_consumption() const = 0;
+  virtual Iterator lower_bound(const std::vector<AllTypeVariant>&) const = 0;
+  virtual Iterator upper_bound(const std::vector<AllTypeVariant>&) const = 0;
+  virtual Iterator cbegin() const = 0;
+  virtual Iterator cend() const = 0;
+
+  using KeyFunctor = std::function<void(const AllTypeVariant& value, ChunkOffset row_count)>;
+  virtual void for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const = 0;
+
+ protected:
+  std::vector<ChunkOffset> _chunk_offsets;
+};
+
+/**
+ * The ChunkOffsets of all non-NULL rows are stored in _chunk_offsets, grouped by value and in ascending order within
+ * each group. A group is identified by its position in _distinct_values, and its ChunkOffsets are at
+ * [_group_begins[group_id], _group_begins[group_id + 1]) in _chunk_offsets.
+ *
+ * The groups are found through an open-addressing hash table with linear probing, which only stores the group ids in
+ * _buckets. At most half of the buckets are used, so that a lookup rarely needs more than two probes.
+ *
+ * The groups are not ordered by value. Thus, lower_bound() and upper_bound() only delimit the rows with exactly the
+ * searched value and return cend() for values that are not contained. See BaseIndex::supports().
+ */
+template <typename DataType>
+class HashIndexImpl : public BaseHashIndexImpl {
+  friend HashIndexTest;
+
+ public:
+  explicit HashIndexImpl(const std::shared_ptr<const BaseSegment>& segment_to_index);
+
+  size_t memory_consumption() const override;
+
+  Iterator lower_bound(const DataType& value) const;
+  Iterator upper_bound(const DataType& value) const;
+
+  Iterator lower_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator upper_bound(const std::vector<AllTypeVariant>&) const override;
+  Iterator cbegin() const override;
+  Iterator cend() const override;
+
+  void for_each_key(const Iterator& begin, const Iterator& end, const KeyFunctor& key_functor) const override;
+
+ protected:
+  using GroupID = uint32_t;
+  static constexpr auto EMPTY_BUCKET = std::numeric_limits<GroupID>::max();
+
+  // Returns the group of the value or EMPTY_BUCKET if the value is not indexed
+  GroupID _find_group(const DataType& value) const;
+
+  // Returns the group of the value and adds a new group if it does not exist yet
+  GroupID _find_or_add_group(const DataType& value);
+
+  size_t _first_bucket(const DataType& value) const;
+  void _resize_buckets(size_t bucket_count);
+
+  std::vector<DataType> _distinct_values;
+  std::vector<ChunkOffset> _group_begins;
+  std::vector<GroupID> _buckets;
+
+  // The bucket of a value is taken from the upper bits of its multiplied hash, so that similar hashes are spread
+  size_t _bucket_shift;
+};
+
+}  // namespace opossum
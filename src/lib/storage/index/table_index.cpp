@@ -0,0 +1,216 @@
+#include "table_index.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+/**
+ * Calls functor(range_begin, range_end) for the (up to two) ranges of [begin, end) whose values satisfy the
+ * predicate. lower_bound(value) and upper_bound(value) return iterators into [begin, end).
+ */
+template <typename T, typename Iterator, typename LowerBound, typename UpperBound, typename Functor>
+void for_each_matching_range(const PredicateCondition predicate_condition, const T& search_value,
+                             const std::optional<T>& search_value2, const Iterator begin, const Iterator end,
+                             const LowerBound& lower_bound, const UpperBound& upper_bound, const Functor& functor) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      functor(lower_bound(search_value), upper_bound(search_value));
+      break;
+    case PredicateCondition::NotEquals:
+      functor(begin, lower_bound(search_value));
+      functor(upper_bound(search_value), end);
+      break;
+    case PredicateCondition::LessThan:
+      functor(begin, lower_bound(search_value));
+      break;
+    case PredicateCondition::LessThanEquals:
+      functor(begin, upper_bound(search_value));
+      break;
+    case PredicateCondition::GreaterThan:
+      functor(upper_bound(search_value), end);
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      functor(lower_bound(search_value), end);
+      break;
+    case PredicateCondition::Between:
+      DebugAssert(search_value2, "Between requires two search values");
+      // An empty range, lower_bound(search_value) would be behind upper_bound(search_value2)
+      if (*search_value2 < search_value) break;
+      functor(lower_bound(search_value), upper_bound(*search_value2));
+      break;
+    default:
+      Fail("Predicate condition not supported by TableIndex");
+  }
+}
+
+}  // namespace
+
+BaseTableIndex::BaseTableIndex(const ColumnID column_id) : _column_id{column_id} {}
+
+ColumnID BaseTableIndex::column_id() const { return _column_id; }
+
+bool BaseTableIndex::supports(const PredicateCondition predicate_condition) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::Between:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+TableIndex<T>::TableIndex(const ColumnID column_id) : BaseTableIndex{column_id} {}
+
+template <typename T>
+void TableIndex<T>::insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_offset,
+                           const ChunkOffset end_offset) {
+  DebugAssert(begin_offset <= end_offset && end_offset <= segment.size(), "Rows to index are out of range");
+
+  // Read the values before taking the lock, so that lookups are only blocked while the entries are added
+  auto entries = std::vector<Entry>{};
+  entries.reserve(end_offset - begin_offset);
+
+  segment_with_iterators<T>(segment, [&](auto it, const auto /* end */) {
+    std::advance(it, begin_offset);
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset, ++it) {
+      if (it->is_null()) continue;
+      entries.emplace_back(it->value(), RowID{chunk_id, chunk_offset});
+    }
+  });
+
+  if (entries.size() >= BULK_INSERT_THRESHOLD) std::sort(entries.begin(), entries.end());
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  if (entries.size() >= BULK_INSERT_THRESHOLD) {
+    _merge_into_main(entries);
+    return;
+  }
+
+  for (auto& entry : entries) {
+    _delta.emplace(std::move(entry.first), entry.second);
+  }
+
+  if (_delta.size() * MAIN_TO_DELTA_RATIO > _main.size() + BULK_INSERT_THRESHOLD * MAIN_TO_DELTA_RATIO) {
+    auto delta_entries = std::vector<Entry>{};
+    delta_entries.reserve(_delta.size());
+
+    // The multimap is ordered by value only, the RowIDs of equal values are sorted here
+    for (auto& [value, row_id] : _delta) {
+      delta_entries.emplace_back(std::move(value), row_id);
+    }
+    _delta.clear();
+
+    std::sort(delta_entries.begin(), delta_entries.end());
+    _merge_into_main(delta_entries);
+  }
+}
+
+template <typename T>
+void TableIndex<T>::remove_chunk(const ChunkID chunk_id) {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+
+  _main.erase(std::remove_if(_main.begin(), _main.end(),
+                             [&](const auto& entry) { return entry.second.chunk_id == chunk_id; }),
+              _main.end());
+
+  for (auto delta_it = _delta.begin(); delta_it != _delta.end();) {
+    if (delta_it->second.chunk_id == chunk_id) {
+      delta_it = _delta.erase(delta_it);
+    } else {
+      ++delta_it;
+    }
+  }
+}
+
+template <typename T>
+void TableIndex<T>::append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                                   const std::optional<AllTypeVariant>& search_value2, PosList& matches) const {
+  // No value compares to NULL
+  if (variant_is_null(search_value) || (search_value2 && variant_is_null(*search_value2))) return;
+
+  const auto typed_search_value = type_cast_variant<T>(search_value);
+  const auto typed_search_value2 =
+      search_value2 ? std::optional<T>{type_cast_variant<T>(*search_value2)} : std::optional<T>{};
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  const auto main_lower_bound = [&](const T& value) {
+    return std::lower_bound(_main.cbegin(), _main.cend(), value,
+                            [](const auto& entry, const auto& value) { return entry.first < value; });
+  };
+  const auto main_upper_bound = [&](const T& value) {
+    return std::upper_bound(_main.cbegin(), _main.cend(), value,
+                            [](const auto& value, const auto& entry) { return value < entry.first; });
+  };
+  for_each_matching_range(predicate_condition, typed_search_value, typed_search_value2, _main.cbegin(),
+                          _main.cend(), main_lower_bound, main_upper_bound, [&](const auto begin, const auto end) {
+                            matches.reserve(matches.size() + std::distance(begin, end));
+                            std::transform(begin, end, std::back_inserter(matches),
+                                           [](const auto& entry) { return entry.second; });
+                          });
+
+  if (_delta.empty()) return;
+
+  const auto delta_lower_bound = [&](const T& value) { return _delta.lower_bound(value); };
+  const auto delta_upper_bound = [&](const T& value) { return _delta.upper_bound(value); };
+  for_each_matching_range(predicate_condition, typed_search_value, typed_search_value2, _delta.cbegin(),
+                          _delta.cend(), delta_lower_bound, delta_upper_bound, [&](auto begin, const auto end) {
+                            for (; begin != end; ++begin) {
+                              matches.emplace_back(begin->second);
+                            }
+                          });
+}
+
+template <typename T>
+size_t TableIndex<T>::size() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _main.size() + _delta.size();
+}
+
+template <typename T>
+size_t TableIndex<T>::estimate_memory_usage() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+
+  // The multimap's nodes hold three pointers and a color next to the entry
+  auto bytes = sizeof(*this) + _main.capacity() * sizeof(Entry) + _delta.size() * (sizeof(Entry) + 4 * sizeof(void*));
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto& entry : _main) bytes += entry.first.capacity();
+    for (const auto& entry : _delta) bytes += entry.first.capacity();
+  }
+
+  return bytes;
+}
+
+template <typename T>
+void TableIndex<T>::_merge_into_main(std::vector<Entry>& entries) {
+  const auto old_size = _main.size();
+  _main.insert(_main.end(), std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+  std::inplace_merge(_main.begin(), _main.begin() + old_size, _main.end());
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(TableIndex);
+
+}  // namespace opossum
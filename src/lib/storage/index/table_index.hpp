@@ -0,0 +1,102 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+
+/**
+ * A TableIndex is a secondary index over a single column of a table that maps values to the RowIDs of all chunks.
+ * In contrast to the chunk indexes (see BaseIndex), a lookup is a single search instead of one search per chunk,
+ * which is what makes point lookups on tables with many chunks fast.
+ *
+ * The index is owned by the Table, which adds the rows of new chunks (see Table::create_table_index). NULLs are not
+ * indexed, as no predicate supported by the index matches them.
+ *
+ * Entries are kept in two parts: The main part is a sorted vector of (value, RowID) pairs, which is compact and cheap
+ * to search. Rows that are added in small batches (e.g., by the Insert operator) go to an ordered delta first and are
+ * merged into the main part once the delta reaches a fraction of its size. This keeps the amortized cost of an insert
+ * low without making lookups slower than two binary searches. Lookups and inserts may run concurrently.
+ *
+ * As with the other indexes, the RowIDs include rows that are not visible to every transaction. The results have to
+ * be validated.
+ */
+class BaseTableIndex : private Noncopyable {
+ public:
+  explicit BaseTableIndex(const ColumnID column_id);
+  virtual ~BaseTableIndex() = default;
+
+  ColumnID column_id() const;
+
+  // Adds the rows [begin_offset, end_offset) of the given segment, which is part of the chunk with chunk_id
+  virtual void insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset) = 0;
+
+  // Removes all rows of the given chunk, e.g., when the chunk is replaced
+  virtual void remove_chunk(const ChunkID chunk_id) = 0;
+
+  /**
+   * Appends the RowIDs of all rows whose value satisfies `value <predicate_condition> search_value` to `matches`.
+   * For PredicateCondition::Between, search_value2 is the upper bound. The values are not sorted.
+   */
+  virtual void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                              const std::optional<AllTypeVariant>& search_value2, PosList& matches) const = 0;
+
+  // Returns whether append_matches supports the predicate condition
+  static bool supports(const PredicateCondition predicate_condition);
+
+  // Returns the number of indexed rows
+  virtual size_t size() const = 0;
+
+  virtual size_t estimate_memory_usage() const = 0;
+
+ private:
+  const ColumnID _column_id;
+};
+
+template <typename T>
+class TableIndex : public BaseTableIndex {
+ public:
+  // The delta is merged into the main part once it holds more than 1/MAIN_TO_DELTA_RATIO of the main part's entries
+  static constexpr size_t MAIN_TO_DELTA_RATIO = 16;
+
+  // Batches of at least this many rows are merged into the main part right away
+  static constexpr size_t BULK_INSERT_THRESHOLD = 1'000;
+
+  explicit TableIndex(const ColumnID column_id);
+
+  void insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset) final;
+
+  void remove_chunk(const ChunkID chunk_id) final;
+
+  void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& search_value,
+                      const std::optional<AllTypeVariant>& search_value2, PosList& matches) const final;
+
+  size_t size() const final;
+
+  size_t estimate_memory_usage() const final;
+
+ private:
+  using Entry = std::pair<T, RowID>;
+
+  // Merges the given entries, which need to be sorted, into the main part. Requires the exclusive lock.
+  void _merge_into_main(std::vector<Entry>& entries);
+
+  std::vector<Entry> _main;
+  std::multimap<T, RowID> _delta;
+
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <lz4hc.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+
+#include "storage/lz4_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+class LZ4Encoder : public SegmentEncoder<LZ4Encoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::LZ4>;
+  static constexpr auto _uses_vector_compression = false;  // see base_segment_encoder.hpp for details
+
+  template <typename T>
+  std::shared_ptr<BaseEncodedSegment> _on_encode(const std::shared_ptr<const ValueSegment<T>>& value_segment) {
+    const auto alloc = value_segment->values().get_allocator();
+
+    static constexpr auto block_size = LZ4Segment<T>::block_size;
+
+    const auto size = value_segment->size();
+
+    // Ceiling of integer division
+    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+
+    const auto num_blocks = div_ceil(size, block_size);
+
+    // holds the compressed blocks back to back
+    auto compressed_data = pmr_vector<char>{alloc};
+
+    // holds the start of each compressed block in compressed_data (plus the end of the last block)
+    auto block_offsets = pmr_vector<size_t>{alloc};
+    block_offsets.reserve(num_blocks + 1);
+    block_offsets.push_back(0u);
+
+    // holds the number of bytes of each block before compression
+    auto decompressed_block_sizes = pmr_vector<uint32_t>{alloc};
+    decompressed_block_sizes.reserve(num_blocks);
+
+    // holds whether a segment value is null
+    auto null_values = pmr_vector<bool>{alloc};
+    null_values.reserve(size);
+
+    // temporary storage for the values of one block and their serialized form
+    auto current_value_block = std::vector<T>{};
+    current_value_block.reserve(block_size);
+    auto serialized_block = std::vector<char>{};
+
+    const auto compress_block = [&]() {
+      _serialize_block(current_value_block, serialized_block);
+
+      Assert(serialized_block.size() <= static_cast<size_t>(std::numeric_limits<int>::max()),
+             "Serialized LZ4 block is too large.");
+      const auto serialized_size = static_cast<int>(serialized_block.size());
+      const auto bound = LZ4_compressBound(serialized_size);
+
+      const auto previous_size = compressed_data.size();
+      compressed_data.resize(previous_size + bound);
+
+      const auto compressed_size = LZ4_compress_HC(serialized_block.data(), compressed_data.data() + previous_size,
+                                                   serialized_size, bound, LZ4HC_CLEVEL_DEFAULT);
+      Assert(compressed_size > 0 || serialized_size == 0, "LZ4 compression failed.");
+
+      compressed_data.resize(previous_size + compressed_size);
+      block_offsets.push_back(compressed_data.size());
+      decompressed_block_sizes.push_back(static_cast<uint32_t>(serialized_size));
+
+      current_value_block.clear();
+    };
+
+    auto iterable = ValueSegmentIterable<T>{*value_segment};
+    iterable.for_each([&](const auto& segment_value) {
+      const auto is_null = segment_value.is_null();
+      current_value_block.push_back(is_null ? T{} : segment_value.value());
+      null_values.push_back(is_null);
+
+      if (current_value_block.size() == block_size) {
+        compress_block();
+      }
+    });
+
+    // The last value block might not be filled completely
+    if (!current_value_block.empty()) {
+      compress_block();
+    }
+
+    compressed_data.shrink_to_fit();
+
+    return std::allocate_shared<LZ4Segment<T>>(alloc, std::move(compressed_data), std::move(block_offsets),
+                                               std::move(decompressed_block_sizes), std::move(null_values));
+  }
+
+ private:
+  // See lz4_segment.hpp for the layout of a serialized block
+  template <typename T>
+  static void _serialize_block(const std::vector<T>& values, std::vector<char>& serialized_block) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto offsets_size = values.size() * sizeof(uint32_t);
+
+      auto characters_size = size_t{0u};
+      for (const auto& value : values) {
+        characters_size += value.size();
+      }
+      Assert(characters_size <= std::numeric_limits<uint32_t>::max(), "Strings in LZ4 block are too long.");
+
+      serialized_block.resize(offsets_size + characters_size);
+
+      auto end_offset = uint32_t{0u};
+      auto* characters = serialized_block.data() + offsets_size;
+      for (auto index = size_t{0u}; index < values.size(); ++index) {
+        const auto& value = values[index];
+        std::memcpy(characters + end_offset, value.data(), value.size());
+        end_offset += static_cast<uint32_t>(value.size());
+        std::memcpy(serialized_block.data() + index * sizeof(uint32_t), &end_offset, sizeof(uint32_t));
+      }
+    } else {
+      serialized_block.resize(values.size() * sizeof(T));
+      std::memcpy(serialized_block.data(), values.data(), serialized_block.size());
+    }
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "storage/segment_iterables.hpp"
+
+#include "storage/lz4_segment.hpp"
+
+namespace opossum {
+
+/**
+ * Iterating over an LZ4Segment decompresses one block at a time. The iterators cache the
+ * most recently decompressed block so that consecutive accesses to the same block (i.e.,
+ * sequential scans or sorted position lists) only pay for the decompression once.
+ */
+template <typename T>
+class LZ4Iterable : public PointAccessibleSegmentIterable<LZ4Iterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit LZ4Iterable(const LZ4Segment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_statistics().on_sequential_scan(_segment.size());
+
+    auto begin = Iterator{&_segment, _segment.null_values().cbegin(), ChunkOffset{0u}};
+    auto end = Iterator{nullptr, _segment.null_values().cend(), static_cast<ChunkOffset>(_segment.size())};
+
+    functor(begin, end);
+  }
+
+  template <typename Functor>
+  void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    _segment.access_statistics().on_point_access(position_filter->size());
+
+    auto begin = PointAccessIterator{&_segment, position_filter->cbegin(), position_filter->cbegin()};
+    auto end = PointAccessIterator{nullptr, position_filter->cbegin(), position_filter->cend()};
+
+    functor(begin, end);
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const LZ4Segment<T>& _segment;
+
+ private:
+  /**
+   * Holds the values of the block that has been decompressed last. Shared between copies
+   * of an iterator. Since a decompressed block is never modified, but replaced by a newly
+   * allocated one, sharing it is safe.
+   */
+  class BlockCache {
+   public:
+    const T& get(const LZ4Segment<T>& segment, const ChunkOffset chunk_offset) {
+      const auto block_index = static_cast<size_t>(chunk_offset / LZ4Segment<T>::block_size);
+      if (block_index != _block_index) {
+        auto values = std::make_shared<std::vector<T>>();
+        segment.decompress_block(block_index, *values);
+        _values = std::move(values);
+        _block_index = block_index;
+      }
+      return (*_values)[chunk_offset % LZ4Segment<T>::block_size];
+    }
+
+   private:
+    size_t _block_index{std::numeric_limits<size_t>::max()};
+    std::shared_ptr<const std::vector<T>> _values;
+  };
+
+  class Iterator : public BaseSegmentIterator<Iterator, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = LZ4Iterable<T>;
+    using NullValueIterator = typename pmr_vector<bool>::const_iterator;
+
+   public:
+    explicit Iterator(const LZ4Segment<T>* segment, NullValueIterator null_value_it, ChunkOffset chunk_offset)
+        : _segment{segment}, _null_value_it{null_value_it}, _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_null_value_it;
+      ++_chunk_offset;
+    }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    SegmentPosition<T> dereference() const {
+      if (*_null_value_it) {
+        return SegmentPosition<T>{T{}, true, _chunk_offset};
+      }
+      return SegmentPosition<T>{_block_cache.get(*_segment, _chunk_offset), false, _chunk_offset};
+    }
+
+   private:
+    const LZ4Segment<T>* _segment;
+    NullValueIterator _null_value_it;
+    ChunkOffset _chunk_offset;
+    mutable BlockCache _block_cache;
+  };
+
+  class PointAccessIterator : public BasePointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = LZ4Iterable<T>;
+
+    PointAccessIterator(const LZ4Segment<T>* segment, const PosList::const_iterator position_filter_begin,
+                        PosList::const_iterator position_filter_it)
+        : BasePointAccessSegmentIterator<PointAccessIterator, SegmentPosition<T>>{std::move(position_filter_begin),
+                                                                                  std::move(position_filter_it)},
+          _segment{segment} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto offset_in_referenced_chunk = chunk_offsets.offset_in_referenced_chunk;
+
+      if (_segment->null_values()[offset_in_referenced_chunk]) {
+        return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+      }
+
+      const auto& value = _block_cache.get(*_segment, offset_in_referenced_chunk);
+      return SegmentPosition<T>{value, false, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const LZ4Segment<T>* _segment;
+    mutable BlockCache _block_cache;
+  };
+};
+
+}  // namespace opossum
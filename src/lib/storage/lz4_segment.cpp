@@ -0,0 +1,172 @@
+#include "lz4_segment.hpp"
+
+#include <lz4.h>
+
+#include <cstring>
+#include <string>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T>
+LZ4Segment<T>::LZ4Segment(pmr_vector<char> compressed_data, pmr_vector<size_t> block_offsets,
+                          pmr_vector<uint32_t> decompressed_block_sizes, pmr_vector<bool> null_values)
+    : BaseEncodedSegment{data_type_from_type<T>()},
+      _compressed_data{std::move(compressed_data)},
+      _block_offsets{std::move(block_offsets)},
+      _decompressed_block_sizes{std::move(decompressed_block_sizes)},
+      _null_values{std::move(null_values)} {
+  DebugAssert(_block_offsets.size() == _decompressed_block_sizes.size() + 1, "Expected one offset per block plus end");
+}
+
+template <typename T>
+const pmr_vector<char>& LZ4Segment<T>::compressed_data() const {
+  return _compressed_data;
+}
+
+template <typename T>
+const pmr_vector<size_t>& LZ4Segment<T>::block_offsets() const {
+  return _block_offsets;
+}
+
+template <typename T>
+const pmr_vector<uint32_t>& LZ4Segment<T>::decompressed_block_sizes() const {
+  return _decompressed_block_sizes;
+}
+
+template <typename T>
+const pmr_vector<bool>& LZ4Segment<T>::null_values() const {
+  return _null_values;
+}
+
+template <typename T>
+size_t LZ4Segment<T>::block_count() const {
+  return _decompressed_block_sizes.size();
+}
+
+template <typename T>
+void LZ4Segment<T>::_decompress_raw_block(size_t block_index, std::vector<char>& buffer) const {
+  DebugAssert(block_index < block_count(), "Block index out of range");
+
+  const auto decompressed_size = _decompressed_block_sizes[block_index];
+  const auto compressed_begin = _block_offsets[block_index];
+  const auto compressed_size = _block_offsets[block_index + 1] - compressed_begin;
+
+  buffer.resize(decompressed_size);
+  const auto written_bytes =
+      LZ4_decompress_safe(_compressed_data.data() + compressed_begin, buffer.data(), static_cast<int>(compressed_size),
+                          static_cast<int>(decompressed_size));
+  Assert(written_bytes == static_cast<int>(decompressed_size), "LZ4 decompression failed");
+}
+
+template <typename T>
+void LZ4Segment<T>::decompress_block(size_t block_index, std::vector<T>& values) const {
+  const auto value_count = std::min(size_t{block_size}, size() - block_index * block_size);
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto buffer = std::vector<char>{};
+    _decompress_raw_block(block_index, buffer);
+
+    const auto* end_offsets = reinterpret_cast<const uint32_t*>(buffer.data());
+    const auto* characters = buffer.data() + value_count * sizeof(uint32_t);
+
+    values.resize(value_count);
+    auto begin_offset = uint32_t{0u};
+    for (auto index = size_t{0u}; index < value_count; ++index) {
+      const auto end_offset = end_offsets[index];
+      values[index].assign(characters + begin_offset, end_offset - begin_offset);
+      begin_offset = end_offset;
+    }
+  } else {
+    values.resize(value_count);
+
+    const auto decompressed_size = _decompressed_block_sizes[block_index];
+    DebugAssert(decompressed_size == value_count * sizeof(T), "Unexpected size of decompressed block");
+
+    const auto compressed_begin = _block_offsets[block_index];
+    const auto compressed_size = _block_offsets[block_index + 1] - compressed_begin;
+
+    // Decompress directly into the value vector to save a copy
+    const auto written_bytes = LZ4_decompress_safe(
+        _compressed_data.data() + compressed_begin, reinterpret_cast<char*>(values.data()),
+        static_cast<int>(compressed_size), static_cast<int>(decompressed_size));
+    Assert(written_bytes == static_cast<int>(decompressed_size), "LZ4 decompression failed");
+  }
+}
+
+template <typename T>
+const AllTypeVariant LZ4Segment<T>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value.has_value()) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T>
+const std::optional<T> LZ4Segment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
+  if (_null_values[chunk_offset]) {
+    return std::nullopt;
+  }
+
+  const auto block_index = chunk_offset / block_size;
+  const auto index_in_block = chunk_offset % block_size;
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    auto values = std::vector<T>{};
+    decompress_block(block_index, values);
+    return std::move(values[index_in_block]);
+  } else {
+    // For fixed-width types, we do not need to materialize the entire block as values of T
+    auto buffer = std::vector<char>{};
+    _decompress_raw_block(block_index, buffer);
+
+    auto value = T{};
+    std::memcpy(&value, buffer.data() + index_in_block * sizeof(T), sizeof(T));
+    return value;
+  }
+}
+
+template <typename T>
+size_t LZ4Segment<T>::size() const {
+  return _null_values.size();
+}
+
+template <typename T>
+std::shared_ptr<BaseSegment> LZ4Segment<T>::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_compressed_data = pmr_vector<char>{_compressed_data, alloc};
+  auto new_block_offsets = pmr_vector<size_t>{_block_offsets, alloc};
+  auto new_decompressed_block_sizes = pmr_vector<uint32_t>{_decompressed_block_sizes, alloc};
+  auto new_null_values = pmr_vector<bool>{_null_values, alloc};
+
+  return std::allocate_shared<LZ4Segment>(alloc, std::move(new_compressed_data), std::move(new_block_offsets),
+                                          std::move(new_decompressed_block_sizes), std::move(new_null_values));
+}
+
+template <typename T>
+size_t LZ4Segment<T>::estimate_memory_usage() const {
+  static const auto bits_per_byte = 8u;
+
+  return sizeof(*this) + _compressed_data.size() + _block_offsets.size() * sizeof(size_t) +
+         _decompressed_block_sizes.size() * sizeof(uint32_t) + _null_values.size() / bits_per_byte;
+}
+
+template <typename T>
+EncodingType LZ4Segment<T>::encoding_type() const {
+  return EncodingType::LZ4;
+}
+
+template <typename T>
+std::optional<CompressedVectorType> LZ4Segment<T>::compressed_vector_type() const {
+  return std::nullopt;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(LZ4Segment);
+
+}  // namespace opossum
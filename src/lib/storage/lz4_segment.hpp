@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "base_encoded_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Segment implementing LZ4 block compression
+ *
+ * The values of the segment are divided into fixed-size blocks, which are
+ * serialized and compressed independently using LZ4 (high compression mode).
+ * This gives much better compression ratios than the lightweight encodings
+ * for wide string columns (e.g., comments or addresses) at the price of
+ * having to decompress an entire block to access a single value. The
+ * encoding is therefore meant for cold columns that are rarely scanned.
+ *
+ * Serialized block layout:
+ *  - For arithmetic types, a block is simply the array of its values.
+ *  - For strings, a block starts with the end offsets (uint32_t) of all of its
+ *    strings followed by the concatenated characters. The offsets are stored
+ *    inside the block so that they are compressed as well.
+ *
+ * As in value segments, null values are represented as an additional
+ * boolean vector. Null values are stored as T{} in the blocks.
+ */
+template <typename T>
+class LZ4Segment : public BaseEncodedSegment {
+ public:
+  /**
+   * Number of values per block. Larger blocks compress better, but point
+   * accesses and partial scans have to decompress more data.
+   */
+  static constexpr auto block_size = 4096u;
+
+  explicit LZ4Segment(pmr_vector<char> compressed_data, pmr_vector<size_t> block_offsets,
+                      pmr_vector<uint32_t> decompressed_block_sizes, pmr_vector<bool> null_values);
+
+  /**
+   * The compressed blocks are stored back to back in compressed_data.
+   * Block i spans [block_offsets[i], block_offsets[i + 1]).
+   */
+  const pmr_vector<char>& compressed_data() const;
+  const pmr_vector<size_t>& block_offsets() const;
+  const pmr_vector<uint32_t>& decompressed_block_sizes() const;
+  const pmr_vector<bool>& null_values() const;
+
+  size_t block_count() const;
+
+  /**
+   * Decompresses the block with the given index and replaces the contents of
+   * values with the values of the block (null values are T{}).
+   */
+  void decompress_block(size_t block_index, std::vector<T>& values) const;
+
+  /**
+   * @defgroup BaseSegment interface
+   * @{
+   */
+
+  const AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
+
+  size_t size() const final;
+
+  std::shared_ptr<BaseSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t estimate_memory_usage() const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup BaseEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  void _decompress_raw_block(size_t block_index, std::vector<char>& buffer) const;
+
+  const pmr_vector<char> _compressed_data;
+  const pmr_vector<size_t> _block_offsets;
+  const pmr_vector<uint32_t> _decompressed_block_sizes;
+  const pmr_vector<bool> _null_values;
+};
+
+}  // namespace opossum
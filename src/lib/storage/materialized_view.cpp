@@ -0,0 +1,541 @@
+#include "materialized_view.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "boost/functional/hash.hpp"
+
+#include "concurrency/transaction_manager.hpp"
+#include "expression/aggregate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/intermediate_result_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/logical_plan_root_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Joins, predicates, and projections are linear in each of their inputs: The delta of their output is computed from
+// the delta of an input alone. Nodes that are not part of a tree would see the delta of a table more than once.
+bool is_linear(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (node->output_count() > 1) return false;
+
+  switch (node->type) {
+    case LQPNodeType::StoredTable: {
+      const auto& stored_table_node = static_cast<const StoredTableNode&>(*node);
+      return stored_table_node.excluded_chunk_ids().empty() && !stored_table_node.table_sample();
+    }
+
+    case LQPNodeType::Join: {
+      const auto join_mode = static_cast<const JoinNode&>(*node).join_mode;
+      if (join_mode != JoinMode::Inner && join_mode != JoinMode::Cross) return false;
+    } break;
+
+    case LQPNodeType::Alias:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Validate:
+      break;
+
+    default:
+      return false;
+  }
+
+  auto is_scalar = true;
+  for (auto& node_expression : node->node_expressions) {
+    visit_expression(node_expression, [&](const auto& expression) {
+      switch (expression->type) {
+        case ExpressionType::Aggregate:
+        case ExpressionType::CorrelatedParameter:
+        case ExpressionType::LQPSelect:
+        case ExpressionType::PQPSelect:
+        case ExpressionType::Placeholder:
+        case ExpressionType::WindowFunction:
+          is_scalar = false;
+          return ExpressionVisitation::DoNotVisitArguments;
+        default:
+          return ExpressionVisitation::VisitArguments;
+      }
+    });
+  }
+  if (!is_scalar) return false;
+
+  return (!node->left_input() || is_linear(node->left_input())) &&
+         (!node->right_input() || is_linear(node->right_input()));
+}
+
+// The AggregateNode below the projections and aliases at the top of @param lqp, if any
+std::shared_ptr<AggregateNode> find_aggregate_node(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto node = lqp;
+  while (node->type == LQPNodeType::Projection || node->type == LQPNodeType::Alias ||
+         node->type == LQPNodeType::Validate) {
+    node = node->left_input();
+  }
+  return std::dynamic_pointer_cast<AggregateNode>(node);
+}
+
+// The StoredTableNodes of equally structured LQPs are found in the same order
+std::vector<std::shared_ptr<StoredTableNode>> find_stored_table_nodes(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto stored_table_nodes = std::vector<std::shared_ptr<StoredTableNode>>{};
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      stored_table_nodes.emplace_back(std::static_pointer_cast<StoredTableNode>(node));
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  return stored_table_nodes;
+}
+
+void append_referencing_chunk(Table& reference_table, const std::shared_ptr<const Table>& table,
+                              const std::shared_ptr<PosList>& pos_list) {
+  if (pos_list->empty()) return;
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  }
+  reference_table.append_chunk(segments);
+}
+
+bool is_visible(const CommitID begin_cid, const CommitID end_cid, const CommitID snapshot_commit_id) {
+  return begin_cid <= snapshot_commit_id && snapshot_commit_id < end_cid;
+}
+
+// References the committed rows of @param table that a snapshot with @param snapshot_commit_id sees. Without a
+// snapshot, i.e., before the view was computed, no rows are visible.
+std::shared_ptr<const Table> find_visible_rows(const std::shared_ptr<const Table>& table,
+                                               const std::optional<CommitID>& snapshot_commit_id) {
+  const auto visible_rows = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  if (!snapshot_commit_id) return visible_rows;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    const auto all_rows_visible = mvcc_data->is_fully_visible(*snapshot_commit_id);
+
+    const auto pos_list = std::make_shared<PosList>();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      if (all_rows_visible ||
+          is_visible(mvcc_data->begin_cid(chunk_offset), mvcc_data->end_cid(chunk_offset), *snapshot_commit_id)) {
+        pos_list->emplace_back(chunk_id, chunk_offset);
+      }
+    }
+    append_referencing_chunk(*visible_rows, table, pos_list);
+  }
+
+  return visible_rows;
+}
+
+// References the rows of @param table that became visible (first) and those that became invisible (second) between
+// the snapshots
+std::pair<std::shared_ptr<const Table>, std::shared_ptr<const Table>> find_changed_rows(
+    const std::shared_ptr<const Table>& table, const std::optional<CommitID>& old_commit_id,
+    const CommitID new_commit_id) {
+  const auto inserted_rows = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  const auto deleted_rows = std::make_shared<Table>(table->column_definitions(), TableType::References);
+
+  // Without transactions that modified the table since the old snapshot, there are no changes to look for
+  if (old_commit_id && table->last_commit_id() <= *old_commit_id) return {inserted_rows, deleted_rows};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    if (old_commit_id && mvcc_data->is_fully_visible(*old_commit_id)) continue;
+
+    const auto inserted_pos_list = std::make_shared<PosList>();
+    const auto deleted_pos_list = std::make_shared<PosList>();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto begin_cid = mvcc_data->begin_cid(chunk_offset);
+      const auto end_cid = mvcc_data->end_cid(chunk_offset);
+      const auto was_visible = old_commit_id && is_visible(begin_cid, end_cid, *old_commit_id);
+      const auto is_visible_now = is_visible(begin_cid, end_cid, new_commit_id);
+
+      if (is_visible_now && !was_visible) inserted_pos_list->emplace_back(chunk_id, chunk_offset);
+      if (was_visible && !is_visible_now) deleted_pos_list->emplace_back(chunk_id, chunk_offset);
+    }
+    append_referencing_chunk(*inserted_rows, table, inserted_pos_list);
+    append_referencing_chunk(*deleted_rows, table, deleted_pos_list);
+  }
+
+  return {inserted_rows, deleted_rows};
+}
+
+}  // namespace
+
+namespace opossum {
+
+MaterializedView::MaterializedView(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                   const std::unordered_map<ColumnID, std::string>& column_names)
+    : lqp(lqp_copy_without_validate_nodes(lqp)), column_names(column_names) {
+  Assert(is_supported(this->lqp), "The LQP of the materialized view cannot be maintained incrementally");
+
+  _aggregate_node = find_aggregate_node(this->lqp);
+
+  if (!_aggregate_node) {
+    _delta_lqp = this->lqp->deep_copy();
+  } else {
+    // The delta LQP outputs the group by expressions, followed by the arguments of the aggregates
+    const auto& aggregate_node_expressions = _aggregate_node->node_expressions;
+    _group_by_expression_count = _aggregate_node->aggregate_expressions_begin_idx;
+    auto expressions = std::vector<std::shared_ptr<AbstractExpression>>(
+        aggregate_node_expressions.cbegin(), aggregate_node_expressions.cbegin() + _group_by_expression_count);
+    for (auto expression_idx = _group_by_expression_count; expression_idx < aggregate_node_expressions.size();
+         ++expression_idx) {
+      const auto argument =
+          static_cast<const AggregateExpression&>(*aggregate_node_expressions[expression_idx]).argument();
+      if (!argument) {
+        _aggregate_argument_column_ids.emplace_back(std::nullopt);
+        continue;
+      }
+      _aggregate_argument_column_ids.emplace_back(ColumnID{static_cast<ColumnID::base_type>(expressions.size())});
+      expressions.emplace_back(argument);
+    }
+
+    const auto aggregate_input = _aggregate_node->left_input()->deep_copy();
+    const auto node_mapping = lqp_create_node_mapping(_aggregate_node->left_input(), aggregate_input);
+    _delta_lqp = ProjectionNode::make(expressions_copy_and_adapt_to_different_lqp(expressions, node_mapping),
+                                      aggregate_input);
+
+    for (const auto& expression : this->lqp->column_expressions()) {
+      _view_column_ids.emplace_back(*_aggregate_node->find_column_id(*expression));
+    }
+  }
+
+  auto column_definitions = TableColumnDefinitions{};
+  const auto& column_expressions = this->lqp->column_expressions();
+  for (auto column_id = ColumnID{0}; column_id < column_expressions.size(); ++column_id) {
+    const auto& expression = *column_expressions[column_id];
+    const auto column_name_iter = column_names.find(column_id);
+    column_definitions.emplace_back(
+        column_name_iter != column_names.end() ? column_name_iter->second : expression.as_column_name(),
+        expression.data_type(), expression.is_nullable());
+  }
+  _table = std::make_shared<Table>(column_definitions, TableType::Data, std::nullopt, UseMvcc::Yes);
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _refresh(std::nullopt, TransactionManager::get().last_commit_id());
+}
+
+bool MaterializedView::is_supported(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  const auto aggregate_node = find_aggregate_node(lqp);
+  if (!aggregate_node) return is_linear(lqp);
+
+  const auto& node_expressions = aggregate_node->node_expressions;
+  for (auto expression_idx = aggregate_node->aggregate_expressions_begin_idx; expression_idx < node_expressions.size();
+       ++expression_idx) {
+    const auto aggregate_function =
+        static_cast<const AggregateExpression&>(*node_expressions[expression_idx]).aggregate_function;
+    if (aggregate_function != AggregateFunction::Sum && aggregate_function != AggregateFunction::Count) return false;
+  }
+
+  // The nodes above the AggregateNode may only select its columns, which identify the row of each group
+  for (const auto& expression : lqp->column_expressions()) {
+    if (!aggregate_node->find_column_id(*expression)) return false;
+  }
+
+  return is_linear(aggregate_node->left_input());
+}
+
+void MaterializedView::refresh() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto commit_id = TransactionManager::get().last_commit_id();
+  if (commit_id == _refreshed_commit_id) return;
+
+  _refresh(_refreshed_commit_id, commit_id);
+}
+
+CommitID MaterializedView::refreshed_commit_id() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _refreshed_commit_id;
+}
+
+const std::shared_ptr<Table>& MaterializedView::table() const { return _table; }
+
+size_t MaterializedView::RowHash::operator()(const Row& row) const {
+  auto hash = size_t{0};
+  for (const auto& value : row) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+bool MaterializedView::RowEqual::operator()(const Row& lhs, const Row& rhs) const {
+  if (lhs.size() != rhs.size()) return false;
+
+  for (auto value_idx = size_t{0}; value_idx < lhs.size(); ++value_idx) {
+    const auto lhs_is_null = variant_is_null(lhs[value_idx]);
+    const auto rhs_is_null = variant_is_null(rhs[value_idx]);
+    if (lhs_is_null != rhs_is_null) return false;
+    if (!lhs_is_null && lhs[value_idx] != rhs[value_idx]) return false;
+  }
+  return true;
+}
+
+void MaterializedView::_refresh(const std::optional<CommitID>& old_commit_id, const CommitID new_commit_id) {
+  struct TableVersions {
+    std::shared_ptr<const Table> table;
+    std::shared_ptr<const Table> inserted_rows;
+    std::shared_ptr<const Table> deleted_rows;
+
+    // Only needed if the view joins the table with a changed one, hence computed on demand
+    std::shared_ptr<const Table> old_rows;
+    std::shared_ptr<const Table> new_rows;
+  };
+
+  const auto stored_table_nodes = find_stored_table_nodes(_delta_lqp);
+  auto versions_by_table_name = std::unordered_map<std::string, TableVersions>{};
+  for (const auto& stored_table_node : stored_table_nodes) {
+    auto& versions = versions_by_table_name[stored_table_node->table_name];
+    if (versions.table) continue;
+
+    versions.table = StorageManager::get().get_table(stored_table_node->table_name);
+    std::tie(versions.inserted_rows, versions.deleted_rows) =
+        find_changed_rows(versions.table, old_commit_id, new_commit_id);
+  }
+
+  // The delta of R_1 x ... x R_n is the sum of the terms R_1,new x ... x R_i-1,new x delta(R_i) x R_i+1,old x ... x
+  // R_n,old, where the rows that became invisible count negatively
+  auto view_delta = ViewDelta{};
+  for (auto delta_node_idx = size_t{0}; delta_node_idx < stored_table_nodes.size(); ++delta_node_idx) {
+    const auto& delta_versions = versions_by_table_name[stored_table_nodes[delta_node_idx]->table_name];
+
+    for (const auto& [delta_rows, sign] : {std::make_pair(delta_versions.inserted_rows, int64_t{1}),
+                                           std::make_pair(delta_versions.deleted_rows, int64_t{-1})}) {
+      if (delta_rows->row_count() == 0) continue;
+
+      auto input_tables = std::vector<std::shared_ptr<const Table>>(stored_table_nodes.size());
+      auto has_empty_input = false;
+      for (auto node_idx = size_t{0}; node_idx < stored_table_nodes.size(); ++node_idx) {
+        auto& versions = versions_by_table_name[stored_table_nodes[node_idx]->table_name];
+        if (node_idx == delta_node_idx) {
+          input_tables[node_idx] = delta_rows;
+        } else if (node_idx < delta_node_idx) {
+          if (!versions.new_rows) versions.new_rows = find_visible_rows(versions.table, new_commit_id);
+          input_tables[node_idx] = versions.new_rows;
+        } else {
+          if (!versions.old_rows) versions.old_rows = find_visible_rows(versions.table, old_commit_id);
+          input_tables[node_idx] = versions.old_rows;
+        }
+        has_empty_input |= input_tables[node_idx]->row_count() == 0;
+      }
+
+      // Joins of an empty table and the other supported nodes over it output no rows
+      if (has_empty_input) continue;
+
+      _add_to_delta(*_execute_delta_lqp(input_tables), sign, view_delta);
+    }
+  }
+
+  // An aggregate without GROUP BY outputs a row even for no input rows
+  if (!old_commit_id && _aggregate_node && _group_by_expression_count == 0) {
+    view_delta.group_changes[Row{}].aggregates.resize(_aggregate_argument_column_ids.size());
+  }
+
+  if (_aggregate_node) {
+    _apply_group_changes(view_delta, new_commit_id);
+  } else {
+    _apply_row_changes(view_delta, new_commit_id);
+  }
+
+  _refreshed_commit_id = new_commit_id;
+}
+
+std::shared_ptr<const Table> MaterializedView::_execute_delta_lqp(
+    const std::vector<std::shared_ptr<const Table>>& input_tables) const {
+  // The root node allows for replacing the topmost node, too
+  const auto root_node = LogicalPlanRootNode::make(_delta_lqp->deep_copy());
+
+  const auto stored_table_nodes = find_stored_table_nodes(root_node);
+  DebugAssert(stored_table_nodes.size() == input_tables.size(), "Expected an input table for each StoredTableNode");
+  for (auto node_idx = size_t{0}; node_idx < stored_table_nodes.size(); ++node_idx) {
+    // The IntermediateResultNode has the column expressions of the StoredTableNode, which the nodes above reference
+    lqp_replace_node(stored_table_nodes[node_idx],
+                     IntermediateResultNode::make(stored_table_nodes[node_idx], input_tables[node_idx]));
+  }
+
+  const auto pqp = LQPTranslator{}.translate_node(root_node->left_input());
+  const auto tasks = OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes);
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  return tasks.back()->get_operator()->get_output();
+}
+
+void MaterializedView::_add_to_delta(const Table& delta_lqp_output, const int64_t sign,
+                                     ViewDelta& view_delta) const {
+  const auto column_count = delta_lqp_output.column_count();
+  const auto& aggregate_node_expressions = _aggregate_node ? _aggregate_node->node_expressions
+                                                           : std::vector<std::shared_ptr<AbstractExpression>>{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < delta_lqp_output.chunk_count(); ++chunk_id) {
+    const auto chunk = delta_lqp_output.get_chunk(chunk_id);
+    const auto& segments = chunk->segments();
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      auto row = Row(column_count);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        row[column_id] = (*segments[column_id])[chunk_offset];
+      }
+
+      if (!_aggregate_node) {
+        view_delta.row_count_changes[row] += sign;
+        continue;
+      }
+
+      auto& group_state = view_delta.group_changes[Row(row.cbegin(), row.cbegin() + _group_by_expression_count)];
+      group_state.aggregates.resize(_aggregate_argument_column_ids.size());
+      group_state.row_count += sign;
+
+      for (auto aggregate_idx = size_t{0}; aggregate_idx < _aggregate_argument_column_ids.size(); ++aggregate_idx) {
+        const auto& argument_column_id = _aggregate_argument_column_ids[aggregate_idx];
+        if (!argument_column_id || variant_is_null(row[*argument_column_id])) continue;
+
+        auto& aggregate_state = group_state.aggregates[aggregate_idx];
+        aggregate_state.value_count += sign;
+
+        const auto& aggregate_expression = static_cast<const AggregateExpression&>(
+            *aggregate_node_expressions[_group_by_expression_count + aggregate_idx]);
+        if (aggregate_expression.aggregate_function != AggregateFunction::Sum) continue;
+        if (aggregate_expression.data_type() == DataType::Long) {
+          aggregate_state.integral_sum += sign * type_cast_variant<int64_t>(row[*argument_column_id]);
+        } else {
+          aggregate_state.floating_sum +=
+              static_cast<double>(sign) * type_cast_variant<double>(row[*argument_column_id]);
+        }
+      }
+    }
+  }
+}
+
+void MaterializedView::_apply_row_changes(const ViewDelta& view_delta, const CommitID commit_id) {
+  auto has_changes = false;
+
+  for (const auto& [row, row_count_change] : view_delta.row_count_changes) {
+    if (row_count_change == 0) continue;
+    has_changes = true;
+
+    auto& row_ids = _row_ids_by_row[row];
+    for (auto row_idx = int64_t{0}; row_idx < row_count_change; ++row_idx) {
+      row_ids.emplace_back(_append_row(row, commit_id));
+    }
+    for (auto row_idx = int64_t{0}; row_idx < -row_count_change; ++row_idx) {
+      Assert(!row_ids.empty(), "Materialized view lost track of its rows");
+      _invalidate_row(row_ids.back(), commit_id);
+      row_ids.pop_back();
+    }
+    if (row_ids.empty()) _row_ids_by_row.erase(row);
+  }
+
+  if (has_changes) _table->register_commit(commit_id);
+}
+
+void MaterializedView::_apply_group_changes(const ViewDelta& view_delta, const CommitID commit_id) {
+  auto has_changes = false;
+
+  for (const auto& [group_key, group_change] : view_delta.group_changes) {
+    auto& group_state = _groups[group_key];
+    group_state.aggregates.resize(_aggregate_argument_column_ids.size());
+
+    // E.g., a row that was updated without changing the group or the aggregated values
+    auto is_unchanged = group_state.row_id && group_change.row_count == 0;
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < group_state.aggregates.size(); ++aggregate_idx) {
+      const auto& aggregate_change = group_change.aggregates[aggregate_idx];
+      auto& aggregate_state = group_state.aggregates[aggregate_idx];
+      is_unchanged &= aggregate_change.value_count == 0 && aggregate_change.integral_sum == 0 &&
+                      aggregate_change.floating_sum == 0.0;
+
+      aggregate_state.value_count += aggregate_change.value_count;
+      aggregate_state.integral_sum += aggregate_change.integral_sum;
+      aggregate_state.floating_sum += aggregate_change.floating_sum;
+    }
+    if (is_unchanged) continue;
+    has_changes = true;
+
+    group_state.row_count += group_change.row_count;
+    Assert(group_state.row_count >= 0, "Materialized view lost track of its groups");
+
+    if (group_state.row_id) _invalidate_row(*group_state.row_id, commit_id);
+
+    if (group_state.row_count == 0 && _group_by_expression_count > 0) {
+      _groups.erase(group_key);
+      continue;
+    }
+    group_state.row_id = _append_row(_group_row(group_key, group_state), commit_id);
+  }
+
+  if (has_changes) _table->register_commit(commit_id);
+}
+
+MaterializedView::Row MaterializedView::_group_row(const Row& group_key, const GroupState& group_state) const {
+  // The row as output by the AggregateNode
+  auto aggregate_row = group_key;
+  const auto& aggregate_node_expressions = _aggregate_node->node_expressions;
+  for (auto aggregate_idx = size_t{0}; aggregate_idx < group_state.aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate_expression = static_cast<const AggregateExpression&>(
+        *aggregate_node_expressions[_group_by_expression_count + aggregate_idx]);
+    const auto& aggregate_state = group_state.aggregates[aggregate_idx];
+
+    if (aggregate_expression.aggregate_function == AggregateFunction::Count) {
+      // COUNT(*) counts all rows, COUNT(x) the rows where x is not NULL
+      const auto count =
+          _aggregate_argument_column_ids[aggregate_idx] ? aggregate_state.value_count : group_state.row_count;
+      aggregate_row.emplace_back(count);
+    } else if (aggregate_state.value_count == 0) {
+      aggregate_row.emplace_back(NULL_VALUE);
+    } else if (aggregate_expression.data_type() == DataType::Long) {
+      aggregate_row.emplace_back(aggregate_state.integral_sum);
+    } else {
+      aggregate_row.emplace_back(aggregate_state.floating_sum);
+    }
+  }
+
+  auto row = Row{};
+  row.reserve(_view_column_ids.size());
+  for (const auto column_id : _view_column_ids) {
+    row.emplace_back(aggregate_row[column_id]);
+  }
+  return row;
+}
+
+RowID MaterializedView::_append_row(const Row& row, const CommitID commit_id) {
+  _table->append(row);
+
+  const auto chunk_id = ChunkID{_table->chunk_count() - 1};
+  const auto chunk = _table->get_chunk(chunk_id);
+  const auto chunk_offset = ChunkOffset{chunk->size() - 1};
+
+  // The row is appended as uncommitted and becomes visible to snapshots that include the refresh
+  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+  mvcc_data->begin_cids[chunk_offset] = commit_id;
+  mvcc_data->register_committed_insert(commit_id);
+
+  return RowID{chunk_id, chunk_offset};
+}
+
+void MaterializedView::_invalidate_row(const RowID row_id, const CommitID commit_id) {
+  auto mvcc_data = _table->get_chunk(row_id.chunk_id)->get_scoped_mvcc_data_lock_for_writing();
+  mvcc_data->register_invalidation();
+  mvcc_data->end_cids[row_id.chunk_offset] = commit_id;
+}
+
+}  // namespace opossum
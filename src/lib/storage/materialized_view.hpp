@@ -0,0 +1,137 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class AbstractLQPNode;
+class AggregateNode;
+class Table;
+
+/**
+ * A view whose result is stored as a table and maintained incrementally, as opposed to an LQPView, which is
+ * recomputed on every access. The StorageManager registers the table under the name of the view (see
+ * StorageManager::add_materialized_view()), so that it is read like any other table. The MaterializedViewRule answers
+ * queries that equal the view from it.
+ *
+ * refresh() propagates the changes committed to the base tables since the last refresh, i.e., the rows that became
+ * visible and those that became invisible. The result of the view only changes by the rows computed from these
+ * deltas: As delta(R x S) = delta(R) x S_old + R_new x delta(S) for joins, the delta of the base table of each
+ * StoredTableNode is joined with the new versions of the tables before it and the old versions of the tables after it.
+ * The rows of the view are added and invalidated with the commit id up to which the view was refreshed, so readers
+ * with an older snapshot still see the previous result. Rows appended to the base tables outside of transactions are
+ * not propagated.
+ *
+ * Supported are LQPs of (inner or cross) joins, predicates, projections and aliases over stored tables, optionally
+ * aggregated by SUM and COUNT at the top. Above the AggregateNode, projections and aliases may only select its
+ * columns. For aggregates, the view keeps the number of rows and of non-NULL values of each group, so that a group is
+ * removed once its last row is deleted. ValidateNodes in the LQP are ignored, as the view handles visibility itself.
+ */
+class MaterializedView {
+ public:
+  // Computes the result of the view on all changes committed so far
+  MaterializedView(const std::shared_ptr<AbstractLQPNode>& lqp,
+                   const std::unordered_map<ColumnID, std::string>& column_names = {});
+
+  MaterializedView(const MaterializedView&) = delete;
+  MaterializedView& operator=(const MaterializedView&) = delete;
+
+  static bool is_supported(const std::shared_ptr<AbstractLQPNode>& lqp);
+
+  // Propagates the changes committed to the base tables since the last refresh. Thread-safe.
+  void refresh();
+
+  // The CommitID up to which the changes to the base tables are reflected in the table of the view
+  CommitID refreshed_commit_id() const;
+
+  // Stored table with MVCC data that holds the result of the view
+  const std::shared_ptr<Table>& table() const;
+
+  // The LQP that defines the view, without ValidateNodes
+  const std::shared_ptr<AbstractLQPNode> lqp;
+
+  const std::unordered_map<ColumnID, std::string> column_names;
+
+  using Row = std::vector<AllTypeVariant>;
+
+  // NULLs are equal to each other here, so that they form a group
+  struct RowHash {
+    size_t operator()(const Row& row) const;
+  };
+  struct RowEqual {
+    bool operator()(const Row& lhs, const Row& rhs) const;
+  };
+
+ private:
+  struct AggregateState {
+    int64_t value_count{0};
+    int64_t integral_sum{0};
+    double floating_sum{0.0};
+  };
+
+  struct GroupState {
+    // The row of the group in the table of the view, if any
+    std::optional<RowID> row_id;
+    int64_t row_count{0};
+    std::vector<AggregateState> aggregates;
+  };
+
+  // The results of all terms of the delta of one refresh
+  struct ViewDelta {
+    std::unordered_map<Row, int64_t, RowHash, RowEqual> row_count_changes;
+    std::unordered_map<Row, GroupState, RowHash, RowEqual> group_changes;
+  };
+
+  // Propagates the changes between the snapshots @param old_commit_id (or the empty tables) and @param new_commit_id
+  void _refresh(const std::optional<CommitID>& old_commit_id, const CommitID new_commit_id);
+
+  // Executes the delta LQP with the table of each of its StoredTableNodes replaced by the corresponding input table
+  std::shared_ptr<const Table> _execute_delta_lqp(const std::vector<std::shared_ptr<const Table>>& input_tables) const;
+
+  // Adds the rows of the output of the delta LQP with @param sign to the delta of the view
+  void _add_to_delta(const Table& delta_lqp_output, const int64_t sign, ViewDelta& view_delta) const;
+
+  void _apply_row_changes(const ViewDelta& view_delta, const CommitID commit_id);
+  void _apply_group_changes(const ViewDelta& view_delta, const CommitID commit_id);
+
+  // Output row of the view for the given group
+  Row _group_row(const Row& group_key, const GroupState& group_state) const;
+
+  RowID _append_row(const Row& row, const CommitID commit_id);
+  void _invalidate_row(const RowID row_id, const CommitID commit_id);
+
+  // Computes the rows that are changed in the view. For aggregates, it outputs the group by expressions and the
+  // arguments of the aggregates for each row of the input of the AggregateNode.
+  std::shared_ptr<AbstractLQPNode> _delta_lqp;
+
+  std::shared_ptr<AggregateNode> _aggregate_node;
+  size_t _group_by_expression_count{0};
+
+  // For each aggregate, the column of its argument in the output of the delta LQP (none for COUNT(*))
+  std::vector<std::optional<ColumnID>> _aggregate_argument_column_ids;
+
+  // For aggregates, the column of the AggregateNode that each column of the view outputs
+  std::vector<ColumnID> _view_column_ids;
+
+  std::shared_ptr<Table> _table;
+
+  // The valid rows of the view (without aggregate), by their values
+  std::unordered_map<Row, std::vector<RowID>, RowHash, RowEqual> _row_ids_by_row;
+
+  // The groups of the view (with aggregate), by the values of their group by expressions
+  std::unordered_map<Row, GroupState, RowHash, RowEqual> _groups;
+
+  CommitID _refreshed_commit_id{0};
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
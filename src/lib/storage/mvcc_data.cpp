@@ -1,6 +1,9 @@
 #include "mvcc_data.hpp"
 
+#include <algorithm>
 #include <shared_mutex>
+#include <utility>
+#include <vector>
 
 #include "utils/assert.hpp"
 
@@ -17,23 +20,149 @@ void MvccData::shrink() {
 }
 
 void MvccData::grow_by(size_t delta, CommitID begin_cid) {
+  DebugAssert(!_is_compressed, "Compressed MVCC data cannot grow");
+
+  // The summary is updated first, so that the rows are never visible without being reflected in it
+  if (begin_cid == MAX_COMMIT_ID) {
+    _uncommitted_row_count += delta;
+  } else if (delta > 0) {
+    _raise_max_begin_cid(begin_cid);
+  }
+
   _size += delta;
   tids.grow_to_at_least(_size);
   begin_cids.grow_to_at_least(_size, begin_cid);
   end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
 }
 
+bool MvccData::is_fully_visible(const CommitID snapshot_commit_id) const {
+  // The uncommitted rows have to be checked first: Once an Insert has committed its last row, _max_begin_cid already
+  // includes its commit id
+  return _uncommitted_row_count == 0 && !_has_invalidated_rows && _max_begin_cid <= snapshot_commit_id;
+}
+
+void MvccData::register_committed_insert(const CommitID begin_cid) {
+  _raise_max_begin_cid(begin_cid);
+
+  DebugAssert(_uncommitted_row_count > 0, "Expected an uncommitted row");
+  --_uncommitted_row_count;
+}
+
+void MvccData::register_invalidation() { _has_invalidated_rows = true; }
+
+void MvccData::_raise_max_begin_cid(const CommitID begin_cid) {
+  auto max_begin_cid = _max_begin_cid.load();
+  while (max_begin_cid < begin_cid && !_max_begin_cid.compare_exchange_weak(max_begin_cid, begin_cid)) {
+  }
+}
+
+bool MvccData::is_compressed() const { return _is_compressed; }
+
+TransactionID MvccData::tid(const ChunkOffset chunk_offset) const {
+  if (!_is_compressed) return tids[chunk_offset].load();
+  const auto* const invalidated_row = _find_invalidated_row(chunk_offset);
+  return invalidated_row ? invalidated_row->tid : TransactionID{0};
+}
+
+CommitID MvccData::begin_cid(const ChunkOffset chunk_offset) const {
+  return _is_compressed ? _compressed_begin_cid : begin_cids[chunk_offset];
+}
+
+CommitID MvccData::end_cid(const ChunkOffset chunk_offset) const {
+  if (!_is_compressed) return end_cids[chunk_offset];
+  const auto* const invalidated_row = _find_invalidated_row(chunk_offset);
+  return invalidated_row ? invalidated_row->end_cid : MAX_COMMIT_ID;
+}
+
+CommitID MvccData::compressed_begin_cid() const {
+  DebugAssert(_is_compressed, "MVCC data is not compressed");
+  return _compressed_begin_cid;
+}
+
+const std::vector<MvccData::InvalidatedRow>& MvccData::invalidated_rows() const {
+  DebugAssert(_is_compressed, "MVCC data is not compressed");
+  return _invalidated_rows;
+}
+
+bool MvccData::_compress(const CommitID visibility_horizon) {
+  if (_is_compressed) return true;
+
+  // Rows that are uncommitted, locked by a running Delete, or changed after the horizon might still be seen
+  // differently by different transactions
+  auto max_begin_cid = CommitID{0};
+  auto invalidated_rows = std::vector<InvalidatedRow>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    const auto row_begin_cid = begin_cids[chunk_offset];
+    const auto row_end_cid = end_cids[chunk_offset];
+    const auto row_tid = tids[chunk_offset].load();
+    if (row_begin_cid > visibility_horizon) return false;
+    if (row_end_cid == MAX_COMMIT_ID) {
+      if (row_tid != 0) return false;
+      max_begin_cid = std::max(max_begin_cid, row_begin_cid);
+      continue;
+    }
+    if (row_end_cid > visibility_horizon) return false;
+    invalidated_rows.emplace_back(InvalidatedRow{chunk_offset, row_tid, row_end_cid});
+  }
+
+  _compressed_begin_cid = max_begin_cid;
+  _invalidated_rows = std::move(invalidated_rows);
+  _invalidated_rows.shrink_to_fit();
+
+  // Swapping with empty vectors releases the memory, unlike clear()
+  decltype(tids){}.swap(tids);
+  decltype(begin_cids){}.swap(begin_cids);
+  decltype(end_cids){}.swap(end_cids);
+  _is_compressed = true;
+  return true;
+}
+
+void MvccData::_decompress() {
+  if (!_is_compressed) return;
+
+  tids.grow_to_at_least(_size);
+  begin_cids.grow_to_at_least(_size, _compressed_begin_cid);
+  end_cids.grow_to_at_least(_size, MAX_COMMIT_ID);
+  for (const auto& invalidated_row : _invalidated_rows) {
+    tids[invalidated_row.chunk_offset] = invalidated_row.tid;
+    end_cids[invalidated_row.chunk_offset] = invalidated_row.end_cid;
+  }
+
+  _invalidated_rows = {};
+  _is_compressed = false;
+}
+
+const MvccData::InvalidatedRow* MvccData::_find_invalidated_row(const ChunkOffset chunk_offset) const {
+  const auto iter = std::lower_bound(_invalidated_rows.cbegin(), _invalidated_rows.cend(), chunk_offset,
+                                     [](const auto& row, const auto offset) { return row.chunk_offset < offset; });
+  if (iter == _invalidated_rows.cend() || iter->chunk_offset != chunk_offset) return nullptr;
+  return &*iter;
+}
+
+size_t MvccData::estimate_memory_usage() const {
+  auto bytes = sizeof(*this);
+  bytes += tids.size() * sizeof(decltype(tids)::value_type);
+  bytes += begin_cids.size() * sizeof(decltype(begin_cids)::value_type);
+  bytes += end_cids.size() * sizeof(decltype(end_cids)::value_type);
+  bytes += _invalidated_rows.capacity() * sizeof(InvalidatedRow);
+  return bytes;
+}
+
 void MvccData::print(std::ostream& stream) const {
   stream << "TIDs: ";
-  for (const auto& tid : tids) stream << tid << ", ";
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) stream << tid(chunk_offset) << ", ";
   stream << std::endl;
 
   stream << "BeginCIDs: ";
-  for (const auto& begin_cid : begin_cids) stream << begin_cid << ", ";
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    stream << begin_cid(chunk_offset) << ", ";
+  }
   stream << std::endl;
 
   stream << "EndCIDs: ";
-  for (const auto& end_cid : end_cids) stream << end_cid << ", ";
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _size; ++chunk_offset) {
+    stream << end_cid(chunk_offset) << ", ";
+  }
   stream << std::endl;
 }
 
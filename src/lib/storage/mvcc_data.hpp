@@ -2,6 +2,7 @@
 
 #include <atomic>
 #include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <vector>
 
 #include "types.hpp"
 #include "utils/copyable_atomic.hpp"
@@ -42,7 +43,69 @@ struct MvccData {
 
   void print(std::ostream& stream = std::cout) const;
 
+  size_t estimate_memory_usage() const;
+
+  /**
+   * @defgroup Summary of all rows
+   *
+   * Allows Validate to forward chunks without checking every row. It is maintained by grow_by() and by the operators
+   * that modify the MVCC data (Insert, Delete). It is conservative: rows that were added as uncommitted (i.e., with
+   * MAX_COMMIT_ID as begin_cid) and not committed by an Insert, as well as any locked or invalidated row, disable the
+   * shortcut for the entire chunk. Code that changes the vectors above directly does not update the summary.
+   * @{
+   */
+
+  // Whether all rows are visible to every transaction with the given snapshot, including transactions that modified
+  // the chunk themselves
+  bool is_fully_visible(const CommitID snapshot_commit_id) const;
+
+  // Called by Insert when it commits one of its uncommitted rows
+  void register_committed_insert(const CommitID begin_cid);
+
+  // Called when a row is locked for deletion or an insert is rolled back. Is never undone.
+  void register_invalidation();
+
+  /**@}*/
+
+  /**
+   * @defgroup Compressed representation of frozen chunks
+   *
+   * Once all changes to an immutable chunk are visible to every active and future transaction (see
+   * ChunkCompactionManager), per-row commit ids are no longer needed. Chunk::try_compress_mvcc_data() then replaces the
+   * vectors above with the largest begin_cid of the chunk and a sparse list of the invalidated rows. A compressed
+   * MvccData has empty vectors: Readers use the accessors below, which work on both representations. Writers get
+   * decompressed data from Chunk::get_scoped_mvcc_data_lock_for_writing(). The summary above is not changed.
+   * @{
+   */
+
+  struct InvalidatedRow {
+    ChunkOffset chunk_offset;
+    TransactionID tid;
+    CommitID end_cid;
+  };
+
+  bool is_compressed() const;
+
+  TransactionID tid(const ChunkOffset chunk_offset) const;
+  CommitID begin_cid(const ChunkOffset chunk_offset) const;
+  CommitID end_cid(const ChunkOffset chunk_offset) const;
+
+  // Only for compressed MVCC data: The begin_cid of all rows and the invalidated rows, sorted by their chunk offset
+  CommitID compressed_begin_cid() const;
+  const std::vector<InvalidatedRow>& invalidated_rows() const;
+
+  /**@}*/
+
  private:
+  void _raise_max_begin_cid(const CommitID begin_cid);
+
+  // Called by Chunk with the exclusive lock. Fails if a row was changed after @param visibility_horizon or is locked.
+  bool _compress(const CommitID visibility_horizon);
+  void _decompress();
+
+  // Points to the invalidated row at @param chunk_offset, or is nullptr if the row is valid
+  const InvalidatedRow* _find_invalidated_row(const ChunkOffset chunk_offset) const;
+
   /**
    * @brief Mutex used to manage access to MVCC data
    *
@@ -53,6 +116,16 @@ struct MvccData {
   std::shared_mutex _mutex;
 
   size_t _size{0};
+
+  // See is_fully_visible()
+  std::atomic<CommitID> _max_begin_cid{0};
+  std::atomic<size_t> _uncommitted_row_count{0};
+  std::atomic<bool> _has_invalidated_rows{false};
+
+  // See is_compressed()
+  bool _is_compressed{false};
+  CommitID _compressed_begin_cid{0};
+  std::vector<InvalidatedRow> _invalidated_rows;
 };
 
 }  // namespace opossum
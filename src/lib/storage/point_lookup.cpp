@@ -0,0 +1,187 @@
+#include "point_lookup.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+size_t PointLookupResult::row_count() const { return key_positions.size(); }
+
+const AllTypeVariant& PointLookupResult::value(const size_t row, const size_t column_index) const {
+  DebugAssert(row < row_count() && column_index < column_count, "Value out of range");
+  return values[row * column_count + column_index];
+}
+
+PointLookup::PointLookup(const std::shared_ptr<const Table>& table, const ColumnID key_column_id,
+                         const std::vector<ColumnID>& projected_column_ids)
+    : table(table), key_column_id(key_column_id), projected_column_ids(projected_column_ids) {
+  Assert(table->type() == TableType::Data, "PointLookup requires a table that stores its data");
+  Assert(key_column_id < table->column_count(), "Key column out of range");
+  for (const auto column_id : projected_column_ids) {
+    Assert(column_id < table->column_count(), "Projected column out of range");
+  }
+}
+
+PointLookupResult PointLookup::execute(const std::vector<AllTypeVariant>& keys,
+                                       const std::shared_ptr<TransactionContext>& transaction_context) const {
+  const auto has_mvcc = table->has_mvcc() == UseMvcc::Yes;
+  Assert(!has_mvcc || transaction_context, "PointLookup on a table with MVCC data requires a TransactionContext");
+
+  auto result = PointLookupResult{};
+  result.column_count = projected_column_ids.size();
+
+  // The indexes compare the keys with the values of their own type, so the keys are cast to the type of the column
+  auto typed_keys = std::vector<std::pair<AllTypeVariant, size_t>>{};
+  typed_keys.reserve(keys.size());
+  resolve_data_type(table->column_data_type(key_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    for (auto key_position = size_t{0}; key_position < keys.size(); ++key_position) {
+      if (variant_is_null(keys[key_position])) continue;
+      typed_keys.emplace_back(type_cast_variant<ColumnDataType>(keys[key_position]), key_position);
+    }
+  });
+  if (typed_keys.empty()) return result;
+
+  auto matches = std::vector<Match>{};
+  if (const auto table_index = table->get_table_index(key_column_id)) {
+    _probe_table_index(*table_index, typed_keys, matches);
+  } else {
+    _probe_chunks(typed_keys, matches);
+  }
+
+  if (has_mvcc) _validate(matches, *transaction_context);
+
+  std::sort(matches.begin(), matches.end(), [](const auto& lhs, const auto& rhs) {
+    return std::tie(lhs.key_position, lhs.row_id) < std::tie(rhs.key_position, rhs.row_id);
+  });
+
+  result.key_positions.reserve(matches.size());
+  result.values.reserve(matches.size() * projected_column_ids.size());
+  auto chunk = std::shared_ptr<const Chunk>{};
+  auto chunk_id = INVALID_CHUNK_ID;
+  for (const auto& match : matches) {
+    if (match.row_id.chunk_id != chunk_id) {
+      chunk_id = match.row_id.chunk_id;
+      chunk = table->get_chunk(chunk_id);
+    }
+    result.key_positions.emplace_back(match.key_position);
+    for (const auto column_id : projected_column_ids) {
+      result.values.emplace_back((*chunk->get_segment(column_id))[match.row_id.chunk_offset]);
+    }
+  }
+
+  return result;
+}
+
+void PointLookup::_probe_table_index(const BaseTableIndex& table_index,
+                                     const std::vector<std::pair<AllTypeVariant, size_t>>& keys,
+                                     std::vector<Match>& matches) const {
+  auto row_ids = PosList{};
+  for (const auto& [key, key_position] : keys) {
+    row_ids.clear();
+    table_index.append_matches(PredicateCondition::Equals, key, std::nullopt, row_ids);
+    for (const auto& row_id : row_ids) {
+      matches.emplace_back(Match{row_id, key_position});
+    }
+  }
+}
+
+void PointLookup::_probe_chunks(const std::vector<std::pair<AllTypeVariant, size_t>>& keys,
+                                std::vector<Match>& matches) const {
+  resolve_data_type(table->column_data_type(key_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // For scanning the chunks without a suitable index. Built when the first such chunk is found.
+    auto key_positions_by_value = std::unordered_map<ColumnDataType, std::vector<size_t>>{};
+
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+
+      const auto indexes = chunk->get_indices(std::vector<ColumnID>{key_column_id});
+      const auto index_it = std::find_if(indexes.cbegin(), indexes.cend(), [](const auto& index) {
+        return BaseIndex::supports(index->type(), PredicateCondition::Equals);
+      });
+
+      if (index_it != indexes.cend()) {
+        const auto& index = **index_it;
+        for (const auto& [key, key_position] : keys) {
+          const auto search_values = std::vector<AllTypeVariant>{key};
+          const auto end = index.upper_bound(search_values);
+          for (auto offset_it = index.lower_bound(search_values); offset_it != end; ++offset_it) {
+            matches.emplace_back(Match{RowID{chunk_id, *offset_it}, key_position});
+          }
+        }
+        continue;
+      }
+
+      if (key_positions_by_value.empty()) {
+        for (const auto& [key, key_position] : keys) {
+          key_positions_by_value[boost::get<ColumnDataType>(key)].emplace_back(key_position);
+        }
+      }
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(key_column_id), [&](const auto& position) {
+        if (position.is_null()) return;
+        const auto key_positions_it = key_positions_by_value.find(position.value());
+        if (key_positions_it == key_positions_by_value.end()) return;
+        for (const auto key_position : key_positions_it->second) {
+          matches.emplace_back(Match{RowID{chunk_id, position.chunk_offset()}, key_position});
+        }
+      });
+    }
+  });
+}
+
+void PointLookup::_validate(std::vector<Match>& matches, const TransactionContext& transaction_context) const {
+  const auto our_tid = transaction_context.transaction_id();
+  const auto snapshot_commit_id = transaction_context.snapshot_commit_id();
+
+  // Sorted by RowID, the MVCC data of each chunk is locked only once
+  std::sort(matches.begin(), matches.end(), [](const auto& lhs, const auto& rhs) { return lhs.row_id < rhs.row_id; });
+
+  auto visible_match_count = size_t{0};
+  for (auto chunk_begin = size_t{0}; chunk_begin < matches.size();) {
+    const auto chunk_id = matches[chunk_begin].row_id.chunk_id;
+    auto chunk_end = chunk_begin;
+    while (chunk_end < matches.size() && matches[chunk_end].row_id.chunk_id == chunk_id) ++chunk_end;
+
+    const auto chunk = table->get_chunk(chunk_id);
+
+    // All rows of a compacted chunk have been moved to other chunks before our snapshot was taken (see Validate)
+    const auto cleanup_commit_id = chunk->cleanup_commit_id();
+    if (!cleanup_commit_id || snapshot_commit_id < *cleanup_commit_id) {
+      const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+      const auto fully_visible = mvcc_data->is_fully_visible(snapshot_commit_id);
+      for (auto match_index = chunk_begin; match_index < chunk_end; ++match_index) {
+        const auto chunk_offset = matches[match_index].row_id.chunk_offset;
+        if (fully_visible ||
+            Validate::is_row_visible(our_tid, snapshot_commit_id, mvcc_data->tid(chunk_offset),
+                                     mvcc_data->begin_cid(chunk_offset), mvcc_data->end_cid(chunk_offset))) {
+          matches[visible_match_count++] = matches[match_index];
+        }
+      }
+    }
+
+    chunk_begin = chunk_end;
+  }
+
+  matches.resize(visible_match_count);
+}
+
+}  // namespace opossum
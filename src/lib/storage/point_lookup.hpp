@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseTableIndex;
+class Table;
+class TransactionContext;
+
+// The rows found by PointLookup::execute()
+struct PointLookupResult {
+  size_t row_count() const;
+
+  // Value of the projected column @param column_index (i.e., the position in the projected columns) of a row
+  const AllTypeVariant& value(const size_t row, const size_t column_index) const;
+
+  // The number of projected columns
+  size_t column_count{0};
+
+  // For each row, the position of the key it matches in the batch. The rows are ordered by it.
+  std::vector<size_t> key_positions;
+
+  // The values of the projected columns of all rows, row by row
+  std::vector<AllTypeVariant> values;
+};
+
+/**
+ * Answers batches of point lookups, i.e., `SELECT <projected columns> FROM <table> WHERE <key column> IN (<keys>)`,
+ * directly on the storage layer. For such queries, most of the time goes to parsing, translating, and optimizing the
+ * SQL and to setting up the operators. A PointLookup resolves the table and the columns once, and each call of
+ * execute() only probes the indexes, checks the visibility of the matches, and copies their values.
+ *
+ * The keys are looked up in the TableIndex of the key column if there is one (see Table::create_table_index()).
+ * Otherwise, each chunk is probed with one of its indexes on the key column that supports equality lookups, or
+ * scanned if it has none (e.g., the mutable last chunk). NULL keys do not match any row.
+ *
+ * For tables with MVCC data, only the rows visible to the transaction are returned, as the Validate operator would.
+ */
+class PointLookup {
+ public:
+  PointLookup(const std::shared_ptr<const Table>& table, const ColumnID key_column_id,
+              const std::vector<ColumnID>& projected_column_ids);
+
+  // Thread-safe, as long as the table is not modified other than by transactions
+  PointLookupResult execute(const std::vector<AllTypeVariant>& keys,
+                            const std::shared_ptr<TransactionContext>& transaction_context) const;
+
+  const std::shared_ptr<const Table> table;
+  const ColumnID key_column_id;
+  const std::vector<ColumnID> projected_column_ids;
+
+ private:
+  // A matching row and the position of its key in the batch
+  struct Match {
+    RowID row_id;
+    size_t key_position;
+  };
+
+  // Appends the matches of the keys, which are cast to the type of the key column and not NULL, to @param matches
+  void _probe_table_index(const BaseTableIndex& table_index, const std::vector<std::pair<AllTypeVariant, size_t>>& keys,
+                          std::vector<Match>& matches) const;
+  void _probe_chunks(const std::vector<std::pair<AllTypeVariant, size_t>>& keys, std::vector<Match>& matches) const;
+
+  // Removes the matches that are not visible to the transaction
+  void _validate(std::vector<Match>& matches, const TransactionContext& transaction_context) const;
+};
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#include "pos_list.hpp"
+
+#include <mutex>
+#include <utility>
+
+namespace opossum {
+
+void PosList::set_chunk_range(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end) {
+  DebugAssert(chunk_id != INVALID_CHUNK_ID && begin <= end, "Invalid chunk range");
+
+  clear();
+  Vector::shrink_to_fit();
+
+  _representation = Representation::Range;
+  _compact_chunk_id = chunk_id;
+  _compact_size = end - begin;
+  _range_begin = begin;
+  _range_end = end;
+  _materialized.store(false, std::memory_order_release);
+  _references_single_chunk = true;
+}
+
+bool PosList::compact(const ChunkOffset chunk_size) {
+  if (_representation != Representation::RowIDs) return true;
+  if (Vector::empty()) return false;
+
+  const auto& row_ids = static_cast<const Vector&>(*this);
+  const auto chunk_id = row_ids.front().chunk_id;
+  if (chunk_id == INVALID_CHUNK_ID) return false;
+
+  for (auto row_idx = size_t{1}; row_idx < row_ids.size(); ++row_idx) {
+    if (row_ids[row_idx].chunk_id != chunk_id || row_ids[row_idx].chunk_offset <= row_ids[row_idx - 1].chunk_offset) {
+      return false;
+    }
+  }
+
+  const auto begin = row_ids.front().chunk_offset;
+  const auto end = row_ids.back().chunk_offset + 1;
+  DebugAssert(end <= chunk_size, "PosList references offsets behind the end of the chunk");
+
+  // With ascending offsets and no duplicates, the offsets are contiguous iff the range has as many entries as the list
+  if (end - begin == row_ids.size()) {
+    set_chunk_range(chunk_id, begin, end);
+    return true;
+  }
+
+  const auto word_count = (static_cast<size_t>(chunk_size) + 63) / 64;
+  if (word_count * sizeof(uint64_t) >= row_ids.size() * sizeof(RowID)) return false;
+
+  auto bitmap = pmr_vector<uint64_t>(word_count, uint64_t{0}, get_allocator());
+  for (const auto& row_id : row_ids) {
+    bitmap[row_id.chunk_offset / 64] |= uint64_t{1} << (row_id.chunk_offset % 64);
+  }
+
+  const auto row_count = row_ids.size();
+
+  clear();
+  Vector::shrink_to_fit();
+
+  _representation = Representation::Bitmap;
+  _compact_chunk_id = chunk_id;
+  _compact_size = row_count;
+  _bitmap = std::move(bitmap);
+  _materialized.store(false, std::memory_order_release);
+  _references_single_chunk = true;
+
+  return true;
+}
+
+void PosList::_materialize() const {
+  std::lock_guard<std::mutex> lock(_materialize_mutex);
+  if (_materialized.load(std::memory_order_relaxed)) return;
+
+  // The vector acts as a cache of the compact representation here, so filling it does not change the PosList's
+  // logical contents. PosLists are not created as const objects, which makes the const_cast safe.
+  auto& row_ids = const_cast<Vector&>(static_cast<const Vector&>(*this));
+  row_ids.reserve(_compact_size);
+  for_each_row_id([&](const RowID& row_id) { row_ids.emplace_back(row_id); });
+
+  _materialized.store(true, std::memory_order_release);
+}
+
+void PosList::_reset_compact_representation() {
+  _representation = Representation::RowIDs;
+  _compact_chunk_id = INVALID_CHUNK_ID;
+  _compact_size = 0;
+  _range_begin = 0;
+  _range_end = 0;
+  _bitmap = pmr_vector<uint64_t>{get_allocator()};
+  _materialized.store(true, std::memory_order_release);
+}
+
+void PosList::_take_compact_representation(PosList& other) {
+  // The vector has already been moved by the caller
+  _references_single_chunk = other._references_single_chunk;
+  _representation = other._representation;
+  _compact_chunk_id = other._compact_chunk_id;
+  _compact_size = other._compact_size;
+  _range_begin = other._range_begin;
+  _range_end = other._range_end;
+  _bitmap = std::move(other._bitmap);
+  _materialized.store(other._materialized.load(std::memory_order_acquire), std::memory_order_release);
+
+  other._reset_compact_representation();
+}
+
+}  // namespace opossum
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -14,6 +17,17 @@ namespace opossum {
 // Inheriting from std::vector is generally not encouraged, because the STL containers are not prepared for
 // inheritance. By making the inheritance private and this class final, we can assure that the problems that come with
 // a non-virtual destructor do not occur.
+//
+// A PosList that references a single chunk in ascending order does not need to store its RowIDs. Scans that match
+// all or most rows of a chunk would otherwise allocate eight bytes per row. Instead, the PosList can be switched to a
+// compact representation (see `set_chunk_range` and `compact`):
+//   - Range:  All offsets from `begin` to `end` (exclusive) of one chunk
+//   - Bitmap: One bit per row of the chunk, set for the offsets that are part of the PosList
+// size(), empty(), and for_each_row_id() work on the compact representation directly, and consumers such as the
+// ReferenceSegmentIterable and split_pos_list_by_chunk_id check `representation()` to avoid materializing the RowIDs.
+// For everybody else, a compact PosList behaves as before: The const accessors (operator[], iterators, ...)
+// materialize the RowIDs on first use. This is thread-safe, so that a PosList can still be shared between segments
+// that are read concurrently. Non-const accessors and modifiers switch the PosList back to the RowID representation.
 
 struct PosList final : private pmr_vector<RowID> {
  public:
@@ -32,6 +46,8 @@ struct PosList final : private pmr_vector<RowID> {
   using reverse_iterator = Vector::reverse_iterator;
   using const_reverse_iterator = Vector::const_reverse_iterator;
 
+  enum class Representation { RowIDs, Range, Bitmap };
+
   /* (1 ) */ PosList() noexcept(noexcept(allocator_type())) {}
   /* (1 ) */ explicit PosList(const allocator_type& allocator) noexcept : Vector(allocator) {}
   /* (2 ) */ PosList(size_type count, const RowID& value, const allocator_type& alloc = allocator_type())
@@ -42,16 +58,20 @@ struct PosList final : private pmr_vector<RowID> {
       : Vector(std::move(first), std::move(last)) {}
   /* (5 ) */  // PosList(const Vector& other) : Vector(other); - Oh no, you don't.
   /* (5 ) */  // PosList(const Vector& other, const allocator_type& alloc) : Vector(other, alloc);
-  /* (6 ) */ PosList(PosList&& other) noexcept
-      : Vector(std::move(other)), _references_single_chunk{other._references_single_chunk} {}
+  /* (6 ) */ PosList(PosList&& other) noexcept : Vector(std::move(other)) { _take_compact_representation(other); }
   /* (6+) */ explicit PosList(Vector&& other) noexcept : Vector(std::move(other)) {}
-  /* (7 ) */ PosList(PosList&& other, const allocator_type& alloc)
-      : Vector(std::move(other), alloc), _references_single_chunk{other._references_single_chunk} {}
+  /* (7 ) */ PosList(PosList&& other, const allocator_type& alloc) : Vector(std::move(other), alloc) {
+    _take_compact_representation(other);
+  }
   /* (7+) */ PosList(Vector&& other, const allocator_type& alloc) : Vector(std::move(other), alloc) {}
   /* (8 ) */ PosList(std::initializer_list<RowID> init, const allocator_type& alloc = allocator_type())
       : Vector(std::move(init), alloc) {}
 
-  PosList& operator=(PosList&& other) = default;
+  PosList& operator=(PosList&& other) {
+    Vector::operator=(std::move(other));
+    _take_compact_representation(other);
+    return *this;
+  }
 
   // If all entries in the PosList shares a single ChunkID, it makes sense to explicitly give this guarantee in order
   // to enable some optimizations.
@@ -59,7 +79,7 @@ struct PosList final : private pmr_vector<RowID> {
 
   // Returns whether the single ChunkID has been given (not necessarily, if it has been met)
   bool references_single_chunk() const {
-    if (_references_single_chunk) {
+    if (_references_single_chunk && _representation == Representation::RowIDs) {
       DebugAssert(
           [&]() {
             if (size() == 0) return true;
@@ -77,66 +97,267 @@ struct PosList final : private pmr_vector<RowID> {
     DebugAssert(references_single_chunk(),
                 "Can only retrieve the common_chunk_id if the PosList is guaranteed to reference a single chunk.");
     Assert(!empty(), "Cannot retrieve common_chunk_id of an empty chunk");
+    if (_representation != Representation::RowIDs) return _compact_chunk_id;
     return (*this)[0].chunk_id;
   }
 
-  using Vector::assign;
+  // Compact representations
+
+  // Replaces the contents with the offsets from `begin` to `end` (exclusive) of the given chunk
+  void set_chunk_range(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end);
+
+  // Switches a PosList that references a single chunk with (strictly) ascending offsets to the range or bitmap
+  // representation if that takes less memory than the RowIDs. `chunk_size` is the size of the referenced chunk.
+  // Returns whether the PosList is compact afterwards.
+  bool compact(const ChunkOffset chunk_size);
+
+  Representation representation() const { return _representation; }
+
+  // For Representation::Range, the first offset and the offset behind the last one
+  std::pair<ChunkOffset, ChunkOffset> chunk_range() const {
+    DebugAssert(_representation == Representation::Range, "PosList is not a range");
+    return {_range_begin, _range_end};
+  }
+
+  // For Representation::Bitmap, one bit per offset of the referenced chunk, starting with the lowest bit of word 0
+  const pmr_vector<uint64_t>& chunk_bitmap() const {
+    DebugAssert(_representation == Representation::Bitmap, "PosList is not a bitmap");
+    return _bitmap;
+  }
+
+  // Returns whether the PosList references all rows of a chunk of the given size in their original order, so that it
+  // can be ignored when used as a position filter
+  bool references_entire_chunk(const ChunkOffset chunk_size) const {
+    return _representation == Representation::Range && _range_begin == 0 && _range_end == chunk_size;
+  }
+
+  // Calls `functor` for every RowID without materializing a compact PosList
+  template <typename Functor>
+  void for_each_row_id(const Functor& functor) const {
+    switch (_representation) {
+      case Representation::RowIDs:
+        for (const auto& row_id : static_cast<const Vector&>(*this)) functor(row_id);
+        break;
+
+      case Representation::Range:
+        for (auto chunk_offset = _range_begin; chunk_offset < _range_end; ++chunk_offset) {
+          functor(RowID{_compact_chunk_id, chunk_offset});
+        }
+        break;
+
+      case Representation::Bitmap:
+        for (auto word_idx = size_t{0}; word_idx < _bitmap.size(); ++word_idx) {
+          for (auto word = _bitmap[word_idx]; word != 0; word &= word - 1) {
+            const auto chunk_offset = static_cast<ChunkOffset>(word_idx * 64 + __builtin_ctzll(word));
+            functor(RowID{_compact_chunk_id, chunk_offset});
+          }
+        }
+        break;
+    }
+  }
+
+  size_t estimate_memory_usage() const {
+    return Vector::size() * sizeof(RowID) + _bitmap.size() * sizeof(decltype(_bitmap)::value_type);
+  }
+
   using Vector::get_allocator;
 
   // Element access
   // using Vector::at; - Oh no. People have misused this in the past.
-  using Vector::operator[];
-  using Vector::back;
-  using Vector::data;
-  using Vector::front;
+  const_reference operator[](size_type pos) const {
+    _ensure_materialized();
+    return Vector::operator[](pos);
+  }
+  reference operator[](size_type pos) {
+    _ensure_row_ids();
+    return Vector::operator[](pos);
+  }
+  const_reference back() const {
+    _ensure_materialized();
+    return Vector::back();
+  }
+  reference back() {
+    _ensure_row_ids();
+    return Vector::back();
+  }
+  const RowID* data() const {
+    _ensure_materialized();
+    return Vector::data();
+  }
+  RowID* data() {
+    _ensure_row_ids();
+    return Vector::data();
+  }
+  const_reference front() const {
+    _ensure_materialized();
+    return Vector::front();
+  }
+  reference front() {
+    _ensure_row_ids();
+    return Vector::front();
+  }
 
   // Iterators
-  using Vector::begin;
-  using Vector::cbegin;
-  using Vector::cend;
-  using Vector::crbegin;
-  using Vector::crend;
-  using Vector::end;
-  using Vector::rbegin;
-  using Vector::rend;
+  const_iterator begin() const { return cbegin(); }
+  iterator begin() {
+    _ensure_row_ids();
+    return Vector::begin();
+  }
+  const_iterator cbegin() const {
+    _ensure_materialized();
+    return Vector::cbegin();
+  }
+  const_iterator cend() const {
+    _ensure_materialized();
+    return Vector::cend();
+  }
+  const_reverse_iterator crbegin() const {
+    _ensure_materialized();
+    return Vector::crbegin();
+  }
+  const_reverse_iterator crend() const {
+    _ensure_materialized();
+    return Vector::crend();
+  }
+  const_iterator end() const { return cend(); }
+  iterator end() {
+    _ensure_row_ids();
+    return Vector::end();
+  }
+  const_reverse_iterator rbegin() const { return crbegin(); }
+  reverse_iterator rbegin() {
+    _ensure_row_ids();
+    return Vector::rbegin();
+  }
+  const_reverse_iterator rend() const { return crend(); }
+  reverse_iterator rend() {
+    _ensure_row_ids();
+    return Vector::rend();
+  }
 
   // Capacity
   using Vector::capacity;
-  using Vector::empty;
   using Vector::max_size;
   using Vector::reserve;
   using Vector::shrink_to_fit;
-  using Vector::size;
+  bool empty() const noexcept { return size() == 0; }
+  size_type size() const noexcept {
+    return _representation == Representation::RowIDs ? Vector::size() : _compact_size;
+  }
 
   // Modifiers
-  using Vector::clear;
-  using Vector::emplace;
-  using Vector::emplace_back;
-  using Vector::erase;
-  using Vector::insert;
-  using Vector::pop_back;
-  using Vector::push_back;
-  using Vector::resize;
-  using Vector::swap;
+  template <typename... Args>
+  void assign(Args&&... args) {
+    _ensure_row_ids();
+    Vector::assign(std::forward<Args>(args)...);
+  }
+  void assign(std::initializer_list<RowID> init) {
+    _ensure_row_ids();
+    Vector::assign(init);
+  }
+  void clear() {
+    _reset_compact_representation();
+    Vector::clear();
+  }
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    _ensure_row_ids();
+    return Vector::emplace(pos, std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  reference emplace_back(Args&&... args) {
+    _ensure_row_ids();
+    return Vector::emplace_back(std::forward<Args>(args)...);
+  }
+  iterator erase(const_iterator pos) {
+    _ensure_row_ids();
+    return Vector::erase(pos);
+  }
+  iterator erase(const_iterator first, const_iterator last) {
+    _ensure_row_ids();
+    return Vector::erase(first, last);
+  }
+  template <typename... Args>
+  iterator insert(const_iterator pos, Args&&... args) {
+    _ensure_row_ids();
+    return Vector::insert(pos, std::forward<Args>(args)...);
+  }
+  iterator insert(const_iterator pos, std::initializer_list<RowID> init) {
+    _ensure_row_ids();
+    return Vector::insert(pos, init);
+  }
+  void pop_back() {
+    _ensure_row_ids();
+    Vector::pop_back();
+  }
+  void push_back(const RowID& value) {
+    _ensure_row_ids();
+    Vector::push_back(value);
+  }
+  void push_back(RowID&& value) {
+    _ensure_row_ids();
+    Vector::push_back(std::move(value));
+  }
+  void resize(size_type count) {
+    _ensure_row_ids();
+    Vector::resize(count);
+  }
+  void resize(size_type count, const RowID& value) {
+    _ensure_row_ids();
+    Vector::resize(count, value);
+  }
+  void swap(PosList& other) {
+    auto tmp = std::move(other);
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
 
   friend bool operator==(const PosList& lhs, const PosList& rhs);
   friend bool operator==(const PosList& lhs, const pmr_vector<RowID>& rhs);
   friend bool operator==(const pmr_vector<RowID>& lhs, const PosList& rhs);
 
  private:
+  void _ensure_materialized() const {
+    if (!_materialized.load(std::memory_order_acquire)) _materialize();
+  }
+
+  // Called before the contents are modified
+  void _ensure_row_ids() {
+    if (_representation != Representation::RowIDs) {
+      _ensure_materialized();
+      _reset_compact_representation();
+    }
+  }
+
+  // Writes the RowIDs of a compact PosList into the vector
+  void _materialize() const;
+
+  void _reset_compact_representation();
+
+  void _take_compact_representation(PosList& other);
+
   bool _references_single_chunk = false;
+
+  Representation _representation = Representation::RowIDs;
+  ChunkID _compact_chunk_id{INVALID_CHUNK_ID};
+  size_t _compact_size{0};
+  ChunkOffset _range_begin{0};
+  ChunkOffset _range_end{0};
+  pmr_vector<uint64_t> _bitmap;
+
+  // Whether the vector holds the RowIDs. Always true for Representation::RowIDs.
+  mutable std::atomic_bool _materialized{true};
+  mutable std::mutex _materialize_mutex;
 };
 
 inline bool operator==(const PosList& lhs, const PosList& rhs) {
-  return static_cast<const pmr_vector<RowID>&>(lhs) == static_cast<const pmr_vector<RowID>&>(rhs);
+  return lhs.size() == rhs.size() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
 }
 
 inline bool operator==(const PosList& lhs, const pmr_vector<RowID>& rhs) {
-  return static_cast<const pmr_vector<RowID>&>(lhs) == rhs;
+  return lhs.size() == rhs.size() && std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin());
 }
 
-inline bool operator==(const pmr_vector<RowID>& lhs, const PosList& rhs) {
-  return lhs == static_cast<const pmr_vector<RowID>&>(rhs);
-}
+inline bool operator==(const pmr_vector<RowID>& lhs, const PosList& rhs) { return rhs == lhs; }
 
 }  // namespace opossum
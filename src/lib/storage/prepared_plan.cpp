@@ -57,7 +57,9 @@ PreparedPlan::PreparedPlan(const std::shared_ptr<AbstractLQPNode>& lqp, const st
 
 std::shared_ptr<PreparedPlan> PreparedPlan::deep_copy() const {
   const auto lqp_copy = lqp->deep_copy();
-  return std::make_shared<PreparedPlan>(lqp_copy, parameter_ids);
+  auto prepared_plan_copy = std::make_shared<PreparedPlan>(lqp_copy, parameter_ids);
+  prepared_plan_copy->is_optimized = is_optimized;
+  return prepared_plan_copy;
 }
 
 void PreparedPlan::print(std::ostream& stream) const {
@@ -91,7 +93,7 @@ std::shared_ptr<AbstractLQPNode> PreparedPlan::instantiate(
 }
 
 bool PreparedPlan::operator==(const PreparedPlan& rhs) const {
-  return *lqp == *rhs.lqp && parameter_ids == rhs.parameter_ids;
+  return *lqp == *rhs.lqp && parameter_ids == rhs.parameter_ids && is_optimized == rhs.is_optimized;
 }
 
 }  // namespace opossum
@@ -32,6 +32,11 @@ class PreparedPlan final {
 
   std::shared_ptr<AbstractLQPNode> lqp;
   std::vector<ParameterID> parameter_ids;
+
+  // Set if the lqp was optimized before its placeholders are filled in. This is only done if the placeholders do not
+  // influence the structure of the plan (see placeholders_are_scan_values()), so that a physical plan created once can
+  // be executed with all parameter values.
+  bool is_optimized = false;
 };
 
 }  // namespace opossum
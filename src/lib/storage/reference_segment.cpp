@@ -30,7 +30,10 @@ ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table>& reference
 const AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
 
-  const auto row_id = (*_pos_list)[chunk_offset];
+  // Avoid materializing a compact PosList only to access a single row
+  const auto row_id = _pos_list->representation() == PosList::Representation::Range
+                          ? RowID{_pos_list->common_chunk_id(), _pos_list->chunk_range().first + chunk_offset}
+                          : (*_pos_list)[chunk_offset];
 
   if (row_id.is_null()) return NULL_VALUE;
 
@@ -52,7 +55,7 @@ std::shared_ptr<BaseSegment> ReferenceSegment::copy_using_allocator(const Polymo
 }
 
 size_t ReferenceSegment::estimate_memory_usage() const {
-  return sizeof(*this) + _pos_list->size() * sizeof(decltype(_pos_list)::element_type::value_type);
+  return sizeof(*this) + _pos_list->estimate_memory_usage();
 }
 
 }  // namespace opossum
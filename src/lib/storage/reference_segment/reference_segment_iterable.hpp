@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <utility>
@@ -8,16 +10,56 @@
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterables.hpp"
+#include "storage/split_pos_list_by_chunk_id.hpp"
 
 namespace opossum {
 
+/**
+ * Iterating over a ReferenceSegment reads a value per RowID, each of which is likely a cache miss if the PosList is not
+ * sorted, e.g., after a join. The iterators therefore prefetch the value PREFETCH_DISTANCE positions ahead of the one
+ * they read (see BaseSegmentAccessor::prefetch), so that the cache misses overlap.
+ *
+ * Materializing a ReferenceSegment that references multiple chunks is additionally batched by chunk: The PosList is
+ * split with split_pos_list_by_chunk_id, so that each referenced segment is resolved once and read through a
+ * non-virtual accessor, and the values are written to their original positions.
+ */
 template <typename T>
 class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable<T>> {
  public:
   using ValueType = T;
 
+  // Number of positions between the value that is prefetched and the one that is read. Large enough to cover the
+  // memory latency with the work of the positions in between, small enough for the prefetched lines to stay cached.
+  static constexpr auto PREFETCH_DISTANCE = size_t{16};
+
   explicit ReferenceSegmentIterable(const ReferenceSegment& segment) : _segment{segment} {}
 
+  template <typename Container>
+  void materialize_values(Container& container) const {
+    if (!_gathers_by_chunk()) {
+      SegmentIterable<ReferenceSegmentIterable<T>>::materialize_values(container);
+      return;
+    }
+
+    const auto index = container.size();
+    container.resize(index + _segment.size());
+    _gather_by_chunk([&](const size_t position, const T& value, const bool) { container[index + position] = value; });
+  }
+
+  template <typename Container>
+  void materialize_values_and_nulls(Container& container) const {
+    if (!_gathers_by_chunk()) {
+      SegmentIterable<ReferenceSegmentIterable<T>>::materialize_values_and_nulls(container);
+      return;
+    }
+
+    const auto index = container.size();
+    container.resize(index + _segment.size());
+    _gather_by_chunk([&](const size_t position, const T& value, const bool is_null) {
+      container[index + position] = std::make_pair(is_null, value);
+    });
+  }
+
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
     const auto referenced_table = _segment.referenced_table();
@@ -25,31 +67,57 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 
     const auto& pos_list = *_segment.pos_list();
 
+    // Compact PosLists (see pos_list.hpp) reference a single chunk as well. Their chunk offsets are taken from the
+    // range or bitmap, so that the RowIDs do not have to be materialized.
+    if (pos_list.representation() != PosList::Representation::RowIDs && !pos_list.empty()) {
+      const auto epoch_guard = EpochGuard{};
+      const auto& referenced_segment =
+          referenced_table->get_chunk(pos_list.common_chunk_id())->get_pinned_segment(referenced_column_id);
+      resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
+        using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+        if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
+          auto accessor = SegmentAccessor<T, SegmentType>(typed_segment);
+
+          auto begin = CompactChunkIterator<decltype(accessor)>{accessor, pos_list, ChunkOffset{0}};
+          auto end = CompactChunkIterator<decltype(accessor)>{accessor, pos_list,
+                                                              static_cast<ChunkOffset>(pos_list.size())};
+          functor(begin, end);
+        } else {
+          Fail("Found ReferenceSegment pointing to ReferenceSegment");
+        }
+      });
+      return;
+    }
+
     const auto begin_it = pos_list.begin();
     const auto end_it = pos_list.end();
 
     // If we are guaranteed that the reference segment refers to a single chunk, we can do some optimizations.
     // For example, we can use a single, non-virtual segment accessor instead of having to keep multiple and using
-    // virtual method calls.
+    // virtual method calls. The referenced segment is read without copying its shared_ptr, so the epoch is pinned
+    // until the functor returns.
 
     if (pos_list.references_single_chunk() && pos_list.size() > 0) {
-      auto referenced_segment = referenced_table->get_chunk(begin_it->chunk_id)->get_segment(referenced_column_id);
-      resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_segment) {
+      const auto epoch_guard = EpochGuard{};
+      const auto& referenced_segment =
+          referenced_table->get_chunk(begin_it->chunk_id)->get_pinned_segment(referenced_column_id);
+      resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
         using SegmentType = std::decay_t<decltype(typed_segment)>;
 
         if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
           auto accessor = SegmentAccessor<T, SegmentType>(typed_segment);
 
-          auto begin = SingleChunkIterator<decltype(accessor)>{accessor, begin_it, begin_it};
-          auto end = SingleChunkIterator<decltype(accessor)>{accessor, begin_it, end_it};
+          auto begin = SingleChunkIterator<decltype(accessor)>{accessor, begin_it, begin_it, end_it};
+          auto end = SingleChunkIterator<decltype(accessor)>{accessor, begin_it, end_it, end_it};
           functor(begin, end);
         } else {
           Fail("Found ReferenceSegment pointing to ReferenceSegment");
         }
       });
     } else {
-      auto begin = MultipleChunkIterator{referenced_table, referenced_column_id, begin_it, begin_it};
-      auto end = MultipleChunkIterator{referenced_table, referenced_column_id, begin_it, end_it};
+      auto begin = MultipleChunkIterator{referenced_table, referenced_column_id, begin_it, begin_it, end_it};
+      auto end = MultipleChunkIterator{referenced_table, referenced_column_id, begin_it, end_it, end_it};
       functor(begin, end);
     }
   }
@@ -57,6 +125,63 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
   size_t _on_size() const { return _segment.size(); }
 
  private:
+  // Compact and single-chunk PosLists are materialized by the iterators, which read from a single accessor anyway
+  bool _gathers_by_chunk() const {
+    const auto& pos_list = *_segment.pos_list();
+    return pos_list.representation() == PosList::Representation::RowIDs && !pos_list.references_single_chunk() &&
+           !pos_list.empty();
+  }
+
+  // Calls @param write with the position in the PosList, the value, and whether it is NULL for each position
+  template <typename Write>
+  void _gather_by_chunk(const Write& write) const {
+    const auto& referenced_table = _segment.referenced_table();
+    const auto referenced_column_id = _segment.referenced_column_id();
+    const auto& pos_list = _segment.pos_list();
+
+    // NULL RowIDs, e.g., from outer joins, are not part of any of the split PosLists
+    auto position = size_t{0};
+    for (const auto& row_id : *pos_list) {
+      if (row_id.is_null()) write(position, T{}, true);
+      ++position;
+    }
+
+    const auto chunk_count = referenced_table->chunk_count();
+    const auto sub_pos_lists = split_pos_list_by_chunk_id(pos_list, chunk_count);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto& sub_pos_list = sub_pos_lists[chunk_id];
+      const auto& row_ids = *sub_pos_list.row_ids;
+      if (row_ids.empty()) continue;
+
+      const auto epoch_guard = EpochGuard{};
+      const auto& referenced_segment = referenced_table->get_chunk(chunk_id)->get_pinned_segment(referenced_column_id);
+      resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
+        using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+        if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
+          const auto accessor = SegmentAccessor<T, SegmentType>(typed_segment);
+
+          const auto row_count = row_ids.size();
+          for (auto sub_position = size_t{0}; sub_position < row_count; ++sub_position) {
+            if (sub_position + PREFETCH_DISTANCE < row_count) {
+              accessor.prefetch(row_ids[sub_position + PREFETCH_DISTANCE].chunk_offset);
+            }
+
+            const auto typed_value = accessor.access(row_ids[sub_position].chunk_offset);
+            if (typed_value) {
+              write(sub_pos_list.original_positions[sub_position], *typed_value, false);
+            } else {
+              write(sub_pos_list.original_positions[sub_position], T{}, true);
+            }
+          }
+        } else {
+          Fail("Found ReferenceSegment pointing to ReferenceSegment");
+        }
+      });
+    }
+  }
+
   const ReferenceSegment& _segment;
 
  private:
@@ -70,13 +195,32 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 
    public:
     explicit SingleChunkIterator(const Accessor& accessor, const PosListIterator& begin_pos_list_it,
-                                 const PosListIterator& pos_list_it)
-        : _begin_pos_list_it{begin_pos_list_it}, _pos_list_it{pos_list_it}, _accessor{accessor} {}
+                                 const PosListIterator& pos_list_it, const PosListIterator& end_pos_list_it)
+        : _begin_pos_list_it{begin_pos_list_it},
+          _pos_list_it{pos_list_it},
+          _end_pos_list_it{end_pos_list_it},
+          _accessor{accessor} {
+      // The first positions are read before any of them could have been prefetched by increment()
+      const auto prefetch_count =
+          std::min(_end_pos_list_it - _pos_list_it, static_cast<std::ptrdiff_t>(PREFETCH_DISTANCE));
+      for (auto prefetch_it = _pos_list_it; prefetch_it != _pos_list_it + prefetch_count; ++prefetch_it) {
+        _prefetch(*prefetch_it);
+      }
+    }
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_pos_list_it; }
+    void increment() {
+      ++_pos_list_it;
+      if (_end_pos_list_it - _pos_list_it > static_cast<std::ptrdiff_t>(PREFETCH_DISTANCE)) {
+        _prefetch(_pos_list_it[PREFETCH_DISTANCE]);
+      }
+    }
+
+    void _prefetch(const RowID& row_id) const {
+      if (!row_id.is_null()) _accessor.prefetch(row_id.chunk_offset);
+    }
 
     bool equal(const SingleChunkIterator& other) const { return _pos_list_it == other._pos_list_it; }
 
@@ -100,6 +244,65 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
    private:
     const PosListIterator _begin_pos_list_it;
     PosListIterator _pos_list_it;
+    const PosListIterator _end_pos_list_it;
+
+    const Accessor _accessor;
+  };
+
+  // The iterator for compact PosLists, which walks the offsets of the referenced chunk's range or bitmap
+  template <typename Accessor>
+  class CompactChunkIterator : public BaseSegmentIterator<CompactChunkIterator<Accessor>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = ReferenceSegmentIterable<T>;
+
+   public:
+    explicit CompactChunkIterator(const Accessor& accessor, const PosList& pos_list, const ChunkOffset position)
+        : _bitmap{pos_list.representation() == PosList::Representation::Bitmap ? &pos_list.chunk_bitmap() : nullptr},
+          _position{position},
+          _accessor{accessor} {
+      // Only the begin iterator needs to know its chunk offset, the end iterator is compared by position
+      if (position == 0) _chunk_offset = _bitmap ? _next_set_bit(0) : pos_list.chunk_range().first;
+    }
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_position;
+      _chunk_offset = _bitmap ? _next_set_bit(_chunk_offset + 1) : _chunk_offset + 1;
+    }
+
+    bool equal(const CompactChunkIterator& other) const { return _position == other._position; }
+
+    SegmentPosition<T> dereference() const {
+      const auto typed_value = _accessor.access(_chunk_offset);
+
+      if (typed_value) {
+        return SegmentPosition<T>{std::move(*typed_value), false, _position};
+      } else {
+        return SegmentPosition<T>{T{}, true, _position};
+      }
+    }
+
+    // Returns the first offset at or behind `chunk_offset` that is set in the bitmap, or the bitmap's size in bits
+    ChunkOffset _next_set_bit(const ChunkOffset chunk_offset) const {
+      auto word_idx = size_t{chunk_offset / 64};
+      if (word_idx >= _bitmap->size()) return static_cast<ChunkOffset>(_bitmap->size() * 64);
+
+      auto word = (*_bitmap)[word_idx] & (~uint64_t{0} << (chunk_offset % 64));
+      while (word == 0) {
+        if (++word_idx == _bitmap->size()) return static_cast<ChunkOffset>(word_idx * 64);
+        word = (*_bitmap)[word_idx];
+      }
+
+      return static_cast<ChunkOffset>(word_idx * 64 + __builtin_ctzll(word));
+    }
+
+   private:
+    const pmr_vector<uint64_t>* _bitmap;
+    ChunkOffset _chunk_offset{INVALID_CHUNK_OFFSET};
+    ChunkOffset _position;
 
     const Accessor _accessor;
   };
@@ -114,17 +317,41 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
    public:
     explicit MultipleChunkIterator(const std::shared_ptr<const Table>& referenced_table,
                                    const ColumnID referenced_column_id, const PosListIterator& begin_pos_list_it,
-                                   const PosListIterator& pos_list_it)
+                                   const PosListIterator& pos_list_it, const PosListIterator& end_pos_list_it)
         : _referenced_table{referenced_table},
           _referenced_column_id{referenced_column_id},
           _begin_pos_list_it{begin_pos_list_it},
           _pos_list_it{pos_list_it},
-          _accessors{_referenced_table->chunk_count()} {}
+          _end_pos_list_it{end_pos_list_it},
+          _accessors{_referenced_table->chunk_count()} {
+      // The end iterator is never dereferenced, so it does not create any accessors
+      if (_pos_list_it == _end_pos_list_it) return;
+
+      const auto prefetch_count =
+          std::min(_end_pos_list_it - _pos_list_it, static_cast<std::ptrdiff_t>(PREFETCH_DISTANCE));
+      for (auto prefetch_it = _pos_list_it; prefetch_it != _pos_list_it + prefetch_count; ++prefetch_it) {
+        _prefetch(*prefetch_it);
+      }
+    }
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_pos_list_it; }
+    void increment() {
+      ++_pos_list_it;
+      if (_end_pos_list_it - _pos_list_it > static_cast<std::ptrdiff_t>(PREFETCH_DISTANCE)) {
+        _prefetch(_pos_list_it[PREFETCH_DISTANCE]);
+      }
+    }
+
+    void _prefetch(const RowID& row_id) const {
+      if (row_id.is_null()) return;
+
+      if (!_accessors[row_id.chunk_id]) {
+        _create_accessor(row_id.chunk_id);
+      }
+      _accessors[row_id.chunk_id]->prefetch(row_id.chunk_offset);
+    }
 
     bool equal(const MultipleChunkIterator& other) const { return _pos_list_it == other._pos_list_it; }
 
@@ -162,6 +389,7 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 
     const PosListIterator _begin_pos_list_it;
     PosListIterator _pos_list_it;
+    const PosListIterator _end_pos_list_it;
 
     mutable std::vector<std::shared_ptr<BaseSegmentAccessor<T>>> _accessors;
   };
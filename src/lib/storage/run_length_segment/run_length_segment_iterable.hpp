@@ -17,6 +17,8 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
+    _segment.access_statistics().on_sequential_scan(_segment.size());
+
     auto begin =
         Iterator{_segment.values()->cbegin(), _segment.null_values()->cbegin(), _segment.end_positions()->cbegin(), 0u};
     auto end = Iterator{_segment.values()->cend(), _segment.null_values()->cend(), _segment.end_positions()->cend(),
@@ -27,6 +29,8 @@ class RunLengthSegmentIterable : public PointAccessibleSegmentIterable<RunLength
 
   template <typename Functor>
   void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
+    _segment.access_statistics().on_point_access(position_filter->size());
+
     auto begin = PointAccessIterator{*_segment.values(), *_segment.null_values(), *_segment.end_positions(),
                                      position_filter->cbegin(), position_filter->cbegin()};
     auto end = PointAccessIterator{*_segment.values(), *_segment.null_values(), *_segment.end_positions(),
@@ -0,0 +1,82 @@
+#include "segment_access_statistics.hpp"
+
+#include <memory>
+#include <string>
+
+#include "constant_mappings.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+void SegmentAccessStatistics::reset() {
+  _sequential_scan_count = 0;
+  _sequential_row_count = 0;
+  _point_access_count = 0;
+  for (auto& predicate_count : _predicate_counts) predicate_count = 0;
+}
+
+std::string SegmentAccessStatistics::predicates_to_string() const {
+  auto predicates = std::string{};
+  for (auto predicate_condition_id = size_t{0}; predicate_condition_id < PREDICATE_CONDITION_COUNT;
+       ++predicate_condition_id) {
+    const auto predicate_condition = static_cast<PredicateCondition>(predicate_condition_id);
+    const auto count = predicate_count(predicate_condition);
+    if (count == 0) continue;
+
+    if (!predicates.empty()) predicates += ",";
+    predicates += predicate_condition_to_string.left.at(predicate_condition) + ":" + std::to_string(count);
+  }
+  return predicates;
+}
+
+std::shared_ptr<Table> SegmentAccessStatistics::to_table() {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"table_name", DataType::String},
+                                                              {"chunk_id", DataType::Int},
+                                                              {"column_id", DataType::Int},
+                                                              {"column_name", DataType::String},
+                                                              {"encoding", DataType::String},
+                                                              {"sequential_scans", DataType::Long},
+                                                              {"sequential_rows", DataType::Long},
+                                                              {"point_accesses", DataType::Long},
+                                                              {"predicates", DataType::String}},
+                                       TableType::Data);
+
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+      const auto chunk = stored_table->get_chunk(chunk_id);
+      for (auto column_id = ColumnID{0}; column_id < stored_table->column_count(); ++column_id) {
+        const auto segment = chunk->get_segment(column_id);
+        const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(segment);
+        const auto encoding = encoded_segment ? encoded_segment->encoding_type() : EncodingType::Unencoded;
+        const auto& statistics = segment->access_statistics();
+
+        table->append({AllTypeVariant{table_name}, AllTypeVariant{static_cast<int32_t>(chunk_id)},
+                       AllTypeVariant{static_cast<int32_t>(column_id)},
+                       AllTypeVariant{stored_table->column_name(column_id)},
+                       AllTypeVariant{encoding_type_to_string.left.at(encoding)},
+                       AllTypeVariant{static_cast<int64_t>(statistics.sequential_scan_count())},
+                       AllTypeVariant{static_cast<int64_t>(statistics.sequential_row_count())},
+                       AllTypeVariant{static_cast<int64_t>(statistics.point_access_count())},
+                       AllTypeVariant{statistics.predicates_to_string()}});
+      }
+    }
+  }
+
+  return table;
+}
+
+void SegmentAccessStatistics::reset_all() {
+  for (const auto& [table_name, stored_table] : StorageManager::get().tables()) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < stored_table->chunk_count(); ++chunk_id) {
+      const auto chunk = stored_table->get_chunk(chunk_id);
+      for (auto column_id = ColumnID{0}; column_id < stored_table->column_count(); ++column_id) {
+        chunk->get_segment(column_id)->access_statistics().reset();
+      }
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Counts how a segment is read, so that its encoding and its placement (see ChunkTieringManager) can be chosen by how
+ * it is used rather than by its data alone. The statistics are always collected, which is why they are counted where
+ * it costs the least:
+ *
+ *   sequential scans    Counted once per iteration over all values of the segment by its iterable. The rows of
+ *                       these iterations are counted as well.
+ *   point accesses      Values read at given positions, e.g., through a ReferenceSegment or by the SegmentAccessor of
+ *                       a join. The iterables count a filtered iteration once with the size of the PosList, the
+ *                       SegmentAccessors count their accesses in a member and add them when they are destroyed.
+ *   predicates          Counted once per segment a single-column TableScan scans, by the PredicateCondition
+ *
+ * The counters are relaxed atomics, as they do not order any other memory accesses.
+ */
+class SegmentAccessStatistics {
+ public:
+  static constexpr auto PREDICATE_CONDITION_COUNT = static_cast<size_t>(PredicateCondition::IsNotNull) + 1;
+
+  void on_sequential_scan(const size_t row_count) {
+    _sequential_scan_count.fetch_add(1, std::memory_order_relaxed);
+    _sequential_row_count.fetch_add(row_count, std::memory_order_relaxed);
+  }
+
+  void on_point_access(const size_t access_count) {
+    _point_access_count.fetch_add(access_count, std::memory_order_relaxed);
+  }
+
+  void on_predicate(const PredicateCondition predicate_condition) {
+    _predicate_counts[static_cast<size_t>(predicate_condition)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  uint64_t sequential_scan_count() const { return _sequential_scan_count.load(std::memory_order_relaxed); }
+  uint64_t sequential_row_count() const { return _sequential_row_count.load(std::memory_order_relaxed); }
+  uint64_t point_access_count() const { return _point_access_count.load(std::memory_order_relaxed); }
+  uint64_t predicate_count(const PredicateCondition predicate_condition) const {
+    return _predicate_counts[static_cast<size_t>(predicate_condition)].load(std::memory_order_relaxed);
+  }
+
+  void reset();
+
+  // The predicates that were counted, e.g., "=:12,<:3", ordered by PredicateCondition
+  std::string predicates_to_string() const;
+
+  /**
+   * One row per segment of the tables in the StorageManager, with the columns table_name, chunk_id, column_id,
+   * column_name, encoding, sequential_scans, sequential_rows, point_accesses, and predicates. Returned by
+   * `SHOW ACCESS STATISTICS` and meant to be read by plugins that choose encodings or tiers.
+   */
+  static std::shared_ptr<Table> to_table();
+
+  // Resets the statistics of all segments of the tables in the StorageManager
+  static void reset_all();
+
+ private:
+  std::atomic<uint64_t> _sequential_scan_count{0};
+  std::atomic<uint64_t> _sequential_row_count{0};
+  std::atomic<uint64_t> _point_access_count{0};
+  std::array<std::atomic<uint64_t>, PREDICATE_CONDITION_COUNT> _predicate_counts{};
+};
+
+}  // namespace opossum
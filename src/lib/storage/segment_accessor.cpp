@@ -6,8 +6,13 @@ namespace detail {
 template <typename T>
 std::unique_ptr<BaseSegmentAccessor<T>> CreateSegmentAccessor<T>::create(
     const std::shared_ptr<const BaseSegment>& segment) {
+  return create(*segment);
+}
+
+template <typename T>
+std::unique_ptr<BaseSegmentAccessor<T>> CreateSegmentAccessor<T>::create(const BaseSegment& segment) {
   std::unique_ptr<BaseSegmentAccessor<T>> accessor;
-  resolve_segment_type<T>(*segment, [&](const auto& typed_segment) {
+  resolve_segment_type<T>(segment, [&](const auto& typed_segment) {
     using SegmentType = std::decay_t<decltype(typed_segment)>;
     if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
       if (typed_segment.pos_list()->references_single_chunk() && typed_segment.pos_list()->size() > 0) {
@@ -5,8 +5,10 @@
 #include <type_traits>
 
 #include "resolve_type.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/base_segment_accessor.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "types.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -20,6 +22,7 @@ template <typename T>
 class CreateSegmentAccessor {
  public:
   static std::unique_ptr<BaseSegmentAccessor<T>> create(const std::shared_ptr<const BaseSegment>& segment);
+  static std::unique_ptr<BaseSegmentAccessor<T>> create(const BaseSegment& segment);
 };
 
 }  // namespace detail
@@ -38,16 +41,74 @@ std::unique_ptr<BaseSegmentAccessor<T>> create_segment_accessor(const std::share
  *
  *   const std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
  *
+ * The accesses are counted as point accesses of the segment (see SegmentAccessStatistics). So that the hot path does
+ * not touch an atomic, they are added to the statistics only when the accessor is destroyed. Copies, e.g., those held
+ * by the iterators of the ReferenceSegmentIterable, only count their own accesses.
+ *
+ * prefetch() is supported for ValueSegments and for dictionary segments with an uncompressed or byte-aligned
+ * attribute vector, as the position of their values follows from the offset. The dictionary lookup itself depends on
+ * the value id and is not prefetched, but dictionaries are usually small enough to stay in the cache.
  */
 template <typename T, typename SegmentType>
 class SegmentAccessor : public BaseSegmentAccessor<T> {
  public:
-  explicit SegmentAccessor(const SegmentType& segment) : BaseSegmentAccessor<T>{}, _segment{segment} {}
+  explicit SegmentAccessor(const SegmentType& segment) : BaseSegmentAccessor<T>{}, _segment{segment} {
+    _init_prefetching();
+  }
 
-  const std::optional<T> access(ChunkOffset offset) const final { return _segment.get_typed_value(offset); }
+  SegmentAccessor(const SegmentAccessor& other) : BaseSegmentAccessor<T>{}, _segment{other._segment} {
+    _init_prefetching();
+  }
+
+  ~SegmentAccessor() override {
+    if (_access_count > 0) _segment.access_statistics().on_point_access(_access_count);
+  }
+
+  const std::optional<T> access(ChunkOffset offset) const final {
+    ++_access_count;
+    return _segment.get_typed_value(offset);
+  }
+
+  void prefetch(ChunkOffset offset) const final {
+    if constexpr (std::is_same_v<SegmentType, ValueSegment<T>>) {
+      __builtin_prefetch(&_segment.values()[offset]);
+    } else {
+      if (_prefetch_base) __builtin_prefetch(_prefetch_base + offset * _prefetch_stride);
+    }
+  }
 
  protected:
+  void _init_prefetching() {
+    if constexpr (std::is_base_of_v<BaseDictionarySegment, SegmentType>) {
+      const auto& attribute_vector = *_segment.attribute_vector();
+      switch (attribute_vector.type()) {
+        case CompressedVectorType::FixedSize4ByteAligned:
+          _set_prefetch_base(static_cast<const FixedSizeByteAlignedVector<uint32_t>&>(attribute_vector).data());
+          break;
+        case CompressedVectorType::FixedSize2ByteAligned:
+          _set_prefetch_base(static_cast<const FixedSizeByteAlignedVector<uint16_t>&>(attribute_vector).data());
+          break;
+        case CompressedVectorType::FixedSize1ByteAligned:
+          _set_prefetch_base(static_cast<const FixedSizeByteAlignedVector<uint8_t>&>(attribute_vector).data());
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  template <typename Data>
+  void _set_prefetch_base(const Data& data) {
+    _prefetch_base = reinterpret_cast<const char*>(data.data());
+    _prefetch_stride = sizeof(typename Data::value_type);
+  }
+
   const SegmentType& _segment;
+  mutable size_t _access_count{0};
+
+  // Start and element size of the data that an access reads first, if the segment's layout is known
+  const char* _prefetch_base{nullptr};
+  size_t _prefetch_stride{0};
 };
 
 /**
@@ -84,12 +145,16 @@ class SingleChunkReferenceSegmentAccessor : public BaseSegmentAccessor<T> {
  public:
   explicit SingleChunkReferenceSegmentAccessor(const ReferenceSegment& segment)
       : _segment{segment},
-        _chunk_id((*_segment.pos_list())[ChunkOffset{0}].chunk_id),
+        _chunk_id(_segment.pos_list()->common_chunk_id()),
         _accessor{create_segment_accessor<T>(
             segment.referenced_table()->get_chunk(_chunk_id)->get_segment(_segment.referenced_column_id()))} {}
 
   const std::optional<T> access(ChunkOffset offset) const final {
-    const auto referenced_chunk_offset = (*_segment.pos_list())[offset].chunk_offset;
+    const auto& pos_list = *_segment.pos_list();
+    // Ranges are resolved without materializing the PosList
+    const auto referenced_chunk_offset = pos_list.representation() == PosList::Representation::Range
+                                             ? pos_list.chunk_range().first + offset
+                                             : pos_list[offset].chunk_offset;
 
     return _accessor->access(referenced_chunk_offset);
   }
@@ -100,4 +165,80 @@ class SingleChunkReferenceSegmentAccessor : public BaseSegmentAccessor<T> {
   const std::unique_ptr<BaseSegmentAccessor<T>> _accessor;
 };
 
+// Accessor for ReferenceSegments that reference a single chunk whose segment type is known (see
+// segment_with_accessor()). Unlike the SingleChunkReferenceSegmentAccessor, it reads the referenced segment without a
+// virtual call.
+template <typename T, typename ReferencedSegmentType>
+class ResolvedSingleChunkReferenceSegmentAccessor : public BaseSegmentAccessor<T> {
+ public:
+  ResolvedSingleChunkReferenceSegmentAccessor(const ReferenceSegment& segment,
+                                              const ReferencedSegmentType& referenced_segment)
+      : _pos_list{*segment.pos_list()}, _accessor{referenced_segment} {}
+
+  const std::optional<T> access(ChunkOffset offset) const final {
+    return _accessor.access(_referenced_chunk_offset(offset));
+  }
+
+  void prefetch(ChunkOffset offset) const final { _accessor.prefetch(_referenced_chunk_offset(offset)); }
+
+ protected:
+  ChunkOffset _referenced_chunk_offset(const ChunkOffset offset) const {
+    // Ranges are resolved without materializing the PosList
+    return _pos_list.representation() == PosList::Representation::Range ? _pos_list.chunk_range().first + offset
+                                                                         : _pos_list[offset].chunk_offset;
+  }
+
+  const PosList& _pos_list;
+  const SegmentAccessor<T, ReferencedSegmentType> _accessor;
+};
+
+/**
+ * Resolves the type of a segment once and calls @param functor with an accessor of the matching type (use
+ * const auto& as the parameter declaration), so that operators that access segments at random positions, e.g., when
+ * materializing sorted rows, do not pay for a virtual call per value. Call it once per chunk and loop over the
+ * positions within the functor.
+ *
+ * ReferenceSegments that reference a single chunk are resolved to the type of the referenced segment. Those that
+ * reference multiple chunks are passed as a MultipleChunkReferenceSegmentAccessor, which dispatches each access.
+ *
+ * The functor is instantiated for each segment type (twice, for the segments referenced by ReferenceSegments). Just
+ * like for segment_iterate(), EraseTypes::Always limits it to a single instantiation with a BaseSegmentAccessor<T>,
+ * which reduces compile time at the cost of run time. Debug builds always erase the types.
+ */
+template <typename T, EraseTypes erase_segment_types = EraseTypes::OnlyInDebug, typename Functor>
+void segment_with_accessor(const BaseSegment& base_segment, const Functor& functor) {
+  if constexpr (HYRISE_DEBUG || erase_segment_types == EraseTypes::Always) {
+    const auto accessor = opossum::detail::CreateSegmentAccessor<T>::create(base_segment);
+    functor(static_cast<const BaseSegmentAccessor<T>&>(*accessor));
+  } else {
+    resolve_segment_type<T>(base_segment, [&](const auto& typed_segment) {
+      using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+      if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+        const auto& pos_list = *typed_segment.pos_list();
+        if (!pos_list.references_single_chunk() || pos_list.empty()) {
+          functor(MultipleChunkReferenceSegmentAccessor<T>{typed_segment});
+          return;
+        }
+
+        const auto referenced_segment = typed_segment.referenced_table()
+                                            ->get_chunk(pos_list.common_chunk_id())
+                                            ->get_segment(typed_segment.referenced_column_id());
+        resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_referenced_segment) {
+          using ReferencedSegmentType = std::decay_t<decltype(typed_referenced_segment)>;
+
+          if constexpr (!std::is_same_v<ReferencedSegmentType, ReferenceSegment>) {
+            functor(ResolvedSingleChunkReferenceSegmentAccessor<T, ReferencedSegmentType>{typed_segment,
+                                                                                         typed_referenced_segment});
+          } else {
+            Fail("Found ReferenceSegment pointing to ReferenceSegment");
+          }
+        });
+      } else {
+        functor(SegmentAccessor<T, SegmentType>{typed_segment});
+      }
+    });
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,254 @@
+#include "segment_encoding_selection.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The sample consists of window_count windows of window_size consecutive rows each
+constexpr auto window_count = size_t{8u};
+constexpr auto window_size = size_t{512u};
+
+/**
+ * Relative cost of scanning an encoding, compared to a dictionary segment. Delta encoding needs to sum up deltas
+ * sequentially and point access has to start at the anchor of a block.
+ */
+constexpr auto delta_scan_cost_factor = 1.5;
+
+struct SampleStatistics {
+  size_t row_count{0u};
+  size_t null_count{0u};
+  size_t distinct_count{0u};
+  size_t run_count{0u};
+
+  // Only gathered for integral types, from all rows of the segment (see gather_integral_statistics())
+  uint64_t max_block_range{0u};
+  uint64_t max_encoded_delta{0u};
+
+  // Only gathered for strings
+  size_t total_string_length{0u};
+  size_t max_string_length{0u};
+};
+
+/**
+ * FrameOfReference and Delta encoding compress the offsets or deltas to the width of the largest one, and they can
+ * only compress 32 bit integers. A single outlier that a sample is likely to miss decides both, so the largest range
+ * of a FrameOfReference block and the largest delta are determined from all rows of the segment.
+ */
+template <typename T>
+void gather_integral_statistics(const ValueSegment<T>& segment, SampleStatistics& statistics) {
+  using UnsignedT = std::make_unsigned_t<T>;
+
+  const auto& values = segment.values();
+  const auto size = segment.size();
+  const auto may_contain_null_values = segment.may_contain_null_values();
+
+  auto previous_value = std::optional<T>{};
+  auto block_min = std::optional<T>{};
+  auto block_max = std::optional<T>{};
+
+  const auto finish_block = [&]() {
+    if (!block_min) return;
+    const auto range = static_cast<UnsignedT>(static_cast<UnsignedT>(*block_max) - static_cast<UnsignedT>(*block_min));
+    statistics.max_block_range = std::max(statistics.max_block_range, static_cast<uint64_t>(range));
+    block_min.reset();
+    block_max.reset();
+  };
+
+  for (auto row = size_t{0u}; row < size; ++row) {
+    if (row % FrameOfReferenceSegment<T>::block_size == 0u) finish_block();
+    if (may_contain_null_values && segment.null_values()[row]) continue;
+
+    const auto value = values[row];
+    block_min = block_min ? std::min(*block_min, value) : value;
+    block_max = block_max ? std::max(*block_max, value) : value;
+
+    // Null values repeat the previous value (as in DeltaSegment), so they are skipped here
+    if (previous_value) {
+      const auto encoded_delta = static_cast<uint64_t>(DeltaSegment<T>::encode_delta(*previous_value, value));
+      statistics.max_encoded_delta = std::max(statistics.max_encoded_delta, encoded_delta);
+    }
+    previous_value = value;
+  }
+  finish_block();
+}
+
+template <typename T>
+SampleStatistics sample_segment(const ValueSegment<T>& segment) {
+  auto statistics = SampleStatistics{};
+
+  const auto& values = segment.values();
+  const auto size = segment.size();
+  const auto may_contain_null_values = segment.may_contain_null_values();
+
+  auto distinct_values = std::unordered_set<T>{};
+
+  const auto sample_window = [&](const size_t window_begin, const size_t window_end) {
+    auto previous_value = std::optional<T>{};
+    auto previous_is_null = false;
+
+    for (auto row = window_begin; row < window_end; ++row) {
+      const auto is_null = may_contain_null_values && segment.null_values()[row];
+      ++statistics.row_count;
+
+      if (row == window_begin || is_null != previous_is_null || (!is_null && values[row] != *previous_value)) {
+        ++statistics.run_count;
+      }
+      previous_is_null = is_null;
+
+      if (is_null) {
+        ++statistics.null_count;
+        continue;
+      }
+
+      const auto& value = values[row];
+      distinct_values.insert(value);
+
+      if constexpr (std::is_same_v<T, std::string>) {
+        statistics.total_string_length += value.size();
+        statistics.max_string_length = std::max(statistics.max_string_length, value.size());
+      }
+
+      previous_value = value;
+    }
+  };
+
+  if (size <= window_count * window_size) {
+    sample_window(0u, size);
+  } else {
+    // Spread the windows evenly, the last window ends at the end of the segment
+    const auto window_distance = (size - window_size) / (window_count - 1u);
+    for (auto window_index = size_t{0u}; window_index < window_count; ++window_index) {
+      const auto window_begin = window_index * window_distance;
+      sample_window(window_begin, window_begin + window_size);
+    }
+  }
+
+  statistics.distinct_count = distinct_values.size();
+  if constexpr (std::is_integral_v<T>) gather_integral_statistics(segment, statistics);
+  return statistics;
+}
+
+uint32_t bits_needed(uint64_t max_value) {
+  auto bits = uint32_t{1u};
+  while (max_value >>= 1u) ++bits;
+  return bits;
+}
+
+/**
+ * Estimates the size of a compressed vector in bytes per element and chooses the vector compression.
+ */
+std::pair<VectorCompressionType, double> estimate_compressed_vector(const uint64_t max_value) {
+  const auto bits = bits_needed(max_value);
+  const auto byte_aligned_bits = bits <= 8u ? 8u : bits <= 16u ? 16u : 32u;
+
+  if (bits * 2u <= byte_aligned_bits) {
+    return {VectorCompressionType::SimdBp128, bits / 8.0};
+  }
+  return {VectorCompressionType::FixedSizeByteAligned, byte_aligned_bits / 8.0};
+}
+
+template <typename T>
+SegmentEncodingSpec select_encoding_spec(const ValueSegment<T>& segment) {
+  const auto statistics = sample_segment(segment);
+
+  const auto size = static_cast<double>(segment.size());
+  if (statistics.row_count == 0u) return SegmentEncodingSpec{EncodingType::Dictionary};
+
+  const auto scale = size / statistics.row_count;
+  const auto non_null_count = statistics.row_count - statistics.null_count;
+
+  // If (almost) every sampled value is unique, the number of distinct values grows linearly with the segment size.
+  // If the values repeat within the sample, they most likely stem from a small domain.
+  const auto distinct_ratio =
+      non_null_count > 0u ? static_cast<double>(statistics.distinct_count) / non_null_count : 0.0;
+  const auto distinct_count = statistics.distinct_count * (1.0 + (scale - 1.0) * distinct_ratio);
+  const auto run_count = statistics.run_count * scale;
+
+  auto value_size = static_cast<double>(sizeof(T));
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Short strings are stored inline (small string optimization), longer ones need a heap allocation.
+    const auto average_string_length = non_null_count > 0u ? statistics.total_string_length / non_null_count : 0u;
+    if (average_string_length > 15u) value_size += average_string_length + 1u;
+  }
+
+  const auto null_values_size = segment.is_nullable() ? size / 8.0 : 0.0;
+
+  // Dictionary encoding is the default, other encodings are only chosen if they are cheaper
+  const auto [dictionary_vector_compression, dictionary_bytes_per_value] =
+      estimate_compressed_vector(static_cast<uint64_t>(distinct_count));
+  auto best_spec = SegmentEncodingSpec{EncodingType::Dictionary, dictionary_vector_compression};
+  auto best_cost = distinct_count * value_size + size * dictionary_bytes_per_value;
+
+  const auto consider = [&](const SegmentEncodingSpec& spec, const double cost) {
+    if (cost < best_cost) {
+      best_spec = spec;
+      best_cost = cost;
+    }
+  };
+
+  // Run-length encoding stores a value, a null flag, and an end position (uint32_t) per run
+  consider(SegmentEncodingSpec{EncodingType::RunLength}, run_count * (value_size + sizeof(uint32_t) + 1.0 / 8.0));
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto fixed_string_dictionary_size = distinct_count * statistics.max_string_length;
+    consider(SegmentEncodingSpec{EncodingType::FixedStringDictionary, dictionary_vector_compression},
+             fixed_string_dictionary_size + size * dictionary_bytes_per_value);
+  }
+
+  if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>, hana::type_c<T>)) {
+    if (statistics.max_block_range <= std::numeric_limits<uint32_t>::max()) {
+      const auto [vector_compression, bytes_per_value] = estimate_compressed_vector(statistics.max_block_range);
+      const auto block_count = size / FrameOfReferenceSegment<T>::block_size;
+      consider(SegmentEncodingSpec{EncodingType::FrameOfReference, vector_compression},
+               block_count * sizeof(T) + size * bytes_per_value + null_values_size);
+    }
+  }
+
+  // Wider deltas are stored separately by the DeltaSegment, which is only meant for outliers
+  if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::Delta>, hana::type_c<T>)) {
+    if (statistics.max_encoded_delta < DeltaSegment<T>::WIDE_DELTA) {
+      const auto [vector_compression, bytes_per_value] = estimate_compressed_vector(statistics.max_encoded_delta);
+      const auto block_count = size / DeltaSegment<T>::block_size;
+      consider(SegmentEncodingSpec{EncodingType::Delta, vector_compression},
+               delta_scan_cost_factor * (block_count * sizeof(T) + size * bytes_per_value + null_values_size));
+    }
+  }
+
+  return best_spec;
+}
+
+}  // namespace
+
+SegmentEncodingSpec select_segment_encoding_spec(DataType data_type,
+                                                 const std::shared_ptr<const BaseValueSegment>& value_segment) {
+  auto spec = SegmentEncodingSpec{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto typed_segment = std::dynamic_pointer_cast<const ValueSegment<ColumnDataType>>(value_segment);
+    Assert(typed_segment, "Data type does not match the value segment.");
+
+    spec = select_encoding_spec(*typed_segment);
+  });
+
+  return spec;
+}
+
+}  // namespace opossum
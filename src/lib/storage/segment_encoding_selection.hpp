@@ -0,0 +1,29 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk_encoder.hpp"
+
+namespace opossum {
+
+class BaseValueSegment;
+
+/**
+ * @brief Picks an encoding for a value segment based on a sample of its values
+ *
+ * Used by EncodingType::Auto. The segment is sampled in a few windows of consecutive rows (so that runs can be
+ * detected) spread over the entire segment. From the sample, the number of distinct values, the number of runs, the
+ * value range within blocks, the largest delta between consecutive values, and the string lengths are estimated.
+ * These are used to estimate the size of the segment for each candidate encoding. The cheapest candidate, weighted
+ * with the relative cost of scanning the encoding, is chosen.
+ *
+ * The vector compression is chosen alongside the encoding: FixedSizeByteAligned is faster to scan, so SIMD-BP128 is
+ * only used if it at least halves the size of the compressed vector.
+ *
+ * LZ4 is never selected, as it requires decompressing an entire block for each point access.
+ */
+SegmentEncodingSpec select_segment_encoding_spec(DataType data_type,
+                                                 const std::shared_ptr<const BaseValueSegment>& value_segment);
+
+}  // namespace opossum
@@ -3,8 +3,10 @@
 #include <map>
 #include <memory>
 
+#include "storage/delta_segment/delta_encoder.hpp"
 #include "storage/dictionary_segment/dictionary_encoder.hpp"
 #include "storage/frame_of_reference/frame_of_reference_encoder.hpp"
+#include "storage/lz4/lz4_encoder.hpp"
 #include "storage/run_length_segment/run_length_encoder.hpp"
 
 #include "storage/base_value_segment.hpp"
@@ -24,12 +26,15 @@ const auto encoder_for_type = std::map<EncodingType, std::shared_ptr<BaseSegment
     {EncodingType::Dictionary, std::make_shared<DictionaryEncoder<EncodingType::Dictionary>>()},
     {EncodingType::RunLength, std::make_shared<RunLengthEncoder>()},
     {EncodingType::FixedStringDictionary, std::make_shared<DictionaryEncoder<EncodingType::FixedStringDictionary>>()},
-    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()}};
+    {EncodingType::FrameOfReference, std::make_shared<FrameOfReferenceEncoder>()},
+    {EncodingType::LZ4, std::make_shared<LZ4Encoder>()},
+    {EncodingType::Delta, std::make_shared<DeltaEncoder>()}};
 
 }  // namespace
 
 std::unique_ptr<BaseSegmentEncoder> create_encoder(EncodingType encoding_type) {
   Assert(encoding_type != EncodingType::Unencoded, "Encoding type must not be Unencoded`.");
+  Assert(encoding_type != EncodingType::Auto, "Encoding type Auto needs to be resolved by the ChunkEncoder.");
 
   auto it = encoder_for_type.find(encoding_type);
   Assert(it != encoder_for_type.cend(), "All encoding types must be in encoder_for_type.");
@@ -2,6 +2,7 @@
 
 #include <type_traits>
 
+#include "storage/pos_list.hpp"
 #include "storage/segment_iterables/base_segment_iterators.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -145,7 +146,9 @@ class PointAccessibleSegmentIterable : public SegmentIterable<Derived> {
 
   template <typename Functor>
   void with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
-    if (position_filter == nullptr) {
+    // A filter that covers the entire chunk (see PosList::references_entire_chunk) does not filter anything
+    if (position_filter == nullptr ||
+        position_filter->references_entire_chunk(static_cast<ChunkOffset>(_self()._on_size()))) {
       _self()._on_with_iterators(functor);
     } else {
       DebugAssert(position_filter->references_single_chunk(), "Expected PosList to reference single chunk");
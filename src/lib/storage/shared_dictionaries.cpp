@@ -0,0 +1,151 @@
+#include "shared_dictionaries.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Rewrites the attribute vector of the segment to the value IDs of the merged dictionary
+template <typename T>
+std::shared_ptr<DictionarySegment<T>> remap_segment(const DictionarySegment<T>& segment,
+                                                    const std::shared_ptr<const pmr_vector<T>>& merged_dictionary) {
+  const auto& dictionary = *segment.dictionary();
+
+  // Both dictionaries are sorted and the merged one contains all values of the old one
+  auto new_value_ids = std::vector<uint32_t>(dictionary.size() + 1u);
+  auto merged_it = merged_dictionary->cbegin();
+  for (auto value_id = size_t{0u}; value_id < dictionary.size(); ++value_id) {
+    merged_it = std::lower_bound(merged_it, merged_dictionary->cend(), dictionary[value_id]);
+    new_value_ids[value_id] = static_cast<uint32_t>(std::distance(merged_dictionary->cbegin(), merged_it));
+  }
+
+  // The null value ID is the size of the dictionary
+  const auto null_value_id = static_cast<uint32_t>(merged_dictionary->size());
+  new_value_ids.back() = null_value_id;
+
+  const auto& attribute_vector = *segment.attribute_vector();
+  const auto alloc = dictionary.get_allocator();
+
+  auto uncompressed_attribute_vector = pmr_vector<uint32_t>{alloc};
+  uncompressed_attribute_vector.reserve(attribute_vector.size());
+
+  const auto decompressor = attribute_vector.create_base_decompressor();
+  for (auto chunk_offset = size_t{0u}; chunk_offset < attribute_vector.size(); ++chunk_offset) {
+    uncompressed_attribute_vector.push_back(new_value_ids[decompressor->get(chunk_offset)]);
+  }
+
+  const auto vector_compression_type = attribute_vector.type() == CompressedVectorType::SimdBp128
+                                           ? VectorCompressionType::SimdBp128
+                                           : VectorCompressionType::FixedSizeByteAligned;
+  auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>{
+      compress_vector(uncompressed_attribute_vector, vector_compression_type, alloc, {null_value_id})};
+
+  return std::make_shared<DictionarySegment<T>>(merged_dictionary, compressed_attribute_vector,
+                                                ValueID{null_value_id});
+}
+
+template <typename T>
+void share_dictionaries(const std::shared_ptr<Table>& table, const ColumnID column_id) {
+  auto segments = std::vector<std::pair<ChunkID, std::shared_ptr<const DictionarySegment<T>>>>{};
+  auto dictionaries = std::vector<std::shared_ptr<const pmr_vector<T>>>{};
+  auto known_dictionaries = std::unordered_set<const pmr_vector<T>*>{};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto segment =
+        std::dynamic_pointer_cast<const DictionarySegment<T>>(table->get_chunk(chunk_id)->get_segment(column_id));
+    if (!segment) continue;
+
+    segments.emplace_back(chunk_id, segment);
+    if (known_dictionaries.emplace(segment->dictionary().get()).second) {
+      dictionaries.emplace_back(segment->dictionary());
+    }
+  }
+
+  if (dictionaries.size() <= 1u) return;
+
+  // Start with the largest dictionary, which is most likely the previously shared one. If no values are added to it,
+  // the segments using it do not need to be rewritten.
+  const auto largest_dictionary_it =
+      std::max_element(dictionaries.begin(), dictionaries.end(),
+                       [](const auto& lhs, const auto& rhs) { return lhs->size() < rhs->size(); });
+  std::iter_swap(dictionaries.begin(), largest_dictionary_it);
+
+  auto merged_dictionary = dictionaries.front();
+  for (auto dictionary_it = std::next(dictionaries.cbegin()); dictionary_it != dictionaries.cend(); ++dictionary_it) {
+    const auto& dictionary = **dictionary_it;
+    if (std::includes(merged_dictionary->cbegin(), merged_dictionary->cend(), dictionary.cbegin(),
+                      dictionary.cend())) {
+      continue;
+    }
+
+    auto union_dictionary = pmr_vector<T>{merged_dictionary->get_allocator()};
+    union_dictionary.reserve(merged_dictionary->size() + dictionary.size());
+    std::set_union(merged_dictionary->cbegin(), merged_dictionary->cend(), dictionary.cbegin(), dictionary.cend(),
+                   std::back_inserter(union_dictionary));
+    merged_dictionary = std::make_shared<const pmr_vector<T>>(std::move(union_dictionary));
+  }
+
+  Assert(merged_dictionary->size() < std::numeric_limits<ValueID::base_type>::max(),
+         "Shared dictionary exceeds the range of value IDs");
+
+  for (const auto& [chunk_id, segment] : segments) {
+    if (segment->dictionary() == merged_dictionary) continue;
+
+    table->get_chunk(chunk_id)->replace_segment(column_id, remap_segment(*segment, merged_dictionary));
+  }
+}
+
+}  // namespace
+
+void share_dictionaries(const std::shared_ptr<Table>& table, const ColumnID column_id) {
+  Assert(table->type() == TableType::Data, "Dictionaries can only be shared in data tables");
+
+  resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    share_dictionaries<ColumnDataType>(table, column_id);
+  });
+}
+
+std::vector<std::shared_ptr<const BaseDictionarySegment>> segments_with_shared_dictionary(const Table& table,
+                                                                                          const ColumnID column_id) {
+  auto segments = std::vector<std::shared_ptr<const BaseDictionarySegment>>{};
+  if (table.type() != TableType::Data || table.chunk_count() == 0) return segments;
+
+  resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    segments.reserve(table.chunk_count());
+    auto shared_dictionary = std::shared_ptr<const pmr_vector<ColumnDataType>>{};
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(
+          table.get_chunk(chunk_id)->get_segment(column_id));
+
+      if (!segment || (shared_dictionary && segment->dictionary() != shared_dictionary)) {
+        segments.clear();
+        return;
+      }
+
+      shared_dictionary = segment->dictionary();
+      segments.emplace_back(segment);
+    }
+  });
+
+  return segments;
+}
+
+}  // namespace opossum
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+class Table;
+
+/**
+ * Usually, each DictionarySegment has its own dictionary, so value IDs cannot be compared across chunks. This merges
+ * the dictionaries of all DictionarySegments of a column into a single sorted dictionary that is shared by these
+ * segments. Their attribute vectors are rewritten to the new value IDs, keeping their vector compression.
+ *
+ * The merge is incremental: Calling it again after more chunks have been encoded only rewrites the segments whose
+ * dictionary differs from the result. Segments of other encodings (e.g., of mutable chunks) are left untouched. As
+ * with ChunkEncoder, segments are exchanged atomically. Concurrently running operators keep using the previous
+ * segments.
+ *
+ * Note that the segment statistics of the chunks are not changed, so chunk pruning still uses the per-chunk values.
+ */
+void share_dictionaries(const std::shared_ptr<Table>& table, const ColumnID column_id);
+
+/**
+ * Returns the segments of the column if all of them are DictionarySegments using a single dictionary, i.e., their
+ * value IDs are comparable. Returns an empty vector otherwise. Operators should use the returned segments and not
+ * the ones currently in the table, because share_dictionaries() might exchange those in the meantime.
+ */
+std::vector<std::shared_ptr<const BaseDictionarySegment>> segments_with_shared_dictionary(const Table& table,
+                                                                                          const ColumnID column_id);
+
+}  // namespace opossum
@@ -1,63 +1,127 @@
 #include "storage_manager.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "logical_query_plan/abstract_lqp_node.hpp"
+#include "operators/export_binary.hpp"
 #include "operators/export_csv.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_wrapper.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/materialized_view.hpp"
 #include "utils/assert.hpp"
+#include "utils/filesystem.hpp"
 
 namespace opossum {
 
 void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> table) {
-  Assert(_tables.find(name) == _tables.end(), "A table with the name " + name + " already exists");
-  Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
-
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); chunk_id++) {
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
   table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
+
+  std::unique_lock<std::shared_mutex> lock(*_tables_mutex);
+  _assert_name_is_available(name);
   _tables.emplace(name, std::move(table));
 }
 
 void StorageManager::drop_table(const std::string& name) {
-  const auto num_deleted = _tables.erase(name);
+  Assert(!has_materialized_view(name), "Cannot drop table " + name + " - it is the result of a materialized view");
+
+  std::unique_lock<std::shared_mutex> lock(*_tables_mutex);
+  const auto num_deleted = _tables.erase(name) + _persisted_tables.erase(name);
   Assert(num_deleted == 1, "Error deleting table " + name + ": _erase() returned " + std::to_string(num_deleted) + ".");
 }
 
-std::shared_ptr<Table> StorageManager::get_table(const std::string& name) const {
-  const auto iter = _tables.find(name);
-  Assert(iter != _tables.end(), "No such table named '" + name + "'");
+std::shared_ptr<Table> StorageManager::get_table(const std::string& name) {
+  auto persisted_table = std::shared_ptr<PersistedTable>{};
+  {
+    std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+    const auto iter = _tables.find(name);
+    if (iter != _tables.end()) return iter->second;
 
-  return iter->second;
+    const auto persisted_iter = _persisted_tables.find(name);
+    Assert(persisted_iter != _persisted_tables.end(), "No such table named '" + name + "'");
+    persisted_table = persisted_iter->second;
+  }
+
+  return _load_and_move_persisted_table(name, persisted_table);
 }
 
-bool StorageManager::has_table(const std::string& name) const { return _tables.count(name); }
+bool StorageManager::has_table(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+  return _has_table(name);
+}
 
 std::vector<std::string> StorageManager::table_names() const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+
   std::vector<std::string> table_names;
-  table_names.reserve(_tables.size());
+  table_names.reserve(_tables.size() + _persisted_tables.size());
 
   for (const auto& table_item : _tables) {
     table_names.emplace_back(table_item.first);
   }
 
+  for (const auto& persisted_table_item : _persisted_tables) {
+    table_names.emplace_back(persisted_table_item.first);
+  }
+
+  std::sort(table_names.begin(), table_names.end());
+
   return table_names;
 }
 
-const std::map<std::string, std::shared_ptr<Table>>& StorageManager::tables() const { return _tables; }
+std::map<std::string, std::shared_ptr<Table>> StorageManager::tables() {
+  _load_all_persisted_tables();
+
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+  return _tables;
+}
+
+void StorageManager::attach_persisted_table(const std::string& name, const std::string& filename) {
+  Assert(filesystem::is_regular_file(filename), "Cannot attach table " + name + " - no such file " + filename);
+
+  auto persisted_table = std::make_shared<PersistedTable>();
+  persisted_table->filename = filename;
+
+  std::unique_lock<std::shared_mutex> lock(*_tables_mutex);
+  _assert_name_is_available(name);
+  _persisted_tables.emplace(name, std::move(persisted_table));
+}
+
+void StorageManager::attach_persisted_tables(const std::string& path) {
+  Assert(filesystem::is_directory(path), "Cannot attach tables - no such directory " + path);
+
+  for (const auto& directory_entry : filesystem::directory_iterator(path)) {
+    const auto& file_path = directory_entry.path();
+    if (!directory_entry.is_regular_file() || file_path.extension() != ".bin") continue;
+
+    attach_persisted_table(file_path.stem().string(), file_path.string());
+  }
+}
+
+bool StorageManager::is_table_loaded(const std::string& name) const {
+  std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+  if (_tables.count(name)) return true;
+
+  // Loaded tables are moved to _tables, so a table that is still persisted is either not loaded or just being loaded
+  Assert(_persisted_tables.count(name), "No such table named '" + name + "'");
+  return false;
+}
 
 void StorageManager::add_view(const std::string& name, const std::shared_ptr<LQPView>& view) {
-  Assert(_tables.find(name) == _tables.end(),
-         "Cannot add view " + name + " - a table with the same name already exists");
+  Assert(!has_table(name), "Cannot add view " + name + " - a table with the same name already exists");
   Assert(_views.find(name) == _views.end(), "A view with the name " + name + " already exists");
 
   _views.emplace(name, view);
@@ -88,7 +152,41 @@ std::vector<std::string> StorageManager::view_names() const {
   return view_names;
 }
 
+void StorageManager::add_materialized_view(const std::string& name, const std::shared_ptr<MaterializedView>& view) {
+  add_table(name, view->table());
+  _materialized_views.emplace(name, view);
+}
+
+void StorageManager::drop_materialized_view(const std::string& name) {
+  const auto num_deleted = _materialized_views.erase(name);
+  Assert(num_deleted == 1, "Error deleting materialized view " + name + ": _erase() returned " +
+                               std::to_string(num_deleted) + ".");
+  drop_table(name);
+}
+
+std::shared_ptr<MaterializedView> StorageManager::get_materialized_view(const std::string& name) const {
+  const auto iter = _materialized_views.find(name);
+  Assert(iter != _materialized_views.end(), "No such materialized view named '" + name + "'");
+
+  return iter->second;
+}
+
+bool StorageManager::has_materialized_view(const std::string& name) const {
+  return _materialized_views.count(name);
+}
+
+const std::map<std::string, std::shared_ptr<MaterializedView>>& StorageManager::materialized_views() const {
+  return _materialized_views;
+}
+
+void StorageManager::refresh_materialized_views() {
+  for (const auto& [name, view] : _materialized_views) {
+    view->refresh();
+  }
+}
+
 void StorageManager::add_prepared_plan(const std::string& name, const std::shared_ptr<PreparedPlan>& prepared_plan) {
+  std::lock_guard<std::mutex> lock(*_prepared_plans_mutex);
   Assert(_prepared_plans.find(name) == _prepared_plans.end(),
          "Cannot add prepared plan " + name + " - a prepared plan with the same name already exists");
 
@@ -96,6 +194,7 @@ void StorageManager::add_prepared_plan(const std::string& name, const std::share
 }
 
 std::shared_ptr<PreparedPlan> StorageManager::get_prepared_plan(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(*_prepared_plans_mutex);
   const auto iter = _prepared_plans.find(name);
   Assert(iter != _prepared_plans.end(), "No such prepared plan named '" + name + "'");
 
@@ -103,10 +202,12 @@ std::shared_ptr<PreparedPlan> StorageManager::get_prepared_plan(const std::strin
 }
 
 bool StorageManager::has_prepared_plan(const std::string& name) const {
+  std::lock_guard<std::mutex> lock(*_prepared_plans_mutex);
   return _prepared_plans.find(name) != _prepared_plans.end();
 }
 
 void StorageManager::drop_prepared_plan(const std::string& name) {
+  std::lock_guard<std::mutex> lock(*_prepared_plans_mutex);
   const auto iter = _prepared_plans.find(name);
   Assert(iter != _prepared_plans.end(), "No such prepared plan named '" + name + "'");
 
@@ -117,6 +218,8 @@ void StorageManager::print(std::ostream& out) const {
   out << "==================" << std::endl;
   out << "===== Tables =====" << std::endl << std::endl;
 
+  std::shared_lock<std::shared_mutex> tables_lock(*_tables_mutex);
+
   for (auto const& table : _tables) {
     out << "==== table >> " << table.first << " <<";
     out << " (" << table.second->column_count() << " columns, " << table.second->row_count() << " rows in "
@@ -124,6 +227,13 @@ void StorageManager::print(std::ostream& out) const {
     out << std::endl;
   }
 
+  for (auto const& persisted_table : _persisted_tables) {
+    out << "==== table >> " << persisted_table.first << " << (persisted in " << persisted_table.second->filename;
+    out << ", not loaded yet)";
+    out << std::endl;
+  }
+  tables_lock.unlock();
+
   out << "==================" << std::endl;
   out << "===== Views ======" << std::endl << std::endl;
 
@@ -135,6 +245,7 @@ void StorageManager::print(std::ostream& out) const {
   out << "==================" << std::endl;
   out << "= PreparedPlans ==" << std::endl << std::endl;
 
+  std::lock_guard<std::mutex> lock(*_prepared_plans_mutex);
   for (auto const& prepared_plan : _prepared_plans) {
     out << "==== prepared plan >> " << prepared_plan.first << " <<";
     out << std::endl;
@@ -144,10 +255,12 @@ void StorageManager::print(std::ostream& out) const {
 void StorageManager::reset() { get() = StorageManager(); }
 
 void StorageManager::export_all_tables_as_csv(const std::string& path) {
+  const auto tables_to_export = tables();
+
   auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
-  tasks.reserve(_tables.size());
+  tasks.reserve(tables_to_export.size());
 
-  for (auto& pair : _tables) {
+  for (const auto& pair : tables_to_export) {
     auto job_task = std::make_shared<JobTask>([pair, &path]() {
       const auto& name = pair.first;
       auto& table = pair.second;
@@ -165,4 +278,69 @@ void StorageManager::export_all_tables_as_csv(const std::string& path) {
   CurrentScheduler::wait_for_tasks(tasks);
 }
 
+void StorageManager::export_all_tables_as_binary(const std::string& path) {
+  const auto tables_to_export = tables();
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(tables_to_export.size());
+
+  for (const auto& pair : tables_to_export) {
+    auto job_task = std::make_shared<JobTask>([pair, &path]() {
+      const auto& name = pair.first;
+      const auto& table = pair.second;
+
+      ExportBinary::write_binary(*table, path + "/" + name + ".bin");  // NOLINT
+    });
+    tasks.push_back(job_task);
+    job_task->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(tasks);
+}
+
+const std::shared_ptr<Table>& StorageManager::_load_persisted_table(PersistedTable& persisted_table) {
+  std::call_once(persisted_table.load_flag, [&]() {
+    auto table = ImportBinary::read_binary(persisted_table.filename);
+    table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
+    persisted_table.table = std::move(table);
+  });
+
+  return persisted_table.table;
+}
+
+std::shared_ptr<Table> StorageManager::_load_and_move_persisted_table(
+    const std::string& name, const std::shared_ptr<PersistedTable>& persisted_table) {
+  const auto& table = _load_persisted_table(*persisted_table);
+
+  std::unique_lock<std::shared_mutex> lock(*_tables_mutex);
+  const auto persisted_iter = _persisted_tables.find(name);
+  if (persisted_iter != _persisted_tables.end() && persisted_iter->second == persisted_table) {
+    _persisted_tables.erase(persisted_iter);
+    _tables.emplace(name, table);
+  }
+
+  return table;
+}
+
+void StorageManager::_load_all_persisted_tables() {
+  auto persisted_tables = std::map<std::string, std::shared_ptr<PersistedTable>>{};
+  {
+    std::shared_lock<std::shared_mutex> lock(*_tables_mutex);
+    persisted_tables = _persisted_tables;
+  }
+
+  for (const auto& [name, persisted_table] : persisted_tables) {
+    _load_and_move_persisted_table(name, persisted_table);
+  }
+}
+
+bool StorageManager::_has_table(const std::string& name) const {
+  return _tables.count(name) || _persisted_tables.count(name);
+}
+
+void StorageManager::_assert_name_is_available(const std::string& name) const {
+  Assert(!_has_table(name), "A table with the name " + name + " already exists");
+  Assert(_views.find(name) == _views.end(), "Cannot add table " + name + " - a view with the same name already exists");
+}
+
 }  // namespace opossum
@@ -3,6 +3,8 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -15,6 +17,7 @@ namespace opossum {
 
 class Table;
 class AbstractLQPNode;
+class MaterializedView;
 
 // The StorageManager is a singleton that maintains all tables
 // by mapping table names to table instances.
@@ -26,10 +29,26 @@ class StorageManager : public Singleton<StorageManager> {
    */
   void add_table(const std::string& name, std::shared_ptr<Table> table);
   void drop_table(const std::string& name);
-  std::shared_ptr<Table> get_table(const std::string& name) const;
+  // Loads the table if it is persisted and has not been accessed yet (see below)
+  std::shared_ptr<Table> get_table(const std::string& name);
   bool has_table(const std::string& name) const;
   std::vector<std::string> table_names() const;
-  const std::map<std::string, std::shared_ptr<Table>>& tables() const;
+  // Returns a snapshot of all tables, which can be iterated while other threads add or drop tables. Also loads all
+  // persisted tables that have not been accessed yet.
+  std::map<std::string, std::shared_ptr<Table>> tables();
+  /** @} */
+
+  /**
+   * @defgroup Manage persisted tables
+   * Tables written by export_all_tables_as_binary() (or ExportBinary) can be re-attached after a restart. Attaching
+   * only registers the file, which makes it cheap. The table is loaded on its first access via get_table() or
+   * tables(). Until then, has_table() and table_names() already report it.
+   * @{
+   */
+  void attach_persisted_table(const std::string& name, const std::string& filename);
+  // Attaches every <name>.bin file within the directory as table <name>
+  void attach_persisted_tables(const std::string& path);
+  bool is_table_loaded(const std::string& name) const;
   /** @} */
 
   /**
@@ -43,6 +62,22 @@ class StorageManager : public Singleton<StorageManager> {
   std::vector<std::string> view_names() const;
   /** @} */
 
+  /**
+   * @defgroup Manage materialized views
+   * The result of a materialized view is added as a table with the name of the view. It is read like any other table
+   * and dropped along with the view.
+   * @{
+   */
+  void add_materialized_view(const std::string& name, const std::shared_ptr<MaterializedView>& view);
+  void drop_materialized_view(const std::string& name);
+  std::shared_ptr<MaterializedView> get_materialized_view(const std::string& name) const;
+  bool has_materialized_view(const std::string& name) const;
+  const std::map<std::string, std::shared_ptr<MaterializedView>>& materialized_views() const;
+
+  // Propagates the changes committed since their last refresh to all materialized views, e.g., periodically
+  void refresh_materialized_views();
+  /** @} */
+
   /**
    * @defgroup Manage prepared plans - comparable to SQL PREPAREd statements
    * @{
@@ -65,6 +100,9 @@ class StorageManager : public Singleton<StorageManager> {
   // For debugging purposes mostly, dump all tables as csv
   void export_all_tables_as_csv(const std::string& path);
 
+  // Writes all tables as <path>/<name>.bin so that they can be re-attached using attach_persisted_tables()
+  void export_all_tables_as_binary(const std::string& path);
+
   StorageManager(StorageManager&&) = delete;
 
  protected:
@@ -75,8 +113,39 @@ class StorageManager : public Singleton<StorageManager> {
   const StorageManager& operator=(const StorageManager&) = delete;
   StorageManager& operator=(StorageManager&&) = default;
 
+  struct PersistedTable {
+    std::string filename;
+    std::once_flag load_flag;
+    std::shared_ptr<Table> table;
+  };
+
+  // Loads the table on its first call. Concurrent calls wait for the table to be loaded.
+  static const std::shared_ptr<Table>& _load_persisted_table(PersistedTable& persisted_table);
+
+  // Loads the persisted table (without holding _tables_mutex, so that other tables stay accessible meanwhile) and
+  // moves it into _tables, unless it was dropped in the meantime
+  std::shared_ptr<Table> _load_and_move_persisted_table(const std::string& name,
+                                                        const std::shared_ptr<PersistedTable>& persisted_table);
+
+  // Moves all persisted tables into _tables, loading them if necessary
+  void _load_all_persisted_tables();
+
+  // Expects _tables_mutex to be held by the caller
+  bool _has_table(const std::string& name) const;
+  void _assert_name_is_available(const std::string& name) const;
+
   std::map<std::string, std::shared_ptr<Table>> _tables;
+  std::map<std::string, std::shared_ptr<PersistedTable>> _persisted_tables;
   std::map<std::string, std::shared_ptr<LQPView>> _views;
+  std::map<std::string, std::shared_ptr<MaterializedView>> _materialized_views;
   std::map<std::string, std::shared_ptr<PreparedPlan>> _prepared_plans;
+
+  // Server sessions on different threads add and drop prepared plans concurrently. The mutex is held in a unique_ptr
+  // so that the StorageManager stays move-assignable for reset().
+  std::unique_ptr<std::mutex> _prepared_plans_mutex = std::make_unique<std::mutex>();
+
+  // Guards _tables and _persisted_tables, which are accessed by queries and by background threads (e.g., the
+  // ChunkCompressionManager) alike
+  std::unique_ptr<std::shared_mutex> _tables_mutex = std::make_unique<std::shared_mutex>();
 };
 }  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace opossum {
+
+/**
+ * The length and the first four characters of a string, as stored inline by the "German string" layout of Umbra.
+ * ValueSegment<std::string> keeps a prefix for each of its values in a dense vector. Most comparisons of a scan are
+ * decided by the eight bytes of the prefixes, without following the pointers of the strings to their characters.
+ */
+struct StringPrefix {
+  static StringPrefix of(const std::string& string) {
+    auto characters = uint32_t{0};
+    for (auto index = size_t{0}; index < sizeof(characters); ++index) {
+      characters <<= 8u;
+      if (index < string.size()) characters |= static_cast<unsigned char>(string[index]);
+    }
+    return StringPrefix{static_cast<uint32_t>(string.size()), characters};
+  }
+
+  uint32_t size{0};
+
+  // Big-endian and padded with zeros, so that comparing the integers compares the characters like std::string does
+  uint32_t characters{0};
+};
+
+// Returns the sign of lhs.compare(rhs) if it follows from the prefixes of the strings, std::nullopt otherwise
+inline std::optional<int> compare_string_prefixes(const StringPrefix& lhs, const StringPrefix& rhs) {
+  if (lhs.characters != rhs.characters) return lhs.characters < rhs.characters ? -1 : 1;
+
+  // If one of the strings is not longer than the prefix, it is a prefix of the other one
+  if (lhs.size <= sizeof(lhs.characters) || rhs.size <= sizeof(rhs.characters)) {
+    return lhs.size == rhs.size ? 0 : (lhs.size < rhs.size ? -1 : 1);
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace opossum
@@ -1,14 +1,19 @@
 #include "table.hpp"
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/worker.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -29,6 +34,8 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
   // _max_chunk_size has no meaning if the table is a reference table.
   DebugAssert(type == TableType::Data || !max_chunk_size, "Must not set max_chunk_size for reference tables");
   DebugAssert(!max_chunk_size || *max_chunk_size > 0, "Table must have a chunk size greater than 0.");
+
+  _insertion_chunks.emplace_back(std::make_unique<InsertionChunk>());
 }
 
 const TableColumnDefinitions& Table::column_definitions() const { return _column_definitions; }
@@ -88,14 +95,60 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 }
 
 void Table::append(const std::vector<AllTypeVariant>& values) {
-  if (_chunks.empty() || _chunks.back()->size() >= _max_chunk_size) {
-    append_mutable_chunk();
+  auto chunk_id = ChunkID{0};
+  if (_partitioning) {
+    chunk_id = open_insertion_chunk(insertion_chunk(_partitioning->partition_of(values[_partitioning->column_id()])));
+  } else {
+    if (_chunks.empty() || _chunks.back()->size() >= _max_chunk_size) {
+      append_mutable_chunk();
+    }
+    chunk_id = ChunkID{chunk_count() - 1};
+  }
+
+  const auto& chunk = _chunks[chunk_id];
+  chunk->append(values);
+  ++_direct_append_count;
+
+  const auto chunk_size = chunk->size();
+  add_to_table_indexes(chunk_id, chunk_size - 1, chunk_size);
+}
+
+void Table::append_columns(const Segments& segments) {
+  DebugAssert(segments.size() == column_count(), "append_columns: number of segments does not match the table.");
+
+  if (_partitioning) {
+    const auto segments_per_partition = _partitioning->partition_segments(segments, columns_are_nullable());
+    for (auto partition_id = PartitionID{0}; partition_id < segments_per_partition.size(); ++partition_id) {
+      auto& partition_insertion_chunk = insertion_chunk(partition_id);
+      _append_columns(segments_per_partition[partition_id],
+                      [&]() { return open_insertion_chunk(partition_insertion_chunk); });
+    }
+  } else {
+    _append_columns(segments, [&]() {
+      if (_chunks.empty() || _chunks.back()->size() >= _max_chunk_size || !_chunks.back()->is_mutable()) {
+        append_mutable_chunk();
+      }
+      return ChunkID{chunk_count() - 1};
+    });
   }
+  ++_direct_append_count;
+}
 
-  _chunks.back()->append(values);
+void Table::_append_columns(const Segments& segments, const std::function<ChunkID()>& open_chunk) {
+  const auto row_count = segments.empty() ? ChunkOffset{0} : static_cast<ChunkOffset>(segments[0]->size());
+
+  for (auto offset = ChunkOffset{0}; offset < row_count;) {
+    const auto chunk_id = open_chunk();
+    const auto& chunk = _chunks[chunk_id];
+    const auto length = std::min(_max_chunk_size - chunk->size(), row_count - offset);
+    const auto chunk_size = chunk->size();
+    chunk->append_columns(segments, offset, length);
+    add_to_table_indexes(chunk_id, chunk_size, chunk_size + length);
+    offset += length;
+  }
 }
 
-void Table::append_mutable_chunk() {
+void Table::append_mutable_chunk(const std::optional<PartitionID>& partition_id) {
   Segments segments;
   for (const auto& column_definition : _column_definitions) {
     resolve_data_type(column_definition.data_type, [&](auto type) {
@@ -103,7 +156,17 @@ void Table::append_mutable_chunk() {
       segments.push_back(std::make_shared<ValueSegment<ColumnDataType>>(column_definition.nullable));
     });
   }
-  append_chunk(segments);
+
+  if (!partition_id) {
+    append_chunk(segments);
+    return;
+  }
+
+  // The partition is set before the chunk becomes visible in the table
+  const auto mvcc_data = _use_mvcc == UseMvcc::Yes ? std::make_shared<MvccData>(0) : nullptr;
+  const auto chunk = std::make_shared<Chunk>(segments, mvcc_data);
+  chunk->set_partition_id(*partition_id);
+  append_chunk(chunk);
 }
 
 uint64_t Table::row_count() const {
@@ -124,22 +187,22 @@ uint32_t Table::max_chunk_size() const { return _max_chunk_size; }
 
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(std::atomic_load(&_chunks[chunk_id]));
 }
 
 const ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) const {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(std::atomic_load(&_chunks[chunk_id]));
 }
 
 void Table::append_chunk(const Segments& segments, const std::optional<PolymorphicAllocator<Chunk>>& alloc,
@@ -168,6 +231,8 @@ void Table::append_chunk(const Segments& segments, const std::optional<Polymorph
   }
 
   _chunks.emplace_back(std::make_shared<Chunk>(segments, mvcc_data, alloc, access_counter));
+  ++_direct_append_count;
+  add_to_table_indexes(ChunkID{chunk_count() - 1}, 0, chunk_size);
 }
 
 void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
@@ -189,11 +254,223 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
               "Chunk does not have the same MVCC setting as the table.");
 
   _chunks.emplace_back(chunk);
+  ++_direct_append_count;
+  add_to_table_indexes(ChunkID{chunk_count() - 1}, 0, chunk->size());
+}
+
+void Table::replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk) {
+  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  DebugAssert(chunk->column_count() == column_count(), "Chunk does not have the same number of columns as the table.");
+  DebugAssert(chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes),
+              "Chunk does not have the same MVCC setting as the table.");
+
+  std::atomic_store(&_chunks[chunk_id], chunk);
+
+  // Lookups in between see the RowIDs of the old chunk, which are still valid for operators that hold it
+  for (const auto& table_index : _table_indexes) {
+    table_index->remove_chunk(chunk_id);
+  }
+  add_to_table_indexes(chunk_id, 0, chunk->size());
 }
 
+CommitID Table::last_commit_id() const { return _last_commit_id.load(); }
+
+void Table::register_commit(const CommitID commit_id) {
+  auto last_commit_id = _last_commit_id.load();
+  while (last_commit_id < commit_id && !_last_commit_id.compare_exchange_weak(last_commit_id, commit_id)) {
+  }
+}
+
+uint64_t Table::direct_append_count() const { return _direct_append_count.load(); }
+
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
+void Table::set_insertion_chunk_count(const size_t insertion_chunk_count) {
+  Assert(insertion_chunk_count > 0, "A table needs at least one insertion chunk");
+
+  const auto append_lock = acquire_append_mutex();
+  _insertion_chunks.resize(insertion_chunk_count);
+  for (auto& insertion_chunk : _insertion_chunks) {
+    if (!insertion_chunk) insertion_chunk = std::make_unique<InsertionChunk>();
+  }
+}
+
+size_t Table::insertion_chunk_count() const { return _insertion_chunks.size(); }
+
+Table::InsertionChunk& Table::insertion_chunk() {
+  if (_insertion_chunks.size() == 1) return *_insertion_chunks.front();
+
+  // Inserts on the same Worker, or on the same thread outside of Workers, do not run concurrently and can thus share an
+  // insertion chunk without contention
+  const auto worker = Worker::get_this_thread_worker();
+  const auto thread_number = worker ? size_t{worker->id()} : std::hash<std::thread::id>{}(std::this_thread::get_id());
+  return *_insertion_chunks[thread_number % _insertion_chunks.size()];
+}
+
+Table::InsertionChunk& Table::insertion_chunk(const PartitionID partition_id) {
+  DebugAssert(partition_id < _partition_insertion_chunks.size(), "PartitionID out of range");
+  return *_partition_insertion_chunks[partition_id];
+}
+
+ChunkID Table::open_insertion_chunk(InsertionChunk& insertion_chunk) {
+  const auto has_free_space = [&](const ChunkID chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    return chunk->is_mutable() && chunk->size() < _max_chunk_size;
+  };
+
+  if (insertion_chunk.chunk_id != INVALID_CHUNK_ID && has_free_space(insertion_chunk.chunk_id)) {
+    return insertion_chunk.chunk_id;
+  }
+
+  const auto append_lock = acquire_append_mutex();
+
+  // Continue with the last chunk, e.g., one that was bulk-loaded, unless another insertion chunk already uses it or it
+  // belongs to another partition
+  const auto last_chunk_id = ChunkID{chunk_count() - 1};
+  const auto is_used = [&](const auto& other) { return other->chunk_id == last_chunk_id; };
+  const auto last_chunk_is_used =
+      std::any_of(_insertion_chunks.cbegin(), _insertion_chunks.cend(), is_used) ||
+      std::any_of(_partition_insertion_chunks.cbegin(), _partition_insertion_chunks.cend(), is_used);
+  const auto last_chunk_is_available = !_chunks.empty() && !last_chunk_is_used && has_free_space(last_chunk_id) &&
+                                       get_chunk(last_chunk_id)->partition_id() == insertion_chunk.partition_id;
+  if (!last_chunk_is_available) append_mutable_chunk(insertion_chunk.partition_id);
+
+  insertion_chunk.chunk_id = ChunkID{chunk_count() - 1};
+  return insertion_chunk.chunk_id;
+}
+
+void Table::set_partitioning(const std::shared_ptr<const TablePartitioning>& partitioning) {
+  Assert(_type == TableType::Data, "Only data tables can be partitioned");
+  Assert(_chunks.empty(), "Only tables without chunks can be partitioned");
+  Assert(partitioning->column_id() < column_count(), "Cannot partition by a column the table does not have");
+  Assert(partitioning->data_type() == column_data_type(partitioning->column_id()),
+         "The partitioning does not match the data type of its column");
+
+  const auto append_lock = acquire_append_mutex();
+  _partitioning = partitioning;
+  _partition_insertion_chunks.clear();
+  for (auto partition_id = PartitionID{0}; partition_id < partitioning->partition_count(); ++partition_id) {
+    _partition_insertion_chunks.emplace_back(std::make_unique<InsertionChunk>());
+    _partition_insertion_chunks.back()->partition_id = partition_id;
+  }
+}
+
+const std::shared_ptr<const TablePartitioning>& Table::partitioning() const { return _partitioning; }
+
+void Table::add_unique_constraint(const std::vector<ColumnID>& columns, const IsPrimaryKey is_primary_key) {
+  Assert(!columns.empty(), "A unique constraint needs at least one column");
+  for (const auto column_id : columns) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+    Assert(is_primary_key == IsPrimaryKey::No || !column_is_nullable(column_id),
+           "The columns of a primary key must not be nullable");
+  }
+
+  if (is_primary_key == IsPrimaryKey::Yes) {
+    Assert(std::none_of(_unique_constraints.cbegin(), _unique_constraints.cend(),
+                        [](const auto& constraint) { return constraint.is_primary_key == IsPrimaryKey::Yes; }),
+           "A table can only have one primary key");
+  }
+
+  _unique_constraints.emplace_back(TableConstraintDefinition{columns, is_primary_key});
+}
+
+const std::vector<TableConstraintDefinition>& Table::get_unique_constraints() const { return _unique_constraints; }
+
+void Table::add_foreign_key_constraint(const std::vector<ColumnID>& columns, const std::string& referenced_table_name,
+                                       const std::vector<ColumnID>& referenced_columns) {
+  Assert(!columns.empty(), "A foreign key constraint needs at least one column");
+  Assert(columns.size() == referenced_columns.size(), "Expected as many referenced columns as columns");
+  for (const auto column_id : columns) {
+    Assert(column_id < column_count(), "ColumnID out of range");
+  }
+
+  _foreign_key_constraints.emplace_back(
+      ForeignKeyConstraintDefinition{columns, referenced_table_name, referenced_columns});
+}
+
+const std::vector<ForeignKeyConstraintDefinition>& Table::get_foreign_key_constraints() const {
+  return _foreign_key_constraints;
+}
+
+std::vector<IndexInfo> Table::get_indexes() const {
+  std::lock_guard<std::mutex> lock(_indexes_mutex);
+  return _indexes;
+}
+
+void Table::add_index_info(const IndexInfo& index_info) {
+  std::lock_guard<std::mutex> lock(_indexes_mutex);
+  const auto iter = std::find_if(_indexes.cbegin(), _indexes.cend(), [&](const auto& existing_index_info) {
+    return existing_index_info.column_ids == index_info.column_ids && existing_index_info.type == index_info.type;
+  });
+  if (iter == _indexes.cend()) _indexes.emplace_back(index_info);
+}
+
+void Table::remove_index_info(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type) {
+  std::lock_guard<std::mutex> lock(_indexes_mutex);
+  _indexes.erase(std::remove_if(_indexes.begin(), _indexes.end(),
+                                [&](const auto& index_info) {
+                                  return index_info.column_ids == column_ids && index_info.type == index_type;
+                                }),
+                 _indexes.end());
+}
+
+void Table::_for_each_chunk_in_parallel(const std::function<void(const std::shared_ptr<Chunk>&)>& functor) {
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(_chunks.size());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk = get_chunk(chunk_id)]() { functor(chunk); }));
+    jobs.back()->schedule();
+  }
+
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+void Table::create_table_index(const ColumnID column_id) {
+  DebugAssert(column_id < column_count(), "ColumnID out of range");
+  Assert(_type == TableType::Data, "Table indexes can only be created on data tables");
+  Assert(!get_table_index(column_id), "Column already has a table index");
+
+  const auto table_index =
+      make_shared_by_data_type<BaseTableIndex, TableIndex>(column_data_type(column_id), column_id);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    table_index->insert(chunk_id, *chunk->get_segment(column_id), 0, chunk->size());
+  }
+
+  _table_indexes.emplace_back(table_index);
+}
+
+std::shared_ptr<BaseTableIndex> Table::get_table_index(const ColumnID column_id) const {
+  const auto iter = std::find_if(_table_indexes.cbegin(), _table_indexes.cend(),
+                                 [&](const auto& table_index) { return table_index->column_id() == column_id; });
+  return iter != _table_indexes.cend() ? *iter : nullptr;
+}
+
+const std::vector<std::shared_ptr<BaseTableIndex>>& Table::table_indexes() const { return _table_indexes; }
+
+void Table::add_to_table_indexes(const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                 const ChunkOffset end_offset) {
+  if (_table_indexes.empty() || begin_offset == end_offset) return;
+
+  const auto chunk = get_chunk(chunk_id);
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(chunk_id, *chunk->get_segment(table_index->column_id()), begin_offset, end_offset);
+  }
+}
+
+void Table::retain_memory_resource(
+    const std::shared_ptr<boost::container::pmr::memory_resource>& memory_resource) {
+  if (std::find(_retained_memory_resources.cbegin(), _retained_memory_resources.cend(), memory_resource) ==
+      _retained_memory_resources.cend()) {
+    _retained_memory_resources.emplace_back(memory_resource);
+  }
+}
+
+const std::vector<std::shared_ptr<boost::container::pmr::memory_resource>>& Table::retained_memory_resources() const {
+  return _retained_memory_resources;
+}
 
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
@@ -206,6 +483,10 @@ size_t Table::estimate_memory_usage() const {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& table_index : _table_indexes) {
+    bytes += table_index->estimate_memory_usage();
+  }
+
   // TODO(anybody) Statistics and Indices missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
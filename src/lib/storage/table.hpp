@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -10,7 +13,10 @@
 #include "chunk.hpp"
 #include "proxy_chunk.hpp"
 #include "storage/index/index_info.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/table_column_definition.hpp"
+#include "storage/table_constraint_definition.hpp"
+#include "storage/table_partitioning.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -104,8 +110,24 @@ class Table : private Noncopyable {
    */
   void append_chunk(const std::shared_ptr<Chunk>& chunk);
 
-  // Create and append a Chunk consisting of ValueSegments.
-  void append_mutable_chunk();
+  // Create and append a Chunk consisting of ValueSegments. @param partition_id is set as the chunk's partition.
+  void append_mutable_chunk(const std::optional<PartitionID>& partition_id = std::nullopt);
+
+  /**
+   * Appends the rows of the given ValueSegments (one per column, all of the same size and with the columns' data
+   * types) at the end of the table. The values are copied column by column into the last mutable chunk and into new
+   * chunks as needed. This is the fast way to bulk-load a table, as opposed to append(). It is not thread-safe,
+   * concurrent inserts have to go through the Insert operator. The rows of a partitioned table are appended to the
+   * chunks of their partitions.
+   */
+  void append_columns(const Segments& segments);
+
+  /**
+   * Atomically replaces the chunk at chunk_id, e.g., to release the data of a chunk whose rows have been moved
+   * elsewhere. Operators that already hold the old chunk can continue to use it. The replacement must have the same
+   * columns and MVCC setting.
+   */
+  void replace_chunk(ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk);
 
   /** @} */
 
@@ -114,7 +136,7 @@ class Table : private Noncopyable {
    * @{
    */
 
-  // inserts a row at the end of the table
+  // inserts a row at the end of the table (or of its partition, if the table is partitioned)
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
@@ -144,37 +166,182 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
-  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
+  /**
+   * @defgroup Insertion chunks, the mutable chunks that the Insert operator appends to
+   *
+   * Each insertion chunk is used by the Inserts running on a share of the Workers and has a mutex of its own, so that
+   * concurrent Inserts reserve their rows independently instead of serializing on the last chunk of the table. Once
+   * the chunk of an insertion chunk is full, it is sealed, i.e., left to the ChunkCompressionManager, and a new mutable
+   * chunk is appended to the table for it.
+   *
+   * By default, a table has a single insertion chunk, so rows are appended in the order in which they are inserted.
+   * With more insertion chunks, up to that many chunks of the table are mutable and partially filled at a time.
+   * @{
+   */
 
-  std::shared_ptr<TableStatistics> table_statistics() { return _table_statistics; }
-  std::shared_ptr<const TableStatistics> table_statistics() const { return _table_statistics; }
+  struct InsertionChunk {
+    // Held by an Insert while it reserves its rows
+    std::mutex mutex;
+
+    // Only changed while holding both the mutex above and the append mutex of the table
+    ChunkID chunk_id{INVALID_CHUNK_ID};
+
+    // Set for the insertion chunks of the partitions of a partitioned table, whose chunks only hold rows of their
+    // partition
+    std::optional<PartitionID> partition_id;
+  };
+
+  // Must not be called while Inserts into the table are running. Partitioned tables have one insertion chunk per
+  // partition instead (see insertion_chunk(PartitionID)).
+  void set_insertion_chunk_count(const size_t insertion_chunk_count);
+  size_t insertion_chunk_count() const;
+
+  // Returns the insertion chunk for Inserts running on the calling thread
+  InsertionChunk& insertion_chunk();
+
+  // Returns the insertion chunk of a partition of a partitioned table
+  InsertionChunk& insertion_chunk(const PartitionID partition_id);
+
+  /**
+   * Returns the id of a mutable chunk with free space for @param insertion_chunk, whose mutex the caller has to hold.
+   * If its current chunk is full or has been encoded, it is replaced with the last chunk of the table if that one is
+   * mutable, has free space, and is not used by another insertion chunk, or with a new mutable chunk otherwise.
+   */
+  ChunkID open_insertion_chunk(InsertionChunk& insertion_chunk);
+
+  /** @} */
+
+  /**
+   * @defgroup Partitioning, see TablePartitioning
+   * @{
+   */
+
+  // Only data tables without chunks can be partitioned, as the rows of the existing chunks would not be routed
+  void set_partitioning(const std::shared_ptr<const TablePartitioning>& partitioning);
+
+  // nullptr if the table is not partitioned
+  const std::shared_ptr<const TablePartitioning>& partitioning() const;
+
+  /** @} */
+
+  // The statistics are replaced when they become stale (see StoredTableNode), so they are accessed atomically
+  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) {
+    std::atomic_store(&_table_statistics, table_statistics);
+  }
+
+  std::shared_ptr<TableStatistics> table_statistics() { return std::atomic_load(&_table_statistics); }
+  std::shared_ptr<const TableStatistics> table_statistics() const { return std::atomic_load(&_table_statistics); }
 
   std::vector<IndexInfo> get_indexes() const;
 
+  // Registers an index that was created on the chunks directly (e.g., by the IndexAdvisorPlugin), so that the optimizer
+  // considers it. Does nothing if an index of the same type on the same columns is already registered.
+  void add_index_info(const IndexInfo& index_info);
+  void remove_index_info(const std::vector<ColumnID>& column_ids, const SegmentIndexType index_type);
+
   template <typename Index>
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
     SegmentIndexType index_type = get_index_type_of<Index>();
 
-    for (auto& chunk : _chunks) {
-      chunk->create_index<Index>(column_ids);
-    }
+    // The indexes of the chunks are independent of each other and are built in parallel
+    _for_each_chunk_in_parallel([&](const std::shared_ptr<Chunk>& chunk) { chunk->create_index<Index>(column_ids); });
     IndexInfo i = {column_ids, name, index_type};
+    std::lock_guard<std::mutex> lock(_indexes_mutex);
     _indexes.emplace_back(i);
   }
 
+  /**
+   * @defgroup Key constraints, see TableConstraintDefinition
+   * @{
+   */
+
+  // Fail()s if a column does not exist, if a second primary key is added, or if a column of a primary key is nullable
+  void add_unique_constraint(const std::vector<ColumnID>& columns,
+                             const IsPrimaryKey is_primary_key = IsPrimaryKey::No);
+  const std::vector<TableConstraintDefinition>& get_unique_constraints() const;
+
+  // The referenced table does not need to exist yet
+  void add_foreign_key_constraint(const std::vector<ColumnID>& columns, const std::string& referenced_table_name,
+                                  const std::vector<ColumnID>& referenced_columns);
+  const std::vector<ForeignKeyConstraintDefinition>& get_foreign_key_constraints() const;
+
+  /** @} */
+
+  /**
+   * @defgroup Table indexes, which span all chunks (see TableIndex)
+   * @{
+   */
+
+  // Creates a TableIndex on the column and adds all existing rows. Rows added later are indexed automatically.
+  void create_table_index(const ColumnID column_id);
+
+  // Returns the TableIndex on the column, or nullptr if there is none
+  std::shared_ptr<BaseTableIndex> get_table_index(const ColumnID column_id) const;
+
+  const std::vector<std::shared_ptr<BaseTableIndex>>& table_indexes() const;
+
+  // Adds the rows [begin_offset, end_offset) of the chunk to all table indexes. This is called by the Insert operator,
+  // which writes into the segments directly.
+  void add_to_table_indexes(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
+  /** @} */
+
+  /**
+   * Keeps @param memory_resource alive as long as this table, because data referenced by the table (e.g., the PosLists
+   * of its ReferenceSegments) was allocated from it. Used for the ArenaMemoryResource of a query, whose intermediate
+   * results might outlive the query plan.
+   */
+  void retain_memory_resource(const std::shared_ptr<boost::container::pmr::memory_resource>& memory_resource);
+  const std::vector<std::shared_ptr<boost::container::pmr::memory_resource>>& retained_memory_resources() const;
+
+  /**
+   * @defgroup Versions of the contents of the table, e.g., to invalidate cached query results (see SQLResultCache)
+   * @{
+   */
+
+  // The CommitID of the last committed transaction that inserted or deleted rows of the table
+  CommitID last_commit_id() const;
+
+  // Called when a transaction that modified the table commits. Commits may be processed out of order, so the highest
+  // CommitID is kept.
+  void register_commit(const CommitID commit_id);
+
+  // Incremented whenever rows or chunks are appended outside of a transaction, e.g., while the table is loaded
+  uint64_t direct_append_count() const;
+
+  /** @} */
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
   size_t estimate_memory_usage() const;
 
  protected:
+  // Runs the functor for each chunk as a job of the current scheduler and waits for all of them
+  void _for_each_chunk_in_parallel(const std::function<void(const std::shared_ptr<Chunk>&)>& functor);
+
+  // Appends the rows of the ValueSegments to the chunks returned by @param open_chunk, see append_columns()
+  void _append_columns(const Segments& segments, const std::function<ChunkID()>& open_chunk);
+
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
   const uint32_t _max_chunk_size;
+  // Declared before _chunks, so that the memory resources outlive the chunks
+  std::vector<std::shared_ptr<boost::container::pmr::memory_resource>> _retained_memory_resources;
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
+  std::vector<std::unique_ptr<InsertionChunk>> _insertion_chunks;
+  std::shared_ptr<const TablePartitioning> _partitioning;
+  std::vector<std::unique_ptr<InsertionChunk>> _partition_insertion_chunks;
   std::vector<IndexInfo> _indexes;
+  // The IndexAdvisorPlugin adds and removes index infos while queries are optimized
+  mutable std::mutex _indexes_mutex;
+  std::vector<TableConstraintDefinition> _unique_constraints;
+  std::vector<ForeignKeyConstraintDefinition> _foreign_key_constraints;
+  std::vector<std::shared_ptr<BaseTableIndex>> _table_indexes;
+  std::atomic<CommitID> _last_commit_id{0};
+  std::atomic<uint64_t> _direct_append_count{0};
 };
 }  // namespace opossum
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class IsPrimaryKey : bool { Yes = true, No = false };
+
+/**
+ * The values of the columns, taken together, are unique within the table. The columns of a primary key must not be
+ * nullable. The constraints are declared by the user and are not checked when rows are added, the optimizer trusts
+ * them.
+ */
+struct TableConstraintDefinition final {
+  std::vector<ColumnID> columns;
+  IsPrimaryKey is_primary_key{IsPrimaryKey::No};
+};
+
+/**
+ * Each row whose values in the columns are not NULL has a matching row in the referenced columns of the referenced
+ * table. Like the unique constraints, it is not checked.
+ */
+struct ForeignKeyConstraintDefinition final {
+  std::vector<ColumnID> columns;
+  std::string referenced_table_name;
+  std::vector<ColumnID> referenced_columns;
+};
+
+}  // namespace opossum
@@ -0,0 +1,204 @@
+#include "table_partitioning.hpp"
+
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::shared_ptr<const TablePartitioning> TablePartitioning::range(const ColumnID column_id, const DataType data_type,
+                                                                  const std::vector<AllTypeVariant>& bounds) {
+  auto typed_bounds = std::vector<AllTypeVariant>{};
+  typed_bounds.reserve(bounds.size());
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    for (const auto& bound : bounds) {
+      Assert(!variant_is_null(bound), "The bounds of a range partitioning must not be NULL.");
+      const auto typed_bound = type_cast_variant<ColumnDataType>(bound);
+      Assert(typed_bounds.empty() || boost::get<ColumnDataType>(typed_bounds.back()) < typed_bound,
+             "The bounds of a range partitioning have to be strictly ascending.");
+      typed_bounds.emplace_back(typed_bound);
+    }
+  });
+
+  return std::make_shared<TablePartitioning>(PartitionType::Range, column_id, data_type, typed_bounds,
+                                             typed_bounds.size() + 1);
+}
+
+std::shared_ptr<const TablePartitioning> TablePartitioning::hash(const ColumnID column_id, const DataType data_type,
+                                                                 const size_t partition_count) {
+  Assert(partition_count > 0, "Need at least one partition.");
+  return std::make_shared<TablePartitioning>(PartitionType::Hash, column_id, data_type, std::vector<AllTypeVariant>{},
+                                             partition_count);
+}
+
+TablePartitioning::TablePartitioning(const PartitionType type, const ColumnID column_id, const DataType data_type,
+                                     const std::vector<AllTypeVariant>& bounds, const size_t partition_count)
+    : _type(type), _column_id(column_id), _data_type(data_type), _bounds(bounds), _partition_count(partition_count) {
+  DebugAssert(type == PartitionType::Hash || partition_count == bounds.size() + 1,
+              "A range partitioning has one partition more than bounds.");
+}
+
+PartitionType TablePartitioning::type() const { return _type; }
+
+ColumnID TablePartitioning::column_id() const { return _column_id; }
+
+DataType TablePartitioning::data_type() const { return _data_type; }
+
+size_t TablePartitioning::partition_count() const { return _partition_count; }
+
+const std::vector<AllTypeVariant>& TablePartitioning::bounds() const { return _bounds; }
+
+PartitionID TablePartitioning::partition_of(const AllTypeVariant& value) const {
+  if (variant_is_null(value)) return PartitionID{0};
+
+  auto partition_id = PartitionID{0};
+  resolve_data_type(_data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    partition_id = partition_of<ColumnDataType>(type_cast_variant<ColumnDataType>(value));
+  });
+  return partition_id;
+}
+
+std::vector<Segments> TablePartitioning::partition_segments(const Segments& segments,
+                                                            const std::vector<bool>& nullable) const {
+  DebugAssert(_column_id < segments.size(), "Segments do not contain the partition column.");
+  DebugAssert(nullable.size() == segments.size(), "Expected the nullability of each segment.");
+
+  const auto& partition_segment = *segments[_column_id];
+  const auto row_count = partition_segment.size();
+
+  // The partition of each row
+  auto partition_ids = std::vector<PartitionID>(row_count, PartitionID{0});
+  if (partition_segment.data_type() == _data_type) {
+    resolve_data_type(_data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      segment_iterate<ColumnDataType>(partition_segment, [&](const auto& position) {
+        if (position.is_null()) return;
+        partition_ids[position.chunk_offset()] = partition_of<ColumnDataType>(position.value());
+      });
+    });
+  } else {
+    // Values of other types, e.g., from the dummy table used to insert NULLs, are converted via AllTypeVariants
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      partition_ids[chunk_offset] = partition_of(partition_segment[chunk_offset]);
+    }
+  }
+
+  auto segments_per_partition = std::vector<Segments>(_partition_count);
+  for (auto column_id = ColumnID{0}; column_id < segments.size(); ++column_id) {
+    resolve_data_type(segments[column_id]->data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto values = std::vector<pmr_concurrent_vector<ColumnDataType>>(_partition_count);
+      auto null_values = std::vector<pmr_concurrent_vector<bool>>(_partition_count);
+
+      segment_iterate<ColumnDataType>(*segments[column_id], [&](const auto& position) {
+        const auto partition_id = partition_ids[position.chunk_offset()];
+        values[partition_id].push_back(position.is_null() ? ColumnDataType{} : position.value());
+        if (nullable[column_id]) null_values[partition_id].push_back(position.is_null());
+      });
+
+      for (auto partition_id = size_t{0}; partition_id < _partition_count; ++partition_id) {
+        if (nullable[column_id]) {
+          segments_per_partition[partition_id].emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(
+              std::move(values[partition_id]), std::move(null_values[partition_id])));
+        } else {
+          segments_per_partition[partition_id].emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values[partition_id])));
+        }
+      }
+    });
+  }
+
+  return segments_per_partition;
+}
+
+std::vector<bool> TablePartitioning::matching_partitions(const PredicateCondition condition,
+                                                         const AllTypeVariant& value,
+                                                         const std::optional<AllTypeVariant>& value2) const {
+  auto matching = std::vector<bool>(_partition_count, true);
+  const auto match_only = [&](const PartitionID first, const PartitionID last) {
+    for (auto partition_id = PartitionID{0}; partition_id < _partition_count; ++partition_id) {
+      matching[partition_id] = partition_id >= first && partition_id <= last;
+    }
+  };
+
+  if (condition == PredicateCondition::IsNull) {
+    match_only(PartitionID{0}, PartitionID{0});
+    return matching;
+  }
+
+  // Only values that are converted to the column type without changing them can be used to rule out partitions, e.g.,
+  // a long value might not fit into an int column
+  const auto is_exactly_convertible = [&](const AllTypeVariant& variant) {
+    if (variant_is_null(variant)) return false;
+    const auto variant_data_type = data_type_from_all_type_variant(variant);
+    return variant_data_type == _data_type ||
+           (variant_data_type == DataType::Int && (_data_type == DataType::Long || _data_type == DataType::Double)) ||
+           (variant_data_type == DataType::Float && _data_type == DataType::Double);
+  };
+  if (!is_exactly_convertible(value) || (value2 && !is_exactly_convertible(*value2))) return matching;
+
+  const auto last_partition_id = PartitionID{static_cast<PartitionID::base_type>(_partition_count - 1)};
+
+  switch (condition) {
+    case PredicateCondition::Equals: {
+      const auto partition_id = partition_of(value);
+      match_only(partition_id, partition_id);
+    } break;
+
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+      if (_type == PartitionType::Range) match_only(PartitionID{0}, partition_of(value));
+      break;
+
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      if (_type == PartitionType::Range) match_only(partition_of(value), last_partition_id);
+      break;
+
+    case PredicateCondition::Between:
+      if (_type == PartitionType::Range && value2) match_only(partition_of(value), partition_of(*value2));
+      break;
+
+    default:
+      break;
+  }
+
+  return matching;
+}
+
+bool TablePartitioning::is_co_partitioned_with(const TablePartitioning& other) const {
+  return _type == other._type && _data_type == other._data_type && _partition_count == other._partition_count &&
+         _bounds == other._bounds;
+}
+
+std::string TablePartitioning::description() const {
+  std::stringstream stream;
+  stream << (_type == PartitionType::Range ? "RANGE" : "HASH") << " (column #" << _column_id << ") ";
+  if (_type == PartitionType::Range) {
+    stream << "[";
+    for (auto bound_idx = size_t{0}; bound_idx < _bounds.size(); ++bound_idx) {
+      stream << (bound_idx > 0 ? ", " : "") << _bounds[bound_idx];
+    }
+    stream << "]";
+  } else {
+    stream << _partition_count << " partitions";
+  }
+  return stream.str();
+}
+
+}  // namespace opossum
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/chunk.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class PartitionType { Range, Hash };
+
+/**
+ * Declares how the rows of a table are split into partitions by the values of one column. Each chunk of a
+ * partitioned table only holds rows of a single partition (see Chunk::partition_id()), because the Insert operator
+ * and Table::append_columns() route the rows to chunks of their partition. This allows the ChunkPruningRule to skip
+ * all chunks of the partitions that cannot match a predicate on the partition column, independent of the chunk
+ * statistics, and co-partitioned tables to be joined partition by partition (see JoinPartitionWise).
+ *
+ *   Range    Partition i holds the values in [bounds[i - 1], bounds[i]), so there is one partition more than bounds.
+ *            E.g., the bounds {2018, 2019} create the partitions (-inf, 2018), [2018, 2019), and [2019, inf).
+ *   Hash     Partition i holds the values whose std::hash modulo the partition count is i.
+ *
+ * NULLs are put into the first partition.
+ */
+class TablePartitioning final {
+ public:
+  // The bounds are converted to the data type of the column and have to be strictly ascending
+  static std::shared_ptr<const TablePartitioning> range(const ColumnID column_id, const DataType data_type,
+                                                        const std::vector<AllTypeVariant>& bounds);
+  static std::shared_ptr<const TablePartitioning> hash(const ColumnID column_id, const DataType data_type,
+                                                       const size_t partition_count);
+
+  TablePartitioning(const PartitionType type, const ColumnID column_id, const DataType data_type,
+                    const std::vector<AllTypeVariant>& bounds, const size_t partition_count);
+
+  PartitionType type() const;
+  ColumnID column_id() const;
+  DataType data_type() const;
+  size_t partition_count() const;
+
+  // Empty for hash partitionings
+  const std::vector<AllTypeVariant>& bounds() const;
+
+  // The partition of a value of the partition column, which is converted to its data type if necessary
+  PartitionID partition_of(const AllTypeVariant& value) const;
+
+  // T has to be the data type of the partition column
+  template <typename T>
+  PartitionID partition_of(const T& value) const {
+    if (_type == PartitionType::Hash) {
+      return PartitionID{static_cast<PartitionID::base_type>(std::hash<T>{}(value) % _partition_count)};
+    }
+
+    const auto bound_it = std::upper_bound(_bounds.cbegin(), _bounds.cend(), value,
+                                           [](const T& lhs, const AllTypeVariant& bound) {
+                                             return lhs < boost::get<T>(bound);
+                                           });
+    return PartitionID{static_cast<PartitionID::base_type>(std::distance(_bounds.cbegin(), bound_it))};
+  }
+
+  /**
+   * Splits the rows of @param segments (one per column of the table, of any segment type) by the partition of their
+   * value in column_id(). Returns one set of ValueSegments per partition, which are empty for partitions without rows.
+   * The ValueSegments keep the data types of the input segments and are nullable as given by @param nullable.
+   */
+  std::vector<Segments> partition_segments(const Segments& segments, const std::vector<bool>& nullable) const;
+
+  /**
+   * Returns for each partition whether it might contain rows for which `<partition column> <condition> value` (or
+   * BETWEEN value AND value2) holds. Used for pruning, so this is conservative: all partitions are returned as
+   * matching if the predicate does not allow ruling any of them out, e.g., for LIKE or for ranges on hash partitions.
+   */
+  std::vector<bool> matching_partitions(const PredicateCondition condition, const AllTypeVariant& value,
+                                        const std::optional<AllTypeVariant>& value2 = std::nullopt) const;
+
+  // Whether equal values of the two partition columns are always in partitions with the same id, so that joining
+  // the tables on their partition columns only needs to join partitions with the same id
+  bool is_co_partitioned_with(const TablePartitioning& other) const;
+
+  // E.g., "RANGE (column #1) [2018, 2019]" or "HASH (column #0) 8 partitions"
+  std::string description() const;
+
+ private:
+  const PartitionType _type;
+  const ColumnID _column_id;
+  const DataType _data_type;
+  const std::vector<AllTypeVariant> _bounds;
+  const size_t _partition_count;
+};
+
+}  // namespace opossum
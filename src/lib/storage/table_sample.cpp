@@ -0,0 +1,26 @@
+#include "table_sample.hpp"
+
+#include <optional>
+#include <ostream>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableSample::TableSample(const TableSampleMethod method, const double fraction, const std::optional<uint32_t>& seed)
+    : method(method), fraction(fraction), seed(seed) {
+  Assert(fraction > 0.0 && fraction <= 1.0, "The sample fraction has to be greater than 0 and at most 1.");
+}
+
+bool TableSample::operator==(const TableSample& rhs) const {
+  return method == rhs.method && fraction == rhs.fraction && seed == rhs.seed;
+}
+
+std::ostream& operator<<(std::ostream& stream, const TableSample& table_sample) {
+  stream << (table_sample.method == TableSampleMethod::System ? "SYSTEM" : "BERNOULLI");
+  stream << " (" << table_sample.fraction * 100 << "%)";
+  if (table_sample.seed) stream << " REPEATABLE (" << *table_sample.seed << ")";
+  return stream;
+}
+
+}  // namespace opossum
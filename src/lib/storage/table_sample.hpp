@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <ostream>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * How a random sample of the rows of a stored table is drawn (like TABLESAMPLE in SQL:2003):
+ *  - System: each chunk is part of the sample with the probability fraction, i.e., all or none of its rows are.
+ *            Sampled chunks are output as they are, so this costs next to nothing, but the sample is only as random as
+ *            the distribution of the values over the chunks.
+ *  - Bernoulli: each row is part of the sample with the probability fraction. The output references the sampled rows.
+ */
+enum class TableSampleMethod { System, Bernoulli };
+
+struct TableSample final {
+  TableSample(const TableSampleMethod method, const double fraction,
+              const std::optional<uint32_t>& seed = std::nullopt);
+
+  bool operator==(const TableSample& rhs) const;
+
+  TableSampleMethod method;
+
+  // Between 0 (exclusive) and 1 (inclusive)
+  double fraction;
+
+  // Samples drawn with the same seed from the same table are the same (like REPEATABLE in SQL). Without a seed, each
+  // execution draws a different sample.
+  std::optional<uint32_t> seed;
+};
+
+// E.g., "BERNOULLI (10%) REPEATABLE (42)"
+std::ostream& operator<<(std::ostream& stream, const TableSample& table_sample);
+
+}  // namespace opossum
@@ -1,9 +1,11 @@
 #include "value_segment.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -22,38 +24,50 @@ ValueSegment<T>::ValueSegment(bool nullable) : BaseValueSegment(data_type_from_t
 
 template <typename T>
 ValueSegment<T>::ValueSegment(const PolymorphicAllocator<T>& alloc, bool nullable)
-    : BaseValueSegment(data_type_from_type<T>()), _values(alloc) {
+    : BaseValueSegment(data_type_from_type<T>()), _values(alloc), _string_prefixes(alloc) {
   if (nullable) _null_values = pmr_concurrent_vector<bool>(alloc);
 }
 
 template <typename T>
 ValueSegment<T>::ValueSegment(pmr_concurrent_vector<T>&& values, const PolymorphicAllocator<T>& alloc)
-    : BaseValueSegment(data_type_from_type<T>()), _values(std::move(values), alloc) {}
+    : BaseValueSegment(data_type_from_type<T>()), _values(std::move(values), alloc), _string_prefixes(alloc) {
+  _append_string_prefixes(_values.cbegin(), _values.cend());
+}
 
 template <typename T>
 ValueSegment<T>::ValueSegment(pmr_concurrent_vector<T>&& values, pmr_concurrent_vector<bool>&& null_values,
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(std::move(values), alloc),
-      _null_values({std::move(null_values), alloc}) {
+      _null_values({std::move(null_values), alloc}),
+      _string_prefixes(alloc) {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
+  _update_may_contain_null_values();
+  _append_string_prefixes(_values.cbegin(), _values.cend());
 }
 
 template <typename T>
 ValueSegment<T>::ValueSegment(const std::vector<T>& values, const PolymorphicAllocator<T>& alloc)
-    : BaseValueSegment(data_type_from_type<T>()), _values(values, alloc) {}
+    : BaseValueSegment(data_type_from_type<T>()), _values(values, alloc), _string_prefixes(alloc) {
+  _append_string_prefixes(_values.cbegin(), _values.cend());
+}
 
 template <typename T>
 ValueSegment<T>::ValueSegment(std::vector<T>&& values, const PolymorphicAllocator<T>& alloc)
-    : BaseValueSegment(data_type_from_type<T>()), _values(std::move(values), alloc) {}
+    : BaseValueSegment(data_type_from_type<T>()), _values(std::move(values), alloc), _string_prefixes(alloc) {
+  _append_string_prefixes(_values.cbegin(), _values.cend());
+}
 
 template <typename T>
 ValueSegment<T>::ValueSegment(const std::vector<T>& values, std::vector<bool>& null_values,
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(values, alloc),
-      _null_values(pmr_concurrent_vector<bool>(null_values, alloc)) {
+      _null_values(pmr_concurrent_vector<bool>(null_values, alloc)),
+      _string_prefixes(alloc) {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
+  _update_may_contain_null_values();
+  _append_string_prefixes(_values.cbegin(), _values.cend());
 }
 
 template <typename T>
@@ -61,8 +75,11 @@ ValueSegment<T>::ValueSegment(std::vector<T>&& values, std::vector<bool>&& null_
                               const PolymorphicAllocator<T>& alloc)
     : BaseValueSegment(data_type_from_type<T>()),
       _values(std::move(values), alloc),
-      _null_values(pmr_concurrent_vector<bool>(std::move(null_values), alloc)) {
+      _null_values(pmr_concurrent_vector<bool>(std::move(null_values), alloc)),
+      _string_prefixes(alloc) {
   DebugAssert(values.size() == null_values.size(), "The number of values and null values should be equal");
+  _update_may_contain_null_values();
+  _append_string_prefixes(_values.cbegin(), _values.cend());
 }
 
 template <typename T>
@@ -71,7 +88,7 @@ const AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset)
   PerformanceWarning("operator[] used");
 
   // Segment supports null values and value is null
-  if (is_nullable() && _null_values->at(chunk_offset)) {
+  if (may_contain_null_values() && _null_values->at(chunk_offset)) {
     return NULL_VALUE;
   }
 
@@ -81,7 +98,7 @@ const AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset)
 template <typename T>
 const std::optional<T> ValueSegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
   // Column supports null values and value is null
-  if (is_nullable() && (*_null_values)[chunk_offset]) {
+  if (may_contain_null_values() && (*_null_values)[chunk_offset]) {
     return std::nullopt;
   }
   return _values[chunk_offset];
@@ -89,36 +106,78 @@ const std::optional<T> ValueSegment<T>::get_typed_value(const ChunkOffset chunk_
 
 template <typename T>
 bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
-  return is_nullable() && (*_null_values)[chunk_offset];
+  return may_contain_null_values() && (*_null_values)[chunk_offset];
 }
 
 template <typename T>
 const T ValueSegment<T>::get(const ChunkOffset chunk_offset) const {
   DebugAssert(chunk_offset != INVALID_CHUNK_OFFSET, "Passed chunk offset must be valid.");
 
-  Assert(!is_nullable() || !(*_null_values).at(chunk_offset), "Can’t return value of segment type because it is null.");
+  Assert(!may_contain_null_values() || !(*_null_values).at(chunk_offset),
+         "Can’t return value of segment type because it is null.");
   return _values.at(chunk_offset);
 }
 
 template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& val) {
   bool is_null = variant_is_null(val);
+  Assert(is_nullable() || !is_null, "ValueSegments is not nullable but value passed is null.");
 
   if (is_nullable()) {
+    if (is_null) _may_contain_null_values.store(true, std::memory_order_relaxed);
     (*_null_values).push_back(is_null);
-    _values.push_back(is_null ? T{} : type_cast_variant<T>(val));
-    return;
   }
 
-  Assert(!is_null, "ValueSegments is not nullable but value passed is null.");
+  auto value = is_null ? T{} : type_cast_variant<T>(val);
+  _append_string_prefixes(&value, &value + 1);
+  _values.push_back(std::move(value));
+}
+
+template <typename T>
+void ValueSegment<T>::append_values(const BaseValueSegment& source, const ChunkOffset offset,
+                                    const ChunkOffset length) {
+  const auto* typed_source = dynamic_cast<const ValueSegment<T>*>(&source);
+  Assert(typed_source, "Can only append values from a ValueSegment of the same data type.");
+  DebugAssert(offset + length <= typed_source->size(), "Values to append are out of range.");
+
+  const auto values_begin = typed_source->values().cbegin() + offset;
+  const auto values_end = values_begin + length;
+
+  if (typed_source->may_contain_null_values()) {
+    append_values(values_begin, values_end, typed_source->null_values().cbegin() + offset);
+  } else {
+    append_values(values_begin, values_end);
+  }
+}
+
+template <typename T>
+void ValueSegment<T>::append_values(ValueSegment<T>&& source) {
+  const auto values_begin = std::make_move_iterator(source._values.begin());
+  const auto values_end = std::make_move_iterator(source._values.end());
+  if (source.is_nullable()) {
+    append_values(values_begin, values_end, source._null_values->cbegin());
+    source._null_values->clear();
+  } else {
+    append_values(values_begin, values_end);
+  }
+
+  source._values.clear();
+  source._string_prefixes.clear();
+}
 
-  _values.push_back(type_cast_variant<T>(val));
+template <typename T>
+void ValueSegment<T>::grow_to_at_least(const size_t size) {
+  if (_null_values) _null_values->grow_to_at_least(size, false);
+  // The default prefix is the prefix of the empty string
+  if constexpr (std::is_same_v<T, std::string>) _string_prefixes.grow_to_at_least(size);
+  _values.grow_to_at_least(size);
 }
 
 template <typename T>
 void ValueSegment<T>::reserve(const size_t capacity) {
   _values.reserve(capacity);
   if (_null_values) _null_values->reserve(capacity);
+  if constexpr (std::is_same_v<T, std::string>) _string_prefixes.reserve(capacity);
 }
 
 template <typename T>
@@ -127,8 +186,8 @@ const pmr_concurrent_vector<T>& ValueSegment<T>::values() const {
 }
 
 template <typename T>
-pmr_concurrent_vector<T>& ValueSegment<T>::values() {
-  return _values;
+const pmr_concurrent_vector<StringPrefix>& ValueSegment<T>::string_prefixes() const {
+  return _string_prefixes;
 }
 
 template <typename T>
@@ -147,9 +206,24 @@ template <typename T>
 pmr_concurrent_vector<bool>& ValueSegment<T>::null_values() {
   DebugAssert(is_nullable(), "This ValueSegment does not support null values.");
 
+  // The caller might write NULLs through the returned reference
+  _may_contain_null_values.store(true, std::memory_order_relaxed);
+
   return *_null_values;
 }
 
+template <typename T>
+bool ValueSegment<T>::may_contain_null_values() const {
+  return _may_contain_null_values.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void ValueSegment<T>::_update_may_contain_null_values() {
+  const auto contains_null_values =
+      std::any_of(_null_values->cbegin(), _null_values->cend(), [](const auto is_null) { return is_null; });
+  _may_contain_null_values.store(contains_null_values, std::memory_order_relaxed);
+}
+
 template <typename T>
 size_t ValueSegment<T>::size() const {
   return _values.size();
@@ -169,7 +243,8 @@ std::shared_ptr<BaseSegment> ValueSegment<T>::copy_using_allocator(const Polymor
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
-  return sizeof(*this) + _values.size() * sizeof(T) + (_null_values ? _null_values->size() * sizeof(bool) : 0u);
+  return sizeof(*this) + _values.size() * sizeof(T) + (_null_values ? _null_values->size() * sizeof(bool) : 0u) +
+         _string_prefixes.size() * sizeof(StringPrefix);
 }
 
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueSegment);
@@ -1,12 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "base_value_segment.hpp"
+#include "string_prefix.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -45,6 +51,55 @@ class ValueSegment : public BaseValueSegment {
   // Add a value to the end of the segment.
   void append(const AllTypeVariant& val) final;
 
+  // Add the values in [values_begin, values_end) to the end of the segment. This is much cheaper than appending them
+  // one by one, as no AllTypeVariants are created and the vectors grow only once. If the segment is nullable, the
+  // values are marked as not NULL.
+  template <typename ValueIterator>
+  void append_values(ValueIterator values_begin, ValueIterator values_end) {
+    if (_null_values) _null_values->grow_by(std::distance(values_begin, values_end), false);
+    _append_string_prefixes(values_begin, values_end);
+    _values.grow_by(values_begin, values_end);
+  }
+
+  // Same as above, but null_values_begin points to a bool for each value that is true if the value is NULL. The
+  // values at NULL positions are stored, but never read.
+  template <typename ValueIterator, typename NullValueIterator>
+  void append_values(ValueIterator values_begin, ValueIterator values_end, NullValueIterator null_values_begin) {
+    const auto null_values_end = std::next(null_values_begin, std::distance(values_begin, values_end));
+    const auto has_null_values =
+        std::any_of(null_values_begin, null_values_end, [](const bool is_null) { return is_null; });
+
+    if (!is_nullable()) {
+      Assert(!has_null_values, "ValueSegments is not nullable but values passed are null.");
+      _append_string_prefixes(values_begin, values_end);
+      _values.grow_by(values_begin, values_end);
+      return;
+    }
+
+    if (has_null_values) _may_contain_null_values.store(true, std::memory_order_relaxed);
+    _null_values->grow_by(null_values_begin, null_values_end);
+    _append_string_prefixes(values_begin, values_end);
+    _values.grow_by(values_begin, values_end);
+  }
+
+  // Add `length` values of `source`, which must be a ValueSegment of the same type, starting at `offset`.
+  void append_values(const BaseValueSegment& source, const ChunkOffset offset, const ChunkOffset length) final;
+
+  // Moves all values of `source`, which is not used afterwards, to the end of the segment. Strings are moved instead
+  // of copied. `source` is left empty.
+  void append_values(ValueSegment<T>&& source);
+
+  // Appends default-constructed values that are not NULL until the segment holds at least `size` values. Like
+  // append_values(), this is safe to call concurrently with readers. Used by writers that reserve rows first and fill
+  // them later via set_value(), e.g., Insert.
+  void grow_to_at_least(const size_t size);
+
+  // Overwrites the value at `chunk_offset`. Whether the value is NULL is not changed.
+  void set_value(const ChunkOffset chunk_offset, T value) {
+    if constexpr (std::is_same_v<T, std::string>) _string_prefixes[chunk_offset] = StringPrefix::of(value);
+    _values[chunk_offset] = std::move(value);
+  }
+
   // Allocate enough space to hold at least @param capacity entries
   void reserve(const size_t capacity) final;
 
@@ -52,7 +107,17 @@ class ValueSegment : public BaseValueSegment {
   // access more than a single value anyway.
   // e.g. auto& values = segment.values(); and then: values.at(i); in your loop.
   const pmr_concurrent_vector<T>& values() const;
-  pmr_concurrent_vector<T>& values();
+
+  // Strings are only written through the methods above, which keep their prefixes in sync. For
+  // ValueSegment<std::string>, this overload does not exist, so that values() always returns the const vector.
+  template <typename U = T, typename = std::enable_if_t<!std::is_same_v<U, std::string>>>
+  pmr_concurrent_vector<T>& values() {
+    return _values;
+  }
+
+  // The prefixes of the values of a ValueSegment<std::string> (see StringPrefix), empty for other types. The prefix of
+  // a value is written before the value, so that readers may access the prefixes up to the size of values().
+  const pmr_concurrent_vector<StringPrefix>& string_prefixes() const;
 
   // Return whether segment supports null values.
   bool is_nullable() const final;
@@ -61,9 +126,12 @@ class ValueSegment : public BaseValueSegment {
   // Throws exception if is_nullable() returns false
   // This is the preferred method to check a for a null value at a certain index.
   // Usually you need to access more than a single value anyway.
+  // Note that requesting the mutable null value vector marks the segment as possibly containing NULLs.
   const pmr_concurrent_vector<bool>& null_values() const final;
   pmr_concurrent_vector<bool>& null_values() final;
 
+  bool may_contain_null_values() const final;
+
   // Return the number of entries in the segment.
   size_t size() const final;
 
@@ -79,6 +147,25 @@ class ValueSegment : public BaseValueSegment {
   // (e.g. DictionarySegment) do not. For this reason, we need to store the nullable information separately
   // in the table's definition.
   std::optional<pmr_concurrent_vector<bool>> _null_values;
+
+  // Maintained on writes so that readers can skip the null value vector, which is the common case for columns that
+  // are declared nullable but never hold NULLs. Atomic because Insert writes NULLs concurrently.
+  std::atomic_bool _may_contain_null_values{false};
+
+  pmr_concurrent_vector<StringPrefix> _string_prefixes;
+
+ private:
+  void _update_may_contain_null_values();
+
+  template <typename ValueIterator>
+  void _append_string_prefixes(ValueIterator values_begin, ValueIterator values_end) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      auto prefix_it = _string_prefixes.grow_by(std::distance(values_begin, values_end));
+      for (auto value_it = values_begin; value_it != values_end; ++value_it, ++prefix_it) {
+        *prefix_it = StringPrefix::of(*value_it);
+      }
+    }
+  }
 };
 
 }  // namespace opossum
@@ -32,6 +32,8 @@ class NullValueVectorIterable : public PointAccessibleSegmentIterable<NullValueV
     functor(begin, end);
   }
 
+  size_t _on_size() const { return _null_values.size(); }
+
  private:
   const pmr_concurrent_vector<bool>& _null_values;
 
@@ -17,7 +17,10 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
   template <typename Functor>
   void _on_with_iterators(const Functor& functor) const {
-    if (_segment.is_nullable()) {
+    _segment.access_statistics().on_sequential_scan(_segment.size());
+
+    // Nullable segments without NULLs use the cheaper iterators of non-nullable segments
+    if (_segment.may_contain_null_values()) {
       auto begin = Iterator{_segment.values().cbegin(), _segment.values().cbegin(), _segment.null_values().cbegin()};
       auto end = Iterator{_segment.values().cbegin(), _segment.values().cend(), _segment.null_values().cend()};
       functor(begin, end);
@@ -30,7 +33,9 @@ class ValueSegmentIterable : public PointAccessibleSegmentIterable<ValueSegmentI
 
   template <typename Functor>
   void _on_with_iterators(const std::shared_ptr<const PosList>& position_filter, const Functor& functor) const {
-    if (_segment.is_nullable()) {
+    _segment.access_statistics().on_point_access(position_filter->size());
+
+    if (_segment.may_contain_null_values()) {
       auto begin = PointAccessIterator{_segment.values(), _segment.null_values(), position_filter->cbegin(),
                                        position_filter->cbegin()};
       auto end = PointAccessIterator{_segment.values(), _segment.null_values(), position_filter->cbegin(),
@@ -53,8 +53,8 @@ void SimdBp128Compressor::_finish() {
     _pack_incomplete_meta_block();
   }
 
-  // Resize vector to actual size
-  _data->resize(_data_index);
+  // Resize vector to actual size, the padding is zero-initialized
+  _data->resize(_data_index + Packing::trailing_padding);
   _data->shrink_to_fit();
 }
 
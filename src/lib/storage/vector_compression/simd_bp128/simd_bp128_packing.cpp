@@ -1,12 +1,29 @@
 #include "simd_bp128_packing.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <utility>
 
 #include "utils/assert.hpp"
 
 // When casting into this data type, make sure that the underlying data is properly aligned to 16 byte boundaries.
 using simd_type = uint32_t __attribute__((vector_size(16)));
 
+// The 256-bit and 512-bit unpacking needs constant shuffles across registers and is only available on x86-64
+#if defined(__x86_64__) && defined(__has_builtin)
+#if __has_builtin(__builtin_shufflevector)
+#define SIMD_BP128_WIDE_UNPACKING 1
+#endif
+#endif
+
+#if SIMD_BP128_WIDE_UNPACKING
+using simd_type_256 = uint32_t __attribute__((vector_size(32)));
+using simd_type_512 = uint32_t __attribute__((vector_size(64)));
+#endif
+
+// Used for code that needs to be compiled for the instruction set of its caller (see unpack_block_512)
+#define SIMD_BP128_ALWAYS_INLINE __attribute__((always_inline))
+
 namespace opossum {
 
 namespace {
@@ -76,10 +93,15 @@ struct Pack128Bit<bit_size, carry_over, 0u> {
 
 /**
  * @brief Unpacks 128 unsigned integers with the specified bit size
+ *
+ * Each unpacked group of four integers is passed to the consumer, which
+ * either stores them (see StoreConsumer) or directly evaluates a predicate
+ * on them (see RangeMatchConsumer).
  */
 template <uint8_t bit_size, uint8_t carry_over = 0u, uint8_t remaining_recursions = bit_size>
 struct Unpack128Bit {
-  void operator()(const simd_type* in, simd_type* out, simd_type& in_reg, simd_type& out_reg,
+  template <typename Consumer>
+  void operator()(const simd_type* in, Consumer& out, simd_type& in_reg, simd_type& out_reg,
                   const simd_type& mask) const {
     constexpr auto BITS_IN_WORD = 32u;
 
@@ -89,7 +111,7 @@ struct Unpack128Bit {
     for (auto i = 0u; i < I_MAX; ++i) {
       const auto offset = carry_over + i * bit_size;
       out_reg = (in_reg >> offset) & mask;
-      *out++ = out_reg;
+      out(out_reg);
     }
 
     constexpr auto NEXT_OFFSET = carry_over + I_MAX * bit_size;
@@ -101,7 +123,7 @@ struct Unpack128Bit {
       in_reg = *in++;
 
       out_reg = out_reg | ((in_reg << NUM_FIRST_BITS) & mask);
-      *out++ = out_reg;
+      out(out_reg);
     } else {
       constexpr auto LAST_RECURSION = 1u;
 
@@ -119,15 +141,150 @@ struct Unpack128Bit {
 
 template <uint8_t bit_size, uint8_t carry_over>
 struct Unpack128Bit<bit_size, carry_over, 0u> {
-  void operator()(const simd_type* in, simd_type* out, simd_type& in_reg, simd_type& out_reg,
+  template <typename Consumer>
+  void operator()(const simd_type* in, Consumer& out, simd_type& in_reg, simd_type& out_reg,
                   const simd_type& mask) const {}
 };
 
+// Writes the unpacked integers to memory
+struct StoreConsumer {
+  void operator()(const simd_type& reg) { *out++ = reg; }
+
+  simd_type* out;
+};
+
+/**
+ * Checks whether the unpacked integers lie in the include range but not in the exclude range and appends the result
+ * as four bits to a 128-bit match mask. A range check is done with one subtraction and one unsigned comparison:
+ * begin <= x < end  <=>  x - begin < end - begin (unsigned)
+ */
+struct RangeMatchConsumer {
+  void operator()(const simd_type& reg) {
+    // Vector comparisons yield -1 (all bits set) for true and 0 for false in each lane
+    const auto included = (simd_type)((reg - include_begin) < include_width);  // NOLINT
+    const auto excluded = (simd_type)((reg - exclude_begin) < exclude_width);  // NOLINT
+
+    static constexpr simd_type lane_bits = {1u, 2u, 4u, 8u};
+    const auto bits = included & ~excluded & lane_bits;
+    const auto nibble = uint64_t{bits[0] | bits[1] | bits[2] | bits[3]};
+
+    out[index / 64u] |= nibble << (index % 64u);
+    index += 4u;
+  }
+
+  const simd_type include_begin;
+  const simd_type include_width;
+  const simd_type exclude_begin;
+  const simd_type exclude_width;
+  uint64_t* out;
+  uint32_t index{0u};
+};
+
+/**
+ * Calls functor with std::integral_constant<uint8_t, bit_size> for bit sizes in [1, 32]
+ */
+template <uint8_t bit_size = 1u, typename Functor>
+inline SIMD_BP128_ALWAYS_INLINE void resolve_bit_size(const uint8_t runtime_bit_size, const Functor& functor) {
+  if constexpr (bit_size <= 32u) {
+    if (runtime_bit_size == bit_size) {
+      functor(std::integral_constant<uint8_t, bit_size>{});
+      return;
+    }
+    resolve_bit_size<bit_size + 1u>(runtime_bit_size, functor);
+  } else {
+    Fail("Bit size must be in range [0, 32]");
+  }
+}
+
 void unpack_128_zeros(uint32_t* out) {
   static constexpr auto NUM_ZEROES = 128u;
   std::fill(out, out + NUM_ZEROES, 0u);
 }
 
+#if SIMD_BP128_WIDE_UNPACKING
+
+/**
+ * @brief Unpacks 128 unsigned integers with the specified bit size using 256-bit or 512-bit registers
+ *
+ * Unpack128Bit produces four consecutive integers per step, one from each 32-bit sub-block. Here, a register holds
+ * the integers of several steps (eight or sixteen consecutive integers), so that they are written with a single store.
+ * The packed format is the same. For each integer, the 32-bit word that holds its first bits and the following word of
+ * the same sub-block (for integers that are split) are picked from a window of packed 128-bit words with constant
+ * shuffles. The positions and shifts only depend on the bit size and are computed at compile time.
+ *
+ * The window of the last integers may extend past the end of the block, which is why compressed vectors are followed
+ * by SimdBp128Packing::trailing_padding words. Words outside the block only end up in bits that are masked out.
+ */
+template <typename Register, uint8_t bit_size>
+struct WideUnpack {
+  static constexpr auto LANES = sizeof(Register) / sizeof(uint32_t);
+
+  // The window consists of two registers with LANES / 4 words of 128 bits each
+  static constexpr auto WORDS_PER_REGISTER = LANES / 4u;
+
+  static_assert(2u * WORDS_PER_REGISTER <= SimdBp128Packing::trailing_padding, "Padding is too small for window.");
+
+  // Bit offset of an integer within its 32-bit sub-block column
+  static constexpr size_t bit_offset(const size_t index) { return (index / 4u) * bit_size; }
+
+  // The first word of the window of a chunk, i.e., of LANES consecutive integers
+  static constexpr size_t window_begin(const size_t chunk) { return bit_offset(chunk * LANES) / 32u; }
+
+  // The position of the 32-bit word within the window that holds the first (or, if next, the remaining) bits
+  static constexpr int source(const size_t chunk, const size_t lane, const size_t next) {
+    const auto index = chunk * LANES + lane;
+    return static_cast<int>((bit_offset(index) / 32u + next - window_begin(chunk)) * 4u + index % 4u);
+  }
+
+  static constexpr uint32_t shift(const size_t chunk, const size_t lane) {
+    return static_cast<uint32_t>(bit_offset(chunk * LANES + lane) % 32u);
+  }
+
+  template <size_t chunk, size_t... lane>
+  static SIMD_BP128_ALWAYS_INLINE void unpack_chunk(const uint128_t* in, uint32_t* out, const Register& mask,
+                                                    std::index_sequence<lane...>) {
+    Register first_half;
+    Register second_half;
+    std::memcpy(&first_half, in + window_begin(chunk), sizeof(Register));
+    std::memcpy(&second_half, in + window_begin(chunk) + WORDS_PER_REGISTER, sizeof(Register));
+
+    const Register words = __builtin_shufflevector(first_half, second_half, source(chunk, lane, 0u)...);
+    const Register next_words = __builtin_shufflevector(first_half, second_half, source(chunk, lane, 1u)...);
+
+    // (x << (31 - s)) << 1 is x << (32 - s), but zero instead of undefined for s = 0
+    constexpr Register shifts = {shift(chunk, lane)...};
+    constexpr Register next_shifts = {(31u - shift(chunk, lane))...};
+    const Register values = ((words >> shifts) | ((next_words << next_shifts) << 1u)) & mask;
+
+    std::memcpy(out + chunk * LANES, &values, sizeof(Register));
+  }
+
+  template <size_t... chunk>
+  static SIMD_BP128_ALWAYS_INLINE void unpack(const uint128_t* in, uint32_t* out, std::index_sequence<chunk...>) {
+    const auto mask = Register{} + static_cast<uint32_t>((1ul << bit_size) - 1);
+    (unpack_chunk<chunk>(in, out, mask, std::make_index_sequence<LANES>{}), ...);
+  }
+
+  static SIMD_BP128_ALWAYS_INLINE void unpack(const uint128_t* in, uint32_t* out) {
+    unpack(in, out, std::make_index_sequence<SimdBp128Packing::block_size / LANES>{});
+  }
+};
+
+// Compiled for the respective instruction set, only called if the CPU supports it
+__attribute__((target("avx2"))) void unpack_block_256(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
+  resolve_bit_size(bit_size, [&](auto bit_size_c) SIMD_BP128_ALWAYS_INLINE {
+    WideUnpack<simd_type_256, decltype(bit_size_c)::value>::unpack(in, out);
+  });
+}
+
+__attribute__((target("avx512f"))) void unpack_block_512(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
+  resolve_bit_size(bit_size, [&](auto bit_size_c) SIMD_BP128_ALWAYS_INLINE {
+    WideUnpack<simd_type_512, decltype(bit_size_c)::value>::unpack(in, out);
+  });
+}
+
+#endif
+
 }  // namespace
 
 void SimdBp128Packing::write_meta_info(const uint8_t* in, uint128_t* out) {
@@ -291,14 +448,40 @@ void SimdBp128Packing::pack_block(const uint32_t* in, uint128_t* out, const uint
   }
 }
 
+uint32_t SimdBp128Packing::max_register_width() {
+#if SIMD_BP128_WIDE_UNPACKING
+  static const auto register_width = []() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return 512u;
+    if (__builtin_cpu_supports("avx2")) return 256u;
+    return 128u;
+  }();
+  return register_width;
+#else
+  return 128u;
+#endif
+}
+
 void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size) {
+  unpack_block(in, out, bit_size, max_register_width());
+}
+
+void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size,
+                                    const uint32_t register_width) {
+  DebugAssert(register_width <= max_register_width(), "Register width is not supported by this CPU.");
+
   if (bit_size == 0u) {
     unpack_128_zeros(out);
     return;
   }
 
+#if SIMD_BP128_WIDE_UNPACKING
+  if (register_width >= 512u) return unpack_block_512(in, out, bit_size);
+  if (register_width >= 256u) return unpack_block_256(in, out, bit_size);
+#endif
+
   auto simd_in = reinterpret_cast<const simd_type*>(in);
-  auto simd_out = reinterpret_cast<simd_type*>(out);
+  auto simd_out = StoreConsumer{reinterpret_cast<simd_type*>(out)};
 
   simd_type in_reg = *simd_in++;
   simd_type out_reg = {0, 0, 0, 0};
@@ -439,4 +622,43 @@ void SimdBp128Packing::unpack_block(const uint128_t* in, uint32_t* out, const ui
   }
 }
 
+void SimdBp128Packing::match_block(const uint128_t* in, uint64_t* out, const uint8_t bit_size,
+                                   const MatchRanges& ranges) {
+  out[0] = 0u;
+  out[1] = 0u;
+
+  if (bit_size == 0u) {
+    // All 128 integers are zero, so the predicate only needs to be evaluated once
+    const auto included = (0u - ranges.include_begin) < (ranges.include_end - ranges.include_begin);
+    const auto excluded = (0u - ranges.exclude_begin) < (ranges.exclude_end - ranges.exclude_begin);
+    if (included && !excluded) {
+      out[0] = ~uint64_t{0u};
+      out[1] = ~uint64_t{0u};
+    }
+    return;
+  }
+
+  auto simd_in = reinterpret_cast<const simd_type*>(in);
+
+  simd_type in_reg = *simd_in++;
+  simd_type out_reg = {0, 0, 0, 0};
+  auto one_mask = static_cast<unsigned int>((1ul << bit_size) - 1);
+  const simd_type mask = {one_mask, one_mask, one_mask, one_mask};
+
+  const auto include_width = ranges.include_end - ranges.include_begin;
+  const auto exclude_width = ranges.exclude_end - ranges.exclude_begin;
+
+  auto consumer = RangeMatchConsumer{simd_type{ranges.include_begin, ranges.include_begin, ranges.include_begin,
+                                               ranges.include_begin},
+                                     simd_type{include_width, include_width, include_width, include_width},
+                                     simd_type{ranges.exclude_begin, ranges.exclude_begin, ranges.exclude_begin,
+                                               ranges.exclude_begin},
+                                     simd_type{exclude_width, exclude_width, exclude_width, exclude_width},
+                                     out};
+
+  resolve_bit_size(bit_size, [&](auto bit_size_c) {
+    Unpack128Bit<decltype(bit_size_c)::value>{}(simd_in, consumer, in_reg, out_reg, mask);
+  });
+}
+
 }  // namespace opossum
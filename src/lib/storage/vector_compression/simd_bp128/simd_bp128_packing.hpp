@@ -20,12 +20,42 @@ class SimdBp128Packing {
   static constexpr auto blocks_in_meta_block = 16u;
   static constexpr auto meta_block_size = block_size * blocks_in_meta_block;
 
+  // Number of 128-bit words that follow the packed data, as unpacking may read past the end of the last block
+  static constexpr auto trailing_padding = 8u;
+
  public:
   static void write_meta_info(const uint8_t* in, uint128_t* out);
   static void read_meta_info(const uint128_t* in, uint8_t* out);
 
   static void pack_block(const uint32_t* in, uint128_t* out, const uint8_t bit_size);
+
+  /**
+   * Unpacks a block using 128-bit, 256-bit (AVX2), or 512-bit (AVX-512) registers. The packed format is the same for
+   * all register widths. Without register_width, the widest registers supported by the CPU (checked at runtime via
+   * CPUID) are used.
+   */
   static void unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size);
+  static void unpack_block(const uint128_t* in, uint32_t* out, const uint8_t bit_size, const uint32_t register_width);
+
+  static uint32_t max_register_width();
+
+  /**
+   * Unsigned integers x are matched iff include_begin <= x < include_end and not exclude_begin <= x < exclude_end.
+   * Empty ranges (begin == end) are allowed. An empty exclude range excludes nothing.
+   */
+  struct MatchRanges {
+    uint32_t include_begin;
+    uint32_t include_end;
+    uint32_t exclude_begin{0u};
+    uint32_t exclude_end{0u};
+  };
+
+  /**
+   * @brief Evaluates a range predicate on a packed block without writing the unpacked integers to memory
+   *
+   * Writes a 128-bit mask into out (two 64-bit words), where bit i is set iff the i-th integer matches.
+   */
+  static void match_block(const uint128_t* in, uint64_t* out, const uint8_t bit_size, const MatchRanges& ranges);
 };
 
 }  // namespace opossum
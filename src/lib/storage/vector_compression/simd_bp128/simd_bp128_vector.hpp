@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
 #include "oversized_types.hpp"
@@ -38,6 +41,55 @@ class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
 
   std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const;
 
+  /**
+   * @brief Calls functor(index) for every index whose value lies in the given ranges
+   *
+   * The predicate is evaluated on four values at a time while they are unpacked (see SimdBp128Packing::match_block),
+   * so the vector is never decompressed into memory. Indices are passed in ascending order.
+   */
+  template <typename Functor>
+  void for_each_match(const SimdBp128Packing::MatchRanges& ranges, const Functor& functor) const {
+    using Packing = SimdBp128Packing;
+    static constexpr auto bits_in_word = 64u;
+
+    alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+    auto match_mask = std::array<uint64_t, Packing::block_size / bits_in_word>{};
+
+    auto data_index = size_t{0u};
+    for (auto meta_block_begin = size_t{0u}; meta_block_begin < _size; meta_block_begin += Packing::meta_block_size) {
+      Packing::read_meta_info(_data.data() + data_index++, meta_info.data());
+
+      for (auto block_index = 0u; block_index < Packing::blocks_in_meta_block; ++block_index) {
+        const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+        if (block_begin >= _size) return;
+
+        const auto bit_size = meta_info[block_index];
+        Packing::match_block(_data.data() + data_index, match_mask.data(), bit_size, ranges);
+        data_index += bit_size;
+
+        // The last block is padded with zeros, which must not be reported as matches
+        const auto values_in_block = std::min(size_t{Packing::block_size}, _size - block_begin);
+
+        for (auto word_index = 0u; word_index < match_mask.size(); ++word_index) {
+          const auto word_begin = word_index * bits_in_word;
+          if (word_begin >= values_in_block) break;
+
+          auto word = match_mask[word_index];
+          const auto values_in_word = values_in_block - word_begin;
+          if (values_in_word < bits_in_word) {
+            word &= (uint64_t{1u} << values_in_word) - 1u;
+          }
+
+          while (word != 0u) {
+            const auto bit = static_cast<size_t>(__builtin_ctzll(word));
+            functor(block_begin + word_begin + bit);
+            word &= word - 1u;
+          }
+        }
+      }
+    }
+  }
+
  private:
   friend class SimdBp128Decompressor;
 
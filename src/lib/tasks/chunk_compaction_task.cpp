@@ -0,0 +1,84 @@
+#include "chunk_compaction_task.hpp"
+
+#include <memory>
+#include <string>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkCompactionTask::ChunkCompactionTask(const std::string& table_name, const ChunkID chunk_id)
+    : _table_name{table_name}, _chunk_id{chunk_id} {}
+
+bool ChunkCompactionTask::was_compacted() const { return _was_compacted; }
+
+bool ChunkCompactionTask::chunk_is_compactable(const std::shared_ptr<Chunk>& chunk) {
+  if (!chunk->has_mvcc_data() || chunk->is_mutable() || chunk->cleanup_commit_id()) return false;
+
+  auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_data->size(); ++chunk_offset) {
+    if (mvcc_data->begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
+  }
+
+  return true;
+}
+
+void ChunkCompactionTask::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+
+  Assert(table != nullptr, "Table does not exist.");
+  Assert(_chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
+
+  const auto chunk = table->get_chunk(_chunk_id);
+  Assert(chunk_is_compactable(chunk), "Chunk is still being modified and thus can’t be compacted.");
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  // Reference all rows of the chunk, Validate then removes the ones that are invalidated already
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->set_chunk_range(_chunk_id, ChunkOffset{0}, chunk->size());
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  }
+
+  auto chunk_table = std::make_shared<Table>(table->column_definitions(), TableType::References);
+  chunk_table->append_chunk(segments);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(chunk_table);
+  table_wrapper->execute();
+
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  // If there are no valid rows, there is nothing to move
+  if (validate->get_output()->row_count() > 0) {
+    const auto update = std::make_shared<Update>(_table_name, validate, validate);
+    update->set_transaction_context(transaction_context);
+    update->execute();
+
+    if (update->execute_failed()) {
+      transaction_context->rollback();
+      return;
+    }
+  }
+
+  transaction_context->commit();
+  chunk->set_cleanup_commit_id(transaction_context->commit_id());
+  _was_compacted = true;
+}
+
+}  // namespace opossum
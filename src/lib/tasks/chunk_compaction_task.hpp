@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "scheduler/abstract_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * @brief Moves the valid rows of a chunk to the end of its table so that the chunk's memory can be released later
+ *
+ * Deleted and updated rows stay in their chunk until the chunk is dropped, as older transactions might still see
+ * them. This task starts a transaction that updates all rows of the chunk that are visible to it with themselves.
+ * The Update re-inserts the rows at the end of the table (where the ChunkCompressionManager re-encodes them once the
+ * chunk is full) and invalidates them in the old chunk. After the commit, the chunk is marked with a cleanup commit
+ * id: transactions that started afterwards skip it in Validate and TableScan, and the ChunkCompactionManager
+ * replaces it with an empty chunk once no older transaction is active anymore. Chunk ids remain stable, so that
+ * RowIDs of other chunks are not affected.
+ *
+ * If a concurrent transaction modifies one of the rows, the compaction is rolled back and the chunk stays as it is.
+ * Only immutable chunks whose inserting transactions have all finished can be compacted.
+ */
+class ChunkCompactionTask : public AbstractTask {
+ public:
+  explicit ChunkCompactionTask(const std::string& table_name, const ChunkID chunk_id);
+
+  // Returns whether the chunk has been compacted, false if the transaction had to be rolled back
+  bool was_compacted() const;
+
+  static bool chunk_is_compactable(const std::shared_ptr<Chunk>& chunk);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::string _table_name;
+  const ChunkID _chunk_id;
+  bool _was_compacted = false;
+};
+}  // namespace opossum
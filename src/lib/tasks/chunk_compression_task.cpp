@@ -13,11 +13,13 @@
 
 namespace opossum {
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
-    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                           const SegmentEncodingSpec& segment_encoding_spec)
+    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}, segment_encoding_spec} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const SegmentEncodingSpec& segment_encoding_spec)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _segment_encoding_spec{segment_encoding_spec} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
@@ -29,20 +31,20 @@ void ChunkCompressionTask::_on_execute() {
 
     auto chunk = table->get_chunk(chunk_id);
 
-    DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    ChunkEncoder::encode_chunk(chunk, table->column_data_types(), _segment_encoding_spec);
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
   if (chunk->size() != max_chunk_size) return false;
 
   auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
-  for (const auto begin_cid : mvcc_data->begin_cids) {
-    if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_data->size(); ++chunk_offset) {
+    if (mvcc_data->begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
   }
 
   return true;
@@ -4,13 +4,14 @@
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
 class Chunk;
 
 /**
- * @brief Compresses a chunk of a table using the default encoding
+ * @brief Compresses a chunk of a table using the given (or the default) encoding
  *
  * The task compresses a chunk by sequentially compressing segments.
  * From each value segment, a dictionary segment is created that replaces the
@@ -32,22 +33,24 @@ class Chunk;
  */
 class ChunkCompressionTask : public AbstractTask {
  public:
-  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
-  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                const SegmentEncodingSpec& segment_encoding_spec = {});
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                const SegmentEncodingSpec& segment_encoding_spec = {});
 
- protected:
-  void _on_execute() override;
-
- private:
   /**
    * @brief Checks if a chunks is completed
    *
    * See class comment for further explanation
    */
-  bool _chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+  static bool chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
+
+ protected:
+  void _on_execute() override;
 
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const SegmentEncodingSpec _segment_encoding_spec;
 };
 }  // namespace opossum
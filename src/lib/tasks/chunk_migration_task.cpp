@@ -7,6 +7,7 @@
 #include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "utils/tracing/probes.hpp"
 
 #if HYRISE_NUMA_SUPPORT
 
@@ -38,6 +39,8 @@ void ChunkMigrationTask::_on_execute() {
                 "Chunk is not completed and thus can’t be migrated.");
 
     chunk->migrate(Topology::get().get_memory_resource(_target_node_id));
+    DTRACE_PROBE3(HYRISE, CHUNK_MIGRATED, _table_name.c_str(), static_cast<ChunkID::base_type>(chunk_id),
+                  _target_node_id);
   }
 }
 
@@ -47,8 +50,8 @@ bool ChunkMigrationTask::chunk_is_completed(const std::shared_ptr<const Chunk>&
   if (chunk->has_mvcc_data()) {
     auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
 
-    for (const auto begin_cid : mvcc_data->begin_cids) {
-      if (begin_cid == MvccData::MAX_COMMIT_ID) return false;
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < mvcc_data->size(); ++chunk_offset) {
+      if (mvcc_data->begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
     }
   }
 
@@ -134,7 +134,7 @@ std::vector<double> get_node_temperatures(const std::vector<ChunkInfo>& chunk_in
 
 // Calculates chunk temperature metrics for all full chunks in all tables
 // that are stored in the supplied StorageManager.
-std::vector<ChunkInfo> collect_chunk_infos(const StorageManager& storage_manager,
+std::vector<ChunkInfo> collect_chunk_infos(StorageManager& storage_manager,
                                            const std::chrono::milliseconds& lookback,
                                            const std::chrono::milliseconds& counter_history_interval) {
   std::vector<ChunkInfo> chunk_infos;
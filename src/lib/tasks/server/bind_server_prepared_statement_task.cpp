@@ -1,12 +1,19 @@
 #include "bind_server_prepared_statement_task.hpp"
 
+#include <string>
+#include <unordered_map>
+
 #include "concurrency/transaction_manager.hpp"
+#include "expression/correlated_parameter_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "resolve_type.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_pipeline.hpp"
+#include "sql/sql_plan_cache.hpp"
 #include "storage/prepared_plan.hpp"
 
 namespace opossum {
@@ -15,6 +22,19 @@ void BindServerPreparedStatementTask::_on_execute() {
   try {
     Assert(_params.size() == _prepared_plan->parameter_ids.size(), "Prepared statement parameter count mismatch");
 
+    if (_prepared_plan->is_optimized) {
+      auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+      for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
+        parameters.emplace(_prepared_plan->parameter_ids[parameter_idx], _params[parameter_idx]);
+      }
+
+      const auto pqp = _physical_plan_template()->deep_copy();
+      pqp->set_parameters(parameters);
+
+      _promise.set_value(pqp);
+      return;
+    }
+
     auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{_params.size()};
     for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
       parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(_params[parameter_idx]);
@@ -29,4 +49,31 @@ void BindServerPreparedStatementTask::_on_execute() {
   }
 }
 
+std::shared_ptr<const AbstractOperator> BindServerPreparedStatementTask::_physical_plan_template() const {
+  // The operators evaluate the parameters as values of the data type of the CorrelatedParameterExpressions, hence the
+  // template is specific to the data types. Client SQL strings cannot contain '\0', so the key is unambiguous.
+  auto cache_key = _query + '\0';
+  for (const auto& param : _params) {
+    cache_key += std::to_string(param.which()) + ',';
+  }
+
+  if (const auto cached_physical_plan = SQLPreparedStatementPlanCache::get().try_get(cache_key)) {
+    return *cached_physical_plan;
+  }
+
+  auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{_params.size()};
+  for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
+    const auto& param = _params[parameter_idx];
+    const auto parameter_info = CorrelatedParameterExpression::ReferencedExpressionInfo{
+        data_type_from_all_type_variant(param), variant_is_null(param), "?"};
+    parameter_expressions[parameter_idx] =
+        std::make_shared<CorrelatedParameterExpression>(_prepared_plan->parameter_ids[parameter_idx], parameter_info);
+  }
+
+  const auto physical_plan = LQPTranslator{}.translate_node(_prepared_plan->instantiate(parameter_expressions));
+  SQLPreparedStatementPlanCache::get().set(cache_key, physical_plan);
+
+  return physical_plan;
+}
+
 }  // namespace opossum
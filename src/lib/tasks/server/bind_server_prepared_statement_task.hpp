@@ -10,15 +10,20 @@ class AbstractOperator;
 class PreparedPlan;
 
 // This task is used to bind the actual variables of a prepared statements and return the corresponding query plan.
+// For optimized prepared plans, the physical plan is created once per @param query and parameter data types and is
+// taken from the SQLPreparedStatementPlanCache afterwards, so that binding only copies it and sets the parameters.
 class BindServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<AbstractOperator>> {
  public:
-  BindServerPreparedStatementTask(const std::shared_ptr<PreparedPlan>& prepared_plan,
+  BindServerPreparedStatementTask(const std::string& query, const std::shared_ptr<PreparedPlan>& prepared_plan,
                                   std::vector<AllTypeVariant> params)
-      : _prepared_plan(prepared_plan), _params(std::move(params)) {}
+      : _query(query), _prepared_plan(prepared_plan), _params(std::move(params)) {}
 
  protected:
   void _on_execute() override;
 
+  std::shared_ptr<const AbstractOperator> _physical_plan_template() const;
+
+  std::string _query;
   std::shared_ptr<PreparedPlan> _prepared_plan;
   std::vector<AllTypeVariant> _params;
 };
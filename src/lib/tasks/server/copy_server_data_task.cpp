@@ -0,0 +1,215 @@
+#include "copy_server_data_task.hpp"
+
+#include <arpa/inet.h>
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <cstring>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "constant_mappings.hpp"
+#include "import_export/csv_parser.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "server/postgres_wire_handler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Converts the text format of COPY (tab-separated fields, \N for NULL, and backslash escapes) to the CSV read by the
+// CsvParser. Fields are only quoted where necessary, as the CsvParser rejects quoted numbers.
+std::string text_to_csv(const std::string& text) {
+  auto csv = std::string{};
+  csv.reserve(text.size());
+
+  auto field = std::string{};
+  auto field_is_null = false;
+  auto line_is_empty = true;
+
+  const auto finish_field = [&]() {
+    if (field_is_null) {
+      // An empty unquoted field is NULL
+    } else if (field.empty() || field.find_first_of(",\"\r\n") != std::string::npos ||
+               boost::iequals(field, ParseConfig::NULL_STRING)) {
+      csv += '"';
+      for (const auto character : field) {
+        if (character == '"') csv += '"';
+        csv += character;
+      }
+      csv += '"';
+    } else {
+      csv += field;
+    }
+    field.clear();
+    field_is_null = false;
+  };
+
+  for (auto position = size_t{0}; position < text.size(); ++position) {
+    const auto character = text[position];
+
+    // Clients may end the data with a line containing only the end-of-data marker
+    if (line_is_empty && text.compare(position, 2, "\\.") == 0) break;
+    line_is_empty = false;
+
+    if (character == '\t') {
+      finish_field();
+      csv += ',';
+    } else if (character == '\n') {
+      finish_field();
+      csv += '\n';
+      line_is_empty = true;
+    } else if (character == '\\' && position + 1 < text.size()) {
+      ++position;
+      switch (text[position]) {
+        case 'N':
+          field_is_null = true;
+          break;
+        case 't':
+          field += '\t';
+          break;
+        case 'n':
+          field += '\n';
+          break;
+        case 'r':
+          field += '\r';
+          break;
+        case 'b':
+          field += '\b';
+          break;
+        case 'f':
+          field += '\f';
+          break;
+        case 'v':
+          field += '\v';
+          break;
+        default:
+          field += text[position];
+      }
+    } else {
+      field += character;
+    }
+  }
+
+  if (!line_is_empty) {
+    finish_field();
+    csv += '\n';
+  }
+
+  return csv;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void CopyServerDataTask::_on_execute() {
+  try {
+    const auto target_table = StorageManager::get().get_table(_table_name);
+
+    const auto rows = _format == CopyFormat::Binary ? _parse_binary(*target_table) : _parse_csv(*target_table);
+    const auto row_count = rows->row_count();
+
+    if (row_count > 0) {
+      const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+      const auto table_wrapper = std::make_shared<TableWrapper>(rows);
+      table_wrapper->execute();
+
+      const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+      insert->set_transaction_context(transaction_context);
+      insert->execute();
+
+      if (insert->execute_failed()) {
+        transaction_context->rollback();
+        Fail("Inserting the copied rows failed.");
+      }
+
+      transaction_context->commit();
+    }
+
+    _promise.set_value(row_count);
+  } catch (...) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+std::shared_ptr<Table> CopyServerDataTask::_parse_csv(const Table& target_table) {
+  auto csv_meta = CsvMeta{};
+  for (auto column_id = ColumnID{0}; column_id < target_table.column_count(); ++column_id) {
+    csv_meta.columns.emplace_back(ColumnMeta{target_table.column_name(column_id),
+                                             data_type_to_string.left.at(target_table.column_data_type(column_id)),
+                                             target_table.column_is_nullable(column_id), std::nullopt});
+  }
+
+  // The data is not needed afterwards, so the CSV data is moved instead of copied
+  auto csv = _format == CopyFormat::Text ? text_to_csv(*_data) : std::move(*_data);
+
+  return CsvParser{}.parse_content(std::move(csv), csv_meta, target_table.max_chunk_size());
+}
+
+std::shared_ptr<Table> CopyServerDataTask::_parse_binary(const Table& target_table) {
+  const auto& data = *_data;
+  auto position = size_t{0};
+
+  // All numbers are in network byte order
+  const auto read_bytes = [&](const size_t size) {
+    Assert(position + size <= data.size(), "Binary COPY data ended unexpectedly.");
+    const auto bytes = data.substr(position, size);
+    position += size;
+    return bytes;
+  };
+  const auto read_int16 = [&]() {
+    auto value = uint16_t{};
+    std::memcpy(&value, read_bytes(sizeof(value)).data(), sizeof(value));
+    return static_cast<int16_t>(ntohs(value));
+  };
+  const auto read_int32 = [&]() {
+    auto value = uint32_t{};
+    std::memcpy(&value, read_bytes(sizeof(value)).data(), sizeof(value));
+    return static_cast<int32_t>(ntohl(value));
+  };
+
+  // The header consists of the signature, flags, and an extension area that we do not use
+  const auto signature = std::string("PGCOPY\n\377\r\n\0", 11);
+  Assert(read_bytes(signature.size()) == signature, "Binary COPY data has an invalid signature.");
+  read_int32();
+  read_bytes(static_cast<size_t>(read_int32()));
+
+  const auto column_count = target_table.column_count();
+  auto type_ids = std::vector<uint32_t>(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    type_ids[column_id] = PostgresWireHandler::type_id(target_table.column_data_type(column_id));
+  }
+
+  auto rows = std::make_shared<Table>(target_table.column_definitions(), TableType::Data,
+                                      target_table.max_chunk_size());
+
+  // Each row starts with its number of fields, the data ends with -1 instead
+  while (position < data.size()) {
+    const auto field_count = read_int16();
+    if (field_count == -1) break;
+    Assert(static_cast<size_t>(field_count) == column_count, "Number of fields does not match number of columns.");
+
+    auto row = std::vector<AllTypeVariant>(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      // A length of -1 denotes NULL, in which case no value bytes follow
+      const auto length = read_int32();
+      if (length == -1) {
+        row[column_id] = NullValue{};
+        continue;
+      }
+      row[column_id] = PostgresWireHandler::decode_binary_value(read_bytes(static_cast<size_t>(length)),
+                                                                type_ids[column_id]);
+    }
+    rows->append(row);
+  }
+
+  return rows;
+}
+
+}  // namespace opossum
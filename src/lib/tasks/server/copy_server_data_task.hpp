@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_server_task.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Formats of COPY, see https://www.postgresql.org/docs/current/static/sql-copy.html
+enum class CopyFormat { Text, Csv, Binary };
+
+struct CopyFromStdin {
+  std::string table_name;
+  CopyFormat format;
+};
+
+// COPY table_name TO STDOUT or COPY (query) TO STDOUT, of which we only support the Arrow format (see ArrowIpcWriter)
+struct CopyToStdout {
+  std::string table_name;
+  std::string query;
+};
+
+// This task inserts the data that a client sent after a COPY ... FROM STDIN command into the table and returns the
+// number of inserted rows. Text and CSV data is parsed in parallel chunks by the CsvParser. All rows are inserted in
+// one transaction.
+class CopyServerDataTask : public AbstractServerTask<uint64_t> {
+ public:
+  CopyServerDataTask(std::string table_name, CopyFormat format, std::shared_ptr<std::string> data)
+      : _table_name(std::move(table_name)), _format(format), _data(std::move(data)) {}
+
+ protected:
+  void _on_execute() override;
+
+  std::shared_ptr<Table> _parse_csv(const Table& target_table);
+  std::shared_ptr<Table> _parse_binary(const Table& target_table);
+
+  const std::string _table_name;
+  const CopyFormat _format;
+  const std::shared_ptr<std::string> _data;
+};
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#include "copy_server_result_task.hpp"
+
+#include <sstream>
+
+#include "import_export/arrow_ipc_writer.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void CopyServerResultTask::_on_execute() {
+  try {
+    auto table = std::shared_ptr<const Table>{};
+    if (_copy_to_stdout.query.empty()) {
+      // Not using Assert() since it includes file:line info that we don't want to hard code in tests
+      if (!StorageManager::get().has_table(_copy_to_stdout.table_name)) Fail("The specified table does not exist.");
+      table = StorageManager::get().get_table(_copy_to_stdout.table_name);
+    } else {
+      auto builder = SQLPipelineBuilder{_copy_to_stdout.query};
+      builder.with_cancellation_token(_query_cancellation_token);
+      table = builder.create_pipeline().get_result_table();
+      if (!table) Fail("COPY TO STDOUT requires a query that returns rows.");
+    }
+
+    auto result = std::make_unique<CopyServerResult>();
+    result->column_count = table->column_count();
+    result->row_count = table->row_count();
+
+    // Each chunk becomes one record batch, so that the client can process the stream batch by batch
+    const auto writer = ArrowIpcWriter{*table};
+    const auto add_message = [&](const auto& write_message) {
+      auto stream = std::ostringstream{};
+      write_message(stream);
+      result->messages.emplace_back(stream.str());
+    };
+
+    add_message([&](std::ostream& stream) { writer.write_schema(stream); });
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      add_message([&](std::ostream& stream) { writer.write_record_batch(chunk_id, stream); });
+    }
+    add_message([](std::ostream& stream) { ArrowIpcWriter::write_end_of_stream(stream); });
+
+    _promise.set_value(std::move(result));
+  } catch (...) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
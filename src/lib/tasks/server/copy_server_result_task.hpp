@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_server_task.hpp"
+#include "copy_server_data_task.hpp"
+
+namespace opossum {
+
+class CancellationToken;
+
+// The Arrow IPC stream of a COPY ... TO STDOUT, split into the messages of the stream, each of which is sent in one
+// CopyData message
+struct CopyServerResult {
+  size_t column_count;
+  uint64_t row_count;
+  std::vector<std::string> messages;
+};
+
+// This task writes a table or the result of a query as an Arrow IPC stream for a COPY ... TO STDOUT command. The
+// query is cancelled with @param cancellation_token.
+class CopyServerResultTask : public AbstractServerTask<std::unique_ptr<CopyServerResult>> {
+ public:
+  explicit CopyServerResultTask(CopyToStdout copy_to_stdout,
+                                std::shared_ptr<const CancellationToken> cancellation_token = nullptr)
+      : _copy_to_stdout(std::move(copy_to_stdout)), _query_cancellation_token(std::move(cancellation_token)) {}
+
+ protected:
+  void _on_execute() override;
+
+  const CopyToStdout _copy_to_stdout;
+  const std::shared_ptr<const CancellationToken> _query_cancellation_token;
+};
+
+}  // namespace opossum
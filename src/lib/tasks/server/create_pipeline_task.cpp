@@ -2,7 +2,12 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <regex>
+
+#include "server/server_metrics.hpp"
 #include "sql/sql_pipeline_builder.hpp"
+#include "storage/segment_access_statistics.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 
@@ -13,8 +18,19 @@ void CreatePipelineTask::_on_execute() {
     if (_allow_load_table && _is_load_table()) {
       // Try LOAD file_name table_name
       result->load_table = std::make_pair(_file_name, _table_name);
+    } else if (const auto copy_from_stdin = _copy_from_stdin()) {
+      result->copy_from_stdin = copy_from_stdin;
+    } else if (const auto copy_to_stdout = _copy_to_stdout()) {
+      result->copy_to_stdout = copy_to_stdout;
+    } else if (_is_show_stats()) {
+      result->server_metrics = ServerMetrics::get().to_table();
+    } else if (_is_show_access_statistics()) {
+      result->server_metrics = SegmentAccessStatistics::to_table();
     } else {
-      result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{_sql}.create_pipeline());
+      // Clients tend to send the same queries with different literals
+      auto builder = SQLPipelineBuilder{_sql};
+      builder.enable_parameterized_plan_cache().with_cancellation_token(_query_cancellation_token);
+      result->sql_pipeline = std::make_shared<SQLPipeline>(builder.create_pipeline());
     }
   } catch (...) {
     // Setting the exception this way ensures that the details are preserved in the futures
@@ -47,4 +63,46 @@ bool CreatePipelineTask::_is_load_table() {
   return true;
 }
 
+std::optional<CopyFromStdin> CreatePipelineTask::_copy_from_stdin() const {
+  // COPY table_name FROM STDIN, optionally followed by the format, e.g., WITH (FORMAT csv) or the legacy CSV or BINARY
+  static const auto copy_regex =
+      std::regex{R"(^\s*COPY\s+(\w+)\s+FROM\s+STDIN\b([^;]*);?[\s\0]*$)", std::regex::icase};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(_sql, match, copy_regex)) return std::nullopt;
+
+  const auto options = boost::to_upper_copy(match[2].str());
+  auto format = CopyFormat::Text;
+  if (std::regex_search(options, std::regex{R"(\bBINARY\b)"})) {
+    format = CopyFormat::Binary;
+  } else if (std::regex_search(options, std::regex{R"(\bCSV\b)"})) {
+    format = CopyFormat::Csv;
+  }
+
+  return CopyFromStdin{match[1].str(), format};
+}
+
+std::optional<CopyToStdout> CreatePipelineTask::_copy_to_stdout() const {
+  // COPY table_name TO STDOUT or COPY (query) TO STDOUT, followed by WITH (FORMAT arrow) or (FORMAT arrow)
+  static const auto copy_regex = std::regex{
+      R"(^\s*COPY\s+(?:(\w+)|\(([\s\S]*)\))\s*TO\s+STDOUT\s*(?:WITH\s*)?\(\s*FORMAT\s+'?ARROW'?\s*\)\s*;?[\s\0]*$)",
+      std::regex::icase};
+
+  auto match = std::smatch{};
+  if (!std::regex_match(_sql, match, copy_regex)) return std::nullopt;
+
+  return CopyToStdout{match[1].str(), match[2].str()};
+}
+
+bool CreatePipelineTask::_is_show_stats() const {
+  static const auto show_stats_regex = std::regex{R"(^\s*SHOW\s+STATS\s*;?[\s\0]*$)", std::regex::icase};
+  return std::regex_match(_sql, show_stats_regex);
+}
+
+bool CreatePipelineTask::_is_show_access_statistics() const {
+  static const auto show_access_statistics_regex =
+      std::regex{R"(^\s*SHOW\s+ACCESS\s+STATISTICS\s*;?[\s\0]*$)", std::regex::icase};
+  return std::regex_match(_sql, show_access_statistics_regex);
+}
+
 }  // namespace opossum
@@ -3,14 +3,22 @@
 #include <boost/thread/future.hpp>
 
 #include "abstract_server_task.hpp"
+#include "copy_server_data_task.hpp"
 
 namespace opossum {
 
+class CancellationToken;
 class SQLPipeline;
+class Table;
 
 struct CreatePipelineResult {
   std::shared_ptr<SQLPipeline> sql_pipeline;
   std::optional<std::pair<std::string, std::string>> load_table;
+  std::optional<CopyFromStdin> copy_from_stdin;
+  std::optional<CopyToStdout> copy_to_stdout;
+
+  // The result of SHOW STATS (see ServerMetrics) or SHOW ACCESS STATISTICS (see SegmentAccessStatistics)
+  std::shared_ptr<const Table> server_metrics;
 };
 
 // This task is used to parse an SQL string from a client and wrap it in an SQLPipeline. It is a separate task and not
@@ -18,8 +26,12 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  // The statements of the pipeline are cancelled with @param cancellation_token
+  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false,
+                              std::shared_ptr<const CancellationToken> cancellation_token = nullptr)
+      : _sql(sql),
+        _allow_load_table(allow_load_table),
+        _query_cancellation_token(std::move(cancellation_token)) {}
 
  protected:
   void _on_execute() override;
@@ -29,8 +41,22 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
   // interpret it as a LOAD <file-name> <table-name> command. If this doesn't work, we pass on the parse error.
   bool _is_load_table();
 
+  // The SQL parser does not support COPY ... FROM STDIN, which clients use to send data in bulk, so we detect it here.
+  // The data follows in CopyData messages of the COPY sub-protocol.
+  std::optional<CopyFromStdin> _copy_from_stdin() const;
+
+  // Likewise, COPY ... TO STDOUT (FORMAT arrow) exports a table or a query result as an Arrow IPC stream
+  std::optional<CopyToStdout> _copy_to_stdout() const;
+
+  // The SQL parser does not know SHOW STATS either, which returns the ServerMetrics as a table
+  bool _is_show_stats() const;
+
+  // SHOW ACCESS STATISTICS returns the SegmentAccessStatistics of all stored segments as a table
+  bool _is_show_access_statistics() const;
+
   const std::string _sql;
   const bool _allow_load_table;
+  const std::shared_ptr<const CancellationToken> _query_cancellation_token;
 
   std::string _file_name;
   std::string _table_name;
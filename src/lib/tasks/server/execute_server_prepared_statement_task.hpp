@@ -5,19 +5,23 @@
 namespace opossum {
 
 class AbstractOperator;
+class CancellationToken;
 class TransactionContext;
 class Table;
 
 // This task takes a query plan of a prepared statement and executes it.
 class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<const Table>> {
  public:
-  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<AbstractOperator> prepared_plan)
-      : _prepared_plan(std::move(prepared_plan)) {}
+  // The execution of the plan is cancelled with @param cancellation_token
+  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<AbstractOperator> prepared_plan,
+                                              std::shared_ptr<const CancellationToken> cancellation_token = nullptr)
+      : _prepared_plan(std::move(prepared_plan)), _query_cancellation_token(std::move(cancellation_token)) {}
 
  protected:
   void _on_execute() override;
 
   std::shared_ptr<AbstractOperator> _prepared_plan;
+  const std::shared_ptr<const CancellationToken> _query_cancellation_token;
 };
 
 }  // namespace opossum
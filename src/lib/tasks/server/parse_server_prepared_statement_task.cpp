@@ -1,20 +1,33 @@
 #include "parse_server_prepared_statement_task.hpp"
 
+#include "optimizer/optimizer.hpp"
+#include "sql/parameterize_sql.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/prepared_plan.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
 void ParseServerPreparedStatementTask::_on_execute() {
   try {
     auto pipeline_statement = SQLPipelineBuilder{_query}.create_pipeline_statement();
+    AssertInput(pipeline_statement.explain_mode() == ExplainMode::None,
+                "EXPLAIN is only supported in simple queries, not in prepared statements");
+    const auto& parsed_sql = *pipeline_statement.get_parsed_sql_statement();
     auto sql_translator = SQLTranslator{UseMvcc::Yes};
-    const auto prepared_plans = sql_translator.translate_parser_result(*pipeline_statement.get_parsed_sql_statement());
+    const auto prepared_plans = sql_translator.translate_parser_result(parsed_sql);
     Assert(prepared_plans.size() == 1u, "Only a single statement allowed in prepared statement");
 
-    auto prepared_plan =
-        std::make_unique<PreparedPlan>(prepared_plans[0], sql_translator.parameter_ids_of_value_placeholders());
+    const auto parameter_ids = sql_translator.parameter_ids_of_value_placeholders();
+    auto prepared_plan = std::make_unique<PreparedPlan>(prepared_plans[0], parameter_ids);
+
+    // If the parameters are only compared to columns, the plan is valid for all of their values and is optimized once
+    // for all executions of the statement
+    if (placeholders_are_scan_values(parsed_sql, parameter_ids.size())) {
+      prepared_plan->lqp = Optimizer::create_default_optimizer()->optimize(prepared_plan->lqp);
+      prepared_plan->is_optimized = true;
+    }
 
     _promise.set_value(std::move(prepared_plan));
   } catch (const std::exception&) {
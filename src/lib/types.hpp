@@ -40,6 +40,7 @@ STRONG_TYPEDEF(uint16_t, ColumnID);
 STRONG_TYPEDEF(uint32_t, ValueID);  // Cannot be larger than ChunkOffset
 STRONG_TYPEDEF(uint32_t, NodeID);
 STRONG_TYPEDEF(uint32_t, CpuID);
+STRONG_TYPEDEF(uint32_t, PartitionID);
 
 // Used to identify a Parameter within a (Sub)Select. This can be either a parameter of a Prepared SELECT statement
 // `SELECT * FROM t WHERE a > ?` or a correlated parameter in a Subselect.
@@ -205,6 +206,16 @@ enum class UseMvcc : bool { Yes = true, No = false };
 
 enum class CleanupTemporaries : bool { Yes = true, No = false };
 
+enum class UseQueryArena : bool { Yes = true, No = false };
+
+enum class UseParameterizedPlanCache : bool { Yes = true, No = false };
+
+enum class UseResultCache : bool { Yes = true, No = false };
+
+// EXPLAIN returns the plan of a statement instead of its result, EXPLAIN ANALYZE executes the statement first and adds
+// the measured performance of each operator, see create_explain_table()
+enum class ExplainMode { None, Plan, Analyze };
+
 // Used as a template parameter that is passed whenever we conditionally erase the type of a template. This is done to
 // reduce the compile time at the cost of the runtime performance. Examples are iterators, which are replaced by
 // AnySegmentIterators that use virtual method calls.
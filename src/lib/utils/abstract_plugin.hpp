@@ -10,11 +10,17 @@ namespace opossum {
 
 // This is necessary to make the plugin instantiable, it leads to plain C linkage to avoid
 // ugly mangled names. Use EXPORT in the implementation file of your plugin.
+// Plugins that are compiled into an executable (e.g., into the tests, which use their singletons directly) are not
+// exported, as the factories of multiple plugins would collide.
+#ifdef HYRISE_PLUGIN_COMPILED_IN
+#define EXPORT_PLUGIN(PluginName)
+#else
 #define EXPORT_PLUGIN(PluginName)                                     \
   extern "C" AbstractPlugin* factory() {                              \
     auto plugin = static_cast<AbstractPlugin*>(&(PluginName::get())); \
     return plugin;                                                    \
   }
+#endif
 
 // AbstractPlugin is the abstract super class for all plugins. An example implementation can be found
 // under test/utils/test_plugin.cpp. Usually plugins are implemented as singletons because there
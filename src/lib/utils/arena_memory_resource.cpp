@@ -0,0 +1,93 @@
+#include "arena_memory_resource.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <new>
+
+#include "utils/assert.hpp"
+#include "utils/huge_page_memory_resource.hpp"
+
+namespace opossum {
+
+ArenaMemoryResource::ArenaMemoryResource(const size_t initial_block_size) : _initial_block_size(initial_block_size) {
+  Assert(initial_block_size >= 4 * _min_alignment, "Initial block size of an arena is too small.");
+}
+
+ArenaMemoryResource::~ArenaMemoryResource() {
+  for (const auto& [pointer, alignment] : _large_allocations) {
+    if (!HugePageMemoryResource::deallocate_from_default_resource(pointer)) {
+      ::operator delete(pointer, std::align_val_t{alignment});
+    }
+  }
+}
+
+size_t ArenaMemoryResource::reserved_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _reserved_bytes;
+}
+
+void* ArenaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  DebugAssert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two.");
+
+  if (_is_large_allocation(bytes, alignment)) {
+    auto* const huge_page_resource = HugePageMemoryResource::default_resource_instance();
+    auto* const pointer = huge_page_resource && bytes >= huge_page_resource->threshold()
+                              ? huge_page_resource->allocate(bytes, alignment)
+                              : ::operator new(bytes, std::align_val_t{alignment});
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _large_allocations.emplace(pointer, alignment);
+    _reserved_bytes += bytes;
+    return pointer;
+  }
+
+  const auto size = (bytes + _min_alignment - 1) & ~(_min_alignment - 1);
+
+  // Concurrent allocations bump the offset of the current block. Whoever overshoots its capacity replaces the block.
+  while (true) {
+    auto* const block = _current_block.load();
+    if (block) {
+      const auto offset = block->offset.fetch_add(size);
+      if (offset + size <= block->capacity) return block->data.get() + offset;
+    }
+
+    _add_block(block);
+  }
+}
+
+void ArenaMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  // Memory within the blocks is only released when the arena is destroyed
+  if (!_is_large_allocation(bytes, alignment)) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    [[maybe_unused]] const auto erased_count = _large_allocations.erase(p);
+    DebugAssert(erased_count == 1, "Deallocated memory was not allocated from this arena.");
+    _reserved_bytes -= bytes;
+  }
+
+  if (!HugePageMemoryResource::deallocate_from_default_resource(p)) ::operator delete(p, std::align_val_t{alignment});
+}
+
+bool ArenaMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+bool ArenaMemoryResource::_is_large_allocation(std::size_t bytes, std::size_t alignment) const {
+  return bytes > _initial_block_size / 4 || alignment > _min_alignment;
+}
+
+void ArenaMemoryResource::_add_block(const Block* full_block) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_current_block.load() != full_block) return;
+
+  // Blocks grow geometrically, so that large queries do not need many of them. Allocations from blocks are at most a
+  // quarter of the initial block size, so they always fit into a new block.
+  const auto max_block_size = std::max(_max_block_size, _initial_block_size);
+  const auto capacity = _blocks.empty() ? _initial_block_size : std::min(_blocks.back()->capacity * 2, max_block_size);
+  _blocks.emplace_back(std::make_unique<Block>(capacity));
+  _reserved_bytes += capacity;
+
+  _current_block.store(_blocks.back().get());
+}
+
+}  // namespace opossum
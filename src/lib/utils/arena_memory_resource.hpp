@@ -0,0 +1,73 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Thread-safe monotonic memory resource for the intermediate results of a single query (see
+ * SQLPipelineBuilder::enable_query_arena()). Allocations are bump-allocated from blocks of growing size, which the
+ * jobs of all operators share without locking in the common case. Deallocating is a no-op; all blocks are released at
+ * once when the arena is destroyed. Whoever holds data allocated from the arena therefore has to keep the arena alive,
+ * see Table::retain_memory_resource().
+ *
+ * Large allocations (or those with a large alignment) would waste most of a block. They are passed to malloc, or
+ * placed on huge pages if those were enabled (see HugePageMemoryResource), and freed when they are deallocated, so
+ * that, e.g., a growing vector does not leave its old buffers in the arena.
+ */
+class ArenaMemoryResource : public boost::container::pmr::memory_resource, public Noncopyable {
+ public:
+  explicit ArenaMemoryResource(const size_t initial_block_size = size_t{1} << 20u);
+  ~ArenaMemoryResource() override;
+
+  // Number of bytes reserved for blocks and large allocations
+  size_t reserved_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  struct Block {
+    explicit Block(const size_t init_capacity) : capacity(init_capacity), data(new char[init_capacity]) {}
+
+    std::atomic<size_t> offset{0};
+    const size_t capacity;
+    const std::unique_ptr<char[]> data;
+  };
+
+  // Allocations are padded to this granularity, so that all allocations within a block are aligned to it. Blocks are
+  // allocated with new[], which aligns them at least as strictly.
+  static constexpr size_t _min_alignment = 16;
+
+  // Blocks do not grow beyond this size
+  static constexpr size_t _max_block_size = size_t{64} << 20u;
+
+  bool _is_large_allocation(std::size_t bytes, std::size_t alignment) const;
+
+  // Appends a new block to _blocks, unless another thread has already replaced @param full_block
+  void _add_block(const Block* full_block);
+
+  const size_t _initial_block_size;
+
+  std::atomic<Block*> _current_block{nullptr};
+
+  mutable std::mutex _mutex;
+  std::vector<std::unique_ptr<Block>> _blocks;
+  // Alignment of the large allocations that have not been deallocated yet
+  std::unordered_map<void*, size_t> _large_allocations;
+  size_t _reserved_bytes{0};
+};
+
+}  // namespace opossum
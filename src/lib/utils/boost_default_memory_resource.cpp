@@ -5,15 +5,32 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "utils/huge_page_memory_resource.hpp"
+
 namespace boost {
 namespace container {
 namespace pmr {
 
 class default_resource_impl : public memory_resource {  // NOLINT
  public:
-  void* do_allocate(std::size_t bytes, std::size_t alignment) override { return std::malloc(bytes); }  // NOLINT
-
-  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override { std::free(p); }  // NOLINT
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+    // Large allocations are placed on huge pages if they were enabled (see HugePageMemoryResource)
+    if (bytes >= opossum::HugePageMemoryResource::MIN_THRESHOLD) {
+      auto* const huge_page_resource = opossum::HugePageMemoryResource::default_resource_instance();
+      if (huge_page_resource && bytes >= huge_page_resource->threshold()) {
+        return huge_page_resource->allocate(bytes, alignment);
+      }
+    }
+    return std::malloc(bytes);  // NOLINT
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+    if (bytes >= opossum::HugePageMemoryResource::MIN_THRESHOLD &&
+        opossum::HugePageMemoryResource::deallocate_from_default_resource(p)) {
+      return;
+    }
+    std::free(p);  // NOLINT
+  }
 
   bool do_is_equal(const memory_resource& other) const BOOST_NOEXCEPT override { return &other == this; }
 };
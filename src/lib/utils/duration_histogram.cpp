@@ -0,0 +1,59 @@
+#include "duration_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace opossum {
+
+DurationHistogram::DurationHistogram(const DurationHistogram& other) { merge(other); }
+
+DurationHistogram& DurationHistogram::operator=(const DurationHistogram& other) {
+  for (auto bucket_id = size_t{0}; bucket_id < BUCKET_COUNT; ++bucket_id) {
+    _counts[bucket_id] = other._counts[bucket_id].load();
+  }
+  return *this;
+}
+
+void DurationHistogram::add(const std::chrono::nanoseconds duration) {
+  const auto microseconds = static_cast<uint64_t>(std::max(duration.count(), int64_t{0})) / 1'000;
+  const auto bucket_id =
+      microseconds == 0
+          ? size_t{0}
+          : std::min(size_t{64} - static_cast<size_t>(__builtin_clzll(microseconds)), BUCKET_COUNT - 1);
+  _counts[bucket_id].fetch_add(1, std::memory_order_relaxed);
+}
+
+void DurationHistogram::merge(const DurationHistogram& other) {
+  for (auto bucket_id = size_t{0}; bucket_id < BUCKET_COUNT; ++bucket_id) {
+    _counts[bucket_id].fetch_add(other._counts[bucket_id].load(), std::memory_order_relaxed);
+  }
+}
+
+uint64_t DurationHistogram::count() const {
+  auto count = uint64_t{0};
+  for (const auto& bucket_count : _counts) {
+    count += bucket_count.load();
+  }
+  return count;
+}
+
+uint64_t DurationHistogram::count_in_bucket(const size_t bucket_id) const { return _counts[bucket_id].load(); }
+
+std::chrono::microseconds DurationHistogram::bucket_upper_bound(const size_t bucket_id) {
+  return std::chrono::microseconds{int64_t{1} << bucket_id};
+}
+
+std::chrono::microseconds DurationHistogram::percentile(const double fraction) const {
+  const auto count = this->count();
+  if (count == 0) return std::chrono::microseconds{0};
+
+  const auto rank = std::max(static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count))), uint64_t{1});
+  auto cumulative_count = uint64_t{0};
+  for (auto bucket_id = size_t{0}; bucket_id < BUCKET_COUNT; ++bucket_id) {
+    cumulative_count += _counts[bucket_id].load();
+    if (cumulative_count >= rank) return bucket_upper_bound(bucket_id);
+  }
+  return bucket_upper_bound(BUCKET_COUNT - 1);
+}
+
+}  // namespace opossum
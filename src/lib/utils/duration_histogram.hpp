@@ -0,0 +1,38 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+namespace opossum {
+
+/**
+ * Histogram of durations with exponentially growing buckets: The first bucket holds the durations below 1us, bucket i
+ * those in [2^(i-1)us, 2^i us), and the last bucket all longer ones. Can be updated concurrently.
+ */
+class DurationHistogram {
+ public:
+  static constexpr size_t BUCKET_COUNT = 32;
+
+  DurationHistogram() = default;
+  DurationHistogram(const DurationHistogram& other);
+  DurationHistogram& operator=(const DurationHistogram& other);
+
+  void add(const std::chrono::nanoseconds duration);
+  void merge(const DurationHistogram& other);
+
+  uint64_t count() const;
+  uint64_t count_in_bucket(const size_t bucket_id) const;
+
+  // Exclusive upper bound of the durations in the bucket
+  static std::chrono::microseconds bucket_upper_bound(const size_t bucket_id);
+
+  // Upper bound of the given percentile (e.g., 0.99 for the p99), i.e., the upper bound of the bucket that holds it.
+  // Zero for an empty histogram.
+  std::chrono::microseconds percentile(const double fraction) const;
+
+ private:
+  std::array<std::atomic<uint64_t>, BUCKET_COUNT> _counts{};
+};
+
+}  // namespace opossum
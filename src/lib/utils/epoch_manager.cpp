@@ -0,0 +1,104 @@
+#include "epoch_manager.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+EpochManager::Guard::Guard() : _record(EpochManager::get()._thread_record()) {
+  if (_record.pin_depth++ > 0) return;
+
+  // Reading the epoch with acquire semantics makes sure that a thread that pins after retire() incremented the epoch
+  // also sees the pointer that replaced the retired version. The fence orders the announcement before all loads of
+  // published pointers and pairs with the fence in reclaim(): Either the reclaiming thread sees the announcement, or
+  // this thread sees the new pointers.
+  _record.pinned_epoch.store(EpochManager::get()._epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+EpochManager::Guard::~Guard() {
+  if (--_record.pin_depth > 0) return;
+
+  _record.pinned_epoch.store(UNPINNED, std::memory_order_release);
+}
+
+void EpochManager::retire(std::shared_ptr<const void> version) {
+  if (!version) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_retired_mutex);
+    _retired.emplace_back(_epoch.fetch_add(1), std::move(version));
+  }
+
+  reclaim();
+}
+
+size_t EpochManager::reclaim() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  auto min_pinned_epoch = UNPINNED;
+  {
+    std::lock_guard<std::mutex> lock(_thread_records_mutex);
+    for (const auto& thread_record : _thread_records) {
+      min_pinned_epoch = std::min(min_pinned_epoch, thread_record->pinned_epoch.load(std::memory_order_acquire));
+    }
+  }
+
+  // The versions are released after unlocking, as their destructors might take a while
+  auto released_versions = std::vector<std::shared_ptr<const void>>{};
+  {
+    std::lock_guard<std::mutex> lock(_retired_mutex);
+    const auto retained_end = std::partition(_retired.begin(), _retired.end(), [&](const auto& retired_version) {
+      return retired_version.first >= min_pinned_epoch;
+    });
+    std::transform(std::make_move_iterator(retained_end), std::make_move_iterator(_retired.end()),
+                   std::back_inserter(released_versions), [](auto&& retired_version) {
+                     return std::move(retired_version.second);
+                   });
+    _retired.erase(retained_end, _retired.end());
+  }
+
+  return released_versions.size();
+}
+
+size_t EpochManager::retired_count() const {
+  std::lock_guard<std::mutex> lock(_retired_mutex);
+  return _retired.size();
+}
+
+bool EpochManager::is_pinned() { return EpochManager::get()._thread_record().pin_depth > 0; }
+
+uint64_t EpochManager::current_epoch() const { return _epoch.load(); }
+
+EpochManager::ThreadRecord& EpochManager::_thread_record() {
+  // Hands the record back when the thread exits
+  struct ThreadRecordHolder {
+    ~ThreadRecordHolder() {
+      if (record) record->in_use.store(false, std::memory_order_release);
+    }
+
+    ThreadRecord* record{nullptr};
+  };
+
+  thread_local auto holder = ThreadRecordHolder{};
+  if (holder.record) return *holder.record;
+
+  std::lock_guard<std::mutex> lock(_thread_records_mutex);
+  for (const auto& thread_record : _thread_records) {
+    auto expected = false;
+    if (thread_record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+      holder.record = thread_record.get();
+      return *holder.record;
+    }
+  }
+
+  holder.record = _thread_records.emplace_back(std::make_unique<ThreadRecord>()).get();
+  holder.record->in_use = true;
+  return *holder.record;
+}
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/**
+ * Epoch-based reclamation for data structures that are replaced while other threads read them, e.g., the segments,
+ * indexes, and statistics of a Chunk. Writers publish a new version through an atomic raw pointer and hand the previous
+ * version to retire(). Readers pin the current epoch with an EpochGuard and may then dereference the published raw
+ * pointers without touching any reference counts. A retired version is only released once every thread that might
+ * have loaded its pointer has unpinned its epoch:
+ *
+ *   - Each retired version is tagged with the value of the global epoch, which retire() then increments
+ *   - Each thread that holds an EpochGuard has announced the epoch it observed when it pinned
+ *   - A retired version is released if its tag is smaller than the epoch of every pinned thread, because these threads
+ *     pinned after it was unpublished and thus can only have loaded the newer version
+ *
+ * Pinning costs a store and a fence on thread-local data and is cheaper than copying a shared_ptr, which needs two
+ * atomic read-modify-write operations on a cache line that all readers of the object share. A thread that stays
+ * pinned delays the reclamation of everything retired in the meantime, so guards should not be held across blocking
+ * operations, such as waiting for other tasks.
+ *
+ * Nested guards on the same thread are allowed and cheap; only the outermost one pins and unpins.
+ */
+class EpochManager : public Singleton<EpochManager> {
+ protected:
+  struct ThreadRecord;
+
+ public:
+  // Pins the epoch of the calling thread for its lifetime
+  class Guard final : private Noncopyable {
+   public:
+    Guard();
+    ~Guard();
+
+   private:
+    ThreadRecord& _record;
+  };
+
+  // Releases the passed version once no thread might read it anymore
+  void retire(std::shared_ptr<const void> version);
+
+  // Releases the retired versions that cannot be read anymore and returns their number. retire() calls this as well,
+  // so it only needs to be called to release memory without retiring something.
+  size_t reclaim();
+
+  // The number of retired versions that were not released yet
+  size_t retired_count() const;
+
+  // Whether the calling thread holds an EpochGuard
+  static bool is_pinned();
+
+  uint64_t current_epoch() const;
+
+ protected:
+  friend class Singleton;
+
+  EpochManager() = default;
+
+  static constexpr auto UNPINNED = std::numeric_limits<uint64_t>::max();
+
+  // The announcement of a thread. Records are not freed before the EpochManager but reused by later threads, so that
+  // the reclaiming thread can iterate over them without synchronizing with exiting threads.
+  struct ThreadRecord {
+    std::atomic<uint64_t> pinned_epoch{UNPINNED};
+    size_t pin_depth{0};
+    std::atomic_bool in_use{false};
+  };
+
+  ThreadRecord& _thread_record();
+
+  std::atomic<uint64_t> _epoch{0};
+
+  mutable std::mutex _thread_records_mutex;
+  std::vector<std::unique_ptr<ThreadRecord>> _thread_records;
+
+  mutable std::mutex _retired_mutex;
+  std::vector<std::pair<uint64_t, std::shared_ptr<const void>>> _retired;
+};
+
+using EpochGuard = EpochManager::Guard;
+
+}  // namespace opossum
@@ -0,0 +1,127 @@
+#include "file_backed_memory_resource.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+FileBackedMemoryResource::FileBackedMemoryResource(const std::string& directory, const size_t capacity)
+    : _capacity(capacity) {
+  Assert(capacity > 0, "Capacity of a file-backed memory resource must be larger than zero.");
+
+  auto path = std::vector<char>(directory.cbegin(), directory.cend());
+  const auto file_name_template = std::string{"/hyrise_tiered_XXXXXX"};
+  path.insert(path.end(), file_name_template.cbegin(), file_name_template.cend());
+  path.emplace_back('\0');
+
+  const auto file_descriptor = mkstemp(path.data());
+  Assert(file_descriptor >= 0, "Could not create file in " + directory);
+
+  // The file is only reachable through the mapping, so it is removed once the mapping is gone
+  unlink(path.data());
+
+  if (ftruncate(file_descriptor, static_cast<off_t>(capacity)) != 0) {
+    close(file_descriptor);
+    Fail("Could not resize file in " + directory);
+  }
+
+  auto* const mapping = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_NORESERVE, file_descriptor, 0);
+  // The mapping stays valid after the file descriptor is closed
+  close(file_descriptor);
+  Assert(mapping != MAP_FAILED, "Could not map file in " + directory);
+
+  _data = static_cast<char*>(mapping);
+}
+
+FileBackedMemoryResource::~FileBackedMemoryResource() { munmap(_data, _capacity); }
+
+size_t FileBackedMemoryResource::capacity() const { return _capacity; }
+
+size_t FileBackedMemoryResource::allocated_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _allocated_bytes;
+}
+
+void* FileBackedMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  // The mapping starts at a page boundary, so aligned offsets result in aligned addresses
+  DebugAssert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two.");
+  DebugAssert(alignment <= static_cast<size_t>(sysconf(_SC_PAGESIZE)), "Alignment must not exceed the page size.");
+
+  const auto size = _padded_size(bytes, alignment);
+  const auto align = [&](const size_t offset) { return (offset + alignment - 1) & ~(alignment - 1); };
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  for (auto free_range_it = _free_ranges.begin(); free_range_it != _free_ranges.end(); ++free_range_it) {
+    const auto [range_begin, range_size] = *free_range_it;
+    const auto offset = align(range_begin);
+    if (offset + size > range_begin + range_size) continue;
+
+    _free_ranges.erase(free_range_it);
+    if (offset > range_begin) _free_ranges.emplace(range_begin, offset - range_begin);
+    if (offset + size < range_begin + range_size) {
+      _free_ranges.emplace(offset + size, range_begin + range_size - offset - size);
+    }
+
+    _allocated_bytes += size;
+    return _data + offset;
+  }
+
+  const auto offset = align(_end);
+  Assert(offset + size <= _capacity, "File-backed memory resource is full.");
+  if (offset > _end) _free_ranges.emplace(_end, offset - _end);
+  _end = offset + size;
+
+  _allocated_bytes += size;
+  return _data + offset;
+}
+
+void FileBackedMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  auto offset = static_cast<size_t>(static_cast<char*>(p) - _data);
+  auto size = _padded_size(bytes, alignment);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  DebugAssert(offset + size <= _end, "Pointer was not allocated by this memory resource.");
+  _allocated_bytes -= size;
+
+  // Merge with the adjacent free ranges
+  const auto next_it = _free_ranges.lower_bound(offset);
+  if (next_it != _free_ranges.end() && next_it->first == offset + size) {
+    size += next_it->second;
+    _free_ranges.erase(next_it);
+  }
+
+  auto previous_it = _free_ranges.lower_bound(offset);
+  if (previous_it != _free_ranges.begin()) {
+    --previous_it;
+    if (previous_it->first + previous_it->second == offset) {
+      offset = previous_it->first;
+      size += previous_it->second;
+      _free_ranges.erase(previous_it);
+    }
+  }
+
+  if (offset + size == _end) {
+    _end = offset;
+  } else {
+    _free_ranges.emplace(offset, size);
+  }
+}
+
+bool FileBackedMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return this == &other; }
+
+size_t FileBackedMemoryResource::_padded_size(std::size_t bytes, std::size_t alignment) const {
+  const auto granularity = std::max(alignment, _min_alignment);
+  return std::max((bytes + granularity - 1) / granularity * granularity, granularity);
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resource that places its allocations in a file, e.g., on an SSD. The file is created in the given directory,
+ * unlinked right away (so that it is removed when the process ends), and mapped into memory with MAP_SHARED. The
+ * operating system keeps recently used pages in the page cache and writes cold pages back to the file, so data
+ * allocated here only occupies DRAM while it is accessed.
+ *
+ * The address range of `capacity` bytes is reserved upfront. The file is sparse, so only allocated pages take up space
+ * on the device. Freed ranges are merged with adjacent free ranges and reused (first fit).
+ */
+class FileBackedMemoryResource : public boost::container::pmr::memory_resource, public Noncopyable {
+ public:
+  FileBackedMemoryResource(const std::string& directory, size_t capacity);
+  ~FileBackedMemoryResource() override;
+
+  size_t capacity() const;
+
+  // Number of bytes currently handed out, including alignment padding
+  size_t allocated_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  // Allocations are padded to this granularity so that freed ranges can be reused for most requests
+  static constexpr size_t _min_alignment = 16;
+
+  size_t _padded_size(std::size_t bytes, std::size_t alignment) const;
+
+  const size_t _capacity;
+  char* _data{nullptr};
+
+  mutable std::mutex _mutex;
+
+  // Free ranges below _end, by offset
+  std::map<size_t, size_t> _free_ranges;
+
+  // Everything behind _end has never been allocated
+  size_t _end{0};
+  size_t _allocated_bytes{0};
+};
+
+}  // namespace opossum
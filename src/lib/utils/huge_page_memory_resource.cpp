@@ -0,0 +1,249 @@
+#include "huge_page_memory_resource.hpp"
+
+#include <sys/mman.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <boost/container/pmr/global_resource.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Mode of set_mempolicy(2) and mbind(2) that takes the pages from the given node as long as it has free memory left.
+// The constant is defined in numaif.h, which is only available if libnuma is installed.
+constexpr auto MPOL_PREFERRED_MODE = 1;
+
+// The instances used by the default memory resource. They are never deleted, as allocations from them may outlive the
+// settings they were made with, see the comment in boost_default_memory_resource.cpp.
+struct DefaultResourceInstances {
+  std::mutex mutex;
+  bool enabled{false};
+  size_t threshold{HugePageMemoryResource::HUGE_PAGE_BYTES};
+  HugePageSize page_size{HugePageSize::Transparent};
+
+  // The instances for the current settings, by NUMA node
+  std::map<int, HugePageMemoryResource*> current;
+  std::vector<HugePageMemoryResource*> all;
+};
+
+DefaultResourceInstances& default_resource_instances() {
+  static auto* instances = new DefaultResourceInstances();  // NOLINT
+  return *instances;
+}
+
+// The instance for the node -1, read on every large allocation of the default memory resource without locking
+std::atomic<HugePageMemoryResource*> current_default_instance{nullptr};
+std::atomic_bool any_default_instance{false};
+
+size_t round_up(const size_t bytes, const size_t granularity) {
+  return (bytes + granularity - 1) / granularity * granularity;
+}
+
+}  // namespace
+
+HugePageMemoryResource::HugePageMemoryResource(const size_t threshold, const HugePageSize page_size, const int node_id,
+                                               boost::container::pmr::memory_resource* upstream)
+    : _threshold(threshold),
+      _page_size(page_size),
+      _node_id(node_id),
+      _upstream(upstream ? upstream : boost::container::pmr::get_default_resource()) {
+  Assert(threshold > 0, "Threshold of huge page allocations must be positive.");
+}
+
+HugePageMemoryResource::~HugePageMemoryResource() {
+  for (const auto& [pointer, mapping_bytes] : _mappings) {
+    munmap(const_cast<void*>(pointer), mapping_bytes);
+  }
+}
+
+size_t HugePageMemoryResource::threshold() const { return _threshold; }
+
+HugePageSize HugePageMemoryResource::page_size() const { return _page_size; }
+
+size_t HugePageMemoryResource::mapped_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _mapped_bytes;
+}
+
+size_t HugePageMemoryResource::fallback_count() const { return _fallback_count.load(); }
+
+bool HugePageMemoryResource::owns(const void* pointer) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _mappings.count(pointer) > 0;
+}
+
+void HugePageMemoryResource::enable_for_default_resource(const size_t threshold, const HugePageSize page_size) {
+  Assert(threshold >= MIN_THRESHOLD, "Threshold of huge page allocations is too small for the default resource.");
+
+  auto& instances = default_resource_instances();
+  std::lock_guard<std::mutex> lock(instances.mutex);
+  instances.enabled = true;
+  instances.threshold = threshold;
+  instances.page_size = page_size;
+  instances.current.clear();
+
+  auto* const instance = new HugePageMemoryResource(threshold, page_size);  // NOLINT
+  instances.current.emplace(-1, instance);
+  instances.all.emplace_back(instance);
+  any_default_instance = true;
+  current_default_instance = instance;
+}
+
+void HugePageMemoryResource::disable_for_default_resource() {
+  auto& instances = default_resource_instances();
+  std::lock_guard<std::mutex> lock(instances.mutex);
+  instances.enabled = false;
+  instances.current.clear();
+  current_default_instance = nullptr;
+}
+
+HugePageMemoryResource* HugePageMemoryResource::default_resource_instance(const int node_id) {
+  if (node_id < 0) return current_default_instance.load();
+
+  auto& instances = default_resource_instances();
+  std::lock_guard<std::mutex> lock(instances.mutex);
+  if (!instances.enabled) return nullptr;
+
+  auto& instance = instances.current[node_id];
+  if (!instance) {
+    instance = new HugePageMemoryResource(instances.threshold, instances.page_size, node_id);  // NOLINT
+    instances.all.emplace_back(instance);
+  }
+  return instance;
+}
+
+bool HugePageMemoryResource::deallocate_from_default_resource(void* pointer) {
+  if (!any_default_instance.load()) return false;
+
+  auto& instances = default_resource_instances();
+  std::lock_guard<std::mutex> lock(instances.mutex);
+  return std::any_of(instances.all.cbegin(), instances.all.cend(),
+                     [&](HugePageMemoryResource* instance) { return instance->_try_unmap(pointer); });
+}
+
+void HugePageMemoryResource::advise_transparent_huge_pages(void* data, const size_t bytes) {
+#if defined(__linux__)
+  const auto* const instance = current_default_instance.load();
+  if (!instance || bytes < instance->threshold()) return;
+
+  // madvise(2) only accepts page-aligned ranges. The partial huge pages at both ends stay on regular pages.
+  const auto begin = round_up(reinterpret_cast<uintptr_t>(data), HUGE_PAGE_BYTES);
+  const auto end = (reinterpret_cast<uintptr_t>(data) + bytes) / HUGE_PAGE_BYTES * HUGE_PAGE_BYTES;
+  if (begin >= end) return;
+
+  // Failing is not an error, e.g., if transparent huge pages are disabled system-wide
+  madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+#endif
+}
+
+void* HugePageMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  if (bytes < _threshold) return _upstream->allocate(bytes, alignment);
+
+  return _map(bytes, alignment);
+}
+
+void HugePageMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  if (bytes < _threshold) {
+    _upstream->deallocate(p, bytes, alignment);
+    return;
+  }
+
+  [[maybe_unused]] const auto unmapped = _try_unmap(p);
+  DebugAssert(unmapped, "Deallocated memory was not allocated from this resource.");
+}
+
+bool HugePageMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+void* HugePageMemoryResource::_map(const size_t bytes, const size_t alignment) {
+  auto* pointer = static_cast<void*>(nullptr);
+  auto mapping_bytes = size_t{0};
+
+#if defined(__linux__)
+  if (_page_size != HugePageSize::Transparent) {
+    // Explicit huge pages are aligned to their size. Larger alignments are left to transparent huge pages.
+    const auto page_shift = _page_size == HugePageSize::Explicit2MB ? 21 : 30;
+    const auto page_bytes = size_t{1} << static_cast<size_t>(page_shift);
+    if (alignment <= page_bytes) {
+      mapping_bytes = round_up(bytes, page_bytes);
+      pointer = mmap(nullptr, mapping_bytes, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (page_shift << MAP_HUGE_SHIFT), -1, 0);
+    }
+
+    // The pool of explicit huge pages is usually small, if it was set up at all
+    if (pointer == nullptr || pointer == MAP_FAILED) {
+      pointer = nullptr;
+      ++_fallback_count;
+    }
+  }
+#endif
+
+  if (!pointer) {
+    // mmap(2) aligns mappings only to regular pages. Mapping an extra huge page and unmapping the unaligned parts
+    // at both ends lets the kernel back the mapping with huge pages from its beginning.
+    const auto mapping_alignment = std::max(HUGE_PAGE_BYTES, alignment);
+    mapping_bytes = round_up(bytes, HUGE_PAGE_BYTES);
+    auto* const unaligned_pointer = mmap(nullptr, mapping_bytes + mapping_alignment, PROT_READ | PROT_WRITE,
+                                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (unaligned_pointer == MAP_FAILED) throw std::bad_alloc{};
+
+    const auto unaligned_begin = reinterpret_cast<uintptr_t>(unaligned_pointer);
+    const auto begin = round_up(unaligned_begin, mapping_alignment);
+    const auto end = begin + mapping_bytes;
+    if (begin > unaligned_begin) munmap(unaligned_pointer, begin - unaligned_begin);
+    if (unaligned_begin + mapping_bytes + mapping_alignment > end) {
+      munmap(reinterpret_cast<void*>(end), unaligned_begin + mapping_bytes + mapping_alignment - end);
+    }
+    pointer = reinterpret_cast<void*>(begin);
+
+#if defined(__linux__)
+    // Failing is not an error, e.g., if transparent huge pages are disabled system-wide
+    madvise(pointer, mapping_bytes, MADV_HUGEPAGE);
+#endif
+  }
+
+#if defined(__linux__)
+  // The pages are only backed when they are first written to, so the policy applies to all of them. Only the first 64
+  // nodes are supported, which is enough for a single node mask.
+  if (_node_id >= 0 && _node_id < 64) {
+    const auto node_mask = uint64_t{1} << static_cast<uint64_t>(_node_id);
+    syscall(SYS_mbind, pointer, mapping_bytes, MPOL_PREFERRED_MODE, &node_mask, 64, 0);
+  }
+#endif
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _mappings.emplace(pointer, mapping_bytes);
+  _mapped_bytes += mapping_bytes;
+  return pointer;
+}
+
+bool HugePageMemoryResource::_try_unmap(void* pointer) {
+  auto mapping_bytes = size_t{0};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto mapping_it = _mappings.find(pointer);
+    if (mapping_it == _mappings.end()) return false;
+
+    mapping_bytes = mapping_it->second;
+    _mappings.erase(mapping_it);
+    _mapped_bytes -= mapping_bytes;
+  }
+
+  munmap(pointer, mapping_bytes);
+  return true;
+}
+
+}  // namespace opossum
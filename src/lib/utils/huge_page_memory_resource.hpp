@@ -0,0 +1,111 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Transparent: anonymous memory that the kernel is advised to back with transparent huge pages of 2MB (see
+ *              /sys/kernel/mm/transparent_hugepage/enabled, which has to be "madvise" or "always")
+ * Explicit2MB, Explicit1GB: huge pages reserved in the hugetlbfs pool (see /proc/sys/vm/nr_hugepages and
+ *              /sys/kernel/mm/hugepages). If the pool has no free pages left, transparent huge pages are used instead.
+ */
+enum class HugePageSize { Transparent, Explicit2MB, Explicit1GB };
+
+/**
+ * Memory resource that places large allocations on huge pages. Random accesses into large segments, hash tables, and
+ * radix partitions touch a different 4KB page nearly every time, so that most of them miss the TLB. A 2MB page covers
+ * 512 times as much memory with a single TLB entry.
+ *
+ * Allocations of at least `threshold` bytes are mapped with mmap(2), rounded up to whole huge pages. Smaller
+ * allocations would waste most of a huge page and are passed to the upstream resource. If a NUMA node is given, the
+ * huge pages are preferably taken from its memory, like the allocations of a NUMAMemoryResource.
+ *
+ * The default memory resource, which segments and operators use unless they are given another one, places large
+ * allocations on huge pages after enable_for_default_resource() was called, e.g., by the BenchmarkRunner's --huge_pages
+ * option. The arena of a query (see ArenaMemoryResource) and the NUMAMemoryResources of the Topology do the same.
+ *
+ * Huge pages are only available on Linux. Elsewhere, large allocations are still mapped, but with regular pages.
+ */
+class HugePageMemoryResource : public boost::container::pmr::memory_resource, public Noncopyable {
+ public:
+  static constexpr size_t HUGE_PAGE_BYTES = size_t{2} << 20u;
+
+  // Allocations of the default memory resource below this size are never placed on huge pages, so that freeing them
+  // does not need to check whether they were
+  static constexpr size_t MIN_THRESHOLD = HUGE_PAGE_BYTES / 2;
+
+  explicit HugePageMemoryResource(const size_t threshold = HUGE_PAGE_BYTES,
+                                  const HugePageSize page_size = HugePageSize::Transparent, const int node_id = -1,
+                                  boost::container::pmr::memory_resource* upstream = nullptr);
+  ~HugePageMemoryResource() override;
+
+  size_t threshold() const;
+  HugePageSize page_size() const;
+
+  // Number of bytes mapped for the allocations that were not passed upstream
+  size_t mapped_bytes() const;
+
+  // Number of allocations for which no explicit huge pages were left, so that transparent huge pages were used
+  size_t fallback_count() const;
+
+  // Whether @param pointer was mapped by this resource and not deallocated yet
+  bool owns(const void* pointer) const;
+
+  /**
+   * Makes the default memory resource place allocations of at least @param threshold bytes on huge pages. Calling it
+   * again replaces the settings. Allocations made with earlier settings stay valid and are freed correctly.
+   */
+  static void enable_for_default_resource(const size_t threshold = HUGE_PAGE_BYTES,
+                                          const HugePageSize page_size = HugePageSize::Transparent);
+  static void disable_for_default_resource();
+
+  /**
+   * The resource that the default memory resource passes large allocations to, nullptr if huge pages are disabled.
+   * With a @param node_id, the huge pages are taken from that NUMA node, which is used by the NUMAMemoryResources.
+   */
+  static HugePageMemoryResource* default_resource_instance(const int node_id = -1);
+
+  // Frees allocations of the default_resource_instance()s, also after huge pages were disabled. Returns false if
+  // @param pointer was not allocated by any of them.
+  static bool deallocate_from_default_resource(void* pointer);
+
+  /**
+   * Advises the kernel to back the huge-page-aligned part of a buffer of @param bytes with transparent huge pages, if
+   * huge pages are enabled for the default resource and the buffer is at least as large as its threshold. This is for
+   * large buffers that are not allocated through a memory resource, e.g., the radix partitions of the hash join.
+   * It has to be called before the buffer is written to, as the kernel backs pages when they are first touched.
+   */
+  static void advise_transparent_huge_pages(void* data, const size_t bytes);
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+  void* _map(const size_t bytes, const size_t alignment);
+
+  // Unmaps @param pointer if it was mapped by this resource
+  bool _try_unmap(void* pointer);
+
+  const size_t _threshold;
+  const HugePageSize _page_size;
+  const int _node_id;
+  boost::container::pmr::memory_resource* const _upstream;
+
+  mutable std::mutex _mutex;
+  // Size of each mapping, by its address
+  std::unordered_map<const void*, size_t> _mappings;
+  size_t _mapped_bytes{0};
+  std::atomic<size_t> _fallback_count{0};
+};
+
+}  // namespace opossum
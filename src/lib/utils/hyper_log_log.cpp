@@ -0,0 +1,115 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog(std::vector<uint32_t> sparse_registers, std::vector<uint8_t> dense_registers)
+    : _sparse_registers(std::move(sparse_registers)), _dense_registers(std::move(dense_registers)) {
+  Assert(_dense_registers.empty() || (_sparse_registers.empty() && _dense_registers.size() == REGISTER_COUNT),
+         "Expected the registers of either the sparse or the dense form.");
+}
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  const auto index = static_cast<uint32_t>(hash >> (64 - PRECISION));
+
+  // The remaining bits are shifted to the top. If they are all zero, the rank is one more than their count.
+  const auto remaining_bits = hash << PRECISION;
+  const auto rank =
+      static_cast<uint8_t>(remaining_bits == 0 ? 64 - PRECISION + 1 : __builtin_clzll(remaining_bits) + 1);
+
+  _update_register(index, rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  if (other._dense_registers.empty()) {
+    for (const auto entry : other._sparse_registers) {
+      _update_register(entry >> 8, static_cast<uint8_t>(entry & 0xFF));
+    }
+    return;
+  }
+
+  _densify();
+  for (auto index = size_t{0}; index < REGISTER_COUNT; ++index) {
+    _dense_registers[index] = std::max(_dense_registers[index], other._dense_registers[index]);
+  }
+}
+
+uint64_t HyperLogLog::estimate() const {
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+
+  // The harmonic mean of 2^rank over all registers
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  if (_dense_registers.empty()) {
+    zero_register_count = REGISTER_COUNT - _sparse_registers.size();
+    inverse_sum = static_cast<double>(zero_register_count);
+    for (const auto entry : _sparse_registers) {
+      inverse_sum += std::ldexp(1.0, -static_cast<int>(entry & 0xFF));
+    }
+  } else {
+    for (const auto rank : _dense_registers) {
+      inverse_sum += std::ldexp(1.0, -static_cast<int>(rank));
+      zero_register_count += rank == 0;
+    }
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  auto estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For few values, counting the registers that no hash selected (linear counting) is more accurate. With 64 bit
+  // hashes, there are no hash collisions to correct for large numbers of values.
+  if (estimate <= 2.5 * register_count && zero_register_count > 0) {
+    estimate = register_count * std::log(register_count / static_cast<double>(zero_register_count));
+  }
+
+  return static_cast<uint64_t>(std::llround(estimate));
+}
+
+uint64_t HyperLogLog::mix(uint64_t hash) {
+  // Finalizer of SplitMix64
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+  return hash ^ (hash >> 31);
+}
+
+bool HyperLogLog::is_sparse() const { return _dense_registers.empty(); }
+
+const std::vector<uint32_t>& HyperLogLog::sparse_registers() const { return _sparse_registers; }
+
+const std::vector<uint8_t>& HyperLogLog::dense_registers() const { return _dense_registers; }
+
+void HyperLogLog::_update_register(const uint32_t index, const uint8_t rank) {
+  if (!_dense_registers.empty()) {
+    _dense_registers[index] = std::max(_dense_registers[index], rank);
+    return;
+  }
+
+  const auto entry = index << 8 | rank;
+  const auto iter = std::lower_bound(_sparse_registers.begin(), _sparse_registers.end(), index << 8);
+  if (iter != _sparse_registers.end() && (*iter >> 8) == index) {
+    *iter = std::max(*iter, entry);
+    return;
+  }
+  _sparse_registers.insert(iter, entry);
+
+  // Switch to the dense form once it needs less memory
+  if (_sparse_registers.size() * sizeof(uint32_t) > REGISTER_COUNT) _densify();
+}
+
+void HyperLogLog::_densify() {
+  if (!_dense_registers.empty()) return;
+
+  _dense_registers.resize(REGISTER_COUNT);
+  for (const auto entry : _sparse_registers) {
+    _dense_registers[entry >> 8] = static_cast<uint8_t>(entry & 0xFF);
+  }
+  _sparse_registers = std::vector<uint32_t>{};
+}
+
+}  // namespace opossum
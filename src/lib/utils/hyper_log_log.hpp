@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch (Flajolet et al., 2007) that estimates the number of distinct values added to it with a standard
+ * error of about 1.04 / sqrt(REGISTER_COUNT), i.e., 2.3%. The sketches of two sets of values can be merged into the
+ * sketch of their union, e.g., the sketches of the chunks or threads that aggregated parts of a group.
+ *
+ * The upper PRECISION bits of the hash of a value select a register, which keeps the maximum rank (the position of the
+ * first one bit) of the remaining bits of all hashes that selected it. Sketches of few values keep their non-zero
+ * registers in a sorted list (sparse form) and only switch to an array of all registers (dense form, one byte each)
+ * once the list would need more memory, so that the sketches of many small groups stay small.
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto PRECISION = uint32_t{11};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  HyperLogLog() = default;
+
+  // Restores a sketch from the registers of another one (see sparse_registers() and dense_registers())
+  HyperLogLog(std::vector<uint32_t> sparse_registers, std::vector<uint8_t> dense_registers);
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(hash(value));
+  }
+
+  void add_hash(const uint64_t hash);
+
+  void merge(const HyperLogLog& other);
+
+  uint64_t estimate() const;
+
+  // std::hash is the identity for integers in libstdc++, so its result is mixed to spread the values over all bits
+  template <typename T>
+  static uint64_t hash(const T& value) {
+    return mix(std::hash<T>{}(value));
+  }
+
+  static uint64_t mix(uint64_t hash);
+
+  // In the sparse form, each non-zero register is stored as index << 8 | rank, sorted by the index. In the dense
+  // form, the sparse registers are empty.
+  bool is_sparse() const;
+  const std::vector<uint32_t>& sparse_registers() const;
+  const std::vector<uint8_t>& dense_registers() const;
+
+ private:
+  void _update_register(const uint32_t index, const uint8_t rank);
+  void _densify();
+
+  std::vector<uint32_t> _sparse_registers;
+  std::vector<uint8_t> _dense_registers;
+};
+
+}  // namespace opossum
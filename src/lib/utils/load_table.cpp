@@ -1,11 +1,15 @@
 #include "load_table.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "resolve_type.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_cast.hpp"
 
 #include "constant_mappings.hpp"
 #include "string_utils.hpp"
@@ -51,25 +55,63 @@ std::shared_ptr<Table> load_table(const std::string& file_name, size_t chunk_siz
 
   auto table = create_table_from_header(infile, chunk_size);
 
+  // The values are collected column by column and appended to the table one chunk at a time
+  auto string_columns = std::vector<std::vector<std::string>>(table->column_count());
+
+  const auto append_rows = [&]() {
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      const auto nullable = table->column_is_nullable(column_id);
+      auto& string_values = string_columns[column_id];
+
+      resolve_data_type(table->column_data_type(column_id), [&](const auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto values = std::vector<ColumnDataType>(string_values.size());
+        auto null_values = std::vector<bool>(nullable ? string_values.size() : 0u);
+        for (auto row_id = size_t{0}; row_id < string_values.size(); ++row_id) {
+          if (nullable && string_values[row_id] == "null") {
+            null_values[row_id] = true;
+          } else {
+            values[row_id] = type_cast<ColumnDataType>(std::move(string_values[row_id]));
+          }
+        }
+
+        if (nullable) {
+          segments.emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      });
+
+      string_values.clear();
+    }
+
+    table->append_columns(segments);
+  };
+
   std::string line;
+  auto buffered_row_count = size_t{0};
   while (std::getline(infile, line)) {
     auto string_values = split_string_by_delimiter(line, '|');
-    auto variant_values = std::vector<AllTypeVariant>(string_values.size());
-
     for (auto column_id = ColumnID{0}; column_id < string_values.size(); ++column_id) {
-      if (table->column_is_nullable(column_id) && string_values[column_id] == "null") {
-        variant_values[column_id] = NULL_VALUE;
-      } else {
-        variant_values[column_id] = AllTypeVariant{std::move(string_values[column_id])};
-      }
+      string_columns[column_id].emplace_back(std::move(string_values[column_id]));
     }
 
-    table->append(variant_values);
+    if (++buffered_row_count == chunk_size) {
+      append_rows();
+      buffered_row_count = 0;
+    }
+  }
+  if (buffered_row_count > 0) append_rows();
 
-    auto chunk = table->get_chunk(static_cast<ChunkID>(table->chunk_count() - 1));
-    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
-    mvcc_data->begin_cids.back() = 0;
+  // The loaded rows are visible to all transactions
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    auto mvcc_data = table->get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
+    std::fill(mvcc_data->begin_cids.begin(), mvcc_data->begin_cids.end(), CommitID{0});
   }
+
   return table;
 }
 
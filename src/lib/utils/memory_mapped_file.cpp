@@ -0,0 +1,67 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename) : _filename(filename) {
+  const auto file_descriptor = open(filename.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Could not open file " + filename);
+
+  struct stat file_status {};
+  if (fstat(file_descriptor, &file_status) != 0) {
+    close(file_descriptor);
+    Fail("Could not determine size of file " + filename);
+  }
+  _size = static_cast<size_t>(file_status.st_size);
+
+  // Mapping an empty file fails, there is nothing to read anyway
+  if (_size > 0) {
+    auto* const mapping = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    // The mapping stays valid after the file descriptor is closed
+    close(file_descriptor);
+    Assert(mapping != MAP_FAILED, "Could not map file " + filename);
+
+    // Files are read front to back, so the kernel can read ahead aggressively
+    madvise(mapping, _size, MADV_SEQUENTIAL);
+    const auto size = _size;
+    _mapping = std::shared_ptr<const char>(static_cast<const char*>(mapping),
+                                           [size](const char* data) { munmap(const_cast<char*>(data), size); });
+    _data = _mapping.get();
+  } else {
+    close(file_descriptor);
+  }
+}
+
+MemoryMappedFile::MemoryMappedFile(const std::string& filename, const std::shared_ptr<const char>& mapping,
+                                   const size_t size, const size_t position)
+    : _filename(filename), _mapping(mapping), _data(mapping.get()), _size(size), _position(position) {}
+
+const char* MemoryMappedFile::data() const { return _data; }
+
+size_t MemoryMappedFile::size() const { return _size; }
+
+size_t MemoryMappedFile::position() const { return _position; }
+
+const char* MemoryMappedFile::read(const size_t byte_count) {
+  Assert(byte_count <= _size - _position, "Unexpected end of file " + _filename);
+
+  const auto* const begin = _data + _position;
+  _position += byte_count;
+  return begin;
+}
+
+MemoryMappedFile MemoryMappedFile::at(const size_t position) const {
+  Assert(position <= _size, "Position is beyond the end of file " + _filename);
+  return MemoryMappedFile{_filename, _mapping, _size, position};
+}
+
+}  // namespace opossum
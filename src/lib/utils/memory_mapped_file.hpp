@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Maps a file read-only into memory. Pages are loaded by the operating system on first access, which avoids copying
+ * the file through a stream buffer. The file is read sequentially via read(), which returns a pointer into the
+ * mapping and advances the read position. Views created by at() share the mapping but have their own read position,
+ * so that different parts of the file can be read concurrently.
+ */
+class MemoryMappedFile : public Noncopyable {
+ public:
+  explicit MemoryMappedFile(const std::string& filename);
+
+  const char* data() const;
+  size_t size() const;
+
+  size_t position() const;
+
+  // Returns a pointer to the next byte_count bytes and advances the read position. Fails if the file is too short.
+  const char* read(const size_t byte_count);
+
+  // Returns a view of the same mapping that starts reading at the given position. The mapping is unmapped once the
+  // file and all of its views are destroyed.
+  MemoryMappedFile at(const size_t position) const;
+
+ private:
+  MemoryMappedFile(const std::string& filename, const std::shared_ptr<const char>& mapping, const size_t size,
+                   const size_t position);
+
+  std::string _filename;
+  std::shared_ptr<const char> _mapping;
+  const char* _data{nullptr};
+  size_t _size{0};
+  size_t _position{0};
+};
+
+}  // namespace opossum
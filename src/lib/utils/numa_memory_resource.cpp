@@ -2,6 +2,8 @@
 
 #include <string>
 
+#include "utils/huge_page_memory_resource.hpp"
+
 #if HYRISE_NUMA_SUPPORT
 #define NUMA_MEMORY_RESOURCE_ARENA_SIZE 1llu << 30u
 #else
@@ -15,10 +17,22 @@ NUMAMemoryResource::NUMAMemoryResource(int node_id, const std::string& name)
     : _memory_source(numa::MemSource::create(node_id, NUMA_MEMORY_RESOURCE_ARENA_SIZE, name.c_str())) {}
 
 void* NUMAMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  // Large allocations are placed on huge pages of the same node if they were enabled (see HugePageMemoryResource)
+  if (bytes >= HugePageMemoryResource::MIN_THRESHOLD) {
+    auto* const huge_page_resource = HugePageMemoryResource::default_resource_instance(get_node_id());
+    if (huge_page_resource && bytes >= huge_page_resource->threshold()) {
+      return huge_page_resource->allocate(bytes, alignment);
+    }
+  }
   return _memory_source.allocAligned(boost::integer::lcm(_alignment, alignment), bytes);
 }
 
-void NUMAMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) { numa::MemSource::free(p); }
+void NUMAMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  if (bytes >= HugePageMemoryResource::MIN_THRESHOLD && HugePageMemoryResource::deallocate_from_default_resource(p)) {
+    return;
+  }
+  numa::MemSource::free(p);
+}
 
 bool NUMAMemoryResource::do_is_equal(const memory_resource& other) const noexcept {
   const auto other_numa_resource = dynamic_cast<const NUMAMemoryResource*>(&other);
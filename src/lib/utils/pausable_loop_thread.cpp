@@ -3,6 +3,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -38,6 +39,16 @@ PausableLoopThread::~PausableLoopThread() {
   if (_loop_thread.joinable()) _loop_thread.join();
 }
 
+void PausableLoopThread::resume_or_create(std::unique_ptr<PausableLoopThread>& thread,
+                                          std::chrono::milliseconds loop_sleep_time,
+                                          const std::function<void(size_t)>& loop_func) {
+  if (thread) {
+    thread->resume();
+  } else {
+    thread = std::make_unique<PausableLoopThread>(loop_sleep_time, loop_func);
+  }
+}
+
 void PausableLoopThread::pause() {
   if (!_loop_thread.joinable()) return;
   _pause_requested = true;
@@ -1,7 +1,10 @@
+#pragma once
+
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -16,6 +19,12 @@ struct PausableLoopThread {
   explicit PausableLoopThread(std::chrono::milliseconds loop_sleep_time, const std::function<void(size_t)>& loop_func);
 
   ~PausableLoopThread();
+
+  // Resumes the given thread or creates it if it does not exist yet. Background components that can be started and
+  // paused use this to only spawn their thread once they are started.
+  static void resume_or_create(std::unique_ptr<PausableLoopThread>& thread, std::chrono::milliseconds loop_sleep_time,
+                               const std::function<void(size_t)>& loop_func);
+
   void pause();
   void resume();
   void set_loop_sleep_time(std::chrono::milliseconds loop_sleep_time);
@@ -0,0 +1,153 @@
+#include "performance_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace opossum {
+
+namespace {
+
+std::atomic_bool performance_counters_enabled{false};
+
+#if defined(__linux__)
+
+constexpr auto EVENT_COUNT = size_t{5};
+
+// Type and config of the counted events, in the order of the members of PerformanceCounterValues
+constexpr auto EVENTS = std::array<std::pair<uint32_t, uint64_t>, EVENT_COUNT>{
+    {{PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+     {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+     {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+     {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8u) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u)},
+     {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}}};
+
+// The counters of a single thread. They are opened as a group, so that the kernel schedules them onto the PMU together
+// and their values refer to the same period of time.
+class ThreadCounters final {
+ public:
+  ThreadCounters() {
+    for (auto event_id = size_t{0}; event_id < EVENT_COUNT; ++event_id) {
+      auto attributes = perf_event_attr{};
+      attributes.size = sizeof(perf_event_attr);
+      attributes.type = EVENTS[event_id].first;
+      attributes.config = EVENTS[event_id].second;
+      // Counting only user space events is permitted with the default perf_event_paranoid setting of most distributions
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      const auto group_fd = event_id == 0 ? -1 : _fds[0];
+      const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group_fd, 0));
+      if (fd < 0) {
+        _close();
+        return;
+      }
+      _fds[event_id] = fd;
+    }
+  }
+
+  ThreadCounters(const ThreadCounters&) = delete;
+  ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+  ~ThreadCounters() { _close(); }
+
+  std::optional<PerformanceCounterValues> read() const {
+    if (_fds[0] < 0) return std::nullopt;
+
+    // Layout of PERF_FORMAT_GROUP with both times: number of events, time enabled, time running, one value per event
+    auto buffer = std::array<uint64_t, 3 + EVENT_COUNT>{};
+    if (::read(_fds[0], buffer.data(), sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer))) return std::nullopt;
+
+    const auto time_enabled = buffer[1];
+    const auto time_running = buffer[2];
+    if (time_running == 0) return PerformanceCounterValues{};
+
+    // If more events are counted than the PMU has registers for, e.g., by another process, the kernel multiplexes the
+    // groups. The values are then extrapolated to the whole time the group was enabled.
+    const auto scale = [&](const uint64_t value) {
+      return static_cast<uint64_t>(static_cast<double>(value) * static_cast<double>(time_enabled) /
+                                   static_cast<double>(time_running));
+    };
+
+    return PerformanceCounterValues{scale(buffer[3]), scale(buffer[4]), scale(buffer[5]), scale(buffer[6]),
+                                    scale(buffer[7])};
+  }
+
+ private:
+  void _close() {
+    for (auto& fd : _fds) {
+      if (fd >= 0) close(fd);
+      fd = -1;
+    }
+  }
+
+  std::array<int, EVENT_COUNT> _fds{{-1, -1, -1, -1, -1}};
+};
+
+#endif
+
+}  // namespace
+
+PerformanceCounterValues& PerformanceCounterValues::operator+=(const PerformanceCounterValues& rhs) {
+  cycles += rhs.cycles;
+  instructions += rhs.instructions;
+  cache_misses += rhs.cache_misses;
+  tlb_misses += rhs.tlb_misses;
+  branch_misses += rhs.branch_misses;
+  return *this;
+}
+
+PerformanceCounterValues PerformanceCounterValues::operator-(const PerformanceCounterValues& rhs) const {
+  return PerformanceCounterValues{cycles - rhs.cycles, instructions - rhs.instructions,
+                                  cache_misses - rhs.cache_misses, tlb_misses - rhs.tlb_misses,
+                                  branch_misses - rhs.branch_misses};
+}
+
+double PerformanceCounterValues::instructions_per_cycle() const {
+  if (cycles == 0) return 0.0;
+  return static_cast<double>(instructions) / static_cast<double>(cycles);
+}
+
+std::string PerformanceCounterValues::to_string() const {
+  std::stringstream stream;
+  stream.precision(2);
+  stream << std::fixed << instructions_per_cycle() << " IPC (" << instructions << " instructions, " << cycles
+         << " cycles), " << cache_misses << " cache misses, " << tlb_misses << " TLB misses, " << branch_misses
+         << " branch misses";
+  return stream.str();
+}
+
+nlohmann::json PerformanceCounterValues::to_json() const {
+  return nlohmann::json{{"cycles", cycles},
+                        {"instructions", instructions},
+                        {"instructions_per_cycle", instructions_per_cycle()},
+                        {"cache_misses", cache_misses},
+                        {"tlb_misses", tlb_misses},
+                        {"branch_misses", branch_misses}};
+}
+
+bool PerformanceCounters::enabled() { return performance_counters_enabled.load(); }
+
+void PerformanceCounters::set_enabled(const bool enabled) { performance_counters_enabled = enabled; }
+
+std::optional<PerformanceCounterValues> PerformanceCounters::read() {
+#if defined(__linux__)
+  thread_local const auto thread_counters = ThreadCounters{};
+  return thread_counters.read();
+#else
+  return std::nullopt;
+#endif
+}
+
+}  // namespace opossum
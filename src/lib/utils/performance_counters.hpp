@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "json.hpp"
+
+namespace opossum {
+
+// Hardware events counted by the CPU's performance monitoring unit
+struct PerformanceCounterValues {
+  uint64_t cycles{0};
+  uint64_t instructions{0};
+  // Misses in the last level cache
+  uint64_t cache_misses{0};
+  // Misses in the data TLB on reads
+  uint64_t tlb_misses{0};
+  uint64_t branch_misses{0};
+
+  PerformanceCounterValues& operator+=(const PerformanceCounterValues& rhs);
+  PerformanceCounterValues operator-(const PerformanceCounterValues& rhs) const;
+
+  // Instructions per cycle, 0 if no cycles were counted
+  double instructions_per_cycle() const;
+
+  std::string to_string() const;
+  nlohmann::json to_json() const;
+};
+
+/**
+ * Reads the hardware performance counters of the calling thread using perf_event_open(2). The counters of a thread
+ * are opened on its first read and keep running until the thread exits, so that the events of a piece of code are the
+ * difference between two reads. Nested measurements thus do not interfere.
+ *
+ * The counters are only available on Linux and only if the kernel permits unprivileged users to open them (see
+ * /proc/sys/kernel/perf_event_paranoid). Also, virtual machines often do not expose the performance monitoring unit.
+ *
+ * Measuring costs a system call per read, so operators only measure their counters when they were enabled with
+ * set_enabled(), e.g., by the BenchmarkRunner's --performance_counters option.
+ */
+class PerformanceCounters final {
+ public:
+  static bool enabled();
+  static void set_enabled(const bool enabled);
+
+  // Returns the events counted for the calling thread so far, or std::nullopt if the counters are not available
+  static std::optional<PerformanceCounterValues> read();
+};
+
+}  // namespace opossum
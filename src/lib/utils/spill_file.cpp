@@ -0,0 +1,48 @@
+#include "spill_file.hpp"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SpillFile::SpillFile(const std::string& directory) {
+  auto path = std::vector<char>(directory.cbegin(), directory.cend());
+  const auto file_name_template = std::string{"/hyrise_spill_XXXXXX"};
+  path.insert(path.end(), file_name_template.cbegin(), file_name_template.cend());
+  path.emplace_back('\0');
+
+  const auto file_descriptor = mkstemp(path.data());
+  Assert(file_descriptor >= 0, "Could not create file in " + directory);
+  unlink(path.data());
+
+  _file = fdopen(file_descriptor, "w+b");
+  if (!_file) {
+    close(file_descriptor);
+    Fail("Could not open file in " + directory);
+  }
+}
+
+SpillFile::~SpillFile() { std::fclose(_file); }
+
+void SpillFile::write(const void* data, const size_t byte_count) {
+  Assert(std::fwrite(data, 1, byte_count, _file) == byte_count, "Could not write to spill file");
+}
+
+void SpillFile::rewind() {
+  Assert(std::fflush(_file) == 0, "Could not write to spill file");
+  std::rewind(_file);
+}
+
+bool SpillFile::read(void* data, const size_t byte_count) {
+  const auto read_byte_count = std::fread(data, 1, byte_count, _file);
+  Assert(read_byte_count == byte_count || (read_byte_count == 0 && std::feof(_file)), "Could not read spill file");
+  return read_byte_count == byte_count;
+}
+
+}  // namespace opossum
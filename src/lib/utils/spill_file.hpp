@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Lets an operator write its intermediate data to files in the directory once it would exceed the memory budget
+struct SpillOptions final {
+  explicit SpillOptions(const size_t memory_budget, const std::string& directory = "/tmp")
+      : memory_budget(memory_budget), directory(directory) {}
+
+  // In bytes
+  size_t memory_budget;
+  std::string directory;
+};
+
+/**
+ * A temporary file that an operator writes intermediate data to (e.g., the sorted runs of an external Sort) and then
+ * reads back sequentially. Like the FileBackedMemoryResource, the file is unlinked right away, so that it is removed
+ * once it is closed, even if the process ends.
+ */
+class SpillFile : public Noncopyable {
+ public:
+  explicit SpillFile(const std::string& directory);
+  ~SpillFile();
+
+  SpillFile(SpillFile&&) = delete;
+
+  void write(const void* data, const size_t byte_count);
+
+  // Switches from writing to reading from the start of the file
+  void rewind();
+
+  // Returns false at the end of the file
+  bool read(void* data, const size_t byte_count);
+
+ private:
+  std::FILE* _file{nullptr};
+};
+
+}  // namespace opossum
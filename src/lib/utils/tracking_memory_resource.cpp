@@ -0,0 +1,63 @@
+#include "tracking_memory_resource.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "utils/format_bytes.hpp"
+
+namespace opossum {
+
+TrackingMemoryResource::TrackingMemoryResource(
+    const std::shared_ptr<boost::container::pmr::memory_resource>& upstream, const std::optional<size_t>& limit)
+    : _upstream_owner(upstream),
+      _upstream(upstream ? upstream.get() : boost::container::pmr::get_default_resource()),
+      _limit(limit) {}
+
+size_t TrackingMemoryResource::allocated_bytes() const { return _allocated_bytes; }
+
+size_t TrackingMemoryResource::peak_allocated_bytes() const { return _peak_allocated_bytes; }
+
+const std::optional<size_t>& TrackingMemoryResource::limit() const { return _limit; }
+
+std::optional<size_t> TrackingMemoryResource::remaining_bytes() const {
+  const auto* const tracking_upstream = dynamic_cast<const TrackingMemoryResource*>(_upstream);
+  auto remaining_bytes = tracking_upstream ? tracking_upstream->remaining_bytes() : std::nullopt;
+  if (!_limit) return remaining_bytes;
+
+  const auto allocated_bytes = _allocated_bytes.load();
+  const auto own_remaining_bytes = *_limit > allocated_bytes ? *_limit - allocated_bytes : size_t{0};
+  return remaining_bytes ? std::min(*remaining_bytes, own_remaining_bytes) : own_remaining_bytes;
+}
+
+void* TrackingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  // The bytes are counted before they are allocated, so that concurrent allocations cannot overshoot the limit together
+  const auto allocated_bytes = _allocated_bytes.fetch_add(bytes) + bytes;
+  if (_limit && allocated_bytes > *_limit) {
+    _allocated_bytes -= bytes;
+    throw MemoryLimitExceededException("Query exceeded its memory limit of " + format_bytes(*_limit) +
+                                       " when allocating " + format_bytes(bytes) + ".");
+  }
+
+  auto peak_allocated_bytes = _peak_allocated_bytes.load();
+  while (peak_allocated_bytes < allocated_bytes &&
+         !_peak_allocated_bytes.compare_exchange_weak(peak_allocated_bytes, allocated_bytes)) {
+  }
+
+  try {
+    return _upstream->allocate(bytes, alignment);
+  } catch (...) {
+    _allocated_bytes -= bytes;
+    throw;
+  }
+}
+
+void TrackingMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  _upstream->deallocate(p, bytes, alignment);
+  _allocated_bytes -= bytes;
+}
+
+bool TrackingMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Thrown by a TrackingMemoryResource if an allocation would exceed its limit. As an std::bad_alloc, it is handled like
+ * any other failed allocation.
+ */
+class MemoryLimitExceededException : public std::bad_alloc {
+ public:
+  explicit MemoryLimitExceededException(const std::string& message) : _message(message) {}
+
+  const char* what() const noexcept override { return _message.c_str(); }
+
+ private:
+  std::string _message;
+};
+
+/**
+ * Memory resource for the intermediate results of a single query (see SQLPipelineBuilder::with_memory_limit()). It
+ * passes all allocations to an upstream resource (e.g., the ArenaMemoryResource of the query) and counts the bytes
+ * that are currently allocated and their peak. If a limit is given, allocations that would exceed it fail with a
+ * MemoryLimitExceededException, so that a runaway query fails instead of exhausting the memory of the system.
+ * Operators that can spill (e.g., the Aggregate) use the remaining bytes as their memory budget.
+ *
+ * Only allocations from AbstractOperator::memory_resource() are counted, i.e., those of the PosLists and hash tables
+ * of the intermediates, but not the segments of materialized tables.
+ *
+ * Resources can be nested: Each operator counts its own allocations with a TrackingMemoryResource whose upstream is
+ * the resource of the query (see AbstractOperator::execute()).
+ */
+class TrackingMemoryResource : public boost::container::pmr::memory_resource, public Noncopyable {
+ public:
+  // @param upstream is kept alive by the resource. If it is nullptr, the default memory resource is used.
+  explicit TrackingMemoryResource(const std::shared_ptr<boost::container::pmr::memory_resource>& upstream = nullptr,
+                                  const std::optional<size_t>& limit = std::nullopt);
+
+  size_t allocated_bytes() const;
+  size_t peak_allocated_bytes() const;
+
+  const std::optional<size_t>& limit() const;
+
+  // Number of bytes that can be allocated before the limit of this resource or of an upstream TrackingMemoryResource is
+  // reached, std::nullopt if there is no limit
+  std::optional<size_t> remaining_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  const std::shared_ptr<boost::container::pmr::memory_resource> _upstream_owner;
+  boost::container::pmr::memory_resource* const _upstream;
+  const std::optional<size_t> _limit;
+
+  std::atomic<size_t> _allocated_bytes{0};
+  std::atomic<size_t> _peak_allocated_bytes{0};
+};
+
+}  // namespace opossum
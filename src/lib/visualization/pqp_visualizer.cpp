@@ -7,7 +7,6 @@
 #include "operators/limit.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
-#include "utils/format_duration.hpp"
 #include "visualization/abstract_visualizer.hpp"
 #include "visualization/pqp_visualizer.hpp"
 
@@ -113,8 +112,9 @@ void PQPVisualizer::_add_operator(const std::shared_ptr<const AbstractOperator>&
   auto label = op->description(DescriptionMode::MultiLine);
 
   if (op->get_output()) {
-    auto total = op->performance_data().walltime;
-    label += "\n\n" + format_duration(total);
+    const auto& performance_data = op->performance_data();
+    const auto total = performance_data.walltime;
+    label += "\n\n" + performance_data.to_string(DescriptionMode::MultiLine);
     info.pen_width = std::fmax(1, std::ceil(std::log10(total.count()) / 2));
   }
 
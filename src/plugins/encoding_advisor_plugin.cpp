@@ -0,0 +1,191 @@
+#include "encoding_advisor_plugin.hpp"
+
+#include <memory>
+#include <string>
+
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+const std::string EncodingAdvisorPlugin::description() const {
+  return "This plugin re-encodes segments based on the workload";
+}
+
+void EncodingAdvisorPlugin::start() {
+  PausableLoopThread::resume_or_create(_tuning_thread, _options.tuning_interval, [this](size_t) { tune_encodings(); });
+}
+
+void EncodingAdvisorPlugin::stop() {
+  _tuning_thread.reset();
+  reset();
+}
+
+const EncodingAdvisorPlugin::Options& EncodingAdvisorPlugin::options() const { return _options; }
+
+void EncodingAdvisorPlugin::set_options(const Options& options) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  Assert(options.cpu_share >= 0.0 && options.cpu_share <= 1.0, "CPU share must be in [0, 1].");
+  Assert(options.workload_decay >= 0.0 && options.workload_decay <= 1.0, "Workload decay must be in [0, 1].");
+  for (const auto& spec : {options.range_encoding_spec, options.filter_encoding_spec, options.cold_encoding_spec}) {
+    Assert(spec.encoding_type != EncodingType::Auto, "The advisor needs specific encodings.");
+  }
+  _options = options;
+  if (_tuning_thread) _tuning_thread->set_loop_sleep_time(_options.tuning_interval);
+}
+
+size_t EncodingAdvisorPlugin::tune_encodings() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  _record_accesses();
+
+  const auto begin = std::chrono::steady_clock::now();
+  const auto time_budget = _options.tuning_interval * _options.cpu_share;
+  auto reencoded_segment_count = size_t{0};
+
+  // Tables dropped while the pass is running are re-encoded nonetheless, which does not affect anyone else
+  const auto tables = StorageManager::get().tables();
+
+  for (const auto& [table_column, column_workload] : _workload) {
+    const auto& [table_name, column_id] = table_column;
+    const auto table_it = tables.find(table_name);
+    if (table_it == tables.cend()) continue;
+
+    const auto& table = table_it->second;
+    const auto target_encoding = _target_encoding(table_name, *table, column_id);
+    if (!target_encoding) continue;
+
+    const auto data_type = table->column_data_type(column_id);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk->is_mutable()) continue;
+
+      const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+      const auto encoding_type = encoded_segment ? encoded_segment->encoding_type() : EncodingType::Unencoded;
+      if (encoding_type == target_encoding->encoding_type) continue;
+
+      if (reencoded_segment_count > 0 && std::chrono::steady_clock::now() - begin > time_budget) break;
+
+      ChunkEncoder::reencode_segment(chunk, column_id, data_type, *target_encoding);
+      ++reencoded_segment_count;
+    }
+  }
+
+  for (auto& [table_column, column_workload] : _workload) {
+    column_workload.accessed_rows *= _options.workload_decay;
+    column_workload.range_predicates *= _options.workload_decay;
+    column_workload.other_predicates *= _options.workload_decay;
+  }
+
+  return reencoded_segment_count;
+}
+
+std::optional<SegmentEncodingSpec> EncodingAdvisorPlugin::target_encoding(const std::string& table_name,
+                                                                          const ColumnID column_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto tables = StorageManager::get().tables();
+  const auto table_it = tables.find(table_name);
+  if (table_it == tables.cend()) return std::nullopt;
+  return _target_encoding(table_name, *table_it->second, column_id);
+}
+
+void EncodingAdvisorPlugin::reset() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _workload.clear();
+  _recorded_counts.clear();
+}
+
+void EncodingAdvisorPlugin::_record_accesses() {
+  // Forget the segments that were replaced, e.g., by a previous pass, and the tables that were dropped
+  for (auto recorded_it = _recorded_counts.begin(); recorded_it != _recorded_counts.end();) {
+    recorded_it = recorded_it->first.expired() ? _recorded_counts.erase(recorded_it) : std::next(recorded_it);
+  }
+  const auto tables = StorageManager::get().tables();
+  for (auto workload_it = _workload.begin(); workload_it != _workload.end();) {
+    const auto keep = tables.count(workload_it->first.first) > 0;
+    workload_it = keep ? std::next(workload_it) : _workload.erase(workload_it);
+  }
+
+  for (const auto& [table_name, table] : tables) {
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      auto& column_workload = _workload[{table_name, column_id}];
+      ++column_workload.pass_count;
+
+      for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+        const auto segment = std::shared_ptr<const BaseSegment>{table->get_chunk(chunk_id)->get_segment(column_id)};
+        const auto counts = _counts(segment->access_statistics());
+        auto& recorded_counts = _recorded_counts[segment];
+
+        column_workload.accessed_rows += static_cast<double>(counts.accessed_rows - recorded_counts.accessed_rows);
+        column_workload.range_predicates +=
+            static_cast<double>(counts.range_predicates - recorded_counts.range_predicates);
+        column_workload.other_predicates +=
+            static_cast<double>(counts.other_predicates - recorded_counts.other_predicates);
+        recorded_counts = counts;
+      }
+    }
+  }
+}
+
+std::optional<SegmentEncodingSpec> EncodingAdvisorPlugin::_target_encoding(const std::string& table_name,
+                                                                           const Table& table,
+                                                                           const ColumnID column_id) const {
+  const auto workload_it = _workload.find({table_name, column_id});
+  if (workload_it == _workload.cend()) return std::nullopt;
+
+  const auto& column_workload = workload_it->second;
+  const auto data_type = table.column_data_type(column_id);
+  const auto supports = [&](const SegmentEncodingSpec& spec) {
+    return spec.encoding_type == EncodingType::Unencoded || encoding_supports_data_type(spec.encoding_type, data_type);
+  };
+
+  // Less than one scan is not worth an encoding
+  if (column_workload.range_predicates + column_workload.other_predicates >= 1.0) {
+    if (column_workload.range_predicates > column_workload.other_predicates && supports(_options.range_encoding_spec)) {
+      return _options.range_encoding_spec;
+    }
+    if (supports(_options.filter_encoding_spec)) return _options.filter_encoding_spec;
+    return std::nullopt;
+  }
+
+  const auto cold_row_count = _options.cold_row_share * static_cast<double>(table.row_count());
+  if (column_workload.pass_count >= _options.cold_pass_count && column_workload.accessed_rows < cold_row_count &&
+      supports(_options.cold_encoding_spec)) {
+    return _options.cold_encoding_spec;
+  }
+
+  return std::nullopt;
+}
+
+EncodingAdvisorPlugin::RecordedCounts EncodingAdvisorPlugin::_counts(const SegmentAccessStatistics& statistics) {
+  auto counts = RecordedCounts{};
+  counts.accessed_rows = statistics.sequential_row_count() + statistics.point_access_count();
+
+  for (auto predicate_condition_id = size_t{0};
+       predicate_condition_id < SegmentAccessStatistics::PREDICATE_CONDITION_COUNT; ++predicate_condition_id) {
+    const auto predicate_condition = static_cast<PredicateCondition>(predicate_condition_id);
+    switch (predicate_condition) {
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+      case PredicateCondition::Between:
+        counts.range_predicates += statistics.predicate_count(predicate_condition);
+        break;
+      default:
+        counts.other_predicates += statistics.predicate_count(predicate_condition);
+    }
+  }
+
+  return counts;
+}
+
+EXPORT_PLUGIN(EncodingAdvisorPlugin)
+
+}  // namespace opossum
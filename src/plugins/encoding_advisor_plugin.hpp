@@ -0,0 +1,136 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class SegmentAccessStatistics;
+class Table;
+
+/**
+ * The EncodingAdvisorPlugin re-encodes the segments of immutable chunks based on how their columns are accessed, so
+ * that the physical design follows the workload instead of being chosen once when the data is loaded.
+ *
+ * The workload is taken from the SegmentAccessStatistics of the stored segments. In each tuning pass, the accesses
+ * since the previous pass are added to the workload of their column:
+ *
+ *   - Columns that are mostly filtered with range predicates (<, <=, >, >=, BETWEEN) get `range_encoding_spec`
+ *     (FrameOfReference by default), if the encoding supports their data type
+ *   - Columns that are filtered otherwise, e.g., with equality predicates, get `filter_encoding_spec` (Dictionary)
+ *   - Columns of which fewer than `cold_row_share` of the rows were read per pass are cold and get the more compact
+ *     `cold_encoding_spec` (LZ4). A column is only considered cold after it was observed for `cold_pass_count` passes.
+ *   - All other columns keep their encoding.
+ *
+ * Afterwards, the workload is multiplied by `workload_decay`, so that the advisor follows changes in the workload.
+ *
+ * Re-encoding is done with ChunkEncoder::reencode_segment, which exchanges the segments atomically, so queries are
+ * not blocked. To keep the advisor from competing with the queries, a pass stops re-encoding once it took more than
+ * `cpu_share` of the tuning interval. The segments it did not get to are re-encoded in the next pass. Mutable chunks
+ * are left to the ChunkCompressionManager.
+ */
+class EncodingAdvisorPlugin : public AbstractPlugin, public Singleton<EncodingAdvisorPlugin> {
+ public:
+  struct Options {
+    // The time interval at which the encodings are tuned
+    std::chrono::milliseconds tuning_interval = std::chrono::seconds(10);
+
+    // The share of the tuning interval that a pass may spend re-encoding segments. At least one segment is re-encoded
+    // per pass, so that the advisor makes progress.
+    double cpu_share = 0.1;
+
+    // The factor by which the recorded workload is multiplied after each tuning pass
+    double workload_decay = 0.5;
+
+    // A column is cold if the (decayed) number of rows read from it is less than this share of its rows
+    double cold_row_share = 0.01;
+    size_t cold_pass_count = 3;
+
+    SegmentEncodingSpec range_encoding_spec = SegmentEncodingSpec{EncodingType::FrameOfReference};
+    SegmentEncodingSpec filter_encoding_spec = SegmentEncodingSpec{EncodingType::Dictionary};
+    SegmentEncodingSpec cold_encoding_spec = SegmentEncodingSpec{EncodingType::LZ4};
+  };
+
+  const std::string description() const final;
+
+  // Starts tuning the encodings in the background
+  void start() final;
+
+  void stop() final;
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  /**
+   * Records the accesses since the last pass and re-encodes segments based on the workload once. This is what the
+   * background thread does in each iteration.
+   *
+   * @return the number of re-encoded segments
+   */
+  size_t tune_encodings();
+
+  // The encoding that the advisor chooses for a column based on the recorded workload, std::nullopt if the column
+  // keeps its encoding
+  std::optional<SegmentEncodingSpec> target_encoding(const std::string& table_name, const ColumnID column_id);
+
+  // Forgets the recorded workload
+  void reset();
+
+  EncodingAdvisorPlugin(EncodingAdvisorPlugin&&) = delete;
+
+ protected:
+  EncodingAdvisorPlugin() = default;
+
+  friend class Singleton;
+
+  struct ColumnWorkload {
+    // Decayed number of rows read by scans and point accesses
+    double accessed_rows{0.0};
+
+    // Decayed number of scanned segments, by the kind of predicate
+    double range_predicates{0.0};
+    double other_predicates{0.0};
+
+    size_t pass_count{0};
+  };
+
+  // The counts of a segment at the previous pass, so that only new accesses are added to the workload
+  struct RecordedCounts {
+    uint64_t accessed_rows{0};
+    uint64_t range_predicates{0};
+    uint64_t other_predicates{0};
+  };
+
+  void _record_accesses();
+
+  std::optional<SegmentEncodingSpec> _target_encoding(const std::string& table_name, const Table& table,
+                                                      const ColumnID column_id) const;
+
+  static RecordedCounts _counts(const SegmentAccessStatistics& statistics);
+
+  Options _options;
+
+  // Guards the options and the recorded workload, and makes sure that only one pass runs at a time
+  std::mutex _mutex;
+
+  std::map<std::pair<std::string, ColumnID>, ColumnWorkload> _workload;
+
+  std::map<std::weak_ptr<const BaseSegment>, RecordedCounts, std::owner_less<std::weak_ptr<const BaseSegment>>>
+      _recorded_counts;
+
+  std::unique_ptr<PausableLoopThread> _tuning_thread;
+};
+
+}  // namespace opossum
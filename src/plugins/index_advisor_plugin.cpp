@@ -0,0 +1,280 @@
+#include "index_advisor_plugin.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "resolve_type.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+const std::string IndexAdvisorPlugin::description() const {
+  return "This plugin creates and drops chunk indexes based on the workload";
+}
+
+void IndexAdvisorPlugin::start() {
+  PausableLoopThread::resume_or_create(_tuning_thread, _options.tuning_interval, [this](size_t) {
+    record_cached_plans();
+    tune_indexes();
+  });
+}
+
+void IndexAdvisorPlugin::stop() {
+  _tuning_thread.reset();
+  reset();
+}
+
+const IndexAdvisorPlugin::Options& IndexAdvisorPlugin::options() const { return _options; }
+
+void IndexAdvisorPlugin::set_options(const Options& options) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  Assert(options.benefit_decay >= 0.0 && options.benefit_decay <= 1.0, "Benefit decay must be in [0, 1].");
+  _options = options;
+  if (_tuning_thread) _tuning_thread->set_loop_sleep_time(_options.tuning_interval);
+}
+
+void IndexAdvisorPlugin::record_plan(const std::shared_ptr<const AbstractOperator>& plan) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto visited_operators = std::set<std::shared_ptr<const AbstractOperator>>{};
+  _record_operator(plan, visited_operators);
+}
+
+void IndexAdvisorPlugin::record_cached_plans() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // Forget the plans that were evicted from the cache
+  for (auto plan_it = _recorded_plans.begin(); plan_it != _recorded_plans.end();) {
+    plan_it = plan_it->expired() ? _recorded_plans.erase(plan_it) : std::next(plan_it);
+  }
+
+  auto visited_operators = std::set<std::shared_ptr<const AbstractOperator>>{};
+  for (const auto& [query, plan] : SQLPhysicalPlanCache::get()) {
+    if (_recorded_plans.emplace(plan).second) _record_operator(plan, visited_operators);
+  }
+}
+
+void IndexAdvisorPlugin::_record_operator(const std::shared_ptr<const AbstractOperator>& op,
+                                          std::set<std::shared_ptr<const AbstractOperator>>& visited_operators) {
+  // Operators can be shared by multiple consumers, e.g., in plans with subqueries
+  if (!op || !visited_operators.emplace(op).second) return;
+
+  _record_operator(op->input_left(), visited_operators);
+  _record_operator(op->input_right(), visited_operators);
+
+  // Only executed scans tell how much time an index could save
+  if (op->type() != OperatorType::TableScan || op->performance_data().walltime.count() == 0) return;
+
+  const auto& table_scan = static_cast<const TableScan&>(*op);
+  const auto predicate = std::dynamic_pointer_cast<const AbstractPredicateExpression>(table_scan.predicate());
+  if (!predicate) return;
+
+  auto only_equality = false;
+  switch (predicate->predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+      only_equality = true;
+      break;
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::Between:
+      break;
+    default:
+      return;
+  }
+
+  // The predicate has to compare exactly one column with constants. Which side the column is on does not matter, as
+  // flipping the condition does not change whether it is an equality or a range predicate.
+  auto column_expression = std::shared_ptr<const PQPColumnExpression>{};
+  for (const auto& argument : predicate->arguments) {
+    if (argument->type == ExpressionType::PQPColumn) {
+      if (column_expression) return;
+      column_expression = std::static_pointer_cast<const PQPColumnExpression>(argument);
+    } else if (argument->type != ExpressionType::Value) {
+      return;
+    }
+  }
+  if (!column_expression) return;
+
+  // Only scans on the columns of a stored table can use chunk indexes. Validates and other scans keep the columns.
+  auto input = op->input_left();
+  while (input && (input->type() == OperatorType::Validate || input->type() == OperatorType::TableScan)) {
+    input = input->input_left();
+  }
+  if (!input || input->type() != OperatorType::GetTable) return;
+
+  const auto& table_name = static_cast<const GetTable&>(*input).table_name();
+  auto& column_workload = _workload[{table_name, column_expression->column_id}];
+  column_workload.benefit += static_cast<double>(op->performance_data().walltime.count());
+  column_workload.only_equality_scans &= only_equality;
+}
+
+size_t IndexAdvisorPlugin::tune_indexes() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  struct Candidate {
+    std::string table_name;
+    ColumnID column_id;
+    std::shared_ptr<Table> table;
+    std::shared_ptr<Chunk> chunk;
+    SegmentIndexType index_type;
+    double benefit;
+    size_t memory_consumption;
+  };
+
+  auto candidates = std::vector<Candidate>{};
+  const auto tables = StorageManager::get().tables();
+
+  for (const auto& [table_column, column_workload] : _workload) {
+    const auto& [table_name, column_id] = table_column;
+    const auto table_it = tables.find(table_name);
+    if (table_it == tables.cend()) continue;
+
+    const auto& table = table_it->second;
+    if (column_id >= table->column_count() || table->row_count() == 0) continue;
+
+    const auto index_type = column_workload.only_equality_scans ? SegmentIndexType::Hash : SegmentIndexType::GroupKey;
+
+    auto value_bytes = uint32_t{0};
+    resolve_data_type(table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      value_bytes = static_cast<uint32_t>(sizeof(ColumnDataType));
+    });
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (chunk->is_mutable() || chunk->size() == 0) continue;
+
+      const auto segment = chunk->get_segment(column_id);
+      const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment);
+      if (index_type == SegmentIndexType::GroupKey && !dictionary_segment) continue;
+
+      // Indexes that were created by someone else are left alone
+      const auto existing_index = chunk->get_index(index_type, std::vector<ColumnID>{column_id});
+      if (existing_index && std::none_of(_created_indexes.cbegin(), _created_indexes.cend(), [&](const auto& created) {
+            return created.index == existing_index;
+          })) {
+        continue;
+      }
+
+      const auto distinct_count = dictionary_segment ? dictionary_segment->unique_values_count() : chunk->size();
+      const auto memory_consumption =
+          BaseIndex::estimate_memory_consumption(index_type, chunk->size(), distinct_count, value_bytes);
+      const auto benefit = column_workload.benefit * chunk->size() / table->row_count();
+
+      candidates.emplace_back(Candidate{table_name, column_id, table, chunk, index_type, benefit, memory_consumption});
+    }
+  }
+
+  // Most benefit per byte first
+  std::stable_sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.benefit * rhs.memory_consumption > rhs.benefit * lhs.memory_consumption;
+  });
+
+  auto changed_index_count = size_t{0};
+  auto memory_usage = size_t{0};
+  auto kept_indexes = std::set<std::shared_ptr<BaseIndex>>{};
+
+  for (const auto& candidate : candidates) {
+    if (candidate.memory_consumption > _options.memory_budget - memory_usage) continue;
+    memory_usage += candidate.memory_consumption;
+
+    const auto column_ids = std::vector<ColumnID>{candidate.column_id};
+    auto index = candidate.chunk->get_index(candidate.index_type, column_ids);
+    if (!index) {
+      if (candidate.index_type == SegmentIndexType::Hash) {
+        index = candidate.chunk->create_index<HashIndex>(column_ids);
+      } else {
+        index = candidate.chunk->create_index<GroupKeyIndex>(column_ids);
+      }
+      _created_indexes.emplace_back(CreatedIndex{candidate.table_name, candidate.column_id, candidate.chunk, index});
+      candidate.table->add_index_info(IndexInfo{column_ids, "", candidate.index_type});
+      ++changed_index_count;
+    }
+    kept_indexes.emplace(index);
+  }
+
+  // Drop the indexes that did not make the cut
+  auto dropped_indexes = std::vector<CreatedIndex>{};
+  for (auto created_it = _created_indexes.begin(); created_it != _created_indexes.end();) {
+    if (kept_indexes.count(created_it->index)) {
+      ++created_it;
+      continue;
+    }
+    if (!created_it->chunk.expired()) ++changed_index_count;
+    dropped_indexes.emplace_back(std::move(*created_it));
+    created_it = _created_indexes.erase(created_it);
+  }
+  if (!dropped_indexes.empty()) _clear_cached_plans();
+  for (const auto& dropped_index : dropped_indexes) {
+    _drop_index(dropped_index);
+  }
+
+  for (auto workload_it = _workload.begin(); workload_it != _workload.end();) {
+    workload_it->second.benefit *= _options.benefit_decay;
+    // Less than a nanosecond is not worth an index
+    workload_it = workload_it->second.benefit < 1.0 ? _workload.erase(workload_it) : std::next(workload_it);
+  }
+
+  return changed_index_count;
+}
+
+void IndexAdvisorPlugin::reset() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto created_indexes = std::move(_created_indexes);
+  _created_indexes.clear();
+  if (!created_indexes.empty()) _clear_cached_plans();
+  for (const auto& created_index : created_indexes) {
+    _drop_index(created_index);
+  }
+
+  _workload.clear();
+  _recorded_plans.clear();
+}
+
+void IndexAdvisorPlugin::_clear_cached_plans() {
+  // Cached physical plans contain IndexScans whose chunks were chosen based on the indexes at translation time. They
+  // are copied and executed without being translated again, so they must not outlive the indexes they rely on.
+  SQLPhysicalPlanCache::get().clear();
+  SQLPreparedStatementPlanCache::get().clear();
+}
+
+void IndexAdvisorPlugin::_drop_index(const CreatedIndex& created_index) {
+  const auto chunk = created_index.chunk.lock();
+  if (chunk) chunk->remove_index(created_index.index);
+
+  // The optimizer keeps considering the column as long as the advisor has indexes of that type on it
+  const auto index_type = created_index.index->type();
+  const auto column_still_indexed =
+      std::any_of(_created_indexes.cbegin(), _created_indexes.cend(), [&](const auto& other) {
+        return other.table_name == created_index.table_name && other.column_id == created_index.column_id &&
+               other.index->type() == index_type;
+      });
+  if (column_still_indexed) return;
+
+  const auto tables = StorageManager::get().tables();
+  const auto table_it = tables.find(created_index.table_name);
+  if (table_it != tables.cend()) table_it->second->remove_index_info({created_index.column_id}, index_type);
+}
+
+EXPORT_PLUGIN(IndexAdvisorPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/index/segment_index_type.hpp"
+#include "types.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class BaseIndex;
+class Chunk;
+
+/**
+ * The IndexAdvisorPlugin creates and drops chunk indexes based on the workload, so that indexes do not have to be
+ * chosen by hand.
+ *
+ * The workload is taken from executed physical query plans: for every TableScan that compares a column of a stored
+ * table with a constant, the time spent in the scan (see OperatorPerformanceData) is attributed to that column. Plans
+ * are either handed to the advisor via record_plan() or taken from the SQLPhysicalPlanCache, whose cached plans are
+ * the ones that were executed first.
+ *
+ * In each tuning pass, every immutable chunk of a recorded column is a candidate. Columns that were only scanned for
+ * (in)equality get a HashIndex, all others a GroupKeyIndex if the segment is dictionary-encoded. The expected benefit
+ * of a candidate is the recorded scan time of its column, weighted by the share of the table's rows in the chunk, and
+ * its cost is the memory estimated by BaseIndex::estimate_memory_consumption. The candidates with the highest benefit
+ * per byte are kept until the memory budget is used up, missing indexes are created and indexes that the advisor
+ * created earlier but that did not make the cut are dropped again. Indexes that were not created by the advisor are
+ * never touched. Afterwards, the recorded benefits are multiplied by `benefit_decay`, so that the advisor follows
+ * changes in the workload.
+ *
+ * The created indexes are registered with Table::add_index_info, so that the IndexScanRule considers them.
+ */
+class IndexAdvisorPlugin : public AbstractPlugin, public Singleton<IndexAdvisorPlugin> {
+ public:
+  struct Options {
+    // The time interval at which the cached plans are recorded and the indexes are tuned
+    std::chrono::milliseconds tuning_interval = std::chrono::seconds(60);
+
+    // The number of bytes that the indexes created by the advisor may occupy
+    size_t memory_budget = size_t{1} << 30u;
+
+    // The factor by which the recorded benefits are multiplied after each tuning pass
+    double benefit_decay = 0.5;
+  };
+
+  const std::string description() const final;
+
+  // Starts tuning the indexes in the background
+  void start() final;
+
+  void stop() final;
+
+  const Options& options() const;
+  void set_options(const Options& options);
+
+  // Adds the TableScans of an executed plan to the recorded workload
+  void record_plan(const std::shared_ptr<const AbstractOperator>& plan);
+
+  // Records all plans in the SQLPhysicalPlanCache that have not been recorded before
+  void record_cached_plans();
+
+  /**
+   * Creates and drops indexes based on the recorded workload once. This is what the background thread does in each
+   * iteration.
+   *
+   * @return the number of created and dropped indexes
+   */
+  size_t tune_indexes();
+
+  // Drops all indexes created by the advisor and forgets the recorded workload
+  void reset();
+
+  IndexAdvisorPlugin(IndexAdvisorPlugin&&) = delete;
+
+ protected:
+  IndexAdvisorPlugin() = default;
+
+  friend class Singleton;
+
+  struct ColumnWorkload {
+    // Accumulated scan time in nanoseconds
+    double benefit{0.0};
+
+    bool only_equality_scans{true};
+  };
+
+  struct CreatedIndex {
+    std::string table_name;
+    ColumnID column_id;
+    std::weak_ptr<Chunk> chunk;
+    std::shared_ptr<BaseIndex> index;
+  };
+
+  void _record_operator(const std::shared_ptr<const AbstractOperator>& op,
+                        std::set<std::shared_ptr<const AbstractOperator>>& visited_operators);
+
+  // Removes the physical plans that may use indexes of the advisor from the plan caches
+  void _clear_cached_plans();
+
+  void _drop_index(const CreatedIndex& created_index);
+
+  Options _options;
+
+  // Guards the options, the recorded workload and the created indexes
+  std::mutex _mutex;
+
+  std::map<std::pair<std::string, ColumnID>, ColumnWorkload> _workload;
+
+  std::vector<CreatedIndex> _created_indexes;
+
+  // The cached plans that were already recorded. Plans are kept alive by the cache only.
+  std::set<std::weak_ptr<const AbstractOperator>, std::owner_less<std::weak_ptr<const AbstractOperator>>>
+      _recorded_plans;
+
+  std::unique_ptr<PausableLoopThread> _tuning_thread;
+};
+
+}  // namespace opossum
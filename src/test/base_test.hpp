@@ -12,7 +12,9 @@
 #include "operators/abstract_operator.hpp"
 #include "operators/table_scan.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "sql/intermediate_result_recycler.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/numa_placement_manager.hpp"
@@ -89,6 +91,10 @@ class BaseTestWithParam
 
     SQLPhysicalPlanCache::get().clear();
     SQLLogicalPlanCache::get().clear();
+    SQLParameterizedPlanCache::get().clear();
+    SQLPreparedStatementPlanCache::get().clear();
+    SQLResultCache::get().clear();
+    IntermediateResultRecycler::get().set_memory_budget(0);
   }
 
   static std::shared_ptr<AbstractExpression> get_column_expression(const std::shared_ptr<AbstractOperator>& op,
@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -253,6 +256,38 @@ TEST(CachePolicyTest, Iterators) {
   ASSERT_EQ(value_sum, 200);
 }
 
+TEST(CachePolicyTest, ShardedCache) {
+  Cache<int, int> cache(1000);
+  EXPECT_EQ(cache.shard_count(), 15u);
+  EXPECT_EQ(cache.capacity(), 1000u);
+
+  // Writers and readers of different shards do not wait for each other
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 4; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto key = thread_id * 100; key < (thread_id + 1) * 100; ++key) {
+        cache.set(key, key * 2);
+        ASSERT_EQ(*cache.try_get(key), key * 2);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  // No shard had to evict entries
+  EXPECT_EQ(cache.size(), 400u);
+
+  auto element_count = size_t{0};
+  for (const auto& [key, value] : cache) {
+    ++element_count;
+    ASSERT_EQ(value, key * 2);
+  }
+  EXPECT_EQ(element_count, 400u);
+
+  cache.resize(10);
+  EXPECT_EQ(cache.capacity(), 10u);
+  EXPECT_LE(cache.size(), 10u);
+}
+
 template <typename T>
 class CacheTest : public BaseTest {};
 
@@ -1,6 +1,7 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -108,4 +109,84 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, PendingTransactionsAreCommittedAsAGroup) {
+  auto context_1 = manager().new_transaction_context();
+  auto context_2 = manager().new_transaction_context();
+  auto context_3 = manager().new_transaction_context();
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  // The commit ids of the group are published at once, before any callback of the group fires
+  auto committed_transaction_ids = std::vector<TransactionID>{};
+  const auto callback = [&](TransactionID transaction_id) {
+    EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + 3);
+    committed_transaction_ids.emplace_back(transaction_id);
+  };
+
+  // context_2 and context_3 get their commit ids while context_1 commits its records and wait for it
+  auto try_commit_contexts_2_and_3 = [&]() {
+    context_2->commit_async(callback);
+    context_3->commit_async(callback);
+
+    EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
+  };
+
+  auto commit_op = std::make_shared<CommitFuncOp>(try_commit_contexts_2_and_3);
+  commit_op->set_transaction_context(context_1);
+  commit_op->execute();
+
+  context_1->commit_async(callback);
+
+  EXPECT_EQ(manager().last_commit_id(), context_3->commit_id());
+  EXPECT_EQ(committed_transaction_ids, std::vector<TransactionID>({context_1->transaction_id(),
+                                                                   context_2->transaction_id(),
+                                                                   context_3->transaction_id()}));
+}
+
+TEST_F(TransactionContextTest, LowestActiveSnapshotCommitId) {
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), std::nullopt);
+
+  auto context_1 = manager().new_transaction_context();
+  const auto snapshot_commit_id_1 = context_1->snapshot_commit_id();
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), snapshot_commit_id_1);
+
+  auto context_2 = manager().new_transaction_context();
+  context_2->commit();
+
+  auto context_3 = manager().new_transaction_context();
+  EXPECT_GT(context_3->snapshot_commit_id(), snapshot_commit_id_1);
+
+  // The oldest snapshot is kept until its transaction has finished
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), snapshot_commit_id_1);
+
+  context_1->rollback();
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), context_3->snapshot_commit_id());
+
+  // Contexts that are destroyed without committing or rolling back are not considered active anymore
+  context_3 = nullptr;
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionContextTest, ReadOnlyTransactionsDoNotTakeCommitIds) {
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto context = manager().new_read_only_transaction_context();
+  EXPECT_TRUE(context->is_read_only());
+  EXPECT_EQ(context->transaction_id(), TransactionManager::READ_ONLY_TRANSACTION_ID);
+  EXPECT_EQ(context->snapshot_commit_id(), prev_last_commit_id);
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), prev_last_commit_id);
+
+  auto committed = false;
+  EXPECT_TRUE(context->commit_async([&](TransactionID) { committed = true; }));
+  EXPECT_TRUE(committed);
+  EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+  EXPECT_FALSE(context->commit());
+
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id);
+  EXPECT_EQ(manager().lowest_active_snapshot_commit_id(), std::nullopt);
+
+  auto op = std::make_shared<CommitFuncOp>([]() {});
+  EXPECT_THROW(manager().new_read_only_transaction_context()->register_read_write_operator(op), std::logic_error);
+}
+
 }  // namespace opossum
@@ -0,0 +1,88 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_physical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CostModelPhysicalTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Costs that are easy to add up, writing the output is free
+    coefficients.table_scan_row_costs = {{EncodingType::Unencoded, 1.0f}, {EncodingType::RunLength, 5.0f}};
+    coefficients.reference_scan_row_cost = 0.0f;
+    coefficients.index_scan_chunk_cost = 100.0f;
+    coefficients.index_scan_output_row_cost = 0.0f;
+    coefficients.output_row_cost = 0.0f;
+
+    const auto column_statistics = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100.0f, 1, 100);
+    const auto table_statistics = std::make_shared<TableStatistics>(
+        TableType::Data, 1000, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics});
+
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "a");
+    node_a->set_statistics(table_statistics);
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "b");
+    node_b->set_statistics(table_statistics);
+
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+  }
+
+  CostModelCoefficients coefficients;
+  std::shared_ptr<MockNode> node_a, node_b;
+  LQPColumnReference a_a, b_a;
+};
+
+TEST_F(CostModelPhysicalTest, TableScanByEncoding) {
+  // Two chunks of two rows each, only the first one is run-length encoded
+  const auto table = load_table("resources/test_data/tbl/int_int_int.tbl", 2);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, SegmentEncodingSpec{EncodingType::RunLength});
+  StorageManager::get().add_table("table", table);
+
+  const auto stored_table_node = StoredTableNode::make("table");
+  const auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("a"), 10), stored_table_node);
+
+  const auto cost_model = CostModelPhysical{coefficients};
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(predicate_node), 2 * 5.0f + 2 * 1.0f);
+
+  // An IndexScan looks up both chunks
+  predicate_node->scan_type = ScanType::IndexScan;
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(predicate_node), 2 * 100.0f);
+}
+
+TEST_F(CostModelPhysicalTest, CheapestJoinAlgorithm) {
+  const auto cost_model = CostModelPhysical{coefficients};
+  const auto hash_join_cost = cost_model.estimate_hash_join_cost(1000, 1000);
+  const auto sort_merge_join_cost = cost_model.estimate_sort_merge_join_cost(1000, 1000);
+  ASSERT_LT(hash_join_cost, sort_merge_join_cost);
+  ASSERT_LT(sort_merge_join_cost, cost_model.estimate_nested_loop_join_cost(1000, 1000));
+
+  const auto inner_join_node = JoinNode::make(JoinMode::Inner, equals_(a_a, b_a), node_a, node_b);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(inner_join_node), hash_join_cost);
+
+  // JoinHash does not support full outer joins
+  const auto outer_join_node = JoinNode::make(JoinMode::Outer, equals_(a_a, b_a), node_a, node_b);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(outer_join_node), sort_merge_join_cost);
+
+  const auto inequality_join_node = JoinNode::make(JoinMode::Inner, less_than_(a_a, b_a), node_a, node_b);
+  EXPECT_FLOAT_EQ(cost_model.estimate_plan_cost(inequality_join_node), sort_merge_join_cost);
+
+  // For tiny inputs, building a hash table does not pay off
+  EXPECT_LT(cost_model.estimate_nested_loop_join_cost(1, 10), cost_model.estimate_hash_join_cost(1, 10));
+}
+
+}  // namespace opossum
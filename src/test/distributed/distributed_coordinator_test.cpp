@@ -0,0 +1,127 @@
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "distributed/abstract_node.hpp"
+#include "distributed/distributed_coordinator.hpp"
+#include "operators/exchange.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// A node that stores the loaded tables in memory and answers every fragment with its table "fact"
+class MockNode : public AbstractNode {
+ public:
+  std::shared_ptr<const Table> execute(const std::string& sql) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    executed_sql = sql;
+    return tables.at("fact");
+  }
+
+  void load_table(const std::string& table_name, const std::shared_ptr<const Table>& table) override {
+    std::lock_guard<std::mutex> lock(mutex);
+    tables[table_name] = table;
+  }
+
+  std::string description() const override { return "mock node"; }
+
+  std::mutex mutex;
+  std::map<std::string, std::shared_ptr<const Table>> tables;
+  std::string executed_sql;
+};
+
+class DistributedCoordinatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    for (auto node_id = 0; node_id < 3; ++node_id) {
+      mock_nodes.emplace_back(std::make_shared<MockNode>());
+      nodes.emplace_back(mock_nodes.back());
+    }
+
+    table = load_table("resources/test_data/tbl/int_float4.tbl", 2);
+  }
+
+  std::vector<std::shared_ptr<MockNode>> mock_nodes;
+  std::vector<std::shared_ptr<AbstractNode>> nodes;
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(DistributedCoordinatorTest, ReplicateTable) {
+  auto coordinator = DistributedCoordinator{nodes};
+  coordinator.replicate_table("dimension", table);
+
+  for (const auto& mock_node : mock_nodes) {
+    EXPECT_EQ(mock_node->tables.at("dimension"), table);
+  }
+}
+
+TEST_F(DistributedCoordinatorTest, PartitionTableAndExchange) {
+  auto coordinator = DistributedCoordinator{nodes};
+  coordinator.partition_table("fact", table, ColumnID{0});
+
+  auto row_count = size_t{0};
+  for (const auto& mock_node : mock_nodes) {
+    row_count += mock_node->tables.at("fact")->row_count();
+  }
+  EXPECT_EQ(row_count, table->row_count());
+
+  const auto result = coordinator.execute("SELECT * FROM fact");
+  EXPECT_TABLE_EQ_UNORDERED(result, table);
+
+  for (const auto& mock_node : mock_nodes) {
+    EXPECT_EQ(mock_node->executed_sql, "SELECT * FROM fact");
+  }
+}
+
+TEST_F(DistributedCoordinatorTest, MergePartialResults) {
+  auto coordinator = DistributedCoordinator{nodes};
+  coordinator.partition_table("fact", table, ColumnID{0});
+
+  const auto result =
+      coordinator.execute("SELECT * FROM fact", "SELECT a, SUM(b) FROM partial_results GROUP BY a", "partial_results");
+  EXPECT_FALSE(StorageManager::get().has_table("partial_results"));
+
+  StorageManager::get().add_table("original", load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  const auto expected_result =
+      SQLPipelineBuilder{"SELECT a, SUM(b) FROM original GROUP BY a"}.create_pipeline().get_result_table();
+  EXPECT_TABLE_EQ_UNORDERED(result, expected_result);
+}
+
+TEST_F(DistributedCoordinatorTest, PartialResultsDoNotCollideWithOtherTables) {
+  auto coordinator = DistributedCoordinator{nodes};
+  coordinator.partition_table("fact", table, ColumnID{0});
+
+  // E.g., the partial results of a concurrent query
+  const auto other_table = load_table("resources/test_data/tbl/int.tbl", 2);
+  StorageManager::get().add_table("partial_results", other_table);
+
+  const auto result = coordinator.execute("SELECT * FROM fact", "SELECT a, b FROM partial_results");
+  EXPECT_TABLE_EQ_UNORDERED(result, table);
+  EXPECT_EQ(StorageManager::get().get_table("partial_results"), other_table);
+  EXPECT_EQ(StorageManager::get().table_names().size(), 1u);
+}
+
+TEST_F(DistributedCoordinatorTest, FailedMergeDropsPartialResults) {
+  auto coordinator = DistributedCoordinator{nodes};
+  coordinator.partition_table("fact", table, ColumnID{0});
+
+  EXPECT_THROW(coordinator.execute("SELECT * FROM fact", "SELECT c FROM partial_results"), std::exception);
+  EXPECT_FALSE(StorageManager::get().has_table("partial_results"));
+}
+
+TEST_F(DistributedCoordinatorTest, ExchangeRejectsDifferentColumns) {
+  mock_nodes[0]->load_table("fact", table);
+  mock_nodes[1]->load_table("fact", table);
+  mock_nodes[2]->load_table("fact", load_table("resources/test_data/tbl/int.tbl", 2));
+
+  const auto exchange = std::make_shared<Exchange>(nodes, "SELECT * FROM fact");
+  EXPECT_THROW(exchange->execute(), std::exception);
+}
+
+}  // namespace opossum
@@ -0,0 +1,72 @@
+#include <memory>
+#include <set>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "distributed/table_partitioner.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TablePartitionerTest : public BaseTest {
+ protected:
+  // The union of the partitions, which has to contain the rows of the partitioned table
+  static std::shared_ptr<Table> union_of(const std::vector<std::shared_ptr<Table>>& partitions) {
+    const auto table = std::make_shared<Table>(partitions.front()->column_definitions(), TableType::Data);
+    for (const auto& partition : partitions) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < partition->chunk_count(); ++chunk_id) {
+        table->append_chunk(partition->get_chunk(chunk_id)->segments());
+      }
+    }
+    return table;
+  }
+};
+
+TEST_F(TablePartitionerTest, PartitionsAllRows) {
+  const auto table = load_table("resources/test_data/tbl/int_float4.tbl", 2);
+  const auto partitions = hash_partition_table(table, ColumnID{0}, 3);
+  ASSERT_EQ(partitions.size(), 3u);
+
+  EXPECT_TABLE_EQ_UNORDERED(union_of(partitions), table);
+
+  // Rows with the same value are in the same partition
+  auto values_of_other_partitions = std::set<int32_t>{};
+  for (const auto& partition : partitions) {
+    auto values = std::set<int32_t>{};
+    for (auto row = size_t{0}; row < partition->row_count(); ++row) {
+      values.emplace(partition->get_value<int32_t>(ColumnID{0}, row));
+    }
+    for (const auto value : values) {
+      EXPECT_EQ(values_of_other_partitions.count(value), 0u);
+    }
+    values_of_other_partitions.insert(values.cbegin(), values.cend());
+  }
+}
+
+TEST_F(TablePartitionerTest, NullsAreInTheFirstPartition) {
+  const auto table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2);
+  const auto partitions = hash_partition_table(table, ColumnID{0}, 2);
+
+  EXPECT_TRUE(partitions[0]->column_is_nullable(ColumnID{0}));
+  EXPECT_TABLE_EQ_UNORDERED(union_of(partitions), table);
+
+  auto first_partition_has_null = false;
+  for (auto chunk_id = ChunkID{0}; chunk_id < partitions[0]->chunk_count(); ++chunk_id) {
+    const auto& segment = *partitions[0]->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      first_partition_has_null |= variant_is_null(segment[chunk_offset]);
+    }
+  }
+  EXPECT_TRUE(first_partition_has_null);
+}
+
+TEST_F(TablePartitionerTest, SinglePartition) {
+  const auto table = load_table("resources/test_data/tbl/int_float4.tbl", 2);
+  const auto partitions = hash_partition_table(table, ColumnID{1}, 1);
+  ASSERT_EQ(partitions.size(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(partitions[0], table);
+}
+
+}  // namespace opossum
@@ -136,6 +136,13 @@ TEST_F(ExpressionEvaluatorToPosListTest, LogicalWithNulls) {
   EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(is_null_(c), equals_(c, 33)), {0, 1, 3}));
 }
 
+TEST_F(ExpressionEvaluatorToPosListTest, LogicalWithExpensiveOperand) {
+  // The LIKE is evaluated after the cheaper comparison, only for the rows the comparison does not decide
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *and_(like_(s1, "%a%"), less_than_(d, 7)), {0, 2}));
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(like_(s1, "%e%"), equals_(d, 2)), {0, 1}));
+  EXPECT_TRUE(test_expression(table_a, ChunkID{0}, *or_(equals_(d, 2), equals_(d, 6)), {0, 2}));
+}
+
 TEST_F(ExpressionEvaluatorToPosListTest, ExistsCorrelated) {
   const auto table_wrapper = std::make_shared<TableWrapper>(table_a);
   const auto table_scan =
@@ -164,4 +171,35 @@ TEST_F(ExpressionEvaluatorToPosListTest, ExistsUncorrelated) {
   EXPECT_TRUE(test_expression(table_b, ChunkID{0}, *not_exists_(select_none), {0, 1, 2, 3}));
 }
 
+TEST_F(ExpressionEvaluatorToPosListTest, ChunkSelection) {
+  // Only the selected rows are evaluated and the matches are returned with their offsets in the Chunk
+  const auto selection = std::make_shared<PosList>(PosList{{ChunkID{0}, 1}, {ChunkID{0}, 2}, {ChunkID{0}, 3}});
+  selection->guarantee_single_chunk();
+
+  auto evaluator = ExpressionEvaluator{table_b, ChunkID{0}, selection};
+  EXPECT_TRUE(evaluator.evaluate_expression_to_pos_list(*greater_than_equals_(x, 9)) ==
+              PosList({{ChunkID{0}, 1}, {ChunkID{0}, 2}}));
+  EXPECT_TRUE(evaluator.evaluate_expression_to_pos_list(*and_(less_than_(x, 10), greater_than_(x, 8))) ==
+              PosList({{ChunkID{0}, 1}}));
+  EXPECT_TRUE(evaluator.evaluate_expression_to_pos_list(*value_(1)) == *selection);
+
+  const auto values = evaluator.evaluate_expression_to_result<int32_t>(*add_(x, 1));
+  EXPECT_EQ(values->values, std::vector<int32_t>({10, 11, 9}));
+}
+
+TEST_F(ExpressionEvaluatorToPosListTest, ChunkSelectionOnReferenceTable) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(table_b);
+  table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, less_than_(x, 10));
+  table_scan->execute();
+
+  // The first chunk of the scan result references the rows with 9 and 8 in table_b
+  const auto selection = std::make_shared<PosList>();
+  selection->set_chunk_range(ChunkID{0}, 1, 2);
+
+  const auto values =
+      ExpressionEvaluator{table_scan->get_output(), ChunkID{0}, selection}.evaluate_expression_to_result<int32_t>(*x);
+  EXPECT_EQ(values->values, std::vector<int32_t>({8}));
+}
+
 }  // namespace opossum
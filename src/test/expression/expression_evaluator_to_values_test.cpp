@@ -22,6 +22,7 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "testing_assert.hpp"
@@ -160,6 +161,17 @@ class ExpressionEvaluatorToValuesTest : public ::testing::Test {
   std::shared_ptr<BinaryPredicateExpression> s1_lt_s2;
 };
 
+TEST_F(ExpressionEvaluatorToValuesTest, RepeatedSubexpressionsAreEvaluatedOnce) {
+  auto evaluator = ExpressionEvaluator{table_a, ChunkID{0}};
+
+  // Equal expressions share their result, even if they are different objects
+  const auto a_plus_b_result = evaluator.evaluate_expression_to_result<int32_t>(*add_(a, b));
+  EXPECT_EQ(evaluator.evaluate_expression_to_result<int32_t>(*a_plus_b), a_plus_b_result);
+
+  const auto product = evaluator.evaluate_expression_to_result<int32_t>(*mul_(add_(a, b), 2));
+  EXPECT_EQ(product->values, std::vector<int32_t>({6, 10, 14, 18}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, TernaryOrLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*or_(1, 0), {1}));
   EXPECT_TRUE(test_expression<int32_t>(*or_(1, 1), {1}));
@@ -200,6 +212,16 @@ TEST_F(ExpressionEvaluatorToValuesTest, TernaryAndSeries) {
   // clang-format on
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, TernaryLogicShortCircuits) {
+  // The right operand is only evaluated for the rows the left operand does not decide, the LIKE is evaluated last
+  EXPECT_TRUE(
+      test_expression<int32_t>(table_a, *and_(greater_than_(c, 33), less_than_(a, 4)), {0, std::nullopt, 1, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *or_(greater_than_(c, 33), equals_(a, 4)), {0, std::nullopt, 1, 1}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *and_(like_(s1, "%a%"), less_than_(a, 4)), {1, 0, 1, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *or_(like_(s1, "%e%"), equals_(a, 1)), {1, 1, 0, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *or_(less_than_(a, 5), like_(s1, "%e%")), {1, 1, 1, 1}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, ValueLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*value_(5), {5}));
   EXPECT_TRUE(test_expression<float>(*value_(5.0f), {5.0f}));
@@ -230,6 +252,10 @@ TEST_F(ExpressionEvaluatorToValuesTest, ArithmeticsSeries) {
   EXPECT_TRUE(test_expression<int32_t>(table_a, *mul_(a, b), {2, 6, 12, 20}));
   EXPECT_TRUE(test_expression<int32_t>(table_a, *mod_(b, a), {0, 1, 1, 1}));
   EXPECT_TRUE(test_expression<int32_t>(table_a, *mod_(a, c), {1, std::nullopt, 3, std::nullopt}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *div_(b, a), {2, 1, 1, 1}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *div_(a, sub_(b, 3)), {-1, std::nullopt, 3, 2}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *sub_(10, a), {9, 8, 7, 6}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *sub_(a, 10), {-9, -8, -7, -6}));
   EXPECT_TRUE(test_expression<int32_t>(table_a, *add_(a, add_(b, c)), {36, std::nullopt, 41, std::nullopt}));
   EXPECT_TRUE(test_expression<int32_t>(table_a, *add_(a, NullValue{}), {std::nullopt, std::nullopt, std::nullopt, std::nullopt}));  // NOLINT
   EXPECT_TRUE(test_expression<int32_t>(table_a, *add_(a, add_(b, NullValue{})), {std::nullopt, std::nullopt, std::nullopt, std::nullopt}));  // NOLINT
@@ -291,6 +317,24 @@ TEST_F(ExpressionEvaluatorToValuesTest, PredicatesSeries) {
   EXPECT_TRUE(test_expression<int32_t>(table_a, *between_(3.3, a, b), {0, 0, 1, 0}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, StringPredicatesOnDictionarySegments) {
+  // Comparisons of a string column with a literal are evaluated on the value ids of the dictionary
+  ChunkEncoder::encode_all_chunks(table_a);
+
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *equals_(s1, "Hello"), {0, 1, 0, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *not_equals_(s1, "Hello"), {1, 0, 1, 1}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *equals_(s1, "Hallo"), {0, 0, 0, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *not_equals_(s1, "Hallo"), {1, 1, 1, 1}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *less_than_(s1, "Same"), {0, 1, 0, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *less_than_equals_(s1, "Same"), {0, 1, 0, 1}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *greater_than_(s1, "Same"), {1, 0, 1, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *greater_than_equals_("b", s1), {1, 1, 0, 1}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *greater_than_(s1, "x"), {0, 0, 0, 0}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *less_than_(s1, "x"), {1, 1, 1, 1}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *equals_(s3, "abcd"), {std::nullopt, 1, 0, std::nullopt}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *greater_than_(s3, "b"), {std::nullopt, 0, 1, std::nullopt}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, CaseLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*case_(1, 2, 1), {2}));
   EXPECT_TRUE(test_expression<int32_t>(*case_(1, NullValue{}, 1), {std::nullopt}));
@@ -697,6 +741,24 @@ TEST_F(ExpressionEvaluatorToValuesTest, Exists) {
   EXPECT_FALSE(not_exists_expression->is_nullable());
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, CorrelatedSelectWithRepeatedParameterValues) {
+  /**
+   * The two rows with c = NULL bind the same parameter value, the PQP is executed once for both of them
+   *
+   * SELECT
+   *    EXISTS (SELECT x FROM table_b WHERE x + c = 43)
+   * FROM
+   *    table_a;
+   */
+  const auto table_wrapper = std::make_shared<TableWrapper>(table_b);
+  const auto parameter_c = correlated_parameter_(ParameterID{0}, c);
+  const auto x_plus_c_eq_43_scan = std::make_shared<TableScan>(table_wrapper, equals_(add_(x, parameter_c), 43));
+  const auto pqp_select_expression =
+      pqp_select_(x_plus_c_eq_43_scan, DataType::Int, false, std::make_pair(ParameterID{0}, ColumnID{2}));
+
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *exists_(pqp_select_expression), {1, 0, 1, 0}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, ExtractLiterals) {
   EXPECT_TRUE(test_expression<std::string>(*extract_(DatetimeComponent::Year, "1992-09-30"), {"1992"}));
   EXPECT_TRUE(test_expression<std::string>(*extract_(DatetimeComponent::Month, "1992-09-30"), {"09"}));
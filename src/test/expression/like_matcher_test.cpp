@@ -54,4 +54,44 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("Hello", "He_o"));
 }
 
+TEST_F(LikeMatcherTest, WildcardPatterns) {
+  EXPECT_TRUE(match("", ""));
+  EXPECT_FALSE(match("a", ""));
+  EXPECT_TRUE(match("", "%%"));
+  EXPECT_TRUE(match("Hello World", "H_llo%W%d"));
+  EXPECT_TRUE(match("Hello World", "%l_o%"));
+  EXPECT_TRUE(match("Hello World", "___lo%"));
+  EXPECT_TRUE(match("ab", "a%b"));
+  EXPECT_FALSE(match("a", "a%a"));
+  EXPECT_FALSE(match("abc", "%a%b"));
+  EXPECT_TRUE(match("acab", "%a%b"));
+
+  // Sections in the middle are searched for from left to right, the last one has to match at the end
+  EXPECT_TRUE(match("abcxaxcyyz", "%a_c%y_z"));
+  EXPECT_FALSE(match("abcxaxcyyz", "%a_c%y_zz"));
+
+  // A pattern that makes backtracking matchers take exponential time
+  const auto long_string = std::string(200, 'a');
+  EXPECT_FALSE(match(long_string, "%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%b"));
+  EXPECT_TRUE(match(long_string, "%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%a%_"));
+}
+
+TEST_F(LikeMatcherTest, Find) {
+  // Long enough to be searched with registers
+  const auto haystack = "The quick brown fox jumps over the lazy dog, then the quick brown fox sleeps."s;
+
+  EXPECT_EQ(LikeMatcher::find(haystack, "quick"), 4u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "quick", 5), 54u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "q"), 4u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "sleeps."), 70u);
+  EXPECT_EQ(LikeMatcher::find(haystack, "cat"), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find(haystack, ""), 0u);
+  EXPECT_EQ(LikeMatcher::find("short", "or"), 1u);
+
+  for (auto position = size_t{0}; position < haystack.size(); ++position) {
+    const auto needle = std::string_view{haystack}.substr(position, 3);
+    EXPECT_EQ(LikeMatcher::find(haystack, needle), haystack.find(needle));
+  }
+}
+
 }  // namespace opossum
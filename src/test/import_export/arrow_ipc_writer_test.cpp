@@ -0,0 +1,88 @@
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "import_export/arrow_ipc_writer.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ArrowIpcWriterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data);
+    _table->append({1, "a"});
+    _table->append({2, NullValue{}});
+    _table->append({3, "bc"});
+  }
+
+  template <typename T>
+  static T read(const std::string& bytes, const size_t offset) {
+    auto value = T{};
+    std::memcpy(&value, bytes.data() + offset, sizeof(T));
+    return value;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ArrowIpcWriterTest, WritesFramedMessages) {
+  auto stream = std::ostringstream{};
+  ArrowIpcWriter{*_table}.write_schema(stream);
+  const auto schema = stream.str();
+
+  // Each message starts with the continuation marker and the size of the metadata, which is padded to 8 bytes
+  ASSERT_GE(schema.size(), 8u);
+  EXPECT_EQ(read<uint32_t>(schema, 0), 0xFFFFFFFF);
+  const auto metadata_size = read<int32_t>(schema, 4);
+  EXPECT_EQ(metadata_size % 8, 0);
+  EXPECT_EQ(schema.size(), 8u + static_cast<size_t>(metadata_size));
+
+  // The column names are part of the schema
+  EXPECT_NE(schema.find(std::string("a\0", 2)), std::string::npos);
+  EXPECT_NE(schema.find(std::string("b\0", 2)), std::string::npos);
+}
+
+TEST_F(ArrowIpcWriterTest, WritesRecordBatchBody) {
+  auto stream = std::ostringstream{};
+  ArrowIpcWriter{*_table}.write_record_batch(ChunkID{0}, stream);
+  const auto record_batch = stream.str();
+
+  ASSERT_GE(record_batch.size(), 8u);
+  EXPECT_EQ(read<uint32_t>(record_batch, 0), 0xFFFFFFFF);
+  const auto body_offset = 8u + static_cast<size_t>(read<int32_t>(record_batch, 4));
+
+  // Without nulls, the int column has no validity bitmap, only its values, padded to 8 bytes
+  const auto body = record_batch.substr(body_offset);
+  ASSERT_EQ(body.size(), 48u);
+  EXPECT_EQ(read<int32_t>(body, 0), 1);
+  EXPECT_EQ(read<int32_t>(body, 4), 2);
+  EXPECT_EQ(read<int32_t>(body, 8), 3);
+
+  // The string column has a validity bitmap with the second row being null, the offsets, and the characters
+  EXPECT_EQ(read<uint8_t>(body, 16), 0b101);
+  EXPECT_EQ(read<int32_t>(body, 24), 0);
+  EXPECT_EQ(read<int32_t>(body, 28), 1);
+  EXPECT_EQ(read<int32_t>(body, 32), 1);
+  EXPECT_EQ(read<int32_t>(body, 36), 3);
+  EXPECT_EQ(body.substr(40, 3), "abc");
+}
+
+TEST_F(ArrowIpcWriterTest, WritesStream) {
+  auto stream = std::ostringstream{};
+  ArrowIpcWriter::write(*_table, stream);
+  const auto bytes = stream.str();
+
+  // The stream ends with the end-of-stream marker
+  ASSERT_GE(bytes.size(), 8u);
+  EXPECT_EQ(read<uint32_t>(bytes, bytes.size() - 8), 0xFFFFFFFF);
+  EXPECT_EQ(read<uint32_t>(bytes, bytes.size() - 4), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,98 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "import_export/csv_meta_inference.hpp"
+#include "import_export/csv_parser.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CsvMetaInferenceTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    std::remove(filename.c_str());
+    std::remove((filename + CsvMeta::META_FILE_EXTENSION).c_str());
+  }
+
+  void write_csv(const std::string& content) {
+    std::ofstream file{filename};
+    file << content;
+  }
+
+  const std::string filename = test_data_path + "inferred.csv";
+};
+
+TEST_F(CsvMetaInferenceTest, InfersNarrowestTypes) {
+  write_csv(
+      "1,3000000000,1.5,1.2345678,abc,,\"7\"\n"
+      "-2,4,2.25,2,4,5,8\n"
+      "3,5,16777216,3.5,5.5,6,9\n");
+
+  const auto meta = infer_csv_meta(filename);
+
+  ASSERT_EQ(meta.columns.size(), 7u);
+  EXPECT_EQ(meta.columns[0].name, "column_0");
+  EXPECT_EQ(meta.columns[0].type, "int");
+  EXPECT_EQ(meta.columns[1].type, "long");
+  EXPECT_EQ(meta.columns[2].type, "float");
+  EXPECT_EQ(meta.columns[3].type, "double");
+  EXPECT_EQ(meta.columns[4].type, "string");
+  EXPECT_EQ(meta.columns[5].type, "int");
+  EXPECT_EQ(meta.columns[6].type, "string");
+
+  EXPECT_FALSE(meta.columns[0].nullable);
+  EXPECT_TRUE(meta.columns[5].nullable);
+
+  for (const auto& column_meta : meta.columns) {
+    EXPECT_TRUE(column_meta.encoding);
+  }
+}
+
+TEST_F(CsvMetaInferenceTest, IntegersTooLargeForFloats) {
+  write_csv("16777217,1.5\n0.5,2\n");
+
+  const auto meta = infer_csv_meta(filename, ParseConfig{}, {"a", "b"});
+
+  EXPECT_EQ(meta.columns[0].name, "a");
+  EXPECT_EQ(meta.columns[0].type, "double");
+  EXPECT_EQ(meta.columns[1].name, "b");
+  EXPECT_EQ(meta.columns[1].type, "float");
+
+  EXPECT_THROW(infer_csv_meta(filename, ParseConfig{}, {"a"}), std::logic_error);
+}
+
+TEST_F(CsvMetaInferenceTest, CompressedFile) {
+  const auto meta = infer_csv_meta("resources/test_data/csv/float_int_large.csv.gz");
+  const auto expected_meta = process_csv_meta_file("resources/test_data/csv/float_int_large.csv.json");
+
+  ASSERT_EQ(meta.columns.size(), expected_meta.columns.size());
+  for (auto column_id = size_t{0}; column_id < meta.columns.size(); ++column_id) {
+    EXPECT_EQ(meta.columns[column_id].type, expected_meta.columns[column_id].type);
+    EXPECT_EQ(meta.columns[column_id].nullable, expected_meta.columns[column_id].nullable);
+  }
+}
+
+TEST_F(CsvMetaInferenceTest, ParserWritesInferredMeta) {
+  write_csv("1,a\n1,b\n1,c\n1,\n");
+
+  const auto table = CsvParser{}.parse(filename);
+
+  EXPECT_EQ(table->row_count(), 4u);
+  EXPECT_EQ(table->column_data_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(table->column_data_type(ColumnID{1}), DataType::String);
+  EXPECT_TRUE(table->column_is_nullable(ColumnID{1}));
+
+  // The inferred encodings are applied while importing
+  const auto segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BaseEncodedSegment>(segment));
+
+  const auto written_meta = process_csv_meta_file(filename + CsvMeta::META_FILE_EXTENSION);
+  EXPECT_EQ(written_meta, infer_csv_meta(filename));
+}
+
+}  // namespace opossum
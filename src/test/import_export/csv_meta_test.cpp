@@ -11,9 +11,9 @@ TEST_F(CsvMetaTest, ProcessCsvMetaFile) {
   auto meta = process_csv_meta_file("resources/test_data/csv/sample_meta_information.csv.json");
 
   auto meta_expected = CsvMeta{};
-  meta_expected.columns.emplace_back(ColumnMeta{"a", "int", false});
-  meta_expected.columns.emplace_back(ColumnMeta{"b", "string", false});
-  meta_expected.columns.emplace_back(ColumnMeta{"c", "float", true});
+  meta_expected.columns.emplace_back(ColumnMeta{"a", "int", false, std::nullopt});
+  meta_expected.columns.emplace_back(ColumnMeta{"b", "string", false, std::nullopt});
+  meta_expected.columns.emplace_back(ColumnMeta{"c", "float", true, std::nullopt});
 
   EXPECT_EQ(meta_expected, meta);
 }
@@ -1,8 +1,16 @@
+#include <fstream>
+#include <iterator>
+#include <string>
+
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "import_export/csv_parser.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/base_encoded_segment.hpp"
 #include "storage/table.hpp"
+#include "utils/filesystem.hpp"
 
 namespace opossum {
 
@@ -18,4 +26,89 @@ TEST_F(CsvParserTest, EmptyTableFromMetaFile) {
   EXPECT_TABLE_EQ_UNORDERED(csv_meta_table, expected_table);
 }
 
+TEST_F(CsvParserTest, RowsSpanningBlocks) {
+  // With tiny blocks, most rows and quoted fields (including a quoted line break) are split between blocks
+  CsvParser parser{3};
+  const auto table = parser.parse("resources/test_data/csv/string_escaped.csv", std::nullopt, ChunkOffset{2});
+
+  auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String}}, TableType::Data, 2);
+  expected_table->append({"aa\"\"aa"});
+  expected_table->append({"xx\"x"});
+  expected_table->append({"yy,y"});
+  expected_table->append({"zz\nz"});
+
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+TEST_F(CsvParserTest, ParallelParsingKeepsChunkOrder) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  CsvParser parser{16};
+  const auto table = parser.parse("resources/test_data/csv/float_int_large.csv", std::nullopt, ChunkOffset{7});
+  const auto expected_table = CsvParser{}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt,
+                                                ChunkOffset{7});
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(table->chunk_count(), 15u);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+TEST_F(CsvParserTest, GzipCompressedFile) {
+  // The file consists of two gzip members. The small blocks make the decompression stop and resume within members.
+  const auto table = CsvParser{100}.parse("resources/test_data/csv/float_int_large.csv.gz", std::nullopt,
+                                          ChunkOffset{7});
+  const auto expected_table = CsvParser{}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt,
+                                                ChunkOffset{7});
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+}
+
+TEST_F(CsvParserTest, ZstdCompressedFile) {
+#if HYRISE_ZSTD_SUPPORT
+  // The file consists of two zstd frames
+  const auto table = CsvParser{100}.parse("resources/test_data/csv/float_int_large.csv.zst", std::nullopt,
+                                          ChunkOffset{7});
+  const auto expected_table = CsvParser{}.parse("resources/test_data/csv/float_int_large.csv", std::nullopt,
+                                                ChunkOffset{7});
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+#else
+  EXPECT_THROW(CsvParser{}.parse("resources/test_data/csv/float_int_large.csv.zst"), std::logic_error);
+#endif
+}
+
+TEST_F(CsvParserTest, TruncatedCompressedFile) {
+  const auto filename = test_data_path + "truncated.csv.gz";
+  {
+    std::ifstream compressed_file{"resources/test_data/csv/float_int_large.csv.gz", std::ios::binary};
+    const auto content = std::string{std::istreambuf_iterator<char>{compressed_file}, {}};
+    std::ofstream truncated_file{filename, std::ios::binary};
+    truncated_file << content.substr(0, content.size() - 4);
+  }
+
+  const auto csv_meta = process_csv_meta_file("resources/test_data/csv/float_int_large.csv.json");
+  EXPECT_THROW(CsvParser{}.parse(filename, csv_meta), std::logic_error);
+
+  filesystem::remove(filename);
+}
+
+TEST_F(CsvParserTest, EncodesChunks) {
+  CsvParser parser;
+  const auto table = parser.parse("resources/test_data/csv/float_int_large.csv", std::nullopt, ChunkOffset{20},
+                                  ChunkEncodingSpec{{EncodingType::Dictionary}, {EncodingType::RunLength}});
+
+  EXPECT_EQ(table->row_count(), 100u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+      EXPECT_TRUE(std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id)));
+    }
+    EXPECT_EQ(std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(ColumnID{1}))->encoding_type(),
+              EncodingType::RunLength);
+  }
+}
+
 }  // namespace opossum
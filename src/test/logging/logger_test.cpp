@@ -0,0 +1,143 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "logging/logger.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/filesystem.hpp"
+
+namespace opossum {
+
+class LoggerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::remove(_log_file_path.c_str());
+    StorageManager::get().add_table("table_a", _create_table());
+  }
+
+  void TearDown() override {
+    Logger::get().disable();
+    std::remove(_log_file_path.c_str());
+    filesystem::remove_all(_checkpoint_directory);
+  }
+
+  // Two rows per chunk, so that the logged rows span several chunks
+  static std::shared_ptr<Table> _create_table() {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    return std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  }
+
+  static std::shared_ptr<const Table> _execute(const std::string& sql) {
+    return SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+  }
+
+  const std::string _log_file_path = test_data_path + "logger_test.log";
+  const std::string _checkpoint_directory = test_data_path + "logger_test_checkpoints";
+};
+
+TEST_F(LoggerTest, CommittedChangesAreRecovered) {
+  Logger::get().enable(_log_file_path);
+
+  _execute("INSERT INTO table_a VALUES (1, 'one')");
+  _execute("INSERT INTO table_a VALUES (2, NULL)");
+  _execute("INSERT INTO table_a VALUES (3, 'three')");
+  _execute("DELETE FROM table_a WHERE a = 2");
+  _execute("UPDATE table_a SET b = 'updated' WHERE a = 3");
+
+  // The rolled back row is not logged, but the rows inserted after it have to be recovered at their positions
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (5, 'rolled back')"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  transaction_context->rollback();
+
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+
+  const auto expected_table = _execute("SELECT * FROM table_a");
+  const auto row_count = StorageManager::get().get_table("table_a")->row_count();
+  Logger::get().disable();
+
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", _create_table());
+  EXPECT_EQ(Logger::recover(_log_file_path), 6u);
+
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), expected_table);
+  EXPECT_EQ(StorageManager::get().get_table("table_a")->row_count(), row_count);
+
+  // Changes made after the recovery can be logged to the same file and end up at the same positions
+  Logger::get().enable(_log_file_path);
+  _execute("DELETE FROM table_a WHERE a = 1");
+  const auto expected_table_after_delete = _execute("SELECT * FROM table_a");
+  Logger::get().disable();
+
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", _create_table());
+  EXPECT_EQ(Logger::recover(_log_file_path), 7u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), expected_table_after_delete);
+}
+
+TEST_F(LoggerTest, CheckpointAndLogTailAreRecovered) {
+  Logger::get().enable(_log_file_path);
+
+  _execute("INSERT INTO table_a VALUES (1, 'one')");
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (5, 'rolled back')"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  transaction_context->rollback();
+  _execute("INSERT INTO table_a VALUES (2, NULL)");
+
+  // The second checkpoint replaces the first one
+  Logger::get().checkpoint(_checkpoint_directory);
+  _execute("INSERT INTO table_a VALUES (3, 'three')");
+  Logger::get().checkpoint(_checkpoint_directory);
+
+  // Only these transactions are replayed from the log
+  _execute("DELETE FROM table_a WHERE a = 1");
+  _execute("INSERT INTO table_a VALUES (4, 'four')");
+
+  const auto expected_table = _execute("SELECT * FROM table_a");
+  const auto chunk_count = StorageManager::get().get_table("table_a")->chunk_count();
+  const auto row_count = StorageManager::get().get_table("table_a")->row_count();
+  Logger::get().disable();
+
+  StorageManager::reset();
+  EXPECT_EQ(Logger::recover_from_checkpoint(_checkpoint_directory, _log_file_path), 2u);
+
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a"), expected_table);
+  EXPECT_EQ(StorageManager::get().get_table("table_a")->chunk_count(), chunk_count);
+  EXPECT_EQ(StorageManager::get().get_table("table_a")->row_count(), row_count);
+}
+
+TEST_F(LoggerTest, CallbacksWaitUntilTheLogIsDurable) {
+  Logger::get().enable(_log_file_path);
+
+  // Positions that the log has already reached are durable right away
+  auto called = false;
+  Logger::get().on_durable(0, [&]() { called = true; });
+  EXPECT_TRUE(called);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (1, 'one')"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  EXPECT_TRUE(transaction_context->commit());
+
+  // commit() returns only after the callback, i.e., once the log has been flushed
+  auto log_file = std::ifstream{_log_file_path, std::ios::binary | std::ios::ate};
+  EXPECT_GT(log_file.tellg(), 0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/intermediate_result_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class IntermediateResultNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_int.tbl");
+
+    _mock_node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    _mock_node->set_statistics(std::make_shared<TableStatistics>(
+        TableType::Data, 100.0f,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100.0f, 1, 100),
+            std::make_shared<ColumnStatistics<int32_t>>(0.5f, 2.0f, 10, 20)}));
+
+    _a = lqp_column_({_mock_node, ColumnID{0}});
+    _b = lqp_column_({_mock_node, ColumnID{1}});
+
+    _intermediate_result_node = IntermediateResultNode::make(_mock_node, _table);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<MockNode> _mock_node;
+  std::shared_ptr<AbstractExpression> _a, _b;
+  std::shared_ptr<IntermediateResultNode> _intermediate_result_node;
+};
+
+TEST_F(IntermediateResultNodeTest, Description) {
+  EXPECT_EQ(_intermediate_result_node->description(), "[IntermediateResult] 3 rows");
+}
+
+TEST_F(IntermediateResultNodeTest, ColumnExpressions) {
+  const auto& column_expressions = _intermediate_result_node->column_expressions();
+  ASSERT_EQ(column_expressions.size(), 2u);
+  EXPECT_EQ(*column_expressions.at(0), *_a);
+  EXPECT_EQ(*column_expressions.at(1), *_b);
+}
+
+TEST_F(IntermediateResultNodeTest, Statistics) {
+  const auto statistics = _intermediate_result_node->get_statistics();
+  EXPECT_FLOAT_EQ(statistics->row_count(), 3.0f);
+  ASSERT_EQ(statistics->column_statistics().size(), 2u);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(statistics->column_statistics().at(0));
+  ASSERT_TRUE(column_statistics_a);
+  EXPECT_FLOAT_EQ(column_statistics_a->distinct_count(), 3.0f);
+  EXPECT_EQ(column_statistics_a->min(), 1);
+  EXPECT_EQ(column_statistics_a->max(), 100);
+
+  const auto column_statistics_b =
+      std::dynamic_pointer_cast<const ColumnStatistics<int32_t>>(statistics->column_statistics().at(1));
+  ASSERT_TRUE(column_statistics_b);
+  EXPECT_FLOAT_EQ(column_statistics_b->distinct_count(), 2.0f);
+  EXPECT_FLOAT_EQ(column_statistics_b->null_value_ratio(), 0.5f);
+}
+
+TEST_F(IntermediateResultNodeTest, Equals) {
+  EXPECT_EQ(*_intermediate_result_node, *_intermediate_result_node);
+  EXPECT_EQ(*_intermediate_result_node, *IntermediateResultNode::make(_mock_node, _table));
+  EXPECT_NE(*_intermediate_result_node,
+            *IntermediateResultNode::make(_mock_node, load_table("resources/test_data/tbl/int_int.tbl")));
+}
+
+TEST_F(IntermediateResultNodeTest, Copy) {
+  // Expressions above the node reference the replaced node, they have to survive the copy
+  const auto lqp = ProjectionNode::make(expression_vector(_b, _a), _intermediate_result_node);
+  const auto copied_lqp = lqp->deep_copy();
+
+  EXPECT_EQ(*copied_lqp, *lqp);
+  EXPECT_EQ(*copied_lqp->column_expressions().at(0), *_b);
+  EXPECT_NE(copied_lqp->left_input(), _intermediate_result_node);
+}
+
+}  // namespace opossum
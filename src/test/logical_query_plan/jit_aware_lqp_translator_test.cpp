@@ -12,6 +12,9 @@
 #include "operators/jit_operator/operators/jit_aggregate.hpp"
 #include "operators/jit_operator/operators/jit_compute.hpp"
 #include "operators/jit_operator/operators/jit_filter.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+#include "operators/jit_operator/operators/jit_limit.hpp"
+#include "operators/jit_operator/operators/jit_read_deferred_columns.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_validate.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
@@ -44,13 +47,15 @@ class JitAwareLQPTranslatorTest : public BaseTest {
   // (which could be any AbstractOperator) is dynamically cast to a JitOperatorWrapper pointer. Thus, a simple nullptr
   // check can be used to test whether a JitOperatorWrapper has been created by the translator as the root node of the
   // PQP.
-  std::shared_ptr<const JitOperatorWrapper> translate_query(const std::string& sql) const {
+  std::shared_ptr<const JitOperatorWrapper> translate_query(const std::string& sql,
+                                                            const float min_pipeline_work = 0.0f) const {
     const auto lqp = SQLPipelineBuilder(sql).create_pipeline_statement(nullptr).get_unoptimized_logical_plan();
-    return translate_lqp(lqp);
+    return translate_lqp(lqp, min_pipeline_work);
   }
 
-  std::shared_ptr<const JitOperatorWrapper> translate_lqp(const std::shared_ptr<AbstractLQPNode>& lqp) const {
-    JitAwareLQPTranslator lqp_translator;
+  std::shared_ptr<const JitOperatorWrapper> translate_lqp(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                          const float min_pipeline_work = 0.0f) const {
+    JitAwareLQPTranslator lqp_translator{min_pipeline_work};
     std::shared_ptr<const AbstractOperator> current_node = lqp_translator.translate_node(lqp);
     while (current_node && !std::dynamic_pointer_cast<const JitOperatorWrapper>(current_node)) {
       current_node = current_node->input_left();
@@ -106,6 +111,13 @@ TEST_F(JitAwareLQPTranslatorTest, JitPipelineRequiresASingleInputNode) {
   }
 }
 
+TEST_F(JitAwareLQPTranslatorTest, PipelinesWithLittleWorkAreNotJitted) {
+  // table_a has four rows, so the pipeline's estimated work is far from the threshold of one million
+  ASSERT_NE(translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2"), nullptr);
+  ASSERT_NE(translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2", 1.0f), nullptr);
+  ASSERT_EQ(translate_query("SELECT a FROM table_a WHERE a > 1 AND b > 2", 1'000'000.0f), nullptr);
+}
+
 TEST_F(JitAwareLQPTranslatorTest, JitOperatorsRejectIndexScan) {
   // The jit operators do not yet support index scans and should thus reject translating them
   const auto predicate_node_1 = std::make_shared<PredicateNode>(greater_than_(a_a, 1));
@@ -135,7 +147,7 @@ TEST_F(JitAwareLQPTranslatorTest, InputColumnsAreAddedToJitReadTupleAdapter) {
   const auto jit_operator_wrapper = translate_query("SELECT a, b FROM table_b WHERE a > 1");
   ASSERT_TRUE(jit_operator_wrapper);
   const auto jit_operators = jit_operator_wrapper->jit_operators();
-  ASSERT_EQ(jit_operators.size(), 5u);
+  ASSERT_EQ(jit_operators.size(), 6u);
 
   // Check that the first operator is in fact a JitReadTuples instance
   const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
@@ -148,10 +160,12 @@ TEST_F(JitAwareLQPTranslatorTest, InputColumnsAreAddedToJitReadTupleAdapter) {
   ASSERT_EQ(input_columns[0].column_id, ColumnID{0});
   ASSERT_EQ(input_columns[0].tuple_value.data_type(), DataType::Int);
   ASSERT_EQ(input_columns[0].tuple_value.is_nullable(), true);
+  ASSERT_FALSE(input_columns[0].is_deferred);
 
   ASSERT_EQ(input_columns[1].column_id, ColumnID{1});
   ASSERT_EQ(input_columns[1].tuple_value.data_type(), DataType::Float);
   ASSERT_EQ(input_columns[1].tuple_value.is_nullable(), true);
+  ASSERT_TRUE(input_columns[1].is_deferred);
 }
 
 TEST_F(JitAwareLQPTranslatorTest, LiteralValuesAreAddedToJitReadTupleAdapter) {
@@ -203,11 +217,11 @@ TEST_F(JitAwareLQPTranslatorTest, AllColumnsAreOutputCorrectly) {
   const auto jit_operator_wrapper = translate_query("SELECT * FROM table_a WHERE a > 1");
   ASSERT_TRUE(jit_operator_wrapper);
   const auto jit_operators = jit_operator_wrapper->jit_operators();
-  ASSERT_EQ(jit_operators.size(), 5u);
+  ASSERT_EQ(jit_operators.size(), 6u);
 
   const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
   ASSERT_NE(jit_read_tuples, nullptr);
-  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[4]);
+  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[5]);
   ASSERT_NE(jit_write_tuples, nullptr);
 
   const auto output_columns = jit_write_tuples->output_columns();
@@ -222,11 +236,11 @@ TEST_F(JitAwareLQPTranslatorTest, ReorderedColumnsAreOutputCorrectly) {
   const auto jit_operator_wrapper = translate_query("SELECT c, a FROM table_a WHERE a > 1");
   ASSERT_TRUE(jit_operator_wrapper);
   const auto jit_operators = jit_operator_wrapper->jit_operators();
-  ASSERT_EQ(jit_operators.size(), 5u);
+  ASSERT_EQ(jit_operators.size(), 6u);
 
   const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
   ASSERT_NE(jit_read_tuples, nullptr);
-  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[4]);
+  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[5]);
   ASSERT_NE(jit_write_tuples, nullptr);
 
   const auto output_columns = jit_write_tuples->output_columns();
@@ -235,13 +249,49 @@ TEST_F(JitAwareLQPTranslatorTest, ReorderedColumnsAreOutputCorrectly) {
   ASSERT_EQ(jit_read_tuples->find_input_column(output_columns[1].tuple_value), ColumnID{0});
 }
 
+TEST_F(JitAwareLQPTranslatorTest, ColumnsOnlyUsedAfterFilterAreDeferred) {
+  // Column c is only output, so it is read after the filter for the qualifying rows only
+  const auto jit_operator_wrapper = translate_query("SELECT a, c FROM table_a WHERE a > b");
+  ASSERT_TRUE(jit_operator_wrapper);
+  const auto jit_operators = jit_operator_wrapper->jit_operators();
+  ASSERT_EQ(jit_operators.size(), 6u);
+
+  const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
+  const auto jit_validate = std::dynamic_pointer_cast<JitValidate>(jit_operators[1]);
+  const auto jit_compute = std::dynamic_pointer_cast<JitCompute>(jit_operators[2]);
+  const auto jit_filter = std::dynamic_pointer_cast<JitFilter>(jit_operators[3]);
+  const auto jit_read_deferred_columns = std::dynamic_pointer_cast<JitReadDeferredColumns>(jit_operators[4]);
+  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[5]);
+  ASSERT_NE(jit_read_tuples, nullptr);
+  ASSERT_NE(jit_validate, nullptr);
+  ASSERT_NE(jit_compute, nullptr);
+  ASSERT_NE(jit_filter, nullptr);
+  ASSERT_NE(jit_read_deferred_columns, nullptr);
+  ASSERT_NE(jit_write_tuples, nullptr);
+
+  const auto input_columns = jit_read_tuples->input_columns();
+  ASSERT_EQ(input_columns.size(), 3u);
+  ASSERT_EQ(input_columns[2].column_id, ColumnID{2});
+  ASSERT_TRUE(input_columns[2].is_deferred);
+  ASSERT_FALSE(input_columns[0].is_deferred);
+  ASSERT_FALSE(input_columns[1].is_deferred);
+
+  // Without a filter, all columns are read for every row anyway
+  const auto jit_operator_wrapper_without_filter =
+      translate_query("SELECT COUNT(a), SUM(b), AVG(a + b), MIN(a), MAX(b) FROM table_a GROUP BY a");
+  ASSERT_TRUE(jit_operator_wrapper_without_filter);
+  for (const auto& jit_operator : jit_operator_wrapper_without_filter->jit_operators()) {
+    ASSERT_EQ(std::dynamic_pointer_cast<JitReadDeferredColumns>(jit_operator), nullptr);
+  }
+}
+
 TEST_F(JitAwareLQPTranslatorTest, OutputColumnNamesAndAlias) {
   const auto jit_operator_wrapper = translate_query("SELECT a, b as b_new FROM table_a WHERE a > 1");
   ASSERT_TRUE(jit_operator_wrapper);
   const auto jit_operators = jit_operator_wrapper->jit_operators();
-  ASSERT_EQ(jit_operators.size(), 5u);
+  ASSERT_EQ(jit_operators.size(), 6u);
 
-  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[4]);
+  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[5]);
   ASSERT_NE(jit_write_tuples, nullptr);
 
   const auto output_columns = jit_write_tuples->output_columns();
@@ -469,6 +519,78 @@ TEST_F(JitAwareLQPTranslatorTest, AMoreComplexQuery) {
   ASSERT_EQ(expression_2->result(), std::make_optional(output_columns[1].tuple_value));
 }
 
+TEST_F(JitAwareLQPTranslatorTest, LimitIsAddedAfterFilters) {
+  const auto jit_operator_wrapper = translate_query("SELECT a FROM table_a WHERE a > 1 LIMIT 2");
+  ASSERT_NE(jit_operator_wrapper, nullptr);
+
+  // Check the type of jit operators in the operator pipeline
+  const auto jit_operators = jit_operator_wrapper->jit_operators();
+  ASSERT_EQ(jit_operators.size(), 6u);
+
+  const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
+  const auto jit_validate = std::dynamic_pointer_cast<JitValidate>(jit_operators[1]);
+  const auto jit_compute = std::dynamic_pointer_cast<JitCompute>(jit_operators[2]);
+  const auto jit_filter = std::dynamic_pointer_cast<JitFilter>(jit_operators[3]);
+  const auto jit_limit = std::dynamic_pointer_cast<JitLimit>(jit_operators[4]);
+  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[5]);
+  ASSERT_NE(jit_read_tuples, nullptr);
+  ASSERT_NE(jit_validate, nullptr);
+  ASSERT_NE(jit_compute, nullptr);
+  ASSERT_NE(jit_filter, nullptr);
+  ASSERT_NE(jit_limit, nullptr);
+  ASSERT_NE(jit_write_tuples, nullptr);
+
+  ASSERT_EQ(jit_limit->row_count(), 2u);
+}
+
+TEST_F(JitAwareLQPTranslatorTest, JoinIsFusedAsHashJoinProbe) {
+  {
+    // A join on its own is not worth a pipeline
+    const auto jit_operator_wrapper =
+        translate_query("SELECT table_a.a, table_b.b FROM table_a JOIN table_b ON table_a.a = table_b.a");
+    ASSERT_EQ(jit_operator_wrapper, nullptr);
+  }
+
+  const auto jit_operator_wrapper = translate_query(
+      "SELECT table_a.a, table_b.b FROM table_a JOIN table_b ON table_a.a = table_b.a WHERE table_b.b > 1.0");
+  ASSERT_NE(jit_operator_wrapper, nullptr);
+  ASSERT_NE(jit_operator_wrapper->input_right(), nullptr);
+
+  // Check the type of jit operators in the operator pipeline
+  const auto jit_operators = jit_operator_wrapper->jit_operators();
+  ASSERT_EQ(jit_operators.size(), 6u);
+
+  const auto jit_read_tuples = std::dynamic_pointer_cast<JitReadTuples>(jit_operators[0]);
+  const auto jit_validate = std::dynamic_pointer_cast<JitValidate>(jit_operators[1]);
+  const auto jit_probe = std::dynamic_pointer_cast<JitHashJoinProbe>(jit_operators[2]);
+  const auto jit_compute = std::dynamic_pointer_cast<JitCompute>(jit_operators[3]);
+  const auto jit_filter = std::dynamic_pointer_cast<JitFilter>(jit_operators[4]);
+  const auto jit_write_tuples = std::dynamic_pointer_cast<JitWriteTuples>(jit_operators[5]);
+  ASSERT_NE(jit_read_tuples, nullptr);
+  ASSERT_NE(jit_validate, nullptr);
+  ASSERT_NE(jit_probe, nullptr);
+  ASSERT_NE(jit_compute, nullptr);
+  ASSERT_NE(jit_filter, nullptr);
+  ASSERT_NE(jit_write_tuples, nullptr);
+
+  // table_a.a is probed against table_b.a
+  const auto key_columns = jit_probe->key_columns();
+  ASSERT_EQ(key_columns.size(), 1u);
+  ASSERT_EQ(jit_read_tuples->find_input_column(key_columns[0].probe_value), ColumnID{0});
+  ASSERT_EQ(key_columns[0].build_column_id, ColumnID{0});
+
+  // table_b.b is read from the build side, both by the filter and the output
+  const auto build_column_b = jit_probe->find_build_column(ColumnID{1});
+  ASSERT_TRUE(build_column_b.has_value());
+  ASSERT_EQ(jit_probe->build_columns().size(), 1u);
+  ASSERT_EQ(jit_compute->expression()->left_child()->result(), *build_column_b);
+
+  const auto output_columns = jit_write_tuples->output_columns();
+  ASSERT_EQ(output_columns.size(), 2u);
+  ASSERT_EQ(jit_read_tuples->find_input_column(output_columns[0].tuple_value), ColumnID{0});
+  ASSERT_EQ(output_columns[1].tuple_value, *build_column_b);
+}
+
 TEST_F(JitAwareLQPTranslatorTest, AggregateOperator) {
   const auto jit_operator_wrapper =
       translate_query("SELECT COUNT(a), SUM(b), AVG(a + b), MIN(a), MAX(b) FROM table_a GROUP BY a");
@@ -27,11 +27,14 @@
 #include "logical_query_plan/sort_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "operators/aggregate.hpp"
+#include "operators/distinct.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
-#include "operators/join_sort_merge.hpp"
+#include "operators/join_iejoin.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
@@ -43,6 +46,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -180,6 +184,55 @@ TEST_F(LQPTranslatorTest, PredicateNodeSimpleBinary) {
   EXPECT_EQ(get_table_op->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeChainIsFusedIntoOneTableScan) {
+  /**
+   * LQP resembles:
+   *   SELECT * FROM int_float WHERE a > 5 AND b < 6.0 AND a <> b;
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(not_equals_(int_float_a, int_float_b),
+    PredicateNode::make(less_than_(int_float_b, 6.0),
+      PredicateNode::make(greater_than_(int_float_a, 5),
+        int_float_node)));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto a = PQPColumnExpression::from_table(*table_int_float, ColumnID{0});
+  const auto b = PQPColumnExpression::from_table(*table_int_float, ColumnID{1});
+
+  // `a <> b` compares two columns and remains a separate scan
+  const auto column_vs_column_scan = std::dynamic_pointer_cast<const TableScan>(pqp);
+  ASSERT_TRUE(column_vs_column_scan);
+  EXPECT_EQ(*column_vs_column_scan->predicate(), *not_equals_(a, b));
+
+  // The bottom predicate is evaluated first
+  const auto fused_scan = std::dynamic_pointer_cast<const TableScan>(pqp->input_left());
+  ASSERT_TRUE(fused_scan);
+  EXPECT_EQ(*fused_scan->predicate(), *and_(greater_than_(a, 5), less_than_(b, 6.0)));
+
+  const auto get_table_op = std::dynamic_pointer_cast<const GetTable>(fused_scan->input_left());
+  ASSERT_TRUE(get_table_op);
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodeChainWithSharedPredicateIsNotFused) {
+  const auto shared_predicate_node = PredicateNode::make(greater_than_(int_float_a, 5), int_float_node);
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(UnionMode::Positions,
+    PredicateNode::make(less_than_(int_float_b, 6.0), shared_predicate_node),
+    PredicateNode::make(greater_than_(int_float_b, 7.0), shared_predicate_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  // The shared predicate is only scanned once and both of its outputs build on top of it
+  ASSERT_TRUE(std::dynamic_pointer_cast<const TableScan>(pqp->input_left()));
+  ASSERT_TRUE(std::dynamic_pointer_cast<const TableScan>(pqp->input_right()));
+  EXPECT_EQ(pqp->input_left()->input_left(), pqp->input_right()->input_left());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const TableScan>(pqp->input_left()->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeLike) {
   /**
    * Build LQP and translate to PQP
@@ -326,22 +379,18 @@ TEST_F(LQPTranslatorTest, Sort) {
   const auto projection_a = std::dynamic_pointer_cast<const Projection>(pqp);
   ASSERT_TRUE(projection_a);
 
-  const auto sort_a = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
-  ASSERT_TRUE(sort_a);
-  EXPECT_EQ(sort_a->column_id(), ColumnID{1});
-  EXPECT_EQ(sort_a->order_by_mode(), OrderByMode::Ascending);
-
-  const auto sort_a_plus_b = std::dynamic_pointer_cast<const Sort>(sort_a->input_left());
-  ASSERT_TRUE(sort_a_plus_b);
-  EXPECT_EQ(sort_a_plus_b->column_id(), ColumnID{0});
-  EXPECT_EQ(sort_a_plus_b->order_by_mode(), OrderByMode::Descending);
-
-  const auto sort_b = std::dynamic_pointer_cast<const Sort>(sort_a_plus_b->input_left());
-  ASSERT_TRUE(sort_b);
-  EXPECT_EQ(sort_b->column_id(), ColumnID{2});
-  EXPECT_EQ(sort_b->order_by_mode(), OrderByMode::AscendingNullsLast);
-
-  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort_b->input_left());
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
+  ASSERT_TRUE(sort);
+  const auto& sort_definitions = sort->sort_definitions();
+  ASSERT_EQ(sort_definitions.size(), 3u);
+  EXPECT_EQ(sort_definitions[0].column, ColumnID{1});
+  EXPECT_EQ(sort_definitions[0].order_by_mode, OrderByMode::Ascending);
+  EXPECT_EQ(sort_definitions[1].column, ColumnID{0});
+  EXPECT_EQ(sort_definitions[1].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort_definitions[2].column, ColumnID{2});
+  EXPECT_EQ(sort_definitions[2].order_by_mode, OrderByMode::AscendingNullsLast);
+
+  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort->input_left());
   ASSERT_TRUE(projection_b);
 
   const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
@@ -365,17 +414,17 @@ TEST_F(LQPTranslatorTest, JoinNonEqui) {
   /**
    * Check PQP
    */
-  const auto join_sort_merge = std::dynamic_pointer_cast<JoinSortMerge>(pqp);
-  ASSERT_TRUE(join_sort_merge);
-  EXPECT_EQ(join_sort_merge->column_ids().first, ColumnID{1});
-  EXPECT_EQ(join_sort_merge->column_ids().second, ColumnID{0});
-  EXPECT_EQ(join_sort_merge->predicate_condition(), PredicateCondition::GreaterThan);
+  const auto join_adaptive = std::dynamic_pointer_cast<JoinAdaptive>(pqp);
+  ASSERT_TRUE(join_adaptive);
+  EXPECT_EQ(join_adaptive->column_ids().first, ColumnID{1});
+  EXPECT_EQ(join_adaptive->column_ids().second, ColumnID{0});
+  EXPECT_EQ(join_adaptive->predicate_condition(), PredicateCondition::GreaterThan);
 
-  const auto get_table_int_float2 = std::dynamic_pointer_cast<const GetTable>(join_sort_merge->input_left());
+  const auto get_table_int_float2 = std::dynamic_pointer_cast<const GetTable>(join_adaptive->input_left());
   ASSERT_TRUE(get_table_int_float2);
   EXPECT_EQ(get_table_int_float2->table_name(), "table_int_float2");
 
-  const auto get_table_int_float = std::dynamic_pointer_cast<const GetTable>(join_sort_merge->input_right());
+  const auto get_table_int_float = std::dynamic_pointer_cast<const GetTable>(join_adaptive->input_right());
   ASSERT_TRUE(get_table_int_float);
   EXPECT_EQ(get_table_int_float->table_name(), "table_int_float");
 }
@@ -471,6 +520,68 @@ TEST_F(LQPTranslatorTest, PredicateNodeIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *equals_(b, 42));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeTableIndexScan) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  table->create_table_index(ColumnID{1});
+
+  auto predicate_node = PredicateNode::make(equals_(stored_table_node->get_column("b"), 42));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP: The table index covers all chunks, so there is no TableScan for the chunks without a chunk index
+   */
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op);
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_TRUE(get_included_chunk_ids(index_scan_op).empty());
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodeTableIndexScanOnPrunedTable) {
+  /**
+   * Build LQP and translate to PQP. GetTable outputs a copy without the excluded chunk, which has no table index.
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  stored_table_node->set_excluded_chunk_ids({ChunkID{0}});
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  table->create_table_index(ColumnID{1});
+  table->get_chunk(ChunkID{2})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{1}});
+
+  auto predicate_node = PredicateNode::make(greater_than_(stored_table_node->get_column("b"), 456.0f));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  /**
+   * Check PQP: The chunk indexes are used with the ChunkIDs of the pruned table
+   */
+  const auto union_op = std::dynamic_pointer_cast<UnionPositions>(op);
+  ASSERT_TRUE(union_op);
+
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_EQ(get_included_chunk_ids(index_scan_op), std::vector<ChunkID>{ChunkID{1}});
+
+  /**
+   * Check result
+   */
+  const auto tasks = OperatorTask::make_tasks_from_operator(op, CleanupTemporaries::No);
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+
+  auto expected_result = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_result->append({123, 456.7f});
+  expected_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(op->get_output(), expected_result);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   /**
    * Build LQP and translate to PQP
@@ -506,6 +617,52 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *between_(b, 42, 1337));
 }
 
+TEST_F(LQPTranslatorTest, ProjectionNodeIndexOnlyScan) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto b = stored_table_node->get_column("b");
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  std::vector<ColumnID> index_column_ids = {ColumnID{1}};
+  table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(index_column_ids);
+  table->get_chunk(ChunkID{2})->create_index<GroupKeyIndex>(index_column_ids);
+
+  auto predicate_node = PredicateNode::make(greater_than_(b, 42));
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto projection_node = ProjectionNode::make(expression_vector(b), predicate_node);
+
+  // Not all chunks are indexed, so the positions of the matches are needed
+  const auto mixed_op = LQPTranslator{}.translate_node(projection_node);
+  ASSERT_EQ(mixed_op->type(), OperatorType::Projection);
+  EXPECT_EQ(mixed_op->input_left()->type(), OperatorType::UnionPositions);
+
+  table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>(index_column_ids);
+  const auto op = LQPTranslator{}.translate_node(projection_node);
+
+  /**
+   * Check PQP: The values of b are taken from the indexes
+   */
+  const auto projection_op = std::dynamic_pointer_cast<Projection>(op);
+  ASSERT_TRUE(projection_op);
+  ASSERT_EQ(projection_op->expressions.size(), 1u);
+  EXPECT_EQ(projection_op->expressions.front()->as_column_name(), "b");
+
+  const auto index_scan_op = std::dynamic_pointer_cast<const IndexScan>(op->input_left());
+  ASSERT_TRUE(index_scan_op);
+  EXPECT_TRUE(index_scan_op->index_only());
+  EXPECT_TRUE(get_included_chunk_ids(index_scan_op).empty());
+  EXPECT_EQ(index_scan_op->input_left()->type(), OperatorType::GetTable);
+
+  // Projections of other columns still need the positions
+  const auto other_projection_node =
+      ProjectionNode::make(expression_vector(stored_table_node->get_column("a")), predicate_node);
+  const auto other_op = LQPTranslator{}.translate_node(other_projection_node);
+  EXPECT_EQ(other_op->input_left()->type(), OperatorType::UnionPositions);
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -556,7 +713,7 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   /**
    * Check PQP
    */
-  const auto join_op = std::dynamic_pointer_cast<JoinSortMerge>(op);
+  const auto join_op = std::dynamic_pointer_cast<JoinAdaptive>(op);
   ASSERT_TRUE(join_op);
   EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{1}, ColumnID{0}));
   EXPECT_EQ(join_op->predicate_condition(), PredicateCondition::Equals);
@@ -619,6 +776,45 @@ TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   EXPECT_EQ(aggregate_definition.function, AggregateFunction::Sum);
 }
 
+TEST_F(LQPTranslatorTest, AggregateNodeSortedInput) {
+  const auto sort_modes = std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::Ascending};
+
+  // The input is sorted by the group-by columns, in a different order
+  // clang-format off
+  const auto sorted_lqp =
+  AggregateNode::make(expression_vector(int_float_a, int_float_b), expression_vector(count_star_()),
+    ValidateNode::make(
+      SortNode::make(expression_vector(int_float_b, int_float_a), sort_modes,
+        int_float_node)));
+  // clang-format on
+  const auto sorted_aggregate = std::dynamic_pointer_cast<Aggregate>(LQPTranslator{}.translate_node(sorted_lqp));
+  ASSERT_TRUE(sorted_aggregate);
+  EXPECT_TRUE(sorted_aggregate->input_is_sorted());
+
+  // The input is sorted by a column that is not a group-by column first
+  // clang-format off
+  const auto unsorted_lqp =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(count_star_()),
+    SortNode::make(expression_vector(int_float_b, int_float_a), sort_modes,
+      int_float_node));
+  // clang-format on
+  const auto unsorted_aggregate = std::dynamic_pointer_cast<Aggregate>(LQPTranslator{}.translate_node(unsorted_lqp));
+  ASSERT_TRUE(unsorted_aggregate);
+  EXPECT_FALSE(unsorted_aggregate->input_is_sorted());
+}
+
+TEST_F(LQPTranslatorTest, AggregateNodeWithoutAggregates) {
+  // Groups without aggregates only need to be deduplicated
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(int_float_b, int_float_a), expression_vector(),
+    int_float_node);
+  // clang-format on
+  const auto distinct = std::dynamic_pointer_cast<Distinct>(LQPTranslator{}.translate_node(lqp));
+  ASSERT_TRUE(distinct);
+  EXPECT_EQ(distinct->column_ids(), std::vector<ColumnID>({ColumnID{1}, ColumnID{0}}));
+}
+
 TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   /**
    * Build LQP and translate to PQP
@@ -638,7 +834,7 @@ TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   const auto a = PQPColumnExpression::from_table(*table_int_float, "a");
   const auto b = PQPColumnExpression::from_table(*table_int_float2, "b");
 
-  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op);
+  const auto join_op = std::dynamic_pointer_cast<const JoinAdaptive>(op);
   ASSERT_TRUE(join_op);
 
   const auto predicate_op_left = std::dynamic_pointer_cast<const TableScan>(join_op->input_left());
@@ -658,6 +854,101 @@ TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   EXPECT_EQ(get_table_op_right->table_name(), "table_int_float2");
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeCompositeKey) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(equals_(int_float2_b, int_float_b),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->additional_column_ids(), std::vector<ColumnIDPair>{ColumnIDPair(ColumnID{1}, ColumnID{1})});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_left()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_right()));
+
+  // Predicates on a single input remain scans
+  // clang-format off
+  const auto lqp_with_scan =
+  PredicateNode::make(equals_(int_float_b, int_float_a),
+    JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto scan_op = std::dynamic_pointer_cast<const TableScan>(LQPTranslator{}.translate_node(lqp_with_scan));
+  ASSERT_TRUE(scan_op);
+  // Joins on a single column pair choose their algorithm at runtime
+  const auto scanned_join_op = std::dynamic_pointer_cast<const JoinAdaptive>(scan_op->input_left());
+  ASSERT_TRUE(scanned_join_op);
+  EXPECT_EQ(scanned_join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeBandPredicates) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  // clang-format off
+  const auto lqp =
+  PredicateNode::make(greater_than_equals_(int_float2_b, int_float_b),
+    JoinNode::make(JoinMode::Inner, greater_than_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto join_op = std::dynamic_pointer_cast<const JoinIEJoin>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->mode(), JoinMode::Inner);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->predicate_condition(), PredicateCondition::GreaterThan);
+  ASSERT_TRUE(join_op->secondary_predicate());
+  EXPECT_EQ(join_op->secondary_predicate()->column_ids, ColumnIDPair(ColumnID{1}, ColumnID{1}));
+  EXPECT_EQ(join_op->secondary_predicate()->predicate_condition, PredicateCondition::LessThanEquals);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_left()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(join_op->input_right()));
+
+  // A BETWEEN of columns of both inputs above a cross join
+  // clang-format off
+  const auto between_lqp =
+  PredicateNode::make(between_(int_float_a, int_float2_a, int_float2_a),
+    JoinNode::make(JoinMode::Cross,
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto between_join_op = std::dynamic_pointer_cast<const JoinIEJoin>(LQPTranslator{}.translate_node(between_lqp));
+  ASSERT_TRUE(between_join_op);
+  EXPECT_EQ(between_join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(between_join_op->predicate_condition(), PredicateCondition::GreaterThanEquals);
+  ASSERT_TRUE(between_join_op->secondary_predicate());
+  EXPECT_EQ(between_join_op->secondary_predicate()->column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(between_join_op->secondary_predicate()->predicate_condition, PredicateCondition::LessThanEquals);
+
+  // Predicates on columns of different data types remain scans
+  // clang-format off
+  const auto lqp_with_scan =
+  PredicateNode::make(greater_than_equals_(int_float2_b, int_float_a),
+    JoinNode::make(JoinMode::Inner, greater_than_(int_float_a, int_float2_a),
+      int_float_node,
+      int_float2_node));
+  // clang-format on
+  const auto scan_op = std::dynamic_pointer_cast<const TableScan>(LQPTranslator{}.translate_node(lqp_with_scan));
+  ASSERT_TRUE(scan_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const JoinAdaptive>(scan_op->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, LimitNode) {
   /**
    * Build LQP and translate to PQP
@@ -676,6 +967,53 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(*limit_op->row_count_expression(), *value_(2));
 }
 
+TEST_F(LQPTranslatorTest, LimitNodePushesRowBudgetIntoProjectionAndTableScan) {
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(static_cast<int64_t>(10)),
+    ProjectionNode::make(expression_vector(int_float_a),
+      PredicateNode::make(greater_than_(int_float_a, 5),
+        int_float_node)));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto projection = std::dynamic_pointer_cast<const Projection>(pqp->input_left());
+  ASSERT_TRUE(projection);
+  EXPECT_EQ(projection->row_budget(), std::optional<size_t>{10});
+
+  const auto table_scan = std::dynamic_pointer_cast<const TableScan>(projection->input_left());
+  ASSERT_TRUE(table_scan);
+  EXPECT_EQ(table_scan->row_budget(), std::optional<size_t>{10});
+
+  // The scan needs all rows of its input
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(table_scan->input_left());
+  ASSERT_TRUE(get_table);
+  EXPECT_EQ(get_table->row_budget(), std::nullopt);
+
+  // The budget is kept when the PQP is copied, e.g., by the PQP cache
+  const auto copied_projection = std::dynamic_pointer_cast<const Projection>(pqp->deep_copy()->input_left());
+  ASSERT_TRUE(copied_projection);
+  EXPECT_EQ(copied_projection->row_budget(), std::optional<size_t>{10});
+}
+
+TEST_F(LQPTranslatorTest, LimitNodeOverSortNode) {
+  // ORDER BY ... LIMIT with a constant limit is translated into a single Sort that only outputs the first rows
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(static_cast<int64_t>(100)),
+    SortNode::make(expression_vector(int_float_b), std::vector<OrderByMode>{OrderByMode::Descending},
+      int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp);
+  ASSERT_TRUE(sort);
+  EXPECT_EQ(sort->row_limit(), std::optional<size_t>{100});
+  EXPECT_EQ(sort->column_id(), ColumnID{1});
+  EXPECT_EQ(sort->order_by_mode(), OrderByMode::Descending);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(sort->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
@@ -724,6 +1062,35 @@ TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   EXPECT_EQ(pqp->input_left()->input_left()->input_left(), pqp->input_right()->input_left()->input_left());
 }
 
+TEST_F(LQPTranslatorTest, StructurallyEqualSubplansShareOperators) {
+  // Two separately built, but equal subplans (e.g., from using a view twice) are translated into one operator
+  const auto subplan = PredicateNode::make(greater_than_(int_float_a, 5), int_float_node);
+  const auto equal_subplan = subplan->deep_copy();
+
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Cross,
+    subplan,
+    equal_subplan);
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  ASSERT_NE(pqp->input_left(), nullptr);
+  EXPECT_EQ(pqp->input_left(), pqp->input_right());
+
+  // Different subplans are not shared
+  // clang-format off
+  const auto other_lqp =
+  JoinNode::make(JoinMode::Cross,
+    subplan,
+    PredicateNode::make(greater_than_(int_float_a, 6), int_float_node));
+  // clang-format on
+
+  const auto other_pqp = LQPTranslator{}.translate_node(other_lqp);
+  EXPECT_NE(other_pqp->input_left(), other_pqp->input_right());
+}
+
 TEST_F(LQPTranslatorTest, ReuseInputExpressions) {
   // If the result of a (sub)expression is available in an input column, the expression should not be redundantly
   // evaluated
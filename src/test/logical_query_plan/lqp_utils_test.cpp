@@ -13,7 +13,10 @@
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/projection_node.hpp"
 #include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "logical_query_plan/union_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -179,4 +182,30 @@ TEST_F(LQPUtilsTest, LQPFindModifiedTables) {
   EXPECT_NE(delete_tables.find("delete_table_name"), delete_tables.end());
 }
 
+TEST_F(LQPUtilsTest, LQPExpressionsAreUnique) {
+  const auto table = load_table("resources/test_data/tbl/int_int2.tbl");
+  table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  StorageManager::get().add_table("keyed_table", table);
+
+  const auto stored_table_node = StoredTableNode::make("keyed_table");
+  const auto column_a = lqp_column_(stored_table_node->get_column("a"));
+  const auto column_b = lqp_column_(stored_table_node->get_column("b"));
+
+  EXPECT_TRUE(lqp_expressions_are_unique(stored_table_node, {column_a}));
+  EXPECT_TRUE(lqp_expressions_are_unique(stored_table_node, {column_a, column_b}));
+  EXPECT_FALSE(lqp_expressions_are_unique(stored_table_node, {column_b}));
+  EXPECT_TRUE(lqp_expressions_are_unique(PredicateNode::make(greater_than_(column_b, 5), stored_table_node),
+                                         {column_a}));
+
+  // The groups of an aggregate are unique
+  const auto aggregate_node = AggregateNode::make(expression_vector(a_b), expression_vector(sum_(a_a)), node_a);
+  EXPECT_TRUE(lqp_expressions_are_unique(aggregate_node, {lqp_column_(a_b)}));
+  EXPECT_FALSE(lqp_expressions_are_unique(aggregate_node, {lqp_column_(a_a)}));
+
+  // Each row of node_a matches at most one row of the stored table, so the groups of the aggregate stay unique
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(a_b, column_a), aggregate_node, stored_table_node);
+  EXPECT_TRUE(lqp_expressions_are_unique(join_node, {lqp_column_(a_b)}));
+  EXPECT_FALSE(lqp_expressions_are_unique(join_node, {column_b}));
+}
+
 }  // namespace opossum
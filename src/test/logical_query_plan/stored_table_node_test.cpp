@@ -7,6 +7,8 @@
 
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -51,4 +53,45 @@ TEST_F(StoredTableNodeTest, Copy) { EXPECT_EQ(*_stored_table_node->deep_copy(),
 
 TEST_F(StoredTableNodeTest, NodeExpressions) { ASSERT_EQ(_stored_table_node->node_expressions.size(), 0u); }
 
+TEST_F(StoredTableNodeTest, RegeneratesStaleStatistics) {
+  const auto table = StorageManager::get().get_table("t_a");
+  const auto table_statistics = table->table_statistics();
+  EXPECT_EQ(_stored_table_node->derive_statistics_from(nullptr, nullptr), table_statistics);
+
+  table->append({5, 1.5f});
+  table_statistics->increase_row_count(1);
+
+  const auto regenerated_table_statistics = _stored_table_node->derive_statistics_from(nullptr, nullptr);
+  EXPECT_NE(regenerated_table_statistics, table_statistics);
+  EXPECT_EQ(table->table_statistics(), regenerated_table_statistics);
+  EXPECT_EQ(regenerated_table_statistics->row_count(), 4.0f);
+
+  const auto& column_statistics =
+      static_cast<const ColumnStatistics<int32_t>&>(*regenerated_table_statistics->column_statistics()[0]);
+  EXPECT_EQ(column_statistics.min(), 5);
+  EXPECT_EQ(column_statistics.distinct_count(), 4.0f);
+}
+
+TEST_F(StoredTableNodeTest, TableSample) {
+  const auto sampled_node = StoredTableNode::make("t_a");
+  sampled_node->set_excluded_chunk_ids({ChunkID{2}});
+  sampled_node->set_table_sample(TableSample{TableSampleMethod::Bernoulli, 0.5, 42});
+
+  EXPECT_EQ(sampled_node->description(), "[StoredTable] Name: 't_a' SAMPLE BERNOULLI (50%) REPEATABLE (42)");
+  EXPECT_NE(*sampled_node, *_stored_table_node);
+  EXPECT_EQ(*sampled_node->deep_copy(), *sampled_node);
+
+  const auto different_sample_node = StoredTableNode::make("t_a");
+  different_sample_node->set_excluded_chunk_ids({ChunkID{2}});
+  different_sample_node->set_table_sample(TableSample{TableSampleMethod::System, 0.5, 42});
+  EXPECT_NE(*sampled_node, *different_sample_node);
+
+  // The statistics of a sample only hold a fraction of the rows
+  const auto table_statistics = StorageManager::get().get_table("t_a")->table_statistics();
+  EXPECT_EQ(sampled_node->derive_statistics_from(nullptr, nullptr)->row_count(), table_statistics->row_count() / 2);
+
+  EXPECT_THROW(TableSample(TableSampleMethod::System, 0.0), std::logic_error);
+  EXPECT_THROW(TableSample(TableSampleMethod::System, 1.5), std::logic_error);
+}
+
 }  // namespace opossum
@@ -0,0 +1,134 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/window_function_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/window_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class WindowNodeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _mock_node = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::Float, "c"}}, "t_a");
+
+    _a = lqp_column_({_mock_node, ColumnID{0}});
+    _b = lqp_column_({_mock_node, ColumnID{1}});
+    _c = lqp_column_({_mock_node, ColumnID{2}});
+
+    _rank = std::make_shared<WindowFunctionExpression>(WindowFunction::Rank, nullptr, expression_vector(_a),
+                                                       expression_vector(_b),
+                                                       std::vector<OrderByMode>{OrderByMode::Descending});
+    _window_node = WindowNode::make(_rank, _mock_node);
+  }
+
+  std::shared_ptr<MockNode> _mock_node;
+  std::shared_ptr<AbstractExpression> _a, _b, _c;
+  std::shared_ptr<WindowFunctionExpression> _rank;
+  std::shared_ptr<WindowNode> _window_node;
+};
+
+TEST_F(WindowNodeTest, Description) {
+  EXPECT_EQ(_window_node->description(), "[Window] RANK() OVER (PARTITION BY a ORDER BY b (Descending))");
+
+  const auto sum = std::make_shared<WindowFunctionExpression>(WindowFunction::Sum, _c, expression_vector(),
+                                                              expression_vector(_a),
+                                                              std::vector<OrderByMode>{OrderByMode::Ascending});
+  EXPECT_EQ(WindowNode::make(sum, _mock_node)->description(), "[Window] SUM(c) OVER (ORDER BY a (Ascending))");
+
+  const auto lag = std::make_shared<WindowFunctionExpression>(WindowFunction::Lag, _c, expression_vector(_b),
+                                                              expression_vector(), std::vector<OrderByMode>{}, 2);
+  EXPECT_EQ(WindowNode::make(lag, _mock_node)->description(), "[Window] LAG(c, 2) OVER (PARTITION BY b)");
+}
+
+TEST_F(WindowNodeTest, ColumnExpressions) {
+  const auto& column_expressions = _window_node->column_expressions();
+  ASSERT_EQ(column_expressions.size(), 4u);
+  EXPECT_EQ(*column_expressions.at(0), *_a);
+  EXPECT_EQ(*column_expressions.at(2), *_c);
+  EXPECT_EQ(*column_expressions.at(3), *_rank);
+}
+
+TEST_F(WindowNodeTest, DataTypes) {
+  EXPECT_EQ(_rank->data_type(), DataType::Long);
+  EXPECT_FALSE(_rank->is_nullable());
+
+  const auto avg = std::make_shared<WindowFunctionExpression>(WindowFunction::Avg, _a, expression_vector(),
+                                                              expression_vector(), std::vector<OrderByMode>{});
+  EXPECT_EQ(avg->data_type(), DataType::Double);
+
+  const auto lead = std::make_shared<WindowFunctionExpression>(WindowFunction::Lead, _c, expression_vector(),
+                                                               expression_vector(_a),
+                                                               std::vector<OrderByMode>{OrderByMode::Ascending});
+  EXPECT_EQ(lead->data_type(), DataType::Float);
+  EXPECT_TRUE(lead->is_nullable());
+}
+
+TEST_F(WindowNodeTest, Equals) {
+  EXPECT_EQ(*_window_node, *_window_node);
+
+  const auto same_rank = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::Rank, nullptr, expression_vector(_a), expression_vector(_b),
+      std::vector<OrderByMode>{OrderByMode::Descending});
+  EXPECT_EQ(*_window_node, *WindowNode::make(same_rank, _mock_node));
+
+  const auto ascending_rank = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::Rank, nullptr, expression_vector(_a), expression_vector(_b),
+      std::vector<OrderByMode>{OrderByMode::Ascending});
+  EXPECT_NE(*_window_node, *WindowNode::make(ascending_rank, _mock_node));
+
+  const auto dense_rank = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::DenseRank, nullptr, expression_vector(_a), expression_vector(_b),
+      std::vector<OrderByMode>{OrderByMode::Descending});
+  EXPECT_NE(*_window_node, *WindowNode::make(dense_rank, _mock_node));
+
+  // Same expressions, but split differently into PARTITION BY and ORDER BY
+  const auto row_number_a = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::RowNumber, nullptr, expression_vector(_a), expression_vector(_b),
+      std::vector<OrderByMode>{OrderByMode::Ascending});
+  const auto row_number_b = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::RowNumber, nullptr, expression_vector(), expression_vector(_a, _b),
+      std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::Ascending});
+  EXPECT_NE(*row_number_a, *row_number_b);
+}
+
+TEST_F(WindowNodeTest, Statistics) {
+  const auto c_statistics = std::make_shared<ColumnStatistics<float>>(0.0f, 50.0f, 1.0f, 10.0f);
+  _mock_node->set_statistics(std::make_shared<TableStatistics>(
+      TableType::Data, 100.0f,
+      std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+          std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 10),
+          std::make_shared<ColumnStatistics<int32_t>>(0.0f, 100.0f, 1, 100), c_statistics}));
+
+  // All input rows and columns are kept
+  const auto rank_statistics = _window_node->get_statistics();
+  EXPECT_FLOAT_EQ(rank_statistics->row_count(), 100.0f);
+  ASSERT_EQ(rank_statistics->column_statistics().size(), 4u);
+  EXPECT_EQ(rank_statistics->column_statistics().at(2), c_statistics);
+  EXPECT_EQ(rank_statistics->column_statistics().at(3)->data_type(), DataType::Long);
+
+  // MAX returns values of its argument
+  const auto max = std::make_shared<WindowFunctionExpression>(WindowFunction::Max, _c, expression_vector(_a),
+                                                              expression_vector(), std::vector<OrderByMode>{});
+  const auto max_statistics = WindowNode::make(max, _mock_node)->get_statistics();
+  EXPECT_FLOAT_EQ(max_statistics->row_count(), 100.0f);
+  ASSERT_EQ(max_statistics->column_statistics().size(), 4u);
+  EXPECT_EQ(max_statistics->column_statistics().at(3), c_statistics);
+}
+
+TEST_F(WindowNodeTest, Copy) { EXPECT_EQ(*_window_node->deep_copy(), *_window_node); }
+
+TEST_F(WindowNodeTest, NodeExpressions) {
+  ASSERT_EQ(_window_node->node_expressions.size(), 1u);
+  EXPECT_EQ(*_window_node->node_expressions.at(0), *_rank);
+}
+
+}  // namespace opossum
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -12,9 +14,11 @@
 
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate.hpp"
+#include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/print.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -189,6 +193,54 @@ TEST_F(OperatorsAggregateTest, SingleAggregateCountDistinct) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl", 1);
 }
 
+TEST_F(OperatorsAggregateTest, ApproxCountDistinct) {
+  // Group a = 0 has 10,000 distinct values of b, group a = 1 has 10, and group a = 2 has only NULLs
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::String, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 5'000);
+  for (auto row_idx = 0; row_idx < 20'000; ++row_idx) {
+    table->append({0, std::to_string(row_idx % 10'000)});
+    table->append({1, std::to_string(row_idx % 10)});
+  }
+  table->append({2, NULL_VALUE});
+
+  const auto check_estimates = [&](const std::shared_ptr<const Table>& input) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(input);
+    table_wrapper->execute();
+    const auto aggregate = std::make_shared<Aggregate>(
+        table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::ApproxCountDistinct}},
+        std::vector<ColumnID>{ColumnID{0}});
+    aggregate->execute();
+    const auto output = aggregate->get_output();
+
+    EXPECT_EQ(output->column_name(ColumnID{1}), "APPROX_COUNT_DISTINCT(b)");
+    EXPECT_EQ(output->column_data_type(ColumnID{1}), DataType::Long);
+    EXPECT_FALSE(output->column_is_nullable(ColumnID{1}));
+
+    ASSERT_EQ(output->row_count(), 3u);
+    for (auto row_idx = size_t{0}; row_idx < 3; ++row_idx) {
+      const auto estimate = static_cast<double>(output->get_value<int64_t>(ColumnID{1}, row_idx));
+      switch (output->get_value<int32_t>(ColumnID{0}, row_idx)) {
+        case 0:
+          EXPECT_NEAR(estimate, 10'000.0, 1'000.0);
+          break;
+        case 1:
+          EXPECT_EQ(estimate, 10.0);
+          break;
+        default:
+          EXPECT_EQ(estimate, 0.0);
+      }
+    }
+  };
+
+  check_estimates(table);
+
+  // On dictionary segments, the sketches are built from the value ids
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+  check_estimates(table);
+}
+
 TEST_F(OperatorsAggregateTest, StringSingleAggregateMax) {
   this->test_output(_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
                     "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/max.tbl", 1);
@@ -592,4 +644,241 @@ TEST_F(OperatorsAggregateTest, OuterJoinThenAggregate) {
                     "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/outer_join.tbl", 1, false);
 }
 
+TEST_F(OperatorsAggregateTest, ManyGroupsInSeveralPartitions) {
+  // More groups than fit into a single radix partition, each of which appears in several chunks
+  const auto group_count = size_t{50'000};
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+
+  auto expected_groups = std::map<int32_t, std::vector<int32_t>>{};
+  for (auto row_id = size_t{0}; row_id < group_count * 3; ++row_id) {
+    const auto a = static_cast<int32_t>((row_id * 7'919) % group_count);
+    const auto b = static_cast<int32_t>(row_id % 5);
+    table->append({a, b});
+    expected_groups[a].emplace_back(b);
+  }
+
+  TableColumnDefinitions expected_column_definitions;
+  expected_column_definitions.emplace_back("a", DataType::Int);
+  expected_column_definitions.emplace_back("SUM(b)", DataType::Long, true);
+  expected_column_definitions.emplace_back("MIN(b)", DataType::Int, true);
+  expected_column_definitions.emplace_back("MAX(b)", DataType::Int, true);
+  expected_column_definitions.emplace_back("COUNT(b)", DataType::Long);
+  expected_column_definitions.emplace_back("COUNT(DISTINCT b)", DataType::Long);
+  const auto expected_result = std::make_shared<Table>(expected_column_definitions, TableType::Data);
+  for (const auto& [a, values] : expected_groups) {
+    auto sum = int64_t{0};
+    for (const auto value : values) sum += value;
+    const auto distinct_values = std::set<int32_t>(values.begin(), values.end());
+    expected_result->append({a, sum, *std::min_element(values.begin(), values.end()),
+                             *std::max_element(values.begin(), values.end()), static_cast<int64_t>(values.size()),
+                             static_cast<int64_t>(distinct_values.size())});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The pre-aggregated groups of a chunk take up several megabytes, so that most of them are spilled
+  for (const auto& spill_options : {std::optional<SpillOptions>{}, std::optional<SpillOptions>{10'000'000}}) {
+    const auto aggregate = std::make_shared<Aggregate>(
+        table_wrapper,
+        std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                               {ColumnID{1}, AggregateFunction::Min},
+                                               {ColumnID{1}, AggregateFunction::Max},
+                                               {ColumnID{1}, AggregateFunction::Count},
+                                               {ColumnID{1}, AggregateFunction::CountDistinct}},
+        std::vector<ColumnID>{ColumnID{0}}, false, spill_options);
+    aggregate->execute();
+
+    EXPECT_EQ(aggregate->get_output()->row_count(), group_count);
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_result);
+  }
+}
+
+TEST_F(OperatorsAggregateTest, SpillGroupsWithStringsToDisk) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String, true);
+  column_definitions.emplace_back("b", DataType::Int);
+  column_definitions.emplace_back("c", DataType::String);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row_id = 0; row_id < 20'000; ++row_id) {
+    const auto a = row_id % 101 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{std::to_string(row_id % 997)};
+    table->append({a, row_id % 3, std::string(row_id % 17, 'x') + std::to_string(row_id)});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregates = std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Min},
+                                                                 {ColumnID{2}, AggregateFunction::Max},
+                                                                 {ColumnID{2}, AggregateFunction::CountDistinct},
+                                                                 {std::nullopt, AggregateFunction::Count}};
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+
+  const auto expected_aggregate = std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids);
+  expected_aggregate->execute();
+
+  const auto aggregate =
+      std::make_shared<Aggregate>(table_wrapper, aggregates, groupby_column_ids, false, SpillOptions{10'000});
+  aggregate->execute();
+
+  EXPECT_EQ(aggregate->get_output()->row_count(), 2'994);
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+}
+
+TEST_F(OperatorsAggregateTest, DictionaryEncodedGroupByWithDifferentDictionaries) {
+  // The chunks have different dictionaries and not all of them contain NULLs
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String, true);
+  column_definitions.emplace_back("b", DataType::Int, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  table->append({"x", 1});
+  table->append({"y", 2});
+  table->append({NullValue{}, 3});
+  table->append({"z", 4});
+  table->append({"x", 5});
+  table->append({"y", NullValue{}});
+  table->append({NullValue{}, 7});
+  table->append({"z", 8});
+  ChunkEncoder::encode_all_chunks(table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  TableColumnDefinitions expected_column_definitions;
+  expected_column_definitions.emplace_back("a", DataType::String, true);
+  expected_column_definitions.emplace_back("COUNT(*)", DataType::Long);
+  expected_column_definitions.emplace_back("SUM(b)", DataType::Long, true);
+  expected_column_definitions.emplace_back("COUNT(DISTINCT b)", DataType::Long);
+  const auto expected_result = std::make_shared<Table>(expected_column_definitions, TableType::Data);
+  expected_result->append({"x", int64_t{2}, int64_t{6}, int64_t{2}});
+  expected_result->append({"y", int64_t{2}, int64_t{2}, int64_t{1}});
+  expected_result->append({"z", int64_t{2}, int64_t{12}, int64_t{2}});
+  expected_result->append({NullValue{}, int64_t{2}, int64_t{10}, int64_t{2}});
+
+  // The groups of a dictionary-encoded column are output in the order of their values, followed by NULL
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper,
+      std::vector<AggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count},
+                                             {ColumnID{1}, AggregateFunction::Sum},
+                                             {ColumnID{1}, AggregateFunction::CountDistinct}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+  EXPECT_TABLE_EQ_ORDERED(aggregate->get_output(), expected_result);
+
+  TableColumnDefinitions expected_distinct_column_definitions;
+  expected_distinct_column_definitions.emplace_back("a", DataType::String, true);
+  const auto expected_distinct_result = std::make_shared<Table>(expected_distinct_column_definitions, TableType::Data);
+  expected_distinct_result->append({"x"});
+  expected_distinct_result->append({"y"});
+  expected_distinct_result->append({"z"});
+  expected_distinct_result->append({NullValue{}});
+
+  const auto distinct = std::make_shared<Aggregate>(table_wrapper, std::vector<AggregateColumnDefinition>{},
+                                                    std::vector<ColumnID>{ColumnID{0}});
+  distinct->execute();
+  EXPECT_TABLE_EQ_ORDERED(distinct->get_output(), expected_distinct_result);
+}
+
+TEST_F(OperatorsAggregateTest, SortedInput) {
+  // Groups span several chunks of the sorted input and NULLs form a group of their own
+  const auto sort = std::make_shared<Sort>(_table_wrapper_1_1_null, ColumnID{0}, OrderByMode::Ascending, 3);
+  sort->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      sort, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum}},
+      std::vector<ColumnID>{ColumnID{0}}, true);
+  aggregate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(),
+                            load_table("resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/sum_null.tbl"));
+}
+
+TEST_F(OperatorsAggregateTest, SortedInputTwoGroupByColumns) {
+  const auto sort_b = std::make_shared<Sort>(_table_wrapper_2_1, ColumnID{1}, OrderByMode::Descending, 2);
+  sort_b->execute();
+  const auto sort_a = std::make_shared<Sort>(sort_b, ColumnID{0}, OrderByMode::Ascending, 2);
+  sort_a->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      sort_a, std::vector<AggregateColumnDefinition>{{ColumnID{2}, AggregateFunction::Max}},
+      std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}, true);
+  aggregate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(),
+                            load_table("resources/test_data/tbl/aggregateoperator/groupby_int_2gb_1agg/max.tbl"));
+}
+
+TEST_F(OperatorsAggregateTest, Approximation) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto sample = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto value : {1, 2, 3, 4}) {
+    sample->append({value});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(sample);
+  table_wrapper->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper,
+      std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum},
+                                             {ColumnID{0}, AggregateFunction::Max},
+                                             {std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{}, false, std::nullopt, AggregateApproximation{0.5});
+  aggregate->execute();
+  const auto output = aggregate->get_output();
+
+  // SUM and COUNT are scaled up, MAX is not. The bounds of each scaled aggregate are appended.
+  ASSERT_EQ(output->column_count(), 7u);
+  EXPECT_EQ(output->column_name(ColumnID{3}), "SUM(a) LOWER BOUND");
+  EXPECT_EQ(output->column_name(ColumnID{6}), "COUNT(*) UPPER BOUND");
+  EXPECT_EQ(output->get_value<int64_t>(ColumnID{0}, 0u), 20);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 0u), 4);
+  EXPECT_EQ(output->get_value<int64_t>(ColumnID{2}, 0u), 8);
+
+  // The standard error of the SUM is sqrt((1 - 0.5) * 30) / 0.5, that of the COUNT sqrt((1 - 0.5) * 4) / 0.5
+  const auto z = 1.959964;
+  EXPECT_NEAR(output->get_value<double>(ColumnID{3}, 0u), 20 - z * std::sqrt(15.0) * 2, 0.001);
+  EXPECT_NEAR(output->get_value<double>(ColumnID{4}, 0u), 20 + z * std::sqrt(15.0) * 2, 0.001);
+  EXPECT_NEAR(output->get_value<double>(ColumnID{5}, 0u), 8 - z * std::sqrt(2.0) * 2, 0.001);
+  EXPECT_NEAR(output->get_value<double>(ColumnID{6}, 0u), 8 + z * std::sqrt(2.0) * 2, 0.001);
+}
+
+TEST_F(OperatorsAggregateTest, ApproximationOfBernoulliSample) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row_idx = int32_t{0}; row_idx < 100'000; ++row_idx) {
+    table->append({row_idx % 4, row_idx % 100});
+  }
+  StorageManager::get().add_table("large_table", table);
+
+  const auto get_table = std::make_shared<GetTable>("large_table");
+  get_table->set_table_sample(TableSample{TableSampleMethod::Bernoulli, 0.05, 42});
+  get_table->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      get_table,
+      std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum},
+                                             {std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}}, false, std::nullopt, AggregateApproximation{0.05, 0.999});
+  aggregate->execute();
+  const auto output = aggregate->get_output();
+
+  // Each of the four groups has 25,000 rows, whose b sums up to 1,200,000 in the first group and 25,000 more in each
+  // following group
+  ASSERT_EQ(output->row_count(), 4u);
+  for (auto row_idx = size_t{0}; row_idx < 4; ++row_idx) {
+    const auto group = output->get_value<int32_t>(ColumnID{0}, row_idx);
+    const auto sum = 1'200'000.0 + group * 25'000.0;
+    EXPECT_LE(output->get_value<double>(ColumnID{3}, row_idx), sum);
+    EXPECT_GE(output->get_value<double>(ColumnID{4}, row_idx), sum);
+    EXPECT_LE(output->get_value<double>(ColumnID{5}, row_idx), 25'000.0);
+    EXPECT_GE(output->get_value<double>(ColumnID{6}, row_idx), 25'000.0);
+    EXPECT_NEAR(static_cast<double>(output->get_value<int64_t>(ColumnID{2}, row_idx)), 25'000.0, 2'500.0);
+  }
+}
+
 }  // namespace opossum
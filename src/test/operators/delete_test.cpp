@@ -1,6 +1,8 @@
+#include <chrono>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -16,6 +18,9 @@
 #include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -123,6 +128,12 @@ TEST_F(OperatorsDeleteTest, DetectDirtyWrite) {
   EXPECT_FALSE(delete_op1->execute_failed());
   EXPECT_TRUE(delete_op2->execute_failed());
 
+  // The second Delete waited for the first transaction, which did not finish before the lock wait timeout
+  const auto statistics = TransactionManager::get().write_conflict_statistics();
+  EXPECT_EQ(statistics.conflicts, 1u);
+  EXPECT_EQ(statistics.waits, 1u);
+  EXPECT_EQ(statistics.resolved_waits, 0u);
+
   // MVCC commit.
   t1_context->commit();
   t2_context->rollback();
@@ -137,6 +148,52 @@ TEST_F(OperatorsDeleteTest, DetectDirtyWrite) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result->get_output());
 }
 
+TEST_F(OperatorsDeleteTest, DetectDirtyWriteAcrossChunks) {
+  // The chunks are locked by parallel jobs. A conflict in one chunk fails the Delete, and its rollback unlocks the rows
+  // that were locked in the other chunks.
+  Topology::use_fake_numa_topology(4, 1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto table_name = std::string{"table_b"};
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 1u);
+  StorageManager::get().add_table(table_name, table);
+  const auto get_table = std::make_shared<GetTable>(table_name);
+  get_table->execute();
+
+  auto t1_context = TransactionManager::get().new_transaction_context();
+  auto t2_context = TransactionManager::get().new_transaction_context();
+
+  // Row 1 is in chunk 1, all rows are deleted by the second transaction
+  const auto table_scan1 = create_table_scan(get_table, ColumnID{0}, PredicateCondition::Equals, "123");
+  const auto table_scan2 = create_table_scan(get_table, ColumnID{0}, PredicateCondition::GreaterThan, "0");
+  table_scan1->execute();
+  table_scan2->execute();
+
+  const auto delete_op1 = std::make_shared<Delete>(table_name, table_scan1);
+  delete_op1->set_transaction_context(t1_context);
+  const auto delete_op2 = std::make_shared<Delete>(table_name, table_scan2);
+  delete_op2->set_transaction_context(t2_context);
+
+  delete_op1->execute();
+  delete_op2->execute();
+
+  EXPECT_FALSE(delete_op1->execute_failed());
+  EXPECT_TRUE(delete_op2->execute_failed());
+
+  t2_context->rollback();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+  Topology::use_default_topology();
+
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->tids.at(0u), 0u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->tids.at(0u), t1_context->transaction_id());
+  EXPECT_EQ(table->get_chunk(ChunkID{2})->get_scoped_mvcc_data_lock()->tids.at(0u), 0u);
+
+  t1_context->commit();
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->end_cids.at(0u), t1_context->commit_id());
+}
+
 TEST_F(OperatorsDeleteTest, EmptyDelete) {
   auto tx_context_modification = TransactionManager::get().new_transaction_context();
 
@@ -194,9 +251,48 @@ TEST_F(OperatorsDeleteTest, UpdateAfterDeleteFails) {
   update_op->execute();
   EXPECT_TRUE(update_op->execute_failed());
 
+  // The deletion was committed already, so there was nothing to wait for
+  EXPECT_EQ(TransactionManager::get().write_conflict_statistics().conflicts, 1u);
+  EXPECT_EQ(TransactionManager::get().write_conflict_statistics().waits, 0u);
+
   t2_context->rollback();
 }
 
+TEST_F(OperatorsDeleteTest, WaitForRolledBackLock) {
+  TransactionManager::get().set_lock_wait_timeout(std::chrono::seconds{10});
+
+  auto t1_context = TransactionManager::get().new_transaction_context();
+  auto t2_context = TransactionManager::get().new_transaction_context();
+
+  auto table_scan1 = create_table_scan(_gt, ColumnID{0}, PredicateCondition::Equals, "123");
+  auto table_scan2 = create_table_scan(_gt, ColumnID{0}, PredicateCondition::LessThan, "1234");
+  table_scan1->execute();
+  table_scan2->execute();
+
+  auto delete_op1 = std::make_shared<Delete>(_table_name, table_scan1);
+  delete_op1->set_transaction_context(t1_context);
+  delete_op1->execute();
+
+  // The second Delete waits for the row locked by the first transaction, which then rolls back
+  auto delete_op2 = std::make_shared<Delete>(_table_name, table_scan2);
+  delete_op2->set_transaction_context(t2_context);
+  auto delete_thread = std::thread([&]() { delete_op2->execute(); });
+
+  while (TransactionManager::get().write_conflict_statistics().waits == 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  t1_context->rollback();
+  delete_thread.join();
+
+  EXPECT_FALSE(delete_op2->execute_failed());
+  const auto statistics = TransactionManager::get().write_conflict_statistics();
+  EXPECT_EQ(statistics.conflicts, 0u);
+  EXPECT_EQ(statistics.resolved_waits, 1u);
+
+  t2_context->commit();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->end_cids.at(1u), t2_context->commit_id());
+}
+
 TEST_F(OperatorsDeleteTest, DeleteOwnInsert) {
   // We are testing a couple of things here:
   //   (1) When a transaction deletes a row that it inserted itself, it should no longer be visible to itself
@@ -60,6 +60,40 @@ TEST_F(OperatorsDifferenceTest, DifferneceOnReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
 }
 
+TEST_F(OperatorsDifferenceTest, DifferenceWithNullsAndStrings) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String, true);
+
+  auto left = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  left->append({1, "a"});
+  left->append({NullValue{}, "b"});
+  left->append({2, NullValue{}});
+  left->append({3, "c"});
+  left->append({3, "c"});
+
+  auto right = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  right->append({NullValue{}, "b"});
+  right->append({3, "d"});
+  right->append({2, NullValue{}});
+
+  auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data, 2);
+  expected_result->append({1, "a"});
+  expected_result->append({3, "c"});
+  expected_result->append({3, "c"});
+
+  auto table_wrapper_left = std::make_shared<TableWrapper>(left);
+  table_wrapper_left->execute();
+  auto table_wrapper_right = std::make_shared<TableWrapper>(right);
+  table_wrapper_right->execute();
+
+  // NULLs are equal to each other, so the rows with a NULL are removed
+  auto difference = std::make_shared<Difference>(table_wrapper_left, table_wrapper_right);
+  difference->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(difference->get_output(), expected_result);
+}
+
 TEST_F(OperatorsDifferenceTest, ThrowWrongColumnNumberException) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   auto table_wrapper_c = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int.tbl", 2));
@@ -0,0 +1,118 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/distinct.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsDistinctTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_null = std::make_shared<TableWrapper>(
+        load_table("resources/test_data/tbl/aggregateoperator/groupby_int_2gb_0agg/input_null.tbl", 2));
+    _table_wrapper_null->execute();
+  }
+
+  std::shared_ptr<Table> _expected_table(const std::vector<std::vector<AllTypeVariant>>& rows,
+                                         const TableColumnDefinitions& column_definitions) const {
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_null;
+};
+
+TEST_F(OperatorsDistinctTest, SingleColumnWithNull) {
+  const auto distinct = std::make_shared<Distinct>(_table_wrapper_null, std::vector<ColumnID>{ColumnID{0}});
+  distinct->execute();
+
+  const auto expected = _expected_table({{12345}, {123}, {12}, {NULL_VALUE}}, {{"a", DataType::Int, true}});
+  EXPECT_TABLE_EQ_UNORDERED(distinct->get_output(), expected);
+}
+
+TEST_F(OperatorsDistinctTest, SingleDictionaryEncodedColumn) {
+  const auto table = load_table("resources/test_data/tbl/aggregateoperator/groupby_int_2gb_0agg/input_null.tbl", 3);
+  ChunkEncoder::encode_all_chunks(table);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto distinct_a = std::make_shared<Distinct>(table_wrapper, std::vector<ColumnID>{ColumnID{0}});
+  distinct_a->execute();
+  EXPECT_TABLE_EQ_UNORDERED(distinct_a->get_output(),
+                            _expected_table({{12345}, {123}, {12}, {NULL_VALUE}}, {{"a", DataType::Int, true}}));
+
+  // The last chunk contains no NULL in column b
+  const auto distinct_b = std::make_shared<Distinct>(table_wrapper, std::vector<ColumnID>{ColumnID{1}});
+  distinct_b->execute();
+  EXPECT_TABLE_EQ_UNORDERED(
+      distinct_b->get_output(),
+      _expected_table({{456.7f}, {457.7f}, {458.7f}, {350.7f}, {NULL_VALUE}}, {{"b", DataType::Float, true}}));
+}
+
+TEST_F(OperatorsDistinctTest, MultipleColumns) {
+  const auto distinct =
+      std::make_shared<Distinct>(_table_wrapper_null, std::vector<ColumnID>{ColumnID{2}, ColumnID{0}});
+  distinct->execute();
+
+  const auto expected = _expected_table({{NULL_VALUE, NULL_VALUE},
+                                         {20, 12345},
+                                         {24, 12345},
+                                         {NULL_VALUE, 12345},
+                                         {30, 12345},
+                                         {33, 12345},
+                                         {20, 123},
+                                         {NULL_VALUE, 123},
+                                         {10, 12},
+                                         {NULL_VALUE, 12}},
+                                        {{"c", DataType::Int, true}, {"a", DataType::Int, true}});
+  EXPECT_TABLE_EQ_UNORDERED(distinct->get_output(), expected);
+}
+
+TEST_F(OperatorsDistinctTest, ReferenceInputInParallel) {
+  Topology::use_fake_numa_topology(4, 1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto column_c = pqp_column_(ColumnID{2}, DataType::Int, true, "c");
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper_null, greater_than_(column_c, 20));
+  table_scan->execute();
+
+  const auto distinct = std::make_shared<Distinct>(table_scan, std::vector<ColumnID>{ColumnID{0}, ColumnID{1}});
+  distinct->execute();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+  Topology::use_default_topology();
+
+  const auto expected = _expected_table({{12345, 456.7f}, {12345, 457.7f}},
+                                        {{"a", DataType::Int, true}, {"b", DataType::Float, true}});
+  EXPECT_TABLE_EQ_UNORDERED(distinct->get_output(), expected);
+}
+
+TEST_F(OperatorsDistinctTest, EmptyInput) {
+  const auto table_scan = create_table_scan(_table_wrapper_null, ColumnID{0}, PredicateCondition::Equals, 0);
+  table_scan->execute();
+
+  const auto distinct = std::make_shared<Distinct>(table_scan, std::vector<ColumnID>{ColumnID{0}});
+  distinct->execute();
+
+  EXPECT_EQ(distinct->get_output()->row_count(), 0u);
+  EXPECT_EQ(distinct->get_output()->column_count(), 1u);
+}
+
+}  // namespace opossum
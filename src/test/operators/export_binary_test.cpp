@@ -1,5 +1,6 @@
 #include <cstdio>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -10,9 +11,13 @@
 
 #include "import_export/binary.hpp"
 #include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/frame_of_reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -371,4 +376,91 @@ TEST_F(OperatorsExportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TRUE(compare_files("resources/test_data/bin/AllTypesDictionaryNullValues.bin", filename));
 }
 
+TEST_F(OperatorsExportBinaryTest, FrameOfReferenceSegmentRoundTrip) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Long);
+  column_definitions.emplace_back("c", DataType::String);
+
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+
+  table->append({1, static_cast<int64_t>(3'000'000'000), "one"});
+  table->append({opossum::NULL_VALUE, static_cast<int64_t>(-5), "two"});
+  table->append({300, static_cast<int64_t>(200), "three"});
+  table->append({-70'000, static_cast<int64_t>(0), "four"});
+
+  ChunkEncoder::encode_all_chunks(table, {SegmentEncodingSpec{EncodingType::FrameOfReference},
+                                          SegmentEncodingSpec{EncodingType::FrameOfReference},
+                                          SegmentEncodingSpec{EncodingType::Dictionary}});
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+  const auto segment = imported_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const FrameOfReferenceSegment<int32_t>>(segment));
+}
+
+TEST_F(OperatorsExportBinaryTest, ParallelRoundTripKeepsChunkOrder) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto table = load_table("resources/test_data/tbl/int_float4.tbl", 2);
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, EncodingType::Dictionary);
+
+  ExportBinary::write_binary(*table, filename);
+  const auto imported_table = ImportBinary::read_binary(filename);
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(imported_table->chunk_count(), table->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+}
+
+TEST_F(OperatorsExportBinaryTest, EncodedSegmentsKeepTheirEncoding) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::String, true);
+
+  const auto chunk_encoding_specs = std::vector<ChunkEncodingSpec>{
+      {EncodingType::RunLength, EncodingType::RunLength},
+      {EncodingType::LZ4, EncodingType::LZ4},
+      {EncodingType::Delta, EncodingType::FixedStringDictionary},
+      {{EncodingType::FrameOfReference, VectorCompressionType::SimdBp128},
+       {EncodingType::Dictionary, VectorCompressionType::SimdBp128}},
+      {{EncodingType::Delta, VectorCompressionType::SimdBp128},
+       {EncodingType::FixedStringDictionary, VectorCompressionType::SimdBp128}}};
+
+  for (const auto& chunk_encoding_spec : chunk_encoding_specs) {
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+    table->append({1, "one"});
+    table->append({1, "one"});
+    table->append({opossum::NULL_VALUE, ""});
+    // The delta from 0 to the minimum does not fit into the compressed deltas of a DeltaSegment
+    table->append({0, "zero"});
+    table->append({std::numeric_limits<int32_t>::min(), "min"});
+    table->append({-70'000, opossum::NULL_VALUE});
+    table->append({300, "three"});
+
+    ChunkEncoder::encode_all_chunks(table, chunk_encoding_spec);
+
+    ExportBinary::write_binary(*table, filename);
+    const auto imported_table = ImportBinary::read_binary(filename);
+
+    EXPECT_TABLE_EQ_ORDERED(imported_table, table);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        const auto segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(
+            table->get_chunk(chunk_id)->get_segment(column_id));
+        const auto imported_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(
+            imported_table->get_chunk(chunk_id)->get_segment(column_id));
+        ASSERT_TRUE(imported_segment);
+        EXPECT_EQ(imported_segment->encoding_type(), segment->encoding_type());
+        EXPECT_EQ(imported_segment->compressed_vector_type(), segment->compressed_vector_type());
+      }
+    }
+  }
+}
+
 }  // namespace opossum
@@ -4,6 +4,8 @@
 #include "gtest/gtest.h"
 
 #include "operators/get_table.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -52,4 +54,110 @@ TEST_F(OperatorsGetTableTest, ExcludedChunks) {
   EXPECT_EQ(table->get_value<int>(ColumnID(0), 1u), original_table->get_value<int>(ColumnID(0), 3u));
 }
 
+TEST_F(OperatorsGetTableTest, RowBudget) {
+  auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
+
+  gt->set_excluded_chunk_ids({ChunkID(0)});
+  gt->set_row_budget(2);
+  gt->execute();
+
+  auto original_table = StorageManager::get().get_table("tableWithValues");
+  auto table = gt->get_output();
+  EXPECT_EQ(table->chunk_count(), ChunkID(2));
+  EXPECT_EQ(table->get_value<int>(ColumnID(0), 0u), original_table->get_value<int>(ColumnID(0), 1u));
+  EXPECT_EQ(table->get_value<int>(ColumnID(0), 1u), original_table->get_value<int>(ColumnID(0), 2u));
+}
+
+TEST_F(OperatorsGetTableTest, JoinKeySource) {
+  // Encoding the chunks creates their statistics, each chunk holds one row
+  ChunkEncoder::encode_all_chunks(StorageManager::get().get_table("tableWithValues"), EncodingType::Dictionary);
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto join_keys = std::make_shared<Table>(column_definitions, TableType::Data);
+  join_keys->append({100});
+  join_keys->append({200});
+  const auto table_wrapper = std::make_shared<TableWrapper>(join_keys);
+  table_wrapper->execute();
+
+  auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
+  gt->set_join_key_source(table_wrapper, ColumnID{0}, ColumnID{0});
+  gt->execute();
+
+  // Only the chunk with the value 123 lies within the range of the join keys
+  auto table = gt->get_output();
+  EXPECT_EQ(table->chunk_count(), ChunkID{1});
+  EXPECT_EQ(table->get_value<int>(ColumnID{0}, 0u), 123);
+}
+
+TEST_F(OperatorsGetTableTest, SystemSample) {
+  // 100 chunks of 100 rows each
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto original_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    original_table->append({value});
+  }
+  StorageManager::get().add_table("large_table", original_table);
+
+  const auto sample = [](const TableSample& table_sample) {
+    const auto get_table = std::make_shared<GetTable>("large_table");
+    get_table->set_table_sample(table_sample);
+    get_table->execute();
+    return get_table->get_output();
+  };
+
+  // Whole chunks are part of the sample
+  const auto sampled_table = sample(TableSample{TableSampleMethod::System, 0.3, 42});
+  EXPECT_EQ(sampled_table->type(), TableType::Data);
+  EXPECT_GT(sampled_table->chunk_count(), 10u);
+  EXPECT_LT(sampled_table->chunk_count(), 50u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < sampled_table->chunk_count(); ++chunk_id) {
+    const auto first_value = sampled_table->get_value<int32_t>(ColumnID{0}, chunk_id * 100);
+    const auto original_chunk_id = ChunkID{static_cast<ChunkID::base_type>(first_value / 100)};
+    EXPECT_EQ(sampled_table->get_chunk(chunk_id), original_table->get_chunk(original_chunk_id));
+  }
+
+  // The same seed draws the same sample
+  EXPECT_TABLE_EQ_ORDERED(sample(TableSample{TableSampleMethod::System, 0.3, 42}), sampled_table);
+
+  // A sample of all rows is the table itself
+  EXPECT_EQ(sample(TableSample{TableSampleMethod::System, 1.0}), original_table);
+}
+
+TEST_F(OperatorsGetTableTest, BernoulliSample) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto original_table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto value = int32_t{0}; value < 10'000; ++value) {
+    original_table->append({value});
+  }
+  StorageManager::get().add_table("large_table", original_table);
+
+  const auto get_table = std::make_shared<GetTable>("large_table");
+  get_table->set_excluded_chunk_ids({ChunkID{0}});
+  get_table->set_table_sample(TableSample{TableSampleMethod::Bernoulli, 0.1, 7});
+  get_table->execute();
+  EXPECT_EQ(get_table->description(DescriptionMode::SingleLine),
+            "GetTable (large_table) (1 Chunks pruned) (SAMPLE BERNOULLI (10%) REPEATABLE (7))");
+
+  // The sampled rows are referenced in their original order, and none of them is from the excluded chunk
+  const auto sampled_table = get_table->get_output();
+  EXPECT_EQ(sampled_table->type(), TableType::References);
+  EXPECT_GT(sampled_table->row_count(), 500u);
+  EXPECT_LT(sampled_table->row_count(), 1'500u);
+
+  auto previous_value = int32_t{99};
+  for (auto row_idx = size_t{0}; row_idx < sampled_table->row_count(); ++row_idx) {
+    const auto value = sampled_table->get_value<int32_t>(ColumnID{0}, row_idx);
+    EXPECT_GT(value, previous_value);
+    previous_value = value;
+  }
+
+  // The same seed draws the same sample
+  const auto copied_get_table = get_table->deep_copy();
+  copied_get_table->execute();
+  EXPECT_TABLE_EQ_ORDERED(copied_get_table->get_output(), sampled_table);
+}
+
 }  // namespace opossum
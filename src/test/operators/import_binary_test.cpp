@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "operators/import_binary.hpp"
+#include "storage/base_encoded_segment.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -273,4 +274,27 @@ TEST_F(OperatorsImportBinaryTest, AllTypesDictionaryNullValues) {
   EXPECT_TABLE_EQ_ORDERED(importer->get_output(), expected_table);
 }
 
+TEST_F(OperatorsImportBinaryTest, EncodesUnencodedChunks) {
+  const auto encoding_spec = ChunkEncodingSpec(5, SegmentEncodingSpec{EncodingType::RunLength});
+
+  auto importer = std::make_shared<opossum::ImportBinary>("resources/test_data/bin/AllTypesNullValues.bin",
+                                                          std::nullopt, encoding_spec);
+  importer->execute();
+  const auto chunk = importer->get_output()->get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk->is_mutable());
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+    ASSERT_TRUE(segment);
+    EXPECT_EQ(segment->encoding_type(), EncodingType::RunLength);
+  }
+
+  // Chunks that were stored with an encoding keep it
+  const auto dictionary_table =
+      ImportBinary::read_binary("resources/test_data/bin/AllTypesDictionaryNullValues.bin", encoding_spec);
+  const auto dictionary_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(
+      dictionary_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_EQ(dictionary_segment->encoding_type(), EncodingType::Dictionary);
+}
+
 }  // namespace opossum
@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 
 #include "operators/import_csv.hpp"
+#include "storage/base_encoded_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -301,4 +302,23 @@ TEST_F(OperatorsImportCsvTest, UnconvertedCharactersThrows) {
   importer = std::make_shared<ImportCsv>("resources/test_data/csv/unconverted_characters_double.csv");
   EXPECT_THROW(importer->execute(), std::logic_error);
 }
+
+TEST_F(OperatorsImportCsvTest, EncodesChunks) {
+  const auto encoding_spec = ChunkEncodingSpec{{EncodingType::Dictionary}, {EncodingType::FrameOfReference}};
+  auto importer = std::make_shared<ImportCsv>("resources/test_data/csv/float_int_large.csv", ChunkOffset{20},
+                                              std::nullopt, std::nullopt, encoding_spec);
+  importer->execute();
+  const auto table = importer->get_output();
+
+  auto unencoded_importer = std::make_shared<ImportCsv>("resources/test_data/csv/float_int_large.csv");
+  unencoded_importer->execute();
+  EXPECT_TABLE_EQ_ORDERED(table, unencoded_importer->get_output());
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_EQ(std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(ColumnID{1}))->encoding_type(),
+              EncodingType::FrameOfReference);
+  }
+}
 }  // namespace opossum
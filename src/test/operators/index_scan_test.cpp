@@ -1,6 +1,7 @@
 #include <map>
 #include <memory>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -14,6 +15,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -214,6 +216,53 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanOnlySomeChunks) {
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanWithTableIndex) {
+  // The chunks have no chunk indexes, so all matches come from a single lookup in the TableIndex
+  const auto table = load_table("resources/test_data/tbl/int_int_shuffled_2.tbl", 5);
+  table->create_table_index(ColumnID{0});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {104, 104};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 112, 100, 102, 106, 108, 110, 112};
+  tests[PredicateCondition::LessThan] = {100, 102, 100, 102};
+  tests[PredicateCondition::LessThanEquals] = {100, 102, 104, 100, 102, 104};
+  tests[PredicateCondition::GreaterThan] = {106, 108, 110, 112, 106, 108, 110, 112};
+  tests[PredicateCondition::GreaterThanEquals] = {104, 106, 108, 110, 112, 104, 106, 108, 110, 112};
+  tests[PredicateCondition::Between] = {104, 106, 108, 104, 106, 108};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids, test.first,
+                                            right_values, right_values2);
+    scan->execute();
+
+    EXPECT_EQ(scan->get_output()->chunk_count(), 1u);
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+  }
+
+  // Matches in chunks that are not included are dropped
+  tests[PredicateCondition::Equals] = {};
+  tests[PredicateCondition::NotEquals] = {100, 102, 106, 108, 110, 112, 106, 110, 112};
+  tests[PredicateCondition::LessThan] = {100, 102};
+  tests[PredicateCondition::LessThanEquals] = {100, 102};
+  tests[PredicateCondition::GreaterThan] = {106, 108, 110, 112, 106, 110, 112};
+  tests[PredicateCondition::GreaterThanEquals] = {106, 108, 110, 112, 106, 110, 112};
+  tests[PredicateCondition::Between] = {106, 106, 108};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids, test.first,
+                                            right_values, right_values2);
+    scan->set_included_chunk_ids({ChunkID{0}, ChunkID{2}});
+    scan->execute();
+
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, test.second);
+  }
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
@@ -231,4 +280,123 @@ TYPED_TEST(OperatorsIndexScanTest, InvalidIndexTypeThrows) {
   EXPECT_THROW(scan->execute(), std::logic_error);
 }
 
+TYPED_TEST(OperatorsIndexScanTest, IndexOnlyScanRequiresKeyAccess) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+
+  auto scan = std::make_shared<IndexScan>(this->_int_int, this->_index_type, this->_column_ids,
+                                          PredicateCondition::Equals, right_values);
+  scan->set_index_only(true);
+  EXPECT_TRUE(scan->index_only());
+
+  if (std::is_same_v<TypeParam, GroupKeyIndex>) {
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->type(), TableType::Data);
+    this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0u}, {4, 4});
+  } else {
+    EXPECT_THROW(scan->execute(), std::logic_error);
+  }
+}
+
+// Index-only scans return the values of the scanned column from the index
+class OperatorsGroupKeyIndexScanTest : public OperatorsIndexScanTest<GroupKeyIndex> {};
+
+TEST_F(OperatorsGroupKeyIndexScanTest, IndexOnlyScan) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+  const auto right_values2 = std::vector<AllTypeVariant>{AllTypeVariant{9}};
+
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {4, 4};
+  tests[PredicateCondition::NotEquals] = {0, 2, 6, 8, 10, 12, 0, 2, 6, 8, 10, 12};
+  tests[PredicateCondition::LessThan] = {0, 2, 0, 2};
+  tests[PredicateCondition::LessThanEquals] = {0, 2, 4, 0, 2, 4};
+  tests[PredicateCondition::GreaterThan] = {6, 8, 10, 12, 6, 8, 10, 12};
+  tests[PredicateCondition::GreaterThanEquals] = {4, 6, 8, 10, 12, 4, 6, 8, 10, 12};
+  tests[PredicateCondition::Between] = {4, 6, 8, 4, 6, 8};
+
+  for (const auto& test : tests) {
+    for (const auto& table_wrapper : {_int_int, _int_int_small_chunk}) {
+      auto scan = std::make_shared<IndexScan>(table_wrapper, _index_type, _column_ids, test.first, right_values,
+                                              right_values2);
+      scan->set_index_only(true);
+      scan->execute();
+
+      const auto output = scan->get_output();
+      EXPECT_EQ(output->type(), TableType::Data);
+      ASSERT_EQ(output->column_count(), 1u);
+      EXPECT_EQ(output->column_name(ColumnID{0}), "a");
+      EXPECT_EQ(output->row_count(), test.second.size());
+      ASSERT_COLUMN_EQ(output, ColumnID{0u}, test.second);
+
+      // The rows of each chunk are returned in value order
+      for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+        const auto& segment = *output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+        for (auto chunk_offset = ChunkOffset{1}; chunk_offset < segment.size(); ++chunk_offset) {
+          EXPECT_LE(segment[chunk_offset - 1], segment[chunk_offset]);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsGroupKeyIndexScanTest, IndexOnlyScanDeepCopy) {
+  auto scan = std::make_shared<IndexScan>(_int_int, _index_type, _column_ids, PredicateCondition::Equals,
+                                          std::vector<AllTypeVariant>{AllTypeVariant{4}});
+  scan->set_index_only(true);
+
+  const auto copy = std::static_pointer_cast<IndexScan>(scan->deep_copy());
+  EXPECT_TRUE(copy->index_only());
+}
+
+// The HashIndex only supports (in)equality lookups and thus cannot be part of the typed tests above
+class OperatorsHashIndexScanTest : public OperatorsIndexScanTest<HashIndex> {};
+
+TEST_F(OperatorsHashIndexScanTest, SingleColumnScanOnDataTable) {
+  std::map<std::pair<PredicateCondition, AllTypeVariant>, std::vector<AllTypeVariant>> tests;
+  tests[{PredicateCondition::Equals, 4}] = {104, 104};
+  tests[{PredicateCondition::NotEquals, 4}] = {100, 102, 106, 108, 110, 112, 100, 102, 106, 108, 110, 112};
+  tests[{PredicateCondition::Equals, 30}] = {};
+  tests[{PredicateCondition::NotEquals, 30}] = {100, 102, 104, 106, 108, 110, 112,
+                                                100, 102, 104, 106, 108, 110, 112};
+
+  for (const auto& [predicate, expected] : tests) {
+    const auto right_values = std::vector<AllTypeVariant>{predicate.second};
+
+    auto scan = std::make_shared<IndexScan>(_int_int, _index_type, _column_ids, predicate.first, right_values);
+    scan->execute();
+
+    auto scan_small_chunk =
+        std::make_shared<IndexScan>(_int_int_small_chunk, _index_type, _column_ids, predicate.first, right_values);
+    scan_small_chunk->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1u}, expected);
+    ASSERT_COLUMN_EQ(scan_small_chunk->get_output(), ColumnID{1u}, expected);
+  }
+}
+
+TEST_F(OperatorsHashIndexScanTest, RangePredicateThrows) {
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+
+  auto scan = std::make_shared<IndexScan>(_int_int, _index_type, _column_ids, PredicateCondition::LessThan,
+                                          right_values);
+  EXPECT_THROW(scan->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsHashIndexScanTest, IndexOnlyScan) {
+  std::map<PredicateCondition, std::vector<AllTypeVariant>> tests;
+  tests[PredicateCondition::Equals] = {4, 4};
+  tests[PredicateCondition::NotEquals] = {0, 2, 6, 8, 10, 12, 0, 2, 6, 8, 10, 12};
+
+  for (const auto& [predicate_condition, expected] : tests) {
+    const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{4}};
+
+    auto scan = std::make_shared<IndexScan>(_int_int_small_chunk, _index_type, _column_ids, predicate_condition,
+                                            right_values);
+    scan->set_index_only(true);
+    scan->execute();
+
+    ASSERT_EQ(scan->get_output()->column_count(), 1u);
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0u}, expected);
+  }
+}
+
 }  // namespace opossum
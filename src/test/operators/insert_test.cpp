@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
@@ -13,6 +14,9 @@
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -283,4 +287,78 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float)
 }
 
+TEST_F(OperatorsInsertTest, ParallelInsertIntoMultipleChunks) {
+  // The target chunks are filled in parallel. Their boundaries do not align with those of the input chunks.
+  Topology::use_fake_numa_topology(4, 1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto target_table = load_table("resources/test_data/tbl/int_float.tbl", 2u);
+  StorageManager::get().add_table("target_table", target_table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 3u));
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+  Topology::use_default_topology();
+
+  auto expected_table = load_table("resources/test_data/tbl/int_float.tbl", 2u);
+  const auto input_table = table_wrapper->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    expected_table->append_columns(input_table->get_chunk(chunk_id)->segments());
+  }
+
+  EXPECT_EQ(target_table->row_count(), expected_table->row_count());
+  EXPECT_TABLE_EQ_ORDERED(target_table, expected_table);
+}
+
+TEST_F(OperatorsInsertTest, ConcurrentInsertsIntoInsertionChunks) {
+  // Three rows per Insert
+  const auto values_to_insert = load_table("resources/test_data/tbl/int_float.tbl");
+
+  const auto target_table =
+      std::make_shared<Table>(values_to_insert->column_definitions(), TableType::Data, 5u, UseMvcc::Yes);
+  target_table->set_insertion_chunk_count(4);
+  StorageManager::get().add_table("target_table", target_table);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 8; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto insert_id = 0; insert_id < 10; ++insert_id) {
+        const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+        table_wrapper->execute();
+
+        const auto insert = std::make_shared<Insert>("target_table", table_wrapper);
+        auto context = TransactionManager::get().new_transaction_context();
+        insert->set_transaction_context(context);
+        insert->execute();
+        context->commit();
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(target_table->row_count(), 240u);
+
+  // Only the chunks that are currently used by one of the insertion chunks are partially filled
+  auto partial_chunk_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < target_table->chunk_count(); ++chunk_id) {
+    if (target_table->get_chunk(chunk_id)->size() < target_table->max_chunk_size()) ++partial_chunk_count;
+  }
+  EXPECT_LE(partial_chunk_count, 4u);
+
+  const auto get_table = std::make_shared<GetTable>("target_table");
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 240u);
+}
+
 }  // namespace opossum
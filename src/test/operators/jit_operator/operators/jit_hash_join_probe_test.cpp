@@ -0,0 +1,100 @@
+#include "base_test.hpp"
+#include "operators/jit_operator/operators/jit_hash_join_probe.hpp"
+
+namespace opossum {
+
+// Mock JitOperator that passes individual tuples into the chain
+class MockProbeSource : public AbstractJittable {
+ public:
+  std::string description() const final { return "MockProbeSource"; }
+
+  void emit(JitRuntimeContext& context) { _emit(context); }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {}
+};
+
+// Mock JitOperator that records the value of a string tuple value for each consumed tuple
+class MockProbeSink : public AbstractJittable {
+ public:
+  explicit MockProbeSink(const JitTupleValue& value) : _value{value} {}
+
+  std::string description() const final { return "MockProbeSink"; }
+
+  void reset() const { _consumed_values.clear(); }
+
+  const std::vector<std::optional<std::string>>& consumed_values() const { return _consumed_values; }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {
+    if (_value.is_null(context)) {
+      _consumed_values.emplace_back(std::nullopt);
+    } else {
+      _consumed_values.emplace_back(_value.get<std::string>(context));
+    }
+  }
+
+  const JitTupleValue _value;
+
+  // Must be static, since _consume is const
+  static std::vector<std::optional<std::string>> _consumed_values;
+};
+
+std::vector<std::optional<std::string>> MockProbeSink::_consumed_values;
+
+class JitHashJoinProbeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _build_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"key", DataType::Int, true}, {"value", DataType::String, true}}, TableType::Data, 2);
+    _build_table->append({1, "one"});
+    _build_table->append({2, "two"});
+    _build_table->append({2, "zwei"});
+    _build_table->append({NullValue{}, "none"});
+    _build_table->append({3, NullValue{}});
+  }
+
+  std::shared_ptr<Table> _build_table;
+};
+
+TEST_F(JitHashJoinProbeTest, EmitsTupleForEachJoinPartner) {
+  JitRuntimeContext context;
+  context.tuple.resize(2);
+
+  const auto probe_value = JitTupleValue{DataType::Int, true, 0};
+  const auto build_value = JitTupleValue{DataType::String, true, 1};
+
+  auto source = std::make_shared<MockProbeSource>();
+  auto probe = std::make_shared<JitHashJoinProbe>();
+  auto sink = std::make_shared<MockProbeSink>(build_value);
+  source->set_next_operator(probe);
+  probe->set_next_operator(sink);
+
+  probe->add_key_column(probe_value, ColumnID{0});
+  EXPECT_EQ(probe->add_build_column(ColumnID{1}, build_value), build_value);
+  // Columns are only added once
+  EXPECT_EQ(probe->add_build_column(ColumnID{1}, JitTupleValue{DataType::String, true, 2}), build_value);
+  EXPECT_EQ(probe->build_columns().size(), 1u);
+  EXPECT_EQ(probe->find_build_column(ColumnID{1}), build_value);
+  EXPECT_EQ(probe->find_build_column(ColumnID{0}), std::nullopt);
+
+  probe->before_query(*_build_table, context);
+
+  const auto probe_with = [&](const std::optional<int32_t> key) {
+    sink->reset();
+    probe_value.set_is_null(!key, context);
+    if (key) probe_value.set<int32_t>(*key, context);
+    source->emit(context);
+    return sink->consumed_values();
+  };
+
+  using Values = std::vector<std::optional<std::string>>;
+  EXPECT_EQ(probe_with(1), Values({"one"}));
+  EXPECT_EQ(probe_with(2), Values({"two", "zwei"}));
+  EXPECT_EQ(probe_with(3), Values({std::nullopt}));
+  EXPECT_EQ(probe_with(4), Values{});
+  // NULL never finds a join partner, not even the build row with a NULL key
+  EXPECT_EQ(probe_with(std::nullopt), Values{});
+}
+
+}  // namespace opossum
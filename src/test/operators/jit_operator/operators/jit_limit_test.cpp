@@ -0,0 +1,87 @@
+#include "base_test.hpp"
+#include "operators/jit_operator/operators/jit_limit.hpp"
+
+namespace opossum {
+
+// Mock JitOperator that passes individual tuples into the chain
+class MockLimitSource : public AbstractJittable {
+ public:
+  std::string description() const final { return "MockLimitSource"; }
+
+  void emit(JitRuntimeContext& context) { _emit(context); }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final {}
+};
+
+// Mock JitOperator that counts the tuples passed to it
+class MockLimitSink : public AbstractJittable {
+ public:
+  std::string description() const final { return "MockLimitSink"; }
+
+  void reset() const { _consume_count = 0; }
+
+  size_t consume_count() const { return _consume_count; }
+
+ private:
+  void _consume(JitRuntimeContext& context) const final { ++_consume_count; }
+
+  // Must be static, since _consume is const
+  static size_t _consume_count;
+};
+
+size_t MockLimitSink::_consume_count = 0;
+
+class JitLimitTest : public BaseTest {};
+
+TEST_F(JitLimitTest, PassesOnTuplesUntilLimitIsReached) {
+  JitRuntimeContext context;
+  context.chunk_size = 10;
+
+  auto source = std::make_shared<MockLimitSource>();
+  auto limit = std::make_shared<JitLimit>(3);
+  auto sink = std::make_shared<MockLimitSink>();
+
+  // Link operators to pipeline
+  source->set_next_operator(limit);
+  limit->set_next_operator(sink);
+
+  limit->before_query(context);
+  ASSERT_EQ(context.limit_row_count, 3u);
+  sink->reset();
+
+  for (context.chunk_offset = 0; context.chunk_offset < 2; ++context.chunk_offset) {
+    source->emit(context);
+  }
+  ASSERT_EQ(sink->consume_count(), 2u);
+  ASSERT_EQ(context.chunk_size, 10u);
+
+  // The third tuple reaches the limit, which ends the current chunk after this tuple
+  source->emit(context);
+  ASSERT_EQ(sink->consume_count(), 3u);
+  ASSERT_EQ(context.limit_row_count, 0u);
+  ASSERT_EQ(context.chunk_size, 3u);
+
+  // Further tuples are discarded
+  source->emit(context);
+  ASSERT_EQ(sink->consume_count(), 3u);
+}
+
+TEST_F(JitLimitTest, LimitOfZeroDiscardsAllTuples) {
+  JitRuntimeContext context;
+  context.chunk_size = 10;
+  context.chunk_offset = 0;
+
+  auto source = std::make_shared<MockLimitSource>();
+  auto limit = std::make_shared<JitLimit>(0);
+  auto sink = std::make_shared<MockLimitSink>();
+  source->set_next_operator(limit);
+  limit->set_next_operator(sink);
+
+  limit->before_query(context);
+  sink->reset();
+  source->emit(context);
+  ASSERT_EQ(sink->consume_count(), 0u);
+}
+
+}  // namespace opossum
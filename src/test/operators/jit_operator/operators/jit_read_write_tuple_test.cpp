@@ -1,6 +1,8 @@
 #include "base_test.hpp"
+#include "operators/jit_operator/operators/jit_read_deferred_columns.hpp"
 #include "operators/jit_operator/operators/jit_read_tuples.hpp"
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
@@ -100,4 +102,40 @@ TEST_F(JitReadWriteTupleTest, CopyTable) {
                                 FloatComparisonMode::AbsoluteDifference));
 }
 
+TEST_F(JitReadWriteTupleTest, CopyTableWithDeferredColumns) {
+  JitRuntimeContext context;
+
+  // The deferred column is not read by JitReadTuples, but by the JitReadDeferredColumns operator
+  auto read_tuples = std::make_shared<JitReadTuples>();
+  auto read_deferred_columns = std::make_shared<JitReadDeferredColumns>();
+  auto write_tuples = std::make_shared<JitWriteTuples>();
+  read_tuples->set_next_operator(read_deferred_columns);
+  read_deferred_columns->set_next_operator(write_tuples);
+
+  auto a_value = read_tuples->add_input_column(DataType::Int, true, ColumnID{0});
+  auto b_value = read_tuples->add_input_column(DataType::Float, true, ColumnID{1});
+  read_tuples->defer_input_column(ColumnID{1});
+  write_tuples->add_output_column("a", a_value);
+  write_tuples->add_output_column("b", b_value);
+
+  // Deferred columns are read from encoded segments at the current chunk offset
+  auto input_table = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
+  ChunkEncoder::encode_all_chunks(input_table);
+  auto output_table = write_tuples->create_output_table(2);
+  read_tuples->before_query(*input_table, context);
+  write_tuples->before_query(*output_table, context);
+
+  for (const auto& chunk : input_table->chunks()) {
+    read_tuples->before_chunk(*input_table, *chunk, context);
+    ASSERT_EQ(context.inputs.size(), 1u);
+    ASSERT_EQ(context.deferred_inputs.size(), 1u);
+    read_tuples->execute(context);
+    write_tuples->after_chunk(*output_table, context);
+  }
+  write_tuples->after_query(*output_table, context);
+
+  ASSERT_TRUE(check_table_equal(input_table, output_table, OrderSensitivity::Yes, TypeCmpMode::Strict,
+                                FloatComparisonMode::AbsoluteDifference));
+}
+
 }  // namespace opossum
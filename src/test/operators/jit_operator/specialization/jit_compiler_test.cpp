@@ -4,7 +4,9 @@
 
 #include "base_test.hpp"
 #include "operators/jit_operator/specialization/jit_compiler.hpp"
+#include "operators/jit_operator/specialization/jit_object_cache.hpp"
 #include "operators/jit_operator/specialization/llvm_utils.hpp"
+#include "utils/filesystem.hpp"
 
 namespace opossum {
 
@@ -60,4 +62,27 @@ TEST_F(JitCompilerTest, AddsAndRemovesModules) {
   ASSERT_THROW(compiler.find_symbol<int32_t(int32_t, int32_t)>(_add_fn_symbol), std::logic_error);
 }
 
+TEST_F(JitCompilerTest, StoresAndReloadsObjectsFromObjectCache) {
+  const auto directory = std::string{"jit_object_cache_test"};
+  JitObjectCache::get().set_directory(directory);
+
+  {
+    auto compiler = JitCompiler{};
+    compiler.add_module(parse_llvm_module(
+        std::string(&jit_compiler_test_module, jit_compiler_test_module_size), *_context));
+  }
+  ASSERT_EQ(std::distance(filesystem::directory_iterator(directory), filesystem::directory_iterator{}), 1);
+  EXPECT_NE(JitObjectCache::get().getObject(_module.get()), nullptr);
+
+  // A second compiler (e.g., in a restarted process) uses the cached object
+  auto compiler = JitCompiler{};
+  compiler.add_module(std::move(_module));
+  auto add_fn = compiler.find_symbol<int32_t(int32_t, int32_t)>(_add_fn_symbol);
+  EXPECT_EQ(add_fn(1, 5), 1 + 5);
+  EXPECT_EQ(std::distance(filesystem::directory_iterator(directory), filesystem::directory_iterator{}), 1);
+
+  JitObjectCache::get().set_directory("");
+  filesystem::remove_all(directory);
+}
+
 }  // namespace opossum
@@ -8,6 +8,8 @@
 #include "operators/jit_operator/operators/jit_write_tuples.hpp"
 #include "operators/jit_operator_wrapper.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 
 namespace opossum {
 
@@ -22,6 +24,42 @@ class JitOperatorWrapperTest : public BaseTest {
     _int_table_wrapper->execute();
   }
 
+  // Adds the operators of "SELECT a+a FROM ..." to @param jit_operator_wrapper, reading with @param read_operator
+  static void add_a_plus_a_operators(JitOperatorWrapper& jit_operator_wrapper,
+                                     const std::shared_ptr<JitReadTuples>& read_operator) {
+    const auto tuple_value = read_operator->add_input_column(DataType::Int, false, ColumnID{0});
+    const auto column_expression = std::make_shared<JitExpression>(tuple_value);
+    const auto expression = std::make_shared<JitExpression>(column_expression, JitExpressionType::Addition,
+                                                            column_expression, read_operator->add_temporary_value());
+    const auto write_operator = std::make_shared<JitWriteTuples>();
+    write_operator->add_output_column("a+a", expression->result());
+
+    jit_operator_wrapper.add_jit_operator(read_operator);
+    jit_operator_wrapper.add_jit_operator(std::make_shared<JitCompute>(expression));
+    jit_operator_wrapper.add_jit_operator(write_operator);
+  }
+
+  static void expect_doubled_values(const std::shared_ptr<const Table>& result, const std::shared_ptr<Table>& input) {
+    ASSERT_EQ(result->row_count(), input->row_count());
+    for (auto row = size_t{0}; row < input->row_count(); ++row) {
+      EXPECT_EQ(result->get_value<int32_t>(ColumnID{0}, row), 2 * input->get_value<int32_t>(ColumnID{0}, row));
+    }
+  }
+
+  using ExecuteFunction = JitOperatorWrapper::ExecuteFunction;
+
+  // The compiled code is shared by the deep copies of a JitOperatorWrapper
+  static std::shared_ptr<JitOperatorWrapper::CompiledPipeline> compiled_pipeline(
+      const JitOperatorWrapper& jit_operator_wrapper) {
+    return jit_operator_wrapper._compiled_pipeline;
+  }
+
+  // Makes @param jit_operator_wrapper use the function of @param promise as if the background task had compiled it
+  static void set_compiled_function(const JitOperatorWrapper& jit_operator_wrapper,
+                                    std::promise<ExecuteFunction>& promise) {
+    jit_operator_wrapper._compiled_pipeline->execute_function = promise.get_future().share();
+  }
+
   std::shared_ptr<Table> _empty_table;
   std::shared_ptr<Table> _int_table;
   std::shared_ptr<TableWrapper> _empty_table_wrapper;
@@ -33,6 +71,10 @@ class MockJitSource : public JitReadTuples {
   MOCK_CONST_METHOD2(before_query, void(const Table&, JitRuntimeContext&));
   MOCK_CONST_METHOD3(before_chunk, void(const Table&, const Chunk&, JitRuntimeContext&));
 
+  void forward_before_query(const Table& in_table, JitRuntimeContext& context) const {
+    JitReadTuples::before_query(in_table, context);
+  }
+
   void forward_before_chunk(const Table& in_table, const Chunk& in_chunk, JitRuntimeContext& context) const {
     JitReadTuples::before_chunk(in_table, in_chunk, context);
   }
@@ -155,4 +197,111 @@ TEST_F(JitOperatorWrapperTest, JitOperatorsSpecializedWithMultipleInliningOfSame
   ASSERT_EQ(result->get_value<int>(ColumnID(0), 1), 48);
 }
 
+TEST_F(JitOperatorWrapperTest, CompilesInBackgroundWhileInterpreting) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // Many small chunks, so that the compiled function is likely to take over in the middle of the table
+  const auto table = load_table("resources/test_data/tbl/int_equal_distribution.tbl", 1);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto jit_operator_wrapper = std::make_shared<JitOperatorWrapper>(table_wrapper, JitExecutionMode::Compile);
+  add_a_plus_a_operators(*jit_operator_wrapper, std::make_shared<JitReadTuples>());
+  jit_operator_wrapper->execute();
+  expect_doubled_values(jit_operator_wrapper->get_output(), table);
+
+  // The compilation finishes even if the query finished first
+  const auto execute_function = compiled_pipeline(*jit_operator_wrapper)->execute_function;
+  ASSERT_TRUE(execute_function.valid());
+  EXPECT_NO_THROW(execute_function.get());
+}
+
+TEST_F(JitOperatorWrapperTest, SwitchesToCompiledFunctionInTheMiddleOfTheTable) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto table = load_table("resources/test_data/tbl/10_ints.tbl", 1);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto source = std::make_shared<testing::NiceMock<MockJitSource>>();
+  const auto jit_operator_wrapper = std::make_shared<JitOperatorWrapper>(table_wrapper, JitExecutionMode::Compile);
+  add_a_plus_a_operators(*jit_operator_wrapper, source);
+
+  // Instead of the background task, the fifth chunk provides the "compiled" function, which counts its calls
+  auto promise = std::promise<ExecuteFunction>{};
+  set_compiled_function(*jit_operator_wrapper, promise);
+  auto compiled_chunk_count = size_t{0};
+
+  ON_CALL(*source, before_query(testing::_, testing::_))
+      .WillByDefault(testing::Invoke(source.get(), &MockJitSource::forward_before_query));
+  ON_CALL(*source, before_chunk(testing::_, testing::_, testing::_))
+      .WillByDefault(testing::Invoke([&](const Table& in_table, const Chunk& in_chunk, JitRuntimeContext& context) {
+        source->forward_before_chunk(in_table, in_chunk, context);
+        if (&in_chunk == table->get_chunk(ChunkID{4}).get()) {
+          promise.set_value([&](const JitReadTuples* read_tuples, JitRuntimeContext& runtime_context) {
+            ++compiled_chunk_count;
+            read_tuples->execute(runtime_context);
+          });
+        }
+      }));
+
+  jit_operator_wrapper->execute();
+
+  // The fifth chunk was still interpreted, the remaining five used the compiled function
+  EXPECT_EQ(compiled_chunk_count, 5u);
+  expect_doubled_values(jit_operator_wrapper->get_output(), table);
+}
+
+TEST_F(JitOperatorWrapperTest, DeepCopiesShareCompiledFunction) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto jit_operator_wrapper =
+      std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Compile);
+  add_a_plus_a_operators(*jit_operator_wrapper, std::make_shared<JitReadTuples>());
+
+  auto promise = std::promise<ExecuteFunction>{};
+  set_compiled_function(*jit_operator_wrapper, promise);
+  auto compiled_chunk_count = size_t{0};
+  promise.set_value([&](const JitReadTuples* read_tuples, JitRuntimeContext& context) {
+    ++compiled_chunk_count;
+    read_tuples->execute(context);
+  });
+
+  jit_operator_wrapper->execute();
+  EXPECT_EQ(compiled_chunk_count, _int_table->chunk_count());
+
+  // The copy uses the function of the original from its first chunk on instead of compiling it again
+  const auto copy = std::static_pointer_cast<JitOperatorWrapper>(jit_operator_wrapper->deep_copy());
+  EXPECT_EQ(compiled_pipeline(*copy), compiled_pipeline(*jit_operator_wrapper));
+  copy->mutable_input_left()->execute();
+  copy->execute();
+
+  EXPECT_EQ(compiled_chunk_count, 2 * _int_table->chunk_count());
+  EXPECT_EQ(compiled_pipeline(*copy), compiled_pipeline(*jit_operator_wrapper));
+  expect_doubled_values(copy->get_output(), _int_table);
+}
+
+TEST_F(JitOperatorWrapperTest, AddingOperatorDiscardsCompiledFunction) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto read_operator = std::make_shared<JitReadTuples>();
+  const auto jit_operator_wrapper =
+      std::make_shared<JitOperatorWrapper>(_int_table_wrapper, JitExecutionMode::Compile);
+  jit_operator_wrapper->add_jit_operator(read_operator);
+
+  auto promise = std::promise<ExecuteFunction>{};
+  set_compiled_function(*jit_operator_wrapper, promise);
+  const auto stale_pipeline = compiled_pipeline(*jit_operator_wrapper);
+  const auto copy = std::static_pointer_cast<JitOperatorWrapper>(jit_operator_wrapper->deep_copy());
+
+  // The function was compiled for a pipeline without the sink
+  jit_operator_wrapper->add_jit_operator(std::make_shared<JitWriteTuples>());
+  EXPECT_NE(compiled_pipeline(*jit_operator_wrapper), stale_pipeline);
+  EXPECT_FALSE(compiled_pipeline(*jit_operator_wrapper)->execute_function.valid());
+
+  // Copies made before keep the function of their own pipeline
+  EXPECT_EQ(compiled_pipeline(*copy), stale_pipeline);
+  EXPECT_TRUE(compiled_pipeline(*copy)->execute_function.valid());
+}
+
 }  // namespace opossum
@@ -0,0 +1,114 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_adaptive.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class JoinAdaptiveTest : public BaseTest {
+ protected:
+  // A table with the columns a and b, where a takes distinct_value_count different values
+  static std::shared_ptr<Table> create_table(const size_t row_count, const size_t distinct_value_count) {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      table->append({static_cast<int32_t>((row_id * 7) % distinct_value_count), static_cast<int32_t>(row_id)});
+    }
+    return table;
+  }
+
+  static std::shared_ptr<AbstractOperator> wrap(const std::shared_ptr<Table>& table) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // Executes a JoinAdaptive, compares its output with that of a JoinNestedLoop and returns the chosen join
+  static OperatorType join(const std::shared_ptr<AbstractOperator>& left,
+                           const std::shared_ptr<AbstractOperator>& right, const JoinMode mode,
+                           const PredicateCondition predicate_condition) {
+    const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+    const auto join_adaptive = std::make_shared<JoinAdaptive>(left, right, mode, column_ids, predicate_condition);
+    join_adaptive->execute();
+
+    const auto join_nested_loop = std::make_shared<JoinNestedLoop>(left, right, mode, column_ids, predicate_condition);
+    join_nested_loop->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_adaptive->get_output(), join_nested_loop->get_output());
+    return *join_adaptive->chosen_join_type();
+  }
+};
+
+TEST_F(JoinAdaptiveTest, ChoosesNestedLoopForSmallInputs) {
+  const auto left = wrap(create_table(50, 10));
+  const auto right = wrap(create_table(100, 10));
+
+  EXPECT_EQ(join(left, right, JoinMode::Inner, PredicateCondition::Equals), OperatorType::JoinNestedLoop);
+  EXPECT_EQ(join(left, right, JoinMode::Outer, PredicateCondition::LessThan), OperatorType::JoinNestedLoop);
+}
+
+TEST_F(JoinAdaptiveTest, ChoosesHashForEquiJoins) {
+  const auto left = wrap(create_table(500, 300));
+  const auto right = wrap(create_table(1'000, 700));
+
+  EXPECT_EQ(join(left, right, JoinMode::Inner, PredicateCondition::Equals), OperatorType::JoinHash);
+  EXPECT_EQ(join(left, right, JoinMode::Left, PredicateCondition::Equals), OperatorType::JoinHash);
+  EXPECT_EQ(join(right, left, JoinMode::Right, PredicateCondition::Equals), OperatorType::JoinHash);
+}
+
+TEST_F(JoinAdaptiveTest, ChoosesHashForSemiAndAntiJoins) {
+  // JoinNestedLoop does not support semi and anti joins, so the output is not compared here
+  const auto left = wrap(create_table(50, 10));
+  const auto right = wrap(create_table(10, 5));
+
+  for (const auto mode : {JoinMode::Semi, JoinMode::Anti}) {
+    const auto join_adaptive = std::make_shared<JoinAdaptive>(left, right, mode, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+                                                              PredicateCondition::Equals);
+    join_adaptive->execute();
+    EXPECT_EQ(join_adaptive->chosen_join_type(), OperatorType::JoinHash);
+    // Half of the left rows have a match
+    EXPECT_EQ(join_adaptive->get_output()->row_count(), 25u);
+  }
+}
+
+TEST_F(JoinAdaptiveTest, ChoosesSortMergeForOrderedInputs) {
+  const auto left = std::make_shared<Sort>(wrap(create_table(500, 300)), ColumnID{0}, OrderByMode::Ascending, 100);
+  left->execute();
+  const auto right = std::make_shared<Sort>(wrap(create_table(1'000, 700)), ColumnID{0}, OrderByMode::Ascending, 100);
+  right->execute();
+
+  EXPECT_EQ(join(left, right, JoinMode::Inner, PredicateCondition::Equals), OperatorType::JoinSortMerge);
+}
+
+TEST_F(JoinAdaptiveTest, ChoosesSortMergeForNonEquiAndFullOuterJoins) {
+  const auto left = wrap(create_table(200, 300));
+  const auto right = wrap(create_table(300, 700));
+
+  EXPECT_EQ(join(left, right, JoinMode::Inner, PredicateCondition::GreaterThan), OperatorType::JoinSortMerge);
+  EXPECT_EQ(join(left, right, JoinMode::Outer, PredicateCondition::Equals), OperatorType::JoinSortMerge);
+}
+
+TEST_F(JoinAdaptiveTest, ChoosesIndexForSmallLeftInputs) {
+  const auto left = wrap(create_table(100, 1'000));
+  const auto right_table = create_table(2'000, 1'500);
+
+  EXPECT_EQ(join(left, wrap(right_table), JoinMode::Inner, PredicateCondition::Equals), OperatorType::JoinHash);
+
+  right_table->create_table_index(ColumnID{0});
+  EXPECT_EQ(join(left, wrap(right_table), JoinMode::Inner, PredicateCondition::Equals), OperatorType::JoinIndex);
+
+  // The left input is not small enough compared to the right input
+  EXPECT_EQ(join(wrap(create_table(1'000, 1'000)), wrap(right_table), JoinMode::Inner, PredicateCondition::Equals),
+            OperatorType::JoinHash);
+}
+
+}  // namespace opossum
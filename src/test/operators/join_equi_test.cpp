@@ -11,11 +11,13 @@
 #include "join_test.hpp"
 
 #include "operators/get_table.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_index.hpp"
 #include "operators/join_mpsm.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/union_all.hpp"
 #include "storage/storage_manager.hpp"
@@ -32,7 +34,7 @@ template <typename T>
 class JoinEquiTest : public JoinTest {};
 
 // here we define all Join types
-using JoinEquiTypes = ::testing::Types<JoinNestedLoop, JoinHash, JoinSortMerge, JoinIndex, JoinMPSM>;
+using JoinEquiTypes = ::testing::Types<JoinNestedLoop, JoinHash, JoinSortMerge, JoinIndex, JoinMPSM, JoinAdaptive>;
 TYPED_TEST_CASE(JoinEquiTest, JoinEquiTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(JoinEquiTest, LeftJoin) {
@@ -237,6 +239,61 @@ TYPED_TEST(JoinEquiTest, InnerJoinBig) {
                                              "resources/test_data/tbl/joinoperators/int_string_inner_join.tbl", 1);
 }
 
+TYPED_TEST(JoinEquiTest, InnerJoinOnSortedInputs) {
+  // Joins inputs whose chunks are ordered by the join columns, which JoinSortMerge and JoinMPSM merge instead of sort
+  auto sort_c = std::make_shared<Sort>(this->_table_wrapper_c, ColumnID{0}, OrderByMode::Ascending, 2);
+  sort_c->execute();
+  auto sort_d = std::make_shared<Sort>(this->_table_wrapper_d, ColumnID{1}, OrderByMode::Descending, 2);
+  sort_d->execute();
+
+  this->template test_join_output<TypeParam>(sort_c, sort_d, ColumnIDPair(ColumnID{0}, ColumnID{1}),
+                                             PredicateCondition::Equals, JoinMode::Inner,
+                                             "resources/test_data/tbl/joinoperators/int_string_inner_join.tbl", 1);
+}
+
+TYPED_TEST(JoinEquiTest, LeftJoinOnSortedInputs) {
+  auto sort_a = std::make_shared<Sort>(this->_table_wrapper_a, ColumnID{0}, OrderByMode::Descending, 1);
+  sort_a->execute();
+  auto sort_b = std::make_shared<Sort>(this->_table_wrapper_b, ColumnID{0}, OrderByMode::Ascending, 1);
+  sort_b->execute();
+
+  this->template test_join_output<TypeParam>(sort_a, sort_b, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                             PredicateCondition::Equals, JoinMode::Left,
+                                             "resources/test_data/tbl/joinoperators/int_left_join.tbl", 1);
+}
+
+TYPED_TEST(JoinEquiTest, JoinOnHeavyHitters) {
+  // Half of the left rows and a quarter of the right rows have the value 1, which JoinSortMerge and JoinMPSM detect as
+  // a heavy hitter and whose matches they emit in several jobs
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+  for (auto row = 0; row < 3'000; ++row) {
+    left_table->append({row % 2 == 0 ? 1 : row});
+  }
+  const auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, 50);
+  for (auto row = 0; row < 100; ++row) {
+    right_table->append({row % 4 == 0 ? 1 : row});
+  }
+
+  const auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  const auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Outer}) {
+    if (std::is_same_v<TypeParam, JoinHash> && mode == JoinMode::Outer) continue;
+
+    const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+    const auto join = std::make_shared<TypeParam>(left, right, mode, column_ids, PredicateCondition::Equals);
+    join->execute();
+    const auto expected_join =
+        std::make_shared<JoinNestedLoop>(left, right, mode, column_ids, PredicateCondition::Equals);
+    expected_join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+  }
+}
+
 TYPED_TEST(JoinEquiTest, InnerRefJoinFilteredBig) {
   auto scan_c = this->create_table_scan(this->_table_wrapper_c, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
   scan_c->execute();
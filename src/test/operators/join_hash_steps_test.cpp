@@ -1,8 +1,13 @@
+#include <algorithm>
+#include <numeric>
+
 #include "../base_test.hpp"
 
 #include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/table_wrapper.hpp"
 #include "resolve_type.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 
 namespace opossum {
 
@@ -38,16 +43,6 @@ class JoinHashStepsTest : public BaseTest {
 
   void SetUp() override {}
 
-  // Accumulates the RowIDs hidden behind the iterator element (hash map stores PosLists, not RowIDs)
-  template <typename Iter>
-  size_t get_row_count(Iter begin, Iter end) {
-    size_t row_count = 0;
-    for (Iter it = begin; it != end; ++it) {
-      row_count += it->second.size();
-    }
-    return row_count;
-  }
-
   inline static size_t _table_size_zero_one = 0;
   inline static std::shared_ptr<Table> _table_zero_one;
   inline static std::shared_ptr<TableWrapper> _table_int_with_nulls, _table_with_nulls_and_zeros;
@@ -118,9 +113,102 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
   table_without_nulls_scanned->execute();
 
   // now that build removed the unneeded init values, map sizes should differ
-  EXPECT_EQ(
-      this->get_row_count(hash_map_without_nulls.at(0).value().begin(), hash_map_without_nulls.at(0).value().end()),
-      table_without_nulls_scanned->get_output()->row_count());
+  EXPECT_EQ(hash_map_without_nulls.at(0).value().row_count(), table_without_nulls_scanned->get_output()->row_count());
+}
+
+TEST_F(JoinHashStepsTest, PosHashTable) {
+  auto hashtable = PosHashTable<int>(8);
+  hashtable.insert(7, RowID{ChunkID{0}, 0});
+  hashtable.insert(3, RowID{ChunkID{0}, 1});
+  hashtable.insert(7, RowID{ChunkID{1}, 0});
+  hashtable.insert(5, RowID{ChunkID{1}, 1});
+  hashtable.insert(7, RowID{ChunkID{2}, 0});
+  hashtable.insert(5, RowID{ChunkID{2}, 1});
+  hashtable.finalize();
+
+  EXPECT_EQ(hashtable.size(), 3u);
+  EXPECT_EQ(hashtable.row_count(), 6u);
+
+  // Duplicates are returned in insertion order
+  const auto to_pos_list = [](const auto& matches) { return PosList(matches.begin(), matches.end()); };
+  EXPECT_EQ(to_pos_list(hashtable.find(3)), PosList({RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(to_pos_list(hashtable.find(5)), PosList({RowID{ChunkID{1}, 1}, RowID{ChunkID{2}, 1}}));
+  EXPECT_EQ(to_pos_list(hashtable.find(7)),
+            PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}, RowID{ChunkID{2}, 0}}));
+
+  EXPECT_TRUE(hashtable.find(4).empty());
+  EXPECT_TRUE(hashtable.contains(5));
+  EXPECT_FALSE(hashtable.contains(0));
+
+  auto row_count = size_t{0};
+  hashtable.for_each([&](const auto& value, const auto& matches) { row_count += matches.size(); });
+  EXPECT_EQ(row_count, 6u);
+}
+
+TEST_F(JoinHashStepsTest, PosHashTableStrings) {
+  // Values of a radix partition share the lower bits of their hash, so the table must not rely on them
+  auto hashtable = PosHashTable<std::string>(1'000);
+  for (auto value_id = ChunkOffset{0}; value_id < 1'000; ++value_id) {
+    hashtable.insert(std::to_string(value_id % 400), RowID{ChunkID{0}, value_id});
+  }
+  hashtable.finalize();
+
+  EXPECT_EQ(hashtable.size(), 400u);
+  EXPECT_EQ(hashtable.find("17").size(), 3u);
+  EXPECT_EQ(hashtable.find("399").size(), 2u);
+  EXPECT_EQ(*hashtable.find("399").begin(), (RowID{ChunkID{0}, 399}));
+  EXPECT_TRUE(hashtable.find("400").empty());
+}
+
+TEST_F(JoinHashStepsTest, PosHashTableSinglePosition) {
+  auto hashtable = PosHashTable<int>(8, PosHashTableMode::SinglePosition);
+  hashtable.insert(7, RowID{ChunkID{0}, 0});
+  hashtable.insert(3, RowID{ChunkID{0}, 1});
+  hashtable.insert(7, RowID{ChunkID{1}, 0});
+  hashtable.insert(7, RowID{ChunkID{2}, 0});
+  hashtable.finalize();
+
+  // Only the first RowID of a value is kept
+  EXPECT_EQ(hashtable.size(), 2u);
+  EXPECT_EQ(hashtable.row_count(), 4u);
+  EXPECT_EQ(PosList(hashtable.find(7).begin(), hashtable.find(7).end()), PosList({RowID{ChunkID{0}, 0}}));
+  EXPECT_TRUE(hashtable.contains(3));
+  EXPECT_FALSE(hashtable.contains(5));
+}
+
+TEST_F(JoinHashStepsTest, DenseValueBitmap) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  for (const auto value : {-5, 12, -5, 40}) {
+    table->append({value});
+  }
+  table->append({NullValue{}});
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized = materialize_input<int, int, false>(table, ColumnID{0}, histograms, 0);
+  const auto bitmap = build_dense_value_bitmap<int, int>(materialized);
+  ASSERT_TRUE(bitmap);
+
+  EXPECT_TRUE(bitmap->contains(-5));
+  EXPECT_TRUE(bitmap->contains(12));
+  EXPECT_TRUE(bitmap->contains(40));
+  EXPECT_FALSE(bitmap->contains(0));
+  EXPECT_FALSE(bitmap->contains(-6));
+  EXPECT_FALSE(bitmap->contains(41));
+  EXPECT_FALSE(bitmap->contains(std::numeric_limits<int>::min()));
+  EXPECT_FALSE(bitmap->contains(std::numeric_limits<int>::max()));
+
+  auto values = std::vector<int>{};
+  bitmap->for_each([&](const auto value) { values.emplace_back(value); });
+  EXPECT_EQ(values, std::vector<int>({-5, 12, 40}));
+
+  // Sparse values are left to the hash tables
+  auto sparse_table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+  sparse_table->append({0});
+  sparse_table->append({1'000'000});
+  const auto sparse_materialized = materialize_input<int, int, false>(sparse_table, ColumnID{0}, histograms, 0);
+  EXPECT_FALSE((build_dense_value_bitmap<int, int>(sparse_materialized)));
 }
 
 TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
@@ -213,4 +301,108 @@ TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
                std::logic_error);
 }
 
+TEST_F(JoinHashStepsTest, DeterminePrunedChunks) {
+  // Two chunks with the even values from 0 to 18 and from 20 to 38
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (auto value = 0; value < 20; ++value) {
+    table->append({value * 2});
+  }
+
+  SegmentStatistics::set_bloom_filter_bits_per_value(10);
+  ChunkEncoder::encode_all_chunks(table);
+  SegmentStatistics::set_bloom_filter_bits_per_value(0);
+
+  EXPECT_EQ(determine_pruned_chunks(table, ColumnID{0}, std::vector<int>{4, 100}), std::vector<bool>({false, true}));
+  EXPECT_EQ(determine_pruned_chunks(table, ColumnID{0}, std::vector<int>{4, 24}), std::vector<bool>({false, false}));
+  EXPECT_EQ(determine_pruned_chunks(table, ColumnID{0}, std::vector<int>{-5, 7, 13}), std::vector<bool>({true, true}));
+
+  // Reference segments use the statistics of the referenced chunk
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 2);
+  scan->execute();
+  EXPECT_EQ(determine_pruned_chunks(scan->get_output(), ColumnID{0}, std::vector<int>{30}),
+            std::vector<bool>({true, false}));
+
+  // Chunks without statistics are not pruned
+  EXPECT_EQ(determine_pruned_chunks(_table_zero_one, ColumnID{0}, std::vector<int>{7}),
+            std::vector<bool>(_table_zero_one->chunk_count(), false));
+}
+
+TEST_F(JoinHashStepsTest, MaterializeInputSkipsPrunedChunks) {
+  const auto table = _table_with_nulls_and_zeros->get_output();
+
+  std::vector<std::vector<size_t>> histograms;
+  auto radix_container = materialize_input<int, int, false>(table, ColumnID{0}, histograms, 0, {true, false});
+
+  // The slots of the pruned chunk remain empty
+  EXPECT_EQ(radix_container.elements->size(), table->row_count());
+  for (auto offset = size_t{0}; offset < table->get_chunk(ChunkID{0})->size(); ++offset) {
+    EXPECT_EQ((*radix_container.elements)[offset].row_id, NULL_ROW_ID);
+  }
+  EXPECT_EQ(std::accumulate(histograms[0].begin(), histograms[0].end(), size_t{0}), 0u);
+  EXPECT_GT(std::accumulate(histograms[1].begin(), histograms[1].end(), size_t{0}), 0u);
+}
+
+TEST_F(JoinHashStepsTest, RuntimeFilter) {
+  // The build relation contains the multiples of three from 30 to 87
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 7);
+  for (auto value = 10; value < 30; ++value) {
+    table->append({value * 3});
+  }
+
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized = materialize_input<int, int, false>(table, ColumnID{0}, histograms, 0);
+  const auto runtime_filter = RuntimeFilter<int>(build<int, int>(materialized));
+
+  for (auto value = 10; value < 30; ++value) {
+    EXPECT_TRUE(runtime_filter.may_contain(value * 3));
+  }
+
+  // Values outside of the range always fail, while false positives within the range are rare
+  EXPECT_FALSE(runtime_filter.may_contain(29));
+  EXPECT_FALSE(runtime_filter.may_contain(88));
+  EXPECT_FALSE(runtime_filter.may_contain(-30));
+  auto false_positive_count = 0;
+  for (auto value = 30; value < 88; ++value) {
+    if (value % 3 != 0 && runtime_filter.may_contain(value)) ++false_positive_count;
+  }
+  EXPECT_LT(false_positive_count, 10);
+
+  // Without build values, every value fails
+  const auto empty_runtime_filter = RuntimeFilter<int>(std::vector<std::optional<PosHashTable<int>>>(2));
+  EXPECT_FALSE(empty_runtime_filter.may_contain(0));
+}
+
+TEST_F(JoinHashStepsTest, MaterializeInputAppliesRuntimeFilter) {
+  // The build relation only contains the value 1
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  table->append({1});
+
+  std::vector<std::vector<size_t>> build_histograms;
+  const auto materialized_build = materialize_input<int, int, false>(table, ColumnID{0}, build_histograms, 0);
+  const auto runtime_filter = RuntimeFilter<int>(build<int, int>(materialized_build));
+
+  // Only the rows with a one are materialized and counted, the slots of the other rows remain empty
+  std::vector<std::vector<size_t>> histograms;
+  const auto radix_container =
+      materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, 0, {}, &runtime_filter);
+
+  EXPECT_EQ(radix_container.elements->size(), _table_size_zero_one);
+  const auto materialized_count =
+      std::count_if(radix_container.elements->begin(), radix_container.elements->end(),
+                    [](const auto& element) { return !element.row_id.is_null(); });
+  EXPECT_EQ(static_cast<size_t>(materialized_count), _table_size_zero_one / 2);
+  EXPECT_EQ(std::accumulate(histograms[0].begin(), histograms[0].end(), size_t{0}), _table_size_zero_one / 2);
+  for (const auto& element : *radix_container.elements) {
+    if (!element.row_id.is_null()) EXPECT_EQ(element.value, 1);
+  }
+}
+
 }  // namespace opossum
@@ -1,7 +1,14 @@
 #include "../base_test.hpp"
 
 #include "operators/join_hash.hpp"
+#include "operators/join_hash/join_hash_steps.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -77,6 +84,44 @@ TEST_F(JoinHashTest, RadixClusteredLeftJoinWithZeroAndOnesAnd) {
   EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
 }
 
+TEST_F(JoinHashTest, RightJoinWithLargerLeftInput) {
+  // The outer input stays the probe input although it is the smaller one
+  auto right_join = std::make_shared<JoinHash>(_table_tpch_lineitems, _table_wrapper_small, JoinMode::Right,
+                                               ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  right_join->execute();
+
+  auto left_join = std::make_shared<JoinHash>(_table_wrapper_small, _table_tpch_lineitems, JoinMode::Left,
+                                              ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  left_join->execute();
+
+  EXPECT_EQ(right_join->get_output()->row_count(), left_join->get_output()->row_count());
+}
+
+TEST_F(JoinHashTest, RadixClusteredJoinOnMultipleNodes) {
+  // The partitions are distributed over the nodes of the topology
+  Topology::use_fake_numa_topology(8, 1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto node_count = Topology::get().nodes().size();
+  if (node_count > 1) {
+    EXPECT_EQ(partition_node_id(0, 4), NodeID{0});
+    EXPECT_EQ(partition_node_id(3, 4), NodeID{static_cast<NodeID::base_type>(3 % node_count)});
+  }
+  EXPECT_EQ(partition_node_id(0, 1), CURRENT_NODE_ID);
+
+  auto join = std::make_shared<JoinHash>(_table_with_nulls, _table_with_nulls, JoinMode::Left,
+                                         ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals, 2);
+  const auto task = std::make_shared<OperatorTask>(join, CleanupTemporaries::Yes);
+  task->schedule();
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+  Topology::use_default_topology();
+
+  std::shared_ptr<Table> expected_result =
+      load_table("resources/test_data/tbl/joinoperators/int_with_null_and_zero.tbl", 1);
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_result);
+}
+
 TEST_F(JoinHashTest, HashJoinNotApplicable) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -98,4 +143,120 @@ TEST_F(JoinHashTest, HashJoinNotApplicable) {
   EXPECT_THROW(execute_hash_join(JoinMode::Left, PredicateCondition::GreaterThan), std::logic_error);
 }
 
+TEST_F(JoinHashTest, RuntimePruningOfProbeChunks) {
+  // The probe side has six chunks with Bloom filters, only the third one contains the key of the build side
+  const auto probe_table = load_table("resources/test_data/tbl/tpch/sf-0.001/orders.tbl", 250);
+  SegmentStatistics::set_bloom_filter_bits_per_value(10);
+  ChunkEncoder::encode_all_chunks(probe_table);
+  SegmentStatistics::set_bloom_filter_bits_per_value(0);
+
+  const auto probe_wrapper = std::make_shared<TableWrapper>(probe_table);
+  probe_wrapper->execute();
+
+  const auto build_value = probe_table->get_value<int32_t>(ColumnID{0}, 600u);
+  const auto build_scan = create_table_scan(probe_wrapper, ColumnID{0}, PredicateCondition::Equals, build_value);
+  build_scan->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Semi}) {
+    auto join = std::make_shared<JoinHash>(build_scan, probe_wrapper, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                           PredicateCondition::Equals);
+    join->execute();
+
+    EXPECT_EQ(join->get_output()->row_count(), 1u);
+    EXPECT_EQ(join->get_output()->get_value<int32_t>(ColumnID{0}, 0u), build_value);
+  }
+}
+
+TEST_F(JoinHashTest, CompositeKeys) {
+  // Join on (a, b) = (c, d), where a and c have different types and NULLs never match
+  TableColumnDefinitions left_column_definitions;
+  left_column_definitions.emplace_back("a", DataType::Int, true);
+  left_column_definitions.emplace_back("b", DataType::String, true);
+  const auto left_table = std::make_shared<Table>(left_column_definitions, TableType::Data, 2);
+  left_table->append({1, "x"});
+  left_table->append({1, "y"});
+  left_table->append({2, "x"});
+  left_table->append({NullValue{}, "x"});
+  left_table->append({3, NullValue{}});
+
+  TableColumnDefinitions right_column_definitions;
+  right_column_definitions.emplace_back("c", DataType::Long, true);
+  right_column_definitions.emplace_back("d", DataType::String, true);
+  right_column_definitions.emplace_back("e", DataType::Int, true);
+  const auto right_table = std::make_shared<Table>(right_column_definitions, TableType::Data, 3);
+  right_table->append({int64_t{1}, "x", 10});
+  right_table->append({int64_t{1}, "z", 11});
+  right_table->append({int64_t{2}, "x", 12});
+  right_table->append({int64_t{2}, "x", 13});
+  right_table->append({int64_t{3}, NullValue{}, 14});
+  right_table->append({int64_t{1}, "x", 15});
+
+  const auto left = std::make_shared<TableWrapper>(left_table);
+  left->execute();
+  const auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  auto output_column_definitions = left_column_definitions;
+  output_column_definitions.insert(output_column_definitions.end(), right_column_definitions.begin(),
+                                   right_column_definitions.end());
+
+  const auto expected_inner = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  expected_inner->append({1, "x", int64_t{1}, "x", 10});
+  expected_inner->append({1, "x", int64_t{1}, "x", 15});
+  expected_inner->append({2, "x", int64_t{2}, "x", 12});
+  expected_inner->append({2, "x", int64_t{2}, "x", 13});
+
+  const auto expected_left = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  expected_left->append({1, "x", int64_t{1}, "x", 10});
+  expected_left->append({1, "x", int64_t{1}, "x", 15});
+  expected_left->append({2, "x", int64_t{2}, "x", 12});
+  expected_left->append({2, "x", int64_t{2}, "x", 13});
+  expected_left->append({1, "y", NullValue{}, NullValue{}, NullValue{}});
+  expected_left->append({NullValue{}, "x", NullValue{}, NullValue{}, NullValue{}});
+  expected_left->append({3, NullValue{}, NullValue{}, NullValue{}, NullValue{}});
+
+  const auto expected_semi = std::make_shared<Table>(left_column_definitions, TableType::Data);
+  expected_semi->append({1, "x"});
+  expected_semi->append({2, "x"});
+
+  const auto additional_column_ids = std::vector<ColumnIDPair>{{ColumnID{1}, ColumnID{1}}};
+  for (const auto radix_bits : {size_t{0}, size_t{2}}) {
+    // A budget of one byte spills the string keys
+    for (const auto& spill_options : {std::optional<SpillOptions>{}, std::optional<SpillOptions>{SpillOptions{1}}}) {
+      for (const auto& [mode, expected_table] : std::vector<std::pair<JoinMode, std::shared_ptr<Table>>>{
+               {JoinMode::Inner, expected_inner}, {JoinMode::Left, expected_left}, {JoinMode::Semi, expected_semi}}) {
+        auto join = std::make_shared<JoinHash>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                               PredicateCondition::Equals, radix_bits, additional_column_ids,
+                                               spill_options);
+        join->execute();
+        EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_table);
+      }
+    }
+  }
+}
+
+TEST_F(JoinHashTest, SpillPartitionsToDisk) {
+  // The partitions of orders and lineitems take about 150 KB, so that groups of about two of the 16 partitions are
+  // joined one after another
+  const auto spill_options = SpillOptions{20'000};
+
+  using Inputs = std::pair<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>>;
+  const auto inputs = std::vector<Inputs>{{_table_tpch_orders, _table_tpch_lineitems},
+                                          {_table_tpch_orders_scanned, _table_tpch_lineitems_scanned}};
+  for (const auto& [orders, lineitems] : inputs) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi, JoinMode::Anti}) {
+      auto join = std::make_shared<JoinHash>(orders, lineitems, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                             PredicateCondition::Equals);
+      join->execute();
+
+      auto spilled_join = std::make_shared<JoinHash>(orders, lineitems, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                     PredicateCondition::Equals, std::nullopt,
+                                                     std::vector<ColumnIDPair>{}, spill_options);
+      spilled_join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(spilled_join->get_output(), join->get_output());
+    }
+  }
+}
+
 }  // namespace opossum
@@ -29,9 +29,7 @@ void test_hash_map(const std::vector<T>& values) {
   EXPECT_EQ(hash_map.size(), 1);
 
   size_t row_count = 0;
-  for (const auto& pos_list_pair : hash_map.at(0).value()) {
-    row_count += pos_list_pair.second.size();
-  }
+  hash_map.at(0).value().for_each([&](const auto& value, const auto& row_ids) { row_count += row_ids.size(); });
   EXPECT_EQ(row_count, elements.size());
 
   ASSERT_FALSE(hash_map.at(0).value().empty());  // hash map for first (and only) chunk exists
@@ -40,7 +38,7 @@ void test_hash_map(const std::vector<T>& values) {
   for (const auto& element : elements) {
     const auto probe_value = element.value;
 
-    const auto result_list = hash_map.at(0).value().at(probe_value);
+    const auto result_list = hash_map.at(0).value().find(probe_value);
     const RowID probe_row_id{ChunkID{17}, offset};
     EXPECT_TRUE(std::find(result_list.begin(), result_list.end(), probe_row_id) != result_list.end());
     ++offset;
@@ -0,0 +1,182 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/join_iejoin.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinIEJoinTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto events = std::make_shared<Table>(
+        TableColumnDefinitions{{"id", DataType::Int, false}, {"ts", DataType::Int, true}}, TableType::Data, 3);
+    events->append({1, 5});
+    events->append({2, 10});
+    events->append({3, NullValue{}});
+    events->append({4, 15});
+    events->append({5, 10});
+    events->append({6, 25});
+    events->append({7, 1});
+
+    const auto intervals = std::make_shared<Table>(
+        TableColumnDefinitions{{"begin", DataType::Int, true}, {"end", DataType::Int, false}}, TableType::Data, 2);
+    intervals->append({0, 5});
+    intervals->append({5, 10});
+    intervals->append({10, 15});
+    intervals->append({NullValue{}, 20});
+    intervals->append({12, 12});
+    intervals->append({30, 40});
+
+    _events = std::make_shared<TableWrapper>(events);
+    _events->execute();
+    _intervals = std::make_shared<TableWrapper>(intervals);
+    _intervals->execute();
+  }
+
+  // The result of a JoinNestedLoop on the first predicate, followed by a TableScan of the second one
+  std::shared_ptr<const Table> expected_band_join(const std::shared_ptr<const AbstractOperator>& left,
+                                                  const std::shared_ptr<const AbstractOperator>& right,
+                                                  const PredicateCondition first_condition,
+                                                  const PredicateCondition second_condition) {
+    const auto join = std::make_shared<JoinNestedLoop>(left, right, JoinMode::Inner,
+                                                       ColumnIDPair{ColumnID{1}, ColumnID{0}}, first_condition);
+    join->execute();
+
+    const auto ts = pqp_column_(ColumnID{1}, DataType::Int, true, "ts");
+    const auto end = pqp_column_(ColumnID{3}, DataType::Int, false, "end");
+    const auto scan = std::make_shared<TableScan>(
+        join, std::make_shared<BinaryPredicateExpression>(second_condition, ts, end));
+    scan->execute();
+    return scan->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> _events, _intervals;
+};
+
+TEST_F(JoinIEJoinTest, OnePredicate) {
+  for (const auto predicate_condition : {PredicateCondition::LessThan, PredicateCondition::LessThanEquals,
+                                         PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Outer}) {
+      const auto column_ids = ColumnIDPair{ColumnID{1}, ColumnID{0}};
+
+      const auto join = std::make_shared<JoinIEJoin>(_events, _intervals, mode, column_ids, predicate_condition);
+      join->execute();
+
+      const auto expected =
+          std::make_shared<JoinNestedLoop>(_events, _intervals, mode, column_ids, predicate_condition);
+      expected->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected->get_output());
+    }
+  }
+}
+
+TEST_F(JoinIEJoinTest, TwoPredicates) {
+  const auto conditions = {PredicateCondition::LessThan, PredicateCondition::LessThanEquals,
+                           PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+
+  for (const auto first_condition : conditions) {
+    for (const auto second_condition : conditions) {
+      const auto join = std::make_shared<JoinIEJoin>(
+          _events, _intervals, JoinMode::Inner, ColumnIDPair{ColumnID{1}, ColumnID{0}}, first_condition,
+          OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, second_condition});
+      join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(),
+                                expected_band_join(_events, _intervals, first_condition, second_condition));
+    }
+  }
+}
+
+TEST_F(JoinIEJoinTest, BandJoin) {
+  // Events with the intervals that they fall into, i.e., ts >= begin AND ts <= end
+  const auto join = std::make_shared<JoinIEJoin>(
+      _events, _intervals, JoinMode::Inner, ColumnIDPair{ColumnID{1}, ColumnID{0}},
+      PredicateCondition::GreaterThanEquals,
+      OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThanEquals});
+  join->execute();
+
+  const auto expected = std::make_shared<Table>(TableColumnDefinitions{{"id", DataType::Int, false},
+                                                                       {"ts", DataType::Int, true},
+                                                                       {"begin", DataType::Int, true},
+                                                                       {"end", DataType::Int, false}},
+                                                TableType::Data);
+  expected->append({1, 5, 0, 5});
+  expected->append({1, 5, 5, 10});
+  expected->append({2, 10, 5, 10});
+  expected->append({2, 10, 10, 15});
+  expected->append({4, 15, 10, 15});
+  expected->append({5, 10, 5, 10});
+  expected->append({5, 10, 10, 15});
+  expected->append({7, 1, 0, 5});
+
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected);
+  EXPECT_EQ(join->description(DescriptionMode::SingleLine),
+            "JoinIEJoin (Inner Join where ts >= begin AND ts <= end)");
+}
+
+TEST_F(JoinIEJoinTest, ReferenceAndDictionaryInputs) {
+  // Many rows with duplicate values, so that the bit arrays span several words
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}},
+                                       TableType::Data, 100);
+  for (auto row_index = 0; row_index < 500; ++row_index) {
+    table->append({(row_index * 7) % 61, (row_index * 13) % 97});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}, ChunkID{3}});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto scan = std::make_shared<TableScan>(
+      table_wrapper, greater_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"), value_(10)));
+  scan->execute();
+
+  const auto join = std::make_shared<JoinIEJoin>(
+      scan, table_wrapper, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{1}}, PredicateCondition::LessThan,
+      OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, PredicateCondition::GreaterThanEquals});
+  join->execute();
+
+  const auto nested_loop = std::make_shared<JoinNestedLoop>(scan, table_wrapper, JoinMode::Inner,
+                                                            ColumnIDPair{ColumnID{0}, ColumnID{1}},
+                                                            PredicateCondition::LessThan);
+  nested_loop->execute();
+  const auto expected = std::make_shared<TableScan>(
+      nested_loop, greater_than_equals_(pqp_column_(ColumnID{1}, DataType::Int, false, "b"),
+                                        pqp_column_(ColumnID{2}, DataType::Int, false, "a")));
+  expected->execute();
+
+  EXPECT_GT(expected->get_output()->row_count(), 0u);
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected->get_output());
+}
+
+TEST_F(JoinIEJoinTest, EmptyInput) {
+  const auto empty_scan = std::make_shared<TableScan>(
+      _intervals, greater_than_(pqp_column_(ColumnID{1}, DataType::Int, false, "end"), value_(100)));
+  empty_scan->execute();
+
+  const auto inner_join = std::make_shared<JoinIEJoin>(_events, empty_scan, JoinMode::Inner,
+                                                       ColumnIDPair{ColumnID{1}, ColumnID{0}},
+                                                       PredicateCondition::GreaterThanEquals);
+  inner_join->execute();
+  EXPECT_EQ(inner_join->get_output()->row_count(), 0u);
+
+  const auto left_join = std::make_shared<JoinIEJoin>(_events, empty_scan, JoinMode::Left,
+                                                      ColumnIDPair{ColumnID{1}, ColumnID{0}},
+                                                      PredicateCondition::GreaterThanEquals);
+  left_join->execute();
+  EXPECT_EQ(left_join->get_output()->row_count(), 7u);
+}
+
+}  // namespace opossum
@@ -16,6 +16,7 @@
 #include "storage/index/b_tree/b_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -85,6 +86,16 @@ class JoinIndexTest : public BaseTest {
     return std::make_shared<TableWrapper>(table);
   }
 
+  static std::shared_ptr<TableWrapper> load_table_with_table_index(const std::string& filename,
+                                                                   const size_t chunk_size) {
+    auto table = load_table(filename, chunk_size);
+    table->create_table_index(ColumnID{0});
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
   // builds and executes the given Join and checks correctness of the output
   static void test_join_output(const std::shared_ptr<const AbstractOperator>& left,
                                const std::shared_ptr<const AbstractOperator>& right,
@@ -551,4 +562,59 @@ TYPED_TEST(JoinIndexTest, LeftJoinEmptyRefSegment) {
                          "resources/test_data/tbl/joinoperators/int_join_empty_left.tbl", 1);
 }
 
+TYPED_TEST(JoinIndexTest, InnerJoinWithTableIndex) {
+  // The chunks of the right table have no chunk indexes, the lookups go to the TableIndex
+  const auto right = this->load_table_with_table_index("resources/test_data/tbl/int_float2.tbl", 2);
+  this->test_join_output(this->_table_wrapper_a, right,
+                         std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                         JoinMode::Inner, "resources/test_data/tbl/joinoperators/int_inner_join.tbl", 1);
+}
+
+TYPED_TEST(JoinIndexTest, OuterJoinWithTableIndex) {
+  const auto right = this->load_table_with_table_index("resources/test_data/tbl/int_float2.tbl", 2);
+  this->test_join_output(this->_table_wrapper_a, right,
+                         std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals,
+                         JoinMode::Outer, "resources/test_data/tbl/joinoperators/int_outer_join.tbl", 1);
+}
+
+TYPED_TEST(JoinIndexTest, SmallerOuterJoinWithTableIndex) {
+  const auto right = this->load_table_with_table_index("resources/test_data/tbl/int.tbl", 1);
+  this->test_join_output(this->_table_wrapper_k, right,
+                         std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}), PredicateCondition::LessThan,
+                         JoinMode::Outer, "resources/test_data/tbl/joinoperators/int_smaller_outer_join.tbl", 1);
+}
+
+// The HashIndex is only used for (in)equality joins, other joins fall back to the nested loop join
+class JoinHashIndexTest : public JoinIndexTest<HashIndex> {};
+
+TEST_F(JoinHashIndexTest, InnerJoin) {
+  test_join_output(_table_wrapper_a, _table_wrapper_b, std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}),
+                   PredicateCondition::Equals, JoinMode::Inner,
+                   "resources/test_data/tbl/joinoperators/int_inner_join.tbl", 1);
+}
+
+TEST_F(JoinHashIndexTest, InnerJoinOnString) {
+  test_join_output(_table_wrapper_c, _table_wrapper_d, std::pair<ColumnID, ColumnID>(ColumnID{1}, ColumnID{0}),
+                   PredicateCondition::Equals, JoinMode::Inner,
+                   "resources/test_data/tbl/joinoperators/string_inner_join.tbl", 1);
+}
+
+TEST_F(JoinHashIndexTest, OuterJoin) {
+  test_join_output(_table_wrapper_a, _table_wrapper_b, std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}),
+                   PredicateCondition::Equals, JoinMode::Outer,
+                   "resources/test_data/tbl/joinoperators/int_outer_join.tbl", 1);
+}
+
+TEST_F(JoinHashIndexTest, NotEqualInnerJoin) {
+  test_join_output(_table_wrapper_a, _table_wrapper_b, std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}),
+                   PredicateCondition::NotEquals, JoinMode::Inner,
+                   "resources/test_data/tbl/joinoperators/int_notequal_inner_join.tbl", 1);
+}
+
+TEST_F(JoinHashIndexTest, SmallerInnerJoinFallsBack) {
+  test_join_output(_table_wrapper_a, _table_wrapper_b, std::pair<ColumnID, ColumnID>(ColumnID{0}, ColumnID{0}),
+                   PredicateCondition::LessThan, JoinMode::Inner,
+                   "resources/test_data/tbl/joinoperators/int_smaller_inner_join.tbl", 1, false);
+}
+
 }  // namespace opossum
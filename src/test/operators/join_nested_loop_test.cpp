@@ -0,0 +1,76 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class JoinNestedLoopTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // With chunks of 1000 rows, each pair of chunks is joined by its own job (see MIN_ROW_PAIRS_PER_JOB)
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+    auto left_table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+    auto right_table = std::make_shared<Table>(column_definitions, TableType::Data, 1'000);
+    for (auto row = 0; row < 2'500; ++row) {
+      left_table->append({row % 7 == 0 ? NULL_VALUE : AllTypeVariant{row % 1'300}});
+      right_table->append({row % 11 == 0 ? NULL_VALUE : AllTypeVariant{row % 1'700 + 1'000}});
+    }
+
+    _left = std::make_shared<TableWrapper>(left_table);
+    _left->execute();
+    _right = std::make_shared<TableWrapper>(right_table);
+    _right->execute();
+  }
+
+  std::shared_ptr<AbstractOperator> _left, _right;
+};
+
+TEST_F(JoinNestedLoopTest, ParallelJoinEqualsSequentialJoin) {
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Outer}) {
+    for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan,
+                                           PredicateCondition::GreaterThanEquals}) {
+      const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+      const auto sequential_join =
+          std::make_shared<JoinNestedLoop>(_left, _right, mode, column_ids, predicate_condition);
+      sequential_join->execute();
+
+      CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+      const auto parallel_join =
+          std::make_shared<JoinNestedLoop>(_left, _right, mode, column_ids, predicate_condition);
+      const auto task = std::make_shared<OperatorTask>(parallel_join, CleanupTemporaries::Yes);
+      task->schedule();
+      CurrentScheduler::get()->finish();
+      CurrentScheduler::set(nullptr);
+
+      // The matches of the jobs are merged in a fixed order
+      EXPECT_TABLE_EQ_ORDERED(parallel_join->get_output(), sequential_join->get_output());
+    }
+  }
+}
+
+TEST_F(JoinNestedLoopTest, MatchesOfAllPairsOfChunks) {
+  // Only the left values from 1000 to 1299 have matches, which lie in different chunks
+  auto expected_row_count = size_t{0};
+  for (auto left_row = 0; left_row < 2'500; ++left_row) {
+    if (left_row % 7 == 0) continue;
+    for (auto right_row = 0; right_row < 2'500; ++right_row) {
+      if (right_row % 11 != 0 && left_row % 1'300 == right_row % 1'700 + 1'000) ++expected_row_count;
+    }
+  }
+
+  const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+  const auto join =
+      std::make_shared<JoinNestedLoop>(_left, _right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+  join->execute();
+  EXPECT_EQ(join->get_output()->row_count(), expected_row_count);
+}
+
+}  // namespace opossum
@@ -0,0 +1,121 @@
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_partition_wise.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/table_partitioning.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinPartitionWiseTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _partitioning = TablePartitioning::hash(ColumnID{0}, DataType::Int, 4);
+    StorageManager::get().add_table("left", create_table(200, 50, _partitioning));
+    StorageManager::get().add_table("right", create_table(300, 70, _partitioning));
+  }
+
+  // A table with the columns a and b, where a takes distinct_value_count different values
+  static std::shared_ptr<Table> create_table(const size_t row_count, const size_t distinct_value_count,
+                                             const std::shared_ptr<const TablePartitioning>& partitioning) {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 20);
+    if (partitioning) table->set_partitioning(partitioning);
+    for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+      table->append({static_cast<int32_t>((row_id * 7) % distinct_value_count), static_cast<int32_t>(row_id)});
+    }
+    return table;
+  }
+
+  // Executes a JoinPartitionWise, compares its output with that of a JoinNestedLoop, and returns the number of
+  // partitions it joined separately
+  static std::optional<size_t> join(const std::shared_ptr<AbstractOperator>& left,
+                                    const std::shared_ptr<AbstractOperator>& right) {
+    const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+    const auto join_partition_wise =
+        std::make_shared<JoinPartitionWise>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+    join_partition_wise->execute();
+
+    const auto join_nested_loop =
+        std::make_shared<JoinNestedLoop>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+    join_nested_loop->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_partition_wise->get_output(), join_nested_loop->get_output());
+    return join_partition_wise->joined_partition_count();
+  }
+
+  std::shared_ptr<const TablePartitioning> _partitioning;
+};
+
+TEST_F(JoinPartitionWiseTest, JoinsPartitions) {
+  const auto left = std::make_shared<GetTable>("left");
+  const auto right = std::make_shared<GetTable>("right");
+  left->execute();
+  right->execute();
+
+  EXPECT_EQ(join(left, right), size_t{4});
+}
+
+TEST_F(JoinPartitionWiseTest, JoinsScannedPartitions) {
+  const auto left = std::make_shared<GetTable>("left");
+  const auto right = std::make_shared<GetTable>("right");
+  left->execute();
+  right->execute();
+
+  // The scans keep the partitions of the chunks
+  const auto left_scan =
+      std::make_shared<TableScan>(left, greater_than_(pqp_column_(ColumnID{1}, DataType::Int, false, "b"), 50));
+  left_scan->execute();
+
+  EXPECT_EQ(join(left_scan, right), size_t{4});
+}
+
+TEST_F(JoinPartitionWiseTest, JoinsUnpartitionedInputsAsAWhole) {
+  const auto left = std::make_shared<GetTable>("left");
+  const auto right = std::make_shared<TableWrapper>(create_table(300, 70, nullptr));
+  left->execute();
+  right->execute();
+
+  EXPECT_EQ(join(left, right), std::nullopt);
+}
+
+TEST_F(JoinPartitionWiseTest, ChosenForCoPartitionedTables) {
+  const auto translate_join = [](const std::string& left_table_name, const std::string& right_table_name,
+                                 const ColumnID right_column_id) {
+    const auto left_node = StoredTableNode::make(left_table_name);
+    const auto right_node = StoredTableNode::make(right_table_name);
+    const auto join_node = JoinNode::make(JoinMode::Inner,
+                                          equals_(LQPColumnReference{left_node, ColumnID{0}},
+                                                  LQPColumnReference{right_node, right_column_id}),
+                                          left_node, right_node);
+    return LQPTranslator{}.translate_node(join_node)->type();
+  };
+
+  StorageManager::get().add_table("unpartitioned", create_table(100, 10, nullptr));
+  StorageManager::get().add_table("other_partitioning",
+                                  create_table(100, 10, TablePartitioning::hash(ColumnID{0}, DataType::Int, 3)));
+
+  EXPECT_EQ(translate_join("left", "right", ColumnID{0}), OperatorType::JoinPartitionWise);
+  EXPECT_EQ(translate_join("left", "right", ColumnID{1}), OperatorType::JoinAdaptive);
+  EXPECT_EQ(translate_join("left", "unpartitioned", ColumnID{0}), OperatorType::JoinAdaptive);
+  EXPECT_EQ(translate_join("left", "other_partitioning", ColumnID{0}), OperatorType::JoinAdaptive);
+}
+
+}  // namespace opossum
@@ -83,4 +83,47 @@ TEST_F(JoinSemiAntiTest, AntiJoinBig) {
                              "resources/test_data/tbl/joinoperators/anti_result.tbl", 1);
 }
 
+TEST_F(JoinSemiAntiTest, DenseAndSparseBuildValues) {
+  // Dense build values are looked up in a bitmap, sparse ones in hash tables. Both have to give the same results.
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}};
+
+  auto probe_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+  for (auto value = -20; value < 80; ++value) {
+    probe_table->append({value});
+  }
+  probe_table->append({NullValue{}});
+  probe_table->append({2'000'000'000});
+
+  for (const auto sparse : {false, true}) {
+    auto build_table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+    for (auto value = -10; value < 30; value += 3) {
+      build_table->append({value});
+      build_table->append({value});
+    }
+    build_table->append({NullValue{}});
+    if (sparse) build_table->append({2'000'000'000});
+
+    const auto probe = std::make_shared<TableWrapper>(probe_table);
+    probe->execute();
+    const auto build = std::make_shared<TableWrapper>(build_table);
+    build->execute();
+
+    auto expected_semi = std::make_shared<Table>(column_definitions, TableType::Data);
+    auto expected_anti = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (auto value = -20; value < 80; ++value) {
+      const auto has_match = value >= -10 && value < 30 && (value + 10) % 3 == 0;
+      (has_match ? expected_semi : expected_anti)->append({value});
+    }
+    (sparse ? expected_semi : expected_anti)->append({2'000'000'000});
+
+    for (const auto mode : {JoinMode::Semi, JoinMode::Anti}) {
+      const auto join = std::make_shared<JoinHash>(probe, build, mode, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+                                                   PredicateCondition::Equals);
+      join->execute();
+      const auto& expected = mode == JoinMode::Semi ? expected_semi : expected_anti;
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected);
+    }
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,99 @@
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/morsel_planner.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class MorselPlannerTest : public BaseTest {
+ public:
+  void SetUp() override {
+    MorselPlanner::reset_cost_per_row(OperatorType::Mock);
+
+    // Ten chunks of ten rows each
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 10);
+    for (auto value = 0; value < 100; ++value) {
+      _table->append({value});
+    }
+  }
+
+  void TearDown() override { MorselPlanner::reset_cost_per_row(OperatorType::Mock); }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(MorselPlannerTest, EachChunkIsAMorselWithoutObservedCost) {
+  const auto morsels = MorselPlanner::plan(OperatorType::Mock, *_table, MorselPlanner::all_chunk_ids(*_table));
+
+  ASSERT_EQ(morsels.size(), 10u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(morsels[chunk_id].chunk_ids, std::vector<ChunkID>{chunk_id});
+    EXPECT_EQ(morsels[chunk_id].row_count, 10u);
+  }
+}
+
+TEST_F(MorselPlannerTest, CheapChunksAreGrouped) {
+  // 1ns per row, so that all rows fit into a single morsel
+  MorselPlanner::record_execution(OperatorType::Mock, 1'000, std::chrono::nanoseconds{1'000});
+  EXPECT_EQ(MorselPlanner::cost_per_row(OperatorType::Mock), 1.0);
+
+  const auto morsels = MorselPlanner::plan(OperatorType::Mock, *_table, MorselPlanner::all_chunk_ids(*_table));
+
+  ASSERT_EQ(morsels.size(), 1u);
+  EXPECT_EQ(morsels[0].chunk_ids, MorselPlanner::all_chunk_ids(*_table));
+  EXPECT_EQ(morsels[0].row_count, 100u);
+}
+
+TEST_F(MorselPlannerTest, MorselsAreSizedByObservedCost) {
+  // 20us per row, so that a morsel of TARGET_MORSEL_DURATION has at most 25 rows, i.e., two chunks
+  MorselPlanner::record_execution(OperatorType::Mock, 10, std::chrono::microseconds{200});
+
+  const auto morsels = MorselPlanner::plan(OperatorType::Mock, *_table, {ChunkID{1}, ChunkID{2}, ChunkID{3}});
+
+  ASSERT_EQ(morsels.size(), 2u);
+  EXPECT_EQ(morsels[0].chunk_ids, std::vector<ChunkID>({ChunkID{1}, ChunkID{2}}));
+  EXPECT_EQ(morsels[0].row_count, 20u);
+  EXPECT_EQ(morsels[1].chunk_ids, std::vector<ChunkID>{ChunkID{3}});
+  EXPECT_EQ(morsels[1].row_count, 10u);
+}
+
+TEST_F(MorselPlannerTest, CostIsAveragedOverExecutions) {
+  MorselPlanner::record_execution(OperatorType::Mock, 10, std::chrono::nanoseconds{100});
+  EXPECT_EQ(MorselPlanner::cost_per_row(OperatorType::Mock), 10.0);
+
+  // Empty morsels are ignored
+  MorselPlanner::record_execution(OperatorType::Mock, 0, std::chrono::nanoseconds{100});
+  EXPECT_EQ(MorselPlanner::cost_per_row(OperatorType::Mock), 10.0);
+
+  MorselPlanner::record_execution(OperatorType::Mock, 10, std::chrono::nanoseconds{900});
+  EXPECT_GT(MorselPlanner::cost_per_row(OperatorType::Mock), 10.0);
+  EXPECT_LT(MorselPlanner::cost_per_row(OperatorType::Mock), 90.0);
+}
+
+TEST_F(MorselPlannerTest, ForEachChunkVisitsEachChunkOnce) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // The first run has one morsel per chunk, the second one groups the chunks by the cost observed in the first run
+  for (auto run = 0; run < 2; ++run) {
+    // Each chunk is written by one job only
+    auto visit_counts = std::vector<size_t>(_table->chunk_count());
+    MorselPlanner::for_each_chunk(OperatorType::Mock, *_table,
+                                  [&](const ChunkID chunk_id) { ++visit_counts[chunk_id]; });
+
+    EXPECT_EQ(visit_counts, std::vector<size_t>(_table->chunk_count(), 1));
+  }
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+}  // namespace opossum
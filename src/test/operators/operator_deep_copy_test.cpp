@@ -7,6 +7,7 @@
 #include "expression/expression_functional.hpp"
 #include "operators/difference.hpp"
 #include "operators/get_table.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
 #include "operators/join_mpsm.hpp"
 #include "operators/join_nested_loop.hpp"
@@ -55,7 +56,7 @@ template <typename T>
 class DeepCopyTestJoin : public OperatorDeepCopyTest {};
 
 // here we define all Join types
-using JoinTypes = ::testing::Types<JoinNestedLoop, JoinHash, JoinSortMerge, JoinMPSM>;
+using JoinTypes = ::testing::Types<JoinNestedLoop, JoinHash, JoinSortMerge, JoinMPSM, JoinAdaptive>;
 TYPED_TEST_CASE(DeepCopyTestJoin, JoinTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(DeepCopyTestJoin, DeepCopyJoin) {
@@ -0,0 +1,104 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/operator_performance_data.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorPerformanceDataTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorPerformanceDataTest, PhaseAndTaskWalltimes) {
+  auto performance_data = OperatorPerformanceData{};
+  performance_data.add_phase_walltime("Build", std::chrono::nanoseconds{10});
+  performance_data.add_phase_walltime("Probe", std::chrono::nanoseconds{5});
+  performance_data.add_phase_walltime("Build", std::chrono::nanoseconds{20});
+
+  const auto phase_walltimes = performance_data.phase_walltimes();
+  ASSERT_EQ(phase_walltimes.size(), 2u);
+  EXPECT_EQ(phase_walltimes[0].first, "Build");
+  EXPECT_EQ(phase_walltimes[0].second, std::chrono::nanoseconds{30});
+  EXPECT_EQ(phase_walltimes[1].first, "Probe");
+  EXPECT_EQ(phase_walltimes[1].second, std::chrono::nanoseconds{5});
+
+  performance_data.add_task_walltime(std::chrono::nanoseconds{7});
+  performance_data.add_task_walltime(std::chrono::nanoseconds{3});
+  performance_data.add_task_walltime(std::chrono::nanoseconds{11});
+
+  const auto task_walltimes = performance_data.task_walltimes();
+  EXPECT_EQ(task_walltimes.count, 3u);
+  EXPECT_EQ(task_walltimes.total, std::chrono::nanoseconds{21});
+  EXPECT_EQ(task_walltimes.min, std::chrono::nanoseconds{3});
+  EXPECT_EQ(task_walltimes.max, std::chrono::nanoseconds{11});
+
+  const auto description = performance_data.to_string(DescriptionMode::MultiLine);
+  EXPECT_NE(description.find("Build: "), std::string::npos);
+  EXPECT_NE(description.find("3 task(s)"), std::string::npos);
+}
+
+TEST_F(OperatorPerformanceDataTest, TableScanCounters) {
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, greater_than_(column_a, 200));
+  table_scan->execute();
+
+  const auto& performance_data = table_scan->performance_data();
+  EXPECT_EQ(performance_data.input_row_count, 3u);
+  EXPECT_EQ(performance_data.output_row_count, 2u);
+  EXPECT_EQ(performance_data.output_chunk_count, 2u);
+  EXPECT_EQ(performance_data.chunks_processed, 2u);
+  EXPECT_EQ(performance_data.chunks_skipped, 0u);
+  EXPECT_EQ(performance_data.task_walltimes().count, 2u);
+}
+
+TEST_F(OperatorPerformanceDataTest, MemoryUsage) {
+  EXPECT_EQ(_table_wrapper->performance_data().peak_memory_usage_bytes, 0u);
+
+  const auto join = std::make_shared<JoinHash>(_table_wrapper, _table_wrapper, JoinMode::Inner,
+                                               ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join->execute();
+
+  // The hash tables are released after the execution, the PosLists of the output are retained
+  const auto& performance_data = join->performance_data();
+  EXPECT_GT(performance_data.retained_memory_usage_bytes, 0u);
+  EXPECT_GT(performance_data.peak_memory_usage_bytes, performance_data.retained_memory_usage_bytes);
+  EXPECT_NE(performance_data.to_string().find("peak memory"), std::string::npos);
+
+  // The operator's memory resource outlives the operator, as the output still references the PosLists
+  const auto output = join->get_output();
+  EXPECT_EQ(output->retained_memory_resources().size(), 1u);
+  EXPECT_EQ(output->row_count(), 3u);
+}
+
+TEST_F(OperatorPerformanceDataTest, JoinHashPhases) {
+  const auto join = std::make_shared<JoinHash>(_table_wrapper, _table_wrapper, JoinMode::Inner,
+                                               ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join->execute();
+
+  const auto& performance_data = join->performance_data();
+  EXPECT_EQ(performance_data.input_row_count, 6u);
+  EXPECT_EQ(performance_data.output_row_count, 3u);
+  EXPECT_GT(performance_data.bytes_materialized, 0u);
+
+  auto phases = std::vector<std::string>{};
+  for (const auto& [phase, walltime] : performance_data.phase_walltimes()) phases.emplace_back(phase);
+  EXPECT_EQ(phases, std::vector<std::string>({"Materialize", "Partition", "Build", "Probe", "Write output"}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,116 @@
+#if HYRISE_PARQUET_SUPPORT
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/export_parquet.hpp"
+#include "operators/import_parquet.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsParquetTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    column_definitions.emplace_back("c", DataType::Double, false);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+    _table->append({3, "b", 1.5});
+    _table->append({1, NullValue{}, 2.5});
+    _table->append({2, "a", 3.5});
+    _table->append({5, "c", 4.5});
+    _table->append({4, NullValue{}, 5.5});
+  }
+
+  void TearDown() override { std::remove(filename.c_str()); }
+
+  const std::string filename = test_data_path + "export_test.parquet";
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsParquetTest, RoundTrip) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  auto exporter = std::make_shared<ExportParquet>(table_wrapper, filename);
+  exporter->execute();
+
+  auto importer = std::make_shared<ImportParquet>(filename);
+  importer->execute();
+  const auto table = importer->get_output();
+
+  EXPECT_TABLE_EQ_ORDERED(table, _table);
+
+  // Each chunk was written as one row group and becomes a chunk again
+  EXPECT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->size(), 2u);
+}
+
+TEST_F(OperatorsParquetTest, DictionaryEncodedColumnsBecomeDictionarySegments) {
+  ExportParquet::write_parquet(*_table, filename);
+  const auto table = ImportParquet::read_parquet(filename);
+
+  const auto segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+  const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<std::string>>(segment);
+  ASSERT_TRUE(dictionary_segment);
+
+  // The dictionary is sorted although "b" was written first
+  EXPECT_EQ(*dictionary_segment->dictionary(), pmr_vector<std::string>({"a", "b"}));
+  EXPECT_EQ((*dictionary_segment)[ChunkOffset{0}], AllTypeVariant{"b"});
+  EXPECT_TRUE(variant_is_null((*dictionary_segment)[ChunkOffset{1}]));
+  EXPECT_EQ((*dictionary_segment)[ChunkOffset{2}], AllTypeVariant{"a"});
+}
+
+TEST_F(OperatorsParquetTest, ReadsSelectedColumns) {
+  ExportParquet::write_parquet(*_table, filename);
+  const auto table = ImportParquet::read_parquet(filename, {"c", "a"});
+
+  ASSERT_EQ(table->column_count(), 2u);
+  EXPECT_EQ(table->column_name(ColumnID{0}), "c");
+  EXPECT_EQ(table->column_name(ColumnID{1}), "a");
+  EXPECT_EQ(table->get_value<double>(ColumnID{0}, 3u), 4.5);
+  EXPECT_EQ(table->get_value<int32_t>(ColumnID{1}, 3u), 5);
+
+  EXPECT_THROW(ImportParquet::read_parquet(filename, {"d"}), std::exception);
+}
+
+TEST_F(OperatorsParquetTest, SkipsRowGroups) {
+  ExportParquet::write_parquet(*_table, filename);
+
+  // The first row group holds a in [1, 3], the second one a in [4, 5]
+  const auto greater_than = ImportParquet::read_parquet(filename, {}, {{"a", PredicateCondition::GreaterThan, 3}});
+  EXPECT_EQ(greater_than->row_count(), 2u);
+
+  const auto equals = ImportParquet::read_parquet(filename, {}, {{"a", PredicateCondition::Equals, 2}});
+  EXPECT_EQ(equals->row_count(), 3u);
+
+  const auto none = ImportParquet::read_parquet(filename, {}, {{"a", PredicateCondition::LessThan, 1}});
+  EXPECT_EQ(none->row_count(), 0u);
+
+  // Values of other types do not skip any row groups
+  const auto other_type = ImportParquet::read_parquet(filename, {}, {{"a", PredicateCondition::LessThan, int64_t{1}}});
+  EXPECT_EQ(other_type->row_count(), 5u);
+}
+
+TEST_F(OperatorsParquetTest, AddsTableToStorageManager) {
+  ExportParquet::write_parquet(*_table, filename);
+
+  auto importer = std::make_shared<ImportParquet>(filename, std::string{"parquet_table"});
+  importer->execute();
+
+  EXPECT_TRUE(StorageManager::get().has_table("parquet_table"));
+  EXPECT_EQ(StorageManager::get().get_table("parquet_table"), importer->get_output());
+}
+
+}  // namespace opossum
+
+#endif
@@ -0,0 +1,222 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "logical_query_plan/pipelining_lqp_translator.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/product.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class PipelineTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table_wrapper_a = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+    _table_wrapper_a->execute();
+    _table_wrapper_b = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float2.tbl", 2));
+    _table_wrapper_b->execute();
+
+    _a_a = PQPColumnExpression::from_table(*_table_wrapper_a->get_output(), "a");
+    _a_b = PQPColumnExpression::from_table(*_table_wrapper_a->get_output(), "b");
+  }
+
+  // Executes the join regularly and as the last stage of a Pipeline and compares the results
+  void test_join(const JoinMode mode, const bool probe_input_is_left) {
+    const auto join = std::make_shared<JoinHash>(_table_wrapper_a, _table_wrapper_b, mode,
+                                                 ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+    join->execute();
+
+    const auto probe_input = probe_input_is_left ? _table_wrapper_a : _table_wrapper_b;
+    const auto build_input = probe_input_is_left ? _table_wrapper_b : _table_wrapper_a;
+    const auto pipeline = std::make_shared<Pipeline>(
+        probe_input, std::vector<std::shared_ptr<AbstractOperator>>{join}, build_input, probe_input_is_left);
+    pipeline->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(pipeline->get_output(), join->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_a, _table_wrapper_b;
+  std::shared_ptr<PQPColumnExpression> _a_a, _a_b;
+};
+
+TEST_F(PipelineTest, ScanAndProjection) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper_a, greater_than_(_a_a, 200));
+  const auto projection = std::make_shared<Projection>(table_scan, expression_vector(add_(_a_a, _a_b), _a_a));
+  table_scan->execute();
+  projection->execute();
+
+  const auto pipeline = std::make_shared<Pipeline>(
+      _table_wrapper_a, std::vector<std::shared_ptr<AbstractOperator>>{table_scan, projection});
+  EXPECT_EQ(pipeline->stages().size(), 2u);
+  EXPECT_FALSE(pipeline->stages().front()->input_left());
+  pipeline->execute();
+
+  // The chunks are appended in the order of the input chunks
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), projection->get_output());
+}
+
+TEST_F(PipelineTest, ScanOnReferenceTable) {
+  const auto table_scan_a = std::make_shared<TableScan>(_table_wrapper_a, greater_than_(_a_a, 200));
+  table_scan_a->execute();
+  const auto table_scan_b = std::make_shared<TableScan>(table_scan_a, less_than_(_a_b, 458.0f));
+  table_scan_b->execute();
+
+  const auto pipeline =
+      std::make_shared<Pipeline>(table_scan_a, std::vector<std::shared_ptr<AbstractOperator>>{table_scan_b});
+  pipeline->execute();
+
+  EXPECT_EQ(pipeline->get_output()->type(), TableType::References);
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), table_scan_b->get_output());
+}
+
+TEST_F(PipelineTest, Validate) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+      mvcc_data->begin_cids[chunk_offset] = 0u;
+    }
+  }
+  table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->end_cids[0] = 0u;
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  const auto table_scan = std::make_shared<TableScan>(validate, greater_than_(_a_a, 100));
+  const auto pipeline =
+      std::make_shared<Pipeline>(table_wrapper, std::vector<std::shared_ptr<AbstractOperator>>{validate, table_scan});
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+  pipeline->set_transaction_context(transaction_context);
+  pipeline->execute();
+
+  const auto expected_result = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+  expected_result->append({123, 456.7f});
+  expected_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), expected_result);
+}
+
+TEST_F(PipelineTest, JoinHashInnerProbeLeft) { test_join(JoinMode::Inner, true); }
+
+TEST_F(PipelineTest, JoinHashInnerProbeRight) { test_join(JoinMode::Inner, false); }
+
+TEST_F(PipelineTest, JoinHashLeft) { test_join(JoinMode::Left, true); }
+
+TEST_F(PipelineTest, JoinHashRight) { test_join(JoinMode::Right, false); }
+
+TEST_F(PipelineTest, JoinHashSemi) { test_join(JoinMode::Semi, true); }
+
+TEST_F(PipelineTest, JoinHashAnti) { test_join(JoinMode::Anti, true); }
+
+TEST_F(PipelineTest, JoinHashOnReferenceTables) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper_a, greater_than_(_a_a, 200));
+  table_scan->execute();
+  const auto join = std::make_shared<JoinHash>(table_scan, _table_wrapper_b, JoinMode::Inner,
+                                               ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join->execute();
+
+  const auto pipeline = std::make_shared<Pipeline>(
+      _table_wrapper_a, std::vector<std::shared_ptr<AbstractOperator>>{table_scan, join}, _table_wrapper_b, true);
+  pipeline->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(pipeline->get_output(), join->get_output());
+}
+
+TEST_F(PipelineTest, ProductAndScan) {
+  // The product of each morsel of the left input is scanned before the next morsel is processed
+  const auto product = std::make_shared<Product>(_table_wrapper_a, _table_wrapper_b);
+  product->execute();
+  const auto left_a = PQPColumnExpression::from_table(*product->get_output(), ColumnID{0});
+  const auto right_a = PQPColumnExpression::from_table(*product->get_output(), ColumnID{2});
+  const auto table_scan = std::make_shared<TableScan>(product, less_than_(left_a, right_a));
+  table_scan->execute();
+
+  const auto pipeline = std::make_shared<Pipeline>(
+      _table_wrapper_a, std::vector<std::shared_ptr<AbstractOperator>>{product, table_scan}, _table_wrapper_b);
+  pipeline->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(pipeline->get_output(), table_scan->get_output());
+
+  // The morsels are taken from the left input only
+  EXPECT_FALSE(Pipeline::is_stage(*product, false));
+}
+
+TEST_F(PipelineTest, StagesOnlySupportedModes) {
+  const auto right_join =
+      std::make_shared<JoinHash>(_table_wrapper_a, _table_wrapper_b, JoinMode::Right,
+                                 ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  EXPECT_FALSE(Pipeline::is_stage(*right_join, true));
+  EXPECT_TRUE(Pipeline::is_stage(*right_join, false));
+
+  const auto composite_join = std::make_shared<JoinHash>(
+      _table_wrapper_a, _table_wrapper_b, JoinMode::Inner, ColumnIDPair{ColumnID{0}, ColumnID{0}},
+      PredicateCondition::Equals, std::nullopt, std::vector<ColumnIDPair>{{ColumnID{1}, ColumnID{1}}});
+  EXPECT_FALSE(Pipeline::is_stage(*composite_join, true));
+
+  EXPECT_FALSE(Pipeline::is_stage(*_table_wrapper_a));
+}
+
+TEST_F(PipelineTest, DeepCopy) {
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper_a, greater_than_(_a_a, 200));
+  const auto pipeline =
+      std::make_shared<Pipeline>(_table_wrapper_a, std::vector<std::shared_ptr<AbstractOperator>>{table_scan});
+  EXPECT_EQ(pipeline->description(), "Pipeline [TableScan Impl: Unset a > 200]");
+
+  const auto copy = std::static_pointer_cast<Pipeline>(pipeline->deep_copy());
+  ASSERT_EQ(copy->stages().size(), 1u);
+  EXPECT_NE(copy->stages().front(), pipeline->stages().front());
+  EXPECT_NE(copy->input_left(), pipeline->input_left());
+
+  std::const_pointer_cast<AbstractOperator>(copy->input_left())->execute();
+  copy->execute();
+  EXPECT_EQ(copy->get_output()->row_count(), 2u);
+}
+
+TEST_F(PipelineTest, PipeliningLQPTranslator) {
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+  const auto query =
+      "SELECT table_a.a, table_a.b + 1, table_b.b FROM table_a JOIN table_b ON table_a.a = table_b.a WHERE table_a.a > "
+      "200 AND table_b.b < 500";
+
+  auto expected_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+  const auto expected_result = expected_pipeline.get_result_table();
+  SQLPhysicalPlanCache::get().clear();
+
+  auto sql_pipeline =
+      SQLPipelineBuilder{query}.with_lqp_translator(std::make_shared<PipeliningLQPTranslator>()).create_pipeline();
+  const auto result = sql_pipeline.get_result_table();
+
+  EXPECT_TABLE_EQ_UNORDERED(result, expected_result);
+
+  // The Projection on top of the join is executed as part of the Pipeline of the join
+  const auto pqp = sql_pipeline.get_physical_plans().front();
+  ASSERT_EQ(pqp->type(), OperatorType::Pipeline);
+  const auto& stages = std::static_pointer_cast<const Pipeline>(pqp)->stages();
+  EXPECT_EQ(stages.back()->type(), OperatorType::Projection);
+  EXPECT_TRUE(std::any_of(stages.begin(), stages.end(),
+                          [](const auto& stage) { return stage->type() == OperatorType::JoinHash; }));
+}
+
+}  // namespace opossum
@@ -10,6 +10,9 @@
 #include "operators/product.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -57,4 +60,31 @@ TEST_F(OperatorsProductTest, SelfProduct) {
   EXPECT_TABLE_EQ_UNORDERED(product->get_output(), expected_result);
 }
 
+TEST_F(OperatorsProductTest, ParallelExecution) {
+  const auto product = std::make_shared<Product>(_table_wrapper_c, _table_wrapper_b);
+  product->execute();
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto parallel_product = std::make_shared<Product>(_table_wrapper_c, _table_wrapper_b);
+  const auto task = std::make_shared<OperatorTask>(parallel_product, CleanupTemporaries::Yes);
+  task->schedule();
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  // One output chunk per pair of input chunks, in the order of the left chunks
+  EXPECT_EQ(parallel_product->get_output()->chunk_count(),
+            _table_wrapper_c->get_output()->chunk_count() * _table_wrapper_b->get_output()->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(parallel_product->get_output(), product->get_output());
+}
+
+TEST_F(OperatorsProductTest, SkipsEmptyChunks) {
+  auto table_scan = create_table_scan(_table_wrapper_c, ColumnID{0}, PredicateCondition::LessThan, 0);
+  table_scan->execute();
+
+  auto product = std::make_shared<Product>(table_scan, _table_wrapper_b);
+  product->execute();
+  EXPECT_EQ(product->get_output()->chunk_count(), 0u);
+  EXPECT_EQ(product->get_output()->column_count(), 3u);
+}
+
 }  // namespace opossum
@@ -11,8 +11,13 @@
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/print.hpp"
 #include "operators/projection.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -54,6 +59,118 @@ TEST_F(OperatorsProjectionTest, ExecutedOnAllChunks) {
                             load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
 }
 
+TEST_F(OperatorsProjectionTest, ExecutedInParallelKeepsChunkOrder) {
+  const auto projection =
+      std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(add_(a_a, a_b), a_a));
+  projection->execute();
+
+  // The chunks are projected by different workers, but have to be appended in the order of the input chunks
+  Topology::use_fake_numa_topology(4, 1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto parallel_projection =
+      std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(add_(a_a, a_b), a_a));
+  const auto task = std::make_shared<OperatorTask>(parallel_projection, CleanupTemporaries::Yes);
+  task->schedule();
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+  Topology::use_default_topology();
+
+  EXPECT_EQ(parallel_projection->get_output()->chunk_count(), table_wrapper_a->get_output()->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(parallel_projection->get_output(), projection->get_output());
+}
+
+TEST_F(OperatorsProjectionTest, RowBudget) {
+  const auto projection = std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(add_(a_a, a_b)));
+  projection->set_row_budget(2);
+  projection->execute();
+
+  // Only the first chunk, which holds two rows, is projected
+  EXPECT_EQ(projection->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(projection->get_output()->row_count(), 2u);
+}
+
+TEST_F(OperatorsProjectionTest, KeepsOrderOfForwardedColumns) {
+  const auto sort = std::make_shared<Sort>(table_wrapper_a, ColumnID{1});
+  sort->execute();
+
+  // The scan and the projection keep the order of the rows, which the JoinAdaptive uses to choose a JoinSortMerge
+  const auto table_scan = std::make_shared<TableScan>(sort, greater_than_(a_a, 200));
+  table_scan->execute();
+  const auto projection = std::make_shared<opossum::Projection>(table_scan, expression_vector(add_(a_a, a_b), a_b));
+  projection->execute();
+
+  // In both outputs, b is the second column
+  for (const auto& table : {table_scan->get_output(), projection->get_output()}) {
+    ASSERT_EQ(table->chunk_count(), 1u);
+    const auto& ordered_by = table->get_chunk(ChunkID{0})->ordered_by();
+    ASSERT_TRUE(ordered_by);
+    EXPECT_EQ(ordered_by->first, ColumnID{1});
+    EXPECT_EQ(ordered_by->second, OrderByMode::Ascending);
+  }
+
+  // Without the sorted column, the order is unknown
+  const auto projection_without_b = std::make_shared<opossum::Projection>(table_scan, expression_vector(a_a));
+  projection_without_b->execute();
+  EXPECT_FALSE(projection_without_b->get_output()->get_chunk(ChunkID{0})->ordered_by());
+}
+
+TEST_F(OperatorsProjectionTest, LargeChunkIsEvaluatedInBatches) {
+  // The chunk is larger than ExpressionEvaluator::BATCH_SIZE, the results of the batches are appended to one segment
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                             10'000);
+  for (auto value = 0; value < 10'000; ++value) {
+    table->append({value % 1'000 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{value}});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+  const auto projection = std::make_shared<Projection>(table_wrapper, expression_vector(add_(column_a, 1), column_a));
+  projection->execute();
+
+  const auto& output = projection->get_output();
+  ASSERT_EQ(output->chunk_count(), 1u);
+  ASSERT_EQ(output->row_count(), 10'000u);
+  const auto& segment = *output->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10'000; ++chunk_offset) {
+    if (chunk_offset % 1'000 == 0) {
+      EXPECT_TRUE(variant_is_null(segment[chunk_offset]));
+    } else {
+      EXPECT_EQ(segment[chunk_offset], AllTypeVariant{static_cast<int32_t>(chunk_offset + 1)});
+    }
+  }
+}
+
+TEST_F(OperatorsProjectionTest, LargeChunkOfStringsIsEvaluatedInBatches) {
+  // The strings computed for each batch are moved into the output segment, the input column must remain unchanged
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"s", DataType::String, true}}, TableType::Data,
+                                             10'000);
+  for (auto value = 0; value < 10'000; ++value) {
+    table->append({value % 1'000 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{std::to_string(value)}});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_s = pqp_column_(ColumnID{0}, DataType::String, true, "s");
+  const auto projection =
+      std::make_shared<Projection>(table_wrapper, expression_vector(concat_(column_s, "!"), column_s));
+  projection->execute();
+
+  const auto& output = projection->get_output();
+  ASSERT_EQ(output->row_count(), 10'000u);
+  const auto& concatenated_segment = *output->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto& input_segment = *table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 10'000; ++chunk_offset) {
+    if (chunk_offset % 1'000 == 0) {
+      EXPECT_TRUE(variant_is_null(concatenated_segment[chunk_offset]));
+    } else {
+      EXPECT_EQ(concatenated_segment[chunk_offset], AllTypeVariant{std::to_string(chunk_offset) + "!"});
+      EXPECT_EQ(input_segment[chunk_offset], AllTypeVariant{std::to_string(chunk_offset)});
+    }
+  }
+}
+
 TEST_F(OperatorsProjectionTest, ForwardsIfPossibleDataTable) {
   // The Projection will forward segments from its input if all expressions are segment references.
   // Why would you enforce something like this? E.g., Update relies on it.
@@ -1,6 +1,9 @@
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -11,6 +14,7 @@
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/shared_dictionaries.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -64,6 +68,20 @@ TEST_P(OperatorsSortTest, AscendingSortOfOneColumn) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, OutputChunksAreOrdered) {
+  auto sort = std::make_shared<Sort>(_table_wrapper_null, ColumnID{1}, OrderByMode::DescendingNullsLast, 2u);
+  sort->execute();
+
+  const auto output = sort->get_output();
+  ASSERT_GT(output->chunk_count(), 1u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto& ordered_by = output->get_chunk(chunk_id)->ordered_by();
+    ASSERT_TRUE(ordered_by);
+    EXPECT_EQ(ordered_by->first, ColumnID{1});
+    EXPECT_EQ(ordered_by->second, OrderByMode::DescendingNullsLast);
+  }
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOFilteredColumn) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered_sorted.tbl", 2);
 
@@ -143,6 +161,125 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, MultipleColumnSort) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float2_sorted_mixed.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortOfManyRows) {
+  // Enough rows for several runs that are sorted and merged in parallel. The strings share a prefix that is longer
+  // than the part of them that is encoded in the normalized keys.
+  const auto row_count = 200'000;
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("s", DataType::String);
+  column_definitions.emplace_back("i", DataType::Int, true);
+  column_definitions.emplace_back("row", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 10'000);
+
+  const auto string = [](const auto row) { return "Customer#" + std::to_string(row % 1'000); };
+  const auto is_null = [](const auto row) { return row % 17 == 0; };
+  const auto value = [](const auto row) { return (row * 7) % 13 - 6; };
+
+  auto rows = std::vector<int32_t>(row_count);
+  for (auto row = int32_t{0}; row < row_count; ++row) {
+    rows[row] = row;
+    table->append({string(row), is_null(row) ? AllTypeVariant{NullValue{}} : AllTypeVariant{value(row)}, row});
+  }
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+  // Sort by s ascending, then by i descending with NULLs last
+  std::stable_sort(rows.begin(), rows.end(), [&](const auto left, const auto right) {
+    if (string(left) != string(right)) return string(left) < string(right);
+    if (is_null(left) || is_null(right)) return !is_null(left) && is_null(right);
+    return value(left) > value(right);
+  });
+
+  const auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto row : rows) {
+    expected_result->append(
+        {string(row), is_null(row) ? AllTypeVariant{NullValue{}} : AllTypeVariant{value(row)}, row});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper,
+                                     std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending},
+                                                                       {ColumnID{1}, OrderByMode::DescendingNullsLast}},
+                                     10'000u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+
+  // With a row limit, the runs only keep their first rows
+  const auto expected_first_rows = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto row_id = size_t{0}; row_id < 100; ++row_id) {
+    const auto row = rows[row_id];
+    expected_first_rows->append(
+        {string(row), is_null(row) ? AllTypeVariant{NullValue{}} : AllTypeVariant{value(row)}, row});
+  }
+
+  auto top_k = std::make_shared<Sort>(table_wrapper, sort->sort_definitions(), 10'000u, 100u);
+  top_k->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), expected_first_rows);
+
+  // A memory budget that fits about one chunk lets each chunk be spilled as a sorted run, which are then merged
+  const auto spill_options = SpillOptions{1'000'000};
+
+  auto external_sort =
+      std::make_shared<Sort>(table_wrapper, sort->sort_definitions(), 7'000u, std::nullopt, spill_options);
+  external_sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(external_sort->get_output(), expected_result);
+  EXPECT_EQ(external_sort->get_output()->chunk_count(), 29u);
+
+  auto external_top_k = std::make_shared<Sort>(table_wrapper, sort->sort_definitions(), 10'000u, 100u, spill_options);
+  external_top_k->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(external_top_k->get_output(), expected_first_rows);
+}
+
+TEST_P(OperatorsSortTest, RowLimit) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}, OrderByMode::Descending}};
+
+  // The rows with the same a keep their order when the limit cuts through them
+  const auto& column_definitions = table_wrapper->get_output()->column_definitions();
+  const auto expected_result = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_result->append({12, 350.7f});
+  expected_result->append({123, 458.7f});
+  expected_result->append({12345, 457.7f});
+
+  auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 2u, 3u);
+  sort->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+
+  // Limits of zero rows and of more rows than the input has
+  auto empty_sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 2u, 0u);
+  empty_sort->execute();
+  EXPECT_EQ(empty_sort->get_output()->row_count(), 0u);
+
+  auto full_sort = std::make_shared<Sort>(table_wrapper, sort_definitions, 2u, 100u);
+  full_sort->execute();
+  EXPECT_TABLE_EQ_ORDERED(full_sort->get_output(),
+                          load_table("resources/test_data/tbl/int_float2_sorted_mixed.tbl", 2));
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
 
@@ -217,4 +354,27 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneDictSegment) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, SortOfSharedDictionarySegmentsWithNull) {
+  auto table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table);
+  share_dictionaries(table, ColumnID{0});
+  ASSERT_FALSE(segments_with_shared_dictionary(*table, ColumnID{0}).empty());
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_results = std::vector<std::pair<OrderByMode, std::string>>{
+      {OrderByMode::Ascending, "resources/test_data/tbl/int_float_null_sorted_asc.tbl"},
+      {OrderByMode::Descending, "resources/test_data/tbl/int_float_null_sorted_desc.tbl"},
+      {OrderByMode::AscendingNullsLast, "resources/test_data/tbl/int_float_null_sorted_asc_nulls_last.tbl"},
+      {OrderByMode::DescendingNullsLast, "resources/test_data/tbl/int_float_null_sorted_desc_nulls_last.tbl"}};
+
+  for (const auto& [order_by_mode, expected_result_file] : expected_results) {
+    auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, order_by_mode, 2u);
+    sort->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table(expected_result_file, 2));
+  }
+}
+
 }  // namespace opossum
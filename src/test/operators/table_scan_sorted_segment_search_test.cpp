@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "constant_mappings.hpp"
+#include "operators/table_scan/column_between_table_scan_impl.hpp"
+#include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableScanSortedSegmentSearchTest : public BaseTestWithParam<std::tuple<EncodingType, OrderByMode>> {
+ protected:
+  void SetUp() override {
+    const auto [encoding_type, order_by_mode] = GetParam();  // NOLINT
+    _order_by_mode = order_by_mode;
+
+    const auto is_ascending =
+        order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast;
+    const auto nulls_first = order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+
+    // Values from 0 to 18 with duplicates, and five NULLs
+    auto values = std::vector<int32_t>{};
+    for (auto index = 0; index < 30; ++index) {
+      values.emplace_back((index / 3) * 2);
+    }
+    if (!is_ascending) std::reverse(values.begin(), values.end());
+
+    if (nulls_first) _values.insert(_values.end(), 5, std::nullopt);
+    _values.insert(_values.end(), values.begin(), values.end());
+    if (!nulls_first) _values.insert(_values.end(), 5, std::nullopt);
+
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+    for (const auto& value : _values) {
+      _table->append({value ? AllTypeVariant{*value} : NULL_VALUE});
+    }
+
+    ChunkEncoder::encode_all_chunks(_table, encoding_type);
+  }
+
+  std::vector<ChunkOffset> expected_offsets(const std::function<bool(int32_t)>& predicate) const {
+    auto offsets = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _values.size(); ++chunk_offset) {
+      if (_values[chunk_offset] && predicate(*_values[chunk_offset])) offsets.emplace_back(chunk_offset);
+    }
+    return offsets;
+  }
+
+  static std::vector<ChunkOffset> offsets(const PosList& pos_list) {
+    auto offsets = std::vector<ChunkOffset>{};
+    for (const auto& row_id : pos_list) {
+      EXPECT_EQ(row_id.chunk_id, ChunkID{0});
+      offsets.emplace_back(row_id.chunk_offset);
+    }
+    return offsets;
+  }
+
+  OrderByMode _order_by_mode;
+  std::vector<std::optional<int32_t>> _values;
+  std::shared_ptr<Table> _table;
+};
+
+auto sorted_segment_search_test_formatter =
+    [](const ::testing::TestParamInfo<std::tuple<EncodingType, OrderByMode>> info) {
+      const auto [encoding_type, order_by_mode] = info.param;  // NOLINT
+      return encoding_type_to_string.left.at(encoding_type) + order_by_mode_to_string.at(order_by_mode);
+    };
+
+INSTANTIATE_TEST_CASE_P(TableScanSortedSegmentSearchTestInstances, TableScanSortedSegmentSearchTest,
+                        ::testing::Combine(::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
+                                                             EncodingType::RunLength, EncodingType::FrameOfReference,
+                                                             EncodingType::LZ4, EncodingType::Delta),
+                                           ::testing::Values(OrderByMode::Ascending, OrderByMode::AscendingNullsLast,
+                                                             OrderByMode::Descending,
+                                                             OrderByMode::DescendingNullsLast)),
+                        sorted_segment_search_test_formatter);
+
+TEST_P(TableScanSortedSegmentSearchTest, ChunkEncoderDetectsOrder) {
+  const auto& ordered_by = _table->get_chunk(ChunkID{0})->ordered_by();
+  ASSERT_TRUE(ordered_by);
+  EXPECT_EQ(ordered_by->first, ColumnID{0});
+  EXPECT_EQ(ordered_by->second, _order_by_mode);
+}
+
+TEST_P(TableScanSortedSegmentSearchTest, ScanColumnVsValue) {
+  const auto predicates = std::vector<std::pair<PredicateCondition, std::function<bool(int32_t, int32_t)>>>{
+      {PredicateCondition::Equals, [](auto lhs, auto rhs) { return lhs == rhs; }},
+      {PredicateCondition::NotEquals, [](auto lhs, auto rhs) { return lhs != rhs; }},
+      {PredicateCondition::LessThan, [](auto lhs, auto rhs) { return lhs < rhs; }},
+      {PredicateCondition::LessThanEquals, [](auto lhs, auto rhs) { return lhs <= rhs; }},
+      {PredicateCondition::GreaterThan, [](auto lhs, auto rhs) { return lhs > rhs; }},
+      {PredicateCondition::GreaterThanEquals, [](auto lhs, auto rhs) { return lhs >= rhs; }}};
+
+  for (const auto& [predicate_condition, comparator] : predicates) {
+    for (auto search_value = -1; search_value <= 20; ++search_value) {
+      SCOPED_TRACE(predicate_condition_to_string.left.at(predicate_condition) + " " + std::to_string(search_value));
+
+      const auto scan_impl = ColumnVsValueTableScanImpl{_table, ColumnID{0}, predicate_condition, search_value};
+      const auto matches = scan_impl.scan_chunk(ChunkID{0});
+
+      const auto& predicate_comparator = comparator;
+      const auto expected =
+          expected_offsets([&](const auto value) { return predicate_comparator(value, search_value); });
+      EXPECT_EQ(offsets(*matches), expected);
+    }
+  }
+}
+
+TEST_P(TableScanSortedSegmentSearchTest, ScanBetween) {
+  for (auto left_value = -1; left_value <= 20; ++left_value) {
+    for (auto right_value = left_value - 1; right_value <= 20; ++right_value) {
+      SCOPED_TRACE(std::to_string(left_value) + " BETWEEN " + std::to_string(right_value));
+
+      const auto scan_impl = ColumnBetweenTableScanImpl{_table, ColumnID{0}, left_value, right_value};
+      const auto matches = scan_impl.scan_chunk(ChunkID{0});
+
+      const auto expected =
+          expected_offsets([&](const auto value) { return value >= left_value && value <= right_value; });
+      EXPECT_EQ(offsets(*matches), expected);
+    }
+  }
+}
+
+TEST_P(TableScanSortedSegmentSearchTest, ScanNull) {
+  const auto scan_impl = ColumnVsValueTableScanImpl{_table, ColumnID{0}, PredicateCondition::Equals, NULL_VALUE};
+  EXPECT_TRUE(scan_impl.scan_chunk(ChunkID{0})->empty());
+}
+
+}  // namespace opossum
@@ -13,9 +13,12 @@
 #include "operators/get_table.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "type_comparison.hpp"
 #include "types.hpp"
 
 using namespace std::string_literals;  // NOLINT
@@ -68,7 +71,8 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanStringTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
-                                          EncodingType::FixedStringDictionary, EncodingType::RunLength),
+                                          EncodingType::FixedStringDictionary, EncodingType::RunLength,
+                                          EncodingType::LZ4),
                         formatter);
 
 TEST_P(OperatorsTableScanStringTest, ScanEquals) {
@@ -162,6 +166,25 @@ TEST_P(OperatorsTableScanStringTest, ScanLikeStartingOnReferencedDictSegment) {
   EXPECT_TABLE_EQ_UNORDERED(scan2->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanStringTest, ScanNotLikeStartingOnDictSegment) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_string_like_not_starting.tbl", 1);
+  auto scan = create_table_scan(_gt_string_compressed, ColumnID{1}, PredicateCondition::NotLike, "Dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
+TEST_P(OperatorsTableScanStringTest, ScanLikeWithoutWildcardOnDictSegment) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_string_like_equals.tbl", 1);
+  auto scan = create_table_scan(_gt_string_compressed, ColumnID{1}, PredicateCondition::Like, "Reeperbahn");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+
+  // A prefix of a value does not match without a wildcard
+  auto prefix_scan = create_table_scan(_gt_string_compressed, ColumnID{1}, PredicateCondition::Like, "Reeper");
+  prefix_scan->execute();
+  EXPECT_EQ(prefix_scan->get_output()->row_count(), 0u);
+}
+
 // PredicateCondition::Like - Ending
 TEST_F(OperatorsTableScanStringTest, ScanLikeEnding) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_string_like_ending.tbl", 1);
@@ -315,4 +338,36 @@ TEST_P(OperatorsTableScanStringTest, ScanNotLikeUnderscoreWildcardOnDict) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_F(OperatorsTableScanStringTest, ScanValueSegmentByStringPrefixes) {
+  // Values that share their prefixes with the search values, so that the strings have to be compared in full
+  const auto values = std::vector<std::string>{"",    "abc", "abcd",         "abcde",           "abcdefgh", "abcdefgi",
+                                               "abce", "abd", "ab\0\0\0x"s, "abcd\xFF\xFF"s, "zz",       "abcdefgh"};
+  auto null_values = std::vector<bool>(values.size(), false);
+  null_values[10] = true;
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::String, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  table->append_chunk({std::make_shared<ValueSegment<std::string>>(values, null_values)});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto search_values = std::vector<std::string>{"", "abc", "abcd", "abcdefgh", "abcdefgha", "ab\0\0\0"s, "zz"};
+  for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::NotEquals,
+                                         PredicateCondition::LessThan, PredicateCondition::LessThanEquals,
+                                         PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    for (const auto& search_value : search_values) {
+      auto expected_row_count = size_t{0};
+      with_comparator(predicate_condition, [&](auto comparator) {
+        for (auto index = size_t{0}; index < values.size(); ++index) {
+          if (!null_values[index] && comparator(values[index], search_value)) ++expected_row_count;
+        }
+      });
+
+      const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, search_value);
+      scan->execute();
+      EXPECT_EQ(scan->get_output()->row_count(), expected_row_count) << search_value;
+    }
+  }
+}
+
 }  // namespace opossum
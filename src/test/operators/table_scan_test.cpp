@@ -17,10 +17,12 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_scan/column_between_table_scan_impl.hpp"
+#include "operators/table_scan/column_in_table_scan_impl.hpp"
 #include "operators/table_scan/column_is_null_table_scan_impl.hpp"
 #include "operators/table_scan/column_like_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_column_table_scan_impl.hpp"
 #include "operators/table_scan/column_vs_value_table_scan_impl.hpp"
+#include "operators/table_scan/conjunction_table_scan_impl.hpp"
 #include "operators/table_scan/expression_evaluator_table_scan_impl.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -241,7 +243,7 @@ auto formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
 
 INSTANTIATE_TEST_CASE_P(EncodingTypes, OperatorsTableScanTest,
                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary, EncodingType::RunLength,
-                                          EncodingType::FrameOfReference),
+                                          EncodingType::FrameOfReference, EncodingType::LZ4, EncodingType::Delta),
                         formatter);
 
 TEST_P(OperatorsTableScanTest, DoubleScan) {
@@ -256,6 +258,45 @@ TEST_P(OperatorsTableScanTest, DoubleScan) {
   EXPECT_TABLE_EQ_UNORDERED(scan_2->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, ConjunctionScan) {
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered.tbl", 2);
+
+  const auto table = get_int_float_op();
+  const auto column_a = get_column_expression(table, ColumnID{0});
+  const auto column_b = get_column_expression(table, ColumnID{1});
+
+  // Both predicates of the DoubleScan evaluated by a single TableScan
+  const auto scan =
+      std::make_shared<TableScan>(table, and_(greater_than_equals_(column_a, 1234), less_than_(column_b, 457.9)));
+  scan->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
+TEST_P(OperatorsTableScanTest, ConjunctionScanMatchesChainedScans) {
+  const auto in_tables = std::vector<std::shared_ptr<AbstractOperator>>{_int_int_compressed,
+                                                                        _int_int_partly_compressed,
+                                                                        get_table_op_filtered()};
+
+  for (const auto& in_table : in_tables) {
+    const auto column_a = get_column_expression(in_table, ColumnID{0});
+    const auto column_b = get_column_expression(in_table, ColumnID{1});
+
+    const auto scan_a = std::make_shared<TableScan>(in_table, greater_than_(column_a, 3));
+    scan_a->execute();
+    const auto scan_b = std::make_shared<TableScan>(scan_a, between_(column_b, 104, 110));
+    scan_b->execute();
+    const auto scan_c = std::make_shared<TableScan>(scan_b, not_equals_(column_a, 8));
+    scan_c->execute();
+
+    const auto conjunction_scan = std::make_shared<TableScan>(
+        in_table, and_(greater_than_(column_a, 3), and_(between_(column_b, 104, 110), not_equals_(column_a, 8))));
+    conjunction_scan->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(conjunction_scan->get_output(), scan_c->get_output());
+  }
+}
+
 TEST_P(OperatorsTableScanTest, EmptyResultScan) {
   auto scan_1 = create_table_scan(get_int_float_op(), ColumnID{0}, PredicateCondition::GreaterThan, 90000);
   scan_1->execute();
@@ -273,6 +314,81 @@ TEST_P(OperatorsTableScanTest, SingleScan) {
   EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, ScanWithRowBudgetStopsEarly) {
+  const auto table = load_and_encode_table("resources/test_data/tbl/int_float.tbl", 1);
+
+  // The first chunk already holds enough rows, so the other two chunks are not scanned
+  auto scan = create_table_scan(table, ColumnID{0}, PredicateCondition::GreaterThanEquals, 123);
+  scan->set_row_budget(1);
+  scan->execute();
+
+  EXPECT_EQ(scan->get_output()->chunk_count(), 1u);
+  EXPECT_EQ(scan->get_output()->get_value<int>(ColumnID{0}, 0u), 12345);
+
+  // The first rows are in chunk order, as without a budget
+  auto scan_with_larger_budget = create_table_scan(table, ColumnID{0}, PredicateCondition::GreaterThanEquals, 123);
+  scan_with_larger_budget->set_row_budget(2);
+  scan_with_larger_budget->execute();
+
+  EXPECT_GE(scan_with_larger_budget->get_output()->row_count(), 2u);
+  EXPECT_EQ(scan_with_larger_budget->get_output()->get_value<int>(ColumnID{0}, 0u), 12345);
+  EXPECT_EQ(scan_with_larger_budget->get_output()->get_value<int>(ColumnID{0}, 1u), 123);
+}
+
+TEST_P(OperatorsTableScanTest, ExpressionEvaluatorScanOfLargeChunk) {
+  // The chunk is larger than ExpressionEvaluator::BATCH_SIZE, so that the ExpressionEvaluatorTableScanImpl evaluates
+  // it in batches
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}},
+                                             TableType::Data, 10'000);
+  for (auto value = 0; value < 10'000; ++value) {
+    table->append({value, value % 7});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, {_encoding_type});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+  const auto scan = std::make_shared<TableScan>(table_wrapper, or_(less_than_(column_a, 100), equals_(column_b, 0)));
+  scan->execute();
+
+  // 100 values below 100 and the 1'414 multiples of 7 from 105 to 9'996, in their original order
+  const auto& output = scan->get_output();
+  ASSERT_EQ(output->row_count(), 1'514u);
+  EXPECT_EQ(output->get_value<int>(ColumnID{0}, 99u), 99);
+  EXPECT_EQ(output->get_value<int>(ColumnID{0}, 100u), 105);
+  EXPECT_EQ(output->get_value<int>(ColumnID{0}, 1'513u), 9'996);
+}
+
+TEST_P(OperatorsTableScanTest, ScanOfLongRuns) {
+  // RunLengthSegments are scanned run by run, adjacent matching runs are added as one range
+  const auto table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data, 10'000);
+  for (auto row = 0; row < 10'000; ++row) {
+    const auto run = row / 1'000;
+    table->append({run == 3 ? AllTypeVariant{NullValue{}} : AllTypeVariant{run}});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, {_encoding_type});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto scan_equals = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::Equals, 5);
+  scan_equals->execute();
+  EXPECT_EQ(scan_equals->get_output()->row_count(), 1'000u);
+
+  const auto scan_not_equals = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::NotEquals, 5);
+  scan_not_equals->execute();
+  const auto& not_equals_output = scan_not_equals->get_output();
+  ASSERT_EQ(not_equals_output->row_count(), 8'000u);
+  EXPECT_EQ(not_equals_output->get_value<int>(ColumnID{0}, 2'999u), 2);
+  EXPECT_EQ(not_equals_output->get_value<int>(ColumnID{0}, 3'000u), 4);
+  EXPECT_EQ(not_equals_output->get_value<int>(ColumnID{0}, 4'000u), 6);
+
+  const auto scan_greater_than = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  scan_greater_than->execute();
+  EXPECT_EQ(scan_greater_than->get_output()->row_count(), 7'000u);
+}
+
 TEST_P(OperatorsTableScanTest, SingleScanWithSubselect) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 1);
 
@@ -676,6 +792,37 @@ TEST_P(OperatorsTableScanTest, NullSemantics) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, CompactPosListsForDataTables) {
+  const auto pos_list_representations = [](const std::shared_ptr<const Table>& table) {
+    auto representations = std::vector<PosList::Representation>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto segment =
+          std::static_pointer_cast<const ReferenceSegment>(table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+      representations.emplace_back(segment->pos_list()->representation());
+    }
+    return representations;
+  };
+
+  // All rows of both chunks match, so the results are stored as ranges
+  const auto scan_all = create_table_scan(_int_int_compressed, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan_all->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan_all->get_output(), _int_int_compressed->get_output());
+  EXPECT_EQ(pos_list_representations(scan_all->get_output()),
+            std::vector<PosList::Representation>(2, PosList::Representation::Range));
+
+  // Most rows match, so a bitmap takes less memory than the RowIDs
+  const auto scan_most = create_table_scan(_int_int_compressed, ColumnID{0}, PredicateCondition::GreaterThanEquals, 4);
+  scan_most->execute();
+  ASSERT_COLUMN_EQ(scan_most->get_output(), ColumnID{0}, {10, 4, 12, 10, 4, 6, 8, 12, 8, 6});
+  EXPECT_EQ(pos_list_representations(scan_most->get_output()),
+            std::vector<PosList::Representation>(2, PosList::Representation::Bitmap));
+
+  // Compact PosLists can be scanned again
+  const auto scan_again = create_table_scan(scan_most, ColumnID{1}, PredicateCondition::LessThan, 110);
+  scan_again->execute();
+  ASSERT_COLUMN_EQ(scan_again->get_output(), ColumnID{1}, {104, 104, 106, 108, 108, 106});
+}
+
 TEST_P(OperatorsTableScanTest, MatchesAllExcludesNulls) {
   // Scan implementations will potentially optimize the scan if they can detect that all values in the column match the
   // predicate.
@@ -756,6 +903,51 @@ TEST_P(OperatorsTableScanTest, BinaryScanOnNullable) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, InListScan) {
+  const auto in_tables = std::vector<std::shared_ptr<AbstractOperator>>{_int_int_compressed,
+                                                                        _int_int_partly_compressed,
+                                                                        get_table_op_filtered()};
+
+  for (const auto& in_table : in_tables) {
+    const auto column_a = get_column_expression(in_table, ColumnID{0});
+
+    // 5 does not occur in the table
+    const auto in_scan = std::make_shared<TableScan>(in_table, in_(column_a, list_(12, 2, 5, 4)));
+    in_scan->execute();
+    const auto or_scan = std::make_shared<TableScan>(
+        in_table,
+        or_(equals_(column_a, 12), or_(equals_(column_a, 2), or_(equals_(column_a, 5), equals_(column_a, 4)))));
+    or_scan->execute();
+    EXPECT_TABLE_EQ_UNORDERED(in_scan->get_output(), or_scan->get_output());
+
+    const auto not_in_scan = std::make_shared<TableScan>(in_table, not_in_(column_a, list_(12, 2, 5, 4)));
+    not_in_scan->execute();
+    const auto and_scan = std::make_shared<TableScan>(
+        in_table, and_(not_equals_(column_a, 12),
+                       and_(not_equals_(column_a, 2), and_(not_equals_(column_a, 5), not_equals_(column_a, 4)))));
+    and_scan->execute();
+    EXPECT_TABLE_EQ_UNORDERED(not_in_scan->get_output(), and_scan->get_output());
+  }
+}
+
+TEST_P(OperatorsTableScanTest, InListScanNullSemantics) {
+  const auto table = get_int_float_with_null_op();
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, true, "a");
+
+  const auto in_scan = std::make_shared<TableScan>(table, in_(column_a, list_(123, 12345, NullValue{})));
+  in_scan->execute();
+  ASSERT_COLUMN_EQ(in_scan->get_output(), ColumnID{0}, {12345, 123});
+
+  const auto not_in_scan = std::make_shared<TableScan>(table, not_in_(column_a, list_(123)));
+  not_in_scan->execute();
+  ASSERT_COLUMN_EQ(not_in_scan->get_output(), ColumnID{0}, {12345, 1234});
+
+  // `a NOT IN (123, NULL)` is never true
+  const auto not_in_null_scan = std::make_shared<TableScan>(table, not_in_(column_a, list_(123, NullValue{})));
+  not_in_null_scan->execute();
+  EXPECT_EQ(not_in_null_scan->get_output()->row_count(), 0u);
+}
+
 TEST_P(OperatorsTableScanTest, SetParameters) {
   const auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{{ParameterID{3}, AllTypeVariant{5}},
                                                                           {ParameterID{2}, AllTypeVariant{6}}};
@@ -800,12 +992,22 @@ TEST_P(OperatorsTableScanTest, GetImpl) {
       TableScan{get_int_string_op(), like_(column_s, "%s%")}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
       TableScan{get_int_string_op(), like_("hello", "%s%")}.create_impl().get()));
-  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+  EXPECT_TRUE(dynamic_cast<ColumnInTableScanImpl*>(
       TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ColumnInTableScanImpl*>(
+      TableScan{get_int_float_op(), not_in_(column_a, list_(1, 2, NullValue{}))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
-      TableScan{get_int_float_op(), in_(column_a, list_(1, 2, 3))}.create_impl().get()));
+      TableScan{get_int_float_op(), in_(column_a, list_(1, 2.5, 3))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+      TableScan{get_int_float_op(), in_(column_a, list_(1, column_a))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ConjunctionTableScanImpl*>(
       TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+      TableScan{get_int_float_op(), and_(greater_than_(column_a, 5), equals_(column_b, column_a))}
+          .create_impl()
+          .get()));
+  EXPECT_TRUE(dynamic_cast<ExpressionEvaluatorTableScanImpl*>(
+      TableScan{get_int_float_op(), or_(greater_than_(column_a, 5), less_than_(column_b, 6))}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(
       TableScan{get_int_float_with_null_op(), is_null_(column_an)}.create_impl().get()));
   EXPECT_TRUE(dynamic_cast<ColumnIsNullTableScanImpl*>(
@@ -0,0 +1,105 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan/value_segment_simd_scan.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+template <typename T>
+class TableScanValueSegmentSimdTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 200 rows, so that there are three full blocks of 64 rows and a remainder. Every seventh row is NULL.
+    for (auto index = 0; index < 200; ++index) {
+      _values.push_back(static_cast<T>(index % 20));
+      _null_values.push_back(index % 7 == 0);
+    }
+  }
+
+  std::vector<ChunkOffset> expected_offsets(const PredicateCondition predicate_condition, const bool skip_nulls) const {
+    auto offsets = std::vector<ChunkOffset>{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _values.size(); ++chunk_offset) {
+      if (skip_nulls && _null_values[chunk_offset]) continue;
+
+      const auto value = _values[chunk_offset];
+      const auto search_value = static_cast<T>(10);
+      auto matches = false;
+      switch (predicate_condition) {
+        case PredicateCondition::Equals:
+          matches = value == search_value;
+          break;
+        case PredicateCondition::NotEquals:
+          matches = value != search_value;
+          break;
+        case PredicateCondition::LessThan:
+          matches = value < search_value;
+          break;
+        case PredicateCondition::LessThanEquals:
+          matches = value <= search_value;
+          break;
+        case PredicateCondition::GreaterThan:
+          matches = value > search_value;
+          break;
+        default:
+          matches = value >= search_value;
+      }
+      if (matches) offsets.emplace_back(chunk_offset);
+    }
+    return offsets;
+  }
+
+  static std::vector<ChunkOffset> offsets(const PosList& pos_list) {
+    auto offsets = std::vector<ChunkOffset>{};
+    for (const auto& row_id : pos_list) {
+      EXPECT_EQ(row_id.chunk_id, ChunkID{1});
+      offsets.emplace_back(row_id.chunk_offset);
+    }
+    return offsets;
+  }
+
+  void test_scan(const ValueSegment<T>& segment, const bool skip_nulls) const {
+    for (const auto predicate_condition :
+         {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+          PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+      for (auto register_width = 128u; register_width <= ValueSegmentSimdScan::max_register_width();
+           register_width *= 2u) {
+        auto matches = PosList{};
+        ValueSegmentSimdScan::scan(segment, predicate_condition, static_cast<T>(10), ChunkID{1}, matches,
+                                   register_width);
+        EXPECT_EQ(offsets(matches), expected_offsets(predicate_condition, skip_nulls)) << register_width;
+      }
+    }
+  }
+
+  pmr_concurrent_vector<T> _values;
+  pmr_concurrent_vector<bool> _null_values;
+};
+
+using DataTypes = ::testing::Types<int32_t, int64_t, float, double>;
+TYPED_TEST_CASE(TableScanValueSegmentSimdTest, DataTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(TableScanValueSegmentSimdTest, ScanWithoutNulls) {
+  const auto segment = ValueSegment<TypeParam>{pmr_concurrent_vector<TypeParam>{this->_values}};
+  this->test_scan(segment, false);
+}
+
+TYPED_TEST(TableScanValueSegmentSimdTest, ScanWithNulls) {
+  const auto segment = ValueSegment<TypeParam>{pmr_concurrent_vector<TypeParam>{this->_values},
+                                               pmr_concurrent_vector<bool>{this->_null_values}};
+  this->test_scan(segment, true);
+}
+
+TYPED_TEST(TableScanValueSegmentSimdTest, ScanShortSegment) {
+  // Shorter than a block, so that all rows are compared one by one
+  const auto segment = ValueSegment<TypeParam>{pmr_concurrent_vector<TypeParam>{TypeParam{10}, TypeParam{3}}};
+
+  auto matches = PosList{};
+  ValueSegmentSimdScan::scan(segment, PredicateCondition::LessThan, static_cast<TypeParam>(10), ChunkID{1}, matches);
+  EXPECT_EQ(this->offsets(matches), std::vector<ChunkOffset>{1u});
+}
+
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -54,6 +55,30 @@ TEST_F(OperatorsUnionAllTest, UnionOfValueReferenceTables) {
   EXPECT_TABLE_EQ_UNORDERED(union_all->get_output(), expected_result);
 }
 
+TEST_F(OperatorsUnionAllTest, ForwardsChunksWithoutMvccData) {
+  const auto table_scan_a = create_table_scan(_table_wrapper_a, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+  table_scan_a->execute();
+  const auto table_scan_b = create_table_scan(_table_wrapper_b, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+  table_scan_b->execute();
+
+  const auto union_all = std::make_shared<UnionAll>(table_scan_a, table_scan_b);
+  union_all->execute();
+
+  const auto& chunks_a = table_scan_a->get_output()->chunks();
+  const auto& chunks_b = table_scan_b->get_output()->chunks();
+  const auto& output_chunks = union_all->get_output()->chunks();
+  ASSERT_EQ(output_chunks.size(), chunks_a.size() + chunks_b.size());
+  EXPECT_TRUE(std::equal(chunks_a.cbegin(), chunks_a.cend(), output_chunks.cbegin()));
+  EXPECT_TRUE(std::equal(chunks_b.cbegin(), chunks_b.cend(), output_chunks.cbegin() + chunks_a.size()));
+
+  // The chunks of the inputs have MVCC data, which the output does not use
+  const auto union_all_of_data_tables = std::make_shared<UnionAll>(_table_wrapper_a, _table_wrapper_b);
+  union_all_of_data_tables->execute();
+  const auto& output_chunk = union_all_of_data_tables->get_output()->chunks().front();
+  EXPECT_NE(output_chunk, _table_wrapper_a->get_output()->chunks().front());
+  EXPECT_FALSE(output_chunk->has_mvcc_data());
+}
+
 TEST_F(OperatorsUnionAllTest, ThrowWrongColumnNumberException) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
   std::shared_ptr<Table> test_table_c = load_table("resources/test_data/tbl/int.tbl", 2);
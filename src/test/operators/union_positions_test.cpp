@@ -1,5 +1,6 @@
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -304,4 +305,38 @@ TEST_F(UnionPositionsTest, MultipleShuffledPosList) {
                             load_table("resources/test_data/tbl/union_positions_multiple_shuffled_pos_list.tbl"));
 }
 
+TEST_F(UnionPositionsTest, SingleReferencedTableShuffledPosLists) {
+  /**
+   * Both inputs reference only _table_10_ints, so their union is computed with bitmaps. The output has to be sorted by
+   * RowID with duplicates removed, and a NULL_ROW_ID (as created by outer joins) has to be emitted once, at the end.
+   */
+  const auto create_input = [&](const std::vector<std::vector<RowID>>& pos_lists) {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    auto table = std::make_shared<Table>(column_definitions, TableType::References);
+    for (const auto& pos_list : pos_lists) {
+      const auto segment = std::make_shared<ReferenceSegment>(
+          _table_10_ints, ColumnID{0}, std::make_shared<PosList>(pos_list.begin(), pos_list.end()));
+      table->append_chunk(Segments({segment}));
+    }
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+
+  const auto left = create_input({{RowID{ChunkID{3}, 0}, RowID{ChunkID{0}, 2}, NULL_ROW_ID},
+                                  {RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 1}}});
+  const auto right = create_input({{NULL_ROW_ID, RowID{ChunkID{1}, 1}, RowID{ChunkID{0}, 0}}});
+
+  auto union_positions_op = std::make_shared<UnionPositions>(left, right);
+  union_positions_op->execute();
+
+  const auto& output = union_positions_op->get_output();
+  ASSERT_EQ(output->chunk_count(), 1u);
+  const auto segment = output->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  EXPECT_EQ(pos_list, PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 1},
+                               RowID{ChunkID{3}, 0}, NULL_ROW_ID}));
+}
+
 }  // namespace opossum
@@ -13,6 +13,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -68,6 +69,24 @@ TEST_F(OperatorsValidateTest, SimpleValidate) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ValidateCompressedMvccData) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < _test_table->chunk_count(); ++chunk_id) {
+    const auto chunk = _test_table->get_chunk(chunk_id);
+    chunk->mark_immutable();
+    EXPECT_TRUE(chunk->try_compress_mvcc_data(3u));
+  }
+
+  auto context = std::make_shared<TransactionContext>(1u, 3u);
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/validate_output_validated.tbl", 2u);
+
+  auto validate = std::make_shared<Validate>(_table_wrapper);
+  validate->set_transaction_context(context);
+  validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
+}
+
 TEST_F(OperatorsValidateTest, ScanValidate) {
   auto context = std::make_shared<TransactionContext>(1u, 3u);
 
@@ -122,4 +141,70 @@ TEST_F(OperatorsValidateTest, ValidateReferenceSegmentWithMultipleChunks) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result);
 }
 
+TEST_F(OperatorsValidateTest, ForwardsFullyVisibleChunks) {
+  // A table with the same rows, whose MVCC data were not modified after the rows were added at commit id 0
+  auto table = std::make_shared<Table>(_test_table->column_definitions(), TableType::Data, 2u, UseMvcc::Yes);
+  for (ChunkID chunk_id{0}; chunk_id < _test_table->chunk_count(); ++chunk_id) {
+    table->append_chunk(_test_table->get_chunk(chunk_id)->segments());
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(std::make_shared<TransactionContext>(1u, 3u));
+  validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), _test_table);
+
+  // The rows are not checked one by one, all chunks are referenced as ranges
+  for (ChunkID chunk_id{0}; chunk_id < validate->get_output()->chunk_count(); ++chunk_id) {
+    const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+        validate->get_output()->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    ASSERT_TRUE(reference_segment);
+    EXPECT_EQ(reference_segment->pos_list()->representation(), PosList::Representation::Range);
+  }
+
+  // Once a row is invalidated, its chunk is validated row by row again
+  {
+    auto mvcc_data = table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock();
+    mvcc_data->end_cids[0u] = 2u;
+    mvcc_data->register_invalidation();
+  }
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/validate_output_validated.tbl", 2u);
+
+  auto validate_after_delete = std::make_shared<Validate>(table_wrapper);
+  validate_after_delete->set_transaction_context(std::make_shared<TransactionContext>(1u, 3u));
+  validate_after_delete->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(validate_after_delete->get_output(), expected_result);
+}
+
+TEST_F(OperatorsValidateTest, ForwardsReferencedFullyVisibleChunks) {
+  auto table = std::make_shared<Table>(_test_table->column_definitions(), TableType::Data, 2u, UseMvcc::Yes);
+  for (ChunkID chunk_id{0}; chunk_id < _test_table->chunk_count(); ++chunk_id) {
+    table->append_chunk(_test_table->get_chunk(chunk_id)->segments());
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto a = PQPColumnExpression::from_table(*table, "a");
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 2));
+  table_scan->execute();
+
+  auto validate = std::make_shared<Validate>(table_scan);
+  validate->set_transaction_context(std::make_shared<TransactionContext>(1u, 3u));
+  validate->execute();
+
+  // The chunks of the scan are forwarded as they are
+  const auto& scan_output = table_scan->get_output();
+  ASSERT_EQ(validate->get_output()->chunk_count(), scan_output->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < scan_output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(validate->get_output()->get_chunk(chunk_id)->get_segment(ColumnID{0}),
+              scan_output->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,182 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "expression/window_function_expression.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/window_function_evaluator.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class WindowFunctionEvaluatorTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _rows = {{1, 1, 10}, {2, 1, 20}, {3, 2, 5}, {4, 1, 20}, {5, 2, NullValue{}}, {6, 1, 30}, {7, 3, 7}};
+
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, 3);
+    for (const auto& row : _rows) {
+      _table->append(row);
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<const Table> evaluate(const WindowFunction window_function,
+                                        const std::shared_ptr<AbstractExpression>& argument,
+                                        const std::vector<std::shared_ptr<AbstractExpression>>& partition_by,
+                                        const std::vector<std::shared_ptr<AbstractExpression>>& order_by,
+                                        const std::vector<OrderByMode>& order_by_modes, const size_t offset = 1) {
+    const auto expression = std::make_shared<WindowFunctionExpression>(window_function, argument, partition_by,
+                                                                       order_by, order_by_modes, offset);
+    _window_function_evaluator = std::make_shared<WindowFunctionEvaluator>(_table_wrapper, expression);
+    _window_function_evaluator->execute();
+    return _window_function_evaluator->get_output();
+  }
+
+  // The input rows, each followed by its result of the window function
+  std::shared_ptr<Table> expected_table(const DataType data_type, const bool nullable,
+                                        const std::vector<AllTypeVariant>& results) {
+    auto column_definitions = _column_definitions;
+    column_definitions.emplace_back(_window_function_evaluator->window_function_expression->as_column_name(),
+                                    data_type, nullable);
+
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (auto row_index = size_t{0}; row_index < _rows.size(); ++row_index) {
+      auto row = _rows[row_index];
+      row.emplace_back(results[row_index]);
+      table->append(row);
+    }
+    return table;
+  }
+
+  const TableColumnDefinitions _column_definitions{
+      {"id", DataType::Int, false}, {"g", DataType::Int, false}, {"v", DataType::Int, true}};
+  const std::shared_ptr<AbstractExpression> _id = pqp_column_(ColumnID{0}, DataType::Int, false, "id");
+  const std::shared_ptr<AbstractExpression> _g = pqp_column_(ColumnID{1}, DataType::Int, false, "g");
+  const std::shared_ptr<AbstractExpression> _v = pqp_column_(ColumnID{2}, DataType::Int, true, "v");
+
+  std::vector<std::vector<AllTypeVariant>> _rows;
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<WindowFunctionEvaluator> _window_function_evaluator;
+};
+
+TEST_F(WindowFunctionEvaluatorTest, Ranking) {
+  // NULLs come first for OrderByMode::Ascending
+  const auto ascending = std::vector<OrderByMode>{OrderByMode::Ascending};
+
+  const auto row_number =
+      evaluate(WindowFunction::RowNumber, nullptr, expression_vector(_g), expression_vector(_v), ascending);
+  EXPECT_TABLE_EQ_ORDERED(row_number, expected_table(DataType::Long, false, {1, 2, 2, 3, 1, 4, 1}));
+
+  const auto rank = evaluate(WindowFunction::Rank, nullptr, expression_vector(_g), expression_vector(_v), ascending);
+  EXPECT_TABLE_EQ_ORDERED(rank, expected_table(DataType::Long, false, {1, 2, 2, 2, 1, 4, 1}));
+
+  const auto dense_rank =
+      evaluate(WindowFunction::DenseRank, nullptr, expression_vector(_g), expression_vector(_v), ascending);
+  EXPECT_TABLE_EQ_ORDERED(dense_rank, expected_table(DataType::Long, false, {1, 2, 2, 2, 1, 3, 1}));
+
+  EXPECT_EQ(_window_function_evaluator->description(DescriptionMode::SingleLine),
+            "WindowFunctionEvaluator DENSE_RANK() OVER (PARTITION BY g ORDER BY v (Ascending))");
+}
+
+TEST_F(WindowFunctionEvaluatorTest, RunningAggregates) {
+  // The frame ends with the last row that has the same ORDER BY values as the current row
+  const auto ascending = std::vector<OrderByMode>{OrderByMode::Ascending};
+
+  const auto sum = evaluate(WindowFunction::Sum, _v, expression_vector(_g), expression_vector(_v), ascending);
+  EXPECT_TABLE_EQ_ORDERED(sum, expected_table(DataType::Long, true, {10, 50, 5, 50, NullValue{}, 80, 7}));
+
+  const auto count = evaluate(WindowFunction::Count, _v, expression_vector(_g), expression_vector(_v), ascending);
+  EXPECT_TABLE_EQ_ORDERED(count, expected_table(DataType::Long, false, {1, 3, 1, 3, 0, 4, 1}));
+
+  const auto count_star =
+      evaluate(WindowFunction::Count, nullptr, expression_vector(_g), expression_vector(_v), ascending);
+  EXPECT_TABLE_EQ_ORDERED(count_star, expected_table(DataType::Long, false, {1, 3, 2, 3, 1, 4, 1}));
+
+  const auto min = evaluate(WindowFunction::Min, _v, expression_vector(), expression_vector(_id),
+                            std::vector<OrderByMode>{OrderByMode::Descending});
+  EXPECT_TABLE_EQ_ORDERED(min, expected_table(DataType::Int, true, {5, 5, 5, 7, 7, 7, 7}));
+}
+
+TEST_F(WindowFunctionEvaluatorTest, WholePartitionAggregates) {
+  const auto avg = evaluate(WindowFunction::Avg, _v, expression_vector(_g), expression_vector(), {});
+  EXPECT_TABLE_EQ_ORDERED(avg, expected_table(DataType::Double, true, {20.0, 20.0, 5.0, 20.0, 5.0, 20.0, 7.0}));
+
+  const auto max = evaluate(WindowFunction::Max, _v, expression_vector(), expression_vector(), {});
+  EXPECT_TABLE_EQ_ORDERED(max, expected_table(DataType::Int, true, {30, 30, 30, 30, 30, 30, 30}));
+}
+
+TEST_F(WindowFunctionEvaluatorTest, LagAndLead) {
+  const auto ascending = std::vector<OrderByMode>{OrderByMode::Ascending};
+
+  const auto lag = evaluate(WindowFunction::Lag, _v, expression_vector(_g), expression_vector(_id), ascending);
+  EXPECT_TABLE_EQ_ORDERED(lag,
+                          expected_table(DataType::Int, true, {NullValue{}, 10, NullValue{}, 20, 5, 20, NullValue{}}));
+
+  const auto lead = evaluate(WindowFunction::Lead, _v, expression_vector(), expression_vector(_id), ascending, 2);
+  EXPECT_TABLE_EQ_ORDERED(lead,
+                          expected_table(DataType::Int, true, {5, 20, NullValue{}, 30, 7, NullValue{}, NullValue{}}));
+}
+
+TEST_F(WindowFunctionEvaluatorTest, ManyPartitions) {
+  // Enough rows for several buckets, with encoded segments and a reference input
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}},
+                                       TableType::Data, 1'000);
+  for (auto row_index = 0; row_index < 50'000; ++row_index) {
+    table->append({row_index, row_index % 997});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}, ChunkID{3}, ChunkID{20}});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, false, "b");
+
+  const auto scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, value_(1'000)));
+  scan->execute();
+
+  const auto row_number = std::make_shared<WindowFunctionExpression>(
+      WindowFunction::RowNumber, nullptr, expression_vector(b), expression_vector(a),
+      std::vector<OrderByMode>{OrderByMode::Descending});
+  const auto window_function_evaluator = std::make_shared<WindowFunctionEvaluator>(scan, row_number);
+  window_function_evaluator->execute();
+
+  const auto output = window_function_evaluator->get_output();
+  ASSERT_EQ(output->row_count(), 49'000u);
+  EXPECT_EQ(output->column_count(), 3u);
+
+  // The row with the largest `a` of each partition is the first one
+  const auto last_row_of_partition = [](const auto b_value) {
+    auto last_row = b_value;
+    while (last_row + 997 < 50'000) last_row += 997;
+    return last_row;
+  };
+
+  for (auto row_index = size_t{0}; row_index < output->row_count(); row_index += 97) {
+    const auto a_value = output->get_value<int32_t>(ColumnID{0}, row_index);
+    const auto b_value = output->get_value<int32_t>(ColumnID{1}, row_index);
+    const auto expected = (last_row_of_partition(b_value) - a_value) / 997 + 1;
+    EXPECT_EQ(output->get_value<int64_t>(ColumnID{2}, row_index), expected);
+  }
+}
+
+TEST_F(WindowFunctionEvaluatorTest, DeepCopy) {
+  evaluate(WindowFunction::Rank, nullptr, expression_vector(_g), expression_vector(_v),
+           std::vector<OrderByMode>{OrderByMode::Ascending});
+  const auto copy = std::static_pointer_cast<WindowFunctionEvaluator>(_window_function_evaluator->deep_copy());
+  EXPECT_EQ(*copy->window_function_expression, *_window_function_evaluator->window_function_expression);
+}
+
+}  // namespace opossum
@@ -162,4 +162,18 @@ TEST(EnumerateCcpTest, ArbitraryVertexNumbering) {
   EXPECT_TRUE(equals(pairs[3], std::make_pair(0b101ul, 0b010ul)));
 }
 
+TEST(EnumerateCcpTest, Budget) {
+  // A clique of five vertices has 90 CsgCmpPairs
+  std::vector<std::pair<size_t, size_t>> edges{{0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 2},
+                                               {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4}};
+
+  auto enumerate_ccp_within_budget = EnumerateCcp{5, edges, 90};
+  EXPECT_EQ(enumerate_ccp_within_budget().size(), 90u);
+  EXPECT_FALSE(enumerate_ccp_within_budget.budget_exceeded());
+
+  auto enumerate_ccp_over_budget = EnumerateCcp{5, edges, 50};
+  enumerate_ccp_over_budget();
+  EXPECT_TRUE(enumerate_ccp_over_budget.budget_exceeded());
+}
+
 }  // namespace opossum
@@ -162,4 +162,46 @@ TEST_F(OptimizerTest, OptimizesSubqueriesExactlyOnce) {
   EXPECT_LQP_EQ(select_b_a->lqp, select_lqp_b);
 }
 
+TEST_F(OptimizerTest, RecordsRuleMetrics) {
+  class MockRule : public AbstractRule {
+   public:
+    explicit MockRule(const std::string& name) : _name(name) {}
+
+    std::string name() const override { return _name; }
+
+    void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override {}
+
+   private:
+    const std::string _name;
+  };
+
+  // Removes the first PredicateNode below the root
+  class RemovingRule : public AbstractRule {
+   public:
+    std::string name() const override { return "Removing"; }
+
+    void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override {
+      if (root->left_input() && root->left_input()->type == LQPNodeType::Predicate) {
+        lqp_remove_node(root->left_input());
+      }
+    }
+  };
+
+  Optimizer optimizer{};
+  optimizer.add_rule(std::make_shared<MockRule>("First"));
+  optimizer.add_rule(std::make_shared<RemovingRule>());
+  optimizer.add_rule(std::make_shared<MockRule>("Second"));
+
+  auto rule_metrics = std::vector<OptimizerRuleMetrics>{};
+  optimizer.optimize(PredicateNode::make(greater_than_(a, b), node_a), &rule_metrics);
+
+  ASSERT_EQ(rule_metrics.size(), 3u);
+  EXPECT_EQ(rule_metrics[0].rule_name, "First");
+  EXPECT_FALSE(rule_metrics[0].changed_plan);
+  EXPECT_EQ(rule_metrics[1].rule_name, "Removing");
+  EXPECT_TRUE(rule_metrics[1].changed_plan);
+  EXPECT_EQ(rule_metrics[2].rule_name, "Second");
+  EXPECT_FALSE(rule_metrics[2].changed_plan);
+}
+
 }  // namespace opossum
@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "optimizer/reoptimizing_executor.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ReoptimizingExecutorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("a", _create_table("a", 100, 50));
+    StorageManager::get().add_table("b", _create_table("b", 100, 50));
+    StorageManager::get().add_table("c", _create_table("c", 20, 0));
+
+    _node_a = StoredTableNode::make("a");
+    _node_b = StoredTableNode::make("b");
+    _node_c = StoredTableNode::make("c");
+    _a = _node_a->get_column("a");
+    _b = _node_b->get_column("b");
+    _c = _node_c->get_column("c");
+
+    _lqp =
+        JoinNode::make(JoinMode::Inner, equals_(_b, _c),
+                       PredicateNode::make(greater_than_(_a, 10),
+                                           JoinNode::make(JoinMode::Inner, equals_(_a, _b), _node_a, _node_b)),
+                       _node_c);
+  }
+
+  // The values are max(i - offset, 0) for i in [0, row_count). With an offset, the zeros are far more frequent than
+  // the other values, so the estimated row count of a join (which assumes uniformly distributed values) is far off.
+  static std::shared_ptr<Table> _create_table(const std::string& column_name, const int32_t row_count,
+                                              const int32_t offset) {
+    auto table = std::make_shared<Table>(TableColumnDefinitions{{column_name, DataType::Int}}, TableType::Data, 32,
+                                         UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      table->append({std::max(value - offset, 0)});
+    }
+    return table;
+  }
+
+  static std::shared_ptr<const Table> _execute_without_reoptimization(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    const auto tasks = OperatorTask::make_tasks_from_operator(LQPTranslator{}.translate_node(lqp),
+                                                              CleanupTemporaries::Yes);
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    return tasks.back()->get_operator()->get_output();
+  }
+
+  std::shared_ptr<StoredTableNode> _node_a, _node_b, _node_c;
+  LQPColumnReference _a, _b, _c;
+  std::shared_ptr<AbstractLQPNode> _lqp;
+};
+
+TEST_F(ReoptimizingExecutorTest, ReoptimizesOnMisestimation) {
+  auto executor = ReoptimizingExecutor{1.0f};
+  const auto result = executor.execute(_lqp);
+
+  EXPECT_TABLE_EQ_UNORDERED(result, _execute_without_reoptimization(_lqp));
+
+  // The predicate on top of the join is part of the checkpoint
+  ASSERT_EQ(executor.checkpoints().size(), 1u);
+  EXPECT_EQ(executor.checkpoints()[0].description, "[Predicate] a > 10");
+  EXPECT_EQ(executor.checkpoints()[0].actual_row_count, 39u);
+  EXPECT_TRUE(executor.checkpoints()[0].reoptimized);
+  EXPECT_EQ(executor.reoptimization_count(), 1u);
+}
+
+TEST_F(ReoptimizingExecutorTest, NoReoptimizationWithinThreshold) {
+  auto executor = ReoptimizingExecutor{1'000'000.0f};
+  const auto result = executor.execute(_lqp);
+
+  EXPECT_TABLE_EQ_UNORDERED(result, _execute_without_reoptimization(_lqp));
+
+  ASSERT_EQ(executor.checkpoints().size(), 1u);
+  EXPECT_FALSE(executor.checkpoints()[0].reoptimized);
+  EXPECT_EQ(executor.reoptimization_count(), 0u);
+}
+
+TEST_F(ReoptimizingExecutorTest, NoCheckpointsWithoutNestedJoins) {
+  const auto lqp = JoinNode::make(JoinMode::Inner, equals_(_a, _b), _node_a, _node_b);
+
+  auto executor = ReoptimizingExecutor{};
+  const auto result = executor.execute(lqp);
+
+  EXPECT_TABLE_EQ_UNORDERED(result, _execute_without_reoptimization(lqp));
+  EXPECT_TRUE(executor.checkpoints().empty());
+}
+
+TEST_F(ReoptimizingExecutorTest, InputLQPRemainsUnchanged) {
+  const auto expected_lqp = _lqp->deep_copy();
+
+  auto executor = ReoptimizingExecutor{1.0f};
+  executor.execute(_lqp);
+
+  EXPECT_EQ(*_lqp, *expected_lqp);
+}
+
+}  // namespace opossum
@@ -17,10 +17,12 @@
 #include "operators/get_table.hpp"
 #include "optimizer/strategy/chunk_pruning_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
+#include "statistics/chunk_statistics/segment_statistics.hpp"
 #include "statistics/column_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/table_partitioning.hpp"
 
 #include "utils/assert.hpp"
 
@@ -51,6 +53,8 @@ class ChunkPruningTest : public StrategyBaseTest {
     storage_manager.add_table("uncompressed", load_table("resources/test_data/tbl/int_float2.tbl", 10u));
   }
 
+  void TearDown() override { SegmentStatistics::set_bloom_filter_bits_per_value(0); }
+
   std::shared_ptr<ChunkPruningRule> _rule;
 };
 
@@ -274,4 +278,61 @@ TEST_F(ChunkPruningTest, FixedStringPruningTest) {
   EXPECT_EQ(excluded, expected);
 }
 
+TEST_F(ChunkPruningTest, BloomFilterPruningTest) {
+  auto& storage_manager = StorageManager::get();
+  SegmentStatistics::set_bloom_filter_bits_per_value(10);
+  storage_manager.add_table("bloom_filtered", load_table("resources/test_data/tbl/string.tbl", 3u));
+  ChunkEncoder::encode_all_chunks(storage_manager.get_table("bloom_filtered"), EncodingType::Dictionary);
+
+  // "xyz" lies within the range of values of both chunks, so only the Bloom filters can prune it
+  for (const auto& table_name : {"string_compressed", "bloom_filtered"}) {
+    auto stored_table_node = std::make_shared<StoredTableNode>(table_name);
+
+    auto predicate_node =
+        std::make_shared<PredicateNode>(equals_(LQPColumnReference(stored_table_node, ColumnID{0}), "xyz"));
+    predicate_node->set_left_input(stored_table_node);
+
+    StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+    const auto expected = table_name == std::string{"bloom_filtered"} ? std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}
+                                                                      : std::vector<ChunkID>{};
+    EXPECT_EQ(stored_table_node->excluded_chunk_ids(), expected);
+  }
+}
+
+TEST_F(ChunkPruningTest, PartitionPruningTest) {
+  // The chunks are neither encoded nor have statistics, so only their partitions allow pruning them
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2u);
+  table->set_partitioning(TablePartitioning::range(ColumnID{0}, DataType::Int, {10, 20}));
+  for (const auto value : {5, 15, 25, 6, 16, 26}) {
+    table->append({value, value});
+  }
+  StorageManager::get().add_table("partitioned", table);
+  ASSERT_EQ(table->chunk_count(), 3u);
+
+  const auto excluded_chunk_ids = [&](const std::shared_ptr<AbstractExpression>& predicate,
+                                      const std::shared_ptr<StoredTableNode>& stored_table_node) {
+    const auto predicate_node = PredicateNode::make(predicate, stored_table_node);
+    StrategyBaseTest::apply_rule(_rule, predicate_node);
+    return stored_table_node->excluded_chunk_ids();
+  };
+
+  auto stored_table_node = StoredTableNode::make("partitioned");
+  EXPECT_EQ(excluded_chunk_ids(greater_than_equals_(LQPColumnReference(stored_table_node, ColumnID{0}), 20),
+                               stored_table_node),
+            std::vector<ChunkID>({ChunkID{0}, ChunkID{1}}));
+
+  stored_table_node = StoredTableNode::make("partitioned");
+  EXPECT_EQ(excluded_chunk_ids(between_(LQPColumnReference(stored_table_node, ColumnID{0}), 0, 12), stored_table_node),
+            std::vector<ChunkID>({ChunkID{2}}));
+
+  stored_table_node = StoredTableNode::make("partitioned");
+  EXPECT_EQ(excluded_chunk_ids(greater_than_equals_(LQPColumnReference(stored_table_node, ColumnID{1}), 20),
+                               stored_table_node),
+            std::vector<ChunkID>{});
+}
+
 }  // namespace opossum
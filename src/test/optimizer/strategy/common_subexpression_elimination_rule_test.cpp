@@ -0,0 +1,85 @@
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/strategy/common_subexpression_elimination_rule.hpp"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CommonSubexpressionEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node_a = MockNode::make(
+        MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}, {DataType::Int, "c"}}, "a");
+
+    a = node_a->get_column("a");
+    b = node_a->get_column("b");
+    c = node_a->get_column("c");
+
+    rule = std::make_shared<CommonSubexpressionEliminationRule>();
+  }
+
+  std::shared_ptr<CommonSubexpressionEliminationRule> rule;
+  std::shared_ptr<MockNode> node_a;
+  LQPColumnReference a, b, c;
+};
+
+TEST_F(CommonSubexpressionEliminationRuleTest, NoSharedSubexpressions) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(add_(a, 1), mul_(a, 2), b),
+    node_a);
+  // clang-format on
+
+  const auto expected_lqp = lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, FactorsOutSharedSubexpression) {
+  // Similar to TPC-H query 1: `a * (1 - b)` is a column of its own and part of another one. Column c is not needed.
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(mul_(a, sub_(1, b)), mul_(mul_(a, sub_(1, b)), add_(1, a))),
+    PredicateNode::make(greater_than_(c, 5),
+      node_a));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(mul_(a, sub_(1, b)), mul_(mul_(a, sub_(1, b)), add_(1, a))),
+    ProjectionNode::make(expression_vector(a, mul_(a, sub_(1, b))),
+      PredicateNode::make(greater_than_(c, 5),
+        node_a)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(CommonSubexpressionEliminationRuleTest, NestedSharedSubexpressions) {
+  // `a + b` only occurs within `(a + b) * c`, which is factored out as a whole
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(add_(mul_(add_(a, b), c), 1), sub_(mul_(add_(a, b), c), 1)),
+    node_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(add_(mul_(add_(a, b), c), 1), sub_(mul_(add_(a, b), c), 1)),
+    ProjectionNode::make(expression_vector(mul_(add_(a, b), c)),
+      node_a));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "cost_model/cost_model_physical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/strategy/eager_aggregation_rule.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class EagerAggregationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    // A fact table with many rows per key of the dimension table
+    node_f = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "d_id"}, {DataType::Int, "amount"}}, "f");
+    node_f->set_statistics(std::make_shared<TableStatistics>(
+        TableType::Data, 1'000'000,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 10),
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 1000.0f, 1, 1000)}));
+
+    node_d = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "id"}, {DataType::Int, "category"}}, "d");
+    node_d->set_statistics(std::make_shared<TableStatistics>(
+        TableType::Data, 10,
+        std::vector<std::shared_ptr<const BaseColumnStatistics>>{
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 10),
+            std::make_shared<ColumnStatistics<int32_t>>(0.0f, 2.0f, 1, 2)}));
+
+    f_d_id = node_f->get_column("d_id");
+    f_amount = node_f->get_column("amount");
+    d_id = node_d->get_column("id");
+    d_category = node_d->get_column("category");
+
+    _rule = std::make_shared<EagerAggregationRule>(std::make_shared<CostModelPhysical>());
+  }
+
+  std::shared_ptr<EagerAggregationRule> _rule;
+
+  std::shared_ptr<MockNode> node_f, node_d;
+  LQPColumnReference f_d_id, f_amount, d_id, d_category;
+};
+
+TEST_F(EagerAggregationRuleTest, PushesPartialAggregateBelowJoin) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(d_category, sum_(f_amount), count_(f_amount)),
+    AggregateNode::make(expression_vector(d_category), expression_vector(sum_(f_amount), count_(f_amount)),
+      JoinNode::make(JoinMode::Inner, equals_(f_d_id, d_id),
+        node_f,
+        node_d)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(d_category, sum_(sum_(f_amount)), sum_(count_(f_amount))),
+    AggregateNode::make(expression_vector(d_category),
+                        expression_vector(sum_(sum_(f_amount)), sum_(count_(f_amount))),
+      JoinNode::make(JoinMode::Inner, equals_(f_d_id, d_id),
+        AggregateNode::make(expression_vector(f_d_id), expression_vector(sum_(f_amount), count_(f_amount)),
+          node_f),
+        node_d)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(EagerAggregationRuleTest, AvgIsNotPushedDown) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(d_category), expression_vector(avg_(f_amount)),
+    JoinNode::make(JoinMode::Inner, equals_(f_d_id, d_id),
+      node_f,
+      node_d));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(EagerAggregationRuleTest, NotPushedDownIfNotCheaper) {
+  // Each row of d has its own id, so aggregating d by its join column does not reduce its rows
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(f_amount), expression_vector(max_(d_category)),
+    JoinNode::make(JoinMode::Inner, equals_(f_d_id, d_id),
+      node_f,
+      node_d));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
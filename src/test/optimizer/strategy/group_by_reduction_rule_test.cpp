@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/group_by_reduction_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class GroupByReductionRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    const auto table = load_table("resources/test_data/tbl/int_int2.tbl");
+    table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("table_a", table);
+
+    node_table_a = StoredTableNode::make("table_a");
+    node_table_a_col_a = node_table_a->get_column("a");
+    node_table_a_col_b = node_table_a->get_column("b");
+
+    _rule = std::make_shared<GroupByReductionRule>();
+  }
+
+  std::shared_ptr<GroupByReductionRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node_table_a;
+  LQPColumnReference node_table_a_col_a, node_table_a_col_b;
+};
+
+TEST_F(GroupByReductionRuleTest, GroupByPrimaryKeyBecomesProjection) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, max_(node_table_a_col_b), count_star_()),
+    AggregateNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+                        expression_vector(max_(node_table_a_col_b), count_star_()),
+      node_table_a));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b, value_(int64_t{1})),
+    ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b, node_table_a_col_b,
+                                           value_(int64_t{1})),
+      node_table_a));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(GroupByReductionRuleTest, KeepsAggregateOfGroupsWithSeveralRows) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(node_table_a_col_b), expression_vector(max_(node_table_a_col_a)),
+    node_table_a);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(GroupByReductionRuleTest, KeepsAggregateWithSum) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(node_table_a_col_a), expression_vector(sum_(node_table_a_col_b)),
+    node_table_a);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
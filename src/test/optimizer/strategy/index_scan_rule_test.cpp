@@ -21,6 +21,7 @@
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/assert.hpp"
 
@@ -151,6 +152,60 @@ TEST_F(IndexScanRuleTest, IndexScanWithIndex) {
   EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanWithHashIndexForEquals) {
+  table->create_index<HashIndex>({ColumnID{2}});
+
+  // Column c has many distinct values, so that an equality predicate is selective
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  auto column_statistics = statistics_mock->column_statistics();
+  column_statistics[2] = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 20'000, 0, 20'000);
+  table->set_table_statistics(
+      std::make_shared<TableStatistics>(TableStatistics{TableType::Data, 1'000'000, column_statistics}));
+
+  auto predicate_node_0 = PredicateNode::make(equals_(c, 19'900));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+
+  // HashIndexes cannot answer range predicates
+  auto predicate_node_1 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_1->set_left_input(stored_table_node);
+
+  reordered = StrategyBaseTest::apply_rule(rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, IndexScanWithTableIndex) {
+  // The last chunk is still mutable and has no chunk index
+  table->append_mutable_chunk();
+  table->append({1, 2, 3});
+  table->create_table_index(ColumnID{2});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 = PredicateNode::make(greater_than_(c, 19'900));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoIndexScanWithTableIndexForUnsupportedPredicate) {
+  table->create_table_index(ColumnID{2});
+
+  auto statistics_mock = generate_mock_statistics(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 = PredicateNode::make(is_null_(c));
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type, ScanType::TableScan);
+}
+
 TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   table->create_index<GroupKeyIndex>({ColumnID{2}});
 
@@ -0,0 +1,128 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/join_elimination_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    // referencing_table.b references referenced_table.a
+    const auto referenced_table = load_table("resources/test_data/tbl/int_int3.tbl");
+    referenced_table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    StorageManager::get().add_table("referenced_table", referenced_table);
+
+    const auto referencing_table = load_table("resources/test_data/tbl/int_int2.tbl");
+    referencing_table->add_foreign_key_constraint({ColumnID{1}}, "referenced_table", {ColumnID{0}});
+    StorageManager::get().add_table("referencing_table", referencing_table);
+
+    referencing_node = StoredTableNode::make("referencing_table");
+    referencing_a = referencing_node->get_column("a");
+    referencing_b = referencing_node->get_column("b");
+
+    referenced_node = StoredTableNode::make("referenced_table");
+    referenced_a = referenced_node->get_column("a");
+    referenced_b = referenced_node->get_column("b");
+
+    _rule = std::make_shared<JoinEliminationRule>();
+  }
+
+  std::shared_ptr<JoinEliminationRule> _rule;
+
+  std::shared_ptr<StoredTableNode> referencing_node, referenced_node;
+  LQPColumnReference referencing_a, referencing_b, referenced_a, referenced_b;
+};
+
+TEST_F(JoinEliminationRuleTest, EliminatesJoinOnForeignKey) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(referencing_a),
+    JoinNode::make(JoinMode::Inner, equals_(referenced_a, referencing_b),
+      ValidateNode::make(referenced_node),
+      PredicateNode::make(greater_than_(referencing_a, 5),
+        referencing_node)));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(referencing_a),
+    PredicateNode::make(greater_than_(referencing_a, 5),
+      referencing_node));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, EliminatesSemiJoinOnForeignKey) {
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Semi, equals_(referencing_b, referenced_a),
+    referencing_node,
+    referenced_node);
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, referencing_node);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepsJoinIfReferencedColumnsAreUsed) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(referencing_a, referenced_b),
+    JoinNode::make(JoinMode::Inner, equals_(referencing_b, referenced_a),
+      referencing_node,
+      referenced_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepsJoinIfReferencedTableIsFiltered) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(referencing_a),
+    JoinNode::make(JoinMode::Inner, equals_(referencing_b, referenced_a),
+      referencing_node,
+      PredicateNode::make(greater_than_(referenced_b, 5),
+        referenced_node)));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(JoinEliminationRuleTest, KeepsJoinWithoutForeignKey) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(referencing_a),
+    JoinNode::make(JoinMode::Inner, equals_(referencing_a, referenced_a),
+      referencing_node,
+      referenced_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/materialized_view_rule.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class MaterializedViewRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int2.tbl"));
+
+    // The view is defined on nodes of its own, the queries below only equal it
+    const auto view_node_table_a = StoredTableNode::make("table_a");
+    const auto view_lqp = AggregateNode::make(expression_vector(view_node_table_a->get_column("a")),
+                                              expression_vector(sum_(view_node_table_a->get_column("b"))),
+                                              view_node_table_a);
+    StorageManager::get().add_materialized_view("view_a", std::make_shared<MaterializedView>(view_lqp));
+
+    node_table_a = StoredTableNode::make("table_a");
+    node_table_a_col_a = node_table_a->get_column("a");
+    node_table_a_col_b = node_table_a->get_column("b");
+
+    _rule = std::make_shared<MaterializedViewRule>();
+  }
+
+  std::shared_ptr<MaterializedViewRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node_table_a;
+  LQPColumnReference node_table_a_col_a, node_table_a_col_b;
+};
+
+TEST_F(MaterializedViewRuleTest, ReplacesMatchingSubPlan) {
+  // clang-format off
+  const auto input_lqp =
+  ProjectionNode::make(expression_vector(add_(sum_(node_table_a_col_b), 1), node_table_a_col_a),
+    SortNode::make(expression_vector(sum_(node_table_a_col_b)), std::vector<OrderByMode>{OrderByMode::Descending},
+      AggregateNode::make(expression_vector(node_table_a_col_a), expression_vector(sum_(node_table_a_col_b)),
+        ValidateNode::make(
+          node_table_a))));
+
+  const auto view_node = StoredTableNode::make("view_a");
+  const auto view_col_a = view_node->get_column("a");
+  const auto view_col_sum = view_node->get_column("SUM(b)");
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(add_(view_col_sum, 1), view_col_a),
+    SortNode::make(expression_vector(view_col_sum), std::vector<OrderByMode>{OrderByMode::Descending},
+      ValidateNode::make(
+        view_node)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(MaterializedViewRuleTest, KeepsDifferentPlans) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(node_table_a_col_a), expression_vector(sum_(node_table_a_col_b)),
+    PredicateNode::make(greater_than_(node_table_a_col_b, 5),
+      node_table_a));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "optimizer/strategy/sort_elimination_rule.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SortEliminationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    a = node->get_column("a");
+    b = node->get_column("b");
+
+    _rule = std::make_shared<SortEliminationRule>();
+  }
+
+  std::shared_ptr<SortEliminationRule> _rule;
+
+  std::shared_ptr<MockNode> node;
+  LQPColumnReference a, b;
+};
+
+TEST_F(SortEliminationRuleTest, RemovesSortOfSortedInput) {
+  const auto ascending_descending = std::vector<OrderByMode>{OrderByMode::Ascending, OrderByMode::Descending};
+
+  // clang-format off
+  const auto input_lqp =
+  SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending},
+    ProjectionNode::make(expression_vector(a, b),
+      PredicateNode::make(greater_than_(b, 5),
+        SortNode::make(expression_vector(a, b), ascending_descending,
+          node))));
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(a, b),
+    PredicateNode::make(greater_than_(b, 5),
+      SortNode::make(expression_vector(a, b), ascending_descending,
+        node)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SortEliminationRuleTest, KeepsSortOfDifferentOrder) {
+  // clang-format off
+  const auto input_lqp =
+  SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Descending},
+    SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending},
+      node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SortEliminationRuleTest, KeepsSortAboveIndexScan) {
+  // Index scans return their matches in the order of the index, not in the order of their input
+  const auto input_sort_node =
+      SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending}, node);
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 5), input_sort_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto sort_node = SortNode::make(expression_vector(a), std::vector<OrderByMode>{OrderByMode::Ascending},
+                                        predicate_node);
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, sort_node);
+
+  EXPECT_EQ(actual_lqp, sort_node);
+  EXPECT_EQ(sort_node->left_input(), predicate_node);
+  EXPECT_EQ(predicate_node->left_input(), input_sort_node);
+}
+
+TEST_F(SortEliminationRuleTest, RemovesSortBelowAggregate) {
+  // clang-format off
+  const auto input_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    SortNode::make(expression_vector(b), std::vector<OrderByMode>{OrderByMode::Ascending},
+      node));
+
+  const auto expected_lqp =
+  AggregateNode::make(expression_vector(a), expression_vector(sum_(b)),
+    node);
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/subselect_decorrelation_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SubselectDecorrelationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int2.tbl"));
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_int3.tbl"));
+
+    node_table_a = StoredTableNode::make("table_a");
+    node_table_a_col_a = node_table_a->get_column("a");
+    node_table_a_col_b = node_table_a->get_column("b");
+
+    node_table_b = StoredTableNode::make("table_b");
+    node_table_b_col_a = node_table_b->get_column("a");
+    node_table_b_col_b = node_table_b->get_column("b");
+
+    _rule = std::make_shared<SubselectDecorrelationRule>();
+  }
+
+  std::shared_ptr<SubselectDecorrelationRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node_table_a, node_table_b;
+  LQPColumnReference node_table_a_col_a, node_table_a_col_b, node_table_b_col_a, node_table_b_col_b;
+};
+
+TEST_F(SubselectDecorrelationRuleTest, ScalarAggregateToGroupedJoin) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // SELECT * FROM table_a WHERE b < (SELECT 2 * MIN(table_b.b) FROM table_b WHERE table_b.a = table_a.a)
+  // clang-format off
+  const auto subselect_lqp =
+  ProjectionNode::make(expression_vector(mul_(2, min_(node_table_b_col_b))),
+    AggregateNode::make(expression_vector(), expression_vector(min_(node_table_b_col_b)),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        node_table_b)));
+
+  const auto subselect = lqp_select_(subselect_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subselect),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(less_than_(node_table_a_col_b, mul_(2, min_(node_table_b_col_b))),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        ProjectionNode::make(expression_vector(mul_(2, min_(node_table_b_col_b)), node_table_b_col_a),
+          AggregateNode::make(expression_vector(node_table_b_col_a), expression_vector(min_(node_table_b_col_b)),
+            node_table_b)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubselectDecorrelationRuleTest, CountIsNotDecorrelated) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // COUNT() yields 0 for outer rows without matching rows, which the join would drop instead
+  // clang-format off
+  const auto subselect_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(count_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+
+  const auto subselect = lqp_select_(subselect_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subselect),
+    node_table_a);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubselectDecorrelationRuleTest, NullReplacingProjectionIsNotDecorrelated) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // CASE and IS NULL turn the NULL of outer rows without matching rows into a value, which the join would drop
+  const auto min_is_null = is_null_(min_(node_table_b_col_b));
+  const auto null_replacements = expression_vector(case_(min_is_null, 0, min_(node_table_b_col_b)),
+                                                   mul_(2, case_(min_is_null, 0, min_(node_table_b_col_b))));
+
+  for (const auto& null_replacement : null_replacements) {
+    // clang-format off
+    const auto subselect_lqp =
+    ProjectionNode::make(expression_vector(null_replacement),
+      AggregateNode::make(expression_vector(), expression_vector(min_(node_table_b_col_b)),
+        PredicateNode::make(equals_(node_table_b_col_a, parameter),
+          node_table_b)));
+
+    const auto subselect = lqp_select_(subselect_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+    const auto input_lqp =
+    PredicateNode::make(less_than_(node_table_a_col_b, subselect),
+      node_table_a);
+    // clang-format on
+
+    const auto expected_lqp = input_lqp->deep_copy();
+    const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  }
+}
+
+TEST_F(SubselectDecorrelationRuleTest, ParameterUsedTwiceIsNotDecorrelated) {
+  const auto parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+  // clang-format off
+  const auto subselect_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(min_(node_table_b_col_b)),
+    PredicateNode::make(less_than_(node_table_b_col_b, parameter),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        node_table_b)));
+
+  const auto subselect = lqp_select_(subselect_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(equals_(node_table_a_col_b, subselect),
+    node_table_a);
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+}  // namespace opossum
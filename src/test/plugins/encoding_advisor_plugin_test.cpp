@@ -0,0 +1,147 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "encoding_advisor_plugin.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorPluginTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 10, UseMvcc::Yes);
+
+    for (auto value = int32_t{0}; value < 30; ++value) {
+      _table->append({value % 5, value});
+    }
+
+    // The last chunk stays mutable
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}});
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void TearDown() override {
+    EncodingAdvisorPlugin::get().reset();
+    EncodingAdvisorPlugin::get().set_options(EncodingAdvisorPlugin::Options{});
+  }
+
+  void scan(const ColumnID column_id, const PredicateCondition predicate_condition, const AllTypeVariant& value) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+    create_table_scan(get_table, column_id, predicate_condition, value)->execute();
+  }
+
+  EncodingType encoding_type(const ChunkID chunk_id, const ColumnID column_id) const {
+    const auto segment = _table->get_chunk(chunk_id)->get_segment(column_id);
+    const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(segment);
+    return encoded_segment ? encoded_segment->encoding_type() : EncodingType::Unencoded;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingAdvisorPluginTest, Description) {
+  EXPECT_EQ(EncodingAdvisorPlugin::get().description(), "This plugin re-encodes segments based on the workload");
+}
+
+TEST_F(EncodingAdvisorPluginTest, RangeScannedColumnsUseFrameOfReference) {
+  scan(ColumnID{0}, PredicateCondition::GreaterThan, 2);
+  scan(ColumnID{0}, PredicateCondition::Equals, 2);
+  scan(ColumnID{0}, PredicateCondition::LessThanEquals, 1);
+
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 2u);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{0}), EncodingType::FrameOfReference);
+  EXPECT_EQ(encoding_type(ChunkID{1}, ColumnID{0}), EncodingType::FrameOfReference);
+  EXPECT_EQ(encoding_type(ChunkID{2}, ColumnID{0}), EncodingType::Unencoded);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{1}), EncodingType::Dictionary);
+
+  // The values do not change
+  for (auto row_id = size_t{0}; row_id < 30; ++row_id) {
+    EXPECT_EQ(_table->get_value<int32_t>(ColumnID{0}, row_id), static_cast<int32_t>(row_id % 5));
+  }
+
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 0u);
+}
+
+TEST_F(EncodingAdvisorPluginTest, FilteredColumnsUseFilterEncoding) {
+  // Equality scans on Dictionary segments do not need a different encoding
+  scan(ColumnID{1}, PredicateCondition::Equals, 12);
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 0u);
+  EXPECT_EQ(EncodingAdvisorPlugin::get().target_encoding("table_a", ColumnID{1})->encoding_type,
+            EncodingType::Dictionary);
+
+  auto options = EncodingAdvisorPlugin::Options{};
+  options.filter_encoding_spec = SegmentEncodingSpec{EncodingType::RunLength};
+  EncodingAdvisorPlugin::get().set_options(options);
+
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 2u);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{1}), EncodingType::RunLength);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{0}), EncodingType::Dictionary);
+}
+
+TEST_F(EncodingAdvisorPluginTest, ColdColumnsAreCompressed) {
+  auto options = EncodingAdvisorPlugin::Options{};
+  options.cold_pass_count = 2;
+  EncodingAdvisorPlugin::get().set_options(options);
+
+  // Columns are not cold before they were observed for long enough
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 0u);
+
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto table_scan = create_table_scan(get_table, ColumnID{1}, PredicateCondition::IsNotNull, NullValue{});
+  table_scan->execute();
+
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 2u);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{0}), EncodingType::LZ4);
+  EXPECT_EQ(encoding_type(ChunkID{1}, ColumnID{0}), EncodingType::LZ4);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{1}), EncodingType::Dictionary);
+  EXPECT_EQ(EncodingAdvisorPlugin::get().target_encoding("table_a", ColumnID{1})->encoding_type,
+            EncodingType::Dictionary);
+}
+
+TEST_F(EncodingAdvisorPluginTest, RespectsCpuBudget) {
+  auto options = EncodingAdvisorPlugin::Options{};
+  options.cpu_share = 0.0;
+  // The unscanned column would become cold in the third pass otherwise
+  options.cold_pass_count = 10;
+  EncodingAdvisorPlugin::get().set_options(options);
+
+  scan(ColumnID{0}, PredicateCondition::LessThan, 3);
+
+  // At least one segment is re-encoded per pass
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 1u);
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 1u);
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 0u);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{0}), EncodingType::FrameOfReference);
+  EXPECT_EQ(encoding_type(ChunkID{1}, ColumnID{0}), EncodingType::FrameOfReference);
+}
+
+TEST_F(EncodingAdvisorPluginTest, FollowsWorkload) {
+  auto options = EncodingAdvisorPlugin::Options{};
+  options.workload_decay = 0.0;
+  EncodingAdvisorPlugin::get().set_options(options);
+
+  scan(ColumnID{0}, PredicateCondition::LessThan, 3);
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 2u);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{0}), EncodingType::FrameOfReference);
+
+  // Accesses of the replaced segments are not counted again
+  scan(ColumnID{0}, PredicateCondition::Equals, 3);
+  scan(ColumnID{0}, PredicateCondition::NotEquals, 3);
+  EXPECT_EQ(EncodingAdvisorPlugin::get().tune_encodings(), 2u);
+  EXPECT_EQ(encoding_type(ChunkID{0}, ColumnID{0}), EncodingType::Dictionary);
+  EXPECT_EQ(encoding_type(ChunkID{1}, ColumnID{0}), EncodingType::Dictionary);
+}
+
+}  // namespace opossum
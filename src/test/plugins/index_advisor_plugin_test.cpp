@@ -0,0 +1,197 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "index_advisor_plugin.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class IndexAdvisorPluginTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 10, UseMvcc::Yes);
+
+    for (auto value = int32_t{0}; value < 30; ++value) {
+      _table->append({value % 5, value});
+    }
+
+    // The last chunk stays mutable
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}});
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void TearDown() override {
+    IndexAdvisorPlugin::get().reset();
+    IndexAdvisorPlugin::get().set_options(IndexAdvisorPlugin::Options{});
+  }
+
+  // Executes a scan on the stored table and records it
+  void record_scan(const ColumnID column_id, const PredicateCondition predicate_condition,
+                   const AllTypeVariant& value) {
+    const auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+    const auto table_scan = create_table_scan(get_table, column_id, predicate_condition, value);
+    table_scan->execute();
+    IndexAdvisorPlugin::get().record_plan(table_scan);
+  }
+
+  size_t index_count(const SegmentIndexType index_type, const ColumnID column_id) const {
+    auto count = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      if (_table->get_chunk(chunk_id)->get_index(index_type, std::vector<ColumnID>{column_id})) ++count;
+    }
+    return count;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(IndexAdvisorPluginTest, Description) {
+  EXPECT_EQ(IndexAdvisorPlugin::get().description(),
+            "This plugin creates and drops chunk indexes based on the workload");
+}
+
+TEST_F(IndexAdvisorPluginTest, CreatesHashIndexesForEqualityScans) {
+  record_scan(ColumnID{0}, PredicateCondition::Equals, 2);
+
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 2u);
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{0}), 2u);
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{1}), 0u);
+  EXPECT_EQ(index_count(SegmentIndexType::GroupKey, ColumnID{0}), 0u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_index(SegmentIndexType::Hash, std::vector<ColumnID>{ColumnID{0}}));
+  EXPECT_FALSE(_table->get_chunk(ChunkID{2})->get_index(SegmentIndexType::Hash, std::vector<ColumnID>{ColumnID{0}}));
+
+  // The optimizer is told about the new indexes
+  const auto index_infos = _table->get_indexes();
+  ASSERT_EQ(index_infos.size(), 1u);
+  EXPECT_EQ(index_infos[0].column_ids, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(index_infos[0].type, SegmentIndexType::Hash);
+
+  // Existing indexes are kept
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 0u);
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{0}), 2u);
+}
+
+TEST_F(IndexAdvisorPluginTest, CreatesGroupKeyIndexesForRangeScans) {
+  record_scan(ColumnID{1}, PredicateCondition::Equals, 2);
+  record_scan(ColumnID{1}, PredicateCondition::GreaterThan, 20);
+
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 2u);
+  EXPECT_EQ(index_count(SegmentIndexType::GroupKey, ColumnID{1}), 2u);
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{1}), 0u);
+}
+
+TEST_F(IndexAdvisorPluginTest, RespectsMemoryBudget) {
+  auto options = IndexAdvisorPlugin::Options{};
+  options.memory_budget = BaseIndex::estimate_memory_consumption(SegmentIndexType::Hash, 10, 5, sizeof(int32_t));
+  IndexAdvisorPlugin::get().set_options(options);
+
+  record_scan(ColumnID{0}, PredicateCondition::Equals, 2);
+
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 1u);
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{0}), 1u);
+
+  options.memory_budget = 0;
+  IndexAdvisorPlugin::get().set_options(options);
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 1u);
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{0}), 0u);
+  EXPECT_TRUE(_table->get_indexes().empty());
+}
+
+TEST_F(IndexAdvisorPluginTest, DropsIndexesOfPastWorkload) {
+  auto options = IndexAdvisorPlugin::Options{};
+  options.benefit_decay = 0.0;
+  IndexAdvisorPlugin::get().set_options(options);
+
+  record_scan(ColumnID{0}, PredicateCondition::Equals, 2);
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 2u);
+
+  // The workload moved on to the other column
+  record_scan(ColumnID{1}, PredicateCondition::LessThan, 5);
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 4u);
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{0}), 0u);
+  EXPECT_EQ(index_count(SegmentIndexType::GroupKey, ColumnID{1}), 2u);
+
+  const auto index_infos = _table->get_indexes();
+  ASSERT_EQ(index_infos.size(), 1u);
+  EXPECT_EQ(index_infos[0].column_ids, std::vector<ColumnID>{ColumnID{1}});
+
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 2u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->has_indices());
+  EXPECT_TRUE(_table->get_indexes().empty());
+}
+
+TEST_F(IndexAdvisorPluginTest, KeepsOtherIndexes) {
+  _table->create_index<HashIndex>({ColumnID{0}});
+
+  record_scan(ColumnID{0}, PredicateCondition::Equals, 2);
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 0u);
+
+  IndexAdvisorPlugin::get().reset();
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{0}), 3u);
+  EXPECT_EQ(_table->get_indexes().size(), 1u);
+}
+
+TEST_F(IndexAdvisorPluginTest, IgnoresScansWithoutIndexBenefit) {
+  // Scans that were not executed, that do not compare with a constant, or that are not on a stored table
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto unexecuted_scan = create_table_scan(get_table, ColumnID{0}, PredicateCondition::Equals, 2);
+  IndexAdvisorPlugin::get().record_plan(unexecuted_scan);
+
+  record_scan(ColumnID{0}, PredicateCondition::IsNull, NullValue{});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+  const auto wrapped_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::Equals, 2);
+  wrapped_scan->execute();
+  IndexAdvisorPlugin::get().record_plan(wrapped_scan);
+
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 0u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->has_indices());
+}
+
+TEST_F(IndexAdvisorPluginTest, RecordsCachedPlans) {
+  SQLPipelineBuilder{"SELECT * FROM table_a WHERE b = 3"}.create_pipeline().get_result_table();
+
+  IndexAdvisorPlugin::get().record_cached_plans();
+
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 2u);
+  EXPECT_EQ(index_count(SegmentIndexType::Hash, ColumnID{1}), 2u);
+}
+
+TEST_F(IndexAdvisorPluginTest, DroppingIndexesClearsCachedPlans) {
+  auto options = IndexAdvisorPlugin::Options{};
+  options.benefit_decay = 0.0;
+  IndexAdvisorPlugin::get().set_options(options);
+
+  record_scan(ColumnID{0}, PredicateCondition::Equals, 2);
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 2u);
+
+  // The cached plan may scan the indexes that are about to be dropped
+  SQLPipelineBuilder{"SELECT * FROM table_a WHERE a = 2"}.create_pipeline().get_result_table();
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has("SELECT * FROM table_a WHERE a = 2"));
+
+  EXPECT_EQ(IndexAdvisorPlugin::get().tune_indexes(), 2u);
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has("SELECT * FROM table_a WHERE a = 2"));
+
+  const auto result = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a = 2"}.create_pipeline().get_result_table();
+  EXPECT_EQ(result->row_count(), 6u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#include <chrono>
+#include <memory>
+
+#include "base_test.hpp"
+
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class CancellationTokenTest : public BaseTest {};
+
+TEST_F(CancellationTokenTest, IsCancelledByCancelDeadlineAndParent) {
+  auto token = CancellationToken{};
+  EXPECT_FALSE(token.is_cancelled());
+  EXPECT_NO_THROW(token.throw_if_cancelled());
+  token.cancel();
+  EXPECT_TRUE(token.is_cancelled());
+  EXPECT_THROW(token.throw_if_cancelled(), QueryCancelledException);
+
+  const auto expired_token = CancellationToken{std::chrono::steady_clock::now()};
+  EXPECT_TRUE(expired_token.is_cancelled());
+  const auto pending_token = CancellationToken{std::chrono::steady_clock::now() + std::chrono::hours{1}};
+  EXPECT_FALSE(pending_token.is_cancelled());
+
+  const auto parent = std::make_shared<CancellationToken>();
+  const auto child = CancellationToken{std::nullopt, parent};
+  EXPECT_FALSE(child.is_cancelled());
+  parent->cancel();
+  EXPECT_TRUE(child.is_cancelled());
+}
+
+TEST_F(CancellationTokenTest, CancelledTaskDoesNotExecute) {
+  const auto token = std::make_shared<CancellationToken>();
+  token->cancel();
+
+  auto executed = false;
+  const auto task = std::make_shared<JobTask>([&]() { executed = true; });
+  task->set_cancellation_token(token);
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task}),
+               QueryCancelledException);
+
+  EXPECT_FALSE(executed);
+}
+
+TEST_F(CancellationTokenTest, SpawnedTasksInheritToken) {
+  const auto token = std::make_shared<CancellationToken>();
+
+  auto inner_token = std::shared_ptr<const CancellationToken>{};
+  const auto task = std::make_shared<JobTask>([&]() {
+    const auto inner_task = std::make_shared<JobTask>([]() {});
+    CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{inner_task});
+    inner_token = inner_task->cancellation_token();
+  });
+  task->set_cancellation_token(token);
+  CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  EXPECT_EQ(inner_token, token);
+}
+
+TEST_F(CancellationTokenTest, StatementTimeoutCancelsPipeline) {
+  StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl", 2));
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM int_float WHERE a > 1"}
+                          .with_statement_timeout(std::chrono::milliseconds{0})
+                          .create_pipeline();
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+
+  auto unlimited_pipeline = SQLPipelineBuilder{"SELECT * FROM int_float WHERE a > 1"}.create_pipeline();
+  EXPECT_NO_THROW(unlimited_pipeline.get_result_table());
+}
+
+}  // namespace opossum
@@ -1,4 +1,9 @@
+#include <array>
+#include <chrono>
 #include <memory>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -12,6 +17,8 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/scheduler_statistics.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -258,4 +265,319 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, ParkedWorkerIsWokenByPushedTask) {
+  auto queue = std::make_shared<TaskQueue>(NodeID{0});
+  EXPECT_FALSE(queue->has_waiting_workers());
+
+  // The timeout is far longer than the test is expected to take, the waiting thread has to be woken by the push
+  const auto begin = std::chrono::steady_clock::now();
+  auto waiting_thread = std::thread([&]() { queue->wait_for_task(std::chrono::milliseconds{60'000}); });
+
+  while (!queue->has_waiting_workers()) std::this_thread::yield();
+  queue->push(std::make_shared<JobTask>([]() {}), static_cast<uint32_t>(SchedulePriority::Default));
+
+  waiting_thread.join();
+  EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds{30'000});
+  EXPECT_FALSE(queue->has_waiting_workers());
+  EXPECT_NE(queue->pull(), nullptr);
+}
+
+TEST_F(SchedulerTest, TasksAreExecutedWithoutSpinning) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(std::chrono::microseconds{0}));
+
+  // Let the Workers park, then check that they pick up new tasks
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+
+  auto counter = std::atomic_uint{0};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 100; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&counter]() { ++counter; }));
+    tasks.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(tasks);
+  EXPECT_EQ(counter.load(), 100u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, YieldingTaskExecutesHighPriorityTask) {
+  // With a single Worker, the high priority task can only be executed at a yield point of the long task
+  Topology::use_default_topology(1);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto high_priority_task_done = std::atomic_bool{false};
+  const auto high_priority_task =
+      std::make_shared<JobTask>([&]() { high_priority_task_done = true; }, SchedulePriority::High);
+
+  auto long_task_started = std::atomic_bool{false};
+  auto done_while_long_task_executed = false;
+  const auto long_task = std::make_shared<JobTask>([&]() {
+    long_task_started = true;
+
+    // Gives up eventually, so that the test fails instead of hanging if yielding does not work
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (!high_priority_task_done && std::chrono::steady_clock::now() < deadline) {
+      CurrentScheduler::yield();
+    }
+    done_while_long_task_executed = high_priority_task_done;
+  });
+
+  long_task->schedule();
+  while (!long_task_started) std::this_thread::yield();
+  high_priority_task->schedule();
+
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{long_task, high_priority_task});
+  EXPECT_TRUE(done_while_long_task_executed);
+
+  // Outside of Workers, yielding does nothing
+  CurrentScheduler::yield();
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ContinueAfterSubtasks) {
+  const auto run = [&]() {
+    auto subtask_count = std::atomic_uint{0};
+    auto continuation_count = std::atomic_uint{0};
+    auto successor_saw_continuations = std::atomic_bool{false};
+
+    const auto create_subtasks = [&](const size_t count) {
+      auto subtasks = std::vector<std::shared_ptr<AbstractTask>>{};
+      for (auto subtask_id = size_t{0}; subtask_id < count; ++subtask_id) {
+        subtasks.emplace_back(std::make_shared<JobTask>([&]() { ++subtask_count; }));
+      }
+      return subtasks;
+    };
+
+    // The parent continues twice, the second continuation after a subtask spawned by the first one
+    const auto parent = std::make_shared<JobTask>([&]() {
+      CurrentScheduler::continue_after(create_subtasks(3), [&]() {
+        EXPECT_EQ(subtask_count.load(), 3u);
+        ++continuation_count;
+
+        CurrentScheduler::continue_after(create_subtasks(1), [&]() {
+          EXPECT_EQ(subtask_count.load(), 4u);
+          ++continuation_count;
+        });
+      });
+    });
+    const auto successor = std::make_shared<JobTask>([&]() { successor_saw_continuations = continuation_count == 2; });
+    parent->set_as_predecessor_of(successor);
+
+    successor->schedule();
+    parent->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{parent, successor});
+
+    EXPECT_TRUE(parent->is_done());
+    EXPECT_EQ(continuation_count.load(), 2u);
+    EXPECT_TRUE(successor_saw_continuations);
+  };
+
+  // Without a Scheduler, the continuations are executed right away
+  run();
+
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  run();
+
+  // Outside of tasks, the subtasks are waited for
+  auto subtask_done = std::atomic_bool{false};
+  auto continued = false;
+  CurrentScheduler::continue_after({std::make_shared<JobTask>([&]() { subtask_done = true; })},
+                                   [&]() { continued = subtask_done; });
+  EXPECT_TRUE(continued);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ExceptionsAreRethrownWhenWaitingForTasks) {
+  Topology::use_fake_numa_topology(4, 2);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  // The exception does not leave the Worker, and the other tasks are still executed
+  auto executed_count = std::atomic_uint{0};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 10; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, task_id]() {
+      ++executed_count;
+      if (task_id == 5) throw std::logic_error("Task failed");
+    }));
+  }
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(tasks), std::logic_error);
+  EXPECT_EQ(executed_count.load(), 10u);
+  EXPECT_NE(tasks[5]->exception(), nullptr);
+  EXPECT_EQ(tasks[4]->exception(), nullptr);
+
+  // A continuation is skipped if a task it waits for failed, and the suspended task fails instead
+  auto continued = std::atomic_bool{false};
+  const auto parent = std::make_shared<JobTask>([&]() {
+    CurrentScheduler::continue_after({std::make_shared<JobTask>([]() { throw std::logic_error("Subtask failed"); })},
+                                     [&]() { continued = true; });
+  });
+  EXPECT_THROW(CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{parent}),
+               std::logic_error);
+  EXPECT_FALSE(continued);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, TopologyParsesCpuLists) {
+  EXPECT_EQ(Topology::parse_cpu_list("0-3,8,10-11"),
+            std::vector<CpuID>({CpuID{0}, CpuID{1}, CpuID{2}, CpuID{3}, CpuID{8}, CpuID{10}, CpuID{11}}));
+  EXPECT_TRUE(Topology::parse_cpu_list("").empty());
+}
+
+TEST_F(SchedulerTest, OneWorkerPerCore) {
+  Topology::use_default_topology();
+
+  // Cores and cache domains are identified by their lowest CPU
+  auto core_ids = std::unordered_set<CpuID>{};
+  for (const auto& node : Topology::get().nodes()) {
+    for (const auto& cpu : node.cpus) {
+      EXPECT_LE(cpu.core_id, cpu.cpu_id);
+      EXPECT_LE(cpu.cache_domain_id, cpu.cpu_id);
+      core_ids.emplace(cpu.core_id);
+    }
+  }
+
+  const auto scheduler = std::make_shared<NodeQueueScheduler>(NodeQueueScheduler::DEFAULT_SPIN_DURATION,
+                                                              WorkerPlacement::OnePerCore);
+  CurrentScheduler::set(scheduler);
+  EXPECT_EQ(scheduler->workers().size(), core_ids.size());
+
+  auto counter = std::atomic_uint{0};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 100; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(counter.load(), 100u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, SuccessorsContinueOnTheSameWorker) {
+  Topology::use_fake_numa_topology(4, 2);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+
+  // A chain longer than a Worker continues with, so that it is cut at least once
+  constexpr auto CHAIN_LENGTH = size_t{100};
+  auto thread_ids = std::vector<std::thread::id>(CHAIN_LENGTH);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = size_t{0}; task_id < CHAIN_LENGTH; ++task_id) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, task_id]() { thread_ids[task_id] = std::this_thread::get_id(); }));
+    if (task_id > 0) tasks[task_id - 1]->set_as_predecessor_of(tasks[task_id]);
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  // The first successors are executed by the Worker of their predecessor
+  for (auto task_id = size_t{1}; task_id < 10; ++task_id) {
+    EXPECT_EQ(thread_ids[task_id], thread_ids[0]);
+  }
+
+  auto continued_tasks = uint64_t{0};
+  for (const auto& worker_statistics : scheduler->statistics().workers) {
+    continued_tasks += worker_statistics.continued_tasks;
+  }
+  EXPECT_GE(continued_tasks, 9u);
+  EXPECT_LT(continued_tasks, CHAIN_LENGTH - 1);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ActiveWorkerCountChangesAtRuntime) {
+  // The fake topology has fewer Workers on smaller machines
+  if (std::thread::hardware_concurrency() < 8) GTEST_SKIP();
+
+  Topology::use_fake_numa_topology(8, 4);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+  EXPECT_EQ(scheduler->active_worker_count(), 8u);
+
+  auto counter = std::atomic_uint{0};
+  const auto run_tasks = [&]() {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_id = 0; task_id < 100; ++task_id) {
+      tasks.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  };
+
+  // Each of the two nodes keeps an active Worker
+  scheduler->set_active_worker_count(1);
+  EXPECT_EQ(scheduler->active_worker_count(), 2u);
+  run_tasks();
+  EXPECT_EQ(counter.load(), 100u);
+
+  scheduler->set_active_worker_count(5);
+  EXPECT_EQ(scheduler->active_worker_count(), 5u);
+  scheduler->set_active_worker_count(NodeID{1}, 1);
+  EXPECT_EQ(scheduler->active_worker_count(), 4u);
+  run_tasks();
+  EXPECT_EQ(counter.load(), 200u);
+
+  EXPECT_THROW(scheduler->set_active_worker_count(NodeID{0}, 0), std::logic_error);
+  EXPECT_THROW(scheduler->set_active_worker_count(NodeID{0}, 5), std::logic_error);
+
+  scheduler->set_active_worker_count(8);
+  EXPECT_EQ(scheduler->active_worker_count(), 8u);
+  run_tasks();
+  EXPECT_EQ(counter.load(), 300u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, Statistics) {
+  Topology::use_fake_numa_topology(4, 2);
+  const auto scheduler = std::make_shared<NodeQueueScheduler>();
+  CurrentScheduler::set(scheduler);
+  scheduler->start_queue_depth_sampling(std::chrono::milliseconds{1}, 3);
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 20; ++task_id) {
+    const auto priority = task_id % 2 == 0 ? SchedulePriority::Default : SchedulePriority::High;
+    tasks.emplace_back(std::make_shared<JobTask>(
+        []() { std::this_thread::sleep_for(std::chrono::microseconds{100}); }, priority));
+    tasks.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(tasks);
+  std::this_thread::sleep_for(std::chrono::milliseconds{20});
+
+  const auto statistics = scheduler->statistics();
+  ASSERT_EQ(statistics.workers.size(), 4u);
+
+  auto finished_tasks_by_priority = std::array<uint64_t, WorkerStatistics::PRIORITY_COUNT>{};
+  auto successful_steals = uint64_t{0};
+  for (const auto& worker_statistics : statistics.workers) {
+    for (auto priority = size_t{0}; priority < WorkerStatistics::PRIORITY_COUNT; ++priority) {
+      finished_tasks_by_priority[priority] += worker_statistics.finished_tasks_by_priority[priority];
+    }
+    successful_steals += worker_statistics.successful_steals;
+
+    EXPECT_LE(worker_statistics.successful_steals, worker_statistics.steal_attempts);
+    EXPECT_EQ(worker_statistics.wait_times.count(), worker_statistics.execution_times.count());
+    EXPECT_GE(worker_statistics.utilization(), 0.0);
+    EXPECT_LE(worker_statistics.utilization(), 1.0);
+  }
+  EXPECT_EQ(finished_tasks_by_priority[static_cast<size_t>(SchedulePriority::Default)], 10u);
+  EXPECT_EQ(finished_tasks_by_priority[static_cast<size_t>(SchedulePriority::High)], 10u);
+
+  // Each task ran for at least 100us
+  const auto execution_times = statistics.execution_times();
+  EXPECT_EQ(execution_times.count(), 20u);
+  EXPECT_GE(execution_times.percentile(0.0), std::chrono::microseconds{128});
+
+  // Only the latest samples are kept, one depth per node
+  ASSERT_EQ(statistics.queue_depth_samples.size(), 3u);
+  EXPECT_EQ(statistics.queue_depth_samples.back().queue_depths.size(), 2u);
+
+  const auto json = statistics.to_json();
+  EXPECT_EQ(json["workers"].size(), 4u);
+  EXPECT_EQ(json["execution_times"]["count"], 20u);
+
+  CurrentScheduler::get()->finish();
+}
+
 }  // namespace opossum
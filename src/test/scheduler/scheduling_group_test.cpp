@@ -0,0 +1,168 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/scheduling_group.hpp"
+#include "scheduler/task_queue.hpp"
+
+namespace opossum {
+
+class SchedulingGroupTest : public BaseTest {
+ protected:
+  std::shared_ptr<AbstractTask> create_task(const std::shared_ptr<SchedulingGroup>& scheduling_group) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_scheduling_group(scheduling_group);
+    return task;
+  }
+
+  static constexpr auto DEFAULT_PRIORITY = static_cast<uint32_t>(SchedulePriority::Default);
+  static constexpr auto HIGH_PRIORITY = static_cast<uint32_t>(SchedulePriority::High);
+};
+
+TEST_F(SchedulingGroupTest, VirtualTimeIsDividedByWeight) {
+  auto heavy_group = SchedulingGroup{4.0f};
+  auto light_group = SchedulingGroup{};
+
+  heavy_group.add_execution_time(std::chrono::nanoseconds{800});
+  light_group.add_execution_time(std::chrono::nanoseconds{800});
+  EXPECT_EQ(heavy_group.virtual_time(), 200u);
+  EXPECT_EQ(light_group.virtual_time(), 800u);
+
+  // The virtual time is never lowered
+  light_group.advance_virtual_time_to(500u);
+  EXPECT_EQ(light_group.virtual_time(), 800u);
+  light_group.advance_virtual_time_to(1'000u);
+  EXPECT_EQ(light_group.virtual_time(), 1'000u);
+}
+
+TEST_F(SchedulingGroupTest, TaskQueuePullsGroupWithLowestVirtualTimeFirst) {
+  const auto analytical_group = std::make_shared<SchedulingGroup>();
+  const auto transactional_group = std::make_shared<SchedulingGroup>();
+  analytical_group->add_execution_time(std::chrono::nanoseconds{1'000});
+
+  auto queue = TaskQueue{NodeID{0}};
+  EXPECT_FALSE(queue.lowest_queued_virtual_time());
+
+  const auto analytical_task = create_task(analytical_group);
+  const auto analytical_high_priority_task = create_task(analytical_group);
+  const auto transactional_task = create_task(transactional_group);
+  const auto ungrouped_task = create_task(nullptr);
+
+  queue.push(analytical_task, DEFAULT_PRIORITY);
+  queue.push(analytical_high_priority_task, HIGH_PRIORITY);
+  queue.push(transactional_task, DEFAULT_PRIORITY);
+  queue.push(ungrouped_task, DEFAULT_PRIORITY);
+  EXPECT_TRUE(queue.has_grouped_tasks());
+  EXPECT_EQ(*queue.lowest_queued_virtual_time(), 0u);
+
+  // Tasks without a group come first, then the groups in the order of their virtual time. Within a group, the
+  // priorities are kept.
+  EXPECT_EQ(queue.pull(), ungrouped_task);
+  EXPECT_EQ(queue.pull(), transactional_task);
+  EXPECT_EQ(*queue.lowest_queued_virtual_time(), 1'000u);
+  EXPECT_EQ(queue.pull(), analytical_high_priority_task);
+  EXPECT_EQ(queue.pull(), analytical_task);
+  EXPECT_EQ(queue.pull(), nullptr);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_FALSE(queue.has_grouped_tasks());
+}
+
+TEST_F(SchedulingGroupTest, IdleGroupCatchesUpWithVirtualTimeOfQueue) {
+  const auto busy_group = std::make_shared<SchedulingGroup>();
+  const auto idle_group = std::make_shared<SchedulingGroup>();
+  busy_group->add_execution_time(std::chrono::nanoseconds{5'000});
+
+  auto queue = TaskQueue{NodeID{0}};
+  queue.push(create_task(busy_group), DEFAULT_PRIORITY);
+  EXPECT_NE(queue.pull(), nullptr);
+
+  // Without catching up, the idle group would get all Workers until it accumulated as much time as the busy group
+  queue.push(create_task(idle_group), DEFAULT_PRIORITY);
+  EXPECT_EQ(idle_group->virtual_time(), 5'000u);
+}
+
+TEST_F(SchedulingGroupTest, TasksInheritGroupAndAreCharged) {
+  const auto scheduling_group = std::make_shared<SchedulingGroup>();
+
+  auto spawned_task = std::shared_ptr<AbstractTask>{};
+  auto task = std::make_shared<JobTask>([&]() {
+    spawned_task = std::make_shared<JobTask>([]() { std::this_thread::sleep_for(std::chrono::milliseconds{1}); });
+    spawned_task->schedule();
+  });
+  task->set_scheduling_group(scheduling_group);
+  task->schedule();
+
+  ASSERT_TRUE(spawned_task);
+  EXPECT_EQ(spawned_task->scheduling_group(), scheduling_group);
+  EXPECT_GE(scheduling_group->virtual_time(), 1'000'000u);
+
+  // Tasks scheduled outside of a grouped task do not have a group
+  const auto ungrouped_task = std::make_shared<JobTask>([]() {});
+  ungrouped_task->schedule();
+  EXPECT_EQ(ungrouped_task->scheduling_group(), nullptr);
+}
+
+TEST_F(SchedulingGroupTest, TaskQueuePullsPreemptingTasks) {
+  const auto analytical_group = std::make_shared<SchedulingGroup>();
+  const auto transactional_group = std::make_shared<SchedulingGroup>();
+  analytical_group->add_execution_time(std::chrono::nanoseconds{1'000});
+
+  auto queue = TaskQueue{NodeID{0}};
+  queue.push(create_task(analytical_group), DEFAULT_PRIORITY);
+
+  // Tasks of the same group or of groups with a higher virtual time do not preempt
+  EXPECT_EQ(queue.pull_preempting_task(nullptr), nullptr);
+  EXPECT_EQ(queue.pull_preempting_task(analytical_group), nullptr);
+  EXPECT_EQ(queue.pull_preempting_task(transactional_group), nullptr);
+
+  const auto transactional_task = create_task(transactional_group);
+  queue.push(transactional_task, DEFAULT_PRIORITY);
+  EXPECT_EQ(queue.pull_preempting_task(analytical_group), transactional_task);
+
+  // Tasks without a group preempt grouped tasks only
+  const auto ungrouped_task = create_task(nullptr);
+  queue.push(ungrouped_task, DEFAULT_PRIORITY);
+  EXPECT_EQ(queue.pull_preempting_task(nullptr), nullptr);
+  EXPECT_EQ(queue.pull_preempting_task(transactional_group), ungrouped_task);
+
+  // Tasks of High priority preempt all tasks
+  const auto high_priority_task = create_task(nullptr);
+  queue.push(high_priority_task, HIGH_PRIORITY);
+  EXPECT_EQ(queue.pull_preempting_task(nullptr), high_priority_task);
+
+  EXPECT_EQ(queue.pull_preempting_task(transactional_group), nullptr);
+  EXPECT_NE(queue.pull(), nullptr);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(SchedulingGroupTest, AdmissionIsCapped) {
+  const auto scheduling_group = std::make_shared<SchedulingGroup>(1.0f, size_t{1});
+
+  auto second_query_admitted = std::atomic_bool{false};
+  auto second_query = std::thread{};
+  {
+    const SchedulingGroup::ScopedAdmission first_admission(scheduling_group);
+    EXPECT_EQ(scheduling_group->admitted_query_count(), 1u);
+
+    second_query = std::thread([&]() {
+      const SchedulingGroup::ScopedAdmission second_admission(scheduling_group);
+      second_query_admitted = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    EXPECT_FALSE(second_query_admitted);
+  }
+
+  second_query.join();
+  EXPECT_TRUE(second_query_admitted);
+  EXPECT_EQ(scheduling_group->admitted_query_count(), 0u);
+
+  // Without a group, nothing is admitted
+  const SchedulingGroup::ScopedAdmission no_admission(nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  std::vector<std::shared_ptr<AbstractTask>> create_tasks(const size_t count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto index = size_t{0}; index < count; ++index) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, OwnerPopsMostRecentAndThievesStealOldestTask) {
+  WorkStealingDeque deque;
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+
+  const auto tasks = create_tasks(3);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_FALSE(deque.empty());
+
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[1]);
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, Grows) {
+  WorkStealingDeque deque{2};
+
+  const auto tasks = create_tasks(100);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+
+  for (auto index = size_t{0}; index < 50; ++index) {
+    EXPECT_EQ(deque.steal(), tasks[index]);
+  }
+  for (auto index = size_t{99}; index >= 50; --index) {
+    EXPECT_EQ(deque.pop(), tasks[index]);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ReleasesRemainingTasks) {
+  auto task = create_tasks(1)[0];
+  {
+    WorkStealingDeque deque;
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, EachTaskIsObtainedExactlyOnceUnderConcurrentStealing) {
+  constexpr auto task_count = size_t{10'000};
+  constexpr auto thief_count = size_t{3};
+
+  WorkStealingDeque deque{4};
+  const auto tasks = create_tasks(task_count);
+
+  auto obtained_count = std::atomic<size_t>{0};
+  auto obtained = std::vector<std::atomic<size_t>>(task_count);
+  for (auto& count : obtained) count = 0;
+
+  const auto record = [&](const std::shared_ptr<AbstractTask>& task) {
+    const auto index = static_cast<size_t>(std::find(tasks.begin(), tasks.end(), task) - tasks.begin());
+    ++obtained[index];
+    ++obtained_count;
+  };
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = size_t{0}; thief_id < thief_count; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (obtained_count < task_count) {
+        if (const auto task = deque.steal()) record(task);
+      }
+    });
+  }
+
+  // The owner interleaves pushes and pops, while the thieves steal concurrently
+  for (auto index = size_t{0}; index < task_count; ++index) {
+    deque.push(tasks[index]);
+    if (index % 3 == 0) {
+      if (const auto task = deque.pop()) record(task);
+    }
+  }
+  while (obtained_count < task_count) {
+    if (const auto task = deque.pop()) record(task);
+  }
+
+  for (auto& thief : thieves) thief.join();
+
+  for (const auto& count : obtained) {
+    EXPECT_EQ(count.load(), 1u);
+  }
+}
+
+}  // namespace opossum
@@ -8,6 +8,8 @@
 
 #include "storage/prepared_plan.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/copy_server_data_task.hpp"
+#include "tasks/server/copy_server_result_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
@@ -28,6 +30,9 @@ class MockTaskRunner {
                boost::future<std::shared_ptr<const Table>>(std::shared_ptr<ExecuteServerPreparedStatementTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<ExecuteServerQueryTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<LoadServerFileTask>));
+  MOCK_METHOD1(dispatch_server_task, boost::future<uint64_t>(std::shared_ptr<CopyServerDataTask>));
+  MOCK_METHOD1(dispatch_server_task,
+               boost::future<std::unique_ptr<CopyServerResult>>(std::shared_ptr<CopyServerResultTask>));
 };
 
 }  // namespace opossum
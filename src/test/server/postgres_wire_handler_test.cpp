@@ -21,8 +21,7 @@ TEST_F(PostgresWireHandlerTest, HandleQueryPacketEmpty) {
 
 TEST_F(PostgresWireHandlerTest, HandleQueryPacket) {
   ByteBuffer buffer = {'Q', 'u', 'e', 'r', 'y', '\0'};
-  _input_packet.data = buffer;
-  _input_packet.offset = _input_packet.data.cbegin();
+  _input_packet = InputPacket{buffer};
 
   std::string result = postgres_wire_handler.handle_query_packet(_input_packet);
 
@@ -35,8 +34,7 @@ TEST_F(PostgresWireHandlerTest, HandleHeader) {
   uint32_t value = ntohl(100);
   char* chars = reinterpret_cast<char*>(&value);
   buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));
-  _input_packet.data = buffer;
-  _input_packet.offset = _input_packet.data.cbegin();
+  _input_packet = InputPacket{buffer};
 
   auto command_header = PostgresWireHandler::handle_header(_input_packet);
 
@@ -51,11 +49,47 @@ TEST_F(PostgresWireHandlerTest, HandleStartupPackage) {
   char* chars = reinterpret_cast<char*>(&value);
   buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));  // length
   buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));  // version
-  _input_packet.data = buffer;
-  _input_packet.offset = _input_packet.data.cbegin();
+  _input_packet = InputPacket{buffer};
 
-  uint32_t result = postgres_wire_handler.handle_startup_package(_input_packet);
-  ASSERT_EQ(result, 92ul);  // 100 - 2 * sizeof(uint32_t)
+  const auto result = postgres_wire_handler.handle_startup_package(_input_packet);
+  EXPECT_EQ(result.type, StartupPacketType::Startup);
+  EXPECT_EQ(result.payload_length, 92ul);  // 100 - 2 * sizeof(uint32_t)
+}
+
+TEST_F(PostgresWireHandlerTest, HandleCancelRequest) {
+  ByteBuffer buffer = {};
+  const auto append_int32 = [&](uint32_t value) {
+    value = htonl(value);
+    char* chars = reinterpret_cast<char*>(&value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));
+  };
+  append_int32(16);        // length
+  append_int32(80877102);  // CancelRequest code
+  _input_packet = InputPacket{buffer};
+
+  const auto header = postgres_wire_handler.handle_startup_package(_input_packet);
+  EXPECT_EQ(header.type, StartupPacketType::CancelRequest);
+  EXPECT_EQ(header.payload_length, 8ul);
+
+  buffer.clear();
+  append_int32(17);  // process id
+  append_int32(42);  // secret key
+  _input_packet = InputPacket{buffer};
+
+  const auto backend_key_data = postgres_wire_handler.handle_cancel_request_packet(_input_packet);
+  EXPECT_EQ(backend_key_data.process_id, 17u);
+  EXPECT_EQ(backend_key_data.secret_key, 42u);
+}
+
+TEST_F(PostgresWireHandlerTest, HandleStartupPackageContent) {
+  const auto content = std::string{"user\0postgres\0options\0-c statement_timeout=5s\0\0", 47};
+  ByteBuffer buffer(content.begin(), content.end());
+  _input_packet = InputPacket{buffer};
+
+  const auto parameters = postgres_wire_handler.handle_startup_package_content(_input_packet);
+  ASSERT_EQ(parameters.size(), 2u);
+  EXPECT_EQ(parameters.at("user"), "postgres");
+  EXPECT_EQ(parameters.at("options"), "-c statement_timeout=5s");
 }
 
 TEST_F(PostgresWireHandlerTest, WriteString) {
@@ -67,4 +101,69 @@ TEST_F(PostgresWireHandlerTest, WriteString) {
   // string should be terminated
   ASSERT_EQ(_output_packet.data[value.length()], '\0');
 }
+
+TEST_F(PostgresWireHandlerTest, HandleBindPacketWithFormatCodes) {
+  ByteBuffer buffer = {'p', 'o', 'r', 't', 'a', 'l', '\0', 's', 't', 'm', 't', '\0'};
+  const auto append_int16 = [&](uint16_t value) {
+    value = htons(value);
+    char* chars = reinterpret_cast<char*>(&value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint16_t));
+  };
+  const auto append_int32 = [&](uint32_t value) {
+    value = htonl(value);
+    char* chars = reinterpret_cast<char*>(&value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));
+  };
+
+  // Parameters: one text, one binary, and one NULL value
+  append_int16(3);
+  append_int16(0);
+  append_int16(1);
+  append_int16(1);
+  append_int16(3);
+  append_int32(2);
+  buffer.insert(buffer.end(), {'4', '2'});
+  append_int32(4);
+  append_int32(17);
+  append_int32(static_cast<uint32_t>(-1));
+
+  // All result columns in binary format
+  append_int16(1);
+  append_int16(1);
+
+  _input_packet = InputPacket{buffer};
+
+  const auto bind_packet = PostgresWireHandler::handle_bind_packet(_input_packet);
+
+  EXPECT_EQ(bind_packet.destination_portal, "portal");
+  EXPECT_EQ(bind_packet.statement_name, "stmt");
+  ASSERT_EQ(bind_packet.params.size(), 3u);
+  EXPECT_EQ(bind_packet.params[0], AllTypeVariant{std::string{"42"}});
+  EXPECT_EQ(PostgresWireHandler::decode_binary_value(boost::get<std::string>(bind_packet.params[1]), 23),
+            AllTypeVariant{int32_t{17}});
+  EXPECT_TRUE(variant_is_null(bind_packet.params[2]));
+
+  EXPECT_EQ(PostgresWireHandler::format_code(bind_packet.parameter_format_codes, 0), FormatCode::Text);
+  EXPECT_EQ(PostgresWireHandler::format_code(bind_packet.parameter_format_codes, 1), FormatCode::Binary);
+  EXPECT_EQ(PostgresWireHandler::format_code(bind_packet.result_format_codes, 5), FormatCode::Binary);
+  EXPECT_EQ(PostgresWireHandler::format_code({}, 5), FormatCode::Text);
+}
+
+TEST_F(PostgresWireHandlerTest, EncodeBinaryValue) {
+  EXPECT_EQ(PostgresWireHandler::encode_binary_value(int32_t{258}), std::string("\x00\x00\x01\x02", 4));
+  EXPECT_EQ(PostgresWireHandler::encode_binary_value(int64_t{-2}), std::string(7, '\xff') + '\xfe');
+  EXPECT_EQ(PostgresWireHandler::encode_binary_value(1.0f), std::string("\x3f\x80\x00\x00", 4));
+  EXPECT_EQ(PostgresWireHandler::encode_binary_value(std::string{"abc"}), "abc");
+
+  // Values are decoded by the object ID of their type, see pg_type.h
+  EXPECT_EQ(PostgresWireHandler::decode_binary_value(PostgresWireHandler::encode_binary_value(int64_t{-2}), 20),
+            AllTypeVariant{int64_t{-2}});
+  EXPECT_EQ(PostgresWireHandler::decode_binary_value(PostgresWireHandler::encode_binary_value(2.5), 701),
+            AllTypeVariant{2.5});
+  EXPECT_EQ(PostgresWireHandler::decode_binary_value(PostgresWireHandler::encode_binary_value(2.5f), 700),
+            AllTypeVariant{2.5f});
+  EXPECT_EQ(PostgresWireHandler::decode_binary_value(std::string("\xff\xfe", 2), 21), AllTypeVariant{int32_t{-2}});
+  EXPECT_THROW(PostgresWireHandler::decode_binary_value("abc", 0), std::logic_error);
+}
+
 }  // namespace opossum
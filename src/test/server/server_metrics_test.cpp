@@ -0,0 +1,75 @@
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "server/server_metrics.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ServerMetricsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    ServerMetrics::get().reset();
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  void TearDown() override { ServerMetrics::get().reset(); }
+
+  // Returns the value of the row with the given metric and labels, or std::nullopt if there is none
+  static std::optional<double> value(const Table& table, const std::string& metric, const std::string& labels) {
+    for (auto row_id = size_t{0}; row_id < table.row_count(); ++row_id) {
+      if (table.get_value<std::string>(ColumnID{0}, row_id) == metric &&
+          table.get_value<std::string>(ColumnID{1}, row_id) == labels) {
+        return table.get_value<double>(ColumnID{2}, row_id);
+      }
+    }
+    return std::nullopt;
+  }
+};
+
+TEST_F(ServerMetricsTest, RecordsPhasesOfPipeline) {
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT a FROM int_float; SELECT b FROM int_float"}.create_pipeline();
+  sql_pipeline.get_result_table();
+  ServerMetrics::get().record_pipeline(sql_pipeline, std::chrono::microseconds{3});
+
+  const auto table = ServerMetrics::get().to_table();
+
+  const auto select_labels = std::string{R"(type="SELECT",phase=)"};
+  EXPECT_EQ(value(*table, "hyrise_statement_latency_microseconds_count", select_labels + R"("parse")"), 2.0);
+  EXPECT_EQ(value(*table, "hyrise_statement_latency_microseconds_count", select_labels + R"("execute")"), 2.0);
+
+  // Only the result of the last statement is sent. 3us lie in the bucket [2us, 4us).
+  EXPECT_EQ(value(*table, "hyrise_statement_latency_microseconds_count", select_labels + R"("serialize")"), 1.0);
+  EXPECT_EQ(value(*table, "hyrise_statement_latency_microseconds_bucket", select_labels + R"("serialize",le="2")"),
+            0.0);
+  EXPECT_EQ(value(*table, "hyrise_statement_latency_microseconds_bucket", select_labels + R"("serialize",le="4")"),
+            1.0);
+  EXPECT_EQ(value(*table, "hyrise_statement_latency_microseconds_bucket", select_labels + R"("serialize",le="+Inf")"),
+            1.0);
+  EXPECT_FALSE(value(*table, "hyrise_statement_latency_microseconds_bucket", select_labels + R"("serialize",le="8")"));
+
+  EXPECT_EQ(value(*table, "hyrise_statements_total", ""), 2.0);
+  EXPECT_EQ(value(*table, "hyrise_plan_cache_hit_rate", ""), 0.0);
+}
+
+TEST_F(ServerMetricsTest, ReportsSessionsAndTables) {
+  ServerMetrics::get().session_started();
+  ServerMetrics::get().session_started();
+  ServerMetrics::get().session_ended();
+
+  const auto table = ServerMetrics::get().to_table();
+  EXPECT_EQ(value(*table, "hyrise_active_sessions", ""), 1.0);
+
+  const auto memory_usage = StorageManager::get().get_table("int_float")->estimate_memory_usage();
+  EXPECT_EQ(value(*table, "hyrise_table_memory_bytes", R"(table="int_float")"), static_cast<double>(memory_usage));
+
+  ServerMetrics::get().session_ended();
+}
+
+}  // namespace opossum
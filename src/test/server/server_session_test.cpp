@@ -45,8 +45,10 @@ class ServerSessionTest : public BaseTest {
 
   void _configure_startup() {
     ON_CALL(*_connection, receive_startup_packet_header())
-        .WillByDefault(Return(ByMove(boost::make_ready_future(uint32_t(32)))));
-    ON_CALL(*_connection, receive_startup_packet_body(_)).WillByDefault(Return(ByMove(boost::make_ready_future())));
+        .WillByDefault(Return(ByMove(boost::make_ready_future(StartupPacketHeader{StartupPacketType::Startup, 32}))));
+    ON_CALL(*_connection, receive_startup_packet_body(_)).WillByDefault(Invoke([](uint32_t) {
+      return boost::make_ready_future(StartupParameters{});
+    }));
   }
 
   void _configure_termination() {
@@ -60,6 +62,9 @@ class ServerSessionTest : public BaseTest {
     // (i.e. don't throw an exception)
     ON_CALL(*_connection, send_ssl_denied()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
     ON_CALL(*_connection, send_auth()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
+    ON_CALL(*_connection, send_backend_key_data(_)).WillByDefault(Invoke([](const BackendKeyData&) {
+      return boost::make_ready_future();
+    }));
     ON_CALL(*_connection, send_parameter_status(_, _)).WillByDefault(Invoke([](const std::string&, const std::string&) {
       return boost::make_ready_future();
     }));
@@ -82,6 +87,16 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
       return boost::make_ready_future();
     }));
+    ON_CALL(*_connection, flush()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
+    ON_CALL(*_connection, send_copy_in_response(_, _)).WillByDefault(Invoke([](FormatCode, size_t) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_out_response(_, _)).WillByDefault(Invoke([](FormatCode, size_t) {
+      return boost::make_ready_future();
+    }));
+    ON_CALL(*_connection, send_copy_data(_)).WillByDefault(Invoke([](const std::string&) {
+      return boost::make_ready_future();
+    }));
   }
 
   std::shared_ptr<SQLPipeline> _create_working_sql_pipeline() {
@@ -98,7 +113,7 @@ class ServerSessionTest : public BaseTest {
 
 TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Use this magic value to check if the session performs the correct calls
-  uint32_t startup_packet_header_length(42);
+  const auto startup_packet_header = StartupPacketHeader{StartupPacketType::Startup, 42};
 
   // This tells googlemock to check that the calls to the session are being made
   // in the same order that we specify below
@@ -107,14 +122,16 @@ TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Override the default mock implementation defined in _configure_startup by returning the magic value
   // as the header length.
   EXPECT_CALL(*_connection, receive_startup_packet_header())
-      .WillOnce(Return(ByMove(boost::make_ready_future(startup_packet_header_length))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(startup_packet_header))));
 
   // Make sure receive_startup_packet_body is called with the magic value defined above
-  EXPECT_CALL(*_connection, receive_startup_packet_body(startup_packet_header_length));
+  EXPECT_CALL(*_connection, receive_startup_packet_body(startup_packet_header.payload_length));
 
-  // Expect that the session sends out an authentication response and an initial ReadyForQuery
+  // Expect that the session sends out an authentication response, the key for CancelRequests, and an initial
+  // ReadyForQuery
   EXPECT_CALL(*_connection, send_auth());
   EXPECT_CALL(*_connection, send_parameter_status(_, _)).Times(2);
+  EXPECT_CALL(*_connection, send_backend_key_data(_));
   EXPECT_CALL(*_connection, send_ready_for_query());
 
   // Actually run the session: googlemock will record which Connection methods are called in which order
@@ -130,19 +147,18 @@ TEST_F(ServerSessionTest, SessionHandlesConnectionErrorsDuringStartup) {
 
   auto exception = std::logic_error("Some connection problem");
   EXPECT_CALL(*_connection, receive_startup_packet_body(_))
-      .WillOnce(Return(ByMove(boost::make_exceptional_future<void>(boost::copy_exception(exception)))));
+      .WillOnce(Return(ByMove(boost::make_exceptional_future<StartupParameters>(boost::copy_exception(exception)))));
 
   EXPECT_NO_THROW(_session->start().wait());
 }
 
 TEST_F(ServerSessionTest, SessionDeniesSslRequestDuringStartup) {
-  // 0 is what the connection reports as the header size when it receives an SSL request
-  uint32_t ssl_startup_packet_header_length(0);
+  const auto ssl_startup_packet_header = StartupPacketHeader{StartupPacketType::SslRequest, 0};
 
   InSequence s;
 
   EXPECT_CALL(*_connection, receive_startup_packet_header())
-      .WillOnce(Return(ByMove(boost::make_ready_future(ssl_startup_packet_header_length))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(ssl_startup_packet_header))));
   EXPECT_CALL(*_connection, send_ssl_denied());
 
   EXPECT_CALL(*_connection, receive_startup_packet_header());
@@ -155,6 +171,43 @@ TEST_F(ServerSessionTest, SessionDeniesSslRequestDuringStartup) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionCancelsQueryOnCancelRequest) {
+  // The query of another session, which the CancelRequest refers to
+  const auto backend_key_data = QueryCancellationRegistry::get().register_session();
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  QueryCancellationRegistry::get().set_current_query(backend_key_data, cancellation_token);
+
+  InSequence s;
+
+  EXPECT_CALL(*_connection, receive_startup_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(StartupPacketHeader{StartupPacketType::CancelRequest, 8}))));
+  EXPECT_CALL(*_connection, receive_cancel_request_body(8))
+      .WillOnce(Return(ByMove(boost::make_ready_future(backend_key_data))));
+
+  // The connection of a CancelRequest is closed without a response
+  EXPECT_CALL(*_connection, send_auth()).Times(0);
+  EXPECT_CALL(*_connection, receive_packet_header()).Times(0);
+
+  _session->start().wait();
+
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  QueryCancellationRegistry::get().unregister_session(backend_key_data);
+}
+
+TEST_F(ServerSessionTest, CancelRequestNeedsSecretKey) {
+  const auto backend_key_data = QueryCancellationRegistry::get().register_session();
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  QueryCancellationRegistry::get().set_current_query(backend_key_data, cancellation_token);
+
+  const auto wrong_key = BackendKeyData{backend_key_data.process_id, backend_key_data.secret_key + 1};
+  EXPECT_FALSE(QueryCancellationRegistry::get().cancel(wrong_key));
+  EXPECT_FALSE(cancellation_token->is_cancelled());
+
+  EXPECT_TRUE(QueryCancellationRegistry::get().cancel(backend_key_data));
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  QueryCancellationRegistry::get().unregister_session(backend_key_data);
+}
+
 TEST_F(ServerSessionTest, SessionShutsDownOnTerminationPacket) {
   InSequence s;
 
@@ -290,7 +343,7 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
       .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
 
   EXPECT_CALL(*_connection, receive_execute_packet_body(42))
-      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("")))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(ExecutePacket{"", 0}))));
 
   // The session executes the SQLPipeline using another scheduled task
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
@@ -316,6 +369,69 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionSuspendsPortalAtExecuteRowLimit) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader parse_request{NetworkMessageType::ParseCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+
+  ParsePacket parse_packet = {"", "SELECT * FROM foo;"};
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+
+  auto sql_pipeline = _create_working_sql_pipeline();
+  auto parse_server_prepared_plan_result =
+      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket bind_packet = {"", "", {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  const auto placeholder_plan = sql_pipeline->get_physical_plans().front();
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<BindServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(placeholder_plan->deep_copy()))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::BindComplete));
+
+  // The first Execute fetches two of the three rows and suspends the portal
+  RequestHeader execute_request{NetworkMessageType::ExecuteCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+
+  EXPECT_CALL(*_connection, receive_execute_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(ExecutePacket{"", 2}))));
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table()))));
+
+  EXPECT_CALL(*_connection, send_row_description(_));
+  EXPECT_CALL(*_connection, send_data_row(_)).Times(2);
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::PortalSuspended));
+
+  // The second Execute sends the remaining row without executing the plan again
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+
+  EXPECT_CALL(*_connection, receive_execute_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(ExecutePacket{"", 2}))));
+
+  EXPECT_CALL(*_connection, send_data_row(_));
+  EXPECT_CALL(*_connection, send_command_complete("SELECT 3"));
+
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionHandlesLoadTableRequestInSimpleQueryCommand) {
   InSequence s;
 
@@ -343,6 +459,92 @@ TEST_F(ServerSessionTest, SessionHandlesLoadTableRequestInSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionHandlesCopyFromStdin) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY foo FROM STDIN WITH (FORMAT csv);")))));
+
+  // The CreatePipelineTask detects the COPY command
+  _create_working_sql_pipeline();
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->copy_from_stdin = CopyFromStdin{"foo", CopyFormat::Csv};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  // The session asks the client for the data of the table's single column
+  EXPECT_CALL(*_connection, send_copy_in_response(FormatCode::Text, 1u));
+
+  // The client sends the data in two CopyData messages, followed by CopyDone
+  RequestHeader copy_data_request{NetworkMessageType::CopyData, 4};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_data_request))));
+  EXPECT_CALL(*_connection, receive_copy_data_packet_body(4))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("1\n2\n")))));
+
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_data_request))));
+  EXPECT_CALL(*_connection, receive_copy_data_packet_body(4))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("3\n")))));
+
+  RequestHeader copy_done_request{NetworkMessageType::CopyDone, 0};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(copy_done_request))));
+  EXPECT_CALL(*_connection, receive_copy_done_packet_body(0)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
+  // The session inserts the data using a CopyServerDataTask
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CopyServerDataTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(uint64_t{3}))));
+
+  EXPECT_CALL(*_connection, send_command_complete("COPY 3"));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionHandlesCopyToStdout) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("COPY foo TO STDOUT (FORMAT arrow);")))));
+
+  // The CreatePipelineTask detects the COPY command
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->copy_to_stdout = CopyToStdout{"foo", ""};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  // The CopyServerResultTask writes the Arrow stream, whose messages are sent one by one
+  auto copy_server_result = std::make_unique<CopyServerResult>();
+  copy_server_result->column_count = 2;
+  copy_server_result->row_count = 3;
+  copy_server_result->messages = {"schema", "batch", "end"};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CopyServerResultTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(copy_server_result)))));
+
+  EXPECT_CALL(*_connection, send_copy_out_response(FormatCode::Binary, 2u));
+  EXPECT_CALL(*_connection, send_copy_data("schema"));
+  EXPECT_CALL(*_connection, send_copy_data("batch"));
+  EXPECT_CALL(*_connection, send_copy_data("end"));
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::CopyDone));
+  EXPECT_CALL(*_connection, send_command_complete("COPY 3"));
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   InSequence s;
 
@@ -372,7 +574,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   EXPECT_CALL(*_connection,
               send_error("Named prepared statements must be explicitly closed before they can be redefined."));
 
-  EXPECT_CALL(*_connection, send_ready_for_query());
+  // The ReadyForQuery is only sent for the Sync that ends the failed pipeline
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
@@ -392,7 +594,7 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenBindingUnknownNamedStatement) {
 
   EXPECT_CALL(*_connection, send_error("The specified statement does not exist."));
 
-  EXPECT_CALL(*_connection, send_ready_for_query());
+  // The ReadyForQuery is only sent for the Sync that ends the failed pipeline
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
@@ -442,7 +644,62 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedPortal) {
 
   EXPECT_CALL(*_connection, send_error("Named portals must be explicitly closed before they can be redefined."));
 
+  // The ReadyForQuery is only sent for the Sync that ends the failed pipeline
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionSkipsPipelinedMessagesAfterErrorUntilSync) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  // Bind fails because the statement does not exist
+  RequestHeader bind_request{NetworkMessageType::BindCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(bind_request))));
+
+  BindPacket bind_packet = {"my_named_statement", "", {}};
+  EXPECT_CALL(*_connection, receive_bind_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(bind_packet))));
+
+  EXPECT_CALL(*_connection, send_error("The specified statement does not exist."));
+
+  // The Execute that the client sent along with the Bind is read, but not executed
+  RequestHeader execute_request{NetworkMessageType::ExecuteCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(execute_request))));
+
+  EXPECT_CALL(*_connection, receive_execute_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(ExecutePacket{"", 0}))));
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>())).Times(0);
+
+  // The Sync ends the pipeline
+  RequestHeader sync_request{NetworkMessageType::SyncCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(sync_request))));
+
+  EXPECT_CALL(*_connection, receive_sync_packet_body(42)).WillOnce(Return(ByMove(boost::make_ready_future())));
+
   EXPECT_CALL(*_connection, send_ready_for_query());
+
+  // Session accepts the next query
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
+TEST_F(ServerSessionTest, SessionFlushesResponsesOnFlushCommand) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader flush_request{NetworkMessageType::FlushCommand, 4};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(flush_request))));
+
+  EXPECT_CALL(*_connection, receive_flush_packet_body(4)).WillOnce(Return(ByMove(boost::make_ready_future())));
+  EXPECT_CALL(*_connection, flush());
+
   EXPECT_CALL(*_connection, receive_packet_header());
 
   _session->start().wait();
@@ -0,0 +1,103 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/explain.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class ExplainTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    SQLLogicalPlanCache::get().clear();
+    SQLPhysicalPlanCache::get().clear();
+  }
+
+  // Returns the row of the operator column whose description starts with @param name, ignoring the indentation
+  std::optional<size_t> find_operator(const Table& table, const std::string& name) {
+    for (auto row_id = size_t{0}; row_id < table.row_count(); ++row_id) {
+      const auto description = table.get_value<std::string>(ColumnID{0}, row_id);
+      if (description.find_first_not_of(' ') == description.find(name)) return row_id;
+    }
+    return std::nullopt;
+  }
+
+  // The explain table is small enough for a single chunk
+  AllTypeVariant get_variant(const Table& table, const ColumnID column_id, const size_t row_id) {
+    return (*table.get_chunk(ChunkID{0})->get_segment(column_id))[static_cast<ChunkOffset>(row_id)];
+  }
+};
+
+TEST_F(ExplainTest, StripExplainPrefix) {
+  EXPECT_EQ(strip_explain_prefix("SELECT * FROM t"), std::make_pair(ExplainMode::None, std::string{"SELECT * FROM t"}));
+  EXPECT_EQ(strip_explain_prefix("EXPLAIN SELECT * FROM t"),
+            std::make_pair(ExplainMode::Plan, std::string{"SELECT * FROM t"}));
+  EXPECT_EQ(strip_explain_prefix("  explain\nanalyze  SELECT * FROM t;"),
+            std::make_pair(ExplainMode::Analyze, std::string{"SELECT * FROM t;"}));
+
+  // EXPLAIN has to be a keyword of its own
+  EXPECT_EQ(strip_explain_prefix("SELECT * FROM explained").first, ExplainMode::None);
+  EXPECT_EQ(strip_explain_prefix("EXPLAINED").first, ExplainMode::None);
+}
+
+TEST_F(ExplainTest, Explain) {
+  auto pipeline = SQLPipelineBuilder{"EXPLAIN SELECT a FROM table_a WHERE a > 200"}.create_pipeline();
+  EXPECT_EQ(pipeline.explain_mode(), ExplainMode::Plan);
+
+  const auto table = pipeline.get_result_table();
+  ASSERT_TRUE(table);
+  EXPECT_EQ(table->column_names(), (std::vector<std::string>{"operator", "estimated_rows", "actual_rows", "walltime_ns",
+                                                             "chunks_processed", "chunks_skipped"}));
+
+  // The root is described first, the inputs are indented below their outputs
+  EXPECT_EQ(table->get_value<std::string>(ColumnID{0}, 0).find("Projection"), 0u);
+  const auto get_table_row = find_operator(*table, "GetTable");
+  ASSERT_TRUE(get_table_row);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{1}, *get_table_row), 3);
+
+  // The statement was not executed
+  for (auto column_id = ColumnID{2}; column_id < table->column_count(); ++column_id) {
+    EXPECT_TRUE(variant_is_null(get_variant(*table, column_id, *get_table_row)));
+  }
+  EXPECT_EQ(pipeline.metrics().statement_metrics.front()->execution_time_nanos.count(), 0);
+}
+
+TEST_F(ExplainTest, ExplainAnalyze) {
+  auto pipeline = SQLPipelineBuilder{"EXPLAIN ANALYZE SELECT a FROM table_a WHERE a > 200"}.create_pipeline();
+  EXPECT_EQ(pipeline.explain_mode(), ExplainMode::Analyze);
+
+  const auto table = pipeline.get_result_table();
+  ASSERT_TRUE(table);
+
+  const auto table_scan_row = find_operator(*table, "TableScan");
+  ASSERT_TRUE(table_scan_row);
+  EXPECT_FALSE(variant_is_null(get_variant(*table, ColumnID{1}, *table_scan_row)));
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{2}, *table_scan_row), 2);
+  EXPECT_GT(table->get_value<int64_t>(ColumnID{3}, *table_scan_row), 0);
+  EXPECT_EQ(table->get_value<int64_t>(ColumnID{4}, *table_scan_row) +
+                table->get_value<int64_t>(ColumnID{5}, *table_scan_row),
+            2);
+}
+
+TEST_F(ExplainTest, ExplainAnalyzeExecutesStatement) {
+  SQLPipelineBuilder{"EXPLAIN ANALYZE DELETE FROM table_a WHERE a > 200"}.create_pipeline().get_result_table();
+
+  const auto table = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline().get_result_table();
+  EXPECT_EQ(table->row_count(), 1u);
+}
+
+TEST_F(ExplainTest, ExplainSingleStatementOnly) {
+  EXPECT_THROW(SQLPipelineBuilder{"EXPLAIN SELECT * FROM table_a; SELECT * FROM table_a"}.create_pipeline(),
+               InvalidInputException);
+}
+
+}  // namespace opossum
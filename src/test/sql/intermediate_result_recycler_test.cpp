@@ -0,0 +1,108 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "sql/intermediate_result_recycler.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class IntermediateResultRecyclerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_a = load_table("resources/test_data/tbl/int_float.tbl");
+    StorageManager::get().add_table("table_a", _table_a);
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_float2.tbl"));
+
+    _result_a = load_table("resources/test_data/tbl/int.tbl");
+    _result_b = load_table("resources/test_data/tbl/int_float.tbl");
+
+    IntermediateResultRecycler::get().set_memory_budget(1'000'000'000);
+  }
+
+  // Each call creates new nodes, as for a new query
+  static std::shared_ptr<AbstractLQPNode> join_lqp(const bool validate = true) {
+    std::shared_ptr<AbstractLQPNode> input_a = StoredTableNode::make("table_a");
+    std::shared_ptr<AbstractLQPNode> input_b = StoredTableNode::make("table_b");
+    const auto column_a = input_a->column_expressions()[0];
+    const auto column_b = input_b->column_expressions()[0];
+    if (validate) {
+      input_a = ValidateNode::make(input_a);
+      input_b = ValidateNode::make(input_b);
+    }
+    return JoinNode::make(JoinMode::Inner, equals_(column_a, column_b), input_a, input_b);
+  }
+
+  std::shared_ptr<Table> _table_a, _result_a, _result_b;
+};
+
+TEST_F(IntermediateResultRecyclerTest, IsRecyclable) {
+  EXPECT_TRUE(IntermediateResultRecycler::is_recyclable(join_lqp()));
+
+  // Without Validates, the result would depend on uncommitted rows
+  EXPECT_FALSE(IntermediateResultRecycler::is_recyclable(join_lqp(false)));
+
+  // Only joins and aggregates are kept
+  const auto stored_table_node = StoredTableNode::make("table_a");
+  const auto predicate_node = PredicateNode::make(greater_than_(stored_table_node->column_expressions()[0], 5),
+                                                  ValidateNode::make(stored_table_node));
+  EXPECT_FALSE(IntermediateResultRecycler::is_recyclable(predicate_node));
+}
+
+TEST_F(IntermediateResultRecyclerTest, RecyclesResultOfEqualSubplan) {
+  auto& recycler = IntermediateResultRecycler::get();
+  const auto snapshot_commit_id = TransactionManager::get().last_commit_id();
+
+  const auto subplan = IntermediateResultRecycler::capture_subplan(join_lqp());
+  EXPECT_EQ(recycler.try_get(subplan, snapshot_commit_id), nullptr);
+
+  recycler.offer(subplan, _result_a, 10.0, snapshot_commit_id);
+  EXPECT_EQ(recycler.size(), 1u);
+
+  const auto equal_subplan = IntermediateResultRecycler::capture_subplan(join_lqp());
+  EXPECT_EQ(equal_subplan.key, subplan.key);
+  EXPECT_EQ(recycler.try_get(equal_subplan, snapshot_commit_id), _result_a);
+
+  // A commit to one of the tables changes the key of the subplan and invalidates the result
+  _table_a->register_commit(snapshot_commit_id + 1);
+  const auto changed_subplan = IntermediateResultRecycler::capture_subplan(join_lqp());
+  EXPECT_NE(changed_subplan.key, subplan.key);
+  EXPECT_EQ(recycler.try_get(changed_subplan, snapshot_commit_id + 1), nullptr);
+  EXPECT_EQ(recycler.try_get(subplan, snapshot_commit_id + 1), nullptr);
+}
+
+TEST_F(IntermediateResultRecyclerTest, EvictsWithinMemoryBudget) {
+  auto& recycler = IntermediateResultRecycler::get();
+  const auto snapshot_commit_id = TransactionManager::get().last_commit_id();
+
+  const auto subplan_a = IntermediateResultRecycler::capture_subplan(join_lqp());
+  auto subplan_b = IntermediateResultRecycler::capture_subplan(join_lqp());
+  ++subplan_b.key;
+
+  // Only one of the results fits into the budget. The one that is cheaper to recompute is evicted.
+  recycler.set_memory_budget(_result_b->estimate_memory_usage() + 1);
+  recycler.offer(subplan_a, _result_a, 1.0, snapshot_commit_id);
+  recycler.offer(subplan_b, _result_b, 1'000'000.0, snapshot_commit_id);
+  EXPECT_EQ(recycler.size(), 1u);
+  EXPECT_LE(recycler.memory_usage(), recycler.memory_budget());
+  EXPECT_EQ(recycler.try_get(subplan_a, snapshot_commit_id), nullptr);
+  EXPECT_EQ(recycler.try_get(subplan_b, snapshot_commit_id), _result_b);
+
+  // Results larger than the budget are not kept
+  recycler.set_memory_budget(1);
+  EXPECT_EQ(recycler.size(), 0u);
+  recycler.offer(subplan_a, _result_a, 1.0, snapshot_commit_id);
+  EXPECT_EQ(recycler.size(), 0u);
+  EXPECT_EQ(recycler.memory_usage(), 0u);
+}
+
+}  // namespace opossum
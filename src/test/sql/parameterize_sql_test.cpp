@@ -0,0 +1,72 @@
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "SQLParser.h"
+#include "expression/expression_functional.hpp"
+#include "sql/parameterize_sql.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class ParameterizeSQLTest : public BaseTest {
+ protected:
+  bool placeholders_are_scan_values(const std::string& sql, const size_t placeholder_count) {
+    hsql::SQLParserResult parsed_sql;
+    hsql::SQLParser::parse(sql, &parsed_sql);
+    return opossum::placeholders_are_scan_values(parsed_sql, placeholder_count);
+  }
+};
+
+TEST_F(ParameterizeSQLTest, ReplacesLiterals) {
+  const auto parameterized_sql =
+      parameterize_sql("SELECT * FROM t WHERE a = 5 AND b < 'it''s' AND c BETWEEN 2.5 AND 3000000000");
+  ASSERT_TRUE(parameterized_sql);
+
+  EXPECT_EQ(parameterized_sql->sql, "SELECT * FROM t WHERE a = ? AND b < ? AND c BETWEEN ? AND ?");
+  ASSERT_EQ(parameterized_sql->values.size(), 4u);
+  EXPECT_EQ(*parameterized_sql->values[0], *value_(int32_t{5}));
+  EXPECT_EQ(*parameterized_sql->values[1], *value_(std::string{"it's"}));
+  EXPECT_EQ(*parameterized_sql->values[2], *value_(2.5));
+  EXPECT_EQ(*parameterized_sql->values[3], *value_(int64_t{3000000000}));
+}
+
+TEST_F(ParameterizeSQLTest, NegativeNumbers) {
+  const auto parameterized_sql = parameterize_sql("SELECT a-1 FROM t WHERE a = -3 AND b IN (-1, 2)");
+  ASSERT_TRUE(parameterized_sql);
+
+  EXPECT_EQ(parameterized_sql->sql, "SELECT a-? FROM t WHERE a = ? AND b IN (?, ?)");
+  ASSERT_EQ(parameterized_sql->values.size(), 4u);
+  EXPECT_EQ(*parameterized_sql->values[0], *value_(int32_t{1}));
+  EXPECT_EQ(*parameterized_sql->values[1], *value_(int32_t{-3}));
+  EXPECT_EQ(*parameterized_sql->values[2], *value_(int32_t{-1}));
+}
+
+TEST_F(ParameterizeSQLTest, KeepsSyntacticLiterals) {
+  const auto parameterized_sql = parameterize_sql("SELECT \"5\" FROM t WHERE a = 5 LIMIT 10 -- 7");
+  ASSERT_TRUE(parameterized_sql);
+
+  EXPECT_EQ(parameterized_sql->sql, "SELECT \"5\" FROM t WHERE a = ? LIMIT 10 ");
+  EXPECT_EQ(parameterized_sql->values.size(), 1u);
+}
+
+TEST_F(ParameterizeSQLTest, NotParameterizable) {
+  EXPECT_FALSE(parameterize_sql("SELECT * FROM t"));
+  EXPECT_FALSE(parameterize_sql("SELECT * FROM t WHERE a = ? AND b = 5"));
+  EXPECT_FALSE(parameterize_sql("SELECT * FROM t WHERE a = 'x"));
+  EXPECT_FALSE(parameterize_sql("SELECT * FROM t WHERE a = 0x1F"));
+}
+
+TEST_F(ParameterizeSQLTest, PlaceholdersAreScanValues) {
+  EXPECT_TRUE(placeholders_are_scan_values("SELECT * FROM t WHERE a = ? AND (? < b OR c IN (?, ?))", 4));
+  EXPECT_TRUE(placeholders_are_scan_values("SELECT * FROM t WHERE a IN (SELECT b FROM u WHERE c = ?)", 1));
+
+  EXPECT_FALSE(placeholders_are_scan_values("SELECT a + ? FROM t WHERE a = ?", 2));
+  EXPECT_FALSE(placeholders_are_scan_values("SELECT * FROM t WHERE a + ? = b", 1));
+  EXPECT_FALSE(placeholders_are_scan_values("SELECT * FROM t WHERE ? = ?", 2));
+  EXPECT_FALSE(placeholders_are_scan_values("INSERT INTO t VALUES (?)", 1));
+}
+
+}  // namespace opossum
@@ -1,3 +1,4 @@
+#include <chrono>
 #include <memory>
 #include <string>
 #include <utility>
@@ -8,18 +9,24 @@
 #include "gtest/gtest.h"
 
 #include "cache/cache.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "logical_query_plan/join_node.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/scheduling_group.hpp"
 #include "scheduler/topology.hpp"
+#include "sql/intermediate_result_recycler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "storage/storage_manager.hpp"
+#include "utils/tracking_memory_resource.hpp"
 
 namespace {
 // This function is a slightly hacky way to check whether an LQP was optimized. This relies on JoinDetectionRule and
@@ -454,6 +461,17 @@ TEST_F(SQLPipelineStatementTest, GetResultTable) {
   EXPECT_TABLE_EQ_UNORDERED(table, _table_a)
 }
 
+TEST_F(SQLPipelineStatementTest, GetResultTableUsesReadOnlyTransactionForSelect) {
+  auto select_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+  select_pipeline.get_result_table();
+  EXPECT_TRUE(select_pipeline.transaction_context()->is_read_only());
+  EXPECT_EQ(select_pipeline.transaction_context()->phase(), TransactionPhase::Committed);
+
+  auto insert_pipeline = SQLPipelineBuilder{"INSERT INTO table_a VALUES (11, 11.11)"}.create_pipeline_statement();
+  insert_pipeline.get_result_table();
+  EXPECT_FALSE(insert_pipeline.transaction_context()->is_read_only());
+}
+
 TEST_F(SQLPipelineStatementTest, GetResultTableTwice) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
 
@@ -508,6 +526,86 @@ TEST_F(SQLPipelineStatementTest, GetResultTableNoMVCC) {
   EXPECT_EQ(sql_pipeline.transaction_context(), nullptr);
 }
 
+TEST_F(SQLPipelineStatementTest, GetResultTableWithQueryArena) {
+  auto result_table = std::shared_ptr<const Table>{};
+  {
+    auto sql_pipeline = SQLPipelineBuilder{_join_query}.enable_query_arena().create_pipeline_statement();
+    result_table = sql_pipeline.get_result_table();
+  }
+
+  // The PosLists of the result were allocated from the arena, which the result table keeps alive
+  EXPECT_TABLE_EQ_UNORDERED(result_table, _join_result);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithMemoryLimit) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline_statement();
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _join_result);
+
+  // The PosLists and hash tables of the intermediate results are counted
+  const auto peak_memory_usage_bytes = sql_pipeline.metrics()->peak_memory_usage_bytes;
+  EXPECT_GT(peak_memory_usage_bytes, 0u);
+
+  // The query fails cleanly once it exceeds the limit, with and without a Scheduler
+  auto limited_sql_pipeline =
+      SQLPipelineBuilder{_join_query}.with_memory_limit(peak_memory_usage_bytes / 2).create_pipeline_statement();
+  EXPECT_THROW(limited_sql_pipeline.get_result_table(), MemoryLimitExceededException);
+  EXPECT_TRUE(limited_sql_pipeline.transaction_context()->aborted());
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto scheduled_sql_pipeline =
+      SQLPipelineBuilder{_join_query}.with_memory_limit(size_t{1}).create_pipeline_statement();
+  EXPECT_THROW(scheduled_sql_pipeline.get_result_table(), MemoryLimitExceededException);
+  for (const auto& task : scheduled_sql_pipeline.get_tasks()) {
+    EXPECT_TRUE(task->is_done());
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithConflictRetries) {
+  // Another transaction holds the lock on the row and does not finish while the statement is executed
+  TransactionManager::get().set_lock_wait_timeout(std::chrono::microseconds{0});
+  const auto holder_context = TransactionManager::get().new_transaction_context();
+  auto holder_sql_pipeline = SQLPipelineBuilder{"DELETE FROM table_a WHERE a = 12345"}
+                                 .with_transaction_context(holder_context)
+                                 .create_pipeline_statement();
+  holder_sql_pipeline.get_result_table();
+  ASSERT_FALSE(holder_context->aborted());
+
+  // The statement fails once it has run out of retries, each in a new transaction
+  const auto update_query = std::string{"UPDATE table_a SET b = 1.0 WHERE a = 12345"};
+  auto sql_pipeline = SQLPipelineBuilder{update_query}.with_conflict_retries(2).create_pipeline_statement();
+  sql_pipeline.get_result_table();
+  EXPECT_TRUE(sql_pipeline.transaction_context()->aborted());
+
+  const auto statistics = TransactionManager::get().write_conflict_statistics();
+  EXPECT_EQ(statistics.conflicts, 3u);
+  EXPECT_EQ(statistics.statement_retries, 2u);
+
+  // Once the lock is released, the statement succeeds right away
+  holder_context->rollback();
+  auto retried_sql_pipeline = SQLPipelineBuilder{update_query}.with_conflict_retries(2).create_pipeline_statement();
+  retried_sql_pipeline.get_result_table();
+  EXPECT_EQ(retried_sql_pipeline.transaction_context()->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(TransactionManager::get().write_conflict_statistics().statement_retries, 2u);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithSchedulingGroup) {
+  const auto scheduling_group = std::make_shared<SchedulingGroup>(1.0f, size_t{1});
+  auto sql_pipeline =
+      SQLPipelineBuilder{_join_query}.with_scheduling_group(scheduling_group).create_pipeline_statement();
+  EXPECT_TABLE_EQ_UNORDERED(sql_pipeline.get_result_table(), _join_result);
+
+  // The group was charged with the execution of the tasks and the query is no longer admitted
+  for (const auto& task : sql_pipeline.get_tasks()) {
+    EXPECT_EQ(task->scheduling_group(), scheduling_group);
+  }
+  EXPECT_GT(scheduling_group->virtual_time(), 0u);
+  EXPECT_EQ(scheduling_group->admitted_query_count(), 0u);
+}
+
 TEST_F(SQLPipelineStatementTest, GetTimes) {
   const auto& cache = SQLPhysicalPlanCache::get();
   EXPECT_EQ(cache.size(), 0u);
@@ -555,6 +653,111 @@ TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   EXPECT_TRUE(cache.has(_select_query_a));
 }
 
+TEST_F(SQLPipelineStatementTest, ParameterizedPlanCache) {
+  auto first_statement = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1000"}
+                             .enable_parameterized_plan_cache()
+                             .create_pipeline_statement();
+  EXPECT_EQ(first_statement.get_result_table()->row_count(), 2u);
+  EXPECT_FALSE(first_statement.metrics()->parameterized_plan_cache_hit);
+
+  auto second_statement = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1234"}
+                              .enable_parameterized_plan_cache()
+                              .create_pipeline_statement();
+  const auto result = second_statement.get_result_table();
+  EXPECT_TRUE(second_statement.metrics()->parameterized_plan_cache_hit);
+
+  auto expected_result = std::make_shared<Table>(_int_float_column_definitions, TableType::Data);
+  expected_result->append({12345, 458.7f});
+  EXPECT_TABLE_EQ_UNORDERED(result, expected_result);
+
+  // The plans are only cached under the parameterized SQL
+  EXPECT_EQ(SQLPhysicalPlanCache::get().size(), 0u);
+  EXPECT_EQ(SQLParameterizedPlanCache::get().size(), 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, ResultCache) {
+  const auto query = std::string{"SELECT * FROM table_a WHERE a > 1000"};
+
+  auto first_statement = SQLPipelineBuilder{query}.enable_result_cache().create_pipeline_statement();
+  const auto first_result = first_statement.get_result_table();
+  EXPECT_EQ(first_result->row_count(), 2u);
+  EXPECT_FALSE(first_statement.metrics()->result_cache_hit);
+
+  auto second_statement = SQLPipelineBuilder{query}.enable_result_cache().create_pipeline_statement();
+  EXPECT_EQ(second_statement.get_result_table(), first_result);
+  EXPECT_TRUE(second_statement.metrics()->result_cache_hit);
+  EXPECT_EQ(second_statement.transaction_context()->phase(), TransactionPhase::Committed);
+
+  // A committed insert invalidates the result
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (2000, 1.5)"}.create_pipeline_statement().get_result_table();
+
+  auto third_statement = SQLPipelineBuilder{query}.enable_result_cache().create_pipeline_statement();
+  EXPECT_EQ(third_statement.get_result_table()->row_count(), 3u);
+  EXPECT_FALSE(third_statement.metrics()->result_cache_hit);
+
+  auto fourth_statement = SQLPipelineBuilder{query}.enable_result_cache().create_pipeline_statement();
+  EXPECT_EQ(fourth_statement.get_result_table()->row_count(), 3u);
+  EXPECT_TRUE(fourth_statement.metrics()->result_cache_hit);
+
+  // So do rows appended outside of a transaction
+  const auto a_segment = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{3000});
+  const auto b_segment = std::make_shared<ValueSegment<float>>(std::vector<float>{2.5f});
+  _table_a->append_chunk(Segments{a_segment, b_segment});
+
+  auto fifth_statement = SQLPipelineBuilder{query}.enable_result_cache().create_pipeline_statement();
+  EXPECT_EQ(fifth_statement.get_result_table()->row_count(), 4u);
+  EXPECT_FALSE(fifth_statement.metrics()->result_cache_hit);
+
+  // Statements in a transaction of their own are not answered from the cache
+  auto transaction_statement = SQLPipelineBuilder{query}
+                                   .with_transaction_context(TransactionManager::get().new_transaction_context())
+                                   .enable_result_cache()
+                                   .create_pipeline_statement();
+  transaction_statement.get_result_table();
+  EXPECT_FALSE(transaction_statement.metrics()->result_cache_hit);
+}
+
+TEST_F(SQLPipelineStatementTest, IntermediateResultRecycling) {
+  // Both queries join the same inputs, but compute different things on top of the join
+  const auto first_query = std::string{"SELECT table_a.b, table_b.b FROM table_a, table_b WHERE table_a.a = table_b.a"};
+  const auto second_query =
+      std::string{"SELECT table_a.b + table_b.b FROM table_a, table_b WHERE table_a.a = table_b.a"};
+
+  const auto uses_recycled_result = [](const std::shared_ptr<const AbstractOperator>& op) {
+    auto operators = std::vector<std::shared_ptr<const AbstractOperator>>{op};
+    while (!operators.empty()) {
+      const auto current_operator = operators.back();
+      operators.pop_back();
+      if (!current_operator) continue;
+      if (std::dynamic_pointer_cast<const TableWrapper>(current_operator)) return true;
+      operators.emplace_back(current_operator->input_left());
+      operators.emplace_back(current_operator->input_right());
+    }
+    return false;
+  };
+
+  const auto expected_result = SQLPipelineBuilder{second_query}.create_pipeline_statement().get_result_table();
+  EXPECT_EQ(IntermediateResultRecycler::get().size(), 0u);
+
+  IntermediateResultRecycler::get().set_memory_budget(1'000'000'000);
+
+  auto first_statement = SQLPipelineBuilder{first_query}.create_pipeline_statement();
+  first_statement.get_result_table();
+  EXPECT_FALSE(uses_recycled_result(first_statement.get_physical_plan()));
+  EXPECT_EQ(IntermediateResultRecycler::get().size(), 1u);
+
+  auto second_statement = SQLPipelineBuilder{second_query}.create_pipeline_statement();
+  EXPECT_TABLE_EQ_UNORDERED(second_statement.get_result_table(), expected_result);
+  EXPECT_TRUE(uses_recycled_result(second_statement.get_physical_plan()));
+
+  // A committed insert into one of the joined tables invalidates the result
+  SQLPipelineBuilder{"INSERT INTO table_b VALUES (123, 1.5)"}.create_pipeline_statement().get_result_table();
+
+  auto third_statement = SQLPipelineBuilder{second_query}.create_pipeline_statement();
+  EXPECT_EQ(third_statement.get_result_table()->row_count(), expected_result->row_count() + 1);
+  EXPECT_FALSE(uses_recycled_result(third_statement.get_physical_plan()));
+}
+
 TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   const auto subselect_query = "SELECT * FROM table_int WHERE a = (SELECT MAX(b) FROM table_int)";
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -458,6 +459,33 @@ TEST_F(SQLPipelineTest, GetTimes) {
   EXPECT_GT(statement_metrics->execution_time_nanos, zero_duration);
 }
 
+TEST_F(SQLPipelineTest, OptimizerRuleMetrics) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query + "; " + _select_query_a}.create_pipeline();
+  sql_pipeline.get_optimized_logical_plans();
+
+  const auto& metrics = sql_pipeline.metrics();
+  ASSERT_EQ(metrics.statement_metrics.size(), 2u);
+  const auto& join_rule_metrics = metrics.statement_metrics[0]->optimizer_rule_metrics;
+  const auto& select_rule_metrics = metrics.statement_metrics[1]->optimizer_rule_metrics;
+  ASSERT_FALSE(join_rule_metrics.empty());
+  ASSERT_EQ(join_rule_metrics.size(), select_rule_metrics.size());
+
+  // At least the cross join and its predicate are turned into an inner join
+  const auto changed_plan = [](const auto& rule_metrics) { return rule_metrics.changed_plan; };
+  EXPECT_TRUE(std::any_of(join_rule_metrics.cbegin(), join_rule_metrics.cend(), changed_plan));
+
+  // The metrics of the rules are summed up over both statements
+  const auto summed_rule_metrics = metrics.optimizer_rule_metrics();
+  ASSERT_EQ(summed_rule_metrics.size(), join_rule_metrics.size());
+  for (auto rule_idx = size_t{0}; rule_idx < summed_rule_metrics.size(); ++rule_idx) {
+    EXPECT_EQ(summed_rule_metrics[rule_idx].rule_name, join_rule_metrics[rule_idx].rule_name);
+    EXPECT_EQ(summed_rule_metrics[rule_idx].duration,
+              join_rule_metrics[rule_idx].duration + select_rule_metrics[rule_idx].duration);
+    EXPECT_EQ(summed_rule_metrics[rule_idx].changed_plan,
+              join_rule_metrics[rule_idx].changed_plan || select_rule_metrics[rule_idx].changed_plan);
+  }
+}
+
 TEST_F(SQLPipelineTest, RequiresExecutionVariations) {
   EXPECT_FALSE(SQLPipelineBuilder{_select_query_a}.create_pipeline().requires_execution());
   EXPECT_FALSE(SQLPipelineBuilder{_join_query}.create_pipeline().requires_execution());
@@ -628,6 +628,16 @@ TEST_F(SQLTranslatorTest, AggregateCount) {
   EXPECT_LQP_EQ(actual_lqp_count_1, expected_lqp_count_1);
 }
 
+TEST_F(SQLTranslatorTest, AggregateApproxCountDistinct) {
+  const auto actual_lqp = compile_query("SELECT b, APPROX_COUNT_DISTINCT(a) FROM int_float GROUP BY b");
+  // clang-format off
+  const auto expected_lqp =
+  AggregateNode::make(expression_vector(int_float_b), expression_vector(approx_count_distinct_(int_float_a)),
+    stored_table_node_int_float);
+  // clang-format on
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
 TEST_F(SQLTranslatorTest, GroupByOnly) {
   const auto actual_lqp = compile_query("SELECT * FROM int_float GROUP BY b + 3, a / b, a, b");
 
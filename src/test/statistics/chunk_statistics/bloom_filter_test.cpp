@@ -0,0 +1,87 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "statistics/chunk_statistics/bloom_filter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename T>
+class BloomFilterTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Even numbers are contained, odd numbers are not
+    for (auto value = 0; value < 1'000; value += 2) {
+      _contained_values.emplace_back(value);
+      _missing_values.emplace_back(value + 1);
+    }
+  }
+
+  pmr_vector<T> _contained_values;
+  std::vector<T> _missing_values;
+};
+
+template <>
+class BloomFilterTest<std::string> : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    for (auto value = 0; value < 1'000; value += 2) {
+      _contained_values.emplace_back("value" + std::to_string(value));
+      _missing_values.emplace_back("value" + std::to_string(value + 1));
+    }
+  }
+
+  pmr_vector<std::string> _contained_values;
+  std::vector<std::string> _missing_values;
+};
+
+using FilterTypes = ::testing::Types<int32_t, int64_t, float, double, std::string>;
+TYPED_TEST_CASE(BloomFilterTest, FilterTypes, );  // NOLINT(whitespace/parens)
+
+TYPED_TEST(BloomFilterTest, NeverPrunesContainedValues) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_contained_values);
+
+  for (const auto& value : this->_contained_values) {
+    EXPECT_TRUE(filter->may_contain(value));
+    EXPECT_FALSE(filter->can_prune(PredicateCondition::Equals, {value}));
+  }
+}
+
+TYPED_TEST(BloomFilterTest, PrunesMostMissingValues) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_contained_values);
+
+  auto false_positive_count = size_t{0};
+  for (const auto& value : this->_missing_values) {
+    false_positive_count += static_cast<size_t>(!filter->can_prune(PredicateCondition::Equals, {value}));
+  }
+
+  // With ten bits per value, about 1% of the missing values are expected to be false positives
+  EXPECT_LT(false_positive_count, this->_missing_values.size() / 20);
+}
+
+TYPED_TEST(BloomFilterTest, OnlyPrunesEquals) {
+  const auto filter = BloomFilter<TypeParam>::build_filter(this->_contained_values);
+  const auto& value = this->_missing_values.front();
+
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::NotEquals, {value}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::LessThan, {value}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::GreaterThanEquals, {value}));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Between, {value}, {value}));
+
+  // as null values are not comparable, we never prune them
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::Equals, NULL_VALUE));
+  EXPECT_FALSE(filter->can_prune(PredicateCondition::IsNull, NULL_VALUE));
+}
+
+TYPED_TEST(BloomFilterTest, MemoryUsageGrowsWithBitsPerValue) {
+  const auto small_filter = BloomFilter<TypeParam>::build_filter(this->_contained_values, 4u);
+  const auto large_filter = BloomFilter<TypeParam>::build_filter(this->_contained_values, 16u);
+
+  EXPECT_LT(small_filter->memory_usage(), large_filter->memory_usage());
+}
+
+}  // namespace opossum
@@ -762,4 +762,37 @@ TEST_F(EqualDistinctCountHistogramTest, StringLikeEdgePruning) {
   EXPECT_FALSE(hist->can_prune(PredicateCondition::Like, "z%"));
 }
 
+TEST_F(EqualDistinctCountHistogramTest, FromValueDistribution) {
+  const auto hist = EqualDistinctCountHistogram<int32_t>::from_value_distribution(
+      {{1, 10}, {2, 10}, {3, 10}, {4, 10}, {7, 1}}, 2u);
+
+  EXPECT_EQ(hist->bin_count(), 2u);
+  EXPECT_EQ(hist->total_count(), 41u);
+  EXPECT_EQ(hist->total_distinct_count(), 5u);
+  EXPECT_FLOAT_EQ(hist->estimate_cardinality(PredicateCondition::LessThanEquals, 3), 30.f);
+  EXPECT_TRUE(hist->can_prune(PredicateCondition::GreaterThan, AllTypeVariant{7}));
+}
+
+TEST_F(EqualDistinctCountHistogramTest, JoinCardinality) {
+  // Bins [1, 2] and [3, 4] with 20 values each
+  const auto left_hist =
+      EqualDistinctCountHistogram<int32_t>::from_value_distribution({{1, 10}, {2, 10}, {3, 10}, {4, 10}}, 2u);
+  // A single bin [2, 5] with 20 values
+  const auto right_hist =
+      EqualDistinctCountHistogram<int32_t>::from_value_distribution({{2, 5}, {3, 5}, {4, 5}, {5, 5}}, 1u);
+
+  // The values 2, 3, and 4 occur 10 times on the left and 5 times on the right
+  EXPECT_FLOAT_EQ(left_hist->estimate_join_cardinality(*right_hist), 150.f);
+  EXPECT_FLOAT_EQ(right_hist->estimate_join_cardinality(*left_hist), 150.f);
+
+  // Skewed distributions are accounted for, unlike with the uniform assumption (40 * 40 / 4 = 400)
+  const auto skewed_hist =
+      EqualDistinctCountHistogram<int32_t>::from_value_distribution({{1, 37}, {2, 1}, {3, 1}, {4, 1}}, 4u);
+  EXPECT_FLOAT_EQ(skewed_hist->estimate_join_cardinality(*skewed_hist), 1372.f);
+
+  // Bins that do not overlap do not contribute
+  const auto disjoint_hist = EqualDistinctCountHistogram<int32_t>::from_value_distribution({{10, 3}, {11, 3}}, 1u);
+  EXPECT_FLOAT_EQ(left_hist->estimate_join_cardinality(*disjoint_hist), 0.f);
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 
 #include "statistics/column_statistics.hpp"
+#include "statistics/generate_column_statistics.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 #include "statistics_test_utils.hpp"
@@ -24,4 +25,35 @@ TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsUnsampled) {
   EXPECT_FLOAT_COLUMN_STATISTICS(table_statistics.column_statistics().at(5), 0.0f, 150, -986.96f, 9983.38f);
 }
 
+TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsOfChunksInParallel) {
+  const auto table = load_table("resources/test_data/tbl/tpch/sf-0.001/customer.tbl", 10);
+  const auto table_statistics = generate_table_statistics(*table);
+
+  EXPECT_EQ(table_statistics.row_count(), 150u);
+
+  // The merged counts of the chunks are exact
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics.column_statistics().at(0), 0.0f, 150, 1, 150);
+  EXPECT_STRING_COLUMN_STATISTICS(table_statistics.column_statistics().at(1), 0.0f, 150, "Customer#000000001",
+                                  "Customer#000000150");
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics.column_statistics().at(3), 0.0f, 25, 0, 24);
+}
+
+TEST_F(GenerateTableStatisticsTest, GenerateTableStatisticsSampled) {
+  const auto table = load_table("resources/test_data/tbl/tpch/sf-0.001/customer.tbl", 10);
+
+  const auto sampled_chunk_ids = sample_chunk_ids(*table, 0.2f);
+  ASSERT_EQ(sampled_chunk_ids.size(), 3u);
+  EXPECT_EQ(sampled_chunk_ids.front(), ChunkID{0});
+  EXPECT_EQ(sample_chunk_ids(*table, 1.0f).size(), 15u);
+
+  const auto table_statistics = generate_table_statistics(*table, 0.5f);
+  EXPECT_EQ(table_statistics.row_count(), 150u);
+
+  // Each key of the 80 sampled rows occurs once, so their distinct count is extrapolated to sqrt(150 / 80) * 80
+  const auto& key_statistics = static_cast<const ColumnStatistics<int32_t>&>(*table_statistics.column_statistics()[0]);
+  EXPECT_NEAR(key_statistics.distinct_count(), 109.5f, 0.1f);
+  EXPECT_EQ(key_statistics.min(), 1);
+  EXPECT_FALSE(key_statistics.histogram());
+}
+
 }  // namespace opossum
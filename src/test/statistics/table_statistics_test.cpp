@@ -11,6 +11,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "statistics/base_column_statistics.hpp"
+#include "statistics/column_statistics.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 
@@ -279,4 +280,45 @@ TEST_F(TableStatisticsTest, TwoColumnScan) {
             post_predicate_statistics->column_statistics()[1]->distinct_count());
 }
 
+TEST_F(TableStatisticsTest, SkewedDistribution) {
+  // 90 rows with a = 1, and one row each with a = 2 to 10
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto row_id = 0; row_id < 90; ++row_id) table->append({1});
+  for (auto value = 2; value <= 10; ++value) table->append({value});
+
+  const auto statistics = generate_table_statistics(*table);
+  const auto& column_statistics = static_cast<const ColumnStatistics<int32_t>&>(*statistics.column_statistics()[0]);
+  ASSERT_TRUE(column_statistics.histogram());
+
+  // The histogram is used instead of assuming 9.9 rows per distinct value
+  EXPECT_NEAR(statistics.estimate_predicate(ColumnID{0}, PredicateCondition::Equals, 1).row_count(), 90.f, 0.01f);
+  EXPECT_NEAR(statistics.estimate_predicate(ColumnID{0}, PredicateCondition::Equals, 2).row_count(), 1.f, 0.01f);
+  EXPECT_NEAR(statistics.estimate_predicate(ColumnID{0}, PredicateCondition::GreaterThan, 1).row_count(), 9.f, 0.01f);
+
+  // The self-join yields 90 * 90 + 9 rows, instead of 99 * 99 / 10
+  const auto join_statistics =
+      statistics.estimate_predicated_join(statistics, JoinMode::Inner, {ColumnID{0}, ColumnID{0}},
+                                          PredicateCondition::Equals);
+  EXPECT_NEAR(join_statistics.row_count(), 8109.f, 0.1f);
+}
+
+TEST_F(TableStatisticsTest, IsStale) {
+  auto statistics = TableStatistics{TableType::Data, 100.0f, {}};
+  EXPECT_FALSE(statistics.is_stale());
+
+  statistics.increase_row_count(10);
+  EXPECT_EQ(statistics.row_count(), 110.0f);
+  EXPECT_FALSE(statistics.is_stale());
+
+  statistics.increase_row_count(1);
+  EXPECT_TRUE(statistics.is_stale());
+
+  // Statistics of tables that were empty when they were generated are stale after the first insert
+  auto empty_table_statistics = TableStatistics{TableType::Data, 0.0f, {}};
+  empty_table_statistics.increase_row_count(1);
+  EXPECT_TRUE(empty_table_statistics.is_stale());
+}
+
 }  // namespace opossum
@@ -210,6 +210,58 @@ TEST_F(AdaptiveRadixTreeIndexTest, SimpleTest) {
   EXPECT_EQ(index->upper_bound({std::numeric_limits<int32_t>::max()}), index->cend());
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, AllNodeTypes) {
+  // The value IDs of the last byte are stored in an ARTNode4, ARTNode16, ARTNode48 and ARTNode256 respectively
+  for (const auto distinct_count : {3, 10, 30, 100}) {
+    std::vector<int32_t> values;
+    for (auto value = int32_t{0}; value < distinct_count; ++value) {
+      values.insert(values.end(), {value * 3, value * 3});
+    }
+
+    auto segment = create_dict_segment_by_type<int32_t>(DataType::Int, values);
+    auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+
+    for (auto value = int32_t{0}; value < distinct_count; ++value) {
+      EXPECT_EQ(std::distance(index->cbegin(), index->lower_bound({value * 3})), value * 2);
+      EXPECT_EQ(std::distance(index->cbegin(), index->upper_bound({value * 3})), value * 2 + 2);
+      EXPECT_EQ(index->lower_bound({value * 3 + 1}), index->upper_bound({value * 3}));
+    }
+    EXPECT_EQ(index->lower_bound({distinct_count * 3}), index->cend());
+  }
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, BatchedLookups) {
+  size_t test_size = 10'001;
+  std::vector<int32_t> ints(test_size);
+  for (auto i = 0u; i < test_size; ++i) {
+    ints[i] = i * 2;
+  }
+
+  std::shuffle(ints.begin(), ints.end(), _rng);
+
+  auto segment = create_dict_segment_by_type<int32_t>(DataType::Int, ints);
+  auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+
+  // Contained values, values in between and values outside of the range of the segment
+  std::vector<AllTypeVariant> search_values;
+  for (auto search_value = int32_t{-5}; search_value < static_cast<int32_t>(3 * test_size); ++search_value) {
+    search_values.emplace_back(search_value);
+  }
+  std::shuffle(search_values.begin(), search_values.end(), _rng);
+
+  const auto lower_bounds = index->lower_bounds(search_values);
+  const auto upper_bounds = index->upper_bounds(search_values);
+  ASSERT_EQ(lower_bounds.size(), search_values.size());
+  ASSERT_EQ(upper_bounds.size(), search_values.size());
+
+  for (auto search_value_id = size_t{0}; search_value_id < search_values.size(); ++search_value_id) {
+    EXPECT_EQ(lower_bounds[search_value_id], index->lower_bound({search_values[search_value_id]}));
+    EXPECT_EQ(upper_bounds[search_value_id], index->upper_bound({search_values[search_value_id]}));
+  }
+
+  EXPECT_TRUE(index->lower_bounds({}).empty());
+}
+
 /**
 * The following two cases try to test two rather extreme situations that both
 * test the node overflow handling of the ART implementation:
@@ -0,0 +1,120 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_compaction_manager.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ChunkCompactionManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 12 rows in two chunks
+    _table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+    ChunkEncoder::encode_all_chunks(_table);
+    StorageManager::get().add_table("table", _table);
+  }
+
+  void TearDown() override {
+    ChunkCompactionManager::get().pause();
+    ChunkCompactionManager::get().set_options(ChunkCompactionManager::Options{});
+  }
+
+  void delete_rows(const std::vector<RowID>& row_ids) {
+    auto pos_list = std::make_shared<PosList>(row_ids.cbegin(), row_ids.cend());
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(_table, column_id, pos_list));
+    }
+    auto rows_to_delete = std::make_shared<Table>(_table->column_definitions(), TableType::References);
+    rows_to_delete->append_chunk(segments);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(rows_to_delete);
+    table_wrapper->execute();
+
+    auto delete_op = std::make_shared<Delete>("table", table_wrapper);
+    auto context = TransactionManager::get().new_transaction_context();
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    context->commit();
+  }
+
+  size_t visible_row_count(const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkCompactionManagerTest, IgnoresChunksWithFewInvalidatedRows) {
+  // One out of six rows is 17% and thus below the default threshold
+  delete_rows({RowID{ChunkID{0}, 0u}});
+
+  EXPECT_EQ(ChunkCompactionManager::get().compact_chunks(), 0u);
+  EXPECT_EQ(_table->chunk_count(), 2u);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+}
+
+TEST_F(ChunkCompactionManagerTest, CompactsAndReleasesChunks) {
+  delete_rows({RowID{ChunkID{0}, 0u}, RowID{ChunkID{0}, 3u}});
+
+  EXPECT_EQ(ChunkCompactionManager::get().compact_chunks(), 1u);
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->size(), 4u);
+
+  // The compacted chunk is released in the next pass, as no transaction can see its rows anymore
+  EXPECT_EQ(ChunkCompactionManager::get().compact_chunks(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 6u);
+
+  EXPECT_EQ(visible_row_count(TransactionManager::get().new_transaction_context()), 10u);
+}
+
+TEST_F(ChunkCompactionManagerTest, KeepsChunksVisibleToActiveTransactions) {
+  delete_rows({RowID{ChunkID{1}, 1u}, RowID{ChunkID{1}, 2u}, RowID{ChunkID{1}, 5u}});
+
+  const auto old_context = TransactionManager::get().new_transaction_context();
+
+  EXPECT_EQ(ChunkCompactionManager::get().compact_chunks(), 1u);
+  EXPECT_EQ(ChunkCompactionManager::get().compact_chunks(), 0u);
+
+  // The old transaction still reads the original rows from the compacted chunk
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 6u);
+  EXPECT_EQ(visible_row_count(old_context), 9u);
+
+  // Newer transactions skip the compacted chunk in TableScans
+  const auto new_context = TransactionManager::get().new_transaction_context();
+  auto get_table = std::make_shared<GetTable>("table");
+  get_table->execute();
+  auto table_scan = create_table_scan(get_table, ColumnID{1}, PredicateCondition::GreaterThanEquals, 0);
+  table_scan->set_transaction_context(new_context);
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 9u);
+
+  old_context->rollback();
+  EXPECT_EQ(ChunkCompactionManager::get().compact_chunks(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 0u);
+  EXPECT_EQ(visible_row_count(new_context), 9u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,123 @@
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/chunk_compression_manager.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ChunkCompressionManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 12 rows in two chunks
+    _table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+    StorageManager::get().add_table("table", _table);
+  }
+
+  void TearDown() override {
+    ChunkCompressionManager::get().pause();
+    ChunkCompressionManager::get().set_options(ChunkCompressionManager::Options{});
+  }
+
+  // Inserts the content of the table into itself, i.e., 12 rows in two chunks
+  std::shared_ptr<TransactionContext> insert_rows() {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+
+    auto insert = std::make_shared<Insert>("table", get_table);
+    auto context = TransactionManager::get().new_transaction_context();
+    insert->set_transaction_context(context);
+    insert->execute();
+    return context;
+  }
+
+  bool is_encoded(const ChunkID chunk_id) const {
+    const auto chunk = _table->get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      if (!std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id))) return false;
+    }
+    return !chunk->is_mutable();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkCompressionManagerTest, CompressesOnlyCompletedChunks) {
+  const auto context = insert_rows();
+  ASSERT_EQ(_table->chunk_count(), 4u);
+
+  // The inserting transaction is still running, so only the bulk-loaded chunks are compressed
+  EXPECT_EQ(ChunkCompressionManager::get().compress_completed_chunks(), 2u);
+  EXPECT_TRUE(is_encoded(ChunkID{0}));
+  EXPECT_TRUE(is_encoded(ChunkID{1}));
+  EXPECT_FALSE(is_encoded(ChunkID{2}));
+  EXPECT_FALSE(is_encoded(ChunkID{3}));
+
+  context->commit();
+
+  EXPECT_EQ(ChunkCompressionManager::get().compress_completed_chunks(), 2u);
+  EXPECT_TRUE(is_encoded(ChunkID{2}));
+  EXPECT_TRUE(is_encoded(ChunkID{3}));
+
+  // Nothing is left to compress
+  EXPECT_EQ(ChunkCompressionManager::get().compress_completed_chunks(), 0u);
+}
+
+TEST_F(ChunkCompressionManagerTest, DoesNotCompressPartialChunks) {
+  // Insert a single row into a new chunk
+  auto single_row = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  single_row->append({"foo", 1});
+  auto table_wrapper = std::make_shared<TableWrapper>(single_row);
+  table_wrapper->execute();
+
+  auto insert = std::make_shared<Insert>("table", table_wrapper);
+  auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  EXPECT_EQ(ChunkCompressionManager::get().compress_completed_chunks(), 2u);
+  EXPECT_FALSE(is_encoded(ChunkID{2}));
+}
+
+TEST_F(ChunkCompressionManagerTest, UsesTableEncoding) {
+  auto options = ChunkCompressionManager::Options{};
+  options.table_encoding_specs["table"] = SegmentEncodingSpec{EncodingType::RunLength};
+  ChunkCompressionManager::get().set_options(options);
+
+  ChunkCompressionManager::get().compress_completed_chunks();
+
+  const auto segment =
+      std::dynamic_pointer_cast<const BaseEncodedSegment>(_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->encoding_type(), EncodingType::RunLength);
+}
+
+TEST_F(ChunkCompressionManagerTest, CompressesInBackground) {
+  auto options = ChunkCompressionManager::Options{};
+  options.compression_interval = std::chrono::milliseconds{1};
+  ChunkCompressionManager::get().set_options(options);
+  ChunkCompressionManager::get().resume();
+
+  const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+  while (!is_encoded(ChunkID{1}) && std::chrono::steady_clock::now() < timeout) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  ChunkCompressionManager::get().pause();
+
+  EXPECT_TRUE(is_encoded(ChunkID{0}));
+  EXPECT_TRUE(is_encoded(ChunkID{1}));
+}
+
+}  // namespace opossum
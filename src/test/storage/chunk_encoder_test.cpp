@@ -68,6 +68,23 @@ TEST_F(ChunkEncoderTest, EncodeSingleChunk) {
   verify_encoding(chunk, chunk_encoding_spec);
 }
 
+TEST_F(ChunkEncoderTest, EncodeSingleChunkAutomatically) {
+  const auto chunk_encoding_spec =
+      ChunkEncodingSpec{{EncodingType::Auto}, {EncodingType::RunLength}, {EncodingType::Auto}};
+
+  auto types = _table->column_data_types();
+  auto chunk = _table->get_chunk(ChunkID{0u});
+
+  ChunkEncoder::encode_chunk(chunk, types, chunk_encoding_spec);
+
+  for (auto column_id = ColumnID{0u}; column_id < chunk->column_count(); ++column_id) {
+    const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(column_id));
+    ASSERT_NE(encoded_segment, nullptr);
+    EXPECT_NE(encoded_segment->encoding_type(), EncodingType::Auto);
+  }
+  EXPECT_FALSE(chunk->is_mutable());
+}
+
 TEST_F(ChunkEncoderTest, LeaveOneSegmentUnencoded) {
   const auto chunk_encoding_spec =
       ChunkEncodingSpec{{EncodingType::Unencoded}, {EncodingType::RunLength}, {EncodingType::Dictionary}};
@@ -0,0 +1,124 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/chunk_merge_manager.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/shared_dictionaries.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ChunkMergeManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 12 rows in two dictionary-encoded chunks, with an index on column b
+    _table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+    ChunkEncoder::encode_all_chunks(_table);
+    _table->create_index<GroupKeyIndex>({ColumnID{1}});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  void TearDown() override {
+    ChunkMergeManager::get().pause();
+    ChunkMergeManager::get().set_options(ChunkMergeManager::Options{});
+  }
+
+  // Inserts the content of the table into itself, i.e., 12 rows in two delta chunks
+  void insert_rows() {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+
+    auto insert = std::make_shared<Insert>("table", get_table);
+    auto context = TransactionManager::get().new_transaction_context();
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->commit();
+  }
+
+  void delete_rows(const std::vector<RowID>& row_ids) {
+    auto pos_list = std::make_shared<PosList>(row_ids.cbegin(), row_ids.cend());
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(_table, column_id, pos_list));
+    }
+    auto rows_to_delete = std::make_shared<Table>(_table->column_definitions(), TableType::References);
+    rows_to_delete->append_chunk(segments);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(rows_to_delete);
+    table_wrapper->execute();
+
+    auto delete_op = std::make_shared<Delete>("table", table_wrapper);
+    auto context = TransactionManager::get().new_transaction_context();
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    context->commit();
+  }
+
+  size_t visible_row_count() {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+    validate->execute();
+    return validate->get_output()->row_count();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkMergeManagerTest, MergesDeltaIntoMain) {
+  insert_rows();
+  ASSERT_EQ(_table->chunk_count(), 4u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+
+  EXPECT_EQ(ChunkMergeManager::get().merge(), 2u);
+
+  // All chunks are encoded, share their dictionaries, and have an index on their current segments
+  const auto column_b = std::vector<ColumnID>{ColumnID{1}};
+  EXPECT_EQ(segments_with_shared_dictionary(*_table, ColumnID{1}).size(), 4u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->get_index(SegmentIndexType::GroupKey, column_b));
+  }
+
+  // Nothing is left to merge, and the indexes stay as they are
+  const auto index = _table->get_chunk(ChunkID{2})->get_index(SegmentIndexType::GroupKey, column_b);
+  EXPECT_EQ(ChunkMergeManager::get().merge(), 0u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->get_index(SegmentIndexType::GroupKey, column_b), index);
+  EXPECT_EQ(visible_row_count(), 24u);
+}
+
+TEST_F(ChunkMergeManagerTest, FoldsInvalidationsIntoDelta) {
+  delete_rows({RowID{ChunkID{0}, 0u}, RowID{ChunkID{0}, 3u}});
+
+  // The four remaining rows of the chunk are moved into a new delta chunk
+  EXPECT_EQ(ChunkMergeManager::get().merge(), 1u);
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->size(), 4u);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_EQ(visible_row_count(), 10u);
+
+  // The compacted chunk is released in the next pass
+  ChunkMergeManager::get().merge();
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->size(), 0u);
+  const auto column_b = std::vector<ColumnID>{ColumnID{1}};
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->get_index(SegmentIndexType::GroupKey, column_b));
+  EXPECT_EQ(visible_row_count(), 10u);
+}
+
+}  // namespace opossum
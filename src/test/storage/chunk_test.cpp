@@ -4,12 +4,17 @@
 #include "gtest/gtest.h"
 
 #include "resolve_type.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/epoch_manager.hpp"
 
 namespace opossum {
 
@@ -203,4 +208,65 @@ TEST_F(StorageChunkTest, RemoveIndex) {
             indices_for_segment_0.cend());
 }
 
+TEST_F(StorageChunkTest, ReplaceSegmentWhilePinned) {
+  auto segment = std::make_shared<ValueSegment<int32_t>>(pmr_concurrent_vector<int32_t>{1, 2, 3});
+  const auto weak_segment = std::weak_ptr<BaseSegment>{segment};
+  chunk = std::make_shared<Chunk>(Segments({segment}));
+  chunk->mark_immutable();
+  segment.reset();
+
+  {
+    const auto epoch_guard = EpochGuard{};
+    const auto& pinned_segment = chunk->get_pinned_segment(ColumnID{0});
+
+    chunk->replace_segment(ColumnID{0}, ds_int);
+
+    // The replaced segment is kept alive as long as the guard might read it
+    EXPECT_FALSE(weak_segment.expired());
+    EXPECT_EQ(pinned_segment.size(), 3u);
+    EXPECT_EQ(&chunk->get_pinned_segment(ColumnID{0}), ds_int.get());
+  }
+
+  EpochManager::get().reclaim();
+  EXPECT_TRUE(weak_segment.expired());
+}
+
+TEST_F(StorageChunkTest, IndicesAndStatisticsArePublished) {
+  chunk = std::make_shared<Chunk>(Segments({ds_int, ds_str}));
+  chunk->mark_immutable();
+  EXPECT_FALSE(chunk->has_indices());
+
+  const auto index = chunk->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_TRUE(chunk->has_indices());
+  chunk->remove_index(index);
+  EXPECT_FALSE(chunk->has_indices());
+
+  const auto epoch_guard = EpochGuard{};
+  EXPECT_EQ(chunk->get_pinned_statistics(), nullptr);
+  const auto statistics = std::make_shared<ChunkStatistics>(std::vector<std::shared_ptr<SegmentStatistics>>(2));
+  chunk->set_statistics(statistics);
+  EXPECT_EQ(chunk->get_pinned_statistics(), statistics.get());
+}
+
+TEST_F(StorageChunkTest, PreferredNodeId) {
+  // The chunk was not allocated on a NUMA node
+  EXPECT_EQ(chunk->preferred_node_id(), CURRENT_NODE_ID);
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  table->append_chunk(Segments{vs_int});
+  table->get_chunk(ChunkID{0})->migrate(Topology::get().get_memory_resource(0));
+
+  const auto expected_node_id = HYRISE_NUMA_SUPPORT ? NodeID{0} : CURRENT_NODE_ID;
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->preferred_node_id(), expected_node_id);
+
+  // A chunk of ReferenceSegments prefers the node of the chunk it references
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->set_chunk_range(ChunkID{0}, ChunkOffset{0}, ChunkOffset{2});
+  const auto reference_chunk =
+      std::make_shared<Chunk>(Segments{std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list)});
+  EXPECT_EQ(reference_chunk->preferred_node_id(), expected_node_id);
+}
+
 }  // namespace opossum
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/chunk_tiering_manager.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class ChunkTieringManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 12 rows in three chunks, the chunks get access counters so that they can be tiered
+    _expected_table = load_table("resources/test_data/tbl/compression_input.tbl", 4u);
+
+    _table = std::make_shared<Table>(_expected_table->column_definitions(), TableType::Data, 4u);
+    for (auto chunk_id = ChunkID{0}; chunk_id < _expected_table->chunk_count(); ++chunk_id) {
+      _table->append_chunk(_expected_table->get_chunk(chunk_id)->segments(), std::nullopt,
+                           std::make_shared<ChunkAccessCounter>(PolymorphicAllocator<uint64_t>{}));
+    }
+    ChunkEncoder::encode_all_chunks(_table);
+    StorageManager::get().add_table("table", _table);
+
+    // Only a single chunk fits into DRAM
+    auto min_memory_usage = std::numeric_limits<size_t>::max();
+    auto max_memory_usage = size_t{0};
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      const auto memory_usage = _table->get_chunk(chunk_id)->estimate_memory_usage();
+      min_memory_usage = std::min(min_memory_usage, memory_usage);
+      max_memory_usage = std::max(max_memory_usage, memory_usage);
+    }
+
+    auto options = ChunkTieringManager::Options{};
+    options.dram_budget = max_memory_usage + min_memory_usage / 2u;
+    ChunkTieringManager::get().set_options(options);
+  }
+
+  void TearDown() override {
+    ChunkTieringManager::get().pause();
+    ChunkTieringManager::get().set_options(ChunkTieringManager::Options{});
+  }
+
+  bool is_tiered(const ChunkID chunk_id) const {
+    return ChunkTieringManager::get().is_tiered(*_table->get_chunk(chunk_id));
+  }
+
+  std::shared_ptr<Table> _expected_table;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkTieringManagerTest, TiersChunksExceedingBudget) {
+  // No chunk has been accessed yet, so the first chunk stays in DRAM
+  EXPECT_EQ(ChunkTieringManager::get().tier_chunks(), 2u);
+  EXPECT_FALSE(is_tiered(ChunkID{0}));
+  EXPECT_TRUE(is_tiered(ChunkID{1}));
+  EXPECT_TRUE(is_tiered(ChunkID{2}));
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+
+  // Nothing changed, so nothing is migrated
+  EXPECT_EQ(ChunkTieringManager::get().tier_chunks(), 0u);
+}
+
+TEST_F(ChunkTieringManagerTest, BringsBackAccessedChunks) {
+  ChunkTieringManager::get().tier_chunks();
+  ASSERT_TRUE(is_tiered(ChunkID{2}));
+
+  _table->get_chunk(ChunkID{2})->access_counter()->increment(1'000);
+
+  // The accessed chunk replaces the first chunk in DRAM
+  EXPECT_EQ(ChunkTieringManager::get().tier_chunks(), 2u);
+  EXPECT_TRUE(is_tiered(ChunkID{0}));
+  EXPECT_TRUE(is_tiered(ChunkID{1}));
+  EXPECT_FALSE(is_tiered(ChunkID{2}));
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(ChunkTieringManagerTest, KeepsChunksWithinBudget) {
+  auto options = ChunkTieringManager::get().options();
+  options.dram_budget = std::numeric_limits<size_t>::max();
+  ChunkTieringManager::get().set_options(options);
+
+  EXPECT_EQ(ChunkTieringManager::get().tier_chunks(), 0u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(is_tiered(chunk_id));
+  }
+}
+
+TEST_F(ChunkTieringManagerTest, IgnoresChunksWithoutAccessCounter) {
+  StorageManager::get().add_table("other_table", load_table("resources/test_data/tbl/compression_input.tbl", 4u));
+
+  auto options = ChunkTieringManager::get().options();
+  options.dram_budget = 0u;
+  ChunkTieringManager::get().set_options(options);
+
+  EXPECT_EQ(ChunkTieringManager::get().tier_chunks(), 3u);
+
+  const auto other_table = StorageManager::get().get_table("other_table");
+  for (auto chunk_id = ChunkID{0}; chunk_id < other_table->chunk_count(); ++chunk_id) {
+    EXPECT_FALSE(ChunkTieringManager::get().is_tiered(*other_table->get_chunk(chunk_id)));
+  }
+}
+
+}  // namespace opossum
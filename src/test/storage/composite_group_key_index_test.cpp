@@ -21,9 +21,11 @@ opossum::VariableLengthKey create_key(uint16_t value) {
   return result;
 }
 
-std::vector<opossum::VariableLengthKey> to_vector(const opossum::VariableLengthKeyStore& keys) {
-  auto result = std::vector<opossum::VariableLengthKey>(keys.size());
-  std::copy(keys.cbegin(), keys.cend(), result.begin());
+std::vector<opossum::VariableLengthKey> to_vector(const opossum::PrefixCompressedKeyStore& keys) {
+  auto result = std::vector<opossum::VariableLengthKey>();
+  for (auto position = opossum::ChunkOffset{0}; position < keys.size(); ++position) {
+    result.emplace_back(keys[position]);
+  }
   return result;
 }
 
@@ -86,8 +88,8 @@ class CompositeGroupKeyIndexTest : public BaseTest {
    * private scope. In order to minimize the friend classes of CompositeGroupKeyIndex the fixture
    * is used as proxy. Since the variables are set in setup(), references are not possible.
    */
-  VariableLengthKeyStore* _keys_int_str;
-  VariableLengthKeyStore* _keys_str_int;
+  PrefixCompressedKeyStore* _keys_int_str;
+  PrefixCompressedKeyStore* _keys_str_int;
 
   std::vector<ChunkOffset>* _offsets_int_str;
   std::vector<ChunkOffset>* _offsets_str_int;
@@ -0,0 +1,149 @@
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/delta_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+
+namespace opossum {
+
+class StorageDeltaSegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<int64_t>> vs_int = std::make_shared<ValueSegment<int64_t>>(true);
+};
+
+TEST_F(StorageDeltaSegmentTest, CompressSortedSegmentInt) {
+  const auto row_count = DeltaSegment<int64_t>::block_size * 3 + 5;
+  for (auto index = 0u; index < row_count; ++index) {
+    vs_int->append(int64_t{1'500'000'000'000} + index * 7);
+  }
+
+  auto segment = encode_segment(EncodingType::Delta, DataType::Long, vs_int,
+                                VectorCompressionType::FixedSizeByteAligned);
+  auto delta_segment = std::dynamic_pointer_cast<DeltaSegment<int64_t>>(segment);
+  ASSERT_NE(delta_segment, nullptr);
+
+  EXPECT_EQ(delta_segment->encoding_type(), EncodingType::Delta);
+  EXPECT_EQ(delta_segment->size(), row_count);
+  EXPECT_EQ(delta_segment->block_anchors().size(), 4u);
+
+  // All deltas are small, so a single byte per value suffices
+  EXPECT_NE(dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>*>(&delta_segment->deltas()), nullptr);
+  EXPECT_LT(delta_segment->estimate_memory_usage() * 4, vs_int->estimate_memory_usage());
+
+  auto index = 0u;
+  create_iterable_from_segment(*delta_segment).for_each([&](const auto& position) {
+    EXPECT_FALSE(position.is_null());
+    EXPECT_EQ(position.value(), int64_t{1'500'000'000'000} + index * 7);
+    ++index;
+  });
+  EXPECT_EQ(index, row_count);
+}
+
+TEST_F(StorageDeltaSegmentTest, NegativeDeltasAndNulls) {
+  vs_int->append(int64_t{10});
+  vs_int->append(int64_t{-3});
+  vs_int->append(NULL_VALUE);
+  vs_int->append(int64_t{-2});
+  vs_int->append(int64_t{-70'000});
+
+  auto segment = encode_segment(EncodingType::Delta, DataType::Long, vs_int);
+  auto delta_segment = std::dynamic_pointer_cast<DeltaSegment<int64_t>>(segment);
+
+  EXPECT_EQ((*delta_segment)[0], AllTypeVariant{int64_t{10}});
+  EXPECT_EQ((*delta_segment)[1], AllTypeVariant{int64_t{-3}});
+  EXPECT_TRUE(variant_is_null((*delta_segment)[2]));
+  EXPECT_EQ((*delta_segment)[3], AllTypeVariant{int64_t{-2}});
+  EXPECT_EQ(delta_segment->get_typed_value(4), int64_t{-70'000});
+}
+
+TEST_F(StorageDeltaSegmentTest, ExtremeValues) {
+  // The deltas between these values do not fit into 32 bits. The values are repeated to span multiple blocks.
+  const auto extreme_values = std::vector<int64_t>{0, std::numeric_limits<int64_t>::max(),
+                                                   std::numeric_limits<int64_t>::min(), -1, 1};
+  const auto row_count = DeltaSegment<int64_t>::block_size * 2 + 3;
+  for (auto index = 0u; index < row_count; ++index) {
+    vs_int->append(extreme_values[index % extreme_values.size()]);
+  }
+  vs_int->append(NULL_VALUE);
+
+  auto segment = encode_segment(EncodingType::Delta, DataType::Long, vs_int);
+  auto delta_segment = std::dynamic_pointer_cast<DeltaSegment<int64_t>>(segment);
+  ASSERT_NE(delta_segment, nullptr);
+  EXPECT_FALSE(delta_segment->wide_deltas().empty());
+  EXPECT_EQ(delta_segment->wide_deltas().size(), delta_segment->wide_delta_offsets().size());
+
+  auto index = 0u;
+  create_iterable_from_segment(*delta_segment).for_each([&](const auto& position) {
+    if (index < row_count) {
+      EXPECT_FALSE(position.is_null());
+      EXPECT_EQ(position.value(), extreme_values[index % extreme_values.size()]);
+    } else {
+      EXPECT_TRUE(position.is_null());
+    }
+    ++index;
+  });
+  EXPECT_EQ(index, row_count + 1);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    EXPECT_EQ(delta_segment->get_typed_value(chunk_offset), extreme_values[chunk_offset % extreme_values.size()]);
+  }
+
+  auto position_filter = std::make_shared<PosList>();
+  position_filter->guarantee_single_chunk();
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{row_count - 1}});
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{2}});
+  auto values = std::vector<int64_t>{};
+  create_iterable_from_segment(*delta_segment).for_each(position_filter, [&](const auto& position) {
+    values.emplace_back(position.value());
+  });
+  EXPECT_EQ(values, (std::vector<int64_t>{extreme_values[(row_count - 1) % extreme_values.size()],
+                                          std::numeric_limits<int64_t>::min()}));
+}
+
+TEST_F(StorageDeltaSegmentTest, ExtremeValuesInt) {
+  // The zigzag encoded delta from 0 to INT32_MIN is the largest uint32_t, which marks wide deltas
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>(
+      pmr_concurrent_vector<int32_t>{0, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()});
+
+  auto segment = encode_segment(EncodingType::Delta, DataType::Int, value_segment);
+  auto delta_segment = std::dynamic_pointer_cast<DeltaSegment<int32_t>>(segment);
+  ASSERT_NE(delta_segment, nullptr);
+  EXPECT_EQ(delta_segment->wide_delta_offsets(), pmr_vector<ChunkOffset>{ChunkOffset{1}});
+
+  EXPECT_EQ(delta_segment->get_typed_value(0), 0);
+  EXPECT_EQ(delta_segment->get_typed_value(1), std::numeric_limits<int32_t>::min());
+  EXPECT_EQ(delta_segment->get_typed_value(2), std::numeric_limits<int32_t>::max());
+}
+
+TEST_F(StorageDeltaSegmentTest, PointAccessAcrossBlocks) {
+  const auto row_count = DeltaSegment<int64_t>::block_size * 2;
+  for (auto index = 0u; index < row_count; ++index) {
+    vs_int->append(static_cast<int64_t>(index));
+  }
+
+  auto segment = encode_segment(EncodingType::Delta, DataType::Long, vs_int);
+  auto delta_segment = std::dynamic_pointer_cast<DeltaSegment<int64_t>>(segment);
+
+  auto position_filter = std::make_shared<PosList>();
+  position_filter->guarantee_single_chunk();
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{3}});
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{4}});
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{row_count - 1}});
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{1}});
+
+  auto values = std::vector<int64_t>{};
+  create_iterable_from_segment(*delta_segment).for_each(position_filter, [&](const auto& position) {
+    values.emplace_back(position.value());
+  });
+
+  EXPECT_EQ(values, (std::vector<int64_t>{3, 4, static_cast<int64_t>(row_count - 1), 1}));
+}
+
+}  // namespace opossum
@@ -59,4 +59,27 @@ TEST_F(GroupKeyIndexTest, IndexPostings) {
   }
 }
 
+TEST_F(GroupKeyIndexTest, KeyAccess) {
+  EXPECT_TRUE(index->supports_key_access());
+
+  auto keys = std::vector<std::pair<AllTypeVariant, ChunkOffset>>{};
+  const auto collect_keys = [&](const AllTypeVariant& value, const ChunkOffset row_count) {
+    keys.emplace_back(value, row_count);
+  };
+
+  index->for_each_key(index->cbegin(), index->cend(), collect_keys);
+  const auto expected_keys = std::vector<std::pair<AllTypeVariant, ChunkOffset>>{
+      {"apple", 1}, {"charlie", 2}, {"delta", 2}, {"frank", 1}, {"hotel", 1}, {"inbox", 1}};
+  EXPECT_EQ(keys, expected_keys);
+
+  // Ranges can also start and end within the postings of a value
+  keys.clear();
+  index->for_each_key(index->lower_bound({"charlie"}) + 1, index->upper_bound({"frank"}), collect_keys);
+  EXPECT_EQ(keys, (std::vector<std::pair<AllTypeVariant, ChunkOffset>>{{"charlie", 1}, {"delta", 2}, {"frank", 1}}));
+
+  keys.clear();
+  index->for_each_key(index->lower_bound({"bravo"}), index->upper_bound({"bravo"}), collect_keys);
+  EXPECT_TRUE(keys.empty());
+}
+
 }  // namespace opossum
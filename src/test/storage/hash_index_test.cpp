@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/base_segment.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/hash/hash_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class HashIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    values = {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"};
+    segment = std::make_shared<ValueSegment<std::string>>(values);
+    index = std::make_shared<HashIndex>(std::vector<std::shared_ptr<const BaseSegment>>({segment}));
+  }
+
+  // Returns the ChunkOffsets of the rows with the value
+  std::vector<ChunkOffset> lookup(const AllTypeVariant& value) {
+    return std::vector<ChunkOffset>(index->lower_bound({value}), index->upper_bound({value}));
+  }
+
+  std::vector<std::string> values;
+  std::shared_ptr<HashIndex> index = nullptr;
+  std::shared_ptr<ValueSegment<std::string>> segment = nullptr;
+};
+
+TEST_F(HashIndexTest, Type) { EXPECT_EQ(index->type(), SegmentIndexType::Hash); }
+
+TEST_F(HashIndexTest, IndexProbes) {
+  EXPECT_EQ(lookup("apple"), std::vector<ChunkOffset>({4}));
+  EXPECT_EQ(lookup("charlie"), std::vector<ChunkOffset>({5, 6}));
+  EXPECT_EQ(lookup("delta"), std::vector<ChunkOffset>({1, 3}));
+  EXPECT_EQ(lookup("frank"), std::vector<ChunkOffset>({2}));
+  EXPECT_EQ(lookup("hotel"), std::vector<ChunkOffset>({0}));
+  EXPECT_EQ(lookup("inbox"), std::vector<ChunkOffset>({7}));
+
+  EXPECT_EQ(std::distance(index->cbegin(), index->cend()), 8);
+}
+
+TEST_F(HashIndexTest, MissingValues) {
+  EXPECT_EQ(index->lower_bound({"bravo"}), index->cend());
+  EXPECT_EQ(index->upper_bound({"bravo"}), index->cend());
+  EXPECT_EQ(index->lower_bound({NullValue{}}), index->cend());
+}
+
+TEST_F(HashIndexTest, NotEquals) {
+  // All rows except for those in [lower_bound, upper_bound) do not have the value
+  auto not_delta = std::vector<ChunkOffset>(index->cbegin(), index->lower_bound({"delta"}));
+  not_delta.insert(not_delta.end(), index->upper_bound({"delta"}), index->cend());
+  std::sort(not_delta.begin(), not_delta.end());
+
+  EXPECT_EQ(not_delta, std::vector<ChunkOffset>({0, 2, 4, 5, 6, 7}));
+}
+
+TEST_F(HashIndexTest, NullsAreNotIndexed) {
+  const auto int_segment = std::make_shared<ValueSegment<int32_t>>(
+      pmr_concurrent_vector<int32_t>{1, 0, 1, 2}, pmr_concurrent_vector<bool>{false, true, false, false});
+  index = std::make_shared<HashIndex>(std::vector<std::shared_ptr<const BaseSegment>>({int_segment}));
+
+  EXPECT_EQ(lookup(1), std::vector<ChunkOffset>({0, 2}));
+  EXPECT_EQ(lookup(0), std::vector<ChunkOffset>{});
+  EXPECT_EQ(std::distance(index->cbegin(), index->cend()), 3);
+}
+
+TEST_F(HashIndexTest, ManyDistinctValues) {
+  // Multiples of a power of two are a bad case for hash tables that take the lower bits of the hash
+  auto int_values = std::vector<int64_t>{};
+  for (auto value = int64_t{0}; value < 10'000; ++value) {
+    int_values.emplace_back((value % 5'000) * 1024);
+  }
+  const auto int_segment = std::make_shared<ValueSegment<int64_t>>(std::move(int_values));
+  index = std::make_shared<HashIndex>(std::vector<std::shared_ptr<const BaseSegment>>({int_segment}));
+
+  for (auto value = int64_t{0}; value < 5'000; ++value) {
+    EXPECT_EQ(lookup(value * 1024), std::vector<ChunkOffset>({static_cast<ChunkOffset>(value),
+                                                              static_cast<ChunkOffset>(value + 5'000)}));
+  }
+  EXPECT_EQ(lookup(int64_t{1023}), std::vector<ChunkOffset>{});
+}
+
+TEST_F(HashIndexTest, EncodedSegment) {
+  const auto dictionary_segment = create_dict_segment_by_type<int32_t>(DataType::Int, {5, 3, 5, 7});
+  index = std::make_shared<HashIndex>(std::vector<std::shared_ptr<const BaseSegment>>({dictionary_segment}));
+
+  EXPECT_EQ(lookup(5), std::vector<ChunkOffset>({0, 2}));
+  EXPECT_EQ(lookup(7), std::vector<ChunkOffset>({3}));
+}
+
+TEST_F(HashIndexTest, MemoryConsumption) {
+  EXPECT_GT(index->memory_consumption(), 8 * sizeof(ChunkOffset) + 6 * sizeof(std::string));
+  EXPECT_EQ(BaseIndex::estimate_memory_consumption(SegmentIndexType::Hash, 8, 6, 32),
+            8 * sizeof(ChunkOffset) + 6 * (32 + sizeof(ChunkOffset)) + 16 * sizeof(uint32_t));
+}
+
+TEST_F(HashIndexTest, SupportedPredicates) {
+  EXPECT_TRUE(BaseIndex::supports(SegmentIndexType::Hash, PredicateCondition::Equals));
+  EXPECT_TRUE(BaseIndex::supports(SegmentIndexType::Hash, PredicateCondition::NotEquals));
+  EXPECT_FALSE(BaseIndex::supports(SegmentIndexType::Hash, PredicateCondition::LessThan));
+  EXPECT_FALSE(BaseIndex::supports(SegmentIndexType::Hash, PredicateCondition::Between));
+  EXPECT_TRUE(BaseIndex::supports(SegmentIndexType::GroupKey, PredicateCondition::Between));
+}
+
+TEST_F(HashIndexTest, KeyAccess) {
+  EXPECT_TRUE(index->supports_key_access());
+
+  auto keys = std::vector<std::pair<AllTypeVariant, ChunkOffset>>{};
+  const auto collect_keys = [&](const AllTypeVariant& value, const ChunkOffset row_count) {
+    keys.emplace_back(value, row_count);
+  };
+
+  index->for_each_key(index->lower_bound({"delta"}), index->upper_bound({"delta"}), collect_keys);
+  EXPECT_EQ(keys, (std::vector<std::pair<AllTypeVariant, ChunkOffset>>{{"delta", 2}}));
+
+  // The groups are not ordered by value
+  keys.clear();
+  index->for_each_key(index->cbegin(), index->cend(), collect_keys);
+  std::sort(keys.begin(), keys.end());
+  const auto expected_keys = std::vector<std::pair<AllTypeVariant, ChunkOffset>>{
+      {"apple", 1}, {"charlie", 2}, {"delta", 2}, {"frank", 1}, {"hotel", 1}, {"inbox", 1}};
+  EXPECT_EQ(keys, expected_keys);
+}
+
+}  // namespace opossum
@@ -0,0 +1,111 @@
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/create_iterable_from_segment.hpp"
+#include "storage/lz4_segment.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageLZ4SegmentTest : public BaseTest {
+ protected:
+  std::shared_ptr<ValueSegment<std::string>> vs_str = std::make_shared<ValueSegment<std::string>>(true);
+};
+
+TEST_F(StorageLZ4SegmentTest, CompressNullableSegmentString) {
+  vs_str->append("Alex");
+  vs_str->append("Peter");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("");
+  vs_str->append("Hasso");
+
+  auto segment = encode_segment(EncodingType::LZ4, DataType::String, vs_str);
+  auto lz4_segment = std::dynamic_pointer_cast<LZ4Segment<std::string>>(segment);
+  ASSERT_NE(lz4_segment, nullptr);
+
+  EXPECT_EQ(lz4_segment->encoding_type(), EncodingType::LZ4);
+  EXPECT_EQ(lz4_segment->compressed_vector_type(), std::nullopt);
+  EXPECT_EQ(lz4_segment->size(), 5u);
+  EXPECT_EQ(lz4_segment->block_count(), 1u);
+
+  EXPECT_EQ((*lz4_segment)[0], AllTypeVariant{"Alex"});
+  EXPECT_EQ((*lz4_segment)[1], AllTypeVariant{"Peter"});
+  EXPECT_TRUE(variant_is_null((*lz4_segment)[2]));
+  EXPECT_EQ((*lz4_segment)[3], AllTypeVariant{""});
+  EXPECT_EQ((*lz4_segment)[4], AllTypeVariant{"Hasso"});
+}
+
+TEST_F(StorageLZ4SegmentTest, CompressEmptySegment) {
+  auto segment = encode_segment(EncodingType::LZ4, DataType::String, vs_str);
+  auto lz4_segment = std::dynamic_pointer_cast<LZ4Segment<std::string>>(segment);
+
+  EXPECT_EQ(lz4_segment->size(), 0u);
+  EXPECT_EQ(lz4_segment->block_count(), 0u);
+}
+
+TEST_F(StorageLZ4SegmentTest, MultipleBlocks) {
+  const auto row_count = LZ4Segment<std::string>::block_size * 2 + 17;
+  for (auto index = 0u; index < row_count; ++index) {
+    vs_str->append("Value " + std::to_string(index));
+  }
+
+  auto segment = encode_segment(EncodingType::LZ4, DataType::String, vs_str);
+  auto lz4_segment = std::dynamic_pointer_cast<LZ4Segment<std::string>>(segment);
+
+  EXPECT_EQ(lz4_segment->size(), row_count);
+  EXPECT_EQ(lz4_segment->block_count(), 3u);
+
+  EXPECT_EQ(lz4_segment->get_typed_value(0u), "Value 0");
+  EXPECT_EQ(lz4_segment->get_typed_value(LZ4Segment<std::string>::block_size), "Value 4096");
+  EXPECT_EQ(lz4_segment->get_typed_value(row_count - 1), "Value " + std::to_string(row_count - 1));
+
+  auto index = 0u;
+  create_iterable_from_segment(*lz4_segment).for_each([&](const auto& position) {
+    EXPECT_FALSE(position.is_null());
+    EXPECT_EQ(position.value(), "Value " + std::to_string(index));
+    ++index;
+  });
+  EXPECT_EQ(index, row_count);
+}
+
+TEST_F(StorageLZ4SegmentTest, PointAccessAcrossBlocks) {
+  const auto row_count = LZ4Segment<std::string>::block_size * 2;
+  for (auto index = 0u; index < row_count; ++index) {
+    vs_str->append(std::to_string(index));
+  }
+
+  auto segment = encode_segment(EncodingType::LZ4, DataType::String, vs_str);
+  auto lz4_segment = std::dynamic_pointer_cast<LZ4Segment<std::string>>(segment);
+
+  auto position_filter = std::make_shared<PosList>();
+  position_filter->guarantee_single_chunk();
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{row_count - 1}});
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{3}});
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{4}});
+
+  auto values = std::vector<std::string>{};
+  create_iterable_from_segment(*lz4_segment).for_each(position_filter, [&](const auto& position) {
+    values.emplace_back(position.value());
+  });
+
+  EXPECT_EQ(values, (std::vector<std::string>{std::to_string(row_count - 1), "3", "4"}));
+}
+
+TEST_F(StorageLZ4SegmentTest, CompressesRepetitiveStrings) {
+  const auto row_count = LZ4Segment<std::string>::block_size * 4;
+  for (auto index = 0u; index < row_count; ++index) {
+    vs_str->append("carefully final deposits detect slyly agai" + std::to_string(index % 10));
+  }
+
+  auto segment = encode_segment(EncodingType::LZ4, DataType::String, vs_str);
+
+  EXPECT_LT(segment->estimate_memory_usage() * 3, vs_str->estimate_memory_usage());
+}
+
+}  // namespace opossum
@@ -6,6 +6,7 @@
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk.hpp"
 #include "storage/materialize.hpp"
+#include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -82,6 +83,24 @@ TEST_P(MaterializeTest, MaterializeTwoIntReferenceSegments) {
   EXPECT_EQ(values, (std::vector<int32_t>{1234, 12345, 123}));
 }
 
+TEST_P(MaterializeTest, MaterializeReferencesToMultipleChunks) {
+  // Unsorted PosLists that reference multiple chunks are gathered chunk by chunk and written to their original
+  // positions
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{1}, ChunkOffset{0}}, NULL_ROW_ID,
+                                                          RowID{ChunkID{0}, ChunkOffset{1}},
+                                                          RowID{ChunkID{0}, ChunkOffset{0}}});
+  const auto reference_segment = ReferenceSegment{_data_table, ColumnID{0}, pos_list};
+
+  EXPECT_EQ(materialize_values_to_vector<int32_t>(reference_segment), (std::vector<int32_t>{1234, 0, 123, 12345}));
+
+  const auto values_and_nulls = materialize_values_and_nulls_to_vector<int32_t>(reference_segment);
+  ASSERT_EQ(values_and_nulls.size(), 4u);
+  EXPECT_EQ(values_and_nulls[0], std::make_pair(false, 1234));
+  EXPECT_TRUE(values_and_nulls[1].first);
+  EXPECT_EQ(values_and_nulls[2], std::make_pair(false, 123));
+  EXPECT_EQ(values_and_nulls[3], std::make_pair(false, 12345));
+}
+
 TEST_P(MaterializeTest, MaterializeFloatData) {
   const auto floats_0 =
       materialize_values_to_vector<float>(*_data_table->get_chunk(ChunkID(0))->get_segment(ColumnID(1)));
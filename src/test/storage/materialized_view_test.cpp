@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/materialized_view.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class MaterializedViewTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("b", DataType::Int, true);
+    const auto table_t = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    table_t->append({1, 10});
+    table_t->append({1, 20});
+    table_t->append({2, 30});
+    table_t->append({3, NULL_VALUE});
+    make_rows_visible(*table_t);
+    StorageManager::get().add_table("t", table_t);
+
+    column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int);
+    column_definitions.emplace_back("c", DataType::Int);
+    const auto table_u = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+    table_u->append({1, 100});
+    table_u->append({2, 200});
+    make_rows_visible(*table_u);
+    StorageManager::get().add_table("u", table_u);
+
+    _t = StoredTableNode::make("t");
+    _t_a = _t->get_column("a");
+    _t_b = _t->get_column("b");
+    _u = StoredTableNode::make("u");
+    _u_a = _u->get_column("a");
+    _u_c = _u->get_column("c");
+  }
+
+  // Rows appended outside of transactions are uncommitted. Like load_table(), this makes them visible to everyone.
+  static void make_rows_visible(Table& table) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      auto mvcc_data = table.get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
+      std::fill(mvcc_data->begin_cids.begin(), mvcc_data->begin_cids.end(), CommitID{0});
+    }
+  }
+
+  static void insert(const std::string& table_name, const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto values = std::make_shared<Table>(StorageManager::get().get_table(table_name)->column_definitions(),
+                                                TableType::Data);
+    for (const auto& row : rows) {
+      values->append(row);
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->commit();
+  }
+
+  // Deletes the rows whose column @param column_id equals @param value
+  static void delete_rows(const std::string& table_name, const ColumnID column_id, const AllTypeVariant& value) {
+    const auto context = TransactionManager::get().new_transaction_context();
+    const auto get_table = std::make_shared<GetTable>(table_name);
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    const auto table_scan = create_table_scan(validate, column_id, PredicateCondition::Equals, value);
+    table_scan->execute();
+
+    const auto delete_operator = std::make_shared<Delete>(table_name, table_scan);
+    delete_operator->set_transaction_context(context);
+    delete_operator->execute();
+    context->commit();
+  }
+
+  // The rows of the view visible to @param context, or to a new transaction
+  static std::shared_ptr<const Table> view_rows(const MaterializedView& view,
+                                                std::shared_ptr<TransactionContext> context = nullptr) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(view.table());
+    table_wrapper->execute();
+    const auto validate = std::make_shared<Validate>(table_wrapper);
+    validate->set_transaction_context(context ? context : TransactionManager::get().new_transaction_context());
+    validate->execute();
+    return validate->get_output();
+  }
+
+  static std::shared_ptr<Table> expected_rows(const MaterializedView& view,
+                                              const std::vector<std::vector<AllTypeVariant>>& rows) {
+    const auto table = std::make_shared<Table>(view.table()->column_definitions(), TableType::Data);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  std::shared_ptr<StoredTableNode> _t, _u;
+  LQPColumnReference _t_a, _t_b, _u_a, _u_c;
+};
+
+TEST_F(MaterializedViewTest, SelectionAndProjection) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(_t_b, _t_a),
+    PredicateNode::make(greater_than_equals_(_t_b, 20),
+      ValidateNode::make(
+        _t)));
+  // clang-format on
+
+  auto view = MaterializedView{lqp, {{ColumnID{1}, "key"}}};
+  EXPECT_EQ(view.table()->column_name(ColumnID{0}), "b");
+  EXPECT_EQ(view.table()->column_name(ColumnID{1}), "key");
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{20, 1}, {30, 2}}));
+
+  const auto context_before_changes = TransactionManager::get().new_transaction_context();
+  insert("t", {{4, 40}, {5, 5}, {2, 30}});
+  delete_rows("t", ColumnID{0}, 1);
+
+  // The view only changes when it is refreshed
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{20, 1}, {30, 2}}));
+
+  view.refresh();
+  EXPECT_EQ(view.refreshed_commit_id(), TransactionManager::get().last_commit_id());
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{30, 2}, {30, 2}, {40, 4}}));
+
+  // Transactions that started before the changes still see the previous result
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view, context_before_changes), expected_rows(view, {{20, 1}, {30, 2}}));
+
+  // Both duplicates are removed
+  delete_rows("t", ColumnID{0}, 2);
+  view.refresh();
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{40, 4}}));
+}
+
+TEST_F(MaterializedViewTest, SumAndCount) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(_t_a, count_star_(), sum_(_t_b), count_(_t_b)),
+    AggregateNode::make(expression_vector(_t_a), expression_vector(sum_(_t_b), count_star_(), count_(_t_b)),
+      _t));
+  // clang-format on
+
+  auto view = MaterializedView{lqp};
+  EXPECT_EQ(view.table()->column_data_type(ColumnID{2}), DataType::Long);
+  EXPECT_TRUE(view.table()->column_is_nullable(ColumnID{2}));
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{1, int64_t{2}, int64_t{30}, int64_t{2}},
+                                                                  {2, int64_t{1}, int64_t{30}, int64_t{1}},
+                                                                  {3, int64_t{1}, NULL_VALUE, int64_t{0}}}));
+
+  insert("t", {{3, 7}, {4, 1}, {1, NULL_VALUE}});
+  delete_rows("t", ColumnID{0}, 2);
+  view.refresh();
+
+  // The group of the deleted rows is removed
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{1, int64_t{3}, int64_t{30}, int64_t{2}},
+                                                                  {3, int64_t{2}, int64_t{7}, int64_t{1}},
+                                                                  {4, int64_t{1}, int64_t{1}, int64_t{1}}}));
+
+  // Deleting the only non-NULL value of a group makes its sum NULL again
+  delete_rows("t", ColumnID{1}, 7);
+  view.refresh();
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{1, int64_t{3}, int64_t{30}, int64_t{2}},
+                                                                  {3, int64_t{1}, NULL_VALUE, int64_t{0}},
+                                                                  {4, int64_t{1}, int64_t{1}, int64_t{1}}}));
+}
+
+TEST_F(MaterializedViewTest, AggregateWithoutGroupBy) {
+  const auto lqp = AggregateNode::make(expression_vector(), expression_vector(sum_(_t_b), count_star_()), _t);
+
+  auto view = MaterializedView{lqp};
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{int64_t{60}, int64_t{4}}}));
+
+  // Without any rows, the aggregate still outputs a row
+  for (const auto value : {1, 2, 3}) {
+    delete_rows("t", ColumnID{0}, value);
+  }
+  view.refresh();
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{NULL_VALUE, int64_t{0}}}));
+}
+
+TEST_F(MaterializedViewTest, Join) {
+  // clang-format off
+  const auto lqp =
+  ProjectionNode::make(expression_vector(_t_b, _u_c),
+    JoinNode::make(JoinMode::Inner, equals_(_t_a, _u_a),
+      _t,
+      _u));
+  // clang-format on
+
+  auto view = MaterializedView{lqp};
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{10, 100}, {20, 100}, {30, 200}}));
+
+  // The joined row is only found by joining the new rows of t with the inserted rows of u
+  insert("t", {{5, 50}});
+  insert("u", {{5, 500}});
+  delete_rows("u", ColumnID{0}, 1);
+  view.refresh();
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{30, 200}, {50, 500}}));
+
+  // Rows deleted from both sides are removed only once
+  delete_rows("t", ColumnID{0}, 5);
+  delete_rows("u", ColumnID{0}, 5);
+  view.refresh();
+  EXPECT_TABLE_EQ_UNORDERED(view_rows(view), expected_rows(view, {{30, 200}}));
+}
+
+TEST_F(MaterializedViewTest, UnsupportedLQPs) {
+  const auto sort_lqp = SortNode::make(expression_vector(_t_a), std::vector<OrderByMode>{OrderByMode::Ascending}, _t);
+  const auto min_lqp = AggregateNode::make(expression_vector(_t_a), expression_vector(min_(_t_b)), _t);
+  const auto outer_join_lqp = JoinNode::make(JoinMode::Left, equals_(_t_a, _u_a), _t, _u);
+
+  // Aggregates above the aggregate, e.g., HAVING, are not supported
+  // clang-format off
+  const auto having_lqp =
+  PredicateNode::make(greater_than_(sum_(_t_b), 10),
+    AggregateNode::make(expression_vector(_t_a), expression_vector(sum_(_t_b)),
+      StoredTableNode::make("t")));
+  // clang-format on
+
+  const auto lqps = std::vector<std::shared_ptr<AbstractLQPNode>>{sort_lqp, min_lqp, outer_join_lqp, having_lqp};
+  for (const auto& lqp : lqps) {
+    EXPECT_FALSE(MaterializedView::is_supported(lqp));
+    EXPECT_THROW(MaterializedView{lqp}, std::logic_error);
+  }
+}
+
+TEST_F(MaterializedViewTest, StorageManager) {
+  const auto view = std::make_shared<MaterializedView>(PredicateNode::make(greater_than_(_t_a, 1), _t));
+
+  auto& storage_manager = StorageManager::get();
+  storage_manager.add_materialized_view("v", view);
+  EXPECT_TRUE(storage_manager.has_materialized_view("v"));
+  EXPECT_EQ(storage_manager.get_materialized_view("v"), view);
+  EXPECT_EQ(storage_manager.get_table("v"), view->table());
+  EXPECT_THROW(storage_manager.drop_table("v"), std::logic_error);
+  EXPECT_THROW(storage_manager.add_table("v", load_table("resources/test_data/tbl/int_int.tbl")), std::logic_error);
+
+  insert("t", {{4, 40}});
+  storage_manager.refresh_materialized_views();
+  EXPECT_EQ(view_rows(*view)->row_count(), 3u);
+
+  storage_manager.drop_materialized_view("v");
+  EXPECT_FALSE(storage_manager.has_materialized_view("v"));
+  EXPECT_FALSE(storage_manager.has_table("v"));
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageMvccDataTest : public BaseTest {};
+
+TEST_F(StorageMvccDataTest, LoadedRowsAreFullyVisible) {
+  const auto mvcc_data = std::make_shared<MvccData>(3);
+
+  EXPECT_TRUE(mvcc_data->is_fully_visible(CommitID{0}));
+
+  mvcc_data->grow_by(2, CommitID{4});
+  EXPECT_FALSE(mvcc_data->is_fully_visible(CommitID{3}));
+  EXPECT_TRUE(mvcc_data->is_fully_visible(CommitID{4}));
+}
+
+TEST_F(StorageMvccDataTest, UncommittedRowsAreNotFullyVisible) {
+  const auto mvcc_data = std::make_shared<MvccData>(3);
+  mvcc_data->grow_by(2, MvccData::MAX_COMMIT_ID);
+  EXPECT_FALSE(mvcc_data->is_fully_visible(CommitID{10}));
+
+  mvcc_data->register_committed_insert(CommitID{5});
+  EXPECT_FALSE(mvcc_data->is_fully_visible(CommitID{10}));
+
+  mvcc_data->register_committed_insert(CommitID{6});
+  EXPECT_FALSE(mvcc_data->is_fully_visible(CommitID{5}));
+  EXPECT_TRUE(mvcc_data->is_fully_visible(CommitID{6}));
+}
+
+TEST_F(StorageMvccDataTest, InvalidatedRowsAreNotFullyVisible) {
+  const auto mvcc_data = std::make_shared<MvccData>(3);
+  mvcc_data->register_invalidation();
+
+  EXPECT_FALSE(mvcc_data->is_fully_visible(CommitID{0}));
+  EXPECT_FALSE(mvcc_data->is_fully_visible(MvccData::MAX_COMMIT_ID));
+}
+
+TEST_F(StorageMvccDataTest, FrozenChunksAreCompressed) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{1, 2, 3, 4});
+  const auto chunk = std::make_shared<Chunk>(Segments{segment}, std::make_shared<MvccData>(4));
+  {
+    auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
+    mvcc_data->begin_cids[1] = CommitID{3};
+    mvcc_data->tids[2] = TransactionID{7};
+    mvcc_data->end_cids[2] = CommitID{5};
+    mvcc_data->tids[3] = TransactionID{8};
+  }
+
+  // Mutable chunks, locked rows, and rows changed after the horizon cannot be compressed
+  EXPECT_FALSE(chunk->try_compress_mvcc_data(CommitID{5}));
+  chunk->mark_immutable();
+  EXPECT_FALSE(chunk->try_compress_mvcc_data(CommitID{5}));
+  chunk->get_scoped_mvcc_data_lock()->tids[3] = TransactionID{0};
+  EXPECT_FALSE(chunk->try_compress_mvcc_data(CommitID{4}));
+  EXPECT_TRUE(chunk->try_compress_mvcc_data(CommitID{5}));
+
+  {
+    const auto mvcc_data = std::as_const(*chunk).get_scoped_mvcc_data_lock();
+    EXPECT_TRUE(mvcc_data->is_compressed());
+    EXPECT_TRUE(mvcc_data->tids.empty());
+    EXPECT_EQ(mvcc_data->size(), 4u);
+    EXPECT_EQ(mvcc_data->compressed_begin_cid(), CommitID{3});
+    EXPECT_EQ(mvcc_data->invalidated_rows().size(), 1u);
+
+    EXPECT_EQ(mvcc_data->begin_cid(0), CommitID{3});
+    EXPECT_EQ(mvcc_data->end_cid(0), MvccData::MAX_COMMIT_ID);
+    EXPECT_EQ(mvcc_data->tid(2), TransactionID{7});
+    EXPECT_EQ(mvcc_data->end_cid(2), CommitID{5});
+    EXPECT_EQ(mvcc_data->tid(3), TransactionID{0});
+  }
+
+  // Writers get the per-row vectors back
+  auto mvcc_data = chunk->get_scoped_mvcc_data_lock_for_writing();
+  EXPECT_FALSE(mvcc_data->is_compressed());
+  EXPECT_EQ(mvcc_data->begin_cids[0], CommitID{3});
+  EXPECT_EQ(mvcc_data->tids[2], TransactionID{7});
+  EXPECT_EQ(mvcc_data->end_cids[2], CommitID{5});
+  EXPECT_EQ(mvcc_data->end_cids[3], MvccData::MAX_COMMIT_ID);
+}
+
+}  // namespace opossum
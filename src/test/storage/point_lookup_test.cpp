@@ -0,0 +1,112 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/point_lookup.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class PointLookupTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 5);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  // The key position and the value of the only projected column of each row
+  static std::vector<std::pair<size_t, AllTypeVariant>> result_rows(const PointLookupResult& result) {
+    EXPECT_EQ(result.column_count, 1u);
+    auto rows = std::vector<std::pair<size_t, AllTypeVariant>>{};
+    for (auto row = size_t{0}; row < result.row_count(); ++row) {
+      rows.emplace_back(result.key_positions[row], result.value(row, 0));
+    }
+    return rows;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(PointLookupTest, LookupWithTableIndex) {
+  _table->create_table_index(ColumnID{0});
+  const auto point_lookup = PointLookup{_table, ColumnID{0}, {ColumnID{1}}};
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto result = point_lookup.execute({10, 3, NULL_VALUE, int64_t{0}}, context);
+
+  const auto expected_rows = std::vector<std::pair<size_t, AllTypeVariant>>{{0, 110}, {0, 110}, {3, 100}, {3, 100}};
+  EXPECT_EQ(result_rows(result), expected_rows);
+}
+
+TEST_F(PointLookupTest, LookupWithChunkIndexes) {
+  // The last chunk has no index and is scanned
+  ChunkEncoder::encode_all_chunks(_table);
+  _table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  _table->get_chunk(ChunkID{1})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  const auto point_lookup = PointLookup{_table, ColumnID{0}, {ColumnID{1}, ColumnID{0}}};
+
+  const auto context = TransactionManager::get().new_transaction_context();
+  const auto result = point_lookup.execute({12, 6, 5}, context);
+
+  ASSERT_EQ(result.row_count(), 4u);
+  EXPECT_EQ(result.column_count, 2u);
+  EXPECT_EQ(result.key_positions, std::vector<size_t>({0, 0, 1, 1}));
+  EXPECT_EQ(result.value(0, 0), AllTypeVariant{112});
+  EXPECT_EQ(result.value(1, 1), AllTypeVariant{12});
+  EXPECT_EQ(result.value(2, 0), AllTypeVariant{106});
+  EXPECT_EQ(result.value(3, 1), AllTypeVariant{6});
+}
+
+TEST_F(PointLookupTest, Visibility) {
+  _table->create_table_index(ColumnID{0});
+  const auto point_lookup = PointLookup{_table, ColumnID{0}, {ColumnID{1}}};
+  const auto old_context = TransactionManager::get().new_transaction_context();
+
+  // Delete the rows with a = 10
+  const auto delete_context = TransactionManager::get().new_transaction_context();
+  const auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(delete_context);
+  validate->execute();
+  const auto table_scan = create_table_scan(validate, ColumnID{0}, PredicateCondition::Equals, 10);
+  table_scan->execute();
+  const auto delete_operator = std::make_shared<Delete>("table_a", table_scan);
+  delete_operator->set_transaction_context(delete_context);
+  delete_operator->execute();
+  delete_context->commit();
+
+  // Insert a row with a = 10 without committing
+  const auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values->append({10, 1010});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+  const auto insert_context = TransactionManager::get().new_transaction_context();
+  const auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+
+  const auto old_rows = std::vector<std::pair<size_t, AllTypeVariant>>{{0, 110}, {0, 110}};
+  EXPECT_EQ(result_rows(point_lookup.execute({10}, old_context)), old_rows);
+
+  const auto inserted_rows = std::vector<std::pair<size_t, AllTypeVariant>>{{0, 1010}};
+  EXPECT_EQ(result_rows(point_lookup.execute({10}, insert_context)), inserted_rows);
+
+  EXPECT_TRUE(result_rows(point_lookup.execute({10}, TransactionManager::get().new_transaction_context())).empty());
+
+  insert_context->rollback();
+}
+
+}  // namespace opossum
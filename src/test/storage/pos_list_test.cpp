@@ -0,0 +1,187 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class PosListTest : public BaseTest {
+ protected:
+  static PosList create_pos_list(const std::vector<RowID>& row_ids) {
+    auto pos_list = PosList{};
+    for (const auto& row_id : row_ids) pos_list.emplace_back(row_id);
+    return pos_list;
+  }
+
+  static std::vector<RowID> row_ids(const PosList& pos_list) {
+    auto result = std::vector<RowID>{};
+    pos_list.for_each_row_id([&](const RowID& row_id) { result.emplace_back(row_id); });
+    return result;
+  }
+};
+
+TEST_F(PosListTest, ChunkRange) {
+  auto pos_list = PosList{};
+  pos_list.set_chunk_range(ChunkID{2}, 3, 6);
+
+  EXPECT_EQ(pos_list.representation(), PosList::Representation::Range);
+  EXPECT_EQ(pos_list.chunk_range(), std::make_pair(ChunkOffset{3}, ChunkOffset{6}));
+  EXPECT_TRUE(pos_list.references_single_chunk());
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{2});
+  EXPECT_EQ(pos_list.size(), 3u);
+  EXPECT_EQ(pos_list.estimate_memory_usage(), 0u);
+
+  const auto expected_row_ids = std::vector<RowID>{{ChunkID{2}, 3}, {ChunkID{2}, 4}, {ChunkID{2}, 5}};
+  EXPECT_EQ(row_ids(pos_list), expected_row_ids);
+  EXPECT_FALSE(pos_list.references_entire_chunk(6));
+
+  // The const accessors materialize the RowIDs without changing the representation
+  const auto& const_pos_list = pos_list;
+  EXPECT_EQ(const_pos_list[1], (RowID{ChunkID{2}, 4}));
+  EXPECT_EQ(std::vector<RowID>(const_pos_list.cbegin(), const_pos_list.cend()), expected_row_ids);
+  EXPECT_EQ(pos_list.representation(), PosList::Representation::Range);
+
+  auto entire_chunk = PosList{};
+  entire_chunk.set_chunk_range(ChunkID{0}, 0, 6);
+  EXPECT_TRUE(entire_chunk.references_entire_chunk(6));
+  EXPECT_FALSE(entire_chunk.references_entire_chunk(7));
+}
+
+TEST_F(PosListTest, CompactToRange) {
+  auto pos_list = create_pos_list({{ChunkID{1}, 4}, {ChunkID{1}, 5}, {ChunkID{1}, 6}, {ChunkID{1}, 7}});
+  EXPECT_TRUE(pos_list.compact(10));
+
+  EXPECT_EQ(pos_list.representation(), PosList::Representation::Range);
+  EXPECT_EQ(pos_list.chunk_range(), std::make_pair(ChunkOffset{4}, ChunkOffset{8}));
+  EXPECT_EQ(pos_list.size(), 4u);
+  EXPECT_EQ(pos_list.capacity(), 0u);
+}
+
+TEST_F(PosListTest, CompactToBitmap) {
+  auto expected_row_ids = std::vector<RowID>{};
+  for (auto chunk_offset = ChunkOffset{1}; chunk_offset < 200; chunk_offset += 3) {
+    expected_row_ids.emplace_back(ChunkID{3}, chunk_offset);
+  }
+
+  auto pos_list = create_pos_list(expected_row_ids);
+  EXPECT_TRUE(pos_list.compact(200));
+
+  EXPECT_EQ(pos_list.representation(), PosList::Representation::Bitmap);
+  EXPECT_EQ(pos_list.chunk_bitmap().size(), 4u);
+  EXPECT_EQ(pos_list.common_chunk_id(), ChunkID{3});
+  EXPECT_EQ(pos_list.size(), expected_row_ids.size());
+  EXPECT_EQ(row_ids(pos_list), expected_row_ids);
+  EXPECT_EQ(pos_list, create_pos_list(expected_row_ids));
+}
+
+TEST_F(PosListTest, CompactOnlyUsefulRepresentations) {
+  // Few rows of a large chunk take less memory as RowIDs
+  auto sparse = create_pos_list({{ChunkID{0}, 1}, {ChunkID{0}, 1000}});
+  EXPECT_FALSE(sparse.compact(2000));
+
+  auto unordered = create_pos_list({{ChunkID{0}, 2}, {ChunkID{0}, 1}});
+  EXPECT_FALSE(unordered.compact(3));
+
+  auto duplicates = create_pos_list({{ChunkID{0}, 1}, {ChunkID{0}, 1}});
+  EXPECT_FALSE(duplicates.compact(3));
+
+  auto multiple_chunks = create_pos_list({{ChunkID{0}, 1}, {ChunkID{1}, 2}});
+  EXPECT_FALSE(multiple_chunks.compact(3));
+
+  auto with_null = create_pos_list({NULL_ROW_ID, {ChunkID{0}, 1}});
+  EXPECT_FALSE(with_null.compact(3));
+
+  auto empty = PosList{};
+  EXPECT_FALSE(empty.compact(3));
+
+  for (const auto* pos_list : {&sparse, &unordered, &duplicates, &multiple_chunks, &with_null, &empty}) {
+    EXPECT_EQ(pos_list->representation(), PosList::Representation::RowIDs);
+  }
+  EXPECT_EQ(sparse.size(), 2u);
+}
+
+TEST_F(PosListTest, ModificationsRestoreRowIDs) {
+  auto pos_list = PosList{};
+  pos_list.set_chunk_range(ChunkID{0}, 0, 2);
+  pos_list.emplace_back(ChunkID{0}, 5);
+
+  EXPECT_EQ(pos_list.representation(), PosList::Representation::RowIDs);
+  EXPECT_EQ(pos_list, create_pos_list({{ChunkID{0}, 0}, {ChunkID{0}, 1}, {ChunkID{0}, 5}}));
+
+  pos_list.set_chunk_range(ChunkID{0}, 0, 2);
+  pos_list[1] = RowID{ChunkID{0}, 7};
+  EXPECT_EQ(pos_list.representation(), PosList::Representation::RowIDs);
+  EXPECT_EQ(pos_list, create_pos_list({{ChunkID{0}, 0}, {ChunkID{0}, 7}}));
+
+  pos_list.set_chunk_range(ChunkID{0}, 0, 2);
+  pos_list.clear();
+  EXPECT_EQ(pos_list.representation(), PosList::Representation::RowIDs);
+  EXPECT_TRUE(pos_list.empty());
+}
+
+TEST_F(PosListTest, Move) {
+  auto pos_list = PosList{};
+  pos_list.set_chunk_range(ChunkID{1}, 2, 4);
+
+  const auto moved_pos_list = std::move(pos_list);
+  EXPECT_EQ(moved_pos_list.representation(), PosList::Representation::Range);
+  EXPECT_EQ(moved_pos_list, create_pos_list({{ChunkID{1}, 2}, {ChunkID{1}, 3}}));
+}
+
+TEST_F(PosListTest, ReferenceSegmentsWithCompactPosLists) {
+  auto column_definitions = TableColumnDefinitions{};
+  column_definitions.emplace_back("a", DataType::Int, true);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, 100);
+  for (auto value = 0; value < 200; ++value) {
+    table->append({value % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, {EncodingType::Dictionary});
+
+  const auto range = std::make_shared<PosList>();
+  range->set_chunk_range(ChunkID{1}, 10, 90);
+
+  auto bitmap = std::make_shared<PosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 100; chunk_offset += 2) {
+    bitmap->emplace_back(ChunkID{0}, chunk_offset);
+  }
+  ASSERT_TRUE(bitmap->compact(100));
+
+  for (const auto& pos_list : {range, bitmap}) {
+    const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+
+    auto expected_values = std::vector<AllTypeVariant>{};
+    pos_list->for_each_row_id([&](const RowID& row_id) {
+      expected_values.emplace_back((*table->get_chunk(row_id.chunk_id)->get_segment(ColumnID{0}))[row_id.chunk_offset]);
+    });
+
+    auto values = std::vector<AllTypeVariant>{};
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    segment_iterate<int32_t>(reference_segment, [&](const auto& position) {
+      values.emplace_back(position.is_null() ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{position.value()});
+      chunk_offsets.emplace_back(position.chunk_offset());
+    });
+
+    // Iterating does not need the RowIDs
+    EXPECT_EQ(pos_list->estimate_memory_usage(), pos_list == range ? 0u : 2 * sizeof(uint64_t));
+
+    const auto equals = [](const AllTypeVariant& lhs, const AllTypeVariant& rhs) {
+      return variant_is_null(lhs) ? variant_is_null(rhs) : lhs == rhs;
+    };
+
+    ASSERT_EQ(values.size(), expected_values.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      EXPECT_TRUE(equals(values[chunk_offset], expected_values[chunk_offset]));
+      EXPECT_TRUE(equals(reference_segment[chunk_offset], expected_values[chunk_offset]));
+      EXPECT_EQ(chunk_offsets[chunk_offset], chunk_offset);
+    }
+  }
+}
+
+}  // namespace opossum
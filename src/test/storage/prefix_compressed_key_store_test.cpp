@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/index/group_key/prefix_compressed_key_store.hpp"
+#include "storage/index/group_key/variable_length_key_proxy.hpp"
+#include "storage/index/group_key/variable_length_key_store.hpp"
+
+#include "types.hpp"
+
+namespace opossum {
+
+class PrefixCompressedKeyStoreTest : public BaseTest {
+ protected:
+  // Concatenates the parts with the given byte widths, like the CompositeGroupKeyIndex does
+  static VariableLengthKey create_key(const std::vector<uint64_t>& parts, const std::vector<uint8_t>& byte_widths) {
+    auto bytes_per_key = CompositeKeyLength{0};
+    for (const auto byte_width : byte_widths) bytes_per_key += byte_width;
+
+    auto key = VariableLengthKey(bytes_per_key);
+    for (auto part_id = size_t{0}; part_id < parts.size(); ++part_id) {
+      key.shift_and_set(parts[part_id], static_cast<uint8_t>(byte_widths[part_id] * 8));
+    }
+    return key;
+  }
+
+  static VariableLengthKeyStore create_store(const std::vector<VariableLengthKey>& sorted_keys) {
+    const auto bytes_per_key = sorted_keys.front().bytes_per_key();
+    auto store = VariableLengthKeyStore(static_cast<ChunkOffset>(sorted_keys.size()), bytes_per_key);
+    for (auto position = ChunkOffset{0}; position < sorted_keys.size(); ++position) {
+      store[position] = sorted_keys[position];
+    }
+    return store;
+  }
+
+  // Checks all keys and lower bounds against the uncompressed keys
+  static void check_store(const std::vector<VariableLengthKey>& sorted_keys,
+                          const std::vector<VariableLengthKey>& search_keys) {
+    const auto store = PrefixCompressedKeyStore(create_store(sorted_keys));
+    ASSERT_EQ(store.size(), sorted_keys.size());
+
+    for (auto position = ChunkOffset{0}; position < sorted_keys.size(); ++position) {
+      EXPECT_EQ(store[position], sorted_keys[position]);
+      EXPECT_EQ(store.lower_bound(sorted_keys[position]), position);
+    }
+
+    for (const auto& search_key : search_keys) {
+      const auto expected = std::lower_bound(sorted_keys.cbegin(), sorted_keys.cend(), search_key);
+      EXPECT_EQ(store.lower_bound(search_key), static_cast<ChunkOffset>(std::distance(sorted_keys.cbegin(), expected)))
+          << search_key;
+    }
+  }
+};
+
+TEST_F(PrefixCompressedKeyStoreTest, EmptyStore) {
+  const auto store = PrefixCompressedKeyStore(VariableLengthKeyStore(0, sizeof(uint32_t)));
+  EXPECT_EQ(store.size(), 0u);
+  EXPECT_EQ(store.key_size(), sizeof(uint32_t));
+  EXPECT_EQ(store.lower_bound(create_key({7}, {4})), 0u);
+}
+
+TEST_F(PrefixCompressedKeyStoreTest, SingleKey) {
+  check_store({create_key({5}, {4})}, {create_key({0}, {4}), create_key({5}, {4}), create_key({6}, {4})});
+}
+
+TEST_F(PrefixCompressedKeyStoreTest, CompositeKeys) {
+  // Keys of (tenant, date, customer), where the leading parts rarely change
+  const auto byte_widths = std::vector<uint8_t>{1, 2, 4};
+  auto sorted_keys = std::vector<VariableLengthKey>{};
+  auto search_keys = std::vector<VariableLengthKey>{};
+  for (auto tenant = uint64_t{0}; tenant < 3; ++tenant) {
+    for (auto date = uint64_t{10}; date < 300; date += 7) {
+      for (auto customer = uint64_t{1}; customer < 70'000; customer += 9'999) {
+        sorted_keys.emplace_back(create_key({tenant, date, customer}, byte_widths));
+        search_keys.emplace_back(create_key({tenant, date, customer - 1}, byte_widths));
+        search_keys.emplace_back(create_key({tenant, date, customer + 1}, byte_widths));
+      }
+      search_keys.emplace_back(create_key({tenant, date + 1, 0}, byte_widths));
+    }
+  }
+  search_keys.emplace_back(create_key({0, 0, 0}, byte_widths));
+  search_keys.emplace_back(create_key({255, 65'535, 0xFFFFFFFF}, byte_widths));
+
+  check_store(sorted_keys, search_keys);
+
+  // The seven-byte keys take eight bytes each when uncompressed
+  const auto store = PrefixCompressedKeyStore(create_store(sorted_keys));
+  EXPECT_LT(store.memory_consumption(), sorted_keys.size() * 8);
+}
+
+TEST_F(PrefixCompressedKeyStoreTest, DenseKeys) {
+  // Consecutive value ids only differ in the least significant byte within a block
+  auto sorted_keys = std::vector<VariableLengthKey>{};
+  auto search_keys = std::vector<VariableLengthKey>{};
+  for (auto value = uint64_t{0}; value < 1'000; ++value) {
+    sorted_keys.emplace_back(create_key({value * 2}, {4}));
+    search_keys.emplace_back(create_key({value * 2 + 1}, {4}));
+  }
+
+  check_store(sorted_keys, search_keys);
+
+  const auto store = PrefixCompressedKeyStore(create_store(sorted_keys));
+  EXPECT_LT(store.memory_consumption(), sorted_keys.size() * 8 / 3);
+}
+
+TEST_F(PrefixCompressedKeyStoreTest, LongSuffixes) {
+  // Suffixes of more than eight bytes are compared byte by byte
+  const auto byte_widths = std::vector<uint8_t>{4, 4, 4};
+  auto sorted_keys = std::vector<VariableLengthKey>{};
+  auto search_keys = std::vector<VariableLengthKey>{};
+  for (auto part = uint64_t{0}; part < 100; ++part) {
+    sorted_keys.emplace_back(create_key({part * 3, part % 7, part * 11}, byte_widths));
+    search_keys.emplace_back(create_key({part * 3, part % 7, part * 11 + 1}, byte_widths));
+    search_keys.emplace_back(create_key({part * 3 + 1, 0, 0}, byte_widths));
+  }
+
+  check_store(sorted_keys, search_keys);
+}
+
+}  // namespace opossum
@@ -0,0 +1,114 @@
+#include <memory>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "expression/expression_functional.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_access_statistics.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SegmentAccessStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 12345, 123, and 1234 in two chunks
+    table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+    segment = table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  }
+
+  std::shared_ptr<Table> table;
+  std::shared_ptr<BaseSegment> segment;
+};
+
+TEST_F(SegmentAccessStatisticsTest, IterationCountsSequentialScan) {
+  segment_iterate<int32_t>(*segment, [](const auto& /*position*/) {});
+
+  const auto& statistics = segment->access_statistics();
+  EXPECT_EQ(statistics.sequential_scan_count(), 1u);
+  EXPECT_EQ(statistics.sequential_row_count(), 2u);
+  EXPECT_EQ(statistics.point_access_count(), 0u);
+}
+
+TEST_F(SegmentAccessStatisticsTest, FilteredIterationCountsPointAccesses) {
+  const auto position_filter = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, ChunkOffset{1}}});
+  position_filter->guarantee_single_chunk();
+  segment_iterate_filtered<int32_t>(*segment, position_filter, [](const auto& /*position*/) {});
+
+  const auto& statistics = segment->access_statistics();
+  EXPECT_EQ(statistics.sequential_scan_count(), 0u);
+  EXPECT_EQ(statistics.point_access_count(), 1u);
+}
+
+TEST_F(SegmentAccessStatisticsTest, AccessorCountsWhenDestroyed) {
+  {
+    const auto accessor = create_segment_accessor<int32_t>(segment);
+    accessor->access(ChunkOffset{0});
+    accessor->access(ChunkOffset{1});
+    accessor->access(ChunkOffset{1});
+    EXPECT_EQ(segment->access_statistics().point_access_count(), 0u);
+  }
+  EXPECT_EQ(segment->access_statistics().point_access_count(), 3u);
+}
+
+TEST_F(SegmentAccessStatisticsTest, ReferenceSegmentCountsAccessesOfReferencedSegments) {
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{1}, ChunkOffset{0}},
+                                                          RowID{ChunkID{0}, ChunkOffset{1}},
+                                                          RowID{ChunkID{0}, ChunkOffset{0}}});
+  const auto reference_segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+  segment_iterate<int32_t>(reference_segment, [](const auto& /*position*/) {});
+
+  EXPECT_EQ(segment->access_statistics().point_access_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})->access_statistics().point_access_count(), 1u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->get_segment(ColumnID{1})->access_statistics().point_access_count(), 0u);
+}
+
+TEST_F(SegmentAccessStatisticsTest, TableScanCountsPredicates) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto scan_a = std::make_shared<TableScan>(table_wrapper, greater_than_(column_a, 200));
+  scan_a->execute();
+  const auto scan_b = std::make_shared<TableScan>(scan_a, less_than_equals_(column_a, 1234));
+  scan_b->execute();
+
+  // The second scan reads the rows the first one left through ReferenceSegments
+  const auto& statistics = segment->access_statistics();
+  EXPECT_EQ(statistics.predicate_count(PredicateCondition::GreaterThan), 1u);
+  EXPECT_EQ(statistics.predicate_count(PredicateCondition::LessThanEquals), 1u);
+  EXPECT_EQ(statistics.predicate_count(PredicateCondition::Equals), 0u);
+  EXPECT_EQ(statistics.sequential_scan_count(), 1u);
+  EXPECT_EQ(statistics.point_access_count(), 1u);
+  EXPECT_EQ(statistics.predicates_to_string(), ">:1,<=:1");
+
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->get_segment(ColumnID{1})->access_statistics().predicates_to_string(), "");
+}
+
+TEST_F(SegmentAccessStatisticsTest, ToTable) {
+  StorageManager::get().add_table("int_float", table);
+  segment_iterate<int32_t>(*segment, [](const auto& /*position*/) {});
+
+  const auto statistics_table = SegmentAccessStatistics::to_table();
+  ASSERT_EQ(statistics_table->row_count(), 4u);
+  EXPECT_EQ(statistics_table->get_value<std::string>(ColumnID{0}, 0u), "int_float");
+  EXPECT_EQ(statistics_table->get_value<int32_t>(ColumnID{1}, 0u), 0);
+  EXPECT_EQ(statistics_table->get_value<std::string>(ColumnID{3}, 0u), "a");
+  EXPECT_EQ(statistics_table->get_value<std::string>(ColumnID{4}, 0u), "Unencoded");
+  EXPECT_EQ(statistics_table->get_value<int64_t>(ColumnID{5}, 0u), 1);
+  EXPECT_EQ(statistics_table->get_value<int64_t>(ColumnID{6}, 0u), 2);
+  EXPECT_EQ(statistics_table->get_value<int64_t>(ColumnID{5}, 1u), 0);
+
+  SegmentAccessStatistics::reset_all();
+  EXPECT_EQ(segment->access_statistics().sequential_scan_count(), 0u);
+}
+
+}  // namespace opossum
@@ -1,4 +1,6 @@
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -101,4 +103,30 @@ TEST_F(SegmentAccessorTest, TestReferenceSegmentToDictionarySegmentString) {
   EXPECT_EQ(rc_str_accessor->access(ChunkOffset{2}), "Hello,");
 }
 
+TEST_F(SegmentAccessorTest, SegmentWithAccessor) {
+  const auto single_chunk_pos_list = std::make_shared<PosList>(PosList{
+      {RowID{ChunkID{0}, ChunkOffset{1}}, RowID{ChunkID{0}, ChunkOffset{2}}, RowID{ChunkID{0}, ChunkOffset{0}}}});
+  single_chunk_pos_list->guarantee_single_chunk();
+  const auto single_chunk_rc_str = ReferenceSegment{tbl, ColumnID{1}, single_chunk_pos_list};
+
+  // Single-chunk ReferenceSegments are resolved to the type of the referenced segment, others are dispatched per access
+  for (const auto* segment : std::vector<const BaseSegment*>{&single_chunk_rc_str, rc_str.get()}) {
+    segment_with_accessor<std::string>(*segment, [&](const auto& accessor) {
+      accessor.prefetch(ChunkOffset{2});
+      EXPECT_EQ(accessor.access(ChunkOffset{0}), "world");
+      EXPECT_EQ(accessor.access(ChunkOffset{2}), "Hello,");
+    });
+  }
+
+  segment_with_accessor<int>(*dc_int, [&](const auto& accessor) {
+    accessor.prefetch(ChunkOffset{1});
+    EXPECT_EQ(accessor.access(ChunkOffset{1}), 6);
+  });
+
+  segment_with_accessor<int, EraseTypes::Always>(*vc_int, [&](const auto& accessor) {
+    EXPECT_TRUE((std::is_same_v<std::decay_t<decltype(accessor)>, BaseSegmentAccessor<int>>));
+    EXPECT_EQ(accessor.access(ChunkOffset{2}), 3);
+  });
+}
+
 }  // namespace opossum
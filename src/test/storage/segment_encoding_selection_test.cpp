@@ -0,0 +1,95 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/segment_encoding_selection.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class SegmentEncodingSelectionTest : public BaseTest {
+ protected:
+  static constexpr auto row_count = 10'000u;
+};
+
+TEST_F(SegmentEncodingSelectionTest, EmptySegment) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>();
+
+  EXPECT_EQ(select_segment_encoding_spec(DataType::Int, segment).encoding_type, EncodingType::Dictionary);
+}
+
+TEST_F(SegmentEncodingSelectionTest, SortedUniqueValuesUseDeltaEncoding) {
+  const auto segment = std::make_shared<ValueSegment<int64_t>>();
+  auto timestamp = int64_t{1'500'000'000'000};
+  for (auto row = 0u; row < row_count; ++row) {
+    timestamp += row % 3 + 1;
+    segment->append(timestamp);
+  }
+
+  const auto spec = select_segment_encoding_spec(DataType::Long, segment);
+  EXPECT_EQ(spec.encoding_type, EncodingType::Delta);
+  EXPECT_EQ(spec.vector_compression_type, VectorCompressionType::SimdBp128);
+}
+
+TEST_F(SegmentEncodingSelectionTest, OutlierBetweenSampledWindows) {
+  // The jump at row 3'500 lies between two sampled windows. Neither its delta nor the value range of its block fit
+  // into 32 bits.
+  const auto segment = std::make_shared<ValueSegment<int64_t>>();
+  auto timestamp = int64_t{1'500'000'000'000};
+  for (auto row = 0u; row < row_count; ++row) {
+    timestamp += row == 3'500u ? int64_t{1} << 40 : row % 3 + 1;
+    segment->append(timestamp);
+  }
+
+  const auto spec = select_segment_encoding_spec(DataType::Long, segment);
+  EXPECT_NE(spec.encoding_type, EncodingType::Delta);
+  EXPECT_NE(spec.encoding_type, EncodingType::FrameOfReference);
+}
+
+TEST_F(SegmentEncodingSelectionTest, LongRunsUseRunLengthEncoding) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(true);
+  for (auto row = 0u; row < row_count; ++row) {
+    if (row / 1'000 == 4) {
+      segment->append(NULL_VALUE);
+    } else {
+      segment->append(static_cast<int32_t>(row / 1'000));
+    }
+  }
+
+  EXPECT_EQ(select_segment_encoding_spec(DataType::Int, segment).encoding_type, EncodingType::RunLength);
+}
+
+TEST_F(SegmentEncodingSelectionTest, NarrowValueRangeUsesFrameOfReference) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    segment->append(static_cast<int32_t>(1'000'000'000 + (row * 7919) % 200));
+  }
+
+  const auto spec = select_segment_encoding_spec(DataType::Int, segment);
+  EXPECT_EQ(spec.encoding_type, EncodingType::FrameOfReference);
+  EXPECT_EQ(spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+}
+
+TEST_F(SegmentEncodingSelectionTest, ShortStringsUseFixedStringDictionary) {
+  const auto segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    segment->append(std::string{static_cast<char>('A' + (row * 7) % 5)});
+  }
+
+  const auto spec = select_segment_encoding_spec(DataType::String, segment);
+  EXPECT_EQ(spec.encoding_type, EncodingType::FixedStringDictionary);
+  EXPECT_EQ(spec.vector_compression_type, VectorCompressionType::SimdBp128);
+}
+
+TEST_F(SegmentEncodingSelectionTest, VaryingStringLengthsUseDictionary) {
+  const auto segment = std::make_shared<ValueSegment<std::string>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    segment->append(row == 0u ? std::string(200, 'x') : std::to_string(row % 1'000));
+  }
+
+  EXPECT_EQ(select_segment_encoding_spec(DataType::String, segment).encoding_type, EncodingType::Dictionary);
+}
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/shared_dictionaries.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+
+namespace opossum {
+
+class SharedDictionariesTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 12 rows in three chunks
+    _expected_table = load_table("resources/test_data/tbl/compression_input.tbl", 4u);
+    _table = load_table("resources/test_data/tbl/compression_input.tbl", 4u);
+  }
+
+  template <typename T>
+  std::shared_ptr<const DictionarySegment<T>> dictionary_segment(const ChunkID chunk_id,
+                                                                 const ColumnID column_id) const {
+    return std::dynamic_pointer_cast<const DictionarySegment<T>>(_table->get_chunk(chunk_id)->get_segment(column_id));
+  }
+
+  std::shared_ptr<Table> _expected_table;
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(SharedDictionariesTest, SharesDictionaryAcrossChunks) {
+  ChunkEncoder::encode_all_chunks(_table);
+  EXPECT_TRUE(segments_with_shared_dictionary(*_table, ColumnID{0}).empty());
+
+  share_dictionaries(_table, ColumnID{0});
+
+  const auto segments = segments_with_shared_dictionary(*_table, ColumnID{0});
+  ASSERT_EQ(segments.size(), 3u);
+
+  const auto dictionary = dictionary_segment<std::string>(ChunkID{0}, ColumnID{0})->dictionary();
+  EXPECT_EQ(*dictionary, (pmr_vector<std::string>{"bar", "foo", "hurz"}));
+  EXPECT_EQ(dictionary_segment<std::string>(ChunkID{2}, ColumnID{0})->dictionary(), dictionary);
+
+  // Equal values have equal value IDs in all chunks
+  EXPECT_EQ(segments[0]->attribute_vector()->create_base_decompressor()->get(1u),
+            segments[2]->attribute_vector()->create_base_decompressor()->get(3u));
+
+  // The other column is not affected
+  EXPECT_TRUE(segments_with_shared_dictionary(*_table, ColumnID{1}).empty());
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(SharedDictionariesTest, SharesDictionaryIncrementally) {
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}});
+  share_dictionaries(_table, ColumnID{1});
+
+  const auto dictionary = dictionary_segment<int32_t>(ChunkID{0}, ColumnID{1})->dictionary();
+  EXPECT_EQ(dictionary_segment<int32_t>(ChunkID{1}, ColumnID{1})->dictionary(), dictionary);
+
+  // The unencoded chunk is left untouched
+  EXPECT_TRUE(segments_with_shared_dictionary(*_table, ColumnID{1}).empty());
+
+  ChunkEncoder::encode_chunks(_table, {ChunkID{2}});
+  share_dictionaries(_table, ColumnID{1});
+
+  // The last chunk contains no new values, so the other segments keep their dictionary
+  EXPECT_EQ(dictionary_segment<int32_t>(ChunkID{0}, ColumnID{1})->dictionary(), dictionary);
+  EXPECT_EQ(dictionary_segment<int32_t>(ChunkID{2}, ColumnID{1})->dictionary(), dictionary);
+  EXPECT_EQ(segments_with_shared_dictionary(*_table, ColumnID{1}).size(), 3u);
+
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(SharedDictionariesTest, KeepsVectorCompression) {
+  ChunkEncoder::encode_all_chunks(_table,
+                                  SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128});
+  share_dictionaries(_table, ColumnID{0});
+
+  EXPECT_EQ(dictionary_segment<std::string>(ChunkID{1}, ColumnID{0})->compressed_vector_type(),
+            CompressedVectorType::SimdBp128);
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(SharedDictionariesTest, NullValues) {
+  _expected_table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2u);
+  _table = load_table("resources/test_data/tbl/int_float_with_null.tbl", 2u);
+  ChunkEncoder::encode_all_chunks(_table);
+
+  share_dictionaries(_table, ColumnID{0});
+
+  EXPECT_FALSE(segments_with_shared_dictionary(*_table, ColumnID{0}).empty());
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+}  // namespace opossum
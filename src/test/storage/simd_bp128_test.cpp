@@ -2,15 +2,18 @@
 #include <boost/hana/map.hpp>
 #include <boost/hana/pair.hpp>
 
+#include <algorithm>
 #include <bitset>
 #include <iostream>
 #include <memory>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "storage/vector_compression/simd_bp128/simd_bp128_compressor.hpp"
 #include "storage/vector_compression/simd_bp128/simd_bp128_decompressor.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
 #include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 
@@ -62,7 +65,7 @@ class SimdBp128Test : public BaseTest, public ::testing::WithParamInterface<uint
     return compressed_vector;
   }
 
- private:
+ protected:
   uint8_t _bit_size;
   uint32_t _min;
   uint32_t _max;
@@ -103,4 +106,55 @@ TEST_P(SimdBp128Test, DecompressSequenceUsingDecompressor) {
   }
 }
 
+TEST_P(SimdBp128Test, MatchRangesWithoutDecompression) {
+  const auto sequence = generate_sequence(4'200);
+  const auto compressed_sequence_base = compress(sequence);
+  const auto& compressed_sequence = static_cast<const SimdBp128Vector&>(*compressed_sequence_base);
+
+  // The sequence contains all values of [_min, _max]. Pick a range in the middle of it and exclude its first value.
+  const auto include_begin = _min + (_max - _min) / 4u;
+  const auto include_end = _max - (_max - _min) / 4u;
+  const auto ranges = SimdBp128Packing::MatchRanges{include_begin, include_end, include_begin, include_begin + 1u};
+
+  auto expected_matches = std::vector<size_t>{};
+  for (auto index = size_t{0u}; index < sequence.size(); ++index) {
+    const auto value = sequence[index];
+    if (value > include_begin && value < include_end) expected_matches.push_back(index);
+  }
+
+  auto matches = std::vector<size_t>{};
+  compressed_sequence.for_each_match(ranges, [&](const size_t index) { matches.push_back(index); });
+
+  EXPECT_EQ(matches, expected_matches);
+}
+
+TEST_P(SimdBp128Test, MatchDoesNotReportPadding) {
+  // Zeros are used to pad the last block and must not be reported even if zero matches
+  const auto sequence = pmr_vector<uint32_t>(130u, 0u);
+  const auto compressed_sequence_base = compress(sequence);
+  const auto& compressed_sequence = static_cast<const SimdBp128Vector&>(*compressed_sequence_base);
+
+  auto match_count = size_t{0u};
+  compressed_sequence.for_each_match(SimdBp128Packing::MatchRanges{0u, 1u}, [&](const size_t) { ++match_count; });
+
+  EXPECT_EQ(match_count, 130u);
+}
+
+TEST_P(SimdBp128Test, UnpackWithAllRegisterWidths) {
+  const auto sequence = generate_sequence(SimdBp128Packing::block_size);
+
+  // The padding is filled with ones, which must not end up in the unpacked integers
+  const auto all_ones = uint128_t{~0u, ~0u, ~0u, ~0u};
+  auto packed_block = std::vector<uint128_t>(_bit_size + SimdBp128Packing::trailing_padding, all_ones);
+  std::fill(packed_block.begin(), packed_block.begin() + _bit_size, uint128_t{});
+  SimdBp128Packing::pack_block(sequence.data(), packed_block.data(), _bit_size);
+
+  for (auto register_width = 128u; register_width <= SimdBp128Packing::max_register_width(); register_width *= 2u) {
+    auto unpacked_block = std::vector<uint32_t>(SimdBp128Packing::block_size);
+    SimdBp128Packing::unpack_block(packed_block.data(), unpacked_block.data(), _bit_size, register_width);
+
+    EXPECT_TRUE(std::equal(unpacked_block.cbegin(), unpacked_block.cend(), sequence.cbegin())) << register_width;
+  }
+}
+
 }  // namespace opossum
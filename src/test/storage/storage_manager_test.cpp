@@ -1,11 +1,14 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
 
 #include "logical_query_plan/stored_table_node.hpp"
+#include "operators/export_binary.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/filesystem.hpp"
@@ -152,4 +155,90 @@ TEST_F(StorageManagerTest, ExportTables) {
   filesystem::remove(filename);
 }
 
+TEST_F(StorageManagerTest, AttachPersistedTables) {
+  auto& sm = StorageManager::get();
+  const auto path = opossum::test_data_path + "/persisted_tables";
+  filesystem::create_directory(path);
+
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+  sm.add_table("third_table", table);
+
+  sm.export_all_tables_as_binary(path);
+  EXPECT_TRUE(filesystem::exists(path + "/third_table.bin"));
+
+  // Simulate a restart
+  StorageManager::reset();
+  sm.attach_persisted_tables(path);
+
+  EXPECT_TRUE(sm.has_table("third_table"));
+  EXPECT_FALSE(sm.is_table_loaded("third_table"));
+  EXPECT_EQ(sm.table_names(), std::vector<std::string>{"third_table"});
+  EXPECT_THROW(sm.attach_persisted_table("third_table", path + "/third_table.bin"), std::exception);
+
+  EXPECT_TABLE_EQ_ORDERED(sm.get_table("third_table"), table);
+  EXPECT_TRUE(sm.is_table_loaded("third_table"));
+  EXPECT_TRUE(sm.get_table("third_table")->table_statistics());
+
+  // Subsequent accesses return the same table
+  EXPECT_EQ(sm.get_table("third_table"), sm.get_table("third_table"));
+  EXPECT_EQ(sm.tables().size(), 1u);
+
+  filesystem::remove_all(path);
+}
+
+TEST_F(StorageManagerTest, DropPersistedTableBeforeLoading) {
+  auto& sm = StorageManager::get();
+  const auto filename = opossum::test_data_path + "/fourth_table.bin";
+
+  sm.add_table("fourth_table", load_table("resources/test_data/tbl/int_float.tbl"));
+  ExportBinary::write_binary(*sm.get_table("fourth_table"), filename);
+  sm.drop_table("fourth_table");
+
+  sm.attach_persisted_table("fourth_table", filename);
+  sm.drop_table("fourth_table");
+  EXPECT_FALSE(sm.has_table("fourth_table"));
+
+  EXPECT_THROW(sm.attach_persisted_table("fifth_table", opossum::test_data_path + "/missing.bin"), std::exception);
+
+  filesystem::remove(filename);
+}
+
+TEST_F(StorageManagerTest, TablesAreASnapshot) {
+  auto& sm = StorageManager::get();
+  const auto tables = sm.tables();
+  EXPECT_EQ(tables.size(), 2u);
+
+  sm.drop_table("first_table");
+  EXPECT_EQ(tables.size(), 2u);
+  EXPECT_EQ(sm.tables().size(), 1u);
+}
+
+TEST_F(StorageManagerTest, ConcurrentlyAddAndIterateTables) {
+  auto& sm = StorageManager::get();
+  constexpr auto TABLE_COUNT = 100;
+
+  auto writer = std::thread([&]() {
+    for (auto table_index = 0; table_index < TABLE_COUNT; ++table_index) {
+      sm.add_table("table_" + std::to_string(table_index),
+                   std::make_shared<Table>(TableColumnDefinitions{}, TableType::Data));
+    }
+  });
+
+  // The iterated snapshots never shrink, as tables are only added
+  auto previous_table_count = size_t{0};
+  for (auto iteration = 0; iteration < TABLE_COUNT; ++iteration) {
+    auto table_count = size_t{0};
+    for (const auto& [table_name, table] : sm.tables()) {
+      EXPECT_TRUE(table);
+      ++table_count;
+    }
+    EXPECT_GE(table_count, previous_table_count);
+    previous_table_count = table_count;
+  }
+
+  writer.join();
+  EXPECT_EQ(sm.tables().size(), TABLE_COUNT + 2u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String);
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 3, UseMvcc::Yes);
+
+    _table->append({4, "delta"});
+    _table->append({2, "bravo"});
+    _table->append({NullValue{}, "echo"});
+    _table->append({4, "alpha"});
+    _table->append({7, "charlie"});
+  }
+
+  // Returns the sorted matches of the index on the column
+  PosList lookup(const ColumnID column_id, const PredicateCondition predicate_condition,
+                 const AllTypeVariant& search_value, const std::optional<AllTypeVariant>& search_value2 = {}) {
+    auto matches = PosList{};
+    _table->get_table_index(column_id)->append_matches(predicate_condition, search_value, search_value2, matches);
+    std::sort(matches.begin(), matches.end());
+    return matches;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableIndexTest, CreateIndexesExistingRows) {
+  EXPECT_EQ(_table->get_table_index(ColumnID{0}), nullptr);
+
+  _table->create_table_index(ColumnID{0});
+  _table->create_table_index(ColumnID{1});
+
+  ASSERT_NE(_table->get_table_index(ColumnID{0}), nullptr);
+  EXPECT_EQ(_table->get_table_index(ColumnID{0})->column_id(), ColumnID{0});
+  EXPECT_EQ(_table->table_indexes().size(), 2u);
+
+  // NULLs are not indexed
+  EXPECT_EQ(_table->get_table_index(ColumnID{0})->size(), 4u);
+  EXPECT_EQ(_table->get_table_index(ColumnID{1})->size(), 5u);
+
+  EXPECT_THROW(_table->create_table_index(ColumnID{0}), std::logic_error);
+}
+
+TEST_F(TableIndexTest, LookupsSpanAllChunks) {
+  _table->create_table_index(ColumnID{0});
+  _table->create_table_index(ColumnID{1});
+
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, 4), PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, 3), PosList{});
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::NotEquals, 4),
+            PosList({RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::LessThan, 4), PosList({RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::LessThanEquals, 4),
+            PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::GreaterThan, 4), PosList({RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::GreaterThanEquals, 5), PosList({RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Between, 3, 7),
+            PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Between, 7, 3), PosList{});
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, NullValue{}), PosList{});
+
+  EXPECT_EQ(lookup(ColumnID{1}, PredicateCondition::LessThan, "charlie"),
+            PosList({RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(lookup(ColumnID{1}, PredicateCondition::Equals, "echo"), PosList({RowID{ChunkID{0}, 2}}));
+}
+
+TEST_F(TableIndexTest, AppendedRowsAreIndexed) {
+  _table->create_table_index(ColumnID{0});
+
+  _table->append({4, "foxtrot"});
+
+  _table->append_columns({std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{4, 8}),
+                          std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"golf", "hotel"})});
+
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, 4),
+            PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}, RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::GreaterThan, 7), PosList({RowID{ChunkID{2}, 1}}));
+
+  // Enough rows to merge the delta into the main part
+  for (auto value = int32_t{0}; value < 2'000; ++value) {
+    _table->append({value % 10 + 100, "india"});
+  }
+
+  EXPECT_EQ(_table->get_table_index(ColumnID{0})->size(), 2'007u);
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, 4).size(), 4u);
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, 105).size(), 200u);
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::GreaterThanEquals, 100).size(), 2'000u);
+}
+
+TEST_F(TableIndexTest, EncodedAndReplacedChunks) {
+  ChunkEncoder::encode_all_chunks(_table);
+  _table->create_table_index(ColumnID{0});
+
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, 4), PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}}));
+
+  // The rows of the replaced chunk are taken from the new chunk
+  const auto chunk = std::make_shared<Chunk>(
+      Segments{std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{9}),
+               std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"juliett"})},
+      std::make_shared<MvccData>(1));
+  _table->replace_chunk(ChunkID{1}, chunk);
+
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, 4), PosList({RowID{ChunkID{0}, 0}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::GreaterThan, 4), PosList({RowID{ChunkID{1}, 0}}));
+  EXPECT_EQ(_table->get_table_index(ColumnID{0})->size(), 3u);
+}
+
+TEST_F(TableIndexTest, InsertedRowsAreIndexed) {
+  _table->create_table_index(ColumnID{0});
+  StorageManager::get().add_table("table", _table);
+
+  auto values_to_insert = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values_to_insert->append({4, "kilo"});
+  values_to_insert->append({5, "lima"});
+  values_to_insert->append({6, "mike"});
+  auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+
+  auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table", table_wrapper);
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  // The last chunk had space for one more row
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Equals, 4),
+            PosList({RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}}));
+  EXPECT_EQ(lookup(ColumnID{0}, PredicateCondition::Between, 5, 6),
+            PosList({RowID{ChunkID{2}, 0}, RowID{ChunkID{2}, 1}}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,205 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/maintenance/create_table.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/table_partitioning.hpp"
+
+namespace opossum {
+
+class TablePartitioningTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions.emplace_back("year", DataType::Int, true);
+    _column_definitions.emplace_back("value", DataType::String);
+
+    // (-inf, 2000), [2000, 2010), [2010, inf)
+    _range_partitioning = TablePartitioning::range(ColumnID{0}, DataType::Int, {2000, 2010});
+  }
+
+  // Checks that each chunk only holds rows of its partition, and returns the number of rows per partition
+  static std::vector<size_t> rows_per_partition(const Table& table) {
+    const auto& partitioning = *table.partitioning();
+    auto row_counts = std::vector<size_t>(partitioning.partition_count());
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      const auto chunk = table.get_chunk(chunk_id);
+      const auto partition_id = chunk->partition_id();
+      EXPECT_TRUE(partition_id);
+      if (!partition_id) continue;
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        EXPECT_EQ(partitioning.partition_of((*chunk->get_segment(ColumnID{0}))[chunk_offset]), *partition_id);
+      }
+      row_counts[*partition_id] += chunk->size();
+    }
+    return row_counts;
+  }
+
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<const TablePartitioning> _range_partitioning;
+};
+
+TEST_F(TablePartitioningTest, RangePartitionOf) {
+  EXPECT_EQ(_range_partitioning->partition_count(), 3u);
+  EXPECT_EQ(_range_partitioning->partition_of(AllTypeVariant{1999}), PartitionID{0});
+  EXPECT_EQ(_range_partitioning->partition_of(AllTypeVariant{2000}), PartitionID{1});
+  EXPECT_EQ(_range_partitioning->partition_of(AllTypeVariant{2009}), PartitionID{1});
+  EXPECT_EQ(_range_partitioning->partition_of(AllTypeVariant{2010}), PartitionID{2});
+  EXPECT_EQ(_range_partitioning->partition_of(2500), PartitionID{2});
+  EXPECT_EQ(_range_partitioning->partition_of(NULL_VALUE), PartitionID{0});
+
+  // Values of other types are converted
+  EXPECT_EQ(_range_partitioning->partition_of(AllTypeVariant{int64_t{2005}}), PartitionID{1});
+
+  EXPECT_THROW(TablePartitioning::range(ColumnID{0}, DataType::Int, {2010, 2000}), std::logic_error);
+}
+
+TEST_F(TablePartitioningTest, HashPartitionOf) {
+  const auto partitioning = TablePartitioning::hash(ColumnID{0}, DataType::Long, 4);
+  EXPECT_EQ(partitioning->partition_count(), 4u);
+  EXPECT_EQ(partitioning->partition_of(NULL_VALUE), PartitionID{0});
+
+  for (auto value = int64_t{0}; value < 100; ++value) {
+    const auto partition_id = partitioning->partition_of(AllTypeVariant{value});
+    EXPECT_LT(partition_id, PartitionID{4});
+    EXPECT_EQ(partitioning->partition_of(value), partition_id);
+    EXPECT_EQ(partitioning->partition_of(AllTypeVariant{static_cast<int32_t>(value)}), partition_id);
+  }
+}
+
+TEST_F(TablePartitioningTest, MatchingRangePartitions) {
+  const auto& partitioning = *_range_partitioning;
+  using Partitions = std::vector<bool>;
+
+  EXPECT_EQ(partitioning.matching_partitions(PredicateCondition::Equals, 2005), Partitions({false, true, false}));
+  EXPECT_EQ(partitioning.matching_partitions(PredicateCondition::LessThan, 2005), Partitions({true, true, false}));
+  EXPECT_EQ(partitioning.matching_partitions(PredicateCondition::GreaterThanEquals, 2010),
+            Partitions({false, false, true}));
+  EXPECT_EQ(partitioning.matching_partitions(PredicateCondition::Between, 1990, 2005),
+            Partitions({true, true, false}));
+  EXPECT_EQ(partitioning.matching_partitions(PredicateCondition::IsNull, NULL_VALUE), Partitions({true, false, false}));
+  EXPECT_EQ(partitioning.matching_partitions(PredicateCondition::NotEquals, 2005), Partitions({true, true, true}));
+
+  // Values that might change when they are converted to the column type do not rule out partitions
+  EXPECT_EQ(partitioning.matching_partitions(PredicateCondition::Equals, int64_t{2005}),
+            Partitions({true, true, true}));
+  EXPECT_EQ(partitioning.matching_partitions(PredicateCondition::Equals, std::string{"2005"}),
+            Partitions({true, true, true}));
+}
+
+TEST_F(TablePartitioningTest, MatchingHashPartitions) {
+  const auto partitioning = TablePartitioning::hash(ColumnID{0}, DataType::Int, 4);
+
+  const auto matching = partitioning->matching_partitions(PredicateCondition::Equals, 17);
+  for (auto partition_id = PartitionID{0}; partition_id < 4; ++partition_id) {
+    EXPECT_EQ(matching[partition_id], partition_id == partitioning->partition_of(17));
+  }
+
+  EXPECT_EQ(partitioning->matching_partitions(PredicateCondition::LessThan, 17), std::vector<bool>(4, true));
+}
+
+TEST_F(TablePartitioningTest, CoPartitioning) {
+  EXPECT_TRUE(_range_partitioning->is_co_partitioned_with(
+      *TablePartitioning::range(ColumnID{1}, DataType::Int, {int64_t{2000}, 2010.0f})));
+  EXPECT_FALSE(
+      _range_partitioning->is_co_partitioned_with(*TablePartitioning::range(ColumnID{0}, DataType::Int, {2000})));
+  EXPECT_FALSE(_range_partitioning->is_co_partitioned_with(
+      *TablePartitioning::range(ColumnID{0}, DataType::Long, {2000, 2010})));
+  EXPECT_FALSE(_range_partitioning->is_co_partitioned_with(*TablePartitioning::hash(ColumnID{0}, DataType::Int, 3)));
+  EXPECT_TRUE(TablePartitioning::hash(ColumnID{0}, DataType::Int, 3)
+                  ->is_co_partitioned_with(*TablePartitioning::hash(ColumnID{2}, DataType::Int, 3)));
+}
+
+TEST_F(TablePartitioningTest, SetPartitioning) {
+  const auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+  EXPECT_THROW(table->set_partitioning(TablePartitioning::range(ColumnID{0}, DataType::Long, {2000})),
+               std::logic_error);
+  EXPECT_THROW(table->set_partitioning(TablePartitioning::range(ColumnID{2}, DataType::Int, {2000})),
+               std::logic_error);
+
+  table->set_partitioning(_range_partitioning);
+  EXPECT_EQ(table->partitioning(), _range_partitioning);
+
+  table->append({2005, "a"});
+  EXPECT_THROW(table->set_partitioning(_range_partitioning), std::logic_error);
+}
+
+TEST_F(TablePartitioningTest, AppendRoutesRows) {
+  const auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+  table->set_partitioning(_range_partitioning);
+
+  table->append({2005, "a"});
+  table->append({1990, "b"});
+  table->append({2006, "c"});
+  table->append({2007, "d"});
+  table->append({NULL_VALUE, "e"});
+
+  EXPECT_EQ(rows_per_partition(*table), std::vector<size_t>({2, 3, 0}));
+  EXPECT_EQ(table->chunk_count(), 3u);
+}
+
+TEST_F(TablePartitioningTest, AppendColumnsRoutesRows) {
+  const auto table = std::make_shared<Table>(_column_definitions, TableType::Data, 3);
+  table->set_partitioning(_range_partitioning);
+
+  const auto years = std::vector<int32_t>{2015, 1990, 2005, 2011, 2012, 2013, 1999};
+  auto year_nulls = std::vector<bool>(years.size(), false);
+  const auto values = std::vector<std::string>{"a", "b", "c", "d", "e", "f", "g"};
+  const auto segments = Segments{std::make_shared<ValueSegment<int32_t>>(years, year_nulls),
+                                 std::make_shared<ValueSegment<std::string>>(values)};
+  table->append_columns(segments);
+  table->append_columns(segments);
+
+  EXPECT_EQ(rows_per_partition(*table), std::vector<size_t>({4, 2, 8}));
+  EXPECT_EQ(table->row_count(), 14u);
+}
+
+TEST_F(TablePartitioningTest, InsertRoutesRows) {
+  const auto create_table = std::make_shared<CreateTable>("partitioned", _column_definitions, _range_partitioning);
+  create_table->execute();
+  const auto table = StorageManager::get().get_table("partitioned");
+  EXPECT_EQ(table->partitioning(), _range_partitioning);
+
+  auto input = std::make_shared<Table>(_column_definitions, TableType::Data, 2);
+  for (const auto year : {2015, 1990, 2005, 2011, 2012, 2013, 1999}) {
+    input->append({year, "x"});
+  }
+  input->append({NULL_VALUE, "y"});
+  const auto table_wrapper = std::make_shared<TableWrapper>(input);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>("partitioned", table_wrapper);
+  const auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(rows_per_partition(*table), std::vector<size_t>({3, 1, 4}));
+
+  // The inserted rows are visible
+  const auto get_table = std::make_shared<GetTable>("partitioned");
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  validate->execute();
+  EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), input);
+
+  // Validate keeps the partitions of the chunks
+  for (auto chunk_id = ChunkID{0}; chunk_id < validate->get_output()->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(validate->get_output()->get_chunk(chunk_id)->partition_id());
+  }
+}
+
+}  // namespace opossum
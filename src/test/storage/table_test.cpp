@@ -1,5 +1,6 @@
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -8,7 +9,13 @@
 #include "gtest/gtest.h"
 
 #include "resolve_type.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -121,6 +128,38 @@ TEST_F(StorageTableTest, ShrinkingMvccDataHasNoSideEffects) {
   }
 }
 
+TEST_F(StorageTableTest, AppendColumns) {
+  t->append({4, "Hello,"});
+
+  const auto segments =
+      Segments{std::make_shared<ValueSegment<int>>(std::vector<int>{6, 3, 7, 8}),
+               std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"world", "!", "foo", "bar"})};
+  t->append_columns(segments);
+
+  // The last chunk is filled up before new chunks are appended
+  ASSERT_EQ(t->chunk_count(), 3u);
+  EXPECT_EQ(t->row_count(), 5u);
+  EXPECT_EQ(t->get_chunk(ChunkID{2})->size(), 1u);
+  EXPECT_EQ(t->get_value<int>(ColumnID{0}, 1u), 6);
+  EXPECT_EQ(t->get_value<std::string>(ColumnID{1}, 4u), "bar");
+
+  // Immutable chunks are not appended to
+  t->get_chunk(ChunkID{2})->mark_immutable();
+  t->append_columns(segments);
+  EXPECT_EQ(t->chunk_count(), 5u);
+  EXPECT_EQ(t->get_chunk(ChunkID{2})->size(), 1u);
+}
+
+TEST_F(StorageTableTest, AppendColumnsGrowsMvccData) {
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes);
+  table->append_columns({std::make_shared<ValueSegment<int>>(std::vector<int>{1, 2, 3}),
+                         std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"a", "b", "c"})});
+
+  ASSERT_EQ(table->chunk_count(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{0})->get_scoped_mvcc_data_lock()->size(), 2u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->get_scoped_mvcc_data_lock()->size(), 1u);
+}
+
 TEST_F(StorageTableTest, EmplaceChunk) {
   EXPECT_EQ(t->chunk_count(), 0u);
 
@@ -163,6 +202,43 @@ TEST_F(StorageTableTest, ChunkSizeZeroThrows) {
   EXPECT_THROW(Table(column_definitions, TableType::Data, 0), std::logic_error);
 }
 
+TEST_F(StorageTableTest, CreateIndexInParallel) {
+  for (auto value = int32_t{0}; value < 9; ++value) {
+    t->append({value % 4, "Hello"});
+  }
+  ChunkEncoder::encode_all_chunks(t);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  t->create_index<GroupKeyIndex>({ColumnID{0}}, "index");
+
+  ASSERT_EQ(t->get_indexes().size(), 1u);
+  EXPECT_EQ(t->get_indexes().front().name, "index");
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < t->chunk_count(); ++chunk_id) {
+    const auto chunk = t->get_chunk(chunk_id);
+    const auto index = chunk->get_index(SegmentIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}});
+    ASSERT_NE(index, nullptr);
+    EXPECT_EQ(std::distance(index->cbegin(), index->cend()), static_cast<std::ptrdiff_t>(chunk->size()));
+  }
+}
+
+TEST_F(StorageTableTest, OpenInsertionChunk) {
+  t->append({4, "Hello,"});
+  t->set_insertion_chunk_count(2);
+  EXPECT_EQ(t->insertion_chunk_count(), 2u);
+
+  auto& insertion_chunk = t->insertion_chunk();
+  std::lock_guard<std::mutex> lock(insertion_chunk.mutex);
+
+  // The bulk-loaded chunk still has free space and is continued, a new chunk is appended once it is full
+  EXPECT_EQ(t->open_insertion_chunk(insertion_chunk), ChunkID{0});
+  t->get_chunk(ChunkID{0})->append({6, "world"});
+  EXPECT_EQ(t->open_insertion_chunk(insertion_chunk), ChunkID{1});
+  EXPECT_EQ(t->open_insertion_chunk(insertion_chunk), ChunkID{1});
+  EXPECT_EQ(t->chunk_count(), 2u);
+}
+
 TEST_F(StorageTableTest, MemoryUsageEstimation) {
   /**
    * WARNING: Since it's hard to assert what constitutes a correct "estimation", this just tests basic sanity of the
@@ -180,4 +256,29 @@ TEST_F(StorageTableTest, MemoryUsageEstimation) {
                                                      sizeof(TransactionID) + 2 * sizeof(CommitID));
 }
 
+TEST_F(StorageTableTest, KeyConstraints) {
+  auto nullable_column_definitions = column_definitions;
+  nullable_column_definitions.emplace_back("column_3", DataType::Int, true);
+  const auto table = std::make_shared<Table>(nullable_column_definitions, TableType::Data);
+
+  table->add_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  table->add_unique_constraint({ColumnID{1}, ColumnID{2}});
+  table->add_foreign_key_constraint({ColumnID{2}}, "other_table", {ColumnID{0}});
+
+  ASSERT_EQ(table->get_unique_constraints().size(), 2u);
+  EXPECT_EQ(table->get_unique_constraints()[0].columns, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(table->get_unique_constraints()[0].is_primary_key, IsPrimaryKey::Yes);
+  EXPECT_EQ(table->get_unique_constraints()[1].columns, std::vector<ColumnID>({ColumnID{1}, ColumnID{2}}));
+  EXPECT_EQ(table->get_unique_constraints()[1].is_primary_key, IsPrimaryKey::No);
+
+  ASSERT_EQ(table->get_foreign_key_constraints().size(), 1u);
+  EXPECT_EQ(table->get_foreign_key_constraints()[0].referenced_table_name, "other_table");
+
+  // Only one primary key, which must not be nullable
+  EXPECT_THROW(table->add_unique_constraint({ColumnID{1}}, IsPrimaryKey::Yes), std::exception);
+  EXPECT_THROW(t->add_unique_constraint({ColumnID{2}}), std::exception);
+  const auto other_table = std::make_shared<Table>(nullable_column_definitions, TableType::Data);
+  EXPECT_THROW(other_table->add_unique_constraint({ColumnID{2}}, IsPrimaryKey::Yes), std::exception);
+}
+
 }  // namespace opossum
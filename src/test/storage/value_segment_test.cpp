@@ -7,6 +7,8 @@
 
 #include "storage/value_segment.hpp"
 
+using namespace std::string_literals;  // NOLINT
+
 namespace opossum {
 
 class StorageValueSegmentTest : public BaseTest {
@@ -96,6 +98,144 @@ TEST_F(StorageValueSegmentTest, ArraySubscriptOperatorReturnsNullValue) {
   EXPECT_TRUE(variant_is_null(vs_double[0]));
 }
 
+TEST_F(StorageValueSegmentTest, MayContainNullValues) {
+  auto vs_int = ValueSegment<int>{true};
+  EXPECT_FALSE(vs_int.may_contain_null_values());
+
+  vs_int.append(1);
+  EXPECT_FALSE(vs_int.may_contain_null_values());
+  EXPECT_FALSE(vs_int.is_null(0));
+
+  vs_int.append(NULL_VALUE);
+  EXPECT_TRUE(vs_int.may_contain_null_values());
+  EXPECT_TRUE(vs_int.is_null(1));
+
+  const auto vs_without_nulls =
+      ValueSegment<int>{pmr_concurrent_vector<int>{1, 2}, pmr_concurrent_vector<bool>{false, false}};
+  EXPECT_FALSE(vs_without_nulls.may_contain_null_values());
+
+  const auto vs_with_nulls =
+      ValueSegment<int>{pmr_concurrent_vector<int>{1, 2}, pmr_concurrent_vector<bool>{false, true}};
+  EXPECT_TRUE(vs_with_nulls.may_contain_null_values());
+}
+
+TEST_F(StorageValueSegmentTest, MutableNullValuesMayContainNullValues) {
+  auto vs_int = ValueSegment<int>{std::vector<int>{1, 2}, std::vector<bool>{false, false}};
+  EXPECT_FALSE(vs_int.may_contain_null_values());
+
+  // Whoever requests the mutable null values might write NULLs
+  vs_int.null_values()[1] = true;
+  EXPECT_TRUE(vs_int.may_contain_null_values());
+  EXPECT_TRUE(vs_int.is_null(1));
+  EXPECT_FALSE(vs_int.get_typed_value(1));
+}
+
+TEST_F(StorageValueSegmentTest, AppendValues) {
+  const auto values = std::vector<int>{1, 2, 3};
+  vs_int.append_values(values.cbegin(), values.cend());
+  EXPECT_EQ(vs_int.size(), 3u);
+  EXPECT_EQ(vs_int.get(2), 3);
+
+  auto nullable_vs_int = ValueSegment<int>{true};
+  nullable_vs_int.append_values(values.cbegin(), values.cend());
+  EXPECT_FALSE(nullable_vs_int.may_contain_null_values());
+
+  const auto null_values = std::vector<bool>{false, true, false};
+  nullable_vs_int.append_values(values.cbegin(), values.cend(), null_values.cbegin());
+  EXPECT_EQ(nullable_vs_int.size(), 6u);
+  EXPECT_EQ(nullable_vs_int.null_values().size(), 6u);
+  EXPECT_TRUE(nullable_vs_int.may_contain_null_values());
+  EXPECT_FALSE(nullable_vs_int.is_null(3));
+  EXPECT_TRUE(nullable_vs_int.is_null(4));
+  EXPECT_EQ(nullable_vs_int.get(5), 3);
+
+  // NULLs cannot be appended to a segment that is not nullable
+  EXPECT_THROW(vs_int.append_values(values.cbegin(), values.cend(), null_values.cbegin()), std::logic_error);
+}
+
+TEST_F(StorageValueSegmentTest, AppendValuesFromSegment) {
+  const auto source = ValueSegment<int>{std::vector<int>{1, 2, 3, 4}, std::vector<bool>{false, false, true, false}};
+
+  auto nullable_vs_int = ValueSegment<int>{true};
+  nullable_vs_int.append_values(source, ChunkOffset{1}, ChunkOffset{3});
+  EXPECT_EQ(nullable_vs_int.size(), 3u);
+  EXPECT_EQ(nullable_vs_int.get(0), 2);
+  EXPECT_TRUE(nullable_vs_int.is_null(1));
+  EXPECT_EQ(nullable_vs_int.get(2), 4);
+
+  // Without NULLs in the appended range, values can also be appended to segments that are not nullable
+  vs_int.append_values(source, ChunkOffset{0}, ChunkOffset{2});
+  EXPECT_EQ(vs_int.size(), 2u);
+  EXPECT_THROW(vs_int.append_values(source, ChunkOffset{2}, ChunkOffset{1}), std::logic_error);
+
+  // The data types have to match
+  EXPECT_THROW(vs_double.append_values(source, ChunkOffset{0}, ChunkOffset{1}), std::logic_error);
+}
+
+TEST_F(StorageValueSegmentTest, StringPrefixes) {
+  vs_str.append("Hello World");
+  const auto values = std::vector<std::string>{"", "abc", "abcd"};
+  vs_str.append_values(values.cbegin(), values.cend());
+
+  const auto& prefixes = vs_str.string_prefixes();
+  ASSERT_EQ(prefixes.size(), 4u);
+  EXPECT_EQ(prefixes[0].size, 11u);
+  EXPECT_EQ(prefixes[0].characters, 0x48656C6Cu);
+  EXPECT_EQ(prefixes[1].size, 0u);
+  EXPECT_EQ(prefixes[1].characters, 0u);
+  EXPECT_EQ(prefixes[2].characters, 0x61626300u);
+  EXPECT_EQ(prefixes[3].characters, 0x61626364u);
+
+  // Overwritten values update their prefix
+  vs_str.set_value(ChunkOffset{1}, "xyz");
+  EXPECT_EQ(prefixes[1].size, 3u);
+  EXPECT_EQ(prefixes[1].characters, 0x78797A00u);
+
+  // Reserved rows start out as empty strings
+  vs_str.grow_to_at_least(6);
+  ASSERT_EQ(prefixes.size(), 6u);
+  EXPECT_EQ(prefixes[5].size, 0u);
+  EXPECT_EQ(prefixes[5].characters, 0u);
+  vs_str.set_value(ChunkOffset{5}, "abcd");
+  EXPECT_EQ(prefixes[5].characters, 0x61626364u);
+
+  // Moved segments take their prefixes with them
+  auto target = ValueSegment<std::string>{};
+  target.append_values(std::move(vs_str));
+  ASSERT_EQ(target.string_prefixes().size(), 6u);
+  EXPECT_EQ(target.get(0), "Hello World");
+  EXPECT_EQ(target.string_prefixes()[1].characters, 0x78797A00u);
+
+  const auto constructed_segment = ValueSegment<std::string>{values};
+  EXPECT_EQ(constructed_segment.string_prefixes().size(), 3u);
+
+  // Segments of other types have no prefixes
+  vs_int.append(1);
+  EXPECT_TRUE(vs_int.string_prefixes().empty());
+}
+
+TEST_F(StorageValueSegmentTest, CompareStringPrefixes) {
+  // Strings of different lengths, with embedded zeros and with characters that are negative as a signed char
+  const auto strings = std::vector<std::string>{
+      "", "a", "ab", "abc", "abcd", "abcde", "abce", "abcdf", "b", "ab\0"s, "ab\0\0\0"s, "\xFF\xFF"s, "\x7F",
+      "abcd\xFF", "abcdabcd", "abcdabce"};
+
+  for (const auto& lhs : strings) {
+    for (const auto& rhs : strings) {
+      const auto expected_sign = lhs.compare(rhs) < 0 ? -1 : (lhs.compare(rhs) > 0 ? 1 : 0);
+      const auto comparison = compare_string_prefixes(StringPrefix::of(lhs), StringPrefix::of(rhs));
+
+      // The prefixes must not decide comparisons of strings that are only distinguished after the prefix
+      if (!comparison) {
+        EXPECT_GT(lhs.size(), 4u);
+        EXPECT_GT(rhs.size(), 4u);
+        continue;
+      }
+      EXPECT_EQ(*comparison, expected_sign) << lhs << " vs. " << rhs;
+    }
+  }
+}
+
 TEST_F(StorageValueSegmentTest, MemoryUsageEstimation) {
   /**
    * WARNING: Since it's hard to assert what constitutes a correct "estimation", this just tests basic sanity of the
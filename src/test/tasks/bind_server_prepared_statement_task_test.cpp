@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/prepared_plan.hpp"
+#include "storage/storage_manager.hpp"
+#include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/parse_server_prepared_statement_task.hpp"
+
+namespace opossum {
+
+class BindServerPreparedStatementTaskTest : public BaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  std::shared_ptr<PreparedPlan> parse(const std::string& query) {
+    auto task = std::make_shared<ParseServerPreparedStatementTask>(query);
+    auto future = task->get_future();
+    task->execute();
+    return future.get();
+  }
+
+  std::shared_ptr<const Table> bind_and_execute(const std::string& query,
+                                                const std::shared_ptr<PreparedPlan>& prepared_plan,
+                                                const std::vector<AllTypeVariant>& params) {
+    auto task = std::make_shared<BindServerPreparedStatementTask>(query, prepared_plan, params);
+    auto future = task->get_future();
+    task->execute();
+    const auto physical_plan = future.get();
+
+    physical_plan->set_transaction_context_recursively(TransactionManager::get().new_transaction_context());
+    const auto tasks = OperatorTask::make_tasks_from_operator(physical_plan, CleanupTemporaries::Yes);
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    return tasks.back()->get_operator()->get_output();
+  }
+};
+
+TEST_F(BindServerPreparedStatementTaskTest, ReusesPhysicalPlanForScanValues) {
+  const auto query = std::string{"SELECT * FROM int_float WHERE a = ?"};
+  const auto prepared_plan = parse(query);
+  EXPECT_TRUE(prepared_plan->is_optimized);
+
+  const auto expected_table = load_table("resources/test_data/tbl/int_float_filtered.tbl");
+
+  EXPECT_TABLE_EQ_UNORDERED(bind_and_execute(query, prepared_plan, {int32_t{1234}}), expected_table);
+  EXPECT_EQ(SQLPreparedStatementPlanCache::get().size(), 1u);
+
+  EXPECT_EQ(bind_and_execute(query, prepared_plan, {int32_t{99}})->row_count(), 0u);
+  EXPECT_EQ(SQLPreparedStatementPlanCache::get().size(), 1u);
+
+  // The physical plan is specific to the data types of the parameters
+  EXPECT_TABLE_EQ_UNORDERED(bind_and_execute(query, prepared_plan, {int64_t{1234}}), expected_table);
+  EXPECT_EQ(SQLPreparedStatementPlanCache::get().size(), 2u);
+}
+
+TEST_F(BindServerPreparedStatementTaskTest, InstantiatesPlansWithOtherPlaceholders) {
+  // The value of the placeholder determines the data type of the column, so the plan is not reused
+  const auto query = std::string{"SELECT a + ? AS c FROM int_float WHERE a = 1234"};
+  const auto prepared_plan = parse(query);
+  EXPECT_FALSE(prepared_plan->is_optimized);
+
+  const auto result_table = bind_and_execute(query, prepared_plan, {int32_t{1}});
+  ASSERT_EQ(result_table->row_count(), 1u);
+  EXPECT_EQ(result_table->column_data_type(ColumnID{0}), DataType::Int);
+  EXPECT_EQ(SQLPreparedStatementPlanCache::get().size(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "tasks/chunk_compaction_task.hpp"
+
+namespace opossum {
+
+class ChunkCompactionTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 12 rows in two chunks
+    _table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+    ChunkEncoder::encode_all_chunks(_table);
+    StorageManager::get().add_table("table", _table);
+  }
+
+  // Deletes the given rows within the given transaction
+  bool delete_rows(const std::vector<RowID>& row_ids, const std::shared_ptr<TransactionContext>& context) {
+    auto pos_list = std::make_shared<PosList>(row_ids.cbegin(), row_ids.cend());
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+      segments.emplace_back(std::make_shared<ReferenceSegment>(_table, column_id, pos_list));
+    }
+    auto rows_to_delete = std::make_shared<Table>(_table->column_definitions(), TableType::References);
+    rows_to_delete->append_chunk(segments);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(rows_to_delete);
+    table_wrapper->execute();
+
+    auto delete_op = std::make_shared<Delete>("table", table_wrapper);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    return !delete_op->execute_failed();
+  }
+
+  std::shared_ptr<const Table> validated_table(const std::shared_ptr<TransactionContext>& context) {
+    auto get_table = std::make_shared<GetTable>("table");
+    get_table->execute();
+
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkCompactionTaskTest, MovesValidRows) {
+  auto delete_context = TransactionManager::get().new_transaction_context();
+  ASSERT_TRUE(delete_rows({RowID{ChunkID{0}, 1u}, RowID{ChunkID{0}, 4u}}, delete_context));
+  delete_context->commit();
+
+  const auto expected_table = validated_table(TransactionManager::get().new_transaction_context());
+  ASSERT_EQ(expected_table->row_count(), 10u);
+
+  // A transaction that started before the compaction keeps seeing the original rows
+  const auto old_context = TransactionManager::get().new_transaction_context();
+
+  auto task = ChunkCompactionTask{"table", ChunkID{0}};
+  task.execute();
+  EXPECT_TRUE(task.was_compacted());
+
+  // The four valid rows of the first chunk were appended in a new chunk
+  ASSERT_EQ(_table->chunk_count(), 3u);
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->size(), 4u);
+
+  const auto cleanup_commit_id = _table->get_chunk(ChunkID{0})->cleanup_commit_id();
+  ASSERT_TRUE(cleanup_commit_id);
+  EXPECT_GT(*cleanup_commit_id, old_context->snapshot_commit_id());
+
+  EXPECT_TABLE_EQ_UNORDERED(validated_table(old_context), expected_table);
+  EXPECT_TABLE_EQ_UNORDERED(validated_table(TransactionManager::get().new_transaction_context()), expected_table);
+
+  // The compacted chunk cannot be compacted again
+  EXPECT_FALSE(ChunkCompactionTask::chunk_is_compactable(_table->get_chunk(ChunkID{0})));
+}
+
+TEST_F(ChunkCompactionTaskTest, RollsBackOnConflict) {
+  auto delete_context = TransactionManager::get().new_transaction_context();
+  ASSERT_TRUE(delete_rows({RowID{ChunkID{0}, 2u}}, delete_context));
+
+  // The row is locked by the uncommitted delete, so the compaction cannot invalidate it
+  auto task = ChunkCompactionTask{"table", ChunkID{0}};
+  task.execute();
+  EXPECT_FALSE(task.was_compacted());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->cleanup_commit_id());
+  EXPECT_EQ(_table->chunk_count(), 2u);
+
+  delete_context->commit();
+  EXPECT_EQ(validated_table(TransactionManager::get().new_transaction_context())->row_count(), 11u);
+}
+
+TEST_F(ChunkCompactionTaskTest, OnlyCompactsFinishedChunks) {
+  EXPECT_TRUE(ChunkCompactionTask::chunk_is_compactable(_table->get_chunk(ChunkID{0})));
+
+  auto mutable_table = load_table("resources/test_data/tbl/compression_input.tbl", 6u);
+  EXPECT_FALSE(ChunkCompactionTask::chunk_is_compactable(mutable_table->get_chunk(ChunkID{0})));
+}
+
+}  // namespace opossum
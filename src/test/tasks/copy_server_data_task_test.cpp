@@ -0,0 +1,90 @@
+#include <arpa/inet.h>
+
+#include <optional>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/server/copy_server_data_task.hpp"
+
+namespace opossum {
+
+class CopyServerDataTaskTest : public BaseTest {
+ public:
+  void SetUp() override {
+    auto column_definitions = TableColumnDefinitions{};
+    column_definitions.emplace_back("a", DataType::Int, false);
+    column_definitions.emplace_back("b", DataType::String, true);
+    StorageManager::get().add_table("t", std::make_shared<Table>(column_definitions, TableType::Data, 2, UseMvcc::Yes));
+
+    expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+    expected_table->append({1, "x,\"y\""});
+    expected_table->append({2, NullValue{}});
+    expected_table->append({3, "tab\there"});
+  }
+
+  uint64_t copy_data(const CopyFormat format, const std::string& data) {
+    auto task = std::make_shared<CopyServerDataTask>("t", format, std::make_shared<std::string>(data));
+    auto future = task->get_future();
+    task->execute();
+    return future.get();
+  }
+
+  std::shared_ptr<Table> expected_table;
+};
+
+TEST_F(CopyServerDataTaskTest, CopiesTextFormat) {
+  EXPECT_EQ(copy_data(CopyFormat::Text, "1\tx,\"y\"\n2\t\\N\n3\ttab\\there\n\\.\n"), 3u);
+  EXPECT_TABLE_EQ_ORDERED(StorageManager::get().get_table("t"), expected_table);
+}
+
+TEST_F(CopyServerDataTaskTest, CopiesCsvFormat) {
+  EXPECT_EQ(copy_data(CopyFormat::Csv, "1,\"x,\"\"y\"\"\"\n2,\n3,tab\there\n"), 3u);
+  EXPECT_TABLE_EQ_ORDERED(StorageManager::get().get_table("t"), expected_table);
+}
+
+TEST_F(CopyServerDataTaskTest, CopiesBinaryFormat) {
+  auto data = std::string("PGCOPY\n\377\r\n\0", 11);
+  const auto append_int16 = [&](const int16_t value) {
+    const auto network_value = htons(static_cast<uint16_t>(value));
+    data.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  };
+  const auto append_int32 = [&](const int32_t value) {
+    const auto network_value = htonl(static_cast<uint32_t>(value));
+    data.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  };
+
+  // Flags and length of the header extension
+  append_int32(0);
+  append_int32(0);
+
+  const auto append_row = [&](const int32_t a, const std::optional<std::string>& b) {
+    append_int16(2);
+    append_int32(4);
+    append_int32(a);
+    if (b) {
+      append_int32(static_cast<int32_t>(b->size()));
+      data += *b;
+    } else {
+      append_int32(-1);
+    }
+  };
+  append_row(1, "x,\"y\"");
+  append_row(2, std::nullopt);
+  append_row(3, "tab\there");
+  append_int16(-1);
+
+  EXPECT_EQ(copy_data(CopyFormat::Binary, data), 3u);
+  EXPECT_TABLE_EQ_ORDERED(StorageManager::get().get_table("t"), expected_table);
+}
+
+TEST_F(CopyServerDataTaskTest, RejectsMalformedData) {
+  EXPECT_THROW(copy_data(CopyFormat::Binary, "PGCOPY"), std::exception);
+  EXPECT_THROW(copy_data(CopyFormat::Csv, "x,y\n"), std::exception);
+  EXPECT_EQ(StorageManager::get().get_table("t")->row_count(), 0u);
+}
+
+}  // namespace opossum
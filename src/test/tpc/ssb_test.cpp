@@ -0,0 +1,59 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+#include "ssb/ssb_queries.hpp"
+#include "ssb/ssb_query_generator.hpp"
+#include "ssb/ssb_table_generator.hpp"
+
+namespace opossum {
+
+class SSBTest : public BaseTest {
+ public:
+  void SetUp() override { SSBTableGenerator{0.01f, 10'000}.generate_and_store(); }
+};
+
+TEST_F(SSBTest, RowCounts) {
+  auto& storage_manager = StorageManager::get();
+  EXPECT_EQ(storage_manager.get_table("customer")->row_count(), 300u);
+  EXPECT_EQ(storage_manager.get_table("supplier")->row_count(), 20u);
+  EXPECT_EQ(storage_manager.get_table("part")->row_count(), 2'000u);
+  // Seven years, two of them leap years
+  EXPECT_EQ(storage_manager.get_table("dwdate")->row_count(), 7 * 365u + 2u);
+
+  // 15,000 orders with one to seven lines each
+  const auto lineorder_row_count = storage_manager.get_table("lineorder")->row_count();
+  EXPECT_GE(lineorder_row_count, 15'000u);
+  EXPECT_LE(lineorder_row_count, 7 * 15'000u);
+}
+
+TEST_F(SSBTest, Queries) {
+  auto query_generator = SSBQueryGenerator{};
+  ASSERT_EQ(query_generator.selected_queries().size(), 13u);
+
+  for (const auto query_id : query_generator.selected_queries()) {
+    SCOPED_TRACE(query_generator.query_name(query_id));
+    const auto table = SQLPipelineBuilder{query_generator.build_query(query_id)}.create_pipeline().get_result_table();
+    ASSERT_TRUE(table);
+  }
+
+  // Flight 1 restricts only the date and the fact table, so it finds lines even for this small scale factor
+  const auto table = SQLPipelineBuilder{ssb_queries[0].second}.create_pipeline().get_result_table();
+  ASSERT_EQ(table->row_count(), 1u);
+  EXPECT_GT(table->get_value<int64_t>(ColumnID{0}, 0), 0);
+}
+
+TEST_F(SSBTest, QuerySubset) {
+  const auto query_generator = SSBQueryGenerator{std::unordered_set<std::string>{"2.1", "4.3"}};
+  ASSERT_EQ(query_generator.selected_queries().size(), 2u);
+  EXPECT_EQ(query_generator.query_name(query_generator.selected_queries()[0]), "SSB 2.1");
+  EXPECT_EQ(query_generator.query_name(query_generator.selected_queries()[1]), "SSB 4.3");
+}
+
+}  // namespace opossum
@@ -0,0 +1,100 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tpcc/constants.hpp"
+#include "tpcc/procedures/tpcc_delivery.hpp"
+#include "tpcc/procedures/tpcc_new_order.hpp"
+#include "tpcc/procedures/tpcc_order_status.hpp"
+#include "tpcc/procedures/tpcc_payment.hpp"
+#include "tpcc/procedures/tpcc_stock_level.hpp"
+#include "tpcc/tpcc_table_generator.hpp"
+
+namespace opossum {
+
+class TPCCTest : public BaseTest {
+ public:
+  void SetUp() override {
+    for (auto& [table_name, table] : TpccTableGenerator{10'000, 1}.generate_all_tables()) {
+      StorageManager::get().add_table(table_name, table);
+    }
+  }
+
+  // Returns the single value of the result of the given query
+  template <typename T>
+  T query_value(const std::string& sql) {
+    const auto table = SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+    EXPECT_EQ(table->row_count(), 1u);
+    return table->get_value<T>(ColumnID{0}, 0);
+  }
+
+  TpccRandomGenerator random_generator{42};
+};
+
+TEST_F(TPCCTest, NewOrder) {
+  const auto next_order_ids = query_value<int64_t>("SELECT SUM(D_NEXT_O_ID) FROM DISTRICT");
+  const auto order_count = query_value<int64_t>("SELECT COUNT(*) FROM \"ORDER\"");
+  const auto new_order_count = query_value<int64_t>("SELECT COUNT(*) FROM NEW_ORDER");
+  const auto order_line_count = query_value<int64_t>("SELECT COUNT(*) FROM ORDER_LINE");
+
+  EXPECT_TRUE(TpccNewOrder(random_generator, 1).execute());
+
+  // The order might have been rolled back on purpose, in which case nothing changed
+  const auto added_order_count = query_value<int64_t>("SELECT COUNT(*) FROM \"ORDER\"") - order_count;
+  ASSERT_LE(added_order_count, 1);
+  EXPECT_EQ(query_value<int64_t>("SELECT SUM(D_NEXT_O_ID) FROM DISTRICT"), next_order_ids + added_order_count);
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM NEW_ORDER"), new_order_count + added_order_count);
+
+  const auto added_order_line_count = query_value<int64_t>("SELECT COUNT(*) FROM ORDER_LINE") - order_line_count;
+  if (added_order_count == 1) {
+    EXPECT_EQ(added_order_line_count,
+              query_value<int32_t>("SELECT O_OL_CNT FROM \"ORDER\" WHERE O_ID = " + std::to_string(NUM_ORDERS)));
+  } else {
+    EXPECT_EQ(added_order_line_count, 0);
+  }
+}
+
+TEST_F(TPCCTest, Payment) {
+  const auto history_count = query_value<int64_t>("SELECT COUNT(*) FROM HISTORY");
+  const auto payment_count = query_value<int64_t>("SELECT SUM(C_PAYMENT_CNT) FROM CUSTOMER");
+
+  EXPECT_TRUE(TpccPayment(random_generator, 1).execute());
+
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM HISTORY"), history_count + 1);
+  EXPECT_EQ(query_value<int64_t>("SELECT SUM(C_PAYMENT_CNT) FROM CUSTOMER"), payment_count + 1);
+  EXPECT_GT(query_value<float>("SELECT W_YTD FROM WAREHOUSE"), CUSTOMER_YTD * NUM_CUSTOMERS_PER_DISTRICT *
+                                                                   NUM_DISTRICTS_PER_WAREHOUSE);
+}
+
+TEST_F(TPCCTest, Delivery) {
+  const auto new_order_count = query_value<int64_t>("SELECT COUNT(*) FROM NEW_ORDER");
+  const auto delivery_count = query_value<int64_t>("SELECT SUM(C_DELIVERY_CNT) FROM CUSTOMER");
+
+  EXPECT_TRUE(TpccDelivery(random_generator, 1).execute());
+
+  // The oldest new order of each district was delivered
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM NEW_ORDER"), new_order_count - NUM_DISTRICTS_PER_WAREHOUSE);
+  EXPECT_EQ(query_value<int64_t>("SELECT SUM(C_DELIVERY_CNT) FROM CUSTOMER"),
+            delivery_count + NUM_DISTRICTS_PER_WAREHOUSE);
+  EXPECT_EQ(query_value<int32_t>("SELECT MIN(NO_O_ID) FROM NEW_ORDER"), NUM_ORDERS - NUM_NEW_ORDERS + 1);
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM \"ORDER\" WHERE O_CARRIER_ID = -1"),
+            new_order_count - NUM_DISTRICTS_PER_WAREHOUSE);
+}
+
+TEST_F(TPCCTest, ReadOnlyProcedures) {
+  const auto order_count = query_value<int64_t>("SELECT COUNT(*) FROM \"ORDER\"");
+
+  for (auto run = 0; run < 10; ++run) {
+    EXPECT_TRUE(TpccOrderStatus(random_generator, 1).execute());
+    EXPECT_TRUE(TpccStockLevel(random_generator, 1).execute());
+  }
+
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM \"ORDER\""), order_count);
+}
+
+}  // namespace opossum
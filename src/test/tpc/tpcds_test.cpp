@@ -0,0 +1,76 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+#include "tpcds/tpcds_query_generator.hpp"
+#include "tpcds/tpcds_table_generator.hpp"
+
+namespace opossum {
+
+class TpcdsTest : public BaseTest {
+ public:
+  void SetUp() override { TpcdsTableGenerator{0.01f, 10'000}.generate_and_store(); }
+
+  // Returns the single value of the result of the given query
+  template <typename T>
+  T query_value(const std::string& sql) {
+    const auto table = SQLPipelineBuilder{sql}.create_pipeline().get_result_table();
+    EXPECT_EQ(table->row_count(), 1u);
+    return table->get_value<T>(ColumnID{0}, 0);
+  }
+};
+
+TEST_F(TpcdsTest, RowCounts) {
+  auto& storage_manager = StorageManager::get();
+  EXPECT_EQ(storage_manager.get_table("date_dim")->row_count(), 73'049u);
+  EXPECT_EQ(storage_manager.get_table("time_dim")->row_count(), 86'400u);
+  EXPECT_EQ(storage_manager.get_table("item")->row_count(), 180u);
+  EXPECT_EQ(storage_manager.get_table("customer")->row_count(), 1'000u);
+  EXPECT_EQ(storage_manager.get_table("customer_address")->row_count(), 500u);
+  EXPECT_EQ(storage_manager.get_table("customer_demographics")->row_count(), 19'208u);
+  EXPECT_EQ(storage_manager.get_table("household_demographics")->row_count(), 7'200u);
+  EXPECT_EQ(storage_manager.get_table("store")->row_count(), 12u);
+  EXPECT_EQ(storage_manager.get_table("promotion")->row_count(), 30u);
+
+  // 2,400 tickets with eight to sixteen items each
+  const auto store_sales_row_count = storage_manager.get_table("store_sales")->row_count();
+  EXPECT_GE(store_sales_row_count, 8 * 2'400u);
+  EXPECT_LE(store_sales_row_count, 16 * 2'400u);
+}
+
+TEST_F(TpcdsTest, Values) {
+  // The first rows of the date dimension, the names, and the business keys follow dsdgen
+  EXPECT_EQ(query_value<int32_t>("SELECT MIN(d_date_sk) FROM date_dim"), 2'415'022);
+  EXPECT_EQ(query_value<std::string>("SELECT d_date FROM date_dim WHERE d_date_sk = 2415022"), "1900-01-02");
+  EXPECT_EQ(query_value<std::string>("SELECT s_store_name FROM store WHERE s_store_sk = 4"), "ese");
+  EXPECT_EQ(query_value<std::string>("SELECT s_store_id FROM store WHERE s_store_sk = 1"), "AAAAAAAABAAAAAAA");
+  // The 19,208 rows contain each of the 70 combinations of gender, marital, and education status 274 times, plus the
+  // first 28 combinations, which include the one below, once more
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM customer_demographics WHERE cd_gender = 'M' AND "
+                                 "cd_marital_status = 'S' AND cd_education_status = 'College'"),
+            275);
+
+  // All sales are within the five years from 1998 to 2002
+  EXPECT_EQ(query_value<int64_t>("SELECT COUNT(*) FROM store_sales, date_dim WHERE ss_sold_date_sk = d_date_sk AND "
+                                 "(d_year < 1998 OR d_year > 2002)"),
+            0);
+}
+
+TEST_F(TpcdsTest, Queries) {
+  auto query_generator = TpcdsQueryGenerator{};
+  ASSERT_EQ(query_generator.selected_queries().size(), 8u);
+
+  for (const auto query_id : query_generator.selected_queries()) {
+    SCOPED_TRACE(query_generator.query_name(query_id));
+    const auto table = SQLPipelineBuilder{query_generator.build_query(query_id)}.create_pipeline().get_result_table();
+    ASSERT_TRUE(table);
+  }
+}
+
+}  // namespace opossum
@@ -1,5 +1,9 @@
 #include "gtest/gtest.h"
 
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/base_encoded_segment.hpp"
 #include "storage/storage_manager.hpp"
 #include "testing_assert.hpp"
 #include "tpch/tpch_table_generator.hpp"
@@ -48,6 +52,32 @@ TEST(TpchDbGeneratorTest, TableContents) {
                           load_table("resources/test_data/tbl/tpch/sf-0.001/region.tbl", chunk_size));
 }
 
+TEST(TpchDbGeneratorTest, TableContentsGeneratedInParallel) {
+  /**
+   * With a chunk size of 10, each task generates 40 rows, so that the rows of most tables are generated by several
+   * tasks, whose random number streams have to skip the rows of the preceding tasks
+   */
+  const auto scale_factor = 0.001f;
+  const auto chunk_size = 10;
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto table_info_by_name = TpchTableGenerator(scale_factor, chunk_size).generate();
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+
+  EXPECT_GT(table_info_by_name.at("orders").table->chunk_count(), 1'500 / 40);
+
+  EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("part").table,
+                          load_table("resources/test_data/tbl/tpch/sf-0.001/part.tbl", chunk_size));
+  EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("partsupp").table,
+                          load_table("resources/test_data/tbl/tpch/sf-0.001/partsupp.tbl", chunk_size));
+  EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("customer").table,
+                          load_table("resources/test_data/tbl/tpch/sf-0.001/customer.tbl", chunk_size));
+  EXPECT_TABLE_EQ_ORDERED(table_info_by_name.at("orders").table,
+                          load_table("resources/test_data/tbl/tpch/sf-0.001/orders.tbl", chunk_size));
+}
+
 TEST(TpchDbGeneratorTest, GenerateAndStore) {
   EXPECT_FALSE(StorageManager::get().has_table("part"));
   EXPECT_FALSE(StorageManager::get().has_table("supplier"));
@@ -70,4 +100,19 @@ TEST(TpchDbGeneratorTest, GenerateAndStore) {
 
   StorageManager::reset();
 }
+
+TEST(TpchDbGeneratorTest, EncodesChunksWhileGenerating) {
+  // The chunks are encoded with the default encoding of the EncodingConfig, i.e., Dictionary
+  const auto table_info_by_name = TpchTableGenerator(0.001f, 100).generate();
+
+  for (const auto& [table_name, table_info] : table_info_by_name) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table_info.table->chunk_count(); ++chunk_id) {
+      const auto chunk = table_info.table->get_chunk(chunk_id);
+      EXPECT_FALSE(chunk->is_mutable()) << table_name;
+      const auto segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(chunk->get_segment(ColumnID{0}));
+      ASSERT_TRUE(segment) << table_name;
+      EXPECT_EQ(segment->encoding_type(), EncodingType::Dictionary);
+    }
+  }
+}
 }  // namespace opossum
@@ -0,0 +1,94 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "types.hpp"
+#include "utils/arena_memory_resource.hpp"
+
+namespace opossum {
+
+class ArenaMemoryResourceTest : public BaseTest {
+ protected:
+  ArenaMemoryResource _memory_resource{size_t{1} << 12u};
+};
+
+TEST_F(ArenaMemoryResourceTest, AllocatesData) {
+  const auto alloc = PolymorphicAllocator<int32_t>(&_memory_resource);
+
+  auto values = pmr_vector<int32_t>(alloc);
+  for (auto value = 0; value < 10'000; ++value) {
+    values.emplace_back(value);
+  }
+
+  EXPECT_EQ(values.get_allocator().resource(), &_memory_resource);
+  EXPECT_GE(_memory_resource.reserved_bytes(), values.size() * sizeof(int32_t));
+  EXPECT_EQ(values[9'999], 9'999);
+}
+
+TEST_F(ArenaMemoryResourceTest, BumpAllocatesSmallAllocations) {
+  auto* const first = static_cast<char*>(_memory_resource.allocate(20, 8));
+  auto* const second = static_cast<char*>(_memory_resource.allocate(20, 8));
+
+  // Allocations are padded to 16 bytes
+  EXPECT_EQ(second, first + 32);
+  EXPECT_EQ(_memory_resource.reserved_bytes(), size_t{1} << 12u);
+
+  // Deallocating is a no-op, the memory is not reused
+  _memory_resource.deallocate(second, 20, 8);
+  EXPECT_NE(_memory_resource.allocate(20, 8), second);
+}
+
+TEST_F(ArenaMemoryResourceTest, GrowsBlocks) {
+  // Each allocation takes a quarter of the first block, so the fifth one needs a second block of twice the size
+  for (auto allocation_idx = 0; allocation_idx < 5; ++allocation_idx) {
+    _memory_resource.allocate(size_t{1} << 10u, 8);
+  }
+
+  EXPECT_EQ(_memory_resource.reserved_bytes(), (size_t{1} << 12u) + (size_t{1} << 13u));
+}
+
+TEST_F(ArenaMemoryResourceTest, FreesLargeAllocations) {
+  const auto reserved_bytes = _memory_resource.reserved_bytes();
+
+  auto* const large = _memory_resource.allocate(size_t{1} << 20u, 8);
+  EXPECT_EQ(_memory_resource.reserved_bytes(), reserved_bytes + (size_t{1} << 20u));
+
+  _memory_resource.deallocate(large, size_t{1} << 20u, 8);
+  EXPECT_EQ(_memory_resource.reserved_bytes(), reserved_bytes);
+
+  // Over-aligned allocations are large allocations as well
+  auto* const aligned = _memory_resource.allocate(64, 64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64, 0u);
+  _memory_resource.deallocate(aligned, 64, 64);
+}
+
+TEST_F(ArenaMemoryResourceTest, OperatorOutputRetainsArena) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+  table_wrapper->execute();
+
+  auto arena = std::make_shared<ArenaMemoryResource>();
+  auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 200);
+  table_scan->set_memory_resource(arena);
+  EXPECT_EQ(table_scan->memory_resource(), arena.get());
+
+  table_scan->execute();
+  const auto output = table_scan->get_output();
+  ASSERT_EQ(output->chunk_count(), 2u);
+
+  // The PosLists were allocated through the TrackingMemoryResource of the operator, which passes them on to the arena
+  EXPECT_GT(table_scan->performance_data().retained_memory_usage_bytes, 0u);
+  EXPECT_EQ(table_scan->memory_resource(), arena.get());
+
+  // The operator only has a weak reference to the arena, the output keeps it alive
+  const auto weak_arena = std::weak_ptr<ArenaMemoryResource>{arena};
+  arena.reset();
+  table_scan.reset();
+  EXPECT_FALSE(weak_arena.expired());
+  EXPECT_EQ(output->row_count(), 2u);
+}
+
+}  // namespace opossum
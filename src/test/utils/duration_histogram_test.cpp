@@ -0,0 +1,58 @@
+#include "gtest/gtest.h"
+
+#include "utils/duration_histogram.hpp"
+
+using namespace std::chrono_literals;  // NOLINT
+
+namespace opossum {
+
+TEST(DurationHistogramTest, Buckets) {
+  auto histogram = DurationHistogram{};
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(histogram.percentile(0.5), 0us);
+
+  histogram.add(999ns);
+  histogram.add(1us);
+  histogram.add(3us);
+  histogram.add(4us);
+  histogram.add(-1ns);
+  histogram.add(24h);
+
+  EXPECT_EQ(histogram.count(), 6u);
+  EXPECT_EQ(histogram.count_in_bucket(0), 2u);
+  EXPECT_EQ(histogram.count_in_bucket(1), 1u);
+  EXPECT_EQ(histogram.count_in_bucket(2), 1u);
+  EXPECT_EQ(histogram.count_in_bucket(3), 1u);
+  EXPECT_EQ(histogram.count_in_bucket(DurationHistogram::BUCKET_COUNT - 1), 1u);
+
+  EXPECT_EQ(DurationHistogram::bucket_upper_bound(0), 1us);
+  EXPECT_EQ(DurationHistogram::bucket_upper_bound(3), 8us);
+}
+
+TEST(DurationHistogramTest, Percentiles) {
+  auto histogram = DurationHistogram{};
+  for (auto index = 0; index < 99; ++index) {
+    histogram.add(10us);
+  }
+  histogram.add(1000us);
+
+  EXPECT_EQ(histogram.percentile(0.5), 16us);
+  EXPECT_EQ(histogram.percentile(0.99), 16us);
+  EXPECT_EQ(histogram.percentile(1.0), 1024us);
+}
+
+TEST(DurationHistogramTest, CopyAndMerge) {
+  auto histogram = DurationHistogram{};
+  histogram.add(10us);
+
+  auto copy = histogram;
+  copy.add(10us);
+  EXPECT_EQ(histogram.count(), 1u);
+  EXPECT_EQ(copy.count(), 2u);
+
+  histogram.merge(copy);
+  EXPECT_EQ(histogram.count(), 3u);
+  EXPECT_EQ(histogram.count_in_bucket(4), 3u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include <future>
+#include <memory>
+#include <thread>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/epoch_manager.hpp"
+
+namespace opossum {
+
+class EpochManagerTest : public BaseTest {
+ protected:
+  void SetUp() override { EpochManager::get().reclaim(); }
+};
+
+TEST_F(EpochManagerTest, ReleasesUnpinnedVersions) {
+  auto version = std::make_shared<int>(42);
+  const auto weak_version = std::weak_ptr<int>{version};
+
+  EpochManager::get().retire(std::move(version));
+  EXPECT_TRUE(weak_version.expired());
+  EXPECT_EQ(EpochManager::get().retired_count(), 0u);
+}
+
+TEST_F(EpochManagerTest, KeepsVersionsWhilePinned) {
+  auto version = std::make_shared<int>(42);
+  const auto weak_version = std::weak_ptr<int>{version};
+
+  {
+    const auto epoch_guard = EpochGuard{};
+    EXPECT_TRUE(EpochManager::is_pinned());
+
+    {
+      // Nested guards do not unpin the thread
+      const auto nested_epoch_guard = EpochGuard{};
+    }
+    EXPECT_TRUE(EpochManager::is_pinned());
+
+    EpochManager::get().retire(std::move(version));
+    EXPECT_FALSE(weak_version.expired());
+    EXPECT_EQ(EpochManager::get().reclaim(), 0u);
+  }
+  EXPECT_FALSE(EpochManager::is_pinned());
+
+  EXPECT_EQ(EpochManager::get().reclaim(), 1u);
+  EXPECT_TRUE(weak_version.expired());
+}
+
+TEST_F(EpochManagerTest, VersionsRetiredAfterPinningAreKeptUntilUnpinned) {
+  auto pinned = std::promise<void>{};
+  auto unpin = std::promise<void>{};
+  auto unpin_future = unpin.get_future();
+
+  auto thread = std::thread([&]() {
+    const auto epoch_guard = EpochGuard{};
+    pinned.set_value();
+    unpin_future.wait();
+  });
+  pinned.get_future().wait();
+
+  auto version = std::make_shared<int>(42);
+  const auto weak_version = std::weak_ptr<int>{version};
+  EpochManager::get().retire(std::move(version));
+  EXPECT_FALSE(weak_version.expired());
+  EXPECT_EQ(EpochManager::get().retired_count(), 1u);
+
+  unpin.set_value();
+  thread.join();
+
+  EXPECT_EQ(EpochManager::get().reclaim(), 1u);
+  EXPECT_TRUE(weak_version.expired());
+}
+
+TEST_F(EpochManagerTest, VersionsRetiredBeforePinningAreReleased) {
+  auto version = std::make_shared<int>(42);
+  const auto weak_version = std::weak_ptr<int>{version};
+
+  {
+    const auto epoch_guard = EpochGuard{};
+    EpochManager::get().retire(std::move(version));
+  }
+
+  // A thread that pins after the version was retired cannot have read it
+  const auto epoch_guard = EpochGuard{};
+  EXPECT_EQ(EpochManager::get().reclaim(), 1u);
+  EXPECT_TRUE(weak_version.expired());
+}
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "types.hpp"
+#include "utils/file_backed_memory_resource.hpp"
+
+namespace opossum {
+
+class FileBackedMemoryResourceTest : public BaseTest {
+ protected:
+  FileBackedMemoryResource _memory_resource{"/tmp", size_t{1} << 20u};
+};
+
+TEST_F(FileBackedMemoryResourceTest, AllocatesData) {
+  const auto alloc = PolymorphicAllocator<int32_t>(&_memory_resource);
+
+  auto values = pmr_vector<int32_t>(alloc);
+  for (auto value = 0; value < 1'000; ++value) {
+    values.emplace_back(value);
+  }
+
+  EXPECT_EQ(values.get_allocator().resource(), &_memory_resource);
+  EXPECT_GE(_memory_resource.allocated_bytes(), values.size() * sizeof(int32_t));
+  EXPECT_EQ(values[999], 999);
+}
+
+TEST_F(FileBackedMemoryResourceTest, ReusesFreedRanges) {
+  auto* const first = _memory_resource.allocate(100, 8);
+  auto* const second = _memory_resource.allocate(100, 8);
+  auto* const third = _memory_resource.allocate(100, 8);
+  EXPECT_EQ(_memory_resource.allocated_bytes(), 3u * 112u);
+
+  // The freed ranges are merged, so a larger allocation fits into them
+  _memory_resource.deallocate(first, 100, 8);
+  _memory_resource.deallocate(second, 100, 8);
+  EXPECT_EQ(_memory_resource.allocate(200, 8), first);
+
+  _memory_resource.deallocate(first, 200, 8);
+  _memory_resource.deallocate(third, 100, 8);
+  EXPECT_EQ(_memory_resource.allocated_bytes(), 0u);
+}
+
+TEST_F(FileBackedMemoryResourceTest, AlignsAllocations) {
+  _memory_resource.allocate(1, 1);
+  const auto* const aligned = _memory_resource.allocate(64, 64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64u, 0u);
+}
+
+TEST_F(FileBackedMemoryResourceTest, FailsWhenFull) {
+  EXPECT_THROW(_memory_resource.allocate(size_t{2} << 20u, 8), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,109 @@
+#include <boost/container/pmr/global_resource.hpp>
+
+#include <cstring>
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "types.hpp"
+#include "utils/huge_page_memory_resource.hpp"
+
+namespace opossum {
+
+class HugePageMemoryResourceTest : public BaseTest {
+ protected:
+  void TearDown() override { HugePageMemoryResource::disable_for_default_resource(); }
+
+  static constexpr auto _huge_page_bytes = HugePageMemoryResource::HUGE_PAGE_BYTES;
+};
+
+TEST_F(HugePageMemoryResourceTest, MapsLargeAllocations) {
+  auto memory_resource = HugePageMemoryResource{_huge_page_bytes};
+
+  auto* const small = memory_resource.allocate(1'000, 8);
+  EXPECT_FALSE(memory_resource.owns(small));
+  EXPECT_EQ(memory_resource.mapped_bytes(), size_t{0});
+
+  // Mappings are rounded up to whole huge pages and aligned to them
+  auto* const large = memory_resource.allocate(_huge_page_bytes + 1, 8);
+  EXPECT_TRUE(memory_resource.owns(large));
+  EXPECT_EQ(memory_resource.mapped_bytes(), 2 * _huge_page_bytes);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(large) % _huge_page_bytes, size_t{0});
+
+  std::memset(large, 42, _huge_page_bytes + 1);
+  EXPECT_EQ(static_cast<char*>(large)[_huge_page_bytes], 42);
+
+  memory_resource.deallocate(large, _huge_page_bytes + 1, 8);
+  memory_resource.deallocate(small, 1'000, 8);
+  EXPECT_FALSE(memory_resource.owns(large));
+  EXPECT_EQ(memory_resource.mapped_bytes(), size_t{0});
+}
+
+TEST_F(HugePageMemoryResourceTest, AlignsBeyondHugePages) {
+  auto memory_resource = HugePageMemoryResource{_huge_page_bytes};
+
+  auto* const pointer = memory_resource.allocate(_huge_page_bytes, 4 * _huge_page_bytes);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(pointer) % (4 * _huge_page_bytes), size_t{0});
+  memory_resource.deallocate(pointer, _huge_page_bytes, 4 * _huge_page_bytes);
+}
+
+TEST_F(HugePageMemoryResourceTest, ExplicitHugePagesFallBack) {
+  // Explicit huge pages are only available if they were reserved, which is not the case on most test machines. The
+  // allocation then falls back to transparent huge pages.
+  auto memory_resource = HugePageMemoryResource{_huge_page_bytes, HugePageSize::Explicit2MB};
+
+  auto* const pointer = memory_resource.allocate(_huge_page_bytes, 8);
+  std::memset(pointer, 42, _huge_page_bytes);
+  EXPECT_TRUE(memory_resource.owns(pointer));
+  EXPECT_LE(memory_resource.fallback_count(), size_t{1});
+  memory_resource.deallocate(pointer, _huge_page_bytes, 8);
+}
+
+TEST_F(HugePageMemoryResourceTest, DefaultResource) {
+  auto* const default_resource = boost::container::pmr::get_default_resource();
+  EXPECT_EQ(HugePageMemoryResource::default_resource_instance(), nullptr);
+
+  HugePageMemoryResource::enable_for_default_resource(_huge_page_bytes);
+  auto* const huge_page_resource = HugePageMemoryResource::default_resource_instance();
+  ASSERT_NE(huge_page_resource, nullptr);
+  EXPECT_EQ(huge_page_resource->threshold(), _huge_page_bytes);
+
+  auto* const small = default_resource->allocate(_huge_page_bytes - 1, 8);
+  auto* const large = default_resource->allocate(_huge_page_bytes, 8);
+  EXPECT_FALSE(huge_page_resource->owns(small));
+  EXPECT_TRUE(huge_page_resource->owns(large));
+
+  // Allocations made while huge pages were enabled are freed correctly afterwards
+  HugePageMemoryResource::disable_for_default_resource();
+  EXPECT_EQ(HugePageMemoryResource::default_resource_instance(), nullptr);
+  default_resource->deallocate(large, _huge_page_bytes, 8);
+  default_resource->deallocate(small, _huge_page_bytes - 1, 8);
+  EXPECT_FALSE(huge_page_resource->owns(large));
+
+  auto* const after_disabling = default_resource->allocate(_huge_page_bytes, 8);
+  EXPECT_FALSE(huge_page_resource->owns(after_disabling));
+  default_resource->deallocate(after_disabling, _huge_page_bytes, 8);
+}
+
+TEST_F(HugePageMemoryResourceTest, DefaultResourceByNode) {
+  EXPECT_EQ(HugePageMemoryResource::default_resource_instance(0), nullptr);
+
+  HugePageMemoryResource::enable_for_default_resource();
+  auto* const node_resource = HugePageMemoryResource::default_resource_instance(0);
+  ASSERT_NE(node_resource, nullptr);
+  EXPECT_EQ(HugePageMemoryResource::default_resource_instance(0), node_resource);
+  EXPECT_NE(HugePageMemoryResource::default_resource_instance(), node_resource);
+
+  auto* const pointer = node_resource->allocate(_huge_page_bytes, 8);
+  std::memset(pointer, 42, _huge_page_bytes);
+  EXPECT_TRUE(HugePageMemoryResource::deallocate_from_default_resource(pointer));
+  EXPECT_FALSE(node_resource->owns(pointer));
+}
+
+TEST_F(HugePageMemoryResourceTest, ThresholdOfDefaultResource) {
+  EXPECT_THROW(HugePageMemoryResource::enable_for_default_resource(HugePageMemoryResource::MIN_THRESHOLD / 2),
+               std::logic_error);
+}
+
+}  // namespace opossum
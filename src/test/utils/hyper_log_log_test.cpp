@@ -0,0 +1,77 @@
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "utils/hyper_log_log.hpp"
+
+namespace opossum {
+
+TEST(HyperLogLogTest, EstimatesFewValues) {
+  auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0u);
+
+  for (auto repetition = 0; repetition < 3; ++repetition) {
+    for (auto value = 0; value < 100; ++value) {
+      sketch.add(value);
+    }
+  }
+
+  // Few values are counted almost exactly, and in the sparse form
+  EXPECT_TRUE(sketch.is_sparse());
+  EXPECT_NEAR(static_cast<double>(sketch.estimate()), 100.0, 3.0);
+}
+
+TEST(HyperLogLogTest, EstimatesManyValues) {
+  auto sketch = HyperLogLog{};
+  for (auto value = int64_t{0}; value < 1'000'000; ++value) {
+    sketch.add(value);
+  }
+
+  EXPECT_FALSE(sketch.is_sparse());
+  EXPECT_EQ(sketch.dense_registers().size(), HyperLogLog::REGISTER_COUNT);
+  EXPECT_NEAR(static_cast<double>(sketch.estimate()), 1'000'000.0, 100'000.0);
+
+  auto string_sketch = HyperLogLog{};
+  for (auto value = 0; value < 20'000; ++value) {
+    string_sketch.add(std::to_string(value % 10'000));
+  }
+  EXPECT_NEAR(static_cast<double>(string_sketch.estimate()), 10'000.0, 1'000.0);
+}
+
+TEST(HyperLogLogTest, Merge) {
+  auto all_values = HyperLogLog{};
+  auto even_values = HyperLogLog{};
+  auto odd_values = HyperLogLog{};
+  auto few_values = HyperLogLog{};
+  for (auto value = 0; value < 50'000; ++value) {
+    all_values.add(value);
+    (value % 2 == 0 ? even_values : odd_values).add(value);
+    if (value < 10) few_values.add(value);
+  }
+
+  // Merging keeps the maximum of each register, so the merged sketch equals that of all values
+  even_values.merge(odd_values);
+  EXPECT_EQ(even_values.dense_registers(), all_values.dense_registers());
+  even_values.merge(few_values);
+  EXPECT_EQ(even_values.dense_registers(), all_values.dense_registers());
+
+  // A sparse sketch becomes dense when a dense one is merged into it
+  few_values.merge(all_values);
+  EXPECT_FALSE(few_values.is_sparse());
+  EXPECT_EQ(few_values.estimate(), all_values.estimate());
+}
+
+TEST(HyperLogLogTest, Restore) {
+  auto sketch = HyperLogLog{};
+  for (auto value = 0; value < 100; ++value) {
+    sketch.add(value);
+  }
+
+  const auto restored_sketch = HyperLogLog{sketch.sparse_registers(), sketch.dense_registers()};
+  EXPECT_EQ(restored_sketch.sparse_registers(), sketch.sparse_registers());
+  EXPECT_EQ(restored_sketch.estimate(), sketch.estimate());
+
+  EXPECT_THROW(HyperLogLog({1u}, std::vector<uint8_t>(HyperLogLog::REGISTER_COUNT)), std::logic_error);
+}
+
+}  // namespace opossum
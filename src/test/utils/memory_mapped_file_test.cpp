@@ -0,0 +1,61 @@
+#include <fstream>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/filesystem.hpp"
+#include "utils/memory_mapped_file.hpp"
+
+namespace opossum {
+
+class MemoryMappedFileTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::ofstream file{filename, std::ios::binary};
+    file << "abcdefgh";
+  }
+
+  void TearDown() override { filesystem::remove(filename); }
+
+  const std::string filename = test_data_path + "memory_mapped_file_test.bin";
+};
+
+TEST_F(MemoryMappedFileTest, ReadSequentially) {
+  auto file = MemoryMappedFile{filename};
+  EXPECT_EQ(file.size(), 8u);
+
+  EXPECT_EQ(std::string(file.read(3), 3), "abc");
+  EXPECT_EQ(file.position(), 3u);
+  EXPECT_EQ(std::string(file.read(5), 5), "defgh");
+  EXPECT_EQ(file.position(), 8u);
+
+  EXPECT_THROW(file.read(1), std::logic_error);
+}
+
+TEST_F(MemoryMappedFileTest, ViewsHaveTheirOwnPosition) {
+  auto view = MemoryMappedFile{filename}.at(5);
+
+  // The view keeps the mapping alive after the file was destroyed
+  EXPECT_EQ(view.position(), 5u);
+  EXPECT_EQ(std::string(view.read(3), 3), "fgh");
+  EXPECT_EQ(std::string(view.at(1).read(2), 2), "bc");
+  EXPECT_EQ(view.position(), 8u);
+
+  EXPECT_THROW(view.at(9), std::logic_error);
+}
+
+TEST_F(MemoryMappedFileTest, EmptyFile) {
+  { std::ofstream file{filename, std::ios::binary | std::ios::trunc}; }
+
+  auto file = MemoryMappedFile{filename};
+  EXPECT_EQ(file.size(), 0u);
+  EXPECT_EQ(file.data(), nullptr);
+  EXPECT_THROW(file.read(1), std::logic_error);
+}
+
+TEST_F(MemoryMappedFileTest, FileDoesNotExist) {
+  EXPECT_THROW(MemoryMappedFile{test_data_path + "not_existing_file"}, std::logic_error);
+}
+
+}  // namespace opossum
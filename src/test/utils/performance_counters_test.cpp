@@ -0,0 +1,52 @@
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/table_wrapper.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace opossum {
+
+class PerformanceCountersTest : public BaseTest {
+ protected:
+  void TearDown() override { PerformanceCounters::set_enabled(false); }
+};
+
+TEST_F(PerformanceCountersTest, Arithmetic) {
+  auto values = PerformanceCounterValues{100, 250, 10, 5, 3};
+  values += PerformanceCounterValues{100, 150, 2, 1, 1};
+  EXPECT_EQ(values.cycles, 200u);
+  EXPECT_EQ(values.instructions, 400u);
+  EXPECT_EQ(values.cache_misses, 12u);
+  EXPECT_EQ(values.tlb_misses, 6u);
+  EXPECT_EQ(values.branch_misses, 4u);
+  EXPECT_DOUBLE_EQ(values.instructions_per_cycle(), 2.0);
+
+  const auto difference = values - PerformanceCounterValues{50, 100, 2, 1, 1};
+  EXPECT_EQ(difference.cycles, 150u);
+  EXPECT_EQ(difference.instructions, 300u);
+  EXPECT_EQ(difference.cache_misses, 10u);
+
+  EXPECT_DOUBLE_EQ(PerformanceCounterValues{}.instructions_per_cycle(), 0.0);
+  EXPECT_EQ(values.to_json()["instructions_per_cycle"], 2.0);
+}
+
+TEST_F(PerformanceCountersTest, OperatorPerformanceData) {
+  const auto table = load_table("resources/test_data/tbl/int_float.tbl");
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  EXPECT_FALSE(table_wrapper->performance_data().performance_counters);
+
+  // Sandboxes and virtual machines often do not permit access to the counters
+  if (!PerformanceCounters::read()) GTEST_SKIP();
+
+  PerformanceCounters::set_enabled(true);
+  table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto& performance_counters = table_wrapper->performance_data().performance_counters;
+  ASSERT_TRUE(performance_counters);
+  EXPECT_GT(performance_counters->instructions, 0u);
+  EXPECT_GT(performance_counters->cycles, 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "utils/arena_memory_resource.hpp"
+#include "utils/tracking_memory_resource.hpp"
+
+namespace opossum {
+
+class TrackingMemoryResourceTest : public BaseTest {};
+
+TEST_F(TrackingMemoryResourceTest, CountsAllocatedBytes) {
+  auto memory_resource = TrackingMemoryResource{};
+  EXPECT_EQ(memory_resource.limit(), std::nullopt);
+  EXPECT_EQ(memory_resource.remaining_bytes(), std::nullopt);
+
+  {
+    auto values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{&memory_resource});
+    EXPECT_EQ(memory_resource.allocated_bytes(), 400u);
+
+    auto more_values = pmr_vector<int32_t>(50, PolymorphicAllocator<int32_t>{&memory_resource});
+    EXPECT_EQ(memory_resource.allocated_bytes(), 600u);
+  }
+
+  EXPECT_EQ(memory_resource.allocated_bytes(), 0u);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 600u);
+}
+
+TEST_F(TrackingMemoryResourceTest, EnforcesLimit) {
+  auto memory_resource = TrackingMemoryResource{nullptr, size_t{1'000}};
+
+  auto values = pmr_vector<int32_t>(200, PolymorphicAllocator<int32_t>{&memory_resource});
+  EXPECT_EQ(memory_resource.remaining_bytes(), 200u);
+
+  EXPECT_THROW(pmr_vector<int32_t>(51, PolymorphicAllocator<int32_t>{&memory_resource}), MemoryLimitExceededException);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 800u);
+
+  // The failed allocation neither counts towards the current nor towards the peak usage
+  auto more_values = pmr_vector<int32_t>(50, PolymorphicAllocator<int32_t>{&memory_resource});
+  EXPECT_EQ(memory_resource.remaining_bytes(), 0u);
+  EXPECT_EQ(memory_resource.peak_allocated_bytes(), 1'000u);
+}
+
+TEST_F(TrackingMemoryResourceTest, AllocatesFromUpstream) {
+  const auto arena = std::make_shared<ArenaMemoryResource>();
+  auto memory_resource = TrackingMemoryResource{arena};
+
+  auto values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{&memory_resource});
+  EXPECT_GT(arena->reserved_bytes(), 0u);
+  EXPECT_EQ(memory_resource.allocated_bytes(), 400u);
+}
+
+TEST_F(TrackingMemoryResourceTest, Nested) {
+  const auto query_memory_resource = std::make_shared<TrackingMemoryResource>(nullptr, size_t{1'000});
+  auto operator_memory_resource = TrackingMemoryResource{query_memory_resource};
+
+  // The nested resource counts its own allocations, but is bound by the limit of the upstream resource
+  auto values = pmr_vector<int32_t>(100, PolymorphicAllocator<int32_t>{&operator_memory_resource});
+  auto other_values = pmr_vector<int32_t>(50, PolymorphicAllocator<int32_t>{query_memory_resource.get()});
+  EXPECT_EQ(operator_memory_resource.allocated_bytes(), 400u);
+  EXPECT_EQ(query_memory_resource->allocated_bytes(), 600u);
+  EXPECT_EQ(operator_memory_resource.remaining_bytes(), 400u);
+
+  EXPECT_THROW(pmr_vector<int32_t>(101, PolymorphicAllocator<int32_t>{&operator_memory_resource}),
+               MemoryLimitExceededException);
+  EXPECT_EQ(operator_memory_resource.allocated_bytes(), 400u);
+}
+
+}  // namespace opossum
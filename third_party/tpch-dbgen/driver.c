@@ -114,7 +114,7 @@ double flt_scale;
 char *spawn_args[25];
 #endif
 #ifdef RNG_TEST
-extern seed_t Seed[];
+extern _Thread_local seed_t Seed[];  /* HYRISE: thread-local, see rnd.c */
 #endif
 static int bTableSet = 0;
 
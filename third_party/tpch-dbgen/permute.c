@@ -82,7 +82,7 @@ void	permute(long *set, int cnt, long stream);
 void	permute_dist(distribution *d, long stream);
 long seed;
 char *eol[2] = {" ", "},"};
-extern seed_t Seed[];
+extern _Thread_local seed_t Seed[];  /* HYRISE: thread-local, see rnd.c */
 #ifdef TEST
 tdef tdefs = { NULL };
 #endif
@@ -95,8 +95,9 @@ tdef tdefs = { NULL };
 void	permute(long *a, int c, long s)
 {
     int i;
-    static DSS_HUGE source;
-    static long *set, temp;
+    /* HYRISE: not static, so that multiple threads can permute */
+    DSS_HUGE source;
+    long temp;
     
 	if (a != (long *)NULL)
 	{
@@ -236,7 +236,11 @@ UnifInt(DSS_HUGE nLow, DSS_HUGE nHigh, long nStream)
     return (nLow + nTemp);
 }
 
-seed_t Seed[MAX_STREAM + 1] =
+/**
+ * HYRISE: The streams are thread-local, so that the TpchTableGenerator can generate row ranges of the tables in
+ * parallel. Each thread resets its streams with dbgen_reset_seeds() and advances them to the first row of its range.
+ */
+_Thread_local seed_t Seed[MAX_STREAM + 1] =
 {
 {PART,   1,          0,	1},					/* P_MFG_SD     0 */
 {PART,   46831694,   0, 1},					/* P_BRND_SD    1 */
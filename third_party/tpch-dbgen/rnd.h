@@ -55,4 +55,9 @@ extern double dM;
  * preferred solution, but not initializing correctly
  */
 #define VSTR_MAX(len)	(long)(len / 5 + (len % 5 == 0)?0:1 + 1)
-extern seed_t     Seed[MAX_STREAM + 1];
\ No newline at end of file
+/* HYRISE: thread-local, see rnd.c. The header is also included by C++ code. */
+#ifdef __cplusplus
+extern thread_local seed_t Seed[MAX_STREAM + 1];
+#else
+extern _Thread_local seed_t Seed[MAX_STREAM + 1];
+#endif
\ No newline at end of file
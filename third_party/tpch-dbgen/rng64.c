@@ -59,7 +59,7 @@
 #include "rng64.h"
 extern double dM;
 
-extern seed_t Seed[];
+extern _Thread_local seed_t Seed[];  /* HYRISE: thread-local, see rnd.c */
 
 void
 dss_random64(DSS_HUGE *tgt, DSS_HUGE nLow, DSS_HUGE nHigh, long nStream)